@@ -0,0 +1,735 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * AES using the AES-NI instructions. See "Intel Advanced Encryption Standard
+ * (AES) New Instructions Set" by Shay Gueron for a description of the
+ * instructions. The round keys are stored in the context as big-endian words
+ * so that the T-table and AES-NI code can share struct aes*_ctx, which means
+ * the words are byte swapped when they are moved to and from the registers.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "aes-internal.h"
+#include "aes.h"
+#include "bswap.h"
+
+#if defined(HAVE_AESNI_INTRINSICS)
+
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#define AESNI_TARGET __attribute__ ((target (AESNI_TARGET_ATTRIBUTE)))
+
+/* Converts between the big-endian words in ctx and the AES-NI byte order. */
+AESNI_TARGET static inline __m128i
+aesni_bswap32 (__m128i x)
+{
+  const __m128i mask
+      = _mm_set_epi8 (12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+  return _mm_shuffle_epi8 (x, mask);
+}
+
+AESNI_TARGET static inline __m128i
+aesni_load_rk (const uint32_t *rk)
+{
+  return aesni_bswap32 (_mm_loadu_si128 ((const __m128i *)rk));
+}
+
+AESNI_TARGET static inline void
+aesni_store_rk (uint32_t *rk, __m128i x)
+{
+  _mm_storeu_si128 ((__m128i *)rk, aesni_bswap32 (x));
+}
+
+/*
+ * SubWord (RotWord (x)) and SubWord (x) for the key schedule. AESKEYGENASSIST
+ * computes both of them for the second word of its input. The round constant
+ * is XORed in by the caller since the instruction only takes an immediate.
+ */
+AESNI_TARGET static inline uint32_t
+aesni_rot_sub_word (uint32_t x)
+{
+  __m128i t;
+
+  t = _mm_aeskeygenassist_si128 (_mm_set_epi32 (0, 0, (int)x, 0), 0);
+  return (uint32_t)_mm_cvtsi128_si32 (_mm_shuffle_epi32 (t, 0x55));
+}
+
+AESNI_TARGET static inline uint32_t
+aesni_sub_word (uint32_t x)
+{
+  __m128i t;
+
+  t = _mm_aeskeygenassist_si128 (_mm_set_epi32 (0, 0, (int)x, 0), 0);
+  return (uint32_t)_mm_cvtsi128_si32 (t);
+}
+
+/*
+ * Key expansion from FIPS 197 5.2. The words are kept in AES-NI byte order
+ * (the first key byte in the low byte) while expanding and swapped into the
+ * big-endian form used by ctx when they are stored.
+ */
+AESNI_TARGET static void
+aesni_expand_key (uint32_t *ek, const uint8_t *key, unsigned int nk,
+                  unsigned int rounds)
+{
+  uint32_t w[60];
+  uint32_t t, rcon;
+  unsigned int i;
+
+  memcpy (w, key, nk * 4);
+  rcon = 0x01;
+  for (i = nk; i < 4 * (rounds + 1); ++i)
+    {
+      t = w[i - 1];
+      if (i % nk == 0)
+        {
+          t = aesni_rot_sub_word (t) ^ rcon;
+          rcon = ((rcon << 1) ^ (((rcon >> 7) & 1) * 0x1b)) & 0xff;
+        }
+      else if (nk > 6 && i % nk == 4)
+        t = aesni_sub_word (t);
+      w[i] = w[i - nk] ^ t;
+    }
+
+  for (i = 0; i < 4 * (rounds + 1); i += 4)
+    aesni_store_rk (ek + i, _mm_loadu_si128 ((const __m128i *)(w + i)));
+}
+
+/*
+ * Key expansion of up to AES_KEY_BATCH keys, four to a vector with word i of
+ * key j in lane j % 4 of w[i][j / 4]. SubWord of all four lanes is one
+ * AESENCLAST with the ShiftRows undone by a byte shuffle beforehand, which
+ * also does the RotWord. The round constant goes in as the round key.
+ */
+AESNI_TARGET static void
+aesni_expand_keys (uint32_t *const *ek, const uint8_t *const *key, size_t n,
+                   unsigned int nk)
+{
+  const __m128i rot_isr
+      = _mm_setr_epi8 (1, 14, 11, 4, 5, 2, 15, 8, 9, 6, 3, 12, 13, 10, 7, 0);
+  const __m128i isr
+      = _mm_setr_epi8 (0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3);
+  __m128i w[60][AES_KEY_BATCH / 4];
+  __m128i t, a, b, c, d;
+  uint32_t x[4];
+  unsigned int i, rounds;
+  size_t j, k, nv;
+  int rcon;
+
+  rounds = nk + 6;
+  nv = (n + 3) / 4;
+  for (i = 0; i < nk; ++i)
+    for (j = 0; j < nv; ++j)
+      {
+        /* Lanes past n repeat the last key and are not stored. */
+        for (k = 0; k < 4; ++k)
+          memcpy (&x[k], key[4 * j + k < n ? 4 * j + k : n - 1] + i * 4, 4);
+        w[i][j] = _mm_loadu_si128 ((const __m128i *)x);
+      }
+  rcon = 0x01;
+  for (i = nk; i < 4 * (rounds + 1); ++i)
+    {
+      for (j = 0; j < nv; ++j)
+        {
+          t = w[i - 1][j];
+          if (i % nk == 0)
+            t = _mm_aesenclast_si128 (_mm_shuffle_epi8 (t, rot_isr),
+                                      _mm_set1_epi32 (rcon));
+          else if (nk > 6 && i % nk == 4)
+            t = _mm_aesenclast_si128 (_mm_shuffle_epi8 (t, isr),
+                                      _mm_setzero_si128 ());
+          w[i][j] = _mm_xor_si128 (w[i - nk][j], t);
+        }
+      if (i % nk == 0)
+        rcon = ((rcon << 1) ^ (((rcon >> 7) & 1) * 0x1b)) & 0xff;
+    }
+
+  /* Transpose each group of four words into the round keys of four keys. */
+  for (i = 0; i < 4 * (rounds + 1); i += 4)
+    for (j = 0; j < nv; ++j)
+      {
+        a = _mm_unpacklo_epi32 (w[i][j], w[i + 1][j]);
+        b = _mm_unpacklo_epi32 (w[i + 2][j], w[i + 3][j]);
+        c = _mm_unpackhi_epi32 (w[i][j], w[i + 1][j]);
+        d = _mm_unpackhi_epi32 (w[i + 2][j], w[i + 3][j]);
+        k = 4 * j;
+        aesni_store_rk (ek[k] + i, _mm_unpacklo_epi64 (a, b));
+        if (k + 1 < n)
+          aesni_store_rk (ek[k + 1] + i, _mm_unpackhi_epi64 (a, b));
+        if (k + 2 < n)
+          aesni_store_rk (ek[k + 2] + i, _mm_unpacklo_epi64 (c, d));
+        if (k + 3 < n)
+          aesni_store_rk (ek[k + 3] + i, _mm_unpackhi_epi64 (c, d));
+      }
+}
+
+/*
+ * Round keys for the equivalent inverse cipher, FIPS 197 5.3.5. The same
+ * layout is produced by the T-table code in aes.c.
+ */
+AESNI_TARGET static void
+aesni_invert_key (uint32_t *dk, const uint32_t *ek, unsigned int rounds)
+{
+  unsigned int i;
+
+  aesni_store_rk (dk, aesni_load_rk (ek + rounds * 4));
+  for (i = 1; i < rounds; ++i)
+    aesni_store_rk (dk + i * 4,
+                    _mm_aesimc_si128 (aesni_load_rk (ek + (rounds - i) * 4)));
+  aesni_store_rk (dk + rounds * 4, aesni_load_rk (ek));
+}
+
+AESNI_TARGET static inline void
+aesni_encrypt (const uint32_t *ek, unsigned int rounds, const uint8_t *src,
+               uint8_t *dest)
+{
+  __m128i x;
+  unsigned int i;
+
+  x = _mm_xor_si128 (_mm_loadu_si128 ((const __m128i *)src),
+                     aesni_load_rk (ek));
+  for (i = 1; i < rounds; ++i)
+    x = _mm_aesenc_si128 (x, aesni_load_rk (ek + i * 4));
+  x = _mm_aesenclast_si128 (x, aesni_load_rk (ek + rounds * 4));
+  _mm_storeu_si128 ((__m128i *)dest, x);
+}
+
+AESNI_TARGET static inline void
+aesni_decrypt (const uint32_t *dk, unsigned int rounds, const uint8_t *src,
+               uint8_t *dest)
+{
+  __m128i x;
+  unsigned int i;
+
+  x = _mm_xor_si128 (_mm_loadu_si128 ((const __m128i *)src),
+                     aesni_load_rk (dk));
+  for (i = 1; i < rounds; ++i)
+    x = _mm_aesdec_si128 (x, aesni_load_rk (dk + i * 4));
+  x = _mm_aesdeclast_si128 (x, aesni_load_rk (dk + rounds * 4));
+  _mm_storeu_si128 ((__m128i *)dest, x);
+}
+
+/* Number of blocks kept in flight by the modes. */
+#define AESNI_BLOCKS 8
+
+AESNI_TARGET static inline __m128i
+aesni_ctr_block (uint64_t hi, uint64_t lo)
+{
+  return _mm_set_epi64x ((long long)cpu_to_be64 (lo),
+                         (long long)cpu_to_be64 (hi));
+}
+
+/* Applies one AES-NI instruction to all of the blocks in flight. */
+#define AESNI_ROUND8(f, k)                                                    \
+  do                                                                          \
+    {                                                                         \
+      x0 = f (x0, (k));                                                       \
+      x1 = f (x1, (k));                                                       \
+      x2 = f (x2, (k));                                                       \
+      x3 = f (x3, (k));                                                       \
+      x4 = f (x4, (k));                                                       \
+      x5 = f (x5, (k));                                                       \
+      x6 = f (x6, (k));                                                       \
+      x7 = f (x7, (k));                                                       \
+    }                                                                         \
+  while (0)
+
+#define AESNI_XOR_STORE(dest, src, i, x)                                      \
+  _mm_storeu_si128 ((__m128i *)((dest) + (i) * 16),                           \
+                    _mm_xor_si128 ((x), _mm_loadu_si128 ((const __m128i *)    \
+                                                         ((src) + (i) * 16))))
+
+/*
+ * CTR mode with AESNI_BLOCKS independent counter blocks per iteration, which
+ * keeps the pipelined AESENC unit busy. The round keys are loaded once per
+ * call instead of once per block.
+ */
+AESNI_TARGET static void
+aesni_ctr_crypt (const uint32_t *ek, unsigned int rounds, uint8_t *ctr,
+                 const uint8_t *src, uint8_t *dest, size_t len)
+{
+  __m128i rk[AES256_ROUNDS + 1];
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+  uint8_t buffer[AES_BLOCK_SIZE];
+  uint64_t hi, lo;
+  unsigned int i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = aesni_load_rk (ek + i * 4);
+
+  aes_ctr_load (ctr, &hi, &lo);
+  while (len >= AESNI_BLOCKS * AES_BLOCK_SIZE)
+    {
+      x0 = aesni_ctr_block (hi, lo);
+      x1 = aesni_ctr_block (hi + (lo > (uint64_t)-2), lo + 1);
+      x2 = aesni_ctr_block (hi + (lo > (uint64_t)-3), lo + 2);
+      x3 = aesni_ctr_block (hi + (lo > (uint64_t)-4), lo + 3);
+      x4 = aesni_ctr_block (hi + (lo > (uint64_t)-5), lo + 4);
+      x5 = aesni_ctr_block (hi + (lo > (uint64_t)-6), lo + 5);
+      x6 = aesni_ctr_block (hi + (lo > (uint64_t)-7), lo + 6);
+      x7 = aesni_ctr_block (hi + (lo > (uint64_t)-8), lo + 7);
+      hi += (lo > (uint64_t)-9);
+      lo += 8;
+
+      AESNI_ROUND8 (_mm_xor_si128, rk[0]);
+      for (i = 1; i < rounds; ++i)
+        AESNI_ROUND8 (_mm_aesenc_si128, rk[i]);
+      AESNI_ROUND8 (_mm_aesenclast_si128, rk[rounds]);
+
+      AESNI_XOR_STORE (dest, src, 0, x0);
+      AESNI_XOR_STORE (dest, src, 1, x1);
+      AESNI_XOR_STORE (dest, src, 2, x2);
+      AESNI_XOR_STORE (dest, src, 3, x3);
+      AESNI_XOR_STORE (dest, src, 4, x4);
+      AESNI_XOR_STORE (dest, src, 5, x5);
+      AESNI_XOR_STORE (dest, src, 6, x6);
+      AESNI_XOR_STORE (dest, src, 7, x7);
+      src += AESNI_BLOCKS * AES_BLOCK_SIZE;
+      dest += AESNI_BLOCKS * AES_BLOCK_SIZE;
+      len -= AESNI_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  /* Remaining blocks one at a time, including a partial block. */
+  while (len > 0)
+    {
+      x0 = _mm_xor_si128 (aesni_ctr_block (hi, lo), rk[0]);
+      if (++lo == 0)
+        ++hi;
+      for (i = 1; i < rounds; ++i)
+        x0 = _mm_aesenc_si128 (x0, rk[i]);
+      x0 = _mm_aesenclast_si128 (x0, rk[rounds]);
+      if (len < AES_BLOCK_SIZE)
+        {
+          _mm_storeu_si128 ((__m128i *)buffer, x0);
+          for (i = 0; i < len; ++i)
+            dest[i] = src[i] ^ buffer[i];
+          break;
+        }
+      AESNI_XOR_STORE (dest, src, 0, x0);
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+      len -= AES_BLOCK_SIZE;
+    }
+  aes_ctr_store (ctr, hi, lo);
+}
+
+/* Loads AESNI_BLOCKS blocks into x0 through x7 and adds the first key. */
+#define AESNI_LOAD8(src, k)                                                   \
+  do                                                                          \
+    {                                                                         \
+      x0 = _mm_loadu_si128 ((const __m128i *)((src) + 0 * 16));               \
+      x1 = _mm_loadu_si128 ((const __m128i *)((src) + 1 * 16));               \
+      x2 = _mm_loadu_si128 ((const __m128i *)((src) + 2 * 16));               \
+      x3 = _mm_loadu_si128 ((const __m128i *)((src) + 3 * 16));               \
+      x4 = _mm_loadu_si128 ((const __m128i *)((src) + 4 * 16));               \
+      x5 = _mm_loadu_si128 ((const __m128i *)((src) + 5 * 16));               \
+      x6 = _mm_loadu_si128 ((const __m128i *)((src) + 6 * 16));               \
+      x7 = _mm_loadu_si128 ((const __m128i *)((src) + 7 * 16));               \
+      AESNI_ROUND8 (_mm_xor_si128, (k));                                      \
+    }                                                                         \
+  while (0)
+
+#define AESNI_STORE8(dest)                                                    \
+  do                                                                          \
+    {                                                                         \
+      _mm_storeu_si128 ((__m128i *)((dest) + 0 * 16), x0);                    \
+      _mm_storeu_si128 ((__m128i *)((dest) + 1 * 16), x1);                    \
+      _mm_storeu_si128 ((__m128i *)((dest) + 2 * 16), x2);                    \
+      _mm_storeu_si128 ((__m128i *)((dest) + 3 * 16), x3);                    \
+      _mm_storeu_si128 ((__m128i *)((dest) + 4 * 16), x4);                    \
+      _mm_storeu_si128 ((__m128i *)((dest) + 5 * 16), x5);                    \
+      _mm_storeu_si128 ((__m128i *)((dest) + 6 * 16), x6);                    \
+      _mm_storeu_si128 ((__m128i *)((dest) + 7 * 16), x7);                    \
+    }                                                                         \
+  while (0)
+
+AESNI_TARGET static void
+aesni_ecb_encrypt (const uint32_t *ek, unsigned int rounds, const uint8_t *src,
+                   uint8_t *dest, size_t blocks)
+{
+  __m128i rk[AES256_ROUNDS + 1];
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+  unsigned int i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = aesni_load_rk (ek + i * 4);
+
+  for (; blocks >= AESNI_BLOCKS; blocks -= AESNI_BLOCKS)
+    {
+      AESNI_LOAD8 (src, rk[0]);
+      for (i = 1; i < rounds; ++i)
+        AESNI_ROUND8 (_mm_aesenc_si128, rk[i]);
+      AESNI_ROUND8 (_mm_aesenclast_si128, rk[rounds]);
+      AESNI_STORE8 (dest);
+      src += AESNI_BLOCKS * AES_BLOCK_SIZE;
+      dest += AESNI_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      aesni_encrypt (ek, rounds, src, dest);
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+}
+
+AESNI_TARGET static void
+aesni_ecb_decrypt (const uint32_t *dk, unsigned int rounds, const uint8_t *src,
+                   uint8_t *dest, size_t blocks)
+{
+  __m128i rk[AES256_ROUNDS + 1];
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+  unsigned int i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = aesni_load_rk (dk + i * 4);
+
+  for (; blocks >= AESNI_BLOCKS; blocks -= AESNI_BLOCKS)
+    {
+      AESNI_LOAD8 (src, rk[0]);
+      for (i = 1; i < rounds; ++i)
+        AESNI_ROUND8 (_mm_aesdec_si128, rk[i]);
+      AESNI_ROUND8 (_mm_aesdeclast_si128, rk[rounds]);
+      AESNI_STORE8 (dest);
+      src += AESNI_BLOCKS * AES_BLOCK_SIZE;
+      dest += AESNI_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      aesni_decrypt (dk, rounds, src, dest);
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+}
+
+#define AESNI_LOAD_BLOCK(src, i)                                              \
+  _mm_loadu_si128 ((const __m128i *)((src) + (i) * 16))
+
+/*
+ * CBC decryption of AESNI_BLOCKS blocks at a time. Every ciphertext block is
+ * loaded again for the final XOR, which is still correct when decrypting in
+ * place because the stores come after the loads.
+ */
+AESNI_TARGET static void
+aesni_cbc_decrypt (const uint32_t *dk, unsigned int rounds, uint8_t *iv,
+                   const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  __m128i rk[AES256_ROUNDS + 1];
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+  __m128i prev, c0, c1, c2, c3, c4, c5, c6, c7;
+  unsigned int i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = aesni_load_rk (dk + i * 4);
+
+  prev = _mm_loadu_si128 ((const __m128i *)iv);
+  for (; blocks >= AESNI_BLOCKS; blocks -= AESNI_BLOCKS)
+    {
+      AESNI_LOAD8 (src, rk[0]);
+      for (i = 1; i < rounds; ++i)
+        AESNI_ROUND8 (_mm_aesdec_si128, rk[i]);
+      AESNI_ROUND8 (_mm_aesdeclast_si128, rk[rounds]);
+      c0 = AESNI_LOAD_BLOCK (src, 0);
+      c1 = AESNI_LOAD_BLOCK (src, 1);
+      c2 = AESNI_LOAD_BLOCK (src, 2);
+      c3 = AESNI_LOAD_BLOCK (src, 3);
+      c4 = AESNI_LOAD_BLOCK (src, 4);
+      c5 = AESNI_LOAD_BLOCK (src, 5);
+      c6 = AESNI_LOAD_BLOCK (src, 6);
+      c7 = AESNI_LOAD_BLOCK (src, 7);
+      x0 = _mm_xor_si128 (x0, prev);
+      x1 = _mm_xor_si128 (x1, c0);
+      x2 = _mm_xor_si128 (x2, c1);
+      x3 = _mm_xor_si128 (x3, c2);
+      x4 = _mm_xor_si128 (x4, c3);
+      x5 = _mm_xor_si128 (x5, c4);
+      x6 = _mm_xor_si128 (x6, c5);
+      x7 = _mm_xor_si128 (x7, c6);
+      prev = c7;
+      AESNI_STORE8 (dest);
+      src += AESNI_BLOCKS * AES_BLOCK_SIZE;
+      dest += AESNI_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      c0 = AESNI_LOAD_BLOCK (src, 0);
+      x0 = _mm_xor_si128 (c0, rk[0]);
+      for (i = 1; i < rounds; ++i)
+        x0 = _mm_aesdec_si128 (x0, rk[i]);
+      x0 = _mm_aesdeclast_si128 (x0, rk[rounds]);
+      _mm_storeu_si128 ((__m128i *)dest, _mm_xor_si128 (x0, prev));
+      prev = c0;
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+  _mm_storeu_si128 ((__m128i *)iv, prev);
+}
+
+/*
+ * Multiplies an XTS tweak by x. Both 64-bit halves are shifted left at once,
+ * and the bits shifted out of them are broadcast with an arithmetic shift to
+ * select the carry into the high half and the reduction of the bit shifted
+ * out of the top.
+ */
+AESNI_TARGET static inline __m128i
+aesni_xts_double (__m128i t)
+{
+  __m128i carry;
+
+  carry = _mm_srai_epi32 (_mm_shuffle_epi32 (t, 0x13), 31);
+  carry = _mm_and_si128 (carry, _mm_set_epi32 (0, 1, 0, 0x87));
+  return _mm_xor_si128 (_mm_add_epi64 (t, t), carry);
+}
+
+/* Derives the tweaks of the next AESNI_BLOCKS blocks from t. */
+#define AESNI_XTS_TWEAKS8()                                                   \
+  do                                                                          \
+    {                                                                         \
+      t0 = t;                                                                 \
+      t1 = aesni_xts_double (t0);                                             \
+      t2 = aesni_xts_double (t1);                                             \
+      t3 = aesni_xts_double (t2);                                             \
+      t4 = aesni_xts_double (t3);                                             \
+      t5 = aesni_xts_double (t4);                                             \
+      t6 = aesni_xts_double (t5);                                             \
+      t7 = aesni_xts_double (t6);                                             \
+      t = aesni_xts_double (t7);                                              \
+    }                                                                         \
+  while (0)
+
+#define AESNI_XTS_XOR8()                                                      \
+  do                                                                          \
+    {                                                                         \
+      x0 = _mm_xor_si128 (x0, t0);                                            \
+      x1 = _mm_xor_si128 (x1, t1);                                            \
+      x2 = _mm_xor_si128 (x2, t2);                                            \
+      x3 = _mm_xor_si128 (x3, t3);                                            \
+      x4 = _mm_xor_si128 (x4, t4);                                            \
+      x5 = _mm_xor_si128 (x5, t5);                                            \
+      x6 = _mm_xor_si128 (x6, t6);                                            \
+      x7 = _mm_xor_si128 (x7, t7);                                            \
+    }                                                                         \
+  while (0)
+
+/*
+ * XTS mode with the tweaks kept in registers. The tweak XOR before the
+ * cipher is done after the XOR with the first round key, which commutes with
+ * it.
+ */
+AESNI_TARGET static void
+aesni_xts_encrypt (const uint32_t *ek, unsigned int rounds, uint8_t *tweak,
+                   const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  __m128i rk[AES256_ROUNDS + 1];
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+  __m128i t, t0, t1, t2, t3, t4, t5, t6, t7;
+  unsigned int i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = aesni_load_rk (ek + i * 4);
+
+  t = _mm_loadu_si128 ((const __m128i *)tweak);
+  for (; blocks >= AESNI_BLOCKS; blocks -= AESNI_BLOCKS)
+    {
+      AESNI_XTS_TWEAKS8 ();
+      AESNI_LOAD8 (src, rk[0]);
+      AESNI_XTS_XOR8 ();
+      for (i = 1; i < rounds; ++i)
+        AESNI_ROUND8 (_mm_aesenc_si128, rk[i]);
+      AESNI_ROUND8 (_mm_aesenclast_si128, rk[rounds]);
+      AESNI_XTS_XOR8 ();
+      AESNI_STORE8 (dest);
+      src += AESNI_BLOCKS * AES_BLOCK_SIZE;
+      dest += AESNI_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      x0 = _mm_xor_si128 (AESNI_LOAD_BLOCK (src, 0), t);
+      x0 = _mm_xor_si128 (x0, rk[0]);
+      for (i = 1; i < rounds; ++i)
+        x0 = _mm_aesenc_si128 (x0, rk[i]);
+      x0 = _mm_aesenclast_si128 (x0, rk[rounds]);
+      _mm_storeu_si128 ((__m128i *)dest, _mm_xor_si128 (x0, t));
+      t = aesni_xts_double (t);
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+  _mm_storeu_si128 ((__m128i *)tweak, t);
+}
+
+AESNI_TARGET static void
+aesni_xts_decrypt (const uint32_t *dk, unsigned int rounds, uint8_t *tweak,
+                   const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  __m128i rk[AES256_ROUNDS + 1];
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+  __m128i t, t0, t1, t2, t3, t4, t5, t6, t7;
+  unsigned int i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = aesni_load_rk (dk + i * 4);
+
+  t = _mm_loadu_si128 ((const __m128i *)tweak);
+  for (; blocks >= AESNI_BLOCKS; blocks -= AESNI_BLOCKS)
+    {
+      AESNI_XTS_TWEAKS8 ();
+      AESNI_LOAD8 (src, rk[0]);
+      AESNI_XTS_XOR8 ();
+      for (i = 1; i < rounds; ++i)
+        AESNI_ROUND8 (_mm_aesdec_si128, rk[i]);
+      AESNI_ROUND8 (_mm_aesdeclast_si128, rk[rounds]);
+      AESNI_XTS_XOR8 ();
+      AESNI_STORE8 (dest);
+      src += AESNI_BLOCKS * AES_BLOCK_SIZE;
+      dest += AESNI_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      x0 = _mm_xor_si128 (AESNI_LOAD_BLOCK (src, 0), t);
+      x0 = _mm_xor_si128 (x0, rk[0]);
+      for (i = 1; i < rounds; ++i)
+        x0 = _mm_aesdec_si128 (x0, rk[i]);
+      x0 = _mm_aesdeclast_si128 (x0, rk[rounds]);
+      _mm_storeu_si128 ((__m128i *)dest, _mm_xor_si128 (x0, t));
+      t = aesni_xts_double (t);
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+  _mm_storeu_si128 ((__m128i *)tweak, t);
+}
+
+AESNI_TARGET static void
+aes128_expand_key_aesni (uint32_t *ek, const uint8_t *key)
+{
+  aesni_expand_key (ek, key, 4, AES128_ROUNDS);
+}
+
+AESNI_TARGET static void
+aes192_expand_key_aesni (uint32_t *ek, const uint8_t *key)
+{
+  aesni_expand_key (ek, key, 6, AES192_ROUNDS);
+}
+
+AESNI_TARGET static void
+aes256_expand_key_aesni (uint32_t *ek, const uint8_t *key)
+{
+  aesni_expand_key (ek, key, 8, AES256_ROUNDS);
+}
+
+AESNI_TARGET static void
+aes128_invert_key_aesni (uint32_t *dk, const uint32_t *ek)
+{
+  aesni_invert_key (dk, ek, AES128_ROUNDS);
+}
+
+AESNI_TARGET static void
+aes192_invert_key_aesni (uint32_t *dk, const uint32_t *ek)
+{
+  aesni_invert_key (dk, ek, AES192_ROUNDS);
+}
+
+AESNI_TARGET static void
+aes256_invert_key_aesni (uint32_t *dk, const uint32_t *ek)
+{
+  aesni_invert_key (dk, ek, AES256_ROUNDS);
+}
+
+AESNI_TARGET static void
+aes128_encrypt_aesni (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  aesni_encrypt (ek, AES128_ROUNDS, src, dest);
+}
+
+AESNI_TARGET static void
+aes192_encrypt_aesni (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  aesni_encrypt (ek, AES192_ROUNDS, src, dest);
+}
+
+AESNI_TARGET static void
+aes256_encrypt_aesni (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  aesni_encrypt (ek, AES256_ROUNDS, src, dest);
+}
+
+AESNI_TARGET static void
+aes128_decrypt_aesni (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  aesni_decrypt (dk, AES128_ROUNDS, src, dest);
+}
+
+AESNI_TARGET static void
+aes192_decrypt_aesni (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  aesni_decrypt (dk, AES192_ROUNDS, src, dest);
+}
+
+AESNI_TARGET static void
+aes256_decrypt_aesni (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  aesni_decrypt (dk, AES256_ROUNDS, src, dest);
+}
+
+const struct aes_backend aes_backend_aesni = {
+  "aesni",
+  aes128_expand_key_aesni,
+  aes192_expand_key_aesni,
+  aes256_expand_key_aesni,
+  aes128_invert_key_aesni,
+  aes192_invert_key_aesni,
+  aes256_invert_key_aesni,
+  aes128_encrypt_aesni,
+  aes192_encrypt_aesni,
+  aes256_encrypt_aesni,
+  aes128_decrypt_aesni,
+  aes192_decrypt_aesni,
+  aes256_decrypt_aesni,
+  aesni_ctr_crypt,
+  aesni_ecb_encrypt,
+  aesni_ecb_decrypt,
+  aesni_cbc_decrypt,
+  aesni_expand_keys,
+  aesni_xts_encrypt,
+  aesni_xts_decrypt,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int aes_aesni_unused;
+
+#endif /* HAVE_AESNI_INTRINSICS */
@@ -0,0 +1,337 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * AES using the ARMv8 Cryptography Extensions. AESE performs AddRoundKey,
+ * SubBytes and ShiftRows and AESMC performs MixColumns, so a round is split
+ * differently than in FIPS 197 and the last round key is XORed in at the
+ * end. The key schedule is the one from aes.c since the round keys are
+ * stored in the same big-endian layout.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aes-internal.h"
+#include "aes.h"
+
+#if defined(HAVE_ARM_AES_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define ARM_AES_TARGET __attribute__ ((target (ARM_AES_TARGET_ATTRIBUTE)))
+
+/* Converts the big-endian round key words to the byte order AESE expects. */
+ARM_AES_TARGET static inline uint8x16_t
+armv8_load_rk (const uint32_t *rk)
+{
+  return vrev32q_u8 (vreinterpretq_u8_u32 (vld1q_u32 (rk)));
+}
+
+ARM_AES_TARGET static inline void
+armv8_encrypt (const uint32_t *ek, unsigned int rounds, const uint8_t *src,
+               uint8_t *dest)
+{
+  uint8x16_t x;
+  unsigned int i;
+
+  x = vld1q_u8 (src);
+  for (i = 0; i < rounds - 1; ++i)
+    x = vaesmcq_u8 (vaeseq_u8 (x, armv8_load_rk (ek + i * 4)));
+  x = vaeseq_u8 (x, armv8_load_rk (ek + (rounds - 1) * 4));
+  x = veorq_u8 (x, armv8_load_rk (ek + rounds * 4));
+  vst1q_u8 (dest, x);
+}
+
+ARM_AES_TARGET static inline void
+armv8_decrypt (const uint32_t *dk, unsigned int rounds, const uint8_t *src,
+               uint8_t *dest)
+{
+  uint8x16_t x;
+  unsigned int i;
+
+  x = vld1q_u8 (src);
+  for (i = 0; i < rounds - 1; ++i)
+    x = vaesimcq_u8 (vaesdq_u8 (x, armv8_load_rk (dk + i * 4)));
+  x = vaesdq_u8 (x, armv8_load_rk (dk + (rounds - 1) * 4));
+  x = veorq_u8 (x, armv8_load_rk (dk + rounds * 4));
+  vst1q_u8 (dest, x);
+}
+
+/* Number of blocks kept in flight by the modes. */
+#define ARMV8_BLOCKS 4
+
+ARM_AES_TARGET static inline uint8x16_t
+armv8_ctr_block (uint64_t hi, uint64_t lo)
+{
+  uint8_t block[AES_BLOCK_SIZE];
+
+  aes_ctr_store (block, hi, lo);
+  return vld1q_u8 (block);
+}
+
+/*
+ * CTR mode with ARMV8_BLOCKS independent blocks per iteration so that the
+ * latency of each AESE/AESMC pair is hidden by the other blocks.
+ */
+ARM_AES_TARGET static void
+armv8_ctr_crypt (const uint32_t *ek, unsigned int rounds, uint8_t *ctr,
+                 const uint8_t *src, uint8_t *dest, size_t len)
+{
+  uint8x16_t rk[AES256_ROUNDS + 1];
+  uint8x16_t x[ARMV8_BLOCKS];
+  uint8_t buffer[AES_BLOCK_SIZE];
+  uint64_t hi, lo;
+  unsigned int b, i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = armv8_load_rk (ek + i * 4);
+
+  aes_ctr_load (ctr, &hi, &lo);
+  while (len >= ARMV8_BLOCKS * AES_BLOCK_SIZE)
+    {
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        {
+          x[b] = armv8_ctr_block (hi, lo);
+          if (++lo == 0)
+            ++hi;
+        }
+      for (i = 0; i < rounds - 1; ++i)
+        for (b = 0; b < ARMV8_BLOCKS; ++b)
+          x[b] = vaesmcq_u8 (vaeseq_u8 (x[b], rk[i]));
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        {
+          x[b] = veorq_u8 (vaeseq_u8 (x[b], rk[rounds - 1]), rk[rounds]);
+          vst1q_u8 (dest + b * 16, veorq_u8 (x[b], vld1q_u8 (src + b * 16)));
+        }
+      src += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+      dest += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+      len -= ARMV8_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  /* Remaining blocks one at a time, including a partial block. */
+  while (len > 0)
+    {
+      aes_ctr_store (buffer, hi, lo);
+      if (++lo == 0)
+        ++hi;
+      armv8_encrypt (ek, rounds, buffer, buffer);
+      if (len < AES_BLOCK_SIZE)
+        {
+          for (i = 0; i < len; ++i)
+            dest[i] = src[i] ^ buffer[i];
+          break;
+        }
+      vst1q_u8 (dest, veorq_u8 (vld1q_u8 (buffer), vld1q_u8 (src)));
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+      len -= AES_BLOCK_SIZE;
+    }
+  aes_ctr_store (ctr, hi, lo);
+}
+
+ARM_AES_TARGET static void
+armv8_ecb_encrypt (const uint32_t *ek, unsigned int rounds, const uint8_t *src,
+                   uint8_t *dest, size_t blocks)
+{
+  uint8x16_t rk[AES256_ROUNDS + 1];
+  uint8x16_t x[ARMV8_BLOCKS];
+  unsigned int b, i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = armv8_load_rk (ek + i * 4);
+
+  for (; blocks >= ARMV8_BLOCKS; blocks -= ARMV8_BLOCKS)
+    {
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        x[b] = vld1q_u8 (src + b * 16);
+      for (i = 0; i < rounds - 1; ++i)
+        for (b = 0; b < ARMV8_BLOCKS; ++b)
+          x[b] = vaesmcq_u8 (vaeseq_u8 (x[b], rk[i]));
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        vst1q_u8 (dest + b * 16,
+                  veorq_u8 (vaeseq_u8 (x[b], rk[rounds - 1]), rk[rounds]));
+      src += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+      dest += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      armv8_encrypt (ek, rounds, src, dest);
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+}
+
+ARM_AES_TARGET static void
+armv8_ecb_decrypt (const uint32_t *dk, unsigned int rounds, const uint8_t *src,
+                   uint8_t *dest, size_t blocks)
+{
+  uint8x16_t rk[AES256_ROUNDS + 1];
+  uint8x16_t x[ARMV8_BLOCKS];
+  unsigned int b, i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = armv8_load_rk (dk + i * 4);
+
+  for (; blocks >= ARMV8_BLOCKS; blocks -= ARMV8_BLOCKS)
+    {
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        x[b] = vld1q_u8 (src + b * 16);
+      for (i = 0; i < rounds - 1; ++i)
+        for (b = 0; b < ARMV8_BLOCKS; ++b)
+          x[b] = vaesimcq_u8 (vaesdq_u8 (x[b], rk[i]));
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        vst1q_u8 (dest + b * 16,
+                  veorq_u8 (vaesdq_u8 (x[b], rk[rounds - 1]), rk[rounds]));
+      src += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+      dest += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      armv8_decrypt (dk, rounds, src, dest);
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+}
+
+/* The ciphertext is kept in c so that decrypting in place works. */
+ARM_AES_TARGET static void
+armv8_cbc_decrypt (const uint32_t *dk, unsigned int rounds, uint8_t *iv,
+                   const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  uint8x16_t rk[AES256_ROUNDS + 1];
+  uint8x16_t x[ARMV8_BLOCKS];
+  uint8x16_t c[ARMV8_BLOCKS];
+  uint8x16_t prev;
+  unsigned int b, i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = armv8_load_rk (dk + i * 4);
+
+  prev = vld1q_u8 (iv);
+  for (; blocks >= ARMV8_BLOCKS; blocks -= ARMV8_BLOCKS)
+    {
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        {
+          c[b] = vld1q_u8 (src + b * 16);
+          x[b] = c[b];
+        }
+      for (i = 0; i < rounds - 1; ++i)
+        for (b = 0; b < ARMV8_BLOCKS; ++b)
+          x[b] = vaesimcq_u8 (vaesdq_u8 (x[b], rk[i]));
+      for (b = 0; b < ARMV8_BLOCKS; ++b)
+        {
+          x[b] = veorq_u8 (vaesdq_u8 (x[b], rk[rounds - 1]), rk[rounds]);
+          vst1q_u8 (dest + b * 16, veorq_u8 (x[b], b == 0 ? prev : c[b - 1]));
+        }
+      prev = c[ARMV8_BLOCKS - 1];
+      src += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+      dest += ARMV8_BLOCKS * AES_BLOCK_SIZE;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      c[0] = vld1q_u8 (src);
+      x[0] = c[0];
+      for (i = 0; i < rounds - 1; ++i)
+        x[0] = vaesimcq_u8 (vaesdq_u8 (x[0], rk[i]));
+      x[0] = veorq_u8 (vaesdq_u8 (x[0], rk[rounds - 1]), rk[rounds]);
+      vst1q_u8 (dest, veorq_u8 (x[0], prev));
+      prev = c[0];
+      src += AES_BLOCK_SIZE;
+      dest += AES_BLOCK_SIZE;
+    }
+  vst1q_u8 (iv, prev);
+}
+
+ARM_AES_TARGET static void
+aes128_encrypt_armv8 (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  armv8_encrypt (ek, AES128_ROUNDS, src, dest);
+}
+
+ARM_AES_TARGET static void
+aes192_encrypt_armv8 (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  armv8_encrypt (ek, AES192_ROUNDS, src, dest);
+}
+
+ARM_AES_TARGET static void
+aes256_encrypt_armv8 (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  armv8_encrypt (ek, AES256_ROUNDS, src, dest);
+}
+
+ARM_AES_TARGET static void
+aes128_decrypt_armv8 (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  armv8_decrypt (dk, AES128_ROUNDS, src, dest);
+}
+
+ARM_AES_TARGET static void
+aes192_decrypt_armv8 (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  armv8_decrypt (dk, AES192_ROUNDS, src, dest);
+}
+
+ARM_AES_TARGET static void
+aes256_decrypt_armv8 (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  armv8_decrypt (dk, AES256_ROUNDS, src, dest);
+}
+
+const struct aes_backend aes_backend_armv8 = {
+  "armv8",
+  aes128_expand_key_table,
+  aes192_expand_key_table,
+  aes256_expand_key_table,
+  aes128_invert_key_table,
+  aes192_invert_key_table,
+  aes256_invert_key_table,
+  aes128_encrypt_armv8,
+  aes192_encrypt_armv8,
+  aes256_encrypt_armv8,
+  aes128_decrypt_armv8,
+  aes192_decrypt_armv8,
+  aes256_decrypt_armv8,
+  armv8_ctr_crypt,
+  armv8_ecb_encrypt,
+  armv8_ecb_decrypt,
+  armv8_cbc_decrypt,
+  aes_expand_keys_table,
+  NULL,
+  NULL,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int aes_armv8_unused;
+
+#endif /* HAVE_ARM_AES_INTRINSICS */
@@ -0,0 +1,854 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Constant time AES with NEON, for ARMv8 processors without the Crypto
+ * Extensions. This is the same as aes-bitslice-ssse3.c with TBL in place of
+ * PSHUFB: eight blocks at a time in the bitsliced layout of Kasper and
+ * Schwabe, and up to six blocks one register each with the S-box computed
+ * from 16-entry tables. TBL returns zero for any index past the table, which
+ * serves for the logarithm of zero like the top bit does for PSHUFB.
+ *
+ * The round keys are stored as big-endian words like in the T-table code.
+ * Both directions use them as they are, so the decryption key schedule is a
+ * copy.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "aes-internal.h"
+#include "aes.h"
+#include "bswap.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+/* Blocks in one bitsliced pass. */
+#define NEON_BLOCKS 8
+
+/* Most blocks that are faster one register per block than bitsliced. */
+#define NEON_SMALL_BLOCKS 6
+
+/*
+ * The tables of the small path, derived in aes-bitslice-ssse3.c. The first
+ * pairs split a byte into its coefficients i and j over GF(16), before and
+ * after the inverse affine transform without its constant 0x47.
+ */
+static const uint8_t neon_in_lo[16]
+    = { 0x00, 0x11, 0x9d, 0x8c, 0x56, 0x47, 0xcb, 0xda,
+        0xde, 0xcf, 0x43, 0x52, 0x88, 0x99, 0x15, 0x04 };
+static const uint8_t neon_in_hi[16]
+    = { 0x00, 0x9c, 0x79, 0xe5, 0x50, 0xcc, 0x29, 0xb5,
+        0x1a, 0x86, 0x63, 0xff, 0x4a, 0xd6, 0x33, 0xaf };
+static const uint8_t neon_inv_in_lo[16]
+    = { 0x00, 0x13, 0xd0, 0xc3, 0xb6, 0xa5, 0x66, 0x75,
+        0x51, 0x42, 0x81, 0x92, 0xe7, 0xf4, 0x37, 0x24 };
+static const uint8_t neon_inv_in_hi[16]
+    = { 0x00, 0x35, 0x9f, 0xaa, 0x1b, 0x2e, 0x84, 0xb1,
+        0x3e, 0x0b, 0xa1, 0x94, 0x25, 0x10, 0xba, 0x8f };
+
+/* Logarithms, powers of the generator, 0x0d x^2 and -log x in GF(16). */
+static const uint8_t neon_log[16]
+    = { 0x90, 0x00, 0x01, 0x04, 0x02, 0x08, 0x05, 0x0a,
+        0x03, 0x0e, 0x09, 0x07, 0x06, 0x0d, 0x0b, 0x0c };
+static const uint8_t neon_exp[16]
+    = { 0x01, 0x02, 0x04, 0x08, 0x03, 0x06, 0x0c, 0x0b,
+        0x05, 0x0a, 0x07, 0x0e, 0x0f, 0x0d, 0x09, 0x00 };
+static const uint8_t neon_lambda_sq[16]
+    = { 0x00, 0x09, 0x02, 0x0b, 0x08, 0x01, 0x0a, 0x03,
+        0x06, 0x0f, 0x04, 0x0d, 0x0e, 0x07, 0x0c, 0x05 };
+static const uint8_t neon_neg_log[16]
+    = { 0x90, 0x00, 0x0e, 0x0b, 0x0d, 0x07, 0x0a, 0x05,
+        0x0c, 0x01, 0x06, 0x08, 0x09, 0x02, 0x04, 0x03 };
+
+/* The output coefficients, with and without the affine transform. */
+static const uint8_t neon_out_t[16]
+    = { 0xcf, 0x1e, 0xa5, 0x41, 0xd1, 0xbb, 0xe4, 0x90,
+        0x6a, 0x5f, 0x74, 0xfa, 0x35, 0x2b, 0x8e, 0x00 };
+static const uint8_t neon_out_tb[16]
+    = { 0xd0, 0xaa, 0x17, 0xc5, 0x7a, 0xbd, 0xd2, 0xbf,
+        0xc7, 0x6f, 0x6d, 0x78, 0xa8, 0x02, 0x15, 0x00 };
+static const uint8_t neon_inv_out_t[16]
+    = { 0x12, 0x4b, 0x0f, 0xd8, 0x59, 0x44, 0xd7, 0x81,
+        0x1d, 0x93, 0x56, 0x9c, 0x8e, 0xc5, 0xca, 0x00 };
+static const uint8_t neon_inv_out_tb[16]
+    = { 0x13, 0xaa, 0x53, 0xd4, 0xb9, 0xf9, 0x87, 0x6d,
+        0x40, 0x7e, 0xea, 0x2d, 0x3e, 0x94, 0xc7, 0x00 };
+
+/* Byte permutations for ShiftRows and the rotations of each column. */
+static const uint8_t neon_shift_rows[16]
+    = { 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11 };
+static const uint8_t neon_inv_shift_rows[16]
+    = { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 };
+static const uint8_t neon_rot1[16]
+    = { 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 };
+static const uint8_t neon_rot2[16]
+    = { 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 };
+
+/* ShiftRows followed by the first rotation. */
+static const uint8_t neon_shift_rot1[16]
+    = { 5, 10, 15, 0, 9, 14, 3, 4, 13, 2, 7, 8, 1, 6, 11, 12 };
+
+/* Converts the big-endian round key words to bytes in state order. */
+NEON_TARGET static inline uint8x16_t
+neon_load_rk (const uint32_t *rk)
+{
+  return vrev32q_u8 (vreinterpretq_u8_u32 (vld1q_u32 (rk)));
+}
+
+#define NEON_SHUFFLE(x, mask) vqtbl1q_u8 ((x), vld1q_u8 (mask))
+
+/* Doubles every byte in GF(2^8). */
+NEON_TARGET static inline uint8x16_t
+neon_xtime (uint8x16_t x)
+{
+  uint8x16_t carry;
+
+  carry = vreinterpretq_u8_s8 (vshrq_n_s8 (vreinterpretq_s8_u8 (x), 7));
+  return veorq_u8 (vshlq_n_u8 (x, 1), vandq_u8 (carry, vdupq_n_u8 (0x1b)));
+}
+
+/* Adds two logarithms modulo 15, keeping the zero marker past the table. */
+NEON_TARGET static inline uint8x16_t
+neon_log_add (uint8x16_t a, uint8x16_t b)
+{
+  uint8x16_t s;
+
+  s = vqaddq_u8 (a, b);
+  return vminq_u8 (s, vsubq_u8 (s, vdupq_n_u8 (15)));
+}
+
+/*
+ * Inverts every byte given as the coefficients i and j in its nibbles, and
+ * returns the sum of the output tables for the coefficients of the inverse.
+ */
+NEON_TARGET static inline uint8x16_t
+neon_invert (uint8x16_t x, const uint8_t *out_t, const uint8_t *out_tb)
+{
+  uint8x16_t i, j, li, lj, n, nl;
+
+  i = vandq_u8 (x, vdupq_n_u8 (0x0f));
+  j = vshrq_n_u8 (x, 4);
+  li = vqtbl1q_u8 (vld1q_u8 (neon_log), i);
+  lj = vqtbl1q_u8 (vld1q_u8 (neon_log), j);
+  n = veorq_u8 (vqtbl1q_u8 (vld1q_u8 (neon_exp), neon_log_add (li, lj)),
+                vqtbl1q_u8 (vld1q_u8 (neon_lambda_sq), veorq_u8 (i, j)));
+  nl = vqtbl1q_u8 (vld1q_u8 (neon_neg_log), n);
+  return veorq_u8 (vqtbl1q_u8 (vld1q_u8 (out_t), neon_log_add (lj, nl)),
+                   vqtbl1q_u8 (vld1q_u8 (out_tb), neon_log_add (li, nl)));
+}
+
+/* Looks up both nibbles of every byte in a pair of linear tables. */
+NEON_TARGET static inline uint8x16_t
+neon_linear (uint8x16_t x, const uint8_t *lo, const uint8_t *hi)
+{
+  return veorq_u8 (vqtbl1q_u8 (vld1q_u8 (lo), vandq_u8 (x, vdupq_n_u8 (0x0f))),
+                   vqtbl1q_u8 (vld1q_u8 (hi), vshrq_n_u8 (x, 4)));
+}
+
+NEON_TARGET static inline uint8x16_t
+neon_sub_bytes (uint8x16_t x)
+{
+  x = neon_linear (x, neon_in_lo, neon_in_hi);
+  return veorq_u8 (neon_invert (x, neon_out_t, neon_out_tb),
+                   vdupq_n_u8 (0x63));
+}
+
+NEON_TARGET static inline uint8x16_t
+neon_inv_sub_bytes (uint8x16_t x)
+{
+  x = veorq_u8 (neon_linear (x, neon_inv_in_lo, neon_inv_in_hi),
+                vdupq_n_u8 (0x47));
+  return neon_invert (x, neon_inv_out_t, neon_inv_out_tb);
+}
+
+/*
+ * MixColumns of columns held in 32-bit lanes, given the first rotation of x
+ * so that ShiftRows can be folded into it.
+ */
+NEON_TARGET static inline uint8x16_t
+neon_mix_columns (uint8x16_t x, uint8x16_t r1)
+{
+  uint8x16_t t;
+
+  t = veorq_u8 (x, r1);
+  return veorq_u8 (veorq_u8 (neon_xtime (t), r1),
+                   NEON_SHUFFLE (t, neon_rot2));
+}
+
+/* InvMixColumns is MixColumns after adding 4 (x + r2) to every byte. */
+NEON_TARGET static inline uint8x16_t
+neon_inv_mix_columns (uint8x16_t x)
+{
+  uint8x16_t w;
+
+  w = veorq_u8 (x, NEON_SHUFFLE (x, neon_rot2));
+  x = veorq_u8 (x, neon_xtime (neon_xtime (w)));
+  return neon_mix_columns (x, NEON_SHUFFLE (x, neon_rot1));
+}
+
+/* Encrypts up to NEON_SMALL_BLOCKS blocks, one register each. */
+NEON_TARGET static void
+neon_encrypt_small (const uint32_t *ek, unsigned int rounds, uint8x16_t *x,
+                    size_t blocks)
+{
+  uint8x16_t k, y;
+  unsigned int i;
+  size_t j;
+
+  k = neon_load_rk (ek);
+  for (j = 0; j < blocks; ++j)
+    x[j] = veorq_u8 (x[j], k);
+  for (i = 1; i < rounds; ++i)
+    {
+      k = neon_load_rk (ek + i * 4);
+      for (j = 0; j < blocks; ++j)
+        {
+          y = neon_sub_bytes (x[j]);
+          y = neon_mix_columns (NEON_SHUFFLE (y, neon_shift_rows),
+                                NEON_SHUFFLE (y, neon_shift_rot1));
+          x[j] = veorq_u8 (y, k);
+        }
+    }
+  k = neon_load_rk (ek + rounds * 4);
+  for (j = 0; j < blocks; ++j)
+    x[j] = veorq_u8 (NEON_SHUFFLE (neon_sub_bytes (x[j]), neon_shift_rows), k);
+}
+
+NEON_TARGET static void
+neon_decrypt_small (const uint32_t *dk, unsigned int rounds, uint8x16_t *x,
+                    size_t blocks)
+{
+  uint8x16_t k, y;
+  unsigned int i;
+  size_t j;
+
+  k = neon_load_rk (dk + rounds * 4);
+  for (j = 0; j < blocks; ++j)
+    x[j] = veorq_u8 (x[j], k);
+  for (i = rounds - 1; i > 0; --i)
+    {
+      k = neon_load_rk (dk + i * 4);
+      for (j = 0; j < blocks; ++j)
+        {
+          y = NEON_SHUFFLE (x[j], neon_inv_shift_rows);
+          y = veorq_u8 (neon_inv_sub_bytes (y), k);
+          x[j] = neon_inv_mix_columns (y);
+        }
+    }
+  k = neon_load_rk (dk);
+  for (j = 0; j < blocks; ++j)
+    x[j] = veorq_u8 (
+        neon_inv_sub_bytes (NEON_SHUFFLE (x[j], neon_inv_shift_rows)), k);
+}
+
+#define NEON_SWAPMOVE(a, b, n, m)                                             \
+  do                                                                          \
+    {                                                                         \
+      uint8x16_t t_;                                                          \
+                                                                              \
+      t_ = vreinterpretq_u8_u64 (                                             \
+          vshrq_n_u64 (vreinterpretq_u64_u8 ((b)), (n)));                     \
+      t_ = vandq_u8 (veorq_u8 (t_, (a)), vdupq_n_u8 (m));                     \
+      (a) = veorq_u8 ((a), t_);                                               \
+      (b) = veorq_u8 ((b), vreinterpretq_u8_u64 (vshlq_n_u64 (                \
+                               vreinterpretq_u64_u8 (t_), (n))));             \
+    }                                                                         \
+  while (0)
+
+/*
+ * Transposes the 8x8 bit matrix at every byte position of eight blocks.
+ * Afterwards x[7 - i] holds bit i of every byte. Each swap undoes itself, so
+ * the inverse runs the three steps in the other order.
+ */
+#define NEON_SWAP1(x)                                                         \
+  do                                                                          \
+    {                                                                         \
+      NEON_SWAPMOVE ((x)[0], (x)[1], 1, 0x55);                                \
+      NEON_SWAPMOVE ((x)[2], (x)[3], 1, 0x55);                                \
+      NEON_SWAPMOVE ((x)[4], (x)[5], 1, 0x55);                                \
+      NEON_SWAPMOVE ((x)[6], (x)[7], 1, 0x55);                                \
+    }                                                                         \
+  while (0)
+
+#define NEON_SWAP2(x)                                                         \
+  do                                                                          \
+    {                                                                         \
+      NEON_SWAPMOVE ((x)[0], (x)[2], 2, 0x33);                                \
+      NEON_SWAPMOVE ((x)[1], (x)[3], 2, 0x33);                                \
+      NEON_SWAPMOVE ((x)[4], (x)[6], 2, 0x33);                                \
+      NEON_SWAPMOVE ((x)[5], (x)[7], 2, 0x33);                                \
+    }                                                                         \
+  while (0)
+
+#define NEON_SWAP4(x)                                                         \
+  do                                                                          \
+    {                                                                         \
+      NEON_SWAPMOVE ((x)[0], (x)[4], 4, 0x0f);                                \
+      NEON_SWAPMOVE ((x)[1], (x)[5], 4, 0x0f);                                \
+      NEON_SWAPMOVE ((x)[2], (x)[6], 4, 0x0f);                                \
+      NEON_SWAPMOVE ((x)[3], (x)[7], 4, 0x0f);                                \
+    }                                                                         \
+  while (0)
+
+NEON_TARGET static inline void
+neon_bitslice (aes_bitslice_word *q, uint8x16_t *x)
+{
+  NEON_SWAP1 (x);
+  NEON_SWAP2 (x);
+  NEON_SWAP4 (x);
+  q[0] = (aes_bitslice_word)x[7];
+  q[1] = (aes_bitslice_word)x[6];
+  q[2] = (aes_bitslice_word)x[5];
+  q[3] = (aes_bitslice_word)x[4];
+  q[4] = (aes_bitslice_word)x[3];
+  q[5] = (aes_bitslice_word)x[2];
+  q[6] = (aes_bitslice_word)x[1];
+  q[7] = (aes_bitslice_word)x[0];
+}
+
+NEON_TARGET static inline void
+neon_unbitslice (uint8x16_t *x, const aes_bitslice_word *q)
+{
+  x[7] = (uint8x16_t)q[0];
+  x[6] = (uint8x16_t)q[1];
+  x[5] = (uint8x16_t)q[2];
+  x[4] = (uint8x16_t)q[3];
+  x[3] = (uint8x16_t)q[4];
+  x[2] = (uint8x16_t)q[5];
+  x[1] = (uint8x16_t)q[6];
+  x[0] = (uint8x16_t)q[7];
+  NEON_SWAP4 (x);
+  NEON_SWAP2 (x);
+  NEON_SWAP1 (x);
+}
+
+/*
+ * The byte orders of the state in the bitsliced rounds, which never do
+ * ShiftRows, and the rotations of MixColumns in each. See the same tables in
+ * aes-bitslice-ssse3.c.
+ */
+static const uint8_t neon_frame[4][16]
+    = { { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+        { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 },
+        { 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12, 5, 14, 7 },
+        { 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11 } };
+static const uint8_t neon_frame_rot1[4][16]
+    = { { 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 },
+        { 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12, 1, 2, 3, 0 },
+        { 9, 10, 11, 8, 13, 14, 15, 12, 1, 2, 3, 0, 5, 6, 7, 4 },
+        { 13, 14, 15, 12, 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8 } };
+static const uint8_t neon_frame_rot2[2][16]
+    = { { 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 },
+        { 10, 11, 8, 9, 14, 15, 12, 13, 2, 3, 0, 1, 6, 7, 4, 5 } };
+
+/*
+ * Expands the round keys to the bitsliced form in the byte order of the state
+ * they are added to, with the constant of the S-box in every key after the
+ * first.
+ */
+NEON_TARGET static void
+neon_expand_sk (aes_bitslice_word *sk, const uint32_t *ek, unsigned int rounds,
+                int decrypt)
+{
+  uint8x16_t k;
+  unsigned int i, j, f;
+
+  for (i = 0; i <= rounds; ++i)
+    {
+      f = (decrypt ? i - rounds : i) & 3;
+      k = NEON_SHUFFLE (neon_load_rk (ek + i * 4), neon_frame[f]);
+      if (i > 0)
+        k = veorq_u8 (k, vdupq_n_u8 (0x63));
+      for (j = 0; j < 8; ++j)
+        sk[i * 8 + j]
+            = (aes_bitslice_word)vtstq_u8 (k, vdupq_n_u8 ((uint8_t)(1 << j)));
+    }
+}
+
+NEON_TARGET static inline void
+neon_bs_add_round_key (aes_bitslice_word *q, const aes_bitslice_word *sk)
+{
+  q[0] ^= sk[0];
+  q[1] ^= sk[1];
+  q[2] ^= sk[2];
+  q[3] ^= sk[3];
+  q[4] ^= sk[4];
+  q[5] ^= sk[5];
+  q[6] ^= sk[6];
+  q[7] ^= sk[7];
+}
+
+#define NEON_BS_SHUFFLE(w, mask)                                              \
+  ((aes_bitslice_word)vqtbl1q_u8 ((uint8x16_t)(w), (mask)))
+
+/* MixColumns on the bit planes in byte order f. */
+NEON_TARGET static inline void
+neon_bs_mix_columns (aes_bitslice_word *q, unsigned int f)
+{
+  aes_bitslice_word r0, r1, r2, r3, r4, r5, r6, r7;
+  aes_bitslice_word t0, t1, t2, t3, t4, t5, t6, t7;
+  uint8x16_t rot1, rot2;
+
+  rot1 = vld1q_u8 (neon_frame_rot1[f]);
+  rot2 = vld1q_u8 (neon_frame_rot2[f & 1]);
+  r0 = NEON_BS_SHUFFLE (q[0], rot1);
+  r1 = NEON_BS_SHUFFLE (q[1], rot1);
+  r2 = NEON_BS_SHUFFLE (q[2], rot1);
+  r3 = NEON_BS_SHUFFLE (q[3], rot1);
+  r4 = NEON_BS_SHUFFLE (q[4], rot1);
+  r5 = NEON_BS_SHUFFLE (q[5], rot1);
+  r6 = NEON_BS_SHUFFLE (q[6], rot1);
+  r7 = NEON_BS_SHUFFLE (q[7], rot1);
+  t0 = q[0] ^ r0;
+  t1 = q[1] ^ r1;
+  t2 = q[2] ^ r2;
+  t3 = q[3] ^ r3;
+  t4 = q[4] ^ r4;
+  t5 = q[5] ^ r5;
+  t6 = q[6] ^ r6;
+  t7 = q[7] ^ r7;
+  q[0] = r0 ^ NEON_BS_SHUFFLE (t0, rot2) ^ t7;
+  q[1] = r1 ^ NEON_BS_SHUFFLE (t1, rot2) ^ t0 ^ t7;
+  q[2] = r2 ^ NEON_BS_SHUFFLE (t2, rot2) ^ t1;
+  q[3] = r3 ^ NEON_BS_SHUFFLE (t3, rot2) ^ t2 ^ t7;
+  q[4] = r4 ^ NEON_BS_SHUFFLE (t4, rot2) ^ t3 ^ t7;
+  q[5] = r5 ^ NEON_BS_SHUFFLE (t5, rot2) ^ t4;
+  q[6] = r6 ^ NEON_BS_SHUFFLE (t6, rot2) ^ t5;
+  q[7] = r7 ^ NEON_BS_SHUFFLE (t7, rot2) ^ t6;
+}
+
+NEON_TARGET static inline void
+neon_bs_inv_mix_columns (aes_bitslice_word *q, unsigned int f)
+{
+  aes_bitslice_word w0, w1, w2, w3, w4, w5, w6, w7;
+  uint8x16_t rot2;
+
+  rot2 = vld1q_u8 (neon_frame_rot2[f & 1]);
+  w0 = q[0] ^ NEON_BS_SHUFFLE (q[0], rot2);
+  w1 = q[1] ^ NEON_BS_SHUFFLE (q[1], rot2);
+  w2 = q[2] ^ NEON_BS_SHUFFLE (q[2], rot2);
+  w3 = q[3] ^ NEON_BS_SHUFFLE (q[3], rot2);
+  w4 = q[4] ^ NEON_BS_SHUFFLE (q[4], rot2);
+  w5 = q[5] ^ NEON_BS_SHUFFLE (q[5], rot2);
+  w6 = q[6] ^ NEON_BS_SHUFFLE (q[6], rot2);
+  w7 = q[7] ^ NEON_BS_SHUFFLE (q[7], rot2);
+  /* Four times w. */
+  q[0] ^= w6;
+  q[1] ^= w6 ^ w7;
+  q[2] ^= w0 ^ w7;
+  q[3] ^= w1 ^ w6;
+  q[4] ^= w2 ^ w6 ^ w7;
+  q[5] ^= w3 ^ w7;
+  q[6] ^= w4;
+  q[7] ^= w5;
+  neon_bs_mix_columns (q, f);
+}
+
+/* Puts the bytes of eight blocks in byte order f back in state order. */
+NEON_TARGET static inline void
+neon_bs_unpermute (uint8x16_t *x, unsigned int f)
+{
+  uint8x16_t mask;
+  unsigned int i;
+
+  if (f == 0)
+    return;
+  mask = vld1q_u8 (neon_frame[(4 - f) & 3]);
+  for (i = 0; i < 8; ++i)
+    x[i] = vqtbl1q_u8 (x[i], mask);
+}
+
+/* Encrypts eight blocks in place. */
+NEON_TARGET static void
+neon_bs_encrypt (const aes_bitslice_word *sk, unsigned int rounds,
+                 uint8x16_t *x)
+{
+  aes_bitslice_word q[8];
+  unsigned int i;
+
+  neon_bitslice (q, x);
+  neon_bs_add_round_key (q, sk);
+  for (i = 1; i < rounds; ++i)
+    {
+      aes_bitslice_sbox_without_c (q);
+      neon_bs_mix_columns (q, i & 3);
+      neon_bs_add_round_key (q, sk + i * 8);
+    }
+  aes_bitslice_sbox_without_c (q);
+  neon_bs_add_round_key (q, sk + rounds * 8);
+  neon_unbitslice (x, q);
+  neon_bs_unpermute (x, rounds & 3);
+}
+
+NEON_TARGET static void
+neon_bs_decrypt (const aes_bitslice_word *sk, unsigned int rounds,
+                 uint8x16_t *x)
+{
+  aes_bitslice_word q[8];
+  unsigned int i;
+
+  neon_bitslice (q, x);
+  neon_bs_add_round_key (q, sk + rounds * 8);
+  for (i = rounds - 1; i > 0; --i)
+    {
+      aes_bitslice_inv_sbox_without_c (q);
+      neon_bs_add_round_key (q, sk + i * 8);
+      neon_bs_inv_mix_columns (q, (i - rounds) & 3);
+    }
+  aes_bitslice_inv_sbox_without_c (q);
+  neon_bs_add_round_key (q, sk);
+  neon_unbitslice (x, q);
+  neon_bs_unpermute (x, -rounds & 3);
+}
+/* Encrypts or decrypts the blocks in x, bitsliced unless there are few. */
+NEON_TARGET static inline void
+neon_encrypt_blocks (const aes_bitslice_word *sk, const uint32_t *ek,
+                     unsigned int rounds, uint8x16_t *x, size_t blocks)
+{
+  size_t i;
+
+  if (blocks <= NEON_SMALL_BLOCKS)
+    neon_encrypt_small (ek, rounds, x, blocks);
+  else
+    {
+      for (i = blocks; i < NEON_BLOCKS; ++i)
+        x[i] = vdupq_n_u8 (0);
+      neon_bs_encrypt (sk, rounds, x);
+    }
+}
+
+NEON_TARGET static inline void
+neon_decrypt_blocks (const aes_bitslice_word *sk, const uint32_t *dk,
+                     unsigned int rounds, uint8x16_t *x, size_t blocks)
+{
+  size_t i;
+
+  if (blocks <= NEON_SMALL_BLOCKS)
+    neon_decrypt_small (dk, rounds, x, blocks);
+  else
+    {
+      for (i = blocks; i < NEON_BLOCKS; ++i)
+        x[i] = vdupq_n_u8 (0);
+      neon_bs_decrypt (sk, rounds, x);
+    }
+}
+
+NEON_TARGET static void
+aes_ecb_encrypt_neon (const uint32_t *ek, unsigned int rounds,
+                      const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  uint8x16_t x[NEON_BLOCKS];
+  size_t i, n;
+
+  if (blocks > NEON_SMALL_BLOCKS)
+    neon_expand_sk (sk, ek, rounds, 0);
+  while (blocks > 0)
+    {
+      n = blocks < NEON_BLOCKS ? blocks : NEON_BLOCKS;
+      for (i = 0; i < n; ++i)
+        x[i] = vld1q_u8 (src + i * AES_BLOCK_SIZE);
+      neon_encrypt_blocks (sk, ek, rounds, x, n);
+      for (i = 0; i < n; ++i)
+        vst1q_u8 (dest + i * AES_BLOCK_SIZE, x[i]);
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+}
+
+NEON_TARGET static void
+aes_ecb_decrypt_neon (const uint32_t *dk, unsigned int rounds,
+                      const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  uint8x16_t x[NEON_BLOCKS];
+  size_t i, n;
+
+  if (blocks > NEON_SMALL_BLOCKS)
+    neon_expand_sk (sk, dk, rounds, 1);
+  while (blocks > 0)
+    {
+      n = blocks < NEON_BLOCKS ? blocks : NEON_BLOCKS;
+      for (i = 0; i < n; ++i)
+        x[i] = vld1q_u8 (src + i * AES_BLOCK_SIZE);
+      neon_decrypt_blocks (sk, dk, rounds, x, n);
+      for (i = 0; i < n; ++i)
+        vst1q_u8 (dest + i * AES_BLOCK_SIZE, x[i]);
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+}
+
+NEON_TARGET static void
+aes_cbc_decrypt_neon (const uint32_t *dk, unsigned int rounds, uint8_t *iv,
+                      const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  uint8x16_t x[NEON_BLOCKS], c[NEON_BLOCKS];
+  uint8x16_t prev;
+  size_t i, n;
+
+  if (blocks > NEON_SMALL_BLOCKS)
+    neon_expand_sk (sk, dk, rounds, 1);
+  prev = vld1q_u8 (iv);
+  while (blocks > 0)
+    {
+      n = blocks < NEON_BLOCKS ? blocks : NEON_BLOCKS;
+      for (i = 0; i < n; ++i)
+        {
+          c[i] = vld1q_u8 (src + i * AES_BLOCK_SIZE);
+          x[i] = c[i];
+        }
+      neon_decrypt_blocks (sk, dk, rounds, x, n);
+      for (i = 0; i < n; ++i)
+        {
+          vst1q_u8 (dest + i * AES_BLOCK_SIZE, veorq_u8 (x[i], prev));
+          prev = c[i];
+        }
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+  vst1q_u8 (iv, prev);
+}
+
+NEON_TARGET static void
+aes_ctr_crypt_neon (const uint32_t *ek, unsigned int rounds, uint8_t *ctr,
+                    const uint8_t *src, uint8_t *dest, size_t len)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  uint8_t keystream[NEON_BLOCKS * AES_BLOCK_SIZE];
+  uint8x16_t x[NEON_BLOCKS];
+  uint64_t hi, lo;
+  size_t i, n, blocks;
+
+  if (len > NEON_SMALL_BLOCKS * AES_BLOCK_SIZE)
+    neon_expand_sk (sk, ek, rounds, 0);
+  aes_ctr_load (ctr, &hi, &lo);
+  while (len > 0)
+    {
+      n = len < sizeof (keystream) ? len : sizeof (keystream);
+      blocks = (n + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE;
+      for (i = 0; i < blocks; ++i)
+        {
+          x[i] = vrev64q_u8 (vreinterpretq_u8_u64 (
+              vcombine_u64 (vcreate_u64 (hi), vcreate_u64 (lo))));
+          hi += ++lo == 0;
+        }
+      neon_encrypt_blocks (sk, ek, rounds, x, blocks);
+      if (n == sizeof (keystream))
+        for (i = 0; i < NEON_BLOCKS; ++i)
+          vst1q_u8 (dest + i * AES_BLOCK_SIZE,
+                    veorq_u8 (x[i], vld1q_u8 (src + i * AES_BLOCK_SIZE)));
+      else
+        {
+          for (i = 0; i < blocks; ++i)
+            vst1q_u8 (keystream + i * AES_BLOCK_SIZE, x[i]);
+          for (i = 0; i < n; ++i)
+            dest[i] = src[i] ^ keystream[i];
+        }
+      src += n;
+      dest += n;
+      len -= n;
+    }
+  aes_ctr_store (ctr, hi, lo);
+}
+
+NEON_TARGET static uint32_t
+neon_sub_word (uint32_t w)
+{
+  return vgetq_lane_u32 (
+      vreinterpretq_u32_u8 (
+          neon_sub_bytes (vreinterpretq_u8_u32 (vdupq_n_u32 (w)))),
+      0);
+}
+
+/* FIPS 197 key expansion, with SubWord from the TBL tables. */
+NEON_TARGET static void
+neon_expand_key (uint32_t *ek, const uint8_t *key, unsigned int nk)
+{
+  uint32_t t, rcon;
+  unsigned int i;
+
+  for (i = 0; i < nk; ++i)
+    ek[i] = buff_get_be32 (key + i * 4);
+  rcon = 0x01;
+  for (i = nk; i < 4 * (nk + 7); ++i)
+    {
+      t = ek[i - 1];
+      if (i % nk == 0)
+        {
+          t = neon_sub_word ((t << 8) | (t >> 24)) ^ (rcon << 24);
+          rcon = ((rcon << 1) ^ (((rcon >> 7) & 1) * 0x1b)) & 0xff;
+        }
+      else if (nk > 6 && i % nk == 4)
+        t = neon_sub_word (t);
+      ek[i] = ek[i - nk] ^ t;
+    }
+}
+
+static void
+aes_expand_keys_neon (uint32_t *const *ek, const uint8_t *const *key,
+                      size_t n, unsigned int nk)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    neon_expand_key (ek[i], key[i], nk);
+}
+
+static void
+aes128_expand_key_neon (uint32_t *ek, const uint8_t *key)
+{
+  neon_expand_key (ek, key, 4);
+}
+
+static void
+aes192_expand_key_neon (uint32_t *ek, const uint8_t *key)
+{
+  neon_expand_key (ek, key, 6);
+}
+
+static void
+aes256_expand_key_neon (uint32_t *ek, const uint8_t *key)
+{
+  neon_expand_key (ek, key, 8);
+}
+
+static void
+aes128_invert_key_neon (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES128_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+static void
+aes192_invert_key_neon (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES192_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+static void
+aes256_invert_key_neon (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES256_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+NEON_TARGET static inline void
+neon_encrypt1 (const uint32_t *ek, unsigned int rounds, const uint8_t *src,
+               uint8_t *dest)
+{
+  uint8x16_t x;
+
+  x = vld1q_u8 (src);
+  neon_encrypt_small (ek, rounds, &x, 1);
+  vst1q_u8 (dest, x);
+}
+
+NEON_TARGET static inline void
+neon_decrypt1 (const uint32_t *dk, unsigned int rounds, const uint8_t *src,
+               uint8_t *dest)
+{
+  uint8x16_t x;
+
+  x = vld1q_u8 (src);
+  neon_decrypt_small (dk, rounds, &x, 1);
+  vst1q_u8 (dest, x);
+}
+
+NEON_TARGET static void
+aes128_encrypt_neon (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  neon_encrypt1 (ek, AES128_ROUNDS, src, dest);
+}
+
+NEON_TARGET static void
+aes192_encrypt_neon (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  neon_encrypt1 (ek, AES192_ROUNDS, src, dest);
+}
+
+NEON_TARGET static void
+aes256_encrypt_neon (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  neon_encrypt1 (ek, AES256_ROUNDS, src, dest);
+}
+
+NEON_TARGET static void
+aes128_decrypt_neon (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  neon_decrypt1 (dk, AES128_ROUNDS, src, dest);
+}
+
+NEON_TARGET static void
+aes192_decrypt_neon (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  neon_decrypt1 (dk, AES192_ROUNDS, src, dest);
+}
+
+NEON_TARGET static void
+aes256_decrypt_neon (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  neon_decrypt1 (dk, AES256_ROUNDS, src, dest);
+}
+
+const struct aes_backend aes_backend_neon = {
+  "neon",
+  aes128_expand_key_neon,
+  aes192_expand_key_neon,
+  aes256_expand_key_neon,
+  aes128_invert_key_neon,
+  aes192_invert_key_neon,
+  aes256_invert_key_neon,
+  aes128_encrypt_neon,
+  aes192_encrypt_neon,
+  aes256_encrypt_neon,
+  aes128_decrypt_neon,
+  aes192_decrypt_neon,
+  aes256_decrypt_neon,
+  aes_ctr_crypt_neon,
+  aes_ecb_encrypt_neon,
+  aes_ecb_decrypt_neon,
+  aes_cbc_decrypt_neon,
+  aes_expand_keys_neon,
+  NULL,
+  NULL,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int aes_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
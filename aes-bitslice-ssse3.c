@@ -0,0 +1,938 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Constant time AES with SSSE3, for x86 processors without AES-NI. Runs of
+ * eight blocks use the bitsliced layout of "Faster and Timing-Attack
+ * Resistant AES-GCM" by Emilia Kasper and Peter Schwabe: the bits of the
+ * blocks are transposed so that register i holds bit i of every byte, with
+ * the bytes still in state order. The S-box is then the circuit from
+ * aes-internal.h and the rotations of MixColumns are PSHUFB byte
+ * permutations of each register, with ShiftRows folded into them.
+ *
+ * Up to six blocks, as in CBC encryption or the last blocks of a message,
+ * would waste most of a bitsliced pass, so they are encrypted one register
+ * per block with the S-box computed from 16-entry PSHUFB tables in the
+ * style of Mike Hamburg's "Accelerating AES with Vector Permute
+ * Instructions". Each byte is written as i t + j t^16 over GF(16), where
+ * t^2 + t = 0x0d, so that its inverse is (j t + i t^16) / N with
+ * N = 0x0d (i + j)^2 + ij. The products in GF(16) are sums of logarithms,
+ * and a logarithm of 0x90 stands for zero: any sum containing it keeps the
+ * top bit set, so PSHUFB returns zero for it. The tables were derived from
+ * the generator 0xe1 of GF(16) and the basis 1, 0xe1, 0xe1^2, 0xe1^3 in the
+ * AES field. No table is indexed by anything but the lanes of a register.
+ *
+ * The round keys are stored as big-endian words like in the T-table code.
+ * Both directions use them as they are, so the decryption key schedule is a
+ * copy.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "aes-internal.h"
+#include "aes.h"
+#include "bswap.h"
+
+#if defined(HAVE_SSSE3_INTRINSICS)
+
+#include <tmmintrin.h>
+
+#define SSSE3_TARGET __attribute__ ((target (SSSE3_TARGET_ATTRIBUTE)))
+
+/* Blocks in one bitsliced pass. */
+#define SSSE3_BLOCKS 8
+
+/* Most blocks that are faster one register per block than bitsliced. */
+#define SSSE3_SMALL_BLOCKS 6
+
+/* Splits a byte into its coefficients i and j, in the low and high nibble. */
+static const uint8_t ssse3_in_lo[16]
+    = { 0x00, 0x11, 0x9d, 0x8c, 0x56, 0x47, 0xcb, 0xda,
+        0xde, 0xcf, 0x43, 0x52, 0x88, 0x99, 0x15, 0x04 };
+static const uint8_t ssse3_in_hi[16]
+    = { 0x00, 0x9c, 0x79, 0xe5, 0x50, 0xcc, 0x29, 0xb5,
+        0x1a, 0x86, 0x63, 0xff, 0x4a, 0xd6, 0x33, 0xaf };
+
+/* The same after the inverse affine transform, without its constant 0x47. */
+static const uint8_t ssse3_inv_in_lo[16]
+    = { 0x00, 0x13, 0xd0, 0xc3, 0xb6, 0xa5, 0x66, 0x75,
+        0x51, 0x42, 0x81, 0x92, 0xe7, 0xf4, 0x37, 0x24 };
+static const uint8_t ssse3_inv_in_hi[16]
+    = { 0x00, 0x35, 0x9f, 0xaa, 0x1b, 0x2e, 0x84, 0xb1,
+        0x3e, 0x0b, 0xa1, 0x94, 0x25, 0x10, 0xba, 0x8f };
+
+/* Logarithms, powers of the generator, 0x0d x^2 and -log x in GF(16). */
+static const uint8_t ssse3_log[16]
+    = { 0x90, 0x00, 0x01, 0x04, 0x02, 0x08, 0x05, 0x0a,
+        0x03, 0x0e, 0x09, 0x07, 0x06, 0x0d, 0x0b, 0x0c };
+static const uint8_t ssse3_exp[16]
+    = { 0x01, 0x02, 0x04, 0x08, 0x03, 0x06, 0x0c, 0x0b,
+        0x05, 0x0a, 0x07, 0x0e, 0x0f, 0x0d, 0x09, 0x00 };
+static const uint8_t ssse3_lambda_sq[16]
+    = { 0x00, 0x09, 0x02, 0x0b, 0x08, 0x01, 0x0a, 0x03,
+        0x06, 0x0f, 0x04, 0x0d, 0x0e, 0x07, 0x0c, 0x05 };
+static const uint8_t ssse3_neg_log[16]
+    = { 0x90, 0x00, 0x0e, 0x0b, 0x0d, 0x07, 0x0a, 0x05,
+        0x0c, 0x01, 0x06, 0x08, 0x09, 0x02, 0x04, 0x03 };
+
+/*
+ * The affine transform of the generator's powers times t and t^16, by
+ * logarithm, so that the two lookups sum to the S-box without its constant.
+ */
+static const uint8_t ssse3_out_t[16]
+    = { 0xcf, 0x1e, 0xa5, 0x41, 0xd1, 0xbb, 0xe4, 0x90,
+        0x6a, 0x5f, 0x74, 0xfa, 0x35, 0x2b, 0x8e, 0x00 };
+static const uint8_t ssse3_out_tb[16]
+    = { 0xd0, 0xaa, 0x17, 0xc5, 0x7a, 0xbd, 0xd2, 0xbf,
+        0xc7, 0x6f, 0x6d, 0x78, 0xa8, 0x02, 0x15, 0x00 };
+
+/* The same without the affine transform, for the inverse S-box. */
+static const uint8_t ssse3_inv_out_t[16]
+    = { 0x12, 0x4b, 0x0f, 0xd8, 0x59, 0x44, 0xd7, 0x81,
+        0x1d, 0x93, 0x56, 0x9c, 0x8e, 0xc5, 0xca, 0x00 };
+static const uint8_t ssse3_inv_out_tb[16]
+    = { 0x13, 0xaa, 0x53, 0xd4, 0xb9, 0xf9, 0x87, 0x6d,
+        0x40, 0x7e, 0xea, 0x2d, 0x3e, 0x94, 0xc7, 0x00 };
+
+SSSE3_TARGET static inline __m128i
+ssse3_table (const uint8_t *table)
+{
+  return _mm_loadu_si128 ((const __m128i *)table);
+}
+
+/* Byte permutations for ShiftRows and the rotations of each column. */
+SSSE3_TARGET static inline __m128i
+ssse3_shift_rows_mask (void)
+{
+  return _mm_setr_epi8 (0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11);
+}
+
+SSSE3_TARGET static inline __m128i
+ssse3_inv_shift_rows_mask (void)
+{
+  return _mm_setr_epi8 (0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3);
+}
+
+SSSE3_TARGET static inline __m128i
+ssse3_rot1_mask (void)
+{
+  return _mm_setr_epi8 (1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+}
+
+SSSE3_TARGET static inline __m128i
+ssse3_rot2_mask (void)
+{
+  return _mm_setr_epi8 (2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+}
+
+/* ShiftRows followed by the first rotation. */
+SSSE3_TARGET static inline __m128i
+ssse3_shift_rot1_mask (void)
+{
+  return _mm_setr_epi8 (5, 10, 15, 0, 9, 14, 3, 4, 13, 2, 7, 8, 1, 6, 11, 12);
+}
+
+/* Converts the big-endian round key words to bytes in state order. */
+SSSE3_TARGET static inline __m128i
+ssse3_load_rk (const uint32_t *rk)
+{
+  const __m128i mask
+      = _mm_setr_epi8 (3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+  return _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *)rk), mask);
+}
+
+/* Doubles every byte in GF(2^8). */
+SSSE3_TARGET static inline __m128i
+ssse3_xtime (__m128i x)
+{
+  __m128i carry;
+
+  carry = _mm_cmplt_epi8 (x, _mm_setzero_si128 ());
+  return _mm_xor_si128 (_mm_add_epi8 (x, x),
+                        _mm_and_si128 (carry, _mm_set1_epi8 (0x1b)));
+}
+
+/* Adds two logarithms modulo 15, keeping the top bit of the zero marker. */
+SSSE3_TARGET static inline __m128i
+ssse3_log_add (__m128i a, __m128i b)
+{
+  __m128i s;
+
+  s = _mm_adds_epu8 (a, b);
+  return _mm_min_epu8 (s, _mm_sub_epi8 (s, _mm_set1_epi8 (15)));
+}
+
+/*
+ * Inverts every byte given as the coefficients i and j in its nibbles, and
+ * returns the sum of the output tables for the coefficients of the inverse.
+ */
+SSSE3_TARGET static inline __m128i
+ssse3_invert (__m128i x, const uint8_t *out_t, const uint8_t *out_tb)
+{
+  const __m128i nibble = _mm_set1_epi8 (0x0f);
+  __m128i i, j, li, lj, n, nl;
+
+  i = _mm_and_si128 (x, nibble);
+  j = _mm_and_si128 (_mm_srli_epi16 (x, 4), nibble);
+  li = _mm_shuffle_epi8 (ssse3_table (ssse3_log), i);
+  lj = _mm_shuffle_epi8 (ssse3_table (ssse3_log), j);
+  n = _mm_xor_si128 (
+      _mm_shuffle_epi8 (ssse3_table (ssse3_exp), ssse3_log_add (li, lj)),
+      _mm_shuffle_epi8 (ssse3_table (ssse3_lambda_sq), _mm_xor_si128 (i, j)));
+  nl = _mm_shuffle_epi8 (ssse3_table (ssse3_neg_log), n);
+  return _mm_xor_si128 (
+      _mm_shuffle_epi8 (ssse3_table (out_t), ssse3_log_add (lj, nl)),
+      _mm_shuffle_epi8 (ssse3_table (out_tb), ssse3_log_add (li, nl)));
+}
+
+/* Looks up both nibbles of every byte in a pair of linear tables. */
+SSSE3_TARGET static inline __m128i
+ssse3_linear (__m128i x, const uint8_t *lo, const uint8_t *hi)
+{
+  const __m128i nibble = _mm_set1_epi8 (0x0f);
+
+  return _mm_xor_si128 (
+      _mm_shuffle_epi8 (ssse3_table (lo), _mm_and_si128 (x, nibble)),
+      _mm_shuffle_epi8 (ssse3_table (hi),
+                        _mm_and_si128 (_mm_srli_epi16 (x, 4), nibble)));
+}
+
+SSSE3_TARGET static inline __m128i
+ssse3_sub_bytes (__m128i x)
+{
+  x = ssse3_linear (x, ssse3_in_lo, ssse3_in_hi);
+  return _mm_xor_si128 (ssse3_invert (x, ssse3_out_t, ssse3_out_tb),
+                        _mm_set1_epi8 (0x63));
+}
+
+SSSE3_TARGET static inline __m128i
+ssse3_inv_sub_bytes (__m128i x)
+{
+  x = _mm_xor_si128 (ssse3_linear (x, ssse3_inv_in_lo, ssse3_inv_in_hi),
+                     _mm_set1_epi8 (0x47));
+  return ssse3_invert (x, ssse3_inv_out_t, ssse3_inv_out_tb);
+}
+
+/*
+ * MixColumns of columns held in 32-bit lanes: with the rotations r1 and r2
+ * of x by one and two rows, 2 x + 3 r1 + r2 + r3 = 2 t + r1 + r2 (t) where
+ * t = x + r1. The first rotation is passed in, so that ShiftRows can be
+ * folded into it.
+ */
+SSSE3_TARGET static inline __m128i
+ssse3_mix_columns (__m128i x, __m128i r1)
+{
+  __m128i t;
+
+  t = _mm_xor_si128 (x, r1);
+  return _mm_xor_si128 (
+      _mm_xor_si128 (ssse3_xtime (t), r1),
+      _mm_shuffle_epi8 (t, ssse3_rot2_mask ()));
+}
+
+/*
+ * InvMixColumns is MixColumns after adding 4 (x + r2) to every byte, since
+ * the two circulant matrices differ by that factor.
+ */
+SSSE3_TARGET static inline __m128i
+ssse3_inv_mix_columns (__m128i x)
+{
+  __m128i w;
+
+  w = _mm_xor_si128 (x, _mm_shuffle_epi8 (x, ssse3_rot2_mask ()));
+  x = _mm_xor_si128 (x, ssse3_xtime (ssse3_xtime (w)));
+  return ssse3_mix_columns (x, _mm_shuffle_epi8 (x, ssse3_rot1_mask ()));
+}
+
+/* Encrypts up to SSSE3_SMALL_BLOCKS blocks, one register each. */
+SSSE3_TARGET static void
+ssse3_encrypt_small (const uint32_t *ek, unsigned int rounds, __m128i *x,
+                     size_t blocks)
+{
+  __m128i k, y;
+  unsigned int i;
+  size_t j;
+
+  k = ssse3_load_rk (ek);
+  for (j = 0; j < blocks; ++j)
+    x[j] = _mm_xor_si128 (x[j], k);
+  for (i = 1; i < rounds; ++i)
+    {
+      k = ssse3_load_rk (ek + i * 4);
+      for (j = 0; j < blocks; ++j)
+        {
+          y = ssse3_sub_bytes (x[j]);
+          x[j] = _mm_xor_si128 (
+              ssse3_mix_columns (
+                  _mm_shuffle_epi8 (y, ssse3_shift_rows_mask ()),
+                  _mm_shuffle_epi8 (y, ssse3_shift_rot1_mask ())),
+              k);
+        }
+    }
+  k = ssse3_load_rk (ek + rounds * 4);
+  for (j = 0; j < blocks; ++j)
+    x[j] = _mm_xor_si128 (_mm_shuffle_epi8 (ssse3_sub_bytes (x[j]),
+                                            ssse3_shift_rows_mask ()),
+                          k);
+}
+
+SSSE3_TARGET static void
+ssse3_decrypt_small (const uint32_t *dk, unsigned int rounds, __m128i *x,
+                     size_t blocks)
+{
+  __m128i k, y;
+  unsigned int i;
+  size_t j;
+
+  k = ssse3_load_rk (dk + rounds * 4);
+  for (j = 0; j < blocks; ++j)
+    x[j] = _mm_xor_si128 (x[j], k);
+  for (i = rounds - 1; i > 0; --i)
+    {
+      k = ssse3_load_rk (dk + i * 4);
+      for (j = 0; j < blocks; ++j)
+        {
+          y = _mm_shuffle_epi8 (x[j], ssse3_inv_shift_rows_mask ());
+          y = _mm_xor_si128 (ssse3_inv_sub_bytes (y), k);
+          x[j] = ssse3_inv_mix_columns (y);
+        }
+    }
+  k = ssse3_load_rk (dk);
+  for (j = 0; j < blocks; ++j)
+    x[j] = _mm_xor_si128 (
+        ssse3_inv_sub_bytes (
+            _mm_shuffle_epi8 (x[j], ssse3_inv_shift_rows_mask ())),
+        k);
+}
+
+#define SSSE3_SWAPMOVE(a, b, n, m)                                            \
+  do                                                                          \
+    {                                                                         \
+      __m128i t_;                                                             \
+                                                                              \
+      t_ = _mm_and_si128 (_mm_xor_si128 (_mm_srli_epi64 ((b), (n)), (a)),     \
+                          _mm_set1_epi8 (m));                                 \
+      (a) = _mm_xor_si128 ((a), t_);                                          \
+      (b) = _mm_xor_si128 ((b), _mm_slli_epi64 (t_, (n)));                    \
+    }                                                                         \
+  while (0)
+
+/*
+ * Transposes the 8x8 bit matrix at every byte position of eight blocks.
+ * Afterwards x[7 - i] holds bit i of every byte. Each swap undoes itself, so
+ * the inverse runs the three steps in the other order.
+ */
+#define SSSE3_SWAP1(x)                                                        \
+  do                                                                          \
+    {                                                                         \
+      SSSE3_SWAPMOVE ((x)[0], (x)[1], 1, 0x55);                               \
+      SSSE3_SWAPMOVE ((x)[2], (x)[3], 1, 0x55);                               \
+      SSSE3_SWAPMOVE ((x)[4], (x)[5], 1, 0x55);                               \
+      SSSE3_SWAPMOVE ((x)[6], (x)[7], 1, 0x55);                               \
+    }                                                                         \
+  while (0)
+
+#define SSSE3_SWAP2(x)                                                        \
+  do                                                                          \
+    {                                                                         \
+      SSSE3_SWAPMOVE ((x)[0], (x)[2], 2, 0x33);                               \
+      SSSE3_SWAPMOVE ((x)[1], (x)[3], 2, 0x33);                               \
+      SSSE3_SWAPMOVE ((x)[4], (x)[6], 2, 0x33);                               \
+      SSSE3_SWAPMOVE ((x)[5], (x)[7], 2, 0x33);                               \
+    }                                                                         \
+  while (0)
+
+#define SSSE3_SWAP4(x)                                                        \
+  do                                                                          \
+    {                                                                         \
+      SSSE3_SWAPMOVE ((x)[0], (x)[4], 4, 0x0f);                               \
+      SSSE3_SWAPMOVE ((x)[1], (x)[5], 4, 0x0f);                               \
+      SSSE3_SWAPMOVE ((x)[2], (x)[6], 4, 0x0f);                               \
+      SSSE3_SWAPMOVE ((x)[3], (x)[7], 4, 0x0f);                               \
+    }                                                                         \
+  while (0)
+
+SSSE3_TARGET static inline void
+ssse3_bitslice (aes_bitslice_word *q, __m128i *x)
+{
+  SSSE3_SWAP1 (x);
+  SSSE3_SWAP2 (x);
+  SSSE3_SWAP4 (x);
+  q[0] = (aes_bitslice_word)x[7];
+  q[1] = (aes_bitslice_word)x[6];
+  q[2] = (aes_bitslice_word)x[5];
+  q[3] = (aes_bitslice_word)x[4];
+  q[4] = (aes_bitslice_word)x[3];
+  q[5] = (aes_bitslice_word)x[2];
+  q[6] = (aes_bitslice_word)x[1];
+  q[7] = (aes_bitslice_word)x[0];
+}
+
+SSSE3_TARGET static inline void
+ssse3_unbitslice (__m128i *x, const aes_bitslice_word *q)
+{
+  x[7] = (__m128i)q[0];
+  x[6] = (__m128i)q[1];
+  x[5] = (__m128i)q[2];
+  x[4] = (__m128i)q[3];
+  x[3] = (__m128i)q[4];
+  x[2] = (__m128i)q[5];
+  x[1] = (__m128i)q[6];
+  x[0] = (__m128i)q[7];
+  SSSE3_SWAP4 (x);
+  SSSE3_SWAP2 (x);
+  SSSE3_SWAP1 (x);
+}
+
+/*
+ * ShiftRows is never done on the bit planes. Instead each round leaves the
+ * bytes in the order InvShiftRows^r of the state, where r is the round
+ * number for encryption and minus it for decryption, and MixColumns and the
+ * round keys are permuted to match. With the order as f = r mod 4, lane j
+ * holds the state byte ssse3_frame[f][j], and the rotations of MixColumns
+ * also move the columns by f and 2 f.
+ */
+static const uint8_t ssse3_frame[4][16]
+    = { { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+        { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 },
+        { 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12, 5, 14, 7 },
+        { 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11 } };
+static const uint8_t ssse3_frame_rot1[4][16]
+    = { { 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 },
+        { 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12, 1, 2, 3, 0 },
+        { 9, 10, 11, 8, 13, 14, 15, 12, 1, 2, 3, 0, 5, 6, 7, 4 },
+        { 13, 14, 15, 12, 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8 } };
+static const uint8_t ssse3_frame_rot2[2][16]
+    = { { 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 },
+        { 10, 11, 8, 9, 14, 15, 12, 13, 2, 3, 0, 1, 6, 7, 4, 5 } };
+
+/*
+ * Expands the round keys to the bitsliced form, where every byte of register
+ * i is 0xff or 0x00 depending on bit i of the key byte. Each key is put in
+ * the byte order the state has when it is added, which differs between the
+ * directions. Every key after the first also carries the constant of the
+ * S-box, which for decryption is added before the next inverse S-box and
+ * passes through InvMixColumns unchanged.
+ */
+SSSE3_TARGET static void
+ssse3_expand_sk (aes_bitslice_word *sk, const uint32_t *ek,
+                 unsigned int rounds, int decrypt)
+{
+  __m128i k, bit;
+  unsigned int i, j, f;
+
+  for (i = 0; i <= rounds; ++i)
+    {
+      f = (decrypt ? i - rounds : i) & 3;
+      k = _mm_shuffle_epi8 (ssse3_load_rk (ek + i * 4),
+                            ssse3_table (ssse3_frame[f]));
+      if (i > 0)
+        k = _mm_xor_si128 (k, _mm_set1_epi8 (0x63));
+      for (j = 0; j < 8; ++j)
+        {
+          bit = _mm_set1_epi8 ((char)(1 << j));
+          sk[i * 8 + j] = (aes_bitslice_word)_mm_cmpeq_epi8 (
+              _mm_and_si128 (k, bit), bit);
+        }
+    }
+}
+
+/*
+ * The plane operations are written out rather than looped over, which lets
+ * the compiler keep the planes in registers across the round.
+ */
+SSSE3_TARGET static inline void
+ssse3_bs_add_round_key (aes_bitslice_word *q, const aes_bitslice_word *sk)
+{
+  q[0] ^= sk[0];
+  q[1] ^= sk[1];
+  q[2] ^= sk[2];
+  q[3] ^= sk[3];
+  q[4] ^= sk[4];
+  q[5] ^= sk[5];
+  q[6] ^= sk[6];
+  q[7] ^= sk[7];
+}
+
+#define SSSE3_SHUFFLE(w, mask)                                                \
+  ((aes_bitslice_word)_mm_shuffle_epi8 ((__m128i)(w), (mask)))
+
+/*
+ * MixColumns on the bit planes in byte order f. Doubling moves each plane up
+ * by one and adds the top plane into the planes of 0x1b.
+ */
+SSSE3_TARGET static inline void
+ssse3_bs_mix_columns (aes_bitslice_word *q, unsigned int f)
+{
+  aes_bitslice_word r0, r1, r2, r3, r4, r5, r6, r7;
+  aes_bitslice_word t0, t1, t2, t3, t4, t5, t6, t7;
+  __m128i rot1, rot2;
+
+  rot1 = ssse3_table (ssse3_frame_rot1[f]);
+  rot2 = ssse3_table (ssse3_frame_rot2[f & 1]);
+  r0 = SSSE3_SHUFFLE (q[0], rot1);
+  r1 = SSSE3_SHUFFLE (q[1], rot1);
+  r2 = SSSE3_SHUFFLE (q[2], rot1);
+  r3 = SSSE3_SHUFFLE (q[3], rot1);
+  r4 = SSSE3_SHUFFLE (q[4], rot1);
+  r5 = SSSE3_SHUFFLE (q[5], rot1);
+  r6 = SSSE3_SHUFFLE (q[6], rot1);
+  r7 = SSSE3_SHUFFLE (q[7], rot1);
+  t0 = q[0] ^ r0;
+  t1 = q[1] ^ r1;
+  t2 = q[2] ^ r2;
+  t3 = q[3] ^ r3;
+  t4 = q[4] ^ r4;
+  t5 = q[5] ^ r5;
+  t6 = q[6] ^ r6;
+  t7 = q[7] ^ r7;
+  q[0] = r0 ^ SSSE3_SHUFFLE (t0, rot2) ^ t7;
+  q[1] = r1 ^ SSSE3_SHUFFLE (t1, rot2) ^ t0 ^ t7;
+  q[2] = r2 ^ SSSE3_SHUFFLE (t2, rot2) ^ t1;
+  q[3] = r3 ^ SSSE3_SHUFFLE (t3, rot2) ^ t2 ^ t7;
+  q[4] = r4 ^ SSSE3_SHUFFLE (t4, rot2) ^ t3 ^ t7;
+  q[5] = r5 ^ SSSE3_SHUFFLE (t5, rot2) ^ t4;
+  q[6] = r6 ^ SSSE3_SHUFFLE (t6, rot2) ^ t5;
+  q[7] = r7 ^ SSSE3_SHUFFLE (t7, rot2) ^ t6;
+}
+
+SSSE3_TARGET static inline void
+ssse3_bs_inv_mix_columns (aes_bitslice_word *q, unsigned int f)
+{
+  aes_bitslice_word w0, w1, w2, w3, w4, w5, w6, w7;
+  __m128i rot2;
+
+  rot2 = ssse3_table (ssse3_frame_rot2[f & 1]);
+  w0 = q[0] ^ SSSE3_SHUFFLE (q[0], rot2);
+  w1 = q[1] ^ SSSE3_SHUFFLE (q[1], rot2);
+  w2 = q[2] ^ SSSE3_SHUFFLE (q[2], rot2);
+  w3 = q[3] ^ SSSE3_SHUFFLE (q[3], rot2);
+  w4 = q[4] ^ SSSE3_SHUFFLE (q[4], rot2);
+  w5 = q[5] ^ SSSE3_SHUFFLE (q[5], rot2);
+  w6 = q[6] ^ SSSE3_SHUFFLE (q[6], rot2);
+  w7 = q[7] ^ SSSE3_SHUFFLE (q[7], rot2);
+  /* Four times w. */
+  q[0] ^= w6;
+  q[1] ^= w6 ^ w7;
+  q[2] ^= w0 ^ w7;
+  q[3] ^= w1 ^ w6;
+  q[4] ^= w2 ^ w6 ^ w7;
+  q[5] ^= w3 ^ w7;
+  q[6] ^= w4;
+  q[7] ^= w5;
+  ssse3_bs_mix_columns (q, f);
+}
+
+/* Puts the bytes of eight blocks in byte order f back in state order. */
+SSSE3_TARGET static inline void
+ssse3_bs_unpermute (__m128i *x, unsigned int f)
+{
+  __m128i mask;
+  unsigned int i;
+
+  if (f == 0)
+    return;
+  mask = ssse3_table (ssse3_frame[(4 - f) & 3]);
+  for (i = 0; i < 8; ++i)
+    x[i] = _mm_shuffle_epi8 (x[i], mask);
+}
+
+/* Encrypts eight blocks in place. */
+SSSE3_TARGET static void
+ssse3_bs_encrypt (const aes_bitslice_word *sk, unsigned int rounds,
+                  __m128i *x)
+{
+  aes_bitslice_word q[8];
+  unsigned int i;
+
+  ssse3_bitslice (q, x);
+  ssse3_bs_add_round_key (q, sk);
+  for (i = 1; i < rounds; ++i)
+    {
+      aes_bitslice_sbox_without_c (q);
+      ssse3_bs_mix_columns (q, i & 3);
+      ssse3_bs_add_round_key (q, sk + i * 8);
+    }
+  aes_bitslice_sbox_without_c (q);
+  ssse3_bs_add_round_key (q, sk + rounds * 8);
+  ssse3_unbitslice (x, q);
+  ssse3_bs_unpermute (x, rounds & 3);
+}
+
+SSSE3_TARGET static void
+ssse3_bs_decrypt (const aes_bitslice_word *sk, unsigned int rounds,
+                  __m128i *x)
+{
+  aes_bitslice_word q[8];
+  unsigned int i;
+
+  ssse3_bitslice (q, x);
+  ssse3_bs_add_round_key (q, sk + rounds * 8);
+  for (i = rounds - 1; i > 0; --i)
+    {
+      aes_bitslice_inv_sbox_without_c (q);
+      ssse3_bs_add_round_key (q, sk + i * 8);
+      ssse3_bs_inv_mix_columns (q, (i - rounds) & 3);
+    }
+  aes_bitslice_inv_sbox_without_c (q);
+  ssse3_bs_add_round_key (q, sk);
+  ssse3_unbitslice (x, q);
+  ssse3_bs_unpermute (x, -rounds & 3);
+}
+
+/* Encrypts or decrypts the blocks in x, bitsliced unless there are few. */
+SSSE3_TARGET static inline void
+ssse3_encrypt_blocks (const aes_bitslice_word *sk, const uint32_t *ek,
+                      unsigned int rounds, __m128i *x, size_t blocks)
+{
+  size_t i;
+
+  if (blocks <= SSSE3_SMALL_BLOCKS)
+    ssse3_encrypt_small (ek, rounds, x, blocks);
+  else
+    {
+      for (i = blocks; i < SSSE3_BLOCKS; ++i)
+        x[i] = _mm_setzero_si128 ();
+      ssse3_bs_encrypt (sk, rounds, x);
+    }
+}
+
+SSSE3_TARGET static inline void
+ssse3_decrypt_blocks (const aes_bitslice_word *sk, const uint32_t *dk,
+                      unsigned int rounds, __m128i *x, size_t blocks)
+{
+  size_t i;
+
+  if (blocks <= SSSE3_SMALL_BLOCKS)
+    ssse3_decrypt_small (dk, rounds, x, blocks);
+  else
+    {
+      for (i = blocks; i < SSSE3_BLOCKS; ++i)
+        x[i] = _mm_setzero_si128 ();
+      ssse3_bs_decrypt (sk, rounds, x);
+    }
+}
+
+SSSE3_TARGET static void
+aes_ecb_encrypt_ssse3 (const uint32_t *ek, unsigned int rounds,
+                       const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  __m128i x[SSSE3_BLOCKS];
+  size_t i, n;
+
+  if (blocks > SSSE3_SMALL_BLOCKS)
+    ssse3_expand_sk (sk, ek, rounds, 0);
+  while (blocks > 0)
+    {
+      n = blocks < SSSE3_BLOCKS ? blocks : SSSE3_BLOCKS;
+      for (i = 0; i < n; ++i)
+        x[i] = _mm_loadu_si128 ((const __m128i *)(src + i * AES_BLOCK_SIZE));
+      ssse3_encrypt_blocks (sk, ek, rounds, x, n);
+      for (i = 0; i < n; ++i)
+        _mm_storeu_si128 ((__m128i *)(dest + i * AES_BLOCK_SIZE), x[i]);
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+}
+
+SSSE3_TARGET static void
+aes_ecb_decrypt_ssse3 (const uint32_t *dk, unsigned int rounds,
+                       const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  __m128i x[SSSE3_BLOCKS];
+  size_t i, n;
+
+  if (blocks > SSSE3_SMALL_BLOCKS)
+    ssse3_expand_sk (sk, dk, rounds, 1);
+  while (blocks > 0)
+    {
+      n = blocks < SSSE3_BLOCKS ? blocks : SSSE3_BLOCKS;
+      for (i = 0; i < n; ++i)
+        x[i] = _mm_loadu_si128 ((const __m128i *)(src + i * AES_BLOCK_SIZE));
+      ssse3_decrypt_blocks (sk, dk, rounds, x, n);
+      for (i = 0; i < n; ++i)
+        _mm_storeu_si128 ((__m128i *)(dest + i * AES_BLOCK_SIZE), x[i]);
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+}
+
+SSSE3_TARGET static void
+aes_cbc_decrypt_ssse3 (const uint32_t *dk, unsigned int rounds, uint8_t *iv,
+                       const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  __m128i x[SSSE3_BLOCKS], c[SSSE3_BLOCKS];
+  __m128i prev;
+  size_t i, n;
+
+  if (blocks > SSSE3_SMALL_BLOCKS)
+    ssse3_expand_sk (sk, dk, rounds, 1);
+  prev = _mm_loadu_si128 ((const __m128i *)iv);
+  while (blocks > 0)
+    {
+      n = blocks < SSSE3_BLOCKS ? blocks : SSSE3_BLOCKS;
+      for (i = 0; i < n; ++i)
+        {
+          c[i] = _mm_loadu_si128 (
+              (const __m128i *)(src + i * AES_BLOCK_SIZE));
+          x[i] = c[i];
+        }
+      ssse3_decrypt_blocks (sk, dk, rounds, x, n);
+      for (i = 0; i < n; ++i)
+        {
+          _mm_storeu_si128 ((__m128i *)(dest + i * AES_BLOCK_SIZE),
+                            _mm_xor_si128 (x[i], prev));
+          prev = c[i];
+        }
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+  _mm_storeu_si128 ((__m128i *)iv, prev);
+}
+
+SSSE3_TARGET static void
+aes_ctr_crypt_ssse3 (const uint32_t *ek, unsigned int rounds, uint8_t *ctr,
+                     const uint8_t *src, uint8_t *dest, size_t len)
+{
+  aes_bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  uint8_t keystream[SSSE3_BLOCKS * AES_BLOCK_SIZE];
+  __m128i x[SSSE3_BLOCKS];
+  uint64_t hi, lo;
+  size_t i, n, blocks;
+  /* Puts both halves of the counter in big-endian order. */
+  const __m128i bswap
+      = _mm_setr_epi8 (7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+  if (len > SSSE3_SMALL_BLOCKS * AES_BLOCK_SIZE)
+    ssse3_expand_sk (sk, ek, rounds, 0);
+  aes_ctr_load (ctr, &hi, &lo);
+  while (len > 0)
+    {
+      n = len < sizeof (keystream) ? len : sizeof (keystream);
+      blocks = (n + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE;
+      for (i = 0; i < blocks; ++i)
+        {
+          x[i] = _mm_shuffle_epi8 (_mm_set_epi64x ((long long)lo,
+                                                   (long long)hi),
+                                   bswap);
+          hi += ++lo == 0;
+        }
+      ssse3_encrypt_blocks (sk, ek, rounds, x, blocks);
+      if (n == sizeof (keystream))
+        for (i = 0; i < SSSE3_BLOCKS; ++i)
+          _mm_storeu_si128 (
+              (__m128i *)(dest + i * AES_BLOCK_SIZE),
+              _mm_xor_si128 (x[i], _mm_loadu_si128 ((const __m128i *)(
+                                       src + i * AES_BLOCK_SIZE))));
+      else
+        {
+          for (i = 0; i < blocks; ++i)
+            _mm_storeu_si128 ((__m128i *)(keystream + i * AES_BLOCK_SIZE),
+                              x[i]);
+          for (i = 0; i < n; ++i)
+            dest[i] = src[i] ^ keystream[i];
+        }
+      src += n;
+      dest += n;
+      len -= n;
+    }
+  aes_ctr_store (ctr, hi, lo);
+}
+
+SSSE3_TARGET static uint32_t
+ssse3_sub_word (uint32_t w)
+{
+  return (uint32_t)_mm_cvtsi128_si32 (
+      ssse3_sub_bytes (_mm_cvtsi32_si128 ((int)w)));
+}
+
+/* FIPS 197 key expansion, with SubWord from the PSHUFB tables. */
+SSSE3_TARGET static void
+ssse3_expand_key (uint32_t *ek, const uint8_t *key, unsigned int nk)
+{
+  uint32_t t, rcon;
+  unsigned int i;
+
+  for (i = 0; i < nk; ++i)
+    ek[i] = buff_get_be32 (key + i * 4);
+  rcon = 0x01;
+  for (i = nk; i < 4 * (nk + 7); ++i)
+    {
+      t = ek[i - 1];
+      if (i % nk == 0)
+        {
+          t = ssse3_sub_word ((t << 8) | (t >> 24)) ^ (rcon << 24);
+          rcon = ((rcon << 1) ^ (((rcon >> 7) & 1) * 0x1b)) & 0xff;
+        }
+      else if (nk > 6 && i % nk == 4)
+        t = ssse3_sub_word (t);
+      ek[i] = ek[i - nk] ^ t;
+    }
+}
+
+static void
+aes_expand_keys_ssse3 (uint32_t *const *ek, const uint8_t *const *key,
+                       size_t n, unsigned int nk)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    ssse3_expand_key (ek[i], key[i], nk);
+}
+
+static void
+aes128_expand_key_ssse3 (uint32_t *ek, const uint8_t *key)
+{
+  ssse3_expand_key (ek, key, 4);
+}
+
+static void
+aes192_expand_key_ssse3 (uint32_t *ek, const uint8_t *key)
+{
+  ssse3_expand_key (ek, key, 6);
+}
+
+static void
+aes256_expand_key_ssse3 (uint32_t *ek, const uint8_t *key)
+{
+  ssse3_expand_key (ek, key, 8);
+}
+
+static void
+aes128_invert_key_ssse3 (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES128_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+static void
+aes192_invert_key_ssse3 (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES192_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+static void
+aes256_invert_key_ssse3 (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES256_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+SSSE3_TARGET static inline void
+ssse3_encrypt1 (const uint32_t *ek, unsigned int rounds, const uint8_t *src,
+                uint8_t *dest)
+{
+  __m128i x;
+
+  x = _mm_loadu_si128 ((const __m128i *)src);
+  ssse3_encrypt_small (ek, rounds, &x, 1);
+  _mm_storeu_si128 ((__m128i *)dest, x);
+}
+
+SSSE3_TARGET static inline void
+ssse3_decrypt1 (const uint32_t *dk, unsigned int rounds, const uint8_t *src,
+                uint8_t *dest)
+{
+  __m128i x;
+
+  x = _mm_loadu_si128 ((const __m128i *)src);
+  ssse3_decrypt_small (dk, rounds, &x, 1);
+  _mm_storeu_si128 ((__m128i *)dest, x);
+}
+
+SSSE3_TARGET static void
+aes128_encrypt_ssse3 (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  ssse3_encrypt1 (ek, AES128_ROUNDS, src, dest);
+}
+
+SSSE3_TARGET static void
+aes192_encrypt_ssse3 (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  ssse3_encrypt1 (ek, AES192_ROUNDS, src, dest);
+}
+
+SSSE3_TARGET static void
+aes256_encrypt_ssse3 (const uint32_t *ek, const uint8_t *src, uint8_t *dest)
+{
+  ssse3_encrypt1 (ek, AES256_ROUNDS, src, dest);
+}
+
+SSSE3_TARGET static void
+aes128_decrypt_ssse3 (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  ssse3_decrypt1 (dk, AES128_ROUNDS, src, dest);
+}
+
+SSSE3_TARGET static void
+aes192_decrypt_ssse3 (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  ssse3_decrypt1 (dk, AES192_ROUNDS, src, dest);
+}
+
+SSSE3_TARGET static void
+aes256_decrypt_ssse3 (const uint32_t *dk, const uint8_t *src, uint8_t *dest)
+{
+  ssse3_decrypt1 (dk, AES256_ROUNDS, src, dest);
+}
+
+const struct aes_backend aes_backend_ssse3 = {
+  "ssse3",
+  aes128_expand_key_ssse3,
+  aes192_expand_key_ssse3,
+  aes256_expand_key_ssse3,
+  aes128_invert_key_ssse3,
+  aes192_invert_key_ssse3,
+  aes256_invert_key_ssse3,
+  aes128_encrypt_ssse3,
+  aes192_encrypt_ssse3,
+  aes256_encrypt_ssse3,
+  aes128_decrypt_ssse3,
+  aes192_decrypt_ssse3,
+  aes256_decrypt_ssse3,
+  aes_ctr_crypt_ssse3,
+  aes_ecb_encrypt_ssse3,
+  aes_ecb_decrypt_ssse3,
+  aes_cbc_decrypt_ssse3,
+  aes_expand_keys_ssse3,
+  NULL,
+  NULL,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int aes_ssse3_unused;
+
+#endif /* HAVE_SSSE3_INTRINSICS */
@@ -0,0 +1,759 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Constant time AES for processors without AES instructions. Eight blocks are
+ * processed at once in the bitsliced representation described in "Faster and
+ * Timing-Attack Resistant AES-GCM" by Emilia Kasper and Peter Schwabe, using
+ * the 64-bit variant of the layout from BearSSL's aes_ct64: four blocks are
+ * spread over eight 64-bit words so that word i holds bit i of every byte.
+ *
+ * The S-box is the Boyar-Peralta circuit in aes-internal.h, so there are no
+ * table lookups and no memory accesses or branches that depend on secret
+ * data. With the GCC vector extensions each word is a 128-bit vector holding
+ * two groups of four blocks. This is the fallback for processors that have
+ * neither SSSE3 nor NEON, see aes-bitslice-ssse3.c and aes-bitslice-neon.c.
+ *
+ * The key schedule is kept in the context in a compressed bitsliced form
+ * that takes the same space as the usual round keys, and is expanded on the
+ * stack by every call. Decryption uses the same round keys, so the
+ * decryption key schedule is a copy.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "aes-internal.h"
+#include "aes.h"
+#include "bswap.h"
+
+#if defined(__GNUC__)
+typedef aes_bitslice_word bitslice_word;
+#define BITSLICE_LANES 2
+#define BITSLICE_GET(v, l) ((v)[(l)])
+#define BITSLICE_SET(v, l, x) ((v)[(l)] = (x))
+#else
+typedef uint64_t bitslice_word;
+#define BITSLICE_LANES 1
+#define BITSLICE_GET(v, l) (v)
+#define BITSLICE_SET(v, l, x) ((v) = (x))
+#endif
+
+/* Number of blocks encrypted by one pass over the bitsliced state. */
+#define BITSLICE_BLOCKS (4 * BITSLICE_LANES)
+
+static inline bitslice_word
+bitslice_splat (uint64_t x)
+{
+  bitslice_word v = { 0 };
+  unsigned int l;
+
+  for (l = 0; l < BITSLICE_LANES; ++l)
+    BITSLICE_SET (v, l, x);
+  return v;
+}
+
+static inline bitslice_word
+bitslice_rotr32 (bitslice_word x)
+{
+  return (x << 32) | (x >> 32);
+}
+
+#define BITSLICE_SWAPN(cl, ch, s, x, y)                                       \
+  do                                                                          \
+    {                                                                         \
+      bitslice_word a_, b_;                                                   \
+                                                                              \
+      a_ = (x);                                                               \
+      b_ = (y);                                                               \
+      (x) = (a_ & UINT64_C (cl)) | ((b_ & UINT64_C (cl)) << (s));             \
+      (y) = ((a_ & UINT64_C (ch)) >> (s)) | (b_ & UINT64_C (ch));             \
+    }                                                                         \
+  while (0)
+
+#define BITSLICE_SWAP2(x, y)                                                  \
+  BITSLICE_SWAPN (0x5555555555555555, 0xaaaaaaaaaaaaaaaa, 1, x, y)
+#define BITSLICE_SWAP4(x, y)                                                  \
+  BITSLICE_SWAPN (0x3333333333333333, 0xcccccccccccccccc, 2, x, y)
+#define BITSLICE_SWAP8(x, y)                                                  \
+  BITSLICE_SWAPN (0x0f0f0f0f0f0f0f0f, 0xf0f0f0f0f0f0f0f0, 4, x, y)
+
+/* Converts between the interleaved and the bitsliced layout, both ways. */
+static inline void
+bitslice_ortho (bitslice_word *q)
+{
+  BITSLICE_SWAP2 (q[0], q[1]);
+  BITSLICE_SWAP2 (q[2], q[3]);
+  BITSLICE_SWAP2 (q[4], q[5]);
+  BITSLICE_SWAP2 (q[6], q[7]);
+
+  BITSLICE_SWAP4 (q[0], q[2]);
+  BITSLICE_SWAP4 (q[1], q[3]);
+  BITSLICE_SWAP4 (q[4], q[6]);
+  BITSLICE_SWAP4 (q[5], q[7]);
+
+  BITSLICE_SWAP8 (q[0], q[4]);
+  BITSLICE_SWAP8 (q[1], q[5]);
+  BITSLICE_SWAP8 (q[2], q[6]);
+  BITSLICE_SWAP8 (q[3], q[7]);
+}
+
+/*
+ * Spreads the four little-endian words of one block over two 64-bit words,
+ * the even bytes of every column in lo and the odd bytes in hi.
+ */
+static inline void
+bitslice_interleave_in (uint64_t *lo, uint64_t *hi, const uint32_t *w)
+{
+  uint64_t x0, x1, x2, x3;
+
+  x0 = w[0];
+  x1 = w[1];
+  x2 = w[2];
+  x3 = w[3];
+  x0 |= x0 << 16;
+  x1 |= x1 << 16;
+  x2 |= x2 << 16;
+  x3 |= x3 << 16;
+  x0 &= UINT64_C (0x0000ffff0000ffff);
+  x1 &= UINT64_C (0x0000ffff0000ffff);
+  x2 &= UINT64_C (0x0000ffff0000ffff);
+  x3 &= UINT64_C (0x0000ffff0000ffff);
+  x0 |= x0 << 8;
+  x1 |= x1 << 8;
+  x2 |= x2 << 8;
+  x3 |= x3 << 8;
+  x0 &= UINT64_C (0x00ff00ff00ff00ff);
+  x1 &= UINT64_C (0x00ff00ff00ff00ff);
+  x2 &= UINT64_C (0x00ff00ff00ff00ff);
+  x3 &= UINT64_C (0x00ff00ff00ff00ff);
+  *lo = x0 | (x2 << 8);
+  *hi = x1 | (x3 << 8);
+}
+
+static inline void
+bitslice_interleave_out (uint32_t *w, uint64_t lo, uint64_t hi)
+{
+  uint64_t x0, x1, x2, x3;
+
+  x0 = lo & UINT64_C (0x00ff00ff00ff00ff);
+  x1 = hi & UINT64_C (0x00ff00ff00ff00ff);
+  x2 = (lo >> 8) & UINT64_C (0x00ff00ff00ff00ff);
+  x3 = (hi >> 8) & UINT64_C (0x00ff00ff00ff00ff);
+  x0 |= x0 >> 8;
+  x1 |= x1 >> 8;
+  x2 |= x2 >> 8;
+  x3 |= x3 >> 8;
+  x0 &= UINT64_C (0x0000ffff0000ffff);
+  x1 &= UINT64_C (0x0000ffff0000ffff);
+  x2 &= UINT64_C (0x0000ffff0000ffff);
+  x3 &= UINT64_C (0x0000ffff0000ffff);
+  w[0] = (uint32_t)x0 | (uint32_t)(x0 >> 16);
+  w[1] = (uint32_t)x1 | (uint32_t)(x1 >> 16);
+  w[2] = (uint32_t)x2 | (uint32_t)(x2 >> 16);
+  w[3] = (uint32_t)x3 | (uint32_t)(x3 >> 16);
+}
+
+static inline void
+bitslice_add_round_key (bitslice_word *q, const bitslice_word *sk)
+{
+  q[0] ^= sk[0];
+  q[1] ^= sk[1];
+  q[2] ^= sk[2];
+  q[3] ^= sk[3];
+  q[4] ^= sk[4];
+  q[5] ^= sk[5];
+  q[6] ^= sk[6];
+  q[7] ^= sk[7];
+}
+
+/* Each 16-bit group of a word holds one row of the four blocks. */
+static inline void
+bitslice_shift_rows (bitslice_word *q)
+{
+  bitslice_word x;
+  unsigned int i;
+
+  for (i = 0; i < 8; ++i)
+    {
+      x = q[i];
+      q[i] = (x & UINT64_C (0x000000000000ffff))
+             | ((x & UINT64_C (0x00000000fff00000)) >> 4)
+             | ((x & UINT64_C (0x00000000000f0000)) << 12)
+             | ((x & UINT64_C (0x0000ff0000000000)) >> 8)
+             | ((x & UINT64_C (0x000000ff00000000)) << 8)
+             | ((x & UINT64_C (0xf000000000000000)) >> 12)
+             | ((x & UINT64_C (0x0fff000000000000)) << 4);
+    }
+}
+
+static inline void
+bitslice_inv_shift_rows (bitslice_word *q)
+{
+  bitslice_word x;
+  unsigned int i;
+
+  for (i = 0; i < 8; ++i)
+    {
+      x = q[i];
+      q[i] = (x & UINT64_C (0x000000000000ffff))
+             | ((x & UINT64_C (0x000000000fff0000)) << 4)
+             | ((x & UINT64_C (0x00000000f0000000)) >> 12)
+             | ((x & UINT64_C (0x000000ff00000000)) << 8)
+             | ((x & UINT64_C (0x0000ff0000000000)) >> 8)
+             | ((x & UINT64_C (0x000f000000000000)) << 12)
+             | ((x & UINT64_C (0xfff0000000000000)) >> 4);
+    }
+}
+
+static inline void
+bitslice_mix_columns (bitslice_word *q)
+{
+  bitslice_word q0, q1, q2, q3, q4, q5, q6, q7;
+  bitslice_word r0, r1, r2, r3, r4, r5, r6, r7;
+
+  q0 = q[0];
+  q1 = q[1];
+  q2 = q[2];
+  q3 = q[3];
+  q4 = q[4];
+  q5 = q[5];
+  q6 = q[6];
+  q7 = q[7];
+  r0 = (q0 >> 16) | (q0 << 48);
+  r1 = (q1 >> 16) | (q1 << 48);
+  r2 = (q2 >> 16) | (q2 << 48);
+  r3 = (q3 >> 16) | (q3 << 48);
+  r4 = (q4 >> 16) | (q4 << 48);
+  r5 = (q5 >> 16) | (q5 << 48);
+  r6 = (q6 >> 16) | (q6 << 48);
+  r7 = (q7 >> 16) | (q7 << 48);
+
+  q[0] = q7 ^ r7 ^ r0 ^ bitslice_rotr32 (q0 ^ r0);
+  q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ bitslice_rotr32 (q1 ^ r1);
+  q[2] = q1 ^ r1 ^ r2 ^ bitslice_rotr32 (q2 ^ r2);
+  q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ bitslice_rotr32 (q3 ^ r3);
+  q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ bitslice_rotr32 (q4 ^ r4);
+  q[5] = q4 ^ r4 ^ r5 ^ bitslice_rotr32 (q5 ^ r5);
+  q[6] = q5 ^ r5 ^ r6 ^ bitslice_rotr32 (q6 ^ r6);
+  q[7] = q6 ^ r6 ^ r7 ^ bitslice_rotr32 (q7 ^ r7);
+}
+
+static inline void
+bitslice_inv_mix_columns (bitslice_word *q)
+{
+  bitslice_word q0, q1, q2, q3, q4, q5, q6, q7;
+  bitslice_word r0, r1, r2, r3, r4, r5, r6, r7;
+
+  q0 = q[0];
+  q1 = q[1];
+  q2 = q[2];
+  q3 = q[3];
+  q4 = q[4];
+  q5 = q[5];
+  q6 = q[6];
+  q7 = q[7];
+  r0 = (q0 >> 16) | (q0 << 48);
+  r1 = (q1 >> 16) | (q1 << 48);
+  r2 = (q2 >> 16) | (q2 << 48);
+  r3 = (q3 >> 16) | (q3 << 48);
+  r4 = (q4 >> 16) | (q4 << 48);
+  r5 = (q5 >> 16) | (q5 << 48);
+  r6 = (q6 >> 16) | (q6 << 48);
+  r7 = (q7 >> 16) | (q7 << 48);
+
+  q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7
+         ^ bitslice_rotr32 (q0 ^ q5 ^ q6 ^ r0 ^ r5);
+  q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7
+         ^ bitslice_rotr32 (q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+  q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7
+         ^ bitslice_rotr32 (q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+  q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5
+         ^ bitslice_rotr32 (q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+  q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7
+         ^ bitslice_rotr32 (q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+  q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7
+         ^ bitslice_rotr32 (q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+  q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7
+         ^ bitslice_rotr32 (q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+  q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7
+         ^ bitslice_rotr32 (q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+
+static void
+bitslice_encrypt (const bitslice_word *sk, unsigned int rounds,
+                  bitslice_word *q)
+{
+  unsigned int i;
+
+  bitslice_add_round_key (q, sk);
+  for (i = 1; i < rounds; ++i)
+    {
+      aes_bitslice_sbox (q);
+      bitslice_shift_rows (q);
+      bitslice_mix_columns (q);
+      bitslice_add_round_key (q, sk + i * 8);
+    }
+  aes_bitslice_sbox (q);
+  bitslice_shift_rows (q);
+  bitslice_add_round_key (q, sk + rounds * 8);
+}
+
+static void
+bitslice_decrypt (const bitslice_word *sk, unsigned int rounds,
+                  bitslice_word *q)
+{
+  unsigned int i;
+
+  bitslice_add_round_key (q, sk + rounds * 8);
+  for (i = rounds - 1; i > 0; --i)
+    {
+      bitslice_inv_shift_rows (q);
+      aes_bitslice_inv_sbox (q);
+      bitslice_add_round_key (q, sk + i * 8);
+      bitslice_inv_mix_columns (q);
+    }
+  bitslice_inv_shift_rows (q);
+  aes_bitslice_inv_sbox (q);
+  bitslice_add_round_key (q, sk);
+}
+
+/* Loads up to BITSLICE_BLOCKS blocks, the missing ones are zero. */
+static void
+bitslice_load (bitslice_word *q, const uint8_t *src, size_t blocks)
+{
+  uint32_t w[4];
+  uint64_t lo, hi;
+  unsigned int i, j, l;
+
+  for (l = 0; l < BITSLICE_LANES; ++l)
+    for (i = 0; i < 4; ++i)
+      {
+        for (j = 0; j < 4; ++j)
+          w[j] = 4 * l + i < blocks
+                     ? buff_get_le32 (src + (4 * l + i) * AES_BLOCK_SIZE
+                                      + j * 4)
+                     : 0;
+        bitslice_interleave_in (&lo, &hi, w);
+        BITSLICE_SET (q[i], l, lo);
+        BITSLICE_SET (q[i + 4], l, hi);
+      }
+  bitslice_ortho (q);
+}
+
+static void
+bitslice_store (bitslice_word *q, uint8_t *dest, size_t blocks)
+{
+  uint32_t w[4];
+  unsigned int i, j, l;
+
+  bitslice_ortho (q);
+  for (l = 0; l < BITSLICE_LANES; ++l)
+    for (i = 0; i < 4 && 4 * l + i < blocks; ++i)
+      {
+        bitslice_interleave_out (w, BITSLICE_GET (q[i], l),
+                                 BITSLICE_GET (q[i + 4], l));
+        for (j = 0; j < 4; ++j)
+          buff_put_le32 (dest + (4 * l + i) * AES_BLOCK_SIZE + j * 4, w[j]);
+      }
+}
+
+/*
+ * S-box of every byte of the little-endian words x[0] to x[n - 1], n at most
+ * 16. Two words go in each 64-bit half of the first lane.
+ */
+static void
+bitslice_sub_words (uint32_t *x, size_t n)
+{
+  bitslice_word q[8];
+  unsigned int i;
+
+  for (i = 0; i < 8; ++i)
+    q[i] = bitslice_splat (0);
+  for (i = 0; i < n; ++i)
+    BITSLICE_SET (q[i / 2], 0,
+                  BITSLICE_GET (q[i / 2], 0)
+                      | ((uint64_t)x[i] << (32 * (i % 2))));
+  bitslice_ortho (q);
+  aes_bitslice_sbox (q);
+  bitslice_ortho (q);
+  for (i = 0; i < n; ++i)
+    x[i] = (uint32_t)(BITSLICE_GET (q[i / 2], 0) >> (32 * (i % 2)));
+}
+
+static uint32_t
+bitslice_sub_word (uint32_t x)
+{
+  bitslice_sub_words (&x, 1);
+  return x;
+}
+
+/*
+ * Converts the expanded key words in w to the bitsliced layout, where all
+ * four blocks of a word share the key, so only every fourth bit has to be
+ * kept to store a round key in four 32-bit words.
+ */
+static void
+bitslice_compress_key (uint32_t *ek, const uint32_t *w, unsigned int rounds)
+{
+  uint64_t q[8];
+  uint64_t c0, c1;
+  unsigned int i;
+
+  for (i = 0; i < 4 * (rounds + 1); i += 4)
+    {
+      bitslice_interleave_in (&q[0], &q[4], w + i);
+      q[1] = q[0];
+      q[2] = q[0];
+      q[3] = q[0];
+      q[5] = q[4];
+      q[6] = q[4];
+      q[7] = q[4];
+      {
+        bitslice_word v[8];
+        unsigned int j;
+
+        for (j = 0; j < 8; ++j)
+          v[j] = bitslice_splat (q[j]);
+        bitslice_ortho (v);
+        for (j = 0; j < 8; ++j)
+          q[j] = BITSLICE_GET (v[j], 0);
+      }
+      c0 = (q[0] & UINT64_C (0x1111111111111111))
+           | (q[1] & UINT64_C (0x2222222222222222))
+           | (q[2] & UINT64_C (0x4444444444444444))
+           | (q[3] & UINT64_C (0x8888888888888888));
+      c1 = (q[4] & UINT64_C (0x1111111111111111))
+           | (q[5] & UINT64_C (0x2222222222222222))
+           | (q[6] & UINT64_C (0x4444444444444444))
+           | (q[7] & UINT64_C (0x8888888888888888));
+      ek[i] = (uint32_t)c0;
+      ek[i + 1] = (uint32_t)(c0 >> 32);
+      ek[i + 2] = (uint32_t)c1;
+      ek[i + 3] = (uint32_t)(c1 >> 32);
+    }
+}
+
+/* FIPS 197 key expansion on little-endian words. */
+static void
+bitslice_expand_key (uint32_t *ek, const uint8_t *key, unsigned int nk,
+                     unsigned int rounds)
+{
+  uint32_t w[60];
+  uint32_t t, rcon;
+  unsigned int i;
+
+  for (i = 0; i < nk; ++i)
+    w[i] = buff_get_le32 (key + i * 4);
+  rcon = 0x01;
+  for (i = nk; i < 4 * (rounds + 1); ++i)
+    {
+      t = w[i - 1];
+      if (i % nk == 0)
+        {
+          t = bitslice_sub_word ((t >> 8) | (t << 24)) ^ rcon;
+          rcon = ((rcon << 1) ^ (((rcon >> 7) & 1) * 0x1b)) & 0xff;
+        }
+      else if (nk > 6 && i % nk == 4)
+        t = bitslice_sub_word (t);
+      w[i] = w[i - nk] ^ t;
+    }
+
+  bitslice_compress_key (ek, w, rounds);
+}
+
+/*
+ * Key expansion of up to AES_KEY_BATCH keys in lockstep, so that one pass of
+ * the bitsliced S-box does SubWord for all of them.
+ */
+static void
+bitslice_expand_keys (uint32_t *const *ek, const uint8_t *const *key,
+                      size_t n, unsigned int nk)
+{
+  uint32_t w[AES_KEY_BATCH][60];
+  uint32_t t[AES_KEY_BATCH];
+  uint32_t rcon;
+  unsigned int i, rounds;
+  size_t j;
+
+  rounds = nk + 6;
+  for (j = 0; j < n; ++j)
+    for (i = 0; i < nk; ++i)
+      w[j][i] = buff_get_le32 (key[j] + i * 4);
+  rcon = 0x01;
+  for (i = nk; i < 4 * (rounds + 1); ++i)
+    {
+      for (j = 0; j < n; ++j)
+        t[j] = w[j][i - 1];
+      if (i % nk == 0)
+        {
+          for (j = 0; j < n; ++j)
+            t[j] = (t[j] >> 8) | (t[j] << 24);
+          bitslice_sub_words (t, n);
+          for (j = 0; j < n; ++j)
+            t[j] ^= rcon;
+          rcon = ((rcon << 1) ^ (((rcon >> 7) & 1) * 0x1b)) & 0xff;
+        }
+      else if (nk > 6 && i % nk == 4)
+        bitslice_sub_words (t, n);
+      for (j = 0; j < n; ++j)
+        w[j][i] = w[j][i - nk] ^ t[j];
+    }
+  for (j = 0; j < n; ++j)
+    bitslice_compress_key (ek[j], w[j], rounds);
+}
+
+/* Expands the compressed round keys in ek to the full bitsliced form. */
+static void
+bitslice_expand_sk (bitslice_word *sk, const uint32_t *ek,
+                    unsigned int rounds)
+{
+  uint64_t x, x0, x1, x2, x3;
+  unsigned int i;
+
+  for (i = 0; i < 2 * (rounds + 1); ++i)
+    {
+      x = (uint64_t)ek[2 * i] | ((uint64_t)ek[2 * i + 1] << 32);
+      x0 = x & UINT64_C (0x1111111111111111);
+      x1 = (x & UINT64_C (0x2222222222222222)) >> 1;
+      x2 = (x & UINT64_C (0x4444444444444444)) >> 2;
+      x3 = (x & UINT64_C (0x8888888888888888)) >> 3;
+      sk[4 * i] = bitslice_splat ((x0 << 4) - x0);
+      sk[4 * i + 1] = bitslice_splat ((x1 << 4) - x1);
+      sk[4 * i + 2] = bitslice_splat ((x2 << 4) - x2);
+      sk[4 * i + 3] = bitslice_splat ((x3 << 4) - x3);
+    }
+}
+
+static void
+aes_ecb_encrypt_bitslice (const uint32_t *ek, unsigned int rounds,
+                          const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  bitslice_word q[8];
+  size_t n;
+
+  bitslice_expand_sk (sk, ek, rounds);
+  while (blocks > 0)
+    {
+      n = blocks < BITSLICE_BLOCKS ? blocks : BITSLICE_BLOCKS;
+      bitslice_load (q, src, n);
+      bitslice_encrypt (sk, rounds, q);
+      bitslice_store (q, dest, n);
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+}
+
+static void
+aes_ecb_decrypt_bitslice (const uint32_t *dk, unsigned int rounds,
+                          const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+  bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  bitslice_word q[8];
+  size_t n;
+
+  bitslice_expand_sk (sk, dk, rounds);
+  while (blocks > 0)
+    {
+      n = blocks < BITSLICE_BLOCKS ? blocks : BITSLICE_BLOCKS;
+      bitslice_load (q, src, n);
+      bitslice_decrypt (sk, rounds, q);
+      bitslice_store (q, dest, n);
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+}
+
+static void
+aes_cbc_decrypt_bitslice (const uint32_t *dk, unsigned int rounds,
+                          uint8_t *iv, const uint8_t *src, uint8_t *dest,
+                          size_t blocks)
+{
+  bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  bitslice_word q[8];
+  uint8_t c[BITSLICE_BLOCKS * AES_BLOCK_SIZE];
+  uint8_t prev[AES_BLOCK_SIZE];
+  size_t i, n;
+
+  bitslice_expand_sk (sk, dk, rounds);
+  memcpy (prev, iv, AES_BLOCK_SIZE);
+  while (blocks > 0)
+    {
+      n = blocks < BITSLICE_BLOCKS ? blocks : BITSLICE_BLOCKS;
+      memcpy (c, src, n * AES_BLOCK_SIZE);
+      bitslice_load (q, c, n);
+      bitslice_decrypt (sk, rounds, q);
+      bitslice_store (q, dest, n);
+      for (i = 0; i < AES_BLOCK_SIZE; ++i)
+        dest[i] ^= prev[i];
+      for (i = AES_BLOCK_SIZE; i < n * AES_BLOCK_SIZE; ++i)
+        dest[i] ^= c[i - AES_BLOCK_SIZE];
+      memcpy (prev, c + (n - 1) * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+      src += n * AES_BLOCK_SIZE;
+      dest += n * AES_BLOCK_SIZE;
+      blocks -= n;
+    }
+  memcpy (iv, prev, AES_BLOCK_SIZE);
+}
+
+static void
+aes_ctr_crypt_bitslice (const uint32_t *ek, unsigned int rounds, uint8_t *ctr,
+                        const uint8_t *src, uint8_t *dest, size_t len)
+{
+  bitslice_word sk[(AES256_ROUNDS + 1) * 8];
+  bitslice_word q[8];
+  uint8_t keystream[BITSLICE_BLOCKS * AES_BLOCK_SIZE];
+  uint64_t hi, lo;
+  size_t i, n, blocks;
+
+  bitslice_expand_sk (sk, ek, rounds);
+  aes_ctr_load (ctr, &hi, &lo);
+  while (len > 0)
+    {
+      n = len < sizeof (keystream) ? len : sizeof (keystream);
+      blocks = (n + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE;
+      for (i = 0; i < blocks; ++i)
+        {
+          aes_ctr_store (keystream + i * AES_BLOCK_SIZE, hi, lo);
+          hi += ++lo == 0;
+        }
+      bitslice_load (q, keystream, blocks);
+      bitslice_encrypt (sk, rounds, q);
+      bitslice_store (q, keystream, blocks);
+      for (i = 0; i < n; ++i)
+        dest[i] = src[i] ^ keystream[i];
+      src += n;
+      dest += n;
+      len -= n;
+    }
+  aes_ctr_store (ctr, hi, lo);
+}
+
+static void
+aes128_expand_key_bitslice (uint32_t *ek, const uint8_t *key)
+{
+  bitslice_expand_key (ek, key, 4, AES128_ROUNDS);
+}
+
+static void
+aes192_expand_key_bitslice (uint32_t *ek, const uint8_t *key)
+{
+  bitslice_expand_key (ek, key, 6, AES192_ROUNDS);
+}
+
+static void
+aes256_expand_key_bitslice (uint32_t *ek, const uint8_t *key)
+{
+  bitslice_expand_key (ek, key, 8, AES256_ROUNDS);
+}
+
+static void
+aes128_invert_key_bitslice (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES128_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+static void
+aes192_invert_key_bitslice (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES192_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+static void
+aes256_invert_key_bitslice (uint32_t *dk, const uint32_t *ek)
+{
+  memcpy (dk, ek, (AES256_ROUNDS + 1) * 4 * sizeof (uint32_t));
+}
+
+static void
+aes128_encrypt_bitslice (const uint32_t *ek, const uint8_t *src,
+                         uint8_t *dest)
+{
+  aes_ecb_encrypt_bitslice (ek, AES128_ROUNDS, src, dest, 1);
+}
+
+static void
+aes192_encrypt_bitslice (const uint32_t *ek, const uint8_t *src,
+                         uint8_t *dest)
+{
+  aes_ecb_encrypt_bitslice (ek, AES192_ROUNDS, src, dest, 1);
+}
+
+static void
+aes256_encrypt_bitslice (const uint32_t *ek, const uint8_t *src,
+                         uint8_t *dest)
+{
+  aes_ecb_encrypt_bitslice (ek, AES256_ROUNDS, src, dest, 1);
+}
+
+static void
+aes128_decrypt_bitslice (const uint32_t *dk, const uint8_t *src,
+                         uint8_t *dest)
+{
+  aes_ecb_decrypt_bitslice (dk, AES128_ROUNDS, src, dest, 1);
+}
+
+static void
+aes192_decrypt_bitslice (const uint32_t *dk, const uint8_t *src,
+                         uint8_t *dest)
+{
+  aes_ecb_decrypt_bitslice (dk, AES192_ROUNDS, src, dest, 1);
+}
+
+static void
+aes256_decrypt_bitslice (const uint32_t *dk, const uint8_t *src,
+                         uint8_t *dest)
+{
+  aes_ecb_decrypt_bitslice (dk, AES256_ROUNDS, src, dest, 1);
+}
+
+const struct aes_backend aes_backend_bitslice = {
+  "bitslice",
+  aes128_expand_key_bitslice,
+  aes192_expand_key_bitslice,
+  aes256_expand_key_bitslice,
+  aes128_invert_key_bitslice,
+  aes192_invert_key_bitslice,
+  aes256_invert_key_bitslice,
+  aes128_encrypt_bitslice,
+  aes192_encrypt_bitslice,
+  aes256_encrypt_bitslice,
+  aes128_decrypt_bitslice,
+  aes192_decrypt_bitslice,
+  aes256_decrypt_bitslice,
+  aes_ctr_crypt_bitslice,
+  aes_ecb_encrypt_bitslice,
+  aes_ecb_decrypt_bitslice,
+  aes_cbc_decrypt_bitslice,
+  bitslice_expand_keys,
+  NULL,
+  NULL,
+};
@@ -0,0 +1,394 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between aes.c and the instruction set specific AES
+ * implementations. Backends work on bare round key arrays, shared by
+ * struct aes*_ctx and struct aes*_enc_ctx. The layout of the round keys
+ * belongs to the backend that expanded them; the T-table and AES-NI code
+ * store big-endian words as described in FIPS 197.
+ */
+
+#ifndef AES_INTERNAL_H
+#define AES_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aes.h"
+#include "bswap.h"
+
+/* Number of blocks the T-table code processes at once in the modes. */
+#define AES_TABLE_BLOCKS 4
+
+/* Most key schedules expanded together by the expand_keys primitive. */
+#define AES_KEY_BATCH 8
+
+struct aes_backend
+{
+  const char *name;
+  void (*aes128_expand_key) (uint32_t *, const uint8_t *);
+  void (*aes192_expand_key) (uint32_t *, const uint8_t *);
+  void (*aes256_expand_key) (uint32_t *, const uint8_t *);
+  /* Derives the decryption schedule from the encryption schedule. */
+  void (*aes128_invert_key) (uint32_t *, const uint32_t *);
+  void (*aes192_invert_key) (uint32_t *, const uint32_t *);
+  void (*aes256_invert_key) (uint32_t *, const uint32_t *);
+  void (*aes128_encrypt) (const uint32_t *, const uint8_t *, uint8_t *);
+  void (*aes192_encrypt) (const uint32_t *, const uint8_t *, uint8_t *);
+  void (*aes256_encrypt) (const uint32_t *, const uint8_t *, uint8_t *);
+  void (*aes128_decrypt) (const uint32_t *, const uint8_t *, uint8_t *);
+  void (*aes192_decrypt) (const uint32_t *, const uint8_t *, uint8_t *);
+  void (*aes256_decrypt) (const uint32_t *, const uint8_t *, uint8_t *);
+  /*
+   * Multi-block primitives for the modes. They take the ek or dk schedule and
+   * the number of rounds so that one function serves every key size. CTR
+   * takes a length in bytes and the others a count of whole blocks.
+   */
+  void (*ctr_crypt) (const uint32_t *, unsigned int, uint8_t *,
+                     const uint8_t *, uint8_t *, size_t);
+  void (*ecb_encrypt) (const uint32_t *, unsigned int, const uint8_t *,
+                       uint8_t *, size_t);
+  void (*ecb_decrypt) (const uint32_t *, unsigned int, const uint8_t *,
+                       uint8_t *, size_t);
+  void (*cbc_decrypt) (const uint32_t *, unsigned int, uint8_t *,
+                       const uint8_t *, uint8_t *, size_t);
+  /*
+   * Expands up to AES_KEY_BATCH keys of nk words each into the schedules
+   * pointed to by the first argument, interleaving their dependency chains.
+   */
+  void (*expand_keys) (uint32_t *const *, const uint8_t *const *, size_t,
+                       unsigned int);
+  /*
+   * XTS mode on a count of whole blocks. The third argument holds the
+   * encrypted tweak of the first block and receives the tweak of the block
+   * after the last. These may be NULL, in which case aes.c whitens the
+   * blocks itself around ecb_encrypt and ecb_decrypt.
+   */
+  void (*xts_encrypt) (const uint32_t *, unsigned int, uint8_t *,
+                       const uint8_t *, uint8_t *, size_t);
+  void (*xts_decrypt) (const uint32_t *, unsigned int, uint8_t *,
+                       const uint8_t *, uint8_t *, size_t);
+};
+
+/* The CTR mode counter is a 128-bit big-endian integer. */
+static inline void
+aes_ctr_load (const uint8_t *ctr, uint64_t *hi, uint64_t *lo)
+{
+  *hi = buff_get_be64 (ctr);
+  *lo = buff_get_be64 (ctr + 8);
+}
+
+static inline void
+aes_ctr_store (uint8_t *ctr, uint64_t hi, uint64_t lo)
+{
+  buff_put_be64 (ctr, hi);
+  buff_put_be64 (ctr + 8, lo);
+}
+
+/*
+ * A word of a bitsliced state. With the GCC vector extensions it is 128 bits
+ * wide, which maps to an SSE2 or NEON register.
+ */
+#if defined(__GNUC__)
+typedef uint64_t aes_bitslice_word __attribute__ ((vector_size (16)));
+#else
+typedef uint64_t aes_bitslice_word;
+#endif
+
+/*
+ * Applies the S-box to every byte of a bitsliced state, where q[i] holds bit
+ * i of every byte, but without adding the constant 0x63 of its affine
+ * transform. The constant commutes with MixColumns, so the SIMD backends add
+ * it to the round keys instead. This is the circuit from "A depth-16 circuit
+ * for the AES S-box" by Joan Boyar and Rene Peralta, shared by the bitsliced
+ * backends.
+ */
+static inline void
+aes_bitslice_sbox_without_c (aes_bitslice_word *q)
+{
+  aes_bitslice_word x0, x1, x2, x3, x4, x5, x6, x7;
+  aes_bitslice_word y1, y2, y3, y4, y5, y6, y7, y8, y9;
+  aes_bitslice_word y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+  aes_bitslice_word y20, y21;
+  aes_bitslice_word z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  aes_bitslice_word z10, z11, z12, z13, z14, z15, z16, z17;
+  aes_bitslice_word t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+  aes_bitslice_word t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  aes_bitslice_word t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+  aes_bitslice_word t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  aes_bitslice_word t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+  aes_bitslice_word t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  aes_bitslice_word t60, t61, t62, t63, t64, t65, t66, t67;
+  aes_bitslice_word s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7];
+  x1 = q[6];
+  x2 = q[5];
+  x3 = q[4];
+  x4 = q[3];
+  x5 = q[2];
+  x6 = q[1];
+  x7 = q[0];
+
+  /* Top linear transformation */
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9 = x0 ^ x3;
+  y8 = x0 ^ x5;
+  t0 = x1 ^ x2;
+  y1 = t0 ^ x7;
+  y4 = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2 = y1 ^ x0;
+  y5 = y1 ^ x6;
+  y3 = y5 ^ y8;
+  t1 = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6 = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7 = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  /* Non-linear section */
+  t2 = y12 & y15;
+  t3 = y3 & y6;
+  t4 = t3 ^ t2;
+  t5 = y4 & x7;
+  t6 = t5 ^ t2;
+  t7 = y13 & y16;
+  t8 = y5 & y1;
+  t9 = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15;
+  z1 = t37 & y6;
+  z2 = t33 & x7;
+  z3 = t43 & y16;
+  z4 = t40 & y1;
+  z5 = t29 & y7;
+  z6 = t42 & y11;
+  z7 = t45 & y17;
+  z8 = t41 & y10;
+  z9 = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  /* Bottom linear transformation */
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  s0 = t59 ^ t63;
+  s6 = t56 ^ t62;
+  s7 = t48 ^ t60;
+  t67 = t64 ^ t65;
+  s3 = t53 ^ t66;
+  s4 = t51 ^ t66;
+  s5 = t47 ^ t65;
+  s1 = t64 ^ s3;
+  s2 = t55 ^ t67;
+
+  q[7] = s0;
+  q[6] = s1;
+  q[5] = s2;
+  q[4] = s3;
+  q[3] = s4;
+  q[2] = s5;
+  q[1] = s6;
+  q[0] = s7;
+}
+
+static inline void
+aes_bitslice_add_c (aes_bitslice_word *q)
+{
+  q[0] = ~q[0];
+  q[1] = ~q[1];
+  q[5] = ~q[5];
+  q[6] = ~q[6];
+}
+
+static inline void
+aes_bitslice_sbox (aes_bitslice_word *q)
+{
+  aes_bitslice_sbox_without_c (q);
+  aes_bitslice_add_c (q);
+}
+
+/* The linear part of the inverse affine transform. */
+static inline void
+aes_bitslice_inv_linear (aes_bitslice_word *q)
+{
+  aes_bitslice_word q0, q1, q2, q3, q4, q5, q6, q7;
+
+  q0 = q[0];
+  q1 = q[1];
+  q2 = q[2];
+  q3 = q[3];
+  q4 = q[4];
+  q5 = q[5];
+  q6 = q[6];
+  q7 = q[7];
+  q[7] = q1 ^ q4 ^ q6;
+  q[6] = q0 ^ q3 ^ q5;
+  q[5] = q7 ^ q2 ^ q4;
+  q[4] = q6 ^ q1 ^ q3;
+  q[3] = q5 ^ q0 ^ q2;
+  q[2] = q4 ^ q7 ^ q1;
+  q[1] = q3 ^ q6 ^ q0;
+  q[0] = q2 ^ q5 ^ q7;
+}
+
+/*
+ * Applies the inverse S-box to every byte plus 0x63, so that the constant can
+ * go in the round keys as well. The inverse S-box is the inverse affine
+ * transform, the S-box, which computes the inversion followed by the affine
+ * transform, and the inverse affine transform again. The constants of the
+ * inner two cancel.
+ */
+static inline void
+aes_bitslice_inv_sbox_without_c (aes_bitslice_word *q)
+{
+  aes_bitslice_inv_linear (q);
+  aes_bitslice_sbox_without_c (q);
+  aes_bitslice_inv_linear (q);
+}
+
+static inline void
+aes_bitslice_inv_sbox (aes_bitslice_word *q)
+{
+  aes_bitslice_add_c (q);
+  aes_bitslice_inv_sbox_without_c (q);
+}
+
+/* T-table implementation in aes.c, always available. */
+extern const struct aes_backend aes_backend_table;
+void aes128_expand_key_table (uint32_t *, const uint8_t *);
+void aes192_expand_key_table (uint32_t *, const uint8_t *);
+void aes256_expand_key_table (uint32_t *, const uint8_t *);
+void aes128_invert_key_table (uint32_t *, const uint32_t *);
+void aes192_invert_key_table (uint32_t *, const uint32_t *);
+void aes256_invert_key_table (uint32_t *, const uint32_t *);
+void aes128_encrypt_table (const uint32_t *, const uint8_t *, uint8_t *);
+void aes192_encrypt_table (const uint32_t *, const uint8_t *, uint8_t *);
+void aes256_encrypt_table (const uint32_t *, const uint8_t *, uint8_t *);
+void aes128_decrypt_table (const uint32_t *, const uint8_t *, uint8_t *);
+void aes192_decrypt_table (const uint32_t *, const uint8_t *, uint8_t *);
+void aes256_decrypt_table (const uint32_t *, const uint8_t *, uint8_t *);
+void aes_expand_keys_table (uint32_t *const *, const uint8_t *const *, size_t,
+                            unsigned int);
+
+/* Constant time bitsliced implementation in aes-bitslice.c. */
+extern const struct aes_backend aes_backend_bitslice;
+
+#if defined(HAVE_SSSE3_INTRINSICS)
+/* Constant time SSSE3 implementation in aes-bitslice-ssse3.c. */
+extern const struct aes_backend aes_backend_ssse3;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* Constant time NEON implementation in aes-bitslice-neon.c. */
+extern const struct aes_backend aes_backend_neon;
+#endif
+
+#if defined(HAVE_AESNI_INTRINSICS)
+/* AES-NI implementation in aes-aesni.c. */
+extern const struct aes_backend aes_backend_aesni;
+#endif
+
+#if defined(HAVE_ARM_AES_INTRINSICS)
+/* ARMv8 Crypto Extensions implementation in aes-armv8.c. */
+extern const struct aes_backend aes_backend_armv8;
+#endif
+
+/* Name of the backend picked for this CPU, for fcrypt_cipher_backend. */
+const char *aes_backend_name (void);
+
+#endif /* AES_INTERNAL_H */
@@ -29,6 +29,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct iovec;
+
 #define AES128_KEY_SIZE 16
 #define AES128_BLOCK_SIZE 16
 #define AES128_ROUNDS 10
@@ -41,27 +43,52 @@
 #define AES256_BLOCK_SIZE 16
 #define AES256_ROUNDS 14
 
+#define AES_BLOCK_SIZE 16
+
+/*
+ * Contexts for both directions. A context set up with aes*_set_encrypt_key
+ * derives the decryption key schedule the first time it is used for
+ * decryption, so that call modifies the context and must not race with other
+ * users of it. Call aes*_set_decrypt_key up front to share one between
+ * threads.
+ */
 struct aes128_ctx
 {
   uint32_t ek[44];
   uint32_t dk[44];
+  int have_dk;
 };
 
 struct aes192_ctx
 {
   uint32_t ek[52];
   uint32_t dk[52];
+  int have_dk;
 };
 
 struct aes256_ctx
 {
   uint32_t ek[60];
   uint32_t dk[60];
+  int have_dk;
 };
 
 void aes128_set_encrypt_key (struct aes128_ctx *, const uint8_t *);
 void aes192_set_encrypt_key (struct aes192_ctx *, const uint8_t *);
 void aes256_set_encrypt_key (struct aes256_ctx *, const uint8_t *);
+
+/*
+ * Sets the encryption keys of an array of contexts from an array of key
+ * pointers. The key schedules are expanded several at a time, which is
+ * faster than calling aes*_set_encrypt_key for each of them.
+ */
+void aes128_set_encrypt_key_batch (struct aes128_ctx *, const uint8_t *const *,
+                                   size_t);
+void aes192_set_encrypt_key_batch (struct aes192_ctx *, const uint8_t *const *,
+                                   size_t);
+void aes256_set_encrypt_key_batch (struct aes256_ctx *, const uint8_t *const *,
+                                   size_t);
+
 void aes128_set_decrypt_key (struct aes128_ctx *, const uint8_t *);
 void aes192_set_decrypt_key (struct aes192_ctx *, const uint8_t *);
 void aes256_set_decrypt_key (struct aes256_ctx *, const uint8_t *);
@@ -72,4 +99,222 @@ void aes128_decrypt (struct aes128_ctx *, const uint8_t *, uint8_t *);
 void aes192_decrypt (struct aes192_ctx *, const uint8_t *, uint8_t *);
 void aes256_decrypt (struct aes256_ctx *, const uint8_t *, uint8_t *);
 
+/*
+ * CTR mode. The second argument is the 16-byte big-endian counter block which
+ * is incremented once for every block of keystream used, wrapping at 2^128.
+ * A trailing partial block consumes a whole counter value, so only the last
+ * call for a message may have a length that is not a multiple of
+ * AES_BLOCK_SIZE. Encryption and decryption are the same operation.
+ */
+void aes128_ctr_crypt (struct aes128_ctx *, uint8_t *, const uint8_t *,
+                       uint8_t *, size_t);
+void aes192_ctr_crypt (struct aes192_ctx *, uint8_t *, const uint8_t *,
+                       uint8_t *, size_t);
+void aes256_ctr_crypt (struct aes256_ctx *, uint8_t *, const uint8_t *,
+                       uint8_t *, size_t);
+
+/*
+ * CTR mode in place over the buffers of an iovec array, which are treated as
+ * one message. A block may straddle two buffers, and the counter ends where
+ * a single call of aes*_ctr_crypt on the whole message would leave it.
+ */
+void aes128_ctr_cryptv (struct aes128_ctx *, uint8_t *, const struct iovec *,
+                        size_t);
+void aes192_ctr_cryptv (struct aes192_ctx *, uint8_t *, const struct iovec *,
+                        size_t);
+void aes256_ctr_cryptv (struct aes256_ctx *, uint8_t *, const struct iovec *,
+                        size_t);
+
+/*
+ * ECB and CBC modes on buffers whose length is a multiple of AES_BLOCK_SIZE.
+ * For CBC the second argument is the IV, which is replaced with the last
+ * ciphertext block so that a message can be passed in pieces.
+ */
+void aes128_ecb_encrypt (struct aes128_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes192_ecb_encrypt (struct aes192_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes256_ecb_encrypt (struct aes256_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes128_ecb_decrypt (struct aes128_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes192_ecb_decrypt (struct aes192_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes256_ecb_decrypt (struct aes256_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes128_cbc_encrypt (struct aes128_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes192_cbc_encrypt (struct aes192_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes256_cbc_encrypt (struct aes256_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes128_cbc_decrypt (struct aes128_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes192_cbc_decrypt (struct aes192_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes256_cbc_decrypt (struct aes256_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+
+/*
+ * CFB mode with 128-bit feedback. Both directions only use the encryption
+ * key schedule. The IV is updated like in CBC mode, and only the last call
+ * for a message may have a length that is not a multiple of AES_BLOCK_SIZE.
+ */
+void aes128_cfb_encrypt (struct aes128_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes192_cfb_encrypt (struct aes192_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes256_cfb_encrypt (struct aes256_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes128_cfb_decrypt (struct aes128_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes192_cfb_decrypt (struct aes192_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+void aes256_cfb_decrypt (struct aes256_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
+
+/*
+ * Encryption-only contexts hold half the key schedule of struct aes*_ctx and
+ * skip deriving the inverse cipher keys. They provide every operation that
+ * only runs the cipher forward: CTR, CFB in both directions, ECB and CBC
+ * encryption, and the single block encrypt.
+ */
+struct aes128_enc_ctx
+{
+  uint32_t ek[44];
+};
+
+struct aes192_enc_ctx
+{
+  uint32_t ek[52];
+};
+
+struct aes256_enc_ctx
+{
+  uint32_t ek[60];
+};
+
+void aes128_enc_set_key (struct aes128_enc_ctx *, const uint8_t *);
+void aes192_enc_set_key (struct aes192_enc_ctx *, const uint8_t *);
+void aes256_enc_set_key (struct aes256_enc_ctx *, const uint8_t *);
+void aes128_enc_encrypt (struct aes128_enc_ctx *, const uint8_t *, uint8_t *);
+void aes192_enc_encrypt (struct aes192_enc_ctx *, const uint8_t *, uint8_t *);
+void aes256_enc_encrypt (struct aes256_enc_ctx *, const uint8_t *, uint8_t *);
+void aes128_enc_ctr_crypt (struct aes128_enc_ctx *, uint8_t *, const uint8_t *,
+                           uint8_t *, size_t);
+void aes192_enc_ctr_crypt (struct aes192_enc_ctx *, uint8_t *, const uint8_t *,
+                           uint8_t *, size_t);
+void aes256_enc_ctr_crypt (struct aes256_enc_ctx *, uint8_t *, const uint8_t *,
+                           uint8_t *, size_t);
+void aes128_enc_ctr_cryptv (struct aes128_enc_ctx *, uint8_t *,
+                            const struct iovec *, size_t);
+void aes192_enc_ctr_cryptv (struct aes192_enc_ctx *, uint8_t *,
+                            const struct iovec *, size_t);
+void aes256_enc_ctr_cryptv (struct aes256_enc_ctx *, uint8_t *,
+                            const struct iovec *, size_t);
+
+/*
+ * Random access CTR mode. These use the keystream starting the given number
+ * of bytes past the initial counter block iv, which is not changed, so one
+ * context can be shared between threads. The parallel variants split large
+ * ranges across up to the given number of threads.
+ */
+void aes_ctr_seek (uint8_t *, const uint8_t *, uint64_t);
+void aes128_enc_ctr_crypt_at (struct aes128_enc_ctx *, const uint8_t *,
+                              uint64_t, const uint8_t *, uint8_t *, size_t);
+void aes192_enc_ctr_crypt_at (struct aes192_enc_ctx *, const uint8_t *,
+                              uint64_t, const uint8_t *, uint8_t *, size_t);
+void aes256_enc_ctr_crypt_at (struct aes256_enc_ctx *, const uint8_t *,
+                              uint64_t, const uint8_t *, uint8_t *, size_t);
+void aes128_enc_ctr_crypt_parallel (struct aes128_enc_ctx *, const uint8_t *,
+                                    uint64_t, const uint8_t *, uint8_t *,
+                                    size_t, unsigned int);
+void aes192_enc_ctr_crypt_parallel (struct aes192_enc_ctx *, const uint8_t *,
+                                    uint64_t, const uint8_t *, uint8_t *,
+                                    size_t, unsigned int);
+void aes256_enc_ctr_crypt_parallel (struct aes256_enc_ctx *, const uint8_t *,
+                                    uint64_t, const uint8_t *, uint8_t *,
+                                    size_t, unsigned int);
+void aes128_enc_ecb_encrypt (struct aes128_enc_ctx *, const uint8_t *,
+                             uint8_t *, size_t);
+void aes192_enc_ecb_encrypt (struct aes192_enc_ctx *, const uint8_t *,
+                             uint8_t *, size_t);
+void aes256_enc_ecb_encrypt (struct aes256_enc_ctx *, const uint8_t *,
+                             uint8_t *, size_t);
+void aes128_enc_cbc_encrypt (struct aes128_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes192_enc_cbc_encrypt (struct aes192_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes256_enc_cbc_encrypt (struct aes256_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes128_enc_cfb_encrypt (struct aes128_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes192_enc_cfb_encrypt (struct aes192_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes256_enc_cfb_encrypt (struct aes256_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes128_enc_cfb_decrypt (struct aes128_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes192_enc_cfb_decrypt (struct aes192_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+void aes256_enc_cfb_decrypt (struct aes256_enc_ctx *, uint8_t *,
+                             const uint8_t *, uint8_t *, size_t);
+
+/*
+ * XTS mode as described in IEEE Std 1619, for encrypting the sectors of a
+ * storage device. The key is the data key followed by the tweak key. The
+ * data key is set up for both directions, so a context can be shared
+ * between threads once the key is set.
+ */
+#define AES128_XTS_KEY_SIZE (2 * AES128_KEY_SIZE)
+#define AES256_XTS_KEY_SIZE (2 * AES256_KEY_SIZE)
+#define AES_XTS_TWEAK_SIZE 16
+
+struct aes128_xts_ctx
+{
+  struct aes128_ctx cipher;
+  struct aes128_enc_ctx tweak;
+};
+
+struct aes256_xts_ctx
+{
+  struct aes256_ctx cipher;
+  struct aes256_enc_ctx tweak;
+};
+
+void aes128_xts_set_key (struct aes128_xts_ctx *, const uint8_t *);
+void aes256_xts_set_key (struct aes256_xts_ctx *, const uint8_t *);
+
+/*
+ * Encrypts or decrypts one data unit. The second argument is the
+ * AES_XTS_TWEAK_SIZE byte tweak, which holds the little-endian data unit
+ * number. The length must be at least AES_BLOCK_SIZE and ciphertext
+ * stealing is used if it is not a multiple of it. Returns 0 on success and
+ * -1 with errno set to EINVAL if the length is too short.
+ */
+int aes128_xts_encrypt (struct aes128_xts_ctx *, const uint8_t *,
+                        const uint8_t *, uint8_t *, size_t);
+int aes256_xts_encrypt (struct aes256_xts_ctx *, const uint8_t *,
+                        const uint8_t *, uint8_t *, size_t);
+int aes128_xts_decrypt (struct aes128_xts_ctx *, const uint8_t *,
+                        const uint8_t *, uint8_t *, size_t);
+int aes256_xts_decrypt (struct aes256_xts_ctx *, const uint8_t *,
+                        const uint8_t *, uint8_t *, size_t);
+
+/*
+ * Encrypts or decrypts sectors stored one after another, with the sector
+ * numbers as data unit numbers. The arguments are the array of sector
+ * numbers, the input, the output, the sector size and the number of
+ * sectors. The tweaks of several sectors are encrypted at once, which is
+ * faster than calling aes*_xts_encrypt for each of them.
+ */
+int aes128_xts_encrypt_sectors (struct aes128_xts_ctx *, const uint64_t *,
+                                const uint8_t *, uint8_t *, size_t, size_t);
+int aes256_xts_encrypt_sectors (struct aes256_xts_ctx *, const uint64_t *,
+                                const uint8_t *, uint8_t *, size_t, size_t);
+int aes128_xts_decrypt_sectors (struct aes128_xts_ctx *, const uint64_t *,
+                                const uint8_t *, uint8_t *, size_t, size_t);
+int aes256_xts_decrypt_sectors (struct aes256_xts_ctx *, const uint64_t *,
+                                const uint8_t *, uint8_t *, size_t, size_t);
+
 #endif /* AES_H */
@@ -25,8 +25,13 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "arc4.h"
+#include "fcrypt_memzero.h"
+
+/* Keystream generated at once by arc4_crypt. */
+#define ARC4_BLOCK_SIZE 256
 
 void
 arc4_set_key (struct arc4_ctx *ctx, const uint8_t *key, size_t keylen)
@@ -48,21 +53,103 @@ arc4_set_key (struct arc4_ctx *ctx, const uint8_t *key, size_t keylen)
   ctx->i = ctx->j = 0;
 }
 
+/*
+ * The state is only read through a local pointer and the indices are kept
+ * in local variables, so they stay in registers instead of being stored to
+ * the context after every byte.
+ */
+static void
+arc4_generate (struct arc4_ctx *ctx, uint8_t *out, size_t len)
+{
+  uint8_t *state = ctx->state;
+  unsigned int i = ctx->i, j = ctx->j, si, sj;
+  size_t k;
+
+  for (k = 0; k < len; ++k)
+    {
+      i = (i + 1) & 0xff;
+      si = state[i];
+      j = (j + si) & 0xff;
+      sj = state[j];
+      state[i] = sj;
+      state[j] = si;
+      out[k] = state[(si + sj) & 0xff];
+    }
+  ctx->i = i;
+  ctx->j = j;
+}
+
+/* XORs the keystream into the input eight bytes at a time. */
+static void
+arc4_xor (uint8_t *dest, const uint8_t *src, const uint8_t *keystream,
+          size_t len)
+{
+  uint64_t x, y;
+  size_t k;
+
+  for (k = 0; k + 8 <= len; k += 8)
+    {
+      memcpy (&x, src + k, 8);
+      memcpy (&y, keystream + k, 8);
+      x ^= y;
+      memcpy (dest + k, &x, 8);
+    }
+  for (; k < len; ++k)
+    dest[k] = src[k] ^ keystream[k];
+}
+
+/*
+ * Generates the keystream a block at a time into a buffer, then XORs the
+ * block in one pass.
+ */
 void
 arc4_crypt (struct arc4_ctx *ctx, const uint8_t *src, uint8_t *dest,
             size_t len)
 {
-  size_t i;
-  uint8_t t;
+  uint8_t keystream[ARC4_BLOCK_SIZE];
+  size_t n;
 
-  for (i = 0; i < len; ++i)
+  while (len > 0)
     {
-      ctx->i = (ctx->i + 1) & 0xff;
-      ctx->j = (ctx->j + ctx->state[ctx->i]) & 0xff;
-      t = ctx->state[ctx->i];
-      ctx->state[ctx->i] = ctx->state[ctx->j];
-      ctx->state[ctx->j] = t;
-      dest[i] = src[i]
-                ^ ctx->state[(ctx->state[ctx->i] + ctx->state[ctx->j]) & 0xff];
+      n = len < sizeof (keystream) ? len : sizeof (keystream);
+      arc4_generate (ctx, keystream, n);
+      arc4_xor (dest, src, keystream, n);
+      src += n;
+      dest += n;
+      len -= n;
     }
+  fcrypt_memzero (keystream, sizeof (keystream));
+}
+
+void
+arc4_keystream (struct arc4_ctx *ctx, uint8_t *out, size_t len)
+{
+  arc4_generate (ctx, out, len);
+}
+
+/* The state update of arc4_generate without the output lookup. */
+void
+arc4_drop (struct arc4_ctx *ctx, size_t len)
+{
+  uint8_t *state = ctx->state;
+  unsigned int i = ctx->i, j = ctx->j, si;
+
+  for (; len > 0; --len)
+    {
+      i = (i + 1) & 0xff;
+      si = state[i];
+      j = (j + si) & 0xff;
+      state[i] = state[j];
+      state[j] = si;
+    }
+  ctx->i = i;
+  ctx->j = j;
+}
+
+void
+arc4_set_key_drop (struct arc4_ctx *ctx, const uint8_t *key, size_t keylen,
+                   size_t drop)
+{
+  arc4_set_key (ctx, key, keylen);
+  arc4_drop (ctx, drop);
 }
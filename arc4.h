@@ -39,4 +39,16 @@ struct arc4_ctx
 void arc4_set_key (struct arc4_ctx *, const uint8_t *, size_t);
 void arc4_crypt (struct arc4_ctx *, const uint8_t *, uint8_t *, size_t);
 
+/* Writes the next bytes of keystream, the same as encrypting zeros. */
+void arc4_keystream (struct arc4_ctx *, uint8_t *, size_t);
+
+/*
+ * RC4-drop[n] discards the first n bytes of keystream, which are the most
+ * biased. arc4_set_key_drop sets the key and then drops the given number
+ * of bytes; RFC 4345 uses 1536 for the SSH arcfour128 and arcfour256
+ * ciphers.
+ */
+void arc4_drop (struct arc4_ctx *, size_t);
+void arc4_set_key_drop (struct arc4_ctx *, const uint8_t *, size_t, size_t);
+
 #endif /* ARC4_H */
@@ -0,0 +1,163 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * The Argon2 compression function with AVX2. Each permutation works on
+ * sixteen words in four registers, one row of the BLAKE2b state in each,
+ * like blake2b-avx2.c. The rows of the block are whole registers. The
+ * columns are pairs of words from eight registers, so two column rounds are
+ * done at once by gathering their 128-bit halves with permute2x128 and
+ * scattering them back afterwards.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argon2-internal.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_ROTR32(x) _mm256_shuffle_epi32 ((x), _MM_SHUFFLE (2, 3, 0, 1))
+#define AVX2_ROTR24(x) _mm256_shuffle_epi8 ((x), rot24)
+#define AVX2_ROTR16(x) _mm256_shuffle_epi8 ((x), rot16)
+#define AVX2_ROTR63(x)                                                        \
+  _mm256_xor_si256 (_mm256_srli_epi64 ((x), 63), _mm256_add_epi64 ((x), (x)))
+
+/* x + y + 2 * lo32 (x) * lo32 (y) in each lane. */
+#define AVX2_FBLAMKA(x, y)                                                    \
+  _mm256_add_epi64 (_mm256_add_epi64 ((x), (y)),                              \
+                    _mm256_add_epi64 (_mm256_mul_epu32 ((x), (y)),            \
+                                      _mm256_mul_epu32 ((x), (y))))
+
+#define AVX2_G(a, b, c, d)                                                    \
+  do                                                                          \
+    {                                                                         \
+      (a) = AVX2_FBLAMKA ((a), (b));                                          \
+      (d) = AVX2_ROTR32 (_mm256_xor_si256 ((d), (a)));                        \
+      (c) = AVX2_FBLAMKA ((c), (d));                                          \
+      (b) = AVX2_ROTR24 (_mm256_xor_si256 ((b), (c)));                        \
+      (a) = AVX2_FBLAMKA ((a), (b));                                          \
+      (d) = AVX2_ROTR16 (_mm256_xor_si256 ((d), (a)));                        \
+      (c) = AVX2_FBLAMKA ((c), (d));                                          \
+      (b) = AVX2_ROTR63 (_mm256_xor_si256 ((b), (c)));                        \
+    }                                                                         \
+  while (0)
+
+/* The column step, then the diagonal step with rows b, c and d rotated. */
+#define AVX2_ROUND(a, b, c, d)                                                \
+  do                                                                          \
+    {                                                                         \
+      AVX2_G ((a), (b), (c), (d));                                            \
+      (b) = _mm256_permute4x64_epi64 ((b), _MM_SHUFFLE (0, 3, 2, 1));         \
+      (c) = _mm256_permute4x64_epi64 ((c), _MM_SHUFFLE (1, 0, 3, 2));         \
+      (d) = _mm256_permute4x64_epi64 ((d), _MM_SHUFFLE (2, 1, 0, 3));         \
+      AVX2_G ((a), (b), (c), (d));                                            \
+      (b) = _mm256_permute4x64_epi64 ((b), _MM_SHUFFLE (2, 1, 0, 3));         \
+      (c) = _mm256_permute4x64_epi64 ((c), _MM_SHUFFLE (1, 0, 3, 2));         \
+      (d) = _mm256_permute4x64_epi64 ((d), _MM_SHUFFLE (0, 3, 2, 1));         \
+    }                                                                         \
+  while (0)
+
+/*
+ * Register i of the block holds words 4i to 4i + 3, so column round 2j
+ * takes the low halves of registers j, j + 4, ... j + 28 and column round
+ * 2j + 1 the high halves.
+ */
+#define AVX2_GATHER(lo, hi, x, y)                                             \
+  do                                                                          \
+    {                                                                         \
+      (lo) = _mm256_permute2x128_si256 ((x), (y), 0x20);                      \
+      (hi) = _mm256_permute2x128_si256 ((x), (y), 0x31);                      \
+    }                                                                         \
+  while (0)
+
+AVX2_TARGET static void
+argon2_fill_block_avx2 (uint64_t *next, const uint64_t *prev,
+                        const uint64_t *ref, int with_xor)
+{
+  const __m256i rot24
+      = _mm256_setr_epi8 (3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9,
+                          10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8,
+                          9, 10);
+  const __m256i rot16
+      = _mm256_setr_epi8 (2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8,
+                          9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15,
+                          8, 9);
+  __m256i r[ARGON2_WORDS / 4], z[ARGON2_WORDS / 4];
+  __m256i a0, a1, b0, b1, c0, c1, d0, d1, t;
+  size_t i;
+
+  for (i = 0; i < ARGON2_WORDS / 4; ++i)
+    {
+      r[i] = _mm256_xor_si256 (
+          _mm256_loadu_si256 ((const __m256i *)(prev + 4 * i)),
+          _mm256_loadu_si256 ((const __m256i *)(ref + 4 * i)));
+      z[i] = r[i];
+    }
+
+  for (i = 0; i < 8; ++i)
+    AVX2_ROUND (z[4 * i], z[4 * i + 1], z[4 * i + 2], z[4 * i + 3]);
+
+  for (i = 0; i < 4; ++i)
+    {
+      AVX2_GATHER (a0, a1, z[i], z[i + 4]);
+      AVX2_GATHER (b0, b1, z[i + 8], z[i + 12]);
+      AVX2_GATHER (c0, c1, z[i + 16], z[i + 20]);
+      AVX2_GATHER (d0, d1, z[i + 24], z[i + 28]);
+      AVX2_ROUND (a0, b0, c0, d0);
+      AVX2_ROUND (a1, b1, c1, d1);
+      AVX2_GATHER (z[i], z[i + 4], a0, a1);
+      AVX2_GATHER (z[i + 8], z[i + 12], b0, b1);
+      AVX2_GATHER (z[i + 16], z[i + 20], c0, c1);
+      AVX2_GATHER (z[i + 24], z[i + 28], d0, d1);
+    }
+
+  for (i = 0; i < ARGON2_WORDS / 4; ++i)
+    {
+      t = _mm256_xor_si256 (z[i], r[i]);
+      if (with_xor)
+        t = _mm256_xor_si256 (
+            t, _mm256_loadu_si256 ((const __m256i *)(next + 4 * i)));
+      _mm256_storeu_si256 ((__m256i *)(next + 4 * i), t);
+    }
+}
+
+const struct argon2_backend argon2_backend_avx2 = {
+  "avx2",
+  argon2_fill_block_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int argon2_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
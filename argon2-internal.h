@@ -0,0 +1,66 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between argon2.c and the instruction set specific versions of
+ * the Argon2 compression function, which is built from the BLAKE2b round
+ * with the additions replaced by the multiplying BlaMka function.
+ */
+
+#ifndef ARGON2_INTERNAL_H
+#define ARGON2_INTERNAL_H
+
+#include <stdint.h>
+
+#include "argon2.h"
+
+/* A block is 128 64-bit words, kept in native byte order. */
+#define ARGON2_WORDS (ARGON2_BLOCK_SIZE / 8)
+
+/*
+ * Sets the first block to G(prev ^ ref) ^ prev ^ ref, or XORs that into it
+ * when the last argument is nonzero, as every pass after the first does.
+ * The first block must not overlap the other two.
+ */
+struct argon2_backend
+{
+  const char *name;
+  void (*fill_block) (uint64_t *, const uint64_t *, const uint64_t *, int);
+};
+
+/* Portable implementation in argon2.c, always available. */
+extern const struct argon2_backend argon2_backend_generic;
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* AVX2 implementation in argon2-avx2.c. */
+extern const struct argon2_backend argon2_backend_avx2;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* NEON implementation in argon2-neon.c. */
+extern const struct argon2_backend argon2_backend_neon;
+#endif
+
+#endif /* ARGON2_INTERNAL_H */
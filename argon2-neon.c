@@ -0,0 +1,151 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * The Argon2 compression function with NEON. Each row of the BLAKE2b state
+ * is split across two registers and diagonalized with EXT, as in
+ * blake2b-neon.c. A register holds two adjacent words, which is a quarter
+ * of a row and half of a column of the block, so both the row and the
+ * column rounds load their registers directly.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argon2-internal.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_ROTR(x, n) vsriq_n_u64 (vshlq_n_u64 ((x), 64 - (n)), (x), (n))
+#define NEON_ROTR32(x)                                                        \
+  vreinterpretq_u64_u32 (vrev64q_u32 (vreinterpretq_u32_u64 (x)))
+
+/* x + y + 2 * lo32 (x) * lo32 (y) in each lane. */
+#define NEON_FBLAMKA(x, y)                                                    \
+  vaddq_u64 (vaddq_u64 ((x), (y)),                                            \
+             vshlq_n_u64 (vmull_u32 (vmovn_u64 (x), vmovn_u64 (y)), 1))
+
+#define NEON_G(a, b, c, d)                                                    \
+  do                                                                          \
+    {                                                                         \
+      (a) = NEON_FBLAMKA ((a), (b));                                          \
+      (d) = NEON_ROTR32 (veorq_u64 ((d), (a)));                               \
+      (c) = NEON_FBLAMKA ((c), (d));                                          \
+      (b) = NEON_ROTR (veorq_u64 ((b), (c)), 24);                             \
+      (a) = NEON_FBLAMKA ((a), (b));                                          \
+      (d) = NEON_ROTR (veorq_u64 ((d), (a)), 16);                             \
+      (c) = NEON_FBLAMKA ((c), (d));                                          \
+      (b) = NEON_ROTR (veorq_u64 ((b), (c)), 63);                             \
+    }                                                                         \
+  while (0)
+
+/* One permutation of sixteen words held in eight registers of v. */
+#define NEON_ROUND(v, al, ah, bl, bh, cl, ch, dl, dh)                         \
+  do                                                                          \
+    {                                                                         \
+      uint64x2_t t0, t1;                                                      \
+                                                                              \
+      NEON_G ((v)[al], (v)[bl], (v)[cl], (v)[dl]);                            \
+      NEON_G ((v)[ah], (v)[bh], (v)[ch], (v)[dh]);                            \
+                                                                              \
+      /* Rotate rows b, c and d left by one, two and three words. */          \
+      t0 = vextq_u64 ((v)[bl], (v)[bh], 1);                                   \
+      t1 = vextq_u64 ((v)[bh], (v)[bl], 1);                                   \
+      (v)[bl] = t0;                                                           \
+      (v)[bh] = t1;                                                           \
+      t0 = (v)[cl];                                                           \
+      (v)[cl] = (v)[ch];                                                      \
+      (v)[ch] = t0;                                                           \
+      t0 = vextq_u64 ((v)[dl], (v)[dh], 1);                                   \
+      t1 = vextq_u64 ((v)[dh], (v)[dl], 1);                                   \
+      (v)[dl] = t1;                                                           \
+      (v)[dh] = t0;                                                           \
+                                                                              \
+      NEON_G ((v)[al], (v)[bl], (v)[cl], (v)[dl]);                            \
+      NEON_G ((v)[ah], (v)[bh], (v)[ch], (v)[dh]);                            \
+                                                                              \
+      /* And back again. */                                                   \
+      t0 = vextq_u64 ((v)[bh], (v)[bl], 1);                                   \
+      t1 = vextq_u64 ((v)[bl], (v)[bh], 1);                                   \
+      (v)[bl] = t0;                                                           \
+      (v)[bh] = t1;                                                           \
+      t0 = (v)[cl];                                                           \
+      (v)[cl] = (v)[ch];                                                      \
+      (v)[ch] = t0;                                                           \
+      t0 = vextq_u64 ((v)[dl], (v)[dh], 1);                                   \
+      t1 = vextq_u64 ((v)[dh], (v)[dl], 1);                                   \
+      (v)[dl] = t0;                                                           \
+      (v)[dh] = t1;                                                           \
+    }                                                                         \
+  while (0)
+
+NEON_TARGET static void
+argon2_fill_block_neon (uint64_t *next, const uint64_t *prev,
+                        const uint64_t *ref, int with_xor)
+{
+  uint64x2_t r[ARGON2_WORDS / 2], z[ARGON2_WORDS / 2], t;
+  size_t i;
+
+  for (i = 0; i < ARGON2_WORDS / 2; ++i)
+    {
+      r[i] = veorq_u64 (vld1q_u64 (prev + 2 * i), vld1q_u64 (ref + 2 * i));
+      z[i] = r[i];
+    }
+
+  /* Row i is registers 8i to 8i + 7. */
+  for (i = 0; i < 8; ++i)
+    NEON_ROUND (z, 8 * i, 8 * i + 1, 8 * i + 2, 8 * i + 3, 8 * i + 4,
+                8 * i + 5, 8 * i + 6, 8 * i + 7);
+
+  /* Column i is registers i, i + 8, ... i + 56. */
+  for (i = 0; i < 8; ++i)
+    NEON_ROUND (z, i, i + 8, i + 16, i + 24, i + 32, i + 40, i + 48, i + 56);
+
+  for (i = 0; i < ARGON2_WORDS / 2; ++i)
+    {
+      t = veorq_u64 (z[i], r[i]);
+      if (with_xor)
+        t = veorq_u64 (t, vld1q_u64 (next + 2 * i));
+      vst1q_u64 (next + 2 * i, t);
+    }
+}
+
+const struct argon2_backend argon2_backend_neon = {
+  "neon",
+  argon2_fill_block_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int argon2_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
@@ -0,0 +1,497 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#endif
+
+#include "argon2-internal.h"
+#include "argon2.h"
+#include "blake2b.h"
+#include "bswap.h"
+#include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_memzero.h"
+#include "fcrypt_pool.h"
+
+/* The type field of the input, 2 for Argon2id. */
+#define ARGON2_TYPE_ID 2
+
+/* Pseudo-random values in a block of data-independent addresses. */
+#define ARGON2_ADDRESSES_IN_BLOCK ARGON2_WORDS
+
+/* Huge pages are tried for memory that is a multiple of this size. */
+#define ARGON2_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+/* The multiplication hardened addition of BlaMka. */
+static inline uint64_t
+argon2_fblamka (uint64_t x, uint64_t y)
+{
+  return x + y + 2 * (uint64_t)(uint32_t)x * (uint32_t)y;
+}
+
+#define ARGON2_G(a, b, c, d)                                                  \
+  do                                                                          \
+    {                                                                         \
+      (a) = argon2_fblamka ((a), (b));                                        \
+      (d) = rotr64 ((d) ^ (a), 32);                                           \
+      (c) = argon2_fblamka ((c), (d));                                        \
+      (b) = rotr64 ((b) ^ (c), 24);                                           \
+      (a) = argon2_fblamka ((a), (b));                                        \
+      (d) = rotr64 ((d) ^ (a), 16);                                           \
+      (c) = argon2_fblamka ((c), (d));                                        \
+      (b) = rotr64 ((b) ^ (c), 63);                                           \
+    }                                                                         \
+  while (0)
+
+/* The BLAKE2b round without a message, on sixteen words of v. */
+#define ARGON2_ROUND(v, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11,     \
+                     i12, i13, i14, i15)                                      \
+  do                                                                          \
+    {                                                                         \
+      ARGON2_G ((v)[i0], (v)[i4], (v)[i8], (v)[i12]);                         \
+      ARGON2_G ((v)[i1], (v)[i5], (v)[i9], (v)[i13]);                         \
+      ARGON2_G ((v)[i2], (v)[i6], (v)[i10], (v)[i14]);                        \
+      ARGON2_G ((v)[i3], (v)[i7], (v)[i11], (v)[i15]);                        \
+      ARGON2_G ((v)[i0], (v)[i5], (v)[i10], (v)[i15]);                        \
+      ARGON2_G ((v)[i1], (v)[i6], (v)[i11], (v)[i12]);                        \
+      ARGON2_G ((v)[i2], (v)[i7], (v)[i8], (v)[i13]);                         \
+      ARGON2_G ((v)[i3], (v)[i4], (v)[i9], (v)[i14]);                         \
+    }                                                                         \
+  while (0)
+
+/*
+ * The block is an 8x8 matrix of 16-byte registers. The permutation is
+ * applied to each row of eight registers, which are sixteen consecutive
+ * words, and then to each column.
+ */
+static void
+argon2_fill_block_generic (uint64_t *next, const uint64_t *prev,
+                           const uint64_t *ref, int with_xor)
+{
+  uint64_t r[ARGON2_WORDS], z[ARGON2_WORDS];
+  size_t i;
+
+  for (i = 0; i < ARGON2_WORDS; ++i)
+    r[i] = prev[i] ^ ref[i];
+  memcpy (z, r, sizeof (z));
+
+  for (i = 0; i < 8; ++i)
+    ARGON2_ROUND (z, 16 * i, 16 * i + 1, 16 * i + 2, 16 * i + 3, 16 * i + 4,
+                  16 * i + 5, 16 * i + 6, 16 * i + 7, 16 * i + 8, 16 * i + 9,
+                  16 * i + 10, 16 * i + 11, 16 * i + 12, 16 * i + 13,
+                  16 * i + 14, 16 * i + 15);
+  for (i = 0; i < 8; ++i)
+    ARGON2_ROUND (z, 2 * i, 2 * i + 1, 2 * i + 16, 2 * i + 17, 2 * i + 32,
+                  2 * i + 33, 2 * i + 48, 2 * i + 49, 2 * i + 64, 2 * i + 65,
+                  2 * i + 80, 2 * i + 81, 2 * i + 96, 2 * i + 97,
+                  2 * i + 112, 2 * i + 113);
+
+  if (with_xor)
+    for (i = 0; i < ARGON2_WORDS; ++i)
+      next[i] ^= z[i] ^ r[i];
+  else
+    for (i = 0; i < ARGON2_WORDS; ++i)
+      next[i] = z[i] ^ r[i];
+}
+
+const struct argon2_backend argon2_backend_generic = {
+  "generic",
+  argon2_fill_block_generic,
+};
+
+/*
+ * The implementation is picked once when the library is loaded. Compilers
+ * without constructor support always use the portable code.
+ */
+static const struct argon2_backend *argon2_backend = &argon2_backend_generic;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+argon2_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    argon2_backend = &argon2_backend_avx2;
+#endif
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_NEON) != 0)
+    argon2_backend = &argon2_backend_neon;
+#endif
+}
+#endif /* __GNUC__ */
+
+/* The state shared by the threads filling the segments of one slice. */
+struct argon2_instance
+{
+  uint64_t *memory;
+  uint32_t passes;
+  uint32_t lanes;
+  uint32_t memory_blocks;
+  uint32_t lane_length;
+  uint32_t segment_length;
+  uint32_t pass;
+  uint32_t slice;
+};
+
+/*
+ * The variable length hash H' of RFC 9106 section 3.3. Outputs longer than
+ * a BLAKE2b digest are built from the first halves of a chain of digests.
+ */
+static void
+argon2_hash_long (uint8_t *out, size_t outlen, const uint8_t *input,
+                  size_t inputlen)
+{
+  struct blake2b_ctx ctx;
+  uint8_t v[BLAKE2B_DIGEST_SIZE], le[4];
+
+  buff_put_le32 (le, (uint32_t)outlen);
+  if (outlen <= BLAKE2B_DIGEST_SIZE)
+    {
+      blake2b_init (&ctx, outlen);
+      blake2b_update (&ctx, le, sizeof (le));
+      blake2b_update (&ctx, input, inputlen);
+      blake2b_final (out, &ctx);
+      return;
+    }
+
+  blake2b_init (&ctx, BLAKE2B_DIGEST_SIZE);
+  blake2b_update (&ctx, le, sizeof (le));
+  blake2b_update (&ctx, input, inputlen);
+  blake2b_final (v, &ctx);
+  memcpy (out, v, BLAKE2B_DIGEST_SIZE / 2);
+  out += BLAKE2B_DIGEST_SIZE / 2;
+  outlen -= BLAKE2B_DIGEST_SIZE / 2;
+  while (outlen > BLAKE2B_DIGEST_SIZE)
+    {
+      blake2b (v, v, NULL, BLAKE2B_DIGEST_SIZE, BLAKE2B_DIGEST_SIZE, 0);
+      memcpy (out, v, BLAKE2B_DIGEST_SIZE / 2);
+      out += BLAKE2B_DIGEST_SIZE / 2;
+      outlen -= BLAKE2B_DIGEST_SIZE / 2;
+    }
+  blake2b (out, v, NULL, outlen, BLAKE2B_DIGEST_SIZE, 0);
+  fcrypt_memzero (v, sizeof (v));
+}
+
+/*
+ * Computes the next block of pseudo-random addresses for the first half of
+ * the first pass, which doesn't depend on the password. The input block
+ * holds the position and a counter.
+ */
+static void
+argon2_next_addresses (uint64_t *address, uint64_t *input)
+{
+  static const uint64_t zero[ARGON2_WORDS];
+  uint64_t tmp[ARGON2_WORDS];
+
+  ++input[6];
+  argon2_backend->fill_block (tmp, zero, input, 0);
+  argon2_backend->fill_block (address, zero, tmp, 0);
+}
+
+/*
+ * Maps the low half of a pseudo-random value onto a block in the reference
+ * lane, as described in RFC 9106 section 3.4.1.2. The blocks that may be
+ * referenced are those finished before the current slice, plus the ones
+ * before the current block when the reference is to its own lane.
+ */
+static uint32_t
+argon2_index_alpha (const struct argon2_instance *inst, uint32_t index,
+                    uint32_t pseudo_rand, int same_lane)
+{
+  uint32_t area, start;
+  uint64_t pos;
+
+  if (inst->pass == 0)
+    {
+      start = 0;
+      if (inst->slice == 0)
+        area = index - 1;
+      else if (same_lane)
+        area = inst->slice * inst->segment_length + index - 1;
+      else
+        area = inst->slice * inst->segment_length - (index == 0);
+    }
+  else
+    {
+      start = inst->slice == ARGON2_SYNC_POINTS - 1
+                  ? 0
+                  : (inst->slice + 1) * inst->segment_length;
+      if (same_lane)
+        area = inst->lane_length - inst->segment_length + index - 1;
+      else
+        area = inst->lane_length - inst->segment_length - (index == 0);
+    }
+
+  pos = (uint64_t)pseudo_rand * pseudo_rand >> 32;
+  pos = area - 1 - ((uint64_t)area * pos >> 32);
+  return (uint32_t)((start + pos) % inst->lane_length);
+}
+
+/*
+ * Fills one lane's segment of the current slice. Argon2id takes the
+ * reference blocks from data-independent addresses for the first two slices
+ * of the first pass and from the previous block after that.
+ */
+static void
+argon2_fill_segment (void *arg, size_t lane)
+{
+  const struct argon2_instance *inst = arg;
+  uint64_t address[ARGON2_WORDS], input[ARGON2_WORDS];
+  const uint64_t *prev, *ref;
+  uint64_t pseudo_rand;
+  uint32_t i, start, ref_lane, ref_index;
+  size_t offset;
+  int independent;
+
+  independent = inst->pass == 0 && inst->slice < ARGON2_SYNC_POINTS / 2;
+  if (independent)
+    {
+      memset (input, 0, sizeof (input));
+      input[0] = inst->pass;
+      input[1] = lane;
+      input[2] = inst->slice;
+      input[3] = inst->memory_blocks;
+      input[4] = inst->passes;
+      input[5] = ARGON2_TYPE_ID;
+    }
+
+  /* The first two blocks of each lane come from the initial hash. */
+  start = 0;
+  if (inst->pass == 0 && inst->slice == 0)
+    {
+      start = 2;
+      if (independent)
+        argon2_next_addresses (address, input);
+    }
+
+  offset = lane * inst->lane_length + inst->slice * inst->segment_length
+           + start;
+  for (i = start; i < inst->segment_length; ++i, ++offset)
+    {
+      if (offset % inst->lane_length == 0)
+        prev = inst->memory + (offset + inst->lane_length - 1) * ARGON2_WORDS;
+      else
+        prev = inst->memory + (offset - 1) * ARGON2_WORDS;
+
+      if (independent)
+        {
+          if (i % ARGON2_ADDRESSES_IN_BLOCK == 0)
+            argon2_next_addresses (address, input);
+          pseudo_rand = address[i % ARGON2_ADDRESSES_IN_BLOCK];
+        }
+      else
+        pseudo_rand = prev[0];
+
+      if (inst->pass == 0 && inst->slice == 0)
+        ref_lane = (uint32_t)lane;
+      else
+        ref_lane = (uint32_t)((pseudo_rand >> 32) % inst->lanes);
+      ref_index = argon2_index_alpha (inst, i, (uint32_t)pseudo_rand,
+                                      ref_lane == lane);
+      ref = inst->memory
+            + ((size_t)ref_lane * inst->lane_length + ref_index)
+                  * ARGON2_WORDS;
+      argon2_backend->fill_block (inst->memory + offset * ARGON2_WORDS, prev,
+                                  ref, inst->pass != 0);
+    }
+}
+
+/*
+ * Allocates the memory matrix. Argon2 reads blocks from all over it, so
+ * huge pages save most of the TLB misses once it is larger than the cache.
+ * Explicit huge pages are tried first when the size allows it, then
+ * transparent huge pages are requested for ordinary pages.
+ */
+static void *
+argon2_alloc (size_t size)
+{
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(MAP_ANONYMOUS)
+  void *memory;
+
+#if defined(MAP_HUGETLB)
+  if (size % ARGON2_HUGE_PAGE_SIZE == 0)
+    {
+      memory = mmap (NULL, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (memory != MAP_FAILED)
+        return memory;
+    }
+#endif
+  memory = mmap (NULL, size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED)
+    return NULL;
+#if defined(HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+  if (size >= ARGON2_HUGE_PAGE_SIZE)
+    madvise (memory, size, MADV_HUGEPAGE);
+#endif
+  return memory;
+#else
+  return malloc (size);
+#endif
+}
+
+/* Clears and frees memory from argon2_alloc. */
+static void
+argon2_free (void *memory, size_t size)
+{
+  fcrypt_memzero (memory, size);
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(MAP_ANONYMOUS)
+  munmap (memory, size);
+#else
+  free (memory);
+#endif
+}
+
+/* Hashes a length and then the bytes it counts, as H_0 does. */
+static void
+argon2_update_length (struct blake2b_ctx *ctx, const void *input,
+                      size_t inputlen)
+{
+  uint8_t le[4];
+
+  buff_put_le32 (le, (uint32_t)inputlen);
+  blake2b_update (ctx, le, sizeof (le));
+  if (inputlen > 0)
+    blake2b_update (ctx, input, inputlen);
+}
+
+int
+argon2id (uint8_t *out, size_t outlen, const void *pass, size_t passlen,
+          const uint8_t *salt, size_t saltlen,
+          const struct argon2_params *params)
+{
+  struct argon2_instance inst;
+  struct blake2b_ctx ctx;
+  uint8_t h0[BLAKE2B_DIGEST_SIZE + 8], block[ARGON2_BLOCK_SIZE], le[4];
+  uint64_t *last;
+  uint32_t lane, i;
+  unsigned int threads;
+  size_t size, j;
+
+  if (outlen < ARGON2_MIN_OUTLEN || outlen > UINT32_MAX
+      || saltlen < ARGON2_MIN_SALTLEN || saltlen > UINT32_MAX
+      || passlen > UINT32_MAX || params->secretlen > UINT32_MAX
+      || params->adlen > UINT32_MAX || params->t_cost < 1
+      || params->lanes < 1 || params->lanes > ARGON2_MAX_LANES
+      || params->m_cost / 8 < params->lanes)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  inst.passes = params->t_cost;
+  inst.lanes = params->lanes;
+  inst.segment_length
+      = params->m_cost / (params->lanes * ARGON2_SYNC_POINTS);
+  inst.lane_length = inst.segment_length * ARGON2_SYNC_POINTS;
+  inst.memory_blocks = inst.lane_length * inst.lanes;
+  if ((uint64_t)inst.memory_blocks * ARGON2_BLOCK_SIZE > SIZE_MAX)
+    {
+      errno = ENOMEM;
+      return -1;
+    }
+  size = (size_t)inst.memory_blocks * ARGON2_BLOCK_SIZE;
+  inst.memory = argon2_alloc (size);
+  if (inst.memory == NULL)
+    {
+      errno = ENOMEM;
+      return -1;
+    }
+
+  /* H_0, from RFC 9106 section 3.2. */
+  blake2b_init (&ctx, BLAKE2B_DIGEST_SIZE);
+  buff_put_le32 (le, params->lanes);
+  blake2b_update (&ctx, le, sizeof (le));
+  buff_put_le32 (le, (uint32_t)outlen);
+  blake2b_update (&ctx, le, sizeof (le));
+  buff_put_le32 (le, params->m_cost);
+  blake2b_update (&ctx, le, sizeof (le));
+  buff_put_le32 (le, params->t_cost);
+  blake2b_update (&ctx, le, sizeof (le));
+  buff_put_le32 (le, ARGON2_VERSION);
+  blake2b_update (&ctx, le, sizeof (le));
+  buff_put_le32 (le, ARGON2_TYPE_ID);
+  blake2b_update (&ctx, le, sizeof (le));
+  argon2_update_length (&ctx, pass, passlen);
+  argon2_update_length (&ctx, salt, saltlen);
+  argon2_update_length (&ctx, params->secret, params->secretlen);
+  argon2_update_length (&ctx, params->ad, params->adlen);
+  blake2b_final (h0, &ctx);
+
+  /* The first two blocks of each lane. */
+  for (lane = 0; lane < inst.lanes; ++lane)
+    for (i = 0; i < 2; ++i)
+      {
+        buff_put_le32 (h0 + BLAKE2B_DIGEST_SIZE, i);
+        buff_put_le32 (h0 + BLAKE2B_DIGEST_SIZE + 4, lane);
+        argon2_hash_long (block, sizeof (block), h0, sizeof (h0));
+        last = inst.memory
+               + ((size_t)lane * inst.lane_length + i) * ARGON2_WORDS;
+        for (j = 0; j < ARGON2_WORDS; ++j)
+          last[j] = buff_get_le64 (block + j * 8);
+      }
+
+  /*
+   * The segments of a slice are independent, so each slice is one batch of
+   * tasks on the thread pool, one per lane.
+   */
+  threads = params->threads > 1 ? params->threads : 1;
+  for (inst.pass = 0; inst.pass < inst.passes; ++inst.pass)
+    for (inst.slice = 0; inst.slice < ARGON2_SYNC_POINTS; ++inst.slice)
+      fcrypt_pool_run (argon2_fill_segment, &inst, inst.lanes, threads);
+
+  /* The tag is H' of the XOR of the last block of every lane. */
+  last = inst.memory + (size_t)(inst.lane_length - 1) * ARGON2_WORDS;
+  for (lane = 1; lane < inst.lanes; ++lane)
+    {
+      const uint64_t *other
+          = last + (size_t)lane * inst.lane_length * ARGON2_WORDS;
+
+      for (i = 0; i < ARGON2_WORDS; ++i)
+        last[i] ^= other[i];
+    }
+  for (i = 0; i < ARGON2_WORDS; ++i)
+    buff_put_le64 (block + i * 8, last[i]);
+  argon2_hash_long (out, outlen, block, sizeof (block));
+
+  argon2_free (inst.memory, size);
+  fcrypt_memzero (h0, sizeof (h0));
+  fcrypt_memzero (block, sizeof (block));
+  return 0;
+}
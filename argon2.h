@@ -0,0 +1,75 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Argon2id from RFC 9106, the memory-hard password hash that won the
+ * Password Hashing Competition. Only version 0x13 is implemented.
+ */
+
+#ifndef ARGON2_H
+#define ARGON2_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ARGON2_VERSION 0x13
+#define ARGON2_BLOCK_SIZE 1024
+#define ARGON2_SYNC_POINTS 4
+
+#define ARGON2_MIN_OUTLEN 4
+#define ARGON2_MIN_SALTLEN 8
+#define ARGON2_MAX_LANES 0xffffff
+
+/*
+ * The cost parameters, and the optional secret key and associated data,
+ * which may be NULL when their lengths are zero. The memory cost is in
+ * KiB and must be at least eight times the number of lanes; it is rounded
+ * down to a multiple of four times the number of lanes.
+ *
+ * The lanes are the parallelism of RFC 9106 and are part of the hash. The
+ * number of threads is not: it only says how many threads, including the
+ * calling one, compute the lanes, and zero means one.
+ */
+struct argon2_params
+{
+  uint32_t t_cost;       /* Number of passes over memory */
+  uint32_t m_cost;       /* Memory size in KiB */
+  uint32_t lanes;        /* Degree of parallelism */
+  uint32_t threads;      /* Threads to compute the lanes with */
+  const uint8_t *secret; /* Secret key, K in RFC 9106 */
+  size_t secretlen;
+  const uint8_t *ad; /* Associated data, X in RFC 9106 */
+  size_t adlen;
+};
+
+/*
+ * Computes a tag of the given length from the password and its length and
+ * the salt and its length. Returns 0, or -1 with errno set to EINVAL if a
+ * parameter is out of range or ENOMEM if the memory can't be allocated.
+ */
+int argon2id (uint8_t *, size_t, const void *, size_t, const uint8_t *,
+              size_t, const struct argon2_params *);
+
+#endif /* ARGON2_H */
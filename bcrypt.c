@@ -0,0 +1,551 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * bcrypt password hashing, from "A Future-Adaptable Password Scheme" by
+ * Niels Provos and David Mazieres. The EksBlowfish key schedule runs the
+ * Blowfish key expansion 2^cost times alternating on the password and the
+ * salt. Both are turned into their 18 P-array key words once, so the inner
+ * loop only XORs them in and chains the encryptions through P and S.
+ *
+ * Inside one key schedule every encryption depends on the last, so the only
+ * parallelism is between different hashes. bcrypt_verify_batch runs up to
+ * four hashes of the same cost side by side so their S-box loads overlap.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bcrypt.h"
+#include "blowfish-internal.h"
+#include "blowfish.h"
+#include "fcrypt_memzero.h"
+
+/* Hash length before encoding, the last byte of the cipher text is unused. */
+#define BCRYPT_RAW_SIZE 23
+
+struct bcrypt_job
+{
+  struct blowfish_ctx ctx; /* EksBlowfish state. */
+  uint32_t key[18];        /* Password as P-array key words. */
+  uint32_t saltkey[18];    /* Salt as P-array key words. */
+  uint8_t salt[BCRYPT_SALT_SIZE];
+  unsigned int cost;
+  char minor; /* Version letter, 'a', 'b' or 'y'. */
+};
+
+static const char bcrypt_base64[]
+    = "./ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+
+/* "OrpheanBeholderScryDoubt" */
+static const uint32_t bcrypt_ctext[6] = { 0x4f727068, 0x65616e42, 0x65686f6c,
+                                          0x64657253, 0x63727944, 0x6f756274 };
+
+/* Writes the bcrypt base64 encoding of len bytes without padding. */
+static char *
+bcrypt_encode (char *out, const uint8_t *data, size_t len)
+{
+  const uint8_t *end = data + len;
+  unsigned int c1, c2;
+
+  while (data < end)
+    {
+      c1 = *data++;
+      *out++ = bcrypt_base64[c1 >> 2];
+      c1 = (c1 & 0x03) << 4;
+      if (data >= end)
+        {
+          *out++ = bcrypt_base64[c1];
+          break;
+        }
+      c2 = *data++;
+      *out++ = bcrypt_base64[c1 | (c2 >> 4)];
+      c1 = (c2 & 0x0f) << 2;
+      if (data >= end)
+        {
+          *out++ = bcrypt_base64[c1];
+          break;
+        }
+      c2 = *data++;
+      *out++ = bcrypt_base64[c1 | (c2 >> 6)];
+      *out++ = bcrypt_base64[c2 & 0x3f];
+    }
+  return out;
+}
+
+static int
+bcrypt_decode_char (char c)
+{
+  const char *p;
+
+  if (c == '\0')
+    return -1;
+  p = strchr (bcrypt_base64, c);
+  return p != NULL ? (int)(p - bcrypt_base64) : -1;
+}
+
+/* Decodes len bytes from the bcrypt base64 in src. */
+static int
+bcrypt_decode (uint8_t *data, size_t len, const char *src)
+{
+  int c[4];
+  size_t i, j;
+
+  for (i = 0; i < len; src += 4)
+    {
+      for (j = 0; j < 4; ++j)
+        c[j] = 0;
+      for (j = 0; j < 4 && (j == 0 || i + j - 1 < len); ++j)
+        {
+          c[j] = bcrypt_decode_char (src[j]);
+          if (c[j] < 0)
+            return -1;
+        }
+      data[i++] = (uint8_t)((c[0] << 2) | (c[1] >> 4));
+      if (i < len)
+        data[i++] = (uint8_t)((c[1] << 4) | (c[2] >> 2));
+      if (i < len)
+        data[i++] = (uint8_t)((c[2] << 6) | c[3]);
+    }
+  return 0;
+}
+
+/* Cycles through len bytes to make the 18 words XORed into the P-array. */
+static void
+bcrypt_key_words (uint32_t *words, const uint8_t *key, size_t len)
+{
+  size_t i, j, k;
+  uint32_t w;
+
+  for (i = k = 0; i < 18; ++i)
+    {
+      for (j = w = 0; j < 4; ++j)
+        {
+          w = (w << 8) | key[k];
+          if (++k >= len)
+            k = 0;
+        }
+      words[i] = w;
+    }
+}
+
+/*
+ * Reads the version, cost and salt from a setting or a full hash and sets
+ * up the key words. Returns -1 if the setting is malformed.
+ */
+static int
+bcrypt_parse (struct bcrypt_job *job, const char *password,
+              const char *setting)
+{
+  uint8_t key[BCRYPT_MAX_KEY_SIZE];
+  size_t len;
+
+  if (setting[0] != '$' || setting[1] != '2'
+      || (setting[2] != 'a' && setting[2] != 'b' && setting[2] != 'y')
+      || setting[3] != '$' || setting[4] < '0' || setting[4] > '9'
+      || setting[5] < '0' || setting[5] > '9' || setting[6] != '$')
+    return -1;
+  job->minor = setting[2];
+  job->cost = (unsigned int)(setting[4] - '0') * 10
+              + (unsigned int)(setting[5] - '0');
+  if (job->cost < BCRYPT_MIN_COST || job->cost > BCRYPT_MAX_COST)
+    return -1;
+  if (bcrypt_decode (job->salt, BCRYPT_SALT_SIZE, setting + 7) != 0)
+    return -1;
+
+  /* The key includes the terminating null byte if it fits. */
+  len = strlen (password) + 1;
+  if (len > BCRYPT_MAX_KEY_SIZE)
+    len = BCRYPT_MAX_KEY_SIZE;
+  memcpy (key, password, len);
+  bcrypt_key_words (job->key, key, len);
+  bcrypt_key_words (job->saltkey, job->salt, BCRYPT_SALT_SIZE);
+  fcrypt_memzero (key, sizeof (key));
+  return 0;
+}
+
+#define BCRYPT_ENCIPHER(p, s, l, r, t)                                        \
+  do                                                                          \
+    {                                                                         \
+      (l) ^= (p)[0];                                                          \
+      BLOWFISH_ROUND (s, p, r, l, 1);                                         \
+      BLOWFISH_ROUND (s, p, l, r, 2);                                         \
+      BLOWFISH_ROUND (s, p, r, l, 3);                                         \
+      BLOWFISH_ROUND (s, p, l, r, 4);                                         \
+      BLOWFISH_ROUND (s, p, r, l, 5);                                         \
+      BLOWFISH_ROUND (s, p, l, r, 6);                                         \
+      BLOWFISH_ROUND (s, p, r, l, 7);                                         \
+      BLOWFISH_ROUND (s, p, l, r, 8);                                         \
+      BLOWFISH_ROUND (s, p, r, l, 9);                                         \
+      BLOWFISH_ROUND (s, p, l, r, 10);                                        \
+      BLOWFISH_ROUND (s, p, r, l, 11);                                        \
+      BLOWFISH_ROUND (s, p, l, r, 12);                                        \
+      BLOWFISH_ROUND (s, p, r, l, 13);                                        \
+      BLOWFISH_ROUND (s, p, l, r, 14);                                        \
+      BLOWFISH_ROUND (s, p, r, l, 15);                                        \
+      BLOWFISH_ROUND (s, p, l, r, 16);                                        \
+      (t) = (l);                                                              \
+      (l) = (r) ^ (p)[17];                                                    \
+      (r) = (t);                                                              \
+    }                                                                         \
+  while (0)
+
+/*
+ * The first expansion, which also XORs the salt into the data being
+ * encrypted. It is only done once so the generic code is fine.
+ */
+static void
+bcrypt_expand_salted (struct bcrypt_job *job)
+{
+  uint32_t *p = job->ctx.p;
+  uint32_t *s = job->ctx.s;
+  uint32_t l, r, t;
+  size_t i;
+
+  memcpy (p, blowfish_initial_parray, sizeof (job->ctx.p));
+  memcpy (s, blowfish_initial_sbox, sizeof (job->ctx.s));
+  for (i = 0; i < 18; ++i)
+    p[i] ^= job->key[i];
+  l = r = 0;
+  for (i = 0; i < 18; i += 2)
+    {
+      l ^= job->saltkey[i & 3];
+      r ^= job->saltkey[(i & 3) + 1];
+      BCRYPT_ENCIPHER (p, s, l, r, t);
+      p[i] = l;
+      p[i + 1] = r;
+    }
+  for (i = 0; i < 1024; i += 2)
+    {
+      l ^= job->saltkey[(i + 2) & 3];
+      r ^= job->saltkey[((i + 2) & 3) + 1];
+      BCRYPT_ENCIPHER (p, s, l, r, t);
+      s[i] = l;
+      s[i + 1] = r;
+    }
+}
+
+/* ExpandKey (state, 0, key) with the key already in P-array words. */
+static void
+bcrypt_expand (struct blowfish_ctx *ctx, const uint32_t *key)
+{
+  uint32_t *p = ctx->p;
+  uint32_t *s = ctx->s;
+  uint32_t l, r, t;
+  size_t i;
+
+  for (i = 0; i < 18; ++i)
+    p[i] ^= key[i];
+  l = r = 0;
+  for (i = 0; i < 18; i += 2)
+    {
+      BCRYPT_ENCIPHER (p, s, l, r, t);
+      p[i] = l;
+      p[i + 1] = r;
+    }
+  for (i = 0; i < 1024; i += 2)
+    {
+      BCRYPT_ENCIPHER (p, s, l, r, t);
+      s[i] = l;
+      s[i + 1] = r;
+    }
+}
+
+static void
+bcrypt_eks (struct bcrypt_job *job)
+{
+  uint64_t n;
+
+  bcrypt_expand_salted (job);
+  for (n = (uint64_t)1 << job->cost; n > 0; --n)
+    {
+      bcrypt_expand (&job->ctx, job->key);
+      bcrypt_expand (&job->ctx, job->saltkey);
+    }
+}
+
+/* One Blowfish round of four independent states. */
+#define BCRYPT_ROUND4(h1, h2, i)                                              \
+  do                                                                          \
+    {                                                                         \
+      BLOWFISH_ROUND (s0, p0, h1##0, h2##0, i);                               \
+      BLOWFISH_ROUND (s1, p1, h1##1, h2##1, i);                               \
+      BLOWFISH_ROUND (s2, p2, h1##2, h2##2, i);                               \
+      BLOWFISH_ROUND (s3, p3, h1##3, h2##3, i);                               \
+    }                                                                         \
+  while (0)
+
+#define BCRYPT_ENCIPHER4()                                                    \
+  do                                                                          \
+    {                                                                         \
+      l0 ^= p0[0];                                                            \
+      l1 ^= p1[0];                                                            \
+      l2 ^= p2[0];                                                            \
+      l3 ^= p3[0];                                                            \
+      BCRYPT_ROUND4 (r, l, 1);                                                \
+      BCRYPT_ROUND4 (l, r, 2);                                                \
+      BCRYPT_ROUND4 (r, l, 3);                                                \
+      BCRYPT_ROUND4 (l, r, 4);                                                \
+      BCRYPT_ROUND4 (r, l, 5);                                                \
+      BCRYPT_ROUND4 (l, r, 6);                                                \
+      BCRYPT_ROUND4 (r, l, 7);                                                \
+      BCRYPT_ROUND4 (l, r, 8);                                                \
+      BCRYPT_ROUND4 (r, l, 9);                                                \
+      BCRYPT_ROUND4 (l, r, 10);                                               \
+      BCRYPT_ROUND4 (r, l, 11);                                               \
+      BCRYPT_ROUND4 (l, r, 12);                                               \
+      BCRYPT_ROUND4 (r, l, 13);                                               \
+      BCRYPT_ROUND4 (l, r, 14);                                               \
+      BCRYPT_ROUND4 (r, l, 15);                                               \
+      BCRYPT_ROUND4 (l, r, 16);                                               \
+      t = l0;                                                                 \
+      l0 = r0 ^ p0[17];                                                       \
+      r0 = t;                                                                 \
+      t = l1;                                                                 \
+      l1 = r1 ^ p1[17];                                                       \
+      r1 = t;                                                                 \
+      t = l2;                                                                 \
+      l2 = r2 ^ p2[17];                                                       \
+      r2 = t;                                                                 \
+      t = l3;                                                                 \
+      l3 = r3 ^ p3[17];                                                       \
+      r3 = t;                                                                 \
+    }                                                                         \
+  while (0)
+
+#define BCRYPT_STORE4(x, i)                                                   \
+  do                                                                          \
+    {                                                                         \
+      x##0[(i)] = l0;                                                         \
+      x##0[(i) + 1] = r0;                                                     \
+      x##1[(i)] = l1;                                                         \
+      x##1[(i) + 1] = r1;                                                     \
+      x##2[(i)] = l2;                                                         \
+      x##2[(i) + 1] = r2;                                                     \
+      x##3[(i)] = l3;                                                         \
+      x##3[(i) + 1] = r3;                                                     \
+    }                                                                         \
+  while (0)
+
+/* bcrypt_expand on four states at once, with the key at offset in each. */
+static void
+bcrypt_expand4 (struct bcrypt_job *jobs, size_t offset)
+{
+  uint32_t *p0 = jobs[0].ctx.p, *p1 = jobs[1].ctx.p;
+  uint32_t *p2 = jobs[2].ctx.p, *p3 = jobs[3].ctx.p;
+  uint32_t *s0 = jobs[0].ctx.s, *s1 = jobs[1].ctx.s;
+  uint32_t *s2 = jobs[2].ctx.s, *s3 = jobs[3].ctx.s;
+  uint32_t l0, l1, l2, l3, r0, r1, r2, r3, t;
+  const uint32_t *k;
+  size_t i, j;
+
+  for (j = 0; j < BCRYPT_BATCH_WIDTH; ++j)
+    {
+      k = (const uint32_t *)((const char *)&jobs[j] + offset);
+      for (i = 0; i < 18; ++i)
+        jobs[j].ctx.p[i] ^= k[i];
+    }
+  l0 = l1 = l2 = l3 = r0 = r1 = r2 = r3 = 0;
+  for (i = 0; i < 18; i += 2)
+    {
+      BCRYPT_ENCIPHER4 ();
+      BCRYPT_STORE4 (p, i);
+    }
+  for (i = 0; i < 1024; i += 2)
+    {
+      BCRYPT_ENCIPHER4 ();
+      BCRYPT_STORE4 (s, i);
+    }
+}
+
+/* bcrypt_eks on four jobs of the same cost. */
+static void
+bcrypt_eks4 (struct bcrypt_job *jobs)
+{
+  uint64_t n;
+  size_t j;
+
+  for (j = 0; j < BCRYPT_BATCH_WIDTH; ++j)
+    bcrypt_expand_salted (&jobs[j]);
+  for (n = (uint64_t)1 << jobs[0].cost; n > 0; --n)
+    {
+      bcrypt_expand4 (jobs, offsetof (struct bcrypt_job, key));
+      bcrypt_expand4 (jobs, offsetof (struct bcrypt_job, saltkey));
+    }
+}
+
+/* Encrypts the magic text with the final state and formats the result. */
+static void
+bcrypt_finish (char *out, struct bcrypt_job *job)
+{
+  uint32_t *p = job->ctx.p;
+  uint32_t *s = job->ctx.s;
+  uint32_t c[6], t;
+  uint8_t raw[24];
+  size_t i, j;
+
+  memcpy (c, bcrypt_ctext, sizeof (c));
+  for (i = 0; i < 64; ++i)
+    for (j = 0; j < 6; j += 2)
+      BCRYPT_ENCIPHER (p, s, c[j], c[j + 1], t);
+  for (j = 0; j < 6; ++j)
+    {
+      raw[j * 4] = (uint8_t)(c[j] >> 24);
+      raw[j * 4 + 1] = (uint8_t)(c[j] >> 16);
+      raw[j * 4 + 2] = (uint8_t)(c[j] >> 8);
+      raw[j * 4 + 3] = (uint8_t)c[j];
+    }
+
+  out[0] = '$';
+  out[1] = '2';
+  out[2] = job->minor;
+  out[3] = '$';
+  out[4] = (char)('0' + job->cost / 10);
+  out[5] = (char)('0' + job->cost % 10);
+  out[6] = '$';
+  out = bcrypt_encode (out + 7, job->salt, BCRYPT_SALT_SIZE);
+  out = bcrypt_encode (out, raw, BCRYPT_RAW_SIZE);
+  *out = '\0';
+  fcrypt_memzero (raw, sizeof (raw));
+  fcrypt_memzero (c, sizeof (c));
+}
+
+/*
+ * Writes the setting string for a salt and cost, which must have room for
+ * BCRYPT_SETTING_LENGTH + 1 characters. Returns -1 if the cost is out of
+ * range.
+ */
+int
+bcrypt_setting (char *out, const uint8_t *salt, unsigned int cost)
+{
+  if (cost < BCRYPT_MIN_COST || cost > BCRYPT_MAX_COST)
+    return -1;
+  memcpy (out, "$2b$", 4);
+  out[4] = (char)('0' + cost / 10);
+  out[5] = (char)('0' + cost % 10);
+  out[6] = '$';
+  *bcrypt_encode (out + 7, salt, BCRYPT_SALT_SIZE) = '\0';
+  return 0;
+}
+
+/*
+ * Hashes a password with a setting, or a full hash to take the setting
+ * from, into out, which must have room for BCRYPT_HASH_LENGTH + 1
+ * characters. Returns -1 if the setting is malformed.
+ */
+int
+bcrypt_hash (char *out, const char *password, const char *setting)
+{
+  struct bcrypt_job job;
+
+  if (bcrypt_parse (&job, password, setting) != 0)
+    return -1;
+  bcrypt_eks (&job);
+  bcrypt_finish (out, &job);
+  fcrypt_memzero (&job, sizeof (job));
+  return 0;
+}
+
+/* Compares two hash strings in constant time. */
+static int
+bcrypt_compare (const char *computed, const char *hash)
+{
+  unsigned int diff;
+  size_t i;
+
+  if (strlen (hash) != BCRYPT_HASH_LENGTH)
+    return -1;
+  diff = 0;
+  for (i = 0; i < BCRYPT_HASH_LENGTH; ++i)
+    diff |= (unsigned char)computed[i] ^ (unsigned char)hash[i];
+  return diff == 0 ? 0 : -1;
+}
+
+/* Returns 0 if the password matches the hash and -1 otherwise. */
+int
+bcrypt_verify (const char *password, const char *hash)
+{
+  char computed[BCRYPT_HASH_LENGTH + 1];
+  int rv;
+
+  if (bcrypt_hash (computed, password, hash) != 0)
+    return -1;
+  rv = bcrypt_compare (computed, hash);
+  fcrypt_memzero (computed, sizeof (computed));
+  return rv;
+}
+
+/*
+ * Verifies n passwords against their hashes, setting results[i] as
+ * bcrypt_verify would. Consecutive hashes with the same cost are computed
+ * up to BCRYPT_BATCH_WIDTH at a time, which takes little more time than
+ * one of them alone.
+ */
+void
+bcrypt_verify_batch (const char *const *passwords, const char *const *hashes,
+                     int *results, size_t n)
+{
+  struct bcrypt_job jobs[BCRYPT_BATCH_WIDTH];
+  char computed[BCRYPT_HASH_LENGTH + 1];
+  size_t index[BCRYPT_BATCH_WIDTH];
+  size_t i, j, m;
+
+  i = 0;
+  while (i < n)
+    {
+      for (m = 0; m < BCRYPT_BATCH_WIDTH && i < n;)
+        {
+          if (bcrypt_parse (&jobs[m], passwords[i], hashes[i]) != 0)
+            {
+              results[i++] = -1;
+              continue;
+            }
+          /* Left for the next group. */
+          if (m > 0 && jobs[m].cost != jobs[0].cost)
+            break;
+          index[m++] = i++;
+        }
+      if (m == 0)
+        continue;
+
+      if (m == 1)
+        bcrypt_eks (&jobs[0]);
+      else
+        {
+          /* Fill the unused lanes with copies of the first hash. */
+          for (j = m; j < BCRYPT_BATCH_WIDTH; ++j)
+            jobs[j] = jobs[0];
+          bcrypt_eks4 (jobs);
+        }
+      for (j = 0; j < m; ++j)
+        {
+          bcrypt_finish (computed, &jobs[j]);
+          results[index[j]] = bcrypt_compare (computed, hashes[index[j]]);
+        }
+    }
+  fcrypt_memzero (jobs, sizeof (jobs));
+  fcrypt_memzero (computed, sizeof (computed));
+}
@@ -0,0 +1,54 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef BCRYPT_H
+#define BCRYPT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BCRYPT_SALT_SIZE 16
+#define BCRYPT_MIN_COST 4
+#define BCRYPT_MAX_COST 31
+
+/* Longest password that is used, including the terminating null byte. */
+#define BCRYPT_MAX_KEY_SIZE 72
+
+/* "$2b$", two cost digits, "$" and 22 characters of salt. */
+#define BCRYPT_SETTING_LENGTH 29
+
+/* The setting followed by 31 characters of hash. */
+#define BCRYPT_HASH_LENGTH 60
+
+/* Most hashes bcrypt_verify_batch computes side by side. */
+#define BCRYPT_BATCH_WIDTH 4
+
+int bcrypt_setting (char *, const uint8_t *, unsigned int);
+int bcrypt_hash (char *, const char *, const char *);
+int bcrypt_verify (const char *, const char *);
+void bcrypt_verify_batch (const char *const *, const char *const *, int *,
+                          size_t);
+
+#endif /* BCRYPT_H */
@@ -0,0 +1,291 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "aes-internal.h"
+#include "aes.h"
+#include "bench.h"
+
+/* Number of key setups averaged for each measurement. */
+#define BENCH_KEYS 100000
+
+/* Size of the buffer for the throughput measurements. */
+#define BENCH_BUFFER_SIZE 16384
+
+/* Minimum time spent on each throughput measurement, in seconds. */
+#define BENCH_MIN_TIME 0.25
+
+/*
+ * Data that competes with the AES tables for the L1 cache in the mixed load
+ * measurement, standing in for the packets of a network stack. A slice of
+ * BENCH_LOAD_STRIDE bytes is read after every BENCH_LOAD_BLOCKS blocks.
+ */
+#define BENCH_LOAD_SIZE 32768
+#define BENCH_LOAD_STRIDE 2048
+#define BENCH_LOAD_BLOCKS 8
+
+/* Sector size for the XTS measurements. */
+#define BENCH_SECTOR_SIZE 512
+
+static uint8_t buffer[BENCH_BUFFER_SIZE];
+static uint64_t sectors[BENCH_BUFFER_SIZE / BENCH_SECTOR_SIZE];
+static uint8_t load[BENCH_LOAD_SIZE];
+static volatile uint8_t load_sink;
+
+static void
+report_setup (const char *name, uint64_t ticks)
+{
+  printf ("%-28s %10.1f %s/key\n", name, (double)ticks / BENCH_KEYS,
+          BENCH_TICK_UNIT);
+}
+
+static void
+report_rate (const char *name, size_t bytes, double seconds)
+{
+  printf ("%-28s %10.1f MB/s\n", name, (double)bytes / seconds / 1e6);
+}
+
+/*
+ * Runs the block function of the T-table code over the buffer, reading
+ * through load in between when loaded is nonzero.
+ */
+static void
+table_blocks (void (*func) (const uint32_t *, const uint8_t *, uint8_t *),
+              const uint32_t *rk, int loaded)
+{
+  static size_t offset;
+  size_t i, j;
+  uint8_t acc;
+
+  acc = 0;
+  for (i = 0; i < sizeof (buffer); i += AES_BLOCK_SIZE)
+    {
+      func (rk, buffer + i, buffer + i);
+      if (loaded
+          && (i / AES_BLOCK_SIZE) % BENCH_LOAD_BLOCKS == BENCH_LOAD_BLOCKS - 1)
+        {
+          for (j = 0; j < BENCH_LOAD_STRIDE; j += 64)
+            acc ^= load[offset + j];
+          offset = (offset + BENCH_LOAD_STRIDE) % sizeof (load);
+        }
+    }
+  load_sink = acc;
+}
+
+#define BENCH_SETUP(name, type, func)                                         \
+  do                                                                          \
+    {                                                                         \
+      type ctx;                                                               \
+      uint64_t start;                                                         \
+      size_t i;                                                               \
+                                                                              \
+      start = bench_ticks ();                                                 \
+      for (i = 0; i < BENCH_KEYS; ++i)                                        \
+        {                                                                     \
+          key[0] = (uint8_t)i;                                                \
+          func (&ctx, key);                                                   \
+        }                                                                     \
+      report_setup (name, bench_ticks () - start);                            \
+    }                                                                         \
+  while (0)
+
+/* Same as BENCH_SETUP with the keys set AES_BENCH_BATCH at a time. */
+#define AES_BENCH_BATCH 8
+
+#define BENCH_SETUP_BATCH(name, type, func)                                   \
+  do                                                                          \
+    {                                                                         \
+      type ctx[AES_BENCH_BATCH];                                              \
+      uint8_t keys[AES_BENCH_BATCH][AES256_KEY_SIZE];                         \
+      const uint8_t *keyp[AES_BENCH_BATCH];                                   \
+      uint64_t start;                                                         \
+      size_t i, j;                                                            \
+                                                                              \
+      for (j = 0; j < AES_BENCH_BATCH; ++j)                                   \
+        {                                                                     \
+          memcpy (keys[j], key, sizeof (keys[j]));                            \
+          keyp[j] = keys[j];                                                  \
+        }                                                                     \
+      start = bench_ticks ();                                                 \
+      for (i = 0; i < BENCH_KEYS; i += AES_BENCH_BATCH)                       \
+        {                                                                     \
+          for (j = 0; j < AES_BENCH_BATCH; ++j)                               \
+            keys[j][0] = (uint8_t)(i + j);                                    \
+          func (ctx, keyp, AES_BENCH_BATCH);                                  \
+        }                                                                     \
+      report_setup (name, bench_ticks () - start);                            \
+    }                                                                         \
+  while (0)
+
+#define BENCH_RATE(name, stmt)                                                \
+  do                                                                          \
+    {                                                                         \
+      double start, now;                                                      \
+      size_t bytes;                                                           \
+                                                                              \
+      bytes = 0;                                                              \
+      start = bench_seconds ();                                               \
+      do                                                                      \
+        {                                                                     \
+          stmt;                                                               \
+          bytes += sizeof (buffer);                                           \
+          now = bench_seconds ();                                             \
+        }                                                                     \
+      while (now - start < BENCH_MIN_TIME);                                   \
+      report_rate (name, bytes, now - start);                                 \
+    }                                                                         \
+  while (0)
+
+int
+main (void)
+{
+  struct aes128_ctx ctx128;
+  struct aes128_enc_ctx ectx128;
+  struct aes256_ctx ctx256;
+  struct aes256_enc_ctx ectx256;
+  struct aes128_xts_ctx xctx128;
+  struct aes256_xts_ctx xctx256;
+  uint8_t key[AES256_KEY_SIZE];
+  uint8_t xkey[AES256_XTS_KEY_SIZE];
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint32_t ek[4 * (AES128_ROUNDS + 1)], dk[4 * (AES128_ROUNDS + 1)];
+  size_t i;
+
+  memset (key, 0x5a, sizeof (key));
+  memset (iv, 0, sizeof (iv));
+  memset (load, 0xa5, sizeof (load));
+  for (i = 0; i < BENCH_BUFFER_SIZE / BENCH_SECTOR_SIZE; ++i)
+    sectors[i] = i;
+  printf ("%-28s %10zu bytes\n", "sizeof (aes128_ctx)",
+          sizeof (struct aes128_ctx));
+  printf ("%-28s %10zu bytes\n", "sizeof (aes128_enc_ctx)",
+          sizeof (struct aes128_enc_ctx));
+  printf ("%-28s %10zu bytes\n", "sizeof (aes256_ctx)",
+          sizeof (struct aes256_ctx));
+  printf ("%-28s %10zu bytes\n", "sizeof (aes256_enc_ctx)",
+          sizeof (struct aes256_enc_ctx));
+
+  BENCH_SETUP ("aes128_set_encrypt_key", struct aes128_ctx,
+               aes128_set_encrypt_key);
+  BENCH_SETUP_BATCH ("aes128_set_encrypt_key_batch", struct aes128_ctx,
+                     aes128_set_encrypt_key_batch);
+  BENCH_SETUP ("aes128_set_decrypt_key", struct aes128_ctx,
+               aes128_set_decrypt_key);
+  BENCH_SETUP ("aes128_enc_set_key", struct aes128_enc_ctx,
+               aes128_enc_set_key);
+  BENCH_SETUP ("aes192_set_encrypt_key", struct aes192_ctx,
+               aes192_set_encrypt_key);
+  BENCH_SETUP_BATCH ("aes192_set_encrypt_key_batch", struct aes192_ctx,
+                     aes192_set_encrypt_key_batch);
+  BENCH_SETUP ("aes192_set_decrypt_key", struct aes192_ctx,
+               aes192_set_decrypt_key);
+  BENCH_SETUP ("aes192_enc_set_key", struct aes192_enc_ctx,
+               aes192_enc_set_key);
+  BENCH_SETUP ("aes256_set_encrypt_key", struct aes256_ctx,
+               aes256_set_encrypt_key);
+  BENCH_SETUP_BATCH ("aes256_set_encrypt_key_batch", struct aes256_ctx,
+                     aes256_set_encrypt_key_batch);
+  BENCH_SETUP ("aes256_set_decrypt_key", struct aes256_ctx,
+               aes256_set_decrypt_key);
+  BENCH_SETUP ("aes256_enc_set_key", struct aes256_enc_ctx,
+               aes256_enc_set_key);
+
+  aes128_set_decrypt_key (&ctx128, key);
+  aes128_enc_set_key (&ectx128, key);
+  aes256_set_decrypt_key (&ctx256, key);
+  aes256_enc_set_key (&ectx256, key);
+  memset (xkey, 0x5a, sizeof (xkey));
+  aes128_xts_set_key (&xctx128, xkey);
+  aes256_xts_set_key (&xctx256, xkey);
+
+  BENCH_RATE ("aes128_enc_ctr_crypt",
+              aes128_enc_ctr_crypt (&ectx128, iv, buffer, buffer,
+                                     sizeof (buffer)));
+  BENCH_RATE ("aes128_enc_cbc_encrypt",
+              aes128_enc_cbc_encrypt (&ectx128, iv, buffer, buffer,
+                                       sizeof (buffer)));
+  BENCH_RATE ("aes128_cbc_decrypt",
+              aes128_cbc_decrypt (&ctx128, iv, buffer, buffer,
+                                  sizeof (buffer)));
+  BENCH_RATE ("aes256_enc_ctr_crypt",
+              aes256_enc_ctr_crypt (&ectx256, iv, buffer, buffer,
+                                     sizeof (buffer)));
+  BENCH_RATE ("aes256_enc_cbc_encrypt",
+              aes256_enc_cbc_encrypt (&ectx256, iv, buffer, buffer,
+                                       sizeof (buffer)));
+  BENCH_RATE ("aes256_cbc_decrypt",
+              aes256_cbc_decrypt (&ctx256, iv, buffer, buffer,
+                                  sizeof (buffer)));
+  BENCH_RATE ("aes128_xts_encrypt_sectors",
+              aes128_xts_encrypt_sectors (&xctx128, sectors, buffer, buffer,
+                                          BENCH_SECTOR_SIZE,
+                                          sizeof (buffer)
+                                              / BENCH_SECTOR_SIZE));
+  BENCH_RATE ("aes128_xts_decrypt_sectors",
+              aes128_xts_decrypt_sectors (&xctx128, sectors, buffer, buffer,
+                                          BENCH_SECTOR_SIZE,
+                                          sizeof (buffer)
+                                              / BENCH_SECTOR_SIZE));
+  BENCH_RATE ("aes256_xts_encrypt_sectors",
+              aes256_xts_encrypt_sectors (&xctx256, sectors, buffer, buffer,
+                                          BENCH_SECTOR_SIZE,
+                                          sizeof (buffer)
+                                              / BENCH_SECTOR_SIZE));
+  BENCH_RATE ("aes256_xts_decrypt_sectors",
+              aes256_xts_decrypt_sectors (&xctx256, sectors, buffer, buffer,
+                                          BENCH_SECTOR_SIZE,
+                                          sizeof (buffer)
+                                              / BENCH_SECTOR_SIZE));
+
+  /*
+   * The T-table code directly, which is not the default backend. Build with
+   * --enable-small-aes-tables to compare the two table layouts.
+   */
+#if defined(AES_SMALL_TABLES)
+  printf ("%-28s %10s\n", "AES T-tables", "small");
+#else
+  printf ("%-28s %10s\n", "AES T-tables", "full");
+#endif
+  aes128_expand_key_table (ek, key);
+  aes128_invert_key_table (dk, ek);
+  BENCH_RATE ("aes128_encrypt_table",
+              table_blocks (aes128_encrypt_table, ek, 0));
+  BENCH_RATE ("aes128_encrypt_table, loaded",
+              table_blocks (aes128_encrypt_table, ek, 1));
+  BENCH_RATE ("aes128_decrypt_table",
+              table_blocks (aes128_decrypt_table, dk, 0));
+  BENCH_RATE ("aes128_decrypt_table, loaded",
+              table_blocks (aes128_decrypt_table, dk, 1));
+  BENCH_RATE ("aes_ctr_crypt_table",
+              aes_backend_table.ctr_crypt (ek, AES128_ROUNDS, iv, buffer,
+                                           buffer, sizeof (buffer)));
+  return 0;
+}
@@ -0,0 +1,784 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Differential test and benchmark of the accelerated backends. The program
+ * runs itself once for each set of CPU features the machine has, from the
+ * portable C code up to everything it supports, by setting FCRYPT_CPU for
+ * the child. Each child hashes and encrypts the same random cases, with
+ * random lengths, misaligned source and destination buffers and the input
+ * split across several calls, and prints a fingerprint of every result
+ * along with the throughput of each algorithm. The results of every feature
+ * set are compared against those of the portable code, so a single run both
+ * checks and measures the backends on a new CPU.
+ *
+ * Usage: bench-backends [--algo NAME] [--cases COUNT] [--seed SEED]
+ *                       [--time SECONDS]
+ *
+ * The exit status is 1 if any backend disagrees with the portable code. A
+ * mismatch is printed with the case that caused it, which the same seed
+ * reproduces.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include "bench.h"
+#include "chacha.h"
+#include "crc32.h"
+#include "fcrypt_cipher.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_hash.h"
+#include "fcrypt_instrument.h"
+#include "gcm.h"
+#include "md5.h"
+#include "poly1305.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "siphash.h"
+
+/* Largest message of a case, and the size used for measuring speed. */
+#define BENCH_MAX_LEN (256 * 1024)
+#define BENCH_SPEED_LEN (64 * 1024)
+
+/* Largest misalignment of the buffers, and most calls a case is split in. */
+#define BENCH_MAX_OFFSET 64
+#define BENCH_MAX_PIECES 16
+
+#define BENCH_MAX_TARGETS 64
+#define BENCH_MAX_TIERS 8
+
+struct bench_case
+{
+  size_t len;
+  size_t soff;
+  size_t doff;
+  size_t pieces;
+  size_t cut[BENCH_MAX_PIECES + 1]; /* Piece i is [cut[i], cut[i + 1]) */
+};
+
+struct bench_target;
+
+/* Runs a case on src and dest and returns a fingerprint of the result. */
+typedef uint64_t bench_run_func (const struct bench_target *,
+                                 const struct bench_case *, const uint8_t *,
+                                 uint8_t *);
+
+typedef void bench_multi_func (uint8_t *, const uint8_t *const *,
+                               const size_t *, size_t);
+
+struct bench_target
+{
+  char name[32];
+  const char *backend; /* NULL if the library does not report one */
+  bench_run_func *run;
+  size_t len_unit;     /* The length is a multiple of this */
+  size_t cut_unit;     /* And so is every piece but the last */
+  size_t passes;       /* Times the input is processed by run */
+  size_t speed_pieces; /* Messages for the batch functions */
+  const struct fcrypt_hash *hash;
+  const struct fcrypt_cipher *cipher;
+  bench_multi_func *multi;
+  size_t digest_size;
+  void *ctx;
+};
+
+/* A set of features to test, as a value of FCRYPT_CPU. */
+struct bench_tier
+{
+  const char *name;
+  const char *env;  /* NULL for the features of the machine */
+  uint32_t needs;   /* Skipped unless the CPU has all of these */
+};
+
+static const struct bench_tier bench_tiers[] = {
+  { "portable", "-all", 0 },
+#if defined(__x86_64__) || defined(__i386__)
+  { "sse2", "-all,+sse2", FCRYPT_CPU_SSE2 },
+  { "ssse3", "-all,+sse2,+ssse3", FCRYPT_CPU_SSE2 | FCRYPT_CPU_SSSE3 },
+  { "sse4", "-all,+sse2,+ssse3,+sse41,+sse42",
+    FCRYPT_CPU_SSE2 | FCRYPT_CPU_SSSE3 | FCRYPT_CPU_SSE41
+        | FCRYPT_CPU_SSE42 },
+  { "aesni", "-all,+sse2,+ssse3,+sse41,+sse42,+aesni,+pclmul,+sha",
+    FCRYPT_CPU_SSE2 | FCRYPT_CPU_SSSE3 | FCRYPT_CPU_SSE41 | FCRYPT_CPU_SSE42
+        | FCRYPT_CPU_AESNI | FCRYPT_CPU_PCLMUL },
+  /* Only differs from the native tier on machines with AVX-512. */
+  { "avx2", "-avx512f", FCRYPT_CPU_AVX2 | FCRYPT_CPU_AVX512F },
+#elif defined(__aarch64__)
+  { "neon", "-all,+arm_neon", FCRYPT_CPU_ARM_NEON },
+  { "armv8", "-all,+arm_neon,+arm_aes,+arm_pmull,+arm_sha1,+arm_sha2",
+    FCRYPT_CPU_ARM_NEON | FCRYPT_CPU_ARM_AES | FCRYPT_CPU_ARM_PMULL
+        | FCRYPT_CPU_ARM_SHA1 | FCRYPT_CPU_ARM_SHA2 },
+#endif
+  { "native", NULL, 0 },
+};
+
+#define BENCH_TIERS (sizeof (bench_tiers) / sizeof (bench_tiers[0]))
+
+static const char *only = NULL;
+static unsigned long cases = 100;
+static unsigned long seed = 1;
+static double min_time = 0.02;
+
+static struct bench_target targets[BENCH_MAX_TARGETS];
+static size_t target_count = 0;
+
+static uint8_t key[32];
+static uint8_t nonce[16];
+static uint64_t rng_state;
+
+/* SplitMix64, so every run draws the same cases from the same seed. */
+static uint64_t
+rng_next (void)
+{
+  uint64_t z;
+
+  z = (rng_state += UINT64_C (0x9e3779b97f4a7c15));
+  z = (z ^ (z >> 30)) * UINT64_C (0xbf58476d1ce4e5b9);
+  z = (z ^ (z >> 27)) * UINT64_C (0x94d049bb133111eb);
+  return z ^ (z >> 31);
+}
+
+static size_t
+rng_below (size_t n)
+{
+  return n == 0 ? 0 : (size_t)(rng_next () % n);
+}
+
+static void
+rng_fill (uint8_t *buf, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    buf[i] = (uint8_t)rng_next ();
+}
+
+/* FNV-1a, to print one number for each result. */
+static uint64_t
+fingerprint (uint64_t h, const uint8_t *buf, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    {
+      h ^= buf[i];
+      h *= UINT64_C (0x100000001b3);
+    }
+  return h;
+}
+
+#define FINGERPRINT_INIT UINT64_C (0xcbf29ce484222325)
+
+static uint64_t
+run_hash (const struct bench_target *t, const struct bench_case *c,
+          const uint8_t *src, uint8_t *dest)
+{
+  size_t i;
+
+  t->hash->init (t->ctx);
+  for (i = 0; i < c->pieces; ++i)
+    t->hash->update (t->ctx, src + c->cut[i], c->cut[i + 1] - c->cut[i]);
+  t->hash->final (dest, t->ctx);
+  return fingerprint (FINGERPRINT_INIT, dest, t->hash->digest_size);
+}
+
+/* ECB encryption, then CBC decryption and CTR of the same input. */
+static uint64_t
+run_cipher (const struct bench_target *t, const struct bench_case *c,
+            const uint8_t *src, uint8_t *dest)
+{
+  const struct fcrypt_cipher *cipher = t->cipher;
+  uint8_t iv[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+  uint64_t h = FINGERPRINT_INIT;
+  size_t i, n;
+
+  cipher->set_key (t->ctx, key);
+  for (i = 0; i < c->pieces; ++i)
+    {
+      n = c->cut[i + 1] - c->cut[i];
+      cipher->ecb_encrypt (t->ctx, src + c->cut[i], dest + c->cut[i], n);
+    }
+  h = fingerprint (h, dest, c->len);
+  if (cipher->cbc_decrypt != NULL)
+    {
+      memcpy (iv, nonce, cipher->block_size);
+      for (i = 0; i < c->pieces; ++i)
+        {
+          n = c->cut[i + 1] - c->cut[i];
+          cipher->cbc_decrypt (t->ctx, iv, src + c->cut[i], dest + c->cut[i],
+                               n);
+        }
+      h = fingerprint (h, dest, c->len);
+    }
+  /* Start the counter near a carry out of the low 32 bits. */
+  memcpy (iv, nonce, cipher->block_size);
+  memset (iv + cipher->block_size - 4, 0xff, 3);
+  for (i = 0; i < c->pieces; ++i)
+    {
+      n = c->cut[i + 1] - c->cut[i];
+      cipher->ctr_crypt (t->ctx, iv, src + c->cut[i], dest + c->cut[i], n);
+    }
+  return fingerprint (h, dest, c->len);
+}
+
+static uint64_t
+run_chacha (const struct bench_target *t, const struct bench_case *c,
+            const uint8_t *src, uint8_t *dest)
+{
+  struct chacha_ctx ctx;
+  size_t i;
+
+  (void)t;
+  chacha256_set_key (&ctx, key);
+  chacha_set_nonce (&ctx, nonce, 1);
+  for (i = 0; i < c->pieces; ++i)
+    chacha_encrypt_bytes (&ctx, src + c->cut[i], dest + c->cut[i],
+                          c->cut[i + 1] - c->cut[i]);
+  return fingerprint (FINGERPRINT_INIT, dest, c->len);
+}
+
+static uint64_t
+run_crc32 (const struct bench_target *t, const struct bench_case *c,
+           const uint8_t *src, uint8_t *dest)
+{
+  uint32_t crc = 0;
+  size_t i;
+
+  (void)t;
+  (void)dest;
+  for (i = 0; i < c->pieces; ++i)
+    crc = crc32_update (crc, src + c->cut[i], c->cut[i + 1] - c->cut[i]);
+  return crc;
+}
+
+static uint64_t
+run_crc32c (const struct bench_target *t, const struct bench_case *c,
+            const uint8_t *src, uint8_t *dest)
+{
+  uint32_t crc = 0;
+  size_t i;
+
+  (void)t;
+  (void)dest;
+  for (i = 0; i < c->pieces; ++i)
+    crc = crc32c_update (crc, src + c->cut[i], c->cut[i + 1] - c->cut[i]);
+  return crc;
+}
+
+static uint64_t
+run_poly1305 (const struct bench_target *t, const struct bench_case *c,
+              const uint8_t *src, uint8_t *dest)
+{
+  struct poly1305_ctx ctx;
+  size_t i;
+
+  (void)t;
+  poly1305_init (&ctx, key);
+  for (i = 0; i < c->pieces; ++i)
+    poly1305_update (&ctx, src + c->cut[i], c->cut[i + 1] - c->cut[i]);
+  poly1305_final (dest, &ctx);
+  return fingerprint (FINGERPRINT_INIT, dest, POLY1305_DIGEST_SIZE);
+}
+
+static uint64_t
+run_gcm (const struct bench_target *t, const struct bench_case *c,
+         const uint8_t *src, uint8_t *dest)
+{
+  struct aes128_gcm_ctx *ctx = t->ctx;
+  uint8_t tag[GCM_DIGEST_SIZE];
+  size_t i;
+
+  aes128_gcm_set_key (ctx, key);
+  aes128_gcm_set_iv (ctx, nonce, GCM_IV_SIZE);
+  aes128_gcm_update (ctx, src, c->len % 32);
+  for (i = 0; i < c->pieces; ++i)
+    aes128_gcm_encrypt (ctx, src + c->cut[i], dest + c->cut[i],
+                        c->cut[i + 1] - c->cut[i]);
+  aes128_gcm_digest (ctx, tag);
+  return fingerprint (fingerprint (FINGERPRINT_INIT, dest, c->len), tag,
+                      sizeof (tag));
+}
+
+/* The batch functions take each piece as a separate message. */
+static uint64_t
+run_multi (const struct bench_target *t, const struct bench_case *c,
+           const uint8_t *src, uint8_t *dest)
+{
+  const uint8_t *messages[BENCH_MAX_PIECES];
+  size_t lens[BENCH_MAX_PIECES];
+  size_t i;
+
+  for (i = 0; i < c->pieces; ++i)
+    {
+      messages[i] = src + c->cut[i];
+      lens[i] = c->cut[i + 1] - c->cut[i];
+    }
+  t->multi (dest, messages, lens, c->pieces);
+  return fingerprint (FINGERPRINT_INIT, dest, c->pieces * t->digest_size);
+}
+
+static uint64_t
+run_siphash_batch (const struct bench_target *t, const struct bench_case *c,
+                   const uint8_t *src, uint8_t *dest)
+{
+  const void *messages[BENCH_MAX_PIECES];
+  size_t lens[BENCH_MAX_PIECES];
+  uint64_t out[BENCH_MAX_PIECES];
+  size_t i;
+
+  (void)t;
+  (void)dest;
+  for (i = 0; i < c->pieces; ++i)
+    {
+      messages[i] = src + c->cut[i];
+      lens[i] = c->cut[i + 1] - c->cut[i];
+    }
+  siphash24_batch (key, messages, lens, out, c->pieces);
+  return fingerprint (FINGERPRINT_INIT, (const uint8_t *)out,
+                      c->pieces * sizeof (out[0]));
+}
+
+/* Returns storage for a context with the given alignment, or exits. */
+static void *
+alloc_ctx (size_t size, size_t align)
+{
+  uint8_t *p;
+
+  if (align < 16)
+    align = 16;
+  p = malloc (size + align);
+  if (p == NULL)
+    {
+      fprintf (stderr, "bench-backends: out of memory\n");
+      exit (1);
+    }
+  return p + (align - (uintptr_t)p % align) % align;
+}
+
+static struct bench_target *
+add_target (const char *name, bench_run_func *run, size_t len_unit,
+            size_t cut_unit)
+{
+  struct bench_target *t = &targets[target_count++];
+
+  snprintf (t->name, sizeof (t->name), "%s", name);
+  t->run = run;
+  t->len_unit = len_unit;
+  t->cut_unit = cut_unit;
+  t->passes = 1;
+  t->speed_pieces = 1;
+  return t;
+}
+
+static void
+add_multi (const char *name, bench_multi_func *multi, size_t digest_size)
+{
+  struct bench_target *t = add_target (name, run_multi, 1, 1);
+
+  t->multi = multi;
+  t->digest_size = digest_size;
+  t->speed_pieces = BENCH_MAX_PIECES;
+}
+
+static void
+make_targets (void)
+{
+  const struct fcrypt_hash *hash;
+  const struct fcrypt_cipher *cipher;
+  struct fcrypt_counters counters;
+  struct bench_target *t;
+  size_t i;
+
+  for (i = 0; (hash = fcrypt_hash_get (i)) != NULL; ++i)
+    {
+      t = add_target (hash->name, run_hash, 1, 1);
+      t->hash = hash;
+      t->ctx = alloc_ctx (hash->ctx_size, hash->ctx_align);
+      if (fcrypt_hash_counters (hash, &counters) == 0)
+        t->backend = counters.backend;
+    }
+  for (i = 0; (cipher = fcrypt_cipher_get (i)) != NULL; ++i)
+    {
+      t = add_target (cipher->name, run_cipher, cipher->block_size,
+                      cipher->block_size);
+      t->cipher = cipher;
+      t->ctx = alloc_ctx (cipher->ctx_size, cipher->ctx_align);
+      t->passes = cipher->cbc_decrypt != NULL ? 3 : 2;
+      if (fcrypt_cipher_counters (cipher, &counters) == 0)
+        t->backend = counters.backend;
+    }
+  add_target ("chacha20", run_chacha, 1, CHACHA_BLOCK_SIZE);
+  add_target ("crc32", run_crc32, 1, 1);
+  add_target ("crc32c", run_crc32c, 1, 1);
+  add_target ("poly1305", run_poly1305, 1, 1);
+  t = add_target ("aes128-gcm", run_gcm, 1, GCM_BLOCK_SIZE);
+  t->ctx = alloc_ctx (sizeof (struct aes128_gcm_ctx), 16);
+  add_multi ("md5-multi", md5_multi, MD5_DIGEST_SIZE);
+  add_multi ("sha1-multi", sha1_multi, SHA1_DIGEST_SIZE);
+  add_multi ("sha256-multi", sha256_multi, SHA256_DIGEST_SIZE);
+  t = add_target ("siphash24-batch", run_siphash_batch, 1, 1);
+  t->speed_pieces = BENCH_MAX_PIECES;
+}
+
+/* Splits len into pieces that are multiples of unit except for the last. */
+static void
+make_cuts (struct bench_case *c, size_t unit)
+{
+  size_t i, j, cut;
+
+  c->cut[0] = 0;
+  for (i = 1; i < c->pieces; ++i)
+    {
+      cut = rng_below (c->len + 1);
+      cut -= cut % unit;
+      for (j = i; j > 1 && c->cut[j - 1] > cut; --j)
+        c->cut[j] = c->cut[j - 1];
+      c->cut[j] = cut;
+    }
+  c->cut[c->pieces] = c->len;
+}
+
+/* Mostly short messages, where the tails are handled, and a few long ones. */
+static void
+make_case (struct bench_case *c, const struct bench_target *t)
+{
+  size_t r = rng_below (8);
+
+  if (r < 4)
+    c->len = rng_below (257);
+  else if (r < 7)
+    c->len = rng_below (4097);
+  else
+    c->len = rng_below (BENCH_MAX_LEN + 1);
+  c->len -= c->len % t->len_unit;
+  c->soff = rng_below (BENCH_MAX_OFFSET);
+  c->doff = rng_below (BENCH_MAX_OFFSET);
+  c->pieces = 1 + rng_below (BENCH_MAX_PIECES);
+  make_cuts (c, t->cut_unit);
+}
+
+/* Processes BENCH_SPEED_LEN bytes until min_time passes and returns B/s. */
+static double
+measure (const struct bench_target *t, const uint8_t *src, uint8_t *dest)
+{
+  struct bench_case c;
+  uint64_t calls, i;
+  double start, seconds;
+  size_t piece;
+
+  c.len = BENCH_SPEED_LEN;
+  c.soff = c.doff = 0;
+  c.pieces = t->speed_pieces;
+  piece = c.len / c.pieces;
+  for (i = 0; i <= c.pieces; ++i)
+    c.cut[i] = (size_t)i * piece;
+  for (calls = 1;; calls *= 2)
+    {
+      start = bench_seconds ();
+      for (i = 0; i < calls; ++i)
+        t->run (t, &c, src, dest);
+      seconds = bench_seconds () - start;
+      if (seconds >= min_time)
+        break;
+    }
+  return (double)calls * c.len * t->passes / seconds;
+}
+
+/*
+ * Runs every target with the backends picked for FCRYPT_CPU and prints a
+ * line for each case, "C name index len soff doff pieces fingerprint", and
+ * one for the speed, "T name backend bytes-per-second".
+ */
+static int
+worker (void)
+{
+  struct bench_case c;
+  uint8_t *src, *dest;
+  unsigned long n;
+  size_t i;
+
+  src = malloc (BENCH_MAX_LEN + BENCH_MAX_OFFSET);
+  dest = malloc (BENCH_MAX_LEN + BENCH_MAX_OFFSET + 64);
+  if (src == NULL || dest == NULL)
+    {
+      fprintf (stderr, "bench-backends: out of memory\n");
+      return 1;
+    }
+  rng_state = seed;
+  rng_fill (key, sizeof (key));
+  rng_fill (nonce, sizeof (nonce));
+  rng_fill (src, BENCH_MAX_LEN + BENCH_MAX_OFFSET);
+  make_targets ();
+
+  for (i = 0; i < target_count; ++i)
+    {
+      const struct bench_target *t = &targets[i];
+
+      if (only != NULL && strcmp (only, t->name) != 0)
+        continue;
+      /* Each target draws its own cases, so --algo does not change them. */
+      rng_state = seed ^ (UINT64_C (0x9e3779b97f4a7c15) * (i + 1));
+      for (n = 0; n < cases; ++n)
+        {
+          make_case (&c, t);
+          printf ("C %s %lu %zu %zu %zu %zu %016llx\n", t->name, n, c.len,
+                  c.soff, c.doff, c.pieces,
+                  (unsigned long long)t->run (t, &c, src + c.soff,
+                                              dest + c.doff));
+        }
+      printf ("T %s %s %.0f\n", t->name,
+              t->backend != NULL ? t->backend : "-", measure (t, src, dest));
+      fflush (stdout);
+    }
+  free (src);
+  free (dest);
+  return 0;
+}
+
+#if defined(HAVE_UNISTD_H)
+
+/* The results of one tier, kept for the table at the end. */
+struct bench_row
+{
+  char name[32];
+  char backend[32];
+  double rate[BENCH_TIERS];
+};
+
+static struct bench_row rows[BENCH_MAX_TARGETS];
+static size_t row_count = 0;
+
+static char **reference = NULL;
+static size_t reference_count = 0;
+
+static struct bench_row *
+find_row (const char *name)
+{
+  size_t i;
+
+  for (i = 0; i < row_count; ++i)
+    if (strcmp (rows[i].name, name) == 0)
+      return &rows[i];
+  if (row_count == BENCH_MAX_TARGETS)
+    return NULL;
+  memset (&rows[row_count], 0, sizeof (rows[0]));
+  snprintf (rows[row_count].name, sizeof (rows[0].name), "%s", name);
+  return &rows[row_count++];
+}
+
+/*
+ * Runs the program again with FCRYPT_CPU set for the tier and compares its
+ * cases with those of the first tier, which is the portable code. Returns
+ * the number of mismatches, or -1 if the child could not be run.
+ */
+static long
+run_tier (const char *progname, size_t tier, const char *saved)
+{
+  const struct bench_tier *b = &bench_tiers[tier];
+  char command[4096], line[256], name[32], backend[32];
+  struct bench_row *row;
+  unsigned long mismatches = 0;
+  size_t index = 0;
+  double rate;
+  FILE *child;
+  char **grown;
+
+  if (b->env != NULL)
+    setenv ("FCRYPT_CPU", b->env, 1);
+  else if (saved != NULL)
+    setenv ("FCRYPT_CPU", saved, 1);
+  else
+    unsetenv ("FCRYPT_CPU");
+  snprintf (command, sizeof (command),
+            "'%s' --worker --seed %lu --cases %lu --time %g%s%s", progname,
+            seed, cases, min_time, only != NULL ? " --algo " : "",
+            only != NULL ? only : "");
+  child = popen (command, "r");
+  if (child == NULL)
+    return -1;
+
+  while (fgets (line, sizeof (line), child) != NULL)
+    {
+      if (line[0] == 'T'
+          && sscanf (line, "T %31s %31s %lf", name, backend, &rate) == 3)
+        {
+          row = find_row (name);
+          if (row != NULL)
+            {
+              row->rate[tier] = rate;
+              snprintf (row->backend, sizeof (row->backend), "%s", backend);
+            }
+        }
+      else if (line[0] == 'C' && tier == 0)
+        {
+          grown = realloc (reference,
+                           (reference_count + 1) * sizeof (*reference));
+          if (grown == NULL)
+            {
+              fprintf (stderr, "%s: out of memory\n", progname);
+              exit (1);
+            }
+          reference = grown;
+          reference[reference_count] = strdup (line);
+          if (reference[reference_count++] == NULL)
+            {
+              fprintf (stderr, "%s: out of memory\n", progname);
+              exit (1);
+            }
+        }
+      else if (line[0] == 'C')
+        {
+          if (index >= reference_count
+              || strcmp (line, reference[index]) != 0)
+            {
+              if (mismatches++ < 10)
+                printf ("MISMATCH %s\n  expected %s  got      %s", b->name,
+                        index < reference_count ? reference[index] : "-\n",
+                        line);
+            }
+          ++index;
+        }
+    }
+  if (pclose (child) != 0)
+    {
+      printf ("MISMATCH %s: worker failed\n", b->name);
+      ++mismatches;
+    }
+  if (tier != 0 && index != reference_count)
+    {
+      printf ("MISMATCH %s: %zu cases, expected %zu\n", b->name, index,
+              reference_count);
+      ++mismatches;
+    }
+  return (long)mismatches;
+}
+
+static int
+driver (const char *progname)
+{
+  const char *saved = getenv ("FCRYPT_CPU");
+  uint32_t features = fcrypt_cpu_features ();
+  int ran[BENCH_TIERS];
+  unsigned long total = 0;
+  long mismatches;
+  size_t i, j;
+
+  if (saved != NULL)
+    saved = strdup (saved);
+  printf ("# CPU features 0x%08lx, seed %lu, %lu cases for each algorithm\n",
+          (unsigned long)features, seed, cases);
+  for (i = 0; i < BENCH_TIERS; ++i)
+    {
+      ran[i] = (bench_tiers[i].needs & ~features) == 0;
+      if (!ran[i])
+        continue;
+      mismatches = run_tier (progname, i, saved);
+      if (mismatches < 0)
+        {
+          fprintf (stderr, "%s: can not run %s\n", progname, progname);
+          return 1;
+        }
+      printf ("# %-6s %-8s FCRYPT_CPU=%s\n",
+              mismatches == 0 ? "ok" : "FAILED", bench_tiers[i].name,
+              bench_tiers[i].env != NULL ? bench_tiers[i].env : "");
+      total += (unsigned long)mismatches;
+    }
+
+  printf ("%-16s", "GB/s");
+  for (i = 0; i < BENCH_TIERS; ++i)
+    if (ran[i])
+      printf (" %8s", bench_tiers[i].name);
+  printf ("  backend\n");
+  for (j = 0; j < row_count; ++j)
+    {
+      printf ("%-16s", rows[j].name);
+      for (i = 0; i < BENCH_TIERS; ++i)
+        if (ran[i])
+          printf (" %8.3f", rows[j].rate[i] / 1e9);
+      printf ("  %s\n", rows[j].backend);
+    }
+
+  if (total != 0)
+    {
+      printf ("%lu mismatches\n", total);
+      return 1;
+    }
+  printf ("all backends match\n");
+  return 0;
+}
+
+#endif
+
+static void
+usage (const char *progname)
+{
+  fprintf (stderr,
+           "usage: %s [--algo NAME] [--cases COUNT] [--seed SEED]\n"
+           "       [--time SECONDS]\n",
+           progname);
+  exit (2);
+}
+
+int
+main (int argc, char **argv)
+{
+  int is_worker = 0;
+  int i;
+
+  for (i = 1; i < argc; ++i)
+    {
+      if (strcmp (argv[i], "--worker") == 0)
+        is_worker = 1;
+      else if (strcmp (argv[i], "--algo") == 0 && i + 1 < argc)
+        only = argv[++i];
+      else if (strcmp (argv[i], "--cases") == 0 && i + 1 < argc)
+        cases = strtoul (argv[++i], NULL, 0);
+      else if (strcmp (argv[i], "--seed") == 0 && i + 1 < argc)
+        seed = strtoul (argv[++i], NULL, 0);
+      else if (strcmp (argv[i], "--time") == 0 && i + 1 < argc)
+        min_time = strtod (argv[++i], NULL);
+      else
+        usage (argv[0]);
+    }
+
+  if (is_worker)
+    return worker ();
+#if defined(HAVE_UNISTD_H)
+  return driver (argv[0]);
+#else
+  fprintf (stderr, "%s: can not run the backends without POSIX\n", argv[0]);
+  return 1;
+#endif
+}
@@ -0,0 +1,467 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Throughput of every hash and block cipher in the library, through the
+ * fcrypt_hash and fcrypt_cipher tables, at message sizes from 16 bytes to
+ * 16 MiB. Also measures key setup and the multi-buffer hashes against
+ * hashing the same messages one at a time. Results are printed as a table,
+ * or as CSV or JSON for comparing runs.
+ *
+ * Usage: bench-fcrypt [--csv | --json] [--algo NAME] [--max-size BYTES]
+ *                     [--time SECONDS] [--backend LIST]
+ *
+ * --backend runs with FCRYPT_CPU set to LIST, e.g. "-all" for the portable
+ * code or "-avx512f" to measure the AVX2 code on an AVX-512 machine.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include "bench.h"
+#include "fcrypt_cipher.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_hash.h"
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "sha3.h"
+
+#define BENCH_MIN_SIZE 16
+#define BENCH_MAX_SIZE (16 * 1024 * 1024)
+
+/* Number of key setups averaged for each measurement. */
+#define BENCH_KEYS 10000
+
+/* Number of messages given to each multi-buffer call. */
+#define BENCH_MESSAGES 16
+
+enum bench_format
+{
+  BENCH_TEXT,
+  BENCH_CSV,
+  BENCH_JSON
+};
+
+static enum bench_format format = BENCH_TEXT;
+static const char *only = NULL;
+static size_t max_size = BENCH_MAX_SIZE;
+static double min_time = 0.05;
+static unsigned long records = 0;
+
+static uint8_t *buffer;
+static uint8_t digests[BENCH_MESSAGES * FCRYPT_HASH_MAX_DIGEST_SIZE];
+
+/* Something to measure: len is the message size, or the key size. */
+typedef void bench_func (const void *, size_t);
+
+struct bench_result
+{
+  uint64_t ticks;
+  double seconds;
+  uint64_t calls;
+};
+
+/*
+ * Calls func in batches, doubling the batch until one takes at least
+ * min_time, so that reading the clock does not count for small sizes.
+ */
+static void
+bench_run (bench_func *func, const void *arg, size_t len,
+           struct bench_result *result)
+{
+  uint64_t calls, i, start_ticks;
+  double start;
+
+  for (calls = 1;; calls *= 2)
+    {
+      start = bench_seconds ();
+      start_ticks = bench_ticks ();
+      for (i = 0; i < calls; ++i)
+        func (arg, len);
+      result->ticks = bench_ticks () - start_ticks;
+      result->seconds = bench_seconds () - start;
+      result->calls = calls;
+      if (result->seconds >= min_time)
+        break;
+    }
+}
+
+static void
+report_header (void)
+{
+  switch (format)
+    {
+    case BENCH_TEXT:
+      printf ("# CPU features 0x%08lx, FCRYPT_CPU=%s\n",
+              (unsigned long)fcrypt_cpu_features (),
+              getenv ("FCRYPT_CPU") != NULL ? getenv ("FCRYPT_CPU") : "");
+      printf ("%-12s %-10s %10s %14s %10s\n", "algorithm", "operation",
+              "bytes", BENCH_TICK_UNIT "/byte", "GB/s");
+      break;
+    case BENCH_CSV:
+      printf ("algorithm,operation,bytes,calls,%s,seconds,%s_per_byte,"
+              "gb_per_s\n",
+              BENCH_TICK_UNIT, BENCH_TICK_UNIT);
+      break;
+    case BENCH_JSON:
+      printf ("{\n  \"cpu_features\": %lu,\n  \"tick_unit\": \"%s\",\n"
+              "  \"results\": [",
+              (unsigned long)fcrypt_cpu_features (), BENCH_TICK_UNIT);
+      break;
+    }
+}
+
+static void
+report_footer (void)
+{
+  if (format == BENCH_JSON)
+    printf ("\n  ]\n}\n");
+}
+
+/*
+ * Prints one measurement of calls operations on bytes bytes each. Key setup
+ * is reported per key rather than per byte.
+ */
+static void
+report (const char *algorithm, const char *operation, size_t bytes,
+        const struct bench_result *result)
+{
+  double total, per_byte, rate;
+
+  total = (double)result->calls * (double)bytes;
+  per_byte = (double)result->ticks / total;
+  rate = total / result->seconds / 1e9;
+
+  switch (format)
+    {
+    case BENCH_TEXT:
+      if (strcmp (operation, "setup") == 0)
+        printf ("%-12s %-10s %10zu %10.1f/key\n", algorithm, operation,
+                bytes, (double)result->ticks / (double)result->calls);
+      else
+        printf ("%-12s %-10s %10zu %14.2f %10.3f\n", algorithm, operation,
+                bytes, per_byte, rate);
+      break;
+    case BENCH_CSV:
+      printf ("%s,%s,%zu,%llu,%llu,%.6f,%.4f,%.4f\n", algorithm, operation,
+              bytes, (unsigned long long)result->calls,
+              (unsigned long long)result->ticks, result->seconds, per_byte,
+              rate);
+      break;
+    case BENCH_JSON:
+      printf ("%s\n    { \"algorithm\": \"%s\", \"operation\": \"%s\", "
+              "\"bytes\": %zu, \"calls\": %llu, \"ticks\": %llu, "
+              "\"seconds\": %.6f, \"ticks_per_byte\": %.4f, "
+              "\"gb_per_s\": %.4f }",
+              records == 0 ? "" : ",", algorithm, operation, bytes,
+              (unsigned long long)result->calls,
+              (unsigned long long)result->ticks, result->seconds, per_byte,
+              rate);
+      break;
+    }
+  ++records;
+  fflush (stdout);
+}
+
+static void
+bench_hash_digest (const void *arg, size_t len)
+{
+  const struct fcrypt_hash *hash = arg;
+
+  hash->digest (digests, buffer, len);
+}
+
+static void
+bench_hashes (void)
+{
+  const struct fcrypt_hash *hash;
+  struct bench_result result;
+  size_t i, len;
+
+  for (i = 0; (hash = fcrypt_hash_get (i)) != NULL; ++i)
+    {
+      if (only != NULL && strcmp (only, hash->name) != 0)
+        continue;
+      for (len = BENCH_MIN_SIZE; len <= max_size; len *= 4)
+        {
+          bench_run (bench_hash_digest, hash, len, &result);
+          report (hash->name, "digest", len, &result);
+        }
+    }
+}
+
+/* Context large and aligned enough for any cipher. */
+static union
+{
+  uint64_t align;
+  uint8_t bytes[8192];
+} cipher_ctx;
+
+static uint8_t cipher_iv[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+
+static void
+bench_cipher_setup (const void *arg, size_t len)
+{
+  const struct fcrypt_cipher *cipher = arg;
+  size_t i;
+
+  (void)len;
+  for (i = 0; i < BENCH_KEYS; ++i)
+    {
+      buffer[0] = (uint8_t)i;
+      cipher->set_key (&cipher_ctx, buffer);
+    }
+}
+
+static void
+bench_cipher_ctr (const void *arg, size_t len)
+{
+  const struct fcrypt_cipher *cipher = arg;
+
+  cipher->ctr_crypt (&cipher_ctx, cipher_iv, buffer, buffer, len);
+}
+
+static void
+bench_cipher_ecb (const void *arg, size_t len)
+{
+  const struct fcrypt_cipher *cipher = arg;
+
+  cipher->ecb_encrypt (&cipher_ctx, buffer, buffer, len);
+}
+
+static void
+bench_cipher_cbc_decrypt (const void *arg, size_t len)
+{
+  const struct fcrypt_cipher *cipher = arg;
+
+  cipher->cbc_decrypt (&cipher_ctx, cipher_iv, buffer, buffer, len);
+}
+
+static void
+bench_ciphers (void)
+{
+  const struct fcrypt_cipher *cipher;
+  struct bench_result result;
+  size_t i, len;
+
+  for (i = 0; (cipher = fcrypt_cipher_get (i)) != NULL; ++i)
+    {
+      if (only != NULL && strcmp (only, cipher->name) != 0)
+        continue;
+      if (cipher->ctx_size > sizeof (cipher_ctx))
+        continue;
+
+      bench_run (bench_cipher_setup, cipher, cipher->key_size, &result);
+      result.calls *= BENCH_KEYS;
+      report (cipher->name, "setup", cipher->key_size, &result);
+
+      cipher->set_key (&cipher_ctx, buffer);
+      for (len = BENCH_MIN_SIZE; len <= max_size; len *= 4)
+        {
+          bench_run (bench_cipher_ctr, cipher, len, &result);
+          report (cipher->name, "ctr", len, &result);
+        }
+      for (len = BENCH_MIN_SIZE; len <= max_size; len *= 4)
+        {
+          bench_run (bench_cipher_ecb, cipher, len, &result);
+          report (cipher->name, "ecb", len, &result);
+        }
+      if (cipher->cbc_decrypt == NULL)
+        continue;
+      for (len = BENCH_MIN_SIZE; len <= max_size; len *= 4)
+        {
+          bench_run (bench_cipher_cbc_decrypt, cipher, len, &result);
+          report (cipher->name, "cbc-dec", len, &result);
+        }
+    }
+}
+
+/*
+ * BENCH_MESSAGES messages of the same length, hashed either with one call
+ * of the multi-buffer function or one message at a time.
+ */
+struct bench_multi
+{
+  const char *name;
+  void (*single) (uint8_t *, const void *, size_t);
+  void (*multi) (uint8_t *, const uint8_t *const *, const size_t *, size_t);
+  size_t digest_size;
+};
+
+static const uint8_t *messages[BENCH_MESSAGES];
+static size_t lengths[BENCH_MESSAGES];
+
+static void
+bench_multi_serial (const void *arg, size_t len)
+{
+  const struct bench_multi *m = arg;
+  size_t i;
+
+  for (i = 0; i < BENCH_MESSAGES; ++i)
+    m->single (digests + i * m->digest_size, messages[i], len);
+}
+
+static void
+bench_multi_parallel (const void *arg, size_t len)
+{
+  const struct bench_multi *m = arg;
+
+  (void)len;
+  m->multi (digests, messages, lengths, BENCH_MESSAGES);
+}
+
+static void
+sha3_256_multi (uint8_t *digest, const uint8_t *const *inputs,
+                const size_t *inputlens, size_t count)
+{
+  uint8_t *outputs[4];
+  size_t i, j;
+
+  /* The lengths are all equal here. */
+  for (i = 0; i + 4 <= count; i += 4)
+    {
+      for (j = 0; j < 4; ++j)
+        outputs[j] = digest + (i + j) * SHA3_256_DIGEST_SIZE;
+      sha3_256_x4 (outputs, inputs + i, inputlens[i]);
+    }
+}
+
+static const struct bench_multi multis[] = {
+  { "md5", md5, md5_multi, MD5_DIGEST_SIZE },
+  { "sha1", sha1, sha1_multi, SHA1_DIGEST_SIZE },
+  { "sha256", sha256, sha256_multi, SHA256_DIGEST_SIZE },
+  { "sha3-256", sha3_256, sha3_256_multi, SHA3_256_DIGEST_SIZE },
+};
+
+static void
+bench_multis (void)
+{
+  struct bench_result result;
+  size_t i, j, len;
+
+  for (i = 0; i < sizeof (multis) / sizeof (multis[0]); ++i)
+    {
+      if (only != NULL && strcmp (only, multis[i].name) != 0)
+        continue;
+      for (len = BENCH_MIN_SIZE; len * BENCH_MESSAGES <= max_size; len *= 4)
+        {
+          for (j = 0; j < BENCH_MESSAGES; ++j)
+            {
+              messages[j] = buffer + j * len;
+              lengths[j] = len;
+            }
+          /* Reported per message, so that the rates compare directly. */
+          bench_run (bench_multi_serial, &multis[i], len, &result);
+          result.calls *= BENCH_MESSAGES;
+          report (multis[i].name, "serial", len, &result);
+          bench_run (bench_multi_parallel, &multis[i], len, &result);
+          result.calls *= BENCH_MESSAGES;
+          report (multis[i].name, "multi", len, &result);
+        }
+    }
+}
+
+static void
+usage (const char *progname)
+{
+  fprintf (stderr,
+           "usage: %s [--csv | --json] [--algo NAME] [--max-size BYTES]\n"
+           "       [--time SECONDS] [--backend LIST]\n",
+           progname);
+  exit (2);
+}
+
+int
+main (int argc, char **argv)
+{
+  const char *backend = NULL;
+  const char *current;
+  int i;
+
+  for (i = 1; i < argc; ++i)
+    {
+      if (strcmp (argv[i], "--csv") == 0)
+        format = BENCH_CSV;
+      else if (strcmp (argv[i], "--json") == 0)
+        format = BENCH_JSON;
+      else if (strcmp (argv[i], "--algo") == 0 && i + 1 < argc)
+        only = argv[++i];
+      else if (strcmp (argv[i], "--max-size") == 0 && i + 1 < argc)
+        max_size = (size_t)strtoul (argv[++i], NULL, 0);
+      else if (strcmp (argv[i], "--time") == 0 && i + 1 < argc)
+        min_time = strtod (argv[++i], NULL);
+      else if (strcmp (argv[i], "--backend") == 0 && i + 1 < argc)
+        backend = argv[++i];
+      else
+        usage (argv[0]);
+    }
+  if (max_size > BENCH_MAX_SIZE)
+    max_size = BENCH_MAX_SIZE;
+
+  /*
+   * The backends are chosen when the library is loaded, so run the program
+   * again with the new environment.
+   */
+  if (backend != NULL)
+    {
+      current = getenv ("FCRYPT_CPU");
+      if (current == NULL || strcmp (current, backend) != 0)
+        {
+#if defined(HAVE_UNISTD_H)
+          if (setenv ("FCRYPT_CPU", backend, 1) == 0)
+            execvp (argv[0], argv);
+#endif
+          fprintf (stderr, "%s: can not select backend %s\n", argv[0],
+                   backend);
+          return 1;
+        }
+    }
+
+  buffer = calloc (1, BENCH_MAX_SIZE);
+  if (buffer == NULL)
+    {
+      fprintf (stderr, "%s: out of memory\n", argv[0]);
+      return 1;
+    }
+
+  report_header ();
+  bench_hashes ();
+  bench_ciphers ();
+  bench_multis ();
+  report_footer ();
+
+  free (buffer);
+  return 0;
+}
@@ -0,0 +1,126 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siphash.h"
+
+/* Number of hashes averaged for each measurement. */
+#define BENCH_HASHES 1000000
+
+/* Number of messages in each batch. */
+#define BENCH_BATCH 1000
+
+static uint8_t buffer[64];
+static uint8_t messages[BENCH_BATCH][64];
+
+/* Keeps the results live so the loops are not optimized away. */
+static volatile uint64_t sink;
+
+static void
+report_hash (const char *name, size_t len, uint64_t ticks)
+{
+  printf ("%-24s %4zu bytes %10.1f %s/hash\n", name, len,
+          (double)ticks / BENCH_HASHES, BENCH_TICK_UNIT);
+}
+
+#define BENCH_HASH(name, len, expr)                                           \
+  do                                                                          \
+    {                                                                         \
+      uint64_t start, acc;                                                    \
+      size_t i;                                                               \
+                                                                              \
+      acc = 0;                                                                \
+      start = bench_ticks ();                                                 \
+      for (i = 0; i < BENCH_HASHES; ++i)                                      \
+        {                                                                     \
+          buffer[0] = (uint8_t)i;                                             \
+          acc += (expr);                                                      \
+        }                                                                     \
+      report_hash (name, len, bench_ticks () - start);                        \
+      sink = acc;                                                             \
+    }                                                                         \
+  while (0)
+
+static uint64_t
+siphash24_streaming (const uint8_t *key, const uint8_t *input, size_t len)
+{
+  struct siphash_ctx ctx;
+  uint8_t digest[SIPHASH_MIN_DIGEST_SIZE];
+  uint64_t x;
+  size_t i;
+
+  siphash_init (&ctx, SIPHASH_MIN_DIGEST_SIZE, key, 2, 4);
+  siphash_update (&ctx, input, len);
+  siphash_final (digest, &ctx);
+  x = 0;
+  for (i = sizeof (digest); i-- > 0;)
+    x = (x << 8) | digest[i];
+  return x;
+}
+
+int
+main (void)
+{
+  static const size_t lengths[] = { 8, 16, 32, 64 };
+  static const void *inputs[BENCH_BATCH];
+  static size_t lens[BENCH_BATCH];
+  static uint64_t out[BENCH_BATCH];
+  uint8_t key[SIPHASH_KEY_SIZE];
+  uint64_t start;
+  size_t i, j, len;
+
+  memset (key, 0x5a, sizeof (key));
+  for (j = 0; j < BENCH_BATCH; ++j)
+    inputs[j] = messages[j];
+  for (i = 0; i < sizeof (lengths) / sizeof (lengths[0]); ++i)
+    {
+      len = lengths[i];
+      BENCH_HASH ("siphash_init/final", len,
+                  siphash24_streaming (key, buffer, len));
+      BENCH_HASH ("siphash24", len, siphash24 (key, buffer, len));
+      BENCH_HASH ("siphash13", len, siphash13 (key, buffer, len));
+      BENCH_HASH ("halfsiphash24", len, halfsiphash24 (key, buffer, len));
+
+      for (j = 0; j < BENCH_BATCH; ++j)
+        lens[j] = len;
+      start = bench_ticks ();
+      for (j = 0; j < BENCH_HASHES / BENCH_BATCH; ++j)
+        {
+          messages[0][0] = (uint8_t)j;
+          siphash24_batch (key, inputs, lens, out, BENCH_BATCH);
+        }
+      report_hash ("siphash24_batch", len, bench_ticks () - start);
+      sink = out[BENCH_BATCH - 1];
+    }
+  return 0;
+}
@@ -0,0 +1,528 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * BLAKE2b with each row of the 4x4 state in one AVX2 register, so the four
+ * column steps of a round run as a single vector G. The diagonal steps rotate
+ * the lanes of the last three rows into place and back afterwards. Rotations
+ * by 32, 24 and 16 bits are byte shuffles and the rotation by 63 is an add
+ * combined with a shift.
+ *
+ * Each 16-byte piece of the message block is broadcast to both halves of a
+ * register once per block. The words of a message vector are then gathered
+ * with constant in-lane unpacks, alignr and blends as in the reference AVX2
+ * code, and the rounds are unrolled so none of this indexes blake2b_sigma.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake2b-internal.h"
+#include "blake2b.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_ROTR32(x) _mm256_shuffle_epi32 ((x), _MM_SHUFFLE (2, 3, 0, 1))
+#define AVX2_ROTR24(x) _mm256_shuffle_epi8 ((x), rot24)
+#define AVX2_ROTR16(x) _mm256_shuffle_epi8 ((x), rot16)
+#define AVX2_ROTR63(x)                                                        \
+  _mm256_xor_si256 (_mm256_srli_epi64 ((x), 63), _mm256_add_epi64 ((x), (x)))
+
+/*
+ * AVX2_LOAD_MSG_r_k sets b to the message words added by the first (k = 1,
+ * 3) or second (k = 2, 4) half of the column (k = 1, 2) or diagonal (k = 3,
+ * 4) steps of round r. Both halves of register mi hold words 2i and 2i + 1
+ * of the block, so t0 and t1 get the low and high half of b in each of their
+ * halves.
+ */
+#define AVX2_LOAD_MSG_0_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m0, m1);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m2, m3);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_0_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m0, m1);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m2, m3);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_0_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m7, m4);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m5, m6);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_0_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m7, m4);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m5, m6);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_1_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m7, m2);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m4, m6);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_1_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m5, m4);                                  \
+      (t1) = _mm256_alignr_epi8 (m3, m7, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_1_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m2, m0);                                  \
+      (t1) = _mm256_blend_epi32 (m0, m5, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_1_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m6, m1, 8);                                  \
+      (t1) = _mm256_blend_epi32 (m1, m3, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_2_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m6, m5, 8);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m2, m7);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_2_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m4, m0);                                  \
+      (t1) = _mm256_blend_epi32 (m1, m6, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_2_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m5, m4, 8);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m1, m3);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_2_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m2, m7);                                  \
+      (t1) = _mm256_blend_epi32 (m3, m0, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_3_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m3, m1);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m6, m5);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_3_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m4, m0);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m6, m7);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_3_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m1, m7, 8);                                  \
+      (t1) = _mm256_shuffle_epi32 (m2, _MM_SHUFFLE (1, 0, 3, 2));             \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_3_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m4, m3);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m5, m0);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_4_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m4, m2);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m1, m5);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_4_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_blend_epi32 (m0, m3, 0xCC);                               \
+      (t1) = _mm256_blend_epi32 (m2, m7, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_4_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m7, m1, 8);                                  \
+      (t1) = _mm256_alignr_epi8 (m3, m5, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_4_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m6, m0);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m6, m4);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_5_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m1, m3);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m0, m4);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_5_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m6, m5);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m5, m1);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_5_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m2, m0, 8);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m3, m7);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_5_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m4, m6);                                  \
+      (t1) = _mm256_alignr_epi8 (m7, m2, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_6_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_blend_epi32 (m6, m0, 0xCC);                               \
+      (t1) = _mm256_unpacklo_epi64 (m7, m2);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_6_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m2, m7);                                  \
+      (t1) = _mm256_alignr_epi8 (m5, m6, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_6_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m4, m0);                                  \
+      (t1) = _mm256_blend_epi32 (m3, m4, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_6_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m5, m3);                                  \
+      (t1) = _mm256_shuffle_epi32 (m1, _MM_SHUFFLE (1, 0, 3, 2));             \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_7_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m6, m3);                                  \
+      (t1) = _mm256_blend_epi32 (m6, m1, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_7_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m7, m5, 8);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m0, m4);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_7_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_blend_epi32 (m1, m2, 0xCC);                               \
+      (t1) = _mm256_alignr_epi8 (m4, m7, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_7_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m5, m0);                                  \
+      (t1) = _mm256_unpacklo_epi64 (m2, m3);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_8_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m3, m7);                                  \
+      (t1) = _mm256_alignr_epi8 (m0, m5, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_8_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m7, m4);                                  \
+      (t1) = _mm256_alignr_epi8 (m4, m1, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_8_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m5, m6);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m6, m0);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_8_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_alignr_epi8 (m1, m2, 8);                                  \
+      (t1) = _mm256_alignr_epi8 (m2, m3, 8);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_9_1(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m5, m4);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m3, m0);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_9_2(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpacklo_epi64 (m1, m2);                                  \
+      (t1) = _mm256_blend_epi32 (m3, m2, 0xCC);                               \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_9_3(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_unpackhi_epi64 (m6, m7);                                  \
+      (t1) = _mm256_unpackhi_epi64 (m4, m1);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_LOAD_MSG_9_4(b, t0, t1)                                          \
+  do                                                                          \
+    {                                                                         \
+      (t0) = _mm256_blend_epi32 (m0, m5, 0xCC);                               \
+      (t1) = _mm256_unpacklo_epi64 (m7, m6);                                  \
+      (b) = _mm256_blend_epi32 ((t0), (t1), 0xF0);                            \
+    }                                                                         \
+  while (0)
+
+#define AVX2_G(a, b, c, d, m0, m1)                                            \
+  do                                                                          \
+    {                                                                         \
+      (a) = _mm256_add_epi64 (_mm256_add_epi64 ((a), (m0)), (b));             \
+      (d) = AVX2_ROTR32 (_mm256_xor_si256 ((d), (a)));                        \
+      (c) = _mm256_add_epi64 ((c), (d));                                      \
+      (b) = AVX2_ROTR24 (_mm256_xor_si256 ((b), (c)));                        \
+      (a) = _mm256_add_epi64 (_mm256_add_epi64 ((a), (m1)), (b));             \
+      (d) = AVX2_ROTR16 (_mm256_xor_si256 ((d), (a)));                        \
+      (c) = _mm256_add_epi64 ((c), (d));                                      \
+      (b) = AVX2_ROTR63 (_mm256_xor_si256 ((b), (c)));                        \
+    }                                                                         \
+  while (0)
+
+#define AVX2_ROUND(r)                                                         \
+  do                                                                          \
+    {                                                                         \
+      AVX2_LOAD_MSG_##r##_1 (b0, t0, t1);                                     \
+      AVX2_LOAD_MSG_##r##_2 (b1, t0, t1);                                     \
+      AVX2_G (a, b, c, d, b0, b1);                                            \
+      a = _mm256_permute4x64_epi64 (a, _MM_SHUFFLE (2, 1, 0, 3));             \
+      c = _mm256_permute4x64_epi64 (c, _MM_SHUFFLE (0, 3, 2, 1));             \
+      d = _mm256_permute4x64_epi64 (d, _MM_SHUFFLE (1, 0, 3, 2));             \
+      AVX2_LOAD_MSG_##r##_3 (b0, t0, t1);                                     \
+      AVX2_LOAD_MSG_##r##_4 (b1, t0, t1);                                     \
+      AVX2_G (a, b, c, d, b0, b1);                                            \
+      a = _mm256_permute4x64_epi64 (a, _MM_SHUFFLE (0, 3, 2, 1));             \
+      c = _mm256_permute4x64_epi64 (c, _MM_SHUFFLE (2, 1, 0, 3));             \
+      d = _mm256_permute4x64_epi64 (d, _MM_SHUFFLE (1, 0, 3, 2));             \
+    }                                                                         \
+  while (0)
+
+#define AVX2_BROADCAST(p)                                                     \
+  _mm256_broadcastsi128_si256 (_mm_loadu_si128 ((const __m128i *)(p)))
+
+AVX2_TARGET static void
+blake2b_compress_avx2 (struct blake2b_ctx *ctx, const uint8_t *blocks,
+                       size_t count, uint64_t increment)
+{
+  const __m256i rot24
+      = _mm256_setr_epi8 (3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9,
+                          10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8,
+                          9, 10);
+  const __m256i rot16
+      = _mm256_setr_epi8 (2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8,
+                          9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15,
+                          8, 9);
+  const __m256i iv0 = _mm256_loadu_si256 ((const __m256i *)&blake2b_iv[0]);
+  const __m256i iv1 = _mm256_loadu_si256 ((const __m256i *)&blake2b_iv[4]);
+  __m256i h0, h1, a, b, c, d;
+  __m256i m0, m1, m2, m3, m4, m5, m6, m7, b0, b1, t0, t1;
+
+  h0 = _mm256_loadu_si256 ((const __m256i *)&ctx->state[0]);
+  h1 = _mm256_loadu_si256 ((const __m256i *)&ctx->state[4]);
+  for (; count > 0; --count)
+    {
+      BLAKE2B_INCREMENT_COUNTER (ctx, increment);
+      m0 = AVX2_BROADCAST (blocks + 0);
+      m1 = AVX2_BROADCAST (blocks + 16);
+      m2 = AVX2_BROADCAST (blocks + 32);
+      m3 = AVX2_BROADCAST (blocks + 48);
+      m4 = AVX2_BROADCAST (blocks + 64);
+      m5 = AVX2_BROADCAST (blocks + 80);
+      m6 = AVX2_BROADCAST (blocks + 96);
+      m7 = AVX2_BROADCAST (blocks + 112);
+      a = h0;
+      b = h1;
+      c = iv0;
+      d = _mm256_xor_si256 (
+          iv1, _mm256_set_epi64x ((long long)ctx->f[1], (long long)ctx->f[0],
+                                  (long long)ctx->t[1], (long long)ctx->t[0]));
+      AVX2_ROUND (0);
+      AVX2_ROUND (1);
+      AVX2_ROUND (2);
+      AVX2_ROUND (3);
+      AVX2_ROUND (4);
+      AVX2_ROUND (5);
+      AVX2_ROUND (6);
+      AVX2_ROUND (7);
+      AVX2_ROUND (8);
+      AVX2_ROUND (9);
+      /* Rounds 10 and 11 repeat the permutations of rounds 0 and 1. */
+      AVX2_ROUND (0);
+      AVX2_ROUND (1);
+      h0 = _mm256_xor_si256 (h0, _mm256_xor_si256 (a, c));
+      h1 = _mm256_xor_si256 (h1, _mm256_xor_si256 (b, d));
+      blocks += BLAKE2B_BLOCK_SIZE;
+    }
+  _mm256_storeu_si256 ((__m256i *)&ctx->state[0], h0);
+  _mm256_storeu_si256 ((__m256i *)&ctx->state[4], h1);
+}
+
+const struct blake2b_backend blake2b_backend_avx2 = {
+  "avx2",
+  blake2b_compress_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int blake2b_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
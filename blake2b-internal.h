@@ -0,0 +1,76 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between blake2b.c and the instruction set specific BLAKE2b
+ * compression functions. Each call compresses count 128-byte blocks, adding
+ * increment to the byte counter before every block, with the finalization
+ * flags taken from the context as they are.
+ */
+
+#ifndef BLAKE2B_INTERNAL_H
+#define BLAKE2B_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake2b.h"
+
+#define BLAKE2B_INCREMENT_COUNTER(ctx, inc)                                   \
+  do                                                                          \
+    {                                                                         \
+      (ctx)->t[0] += (inc);                                                   \
+      if ((ctx)->t[0] < (inc))                                                \
+        (ctx)->t[1]++;                                                        \
+    }                                                                         \
+  while (0)
+
+struct blake2b_backend
+{
+  const char *name;
+  void (*compress) (struct blake2b_ctx *, const uint8_t *, size_t, uint64_t);
+};
+
+/* Initialization vector and message permutations, shared with the backends. */
+extern const uint64_t blake2b_iv[8];
+extern const uint8_t blake2b_sigma[12][16];
+
+/* Portable implementation in blake2b.c, always available. */
+extern const struct blake2b_backend blake2b_backend_generic;
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* AVX2 implementation in blake2b-avx2.c. */
+extern const struct blake2b_backend blake2b_backend_avx2;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* NEON implementation in blake2b-neon.c. */
+extern const struct blake2b_backend blake2b_backend_neon;
+#endif
+
+/* Name of the backend picked for this CPU, for fcrypt_hash_backend. */
+const char *blake2b_backend_name (void);
+
+#endif /* BLAKE2B_INTERNAL_H */
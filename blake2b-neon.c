@@ -0,0 +1,517 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * BLAKE2b with NEON, each row split across two 128-bit registers. The rows
+ * are lined up for the diagonal steps with EXT, moving a, c and d so that b,
+ * the last row G computes, stays in place. The rotation by 32 bits reverses
+ * the words of each lane and the others are built with SRI.
+ *
+ * The message block is loaded into eight registers once and the words each
+ * round needs are gathered with a constant EXT or combine of two halves, as
+ * in the reference NEON code. The rounds are unrolled so none of this
+ * indexes blake2b_sigma at run time.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake2b-internal.h"
+#include "blake2b.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_ROTR(x, n) vsriq_n_u64 (vshlq_n_u64 ((x), 64 - (n)), (x), (n))
+#define NEON_ROTR32(x)                                                        \
+  vreinterpretq_u64_u32 (vrev64q_u32 (vreinterpretq_u32_u64 (x)))
+
+/* Loads two little-endian words. */
+#if defined(__ARM_BIG_ENDIAN)
+#define NEON_LOAD(p) vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (p)))
+#else
+#define NEON_LOAD(p) vreinterpretq_u64_u8 (vld1q_u8 (p))
+#endif
+
+/*
+ * NEON_LOAD_MSG_r_k sets b0 and b1 to the message words added by the first
+ * (k = 1, 3) or second (k = 2, 4) half of the column (k = 1, 2) or diagonal
+ * (k = 3, 4) steps of round r, for the low and high halves of the rows.
+ * Register mi holds words 2i and 2i + 1 of the block.
+ */
+#define NEON_LOAD_MSG_0_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m0), vget_low_u64 (m1));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m2), vget_low_u64 (m3));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_0_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m0), vget_high_u64 (m1));           \
+      (b1) = vcombine_u64 (vget_high_u64 (m2), vget_high_u64 (m3));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_0_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m7), vget_low_u64 (m4));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m5), vget_low_u64 (m6));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_0_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m7), vget_high_u64 (m4));           \
+      (b1) = vcombine_u64 (vget_high_u64 (m5), vget_high_u64 (m6));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_1_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m7), vget_low_u64 (m2));             \
+      (b1) = vcombine_u64 (vget_high_u64 (m4), vget_high_u64 (m6));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_1_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m5), vget_low_u64 (m4));             \
+      (b1) = vextq_u64 (m7, m3, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_1_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m2), vget_high_u64 (m0));           \
+      (b1) = vcombine_u64 (vget_low_u64 (m0), vget_high_u64 (m5));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_1_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m1, m6, 1);                                           \
+      (b1) = vcombine_u64 (vget_low_u64 (m1), vget_high_u64 (m3));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_2_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m5, m6, 1);                                           \
+      (b1) = vcombine_u64 (vget_high_u64 (m2), vget_high_u64 (m7));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_2_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m4), vget_low_u64 (m0));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m1), vget_high_u64 (m6));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_2_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m4, m5, 1);                                           \
+      (b1) = vcombine_u64 (vget_high_u64 (m1), vget_high_u64 (m3));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_2_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m2), vget_low_u64 (m7));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m3), vget_high_u64 (m0));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_3_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m3), vget_high_u64 (m1));           \
+      (b1) = vcombine_u64 (vget_high_u64 (m6), vget_high_u64 (m5));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_3_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m4), vget_high_u64 (m0));           \
+      (b1) = vcombine_u64 (vget_low_u64 (m6), vget_low_u64 (m7));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_3_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m7, m1, 1);                                           \
+      (b1) = vextq_u64 (m2, m2, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_3_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m4), vget_low_u64 (m3));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m5), vget_low_u64 (m0));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_4_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m4), vget_high_u64 (m2));           \
+      (b1) = vcombine_u64 (vget_low_u64 (m1), vget_low_u64 (m5));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_4_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m0), vget_high_u64 (m3));            \
+      (b1) = vcombine_u64 (vget_low_u64 (m2), vget_high_u64 (m7));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_4_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m1, m7, 1);                                           \
+      (b1) = vextq_u64 (m5, m3, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_4_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m6), vget_high_u64 (m0));           \
+      (b1) = vcombine_u64 (vget_low_u64 (m6), vget_low_u64 (m4));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_5_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m1), vget_low_u64 (m3));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m0), vget_low_u64 (m4));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_5_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m6), vget_low_u64 (m5));             \
+      (b1) = vcombine_u64 (vget_high_u64 (m5), vget_high_u64 (m1));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_5_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m0, m2, 1);                                           \
+      (b1) = vcombine_u64 (vget_high_u64 (m3), vget_high_u64 (m7));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_5_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m4), vget_high_u64 (m6));           \
+      (b1) = vextq_u64 (m2, m7, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_6_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m6), vget_high_u64 (m0));            \
+      (b1) = vcombine_u64 (vget_low_u64 (m7), vget_low_u64 (m2));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_6_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m2), vget_high_u64 (m7));           \
+      (b1) = vextq_u64 (m6, m5, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_6_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m4), vget_low_u64 (m0));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m3), vget_high_u64 (m4));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_6_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m5), vget_high_u64 (m3));           \
+      (b1) = vextq_u64 (m1, m1, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_7_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m6), vget_high_u64 (m3));           \
+      (b1) = vcombine_u64 (vget_low_u64 (m6), vget_high_u64 (m1));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_7_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m5, m7, 1);                                           \
+      (b1) = vcombine_u64 (vget_high_u64 (m0), vget_high_u64 (m4));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_7_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m1), vget_high_u64 (m2));            \
+      (b1) = vextq_u64 (m7, m4, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_7_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m5), vget_low_u64 (m0));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m2), vget_low_u64 (m3));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_8_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m3), vget_low_u64 (m7));             \
+      (b1) = vextq_u64 (m5, m0, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_8_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m7), vget_high_u64 (m4));           \
+      (b1) = vextq_u64 (m1, m4, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_8_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m5), vget_low_u64 (m6));             \
+      (b1) = vcombine_u64 (vget_high_u64 (m6), vget_high_u64 (m0));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_8_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vextq_u64 (m2, m1, 1);                                           \
+      (b1) = vextq_u64 (m3, m2, 1);                                           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_9_1(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m5), vget_low_u64 (m4));             \
+      (b1) = vcombine_u64 (vget_high_u64 (m3), vget_high_u64 (m0));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_9_2(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m1), vget_low_u64 (m2));             \
+      (b1) = vcombine_u64 (vget_low_u64 (m3), vget_high_u64 (m2));            \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_9_3(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_high_u64 (m6), vget_high_u64 (m7));           \
+      (b1) = vcombine_u64 (vget_high_u64 (m4), vget_high_u64 (m1));           \
+    }                                                                         \
+  while (0)
+
+#define NEON_LOAD_MSG_9_4(b0, b1)                                             \
+  do                                                                          \
+    {                                                                         \
+      (b0) = vcombine_u64 (vget_low_u64 (m0), vget_high_u64 (m5));            \
+      (b1) = vcombine_u64 (vget_low_u64 (m7), vget_low_u64 (m6));             \
+    }                                                                         \
+  while (0)
+
+#define NEON_G(a, b, c, d, m0, m1)                                            \
+  do                                                                          \
+    {                                                                         \
+      (a) = vaddq_u64 (vaddq_u64 ((a), (m0)), (b));                           \
+      (d) = NEON_ROTR32 (veorq_u64 ((d), (a)));                               \
+      (c) = vaddq_u64 ((c), (d));                                             \
+      (b) = NEON_ROTR (veorq_u64 ((b), (c)), 24);                             \
+      (a) = vaddq_u64 (vaddq_u64 ((a), (m1)), (b));                           \
+      (d) = NEON_ROTR (veorq_u64 ((d), (a)), 16);                             \
+      (c) = vaddq_u64 ((c), (d));                                             \
+      (b) = NEON_ROTR (veorq_u64 ((b), (c)), 63);                             \
+    }                                                                         \
+  while (0)
+
+/* Rotate row a right and c left by one word, and d by two. */
+#define NEON_DIAGONALIZE()                                                    \
+  do                                                                          \
+    {                                                                         \
+      t0 = vextq_u64 (ah, al, 1);                                             \
+      t1 = vextq_u64 (al, ah, 1);                                             \
+      al = t0;                                                                \
+      ah = t1;                                                                \
+      t0 = vextq_u64 (cl, ch, 1);                                             \
+      t1 = vextq_u64 (ch, cl, 1);                                             \
+      cl = t0;                                                                \
+      ch = t1;                                                                \
+      t0 = dl;                                                                \
+      dl = dh;                                                                \
+      dh = t0;                                                                \
+    }                                                                         \
+  while (0)
+
+/* And back again. */
+#define NEON_UNDIAGONALIZE()                                                  \
+  do                                                                          \
+    {                                                                         \
+      t0 = vextq_u64 (al, ah, 1);                                             \
+      t1 = vextq_u64 (ah, al, 1);                                             \
+      al = t0;                                                                \
+      ah = t1;                                                                \
+      t0 = vextq_u64 (ch, cl, 1);                                             \
+      t1 = vextq_u64 (cl, ch, 1);                                             \
+      cl = t0;                                                                \
+      ch = t1;                                                                \
+      t0 = dl;                                                                \
+      dl = dh;                                                                \
+      dh = t0;                                                                \
+    }                                                                         \
+  while (0)
+
+#define NEON_ROUND(r)                                                         \
+  do                                                                          \
+    {                                                                         \
+      NEON_LOAD_MSG_##r##_1 (b0, b1);                                         \
+      NEON_LOAD_MSG_##r##_2 (b2, b3);                                         \
+      NEON_G (al, bl, cl, dl, b0, b2);                                        \
+      NEON_G (ah, bh, ch, dh, b1, b3);                                        \
+      NEON_DIAGONALIZE ();                                                    \
+      NEON_LOAD_MSG_##r##_3 (b0, b1);                                         \
+      NEON_LOAD_MSG_##r##_4 (b2, b3);                                         \
+      NEON_G (al, bl, cl, dl, b0, b2);                                        \
+      NEON_G (ah, bh, ch, dh, b1, b3);                                        \
+      NEON_UNDIAGONALIZE ();                                                  \
+    }                                                                         \
+  while (0)
+
+NEON_TARGET static void
+blake2b_compress_neon (struct blake2b_ctx *ctx, const uint8_t *blocks,
+                       size_t count, uint64_t increment)
+{
+  uint64x2_t h[4], al, ah, bl, bh, cl, ch, dl, dh, t0, t1;
+  uint64x2_t m0, m1, m2, m3, m4, m5, m6, m7, b0, b1, b2, b3;
+  size_t i;
+
+  for (i = 0; i < 4; ++i)
+    h[i] = vld1q_u64 (&ctx->state[2 * i]);
+  for (; count > 0; --count)
+    {
+      BLAKE2B_INCREMENT_COUNTER (ctx, increment);
+      m0 = NEON_LOAD (blocks + 0);
+      m1 = NEON_LOAD (blocks + 16);
+      m2 = NEON_LOAD (blocks + 32);
+      m3 = NEON_LOAD (blocks + 48);
+      m4 = NEON_LOAD (blocks + 64);
+      m5 = NEON_LOAD (blocks + 80);
+      m6 = NEON_LOAD (blocks + 96);
+      m7 = NEON_LOAD (blocks + 112);
+      al = h[0];
+      ah = h[1];
+      bl = h[2];
+      bh = h[3];
+      cl = vld1q_u64 (&blake2b_iv[0]);
+      ch = vld1q_u64 (&blake2b_iv[2]);
+      dl = veorq_u64 (vld1q_u64 (&blake2b_iv[4]), vld1q_u64 (ctx->t));
+      dh = veorq_u64 (vld1q_u64 (&blake2b_iv[6]), vld1q_u64 (ctx->f));
+      NEON_ROUND (0);
+      NEON_ROUND (1);
+      NEON_ROUND (2);
+      NEON_ROUND (3);
+      NEON_ROUND (4);
+      NEON_ROUND (5);
+      NEON_ROUND (6);
+      NEON_ROUND (7);
+      NEON_ROUND (8);
+      NEON_ROUND (9);
+      /* Rounds 10 and 11 repeat the permutations of rounds 0 and 1. */
+      NEON_ROUND (0);
+      NEON_ROUND (1);
+      h[0] = veorq_u64 (h[0], veorq_u64 (al, cl));
+      h[1] = veorq_u64 (h[1], veorq_u64 (ah, ch));
+      h[2] = veorq_u64 (h[2], veorq_u64 (bl, dl));
+      h[3] = veorq_u64 (h[3], veorq_u64 (bh, dh));
+      blocks += BLAKE2B_BLOCK_SIZE;
+    }
+  for (i = 0; i < 4; ++i)
+    vst1q_u64 (&ctx->state[2 * i], h[i]);
+}
+
+const struct blake2b_backend blake2b_backend_neon = {
+  "neon",
+  blake2b_compress_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int blake2b_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
@@ -36,25 +36,67 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fcrypt_align.h"
+
+struct iovec;
+
 #define BLAKE2B_DIGEST_SIZE 64
 #define BLAKE2B_KEY_SIZE 64
 #define BLAKE2B_BLOCK_SIZE 128
+#define BLAKE2B_SALT_SIZE 16
+#define BLAKE2B_PERSONAL_SIZE 16
+
+/*
+ * Parameter block from section 2.8 of the BLAKE2 paper. Sequential hashing
+ * uses a fanout and depth of 1 with every other field zero. The xoflen field
+ * is only used by BLAKE2Xb and is part of the node offset otherwise.
+ */
+struct blake2b_param
+{
+  uint8_t digestlen;
+  uint8_t keylen;
+  uint8_t fanout;
+  uint8_t depth;
+  uint32_t leaflen;
+  uint32_t nodeoffset;
+  uint32_t xoflen;
+  uint8_t nodedepth;
+  uint8_t innerlen;
+  uint8_t salt[BLAKE2B_SALT_SIZE];
+  uint8_t personal[BLAKE2B_PERSONAL_SIZE];
+};
 
+/*
+ * The chaining value fills the first cache line and the counters and
+ * lengths the second, so the buffer starts on a line of its own.
+ */
 struct blake2b_ctx
 {
-  uint64_t state[8];
+  FCRYPT_CACHE_ALIGNED uint64_t state[8];
   uint64_t t[2];
   uint64_t f[2];
-  uint8_t buffer[BLAKE2B_BLOCK_SIZE];
   size_t bufferlen;
   size_t digestlen;
+  int lastnode;
+  FCRYPT_CACHE_ALIGNED uint8_t buffer[BLAKE2B_BLOCK_SIZE];
 };
 
 void blake2b_init (struct blake2b_ctx *, size_t);
 void blake2b_init_key (struct blake2b_ctx *, size_t, const uint8_t *, size_t);
+void blake2b_init_param (struct blake2b_ctx *, const struct blake2b_param *,
+                         const uint8_t *);
 void blake2b_update (struct blake2b_ctx *, const void *, size_t);
+void blake2b_updatev (struct blake2b_ctx *, const struct iovec *, size_t);
 void blake2b_final (uint8_t *, struct blake2b_ctx *);
+void blake2b_copy (struct blake2b_ctx *, const struct blake2b_ctx *);
 void blake2b (uint8_t *, const uint8_t *, const uint8_t *, const size_t,
               const size_t, const size_t);
 
+/*
+ * Unkeyed BLAKE2b-512 of exactly 64 bytes, such as two child digests of a
+ * hash tree. The message fits in the last block, so this is a single call
+ * of the compression function with the parameter block already applied.
+ */
+void blake2b_64 (uint8_t *, const uint8_t *);
+
 #endif /* BLAKE2B_H */
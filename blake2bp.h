@@ -0,0 +1,69 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Implementation of BLAKE2bp, the 4-way parallel mode of BLAKE2b. The
+ * input is dealt out block by block to 4 leaves whose digests are hashed
+ * by a root node, so the leaves can be computed independently of each
+ * other. The digests differ from plain BLAKE2b.
+ */
+
+#ifndef BLAKE2BP_H
+#define BLAKE2BP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake2b.h"
+
+#define BLAKE2BP_DIGEST_SIZE BLAKE2B_DIGEST_SIZE
+#define BLAKE2BP_KEY_SIZE BLAKE2B_KEY_SIZE
+#define BLAKE2BP_BLOCK_SIZE BLAKE2B_BLOCK_SIZE
+#define BLAKE2BP_LEAVES 4
+
+struct blake2bp_ctx
+{
+  struct blake2b_ctx leaves[BLAKE2BP_LEAVES];
+  struct blake2b_ctx root;
+  uint8_t buffer[BLAKE2BP_LEAVES * BLAKE2B_BLOCK_SIZE];
+  size_t bufferlen;
+  size_t digestlen;
+};
+
+void blake2bp_init (struct blake2bp_ctx *, size_t);
+void blake2bp_init_key (struct blake2bp_ctx *, size_t, const uint8_t *,
+                         size_t);
+void blake2bp_update (struct blake2bp_ctx *, const void *, size_t);
+void blake2bp_update_parallel (struct blake2bp_ctx *, const void *, size_t,
+                               unsigned int);
+void blake2bp_final (uint8_t *, struct blake2bp_ctx *);
+void blake2bp_copy (struct blake2bp_ctx *, const struct blake2bp_ctx *);
+void blake2bp (uint8_t *, const uint8_t *, const uint8_t *, const size_t,
+               const size_t, const size_t);
+void blake2bp_parallel (uint8_t *, const uint8_t *, const uint8_t *,
+                        const size_t, const size_t, const size_t,
+                        unsigned int);
+
+#endif /* BLAKE2BP_H */
@@ -33,10 +33,12 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "blake2s.h"
 #include "bswap.h"
 #include "circularshift.h"
+#include "fcrypt_wipe.h"
 
 #define BLAKE2S_INCREMENT_COUNTER(ctx, inc)                                   \
   do                                                                          \
@@ -81,6 +83,10 @@
     }                                                                         \
   while (0)
 
+static const uint32_t blake2s_iv[8]
+    = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
 static const uint8_t blake2s_sigma[10][16] = {
   { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
   { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
@@ -94,47 +100,66 @@ static const uint8_t blake2s_sigma[10][16] = {
   { 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
 };
 
+/*
+ * Initializes ctx from a parameter block. Unless key is NULL, the keylen
+ * bytes it points to are buffered as the first block. Tree modes pass NULL
+ * for nodes that record the key length without absorbing the key.
+ */
 void
-blake2s_init (struct blake2s_ctx *ctx, size_t digestlen)
+blake2s_init_param (struct blake2s_ctx *ctx, const struct blake2s_param *param,
+                    const uint8_t *key)
 {
-  ctx->state[0] = 0x6a09e667;
-  ctx->state[1] = 0xbb67ae85;
-  ctx->state[2] = 0x3c6ef372;
-  ctx->state[3] = 0xa54ff53a;
-  ctx->state[4] = 0x510e527f;
-  ctx->state[5] = 0x9b05688c;
-  ctx->state[6] = 0x1f83d9ab;
-  ctx->state[7] = 0x5be0cd19;
-  ctx->state[0] ^= 0x01010000 | digestlen;
+  uint8_t block[32];
+  uint32_t i;
+
+  block[0] = param->digestlen;
+  block[1] = param->keylen;
+  block[2] = param->fanout;
+  block[3] = param->depth;
+  buff_put_le32 (block + 4, param->leaflen);
+  buff_put_le32 (block + 8, param->nodeoffset);
+  buff_put_le16 (block + 12, param->xoflen);
+  block[14] = param->nodedepth;
+  block[15] = param->innerlen;
+  memcpy (block + 16, param->salt, BLAKE2S_SALT_SIZE);
+  memcpy (block + 24, param->personal, BLAKE2S_PERSONAL_SIZE);
+  for (i = 0; i < 8; ++i)
+    ctx->state[i] = blake2s_iv[i] ^ buff_get_le32 (block + i * 4);
   ctx->t[0] = 0;
   ctx->t[1] = 0;
   ctx->f[0] = 0;
   ctx->f[1] = 0;
-  ctx->bufferlen = 0;
-  ctx->digestlen = digestlen;
+  ctx->digestlen = param->digestlen;
+  ctx->lastnode = 0;
+  if (key == NULL || param->keylen == 0)
+    ctx->bufferlen = 0;
+  else
+    {
+      memcpy (ctx->buffer, key, param->keylen);
+      memset (&ctx->buffer[param->keylen], 0,
+              BLAKE2S_BLOCK_SIZE - param->keylen);
+      ctx->bufferlen = BLAKE2S_BLOCK_SIZE;
+    }
+}
+
+void
+blake2s_init (struct blake2s_ctx *ctx, size_t digestlen)
+{
+  blake2s_init_key (ctx, digestlen, NULL, 0);
 }
 
 void
 blake2s_init_key (struct blake2s_ctx *ctx, size_t digestlen,
                   const uint8_t *key, size_t keylen)
 {
-  ctx->state[0] = 0x6a09e667;
-  ctx->state[1] = 0xbb67ae85;
-  ctx->state[2] = 0x3c6ef372;
-  ctx->state[3] = 0xa54ff53a;
-  ctx->state[4] = 0x510e527f;
-  ctx->state[5] = 0x9b05688c;
-  ctx->state[6] = 0x1f83d9ab;
-  ctx->state[7] = 0x5be0cd19;
-  ctx->state[0] ^= 0x01010000 | (keylen << 8) | digestlen;
-  ctx->t[0] = 0;
-  ctx->t[1] = 0;
-  ctx->f[0] = 0;
-  ctx->f[1] = 0;
-  ctx->digestlen = digestlen;
-  memcpy (ctx->buffer, key, keylen);
-  memset (&ctx->buffer[keylen], 0, BLAKE2S_BLOCK_SIZE - keylen);
-  ctx->bufferlen = BLAKE2S_BLOCK_SIZE;
+  struct blake2s_param param;
+
+  memset (&param, 0, sizeof (param));
+  param.digestlen = (uint8_t)digestlen;
+  param.keylen = (uint8_t)keylen;
+  param.fanout = 1;
+  param.depth = 1;
+  blake2s_init_param (ctx, &param, key);
 }
 
 static void
@@ -147,17 +172,16 @@ blake2s_compress_blocks (struct blake2s_ctx *ctx, const uint8_t *blocks,
   for (; count > 0; --count)
     {
       BLAKE2S_INCREMENT_COUNTER (ctx, increment);
-      for (i = 0; i < 16; ++i)
-        m[i] = buff_get_le32 (blocks + i * 4);
+      buff_get_le32_words (m, blocks, 16);
       memcpy (v, ctx->state, 32);
-      v[8] = 0x6a09e667;
-      v[9] = 0xbb67ae85;
-      v[10] = 0x3c6ef372;
-      v[11] = 0xa54ff53a;
-      v[12] = 0x510e527f ^ ctx->t[0];
-      v[13] = 0x9b05688c ^ ctx->t[1];
-      v[14] = 0x1f83d9ab ^ ctx->f[0];
-      v[15] = 0x5be0cd19 ^ ctx->f[1];
+      v[8] = blake2s_iv[0];
+      v[9] = blake2s_iv[1];
+      v[10] = blake2s_iv[2];
+      v[11] = blake2s_iv[3];
+      v[12] = blake2s_iv[4] ^ ctx->t[0];
+      v[13] = blake2s_iv[5] ^ ctx->t[1];
+      v[14] = blake2s_iv[6] ^ ctx->f[0];
+      v[15] = blake2s_iv[7] ^ ctx->f[1];
       BLAKE2S_ROUND (m, v, 0);
       BLAKE2S_ROUND (m, v, 1);
       BLAKE2S_ROUND (m, v, 2);
@@ -208,12 +232,24 @@ blake2s_update (struct blake2s_ctx *ctx, const void *inputptr, size_t inputlen)
   ctx->bufferlen += inputlen;
 }
 
+void
+blake2s_updatev (struct blake2s_ctx *ctx, const struct iovec *iov,
+                 size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    blake2s_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
 void
 blake2s_final (uint8_t *digest, struct blake2s_ctx *ctx)
 {
   uint32_t i;
 
   BLAKE2S_SET_LAST_BLOCK (ctx);
+  if (ctx->lastnode)
+    ctx->f[1] = (uint32_t)-1;
   memset (&ctx->buffer[ctx->bufferlen], 0,
           BLAKE2S_BLOCK_SIZE - ctx->bufferlen);
   blake2s_compress_blocks (ctx, ctx->buffer, 1, ctx->bufferlen);
@@ -222,7 +258,13 @@ blake2s_final (uint8_t *digest, struct blake2s_ctx *ctx)
   for (i = 0; i < 8; ++i)
     ctx->state[i] = cpu_to_le32 (ctx->state[i]);
   memcpy (digest, ctx->state, ctx->digestlen);
-  memset (ctx, 0, sizeof (*ctx));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+blake2s_copy (struct blake2s_ctx *dst, const struct blake2s_ctx *src)
+{
+  *dst = *src;
 }
 
 void
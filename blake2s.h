@@ -36,24 +36,59 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fcrypt_align.h"
+
+struct iovec;
+
 #define BLAKE2S_DIGEST_SIZE 32
 #define BLAKE2S_KEY_SIZE 32
 #define BLAKE2S_BLOCK_SIZE 64
+#define BLAKE2S_SALT_SIZE 8
+#define BLAKE2S_PERSONAL_SIZE 8
 
+/*
+ * Parameter block from section 2.8 of the BLAKE2 paper. Sequential hashing
+ * uses a fanout and depth of 1 with every other field zero. The xoflen field
+ * is only used by BLAKE2Xs and is part of the node offset otherwise.
+ */
+struct blake2s_param
+{
+  uint8_t digestlen;
+  uint8_t keylen;
+  uint8_t fanout;
+  uint8_t depth;
+  uint32_t leaflen;
+  uint32_t nodeoffset;
+  uint16_t xoflen;
+  uint8_t nodedepth;
+  uint8_t innerlen;
+  uint8_t salt[BLAKE2S_SALT_SIZE];
+  uint8_t personal[BLAKE2S_PERSONAL_SIZE];
+};
+
+/*
+ * The fields used for every block share the first cache line, and the
+ * buffer starts the second.
+ */
 struct blake2s_ctx
 {
-  uint32_t state[8];
+  FCRYPT_CACHE_ALIGNED uint32_t state[8];
   uint32_t t[2];
   uint32_t f[2];
-  uint8_t buffer[BLAKE2S_BLOCK_SIZE];
   size_t bufferlen;
+  FCRYPT_CACHE_ALIGNED uint8_t buffer[BLAKE2S_BLOCK_SIZE];
   size_t digestlen;
+  int lastnode;
 };
 
 void blake2s_init (struct blake2s_ctx *, size_t);
 void blake2s_init_key (struct blake2s_ctx *, size_t, const uint8_t *, size_t);
+void blake2s_init_param (struct blake2s_ctx *, const struct blake2s_param *,
+                         const uint8_t *);
 void blake2s_update (struct blake2s_ctx *, const void *, size_t);
+void blake2s_updatev (struct blake2s_ctx *, const struct iovec *, size_t);
 void blake2s_final (uint8_t *, struct blake2s_ctx *);
+void blake2s_copy (struct blake2s_ctx *, const struct blake2s_ctx *);
 void blake2s (uint8_t *, const uint8_t *, const uint8_t *, const size_t,
               const size_t, const size_t);
 
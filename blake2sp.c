@@ -0,0 +1,228 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Implementation of BLAKE2sp from the BLAKE2 paper, using the same parameters
+ * as the reference implementation. Block i of the input goes to leaf
+ * i mod 8, each leaf produces a full 32-byte digest and the root hashes
+ * the leaf digests in order. The last leaf and the root are marked as the
+ * last node at their level.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2sp.h"
+#include "fcrypt_parallel.h"
+#include "fcrypt_pool.h"
+#include "fcrypt_wipe.h"
+
+/* Smallest run of whole strides worth spreading the leaves across threads. */
+#define BLAKE2SP_THREAD_MIN (BLAKE2SP_LEAVES * FCRYPT_PARALLEL_MIN_SIZE)
+
+/* Whole strides of input for the leaves, one task of the pool per leaf. */
+struct blake2sp_leaves_job
+{
+  struct blake2sp_ctx *ctx;
+  const uint8_t *input;
+  size_t count;
+};
+
+/* Initializes the leaf at offset or the root node, at depth 0 and 1. */
+static void
+blake2sp_init_node (struct blake2s_ctx *node, size_t digestlen,
+                    const uint8_t *key, size_t keylen, size_t offset,
+                    size_t depth)
+{
+  struct blake2s_param param;
+
+  memset (&param, 0, sizeof (param));
+  param.digestlen = (uint8_t)digestlen;
+  param.keylen = (uint8_t)keylen;
+  param.fanout = BLAKE2SP_LEAVES;
+  param.depth = 2;
+  param.nodeoffset = (uint32_t)offset;
+  param.nodedepth = (uint8_t)depth;
+  param.innerlen = BLAKE2SP_DIGEST_SIZE;
+  /* Only the leaves absorb the key, the root just records its length. */
+  blake2s_init_param (node, &param, depth == 0 ? key : NULL);
+  if (depth == 0)
+    node->digestlen = BLAKE2SP_DIGEST_SIZE;
+}
+
+void
+blake2sp_init (struct blake2sp_ctx *ctx, size_t digestlen)
+{
+  blake2sp_init_key (ctx, digestlen, NULL, 0);
+}
+
+void
+blake2sp_init_key (struct blake2sp_ctx *ctx, size_t digestlen,
+                   const uint8_t *key, size_t keylen)
+{
+  size_t i;
+
+  for (i = 0; i < BLAKE2SP_LEAVES; ++i)
+    blake2sp_init_node (&ctx->leaves[i], digestlen, key, keylen, i, 0);
+  blake2sp_init_node (&ctx->root, digestlen, key, keylen, 0, 1);
+  ctx->leaves[BLAKE2SP_LEAVES - 1].lastnode = 1;
+  ctx->root.lastnode = 1;
+  ctx->bufferlen = 0;
+  ctx->digestlen = digestlen;
+}
+
+/*
+ * The leaf works on a copy of its state so that the threads don't write to
+ * the cache lines shared by neighbouring leaves.
+ */
+static void
+blake2sp_leaf_task (void *arg, size_t leaf)
+{
+  const struct blake2sp_leaves_job *job = arg;
+  struct blake2s_ctx node;
+  const uint8_t *input;
+  size_t i;
+
+  node = job->ctx->leaves[leaf];
+  input = job->input + leaf * BLAKE2S_BLOCK_SIZE;
+  for (i = 0; i < job->count; ++i)
+    blake2s_update (&node, input + i * sizeof (job->ctx->buffer),
+                    BLAKE2S_BLOCK_SIZE);
+  job->ctx->leaves[leaf] = node;
+  fcrypt_wipe (&node, sizeof (node));
+}
+
+/*
+ * Every leaf absorbs one block out of each stride of BLAKE2SP_LEAVES blocks.
+ * Partial strides are buffered since the final one decides how the blocks
+ * are spread across the leaves.
+ */
+static void
+blake2sp_update_threads (struct blake2sp_ctx *ctx, const void *inputptr,
+                         size_t inputlen, unsigned int threads)
+{
+  const size_t stride = sizeof (ctx->buffer);
+  const uint8_t *input = inputptr;
+  struct blake2sp_leaves_job job;
+  size_t i;
+
+  if (ctx->bufferlen > 0 && inputlen >= stride - ctx->bufferlen)
+    {
+      const size_t need = stride - ctx->bufferlen;
+
+      memcpy (&ctx->buffer[ctx->bufferlen], input, need);
+      for (i = 0; i < BLAKE2SP_LEAVES; ++i)
+        blake2s_update (&ctx->leaves[i], &ctx->buffer[i * BLAKE2S_BLOCK_SIZE],
+                        BLAKE2S_BLOCK_SIZE);
+      ctx->bufferlen = 0;
+      input += need;
+      inputlen -= need;
+    }
+
+  job.ctx = ctx;
+  job.input = input;
+  job.count = inputlen / stride;
+  if (job.count * stride < BLAKE2SP_THREAD_MIN)
+    threads = 1;
+  fcrypt_pool_run (blake2sp_leaf_task, &job, BLAKE2SP_LEAVES, threads);
+  input += job.count * stride;
+  inputlen -= job.count * stride;
+
+  memcpy (&ctx->buffer[ctx->bufferlen], input, inputlen);
+  ctx->bufferlen += inputlen;
+}
+
+void
+blake2sp_update (struct blake2sp_ctx *ctx, const void *input,
+                 size_t inputlen)
+{
+  blake2sp_update_threads (ctx, input, inputlen, 1);
+}
+
+/*
+ * Same as blake2sp_update, but hashes the leaves of a long input on up to
+ * threads threads.
+ */
+void
+blake2sp_update_parallel (struct blake2sp_ctx *ctx, const void *input,
+                          size_t inputlen, unsigned int threads)
+{
+  blake2sp_update_threads (ctx, input, inputlen, threads);
+}
+
+void
+blake2sp_final (uint8_t *digest, struct blake2sp_ctx *ctx)
+{
+  uint8_t hash[BLAKE2SP_LEAVES][BLAKE2SP_DIGEST_SIZE];
+  size_t i, left;
+
+  for (i = 0; i < BLAKE2SP_LEAVES; ++i)
+    {
+      if (ctx->bufferlen > i * BLAKE2S_BLOCK_SIZE)
+        {
+          left = ctx->bufferlen - i * BLAKE2S_BLOCK_SIZE;
+          if (left > BLAKE2S_BLOCK_SIZE)
+            left = BLAKE2S_BLOCK_SIZE;
+          blake2s_update (&ctx->leaves[i],
+                          &ctx->buffer[i * BLAKE2S_BLOCK_SIZE], left);
+        }
+      blake2s_final (hash[i], &ctx->leaves[i]);
+    }
+  blake2s_update (&ctx->root, hash, sizeof (hash));
+  blake2s_final (digest, &ctx->root);
+  fcrypt_wipe (hash, sizeof (hash));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+blake2sp_copy (struct blake2sp_ctx *dst, const struct blake2sp_ctx *src)
+{
+  *dst = *src;
+}
+
+void
+blake2sp (uint8_t *digest, const uint8_t *input, const uint8_t *key,
+          const size_t digestlen, const size_t inputlen, const size_t keylen)
+{
+  struct blake2sp_ctx ctx;
+
+  blake2sp_init_key (&ctx, digestlen, key, keylen);
+  blake2sp_update (&ctx, input, inputlen);
+  blake2sp_final (digest, &ctx);
+}
+
+void
+blake2sp_parallel (uint8_t *digest, const uint8_t *input, const uint8_t *key,
+                   const size_t digestlen, const size_t inputlen,
+                   const size_t keylen, unsigned int threads)
+{
+  struct blake2sp_ctx ctx;
+
+  blake2sp_init_key (&ctx, digestlen, key, keylen);
+  blake2sp_update_parallel (&ctx, input, inputlen, threads);
+  blake2sp_final (digest, &ctx);
+}
@@ -0,0 +1,69 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Implementation of BLAKE2sp, the 8-way parallel mode of BLAKE2s. The
+ * input is dealt out block by block to 8 leaves whose digests are hashed
+ * by a root node, so the leaves can be computed independently of each
+ * other. The digests differ from plain BLAKE2s.
+ */
+
+#ifndef BLAKE2SP_H
+#define BLAKE2SP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake2s.h"
+
+#define BLAKE2SP_DIGEST_SIZE BLAKE2S_DIGEST_SIZE
+#define BLAKE2SP_KEY_SIZE BLAKE2S_KEY_SIZE
+#define BLAKE2SP_BLOCK_SIZE BLAKE2S_BLOCK_SIZE
+#define BLAKE2SP_LEAVES 8
+
+struct blake2sp_ctx
+{
+  struct blake2s_ctx leaves[BLAKE2SP_LEAVES];
+  struct blake2s_ctx root;
+  uint8_t buffer[BLAKE2SP_LEAVES * BLAKE2S_BLOCK_SIZE];
+  size_t bufferlen;
+  size_t digestlen;
+};
+
+void blake2sp_init (struct blake2sp_ctx *, size_t);
+void blake2sp_init_key (struct blake2sp_ctx *, size_t, const uint8_t *,
+                         size_t);
+void blake2sp_update (struct blake2sp_ctx *, const void *, size_t);
+void blake2sp_update_parallel (struct blake2sp_ctx *, const void *, size_t,
+                               unsigned int);
+void blake2sp_final (uint8_t *, struct blake2sp_ctx *);
+void blake2sp_copy (struct blake2sp_ctx *, const struct blake2sp_ctx *);
+void blake2sp (uint8_t *, const uint8_t *, const uint8_t *, const size_t,
+               const size_t, const size_t);
+void blake2sp_parallel (uint8_t *, const uint8_t *, const uint8_t *,
+                        const size_t, const size_t, const size_t,
+                        unsigned int);
+
+#endif /* BLAKE2SP_H */
@@ -0,0 +1,121 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Implementation of BLAKE2Xb. The root is BLAKE2b with the full digest
+ * size and the requested output length in the xoflen field. Output block i
+ * is the BLAKE2b hash of the root digest with node offset i, a leaf length
+ * and inner length of 64 and the salt and personalization of the root.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "blake2b.h"
+#include "blake2xb.h"
+#include "fcrypt_wipe.h"
+
+void
+blake2xb_init (struct blake2xb_ctx *ctx, size_t outlen)
+{
+  blake2xb_init_key (ctx, outlen, NULL, 0);
+}
+
+void
+blake2xb_init_key (struct blake2xb_ctx *ctx, size_t outlen,
+                   const uint8_t *key, size_t keylen)
+{
+  struct blake2b_param param;
+
+  memset (&param, 0, sizeof (param));
+  param.keylen = (uint8_t)keylen;
+  param.xoflen = (uint32_t)outlen;
+  blake2xb_init_param (ctx, &param, key);
+}
+
+/*
+ * Takes the key length, salt and personalization from param along with the
+ * output length in its xoflen field. The remaining fields are set as
+ * BLAKE2Xb requires.
+ */
+void
+blake2xb_init_param (struct blake2xb_ctx *ctx,
+                     const struct blake2b_param *param, const uint8_t *key)
+{
+  ctx->param = *param;
+  ctx->param.digestlen = BLAKE2B_DIGEST_SIZE;
+  ctx->param.fanout = 1;
+  ctx->param.depth = 1;
+  ctx->param.leaflen = 0;
+  ctx->param.nodeoffset = 0;
+  ctx->param.nodedepth = 0;
+  ctx->param.innerlen = 0;
+  blake2b_init_param (&ctx->root, &ctx->param, key);
+}
+
+void
+blake2xb_update (struct blake2xb_ctx *ctx, const void *input, size_t inputlen)
+{
+  blake2b_update (&ctx->root, input, inputlen);
+}
+
+void
+blake2xb_final (uint8_t *output, struct blake2xb_ctx *ctx)
+{
+  struct blake2b_ctx node;
+  uint8_t root[BLAKE2B_DIGEST_SIZE];
+  size_t outlen, len;
+
+  blake2b_final (root, &ctx->root);
+  outlen = ctx->param.xoflen;
+  ctx->param.keylen = 0;
+  ctx->param.fanout = 0;
+  ctx->param.depth = 0;
+  ctx->param.leaflen = BLAKE2B_DIGEST_SIZE;
+  ctx->param.innerlen = BLAKE2B_DIGEST_SIZE;
+  for (; outlen > 0; outlen -= len, output += len)
+    {
+      len = outlen < BLAKE2B_DIGEST_SIZE ? outlen : BLAKE2B_DIGEST_SIZE;
+      ctx->param.digestlen = (uint8_t)len;
+      blake2b_init_param (&node, &ctx->param, NULL);
+      blake2b_update (&node, root, sizeof (root));
+      blake2b_final (output, &node);
+      ctx->param.nodeoffset++;
+    }
+  fcrypt_wipe (root, sizeof (root));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+blake2xb (uint8_t *output, const uint8_t *input, const uint8_t *key,
+          const size_t outlen, const size_t inputlen, const size_t keylen)
+{
+  struct blake2xb_ctx ctx;
+
+  blake2xb_init_key (&ctx, outlen, key, keylen);
+  blake2xb_update (&ctx, input, inputlen);
+  blake2xb_final (output, &ctx);
+}
@@ -0,0 +1,62 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Implementation of BLAKE2Xb, the extendable-output mode of BLAKE2b from
+ * https://www.blake2.net/blake2x.pdf. The input is hashed once into a root
+ * digest, which is then expanded into up to BLAKE2XB_MAX_OUTPUT_SIZE bytes.
+ * The output length is part of the parameters, so outputs of different
+ * lengths are unrelated.
+ */
+
+#ifndef BLAKE2XB_H
+#define BLAKE2XB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake2b.h"
+
+#define BLAKE2XB_KEY_SIZE BLAKE2B_KEY_SIZE
+#define BLAKE2XB_BLOCK_SIZE BLAKE2B_BLOCK_SIZE
+#define BLAKE2XB_MAX_OUTPUT_SIZE UINT32_C (0xfffffffe)
+
+struct blake2xb_ctx
+{
+  struct blake2b_ctx root;
+  struct blake2b_param param;
+};
+
+void blake2xb_init (struct blake2xb_ctx *, size_t);
+void blake2xb_init_key (struct blake2xb_ctx *, size_t, const uint8_t *,
+                         size_t);
+void blake2xb_init_param (struct blake2xb_ctx *,
+                           const struct blake2b_param *, const uint8_t *);
+void blake2xb_update (struct blake2xb_ctx *, const void *, size_t);
+void blake2xb_final (uint8_t *, struct blake2xb_ctx *);
+void blake2xb (uint8_t *, const uint8_t *, const uint8_t *, const size_t,
+               const size_t, const size_t);
+
+#endif /* BLAKE2XB_H */
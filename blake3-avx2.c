@@ -0,0 +1,202 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * BLAKE3 with AVX2, hashing eight chunks or parents at a time with each
+ * register holding one state word of every input. The message blocks are
+ * transposed into that form on the way in. Rotations by 16 and 8 bits are
+ * byte shuffles.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake3-internal.h"
+#include "blake3.h"
+#include "bswap.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_LANES 8
+
+#define AVX2_ROTR16(x) _mm256_shuffle_epi8 ((x), rot16)
+#define AVX2_ROTR8(x) _mm256_shuffle_epi8 ((x), rot8)
+#define AVX2_ROTR12(x)                                                        \
+  _mm256_or_si256 (_mm256_srli_epi32 ((x), 12), _mm256_slli_epi32 ((x), 20))
+#define AVX2_ROTR7(x)                                                         \
+  _mm256_or_si256 (_mm256_srli_epi32 ((x), 7), _mm256_slli_epi32 ((x), 25))
+
+#define AVX2_G(v, a, b, c, d, x, y)                                           \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] = _mm256_add_epi32 (_mm256_add_epi32 ((v)[a], (v)[b]), (x));     \
+      (v)[d] = AVX2_ROTR16 (_mm256_xor_si256 ((v)[d], (v)[a]));               \
+      (v)[c] = _mm256_add_epi32 ((v)[c], (v)[d]);                             \
+      (v)[b] = AVX2_ROTR12 (_mm256_xor_si256 ((v)[b], (v)[c]));               \
+      (v)[a] = _mm256_add_epi32 (_mm256_add_epi32 ((v)[a], (v)[b]), (y));     \
+      (v)[d] = AVX2_ROTR8 (_mm256_xor_si256 ((v)[d], (v)[a]));                \
+      (v)[c] = _mm256_add_epi32 ((v)[c], (v)[d]);                             \
+      (v)[b] = AVX2_ROTR7 (_mm256_xor_si256 ((v)[b], (v)[c]));                \
+    }                                                                         \
+  while (0)
+
+#define AVX2_ROUND(v, m, s)                                                   \
+  do                                                                          \
+    {                                                                         \
+      AVX2_G (v, 0, 4, 8, 12, (m)[(s)[0]], (m)[(s)[1]]);                      \
+      AVX2_G (v, 1, 5, 9, 13, (m)[(s)[2]], (m)[(s)[3]]);                      \
+      AVX2_G (v, 2, 6, 10, 14, (m)[(s)[4]], (m)[(s)[5]]);                     \
+      AVX2_G (v, 3, 7, 11, 15, (m)[(s)[6]], (m)[(s)[7]]);                     \
+      AVX2_G (v, 0, 5, 10, 15, (m)[(s)[8]], (m)[(s)[9]]);                     \
+      AVX2_G (v, 1, 6, 11, 12, (m)[(s)[10]], (m)[(s)[11]]);                   \
+      AVX2_G (v, 2, 7, 8, 13, (m)[(s)[12]], (m)[(s)[13]]);                    \
+      AVX2_G (v, 3, 4, 9, 14, (m)[(s)[14]], (m)[(s)[15]]);                    \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads words 0 to 7 or 8 to 15 of a block of each of the eight inputs, at
+ * offset bytes into each, and stores the words of all inputs for index i in
+ * w[i].
+ */
+AVX2_TARGET static inline void
+avx2_load_transpose (__m256i *w, const uint8_t *const *inputs, size_t offset)
+{
+  __m256i r[AVX2_LANES], t[AVX2_LANES], u[AVX2_LANES];
+  unsigned int l;
+
+  for (l = 0; l < AVX2_LANES; ++l)
+    r[l] = _mm256_loadu_si256 ((const __m256i *)(inputs[l] + offset));
+
+  for (l = 0; l < AVX2_LANES; l += 2)
+    {
+      t[l] = _mm256_unpacklo_epi32 (r[l], r[l + 1]);
+      t[l + 1] = _mm256_unpackhi_epi32 (r[l], r[l + 1]);
+    }
+  for (l = 0; l < AVX2_LANES; l += 4)
+    {
+      u[l] = _mm256_unpacklo_epi64 (t[l], t[l + 2]);
+      u[l + 1] = _mm256_unpackhi_epi64 (t[l], t[l + 2]);
+      u[l + 2] = _mm256_unpacklo_epi64 (t[l + 1], t[l + 3]);
+      u[l + 3] = _mm256_unpackhi_epi64 (t[l + 1], t[l + 3]);
+    }
+  for (l = 0; l < 4; ++l)
+    {
+      w[l] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x20);
+      w[l + 4] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x31);
+    }
+}
+
+AVX2_TARGET static void
+blake3_hash8_avx2 (const uint8_t *const *inputs, size_t blocks,
+                   const uint32_t *key, uint64_t counter, int increment,
+                   uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                   uint8_t *out)
+{
+  const __m256i rot16
+      = _mm256_setr_epi8 (2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                          2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12,
+                          13);
+  const __m256i rot8
+      = _mm256_setr_epi8 (1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+                          1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15,
+                          12);
+  __m256i h[8], v[16], m[16];
+  uint32_t lo[8], hi[8], words[8][8];
+  size_t i, j;
+  uint8_t blockflags;
+
+  for (i = 0; i < 8; ++i)
+    {
+      lo[i] = (uint32_t)(counter + (increment ? i : 0));
+      hi[i] = (uint32_t)((counter + (increment ? i : 0)) >> 32);
+    }
+  for (i = 0; i < 8; ++i)
+    h[i] = _mm256_set1_epi32 ((int)key[i]);
+
+  blockflags = flags | flags_start;
+  for (j = 0; j < blocks; ++j)
+    {
+      if (j + 1 == blocks)
+        blockflags |= flags_end;
+      avx2_load_transpose (m, inputs, j * BLAKE3_BLOCK_SIZE);
+      avx2_load_transpose (m + 8, inputs, j * BLAKE3_BLOCK_SIZE + 32);
+      for (i = 0; i < 8; ++i)
+        v[i] = h[i];
+      for (i = 0; i < 4; ++i)
+        v[i + 8] = _mm256_set1_epi32 ((int)blake3_iv[i]);
+      v[12] = _mm256_loadu_si256 ((const __m256i *)lo);
+      v[13] = _mm256_loadu_si256 ((const __m256i *)hi);
+      v[14] = _mm256_set1_epi32 (BLAKE3_BLOCK_SIZE);
+      v[15] = _mm256_set1_epi32 (blockflags);
+      for (i = 0; i < 7; ++i)
+        AVX2_ROUND (v, m, blake3_schedule[i]);
+      for (i = 0; i < 8; ++i)
+        h[i] = _mm256_xor_si256 (v[i], v[i + 8]);
+      blockflags = flags;
+    }
+
+  for (i = 0; i < 8; ++i)
+    _mm256_storeu_si256 ((__m256i *)words[i], h[i]);
+  for (j = 0; j < 8; ++j)
+    for (i = 0; i < 8; ++i)
+      buff_put_le32 (out + j * BLAKE3_DIGEST_SIZE + i * 4, words[i][j]);
+}
+
+AVX2_TARGET static void
+blake3_hash_many_avx2 (const uint8_t *const *inputs, size_t count,
+                       size_t blocks, const uint32_t *key, uint64_t counter,
+                       int increment, uint8_t flags, uint8_t flags_start,
+                       uint8_t flags_end, uint8_t *out)
+{
+  for (; count > 0; count -= AVX2_LANES)
+    {
+      blake3_hash8_avx2 (inputs, blocks, key, counter, increment, flags,
+                         flags_start, flags_end, out);
+      inputs += AVX2_LANES;
+      out += AVX2_LANES * BLAKE3_DIGEST_SIZE;
+      if (increment)
+        counter += AVX2_LANES;
+    }
+}
+
+const struct blake3_backend blake3_backend_avx2 = {
+  "avx2",
+  AVX2_LANES,
+  blake3_hash_many_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int blake3_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
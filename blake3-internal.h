@@ -0,0 +1,97 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between blake3.c and the instruction set specific BLAKE3
+ * implementations. A backend hashes several inputs of the same number of
+ * blocks side by side, each input being a whole chunk or a parent node. The
+ * count given to it is always a multiple of its degree.
+ */
+
+#ifndef BLAKE3_INTERNAL_H
+#define BLAKE3_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake3.h"
+
+/* Domain separation flags. */
+#define BLAKE3_CHUNK_START (1 << 0)
+#define BLAKE3_CHUNK_END (1 << 1)
+#define BLAKE3_PARENT (1 << 2)
+#define BLAKE3_ROOT (1 << 3)
+#define BLAKE3_KEYED_HASH (1 << 4)
+#define BLAKE3_DERIVE_KEY_CONTEXT (1 << 5)
+#define BLAKE3_DERIVE_KEY_MATERIAL (1 << 6)
+
+/* Most inputs any backend hashes at once. */
+#define BLAKE3_MAX_DEGREE 16
+
+struct blake3_backend
+{
+  const char *name;
+  size_t degree;
+  /*
+   * Compresses blocks blocks of each of count inputs starting from key. When
+   * increment is set input i uses counter + i, otherwise all use counter.
+   * The first and last blocks add flags_start and flags_end to flags. The
+   * chaining values are written one after another to out.
+   */
+  void (*hash_many) (const uint8_t *const *, size_t, size_t, const uint32_t *,
+                     uint64_t, int, uint8_t, uint8_t, uint8_t, uint8_t *);
+};
+
+/* Message word permutation applied in each of the seven rounds. */
+extern const uint8_t blake3_schedule[7][16];
+extern const uint32_t blake3_iv[8];
+
+/* Portable implementation in blake3.c, always available. */
+extern const struct blake3_backend blake3_backend_generic;
+
+#if defined(HAVE_SSE41_INTRINSICS)
+/* Four inputs at a time in blake3-sse41.c. */
+extern const struct blake3_backend blake3_backend_sse41;
+#endif
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* Eight inputs at a time in blake3-avx2.c. */
+extern const struct blake3_backend blake3_backend_avx2;
+#endif
+
+#if defined(HAVE_AVX512_INTRINSICS)
+/* Sixteen inputs at a time in blake3-avx512.c. */
+extern const struct blake3_backend blake3_backend_avx512;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* Four inputs at a time in blake3-neon.c. */
+extern const struct blake3_backend blake3_backend_neon;
+#endif
+
+/* Name of the widest backend picked for this CPU, for fcrypt_hash_backend. */
+const char *blake3_backend_name (void);
+
+#endif /* BLAKE3_INTERNAL_H */
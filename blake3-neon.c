@@ -0,0 +1,181 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * BLAKE3 with NEON, hashing four chunks or parents at a time. This is the
+ * same as blake3-sse41.c, transposing the message words with TRN. The
+ * rotation by 16 bits swaps halfwords and the others are built with SRI.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake3-internal.h"
+#include "blake3.h"
+#include "bswap.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_LANES 4
+
+#define NEON_ROTR(x, n) vsriq_n_u32 (vshlq_n_u32 ((x), 32 - (n)), (x), (n))
+#define NEON_ROTR16(x)                                                        \
+  vreinterpretq_u32_u16 (vrev32q_u16 (vreinterpretq_u16_u32 (x)))
+#define NEON_ROTR12(x) NEON_ROTR ((x), 12)
+#define NEON_ROTR8(x) NEON_ROTR ((x), 8)
+#define NEON_ROTR7(x) NEON_ROTR ((x), 7)
+
+#define NEON_G(v, a, b, c, d, x, y)                                           \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] = vaddq_u32 (vaddq_u32 ((v)[a], (v)[b]), (x));                   \
+      (v)[d] = NEON_ROTR16 (veorq_u32 ((v)[d], (v)[a]));                      \
+      (v)[c] = vaddq_u32 ((v)[c], (v)[d]);                                    \
+      (v)[b] = NEON_ROTR12 (veorq_u32 ((v)[b], (v)[c]));                      \
+      (v)[a] = vaddq_u32 (vaddq_u32 ((v)[a], (v)[b]), (y));                   \
+      (v)[d] = NEON_ROTR8 (veorq_u32 ((v)[d], (v)[a]));                       \
+      (v)[c] = vaddq_u32 ((v)[c], (v)[d]);                                    \
+      (v)[b] = NEON_ROTR7 (veorq_u32 ((v)[b], (v)[c]));                       \
+    }                                                                         \
+  while (0)
+
+#define NEON_ROUND(v, m, s)                                                   \
+  do                                                                          \
+    {                                                                         \
+      NEON_G (v, 0, 4, 8, 12, (m)[(s)[0]], (m)[(s)[1]]);                      \
+      NEON_G (v, 1, 5, 9, 13, (m)[(s)[2]], (m)[(s)[3]]);                      \
+      NEON_G (v, 2, 6, 10, 14, (m)[(s)[4]], (m)[(s)[5]]);                     \
+      NEON_G (v, 3, 7, 11, 15, (m)[(s)[6]], (m)[(s)[7]]);                     \
+      NEON_G (v, 0, 5, 10, 15, (m)[(s)[8]], (m)[(s)[9]]);                     \
+      NEON_G (v, 1, 6, 11, 12, (m)[(s)[10]], (m)[(s)[11]]);                   \
+      NEON_G (v, 2, 7, 8, 13, (m)[(s)[12]], (m)[(s)[13]]);                    \
+      NEON_G (v, 3, 4, 9, 14, (m)[(s)[14]], (m)[(s)[15]]);                    \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads four words of a block of each of the four inputs, at offset bytes
+ * into each, and stores the words of all inputs for index i in w[i].
+ */
+NEON_TARGET static inline void
+neon_load_transpose (uint32x4_t *w, const uint8_t *const *inputs,
+                     size_t offset)
+{
+  uint32x4x2_t t0, t1;
+
+  t0 = vtrnq_u32 (vreinterpretq_u32_u8 (vld1q_u8 (inputs[0] + offset)),
+                  vreinterpretq_u32_u8 (vld1q_u8 (inputs[1] + offset)));
+  t1 = vtrnq_u32 (vreinterpretq_u32_u8 (vld1q_u8 (inputs[2] + offset)),
+                  vreinterpretq_u32_u8 (vld1q_u8 (inputs[3] + offset)));
+  w[0] = vcombine_u32 (vget_low_u32 (t0.val[0]), vget_low_u32 (t1.val[0]));
+  w[1] = vcombine_u32 (vget_low_u32 (t0.val[1]), vget_low_u32 (t1.val[1]));
+  w[2] = vcombine_u32 (vget_high_u32 (t0.val[0]), vget_high_u32 (t1.val[0]));
+  w[3] = vcombine_u32 (vget_high_u32 (t0.val[1]), vget_high_u32 (t1.val[1]));
+}
+
+NEON_TARGET static void
+blake3_hash4_neon (const uint8_t *const *inputs, size_t blocks,
+                   const uint32_t *key, uint64_t counter, int increment,
+                   uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                   uint8_t *out)
+{
+  uint32x4_t h[8], v[16], m[16];
+  uint32_t lo[4], hi[4], words[8][4];
+  size_t i, j;
+  uint8_t blockflags;
+
+  for (i = 0; i < 4; ++i)
+    {
+      lo[i] = (uint32_t)(counter + (increment ? i : 0));
+      hi[i] = (uint32_t)((counter + (increment ? i : 0)) >> 32);
+    }
+  for (i = 0; i < 8; ++i)
+    h[i] = vdupq_n_u32 ((int)key[i]);
+
+  blockflags = flags | flags_start;
+  for (j = 0; j < blocks; ++j)
+    {
+      if (j + 1 == blocks)
+        blockflags |= flags_end;
+      for (i = 0; i < 4; ++i)
+        neon_load_transpose (m + 4 * i, inputs,
+                             j * BLAKE3_BLOCK_SIZE + 16 * i);
+      for (i = 0; i < 8; ++i)
+        v[i] = h[i];
+      for (i = 0; i < 4; ++i)
+        v[i + 8] = vdupq_n_u32 ((int)blake3_iv[i]);
+      v[12] = vld1q_u32 (lo);
+      v[13] = vld1q_u32 (hi);
+      v[14] = vdupq_n_u32 (BLAKE3_BLOCK_SIZE);
+      v[15] = vdupq_n_u32 (blockflags);
+      for (i = 0; i < 7; ++i)
+        NEON_ROUND (v, m, blake3_schedule[i]);
+      for (i = 0; i < 8; ++i)
+        h[i] = veorq_u32 (v[i], v[i + 8]);
+      blockflags = flags;
+    }
+
+  for (i = 0; i < 8; ++i)
+    vst1q_u32 (words[i], h[i]);
+  for (j = 0; j < 4; ++j)
+    for (i = 0; i < 8; ++i)
+      buff_put_le32 (out + j * BLAKE3_DIGEST_SIZE + i * 4, words[i][j]);
+}
+
+NEON_TARGET static void
+blake3_hash_many_neon (const uint8_t *const *inputs, size_t count,
+                       size_t blocks, const uint32_t *key, uint64_t counter,
+                       int increment, uint8_t flags, uint8_t flags_start,
+                       uint8_t flags_end, uint8_t *out)
+{
+  for (; count > 0; count -= NEON_LANES)
+    {
+      blake3_hash4_neon (inputs, blocks, key, counter, increment, flags,
+                         flags_start, flags_end, out);
+      inputs += NEON_LANES;
+      out += NEON_LANES * BLAKE3_DIGEST_SIZE;
+      if (increment)
+        counter += NEON_LANES;
+    }
+}
+
+const struct blake3_backend blake3_backend_neon = {
+  "neon",
+  NEON_LANES,
+  blake3_hash_many_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int blake3_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
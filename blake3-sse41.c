@@ -0,0 +1,189 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * BLAKE3 with SSE4.1, hashing four chunks or parents at a time with each
+ * register holding one state word of every input. The message blocks are
+ * transposed into that form with 4x4 transposes. Rotations by 16 and 8 bits
+ * are byte shuffles.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blake3-internal.h"
+#include "blake3.h"
+#include "bswap.h"
+
+#if defined(HAVE_SSE41_INTRINSICS)
+
+#include <smmintrin.h>
+
+#define SSE41_TARGET __attribute__ ((target (SSE41_TARGET_ATTRIBUTE)))
+
+#define SSE41_LANES 4
+
+#define SSE41_ROTR16(x) _mm_shuffle_epi8 ((x), rot16)
+#define SSE41_ROTR8(x) _mm_shuffle_epi8 ((x), rot8)
+#define SSE41_ROTR12(x)                                                       \
+  _mm_or_si128 (_mm_srli_epi32 ((x), 12), _mm_slli_epi32 ((x), 20))
+#define SSE41_ROTR7(x)                                                        \
+  _mm_or_si128 (_mm_srli_epi32 ((x), 7), _mm_slli_epi32 ((x), 25))
+
+#define SSE41_G(v, a, b, c, d, x, y)                                          \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] = _mm_add_epi32 (_mm_add_epi32 ((v)[a], (v)[b]), (x));           \
+      (v)[d] = SSE41_ROTR16 (_mm_xor_si128 ((v)[d], (v)[a]));                 \
+      (v)[c] = _mm_add_epi32 ((v)[c], (v)[d]);                                \
+      (v)[b] = SSE41_ROTR12 (_mm_xor_si128 ((v)[b], (v)[c]));                 \
+      (v)[a] = _mm_add_epi32 (_mm_add_epi32 ((v)[a], (v)[b]), (y));           \
+      (v)[d] = SSE41_ROTR8 (_mm_xor_si128 ((v)[d], (v)[a]));                  \
+      (v)[c] = _mm_add_epi32 ((v)[c], (v)[d]);                                \
+      (v)[b] = SSE41_ROTR7 (_mm_xor_si128 ((v)[b], (v)[c]));                  \
+    }                                                                         \
+  while (0)
+
+#define SSE41_ROUND(v, m, s)                                                  \
+  do                                                                          \
+    {                                                                         \
+      SSE41_G (v, 0, 4, 8, 12, (m)[(s)[0]], (m)[(s)[1]]);                     \
+      SSE41_G (v, 1, 5, 9, 13, (m)[(s)[2]], (m)[(s)[3]]);                     \
+      SSE41_G (v, 2, 6, 10, 14, (m)[(s)[4]], (m)[(s)[5]]);                    \
+      SSE41_G (v, 3, 7, 11, 15, (m)[(s)[6]], (m)[(s)[7]]);                    \
+      SSE41_G (v, 0, 5, 10, 15, (m)[(s)[8]], (m)[(s)[9]]);                    \
+      SSE41_G (v, 1, 6, 11, 12, (m)[(s)[10]], (m)[(s)[11]]);                  \
+      SSE41_G (v, 2, 7, 8, 13, (m)[(s)[12]], (m)[(s)[13]]);                   \
+      SSE41_G (v, 3, 4, 9, 14, (m)[(s)[14]], (m)[(s)[15]]);                   \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads four words of a block of each of the four inputs, at offset bytes
+ * into each, and stores the words of all inputs for index i in w[i].
+ */
+SSE41_TARGET static inline void
+sse41_load_transpose (__m128i *w, const uint8_t *const *inputs, size_t offset)
+{
+  __m128i r0, r1, r2, r3, t0, t1, t2, t3;
+
+  r0 = _mm_loadu_si128 ((const __m128i *)(inputs[0] + offset));
+  r1 = _mm_loadu_si128 ((const __m128i *)(inputs[1] + offset));
+  r2 = _mm_loadu_si128 ((const __m128i *)(inputs[2] + offset));
+  r3 = _mm_loadu_si128 ((const __m128i *)(inputs[3] + offset));
+  t0 = _mm_unpacklo_epi32 (r0, r1);
+  t1 = _mm_unpackhi_epi32 (r0, r1);
+  t2 = _mm_unpacklo_epi32 (r2, r3);
+  t3 = _mm_unpackhi_epi32 (r2, r3);
+  w[0] = _mm_unpacklo_epi64 (t0, t2);
+  w[1] = _mm_unpackhi_epi64 (t0, t2);
+  w[2] = _mm_unpacklo_epi64 (t1, t3);
+  w[3] = _mm_unpackhi_epi64 (t1, t3);
+}
+
+SSE41_TARGET static void
+blake3_hash4_sse41 (const uint8_t *const *inputs, size_t blocks,
+                    const uint32_t *key, uint64_t counter, int increment,
+                    uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                    uint8_t *out)
+{
+  const __m128i rot16
+      = _mm_setr_epi8 (2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  const __m128i rot8
+      = _mm_setr_epi8 (1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+  __m128i h[8], v[16], m[16];
+  uint32_t lo[4], hi[4], words[8][4];
+  size_t i, j;
+  uint8_t blockflags;
+
+  for (i = 0; i < 4; ++i)
+    {
+      lo[i] = (uint32_t)(counter + (increment ? i : 0));
+      hi[i] = (uint32_t)((counter + (increment ? i : 0)) >> 32);
+    }
+  for (i = 0; i < 8; ++i)
+    h[i] = _mm_set1_epi32 ((int)key[i]);
+
+  blockflags = flags | flags_start;
+  for (j = 0; j < blocks; ++j)
+    {
+      if (j + 1 == blocks)
+        blockflags |= flags_end;
+      for (i = 0; i < 4; ++i)
+        sse41_load_transpose (m + 4 * i, inputs,
+                              j * BLAKE3_BLOCK_SIZE + 16 * i);
+      for (i = 0; i < 8; ++i)
+        v[i] = h[i];
+      for (i = 0; i < 4; ++i)
+        v[i + 8] = _mm_set1_epi32 ((int)blake3_iv[i]);
+      v[12] = _mm_loadu_si128 ((const __m128i *)lo);
+      v[13] = _mm_loadu_si128 ((const __m128i *)hi);
+      v[14] = _mm_set1_epi32 (BLAKE3_BLOCK_SIZE);
+      v[15] = _mm_set1_epi32 (blockflags);
+      for (i = 0; i < 7; ++i)
+        SSE41_ROUND (v, m, blake3_schedule[i]);
+      for (i = 0; i < 8; ++i)
+        h[i] = _mm_xor_si128 (v[i], v[i + 8]);
+      blockflags = flags;
+    }
+
+  for (i = 0; i < 8; ++i)
+    _mm_storeu_si128 ((__m128i *)words[i], h[i]);
+  for (j = 0; j < 4; ++j)
+    for (i = 0; i < 8; ++i)
+      buff_put_le32 (out + j * BLAKE3_DIGEST_SIZE + i * 4, words[i][j]);
+}
+
+SSE41_TARGET static void
+blake3_hash_many_sse41 (const uint8_t *const *inputs, size_t count,
+                        size_t blocks, const uint32_t *key, uint64_t counter,
+                        int increment, uint8_t flags, uint8_t flags_start,
+                        uint8_t flags_end, uint8_t *out)
+{
+  for (; count > 0; count -= SSE41_LANES)
+    {
+      blake3_hash4_sse41 (inputs, blocks, key, counter, increment, flags,
+                          flags_start, flags_end, out);
+      inputs += SSE41_LANES;
+      out += SSE41_LANES * BLAKE3_DIGEST_SIZE;
+      if (increment)
+        counter += SSE41_LANES;
+    }
+}
+
+const struct blake3_backend blake3_backend_sse41 = {
+  "sse41",
+  SSE41_LANES,
+  blake3_hash_many_sse41,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int blake3_sse41_unused;
+
+#endif /* HAVE_SSE41_INTRINSICS */
@@ -0,0 +1,781 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Implementation of BLAKE3. The input is split into 1024-byte chunks which
+ * form the leaves of a binary tree, with each left subtree holding the
+ * largest power of two of chunks that leaves something to its right. Runs
+ * of whole chunks, and the parents above them, are compressed by the widest
+ * backend available; blake3_update_parallel also hands subtrees out to
+ * threads.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include "blake3-internal.h"
+#include "blake3.h"
+#include "bswap.h"
+#include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_pool.h"
+#include "fcrypt_wipe.h"
+
+/* Smallest left subtree worth handing to another thread. */
+#define BLAKE3_THREAD_MIN (128 * BLAKE3_CHUNK_SIZE)
+
+#define BLAKE3_G(v, a, b, c, d, x, y)                                         \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] += (v)[b] + (x);                                                 \
+      (v)[d] = rotr32 ((v)[d] ^ (v)[a], 16);                                  \
+      (v)[c] += (v)[d];                                                       \
+      (v)[b] = rotr32 ((v)[b] ^ (v)[c], 12);                                  \
+      (v)[a] += (v)[b] + (y);                                                 \
+      (v)[d] = rotr32 ((v)[d] ^ (v)[a], 8);                                   \
+      (v)[c] += (v)[d];                                                       \
+      (v)[b] = rotr32 ((v)[b] ^ (v)[c], 7);                                   \
+    }                                                                         \
+  while (0)
+
+#define BLAKE3_ROUND(v, m, s)                                                 \
+  do                                                                          \
+    {                                                                         \
+      BLAKE3_G (v, 0, 4, 8, 12, (m)[(s)[0]], (m)[(s)[1]]);                    \
+      BLAKE3_G (v, 1, 5, 9, 13, (m)[(s)[2]], (m)[(s)[3]]);                    \
+      BLAKE3_G (v, 2, 6, 10, 14, (m)[(s)[4]], (m)[(s)[5]]);                   \
+      BLAKE3_G (v, 3, 7, 11, 15, (m)[(s)[6]], (m)[(s)[7]]);                   \
+      BLAKE3_G (v, 0, 5, 10, 15, (m)[(s)[8]], (m)[(s)[9]]);                   \
+      BLAKE3_G (v, 1, 6, 11, 12, (m)[(s)[10]], (m)[(s)[11]]);                 \
+      BLAKE3_G (v, 2, 7, 8, 13, (m)[(s)[12]], (m)[(s)[13]]);                  \
+      BLAKE3_G (v, 3, 4, 9, 14, (m)[(s)[14]], (m)[(s)[15]]);                  \
+    }                                                                         \
+  while (0)
+
+const uint32_t blake3_iv[8]
+    = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+const uint8_t blake3_schedule[7][16]
+    = { { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+        { 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 },
+        { 3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1 },
+        { 10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6 },
+        { 12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4 },
+        { 9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7 },
+        { 11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13 } };
+
+/*
+ * A node whose compression has been deferred, which is either used as a
+ * chaining value or, for the root, expanded into any amount of output.
+ */
+struct blake3_output
+{
+  uint32_t cv[8];
+  uint8_t block[BLAKE3_BLOCK_SIZE];
+  uint64_t counter;
+  uint8_t blocklen;
+  uint8_t flags;
+};
+
+/* Runs the seven rounds, leaving the state before the feed forward in v. */
+static void
+blake3_compress (uint32_t *v, const uint32_t *cv, const uint8_t *block,
+                 uint8_t blocklen, uint64_t counter, uint8_t flags)
+{
+  uint32_t m[16];
+  uint32_t i;
+
+  for (i = 0; i < 16; ++i)
+    m[i] = buff_get_le32 (block + i * 4);
+  memcpy (v, cv, 32);
+  v[8] = blake3_iv[0];
+  v[9] = blake3_iv[1];
+  v[10] = blake3_iv[2];
+  v[11] = blake3_iv[3];
+  v[12] = (uint32_t)counter;
+  v[13] = (uint32_t)(counter >> 32);
+  v[14] = blocklen;
+  v[15] = flags;
+  for (i = 0; i < 7; ++i)
+    BLAKE3_ROUND (v, m, blake3_schedule[i]);
+}
+
+static void
+blake3_compress_in_place (uint32_t *cv, const uint8_t *block,
+                          uint8_t blocklen, uint64_t counter, uint8_t flags)
+{
+  uint32_t v[16];
+  uint32_t i;
+
+  blake3_compress (v, cv, block, blocklen, counter, flags);
+  for (i = 0; i < 8; ++i)
+    cv[i] = v[i] ^ v[i + 8];
+}
+
+static void
+blake3_hash_many_generic (const uint8_t *const *inputs, size_t count,
+                          size_t blocks, const uint32_t *key, uint64_t counter,
+                          int increment, uint8_t flags, uint8_t flags_start,
+                          uint8_t flags_end, uint8_t *out)
+{
+  uint32_t cv[8];
+  size_t i, j;
+  uint8_t blockflags;
+
+  for (i = 0; i < count; ++i)
+    {
+      memcpy (cv, key, 32);
+      blockflags = flags | flags_start;
+      for (j = 0; j < blocks; ++j)
+        {
+          if (j + 1 == blocks)
+            blockflags |= flags_end;
+          blake3_compress_in_place (cv, inputs[i] + j * BLAKE3_BLOCK_SIZE,
+                                    BLAKE3_BLOCK_SIZE, counter, blockflags);
+          blockflags = flags;
+        }
+      for (j = 0; j < 8; ++j)
+        buff_put_le32 (out + i * BLAKE3_DIGEST_SIZE + j * 4, cv[j]);
+      if (increment)
+        ++counter;
+    }
+}
+
+const struct blake3_backend blake3_backend_generic = {
+  "generic",
+  1,
+  blake3_hash_many_generic,
+};
+
+/*
+ * Backends from the widest down to the portable one, which is always last.
+ * Inputs left over by one backend are passed on to the next.
+ */
+static const struct blake3_backend *blake3_backends[5]
+    = { &blake3_backend_generic };
+static size_t blake3_nbackends = 1;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+blake3_select_backend (void)
+{
+  uint32_t features;
+  size_t n;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+  n = 0;
+#if defined(HAVE_AVX512_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX512F) != 0)
+    blake3_backends[n++] = &blake3_backend_avx512;
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    blake3_backends[n++] = &blake3_backend_avx2;
+#endif
+#if defined(HAVE_SSE41_INTRINSICS)
+  if ((features & (FCRYPT_CPU_SSE41 | FCRYPT_CPU_SSSE3))
+      == (FCRYPT_CPU_SSE41 | FCRYPT_CPU_SSSE3))
+    blake3_backends[n++] = &blake3_backend_sse41;
+#endif
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_NEON) != 0)
+    blake3_backends[n++] = &blake3_backend_neon;
+#endif
+  blake3_backends[n++] = &blake3_backend_generic;
+  blake3_nbackends = n;
+}
+#endif /* __GNUC__ */
+
+const char *
+blake3_backend_name (void)
+{
+  return blake3_backends[0]->name;
+}
+
+static void
+blake3_hash_many (const uint8_t *const *inputs, size_t count, size_t blocks,
+                  const uint32_t *key, uint64_t counter, int increment,
+                  uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                  uint8_t *out)
+{
+  const struct blake3_backend *backend;
+  size_t i, n;
+
+  for (i = 0; i < blake3_nbackends && count > 0; ++i)
+    {
+      backend = blake3_backends[i];
+      n = count - count % backend->degree;
+      if (n == 0)
+        continue;
+      backend->hash_many (inputs, n, blocks, key, counter, increment, flags,
+                          flags_start, flags_end, out);
+      inputs += n;
+      count -= n;
+      out += n * BLAKE3_DIGEST_SIZE;
+      if (increment)
+        counter += n;
+    }
+}
+
+static void
+blake3_output_cv (const struct blake3_output *output, uint8_t *cv)
+{
+  uint32_t words[8];
+  uint32_t i;
+
+  memcpy (words, output->cv, 32);
+  blake3_compress_in_place (words, output->block, output->blocklen,
+                            output->counter, output->flags);
+  for (i = 0; i < 8; ++i)
+    buff_put_le32 (cv + i * 4, words[i]);
+}
+
+static void
+blake3_output_root (const struct blake3_output *output, uint8_t *digest,
+                    size_t digestlen)
+{
+  uint8_t block[BLAKE3_BLOCK_SIZE];
+  uint32_t v[16];
+  uint64_t counter;
+  size_t i, len;
+
+  for (counter = 0; digestlen > 0; ++counter)
+    {
+      blake3_compress (v, output->cv, output->block, output->blocklen,
+                       counter, output->flags | BLAKE3_ROOT);
+      for (i = 0; i < 8; ++i)
+        {
+          buff_put_le32 (block + i * 4, v[i] ^ v[i + 8]);
+          buff_put_le32 (block + 32 + i * 4, v[i + 8] ^ output->cv[i]);
+        }
+      len = digestlen < sizeof (block) ? digestlen : sizeof (block);
+      memcpy (digest, block, len);
+      digest += len;
+      digestlen -= len;
+    }
+  fcrypt_wipe (block, sizeof (block));
+}
+
+static void
+blake3_parent_output (struct blake3_output *output, const uint8_t *block,
+                      const uint32_t *key, uint8_t flags)
+{
+  memcpy (output->cv, key, 32);
+  memcpy (output->block, block, BLAKE3_BLOCK_SIZE);
+  output->counter = 0;
+  output->blocklen = BLAKE3_BLOCK_SIZE;
+  output->flags = flags | BLAKE3_PARENT;
+}
+
+static void
+blake3_chunk_init (struct blake3_chunk *chunk, const uint32_t *key,
+                   uint64_t counter, uint8_t flags)
+{
+  memcpy (chunk->cv, key, 32);
+  chunk->counter = counter;
+  memset (chunk->buffer, 0, sizeof (chunk->buffer));
+  chunk->bufferlen = 0;
+  chunk->blocks = 0;
+  chunk->flags = flags;
+}
+
+static size_t
+blake3_chunk_len (const struct blake3_chunk *chunk)
+{
+  return (size_t)chunk->blocks * BLAKE3_BLOCK_SIZE + chunk->bufferlen;
+}
+
+static uint8_t
+blake3_chunk_flags (const struct blake3_chunk *chunk)
+{
+  return chunk->flags | (chunk->blocks == 0 ? BLAKE3_CHUNK_START : 0);
+}
+
+/*
+ * Absorbs input, which must not run past the end of the chunk. The last
+ * block is always kept in the buffer since it needs the CHUNK_END flag.
+ */
+static void
+blake3_chunk_update (struct blake3_chunk *chunk, const uint8_t *input,
+                     size_t inputlen)
+{
+  size_t take;
+
+  if (chunk->bufferlen > 0)
+    {
+      take = BLAKE3_BLOCK_SIZE - chunk->bufferlen;
+      if (take > inputlen)
+        take = inputlen;
+      memcpy (&chunk->buffer[chunk->bufferlen], input, take);
+      chunk->bufferlen += (uint8_t)take;
+      input += take;
+      inputlen -= take;
+      if (inputlen == 0)
+        return;
+      blake3_compress_in_place (chunk->cv, chunk->buffer, BLAKE3_BLOCK_SIZE,
+                                chunk->counter, blake3_chunk_flags (chunk));
+      chunk->blocks++;
+      chunk->bufferlen = 0;
+      memset (chunk->buffer, 0, sizeof (chunk->buffer));
+    }
+
+  for (; inputlen > BLAKE3_BLOCK_SIZE; inputlen -= BLAKE3_BLOCK_SIZE)
+    {
+      blake3_compress_in_place (chunk->cv, input, BLAKE3_BLOCK_SIZE,
+                                chunk->counter, blake3_chunk_flags (chunk));
+      chunk->blocks++;
+      input += BLAKE3_BLOCK_SIZE;
+    }
+
+  memcpy (chunk->buffer, input, inputlen);
+  chunk->bufferlen = (uint8_t)inputlen;
+}
+
+static void
+blake3_chunk_output (const struct blake3_chunk *chunk,
+                     struct blake3_output *output)
+{
+  memcpy (output->cv, chunk->cv, 32);
+  memcpy (output->block, chunk->buffer, BLAKE3_BLOCK_SIZE);
+  output->counter = chunk->counter;
+  output->blocklen = chunk->bufferlen;
+  output->flags = blake3_chunk_flags (chunk) | BLAKE3_CHUNK_END;
+}
+
+/* Largest power of two not greater than x, which must be positive. */
+static size_t
+blake3_pow2_floor (size_t x)
+{
+  size_t p;
+
+  for (p = 1; p <= x / 2; p <<= 1)
+    ;
+  return p;
+}
+
+/*
+ * Compresses the whole chunks of input side by side and a trailing partial
+ * chunk on its own, returning the number of chaining values written.
+ */
+static size_t
+blake3_compress_chunks (const uint8_t *input, size_t inputlen,
+                        const uint32_t *key, uint64_t counter, uint8_t flags,
+                        uint8_t *out)
+{
+  const uint8_t *chunks[BLAKE3_MAX_DEGREE];
+  struct blake3_chunk chunk;
+  struct blake3_output output;
+  size_t n;
+
+  for (n = 0; inputlen - n * BLAKE3_CHUNK_SIZE >= BLAKE3_CHUNK_SIZE; ++n)
+    chunks[n] = input + n * BLAKE3_CHUNK_SIZE;
+  blake3_hash_many (chunks, n, BLAKE3_CHUNK_SIZE / BLAKE3_BLOCK_SIZE, key,
+                    counter, 1, flags, BLAKE3_CHUNK_START, BLAKE3_CHUNK_END,
+                    out);
+  if (inputlen == n * BLAKE3_CHUNK_SIZE)
+    return n;
+
+  blake3_chunk_init (&chunk, key, counter + n, flags);
+  blake3_chunk_update (&chunk, input + n * BLAKE3_CHUNK_SIZE,
+                       inputlen - n * BLAKE3_CHUNK_SIZE);
+  blake3_chunk_output (&chunk, &output);
+  blake3_output_cv (&output, out + n * BLAKE3_DIGEST_SIZE);
+  return n + 1;
+}
+
+/*
+ * Combines pairs of chaining values into parents side by side, carrying an
+ * odd one up unchanged. Returns the number of values written.
+ */
+static size_t
+blake3_compress_parents (const uint8_t *cvs, size_t count,
+                         const uint32_t *key, uint8_t flags, uint8_t *out)
+{
+  const uint8_t *parents[BLAKE3_MAX_DEGREE];
+  size_t n;
+
+  for (n = 0; count - 2 * n >= 2; ++n)
+    parents[n] = cvs + 2 * n * BLAKE3_DIGEST_SIZE;
+  blake3_hash_many (parents, n, 1, key, 0, 0, flags | BLAKE3_PARENT, 0, 0,
+                    out);
+  if (count == 2 * n)
+    return n;
+
+  memcpy (out + n * BLAKE3_DIGEST_SIZE, cvs + 2 * n * BLAKE3_DIGEST_SIZE,
+          BLAKE3_DIGEST_SIZE);
+  return n + 1;
+}
+
+static size_t blake3_compress_subtree (const uint8_t *, size_t,
+                                       const uint32_t *, uint64_t, uint8_t,
+                                       uint8_t *, unsigned int);
+
+/* One half of a subtree, compressed by a task of the thread pool. */
+struct blake3_subtree_job
+{
+  const uint8_t *input;
+  size_t inputlen;
+  const uint32_t *key;
+  uint64_t counter;
+  uint8_t flags;
+  uint8_t *out;
+  unsigned int threads;
+  size_t count;
+};
+
+static void
+blake3_subtree_task (void *arg, size_t index)
+{
+  struct blake3_subtree_job *job = (struct blake3_subtree_job *)arg + index;
+
+  job->count
+      = blake3_compress_subtree (job->input, job->inputlen, job->key,
+                                 job->counter, job->flags, job->out,
+                                 job->threads);
+}
+
+/*
+ * Compresses a subtree starting at chunk counter down to at most the
+ * degree of the widest backend, or two, chaining values so that they can
+ * still be combined in parallel. Returns the number written to out. With
+ * more than one thread the halves are run as two tasks of the thread pool.
+ */
+static size_t
+blake3_compress_subtree (const uint8_t *input, size_t inputlen,
+                         const uint32_t *key, uint64_t counter, uint8_t flags,
+                         uint8_t *out, unsigned int threads)
+{
+  uint8_t cvs[2 * BLAKE3_MAX_DEGREE * BLAKE3_DIGEST_SIZE];
+  size_t degree, leftlen, leftn, rightn;
+
+  degree = blake3_backends[0]->degree;
+  if (inputlen <= degree * BLAKE3_CHUNK_SIZE)
+    return blake3_compress_chunks (input, inputlen, key, counter, flags, out);
+
+  leftlen = blake3_pow2_floor ((inputlen - 1) / BLAKE3_CHUNK_SIZE)
+            * BLAKE3_CHUNK_SIZE;
+  /* A left side with more than one chunk returns at least two values. */
+  if (leftlen > BLAKE3_CHUNK_SIZE && degree == 1)
+    degree = 2;
+
+  if (threads > 1 && leftlen >= BLAKE3_THREAD_MIN)
+    {
+      struct blake3_subtree_job jobs[2];
+
+      jobs[0].input = input;
+      jobs[0].inputlen = leftlen;
+      jobs[0].counter = counter;
+      jobs[0].out = cvs;
+      jobs[0].threads = threads / 2;
+      jobs[1].input = input + leftlen;
+      jobs[1].inputlen = inputlen - leftlen;
+      jobs[1].counter = counter + leftlen / BLAKE3_CHUNK_SIZE;
+      jobs[1].out = cvs + degree * BLAKE3_DIGEST_SIZE;
+      jobs[1].threads = threads - threads / 2;
+      jobs[0].key = jobs[1].key = key;
+      jobs[0].flags = jobs[1].flags = flags;
+      fcrypt_pool_run (blake3_subtree_task, jobs, 2, 2);
+      leftn = jobs[0].count;
+      rightn = jobs[1].count;
+    }
+  else
+    {
+      leftn = blake3_compress_subtree (input, leftlen, key, counter, flags,
+                                       cvs, 1);
+      rightn = blake3_compress_subtree (
+          input + leftlen, inputlen - leftlen, key,
+          counter + leftlen / BLAKE3_CHUNK_SIZE, flags,
+          cvs + degree * BLAKE3_DIGEST_SIZE, 1);
+    }
+
+  /* Only a single chunk on each side, so this is already a parent. */
+  if (leftn == 1)
+    {
+      memcpy (out, cvs, 2 * BLAKE3_DIGEST_SIZE);
+      return 2;
+    }
+
+  return blake3_compress_parents (cvs, leftn + rightn, key, flags, out);
+}
+
+/*
+ * Compresses a subtree of more than one chunk into the two children of its
+ * root, which are pushed onto the stack separately by the caller.
+ */
+static void
+blake3_compress_subtree_children (const uint8_t *input, size_t inputlen,
+                                  const uint32_t *key, uint64_t counter,
+                                  uint8_t flags, uint8_t *out,
+                                  unsigned int threads)
+{
+  uint8_t cvs[BLAKE3_MAX_DEGREE * BLAKE3_DIGEST_SIZE];
+  uint8_t parents[BLAKE3_MAX_DEGREE * BLAKE3_DIGEST_SIZE / 2];
+  size_t n;
+
+  n = blake3_compress_subtree (input, inputlen, key, counter, flags, cvs,
+                               threads);
+  while (n > 2)
+    {
+      n = blake3_compress_parents (cvs, n, key, flags, parents);
+      memcpy (cvs, parents, n * BLAKE3_DIGEST_SIZE);
+    }
+  memcpy (out, cvs, 2 * BLAKE3_DIGEST_SIZE);
+}
+
+static unsigned int
+blake3_popcount (uint64_t x)
+{
+  unsigned int n;
+
+  for (n = 0; x != 0; ++n)
+    x &= x - 1;
+  return n;
+}
+
+/*
+ * Merges completed subtrees on the stack. One value is left for every bit
+ * set in the number of chunks hashed so far, except the most recent which
+ * is only merged once it is known not to be the root.
+ */
+static void
+blake3_merge_stack (struct blake3_ctx *ctx, uint64_t chunks)
+{
+  struct blake3_output output;
+  uint8_t *top;
+
+  while (ctx->stacklen > blake3_popcount (chunks))
+    {
+      top = &ctx->stack[(ctx->stacklen - 2) * BLAKE3_DIGEST_SIZE];
+      blake3_parent_output (&output, top, ctx->key, ctx->chunk.flags);
+      blake3_output_cv (&output, top);
+      ctx->stacklen--;
+    }
+}
+
+static void
+blake3_push_cv (struct blake3_ctx *ctx, const uint8_t *cv, uint64_t counter)
+{
+  blake3_merge_stack (ctx, counter);
+  memcpy (&ctx->stack[ctx->stacklen * BLAKE3_DIGEST_SIZE], cv,
+          BLAKE3_DIGEST_SIZE);
+  ctx->stacklen++;
+}
+
+static void
+blake3_init_words (struct blake3_ctx *ctx, const uint32_t *key, uint8_t flags)
+{
+  memcpy (ctx->key, key, sizeof (ctx->key));
+  blake3_chunk_init (&ctx->chunk, key, 0, flags);
+  ctx->stacklen = 0;
+}
+
+void
+blake3_init (struct blake3_ctx *ctx)
+{
+  blake3_init_words (ctx, blake3_iv, 0);
+}
+
+void
+blake3_init_key (struct blake3_ctx *ctx, const uint8_t *key)
+{
+  uint32_t words[8];
+  uint32_t i;
+
+  for (i = 0; i < 8; ++i)
+    words[i] = buff_get_le32 (key + i * 4);
+  blake3_init_words (ctx, words, BLAKE3_KEYED_HASH);
+  fcrypt_wipe (words, sizeof (words));
+}
+
+/*
+ * Key derivation mode. The context string should be hardcoded, globally
+ * unique and application specific; the key material is then passed to
+ * blake3_update.
+ */
+void
+blake3_init_derive_key (struct blake3_ctx *ctx, const char *context)
+{
+  uint8_t key[BLAKE3_KEY_SIZE];
+  uint32_t words[8];
+  uint32_t i;
+
+  blake3_init_words (ctx, blake3_iv, BLAKE3_DERIVE_KEY_CONTEXT);
+  blake3_update (ctx, context, strlen (context));
+  blake3_final (key, sizeof (key), ctx);
+  for (i = 0; i < 8; ++i)
+    words[i] = buff_get_le32 (key + i * 4);
+  blake3_init_words (ctx, words, BLAKE3_DERIVE_KEY_MATERIAL);
+  fcrypt_wipe (key, sizeof (key));
+  fcrypt_wipe (words, sizeof (words));
+}
+
+void
+blake3_update_parallel (struct blake3_ctx *ctx, const void *inputptr,
+                        size_t inputlen, unsigned int threads)
+{
+  const uint8_t *input = inputptr;
+  uint8_t cvs[2 * BLAKE3_DIGEST_SIZE];
+  struct blake3_output output;
+  struct blake3_chunk chunk;
+  uint64_t counter;
+  size_t take, subtreelen;
+
+  /* Finish a chunk started by an earlier call. */
+  if (blake3_chunk_len (&ctx->chunk) > 0)
+    {
+      take = BLAKE3_CHUNK_SIZE - blake3_chunk_len (&ctx->chunk);
+      if (take > inputlen)
+        take = inputlen;
+      blake3_chunk_update (&ctx->chunk, input, take);
+      input += take;
+      inputlen -= take;
+      if (inputlen == 0)
+        return;
+      blake3_chunk_output (&ctx->chunk, &output);
+      blake3_output_cv (&output, cvs);
+      blake3_push_cv (ctx, cvs, ctx->chunk.counter);
+      blake3_chunk_init (&ctx->chunk, ctx->key, ctx->chunk.counter + 1,
+                         ctx->chunk.flags);
+    }
+
+  /*
+   * Hash the largest subtrees that the chunks seen so far allow, keeping at
+   * least the last chunk back in case it ends the input.
+   */
+  while (inputlen > BLAKE3_CHUNK_SIZE)
+    {
+      counter = ctx->chunk.counter;
+      subtreelen = blake3_pow2_floor (inputlen);
+      while (((uint64_t)(subtreelen - 1) & (counter * BLAKE3_CHUNK_SIZE))
+             != 0)
+        subtreelen /= 2;
+      if (subtreelen <= BLAKE3_CHUNK_SIZE)
+        {
+          blake3_chunk_init (&chunk, ctx->key, counter, ctx->chunk.flags);
+          blake3_chunk_update (&chunk, input, subtreelen);
+          blake3_chunk_output (&chunk, &output);
+          blake3_output_cv (&output, cvs);
+          blake3_push_cv (ctx, cvs, counter);
+        }
+      else
+        {
+          blake3_compress_subtree_children (input, subtreelen, ctx->key,
+                                            counter, ctx->chunk.flags, cvs,
+                                            threads);
+          blake3_push_cv (ctx, cvs, counter);
+          blake3_push_cv (ctx, cvs + BLAKE3_DIGEST_SIZE,
+                          counter + subtreelen / BLAKE3_CHUNK_SIZE / 2);
+        }
+      ctx->chunk.counter += subtreelen / BLAKE3_CHUNK_SIZE;
+      input += subtreelen;
+      inputlen -= subtreelen;
+    }
+
+  if (inputlen > 0)
+    {
+      blake3_chunk_update (&ctx->chunk, input, inputlen);
+      blake3_merge_stack (ctx, ctx->chunk.counter);
+    }
+}
+
+void
+blake3_update (struct blake3_ctx *ctx, const void *input, size_t inputlen)
+{
+  blake3_update_parallel (ctx, input, inputlen, 1);
+}
+
+void
+blake3_updatev (struct blake3_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    blake3_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
+void
+blake3_final (uint8_t *digest, size_t digestlen, struct blake3_ctx *ctx)
+{
+  struct blake3_output output;
+  uint8_t block[BLAKE3_BLOCK_SIZE];
+  size_t n;
+
+  /* The stack holds left siblings of the path from the last chunk up. */
+  if (ctx->stacklen == 0 || blake3_chunk_len (&ctx->chunk) > 0)
+    {
+      n = ctx->stacklen;
+      blake3_chunk_output (&ctx->chunk, &output);
+    }
+  else
+    {
+      n = ctx->stacklen - 2;
+      blake3_parent_output (&output, &ctx->stack[n * BLAKE3_DIGEST_SIZE],
+                            ctx->key, ctx->chunk.flags);
+    }
+  while (n-- > 0)
+    {
+      memcpy (block, &ctx->stack[n * BLAKE3_DIGEST_SIZE], BLAKE3_DIGEST_SIZE);
+      blake3_output_cv (&output, block + BLAKE3_DIGEST_SIZE);
+      blake3_parent_output (&output, block, ctx->key, ctx->chunk.flags);
+    }
+  blake3_output_root (&output, digest, digestlen);
+  fcrypt_wipe (&output, sizeof (output));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+blake3_copy (struct blake3_ctx *dst, const struct blake3_ctx *src)
+{
+  *dst = *src;
+}
+
+void
+blake3 (uint8_t *digest, const uint8_t *input, const uint8_t *key,
+        const size_t digestlen, const size_t inputlen)
+{
+  blake3_parallel (digest, input, key, digestlen, inputlen, 1);
+}
+
+/* As blake3, with the input split among up to threads threads. */
+void
+blake3_parallel (uint8_t *digest, const uint8_t *input, const uint8_t *key,
+                 const size_t digestlen, const size_t inputlen,
+                 unsigned int threads)
+{
+  struct blake3_ctx ctx;
+
+  if (key == NULL)
+    blake3_init (&ctx);
+  else
+    blake3_init_key (&ctx, key);
+  blake3_update_parallel (&ctx, input, inputlen, threads);
+  blake3_final (digest, digestlen, &ctx);
+}
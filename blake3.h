@@ -0,0 +1,81 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Implementation of BLAKE3, https://github.com/BLAKE3-team/BLAKE3-specs.
+ * Original design by Jack O'Connor, Jean-Philippe Aumasson, Samuel Neves
+ * and Zooko Wilcox-O'Hearn. The output is extendable, so blake3_final takes
+ * the number of bytes to produce.
+ */
+
+#ifndef BLAKE3_H
+#define BLAKE3_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct iovec;
+
+#define BLAKE3_DIGEST_SIZE 32
+#define BLAKE3_KEY_SIZE 32
+#define BLAKE3_BLOCK_SIZE 64
+#define BLAKE3_CHUNK_SIZE 1024
+
+/* Enough chaining values for 2^64 bytes of input. */
+#define BLAKE3_MAX_DEPTH 54
+
+struct blake3_chunk
+{
+  uint32_t cv[8];
+  uint64_t counter;
+  uint8_t buffer[BLAKE3_BLOCK_SIZE];
+  uint8_t bufferlen;
+  uint8_t blocks;
+  uint8_t flags;
+};
+
+struct blake3_ctx
+{
+  uint32_t key[8];
+  struct blake3_chunk chunk;
+  size_t stacklen;
+  uint8_t stack[(BLAKE3_MAX_DEPTH + 1) * BLAKE3_DIGEST_SIZE];
+};
+
+void blake3_init (struct blake3_ctx *);
+void blake3_init_key (struct blake3_ctx *, const uint8_t *);
+void blake3_init_derive_key (struct blake3_ctx *, const char *);
+void blake3_update (struct blake3_ctx *, const void *, size_t);
+void blake3_updatev (struct blake3_ctx *, const struct iovec *, size_t);
+void blake3_update_parallel (struct blake3_ctx *, const void *, size_t,
+                             unsigned int);
+void blake3_final (uint8_t *, size_t, struct blake3_ctx *);
+void blake3_copy (struct blake3_ctx *, const struct blake3_ctx *);
+void blake3 (uint8_t *, const uint8_t *, const uint8_t *, const size_t,
+             const size_t);
+void blake3_parallel (uint8_t *, const uint8_t *, const uint8_t *,
+                      const size_t, const size_t, unsigned int);
+
+#endif /* BLAKE3_H */
@@ -0,0 +1,51 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Definitions shared by blowfish.c and the bcrypt key schedule in bcrypt.c.
+ */
+
+#ifndef BLOWFISH_INTERNAL_H
+#define BLOWFISH_INTERNAL_H
+
+#include <stdint.h>
+
+/*
+ * ((((S1[a] + S2[b]) mod 2^32) XOR S3[c]) + S4[d]) mod 2^32
+ */
+#define F(s, x)                                                               \
+  ((((((s)[(((x) >> 24) & 0xff)] + (s)[0x100 + (((x) >> 16) & 0xff)])         \
+      & 0xffffffff)                                                           \
+     ^ (s)[0x200 + (((x) >> 8) & 0xff)])                                      \
+    + (s)[0x300 + ((x)&0xff)])                                                \
+   & 0xffffffff)
+
+#define BLOWFISH_ROUND(s, p, h1, h2, i) ((h1) ^= F (s, h2) ^ (p)[(i)])
+
+/* Digits of pi that every key schedule starts from. */
+extern const uint32_t blowfish_initial_sbox[1024];
+extern const uint32_t blowfish_initial_parray[18];
+
+#endif /* BLOWFISH_INTERNAL_H */
@@ -27,22 +27,23 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "blowfish-internal.h"
 #include "blowfish.h"
 #include "bswap.h"
 
 /*
- * ((((S1[a] + S2[b]) mod 2^32) XOR S3[c]) + S4[d]) mod 2^32
+ * Number of blocks enciphered side by side by the modes that allow it. Each
+ * round of one block depends on the S-box lookups of the last, so doing
+ * several at once lets the loads of different blocks overlap.
  */
-#define F(s, x)                                                               \
-  ((((((s)[(((x) >> 24) & 0xff)] + (s)[0x100 + (((x) >> 16) & 0xff)])         \
-      & 0xffffffff)                                                           \
-     ^ (s)[0x200 + (((x) >> 8) & 0xff)])                                      \
-    + (s)[0x300 + ((x)&0xff)])                                                \
-   & 0xffffffff)
+#define BLOWFISH_BLOCKS 4
 
-#define BLOWFISH_ROUND(s, p, h1, h2, i) ((h1) ^= F (s, h2) ^ (p)[(i)])
+static void blowfish_encipher_blocks (const struct blowfish_ctx *,
+                                      uint32_t[BLOWFISH_BLOCKS][2]);
+static void blowfish_decipher_blocks (const struct blowfish_ctx *,
+                                      uint32_t[BLOWFISH_BLOCKS][2]);
 
-static const uint32_t blowfish_initial_sbox[1024]
+const uint32_t blowfish_initial_sbox[1024]
     = { 0xd1310ba6, 0x98dfb5ac, 0x2ffd72db, 0xd01adfb7, 0xb8e1afed, 0x6a267e96,
         0xba7c9045, 0xf12c7f99, 0x24a19947, 0xb3916cf7, 0x0801f2e2, 0x858efc16,
         0x636920d8, 0x71574e69, 0xa458fea3, 0xf4933d7e, 0x0d95748f, 0x728eb658,
@@ -215,7 +216,7 @@ static const uint32_t blowfish_initial_sbox[1024]
         0x01c36ae4, 0xd6ebe1f9, 0x90d4f869, 0xa65cdea0, 0x3f09252d, 0xc208e69f,
         0xb74e6132, 0xce77e25b, 0x578fdfe3, 0x3ac372e6 };
 
-static const uint32_t blowfish_initial_parray[18] = {
+const uint32_t blowfish_initial_parray[18] = {
   0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, 0xa4093822, 0x299f31d0,
   0x082efa98, 0xec4e6c89, 0x452821e6, 0x38d01377, 0xbe5466cf, 0x34e90c6c,
   0xc0ac29b7, 0xc97c50dd, 0x3f84d5b5, 0xb5470917, 0x9216d5d9, 0x8979fb1b
@@ -327,8 +328,26 @@ void
 blowfish_ecb_encrypt (struct blowfish_ctx *ctx, const uint8_t *src,
                       uint8_t *dest, size_t len)
 {
+  uint32_t x[BLOWFISH_BLOCKS][2];
   uint32_t block[2];
+  size_t b;
 
+  for (; len >= BLOWFISH_BLOCKS * 8; len -= BLOWFISH_BLOCKS * 8,
+                                     src += BLOWFISH_BLOCKS * 8,
+                                     dest += BLOWFISH_BLOCKS * 8)
+    {
+      for (b = 0; b < BLOWFISH_BLOCKS; ++b)
+        {
+          x[b][0] = buff_get_be32 (src + b * 8);
+          x[b][1] = buff_get_be32 (src + b * 8 + 4);
+        }
+      blowfish_encipher_blocks (ctx, x);
+      for (b = 0; b < BLOWFISH_BLOCKS; ++b)
+        {
+          buff_put_be32 (dest + b * 8, x[b][0]);
+          buff_put_be32 (dest + b * 8 + 4, x[b][1]);
+        }
+    }
   for (; len >= 8; len -= 8, src += 8, dest += 8)
     {
       block[0] = buff_get_be32 (src);
@@ -343,8 +362,26 @@ void
 blowfish_ecb_decrypt (struct blowfish_ctx *ctx, const uint8_t *src,
                       uint8_t *dest, size_t len)
 {
+  uint32_t x[BLOWFISH_BLOCKS][2];
   uint32_t block[2];
+  size_t b;
 
+  for (; len >= BLOWFISH_BLOCKS * 8; len -= BLOWFISH_BLOCKS * 8,
+                                     src += BLOWFISH_BLOCKS * 8,
+                                     dest += BLOWFISH_BLOCKS * 8)
+    {
+      for (b = 0; b < BLOWFISH_BLOCKS; ++b)
+        {
+          x[b][0] = buff_get_be32 (src + b * 8);
+          x[b][1] = buff_get_be32 (src + b * 8 + 4);
+        }
+      blowfish_decipher_blocks (ctx, x);
+      for (b = 0; b < BLOWFISH_BLOCKS; ++b)
+        {
+          buff_put_be32 (dest + b * 8, x[b][0]);
+          buff_put_be32 (dest + b * 8 + 4, x[b][1]);
+        }
+    }
   for (; len >= 8; len -= 8, src += 8, dest += 8)
     {
       block[0] = buff_get_be32 (src);
@@ -354,3 +391,216 @@ blowfish_ecb_decrypt (struct blowfish_ctx *ctx, const uint8_t *src,
       buff_put_be32 (dest + 4, block[1]);
     }
 }
+
+/* One round of four blocks, from the halves h1 into the halves h2. */
+#define BLOWFISH_ROUND4(s, p, h1, h2, i)                                      \
+  do                                                                          \
+    {                                                                         \
+      BLOWFISH_ROUND (s, p, h1##0, h2##0, i);                                 \
+      BLOWFISH_ROUND (s, p, h1##1, h2##1, i);                                 \
+      BLOWFISH_ROUND (s, p, h1##2, h2##2, i);                                 \
+      BLOWFISH_ROUND (s, p, h1##3, h2##3, i);                                 \
+    }                                                                         \
+  while (0)
+
+static void
+blowfish_encipher_blocks (const struct blowfish_ctx *ctx,
+                          uint32_t x[BLOWFISH_BLOCKS][2])
+{
+  uint32_t l0, l1, l2, l3, r0, r1, r2, r3;
+  const uint32_t *p = ctx->p;
+  const uint32_t *s = ctx->s;
+
+  l0 = x[0][0] ^ p[0];
+  l1 = x[1][0] ^ p[0];
+  l2 = x[2][0] ^ p[0];
+  l3 = x[3][0] ^ p[0];
+  r0 = x[0][1];
+  r1 = x[1][1];
+  r2 = x[2][1];
+  r3 = x[3][1];
+  BLOWFISH_ROUND4 (s, p, r, l, 1);
+  BLOWFISH_ROUND4 (s, p, l, r, 2);
+  BLOWFISH_ROUND4 (s, p, r, l, 3);
+  BLOWFISH_ROUND4 (s, p, l, r, 4);
+  BLOWFISH_ROUND4 (s, p, r, l, 5);
+  BLOWFISH_ROUND4 (s, p, l, r, 6);
+  BLOWFISH_ROUND4 (s, p, r, l, 7);
+  BLOWFISH_ROUND4 (s, p, l, r, 8);
+  BLOWFISH_ROUND4 (s, p, r, l, 9);
+  BLOWFISH_ROUND4 (s, p, l, r, 10);
+  BLOWFISH_ROUND4 (s, p, r, l, 11);
+  BLOWFISH_ROUND4 (s, p, l, r, 12);
+  BLOWFISH_ROUND4 (s, p, r, l, 13);
+  BLOWFISH_ROUND4 (s, p, l, r, 14);
+  BLOWFISH_ROUND4 (s, p, r, l, 15);
+  BLOWFISH_ROUND4 (s, p, l, r, 16);
+  x[0][0] = r0 ^ p[17];
+  x[1][0] = r1 ^ p[17];
+  x[2][0] = r2 ^ p[17];
+  x[3][0] = r3 ^ p[17];
+  x[0][1] = l0;
+  x[1][1] = l1;
+  x[2][1] = l2;
+  x[3][1] = l3;
+}
+
+static void
+blowfish_decipher_blocks (const struct blowfish_ctx *ctx,
+                          uint32_t x[BLOWFISH_BLOCKS][2])
+{
+  uint32_t l0, l1, l2, l3, r0, r1, r2, r3;
+  const uint32_t *p = ctx->p;
+  const uint32_t *s = ctx->s;
+
+  l0 = x[0][0] ^ p[17];
+  l1 = x[1][0] ^ p[17];
+  l2 = x[2][0] ^ p[17];
+  l3 = x[3][0] ^ p[17];
+  r0 = x[0][1];
+  r1 = x[1][1];
+  r2 = x[2][1];
+  r3 = x[3][1];
+  BLOWFISH_ROUND4 (s, p, r, l, 16);
+  BLOWFISH_ROUND4 (s, p, l, r, 15);
+  BLOWFISH_ROUND4 (s, p, r, l, 14);
+  BLOWFISH_ROUND4 (s, p, l, r, 13);
+  BLOWFISH_ROUND4 (s, p, r, l, 12);
+  BLOWFISH_ROUND4 (s, p, l, r, 11);
+  BLOWFISH_ROUND4 (s, p, r, l, 10);
+  BLOWFISH_ROUND4 (s, p, l, r, 9);
+  BLOWFISH_ROUND4 (s, p, r, l, 8);
+  BLOWFISH_ROUND4 (s, p, l, r, 7);
+  BLOWFISH_ROUND4 (s, p, r, l, 6);
+  BLOWFISH_ROUND4 (s, p, l, r, 5);
+  BLOWFISH_ROUND4 (s, p, r, l, 4);
+  BLOWFISH_ROUND4 (s, p, l, r, 3);
+  BLOWFISH_ROUND4 (s, p, r, l, 2);
+  BLOWFISH_ROUND4 (s, p, l, r, 1);
+  x[0][0] = r0 ^ p[0];
+  x[1][0] = r1 ^ p[0];
+  x[2][0] = r2 ^ p[0];
+  x[3][0] = r3 ^ p[0];
+  x[0][1] = l0;
+  x[1][1] = l1;
+  x[2][1] = l2;
+  x[3][1] = l3;
+}
+
+void
+blowfish_cbc_encrypt (struct blowfish_ctx *ctx, uint8_t *iv,
+                      const uint8_t *src, uint8_t *dest, size_t len)
+{
+  uint32_t block[2];
+
+  block[0] = buff_get_be32 (iv);
+  block[1] = buff_get_be32 (iv + 4);
+  for (; len >= BLOWFISH_BLOCK_SIZE; len -= BLOWFISH_BLOCK_SIZE,
+                                     src += BLOWFISH_BLOCK_SIZE,
+                                     dest += BLOWFISH_BLOCK_SIZE)
+    {
+      block[0] ^= buff_get_be32 (src);
+      block[1] ^= buff_get_be32 (src + 4);
+      blowfish_encipher (ctx, block);
+      buff_put_be32 (dest, block[0]);
+      buff_put_be32 (dest + 4, block[1]);
+    }
+  buff_put_be32 (iv, block[0]);
+  buff_put_be32 (iv + 4, block[1]);
+}
+
+/*
+ * The blocks are deciphered BLOWFISH_BLOCKS at a time. The ciphertext is
+ * kept until the plaintext is written, so src and dest may be the same.
+ */
+void
+blowfish_cbc_decrypt (struct blowfish_ctx *ctx, uint8_t *iv,
+                      const uint8_t *src, uint8_t *dest, size_t len)
+{
+  uint32_t x[BLOWFISH_BLOCKS][2];
+  uint32_t c[BLOWFISH_BLOCKS][2];
+  uint32_t prev[2];
+  size_t b, n;
+
+  prev[0] = buff_get_be32 (iv);
+  prev[1] = buff_get_be32 (iv + 4);
+  memset (c, 0, sizeof (c));
+  while (len >= BLOWFISH_BLOCK_SIZE)
+    {
+      n = len / BLOWFISH_BLOCK_SIZE;
+      if (n > BLOWFISH_BLOCKS)
+        n = BLOWFISH_BLOCKS;
+      for (b = 0; b < n; ++b)
+        {
+          c[b][0] = buff_get_be32 (src + b * BLOWFISH_BLOCK_SIZE);
+          c[b][1] = buff_get_be32 (src + b * BLOWFISH_BLOCK_SIZE + 4);
+        }
+      memcpy (x, c, sizeof (x));
+      blowfish_decipher_blocks (ctx, x);
+      for (b = 0; b < n; ++b)
+        {
+          buff_put_be32 (dest + b * BLOWFISH_BLOCK_SIZE, x[b][0] ^ prev[0]);
+          buff_put_be32 (dest + b * BLOWFISH_BLOCK_SIZE + 4,
+                         x[b][1] ^ prev[1]);
+          prev[0] = c[b][0];
+          prev[1] = c[b][1];
+        }
+      src += n * BLOWFISH_BLOCK_SIZE;
+      dest += n * BLOWFISH_BLOCK_SIZE;
+      len -= n * BLOWFISH_BLOCK_SIZE;
+    }
+  buff_put_be32 (iv, prev[0]);
+  buff_put_be32 (iv + 4, prev[1]);
+}
+
+/*
+ * CTR mode with the whole block as a 64-bit big-endian counter. A trailing
+ * partial block uses up a counter value, like the AES CTR functions.
+ */
+void
+blowfish_ctr_crypt (struct blowfish_ctx *ctx, uint8_t *ctr,
+                    const uint8_t *src, uint8_t *dest, size_t len)
+{
+  uint32_t x[BLOWFISH_BLOCKS][2];
+  uint8_t keystream[BLOWFISH_BLOCK_SIZE];
+  uint64_t counter;
+  size_t b, i, n;
+
+  counter = buff_get_be64 (ctr);
+  while (len > 0)
+    {
+      n = (len + BLOWFISH_BLOCK_SIZE - 1) / BLOWFISH_BLOCK_SIZE;
+      if (n > BLOWFISH_BLOCKS)
+        n = BLOWFISH_BLOCKS;
+
+      /* Only advance the counter past the blocks that get used. */
+      for (b = 0; b < BLOWFISH_BLOCKS; ++b)
+        {
+          x[b][0] = (uint32_t)(counter >> 32);
+          x[b][1] = (uint32_t)counter;
+          if (b < n)
+            ++counter;
+        }
+
+      blowfish_encipher_blocks (ctx, x);
+      for (b = 0; b < n && len >= BLOWFISH_BLOCK_SIZE; ++b)
+        {
+          buff_put_be32 (dest, buff_get_be32 (src) ^ x[b][0]);
+          buff_put_be32 (dest + 4, buff_get_be32 (src + 4) ^ x[b][1]);
+          src += BLOWFISH_BLOCK_SIZE;
+          dest += BLOWFISH_BLOCK_SIZE;
+          len -= BLOWFISH_BLOCK_SIZE;
+        }
+
+      /* Partial trailing block. */
+      if (b < n)
+        {
+          buff_put_be32 (keystream, x[b][0]);
+          buff_put_be32 (keystream + 4, x[b][1]);
+          for (i = 0; i < len; ++i)
+            dest[i] = src[i] ^ keystream[i];
+          len = 0;
+        }
+    }
+  buff_put_be64 (ctr, counter);
+}
@@ -29,10 +29,15 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fcrypt_align.h"
+
+#define BLOWFISH_BLOCK_SIZE 8
+
+/* Each of the four S-boxes starts on a cache line. */
 struct blowfish_ctx
 {
-  uint32_t p[18];
-  uint32_t s[1024];
+  FCRYPT_CACHE_ALIGNED uint32_t p[18];
+  FCRYPT_CACHE_ALIGNED uint32_t s[1024];
 };
 
 void blowfish_set_key (struct blowfish_ctx *, const uint8_t *, size_t);
@@ -42,5 +47,11 @@ void blowfish_ecb_encrypt (struct blowfish_ctx *, const uint8_t *, uint8_t *,
                            size_t);
 void blowfish_ecb_decrypt (struct blowfish_ctx *, const uint8_t *, uint8_t *,
                            size_t);
+void blowfish_cbc_encrypt (struct blowfish_ctx *, uint8_t *, const uint8_t *,
+                           uint8_t *, size_t);
+void blowfish_cbc_decrypt (struct blowfish_ctx *, uint8_t *, const uint8_t *,
+                           uint8_t *, size_t);
+void blowfish_ctr_crypt (struct blowfish_ctx *, uint8_t *, const uint8_t *,
+                         uint8_t *, size_t);
 
 #endif /* BLOWFISH_H */
@@ -26,7 +26,9 @@
 #ifndef BSWAP_H
 #define BSWAP_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #undef bswap16
 #undef bswap32
@@ -126,130 +128,152 @@
 #error "Unknown byte-order"
 #endif
 
+/*
+ * Loads and stores of words at any alignment. The memcpy is turned into a
+ * single unaligned access, and the swap into a BSWAP or MOVBE on x86 and a
+ * REV on ARM, where assembling the word a byte at a time is not always
+ * recognized.
+ */
+
 static inline uint16_t
 buff_get_be16 (const void *inputptr)
 {
-  uint8_t const *ptr = (uint8_t const *)inputptr;
+  uint16_t val;
 
-  return ((uint16_t)ptr[0] << 8) | ((uint16_t)ptr[1]);
+  memcpy (&val, inputptr, sizeof (val));
+  return be16_to_cpu (val);
 }
 
-static inline uint32_t
-buff_get_be32 (const void *inputptr)
+static inline uint16_t
+buff_get_le16 (const void *inputptr)
 {
-  uint8_t const *ptr = (uint8_t const *)inputptr;
+  uint16_t val;
 
-  return ((uint32_t)ptr[0] << 24) | ((uint32_t)ptr[1] << 16)
-         | ((uint32_t)ptr[2] << 8) | ((uint32_t)ptr[3]);
+  memcpy (&val, inputptr, sizeof (val));
+  return le16_to_cpu (val);
 }
 
-static inline uint64_t
-buff_get_be64 (const void *inputptr)
+static inline uint32_t
+buff_get_be32 (const void *inputptr)
 {
-  uint8_t const *ptr = (uint8_t const *)inputptr;
+  uint32_t val;
 
-  return ((uint64_t)ptr[0] << 56) | ((uint64_t)ptr[1] << 48)
-         | ((uint64_t)ptr[2] << 40) | ((uint64_t)ptr[3] << 32)
-         | ((uint64_t)ptr[4] << 24) | ((uint64_t)ptr[5] << 16)
-         | ((uint64_t)ptr[6] << 8) | ((uint64_t)ptr[7]);
+  memcpy (&val, inputptr, sizeof (val));
+  return be32_to_cpu (val);
 }
 
-static inline uint16_t
-buff_get_le16 (const void *inputptr)
+static inline uint32_t
+buff_get_le32 (const void *inputptr)
 {
-  uint8_t const *ptr = (uint8_t const *)inputptr;
+  uint32_t val;
 
-  return ((uint16_t)ptr[1] << 8) | ((uint16_t)ptr[0]);
+  memcpy (&val, inputptr, sizeof (val));
+  return le32_to_cpu (val);
 }
 
-static inline uint32_t
-buff_get_le32 (const void *inputptr)
+static inline uint64_t
+buff_get_be64 (const void *inputptr)
 {
-  uint8_t const *ptr = (uint8_t const *)inputptr;
+  uint64_t val;
 
-  return ((uint32_t)ptr[3] << 24) | ((uint32_t)ptr[2] << 16)
-         | ((uint32_t)ptr[1] << 8) | ((uint32_t)ptr[0]);
+  memcpy (&val, inputptr, sizeof (val));
+  return be64_to_cpu (val);
 }
 
 static inline uint64_t
 buff_get_le64 (const void *inputptr)
 {
-  uint8_t const *ptr = (uint8_t const *)inputptr;
+  uint64_t val;
 
-  return ((uint64_t)ptr[7] << 56) | ((uint64_t)ptr[6] << 48)
-         | ((uint64_t)ptr[5] << 40) | ((uint64_t)ptr[4] << 32)
-         | ((uint64_t)ptr[3] << 24) | ((uint64_t)ptr[2] << 16)
-         | ((uint64_t)ptr[1] << 8) | ((uint64_t)ptr[0]);
+  memcpy (&val, inputptr, sizeof (val));
+  return le64_to_cpu (val);
 }
 
 static inline void
 buff_put_be16 (void *inputptr, uint16_t val)
 {
-  uint8_t *ptr = (uint8_t *)inputptr;
+  val = cpu_to_be16 (val);
+  memcpy (inputptr, &val, sizeof (val));
+}
 
-  ptr[0] = (val >> 8) & 0xff;
-  ptr[1] = val & 0xff;
+static inline void
+buff_put_le16 (void *inputptr, uint16_t val)
+{
+  val = cpu_to_le16 (val);
+  memcpy (inputptr, &val, sizeof (val));
 }
 
 static inline void
 buff_put_be32 (void *inputptr, uint32_t val)
 {
-  uint8_t *ptr = (uint8_t *)inputptr;
+  val = cpu_to_be32 (val);
+  memcpy (inputptr, &val, sizeof (val));
+}
 
-  ptr[0] = (val >> 24) & 0xff;
-  ptr[1] = (val >> 16) & 0xff;
-  ptr[2] = (val >> 8) & 0xff;
-  ptr[3] = val & 0xff;
+static inline void
+buff_put_le32 (void *inputptr, uint32_t val)
+{
+  val = cpu_to_le32 (val);
+  memcpy (inputptr, &val, sizeof (val));
 }
 
 static inline void
 buff_put_be64 (void *inputptr, uint64_t val)
 {
-  uint8_t *ptr = (uint8_t *)inputptr;
+  val = cpu_to_be64 (val);
+  memcpy (inputptr, &val, sizeof (val));
+}
 
-  ptr[0] = (val >> 56) & 0xff;
-  ptr[1] = (val >> 48) & 0xff;
-  ptr[2] = (val >> 40) & 0xff;
-  ptr[3] = (val >> 32) & 0xff;
-  ptr[4] = (val >> 24) & 0xff;
-  ptr[5] = (val >> 16) & 0xff;
-  ptr[6] = (val >> 8) & 0xff;
-  ptr[7] = val & 0xff;
+static inline void
+buff_put_le64 (void *inputptr, uint64_t val)
+{
+  val = cpu_to_le64 (val);
+  memcpy (inputptr, &val, sizeof (val));
 }
 
+/*
+ * Loads count words at once, such as a whole message block before the
+ * compression function. The loop only swaps words that are already in
+ * registers, so the compiler vectorizes it into byte shuffles.
+ */
 static inline void
-buff_put_le16 (void *inputptr, uint16_t val)
+buff_get_be32_words (uint32_t *words, const void *inputptr, size_t count)
 {
-  uint8_t *ptr = (uint8_t *)inputptr;
+  size_t i;
 
-  ptr[0] = val & 0xff;
-  ptr[1] = (val >> 8) & 0xff;
+  memcpy (words, inputptr, count * sizeof (*words));
+  for (i = 0; i < count; ++i)
+    words[i] = be32_to_cpu (words[i]);
 }
 
 static inline void
-buff_put_le32 (void *inputptr, uint32_t val)
+buff_get_le32_words (uint32_t *words, const void *inputptr, size_t count)
 {
-  uint8_t *ptr = (uint8_t *)inputptr;
+  size_t i;
 
-  ptr[0] = val & 0xff;
-  ptr[1] = (val >> 8) & 0xff;
-  ptr[2] = (val >> 16) & 0xff;
-  ptr[3] = (val >> 24) & 0xff;
+  memcpy (words, inputptr, count * sizeof (*words));
+  for (i = 0; i < count; ++i)
+    words[i] = le32_to_cpu (words[i]);
 }
 
 static inline void
-buff_put_le64 (void *inputptr, uint64_t val)
+buff_get_be64_words (uint64_t *words, const void *inputptr, size_t count)
+{
+  size_t i;
+
+  memcpy (words, inputptr, count * sizeof (*words));
+  for (i = 0; i < count; ++i)
+    words[i] = be64_to_cpu (words[i]);
+}
+
+static inline void
+buff_get_le64_words (uint64_t *words, const void *inputptr, size_t count)
 {
-  uint8_t *ptr = (uint8_t *)inputptr;
+  size_t i;
 
-  ptr[0] = val & 0xff;
-  ptr[1] = (val >> 8) & 0xff;
-  ptr[2] = (val >> 16) & 0xff;
-  ptr[3] = (val >> 24) & 0xff;
-  ptr[4] = (val >> 32) & 0xff;
-  ptr[5] = (val >> 40) & 0xff;
-  ptr[6] = (val >> 48) & 0xff;
-  ptr[7] = (val >> 56) & 0xff;
+  memcpy (words, inputptr, count * sizeof (*words));
+  for (i = 0; i < count; ++i)
+    words[i] = le64_to_cpu (words[i]);
 }
 
 #endif /* BSWAP_H */
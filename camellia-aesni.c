@@ -0,0 +1,291 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Camellia CTR mode sixteen blocks at a time using AES-NI, after "Block
+ * Ciphers: Fast Implementations on x86-64 Architecture" by Jussi Kivilinna.
+ * The blocks are transposed so that each register holds one byte position
+ * of all sixteen blocks. Camellia's S-boxes are the inversion in GF(2^8)
+ * like the AES S-box but in another basis, so each is computed as an affine
+ * map, AESENCLAST with a zero round key and another affine map. The affine
+ * maps are two PSHUFB lookups on the nibbles, with the tables generated by
+ * make-camellia-sboxes.c. Unlike the table code this runs in constant time.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bswap.h"
+#include "camellia-internal.h"
+#include "camellia.h"
+
+#if defined(HAVE_AESNI_INTRINSICS)
+
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#include "camellia-aesni-tables.h"
+
+#define AESNI_TARGET __attribute__ ((target (AESNI_TARGET_ATTRIBUTE)))
+
+/* Most subkeys of any key size. */
+#define CAMELLIA_MAX_SUBKEYS 34
+
+/*
+ * Applies an affine map given as the tables for the low and high nibble of
+ * each byte.
+ */
+AESNI_TARGET static inline __m128i
+camellia_aesni_filter (__m128i x, const uint8_t (*table)[16])
+{
+  const __m128i mask = _mm_set1_epi8 (0x0f);
+  __m128i lo, hi;
+
+  lo = _mm_and_si128 (x, mask);
+  hi = _mm_and_si128 (_mm_srli_epi16 (x, 4), mask);
+  lo = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *)table[0]), lo);
+  hi = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *)table[1]), hi);
+  return _mm_xor_si128 (lo, hi);
+}
+
+/*
+ * One of the S-boxes on all sixteen bytes. AESENCLAST also does ShiftRows,
+ * which the byte shuffle before it undoes.
+ */
+AESNI_TARGET static inline __m128i
+camellia_aesni_sbox (__m128i x, const uint8_t (*pre)[16],
+                     const uint8_t (*post)[16])
+{
+  const __m128i inv_shift_rows
+      = _mm_setr_epi8 (0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3);
+
+  x = camellia_aesni_filter (x, pre);
+  x = _mm_shuffle_epi8 (x, inv_shift_rows);
+  x = _mm_aesenclast_si128 (x, _mm_setzero_si128 ());
+  return camellia_aesni_filter (x, post);
+}
+
+/* Computes d[0..7] ^= F (x[0..7], k) with the bytes in separate registers. */
+AESNI_TARGET static inline void
+camellia_aesni_round (__m128i *d, const __m128i *x, const __m128i *k)
+{
+  __m128i y1, y2, y3, y4, y5, y6, y7, y8;
+  __m128i a, b, c, e;
+
+  y1 = camellia_aesni_sbox (_mm_xor_si128 (x[0], k[0]), camellia_aesni_pre_s1,
+                            camellia_aesni_post_s1);
+  y2 = camellia_aesni_sbox (_mm_xor_si128 (x[1], k[1]), camellia_aesni_pre_s1,
+                            camellia_aesni_post_s2);
+  y3 = camellia_aesni_sbox (_mm_xor_si128 (x[2], k[2]), camellia_aesni_pre_s1,
+                            camellia_aesni_post_s3);
+  y4 = camellia_aesni_sbox (_mm_xor_si128 (x[3], k[3]), camellia_aesni_pre_s4,
+                            camellia_aesni_post_s1);
+  y5 = camellia_aesni_sbox (_mm_xor_si128 (x[4], k[4]), camellia_aesni_pre_s1,
+                            camellia_aesni_post_s2);
+  y6 = camellia_aesni_sbox (_mm_xor_si128 (x[5], k[5]), camellia_aesni_pre_s1,
+                            camellia_aesni_post_s3);
+  y7 = camellia_aesni_sbox (_mm_xor_si128 (x[6], k[6]), camellia_aesni_pre_s4,
+                            camellia_aesni_post_s1);
+  y8 = camellia_aesni_sbox (_mm_xor_si128 (x[7], k[7]), camellia_aesni_pre_s1,
+                            camellia_aesni_post_s1);
+
+  /* The P-function, sharing the XORs that several outputs have in common. */
+  a = _mm_xor_si128 (y1, y8);
+  b = _mm_xor_si128 (y4, y7);
+  c = _mm_xor_si128 (y3, y6);
+  e = _mm_xor_si128 (y2, y5);
+  d[0] = _mm_xor_si128 (d[0], _mm_xor_si128 (_mm_xor_si128 (a, b), c));
+  d[1] = _mm_xor_si128 (d[1], _mm_xor_si128 (_mm_xor_si128 (a, b), e));
+  d[2] = _mm_xor_si128 (d[2], _mm_xor_si128 (_mm_xor_si128 (a, c), e));
+  d[3] = _mm_xor_si128 (d[3], _mm_xor_si128 (_mm_xor_si128 (b, c), e));
+  d[4] = _mm_xor_si128 (
+      d[4], _mm_xor_si128 (_mm_xor_si128 (a, y2), _mm_xor_si128 (y6, y7)));
+  d[5] = _mm_xor_si128 (
+      d[5], _mm_xor_si128 (_mm_xor_si128 (e, y3), _mm_xor_si128 (y7, y8)));
+  d[6] = _mm_xor_si128 (
+      d[6], _mm_xor_si128 (_mm_xor_si128 (c, y4), _mm_xor_si128 (y5, y8)));
+  d[7] = _mm_xor_si128 (
+      d[7], _mm_xor_si128 (_mm_xor_si128 (b, y1), _mm_xor_si128 (y5, y6)));
+}
+
+/* Rotates the four bytes of a 32-bit word left by one bit. */
+AESNI_TARGET static inline void
+camellia_aesni_rotl1 (__m128i *r, const __m128i *t)
+{
+  const __m128i one = _mm_set1_epi8 (1);
+  __m128i carry[4];
+  int j;
+
+  for (j = 0; j < 4; ++j)
+    carry[j] = _mm_and_si128 (_mm_srli_epi16 (t[j], 7), one);
+  for (j = 0; j < 4; ++j)
+    r[j] = _mm_or_si128 (_mm_add_epi8 (t[j], t[j]), carry[(j + 1) & 3]);
+}
+
+/* FL on x[0..7] and FL^-1 on x[8..15]. */
+AESNI_TARGET static inline void
+camellia_aesni_fl (__m128i *x, const __m128i *kl, const __m128i *kr)
+{
+  __m128i t[4], r[4];
+  int j;
+
+  for (j = 0; j < 4; ++j)
+    t[j] = _mm_and_si128 (x[j], kl[j]);
+  camellia_aesni_rotl1 (r, t);
+  for (j = 0; j < 4; ++j)
+    {
+      x[4 + j] = _mm_xor_si128 (x[4 + j], r[j]);
+      x[j] = _mm_xor_si128 (x[j], _mm_or_si128 (x[4 + j], kl[4 + j]));
+    }
+
+  for (j = 0; j < 4; ++j)
+    {
+      x[8 + j] = _mm_xor_si128 (x[8 + j], _mm_or_si128 (x[12 + j], kr[4 + j]));
+      t[j] = _mm_and_si128 (x[8 + j], kr[j]);
+    }
+  camellia_aesni_rotl1 (r, t);
+  for (j = 0; j < 4; ++j)
+    x[12 + j] = _mm_xor_si128 (x[12 + j], r[j]);
+}
+
+/*
+ * Transposes sixteen rows of sixteen bytes, turning blocks into byte
+ * positions and back.
+ */
+AESNI_TARGET static void
+camellia_aesni_transpose (__m128i *x)
+{
+  __m128i a[8][2], b[4][4], c[2][8];
+  int i, j;
+
+  for (i = 0; i < 8; ++i)
+    {
+      a[i][0] = _mm_unpacklo_epi8 (x[2 * i], x[2 * i + 1]);
+      a[i][1] = _mm_unpackhi_epi8 (x[2 * i], x[2 * i + 1]);
+    }
+  for (i = 0; i < 4; ++i)
+    for (j = 0; j < 4; j += 2)
+      {
+        b[i][j] = _mm_unpacklo_epi16 (a[2 * i][j / 2], a[2 * i + 1][j / 2]);
+        b[i][j + 1]
+            = _mm_unpackhi_epi16 (a[2 * i][j / 2], a[2 * i + 1][j / 2]);
+      }
+  for (i = 0; i < 2; ++i)
+    for (j = 0; j < 8; j += 2)
+      {
+        c[i][j] = _mm_unpacklo_epi32 (b[2 * i][j / 2], b[2 * i + 1][j / 2]);
+        c[i][j + 1]
+            = _mm_unpackhi_epi32 (b[2 * i][j / 2], b[2 * i + 1][j / 2]);
+      }
+  for (j = 0; j < 16; j += 2)
+    {
+      x[j] = _mm_unpacklo_epi64 (c[0][j / 2], c[1][j / 2]);
+      x[j + 1] = _mm_unpackhi_epi64 (c[0][j / 2], c[1][j / 2]);
+    }
+}
+
+AESNI_TARGET static void
+camellia_aesni_encrypt16 (const __m128i (*k)[8], unsigned int rounds,
+                          __m128i *x)
+{
+  unsigned int i, r;
+
+  for (i = 0; i < 8; ++i)
+    {
+      x[i] = _mm_xor_si128 (x[i], k[0][i]);
+      x[8 + i] = _mm_xor_si128 (x[8 + i], k[1][i]);
+    }
+  k += 2;
+  for (r = 0; r < rounds; r += 6)
+    {
+      if (r > 0)
+        {
+          camellia_aesni_fl (x, k[0], k[1]);
+          k += 2;
+        }
+      camellia_aesni_round (x + 8, x, k[0]);
+      camellia_aesni_round (x, x + 8, k[1]);
+      camellia_aesni_round (x + 8, x, k[2]);
+      camellia_aesni_round (x, x + 8, k[3]);
+      camellia_aesni_round (x + 8, x, k[4]);
+      camellia_aesni_round (x, x + 8, k[5]);
+      k += 6;
+    }
+  for (i = 0; i < 8; ++i)
+    {
+      x[8 + i] = _mm_xor_si128 (x[8 + i], k[0][i]);
+      x[i] = _mm_xor_si128 (x[i], k[1][i]);
+    }
+}
+
+AESNI_TARGET void
+camellia_ctr_blocks_aesni (const uint64_t *ek, unsigned int rounds,
+                           uint64_t *hi, uint64_t *lo, const uint8_t *src,
+                           uint8_t *dest, size_t blocks)
+{
+  __m128i k[CAMELLIA_MAX_SUBKEYS][8];
+  __m128i x[CAMELLIA_AESNI_BLOCKS], y[CAMELLIA_AESNI_BLOCKS];
+  uint8_t ctr[CAMELLIA_AESNI_BLOCKS][CAMELLIA_BLOCK_SIZE];
+  size_t nkeys, i, j;
+
+  /* Every byte of every subkey broadcast to a whole register. */
+  nkeys = rounds == CAMELLIA128_ROUNDS ? 26 : 34;
+  for (i = 0; i < nkeys; ++i)
+    for (j = 0; j < 8; ++j)
+      k[i][j] = _mm_set1_epi8 ((char)(ek[i] >> (56 - 8 * j)));
+
+  for (; blocks > 0; blocks -= CAMELLIA_AESNI_BLOCKS)
+    {
+      for (i = 0; i < CAMELLIA_AESNI_BLOCKS; ++i)
+        {
+          buff_put_be64 (ctr[i], *hi);
+          buff_put_be64 (ctr[i] + 8, *lo);
+          if (++*lo == 0)
+            ++*hi;
+          x[i] = _mm_loadu_si128 ((const __m128i *)ctr[i]);
+        }
+      camellia_aesni_transpose (x);
+      camellia_aesni_encrypt16 ((const __m128i (*)[8])k, rounds, x);
+
+      /* The output block is the right half followed by the left. */
+      for (i = 0; i < 8; ++i)
+        {
+          y[i] = x[8 + i];
+          y[8 + i] = x[i];
+        }
+      camellia_aesni_transpose (y);
+      for (i = 0; i < CAMELLIA_AESNI_BLOCKS; ++i)
+        {
+          x[i] = _mm_loadu_si128 ((const __m128i *)src + i);
+          _mm_storeu_si128 ((__m128i *)dest + i, _mm_xor_si128 (x[i], y[i]));
+        }
+      src += CAMELLIA_AESNI_BLOCKS * CAMELLIA_BLOCK_SIZE;
+      dest += CAMELLIA_AESNI_BLOCKS * CAMELLIA_BLOCK_SIZE;
+    }
+}
+
+#endif /* HAVE_AESNI_INTRINSICS */
@@ -0,0 +1,57 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between camellia.c and the instruction set specific Camellia
+ * code. The subkeys are laid out as described in camellia.h.
+ */
+
+#ifndef CAMELLIA_INTERNAL_H
+#define CAMELLIA_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "camellia.h"
+
+#if defined(HAVE_AESNI_INTRINSICS)
+/* Number of blocks camellia_ctr_blocks_aesni works on at once. */
+#define CAMELLIA_AESNI_BLOCKS 16
+
+/*
+ * XORs blocks whole blocks of CTR keystream into src, where blocks is a
+ * multiple of CAMELLIA_AESNI_BLOCKS. The counter is given and returned as
+ * its two big-endian halves. Uses AESENCLAST for the S-boxes, in
+ * camellia-aesni.c.
+ */
+void camellia_ctr_blocks_aesni (const uint64_t *, unsigned int, uint64_t *,
+                                uint64_t *, const uint8_t *, uint8_t *,
+                                size_t);
+#endif
+
+/* Name of the code picked for this CPU, for fcrypt_cipher_backend. */
+const char *camellia_backend_name (void);
+
+#endif /* CAMELLIA_INTERNAL_H */
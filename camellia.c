@@ -23,11 +23,27 @@
  * SUCH DAMAGE.
  */
 
+/*
+ * Camellia from RFC 3713. The S-boxes and the P-function are combined into
+ * eight tables of 64-bit words generated by make-camellia-sboxes.c, so the
+ * F-function is eight lookups XORed together. CTR mode on x86-64 uses
+ * camellia-aesni.c for long inputs instead, which computes the S-boxes of
+ * sixteen blocks at a time with AESENCLAST.
+ */
+
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
+#include "bswap.h"
+#include "camellia-internal.h"
+#include "camellia-tables.h"
 #include "camellia.h"
+#include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_memzero.h"
 
 #define K1 0xa09e667f3bcc908b
 #define K2 0xb67ae8584caa73b2
@@ -35,3 +51,347 @@
 #define K4 0x54ff53a5f1d36f1c
 #define K5 0x10e527fade682d1d
 #define K6 0xb05688c2b3e6c1fd
+
+static inline uint64_t
+camellia_f (uint64_t x, uint64_t k)
+{
+  x ^= k;
+  return camellia_sp[0][x >> 56] ^ camellia_sp[1][(x >> 48) & 0xff]
+         ^ camellia_sp[2][(x >> 40) & 0xff] ^ camellia_sp[3][(x >> 32) & 0xff]
+         ^ camellia_sp[4][(x >> 24) & 0xff] ^ camellia_sp[5][(x >> 16) & 0xff]
+         ^ camellia_sp[6][(x >> 8) & 0xff] ^ camellia_sp[7][x & 0xff];
+}
+
+static inline uint64_t
+camellia_fl (uint64_t x, uint64_t k)
+{
+  uint32_t x1 = (uint32_t)(x >> 32), x2 = (uint32_t)x;
+
+  x2 ^= rotl32 (x1 & (uint32_t)(k >> 32), 1);
+  x1 ^= x2 | (uint32_t)k;
+  return ((uint64_t)x1 << 32) | x2;
+}
+
+static inline uint64_t
+camellia_flinv (uint64_t y, uint64_t k)
+{
+  uint32_t y1 = (uint32_t)(y >> 32), y2 = (uint32_t)y;
+
+  y1 ^= y2 | (uint32_t)k;
+  y2 ^= rotl32 (y1 & (uint32_t)(k >> 32), 1);
+  return ((uint64_t)y1 << 32) | y2;
+}
+
+/*
+ * Encrypts one block with the subkeys in k, or decrypts it when given the
+ * reversed subkeys.
+ */
+static void
+camellia_crypt (const uint64_t *k, unsigned int rounds, const uint8_t *src,
+                uint8_t *dest)
+{
+  uint64_t d1, d2;
+  unsigned int i;
+
+  d1 = buff_get_be64 (src) ^ k[0];
+  d2 = buff_get_be64 (src + 8) ^ k[1];
+  k += 2;
+  for (i = 0; i < rounds; i += 6)
+    {
+      if (i > 0)
+        {
+          d1 = camellia_fl (d1, k[0]);
+          d2 = camellia_flinv (d2, k[1]);
+          k += 2;
+        }
+      d2 ^= camellia_f (d1, k[0]);
+      d1 ^= camellia_f (d2, k[1]);
+      d2 ^= camellia_f (d1, k[2]);
+      d1 ^= camellia_f (d2, k[3]);
+      d2 ^= camellia_f (d1, k[4]);
+      d1 ^= camellia_f (d2, k[5]);
+      k += 6;
+    }
+  d2 ^= k[0];
+  d1 ^= k[1];
+  buff_put_be64 (dest, d2);
+  buff_put_be64 (dest + 8, d1);
+}
+
+/* Rotates the 128-bit value in x[0] (high) and x[1] (low) left by n. */
+static void
+camellia_rotl128 (uint64_t *out, const uint64_t *x, unsigned int n)
+{
+  uint64_t hi = x[0], lo = x[1], t;
+
+  if (n >= 64)
+    {
+      t = hi;
+      hi = lo;
+      lo = t;
+      n -= 64;
+    }
+  if (n == 0)
+    {
+      out[0] = hi;
+      out[1] = lo;
+      return;
+    }
+  out[0] = (hi << n) | (lo >> (64 - n));
+  out[1] = (lo << n) | (hi >> (64 - n));
+}
+
+/*
+ * Computes KA, and KB if kr is not NULL, from KL and KR as in section 2.2
+ * of RFC 3713.
+ */
+static void
+camellia_derive (uint64_t *ka, uint64_t *kb, const uint64_t *kl,
+                 const uint64_t *kr)
+{
+  uint64_t d1, d2;
+
+  d1 = kl[0] ^ kr[0];
+  d2 = kl[1] ^ kr[1];
+  d2 ^= camellia_f (d1, K1);
+  d1 ^= camellia_f (d2, K2);
+  d1 ^= kl[0];
+  d2 ^= kl[1];
+  d2 ^= camellia_f (d1, K3);
+  d1 ^= camellia_f (d2, K4);
+  ka[0] = d1;
+  ka[1] = d2;
+  if (kb == NULL)
+    return;
+  d1 = ka[0] ^ kr[0];
+  d2 = ka[1] ^ kr[1];
+  d2 ^= camellia_f (d1, K5);
+  d1 ^= camellia_f (d2, K6);
+  kb[0] = d1;
+  kb[1] = d2;
+}
+
+/* Where each pair of subkeys comes from, as an index into {KL, KR, KA, KB}. */
+struct camellia_subkey
+{
+  unsigned char src;
+  unsigned char rot;
+};
+
+static const struct camellia_subkey camellia128_subkeys[13]
+    = { { 0, 0 },  { 2, 0 },  { 0, 15 }, { 2, 15 }, { 2, 30 },
+        { 0, 45 }, { 2, 45 }, { 2, 60 }, { 0, 77 }, { 0, 94 },
+        { 2, 94 }, { 0, 111 }, { 2, 111 } };
+
+static const struct camellia_subkey camellia256_subkeys[17]
+    = { { 0, 0 },  { 3, 0 },   { 1, 15 }, { 2, 15 }, { 1, 30 }, { 3, 30 },
+        { 0, 45 }, { 2, 45 },  { 0, 60 }, { 1, 60 }, { 3, 60 }, { 0, 77 },
+        { 2, 77 }, { 1, 94 },  { 2, 94 }, { 0, 111 }, { 3, 111 } };
+
+static void
+camellia_expand (uint64_t *ek, const uint64_t (*keys)[2],
+                 const struct camellia_subkey *subkeys, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    camellia_rotl128 (ek + i * 2, keys[subkeys[i].src], subkeys[i].rot);
+}
+
+/*
+ * The decryption subkeys are the encryption subkeys reversed, except that
+ * kw1 and kw2 (and kw3 and kw4) keep their order.
+ */
+static void
+camellia_invert (uint64_t *dk, const uint64_t *ek, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    dk[i] = ek[n - 1 - i];
+  dk[0] = ek[n - 2];
+  dk[1] = ek[n - 1];
+  dk[n - 2] = ek[0];
+  dk[n - 1] = ek[1];
+}
+
+void
+camellia128_set_key (struct camellia128_ctx *ctx, const uint8_t *key)
+{
+  uint64_t keys[4][2];
+
+  keys[0][0] = buff_get_be64 (key);
+  keys[0][1] = buff_get_be64 (key + 8);
+  keys[1][0] = keys[1][1] = 0;
+  camellia_derive (keys[2], NULL, keys[0], keys[1]);
+  camellia_expand (ctx->ek, (const uint64_t (*)[2])keys, camellia128_subkeys,
+                   13);
+  /* k10 is the low half of KL <<< 60 rather than KA <<< 45. */
+  camellia_rotl128 (keys[3], keys[0], 60);
+  ctx->ek[13] = keys[3][1];
+  camellia_invert (ctx->dk, ctx->ek, 26);
+  fcrypt_memzero (keys, sizeof (keys));
+}
+
+static void
+camellia256_expand_key (uint64_t *ek, uint64_t *dk, const uint8_t *key,
+                        size_t len)
+{
+  uint64_t keys[4][2];
+
+  keys[0][0] = buff_get_be64 (key);
+  keys[0][1] = buff_get_be64 (key + 8);
+  keys[1][0] = buff_get_be64 (key + 16);
+  /* A 192-bit key is extended with the complement of its last 64 bits. */
+  keys[1][1] = len == CAMELLIA256_KEY_SIZE ? buff_get_be64 (key + 24)
+                                            : ~keys[1][0];
+  camellia_derive (keys[2], keys[3], keys[0], keys[1]);
+  camellia_expand (ek, (const uint64_t (*)[2])keys, camellia256_subkeys, 17);
+  camellia_invert (dk, ek, 34);
+  fcrypt_memzero (keys, sizeof (keys));
+}
+
+void
+camellia192_set_key (struct camellia192_ctx *ctx, const uint8_t *key)
+{
+  camellia256_expand_key (ctx->ek, ctx->dk, key, CAMELLIA192_KEY_SIZE);
+}
+
+void
+camellia256_set_key (struct camellia256_ctx *ctx, const uint8_t *key)
+{
+  camellia256_expand_key (ctx->ek, ctx->dk, key, CAMELLIA256_KEY_SIZE);
+}
+
+void
+camellia128_encrypt (struct camellia128_ctx *ctx, const uint8_t *src,
+                     uint8_t *dest)
+{
+  camellia_crypt (ctx->ek, CAMELLIA128_ROUNDS, src, dest);
+}
+
+void
+camellia192_encrypt (struct camellia192_ctx *ctx, const uint8_t *src,
+                     uint8_t *dest)
+{
+  camellia_crypt (ctx->ek, CAMELLIA192_ROUNDS, src, dest);
+}
+
+void
+camellia256_encrypt (struct camellia256_ctx *ctx, const uint8_t *src,
+                     uint8_t *dest)
+{
+  camellia_crypt (ctx->ek, CAMELLIA256_ROUNDS, src, dest);
+}
+
+void
+camellia128_decrypt (struct camellia128_ctx *ctx, const uint8_t *src,
+                     uint8_t *dest)
+{
+  camellia_crypt (ctx->dk, CAMELLIA128_ROUNDS, src, dest);
+}
+
+void
+camellia192_decrypt (struct camellia192_ctx *ctx, const uint8_t *src,
+                     uint8_t *dest)
+{
+  camellia_crypt (ctx->dk, CAMELLIA192_ROUNDS, src, dest);
+}
+
+void
+camellia256_decrypt (struct camellia256_ctx *ctx, const uint8_t *src,
+                     uint8_t *dest)
+{
+  camellia_crypt (ctx->dk, CAMELLIA256_ROUNDS, src, dest);
+}
+
+#if defined(HAVE_AESNI_INTRINSICS)
+static int camellia_use_aesni;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+camellia_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+  camellia_use_aesni = (features & (FCRYPT_CPU_AESNI | FCRYPT_CPU_SSSE3))
+                       == (FCRYPT_CPU_AESNI | FCRYPT_CPU_SSSE3);
+}
+#endif /* __GNUC__ */
+#endif
+
+const char *
+camellia_backend_name (void)
+{
+#if defined(HAVE_AESNI_INTRINSICS)
+  if (camellia_use_aesni)
+    return "aesni";
+#endif
+  return "generic";
+}
+
+static void
+camellia_ctr_crypt (const uint64_t *ek, unsigned int rounds, uint8_t *ctr,
+                    const uint8_t *src, uint8_t *dest, size_t len)
+{
+  uint8_t block[CAMELLIA_BLOCK_SIZE];
+  uint8_t keystream[CAMELLIA_BLOCK_SIZE];
+  uint64_t hi, lo;
+  size_t i, n;
+
+  hi = buff_get_be64 (ctr);
+  lo = buff_get_be64 (ctr + 8);
+#if defined(HAVE_AESNI_INTRINSICS)
+  if (camellia_use_aesni)
+    {
+      n = len / (CAMELLIA_BLOCK_SIZE * CAMELLIA_AESNI_BLOCKS)
+          * CAMELLIA_AESNI_BLOCKS;
+      if (n > 0)
+        {
+          camellia_ctr_blocks_aesni (ek, rounds, &hi, &lo, src, dest, n);
+          src += n * CAMELLIA_BLOCK_SIZE;
+          dest += n * CAMELLIA_BLOCK_SIZE;
+          len -= n * CAMELLIA_BLOCK_SIZE;
+        }
+    }
+#endif
+  while (len > 0)
+    {
+      buff_put_be64 (block, hi);
+      buff_put_be64 (block + 8, lo);
+      if (++lo == 0)
+        ++hi;
+      camellia_crypt (ek, rounds, block, keystream);
+      n = len < CAMELLIA_BLOCK_SIZE ? len : CAMELLIA_BLOCK_SIZE;
+      for (i = 0; i < n; ++i)
+        dest[i] = src[i] ^ keystream[i];
+      src += n;
+      dest += n;
+      len -= n;
+    }
+  buff_put_be64 (ctr, hi);
+  buff_put_be64 (ctr + 8, lo);
+  fcrypt_memzero (keystream, sizeof (keystream));
+}
+
+void
+camellia128_ctr_crypt (struct camellia128_ctx *ctx, uint8_t *ctr,
+                       const uint8_t *src, uint8_t *dest, size_t len)
+{
+  camellia_ctr_crypt (ctx->ek, CAMELLIA128_ROUNDS, ctr, src, dest, len);
+}
+
+void
+camellia192_ctr_crypt (struct camellia192_ctx *ctx, uint8_t *ctr,
+                       const uint8_t *src, uint8_t *dest, size_t len)
+{
+  camellia_ctr_crypt (ctx->ek, CAMELLIA192_ROUNDS, ctr, src, dest, len);
+}
+
+void
+camellia256_ctr_crypt (struct camellia256_ctx *ctx, uint8_t *ctr,
+                       const uint8_t *src, uint8_t *dest, size_t len)
+{
+  camellia_ctr_crypt (ctx->ek, CAMELLIA256_ROUNDS, ctr, src, dest, len);
+}
@@ -33,6 +33,62 @@
 #define CAMELLIA192_KEY_SIZE 24
 #define CAMELLIA256_KEY_SIZE 32
 
+#define CAMELLIA128_ROUNDS 18
+#define CAMELLIA192_ROUNDS 24
+#define CAMELLIA256_ROUNDS 24
+
 #define CAMELLIA_BLOCK_SIZE 16
 
+/*
+ * Camellia as described in RFC 3713. The subkeys are 64-bit words in the
+ * order they are used, kw1, kw2, the round keys with the FL and FL^-1 keys
+ * between each group of six rounds, then kw3 and kw4. Decryption is the
+ * same algorithm with the subkeys in reverse, which is stored in dk.
+ */
+struct camellia128_ctx
+{
+  uint64_t ek[26];
+  uint64_t dk[26];
+};
+
+struct camellia192_ctx
+{
+  uint64_t ek[34];
+  uint64_t dk[34];
+};
+
+struct camellia256_ctx
+{
+  uint64_t ek[34];
+  uint64_t dk[34];
+};
+
+void camellia128_set_key (struct camellia128_ctx *, const uint8_t *);
+void camellia192_set_key (struct camellia192_ctx *, const uint8_t *);
+void camellia256_set_key (struct camellia256_ctx *, const uint8_t *);
+void camellia128_encrypt (struct camellia128_ctx *, const uint8_t *,
+                          uint8_t *);
+void camellia192_encrypt (struct camellia192_ctx *, const uint8_t *,
+                          uint8_t *);
+void camellia256_encrypt (struct camellia256_ctx *, const uint8_t *,
+                          uint8_t *);
+void camellia128_decrypt (struct camellia128_ctx *, const uint8_t *,
+                          uint8_t *);
+void camellia192_decrypt (struct camellia192_ctx *, const uint8_t *,
+                          uint8_t *);
+void camellia256_decrypt (struct camellia256_ctx *, const uint8_t *,
+                          uint8_t *);
+
+/*
+ * CTR mode, with the same counter handling as aes128_ctr_crypt. The counter
+ * is a 16-byte big-endian integer incremented once per block and a trailing
+ * partial block consumes a whole counter value.
+ */
+void camellia128_ctr_crypt (struct camellia128_ctx *, uint8_t *,
+                            const uint8_t *, uint8_t *, size_t);
+void camellia192_ctr_crypt (struct camellia192_ctx *, uint8_t *,
+                            const uint8_t *, uint8_t *, size_t);
+void camellia256_ctr_crypt (struct camellia256_ctx *, uint8_t *,
+                            const uint8_t *, uint8_t *, size_t);
+
 #endif /* CAMELLIA_H */
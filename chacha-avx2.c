@@ -0,0 +1,192 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * ChaCha with AVX2, computing eight blocks at a time with each register
+ * holding one state word of every block. Rotations by 16 and 8 bits are
+ * byte shuffles. The blocks are transposed back with 8x8 transposes as
+ * they are XORed into the input.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha-internal.h"
+#include "chacha.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_LANES 8
+
+#define AVX2_ROTL16(x) _mm256_shuffle_epi8 ((x), rot16)
+#define AVX2_ROTL8(x) _mm256_shuffle_epi8 ((x), rot8)
+#define AVX2_ROTL12(x)                                                        \
+  _mm256_or_si256 (_mm256_slli_epi32 ((x), 12), _mm256_srli_epi32 ((x), 20))
+#define AVX2_ROTL7(x)                                                         \
+  _mm256_or_si256 (_mm256_slli_epi32 ((x), 7), _mm256_srli_epi32 ((x), 25))
+
+#define AVX2_QUARTERROUND(v, a, b, c, d)                                      \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] = _mm256_add_epi32 ((v)[a], (v)[b]);                             \
+      (v)[d] = AVX2_ROTL16 (_mm256_xor_si256 ((v)[d], (v)[a]));               \
+      (v)[c] = _mm256_add_epi32 ((v)[c], (v)[d]);                             \
+      (v)[b] = AVX2_ROTL12 (_mm256_xor_si256 ((v)[b], (v)[c]));               \
+      (v)[a] = _mm256_add_epi32 ((v)[a], (v)[b]);                             \
+      (v)[d] = AVX2_ROTL8 (_mm256_xor_si256 ((v)[d], (v)[a]));                \
+      (v)[c] = _mm256_add_epi32 ((v)[c], (v)[d]);                             \
+      (v)[b] = AVX2_ROTL7 (_mm256_xor_si256 ((v)[b], (v)[c]));                \
+    }                                                                         \
+  while (0)
+
+/*
+ * Transposes the eight registers in r, so that w[i] holds the lane i words
+ * of all of them.
+ */
+AVX2_TARGET static inline void
+avx2_transpose8 (__m256i *w, const __m256i *r)
+{
+  __m256i t[8], u[8];
+  size_t i;
+
+  for (i = 0; i < 8; i += 2)
+    {
+      t[i] = _mm256_unpacklo_epi32 (r[i], r[i + 1]);
+      t[i + 1] = _mm256_unpackhi_epi32 (r[i], r[i + 1]);
+    }
+  for (i = 0; i < 8; i += 4)
+    {
+      u[i] = _mm256_unpacklo_epi64 (t[i], t[i + 2]);
+      u[i + 1] = _mm256_unpackhi_epi64 (t[i], t[i + 2]);
+      u[i + 2] = _mm256_unpacklo_epi64 (t[i + 1], t[i + 3]);
+      u[i + 3] = _mm256_unpackhi_epi64 (t[i + 1], t[i + 3]);
+    }
+  for (i = 0; i < 4; ++i)
+    {
+      w[i] = _mm256_permute2x128_si256 (u[i], u[i + 4], 0x20);
+      w[i + 4] = _mm256_permute2x128_si256 (u[i], u[i + 4], 0x31);
+    }
+}
+
+/*
+ * Transposes the state words in v into eight blocks and XORs them into src,
+ * storing the result in dest.
+ */
+AVX2_TARGET static inline void
+avx2_xor_blocks (const __m256i *v, const uint8_t *src, uint8_t *dest)
+{
+  __m256i r[16];
+  size_t i, j;
+
+  avx2_transpose8 (r, v);
+  avx2_transpose8 (r + 8, v + 8);
+  for (j = 0; j < 8; ++j)
+    for (i = 0; i < 2; ++i)
+      {
+        const size_t off = j * CHACHA_BLOCK_SIZE + i * 32;
+
+        _mm256_storeu_si256 (
+            (__m256i *)(dest + off),
+            _mm256_xor_si256 (
+                r[8 * i + j],
+                _mm256_loadu_si256 ((const __m256i *)(src + off))));
+      }
+}
+
+AVX2_TARGET static void
+chacha_encrypt_blocks_avx2 (uint32_t *input, const uint8_t *src,
+                            uint8_t *dest, size_t blocks)
+{
+  const __m256i rot16
+      = _mm256_setr_epi8 (2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                          2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12,
+                          13);
+  const __m256i rot8
+      = _mm256_setr_epi8 (3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+                          3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13,
+                          14);
+  __m256i v[16], y[16];
+  uint32_t lo[AVX2_LANES], hi[AVX2_LANES];
+  uint64_t counter;
+  size_t i;
+
+  for (i = 0; i < 16; ++i)
+    y[i] = _mm256_set1_epi32 ((int)input[i]);
+  counter = (uint64_t)input[12] | ((uint64_t)input[13] << 32);
+
+  for (; blocks > 0; blocks -= AVX2_LANES)
+    {
+      for (i = 0; i < AVX2_LANES; ++i)
+        {
+          lo[i] = (uint32_t)(counter + i);
+          hi[i] = (uint32_t)((counter + i) >> 32);
+        }
+      y[12] = _mm256_loadu_si256 ((const __m256i *)lo);
+      y[13] = _mm256_loadu_si256 ((const __m256i *)hi);
+
+      for (i = 0; i < 16; ++i)
+        v[i] = y[i];
+      for (i = 0; i < 20; i += 2)
+        {
+          AVX2_QUARTERROUND (v, 0, 4, 8, 12);
+          AVX2_QUARTERROUND (v, 1, 5, 9, 13);
+          AVX2_QUARTERROUND (v, 2, 6, 10, 14);
+          AVX2_QUARTERROUND (v, 3, 7, 11, 15);
+          AVX2_QUARTERROUND (v, 0, 5, 10, 15);
+          AVX2_QUARTERROUND (v, 1, 6, 11, 12);
+          AVX2_QUARTERROUND (v, 2, 7, 8, 13);
+          AVX2_QUARTERROUND (v, 3, 4, 9, 14);
+        }
+      for (i = 0; i < 16; ++i)
+        v[i] = _mm256_add_epi32 (v[i], y[i]);
+
+      avx2_xor_blocks (v, src, dest);
+      src += AVX2_LANES * CHACHA_BLOCK_SIZE;
+      dest += AVX2_LANES * CHACHA_BLOCK_SIZE;
+      counter += AVX2_LANES;
+    }
+
+  input[12] = (uint32_t)counter;
+  input[13] = (uint32_t)(counter >> 32);
+}
+
+const struct chacha_backend chacha_backend_avx2 = {
+  "avx2",
+  AVX2_LANES,
+  chacha_encrypt_blocks_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int chacha_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
@@ -0,0 +1,188 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * ChaCha with AVX-512, computing sixteen blocks at a time. This is the same
+ * as chacha-avx2.c with VPROLD for the rotations. The blocks are transposed
+ * back in two halves of eight with AVX2 shuffles and XORed into the input
+ * 64 bytes at a time.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha-internal.h"
+#include "chacha.h"
+
+#if defined(HAVE_AVX512_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX512_TARGET __attribute__ ((target (AVX512_TARGET_ATTRIBUTE)))
+
+#define AVX512_LANES 16
+
+#define AVX512_ROTL16(x) _mm512_rol_epi32 ((x), 16)
+#define AVX512_ROTL12(x) _mm512_rol_epi32 ((x), 12)
+#define AVX512_ROTL8(x) _mm512_rol_epi32 ((x), 8)
+#define AVX512_ROTL7(x) _mm512_rol_epi32 ((x), 7)
+
+#define AVX512_QUARTERROUND(v, a, b, c, d)                                    \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] = _mm512_add_epi32 ((v)[a], (v)[b]);                             \
+      (v)[d] = AVX512_ROTL16 (_mm512_xor_si512 ((v)[d], (v)[a]));             \
+      (v)[c] = _mm512_add_epi32 ((v)[c], (v)[d]);                             \
+      (v)[b] = AVX512_ROTL12 (_mm512_xor_si512 ((v)[b], (v)[c]));             \
+      (v)[a] = _mm512_add_epi32 ((v)[a], (v)[b]);                             \
+      (v)[d] = AVX512_ROTL8 (_mm512_xor_si512 ((v)[d], (v)[a]));              \
+      (v)[c] = _mm512_add_epi32 ((v)[c], (v)[d]);                             \
+      (v)[b] = AVX512_ROTL7 (_mm512_xor_si512 ((v)[b], (v)[c]));              \
+    }                                                                         \
+  while (0)
+
+/*
+ * Transposes the eight registers in r, so that w[i] holds the lane i words
+ * of all of them.
+ */
+AVX512_TARGET static inline void
+avx512_transpose8 (__m256i *w, const __m256i *r)
+{
+  __m256i t[8], u[8];
+  size_t i;
+
+  for (i = 0; i < 8; i += 2)
+    {
+      t[i] = _mm256_unpacklo_epi32 (r[i], r[i + 1]);
+      t[i + 1] = _mm256_unpackhi_epi32 (r[i], r[i + 1]);
+    }
+  for (i = 0; i < 8; i += 4)
+    {
+      u[i] = _mm256_unpacklo_epi64 (t[i], t[i + 2]);
+      u[i + 1] = _mm256_unpackhi_epi64 (t[i], t[i + 2]);
+      u[i + 2] = _mm256_unpacklo_epi64 (t[i + 1], t[i + 3]);
+      u[i + 3] = _mm256_unpackhi_epi64 (t[i + 1], t[i + 3]);
+    }
+  for (i = 0; i < 4; ++i)
+    {
+      w[i] = _mm256_permute2x128_si256 (u[i], u[i + 4], 0x20);
+      w[i + 4] = _mm256_permute2x128_si256 (u[i], u[i + 4], 0x31);
+    }
+}
+
+/*
+ * Transposes the state words in v into sixteen blocks and XORs them into
+ * src, storing the result in dest.
+ */
+AVX512_TARGET static inline void
+avx512_xor_blocks (const __m512i *v, const uint8_t *src, uint8_t *dest)
+{
+  __m256i h[16], r[16];
+  __m512i block;
+  size_t i, j;
+
+  for (i = 0; i < 2; ++i)
+    {
+      for (j = 0; j < 16; ++j)
+        h[j] = i == 0 ? _mm512_castsi512_si256 (v[j])
+                      : _mm512_extracti64x4_epi64 (v[j], 1);
+      avx512_transpose8 (r, h);
+      avx512_transpose8 (r + 8, h + 8);
+      for (j = 0; j < 8; ++j)
+        {
+          const size_t off = (8 * i + j) * CHACHA_BLOCK_SIZE;
+
+          block = _mm512_inserti64x4 (_mm512_castsi256_si512 (r[j]),
+                                      r[j + 8], 1);
+          _mm512_storeu_si512 (
+              dest + off,
+              _mm512_xor_si512 (block, _mm512_loadu_si512 (src + off)));
+        }
+    }
+}
+
+AVX512_TARGET static void
+chacha_encrypt_blocks_avx512 (uint32_t *input, const uint8_t *src,
+                              uint8_t *dest, size_t blocks)
+{
+  __m512i v[16], y[16];
+  uint32_t lo[AVX512_LANES], hi[AVX512_LANES];
+  uint64_t counter;
+  size_t i;
+
+  for (i = 0; i < 16; ++i)
+    y[i] = _mm512_set1_epi32 ((int)input[i]);
+  counter = (uint64_t)input[12] | ((uint64_t)input[13] << 32);
+
+  for (; blocks > 0; blocks -= AVX512_LANES)
+    {
+      for (i = 0; i < AVX512_LANES; ++i)
+        {
+          lo[i] = (uint32_t)(counter + i);
+          hi[i] = (uint32_t)((counter + i) >> 32);
+        }
+      y[12] = _mm512_loadu_si512 (lo);
+      y[13] = _mm512_loadu_si512 (hi);
+
+      for (i = 0; i < 16; ++i)
+        v[i] = y[i];
+      for (i = 0; i < 20; i += 2)
+        {
+          AVX512_QUARTERROUND (v, 0, 4, 8, 12);
+          AVX512_QUARTERROUND (v, 1, 5, 9, 13);
+          AVX512_QUARTERROUND (v, 2, 6, 10, 14);
+          AVX512_QUARTERROUND (v, 3, 7, 11, 15);
+          AVX512_QUARTERROUND (v, 0, 5, 10, 15);
+          AVX512_QUARTERROUND (v, 1, 6, 11, 12);
+          AVX512_QUARTERROUND (v, 2, 7, 8, 13);
+          AVX512_QUARTERROUND (v, 3, 4, 9, 14);
+        }
+      for (i = 0; i < 16; ++i)
+        v[i] = _mm512_add_epi32 (v[i], y[i]);
+
+      avx512_xor_blocks (v, src, dest);
+      src += AVX512_LANES * CHACHA_BLOCK_SIZE;
+      dest += AVX512_LANES * CHACHA_BLOCK_SIZE;
+      counter += AVX512_LANES;
+    }
+
+  input[12] = (uint32_t)counter;
+  input[13] = (uint32_t)(counter >> 32);
+}
+
+const struct chacha_backend chacha_backend_avx512 = {
+  "avx512",
+  AVX512_LANES,
+  chacha_encrypt_blocks_avx512,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int chacha_avx512_unused;
+
+#endif /* HAVE_AVX512_INTRINSICS */
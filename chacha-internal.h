@@ -0,0 +1,75 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between chacha.c and the instruction set specific ChaCha
+ * implementations. A backend computes several keystream blocks side by
+ * side, one per vector lane, and XORs them into the input. The number of
+ * blocks given to it is always a multiple of its width.
+ */
+
+#ifndef CHACHA_INTERNAL_H
+#define CHACHA_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha.h"
+
+/* Most blocks any backend computes at once. */
+#define CHACHA_MAX_WIDTH 16
+
+struct chacha_backend
+{
+  const char *name;
+  size_t width;
+  /*
+   * Encrypts blocks whole blocks from src to dest with the state in input,
+   * advancing the 64-bit block counter in input[12] and input[13].
+   */
+  void (*encrypt_blocks) (uint32_t *, const uint8_t *, uint8_t *, size_t);
+};
+
+#if defined(HAVE_SSE41_INTRINSICS)
+/* Four blocks at a time in chacha-sse41.c. */
+extern const struct chacha_backend chacha_backend_sse41;
+#endif
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* Eight blocks at a time in chacha-avx2.c. */
+extern const struct chacha_backend chacha_backend_avx2;
+#endif
+
+#if defined(HAVE_AVX512_INTRINSICS)
+/* Sixteen blocks at a time in chacha-avx512.c. */
+extern const struct chacha_backend chacha_backend_avx512;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* Four blocks at a time in chacha-neon.c. */
+extern const struct chacha_backend chacha_backend_neon;
+#endif
+
+#endif /* CHACHA_INTERNAL_H */
@@ -0,0 +1,161 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * ChaCha with NEON, computing four blocks at a time. This is the same as
+ * chacha-sse41.c, transposing the blocks back with TRN. The rotation by 16
+ * bits swaps halfwords and the others are built with SRI.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha-internal.h"
+#include "chacha.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_LANES 4
+
+#define NEON_ROTL(x, n) vsriq_n_u32 (vshlq_n_u32 ((x), (n)), (x), 32 - (n))
+#define NEON_ROTL16(x)                                                        \
+  vreinterpretq_u32_u16 (vrev32q_u16 (vreinterpretq_u16_u32 (x)))
+#define NEON_ROTL12(x) NEON_ROTL ((x), 12)
+#define NEON_ROTL8(x) NEON_ROTL ((x), 8)
+#define NEON_ROTL7(x) NEON_ROTL ((x), 7)
+
+#define NEON_QUARTERROUND(v, a, b, c, d)                                      \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] = vaddq_u32 ((v)[a], (v)[b]);                                    \
+      (v)[d] = NEON_ROTL16 (veorq_u32 ((v)[d], (v)[a]));                      \
+      (v)[c] = vaddq_u32 ((v)[c], (v)[d]);                                    \
+      (v)[b] = NEON_ROTL12 (veorq_u32 ((v)[b], (v)[c]));                      \
+      (v)[a] = vaddq_u32 ((v)[a], (v)[b]);                                    \
+      (v)[d] = NEON_ROTL8 (veorq_u32 ((v)[d], (v)[a]));                       \
+      (v)[c] = vaddq_u32 ((v)[c], (v)[d]);                                    \
+      (v)[b] = NEON_ROTL7 (veorq_u32 ((v)[b], (v)[c]));                       \
+    }                                                                         \
+  while (0)
+
+/*
+ * Transposes the state words in v into four blocks and XORs them into src,
+ * storing the result in dest.
+ */
+NEON_TARGET static inline void
+neon_xor_blocks (const uint32x4_t *v, const uint8_t *src, uint8_t *dest)
+{
+  uint32x4x2_t t0, t1;
+  uint32x4_t r[4];
+  size_t i, j;
+
+  for (i = 0; i < 4; ++i)
+    {
+      t0 = vtrnq_u32 (v[4 * i], v[4 * i + 1]);
+      t1 = vtrnq_u32 (v[4 * i + 2], v[4 * i + 3]);
+      r[0] = vcombine_u32 (vget_low_u32 (t0.val[0]), vget_low_u32 (t1.val[0]));
+      r[1] = vcombine_u32 (vget_low_u32 (t0.val[1]), vget_low_u32 (t1.val[1]));
+      r[2] = vcombine_u32 (vget_high_u32 (t0.val[0]),
+                           vget_high_u32 (t1.val[0]));
+      r[3] = vcombine_u32 (vget_high_u32 (t0.val[1]),
+                           vget_high_u32 (t1.val[1]));
+      for (j = 0; j < 4; ++j)
+        {
+          const size_t off = j * CHACHA_BLOCK_SIZE + i * 16;
+
+          vst1q_u8 (dest + off,
+                    veorq_u8 (vreinterpretq_u8_u32 (r[j]),
+                              vld1q_u8 (src + off)));
+        }
+    }
+}
+
+NEON_TARGET static void
+chacha_encrypt_blocks_neon (uint32_t *input, const uint8_t *src,
+                            uint8_t *dest, size_t blocks)
+{
+  uint32x4_t v[16], y[16];
+  uint32_t lo[NEON_LANES], hi[NEON_LANES];
+  uint64_t counter;
+  size_t i;
+
+  for (i = 0; i < 16; ++i)
+    y[i] = vdupq_n_u32 (input[i]);
+  counter = (uint64_t)input[12] | ((uint64_t)input[13] << 32);
+
+  for (; blocks > 0; blocks -= NEON_LANES)
+    {
+      for (i = 0; i < NEON_LANES; ++i)
+        {
+          lo[i] = (uint32_t)(counter + i);
+          hi[i] = (uint32_t)((counter + i) >> 32);
+        }
+      y[12] = vld1q_u32 (lo);
+      y[13] = vld1q_u32 (hi);
+
+      for (i = 0; i < 16; ++i)
+        v[i] = y[i];
+      for (i = 0; i < 20; i += 2)
+        {
+          NEON_QUARTERROUND (v, 0, 4, 8, 12);
+          NEON_QUARTERROUND (v, 1, 5, 9, 13);
+          NEON_QUARTERROUND (v, 2, 6, 10, 14);
+          NEON_QUARTERROUND (v, 3, 7, 11, 15);
+          NEON_QUARTERROUND (v, 0, 5, 10, 15);
+          NEON_QUARTERROUND (v, 1, 6, 11, 12);
+          NEON_QUARTERROUND (v, 2, 7, 8, 13);
+          NEON_QUARTERROUND (v, 3, 4, 9, 14);
+        }
+      for (i = 0; i < 16; ++i)
+        v[i] = vaddq_u32 (v[i], y[i]);
+
+      neon_xor_blocks (v, src, dest);
+      src += NEON_LANES * CHACHA_BLOCK_SIZE;
+      dest += NEON_LANES * CHACHA_BLOCK_SIZE;
+      counter += NEON_LANES;
+    }
+
+  input[12] = (uint32_t)counter;
+  input[13] = (uint32_t)(counter >> 32);
+}
+
+const struct chacha_backend chacha_backend_neon = {
+  "neon",
+  NEON_LANES,
+  chacha_encrypt_blocks_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int chacha_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
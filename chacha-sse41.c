@@ -0,0 +1,167 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * ChaCha with SSSE3, computing four blocks at a time with each register
+ * holding one state word of every block. Rotations by 16 and 8 bits are
+ * byte shuffles. The blocks are transposed back with 4x4 transposes as
+ * they are XORed into the input. This builds with the SSE4.1 flags that
+ * the rest of the library uses, but needs no more than SSSE3.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha-internal.h"
+#include "chacha.h"
+
+#if defined(HAVE_SSE41_INTRINSICS)
+
+#include <smmintrin.h>
+
+#define SSE41_TARGET __attribute__ ((target (SSE41_TARGET_ATTRIBUTE)))
+
+#define SSE41_LANES 4
+
+#define SSE41_ROTL16(x) _mm_shuffle_epi8 ((x), rot16)
+#define SSE41_ROTL8(x) _mm_shuffle_epi8 ((x), rot8)
+#define SSE41_ROTL12(x)                                                       \
+  _mm_or_si128 (_mm_slli_epi32 ((x), 12), _mm_srli_epi32 ((x), 20))
+#define SSE41_ROTL7(x)                                                        \
+  _mm_or_si128 (_mm_slli_epi32 ((x), 7), _mm_srli_epi32 ((x), 25))
+
+#define SSE41_QUARTERROUND(v, a, b, c, d)                                     \
+  do                                                                          \
+    {                                                                         \
+      (v)[a] = _mm_add_epi32 ((v)[a], (v)[b]);                                \
+      (v)[d] = SSE41_ROTL16 (_mm_xor_si128 ((v)[d], (v)[a]));                 \
+      (v)[c] = _mm_add_epi32 ((v)[c], (v)[d]);                                \
+      (v)[b] = SSE41_ROTL12 (_mm_xor_si128 ((v)[b], (v)[c]));                 \
+      (v)[a] = _mm_add_epi32 ((v)[a], (v)[b]);                                \
+      (v)[d] = SSE41_ROTL8 (_mm_xor_si128 ((v)[d], (v)[a]));                  \
+      (v)[c] = _mm_add_epi32 ((v)[c], (v)[d]);                                \
+      (v)[b] = SSE41_ROTL7 (_mm_xor_si128 ((v)[b], (v)[c]));                  \
+    }                                                                         \
+  while (0)
+
+/*
+ * Transposes the state words in v into four blocks and XORs them into src,
+ * storing the result in dest.
+ */
+SSE41_TARGET static inline void
+sse41_xor_blocks (const __m128i *v, const uint8_t *src, uint8_t *dest)
+{
+  __m128i t0, t1, t2, t3, r[4];
+  size_t i, j;
+
+  for (i = 0; i < 4; ++i)
+    {
+      t0 = _mm_unpacklo_epi32 (v[4 * i], v[4 * i + 1]);
+      t1 = _mm_unpackhi_epi32 (v[4 * i], v[4 * i + 1]);
+      t2 = _mm_unpacklo_epi32 (v[4 * i + 2], v[4 * i + 3]);
+      t3 = _mm_unpackhi_epi32 (v[4 * i + 2], v[4 * i + 3]);
+      r[0] = _mm_unpacklo_epi64 (t0, t2);
+      r[1] = _mm_unpackhi_epi64 (t0, t2);
+      r[2] = _mm_unpacklo_epi64 (t1, t3);
+      r[3] = _mm_unpackhi_epi64 (t1, t3);
+      for (j = 0; j < 4; ++j)
+        {
+          const size_t off = j * CHACHA_BLOCK_SIZE + i * 16;
+
+          _mm_storeu_si128 (
+              (__m128i *)(dest + off),
+              _mm_xor_si128 (r[j],
+                             _mm_loadu_si128 ((const __m128i *)(src + off))));
+        }
+    }
+}
+
+SSE41_TARGET static void
+chacha_encrypt_blocks_sse41 (uint32_t *input, const uint8_t *src,
+                             uint8_t *dest, size_t blocks)
+{
+  const __m128i rot16
+      = _mm_setr_epi8 (2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  const __m128i rot8
+      = _mm_setr_epi8 (3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+  __m128i v[16], y[16];
+  uint32_t lo[SSE41_LANES], hi[SSE41_LANES];
+  uint64_t counter;
+  size_t i;
+
+  for (i = 0; i < 16; ++i)
+    y[i] = _mm_set1_epi32 ((int)input[i]);
+  counter = (uint64_t)input[12] | ((uint64_t)input[13] << 32);
+
+  for (; blocks > 0; blocks -= SSE41_LANES)
+    {
+      for (i = 0; i < SSE41_LANES; ++i)
+        {
+          lo[i] = (uint32_t)(counter + i);
+          hi[i] = (uint32_t)((counter + i) >> 32);
+        }
+      y[12] = _mm_loadu_si128 ((const __m128i *)lo);
+      y[13] = _mm_loadu_si128 ((const __m128i *)hi);
+
+      for (i = 0; i < 16; ++i)
+        v[i] = y[i];
+      for (i = 0; i < 20; i += 2)
+        {
+          SSE41_QUARTERROUND (v, 0, 4, 8, 12);
+          SSE41_QUARTERROUND (v, 1, 5, 9, 13);
+          SSE41_QUARTERROUND (v, 2, 6, 10, 14);
+          SSE41_QUARTERROUND (v, 3, 7, 11, 15);
+          SSE41_QUARTERROUND (v, 0, 5, 10, 15);
+          SSE41_QUARTERROUND (v, 1, 6, 11, 12);
+          SSE41_QUARTERROUND (v, 2, 7, 8, 13);
+          SSE41_QUARTERROUND (v, 3, 4, 9, 14);
+        }
+      for (i = 0; i < 16; ++i)
+        v[i] = _mm_add_epi32 (v[i], y[i]);
+
+      sse41_xor_blocks (v, src, dest);
+      src += SSE41_LANES * CHACHA_BLOCK_SIZE;
+      dest += SSE41_LANES * CHACHA_BLOCK_SIZE;
+      counter += SSE41_LANES;
+    }
+
+  input[12] = (uint32_t)counter;
+  input[13] = (uint32_t)(counter >> 32);
+}
+
+const struct chacha_backend chacha_backend_sse41 = {
+  "sse41",
+  SSE41_LANES,
+  chacha_encrypt_blocks_sse41,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int chacha_sse41_unused;
+
+#endif /* HAVE_SSE41_INTRINSICS */
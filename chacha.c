@@ -31,13 +31,21 @@
  * https://cr.yp.to/chacha.html
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "bswap.h"
+#include "chacha-internal.h"
 #include "chacha.h"
 #include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_iov.h"
+#include "fcrypt_memzero.h"
+#include "fcrypt_parallel.h"
 
 /*
  * Input is a 4 x 4 matrix, indexes shown below:
@@ -133,9 +141,74 @@ chacha_set_iv (struct chacha_ctx *ctx, const uint8_t *iv,
   ctx->input[15] = buff_get_le32 (iv + 4);
 }
 
+/*
+ * Sets the 96-bit nonce and 32-bit block counter of RFC 8439 in place of
+ * the 64-bit IV and counter. The caller must not produce more than 2^32
+ * blocks, since the counter would carry into the nonce.
+ */
 void
-chacha_encrypt_bytes (struct chacha_ctx *ctx, const uint8_t *src,
-                      uint8_t *dest, size_t len)
+chacha_set_nonce (struct chacha_ctx *ctx, const uint8_t *nonce,
+                  uint32_t counter)
+{
+  ctx->input[12] = counter;
+  ctx->input[13] = buff_get_le32 (nonce);
+  ctx->input[14] = buff_get_le32 (nonce + 4);
+  ctx->input[15] = buff_get_le32 (nonce + 8);
+}
+
+/*
+ * Moves the 64-bit block counter of the original layout to block, so that
+ * encryption continues at byte offset block * CHACHA_BLOCK_SIZE. With the
+ * RFC 8439 layout pass the block to chacha_set_nonce instead.
+ */
+void
+chacha_seek (struct chacha_ctx *ctx, uint64_t block)
+{
+  ctx->input[12] = (uint32_t)block;
+  ctx->input[13] = (uint32_t)(block >> 32);
+}
+
+/*
+ * Vector backends from the widest down, each taking the whole blocks that
+ * fill its lanes. The portable code below handles what is left.
+ */
+static const struct chacha_backend *chacha_backends[4];
+static size_t chacha_nbackends = 0;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+chacha_select_backend (void)
+{
+  uint32_t features;
+  size_t n;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+  n = 0;
+#if defined(HAVE_AVX512_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX512F) != 0)
+    chacha_backends[n++] = &chacha_backend_avx512;
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    chacha_backends[n++] = &chacha_backend_avx2;
+#endif
+#if defined(HAVE_SSE41_INTRINSICS)
+  if ((features & (FCRYPT_CPU_SSE41 | FCRYPT_CPU_SSSE3))
+      == (FCRYPT_CPU_SSE41 | FCRYPT_CPU_SSSE3))
+    chacha_backends[n++] = &chacha_backend_sse41;
+#endif
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_NEON) != 0)
+    chacha_backends[n++] = &chacha_backend_neon;
+#endif
+  chacha_nbackends = n;
+}
+#endif /* __GNUC__ */
+
+static void
+chacha_encrypt_generic (struct chacha_ctx *ctx, const uint8_t *src,
+                        uint8_t *dest, size_t len)
 {
   uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
   uint32_t x8, x9, x10, x11, x12, x13, x14, x15;
@@ -272,3 +345,190 @@ chacha_encrypt_bytes (struct chacha_ctx *ctx, const uint8_t *src,
         }
     }
 }
+
+void
+chacha_encrypt_bytes (struct chacha_ctx *ctx, const uint8_t *src,
+                      uint8_t *dest, size_t len)
+{
+  const struct chacha_backend *backend;
+  size_t i, blocks;
+
+  for (i = 0; i < chacha_nbackends; ++i)
+    {
+      backend = chacha_backends[i];
+      blocks = len / CHACHA_BLOCK_SIZE;
+      blocks -= blocks % backend->width;
+      if (blocks == 0)
+        continue;
+      backend->encrypt_blocks (ctx->input, src, dest, blocks);
+      src += blocks * CHACHA_BLOCK_SIZE;
+      dest += blocks * CHACHA_BLOCK_SIZE;
+      len -= blocks * CHACHA_BLOCK_SIZE;
+    }
+
+  chacha_encrypt_generic (ctx, src, dest, len);
+}
+
+static void
+chacha_stream_crypt (void *ctx, const uint8_t *src, uint8_t *dest, size_t len)
+{
+  chacha_encrypt_bytes (ctx, src, dest, len);
+}
+
+void
+chacha_encryptv (struct chacha_ctx *ctx, const struct iovec *iov,
+                 size_t iovcnt)
+{
+  fcrypt_stream_cryptv (chacha_stream_crypt, ctx, CHACHA_BLOCK_SIZE, iov,
+                        iovcnt);
+}
+
+void
+chacha_encrypt_at (const struct chacha_ctx *ctx, uint64_t offset,
+                   const uint8_t *src, uint8_t *dest, size_t len)
+{
+  struct chacha_ctx copy;
+  uint8_t block[CHACHA_BLOCK_SIZE];
+  uint64_t counter;
+  size_t skip, i, n;
+
+  copy = *ctx;
+  counter = (uint64_t)ctx->input[12] | ((uint64_t)ctx->input[13] << 32);
+  chacha_seek (&copy, counter + offset / CHACHA_BLOCK_SIZE);
+
+  /* Use the end of the first block when offset falls inside it. */
+  skip = offset % CHACHA_BLOCK_SIZE;
+  if (skip != 0 && len > 0)
+    {
+      n = CHACHA_BLOCK_SIZE - skip;
+      if (n > len)
+        n = len;
+      memset (block, 0, sizeof (block));
+      chacha_encrypt_bytes (&copy, block, block, sizeof (block));
+      for (i = 0; i < n; ++i)
+        dest[i] = src[i] ^ block[skip + i];
+      fcrypt_memzero (block, sizeof (block));
+      src += n;
+      dest += n;
+      len -= n;
+    }
+
+  chacha_encrypt_bytes (&copy, src, dest, len);
+  fcrypt_memzero (&copy, sizeof (copy));
+}
+
+struct chacha_parallel_job
+{
+  const struct chacha_ctx *ctx;
+  uint64_t offset;
+  const uint8_t *src;
+  uint8_t *dest;
+};
+
+static void
+chacha_parallel_piece (void *ptr, unsigned int index, uint64_t offset,
+                       size_t len)
+{
+  const struct chacha_parallel_job *job = ptr;
+
+  (void)index;
+  chacha_encrypt_at (job->ctx, job->offset + offset, job->src + offset,
+                     job->dest + offset, len);
+}
+
+void
+chacha_encrypt_parallel (const struct chacha_ctx *ctx, uint64_t offset,
+                         const uint8_t *src, uint8_t *dest, size_t len,
+                         unsigned int threads)
+{
+  struct chacha_parallel_job job;
+
+  job.ctx = ctx;
+  job.offset = offset;
+  job.src = src;
+  job.dest = dest;
+  fcrypt_parallel_range (chacha_parallel_piece, &job, len, CHACHA_BLOCK_SIZE,
+                         threads);
+}
+
+/*
+ * HChaCha20 from draft-irtf-cfrg-xchacha. It derives a 32 byte subkey from
+ * a 32 byte key and a 16 byte nonce by running the ChaCha20 rounds on them
+ * and keeping the first and last rows, without the final addition.
+ */
+void
+hchacha20 (uint8_t *out, const uint8_t *key, const uint8_t *nonce)
+{
+  struct chacha_ctx ctx;
+  uint32_t *x = ctx.input;
+  size_t i;
+
+  chacha256_set_key (&ctx, key);
+  for (i = 0; i < 4; ++i)
+    x[12 + i] = buff_get_le32 (nonce + 4 * i);
+
+  for (i = 0; i < 20; i += 2)
+    {
+      CHACHA_QUARTERROUND (x[0], x[4], x[8], x[12]);
+      CHACHA_QUARTERROUND (x[1], x[5], x[9], x[13]);
+      CHACHA_QUARTERROUND (x[2], x[6], x[10], x[14]);
+      CHACHA_QUARTERROUND (x[3], x[7], x[11], x[15]);
+      CHACHA_QUARTERROUND (x[0], x[5], x[10], x[15]);
+      CHACHA_QUARTERROUND (x[1], x[6], x[11], x[12]);
+      CHACHA_QUARTERROUND (x[2], x[7], x[8], x[13]);
+      CHACHA_QUARTERROUND (x[3], x[4], x[9], x[14]);
+    }
+
+  for (i = 0; i < 4; ++i)
+    {
+      buff_put_le32 (out + 4 * i, x[i]);
+      buff_put_le32 (out + 16 + 4 * i, x[12 + i]);
+    }
+  fcrypt_memzero (&ctx, sizeof (ctx));
+}
+
+void
+xchacha20_set_key (struct xchacha20_ctx *ctx, const uint8_t *key)
+{
+  memcpy (ctx->key, key, sizeof (ctx->key));
+}
+
+/*
+ * Derives the subkey for the first 16 bytes of the 24 byte nonce and
+ * starts ChaCha20 at block counter with the last 8 bytes as its IV. The
+ * counter takes the place of the 32-bit counter and the zero word that
+ * precedes the IV in the draft, so it is 64 bits wide.
+ */
+void
+xchacha20_set_nonce (struct xchacha20_ctx *ctx, const uint8_t *nonce,
+                     uint64_t counter)
+{
+  uint8_t subkey[32];
+
+  hchacha20 (subkey, ctx->key, nonce);
+  chacha256_set_key (&ctx->cipher, subkey);
+  fcrypt_memzero (subkey, sizeof (subkey));
+  chacha_seek (&ctx->cipher, counter);
+  ctx->cipher.input[14] = buff_get_le32 (nonce + 16);
+  ctx->cipher.input[15] = buff_get_le32 (nonce + 20);
+}
+
+void
+xchacha20_seek (struct xchacha20_ctx *ctx, uint64_t block)
+{
+  chacha_seek (&ctx->cipher, block);
+}
+
+void
+xchacha20_encrypt_bytes (struct xchacha20_ctx *ctx, const uint8_t *src,
+                         uint8_t *dest, size_t len)
+{
+  chacha_encrypt_bytes (&ctx->cipher, src, dest, len);
+}
+
+void
+xchacha20_encryptv (struct xchacha20_ctx *ctx, const struct iovec *iov,
+                    size_t iovcnt)
+{
+  chacha_encryptv (&ctx->cipher, iov, iovcnt);
+}
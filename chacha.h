@@ -37,16 +37,59 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct iovec;
+
+#define CHACHA_BLOCK_SIZE 64
+#define HCHACHA20_NONCE_SIZE 16
+#define XCHACHA20_NONCE_SIZE 24
+
 struct chacha_ctx
 {
   uint32_t input[16];
 };
 
+/* XChaCha20 keeps the key to derive a new subkey for each nonce. */
+struct xchacha20_ctx
+{
+  struct chacha_ctx cipher;
+  uint8_t key[32];
+};
+
 void chacha128_set_key (struct chacha_ctx *, const uint8_t *);
 void chacha256_set_key (struct chacha_ctx *, const uint8_t *);
 void chacha_set_key (struct chacha_ctx *, const uint8_t *, size_t);
 void chacha_set_iv (struct chacha_ctx *, const uint8_t *, const uint8_t *);
+void chacha_set_nonce (struct chacha_ctx *, const uint8_t *, uint32_t);
+void chacha_seek (struct chacha_ctx *, uint64_t);
 void chacha_encrypt_bytes (struct chacha_ctx *, const uint8_t *, uint8_t *,
                            size_t);
 
+/*
+ * Encrypts the buffers of an iovec array in place as one message. A block
+ * may straddle two buffers, and the block counter ends where a single call
+ * of chacha_encrypt_bytes on the whole message would leave it.
+ */
+void chacha_encryptv (struct chacha_ctx *, const struct iovec *, size_t);
+
+/*
+ * Random access. These use the keystream starting the given number of
+ * bytes past the block counter in the context, which they do not change,
+ * so one context can be shared between threads. The parallel variant
+ * splits large ranges across up to the given number of threads.
+ */
+void chacha_encrypt_at (const struct chacha_ctx *, uint64_t, const uint8_t *,
+                        uint8_t *, size_t);
+void chacha_encrypt_parallel (const struct chacha_ctx *, uint64_t,
+                              const uint8_t *, uint8_t *, size_t,
+                              unsigned int);
+
+void hchacha20 (uint8_t *, const uint8_t *, const uint8_t *);
+
+void xchacha20_set_key (struct xchacha20_ctx *, const uint8_t *);
+void xchacha20_set_nonce (struct xchacha20_ctx *, const uint8_t *, uint64_t);
+void xchacha20_seek (struct xchacha20_ctx *, uint64_t);
+void xchacha20_encrypt_bytes (struct xchacha20_ctx *, const uint8_t *,
+                              uint8_t *, size_t);
+void xchacha20_encryptv (struct xchacha20_ctx *, const struct iovec *, size_t);
+
 #endif /* CHACHA_H */
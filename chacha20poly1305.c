@@ -0,0 +1,180 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * ChaCha20-Poly1305 from RFC 8439. The message is processed in chunks that
+ * stay in the L1 cache, so the ciphertext is authenticated right after it
+ * is written, or right before it is decrypted, instead of in a second pass
+ * over the whole buffer.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "chacha.h"
+#include "chacha20poly1305.h"
+#include "fcrypt_memzero.h"
+#include "poly1305.h"
+
+/* Bytes encrypted and authenticated at a time, a multiple of 64. */
+#define CHACHA20POLY1305_CHUNK_SIZE 4096
+
+static const uint8_t chacha20poly1305_zeros[POLY1305_BLOCK_SIZE] = { 0 };
+
+/* Pads the data absorbed so far with zeros to a multiple of 16 bytes. */
+static void
+chacha20poly1305_pad (struct chacha20poly1305_ctx *ctx)
+{
+  if (ctx->mac.bufferlen > 0)
+    poly1305_update (&ctx->mac, chacha20poly1305_zeros,
+                     POLY1305_BLOCK_SIZE - ctx->mac.bufferlen);
+}
+
+void
+chacha20poly1305_set_key (struct chacha20poly1305_ctx *ctx,
+                          const uint8_t *key)
+{
+  chacha256_set_key (&ctx->cipher, key);
+}
+
+/* The Poly1305 key is the start of the keystream block with counter 0. */
+void
+chacha20poly1305_set_nonce (struct chacha20poly1305_ctx *ctx,
+                            const uint8_t *nonce)
+{
+  uint8_t block[64];
+
+  memset (block, 0, sizeof (block));
+  chacha_set_nonce (&ctx->cipher, nonce, 0);
+  chacha_encrypt_bytes (&ctx->cipher, block, block, sizeof (block));
+  poly1305_init (&ctx->mac, block);
+  fcrypt_memzero (block, sizeof (block));
+
+  ctx->auth_size = 0;
+  ctx->data_size = 0;
+}
+
+void
+chacha20poly1305_update (struct chacha20poly1305_ctx *ctx,
+                         const uint8_t *data, size_t len)
+{
+  poly1305_update (&ctx->mac, data, len);
+  ctx->auth_size += len;
+}
+
+void
+chacha20poly1305_encrypt (struct chacha20poly1305_ctx *ctx,
+                          const uint8_t *src, uint8_t *dest, size_t len)
+{
+  size_t n;
+
+  chacha20poly1305_pad (ctx);
+  ctx->data_size += len;
+  while (len > 0)
+    {
+      n = len < CHACHA20POLY1305_CHUNK_SIZE ? len
+                                            : CHACHA20POLY1305_CHUNK_SIZE;
+      chacha_encrypt_bytes (&ctx->cipher, src, dest, n);
+      poly1305_update (&ctx->mac, dest, n);
+      src += n;
+      dest += n;
+      len -= n;
+    }
+}
+
+void
+chacha20poly1305_decrypt (struct chacha20poly1305_ctx *ctx,
+                          const uint8_t *src, uint8_t *dest, size_t len)
+{
+  size_t n;
+
+  chacha20poly1305_pad (ctx);
+  ctx->data_size += len;
+  while (len > 0)
+    {
+      n = len < CHACHA20POLY1305_CHUNK_SIZE ? len
+                                            : CHACHA20POLY1305_CHUNK_SIZE;
+      poly1305_update (&ctx->mac, src, n);
+      chacha_encrypt_bytes (&ctx->cipher, src, dest, n);
+      src += n;
+      dest += n;
+      len -= n;
+    }
+}
+
+void
+chacha20poly1305_digest (struct chacha20poly1305_ctx *ctx, uint8_t *digest)
+{
+  uint8_t block[POLY1305_BLOCK_SIZE];
+
+  chacha20poly1305_pad (ctx);
+  buff_put_le64 (block, ctx->auth_size);
+  buff_put_le64 (block + 8, ctx->data_size);
+  poly1305_update (&ctx->mac, block, sizeof (block));
+  poly1305_final (digest, &ctx->mac);
+}
+
+void
+chacha20poly1305_seal (struct chacha20poly1305_ctx *ctx,
+                       const uint8_t *nonce, const uint8_t *ad, size_t ad_len,
+                       const uint8_t *src, uint8_t *dest, size_t len,
+                       uint8_t *tag)
+{
+  chacha20poly1305_set_nonce (ctx, nonce);
+  chacha20poly1305_update (ctx, ad, ad_len);
+  chacha20poly1305_encrypt (ctx, src, dest, len);
+  chacha20poly1305_digest (ctx, tag);
+}
+
+/* Compares the tags in constant time, clearing the output on a mismatch. */
+int
+chacha20poly1305_open (struct chacha20poly1305_ctx *ctx,
+                       const uint8_t *nonce, const uint8_t *ad, size_t ad_len,
+                       const uint8_t *src, uint8_t *dest, size_t len,
+                       const uint8_t *tag)
+{
+  uint8_t digest[CHACHA20POLY1305_DIGEST_SIZE];
+  uint8_t diff;
+  size_t i;
+
+  chacha20poly1305_set_nonce (ctx, nonce);
+  chacha20poly1305_update (ctx, ad, ad_len);
+  chacha20poly1305_decrypt (ctx, src, dest, len);
+  chacha20poly1305_digest (ctx, digest);
+
+  diff = 0;
+  for (i = 0; i < CHACHA20POLY1305_DIGEST_SIZE; ++i)
+    diff |= digest[i] ^ tag[i];
+  if (diff != 0)
+    {
+      fcrypt_memzero (dest, len);
+      return -1;
+    }
+  return 0;
+}
@@ -0,0 +1,83 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * ChaCha20-Poly1305 authenticated encryption as described in RFC 8439,
+ * "ChaCha20 and Poly1305 for IETF Protocols".
+ */
+
+#ifndef CHACHA20POLY1305_H
+#define CHACHA20POLY1305_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha.h"
+#include "poly1305.h"
+
+#define CHACHA20POLY1305_KEY_SIZE 32
+#define CHACHA20POLY1305_NONCE_SIZE 12
+#define CHACHA20POLY1305_DIGEST_SIZE 16
+
+struct chacha20poly1305_ctx
+{
+  struct chacha_ctx cipher;
+  struct poly1305_ctx mac;
+  uint64_t auth_size;
+  uint64_t data_size;
+};
+
+/*
+ * Streaming interface. After setting the nonce, the associated data is
+ * passed to update followed by the message to encrypt or decrypt, then
+ * digest writes the CHACHA20POLY1305_DIGEST_SIZE byte tag. Only the last
+ * encrypt or decrypt call may have a length that is not a multiple of 64.
+ * A single nonce may not be used for more than 2^38 - 64 bytes.
+ */
+void chacha20poly1305_set_key (struct chacha20poly1305_ctx *,
+                               const uint8_t *);
+void chacha20poly1305_set_nonce (struct chacha20poly1305_ctx *,
+                                 const uint8_t *);
+void chacha20poly1305_update (struct chacha20poly1305_ctx *, const uint8_t *,
+                              size_t);
+void chacha20poly1305_encrypt (struct chacha20poly1305_ctx *,
+                               const uint8_t *, uint8_t *, size_t);
+void chacha20poly1305_decrypt (struct chacha20poly1305_ctx *,
+                               const uint8_t *, uint8_t *, size_t);
+void chacha20poly1305_digest (struct chacha20poly1305_ctx *, uint8_t *);
+
+/*
+ * One-shot interface. The arguments are the nonce, the associated data, the
+ * input, the output and its length, and the tag. Open returns 0 if the tag
+ * matches and -1 otherwise, in which case the output is cleared.
+ */
+void chacha20poly1305_seal (struct chacha20poly1305_ctx *, const uint8_t *,
+                            const uint8_t *, size_t, const uint8_t *,
+                            uint8_t *, size_t, uint8_t *);
+int chacha20poly1305_open (struct chacha20poly1305_ctx *, const uint8_t *,
+                           const uint8_t *, size_t, const uint8_t *,
+                           uint8_t *, size_t, const uint8_t *);
+
+#endif /* CHACHA20POLY1305_H */
@@ -0,0 +1,112 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * CRC-32 and CRC-32C using the ARMv8 CRC32 instructions, which implement the
+ * same bit reflected polynomials as crc32.c. Eight bytes are processed per
+ * instruction and the tail a byte at a time. The CRC-32C code interleaves
+ * three streams like crc32c-sse42.c.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bswap.h"
+#include "crc32-internal.h"
+#include "crc32.h"
+
+#if defined(HAVE_ARM_CRC32_INTRINSICS)
+
+#include <arm_acle.h>
+
+#define ARMV8_TARGET __attribute__ ((target (ARM_CRC32_TARGET_ATTRIBUTE)))
+
+ARMV8_TARGET static uint32_t
+crc32_update_armv8 (uint32_t crc, const uint8_t *input, size_t len)
+{
+  for (; len >= 32; input += 32, len -= 32)
+    {
+      crc = __crc32d (crc, buff_get_le64 (input));
+      crc = __crc32d (crc, buff_get_le64 (input + 8));
+      crc = __crc32d (crc, buff_get_le64 (input + 16));
+      crc = __crc32d (crc, buff_get_le64 (input + 24));
+    }
+  for (; len >= 8; input += 8, len -= 8)
+    crc = __crc32d (crc, buff_get_le64 (input));
+  for (; len > 0; ++input, --len)
+    crc = __crc32b (crc, *input);
+  return crc;
+}
+
+const struct crc32_backend crc32_backend_armv8 = {
+  "armv8",
+  crc32_update_armv8,
+};
+
+/* Three streams of size bytes each, joined with shift. */
+#define CRC32C_STREAMS(size, shift)                                           \
+  for (; len >= 3 * (size); len -= 3 * (size))                                \
+    {                                                                         \
+      crc1 = 0;                                                               \
+      crc2 = 0;                                                               \
+      for (end = input + (size); input < end; input += 8)                     \
+        {                                                                     \
+          crc = __crc32cd (crc, buff_get_le64 (input));                       \
+          crc1 = __crc32cd (crc1, buff_get_le64 (input + (size)));            \
+          crc2 = __crc32cd (crc2, buff_get_le64 (input + 2 * (size)));        \
+        }                                                                     \
+      crc = shift (crc) ^ crc1;                                               \
+      crc = shift (crc) ^ crc2;                                               \
+      input += 2 * (size);                                                    \
+    }
+
+ARMV8_TARGET static uint32_t
+crc32c_update_armv8 (uint32_t crc, const uint8_t *input, size_t len)
+{
+  const uint8_t *end;
+  uint32_t crc1, crc2;
+
+  CRC32C_STREAMS (CRC32C_LONG, crc32c_shift_long);
+  CRC32C_STREAMS (CRC32C_SHORT, crc32c_shift_short);
+  for (; len >= 8; input += 8, len -= 8)
+    crc = __crc32cd (crc, buff_get_le64 (input));
+  for (; len > 0; ++input, --len)
+    crc = __crc32cb (crc, *input);
+  return crc;
+}
+
+const struct crc32_backend crc32c_backend_armv8 = {
+  "armv8",
+  crc32c_update_armv8,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int crc32_armv8_unused;
+
+#endif /* HAVE_ARM_CRC32_INTRINSICS */
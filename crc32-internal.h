@@ -0,0 +1,73 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between crc32.c and the accelerated CRC-32 implementations. The
+ * update function of a backend works on the CRC register without the initial
+ * and final XOR, like crc32_update_base, and handles any length itself.
+ * The same structure is used for the CRC-32C backends.
+ */
+
+#ifndef CRC32_INTERNAL_H
+#define CRC32_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct crc32_backend
+{
+  const char *name;
+  uint32_t (*update) (uint32_t, const uint8_t *, size_t);
+};
+
+#if defined(HAVE_PCLMUL_INTRINSICS)
+/* PCLMULQDQ folding in crc32-pclmul.c. */
+extern const struct crc32_backend crc32_backend_pclmul;
+#endif
+
+#if defined(HAVE_SSE42_INTRINSICS)
+/* SSE4.2 CRC32 instructions in crc32c-sse42.c. */
+extern const struct crc32_backend crc32c_backend_sse42;
+#endif
+
+#if defined(HAVE_ARM_CRC32_INTRINSICS)
+/* ARMv8 CRC32 and CRC32C instructions in crc32-armv8.c. */
+extern const struct crc32_backend crc32_backend_armv8;
+extern const struct crc32_backend crc32c_backend_armv8;
+#endif
+
+/*
+ * The hardware CRC-32C code runs three streams of CRC32C_LONG or
+ * CRC32C_SHORT bytes at once, to hide the latency of the instruction, and
+ * joins them by appending that many zero bytes to the register of each
+ * stream with these before XORing in the next.
+ */
+#define CRC32C_LONG 8192
+#define CRC32C_SHORT 256
+
+uint32_t crc32c_shift_long (uint32_t);
+uint32_t crc32c_shift_short (uint32_t);
+
+#endif /* CRC32_INTERNAL_H */
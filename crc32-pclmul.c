@@ -0,0 +1,144 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * CRC-32 using the PCLMULQDQ instruction. See "Fast CRC Computation for
+ * Generic Polynomials Using PCLMULQDQ Instruction" by Vinodh Gopal et al.
+ * Four 128-bit accumulators are each folded 512 bits forward per step, so
+ * the multiplications of one step don't depend on each other. They are then
+ * folded into one, reduced to 64 bits and finally Barrett reduced to the
+ * 32-bit CRC. The polynomial is bit reflected, so no byte swapping is needed.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "crc32-internal.h"
+#include "crc32.h"
+
+#if defined(HAVE_PCLMUL_INTRINSICS)
+
+#include <wmmintrin.h>
+
+#define PCLMUL_TARGET __attribute__ ((target (PCLMUL_TARGET_ATTRIBUTE)))
+
+/* Smallest input that is folded, shorter ones use the tables. */
+#define CRC32_PCLMUL_MIN_SIZE 64
+
+/*
+ * Folding constants, x^n mod P(x) bit reflected and shifted left one bit,
+ * for n = 4 * 128 + 32 and 4 * 128 - 32, then 128 + 32 and 128 - 32, and
+ * finally 64. The last pair is floor(x^64 / P(x)) and P(x) for the Barrett
+ * reduction.
+ */
+static const uint64_t crc32_pclmul_k1k2[2] = { 0x0154442bd4, 0x01c6e41596 };
+static const uint64_t crc32_pclmul_k3k4[2] = { 0x01751997d0, 0x00ccaa009e };
+static const uint64_t crc32_pclmul_k5 = 0x0163cd6124;
+static const uint64_t crc32_pclmul_poly[2] = { 0x01db710641, 0x01f7011641 };
+
+PCLMUL_TARGET static inline __m128i
+crc32_pclmul_load (const uint64_t *k)
+{
+  return _mm_set_epi64x ((long long)k[1], (long long)k[0]);
+}
+
+/* Multiplies x forward by the distance in k and adds in data. */
+PCLMUL_TARGET static inline __m128i
+crc32_pclmul_fold (__m128i x, __m128i k, __m128i data)
+{
+  return _mm_xor_si128 (_mm_xor_si128 (_mm_clmulepi64_si128 (x, k, 0x00),
+                                       _mm_clmulepi64_si128 (x, k, 0x11)),
+                        data);
+}
+
+PCLMUL_TARGET static uint32_t
+crc32_update_pclmul (uint32_t crc, const uint8_t *input, size_t len)
+{
+  __m128i x0, x1, x2, x3, x4, mask;
+
+  if (len < CRC32_PCLMUL_MIN_SIZE)
+    return crc32_update_slice16 (crc, input, len);
+
+  x1 = _mm_loadu_si128 ((const __m128i *)input);
+  x2 = _mm_loadu_si128 ((const __m128i *)(input + 16));
+  x3 = _mm_loadu_si128 ((const __m128i *)(input + 32));
+  x4 = _mm_loadu_si128 ((const __m128i *)(input + 48));
+  x1 = _mm_xor_si128 (x1, _mm_cvtsi32_si128 ((int)crc));
+  input += 64;
+  len -= 64;
+
+  x0 = crc32_pclmul_load (crc32_pclmul_k1k2);
+  for (; len >= 64; input += 64, len -= 64)
+    {
+      x1 = crc32_pclmul_fold (x1, x0,
+                              _mm_loadu_si128 ((const __m128i *)input));
+      x2 = crc32_pclmul_fold (x2, x0,
+                              _mm_loadu_si128 ((const __m128i *)(input + 16)));
+      x3 = crc32_pclmul_fold (x3, x0,
+                              _mm_loadu_si128 ((const __m128i *)(input + 32)));
+      x4 = crc32_pclmul_fold (x4, x0,
+                              _mm_loadu_si128 ((const __m128i *)(input + 48)));
+    }
+
+  /* Fold the four accumulators and any remaining blocks into one. */
+  x0 = crc32_pclmul_load (crc32_pclmul_k3k4);
+  x1 = crc32_pclmul_fold (x1, x0, x2);
+  x1 = crc32_pclmul_fold (x1, x0, x3);
+  x1 = crc32_pclmul_fold (x1, x0, x4);
+  for (; len >= 16; input += 16, len -= 16)
+    x1 = crc32_pclmul_fold (x1, x0, _mm_loadu_si128 ((const __m128i *)input));
+
+  /* Reduce 128 bits to 64. */
+  mask = _mm_set_epi32 (0, -1, 0, -1);
+  x2 = _mm_clmulepi64_si128 (x1, x0, 0x10);
+  x1 = _mm_xor_si128 (_mm_srli_si128 (x1, 8), x2);
+  x0 = _mm_cvtsi64_si128 ((long long)crc32_pclmul_k5);
+  x2 = _mm_srli_si128 (x1, 4);
+  x1 = _mm_clmulepi64_si128 (_mm_and_si128 (x1, mask), x0, 0x00);
+  x1 = _mm_xor_si128 (x1, x2);
+
+  /* Barrett reduction to 32 bits. */
+  x0 = crc32_pclmul_load (crc32_pclmul_poly);
+  x2 = _mm_clmulepi64_si128 (_mm_and_si128 (x1, mask), x0, 0x10);
+  x2 = _mm_clmulepi64_si128 (_mm_and_si128 (x2, mask), x0, 0x00);
+  x1 = _mm_xor_si128 (x1, x2);
+  crc = (uint32_t)_mm_cvtsi128_si32 (_mm_srli_si128 (x1, 4));
+
+  return crc32_update_slice16 (crc, input, len);
+}
+
+const struct crc32_backend crc32_backend_pclmul = {
+  "pclmul",
+  crc32_update_pclmul,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int crc32_pclmul_unused;
+
+#endif /* HAVE_PCLMUL_INTRINSICS */
@@ -23,78 +23,195 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 
+#include "bswap.h"
+#include "crc32-internal.h"
+#include "crc32-tables.h"
 #include "crc32.h"
-
-static const uint32_t crc32_table[256] = {
-  0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
-  0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
-  0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
-  0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
-  0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9,
-  0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
-  0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c,
-  0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
-  0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
-  0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
-  0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106,
-  0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
-  0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d,
-  0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
-  0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
-  0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
-  0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7,
-  0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
-  0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa,
-  0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
-  0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
-  0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
-  0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84,
-  0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
-  0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb,
-  0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
-  0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
-  0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
-  0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55,
-  0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
-  0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28,
-  0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
-  0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
-  0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
-  0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242,
-  0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
-  0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69,
-  0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
-  0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
-  0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
-  0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693,
-  0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
-  0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
-};
+#include "fcrypt_cpu.h"
+#include "fcrypt_parallel.h"
 
 /*
- * Base function that doesn't care about initial XOR or output XOR.
+ * The table driven code below is shared by every reflected 32-bit
+ * polynomial and takes the tables of one as its first argument. The public
+ * functions pass a constant, so each is specialized when these are inlined.
  */
-uint32_t
-crc32_update_base (uint32_t crc, const void *inputptr, size_t len)
+static inline uint32_t
+crc32_bytes (const uint32_t (*table)[256], uint32_t crc, const uint8_t *input,
+             size_t len)
 {
   size_t i;
-  const uint8_t *input = inputptr;
 
   for (i = 0; i < len; ++i)
-    crc = crc32_table[(crc ^ input[i]) & 0xff] ^ (crc >> 8);
+    crc = table[0][(crc ^ input[i]) & 0xff] ^ (crc >> 8);
   return crc;
 }
 
+static inline uint32_t
+crc32_slice8 (const uint32_t (*table)[256], uint32_t crc, const uint8_t *input,
+              size_t len)
+{
+  uint32_t a, b;
+
+  for (; len >= 8; len -= 8, input += 8)
+    {
+      a = buff_get_le32 (input) ^ crc;
+      b = buff_get_le32 (input + 4);
+      crc = table[7][a & 0xff] ^ table[6][(a >> 8) & 0xff]
+            ^ table[5][(a >> 16) & 0xff] ^ table[4][a >> 24]
+            ^ table[3][b & 0xff] ^ table[2][(b >> 8) & 0xff]
+            ^ table[1][(b >> 16) & 0xff] ^ table[0][b >> 24];
+    }
+  return crc32_bytes (table, crc, input, len);
+}
+
+static inline uint32_t
+crc32_slice16 (const uint32_t (*table)[256], uint32_t crc,
+               const uint8_t *input, size_t len)
+{
+  uint32_t a, b, c, d;
+
+  for (; len >= 16; len -= 16, input += 16)
+    {
+      a = buff_get_le32 (input) ^ crc;
+      b = buff_get_le32 (input + 4);
+      c = buff_get_le32 (input + 8);
+      d = buff_get_le32 (input + 12);
+      crc = table[15][a & 0xff] ^ table[14][(a >> 8) & 0xff]
+            ^ table[13][(a >> 16) & 0xff] ^ table[12][a >> 24]
+            ^ table[11][b & 0xff] ^ table[10][(b >> 8) & 0xff]
+            ^ table[9][(b >> 16) & 0xff] ^ table[8][b >> 24]
+            ^ table[7][c & 0xff] ^ table[6][(c >> 8) & 0xff]
+            ^ table[5][(c >> 16) & 0xff] ^ table[4][c >> 24]
+            ^ table[3][d & 0xff] ^ table[2][(d >> 8) & 0xff]
+            ^ table[1][(d >> 16) & 0xff] ^ table[0][d >> 24];
+    }
+  return crc32_slice8 (table, crc, input, len);
+}
+
+/*
+ * Base function that doesn't care about initial XOR or output XOR. This goes
+ * one byte at a time and is the reference for the sliced versions below.
+ */
+uint32_t
+crc32_update_base (uint32_t crc, const void *inputptr, size_t len)
+{
+  return crc32_bytes (crc32_table, crc, inputptr, len);
+}
+
+/*
+ * Slicing-by-8. Folds the CRC into the next 8 bytes of input and looks each
+ * byte up in the table for its distance from the end of the group.
+ */
+uint32_t
+crc32_update_slice8 (uint32_t crc, const void *inputptr, size_t len)
+{
+  return crc32_slice8 (crc32_table, crc, inputptr, len);
+}
+
+/*
+ * Slicing-by-16, the same as above with twice the number of independent
+ * lookups per iteration.
+ */
+uint32_t
+crc32_update_slice16 (uint32_t crc, const void *inputptr, size_t len)
+{
+  return crc32_slice16 (crc32_table, crc, inputptr, len);
+}
+
+static uint32_t
+crc32_update_table (uint32_t crc, const uint8_t *input, size_t len)
+{
+  return crc32_update_slice16 (crc, input, len);
+}
+
+static const struct crc32_backend crc32_backend_table = {
+  "table",
+  crc32_update_table,
+};
+
+static uint32_t
+crc32c_update_table (uint32_t crc, const uint8_t *input, size_t len)
+{
+  return crc32_slice16 (crc32c_table, crc, input, len);
+}
+
+static const struct crc32_backend crc32c_backend_table = {
+  "table",
+  crc32c_update_table,
+};
+
+static const struct crc32_backend *crc32_backend = &crc32_backend_table;
+static const struct crc32_backend *crc32c_backend = &crc32c_backend_table;
+
+/*
+ * Append CRC32C_LONG or CRC32C_SHORT zero bytes to a CRC-32C register, for
+ * the hardware backends to join their interleaved streams.
+ */
+uint32_t
+crc32c_shift_long (uint32_t crc)
+{
+  return crc32c_long_table[0][crc & 0xff]
+         ^ crc32c_long_table[1][(crc >> 8) & 0xff]
+         ^ crc32c_long_table[2][(crc >> 16) & 0xff]
+         ^ crc32c_long_table[3][crc >> 24];
+}
+
+uint32_t
+crc32c_shift_short (uint32_t crc)
+{
+  return crc32c_short_table[0][crc & 0xff]
+         ^ crc32c_short_table[1][(crc >> 8) & 0xff]
+         ^ crc32c_short_table[2][(crc >> 16) & 0xff]
+         ^ crc32c_short_table[3][crc >> 24];
+}
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+crc32_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+#if defined(HAVE_SSE42_INTRINSICS)
+  if ((features & FCRYPT_CPU_SSE42) != 0)
+    crc32c_backend = &crc32c_backend_sse42;
+#endif
+#if defined(HAVE_ARM_CRC32_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_CRC32) != 0)
+    crc32c_backend = &crc32c_backend_armv8;
+#endif
+#if defined(HAVE_PCLMUL_INTRINSICS)
+  if ((features & FCRYPT_CPU_PCLMUL) != 0
+      && (features & FCRYPT_CPU_SSSE3) != 0)
+    {
+      crc32_backend = &crc32_backend_pclmul;
+      return;
+    }
+#endif
+#if defined(HAVE_ARM_CRC32_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_CRC32) != 0)
+    {
+      crc32_backend = &crc32_backend_armv8;
+      return;
+    }
+#endif
+  (void)features;
+}
+#endif
+
 /*
  * Initial XOR of 0xffffffff and output XOR of 0xffffffff.
  */
 uint32_t
 crc32_update (uint32_t crc, const void *inputptr, size_t len)
 {
-  return crc32_update_base (crc ^ 0xffffffff, inputptr, len) ^ 0xffffffff;
+  return crc32_backend->update (crc ^ 0xffffffff, inputptr, len)
+         ^ 0xffffffff;
 }
 
 uint32_t
@@ -102,3 +219,112 @@ crc32 (const void *inputptr, size_t len)
 {
   return crc32_update (0, inputptr, len);
 }
+
+/* CRC-32C with the same initial and output XOR. */
+uint32_t
+crc32c_update (uint32_t crc, const void *inputptr, size_t len)
+{
+  return crc32c_backend->update (crc ^ 0xffffffff, inputptr, len)
+         ^ 0xffffffff;
+}
+
+uint32_t
+crc32c (const void *inputptr, size_t len)
+{
+  return crc32c_update (0, inputptr, len);
+}
+
+/*
+ * Multiplies a and b modulo the CRC polynomial. All three are bit reflected,
+ * so x^0 is the most significant bit.
+ */
+static uint32_t
+crc32_multmodp (uint32_t a, uint32_t b, uint32_t poly)
+{
+  uint32_t m, p;
+
+  p = 0;
+  for (m = UINT32_C (1) << 31; m != 0; m >>= 1)
+    {
+      if ((a & m) != 0)
+        p ^= b;
+      b = (b & 1) != 0 ? poly ^ (b >> 1) : b >> 1;
+    }
+  return p;
+}
+
+/*
+ * Shifts crc1 over a second segment of len2 bytes by multiplying it with
+ * x^(8 * len2) modulo the polynomial, which takes O(log len2)
+ * multiplications by squaring, and adds in crc2.
+ */
+static uint32_t
+crc32_combine_poly (uint32_t crc1, uint32_t crc2, uint64_t len2,
+                    uint32_t poly)
+{
+  uint32_t p, sq;
+
+  /* x^0 and x^8. */
+  p = UINT32_C (1) << 31;
+  sq = UINT32_C (1) << 23;
+  for (; len2 != 0; len2 >>= 1)
+    {
+      if ((len2 & 1) != 0)
+        p = crc32_multmodp (sq, p, poly);
+      sq = crc32_multmodp (sq, sq, poly);
+    }
+  return crc32_multmodp (p, crc1, poly) ^ crc2;
+}
+
+/*
+ * Returns the CRC-32 of two adjacent segments given the CRC-32 of each and
+ * the length of the second.
+ */
+uint32_t
+crc32_combine (uint32_t crc1, uint32_t crc2, uint64_t len2)
+{
+  return crc32_combine_poly (crc1, crc2, len2, 0xedb88320);
+}
+
+/* The same for CRC-32C. */
+uint32_t
+crc32c_combine (uint32_t crc1, uint32_t crc2, uint64_t len2)
+{
+  return crc32_combine_poly (crc1, crc2, len2, 0x82f63b78);
+}
+
+struct crc32_parallel_job
+{
+  const uint8_t *input;
+  uint32_t crc[FCRYPT_PARALLEL_MAX_THREADS];
+  size_t len[FCRYPT_PARALLEL_MAX_THREADS];
+};
+
+static void
+crc32_parallel_piece (void *ptr, unsigned int index, uint64_t offset,
+                      size_t len)
+{
+  struct crc32_parallel_job *job = ptr;
+
+  job->crc[index] = crc32 (job->input + offset, len);
+  job->len[index] = len;
+}
+
+/*
+ * Computes the same value as crc32 by splitting large inputs across up to
+ * the given number of threads and combining the CRC-32 of each piece.
+ */
+uint32_t
+crc32_parallel (const void *inputptr, size_t len, unsigned int threads)
+{
+  struct crc32_parallel_job job;
+  unsigned int i, pieces;
+  uint32_t crc;
+
+  job.input = inputptr;
+  pieces = fcrypt_parallel_range (crc32_parallel_piece, &job, len, 1, threads);
+  crc = job.crc[0];
+  for (i = 1; i < pieces; ++i)
+    crc = crc32_combine (crc, job.crc[i], job.len[i]);
+  return crc;
+}
@@ -30,7 +30,19 @@
 #include <stdint.h>
 
 uint32_t crc32_update_base (uint32_t, const void *, size_t);
+uint32_t crc32_update_slice8 (uint32_t, const void *, size_t);
+uint32_t crc32_update_slice16 (uint32_t, const void *, size_t);
 uint32_t crc32_update (uint32_t, const void *, size_t);
 uint32_t crc32 (const void *, size_t);
+uint32_t crc32_combine (uint32_t, uint32_t, uint64_t);
+uint32_t crc32_parallel (const void *, size_t, unsigned int);
+
+/*
+ * CRC-32C (Castagnoli), with the same conventions as the functions above.
+ * It uses the SSE4.2 or ARMv8 CRC32C instructions when the CPU has them.
+ */
+uint32_t crc32c_update (uint32_t, const void *, size_t);
+uint32_t crc32c (const void *, size_t);
+uint32_t crc32c_combine (uint32_t, uint32_t, uint64_t);
 
 #endif /* CRC32_H */
@@ -0,0 +1,106 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bswap.h"
+#include "crc64-tables.h"
+#include "crc64.h"
+
+#define CRC64_POLY UINT64_C (0xc96c5795d7870f42)
+
+/*
+ * Slicing-by-8. The CRC fills the whole 64-bit word, so it is folded into
+ * the next 8 bytes of input with a single XOR.
+ */
+uint64_t
+crc64_update (uint64_t crc, const void *inputptr, size_t len)
+{
+  const uint8_t *input = inputptr;
+
+  crc = ~crc;
+  for (; len >= 8; len -= 8, input += 8)
+    {
+      crc ^= buff_get_le64 (input);
+      crc = crc64_table[7][crc & 0xff] ^ crc64_table[6][(crc >> 8) & 0xff]
+            ^ crc64_table[5][(crc >> 16) & 0xff]
+            ^ crc64_table[4][(crc >> 24) & 0xff]
+            ^ crc64_table[3][(crc >> 32) & 0xff]
+            ^ crc64_table[2][(crc >> 40) & 0xff]
+            ^ crc64_table[1][(crc >> 48) & 0xff] ^ crc64_table[0][crc >> 56];
+    }
+  for (; len > 0; ++input, --len)
+    crc = crc64_table[0][(crc ^ *input) & 0xff] ^ (crc >> 8);
+  return ~crc;
+}
+
+uint64_t
+crc64 (const void *inputptr, size_t len)
+{
+  return crc64_update (0, inputptr, len);
+}
+
+/*
+ * Multiplies a and b modulo the CRC polynomial. Both are bit reflected, so
+ * x^0 is the most significant bit.
+ */
+static uint64_t
+crc64_multmodp (uint64_t a, uint64_t b)
+{
+  uint64_t m, p;
+
+  p = 0;
+  for (m = UINT64_C (1) << 63; m != 0; m >>= 1)
+    {
+      if ((a & m) != 0)
+        p ^= b;
+      b = (b & 1) != 0 ? CRC64_POLY ^ (b >> 1) : b >> 1;
+    }
+  return p;
+}
+
+/*
+ * Returns the CRC-64 of two adjacent segments given the CRC-64 of each and
+ * the length of the second, the same way as crc32_combine.
+ */
+uint64_t
+crc64_combine (uint64_t crc1, uint64_t crc2, uint64_t len2)
+{
+  uint64_t p, sq;
+
+  /* x^0 and x^8. */
+  p = UINT64_C (1) << 63;
+  sq = UINT64_C (1) << 55;
+  for (; len2 != 0; len2 >>= 1)
+    {
+      if ((len2 & 1) != 0)
+        p = crc64_multmodp (sq, p);
+      sq = crc64_multmodp (sq, sq);
+    }
+  return crc64_multmodp (p, crc1) ^ crc2;
+}
@@ -0,0 +1,106 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef CURVE25519_INTERNAL_H
+#define CURVE25519_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Arithmetic modulo p = 2^255 - 19 and on the twisted Edwards curve
+ * -x^2 + y^2 = 1 + dx^2y^2 shared by x25519.c and ed25519.c.
+ *
+ * A field element is five limbs of 51 bits, whose products are summed in
+ * 128 bits. Limbs are allowed to grow a few bits past 51 between
+ * multiplications, so additions don't carry.
+ */
+typedef uint64_t fe25519[5];
+
+/* Extended coordinates, x = X/Z, y = Y/Z and xy = T/Z. */
+struct ge25519_p3
+{
+  fe25519 X, Y, Z, T;
+};
+
+/* Affine point as (y + x, y - x, 2dxy), the form of the base tables. */
+struct ge25519_precomp
+{
+  fe25519 yplusx, yminusx, xy2d;
+};
+
+/* Point ready to be added, as (Y + X, Y - X, Z, 2dT). */
+struct ge25519_cached
+{
+  fe25519 YplusX, YminusX, Z, T2d;
+};
+
+/* Width of the tables of odd multiples used for variable time sums. */
+#define CURVE25519_ODD_MULTIPLES 8
+
+/*
+ * Scratch space for curve25519_multi_vartime, per point: the table of odd
+ * multiples and the sliding window digits of the scalar.
+ */
+struct curve25519_multi_scratch
+{
+  struct ge25519_cached table[CURVE25519_ODD_MULTIPLES];
+  signed char digits[256];
+};
+
+/*
+ * Montgomery ladder for X25519. Writes the u-coordinate of [k]P to the
+ * first argument, where k is the already clamped scalar and P the encoded
+ * u-coordinate of the third.
+ */
+void curve25519_scalarmult (uint8_t *, const uint8_t *, const uint8_t *);
+
+/*
+ * Constant time multiplications of the base point B by a scalar below
+ * 2^255. The first writes the u-coordinate of [k]B on the Montgomery curve
+ * and the second the Ed25519 encoding of [k]B.
+ */
+void curve25519_scalarmult_base (uint8_t *, const uint8_t *);
+void ed25519_scalarmult_base (uint8_t *, const uint8_t *);
+
+/*
+ * Decodes an Ed25519 point and negates it. Returns 0, or -1 if the encoding
+ * is not canonical or not a point on the curve. Variable time.
+ */
+int ed25519_decode_negate_vartime (struct ge25519_p3 *, const uint8_t *);
+
+/*
+ * Returns 0 if [8]([b]B + [s_0]P_0 + ... + [s_n-1]P_n-1) is the identity
+ * and -1 otherwise, where b is the first argument, the P_i are the points,
+ * and the s_i the scalars stored 32 bytes apart. All scalars must be below
+ * 2^253, which any scalar reduced modulo the group order is. The points are
+ * summed with Straus' method, sharing the doublings, and a sliding window
+ * of odd multiples of each point. Variable time.
+ */
+int curve25519_multi_vartime (const uint8_t *, const struct ge25519_p3 *,
+                              const uint8_t *, size_t,
+                              struct curve25519_multi_scratch *);
+
+#endif /* CURVE25519_INTERNAL_H */
@@ -0,0 +1,972 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Field and group arithmetic for X25519 and Ed25519. The formulas for the
+ * group are those of "High-speed high-security signatures" by Bernstein,
+ * Duif, Lange, Schwabe and Yang, in the extended coordinates of Hisil, Wong,
+ * Carter and Dawson, and the Montgomery ladder is that of RFC 7748.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "curve25519-internal.h"
+#include "curve25519-tables.h"
+#include "fcrypt_wipe.h"
+
+#define FE25519_MASK51 ((UINT64_C (1) << 51) - 1)
+
+/* Projective coordinates, x = X/Z and y = Y/Z. */
+struct ge25519_p2
+{
+  fe25519 X, Y, Z;
+};
+
+/* Completed coordinates, x = X/Z and y = Y/T. */
+struct ge25519_p1p1
+{
+  fe25519 X, Y, Z, T;
+};
+
+/*
+ * Sums of products of limbs need 128 bits. Compilers without a 128-bit type
+ * get the same arithmetic from pairs of 64-bit words.
+ */
+#if defined(__SIZEOF_INT128__)
+
+__extension__ typedef unsigned __int128 fe25519_wide;
+
+static inline fe25519_wide
+wide_mul (uint64_t a, uint64_t b)
+{
+  return (fe25519_wide)a * b;
+}
+
+static inline fe25519_wide
+wide_mac (fe25519_wide acc, uint64_t a, uint64_t b)
+{
+  return acc + (fe25519_wide)a * b;
+}
+
+static inline fe25519_wide
+wide_add (fe25519_wide acc, uint64_t a)
+{
+  return acc + a;
+}
+
+static inline uint64_t
+wide_shr51 (fe25519_wide a)
+{
+  return (uint64_t)(a >> 51);
+}
+
+static inline uint64_t
+wide_lo51 (fe25519_wide a)
+{
+  return (uint64_t)a & FE25519_MASK51;
+}
+
+#else
+
+typedef struct
+{
+  uint64_t lo, hi;
+} fe25519_wide;
+
+static inline fe25519_wide
+wide_mul (uint64_t a, uint64_t b)
+{
+  const uint64_t p00 = (a & 0xffffffff) * (b & 0xffffffff);
+  const uint64_t p01 = (a & 0xffffffff) * (b >> 32);
+  const uint64_t p10 = (a >> 32) * (b & 0xffffffff);
+  const uint64_t p11 = (a >> 32) * (b >> 32);
+  const uint64_t mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+  fe25519_wide r;
+
+  r.lo = (mid << 32) | (p00 & 0xffffffff);
+  r.hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return r;
+}
+
+static inline fe25519_wide
+wide_mac (fe25519_wide acc, uint64_t a, uint64_t b)
+{
+  const fe25519_wide t = wide_mul (a, b);
+
+  acc.lo += t.lo;
+  acc.hi += t.hi + (acc.lo < t.lo);
+  return acc;
+}
+
+static inline fe25519_wide
+wide_add (fe25519_wide acc, uint64_t a)
+{
+  acc.lo += a;
+  acc.hi += acc.lo < a;
+  return acc;
+}
+
+static inline uint64_t
+wide_shr51 (fe25519_wide a)
+{
+  return (a.lo >> 51) | (a.hi << 13);
+}
+
+static inline uint64_t
+wide_lo51 (fe25519_wide a)
+{
+  return a.lo & FE25519_MASK51;
+}
+
+#endif /* __SIZEOF_INT128__ */
+
+static inline void
+fe_0 (fe25519 h)
+{
+  memset (h, 0, sizeof (fe25519));
+}
+
+static inline void
+fe_1 (fe25519 h)
+{
+  memset (h, 0, sizeof (fe25519));
+  h[0] = 1;
+}
+
+static inline void
+fe_copy (fe25519 h, const fe25519 f)
+{
+  memcpy (h, f, sizeof (fe25519));
+}
+
+/* The sum has limbs of up to 53 bits, which fe_mul accepts. */
+static inline void
+fe_add (fe25519 h, const fe25519 f, const fe25519 g)
+{
+  h[0] = f[0] + g[0];
+  h[1] = f[1] + g[1];
+  h[2] = f[2] + g[2];
+  h[3] = f[3] + g[3];
+  h[4] = f[4] + g[4];
+}
+
+/* Propagates carries so that every limb but the second is below 2^51. */
+static inline void
+fe_carry (fe25519 h)
+{
+  h[1] += h[0] >> 51;
+  h[0] &= FE25519_MASK51;
+  h[2] += h[1] >> 51;
+  h[1] &= FE25519_MASK51;
+  h[3] += h[2] >> 51;
+  h[2] &= FE25519_MASK51;
+  h[4] += h[3] >> 51;
+  h[3] &= FE25519_MASK51;
+  h[0] += 19 * (h[4] >> 51);
+  h[4] &= FE25519_MASK51;
+}
+
+/* Adds 4p before subtracting so that no limb goes below zero. */
+static inline void
+fe_sub (fe25519 h, const fe25519 f, const fe25519 g)
+{
+  h[0] = f[0] + UINT64_C (0x1fffffffffffb4) - g[0];
+  h[1] = f[1] + UINT64_C (0x1ffffffffffffc) - g[1];
+  h[2] = f[2] + UINT64_C (0x1ffffffffffffc) - g[2];
+  h[3] = f[3] + UINT64_C (0x1ffffffffffffc) - g[3];
+  h[4] = f[4] + UINT64_C (0x1ffffffffffffc) - g[4];
+  fe_carry (h);
+}
+
+static inline void
+fe_neg (fe25519 h, const fe25519 f)
+{
+  fe25519 zero;
+
+  fe_0 (zero);
+  fe_sub (h, zero, f);
+}
+
+/* Reduces the five sums of products of fe_mul and fe_sq to 51-bit limbs. */
+static inline void
+fe_reduce_wide (fe25519 h, fe25519_wide r0, fe25519_wide r1,
+                fe25519_wide r2, fe25519_wide r3, fe25519_wide r4)
+{
+  r1 = wide_add (r1, wide_shr51 (r0));
+  h[0] = wide_lo51 (r0);
+  r2 = wide_add (r2, wide_shr51 (r1));
+  h[1] = wide_lo51 (r1);
+  r3 = wide_add (r3, wide_shr51 (r2));
+  h[2] = wide_lo51 (r2);
+  r4 = wide_add (r4, wide_shr51 (r3));
+  h[3] = wide_lo51 (r3);
+  h[4] = wide_lo51 (r4);
+  /* 2^255 = 19, and 19 times the carry may not fit in 64 bits. */
+  r0 = wide_mac (wide_mul (h[0], 1), wide_shr51 (r4), 19);
+  h[0] = wide_lo51 (r0);
+  h[1] += wide_shr51 (r0);
+}
+
+static void
+fe_mul (fe25519 h, const fe25519 f, const fe25519 g)
+{
+  const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  const uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+  const uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2;
+  const uint64_t g3_19 = 19 * g3, g4_19 = 19 * g4;
+  fe25519_wide r0, r1, r2, r3, r4;
+
+  r0 = wide_mul (f0, g0);
+  r0 = wide_mac (r0, f1, g4_19);
+  r0 = wide_mac (r0, f2, g3_19);
+  r0 = wide_mac (r0, f3, g2_19);
+  r0 = wide_mac (r0, f4, g1_19);
+
+  r1 = wide_mul (f0, g1);
+  r1 = wide_mac (r1, f1, g0);
+  r1 = wide_mac (r1, f2, g4_19);
+  r1 = wide_mac (r1, f3, g3_19);
+  r1 = wide_mac (r1, f4, g2_19);
+
+  r2 = wide_mul (f0, g2);
+  r2 = wide_mac (r2, f1, g1);
+  r2 = wide_mac (r2, f2, g0);
+  r2 = wide_mac (r2, f3, g4_19);
+  r2 = wide_mac (r2, f4, g3_19);
+
+  r3 = wide_mul (f0, g3);
+  r3 = wide_mac (r3, f1, g2);
+  r3 = wide_mac (r3, f2, g1);
+  r3 = wide_mac (r3, f3, g0);
+  r3 = wide_mac (r3, f4, g4_19);
+
+  r4 = wide_mul (f0, g4);
+  r4 = wide_mac (r4, f1, g3);
+  r4 = wide_mac (r4, f2, g2);
+  r4 = wide_mac (r4, f3, g1);
+  r4 = wide_mac (r4, f4, g0);
+
+  fe_reduce_wide (h, r0, r1, r2, r3, r4);
+}
+
+static void
+fe_sq (fe25519 h, const fe25519 f)
+{
+  const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  const uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1, f2_2 = 2 * f2;
+  const uint64_t f3_2 = 2 * f3, f3_19 = 19 * f3, f4_19 = 19 * f4;
+  fe25519_wide r0, r1, r2, r3, r4;
+
+  r0 = wide_mul (f0, f0);
+  r0 = wide_mac (r0, f1_2, f4_19);
+  r0 = wide_mac (r0, f2_2, f3_19);
+
+  r1 = wide_mul (f0_2, f1);
+  r1 = wide_mac (r1, f2_2, f4_19);
+  r1 = wide_mac (r1, f3, f3_19);
+
+  r2 = wide_mul (f0_2, f2);
+  r2 = wide_mac (r2, f1, f1);
+  r2 = wide_mac (r2, f3_2, f4_19);
+
+  r3 = wide_mul (f0_2, f3);
+  r3 = wide_mac (r3, f1_2, f2);
+  r3 = wide_mac (r3, f4, f4_19);
+
+  r4 = wide_mul (f0_2, f4);
+  r4 = wide_mac (r4, f1_2, f3);
+  r4 = wide_mac (r4, f2, f2);
+
+  fe_reduce_wide (h, r0, r1, r2, r3, r4);
+}
+
+/* Squares n times. */
+static void
+fe_sqn (fe25519 h, const fe25519 f, int n)
+{
+  fe_sq (h, f);
+  while (--n > 0)
+    fe_sq (h, h);
+}
+
+static void
+fe_mul_small (fe25519 h, const fe25519 f, uint32_t n)
+{
+  fe_reduce_wide (h, wide_mul (f[0], n), wide_mul (f[1], n),
+                  wide_mul (f[2], n), wide_mul (f[3], n), wide_mul (f[4], n));
+}
+
+/*
+ * Computes z^(2^250 - 1), the common part of inversion and square roots,
+ * along with z^11, which inversion needs as well.
+ */
+static void
+fe_pow250 (fe25519 h, fe25519 z11, const fe25519 z)
+{
+  fe25519 t0, t1, t2;
+
+  fe_sq (t0, z);               /* 2 */
+  fe_sqn (t1, t0, 2);          /* 8 */
+  fe_mul (t1, t1, z);          /* 9 */
+  fe_mul (z11, t0, t1);        /* 11 */
+  fe_sq (t0, z11);             /* 22 */
+  fe_mul (t0, t0, t1);         /* 2^5 - 1 */
+  fe_sqn (t1, t0, 5);          /* 2^10 - 2^5 */
+  fe_mul (t0, t1, t0);         /* 2^10 - 1 */
+  fe_sqn (t1, t0, 10);         /* 2^20 - 2^10 */
+  fe_mul (t1, t1, t0);         /* 2^20 - 1 */
+  fe_sqn (t2, t1, 20);         /* 2^40 - 2^20 */
+  fe_mul (t1, t2, t1);         /* 2^40 - 1 */
+  fe_sqn (t1, t1, 10);         /* 2^50 - 2^10 */
+  fe_mul (t0, t1, t0);         /* 2^50 - 1 */
+  fe_sqn (t1, t0, 50);         /* 2^100 - 2^50 */
+  fe_mul (t1, t1, t0);         /* 2^100 - 1 */
+  fe_sqn (t2, t1, 100);        /* 2^200 - 2^100 */
+  fe_mul (t1, t2, t1);         /* 2^200 - 1 */
+  fe_sqn (t1, t1, 50);         /* 2^250 - 2^50 */
+  fe_mul (h, t1, t0);          /* 2^250 - 1 */
+}
+
+/* z^(p - 2) = z^(2^255 - 21) */
+static void
+fe_invert (fe25519 h, const fe25519 z)
+{
+  fe25519 t, z11;
+
+  fe_pow250 (t, z11, z);
+  fe_sqn (t, t, 5);            /* 2^255 - 2^5 */
+  fe_mul (h, t, z11);          /* 2^255 - 21 */
+}
+
+/* z^((p - 5) / 8) = z^(2^252 - 3) */
+static void
+fe_pow22523 (fe25519 h, const fe25519 z)
+{
+  fe25519 t, z11;
+
+  fe_pow250 (t, z11, z);
+  fe_sqn (t, t, 2);            /* 2^252 - 4 */
+  fe_mul (h, t, z);            /* 2^252 - 3 */
+}
+
+/* Ignores the top bit, as both X25519 and Ed25519 require. */
+static void
+fe_frombytes (fe25519 h, const uint8_t *s)
+{
+  h[0] = buff_get_le64 (s) & FE25519_MASK51;
+  h[1] = (buff_get_le64 (s + 6) >> 3) & FE25519_MASK51;
+  h[2] = (buff_get_le64 (s + 12) >> 6) & FE25519_MASK51;
+  h[3] = (buff_get_le64 (s + 19) >> 1) & FE25519_MASK51;
+  h[4] = (buff_get_le64 (s + 24) >> 12) & FE25519_MASK51;
+}
+
+/* Writes the unique representative below p. */
+static void
+fe_tobytes (uint8_t *s, const fe25519 f)
+{
+  fe25519 t;
+  uint64_t q;
+
+  fe_copy (t, f);
+  fe_carry (t);
+  fe_carry (t);
+
+  /* q is 1 if t >= p, that is if t + 19 >= 2^255, and 0 otherwise. */
+  q = (t[0] + 19) >> 51;
+  q = (t[1] + q) >> 51;
+  q = (t[2] + q) >> 51;
+  q = (t[3] + q) >> 51;
+  q = (t[4] + q) >> 51;
+
+  /* Subtract qp by adding 19q and dropping bit 255. */
+  t[0] += 19 * q;
+  t[1] += t[0] >> 51;
+  t[0] &= FE25519_MASK51;
+  t[2] += t[1] >> 51;
+  t[1] &= FE25519_MASK51;
+  t[3] += t[2] >> 51;
+  t[2] &= FE25519_MASK51;
+  t[4] += t[3] >> 51;
+  t[3] &= FE25519_MASK51;
+  t[4] &= FE25519_MASK51;
+
+  buff_put_le64 (s, t[0] | (t[1] << 51));
+  buff_put_le64 (s + 8, (t[1] >> 13) | (t[2] << 38));
+  buff_put_le64 (s + 16, (t[2] >> 26) | (t[3] << 25));
+  buff_put_le64 (s + 24, (t[3] >> 39) | (t[4] << 12));
+}
+
+static int
+fe_isnegative (const fe25519 f)
+{
+  uint8_t s[32];
+
+  fe_tobytes (s, f);
+  return s[0] & 1;
+}
+
+static int
+fe_isnonzero (const fe25519 f)
+{
+  uint8_t s[32], acc;
+  size_t i;
+
+  fe_tobytes (s, f);
+  acc = 0;
+  for (i = 0; i < 32; ++i)
+    acc |= s[i];
+  return acc != 0;
+}
+
+/* Replaces f with g if b is 1 and leaves it if b is 0, in constant time. */
+static inline void
+fe_cmov (fe25519 f, const fe25519 g, uint64_t b)
+{
+  const uint64_t mask = -b;
+
+  f[0] ^= mask & (f[0] ^ g[0]);
+  f[1] ^= mask & (f[1] ^ g[1]);
+  f[2] ^= mask & (f[2] ^ g[2]);
+  f[3] ^= mask & (f[3] ^ g[3]);
+  f[4] ^= mask & (f[4] ^ g[4]);
+}
+
+static inline void
+fe_cswap (fe25519 f, fe25519 g, uint64_t b)
+{
+  const uint64_t mask = -b;
+  uint64_t x;
+  size_t i;
+
+  for (i = 0; i < 5; ++i)
+    {
+      x = mask & (f[i] ^ g[i]);
+      f[i] ^= x;
+      g[i] ^= x;
+    }
+}
+
+void
+curve25519_scalarmult (uint8_t *out, const uint8_t *scalar,
+                       const uint8_t *point)
+{
+  fe25519 x1, x2, z2, x3, z3;
+  fe25519 a, aa, b, bb, e, c, d;
+  uint64_t swap, bit;
+  int i;
+
+  fe_frombytes (x1, point);
+  fe_1 (x2);
+  fe_0 (z2);
+  fe_copy (x3, x1);
+  fe_1 (z3);
+
+  swap = 0;
+  for (i = 254; i >= 0; --i)
+    {
+      bit = (scalar[i >> 3] >> (i & 7)) & 1;
+      swap ^= bit;
+      fe_cswap (x2, x3, swap);
+      fe_cswap (z2, z3, swap);
+      swap = bit;
+
+      fe_add (a, x2, z2);
+      fe_sub (b, x2, z2);
+      fe_add (c, x3, z3);
+      fe_sub (d, x3, z3);
+      fe_sq (aa, a);
+      fe_sq (bb, b);
+      fe_mul (d, d, a);           /* DA */
+      fe_mul (c, c, b);           /* CB */
+      fe_sub (e, aa, bb);
+      fe_add (x3, d, c);
+      fe_sq (x3, x3);
+      fe_sub (z3, d, c);
+      fe_sq (z3, z3);
+      fe_mul (z3, z3, x1);
+      fe_mul (x2, aa, bb);
+      fe_mul_small (z2, e, 121665);
+      fe_add (z2, z2, aa);
+      fe_mul (z2, z2, e);
+    }
+  fe_cswap (x2, x3, swap);
+  fe_cswap (z2, z3, swap);
+
+  fe_invert (z2, z2);
+  fe_mul (x2, x2, z2);
+  fe_tobytes (out, x2);
+
+  fcrypt_wipe (x2, sizeof (x2));
+  fcrypt_wipe (z2, sizeof (z2));
+  fcrypt_wipe (x3, sizeof (x3));
+  fcrypt_wipe (z3, sizeof (z3));
+  fcrypt_wipe (a, sizeof (a));
+  fcrypt_wipe (b, sizeof (b));
+}
+
+static void
+ge_p2_0 (struct ge25519_p2 *h)
+{
+  fe_0 (h->X);
+  fe_1 (h->Y);
+  fe_1 (h->Z);
+}
+
+static void
+ge_p3_0 (struct ge25519_p3 *h)
+{
+  fe_0 (h->X);
+  fe_1 (h->Y);
+  fe_1 (h->Z);
+  fe_0 (h->T);
+}
+
+static void
+ge_p1p1_to_p2 (struct ge25519_p2 *r, const struct ge25519_p1p1 *p)
+{
+  fe_mul (r->X, p->X, p->T);
+  fe_mul (r->Y, p->Y, p->Z);
+  fe_mul (r->Z, p->Z, p->T);
+}
+
+static void
+ge_p1p1_to_p3 (struct ge25519_p3 *r, const struct ge25519_p1p1 *p)
+{
+  fe_mul (r->X, p->X, p->T);
+  fe_mul (r->Y, p->Y, p->Z);
+  fe_mul (r->Z, p->Z, p->T);
+  fe_mul (r->T, p->X, p->Y);
+}
+
+static void
+ge_p3_to_cached (struct ge25519_cached *r, const struct ge25519_p3 *p)
+{
+  fe_add (r->YplusX, p->Y, p->X);
+  fe_sub (r->YminusX, p->Y, p->X);
+  fe_copy (r->Z, p->Z);
+  fe_mul (r->T2d, p->T, curve25519_d2);
+}
+
+static void
+ge_p2_dbl (struct ge25519_p1p1 *r, const fe25519 X, const fe25519 Y,
+           const fe25519 Z)
+{
+  fe25519 t;
+
+  fe_sq (r->X, X);
+  fe_sq (r->Z, Y);
+  fe_sq (r->T, Z);
+  fe_add (r->T, r->T, r->T);
+  fe_add (r->Y, X, Y);
+  fe_sq (t, r->Y);
+  fe_add (r->Y, r->Z, r->X);
+  fe_sub (r->Z, r->Z, r->X);
+  fe_sub (r->X, t, r->Y);
+  fe_sub (r->T, r->T, r->Z);
+}
+
+static void
+ge_madd (struct ge25519_p1p1 *r, const struct ge25519_p3 *p,
+         const struct ge25519_precomp *q)
+{
+  fe25519 t;
+
+  fe_add (r->X, p->Y, p->X);
+  fe_sub (r->Y, p->Y, p->X);
+  fe_mul (r->Z, r->X, q->yplusx);
+  fe_mul (r->Y, r->Y, q->yminusx);
+  fe_mul (r->T, q->xy2d, p->T);
+  fe_add (t, p->Z, p->Z);
+  fe_sub (r->X, r->Z, r->Y);
+  fe_add (r->Y, r->Z, r->Y);
+  fe_add (r->Z, t, r->T);
+  fe_sub (r->T, t, r->T);
+}
+
+static void
+ge_msub (struct ge25519_p1p1 *r, const struct ge25519_p3 *p,
+         const struct ge25519_precomp *q)
+{
+  fe25519 t;
+
+  fe_add (r->X, p->Y, p->X);
+  fe_sub (r->Y, p->Y, p->X);
+  fe_mul (r->Z, r->X, q->yminusx);
+  fe_mul (r->Y, r->Y, q->yplusx);
+  fe_mul (r->T, q->xy2d, p->T);
+  fe_add (t, p->Z, p->Z);
+  fe_sub (r->X, r->Z, r->Y);
+  fe_add (r->Y, r->Z, r->Y);
+  fe_sub (r->Z, t, r->T);
+  fe_add (r->T, t, r->T);
+}
+
+static void
+ge_add (struct ge25519_p1p1 *r, const struct ge25519_p3 *p,
+        const struct ge25519_cached *q)
+{
+  fe25519 t;
+
+  fe_add (r->X, p->Y, p->X);
+  fe_sub (r->Y, p->Y, p->X);
+  fe_mul (r->Z, r->X, q->YplusX);
+  fe_mul (r->Y, r->Y, q->YminusX);
+  fe_mul (r->T, q->T2d, p->T);
+  fe_mul (r->X, p->Z, q->Z);
+  fe_add (t, r->X, r->X);
+  fe_sub (r->X, r->Z, r->Y);
+  fe_add (r->Y, r->Z, r->Y);
+  fe_add (r->Z, t, r->T);
+  fe_sub (r->T, t, r->T);
+}
+
+static void
+ge_sub (struct ge25519_p1p1 *r, const struct ge25519_p3 *p,
+        const struct ge25519_cached *q)
+{
+  fe25519 t;
+
+  fe_add (r->X, p->Y, p->X);
+  fe_sub (r->Y, p->Y, p->X);
+  fe_mul (r->Z, r->X, q->YminusX);
+  fe_mul (r->Y, r->Y, q->YplusX);
+  fe_mul (r->T, q->T2d, p->T);
+  fe_mul (r->X, p->Z, q->Z);
+  fe_add (t, r->X, r->X);
+  fe_sub (r->X, r->Z, r->Y);
+  fe_add (r->Y, r->Z, r->Y);
+  fe_sub (r->Z, t, r->T);
+  fe_add (r->T, t, r->T);
+}
+
+static void
+ge_precomp_cmov (struct ge25519_precomp *t, const struct ge25519_precomp *u,
+                 uint64_t b)
+{
+  fe_cmov (t->yplusx, u->yplusx, b);
+  fe_cmov (t->yminusx, u->yminusx, b);
+  fe_cmov (t->xy2d, u->xy2d, b);
+}
+
+/* 1 if b == c and 0 otherwise, for 0 <= b, c < 256. */
+static inline uint64_t
+ct_equal (uint32_t b, uint32_t c)
+{
+  return ((b ^ c) - 1) >> 31;
+}
+
+/* Loads b * 256^pos * B for -8 <= b <= 8 without branching on b. */
+static void
+ge_select_base (struct ge25519_precomp *t, int pos, signed char b)
+{
+  const uint64_t negative = (uint8_t)b >> 7;
+  const int mask = -(int)negative;
+  const uint32_t babs = (uint32_t)((b ^ mask) - mask);
+  struct ge25519_precomp minus;
+  uint32_t j;
+
+  fe_1 (t->yplusx);
+  fe_1 (t->yminusx);
+  fe_0 (t->xy2d);
+  for (j = 0; j < 8; ++j)
+    ge_precomp_cmov (t, &curve25519_base_table[pos][j],
+                     ct_equal (babs, j + 1));
+  fe_copy (minus.yplusx, t->yminusx);
+  fe_copy (minus.yminusx, t->yplusx);
+  fe_neg (minus.xy2d, t->xy2d);
+  ge_precomp_cmov (t, &minus, negative);
+}
+
+/*
+ * Writes the scalar as 64 signed radix 16 digits. The even ones are summed
+ * from the table directly and the odd ones are summed first and multiplied
+ * by 16 with four doublings, so the table only needs powers of 256.
+ */
+static void
+ge_scalarmult_base (struct ge25519_p3 *h, const uint8_t *scalar)
+{
+  struct ge25519_precomp t;
+  struct ge25519_p1p1 r;
+  struct ge25519_p2 s;
+  signed char e[64];
+  signed char carry;
+  int i;
+
+  for (i = 0; i < 32; ++i)
+    {
+      e[2 * i] = scalar[i] & 15;
+      e[2 * i + 1] = (scalar[i] >> 4) & 15;
+    }
+  carry = 0;
+  for (i = 0; i < 63; ++i)
+    {
+      e[i] += carry;
+      carry = (signed char)((e[i] + 8) >> 4);
+      e[i] -= (signed char)(carry * 16);
+    }
+  e[63] += carry;
+
+  ge_p3_0 (h);
+  for (i = 1; i < 64; i += 2)
+    {
+      ge_select_base (&t, i / 2, e[i]);
+      ge_madd (&r, h, &t);
+      ge_p1p1_to_p3 (h, &r);
+    }
+
+  ge_p2_dbl (&r, h->X, h->Y, h->Z);
+  ge_p1p1_to_p2 (&s, &r);
+  ge_p2_dbl (&r, s.X, s.Y, s.Z);
+  ge_p1p1_to_p2 (&s, &r);
+  ge_p2_dbl (&r, s.X, s.Y, s.Z);
+  ge_p1p1_to_p2 (&s, &r);
+  ge_p2_dbl (&r, s.X, s.Y, s.Z);
+  ge_p1p1_to_p3 (h, &r);
+
+  for (i = 0; i < 64; i += 2)
+    {
+      ge_select_base (&t, i / 2, e[i]);
+      ge_madd (&r, h, &t);
+      ge_p1p1_to_p3 (h, &r);
+    }
+
+  fcrypt_wipe (e, sizeof (e));
+  fcrypt_wipe (&t, sizeof (t));
+}
+
+void
+curve25519_scalarmult_base (uint8_t *out, const uint8_t *scalar)
+{
+  struct ge25519_p3 h;
+  fe25519 n, d;
+
+  /* u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y) */
+  ge_scalarmult_base (&h, scalar);
+  fe_add (n, h.Z, h.Y);
+  fe_sub (d, h.Z, h.Y);
+  fe_invert (d, d);
+  fe_mul (n, n, d);
+  fe_tobytes (out, n);
+  fcrypt_wipe (&h, sizeof (h));
+}
+
+void
+ed25519_scalarmult_base (uint8_t *out, const uint8_t *scalar)
+{
+  struct ge25519_p3 h;
+  fe25519 recip, x, y;
+
+  ge_scalarmult_base (&h, scalar);
+  fe_invert (recip, h.Z);
+  fe_mul (x, h.X, recip);
+  fe_mul (y, h.Y, recip);
+  fe_tobytes (out, y);
+  out[31] ^= (uint8_t)(fe_isnegative (x) << 7);
+  fcrypt_wipe (&h, sizeof (h));
+  fcrypt_wipe (x, sizeof (x));
+}
+
+int
+ed25519_decode_negate_vartime (struct ge25519_p3 *h, const uint8_t *s)
+{
+  fe25519 u, v, v3, vxx, check;
+  uint8_t t[32];
+
+  fe_frombytes (h->Y, s);
+  fe_tobytes (t, h->Y);
+  t[31] |= s[31] & 0x80;
+  if (memcmp (t, s, 32) != 0)
+    return -1;
+
+  /* x^2 = u / v = (y^2 - 1) / (dy^2 + 1) */
+  fe_1 (h->Z);
+  fe_sq (u, h->Y);
+  fe_mul (v, u, curve25519_d);
+  fe_sub (u, u, h->Z);
+  fe_add (v, v, h->Z);
+
+  /* x = uv^3 (uv^7)^((p - 5) / 8) */
+  fe_sq (v3, v);
+  fe_mul (v3, v3, v);
+  fe_sq (h->X, v3);
+  fe_mul (h->X, h->X, v);
+  fe_mul (h->X, h->X, u);
+  fe_pow22523 (h->X, h->X);
+  fe_mul (h->X, h->X, v3);
+  fe_mul (h->X, h->X, u);
+
+  /* vx^2 is u if x is a square root and -u if it must be fixed up. */
+  fe_sq (vxx, h->X);
+  fe_mul (vxx, vxx, v);
+  fe_sub (check, vxx, u);
+  if (fe_isnonzero (check))
+    {
+      fe_add (check, vxx, u);
+      if (fe_isnonzero (check))
+        return -1;
+      fe_mul (h->X, h->X, curve25519_sqrtm1);
+    }
+
+  if (!fe_isnonzero (h->X) && (s[31] >> 7) != 0)
+    return -1;
+  if (fe_isnegative (h->X) == (s[31] >> 7))
+    fe_neg (h->X, h->X);
+
+  fe_mul (h->T, h->X, h->Y);
+  return 0;
+}
+
+/*
+ * Writes the scalar as 256 digits that are zero or odd and in [-15, 15],
+ * with at least five zeros between nonzero ones on average.
+ */
+static void
+slide (signed char *r, const uint8_t *a)
+{
+  int i, b, k;
+
+  for (i = 0; i < 256; ++i)
+    r[i] = (signed char)(1 & (a[i >> 3] >> (i & 7)));
+
+  for (i = 0; i < 256; ++i)
+    {
+      if (r[i] == 0)
+        continue;
+      for (b = 1; b <= 6 && i + b < 256; ++b)
+        {
+          if (r[i + b] == 0)
+            continue;
+          if (r[i] + (r[i + b] << b) <= 15)
+            {
+              r[i] = (signed char)(r[i] + (r[i + b] << b));
+              r[i + b] = 0;
+            }
+          else if (r[i] - (r[i + b] << b) >= -15)
+            {
+              r[i] = (signed char)(r[i] - (r[i + b] << b));
+              for (k = i + b; k < 256; ++k)
+                {
+                  if (r[k] == 0)
+                    {
+                      r[k] = 1;
+                      break;
+                    }
+                  r[k] = 0;
+                }
+            }
+          else
+            break;
+        }
+    }
+}
+
+int
+curve25519_multi_vartime (const uint8_t *b, const struct ge25519_p3 *points,
+                          const uint8_t *scalars, size_t count,
+                          struct curve25519_multi_scratch *scratch)
+{
+  struct ge25519_cached *table;
+  signed char bdigits[256];
+  struct ge25519_p3 u, p2;
+  struct ge25519_p1p1 t;
+  struct ge25519_p2 r;
+  fe25519 check;
+  size_t k;
+  int i, j;
+  signed char d;
+
+  slide (bdigits, b);
+  for (k = 0; k < count; ++k)
+    {
+      slide (scratch[k].digits, scalars + 32 * k);
+      table = scratch[k].table;
+      ge_p3_to_cached (&table[0], &points[k]);
+      ge_p2_dbl (&t, points[k].X, points[k].Y, points[k].Z);
+      ge_p1p1_to_p3 (&p2, &t);
+      for (j = 0; j < CURVE25519_ODD_MULTIPLES - 1; ++j)
+        {
+          ge_add (&t, &p2, &table[j]);
+          ge_p1p1_to_p3 (&u, &t);
+          ge_p3_to_cached (&table[j + 1], &u);
+        }
+    }
+
+  /* Skip the doublings of the identity above the highest digit. */
+  for (i = 255; i >= 0; --i)
+    {
+      if (bdigits[i] != 0)
+        break;
+      for (k = 0; k < count && scratch[k].digits[i] == 0; ++k)
+        ;
+      if (k < count)
+        break;
+    }
+
+  ge_p2_0 (&r);
+  for (; i >= 0; --i)
+    {
+      ge_p2_dbl (&t, r.X, r.Y, r.Z);
+      for (k = 0; k < count; ++k)
+        {
+          d = scratch[k].digits[i];
+          if (d > 0)
+            {
+              ge_p1p1_to_p3 (&u, &t);
+              ge_add (&t, &u, &scratch[k].table[d / 2]);
+            }
+          else if (d < 0)
+            {
+              ge_p1p1_to_p3 (&u, &t);
+              ge_sub (&t, &u, &scratch[k].table[-d / 2]);
+            }
+        }
+      d = bdigits[i];
+      if (d > 0)
+        {
+          ge_p1p1_to_p3 (&u, &t);
+          ge_madd (&t, &u, &curve25519_base_odd[d / 2]);
+        }
+      else if (d < 0)
+        {
+          ge_p1p1_to_p3 (&u, &t);
+          ge_msub (&t, &u, &curve25519_base_odd[-d / 2]);
+        }
+      ge_p1p1_to_p2 (&r, &t);
+    }
+
+  /* Clear any component of small order, then test for (0, 1). */
+  for (j = 0; j < 3; ++j)
+    {
+      ge_p2_dbl (&t, r.X, r.Y, r.Z);
+      ge_p1p1_to_p2 (&r, &t);
+    }
+  fe_sub (check, r.Y, r.Z);
+  return fe_isnonzero (r.X) || fe_isnonzero (check) ? -1 : 0;
+}
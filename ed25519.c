@@ -0,0 +1,327 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "curve25519-internal.h"
+#include "ed25519.h"
+#include "fcrypt_random.h"
+#include "fcrypt_wipe.h"
+#include "sha512.h"
+
+/* Signatures per random linear combination in ed25519_verify_batch. */
+#define ED25519_BATCH_SIZE 64
+
+/* Bytes of each random coefficient, which bound the chance of a forgery. */
+#define ED25519_BATCH_COEFF_SIZE 16
+
+/* The group order L = 2^252 + 27742317777372353535851937790883648493. */
+static const int64_t ed25519_order[32] = {
+  0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7,
+  0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+};
+
+struct ed25519_batch
+{
+  struct ge25519_p3 points[2 * ED25519_BATCH_SIZE];
+  struct curve25519_multi_scratch scratch[2 * ED25519_BATCH_SIZE];
+  uint8_t scalars[2 * ED25519_BATCH_SIZE * 32];
+  uint8_t coeffs[ED25519_BATCH_SIZE * ED25519_BATCH_COEFF_SIZE];
+};
+
+/*
+ * Reduces 64 signed radix 256 digits modulo L into 32 bytes. Digits above
+ * 2^256 are folded down with 2^252 = -(L - 2^252) one at a time, keeping
+ * every digit small enough for 64 bits, and the remainder is reduced by
+ * its bits above 2^252 and a final conditional subtraction.
+ */
+static void
+sc_reduce_digits (uint8_t *r, int64_t *x)
+{
+  int64_t carry;
+  int i, j;
+
+  for (i = 63; i >= 32; --i)
+    {
+      carry = 0;
+      for (j = i - 32; j < i - 12; ++j)
+        {
+          x[j] += carry - 16 * x[i] * ed25519_order[j - (i - 32)];
+          carry = (x[j] + 128) >> 8;
+          x[j] -= carry * 256;
+        }
+      x[j] += carry;
+      x[i] = 0;
+    }
+  carry = 0;
+  for (j = 0; j < 32; ++j)
+    {
+      x[j] += carry - (x[31] >> 4) * ed25519_order[j];
+      carry = x[j] >> 8;
+      x[j] &= 255;
+    }
+  for (j = 0; j < 32; ++j)
+    x[j] -= carry * ed25519_order[j];
+  for (i = 0; i < 32; ++i)
+    {
+      x[i + 1] += x[i] >> 8;
+      r[i] = (uint8_t)(x[i] & 255);
+    }
+}
+
+/* r = s mod L for a 64 byte s. */
+static void
+sc_reduce (uint8_t *r, const uint8_t *s)
+{
+  int64_t x[64];
+  int i;
+
+  for (i = 0; i < 64; ++i)
+    x[i] = s[i];
+  sc_reduce_digits (r, x);
+  fcrypt_wipe (x, sizeof (x));
+}
+
+/* r = ab + c mod L. */
+static void
+sc_muladd (uint8_t *r, const uint8_t *a, const uint8_t *b, const uint8_t *c)
+{
+  int64_t x[64];
+  int i, j;
+
+  for (i = 0; i < 32; ++i)
+    x[i] = c[i];
+  for (; i < 64; ++i)
+    x[i] = 0;
+  for (i = 0; i < 32; ++i)
+    for (j = 0; j < 32; ++j)
+      x[i + j] += (int64_t)a[i] * b[j];
+  sc_reduce_digits (r, x);
+  fcrypt_wipe (x, sizeof (x));
+}
+
+/* Returns 1 if s < L, which RFC 8032 requires of S. */
+static int
+sc_is_canonical (const uint8_t *s)
+{
+  int i;
+
+  for (i = 31; i >= 0; --i)
+    {
+      if (s[i] != ed25519_order[i])
+        return s[i] < ed25519_order[i];
+    }
+  return 0;
+}
+
+/* k = SHA-512(R || A || M) mod L */
+static void
+ed25519_challenge (uint8_t *k, const uint8_t *r, const uint8_t *public_key,
+                   const void *msg, size_t len)
+{
+  struct sha512_ctx ctx;
+  uint8_t digest[SHA512_DIGEST_SIZE];
+
+  sha512_init (&ctx);
+  sha512_update (&ctx, r, 32);
+  sha512_update (&ctx, public_key, ED25519_PUBLIC_KEY_SIZE);
+  sha512_update (&ctx, msg, len);
+  sha512_final (digest, &ctx);
+  sc_reduce (k, digest);
+}
+
+/* Hashes the seed into the clamped scalar and the nonce prefix. */
+static void
+ed25519_expand (uint8_t *az, const uint8_t *seed)
+{
+  struct sha512_ctx ctx;
+
+  sha512_init (&ctx);
+  sha512_update (&ctx, seed, ED25519_SEED_SIZE);
+  sha512_final (az, &ctx);
+  az[0] &= 248;
+  az[31] &= 127;
+  az[31] |= 64;
+}
+
+void
+ed25519_public_key (uint8_t *public_key, const uint8_t *seed)
+{
+  uint8_t az[SHA512_DIGEST_SIZE];
+
+  ed25519_expand (az, seed);
+  ed25519_scalarmult_base (public_key, az);
+  fcrypt_wipe (az, sizeof (az));
+}
+
+void
+ed25519_sign (uint8_t *signature, const uint8_t *seed,
+              const uint8_t *public_key, const void *msg, size_t len)
+{
+  uint8_t az[SHA512_DIGEST_SIZE];
+  uint8_t nonce[SHA512_DIGEST_SIZE];
+  uint8_t r[32], k[32];
+  struct sha512_ctx ctx;
+
+  ed25519_expand (az, seed);
+
+  /* r = SHA-512(prefix || M) mod L and R = [r]B */
+  sha512_init (&ctx);
+  sha512_update (&ctx, az + 32, 32);
+  sha512_update (&ctx, msg, len);
+  sha512_final (nonce, &ctx);
+  sc_reduce (r, nonce);
+  ed25519_scalarmult_base (signature, r);
+
+  /* S = r + ka mod L */
+  ed25519_challenge (k, signature, public_key, msg, len);
+  sc_muladd (signature + 32, k, az, r);
+
+  fcrypt_wipe (az, sizeof (az));
+  fcrypt_wipe (nonce, sizeof (nonce));
+  fcrypt_wipe (r, sizeof (r));
+  fcrypt_wipe (&ctx, sizeof (ctx));
+}
+
+/*
+ * Checks S and decodes -A and -R into points, and writes k, for the sum
+ * [S]B + [k](-A) + (-R) whose multiple by 8 is the identity for a valid
+ * signature. Returns 0, or -1 if the signature is invalid on its face.
+ */
+static int
+ed25519_prepare (struct ge25519_p3 *points, uint8_t *k,
+                 const uint8_t *signature, const uint8_t *public_key,
+                 const void *msg, size_t len)
+{
+  if (!sc_is_canonical (signature + 32)
+      || ed25519_decode_negate_vartime (&points[0], public_key) != 0
+      || ed25519_decode_negate_vartime (&points[1], signature) != 0)
+    return -1;
+  ed25519_challenge (k, signature, public_key, msg, len);
+  return 0;
+}
+
+int
+ed25519_verify (const uint8_t *signature, const uint8_t *public_key,
+                const void *msg, size_t len)
+{
+  struct curve25519_multi_scratch scratch[2];
+  struct ge25519_p3 points[2];
+  uint8_t scalars[64];
+
+  if (ed25519_prepare (points, scalars, signature, public_key, msg, len)
+      != 0)
+    return -1;
+  memset (scalars + 32, 0, 32);
+  scalars[32] = 1;
+  return curve25519_multi_vartime (signature + 32, points, scalars, 2,
+                                   scratch);
+}
+
+/*
+ * Checks that the sum over the signatures of z_i([S_i]B - R_i - [k_i]A_i)
+ * is of small order, for random 128-bit z_i. An invalid signature makes
+ * the check fail except with probability 2^-128.
+ */
+static int
+ed25519_verify_group (struct ed25519_batch *batch,
+                      const uint8_t *const *signatures,
+                      const uint8_t *const *public_keys,
+                      const uint8_t *const *msgs, const size_t *lens,
+                      size_t count)
+{
+  uint8_t b[32], z[32], k[32], zero[32];
+  uint8_t *scalars;
+  size_t i;
+
+  if (fcrypt_random (batch->coeffs, count * ED25519_BATCH_COEFF_SIZE) != 0)
+    return -1;
+
+  memset (b, 0, sizeof (b));
+  memset (z, 0, sizeof (z));
+  memset (zero, 0, sizeof (zero));
+  for (i = 0; i < count; ++i)
+    {
+      scalars = batch->scalars + 64 * i;
+      if (ed25519_prepare (&batch->points[2 * i], k, signatures[i],
+                           public_keys[i], msgs[i], lens[i])
+          != 0)
+        return -1;
+      memcpy (z, batch->coeffs + ED25519_BATCH_COEFF_SIZE * i,
+              ED25519_BATCH_COEFF_SIZE);
+      sc_muladd (scalars, z, k, zero);
+      memcpy (scalars + 32, z, 32);
+      sc_muladd (b, z, signatures[i] + 32, b);
+    }
+  return curve25519_multi_vartime (b, batch->points, batch->scalars,
+                                   2 * count, batch->scratch);
+}
+
+int
+ed25519_verify_batch (int *valid, const uint8_t *const *signatures,
+                      const uint8_t *const *public_keys,
+                      const uint8_t *const *msgs, const size_t *lens,
+                      size_t count)
+{
+  struct ed25519_batch *batch;
+  size_t i, j, n;
+  int rv, ok;
+
+  /* Without memory for the batch, everything is verified one at a time. */
+  batch = count > 1 ? malloc (sizeof (*batch)) : NULL;
+  rv = 0;
+  for (i = 0; i < count; i += n)
+    {
+      n = count - i < ED25519_BATCH_SIZE ? count - i : ED25519_BATCH_SIZE;
+      if (batch != NULL && n > 1
+          && ed25519_verify_group (batch, signatures + i, public_keys + i,
+                                   msgs + i, lens + i, n)
+                 == 0)
+        {
+          if (valid != NULL)
+            for (j = 0; j < n; ++j)
+              valid[i + j] = 1;
+          continue;
+        }
+      for (j = i; j < i + n; ++j)
+        {
+          ok = ed25519_verify (signatures[j], public_keys[j], msgs[j],
+                               lens[j])
+               == 0;
+          if (valid != NULL)
+            valid[j] = ok;
+          if (!ok)
+            rv = -1;
+        }
+    }
+  free (batch);
+  return rv;
+}
@@ -0,0 +1,79 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Ed25519 signatures as described in RFC 8032, "Edwards-Curve Digital
+ * Signature Algorithm (EdDSA)". The private key is a 32 byte seed of random
+ * bytes from which the public key is derived.
+ *
+ * Verification accepts a signature when [8][S]B = [8]R + [8][k]A, the
+ * cofactored equation, which makes single and batch verification agree on
+ * every input. S must be below the group order and R and A must be
+ * canonical encodings of points on the curve.
+ */
+
+#ifndef ED25519_H
+#define ED25519_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ED25519_SEED_SIZE 32
+#define ED25519_PUBLIC_KEY_SIZE 32
+#define ED25519_SIGNATURE_SIZE 64
+
+/* Writes the public key of the seed in the second argument. */
+void ed25519_public_key (uint8_t *, const uint8_t *);
+
+/*
+ * Writes the signature of a message. The arguments are the output, the
+ * seed, its public key, the message and its length. Passing a public key
+ * that doesn't belong to the seed leaks the private key.
+ */
+void ed25519_sign (uint8_t *, const uint8_t *, const uint8_t *,
+                   const void *, size_t);
+
+/*
+ * Returns 0 if the signature in the first argument is valid for the public
+ * key and message that follow, and -1 otherwise.
+ */
+int ed25519_verify (const uint8_t *, const uint8_t *, const void *, size_t);
+
+/*
+ * Verifies many signatures at once. The arguments are an optional array
+ * that receives 1 for each valid signature and 0 for each invalid one, the
+ * arrays of signatures, public keys, messages and message lengths, and the
+ * number of signatures. Returns 0 if all are valid and -1 otherwise.
+ *
+ * Groups of signatures are checked with a single random linear combination
+ * of their equations, which costs about half as much per signature as
+ * verifying each one. A group that fails is verified one signature at a
+ * time to find the invalid ones.
+ */
+int ed25519_verify_batch (int *, const uint8_t *const *,
+                          const uint8_t *const *, const uint8_t *const *,
+                          const size_t *, size_t);
+
+#endif /* ED25519_H */
@@ -0,0 +1,61 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef FCRYPT_ALIGN_H
+#define FCRYPT_ALIGN_H
+
+#include <stddef.h>
+
+/* Alignment of a type, without relying on C11 _Alignof. */
+#define FCRYPT_ALIGNOF(type)                                                  \
+  offsetof (                                                                  \
+      struct {                                                                \
+        char c;                                                               \
+        type x;                                                               \
+      },                                                                      \
+      x)
+
+/*
+ * Size of a cache line on the processors the library is tuned for. The
+ * contexts of the hashes and ciphers with the largest or most frequently
+ * touched state are aligned to it, with the fields used by every block
+ * placed first and buffers starting on a line of their own, so that vector
+ * code sees aligned state and contexts placed one after another in an array
+ * never share a line. Memory for such a context must be allocated with
+ * aligned_alloc or posix_memalign using its alignment, which for the
+ * fcrypt_hash and fcrypt_cipher tables is the ctx_align member.
+ */
+#define FCRYPT_CACHE_LINE_SIZE 64
+
+/* Aligns a structure member, and so the structure, to a cache line. */
+#if defined(__GNUC__)
+#define FCRYPT_CACHE_ALIGNED __attribute__ ((aligned (FCRYPT_CACHE_LINE_SIZE)))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define FCRYPT_CACHE_ALIGNED _Alignas (FCRYPT_CACHE_LINE_SIZE)
+#else
+#define FCRYPT_CACHE_ALIGNED
+#endif
+
+#endif /* FCRYPT_ALIGN_H */
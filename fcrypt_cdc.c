@@ -0,0 +1,281 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fcrypt_cdc.h"
+#include "fcrypt_hash.h"
+#include "fcrypt_memzero.h"
+#include "gear.h"
+
+/* Bytes scanned and then hashed at once, well within the L1 cache. */
+#define FCRYPT_CDC_PIECE 4096
+
+/* Chunks hashed at once by fcrypt_cdc_update_multi. */
+#define FCRYPT_CDC_BATCH 16
+
+struct fcrypt_cdc
+{
+  const struct fcrypt_hash *hash;
+  size_t min, avg, max;
+  uint64_t mask_s;  /* Boundary mask before avg bytes */
+  uint64_t mask_l;  /* Boundary mask after avg bytes */
+  fcrypt_cdc_func *func;
+  void *arg;
+  uint64_t offset;  /* Start of the current chunk */
+  size_t len;       /* Bytes in the current chunk */
+  uint64_t gear;    /* Gear hash of the current chunk */
+  void *ctx;        /* Hash of the current chunk, after this structure */
+};
+
+/*
+ * Returns the high bits of a 64-bit word. The Gear hash shifts left, so its
+ * high bits depend on the most bytes.
+ */
+static uint64_t
+fcrypt_cdc_mask (unsigned int bits)
+{
+  return ~UINT64_C (0) << (64 - bits);
+}
+
+/*
+ * Scans bytes of a chunk that already has len bytes. Returns the number of
+ * bytes that belong to it and sets *cut if the chunk ends after them.
+ */
+static size_t
+fcrypt_cdc_scan (const struct fcrypt_cdc *cdc, uint64_t *gear, size_t len,
+                 const uint8_t *input, size_t inputlen, int *cut)
+{
+  size_t used, n;
+  uint64_t mask;
+
+  used = 0;
+  *cut = 0;
+  if (len < cdc->min)
+    {
+      used = cdc->min - len < inputlen ? cdc->min - len : inputlen;
+      len += used;
+      input += used;
+      inputlen -= used;
+    }
+  while (len >= cdc->min)
+    {
+      if (len == cdc->max)
+        {
+          *cut = 1;
+          break;
+        }
+      if (inputlen == 0)
+        break;
+      if (len < cdc->avg)
+        {
+          mask = cdc->mask_s;
+          n = cdc->avg - len;
+        }
+      else
+        {
+          mask = cdc->mask_l;
+          n = cdc->max - len;
+        }
+      if (n > inputlen)
+        n = inputlen;
+      n = gear_scan (gear, input, n, mask);
+      used += n;
+      len += n;
+      input += n;
+      inputlen -= n;
+      if ((*gear & mask) == 0)
+        {
+          *cut = 1;
+          break;
+        }
+    }
+  return used;
+}
+
+/* Finishes the current chunk, passes it on and starts the next. */
+static void
+fcrypt_cdc_emit (struct fcrypt_cdc *cdc)
+{
+  struct fcrypt_cdc_chunk chunk;
+
+  chunk.offset = cdc->offset;
+  chunk.len = cdc->len;
+  cdc->hash->final (chunk.digest, cdc->ctx);
+  cdc->func (cdc->arg, &chunk);
+  cdc->offset += cdc->len;
+  cdc->len = 0;
+  cdc->gear = 0;
+  cdc->hash->init (cdc->ctx);
+}
+
+struct fcrypt_cdc *
+fcrypt_cdc_new (const struct fcrypt_hash *hash, size_t min, size_t avg,
+                size_t max, fcrypt_cdc_func *func, void *arg)
+{
+  struct fcrypt_cdc *cdc;
+  unsigned int bits;
+  uintptr_t ctx;
+
+  if (hash == NULL || func == NULL || min < 64 || avg < min || max < avg)
+    {
+      errno = EINVAL;
+      return NULL;
+    }
+  cdc = malloc (sizeof (*cdc) + hash->ctx_align - 1 + hash->ctx_size);
+  if (cdc == NULL)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+
+  /* The floor of log2 (avg), which is at least 6. */
+  for (bits = 0; (avg >> bits) > 1; ++bits)
+    ;
+  if (bits > 62)
+    bits = 62;
+  cdc->hash = hash;
+  cdc->min = min;
+  cdc->avg = avg;
+  cdc->max = max;
+  cdc->mask_s = fcrypt_cdc_mask (bits + 2);
+  cdc->mask_l = fcrypt_cdc_mask (bits - 2);
+  cdc->func = func;
+  cdc->arg = arg;
+  cdc->offset = 0;
+  cdc->len = 0;
+  cdc->gear = 0;
+  ctx = (uintptr_t)(cdc + 1);
+  ctx += (hash->ctx_align - ctx % hash->ctx_align) % hash->ctx_align;
+  cdc->ctx = (void *)ctx;
+  hash->init (cdc->ctx);
+  return cdc;
+}
+
+void
+fcrypt_cdc_free (struct fcrypt_cdc *cdc)
+{
+  if (cdc == NULL)
+    return;
+  fcrypt_memzero (cdc->ctx, cdc->hash->ctx_size);
+  free (cdc);
+}
+
+void
+fcrypt_cdc_update (struct fcrypt_cdc *cdc, const void *inputptr,
+                   size_t inputlen)
+{
+  const uint8_t *input = inputptr;
+  size_t n;
+  int cut;
+
+  while (inputlen != 0)
+    {
+      n = fcrypt_cdc_scan (cdc, &cdc->gear, cdc->len, input,
+                           inputlen < FCRYPT_CDC_PIECE ? inputlen
+                                                       : FCRYPT_CDC_PIECE,
+                           &cut);
+      cdc->hash->update (cdc->ctx, input, n);
+      cdc->len += n;
+      input += n;
+      inputlen -= n;
+      if (cut)
+        fcrypt_cdc_emit (cdc);
+    }
+}
+
+void
+fcrypt_cdc_update_multi (struct fcrypt_cdc *cdc, const void *inputptr,
+                         size_t inputlen)
+{
+  uint8_t digests[FCRYPT_CDC_BATCH * FCRYPT_HASH_MAX_DIGEST_SIZE];
+  const uint8_t *inputs[FCRYPT_CDC_BATCH];
+  size_t lens[FCRYPT_CDC_BATCH];
+  const uint8_t *input = inputptr;
+  struct fcrypt_cdc_chunk chunk;
+  size_t count, n, i;
+  uint64_t gear;
+  int cut;
+
+  /* Finish a chunk started by an earlier call in its context. */
+  if (cdc->len != 0)
+    {
+      n = fcrypt_cdc_scan (cdc, &cdc->gear, cdc->len, input, inputlen, &cut);
+      cdc->hash->update (cdc->ctx, input, n);
+      cdc->len += n;
+      input += n;
+      inputlen -= n;
+      if (!cut)
+        return;
+      fcrypt_cdc_emit (cdc);
+    }
+
+  while (inputlen != 0)
+    {
+      for (count = 0; count < FCRYPT_CDC_BATCH && inputlen != 0; ++count)
+        {
+          gear = 0;
+          n = fcrypt_cdc_scan (cdc, &gear, 0, input, inputlen, &cut);
+          if (!cut)
+            {
+              /* The rest is the start of a chunk for the next call. */
+              cdc->hash->update (cdc->ctx, input, n);
+              cdc->len = n;
+              cdc->gear = gear;
+              inputlen = 0;
+              break;
+            }
+          inputs[count] = input;
+          lens[count] = n;
+          input += n;
+          inputlen -= n;
+        }
+
+      fcrypt_hash_multi (cdc->hash, digests, inputs, lens, count);
+      for (i = 0; i < count; ++i)
+        {
+          chunk.offset = cdc->offset;
+          chunk.len = lens[i];
+          memcpy (chunk.digest, digests + i * cdc->hash->digest_size,
+                  cdc->hash->digest_size);
+          cdc->func (cdc->arg, &chunk);
+          cdc->offset += lens[i];
+        }
+    }
+}
+
+void
+fcrypt_cdc_final (struct fcrypt_cdc *cdc)
+{
+  if (cdc->len != 0)
+    fcrypt_cdc_emit (cdc);
+  cdc->offset = 0;
+}
@@ -0,0 +1,94 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Content-defined chunking with FastCDC, fused with hashing of the chunks.
+ * Boundaries are found with the Gear rolling hash, and every byte is given
+ * to the update function of a hash while it is still in the L1 cache from
+ * the scan, so the data is read from memory once instead of once to find
+ * the boundaries and again to hash each chunk.
+ *
+ * A chunk is never shorter than min bytes, except for the last one of a
+ * stream, nor longer than max. The first min bytes of a chunk are not
+ * scanned. Up to avg bytes a boundary needs two more zero bits of the hash
+ * than log2 (avg), and after it two fewer, which draws the chunk sizes
+ * closer to avg than a single mask would.
+ */
+
+#ifndef FCRYPT_CDC_H
+#define FCRYPT_CDC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_hash.h"
+
+struct fcrypt_cdc;
+
+struct fcrypt_cdc_chunk
+{
+  uint64_t offset; /* From the start of the stream */
+  size_t len;
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE]; /* digest_size bytes used */
+};
+
+/* Called with the argument given to fcrypt_cdc_new for each chunk. */
+typedef void fcrypt_cdc_func (void *, const struct fcrypt_cdc_chunk *);
+
+/*
+ * Creates a chunker that hashes each chunk with the given hash, with the
+ * minimum, average and maximum chunk sizes, and passes the chunks in order
+ * to the function. Returns NULL with errno set to EINVAL unless
+ * 64 <= min <= avg <= max, or ENOMEM if there is not enough memory.
+ */
+struct fcrypt_cdc *fcrypt_cdc_new (const struct fcrypt_hash *, size_t,
+                                   size_t, size_t, fcrypt_cdc_func *, void *);
+
+/* Frees a chunker and clears the hash context in it. */
+void fcrypt_cdc_free (struct fcrypt_cdc *);
+
+/*
+ * Adds bytes to the stream, calling the function for every chunk that ends
+ * in them. The stream may be split anywhere without changing the chunks.
+ */
+void fcrypt_cdc_update (struct fcrypt_cdc *, const void *, size_t);
+
+/*
+ * Same as fcrypt_cdc_update, but finds all of the boundaries in a batch of
+ * chunks first and then hashes the batch with fcrypt_hash_multi, for MD5,
+ * SHA-1 and SHA-256 whose multi-buffer code is faster than hashing one
+ * chunk at a time. A batch is at most 16 chunks, which stays in the L2
+ * cache for chunks of a few KiB. Both functions give the same chunks and
+ * can be mixed.
+ */
+void fcrypt_cdc_update_multi (struct fcrypt_cdc *, const void *, size_t);
+
+/*
+ * Ends the stream, calling the function for the last chunk if it is not
+ * empty, and starts a new stream at offset zero.
+ */
+void fcrypt_cdc_final (struct fcrypt_cdc *);
+
+#endif /* FCRYPT_CDC_H */
@@ -0,0 +1,301 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "aes-internal.h"
+#include "aes.h"
+#include "blowfish.h"
+#include "camellia-internal.h"
+#include "camellia.h"
+#include "fcrypt_align.h"
+#include "fcrypt_cipher.h"
+#include "fcrypt_instrument.h"
+#include "fcrypt_probe.h"
+
+/*
+ * Defines the adapters from the void pointers of struct fcrypt_cipher to
+ * the functions of a cipher. SET_KEY sets up both directions and
+ * SET_ENCRYPT_KEY only encryption, which is the same function for ciphers
+ * that share one schedule. Each adapter fires the probes of fcrypt_probe.h
+ * around the call.
+ */
+#define FCRYPT_CIPHER_PROBE(id, len, CALL)                                    \
+  do                                                                          \
+    {                                                                         \
+      FCRYPT_PROBE_BULK_BEGIN (id##_cipher_counters,                          \
+                               fcrypt_cipher_##id.name, len);                 \
+      CALL;                                                                   \
+      FCRYPT_PROBE_BULK_END (id##_cipher_counters, fcrypt_cipher_##id.name,   \
+                             len);                                            \
+    }                                                                         \
+  while (0)
+
+#define FCRYPT_CIPHER_FUNCS(id, type, SET_KEY, SET_ENCRYPT_KEY)               \
+  FCRYPT_PROBE_COUNTERS (id##_cipher_counters)                                \
+                                                                              \
+  static void id##_cipher_set_key (void *ctx, const uint8_t *key)             \
+  {                                                                           \
+    FCRYPT_PROBE_SETUP_BEGIN (id##_cipher_counters, fcrypt_cipher_##id.name); \
+    SET_KEY ((type *)ctx, key);                                               \
+    FCRYPT_PROBE_SETUP_END (id##_cipher_counters, fcrypt_cipher_##id.name);   \
+  }                                                                           \
+                                                                              \
+  static void id##_cipher_set_encrypt_key (void *ctx, const uint8_t *key)     \
+  {                                                                           \
+    FCRYPT_PROBE_SETUP_BEGIN (id##_cipher_counters, fcrypt_cipher_##id.name); \
+    SET_ENCRYPT_KEY ((type *)ctx, key);                                       \
+    FCRYPT_PROBE_SETUP_END (id##_cipher_counters, fcrypt_cipher_##id.name);   \
+  }                                                                           \
+                                                                              \
+  static void id##_cipher_ecb_encrypt (void *ctx, const uint8_t *src,         \
+                                       uint8_t *dest, size_t len)             \
+  {                                                                           \
+    FCRYPT_CIPHER_PROBE (id, len,                                             \
+                         id##_ecb_encrypt ((type *)ctx, src, dest, len));     \
+  }                                                                           \
+                                                                              \
+  static void id##_cipher_ecb_decrypt (void *ctx, const uint8_t *src,         \
+                                       uint8_t *dest, size_t len)             \
+  {                                                                           \
+    FCRYPT_CIPHER_PROBE (id, len,                                             \
+                         id##_ecb_decrypt ((type *)ctx, src, dest, len));     \
+  }                                                                           \
+                                                                              \
+  static void id##_cipher_ctr_crypt (void *ctx, uint8_t *ctr,                 \
+                                     const uint8_t *src, uint8_t *dest,       \
+                                     size_t len)                              \
+  {                                                                           \
+    FCRYPT_CIPHER_PROBE (id, len,                                             \
+                         id##_ctr_crypt ((type *)ctx, ctr, src, dest, len));  \
+  }
+
+#define FCRYPT_CIPHER_CBC_FUNCS(id, type)                                     \
+  static void id##_cipher_cbc_encrypt (void *ctx, uint8_t *iv,                \
+                                       const uint8_t *src, uint8_t *dest,     \
+                                       size_t len)                            \
+  {                                                                           \
+    FCRYPT_CIPHER_PROBE (                                                     \
+        id, len, id##_cbc_encrypt ((type *)ctx, iv, src, dest, len));         \
+  }                                                                           \
+                                                                              \
+  static void id##_cipher_cbc_decrypt (void *ctx, uint8_t *iv,                \
+                                       const uint8_t *src, uint8_t *dest,     \
+                                       size_t len)                            \
+  {                                                                           \
+    FCRYPT_CIPHER_PROBE (                                                     \
+        id, len, id##_cbc_decrypt ((type *)ctx, iv, src, dest, len));         \
+  }
+
+/* The adapter of aes*_set_encrypt_key_batch, counted as one setup call. */
+#define FCRYPT_CIPHER_BATCH_FUNCS(id, type)                                   \
+  static void id##_cipher_set_encrypt_key_batch (                             \
+      void *ctxs, const uint8_t *const *keys, size_t count)                   \
+  {                                                                           \
+    FCRYPT_PROBE_SETUP_BEGIN (id##_cipher_counters, fcrypt_cipher_##id.name); \
+    id##_set_encrypt_key_batch ((type *)ctxs, keys, count);                   \
+    FCRYPT_PROBE_SETUP_END (id##_cipher_counters, fcrypt_cipher_##id.name);   \
+  }
+
+#define FCRYPT_CIPHER(id, str, type, keysize, blocksize, keybatch, cbcenc,    \
+                      cbcdec)                                                 \
+  const struct fcrypt_cipher fcrypt_cipher_##id                               \
+      = { str,                                                                \
+          keysize,                                                            \
+          blocksize,                                                          \
+          sizeof (type),                                                      \
+          FCRYPT_ALIGNOF (type),                                              \
+          id##_cipher_set_key,                                                \
+          id##_cipher_set_encrypt_key,                                        \
+          keybatch,                                                           \
+          id##_cipher_ecb_encrypt,                                            \
+          id##_cipher_ecb_decrypt,                                            \
+          cbcenc,                                                             \
+          cbcdec,                                                             \
+          id##_cipher_ctr_crypt };
+
+/* Camellia only has single block functions, so ECB loops over them. */
+#define CAMELLIA_ECB(bits)                                                    \
+  static void camellia##bits##_ecb_encrypt (                                  \
+      struct camellia##bits##_ctx *ctx, const uint8_t *src, uint8_t *dest,    \
+      size_t len)                                                             \
+  {                                                                           \
+    for (; len >= CAMELLIA_BLOCK_SIZE; len -= CAMELLIA_BLOCK_SIZE)            \
+      {                                                                       \
+        camellia##bits##_encrypt (ctx, src, dest);                            \
+        src += CAMELLIA_BLOCK_SIZE;                                           \
+        dest += CAMELLIA_BLOCK_SIZE;                                          \
+      }                                                                       \
+  }                                                                           \
+                                                                              \
+  static void camellia##bits##_ecb_decrypt (                                  \
+      struct camellia##bits##_ctx *ctx, const uint8_t *src, uint8_t *dest,    \
+      size_t len)                                                             \
+  {                                                                           \
+    for (; len >= CAMELLIA_BLOCK_SIZE; len -= CAMELLIA_BLOCK_SIZE)            \
+      {                                                                       \
+        camellia##bits##_decrypt (ctx, src, dest);                            \
+        src += CAMELLIA_BLOCK_SIZE;                                           \
+        dest += CAMELLIA_BLOCK_SIZE;                                          \
+      }                                                                       \
+  }
+
+static void
+blowfish_set_key128 (struct blowfish_ctx *ctx, const uint8_t *key)
+{
+  blowfish_set_key (ctx, key, 16);
+}
+
+/*
+ * aes*_set_decrypt_key expands the schedules for both directions, so the
+ * decryption functions never write to a context after set_key and a keyed
+ * context can be shared between threads. set_encrypt_key only expands the
+ * encryption schedule, which is all the encryption functions read.
+ */
+FCRYPT_CIPHER_FUNCS (aes128, struct aes128_ctx, aes128_set_decrypt_key,
+                     aes128_set_encrypt_key)
+FCRYPT_CIPHER_BATCH_FUNCS (aes128, struct aes128_ctx)
+FCRYPT_CIPHER_CBC_FUNCS (aes128, struct aes128_ctx)
+FCRYPT_CIPHER (aes128, "aes128", struct aes128_ctx, AES128_KEY_SIZE,
+               AES_BLOCK_SIZE, aes128_cipher_set_encrypt_key_batch,
+               aes128_cipher_cbc_encrypt, aes128_cipher_cbc_decrypt)
+
+FCRYPT_CIPHER_FUNCS (aes192, struct aes192_ctx, aes192_set_decrypt_key,
+                     aes192_set_encrypt_key)
+FCRYPT_CIPHER_BATCH_FUNCS (aes192, struct aes192_ctx)
+FCRYPT_CIPHER_CBC_FUNCS (aes192, struct aes192_ctx)
+FCRYPT_CIPHER (aes192, "aes192", struct aes192_ctx, AES192_KEY_SIZE,
+               AES_BLOCK_SIZE, aes192_cipher_set_encrypt_key_batch,
+               aes192_cipher_cbc_encrypt, aes192_cipher_cbc_decrypt)
+
+FCRYPT_CIPHER_FUNCS (aes256, struct aes256_ctx, aes256_set_decrypt_key,
+                     aes256_set_encrypt_key)
+FCRYPT_CIPHER_BATCH_FUNCS (aes256, struct aes256_ctx)
+FCRYPT_CIPHER_CBC_FUNCS (aes256, struct aes256_ctx)
+FCRYPT_CIPHER (aes256, "aes256", struct aes256_ctx, AES256_KEY_SIZE,
+               AES_BLOCK_SIZE, aes256_cipher_set_encrypt_key_batch,
+               aes256_cipher_cbc_encrypt, aes256_cipher_cbc_decrypt)
+
+CAMELLIA_ECB (128)
+FCRYPT_CIPHER_FUNCS (camellia128, struct camellia128_ctx,
+                     camellia128_set_key, camellia128_set_key)
+FCRYPT_CIPHER (camellia128, "camellia128", struct camellia128_ctx,
+               CAMELLIA128_KEY_SIZE, CAMELLIA_BLOCK_SIZE, NULL, NULL, NULL)
+
+CAMELLIA_ECB (192)
+FCRYPT_CIPHER_FUNCS (camellia192, struct camellia192_ctx,
+                     camellia192_set_key, camellia192_set_key)
+FCRYPT_CIPHER (camellia192, "camellia192", struct camellia192_ctx,
+               CAMELLIA192_KEY_SIZE, CAMELLIA_BLOCK_SIZE, NULL, NULL, NULL)
+
+CAMELLIA_ECB (256)
+FCRYPT_CIPHER_FUNCS (camellia256, struct camellia256_ctx,
+                     camellia256_set_key, camellia256_set_key)
+FCRYPT_CIPHER (camellia256, "camellia256", struct camellia256_ctx,
+               CAMELLIA256_KEY_SIZE, CAMELLIA_BLOCK_SIZE, NULL, NULL, NULL)
+
+FCRYPT_CIPHER_FUNCS (blowfish, struct blowfish_ctx, blowfish_set_key128,
+                     blowfish_set_key128)
+FCRYPT_CIPHER_CBC_FUNCS (blowfish, struct blowfish_ctx)
+FCRYPT_CIPHER (blowfish, "blowfish", struct blowfish_ctx, 16,
+               BLOWFISH_BLOCK_SIZE, NULL, blowfish_cipher_cbc_encrypt,
+               blowfish_cipher_cbc_decrypt)
+
+static const struct fcrypt_cipher *const fcrypt_ciphers[] = {
+  &fcrypt_cipher_aes128,      &fcrypt_cipher_aes192,
+  &fcrypt_cipher_aes256,      &fcrypt_cipher_camellia128,
+  &fcrypt_cipher_camellia192, &fcrypt_cipher_camellia256,
+  &fcrypt_cipher_blowfish,
+};
+
+const struct fcrypt_cipher *
+fcrypt_cipher_lookup (const char *name)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (fcrypt_ciphers) / sizeof (fcrypt_ciphers[0]); ++i)
+    if (strcmp (fcrypt_ciphers[i]->name, name) == 0)
+      return fcrypt_ciphers[i];
+  return NULL;
+}
+
+const struct fcrypt_cipher *
+fcrypt_cipher_get (size_t index)
+{
+  if (index >= sizeof (fcrypt_ciphers) / sizeof (fcrypt_ciphers[0]))
+    return NULL;
+  return fcrypt_ciphers[index];
+}
+
+#if defined(FCRYPT_INSTRUMENT)
+/* The counters of each table, in the order of fcrypt_ciphers. */
+static struct fcrypt_counters *const fcrypt_cipher_counter_list[] = {
+  &aes128_cipher_counters,      &aes192_cipher_counters,
+  &aes256_cipher_counters,      &camellia128_cipher_counters,
+  &camellia192_cipher_counters, &camellia256_cipher_counters,
+  &blowfish_cipher_counters,
+};
+
+void
+fcrypt_cipher_clear_counters (void)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (fcrypt_ciphers) / sizeof (fcrypt_ciphers[0]); ++i)
+    fcrypt_probe_clear (fcrypt_cipher_counter_list[i]);
+}
+#endif /* FCRYPT_INSTRUMENT */
+
+int
+fcrypt_cipher_counters (const struct fcrypt_cipher *cipher,
+                        struct fcrypt_counters *counters)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (fcrypt_ciphers) / sizeof (fcrypt_ciphers[0]); ++i)
+    if (fcrypt_ciphers[i] == cipher)
+      {
+#if defined(FCRYPT_INSTRUMENT)
+        fcrypt_probe_read (fcrypt_cipher_counter_list[i], counters);
+#else
+        memset (counters, 0, sizeof (*counters));
+#endif
+        if (cipher == &fcrypt_cipher_aes128 || cipher == &fcrypt_cipher_aes192
+            || cipher == &fcrypt_cipher_aes256)
+          counters->backend = aes_backend_name ();
+        else if (cipher == &fcrypt_cipher_blowfish)
+          counters->backend = "generic";
+        else
+          counters->backend = camellia_backend_name ();
+        return 0;
+      }
+  errno = EINVAL;
+  return -1;
+}
@@ -0,0 +1,89 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Algorithm agnostic interface to the block ciphers, in the manner of
+ * fcrypt_hash.h. set_key sets the key for both directions at once, and
+ * set_encrypt_key only for ecb_encrypt, cbc_encrypt and ctr_crypt, which
+ * saves deriving a decryption schedule that those never use. The modes take
+ * lengths in bytes, which must be multiples of block_size for ECB and CBC.
+ * CTR treats the iv as a big-endian counter of block_size bytes.
+ */
+
+#ifndef FCRYPT_CIPHER_H
+#define FCRYPT_CIPHER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Largest key_size and block_size of the ciphers below. */
+#define FCRYPT_CIPHER_MAX_KEY_SIZE 32
+#define FCRYPT_CIPHER_MAX_BLOCK_SIZE 16
+
+struct fcrypt_cipher
+{
+  const char *name; /* Lower case, e.g. "aes128" */
+  size_t key_size;
+  size_t block_size;
+  size_t ctx_size;  /* Bytes needed for the context */
+  size_t ctx_align; /* Required alignment of the context */
+  void (*set_key) (void *, const uint8_t *);
+  void (*set_encrypt_key) (void *, const uint8_t *);
+  /*
+   * Calls set_encrypt_key for an array of count contexts, ctx_size bytes
+   * apart, with one key each. NULL if the cipher has no faster way of doing
+   * that than one call at a time.
+   */
+  void (*set_encrypt_key_batch) (void *, const uint8_t *const *, size_t);
+  void (*ecb_encrypt) (void *, const uint8_t *, uint8_t *, size_t);
+  void (*ecb_decrypt) (void *, const uint8_t *, uint8_t *, size_t);
+  /* NULL if the cipher has no CBC mode. */
+  void (*cbc_encrypt) (void *, uint8_t *, const uint8_t *, uint8_t *,
+                       size_t);
+  void (*cbc_decrypt) (void *, uint8_t *, const uint8_t *, uint8_t *,
+                       size_t);
+  void (*ctr_crypt) (void *, uint8_t *, const uint8_t *, uint8_t *, size_t);
+};
+
+extern const struct fcrypt_cipher fcrypt_cipher_aes128;
+extern const struct fcrypt_cipher fcrypt_cipher_aes192;
+extern const struct fcrypt_cipher fcrypt_cipher_aes256;
+extern const struct fcrypt_cipher fcrypt_cipher_camellia128;
+extern const struct fcrypt_cipher fcrypt_cipher_camellia192;
+extern const struct fcrypt_cipher fcrypt_cipher_camellia256;
+
+/* Blowfish with a 128-bit key. */
+extern const struct fcrypt_cipher fcrypt_cipher_blowfish;
+
+/* Returns the cipher with the given name, or NULL if there is none. */
+const struct fcrypt_cipher *fcrypt_cipher_lookup (const char *);
+
+/*
+ * Returns the cipher with the given index, counting from zero, or NULL past
+ * the last one, for listing the ciphers.
+ */
+const struct fcrypt_cipher *fcrypt_cipher_get (size_t);
+
+#endif /* FCRYPT_CIPHER_H */
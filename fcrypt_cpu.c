@@ -0,0 +1,225 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_CPUID_H)
+#include <cpuid.h>
+#endif
+#if defined(HAVE_SYS_AUXV_H)
+#include <sys/auxv.h>
+#endif
+
+#include "fcrypt_cpu.h"
+
+/* Bits from the Linux AArch64 AT_HWCAP auxiliary vector entry. */
+#define AARCH64_HWCAP_ASIMD (1UL << 1)
+#define AARCH64_HWCAP_AES (1UL << 3)
+#define AARCH64_HWCAP_PMULL (1UL << 4)
+#define AARCH64_HWCAP_SHA1 (1UL << 5)
+#define AARCH64_HWCAP_SHA2 (1UL << 6)
+#define AARCH64_HWCAP_CRC32 (1UL << 7)
+#define AARCH64_HWCAP_SHA3 (1UL << 17)
+#define AARCH64_HWCAP_SHA512 (1UL << 21)
+
+/* Register state that the OS saves, from XCR0. */
+#define XCR0_AVX 0x06
+#define XCR0_AVX512 0xe0
+
+#if defined(HAVE_CPUID_H) && (defined(__x86_64__) || defined(__i386__))
+/* Only valid if CPUID reports OSXSAVE. */
+static uint32_t
+fcrypt_xgetbv0 (void)
+{
+  uint32_t lo, hi;
+
+  __asm__ ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  (void)hi;
+  return lo;
+}
+#endif
+
+static uint32_t
+fcrypt_cpu_detect (void)
+{
+  uint32_t features;
+#if defined(HAVE_CPUID_H) && (defined(__x86_64__) || defined(__i386__))
+  unsigned int eax, ebx, ecx, edx;
+  uint32_t xcr0;
+#endif
+#if defined(HAVE_GETAUXVAL) && defined(__aarch64__)
+  unsigned long hwcap;
+#endif
+
+  features = 0;
+
+#if defined(HAVE_CPUID_H) && (defined(__x86_64__) || defined(__i386__))
+  xcr0 = 0;
+  if (__get_cpuid (1, &eax, &ebx, &ecx, &edx) != 0)
+    {
+      if ((edx & bit_SSE2) != 0)
+        features |= FCRYPT_CPU_SSE2;
+      if ((ecx & bit_SSSE3) != 0)
+        features |= FCRYPT_CPU_SSSE3;
+      if ((ecx & bit_AES) != 0)
+        features |= FCRYPT_CPU_AESNI;
+      if ((ecx & bit_PCLMUL) != 0)
+        features |= FCRYPT_CPU_PCLMUL;
+      if ((ecx & bit_SSE4_1) != 0)
+        features |= FCRYPT_CPU_SSE41;
+      if ((ecx & bit_SSE4_2) != 0)
+        features |= FCRYPT_CPU_SSE42;
+      if ((ecx & bit_OSXSAVE) != 0)
+        xcr0 = fcrypt_xgetbv0 ();
+    }
+  /* __get_cpuid_count checks that leaf 7 exists. */
+  if (__get_cpuid_count (7, 0, &eax, &ebx, &ecx, &edx) != 0)
+    {
+      if ((ebx & bit_SHA) != 0)
+        features |= FCRYPT_CPU_SHA;
+      if ((ebx & bit_BMI2) != 0)
+        features |= FCRYPT_CPU_BMI2;
+      /* The AVX registers are only usable if the OS saves them. */
+      if ((ebx & bit_AVX2) != 0 && (xcr0 & XCR0_AVX) == XCR0_AVX)
+        features |= FCRYPT_CPU_AVX2;
+      if ((ebx & bit_AVX512F) != 0
+          && (xcr0 & (XCR0_AVX | XCR0_AVX512)) == (XCR0_AVX | XCR0_AVX512))
+        features |= FCRYPT_CPU_AVX512F;
+    }
+#endif
+
+#if defined(HAVE_GETAUXVAL) && defined(__aarch64__)
+  hwcap = getauxval (AT_HWCAP);
+  if ((hwcap & AARCH64_HWCAP_ASIMD) != 0)
+    features |= FCRYPT_CPU_ARM_NEON;
+  if ((hwcap & AARCH64_HWCAP_AES) != 0)
+    features |= FCRYPT_CPU_ARM_AES;
+  if ((hwcap & AARCH64_HWCAP_PMULL) != 0)
+    features |= FCRYPT_CPU_ARM_PMULL;
+  if ((hwcap & AARCH64_HWCAP_SHA1) != 0)
+    features |= FCRYPT_CPU_ARM_SHA1;
+  if ((hwcap & AARCH64_HWCAP_SHA2) != 0)
+    features |= FCRYPT_CPU_ARM_SHA2;
+  if ((hwcap & AARCH64_HWCAP_CRC32) != 0)
+    features |= FCRYPT_CPU_ARM_CRC32;
+  if ((hwcap & AARCH64_HWCAP_SHA512) != 0)
+    features |= FCRYPT_CPU_ARM_SHA512;
+  if ((hwcap & AARCH64_HWCAP_SHA3) != 0)
+    features |= FCRYPT_CPU_ARM_SHA3;
+#endif
+
+  return features;
+}
+
+struct fcrypt_cpu_name
+{
+  const char *name;
+  uint32_t bits;
+};
+
+static const struct fcrypt_cpu_name fcrypt_cpu_names[] = {
+  { "all", UINT32_C (0xffffffff) },
+  { "ssse3", FCRYPT_CPU_SSSE3 },
+  { "aesni", FCRYPT_CPU_AESNI },
+  { "pclmul", FCRYPT_CPU_PCLMUL },
+  { "sse41", FCRYPT_CPU_SSE41 },
+  { "sha", FCRYPT_CPU_SHA },
+  { "avx2", FCRYPT_CPU_AVX2 },
+  { "avx512f", FCRYPT_CPU_AVX512F },
+  { "sse2", FCRYPT_CPU_SSE2 },
+  { "bmi2", FCRYPT_CPU_BMI2 },
+  { "sse42", FCRYPT_CPU_SSE42 },
+  { "arm_aes", FCRYPT_CPU_ARM_AES },
+  { "arm_pmull", FCRYPT_CPU_ARM_PMULL },
+  { "arm_sha2", FCRYPT_CPU_ARM_SHA2 },
+  { "arm_neon", FCRYPT_CPU_ARM_NEON },
+  { "arm_sha512", FCRYPT_CPU_ARM_SHA512 },
+  { "arm_crc32", FCRYPT_CPU_ARM_CRC32 },
+  { "arm_sha1", FCRYPT_CPU_ARM_SHA1 },
+  { "arm_sha3", FCRYPT_CPU_ARM_SHA3 },
+};
+
+/*
+ * Applies the list of names in the FCRYPT_CPU environment variable to the
+ * detected features. Unknown names are ignored.
+ */
+static uint32_t
+fcrypt_cpu_override (uint32_t features, const char *list)
+{
+  const char *word;
+  size_t i, len;
+  int disable;
+
+  while (*list != '\0')
+    {
+      if (*list == ',' || *list == ' ')
+        {
+          ++list;
+          continue;
+        }
+      disable = *list == '-';
+      if (*list == '-' || *list == '+')
+        ++list;
+      word = list;
+      len = strcspn (word, ", ");
+      list += len;
+      for (i = 0; i < sizeof (fcrypt_cpu_names) / sizeof (fcrypt_cpu_names[0]);
+           ++i)
+        {
+          if (strlen (fcrypt_cpu_names[i].name) != len
+              || memcmp (fcrypt_cpu_names[i].name, word, len) != 0)
+            continue;
+          if (disable)
+            features &= ~fcrypt_cpu_names[i].bits;
+          else
+            features |= fcrypt_cpu_names[i].bits;
+          break;
+        }
+    }
+  return features;
+}
+
+uint32_t
+fcrypt_cpu_features (void)
+{
+  static int initialized = 0;
+  static uint32_t features = 0;
+  const char *list;
+
+  if (initialized == 0)
+    {
+      features = fcrypt_cpu_detect ();
+      list = getenv ("FCRYPT_CPU");
+      if (list != NULL)
+        features = fcrypt_cpu_override (features, list);
+      initialized = 1;
+    }
+  return features;
+}
@@ -0,0 +1,74 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef FCRYPT_CPU_H
+#define FCRYPT_CPU_H
+
+#include <stdint.h>
+
+/*
+ * Instruction set extensions that the accelerated backends depend on. The
+ * bits are only ever set for the architecture that the library was built
+ * for, so callers don't need to check the architecture themselves.
+ *
+ * The FCRYPT_CPU environment variable adjusts the detected set, for testing
+ * and benchmarking each backend. It holds a list of feature names, which are
+ * the macros below without the FCRYPT_CPU_ prefix in lower case, such as
+ * "avx2" or "arm_aes", separated by commas or spaces. A name prefixed by '-'
+ * is disabled and one prefixed by '+' or nothing is enabled even if the CPU
+ * lacks it, which will crash on the first instruction the CPU does not
+ * have. The name "all" stands for every feature, so "-all" selects the
+ * portable C code and "-all,+ssse3,+sse41" the SSE4.1 code.
+ */
+
+/* x86 and x86-64 */
+#define FCRYPT_CPU_SSSE3 (UINT32_C (1) << 0)
+#define FCRYPT_CPU_AESNI (UINT32_C (1) << 1)
+#define FCRYPT_CPU_PCLMUL (UINT32_C (1) << 2)
+#define FCRYPT_CPU_SSE41 (UINT32_C (1) << 3)
+#define FCRYPT_CPU_SHA (UINT32_C (1) << 4)
+#define FCRYPT_CPU_AVX2 (UINT32_C (1) << 5)
+#define FCRYPT_CPU_AVX512F (UINT32_C (1) << 6)
+#define FCRYPT_CPU_SSE2 (UINT32_C (1) << 7)
+#define FCRYPT_CPU_BMI2 (UINT32_C (1) << 8)
+#define FCRYPT_CPU_SSE42 (UINT32_C (1) << 9)
+
+/* AArch64 */
+#define FCRYPT_CPU_ARM_AES (UINT32_C (1) << 16)
+#define FCRYPT_CPU_ARM_PMULL (UINT32_C (1) << 17)
+#define FCRYPT_CPU_ARM_SHA2 (UINT32_C (1) << 18)
+#define FCRYPT_CPU_ARM_NEON (UINT32_C (1) << 19)
+#define FCRYPT_CPU_ARM_SHA512 (UINT32_C (1) << 20)
+#define FCRYPT_CPU_ARM_CRC32 (UINT32_C (1) << 21)
+#define FCRYPT_CPU_ARM_SHA1 (UINT32_C (1) << 22)
+#define FCRYPT_CPU_ARM_SHA3 (UINT32_C (1) << 23)
+
+/*
+ * Returns the set of FCRYPT_CPU_* bits supported by the running CPU, after
+ * applying FCRYPT_CPU. The detection is only done on the first call.
+ */
+uint32_t fcrypt_cpu_features (void);
+
+#endif /* FCRYPT_CPU_H */
@@ -0,0 +1,322 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#include "fcrypt_align.h"
+#include "fcrypt_ctx_pool.h"
+#include "fcrypt_memzero.h"
+
+/* Bytes of contexts in a slab, unless a single context is larger. */
+#define FCRYPT_CTX_POOL_SLAB_SIZE (64 * 1024)
+
+/*
+ * Free contexts a thread keeps for itself. When its cache is empty or full,
+ * a thread moves half of this many contexts at once under the lock.
+ */
+#define FCRYPT_CTX_POOL_CACHE_SIZE 32
+
+/* The head of a slab, followed by the contexts on the next aligned byte. */
+struct fcrypt_ctx_pool_slab
+{
+  struct fcrypt_ctx_pool_slab *next;
+  size_t bytes; /* Allocated, with this head */
+};
+
+#if defined(HAVE_PTHREAD)
+struct fcrypt_ctx_pool_cache
+{
+  struct fcrypt_ctx_pool *pool;
+  struct fcrypt_ctx_pool_cache *all;   /* Next cache of the pool */
+  struct fcrypt_ctx_pool_cache *spare; /* Next cache of an exited thread */
+  size_t count;
+  void *slots[FCRYPT_CTX_POOL_CACHE_SIZE];
+};
+#endif
+
+struct fcrypt_ctx_pool
+{
+  size_t size;     /* Bytes of a context */
+  size_t align;    /* Alignment of the contexts, at least a cache line */
+  size_t stride;   /* Bytes from one context to the next */
+  size_t per_slab; /* Contexts in a slab */
+  void *free;      /* Free contexts, linked through their first word */
+  struct fcrypt_ctx_pool_slab *slabs;
+#if defined(HAVE_PTHREAD)
+  pthread_mutex_t lock; /* Protects everything above and the caches lists */
+  pthread_key_t key;    /* The cache of the calling thread */
+  int have_key;
+  struct fcrypt_ctx_pool_cache *caches;
+  struct fcrypt_ctx_pool_cache *spare;
+#endif
+};
+
+static void
+fcrypt_ctx_pool_push (struct fcrypt_ctx_pool *pool, void *ctx)
+{
+  memcpy (ctx, &pool->free, sizeof (void *));
+  pool->free = ctx;
+}
+
+/* Carves a new slab into free contexts, in address order. */
+static int
+fcrypt_ctx_pool_grow (struct fcrypt_ctx_pool *pool)
+{
+  struct fcrypt_ctx_pool_slab *slab;
+  uint8_t *ctx;
+  size_t bytes, i;
+
+  bytes = sizeof (*slab) + pool->align - 1 + pool->per_slab * pool->stride;
+  slab = calloc (1, bytes);
+  if (slab == NULL)
+    {
+      errno = ENOMEM;
+      return -1;
+    }
+  slab->bytes = bytes;
+  slab->next = pool->slabs;
+  pool->slabs = slab;
+
+  ctx = (uint8_t *)(slab + 1);
+  ctx += (pool->align - (uintptr_t)ctx % pool->align) % pool->align;
+  for (i = pool->per_slab; i-- > 0;)
+    fcrypt_ctx_pool_push (pool, ctx + i * pool->stride);
+  return 0;
+}
+
+static void *
+fcrypt_ctx_pool_pop (struct fcrypt_ctx_pool *pool)
+{
+  void *ctx;
+
+  if (pool->free == NULL && fcrypt_ctx_pool_grow (pool) != 0)
+    return NULL;
+  ctx = pool->free;
+  memcpy (&pool->free, ctx, sizeof (void *));
+  return ctx;
+}
+
+#if defined(HAVE_PTHREAD)
+/* Gives the cache of an exiting thread back to its pool. */
+static void
+fcrypt_ctx_pool_release (void *arg)
+{
+  struct fcrypt_ctx_pool_cache *cache = arg;
+  struct fcrypt_ctx_pool *pool = cache->pool;
+
+  pthread_mutex_lock (&pool->lock);
+  while (cache->count > 0)
+    fcrypt_ctx_pool_push (pool, cache->slots[--cache->count]);
+  cache->spare = pool->spare;
+  pool->spare = cache;
+  pthread_mutex_unlock (&pool->lock);
+}
+
+/*
+ * Returns the cache of the calling thread, reusing one left by an exited
+ * thread before allocating another. Returns NULL if the thread can't have
+ * one, in which case every call takes the lock.
+ */
+static struct fcrypt_ctx_pool_cache *
+fcrypt_ctx_pool_cache (struct fcrypt_ctx_pool *pool)
+{
+  struct fcrypt_ctx_pool_cache *cache;
+
+  if (!pool->have_key)
+    return NULL;
+  cache = pthread_getspecific (pool->key);
+  if (cache != NULL)
+    return cache;
+
+  pthread_mutex_lock (&pool->lock);
+  cache = pool->spare;
+  if (cache != NULL)
+    pool->spare = cache->spare;
+  else if ((cache = malloc (sizeof (*cache))) != NULL)
+    {
+      cache->pool = pool;
+      cache->count = 0;
+      cache->all = pool->caches;
+      pool->caches = cache;
+    }
+  if (cache != NULL && pthread_setspecific (pool->key, cache) != 0)
+    {
+      cache->spare = pool->spare;
+      pool->spare = cache;
+      cache = NULL;
+    }
+  pthread_mutex_unlock (&pool->lock);
+  return cache;
+}
+#endif /* HAVE_PTHREAD */
+
+struct fcrypt_ctx_pool *
+fcrypt_ctx_pool_new (size_t size, size_t align)
+{
+  struct fcrypt_ctx_pool *pool;
+
+  if (size == 0 || size > SIZE_MAX / 4 || align == 0
+      || (align & (align - 1)) != 0 || align > SIZE_MAX / 4)
+    {
+      errno = EINVAL;
+      return NULL;
+    }
+  pool = malloc (sizeof (*pool));
+  if (pool == NULL)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+
+  if (align < FCRYPT_CACHE_LINE_SIZE)
+    align = FCRYPT_CACHE_LINE_SIZE;
+  pool->size = size;
+  pool->align = align;
+  pool->stride = (size + align - 1) & ~(align - 1);
+  pool->per_slab = FCRYPT_CTX_POOL_SLAB_SIZE / pool->stride;
+  if (pool->per_slab == 0)
+    pool->per_slab = 1;
+  pool->free = NULL;
+  pool->slabs = NULL;
+#if defined(HAVE_PTHREAD)
+  pthread_mutex_init (&pool->lock, NULL);
+  pool->have_key
+      = pthread_key_create (&pool->key, fcrypt_ctx_pool_release) == 0;
+  pool->caches = NULL;
+  pool->spare = NULL;
+#endif
+  return pool;
+}
+
+void
+fcrypt_ctx_pool_free (struct fcrypt_ctx_pool *pool)
+{
+  struct fcrypt_ctx_pool_slab *slab;
+#if defined(HAVE_PTHREAD)
+  struct fcrypt_ctx_pool_cache *cache;
+#endif
+
+  if (pool == NULL)
+    return;
+#if defined(HAVE_PTHREAD)
+  /* Deleting the key first keeps exiting threads away from the caches. */
+  if (pool->have_key)
+    pthread_key_delete (pool->key);
+  while ((cache = pool->caches) != NULL)
+    {
+      pool->caches = cache->all;
+      free (cache);
+    }
+  pthread_mutex_destroy (&pool->lock);
+#endif
+  while ((slab = pool->slabs) != NULL)
+    {
+      pool->slabs = slab->next;
+      fcrypt_memzero (slab, slab->bytes);
+      free (slab);
+    }
+  free (pool);
+}
+
+void *
+fcrypt_ctx_pool_get (struct fcrypt_ctx_pool *pool)
+{
+  void *ctx;
+#if defined(HAVE_PTHREAD)
+  struct fcrypt_ctx_pool_cache *cache;
+
+  cache = fcrypt_ctx_pool_cache (pool);
+  if (cache == NULL)
+    {
+      pthread_mutex_lock (&pool->lock);
+      ctx = fcrypt_ctx_pool_pop (pool);
+      pthread_mutex_unlock (&pool->lock);
+    }
+  else
+    {
+      if (cache->count == 0)
+        {
+          pthread_mutex_lock (&pool->lock);
+          while (cache->count < FCRYPT_CTX_POOL_CACHE_SIZE / 2
+                 && (ctx = fcrypt_ctx_pool_pop (pool)) != NULL)
+            cache->slots[cache->count++] = ctx;
+          pthread_mutex_unlock (&pool->lock);
+          if (cache->count == 0)
+            return NULL;
+        }
+      ctx = cache->slots[--cache->count];
+    }
+#else
+  ctx = fcrypt_ctx_pool_pop (pool);
+#endif
+
+  /* The rest of a free context is already zero. */
+  if (ctx != NULL)
+    memset (ctx, 0, sizeof (void *));
+  return ctx;
+}
+
+void
+fcrypt_ctx_pool_put (struct fcrypt_ctx_pool *pool, void *ctx)
+{
+#if defined(HAVE_PTHREAD)
+  struct fcrypt_ctx_pool_cache *cache;
+#endif
+
+  if (ctx == NULL)
+    return;
+  fcrypt_memzero (ctx, pool->size);
+
+#if defined(HAVE_PTHREAD)
+  cache = fcrypt_ctx_pool_cache (pool);
+  if (cache == NULL)
+    {
+      pthread_mutex_lock (&pool->lock);
+      fcrypt_ctx_pool_push (pool, ctx);
+      pthread_mutex_unlock (&pool->lock);
+      return;
+    }
+  if (cache->count == FCRYPT_CTX_POOL_CACHE_SIZE)
+    {
+      pthread_mutex_lock (&pool->lock);
+      while (cache->count > FCRYPT_CTX_POOL_CACHE_SIZE / 2)
+        fcrypt_ctx_pool_push (pool, cache->slots[--cache->count]);
+      pthread_mutex_unlock (&pool->lock);
+    }
+  cache->slots[cache->count++] = ctx;
+#else
+  fcrypt_ctx_pool_push (pool, ctx);
+#endif
+}
@@ -0,0 +1,71 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Pools of equally sized contexts, for programs that keep many contexts of
+ * one algorithm alive and create and destroy them often, such as a server
+ * with a cipher context per connection. Contexts are carved out of slabs of
+ * 64 KiB, each on cache lines of its own, so that neighbouring contexts used
+ * by different threads never share a line. Each thread keeps a small cache
+ * of free contexts, so most calls take no lock. A context is cleared with
+ * fcrypt_memzero when it is given back, and so is every slab when the pool
+ * is freed.
+ */
+
+#ifndef FCRYPT_CTX_POOL_H
+#define FCRYPT_CTX_POOL_H
+
+#include <stddef.h>
+
+struct fcrypt_ctx_pool;
+
+/*
+ * Creates a pool of contexts of the given size and alignment, which must be
+ * a power of two, such as the ctx_size and ctx_align members of a
+ * fcrypt_hash or fcrypt_cipher. Returns NULL with errno set to EINVAL if the
+ * arguments are invalid, or ENOMEM if there is not enough memory.
+ */
+struct fcrypt_ctx_pool *fcrypt_ctx_pool_new (size_t, size_t);
+
+/*
+ * Frees a pool and every context taken from it, whether or not they were
+ * given back. No other thread may use the pool at the same time.
+ */
+void fcrypt_ctx_pool_free (struct fcrypt_ctx_pool *);
+
+/*
+ * Takes a zeroed context from the pool. Returns NULL with errno set to
+ * ENOMEM if the pool has no free context and a new slab can not be
+ * allocated.
+ */
+void *fcrypt_ctx_pool_get (struct fcrypt_ctx_pool *);
+
+/*
+ * Clears a context and gives it back to the pool it was taken from. Any
+ * thread may give back a context, not only the one that took it.
+ */
+void fcrypt_ctx_pool_put (struct fcrypt_ctx_pool *, void *);
+
+#endif /* FCRYPT_CTX_POOL_H */
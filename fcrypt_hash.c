@@ -0,0 +1,403 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include "blake2b-internal.h"
+#include "blake2b.h"
+#include "blake2bp.h"
+#include "blake2s.h"
+#include "blake2sp.h"
+#include "blake3-internal.h"
+#include "blake3.h"
+#include "fcrypt_align.h"
+#include "fcrypt_hash.h"
+#include "fcrypt_instrument.h"
+#include "fcrypt_probe.h"
+#include "has160.h"
+#include "md2.h"
+#include "md4.h"
+#include "md5.h"
+#include "rmd128.h"
+#include "rmd160.h"
+#include "sha1-internal.h"
+#include "sha1.h"
+#include "sha1dc.h"
+#include "sha256-internal.h"
+#include "sha256.h"
+#include "sha3.h"
+#include "sha512-internal.h"
+#include "sha512.h"
+#include "tiger.h"
+
+/*
+ * Defines the adapters from the void pointers of struct fcrypt_hash to the
+ * functions of a hash. INIT and FINAL are statements using ctx and digest,
+ * for the hashes that take extra arguments. The init and update adapters
+ * fire the probes of fcrypt_probe.h around the raw ones, which the one-shot
+ * functions below call so that a digest counts once.
+ */
+#define FCRYPT_HASH_FUNCS(id, type, INIT, UPDATE, FINAL)                      \
+  FCRYPT_PROBE_COUNTERS (id##_hash_counters)                                  \
+                                                                              \
+  static void id##_hash_init_raw (void *ctxptr)                               \
+  {                                                                           \
+    type *ctx = ctxptr;                                                       \
+    INIT;                                                                     \
+  }                                                                           \
+                                                                              \
+  static void id##_hash_update_raw (void *ctxptr, const void *input,          \
+                                    size_t inputlen)                          \
+  {                                                                           \
+    UPDATE ((type *)ctxptr, input, inputlen);                                 \
+  }                                                                           \
+                                                                              \
+  static void id##_hash_init (void *ctxptr)                                   \
+  {                                                                           \
+    FCRYPT_PROBE_SETUP_BEGIN (id##_hash_counters, fcrypt_hash_##id.name);     \
+    id##_hash_init_raw (ctxptr);                                              \
+    FCRYPT_PROBE_SETUP_END (id##_hash_counters, fcrypt_hash_##id.name);       \
+  }                                                                           \
+                                                                              \
+  static void id##_hash_update (void *ctxptr, const void *input,              \
+                                size_t inputlen)                              \
+  {                                                                           \
+    FCRYPT_PROBE_BULK_BEGIN (id##_hash_counters, fcrypt_hash_##id.name,       \
+                             inputlen);                                       \
+    id##_hash_update_raw (ctxptr, input, inputlen);                           \
+    FCRYPT_PROBE_BULK_END (id##_hash_counters, fcrypt_hash_##id.name,         \
+                           inputlen);                                         \
+  }                                                                           \
+                                                                              \
+  static void id##_hash_final (uint8_t *digest, void *ctxptr)                 \
+  {                                                                           \
+    type *ctx = ctxptr;                                                       \
+    FINAL;                                                                    \
+  }
+
+/* One-shot function for hashes that don't have their own. */
+#define FCRYPT_HASH_DIGEST(id, type)                                          \
+  static void id##_hash_digest (uint8_t *digest, const void *input,           \
+                                size_t inputlen)                              \
+  {                                                                           \
+    type ctx;                                                                 \
+                                                                              \
+    id##_hash_init_raw (&ctx);                                                \
+    id##_hash_update_raw (&ctx, input, inputlen);                             \
+    id##_hash_final (digest, &ctx);                                           \
+  }
+
+/* Wraps the one-shot function in the probes when they are compiled in. */
+#if defined(FCRYPT_INSTRUMENT)
+#define FCRYPT_HASH_PROBE_DIGEST(id, digestfn)                                \
+  static void id##_hash_digest_probe (uint8_t *digest, const void *input,     \
+                                      size_t inputlen)                        \
+  {                                                                           \
+    FCRYPT_PROBE_BULK_BEGIN (id##_hash_counters, fcrypt_hash_##id.name,       \
+                             inputlen);                                       \
+    digestfn (digest, input, inputlen);                                       \
+    FCRYPT_PROBE_BULK_END (id##_hash_counters, fcrypt_hash_##id.name,         \
+                           inputlen);                                         \
+  }
+#define FCRYPT_HASH_DIGEST_FN(id, digestfn) id##_hash_digest_probe
+#else
+#define FCRYPT_HASH_PROBE_DIGEST(id, digestfn)
+#define FCRYPT_HASH_DIGEST_FN(id, digestfn) digestfn
+#endif
+
+#define FCRYPT_HASH(id, str, type, digestsize, blocksize, digestfn)           \
+  FCRYPT_HASH_PROBE_DIGEST (id, digestfn)                                     \
+  const struct fcrypt_hash fcrypt_hash_##id                                   \
+      = { str,                                                                \
+          digestsize,                                                         \
+          blocksize,                                                          \
+          sizeof (type),                                                      \
+          FCRYPT_ALIGNOF (type),                                              \
+          id##_hash_init,                                                     \
+          id##_hash_update,                                                   \
+          id##_hash_final,                                                    \
+          FCRYPT_HASH_DIGEST_FN (id, digestfn) };
+
+FCRYPT_HASH_FUNCS (md2, struct md2_ctx, md2_init (ctx), md2_update,
+                   md2_final (digest, ctx))
+FCRYPT_HASH_DIGEST (md2, struct md2_ctx)
+FCRYPT_HASH (md2, "md2", struct md2_ctx, MD2_DIGEST_SIZE, MD2_BLOCK_SIZE,
+             md2_hash_digest)
+
+FCRYPT_HASH_FUNCS (md4, struct md4_ctx, md4_init (ctx), md4_update,
+                   md4_final (digest, ctx))
+FCRYPT_HASH (md4, "md4", struct md4_ctx, MD4_DIGEST_SIZE, MD4_BLOCK_SIZE, md4)
+
+FCRYPT_HASH_FUNCS (md5, struct md5_ctx, md5_init (ctx), md5_update,
+                   md5_final (digest, ctx))
+FCRYPT_HASH (md5, "md5", struct md5_ctx, MD5_DIGEST_SIZE, MD5_BLOCK_SIZE, md5)
+
+FCRYPT_HASH_FUNCS (sha1, struct sha1_ctx, sha1_init (ctx), sha1_update,
+                   sha1_final (digest, ctx))
+FCRYPT_HASH (sha1, "sha1", struct sha1_ctx, SHA1_DIGEST_SIZE, SHA1_BLOCK_SIZE,
+             sha1)
+
+/* The collision flag is dropped; use sha1dc_final to see it. */
+FCRYPT_HASH_FUNCS (sha1dc, struct sha1dc_ctx, sha1dc_init (ctx),
+                   sha1dc_update, (void)sha1dc_final (digest, ctx))
+FCRYPT_HASH_DIGEST (sha1dc, struct sha1dc_ctx)
+FCRYPT_HASH (sha1dc, "sha1dc", struct sha1dc_ctx, SHA1_DIGEST_SIZE,
+             SHA1_BLOCK_SIZE, sha1dc_hash_digest)
+
+FCRYPT_HASH_FUNCS (sha224, struct sha256_ctx, sha224_init (ctx),
+                   sha224_update, sha224_final (digest, ctx))
+FCRYPT_HASH (sha224, "sha224", struct sha256_ctx, SHA224_DIGEST_SIZE,
+             SHA224_BLOCK_SIZE, sha224)
+
+FCRYPT_HASH_FUNCS (sha256, struct sha256_ctx, sha256_init (ctx),
+                   sha256_update, sha256_final (digest, ctx))
+FCRYPT_HASH (sha256, "sha256", struct sha256_ctx, SHA256_DIGEST_SIZE,
+             SHA256_BLOCK_SIZE, sha256)
+
+FCRYPT_HASH_FUNCS (sha384, struct sha512_ctx, sha384_init (ctx),
+                   sha384_update, sha384_final (digest, ctx))
+FCRYPT_HASH_DIGEST (sha384, struct sha512_ctx)
+FCRYPT_HASH (sha384, "sha384", struct sha512_ctx, SHA384_DIGEST_SIZE,
+             SHA384_BLOCK_SIZE, sha384_hash_digest)
+
+FCRYPT_HASH_FUNCS (sha512, struct sha512_ctx, sha512_init (ctx),
+                   sha512_update, sha512_final (digest, ctx))
+FCRYPT_HASH_DIGEST (sha512, struct sha512_ctx)
+FCRYPT_HASH (sha512, "sha512", struct sha512_ctx, SHA512_DIGEST_SIZE,
+             SHA512_BLOCK_SIZE, sha512_hash_digest)
+
+FCRYPT_HASH_FUNCS (sha3_224, struct sha3_ctx, sha3_224_init (ctx),
+                   sha3_update, sha3_final (digest, ctx))
+FCRYPT_HASH (sha3_224, "sha3-224", struct sha3_ctx, SHA3_224_DIGEST_SIZE,
+             SHA3_224_BLOCK_SIZE, sha3_224)
+
+FCRYPT_HASH_FUNCS (sha3_256, struct sha3_ctx, sha3_256_init (ctx),
+                   sha3_update, sha3_final (digest, ctx))
+FCRYPT_HASH (sha3_256, "sha3-256", struct sha3_ctx, SHA3_256_DIGEST_SIZE,
+             SHA3_256_BLOCK_SIZE, sha3_256)
+
+FCRYPT_HASH_FUNCS (sha3_384, struct sha3_ctx, sha3_384_init (ctx),
+                   sha3_update, sha3_final (digest, ctx))
+FCRYPT_HASH (sha3_384, "sha3-384", struct sha3_ctx, SHA3_384_DIGEST_SIZE,
+             SHA3_384_BLOCK_SIZE, sha3_384)
+
+FCRYPT_HASH_FUNCS (sha3_512, struct sha3_ctx, sha3_512_init (ctx),
+                   sha3_update, sha3_final (digest, ctx))
+FCRYPT_HASH (sha3_512, "sha3-512", struct sha3_ctx, SHA3_512_DIGEST_SIZE,
+             SHA3_512_BLOCK_SIZE, sha3_512)
+
+/* The BLAKE2 hashes are unkeyed, with their largest digest. */
+FCRYPT_HASH_FUNCS (blake2b, struct blake2b_ctx,
+                   blake2b_init (ctx, BLAKE2B_DIGEST_SIZE), blake2b_update,
+                   blake2b_final (digest, ctx))
+FCRYPT_HASH_DIGEST (blake2b, struct blake2b_ctx)
+FCRYPT_HASH (blake2b, "blake2b", struct blake2b_ctx, BLAKE2B_DIGEST_SIZE,
+             BLAKE2B_BLOCK_SIZE, blake2b_hash_digest)
+
+FCRYPT_HASH_FUNCS (blake2bp, struct blake2bp_ctx,
+                   blake2bp_init (ctx, BLAKE2BP_DIGEST_SIZE), blake2bp_update,
+                   blake2bp_final (digest, ctx))
+FCRYPT_HASH_DIGEST (blake2bp, struct blake2bp_ctx)
+FCRYPT_HASH (blake2bp, "blake2bp", struct blake2bp_ctx, BLAKE2BP_DIGEST_SIZE,
+             BLAKE2BP_BLOCK_SIZE, blake2bp_hash_digest)
+
+FCRYPT_HASH_FUNCS (blake2s, struct blake2s_ctx,
+                   blake2s_init (ctx, BLAKE2S_DIGEST_SIZE), blake2s_update,
+                   blake2s_final (digest, ctx))
+FCRYPT_HASH_DIGEST (blake2s, struct blake2s_ctx)
+FCRYPT_HASH (blake2s, "blake2s", struct blake2s_ctx, BLAKE2S_DIGEST_SIZE,
+             BLAKE2S_BLOCK_SIZE, blake2s_hash_digest)
+
+FCRYPT_HASH_FUNCS (blake2sp, struct blake2sp_ctx,
+                   blake2sp_init (ctx, BLAKE2SP_DIGEST_SIZE), blake2sp_update,
+                   blake2sp_final (digest, ctx))
+FCRYPT_HASH_DIGEST (blake2sp, struct blake2sp_ctx)
+FCRYPT_HASH (blake2sp, "blake2sp", struct blake2sp_ctx, BLAKE2SP_DIGEST_SIZE,
+             BLAKE2SP_BLOCK_SIZE, blake2sp_hash_digest)
+
+FCRYPT_HASH_FUNCS (blake3, struct blake3_ctx, blake3_init (ctx),
+                   blake3_update,
+                   blake3_final (digest, BLAKE3_DIGEST_SIZE, ctx))
+FCRYPT_HASH_DIGEST (blake3, struct blake3_ctx)
+FCRYPT_HASH (blake3, "blake3", struct blake3_ctx, BLAKE3_DIGEST_SIZE,
+             BLAKE3_BLOCK_SIZE, blake3_hash_digest)
+
+FCRYPT_HASH_FUNCS (rmd128, struct rmd128_ctx, rmd128_init (ctx),
+                   rmd128_update, rmd128_final (digest, ctx))
+FCRYPT_HASH (rmd128, "rmd128", struct rmd128_ctx, RMD128_DIGEST_SIZE,
+             RMD128_BLOCK_SIZE, rmd128)
+
+FCRYPT_HASH_FUNCS (rmd160, struct rmd160_ctx, rmd160_init (ctx),
+                   rmd160_update, rmd160_final (digest, ctx))
+FCRYPT_HASH (rmd160, "rmd160", struct rmd160_ctx, RMD160_DIGEST_SIZE,
+             RMD160_BLOCK_SIZE, rmd160)
+
+FCRYPT_HASH_FUNCS (has160, struct has160_ctx, has160_init (ctx),
+                   has160_update, has160_final (digest, ctx))
+FCRYPT_HASH (has160, "has160", struct has160_ctx, HAS160_DIGEST_SIZE,
+             HAS160_BLOCK_SIZE, has160)
+
+FCRYPT_HASH_FUNCS (tiger, struct tiger_ctx, tiger1_init (ctx), tiger_update,
+                   tiger192_final (digest, ctx))
+FCRYPT_HASH (tiger, "tiger", struct tiger_ctx, TIGER192_DIGEST_SIZE,
+             TIGER_BLOCK_SIZE, tiger1)
+
+FCRYPT_HASH_FUNCS (tiger2, struct tiger_ctx, tiger2_init (ctx), tiger_update,
+                   tiger192_final (digest, ctx))
+FCRYPT_HASH (tiger2, "tiger2", struct tiger_ctx, TIGER192_DIGEST_SIZE,
+             TIGER_BLOCK_SIZE, tiger2)
+
+static const struct fcrypt_hash *const fcrypt_hashes[] = {
+  &fcrypt_hash_md2,      &fcrypt_hash_md4,      &fcrypt_hash_md5,
+  &fcrypt_hash_sha1,     &fcrypt_hash_sha1dc,   &fcrypt_hash_sha224,
+  &fcrypt_hash_sha256,   &fcrypt_hash_sha384,   &fcrypt_hash_sha512,
+  &fcrypt_hash_sha3_224, &fcrypt_hash_sha3_256, &fcrypt_hash_sha3_384,
+  &fcrypt_hash_sha3_512, &fcrypt_hash_blake2b,  &fcrypt_hash_blake2bp,
+  &fcrypt_hash_blake2s,  &fcrypt_hash_blake2sp, &fcrypt_hash_blake3,
+  &fcrypt_hash_rmd128,   &fcrypt_hash_rmd160,   &fcrypt_hash_has160,
+  &fcrypt_hash_tiger,    &fcrypt_hash_tiger2,
+};
+
+const struct fcrypt_hash *
+fcrypt_hash_lookup (const char *name)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (fcrypt_hashes) / sizeof (fcrypt_hashes[0]); ++i)
+    if (strcmp (fcrypt_hashes[i]->name, name) == 0)
+      return fcrypt_hashes[i];
+  return NULL;
+}
+
+const struct fcrypt_hash *
+fcrypt_hash_get (size_t index)
+{
+  if (index >= sizeof (fcrypt_hashes) / sizeof (fcrypt_hashes[0]))
+    return NULL;
+  return fcrypt_hashes[index];
+}
+
+#if defined(FCRYPT_INSTRUMENT)
+/* The counters of each table, in the order of fcrypt_hashes. */
+static struct fcrypt_counters *const fcrypt_hash_counter_list[] = {
+  &md2_hash_counters,      &md4_hash_counters,      &md5_hash_counters,
+  &sha1_hash_counters,     &sha1dc_hash_counters,   &sha224_hash_counters,
+  &sha256_hash_counters,   &sha384_hash_counters,   &sha512_hash_counters,
+  &sha3_224_hash_counters, &sha3_256_hash_counters, &sha3_384_hash_counters,
+  &sha3_512_hash_counters, &blake2b_hash_counters,  &blake2bp_hash_counters,
+  &blake2s_hash_counters,  &blake2sp_hash_counters, &blake3_hash_counters,
+  &rmd128_hash_counters,   &rmd160_hash_counters,   &has160_hash_counters,
+  &tiger_hash_counters,    &tiger2_hash_counters,
+};
+
+void
+fcrypt_hash_clear_counters (void)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (fcrypt_hashes) / sizeof (fcrypt_hashes[0]); ++i)
+    fcrypt_probe_clear (fcrypt_hash_counter_list[i]);
+}
+#endif /* FCRYPT_INSTRUMENT */
+
+/* Names the backend of the compression function that a hash uses. */
+static const char *
+fcrypt_hash_backend (const struct fcrypt_hash *hash)
+{
+  if (hash == &fcrypt_hash_sha1)
+    return sha1_backend_name ();
+  if (hash == &fcrypt_hash_sha224 || hash == &fcrypt_hash_sha256)
+    return sha256_backend_name ();
+  if (hash == &fcrypt_hash_sha384 || hash == &fcrypt_hash_sha512)
+    return sha512_backend_name ();
+  if (hash == &fcrypt_hash_blake2b || hash == &fcrypt_hash_blake2bp)
+    return blake2b_backend_name ();
+  if (hash == &fcrypt_hash_blake3)
+    return blake3_backend_name ();
+  return "generic";
+}
+
+int
+fcrypt_hash_counters (const struct fcrypt_hash *hash,
+                      struct fcrypt_counters *counters)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (fcrypt_hashes) / sizeof (fcrypt_hashes[0]); ++i)
+    if (fcrypt_hashes[i] == hash)
+      {
+#if defined(FCRYPT_INSTRUMENT)
+        fcrypt_probe_read (fcrypt_hash_counter_list[i], counters);
+#else
+        memset (counters, 0, sizeof (*counters));
+#endif
+        counters->backend = fcrypt_hash_backend (hash);
+        return 0;
+      }
+  errno = EINVAL;
+  return -1;
+}
+
+void
+fcrypt_hash_updatev (const struct fcrypt_hash *hash, void *ctx,
+                     const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    hash->update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
+void
+fcrypt_hash_multi (const struct fcrypt_hash *hash, uint8_t *digests,
+                   const uint8_t *const *inputs, const size_t *lens,
+                   size_t count)
+{
+  size_t i;
+
+  if (hash == &fcrypt_hash_md5)
+    md5_multi (digests, inputs, lens, count);
+  else if (hash == &fcrypt_hash_sha1)
+    sha1_multi (digests, inputs, lens, count);
+  else if (hash == &fcrypt_hash_sha256)
+    sha256_multi (digests, inputs, lens, count);
+  else
+    for (i = 0; i < count; ++i)
+      hash->digest (digests + i * hash->digest_size, inputs[i], lens[i]);
+}
+
+void
+fcrypt_hash_final_reset (const struct fcrypt_hash *hash, uint8_t *digest,
+                         void *ctx)
+{
+  hash->final (digest, ctx);
+  hash->init (ctx);
+}
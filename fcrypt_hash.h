@@ -0,0 +1,158 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Algorithm agnostic interface to the hash functions. Each hash is described
+ * by a constant table of its sizes and functions, so that a caller can pick
+ * a hash once, by name or by table, and then hash without switching on the
+ * algorithm. The functions are the public ones of each hash, which already
+ * call the best backend for the processor, chosen once when the library is
+ * loaded.
+ */
+
+#ifndef FCRYPT_HASH_H
+#define FCRYPT_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct iovec;
+
+/* Largest digest_size and block_size of the hashes below. */
+#define FCRYPT_HASH_MAX_DIGEST_SIZE 64
+#define FCRYPT_HASH_MAX_BLOCK_SIZE 168
+
+/* Largest output of fcrypt_hash_export. */
+#define FCRYPT_HASH_MAX_STATE_SIZE 2048
+
+struct fcrypt_hash
+{
+  const char *name;  /* Lower case, e.g. "sha256" or "sha3-256" */
+  size_t digest_size;
+  size_t block_size; /* Bytes consumed per call of the compression */
+  size_t ctx_size;   /* Bytes needed for the context */
+  size_t ctx_align;  /* Required alignment of the context */
+  void (*init) (void *);
+  void (*update) (void *, const void *, size_t);
+  void (*final) (uint8_t *, void *);
+  void (*digest) (uint8_t *, const void *, size_t);
+};
+
+extern const struct fcrypt_hash fcrypt_hash_md2;
+extern const struct fcrypt_hash fcrypt_hash_md4;
+extern const struct fcrypt_hash fcrypt_hash_md5;
+extern const struct fcrypt_hash fcrypt_hash_sha1;
+extern const struct fcrypt_hash fcrypt_hash_sha1dc;
+extern const struct fcrypt_hash fcrypt_hash_sha224;
+extern const struct fcrypt_hash fcrypt_hash_sha256;
+extern const struct fcrypt_hash fcrypt_hash_sha384;
+extern const struct fcrypt_hash fcrypt_hash_sha512;
+extern const struct fcrypt_hash fcrypt_hash_sha3_224;
+extern const struct fcrypt_hash fcrypt_hash_sha3_256;
+extern const struct fcrypt_hash fcrypt_hash_sha3_384;
+extern const struct fcrypt_hash fcrypt_hash_sha3_512;
+extern const struct fcrypt_hash fcrypt_hash_blake2b;
+extern const struct fcrypt_hash fcrypt_hash_blake2bp;
+extern const struct fcrypt_hash fcrypt_hash_blake2s;
+extern const struct fcrypt_hash fcrypt_hash_blake2sp;
+extern const struct fcrypt_hash fcrypt_hash_blake3;
+extern const struct fcrypt_hash fcrypt_hash_rmd128;
+extern const struct fcrypt_hash fcrypt_hash_rmd160;
+extern const struct fcrypt_hash fcrypt_hash_has160;
+extern const struct fcrypt_hash fcrypt_hash_tiger;
+extern const struct fcrypt_hash fcrypt_hash_tiger2;
+
+/* Returns the hash with the given name, or NULL if there is none. */
+const struct fcrypt_hash *fcrypt_hash_lookup (const char *);
+
+/*
+ * Returns the hash with the given index, counting from zero, or NULL past
+ * the last one, for listing the hashes.
+ */
+const struct fcrypt_hash *fcrypt_hash_get (size_t);
+
+/*
+ * Copies a context, so a common prefix can be hashed once and each copy
+ * finished with a different suffix. Contexts hold no pointers, so this is
+ * the same as the *_copy function of each hash, such as sha256_copy.
+ */
+void fcrypt_hash_copy (const struct fcrypt_hash *, void *, const void *);
+
+/*
+ * Writes the digest and starts the next message in the same context, for
+ * callers that hash many messages one after another. Every final function
+ * clears its context with a few inline stores, so there is no need to clear
+ * it again, and reusing it costs little more than init.
+ */
+void fcrypt_hash_final_reset (const struct fcrypt_hash *, uint8_t *, void *);
+
+/*
+ * Saves a context part way through a message and restores it, possibly in
+ * another process or on another machine. The serialized form is a version
+ * byte, the length and name of the hash, and then each field of the
+ * context as a little-endian integer of 8, 32 or 64 bits, with buffers
+ * trimmed to the bytes in use; it is not tied to the structure layout, byte
+ * order or word size. The export function writes at most
+ * FCRYPT_HASH_MAX_STATE_SIZE bytes and returns the number written. The
+ * import function returns 0, or -1 with errno set to EINVAL if the input is
+ * not a whole state of the same hash, in which case the context is cleared.
+ * A saved state holds the data of the last partial block of the message, so
+ * treat it with the same care as the message.
+ */
+size_t fcrypt_hash_export (const struct fcrypt_hash *, const void *,
+                           uint8_t *);
+int fcrypt_hash_import (const struct fcrypt_hash *, void *, const uint8_t *,
+                        size_t);
+
+/*
+ * Passes the buffers of an iovec array to the update function in order, so
+ * a message held in pieces is hashed without first being copied together.
+ * The context keeps a block that straddles two buffers, as it does between
+ * calls of update.
+ */
+void fcrypt_hash_updatev (const struct fcrypt_hash *, void *,
+                          const struct iovec *, size_t);
+
+/*
+ * Hashes many independent messages, writing the digest of message i to
+ * digests + i * digest_size. MD5, SHA-1 and SHA-256 run the messages through
+ * their multi-buffer code, such as sha256_multi; the other hashes call
+ * their digest function once per message.
+ */
+void fcrypt_hash_multi (const struct fcrypt_hash *, uint8_t *,
+                        const uint8_t *const *, const size_t *, size_t);
+
+/*
+ * Hashes everything from the current offset of an open file to its end, or
+ * the file at a path, writing digest_size bytes to the digest. Large regular
+ * files are mapped into memory; others are read by a second thread, into
+ * one buffer while the hash works on the other. Returns 0 on success, or -1
+ * with errno set if the file can not be read. A file that is truncated
+ * while it is mapped raises SIGBUS, as with any mapping.
+ */
+int fcrypt_hash_fd (const struct fcrypt_hash *, int, uint8_t *);
+int fcrypt_hash_file (const struct fcrypt_hash *, const char *, uint8_t *);
+
+#endif /* FCRYPT_HASH_H */
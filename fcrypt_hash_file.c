@@ -0,0 +1,345 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(HAVE_FCNTL_H)
+#include <fcntl.h>
+#endif
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+#if defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#endif
+#if defined(HAVE_SYS_STAT_H)
+#include <sys/stat.h>
+#endif
+#if defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include "fcrypt_hash.h"
+#include "fcrypt_memzero.h"
+
+/* Size of each read, and of each update on a mapped file. */
+#define FCRYPT_HASH_FILE_CHUNK (256 * 1024)
+
+/* Smallest regular file that is mapped rather than read. */
+#define FCRYPT_HASH_FILE_MMAP_MIN (4 * 1024 * 1024)
+
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_SYS_STAT_H)
+#define FCRYPT_HASH_FILE_MMAP 1
+#endif
+
+/* Reads up to len bytes, retrying short reads. Returns -1 on error. */
+static ssize_t
+fcrypt_read_full (int fd, uint8_t *buffer, size_t len)
+{
+  size_t done;
+  ssize_t n;
+
+  done = 0;
+  while (done < len)
+    {
+      n = read (fd, buffer + done, len - done);
+      if (n == 0)
+        break;
+      if (n < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          return -1;
+        }
+      done += (size_t)n;
+    }
+  return (ssize_t)done;
+}
+
+#if defined(FCRYPT_HASH_FILE_MMAP)
+/*
+ * Hashes len bytes starting at offset of a regular file through a read-only
+ * mapping. Returns 1 if the file was hashed, 0 if it could not be mapped.
+ */
+static int
+fcrypt_hash_mapped (const struct fcrypt_hash *hash, void *ctx, int fd,
+                    off_t offset, size_t len)
+{
+  const uint8_t *data;
+  void *map;
+  size_t skip, done, n;
+  long pagesize;
+
+  pagesize = sysconf (_SC_PAGESIZE);
+  if (pagesize <= 0)
+    return 0;
+  skip = (size_t)(offset % pagesize);
+  map = mmap (NULL, len + skip, PROT_READ, MAP_PRIVATE, fd, offset - skip);
+  if (map == MAP_FAILED)
+    return 0;
+#if defined(HAVE_MADVISE)
+  madvise (map, len + skip, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+  madvise (map, len + skip, MADV_HUGEPAGE);
+#endif
+#endif
+
+  data = (const uint8_t *)map + skip;
+  for (done = 0; done < len; done += n)
+    {
+      n = len - done < FCRYPT_HASH_FILE_CHUNK ? len - done
+                                              : FCRYPT_HASH_FILE_CHUNK;
+      hash->update (ctx, data + done, n);
+#if defined(HAVE_MADVISE) && defined(MADV_DONTNEED)
+      /* The pages behind us are not needed again. */
+      if (done >= FCRYPT_HASH_FILE_CHUNK)
+        madvise ((uint8_t *)map + ((skip + done - FCRYPT_HASH_FILE_CHUNK)
+                                   & ~(size_t)(pagesize - 1)),
+                 FCRYPT_HASH_FILE_CHUNK, MADV_DONTNEED);
+#endif
+    }
+  munmap (map, len + skip);
+  return 1;
+}
+#endif
+
+#if defined(HAVE_PTHREAD)
+/*
+ * Two buffers passed between the thread reading the file and the thread
+ * hashing it. Buffer i is full once the reader has filled it and empty once
+ * the hash is done with it. A length of zero marks the end of the file.
+ */
+struct fcrypt_hash_reader
+{
+  int fd;
+  uint8_t *buffers[2];
+  size_t lens[2];
+  int full[2];
+  int error;
+  int stop;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+};
+
+static void *
+fcrypt_hash_reader_thread (void *arg)
+{
+  struct fcrypt_hash_reader *reader = arg;
+  unsigned int i;
+  ssize_t n;
+  int stop;
+
+  for (i = 0;; i ^= 1)
+    {
+      pthread_mutex_lock (&reader->lock);
+      while (reader->full[i] && !reader->stop)
+        pthread_cond_wait (&reader->cond, &reader->lock);
+      stop = reader->stop;
+      pthread_mutex_unlock (&reader->lock);
+      if (stop)
+        break;
+
+      n = fcrypt_read_full (reader->fd, reader->buffers[i],
+                            FCRYPT_HASH_FILE_CHUNK);
+
+      pthread_mutex_lock (&reader->lock);
+      if (n < 0)
+        reader->error = errno;
+      reader->lens[i] = n < 0 ? 0 : (size_t)n;
+      reader->full[i] = 1;
+      pthread_cond_signal (&reader->cond);
+      pthread_mutex_unlock (&reader->lock);
+      if (n < FCRYPT_HASH_FILE_CHUNK)
+        break;
+    }
+  return NULL;
+}
+
+/*
+ * Hashes the rest of the file while a second thread reads ahead. Returns 1
+ * if the file was hashed, 0 if the thread could not be started and -1 on a
+ * read error.
+ */
+static int
+fcrypt_hash_pipelined (const struct fcrypt_hash *hash, void *ctx, int fd,
+                       uint8_t *buffer)
+{
+  struct fcrypt_hash_reader reader;
+  pthread_t thread;
+  unsigned int i;
+  size_t len;
+  int error;
+
+  reader.fd = fd;
+  reader.buffers[0] = buffer;
+  reader.buffers[1] = buffer + FCRYPT_HASH_FILE_CHUNK;
+  reader.full[0] = reader.full[1] = 0;
+  reader.error = 0;
+  reader.stop = 0;
+  if (pthread_mutex_init (&reader.lock, NULL) != 0)
+    return 0;
+  if (pthread_cond_init (&reader.cond, NULL) != 0)
+    {
+      pthread_mutex_destroy (&reader.lock);
+      return 0;
+    }
+  if (pthread_create (&thread, NULL, fcrypt_hash_reader_thread, &reader) != 0)
+    {
+      pthread_cond_destroy (&reader.cond);
+      pthread_mutex_destroy (&reader.lock);
+      return 0;
+    }
+
+  for (i = 0;; i ^= 1)
+    {
+      pthread_mutex_lock (&reader.lock);
+      while (!reader.full[i])
+        pthread_cond_wait (&reader.cond, &reader.lock);
+      len = reader.lens[i];
+      error = reader.error;
+      pthread_mutex_unlock (&reader.lock);
+      if (error != 0)
+        break;
+
+      hash->update (ctx, reader.buffers[i], len);
+      if (len < FCRYPT_HASH_FILE_CHUNK)
+        break;
+
+      pthread_mutex_lock (&reader.lock);
+      reader.full[i] = 0;
+      pthread_cond_signal (&reader.cond);
+      pthread_mutex_unlock (&reader.lock);
+    }
+
+  pthread_mutex_lock (&reader.lock);
+  reader.stop = 1;
+  pthread_cond_signal (&reader.cond);
+  pthread_mutex_unlock (&reader.lock);
+  pthread_join (thread, NULL);
+  pthread_cond_destroy (&reader.cond);
+  pthread_mutex_destroy (&reader.lock);
+  if (error != 0)
+    {
+      errno = error;
+      return -1;
+    }
+  return 1;
+}
+#endif
+
+int
+fcrypt_hash_fd (const struct fcrypt_hash *hash, int fd, uint8_t *digest)
+{
+  uint8_t *block, *buffer;
+  void *ctx;
+  ssize_t n;
+  int rv, done;
+#if defined(FCRYPT_HASH_FILE_MMAP)
+  struct stat st;
+  off_t offset;
+#endif
+
+  /* The context, aligned, followed by the two read buffers. */
+  block = malloc (hash->ctx_align + hash->ctx_size
+                  + 2 * FCRYPT_HASH_FILE_CHUNK);
+  if (block == NULL)
+    return -1;
+  ctx = block
+        + (hash->ctx_align - (uintptr_t)block % hash->ctx_align)
+              % hash->ctx_align;
+  buffer = (uint8_t *)ctx + hash->ctx_size;
+  hash->init (ctx);
+  rv = 0;
+  done = 0;
+
+#if defined(FCRYPT_HASH_FILE_MMAP)
+  if (fstat (fd, &st) == 0 && S_ISREG (st.st_mode)
+      && (offset = lseek (fd, 0, SEEK_CUR)) >= 0
+      && st.st_size - offset >= FCRYPT_HASH_FILE_MMAP_MIN
+      && (uintmax_t)(st.st_size - offset) <= SIZE_MAX)
+    {
+      done = fcrypt_hash_mapped (hash, ctx, fd, offset,
+                                 (size_t)(st.st_size - offset));
+      if (done)
+        lseek (fd, st.st_size, SEEK_SET);
+    }
+#endif
+
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_SEQUENTIAL)
+  if (!done)
+    posix_fadvise (fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+#if defined(HAVE_PTHREAD)
+  if (!done)
+    {
+      rv = fcrypt_hash_pipelined (hash, ctx, fd, buffer);
+      done = rv != 0;
+      rv = rv < 0 ? -1 : 0;
+    }
+#endif
+
+  /* Plain reads if the reading thread could not be started. */
+  while (!done)
+    {
+      n = fcrypt_read_full (fd, buffer, FCRYPT_HASH_FILE_CHUNK);
+      if (n < 0)
+        {
+          rv = -1;
+          break;
+        }
+      hash->update (ctx, buffer, (size_t)n);
+      done = n < FCRYPT_HASH_FILE_CHUNK;
+    }
+
+  /* The final function clears the context itself. */
+  if (rv == 0)
+    hash->final (digest, ctx);
+  else
+    fcrypt_memzero (ctx, hash->ctx_size);
+  free (block);
+  return rv;
+}
+
+int
+fcrypt_hash_file (const struct fcrypt_hash *hash, const char *path,
+                  uint8_t *digest)
+{
+  int fd, rv, saved;
+
+  fd = open (path, O_RDONLY);
+  if (fd < 0)
+    return -1;
+  rv = fcrypt_hash_fd (hash, fd, digest);
+  saved = errno;
+  close (fd);
+  errno = saved;
+  return rv;
+}
@@ -0,0 +1,528 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Serialized hash contexts for fcrypt_hash_export and fcrypt_hash_import.
+ * Each context is described by a table of its fields, which are written in
+ * order as little-endian integers of a fixed width. The format therefore
+ * does not depend on the compiler's structure layout, the byte order or the
+ * width of size_t. Buffers only store the bytes in use, given by a length
+ * field that comes earlier in the table.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "blake2b.h"
+#include "blake2bp.h"
+#include "blake2s.h"
+#include "blake2sp.h"
+#include "blake3.h"
+#include "bswap.h"
+#include "fcrypt_hash.h"
+#include "fcrypt_memzero.h"
+#include "has160.h"
+#include "md2.h"
+#include "md4.h"
+#include "md5.h"
+#include "rmd128.h"
+#include "rmd160.h"
+#include "sha1.h"
+#include "sha1dc.h"
+#include "sha256.h"
+#include "sha3.h"
+#include "sha512.h"
+#include "tiger.h"
+
+#define FCRYPT_STATE_VERSION 1
+
+enum fcrypt_state_type
+{
+  STATE_BYTES,       /* Bytes copied as they are */
+  STATE_U8,          /* uint8_t */
+  STATE_U32,         /* uint32_t */
+  STATE_U64,         /* uint64_t */
+  STATE_SIZE,        /* size_t, stored in 64 bits */
+  STATE_INT,         /* int, stored in 32 bits */
+  STATE_BUFFER_BITS, /* Buffer filled to a uint64_t bit count mod its size */
+  STATE_BUFFER_LEN   /* Buffer filled to a length field times unit bytes */
+};
+
+/* Checks made on each value by fcrypt_hash_import. */
+enum fcrypt_state_check
+{
+  STATE_ANY,      /* Any value */
+  STATE_INIT,     /* The value set by the init function */
+  STATE_MAX,      /* At most arg */
+  STATE_MAX_BLOCK /* At most the block size of the hash */
+};
+
+struct fcrypt_state_field
+{
+  uint8_t type;
+  uint8_t check;
+  uint8_t len_type;  /* Type of the length field of a STATE_BUFFER_LEN */
+  size_t offset;     /* Offset in the context */
+  size_t size;       /* Bytes taken in the context */
+  size_t len_offset; /* Offset of the length of a buffer */
+  size_t arg;        /* Bytes per unit of length, or the STATE_MAX value */
+};
+
+struct fcrypt_state
+{
+  const struct fcrypt_hash *hash;
+  const struct fcrypt_state_field *fields;
+  size_t nfields;
+  /* Checks that the values agree with each other, or NULL. */
+  int (*valid) (const void *);
+};
+
+#define STATE_MEMBER_SIZE(type, member) sizeof (((type *)0)->member)
+
+#define STATE_FIELD(t, check, arg, type, member)                              \
+  {                                                                           \
+    STATE_##t, check, 0, offsetof (type, member),                             \
+        STATE_MEMBER_SIZE (type, member), 0, arg                              \
+  }
+
+#define STATE_BITS(type, member, count)                                       \
+  {                                                                           \
+    STATE_BUFFER_BITS, STATE_ANY, STATE_U64, offsetof (type, member),         \
+        STATE_MEMBER_SIZE (type, member), offsetof (type, count), 0           \
+  }
+
+#define STATE_LEN(type, member, lt, len, unit)                                \
+  {                                                                           \
+    STATE_BUFFER_LEN, STATE_ANY, STATE_##lt, offsetof (type, member),         \
+        STATE_MEMBER_SIZE (type, member), offsetof (type, len), unit          \
+  }
+
+/* The Merkle-Damgard hashes with a 64-bit count of bits. */
+#define STATE_MD_FIELDS(type, w)                                              \
+  STATE_FIELD (w, STATE_ANY, 0, type, state),                                 \
+      STATE_FIELD (U64, STATE_ANY, 0, type, count),                           \
+      STATE_BITS (type, buffer, count)
+
+/* A BLAKE2 context, at p in the context type. */
+#define STATE_BLAKE2_FIELDS(type, w, p)                                       \
+  STATE_FIELD (w, STATE_ANY, 0, type, p state),                               \
+      STATE_FIELD (w, STATE_ANY, 0, type, p t),                               \
+      STATE_FIELD (w, STATE_ANY, 0, type, p f),                               \
+      STATE_FIELD (SIZE, STATE_ANY, 0, type, p bufferlen),                    \
+      STATE_FIELD (SIZE, STATE_INIT, 0, type, p digestlen),                   \
+      STATE_FIELD (INT, STATE_INIT, 0, type, p lastnode),                     \
+      STATE_LEN (type, p buffer, SIZE, p bufferlen, 1)
+
+static const struct fcrypt_state_field md2_fields[] = {
+  STATE_FIELD (BYTES, STATE_ANY, 0, struct md2_ctx, checksum),
+  STATE_FIELD (BYTES, STATE_ANY, 0, struct md2_ctx, state),
+  STATE_FIELD (SIZE, STATE_ANY, 0, struct md2_ctx, bufferlen),
+  STATE_LEN (struct md2_ctx, buffer, SIZE, bufferlen, 1),
+};
+
+static const struct fcrypt_state_field md4_fields[]
+    = { STATE_MD_FIELDS (struct md4_ctx, U32) };
+static const struct fcrypt_state_field md5_fields[]
+    = { STATE_MD_FIELDS (struct md5_ctx, U32) };
+static const struct fcrypt_state_field sha1_fields[]
+    = { STATE_MD_FIELDS (struct sha1_ctx, U32) };
+static const struct fcrypt_state_field sha256_fields[]
+    = { STATE_MD_FIELDS (struct sha256_ctx, U32) };
+static const struct fcrypt_state_field rmd128_fields[]
+    = { STATE_MD_FIELDS (struct rmd128_ctx, U32) };
+static const struct fcrypt_state_field rmd160_fields[]
+    = { STATE_MD_FIELDS (struct rmd160_ctx, U32) };
+static const struct fcrypt_state_field has160_fields[]
+    = { STATE_MD_FIELDS (struct has160_ctx, U32) };
+
+static const struct fcrypt_state_field sha1dc_fields[] = {
+  STATE_MD_FIELDS (struct sha1dc_ctx, U32),
+  STATE_FIELD (INT, STATE_MAX, 1, struct sha1dc_ctx, safe_hash),
+  STATE_FIELD (INT, STATE_MAX, 1, struct sha1dc_ctx, collision),
+};
+
+/* The low word of the 128-bit count comes first. */
+static const struct fcrypt_state_field sha512_fields[]
+    = { STATE_MD_FIELDS (struct sha512_ctx, U64) };
+
+static const struct fcrypt_state_field tiger_fields[] = {
+  STATE_MD_FIELDS (struct tiger_ctx, U64),
+  STATE_FIELD (INT, STATE_INIT, 0, struct tiger_ctx, version),
+};
+
+static const struct fcrypt_state_field sha3_fields[] = {
+  STATE_FIELD (U64, STATE_ANY, 0, struct sha3_ctx, state),
+  STATE_FIELD (SIZE, STATE_INIT, 0, struct sha3_ctx, rate),
+  STATE_FIELD (SIZE, STATE_MAX_BLOCK, 0, struct sha3_ctx, pos),
+  STATE_FIELD (SIZE, STATE_INIT, 0, struct sha3_ctx, digest_size),
+  STATE_FIELD (U8, STATE_INIT, 0, struct sha3_ctx, suffix),
+  STATE_FIELD (INT, STATE_MAX, 1, struct sha3_ctx, squeezing),
+};
+
+static const struct fcrypt_state_field blake2b_fields[]
+    = { STATE_BLAKE2_FIELDS (struct blake2b_ctx, U64, ) };
+static const struct fcrypt_state_field blake2s_fields[]
+    = { STATE_BLAKE2_FIELDS (struct blake2s_ctx, U32, ) };
+
+static const struct fcrypt_state_field blake2bp_fields[] = {
+  STATE_BLAKE2_FIELDS (struct blake2bp_ctx, U64, leaves[0].),
+  STATE_BLAKE2_FIELDS (struct blake2bp_ctx, U64, leaves[1].),
+  STATE_BLAKE2_FIELDS (struct blake2bp_ctx, U64, leaves[2].),
+  STATE_BLAKE2_FIELDS (struct blake2bp_ctx, U64, leaves[3].),
+  STATE_BLAKE2_FIELDS (struct blake2bp_ctx, U64, root.),
+  STATE_FIELD (SIZE, STATE_ANY, 0, struct blake2bp_ctx, bufferlen),
+  STATE_FIELD (SIZE, STATE_INIT, 0, struct blake2bp_ctx, digestlen),
+  STATE_LEN (struct blake2bp_ctx, buffer, SIZE, bufferlen, 1),
+};
+
+static const struct fcrypt_state_field blake2sp_fields[] = {
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[0].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[1].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[2].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[3].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[4].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[5].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[6].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, leaves[7].),
+  STATE_BLAKE2_FIELDS (struct blake2sp_ctx, U32, root.),
+  STATE_FIELD (SIZE, STATE_ANY, 0, struct blake2sp_ctx, bufferlen),
+  STATE_FIELD (SIZE, STATE_INIT, 0, struct blake2sp_ctx, digestlen),
+  STATE_LEN (struct blake2sp_ctx, buffer, SIZE, bufferlen, 1),
+};
+
+/* The last block of a chunk stays in the buffer, so 15 are compressed. */
+static const struct fcrypt_state_field blake3_fields[] = {
+  STATE_FIELD (U32, STATE_INIT, 0, struct blake3_ctx, key),
+  STATE_FIELD (U32, STATE_ANY, 0, struct blake3_ctx, chunk.cv),
+  STATE_FIELD (U64, STATE_ANY, 0, struct blake3_ctx, chunk.counter),
+  STATE_FIELD (U8, STATE_ANY, 0, struct blake3_ctx, chunk.bufferlen),
+  STATE_FIELD (U8, STATE_MAX, BLAKE3_CHUNK_SIZE / BLAKE3_BLOCK_SIZE - 1,
+               struct blake3_ctx, chunk.blocks),
+  STATE_FIELD (U8, STATE_INIT, 0, struct blake3_ctx, chunk.flags),
+  STATE_FIELD (SIZE, STATE_ANY, 0, struct blake3_ctx, stacklen),
+  STATE_LEN (struct blake3_ctx, chunk.buffer, U8, chunk.bufferlen, 1),
+  STATE_LEN (struct blake3_ctx, stack, SIZE, stacklen, BLAKE3_DIGEST_SIZE),
+};
+
+/* The stack holds one chaining value for each bit set in the counter. */
+static int
+blake3_state_valid (const void *ptr)
+{
+  const struct blake3_ctx *ctx = ptr;
+  uint64_t counter;
+  size_t bits;
+
+  for (bits = 0, counter = ctx->chunk.counter; counter != 0; counter >>= 1)
+    bits += (size_t)(counter & 1);
+  return ctx->stacklen == bits;
+}
+
+#define STATE(id, fields, valid)                                              \
+  {                                                                           \
+    &fcrypt_hash_##id, fields, sizeof (fields) / sizeof (fields[0]), valid    \
+  }
+
+static const struct fcrypt_state fcrypt_states[] = {
+  STATE (md2, md2_fields, NULL),
+  STATE (md4, md4_fields, NULL),
+  STATE (md5, md5_fields, NULL),
+  STATE (sha1, sha1_fields, NULL),
+  STATE (sha1dc, sha1dc_fields, NULL),
+  STATE (sha224, sha256_fields, NULL),
+  STATE (sha256, sha256_fields, NULL),
+  STATE (sha384, sha512_fields, NULL),
+  STATE (sha512, sha512_fields, NULL),
+  STATE (sha3_224, sha3_fields, NULL),
+  STATE (sha3_256, sha3_fields, NULL),
+  STATE (sha3_384, sha3_fields, NULL),
+  STATE (sha3_512, sha3_fields, NULL),
+  STATE (blake2b, blake2b_fields, NULL),
+  STATE (blake2bp, blake2bp_fields, NULL),
+  STATE (blake2s, blake2s_fields, NULL),
+  STATE (blake2sp, blake2sp_fields, NULL),
+  STATE (blake3, blake3_fields, blake3_state_valid),
+  STATE (rmd128, rmd128_fields, NULL),
+  STATE (rmd160, rmd160_fields, NULL),
+  STATE (has160, has160_fields, NULL),
+  STATE (tiger, tiger_fields, NULL),
+  STATE (tiger2, tiger_fields, NULL),
+};
+
+static const struct fcrypt_state *
+fcrypt_state_lookup (const struct fcrypt_hash *hash)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (fcrypt_states) / sizeof (fcrypt_states[0]); ++i)
+    if (fcrypt_states[i].hash == hash)
+      return &fcrypt_states[i];
+  return NULL;
+}
+
+/* Native width of one element of a field. */
+static size_t
+fcrypt_state_width (unsigned int type)
+{
+  switch (type)
+    {
+    case STATE_U32:
+      return sizeof (uint32_t);
+    case STATE_U64:
+      return sizeof (uint64_t);
+    case STATE_SIZE:
+      return sizeof (size_t);
+    case STATE_INT:
+      return sizeof (int);
+    default:
+      return 1;
+    }
+}
+
+/* Width of one element in the serialized form. */
+static size_t
+fcrypt_state_stored_width (unsigned int type)
+{
+  switch (type)
+    {
+    case STATE_U32:
+    case STATE_INT:
+      return 4;
+    case STATE_U64:
+    case STATE_SIZE:
+      return 8;
+    default:
+      return 1;
+    }
+}
+
+static uint64_t
+fcrypt_state_get (const uint8_t *p, unsigned int type)
+{
+  uint32_t u32;
+  uint64_t u64;
+  size_t size;
+  int i;
+
+  switch (type)
+    {
+    case STATE_U32:
+      memcpy (&u32, p, sizeof (u32));
+      return u32;
+    case STATE_U64:
+      memcpy (&u64, p, sizeof (u64));
+      return u64;
+    case STATE_SIZE:
+      memcpy (&size, p, sizeof (size));
+      return size;
+    case STATE_INT:
+      memcpy (&i, p, sizeof (i));
+      return (uint32_t)i;
+    default:
+      return *p;
+    }
+}
+
+/* Stores v, returning zero if it does not fit the type. */
+static int
+fcrypt_state_set (uint8_t *p, unsigned int type, uint64_t v)
+{
+  uint32_t u32;
+  size_t size;
+  int i;
+
+  switch (type)
+    {
+    case STATE_U32:
+      u32 = (uint32_t)v;
+      memcpy (p, &u32, sizeof (u32));
+      return v <= UINT32_MAX;
+    case STATE_U64:
+      memcpy (p, &v, sizeof (v));
+      return 1;
+    case STATE_SIZE:
+      size = (size_t)v;
+      memcpy (p, &size, sizeof (size));
+      return v <= SIZE_MAX;
+    case STATE_INT:
+      i = (int)(int32_t)(uint32_t)v;
+      memcpy (p, &i, sizeof (i));
+      return v <= UINT32_MAX;
+    default:
+      *p = (uint8_t)v;
+      return v <= UINT8_MAX;
+    }
+}
+
+/* Bytes of a buffer that are in use. */
+static uint64_t
+fcrypt_state_used (const struct fcrypt_state_field *field, const uint8_t *ctx)
+{
+  uint64_t len;
+
+  len = fcrypt_state_get (ctx + field->len_offset, field->len_type);
+  if (field->type == STATE_BUFFER_BITS)
+    return (len >> 3) % field->size;
+  if (len > field->size / field->arg)
+    return UINT64_MAX;
+  return len * field->arg;
+}
+
+size_t
+fcrypt_hash_export (const struct fcrypt_hash *hash, const void *ctxptr,
+                    uint8_t *out)
+{
+  const struct fcrypt_state *state;
+  const struct fcrypt_state_field *field;
+  const uint8_t *ctx = ctxptr;
+  uint8_t le[8], *p;
+  size_t i, j, n, width, stored;
+  uint64_t v;
+
+  state = fcrypt_state_lookup (hash);
+  if (state == NULL)
+    return 0;
+
+  p = out;
+  n = strlen (hash->name);
+  *p++ = FCRYPT_STATE_VERSION;
+  *p++ = (uint8_t)n;
+  memcpy (p, hash->name, n);
+  p += n;
+
+  for (i = 0; i < state->nfields; ++i)
+    {
+      field = &state->fields[i];
+      if (field->type == STATE_BUFFER_BITS || field->type == STATE_BUFFER_LEN)
+        {
+          n = (size_t)fcrypt_state_used (field, ctx);
+          memcpy (p, ctx + field->offset, n);
+          p += n;
+          continue;
+        }
+
+      width = fcrypt_state_width (field->type);
+      stored = fcrypt_state_stored_width (field->type);
+      for (j = 0; j < field->size; j += width)
+        {
+          v = fcrypt_state_get (ctx + field->offset + j, field->type);
+          buff_put_le64 (le, v);
+          memcpy (p, le, stored);
+          p += stored;
+        }
+    }
+
+  return (size_t)(p - out);
+}
+
+/*
+ * Reads the fields into ctx, which holds the values set by init. Returns
+ * zero if the input is too short or a value fails its check.
+ */
+static int
+fcrypt_state_read (const struct fcrypt_state *state, size_t block_size,
+                   uint8_t *ctx, const uint8_t **inptr, const uint8_t *end)
+{
+  const struct fcrypt_state_field *field;
+  const uint8_t *in = *inptr;
+  uint8_t le[8];
+  size_t i, j, width, stored;
+  uint64_t v, used;
+
+  for (i = 0; i < state->nfields; ++i)
+    {
+      field = &state->fields[i];
+      if (field->type == STATE_BUFFER_BITS || field->type == STATE_BUFFER_LEN)
+        {
+          used = fcrypt_state_used (field, ctx);
+          if (used > field->size || used > (uint64_t)(end - in))
+            return 0;
+          memcpy (ctx + field->offset, in, (size_t)used);
+          in += used;
+          continue;
+        }
+
+      width = fcrypt_state_width (field->type);
+      stored = fcrypt_state_stored_width (field->type);
+      for (j = 0; j < field->size; j += width)
+        {
+          if (stored > (size_t)(end - in))
+            return 0;
+          memset (le, 0, sizeof (le));
+          memcpy (le, in, stored);
+          v = buff_get_le64 (le);
+          in += stored;
+
+          if ((field->check == STATE_INIT
+               && v != fcrypt_state_get (ctx + field->offset + j, field->type))
+              || (field->check == STATE_MAX && v > field->arg)
+              || (field->check == STATE_MAX_BLOCK && v > block_size)
+              || !fcrypt_state_set (ctx + field->offset + j, field->type, v))
+            return 0;
+        }
+    }
+
+  *inptr = in;
+  return 1;
+}
+
+int
+fcrypt_hash_import (const struct fcrypt_hash *hash, void *ctx,
+                    const uint8_t *in, size_t inlen)
+{
+  const struct fcrypt_state *state;
+  const uint8_t *end;
+  size_t n;
+
+  state = fcrypt_state_lookup (hash);
+  n = strlen (hash->name);
+  end = in + inlen;
+  if (state == NULL || inlen < 2 + n || in[0] != FCRYPT_STATE_VERSION
+      || in[1] != n || memcmp (in + 2, hash->name, n) != 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  in += 2 + n;
+
+  hash->init (ctx);
+  if (!fcrypt_state_read (state, hash->block_size, ctx, &in, end)
+      || in != end || (state->valid != NULL && !state->valid (ctx)))
+    {
+      fcrypt_memzero (ctx, hash->ctx_size);
+      errno = EINVAL;
+      return -1;
+    }
+  return 0;
+}
+
+void
+fcrypt_hash_copy (const struct fcrypt_hash *hash, void *dst, const void *src)
+{
+  memcpy (dst, src, hash->ctx_size);
+}
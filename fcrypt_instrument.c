@@ -0,0 +1,91 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_instrument.h"
+#include "fcrypt_probe.h"
+
+#if defined(FCRYPT_INSTRUMENT)
+fcrypt_hook_func *fcrypt_probe_hook = NULL;
+
+#if defined(__GNUC__)
+#define FCRYPT_PROBE_LOAD(x) __atomic_load_n (&(x), __ATOMIC_RELAXED)
+#define FCRYPT_PROBE_STORE(x, v)                                              \
+  __atomic_store_n (&(x), (v), __ATOMIC_RELAXED)
+#else
+#define FCRYPT_PROBE_LOAD(x) (x)
+#define FCRYPT_PROBE_STORE(x, v) ((x) = (v))
+#endif
+
+void
+fcrypt_probe_read (const struct fcrypt_counters *src,
+                   struct fcrypt_counters *dest)
+{
+  dest->setup_calls = FCRYPT_PROBE_LOAD (src->setup_calls);
+  dest->bulk_calls = FCRYPT_PROBE_LOAD (src->bulk_calls);
+  dest->bulk_bytes = FCRYPT_PROBE_LOAD (src->bulk_bytes);
+}
+
+void
+fcrypt_probe_clear (struct fcrypt_counters *counters)
+{
+  FCRYPT_PROBE_STORE (counters->setup_calls, 0);
+  FCRYPT_PROBE_STORE (counters->bulk_calls, 0);
+  FCRYPT_PROBE_STORE (counters->bulk_bytes, 0);
+}
+#endif /* FCRYPT_INSTRUMENT */
+
+int
+fcrypt_instrument_enabled (void)
+{
+#if defined(FCRYPT_INSTRUMENT)
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+void
+fcrypt_instrument_set_hook (fcrypt_hook_func *hook)
+{
+#if defined(FCRYPT_INSTRUMENT)
+  FCRYPT_PROBE_STORE (fcrypt_probe_hook, hook);
+#else
+  (void)hook;
+#endif
+}
+
+void
+fcrypt_instrument_reset (void)
+{
+#if defined(FCRYPT_INSTRUMENT)
+  fcrypt_hash_clear_counters ();
+  fcrypt_cipher_clear_counters ();
+#endif
+}
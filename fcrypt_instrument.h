@@ -0,0 +1,93 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Counters and tracing hooks for the hashes of fcrypt_hash.h and the
+ * ciphers of fcrypt_cipher.h, to attribute the time spent in them. They
+ * are only compiled in when the library is configured with
+ * --enable-instrument; otherwise the counters stay at zero and the calls
+ * through the tables cost nothing extra.
+ *
+ * Each table counts its setup calls, which are init for a hash and set_key
+ * for a cipher, and its bulk calls and bytes, which are update and digest
+ * for a hash and the modes for a cipher. The counters are updated with
+ * relaxed atomic additions, so they are exact but may be read while other
+ * threads are adding to them.
+ *
+ * Setup and bulk calls also fire begin and end events, with the name of the
+ * algorithm and the length of the input, which is zero for setup. They go
+ * to the hook function, if one is set, and to the USDT probes setup__begin,
+ * setup__end, bulk__begin and bulk__end of the provider libfcrypt on
+ * systems with <sys/sdt.h>, for perf, bpftrace or SystemTap.
+ */
+
+#ifndef FCRYPT_INSTRUMENT_H
+#define FCRYPT_INSTRUMENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_cipher.h"
+#include "fcrypt_hash.h"
+
+#define FCRYPT_EVENT_SETUP_BEGIN 1
+#define FCRYPT_EVENT_SETUP_END 2
+#define FCRYPT_EVENT_BULK_BEGIN 3
+#define FCRYPT_EVENT_BULK_END 4
+
+struct fcrypt_counters
+{
+  uint64_t setup_calls;
+  uint64_t bulk_calls;
+  uint64_t bulk_bytes;
+  const char *backend; /* Code picked for this CPU, e.g. "shani" */
+};
+
+/* Called with an FCRYPT_EVENT_* value, the algorithm name and a length. */
+typedef void fcrypt_hook_func (int, const char *, size_t);
+
+/* Returns 1 if the library was built with instrumentation and 0 if not. */
+int fcrypt_instrument_enabled (void);
+
+/*
+ * Sets the hook function, or removes it if NULL. The hook is called from
+ * every thread that uses the tables, so it must be thread safe, and it may
+ * still be called once by a thread that read the old hook.
+ */
+void fcrypt_instrument_set_hook (fcrypt_hook_func *);
+
+/*
+ * Reads the counters of a hash or cipher table. Returns 0, or -1 with errno
+ * set to EINVAL if the table is not one of the library's.
+ */
+int fcrypt_hash_counters (const struct fcrypt_hash *,
+                          struct fcrypt_counters *);
+int fcrypt_cipher_counters (const struct fcrypt_cipher *,
+                            struct fcrypt_counters *);
+
+/* Sets the counters of every table to zero. */
+void fcrypt_instrument_reset (void);
+
+#endif /* FCRYPT_INSTRUMENT_H */
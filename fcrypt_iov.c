@@ -0,0 +1,77 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include "fcrypt_iov.h"
+#include "fcrypt_memzero.h"
+
+void
+fcrypt_stream_cryptv (fcrypt_stream_func *func, void *ctx, size_t block_size,
+                      const struct iovec *iov, size_t iovcnt)
+{
+  uint8_t keystream[FCRYPT_IOV_MAX_BLOCK_SIZE];
+  uint8_t *p;
+  size_t i, len, used, n;
+
+  /* Nothing is left of the keystream block until one is made. */
+  used = block_size;
+  for (i = 0; i < iovcnt; ++i)
+    {
+      p = iov[i].iov_base;
+      len = iov[i].iov_len;
+
+      /* Finish the block started at the end of the previous buffer. */
+      while (len > 0 && used < block_size)
+        {
+          *p++ ^= keystream[used++];
+          --len;
+        }
+
+      n = len - len % block_size;
+      if (n > 0)
+        {
+          func (ctx, p, p, n);
+          p += n;
+          len -= n;
+        }
+
+      /* Start a block that the next buffer may finish. */
+      if (len > 0)
+        {
+          memset (keystream, 0, block_size);
+          func (ctx, keystream, keystream, block_size);
+          for (used = 0; used < len; ++used)
+            p[used] ^= keystream[used];
+        }
+    }
+
+  fcrypt_memzero (keystream, sizeof (keystream));
+}
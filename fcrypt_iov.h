@@ -0,0 +1,54 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef FCRYPT_IOV_H
+#define FCRYPT_IOV_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct iovec;
+
+/* Largest block size of the stream functions below. */
+#define FCRYPT_IOV_MAX_BLOCK_SIZE 64
+
+/*
+ * Encrypts len bytes from the first buffer to the second and moves the
+ * position in the keystream to the start of the next block, as the CTR and
+ * ChaCha functions do. A partial final block uses up the whole block.
+ */
+typedef void fcrypt_stream_func (void *, const uint8_t *, uint8_t *, size_t);
+
+/*
+ * Encrypts the buffers of an iovec array in place, as though they were one
+ * contiguous buffer. Whole blocks are passed straight to func from each
+ * buffer. When a block straddles two buffers, one block of keystream is
+ * made and its unused end carried over to the next buffer, so the result
+ * and the final position match a single call of func on the whole message.
+ */
+void fcrypt_stream_cryptv (fcrypt_stream_func *, void *, size_t,
+                           const struct iovec *, size_t);
+
+#endif /* FCRYPT_IOV_H */
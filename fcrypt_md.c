@@ -0,0 +1,227 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "fcrypt_md.h"
+#include "fcrypt_memzero.h"
+
+/* Progress of one message in a lane of fcrypt_md_multi. */
+struct fcrypt_md_lane
+{
+  const uint8_t *data;
+  size_t left;
+  uint64_t count;
+  uint8_t *digest;
+  unsigned int pad_blocks;
+  unsigned int pad_next;
+  uint8_t pad[2 * FCRYPT_MD_BLOCK_SIZE];
+};
+
+static void
+fcrypt_md_lane_start (struct fcrypt_md_lane *lane, const uint8_t *data,
+                      size_t len, uint8_t *digest)
+{
+  lane->data = data;
+  lane->left = len;
+  lane->count = (uint64_t)len << 3;
+  lane->digest = digest;
+  lane->pad_blocks = 0;
+  lane->pad_next = 0;
+}
+
+/*
+ * Returns the next block of the message, building the one or two padded
+ * final blocks once fewer than FCRYPT_MD_BLOCK_SIZE bytes remain.
+ */
+static const uint8_t *
+fcrypt_md_lane_next (struct fcrypt_md_lane *lane, int big_endian)
+{
+  const uint8_t *block;
+  uint8_t *count;
+  size_t n;
+
+  if (lane->left >= FCRYPT_MD_BLOCK_SIZE)
+    {
+      block = lane->data;
+      lane->data += FCRYPT_MD_BLOCK_SIZE;
+      lane->left -= FCRYPT_MD_BLOCK_SIZE;
+      return block;
+    }
+
+  if (lane->pad_blocks == 0)
+    {
+      n = lane->left;
+      if (n != 0)
+        memcpy (lane->pad, lane->data, n);
+      lane->pad[n++] = 0x80;
+      lane->pad_blocks = n <= FCRYPT_MD_BLOCK_SIZE - 8 ? 1 : 2;
+      count = lane->pad + lane->pad_blocks * FCRYPT_MD_BLOCK_SIZE - 8;
+      memset (lane->pad + n, 0, (size_t)(count - lane->pad) - n);
+      if (big_endian)
+        buff_put_be64 (count, lane->count);
+      else
+        buff_put_le64 (count, lane->count);
+      lane->left = 0;
+    }
+
+  return lane->pad + lane->pad_next++ * FCRYPT_MD_BLOCK_SIZE;
+}
+
+static int
+fcrypt_md_lane_done (const struct fcrypt_md_lane *lane)
+{
+  return lane->pad_blocks != 0 && lane->pad_next == lane->pad_blocks;
+}
+
+static void
+fcrypt_md_output (const struct fcrypt_md_multi *md, uint8_t *digest,
+                  const uint32_t *state, unsigned int stride)
+{
+  unsigned int j;
+
+  for (j = 0; j < md->digest_words; ++j)
+    if (md->big_endian)
+      buff_put_be32 (digest + j * 4, state[j * stride]);
+    else
+      buff_put_le32 (digest + j * 4, state[j * stride]);
+}
+
+/* Finishes a message on its own once too few lanes are busy. */
+static void
+fcrypt_md_lane_finish (const struct fcrypt_md_multi *md,
+                       struct fcrypt_md_lane *lane, uint32_t *state)
+{
+  size_t blocks;
+
+  blocks = lane->left / FCRYPT_MD_BLOCK_SIZE;
+  if (blocks != 0)
+    {
+      md->compress (state, lane->data, blocks);
+      lane->data += blocks * FCRYPT_MD_BLOCK_SIZE;
+      lane->left -= blocks * FCRYPT_MD_BLOCK_SIZE;
+    }
+  while (!fcrypt_md_lane_done (lane))
+    md->compress (state, fcrypt_md_lane_next (lane, md->big_endian), 1);
+
+  fcrypt_md_output (md, lane->digest, state, 1);
+}
+
+void
+fcrypt_md_multi (const struct fcrypt_md_multi *md, uint8_t *digests,
+                 const uint8_t *const *messages, const size_t *lens,
+                 size_t count)
+{
+  static const uint8_t idle[FCRYPT_MD_BLOCK_SIZE] = { 0 };
+  struct fcrypt_md_lane lane[FCRYPT_MD_MAX_LANES];
+  uint32_t state[FCRYPT_MD_MAX_WORDS * FCRYPT_MD_MAX_LANES];
+  const uint8_t *blocks[FCRYPT_MD_MAX_LANES];
+  uint8_t busy[FCRYPT_MD_MAX_LANES];
+  uint8_t buffer[FCRYPT_MD_BLOCK_SIZE];
+  uint32_t single[FCRYPT_MD_MAX_WORDS];
+  unsigned int active, lanes, l, j;
+  size_t next, size;
+
+  size = md->digest_words * 4;
+  lanes = md->lanes;
+  if (lanes == 0 || count < 2)
+    {
+      for (next = 0; next < count; ++next)
+        {
+          memcpy (single, md->iv, md->words * 4);
+          fcrypt_md_oneshot (single, buffer, md->compress, 0x80,
+                             md->big_endian, messages[next], lens[next]);
+          fcrypt_md_output (md, digests + next * size, single, 1);
+        }
+      fcrypt_memzero (buffer, sizeof (buffer));
+      fcrypt_memzero (single, sizeof (single));
+      return;
+    }
+
+  active = 0;
+  next = 0;
+  for (l = 0; l < lanes; ++l)
+    {
+      busy[l] = next < count;
+      if (busy[l])
+        {
+          fcrypt_md_lane_start (&lane[l], messages[next], lens[next],
+                                digests + next * size);
+          for (j = 0; j < md->words; ++j)
+            state[j * lanes + l] = md->iv[j];
+          ++active;
+          ++next;
+        }
+    }
+
+  while (active > 0)
+    {
+      if (next == count && active * 2 <= lanes)
+        {
+          for (l = 0; l < lanes; ++l)
+            if (busy[l])
+              {
+                for (j = 0; j < md->words; ++j)
+                  single[j] = state[j * lanes + l];
+                fcrypt_md_lane_finish (md, &lane[l], single);
+              }
+          break;
+        }
+
+      for (l = 0; l < lanes; ++l)
+        blocks[l] = busy[l] ? fcrypt_md_lane_next (&lane[l], md->big_endian)
+                            : idle;
+      md->compress_lanes (state, blocks);
+
+      for (l = 0; l < lanes; ++l)
+        {
+          if (!busy[l] || !fcrypt_md_lane_done (&lane[l]))
+            continue;
+          fcrypt_md_output (md, lane[l].digest, state + l, lanes);
+          if (next < count)
+            {
+              fcrypt_md_lane_start (&lane[l], messages[next], lens[next],
+                                    digests + next * size);
+              for (j = 0; j < md->words; ++j)
+                state[j * lanes + l] = md->iv[j];
+              ++next;
+            }
+          else
+            {
+              busy[l] = 0;
+              --active;
+            }
+        }
+    }
+
+  fcrypt_memzero (lane, sizeof (lane));
+  fcrypt_memzero (state, sizeof (state));
+  fcrypt_memzero (single, sizeof (single));
+}
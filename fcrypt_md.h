@@ -0,0 +1,189 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Block buffering and padding shared by the hashes built on the
+ * Merkle-Damgard construction with 64-byte blocks and a 64-bit bit count:
+ * MD4, MD5, SHA-1, SHA-224, SHA-256, RIPEMD-128, RIPEMD-160, HAS-160 and
+ * Tiger. Each hash supplies a function that compresses any number of
+ * consecutive blocks into its state. The functions are inline so that the
+ * compression function is called directly from every hash.
+ */
+
+#ifndef FCRYPT_MD_H
+#define FCRYPT_MD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+
+#define FCRYPT_MD_BLOCK_SIZE 64
+
+/* Compresses the given number of blocks into the state. */
+typedef void (*fcrypt_md_compress_fn) (void *, const uint8_t *, size_t);
+
+/*
+ * Adds input to a hash with its bit count and partial block in count and
+ * buffer. Whole blocks are compressed straight from the input.
+ */
+static inline void
+fcrypt_md_update (void *state, uint64_t *count, uint8_t *buffer,
+                  fcrypt_md_compress_fn compress, const void *inputptr,
+                  size_t inputlen)
+{
+  const uint8_t *input = inputptr;
+  size_t filled, need, blocks;
+
+  if (inputlen == 0)
+    return;
+
+  filled = (size_t)((*count >> 3) & (FCRYPT_MD_BLOCK_SIZE - 1));
+  need = FCRYPT_MD_BLOCK_SIZE - filled;
+  *count += (uint64_t)inputlen << 3;
+
+  /* Input too short to fill a complete block. */
+  if (inputlen < need)
+    {
+      memcpy (buffer + filled, input, inputlen);
+      return;
+    }
+
+  /* Check if we need to finish the buffer. */
+  if (filled != 0)
+    {
+      memcpy (buffer + filled, input, need);
+      compress (state, buffer, 1);
+      inputlen -= need;
+      input += need;
+    }
+
+  /* Handle as many blocks as possible. */
+  blocks = inputlen / FCRYPT_MD_BLOCK_SIZE;
+  if (blocks != 0)
+    {
+      compress (state, input, blocks);
+      inputlen -= blocks * FCRYPT_MD_BLOCK_SIZE;
+      input += blocks * FCRYPT_MD_BLOCK_SIZE;
+    }
+
+  /* Save any remaining bytes. */
+  if (inputlen != 0)
+    memcpy (buffer, input, inputlen);
+}
+
+/*
+ * Appends the padding byte, zeros and the bit count to the partial block in
+ * buffer and compresses the one or two final blocks. The count is stored
+ * big-endian for the SHA family and little-endian for the others.
+ */
+static inline void
+fcrypt_md_final (void *state, uint64_t count, uint8_t *buffer,
+                 fcrypt_md_compress_fn compress, uint8_t pad, int big_endian)
+{
+  size_t padoffset;
+
+  padoffset = (size_t)((count >> 3) & (FCRYPT_MD_BLOCK_SIZE - 1));
+  buffer[padoffset++] = pad;
+
+  /* Not enough room for count. */
+  if (padoffset > FCRYPT_MD_BLOCK_SIZE - 8)
+    {
+      memset (buffer + padoffset, 0, FCRYPT_MD_BLOCK_SIZE - padoffset);
+      compress (state, buffer, 1);
+      padoffset = 0;
+    }
+  memset (buffer + padoffset, 0, FCRYPT_MD_BLOCK_SIZE - 8 - padoffset);
+
+  /* Append the count and handle the block. */
+  if (big_endian)
+    buff_put_be64 (buffer + FCRYPT_MD_BLOCK_SIZE - 8, count);
+  else
+    buff_put_le64 (buffer + FCRYPT_MD_BLOCK_SIZE - 8, count);
+  compress (state, buffer, 1);
+}
+
+/*
+ * Hashes a whole message into an initialized state. Only the last partial
+ * block is copied, into buffer, which the caller should wipe.
+ */
+static inline void
+fcrypt_md_oneshot (void *state, uint8_t *buffer,
+                   fcrypt_md_compress_fn compress, uint8_t pad,
+                   int big_endian, const void *inputptr, size_t inputlen)
+{
+  const uint8_t *input = inputptr;
+  size_t blocks;
+
+  blocks = inputlen / FCRYPT_MD_BLOCK_SIZE;
+  if (blocks != 0)
+    compress (state, input, blocks);
+  inputlen -= blocks * FCRYPT_MD_BLOCK_SIZE;
+  if (inputlen != 0)
+    memcpy (buffer, input + blocks * FCRYPT_MD_BLOCK_SIZE, inputlen);
+  fcrypt_md_final (state,
+                   ((uint64_t)blocks * FCRYPT_MD_BLOCK_SIZE + inputlen) << 3,
+                   buffer, compress, pad, big_endian);
+}
+
+/* Most messages hashed side by side by the multi-buffer code. */
+#define FCRYPT_MD_MAX_LANES 16
+
+/* Most 32-bit state words of a hash with multi-buffer code. */
+#define FCRYPT_MD_MAX_WORDS 8
+
+/*
+ * Compresses one block for each lane of independent messages. The state is
+ * transposed, so word j of lane l is state[j * lanes + l], which lets the
+ * vector code load each word of all lanes at once.
+ */
+typedef void (*fcrypt_md_compress_lanes_fn) (uint32_t *,
+                                             const uint8_t *const *);
+
+/* Description of a hash with 32-bit state words for fcrypt_md_multi. */
+struct fcrypt_md_multi
+{
+  const uint32_t *iv;                         /* Initial state */
+  unsigned int words;                         /* Words of state */
+  unsigned int digest_words;                  /* Words of digest */
+  int big_endian;                             /* Count and digest order */
+  fcrypt_md_compress_fn compress;             /* One message */
+  unsigned int lanes;                         /* Zero without vector code */
+  fcrypt_md_compress_lanes_fn compress_lanes; /* Lanes messages */
+};
+
+/*
+ * Hashes count independent messages, writing the digest of message i to
+ * digests + i * digest_words * 4. Each lane of the vector code works on its
+ * own message and is refilled with the next one as soon as it finishes, so
+ * messages of unequal length keep every lane busy. Once there are no
+ * messages left to start and half of the lanes are idle, the rest are
+ * finished one at a time.
+ */
+void fcrypt_md_multi (const struct fcrypt_md_multi *, uint8_t *,
+                      const uint8_t *const *, const size_t *, size_t);
+
+#endif /* FCRYPT_MD_H */
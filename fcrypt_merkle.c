@@ -0,0 +1,421 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fcrypt_hash.h"
+#include "fcrypt_memzero.h"
+#include "fcrypt_merkle.h"
+
+/* Messages hashed at once by fcrypt_hash_multi. */
+#define FCRYPT_MERKLE_BATCH 16
+
+/*
+ * Bytes of scratch space for each message of a batch. Leaves of this size
+ * or more are hashed on their own instead of being copied behind the
+ * prefix byte.
+ */
+#define FCRYPT_MERKLE_SLOT 1024
+
+#define FCRYPT_MERKLE_LEAF 0x00
+#define FCRYPT_MERKLE_NODE 0x01
+
+struct fcrypt_merkle
+{
+  const struct fcrypt_hash *hash;
+  size_t digest_size;
+  unsigned int levels;
+  size_t count[FCRYPT_MERKLE_MAX_DEPTH];    /* Nodes in each level */
+  uint8_t *level[FCRYPT_MERKLE_MAX_DEPTH];  /* First node of each level */
+  uint64_t *dirty[FCRYPT_MERKLE_MAX_DEPTH]; /* Nodes to recompute */
+  size_t dirty_lo[FCRYPT_MERKLE_MAX_DEPTH]; /* First word with a bit set */
+  size_t dirty_hi[FCRYPT_MERKLE_MAX_DEPTH]; /* Last word, or below lo */
+  void *ctx;
+  uint8_t *scratch; /* FCRYPT_MERKLE_BATCH slots */
+};
+
+/* A batch of messages in the scratch space and where their digests go. */
+struct fcrypt_merkle_batch
+{
+  size_t count;
+  const uint8_t *inputs[FCRYPT_MERKLE_BATCH];
+  size_t lens[FCRYPT_MERKLE_BATCH];
+  uint8_t *outputs[FCRYPT_MERKLE_BATCH];
+};
+
+static void
+fcrypt_merkle_run (struct fcrypt_merkle *tree,
+                   struct fcrypt_merkle_batch *batch)
+{
+  uint8_t digests[FCRYPT_MERKLE_BATCH * FCRYPT_HASH_MAX_DIGEST_SIZE];
+  size_t i;
+
+  fcrypt_hash_multi (tree->hash, digests, batch->inputs, batch->lens,
+                     batch->count);
+  for (i = 0; i < batch->count; ++i)
+    memcpy (batch->outputs[i], digests + i * tree->digest_size,
+            tree->digest_size);
+  batch->count = 0;
+}
+
+/* Adds a message to the batch, returning its slot, and runs a full one. */
+static uint8_t *
+fcrypt_merkle_add (struct fcrypt_merkle *tree,
+                   struct fcrypt_merkle_batch *batch, size_t len,
+                   uint8_t *output)
+{
+  uint8_t *slot;
+
+  if (batch->count == FCRYPT_MERKLE_BATCH)
+    fcrypt_merkle_run (tree, batch);
+  slot = tree->scratch + batch->count * FCRYPT_MERKLE_SLOT;
+  batch->inputs[batch->count] = slot;
+  batch->lens[batch->count] = len;
+  batch->outputs[batch->count] = output;
+  ++batch->count;
+  return slot;
+}
+
+/*
+ * Hashes a leaf with a context, or with a temporary one if ctx is NULL.
+ * Returns 0, or -1 with errno set to ENOMEM.
+ */
+static int
+fcrypt_merkle_hash_leaf (const struct fcrypt_hash *hash, void *ctx,
+                         uint8_t *digest, const void *leaf, size_t len)
+{
+  static const uint8_t prefix = FCRYPT_MERKLE_LEAF;
+  void *block;
+
+  block = NULL;
+  if (ctx == NULL)
+    {
+      block = malloc (hash->ctx_align + hash->ctx_size);
+      if (block == NULL)
+        {
+          errno = ENOMEM;
+          return -1;
+        }
+      ctx = (uint8_t *)block
+            + (hash->ctx_align - (uintptr_t)block % hash->ctx_align)
+                  % hash->ctx_align;
+    }
+  hash->init (ctx);
+  hash->update (ctx, &prefix, 1);
+  hash->update (ctx, leaf, len);
+  hash->final (digest, ctx);
+  free (block);
+  return 0;
+}
+
+static void
+fcrypt_merkle_mark (struct fcrypt_merkle *tree, unsigned int level,
+                    size_t index)
+{
+  size_t word;
+
+  word = index / 64;
+  tree->dirty[level][word] |= UINT64_C (1) << (index % 64);
+  if (tree->dirty_lo[level] > tree->dirty_hi[level])
+    {
+      tree->dirty_lo[level] = word;
+      tree->dirty_hi[level] = word;
+    }
+  else if (word < tree->dirty_lo[level])
+    tree->dirty_lo[level] = word;
+  else if (word > tree->dirty_hi[level])
+    tree->dirty_hi[level] = word;
+}
+
+/*
+ * Recomputes the dirty nodes of each level from the one below, marking
+ * their parents, so only the paths above changed leaves are hashed.
+ */
+static void
+fcrypt_merkle_flush (struct fcrypt_merkle *tree)
+{
+  struct fcrypt_merkle_batch batch;
+  size_t d, word, index, below;
+  unsigned int level;
+  uint64_t bits;
+  uint8_t *slot, *node;
+
+  d = tree->digest_size;
+  batch.count = 0;
+  for (level = 1; level < tree->levels; ++level)
+    {
+      below = tree->count[level - 1];
+      for (word = tree->dirty_lo[level]; word <= tree->dirty_hi[level];
+           ++word)
+        {
+          bits = tree->dirty[level][word];
+          tree->dirty[level][word] = 0;
+          for (index = word * 64; bits != 0; ++index, bits >>= 1)
+            {
+              if ((bits & 1) == 0)
+                continue;
+              node = tree->level[level - 1] + 2 * index * d;
+              if (2 * index + 1 < below)
+                {
+                  slot = fcrypt_merkle_add (tree, &batch, 1 + 2 * d,
+                                            tree->level[level] + index * d);
+                  slot[0] = FCRYPT_MERKLE_NODE;
+                  memcpy (slot + 1, node, 2 * d);
+                }
+              else
+                memcpy (tree->level[level] + index * d, node, d);
+              if (level + 1 < tree->levels)
+                fcrypt_merkle_mark (tree, level + 1, index / 2);
+            }
+        }
+      tree->dirty_lo[level] = 1;
+      tree->dirty_hi[level] = 0;
+
+      /* The next level reads the digests of this one. */
+      if (batch.count != 0)
+        fcrypt_merkle_run (tree, &batch);
+    }
+}
+
+struct fcrypt_merkle *
+fcrypt_merkle_new (const struct fcrypt_hash *hash, size_t leaves)
+{
+  struct fcrypt_merkle *tree;
+  size_t count, nodes, words, bytes, i;
+  unsigned int levels;
+  uint8_t *base;
+  uint64_t *dirty;
+  uint8_t empty[FCRYPT_HASH_MAX_DIGEST_SIZE];
+
+  if (hash == NULL || leaves == 0)
+    {
+      errno = EINVAL;
+      return NULL;
+    }
+
+  /* Count the nodes and the words of the dirty bitmaps. */
+  nodes = 0;
+  words = 0;
+  levels = 0;
+  for (count = leaves;; count = count / 2 + count % 2)
+    {
+      if (levels == FCRYPT_MERKLE_MAX_DEPTH
+          || count > (SIZE_MAX / 4 - nodes) / hash->digest_size)
+        {
+          errno = ENOMEM;
+          return NULL;
+        }
+      nodes += count;
+      words += count / 64 + 1;
+      ++levels;
+      if (count == 1)
+        break;
+    }
+
+  bytes = sizeof (*tree) + words * sizeof (uint64_t) + hash->ctx_align
+          + hash->ctx_size + FCRYPT_MERKLE_BATCH * FCRYPT_MERKLE_SLOT;
+  if (bytes > SIZE_MAX / 2 - nodes * hash->digest_size)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+  tree = calloc (1, bytes + nodes * hash->digest_size);
+  if (tree == NULL)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+
+  tree->hash = hash;
+  tree->digest_size = hash->digest_size;
+  tree->levels = levels;
+  dirty = (uint64_t *)(tree + 1);
+  base = (uint8_t *)(dirty + words);
+  base += (hash->ctx_align - (uintptr_t)base % hash->ctx_align)
+          % hash->ctx_align;
+  tree->ctx = base;
+  tree->scratch = base + hash->ctx_size;
+  base = tree->scratch + FCRYPT_MERKLE_BATCH * FCRYPT_MERKLE_SLOT;
+  count = leaves;
+  for (i = 0; i < levels; ++i)
+    {
+      tree->count[i] = count;
+      tree->level[i] = base;
+      tree->dirty[i] = dirty;
+      tree->dirty_lo[i] = 1;
+      tree->dirty_hi[i] = 0;
+      base += count * hash->digest_size;
+      dirty += count / 64 + 1;
+      count = count / 2 + count % 2;
+    }
+
+  /* Every leaf is empty, and every node above them needs computing. */
+  fcrypt_merkle_hash_leaf (hash, tree->ctx, empty, "", 0);
+  for (i = 0; i < leaves; ++i)
+    {
+      memcpy (tree->level[0] + i * hash->digest_size, empty,
+              hash->digest_size);
+      if (levels > 1 && i % 2 == 0)
+        fcrypt_merkle_mark (tree, 1, i / 2);
+    }
+  return tree;
+}
+
+void
+fcrypt_merkle_free (struct fcrypt_merkle *tree)
+{
+  if (tree == NULL)
+    return;
+  fcrypt_memzero (tree->ctx, tree->hash->ctx_size);
+  fcrypt_memzero (tree->scratch, FCRYPT_MERKLE_BATCH * FCRYPT_MERKLE_SLOT);
+  free (tree);
+}
+
+int
+fcrypt_merkle_set_leaves (struct fcrypt_merkle *tree, size_t first,
+                          const uint8_t *const *leaves, const size_t *lens,
+                          size_t count)
+{
+  struct fcrypt_merkle_batch batch;
+  uint8_t *slot, *leaf;
+  size_t i;
+
+  if (first > tree->count[0] || count > tree->count[0] - first)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  batch.count = 0;
+  for (i = 0; i < count; ++i)
+    {
+      leaf = tree->level[0] + (first + i) * tree->digest_size;
+      if (lens[i] < FCRYPT_MERKLE_SLOT)
+        {
+          slot = fcrypt_merkle_add (tree, &batch, 1 + lens[i], leaf);
+          slot[0] = FCRYPT_MERKLE_LEAF;
+          memcpy (slot + 1, leaves[i], lens[i]);
+        }
+      else
+        {
+          /* A leaf set twice in one call must keep the later value. */
+          if (batch.count != 0)
+            fcrypt_merkle_run (tree, &batch);
+          fcrypt_merkle_hash_leaf (tree->hash, tree->ctx, leaf, leaves[i],
+                                   lens[i]);
+        }
+      if (tree->levels > 1)
+        fcrypt_merkle_mark (tree, 1, (first + i) / 2);
+    }
+  if (batch.count != 0)
+    fcrypt_merkle_run (tree, &batch);
+  return 0;
+}
+
+void
+fcrypt_merkle_root (struct fcrypt_merkle *tree, uint8_t *root)
+{
+  fcrypt_merkle_flush (tree);
+  memcpy (root, tree->level[tree->levels - 1], tree->digest_size);
+}
+
+int
+fcrypt_merkle_proof (struct fcrypt_merkle *tree, size_t index,
+                     uint8_t *proof, size_t *count)
+{
+  unsigned int level;
+  size_t n;
+
+  if (index >= tree->count[0])
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  fcrypt_merkle_flush (tree);
+  n = 0;
+  for (level = 0; level + 1 < tree->levels; ++level, index /= 2)
+    if ((index ^ 1) < tree->count[level])
+      {
+        memcpy (proof + n * tree->digest_size,
+                tree->level[level] + (index ^ 1) * tree->digest_size,
+                tree->digest_size);
+        ++n;
+      }
+  *count = n;
+  return 0;
+}
+
+int
+fcrypt_merkle_verify (const struct fcrypt_hash *hash, size_t leaves,
+                      size_t index, const void *leaf, size_t len,
+                      const uint8_t *proof, size_t count, const uint8_t *root)
+{
+  uint8_t node[1 + 2 * FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t buffer[FCRYPT_MERKLE_SLOT];
+  size_t d, n;
+
+  if (index >= leaves)
+    return -1;
+  d = hash->digest_size;
+  if (len < FCRYPT_MERKLE_SLOT)
+    {
+      /* Short leaves are common, so avoid allocating a context. */
+      buffer[0] = FCRYPT_MERKLE_LEAF;
+      memcpy (buffer + 1, leaf, len);
+      hash->digest (digest, buffer, 1 + len);
+    }
+  else if (fcrypt_merkle_hash_leaf (hash, NULL, digest, leaf, len) != 0)
+    return -1;
+
+  node[0] = FCRYPT_MERKLE_NODE;
+  for (n = 0; leaves > 1; leaves = leaves / 2 + leaves % 2, index /= 2)
+    {
+      /* The last node of an odd level has no sibling. */
+      if ((index ^ 1) >= leaves)
+        continue;
+      if (n == count)
+        return -1;
+      if (index % 2 == 0)
+        {
+          memcpy (node + 1, digest, d);
+          memcpy (node + 1 + d, proof + n * d, d);
+        }
+      else
+        {
+          memcpy (node + 1, proof + n * d, d);
+          memcpy (node + 1 + d, digest, d);
+        }
+      hash->digest (digest, node, 1 + 2 * d);
+      ++n;
+    }
+  return n == count && memcmp (digest, root, d) == 0 ? 0 : -1;
+}
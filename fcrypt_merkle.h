@@ -0,0 +1,97 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Merkle trees over a fixed number of leaves, with any hash of
+ * fcrypt_hash. A leaf is hashed as H(0x00 || data) and a node as
+ * H(0x01 || left || right). When a level has an odd number of nodes the
+ * last one moves up unchanged, which gives the same tree and root as
+ * RFC 6962, so a SHA-256 tree matches a Certificate Transparency log.
+ *
+ * The digests of each level are kept one after another in a single array,
+ * leaves first and the root last. Changing leaves only marks their parents
+ * as dirty, and the next call that needs the root recomputes the dirty
+ * nodes level by level, so a batch of updates rehashes each shared node
+ * once. Leaves and nodes are hashed in groups through fcrypt_hash_multi,
+ * which uses the multi-buffer code of MD5, SHA-1 and SHA-256.
+ */
+
+#ifndef FCRYPT_MERKLE_H
+#define FCRYPT_MERKLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_hash.h"
+
+/* Most digests in an inclusion proof. */
+#define FCRYPT_MERKLE_MAX_DEPTH 64
+
+struct fcrypt_merkle;
+
+/*
+ * Creates a tree with the given number of leaves, which all start as the
+ * hash of empty data. Returns NULL with errno set to EINVAL if there are no
+ * leaves, or ENOMEM if there is not enough memory.
+ */
+struct fcrypt_merkle *fcrypt_merkle_new (const struct fcrypt_hash *, size_t);
+
+/* Frees a tree. */
+void fcrypt_merkle_free (struct fcrypt_merkle *);
+
+/*
+ * Sets count leaves starting at the given index, from arrays of pointers
+ * and lengths. Returns 0, or -1 with errno set to EINVAL if the leaves are
+ * past the end of the tree.
+ */
+int fcrypt_merkle_set_leaves (struct fcrypt_merkle *, size_t,
+                              const uint8_t *const *, const size_t *, size_t);
+
+/* Writes the root digest, after recomputing the dirty nodes. */
+void fcrypt_merkle_root (struct fcrypt_merkle *, uint8_t *);
+
+/*
+ * Writes the inclusion proof of the leaf with the given index: the digest
+ * of the sibling at each level from the leaves up, skipping levels where
+ * the node has none. Sets *count to the number of digests, which is at
+ * most FCRYPT_MERKLE_MAX_DEPTH. Returns 0, or -1 with errno set to EINVAL
+ * if the index is past the end of the tree.
+ */
+int fcrypt_merkle_proof (struct fcrypt_merkle *, size_t, uint8_t *,
+                         size_t *);
+
+/*
+ * Checks an inclusion proof without a tree. The arguments are the hash,
+ * the number of leaves in the tree, the index of the leaf, the leaf and
+ * its length, the proof and its number of digests, and the root. Returns 0
+ * if the proof leads from the leaf to the root, or -1 otherwise, with
+ * errno set to ENOMEM if memory for hashing a long leaf can't be
+ * allocated.
+ */
+int fcrypt_merkle_verify (const struct fcrypt_hash *, size_t, size_t,
+                          const void *, size_t, const uint8_t *, size_t,
+                          const uint8_t *);
+
+#endif /* FCRYPT_MERKLE_H */
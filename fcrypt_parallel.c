@@ -0,0 +1,79 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_parallel.h"
+#include "fcrypt_pool.h"
+
+struct fcrypt_parallel_job
+{
+  fcrypt_range_func *func;
+  void *arg;
+  unsigned int pieces;
+  size_t piece;
+  size_t len;
+};
+
+static void
+fcrypt_parallel_task (void *ptr, size_t index)
+{
+  struct fcrypt_parallel_job *job = ptr;
+  uint64_t offset;
+
+  offset = (uint64_t)job->piece * index;
+  job->func (job->arg, (unsigned int)index, offset,
+             index == job->pieces - 1 ? job->len - (size_t)offset
+                                      : job->piece);
+}
+
+unsigned int
+fcrypt_parallel_range (fcrypt_range_func *func, void *arg, size_t len,
+                       size_t align, unsigned int threads)
+{
+  struct fcrypt_parallel_job job;
+
+  if (threads > FCRYPT_PARALLEL_MAX_THREADS)
+    threads = FCRYPT_PARALLEL_MAX_THREADS;
+  if (threads > len / FCRYPT_PARALLEL_MIN_SIZE)
+    threads = (unsigned int)(len / FCRYPT_PARALLEL_MIN_SIZE);
+  if (threads <= 1)
+    {
+      func (arg, 0, 0, len);
+      return 1;
+    }
+
+  job.func = func;
+  job.arg = arg;
+  job.pieces = threads;
+  job.piece = len / threads;
+  job.piece -= job.piece % align;
+  job.len = len;
+  fcrypt_pool_run (fcrypt_parallel_task, &job, threads, threads);
+  return threads;
+}
@@ -0,0 +1,54 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef FCRYPT_PARALLEL_H
+#define FCRYPT_PARALLEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Smallest piece of a range worth giving to its own thread. */
+#define FCRYPT_PARALLEL_MIN_SIZE (64 * 1024)
+
+/* Most threads a range is split across. */
+#define FCRYPT_PARALLEL_MAX_THREADS 64
+
+/*
+ * Processes len bytes starting offset bytes into the range. The pieces are
+ * numbered from zero in the order they appear in the range.
+ */
+typedef void fcrypt_range_func (void *, unsigned int, uint64_t, size_t);
+
+/*
+ * Splits a range of len bytes into at most threads pieces whose lengths are
+ * multiples of align, except for the last, and calls func on each from the
+ * thread pool in fcrypt_pool.h. Without POSIX threads, or if no thread can
+ * be started, the pieces run on the calling thread. Returns the number of
+ * pieces, at most threads and at least one.
+ */
+unsigned int fcrypt_parallel_range (fcrypt_range_func *, void *, size_t,
+                                    size_t, unsigned int);
+
+#endif /* FCRYPT_PARALLEL_H */
@@ -0,0 +1,221 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#include "fcrypt_pool.h"
+
+#if defined(HAVE_PTHREAD)
+/*
+ * A batch lives on the stack of the thread that called fcrypt_pool_run. It
+ * is linked into the list of batches until it finishes, and every field is
+ * protected by fcrypt_pool_lock.
+ */
+struct fcrypt_pool_batch
+{
+  fcrypt_task_func *func;
+  void *arg;
+  unsigned int ranges;                   /* Threads that may join */
+  unsigned int joined;                   /* Threads joined, with the caller */
+  size_t remaining;                      /* Tasks not finished yet */
+  size_t next[FCRYPT_POOL_MAX_THREADS];  /* Next task of each range */
+  size_t end[FCRYPT_POOL_MAX_THREADS];   /* End of each range */
+  struct fcrypt_pool_batch *link;
+};
+
+static pthread_mutex_t fcrypt_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Signalled when a batch is added, and when one finishes. */
+static pthread_cond_t fcrypt_pool_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t fcrypt_pool_done = PTHREAD_COND_INITIALIZER;
+
+static struct fcrypt_pool_batch *fcrypt_pool_batches = NULL;
+static unsigned int fcrypt_pool_workers = 0;
+
+/* Returns the range with the most tasks left, or ranges if all are empty. */
+static unsigned int
+fcrypt_pool_largest (const struct fcrypt_pool_batch *batch)
+{
+  unsigned int i, largest;
+  size_t most;
+
+  largest = batch->ranges;
+  most = 0;
+  for (i = 0; i < batch->ranges; ++i)
+    if (batch->end[i] - batch->next[i] > most)
+      {
+        most = batch->end[i] - batch->next[i];
+        largest = i;
+      }
+  return largest;
+}
+
+/*
+ * Takes the next task of the given range. An empty range first steals the
+ * back half of the largest one. Returns zero if no tasks are left to start.
+ */
+static int
+fcrypt_pool_take (struct fcrypt_pool_batch *batch, unsigned int range,
+                  size_t *task)
+{
+  unsigned int victim;
+  size_t mid;
+
+  if (batch->next[range] == batch->end[range])
+    {
+      victim = fcrypt_pool_largest (batch);
+      if (victim == batch->ranges)
+        return 0;
+      mid = batch->next[victim]
+            + (batch->end[victim] - batch->next[victim]) / 2;
+      batch->next[range] = mid;
+      batch->end[range] = batch->end[victim];
+      batch->end[victim] = mid;
+    }
+  *task = batch->next[range]++;
+  return 1;
+}
+
+/*
+ * Runs tasks of the batch until there are none left to start. Called with
+ * the lock held, which is dropped while each task runs. The batch must not
+ * be touched afterwards, since its caller may return as soon as the last
+ * task is finished.
+ */
+static void
+fcrypt_pool_work_on (struct fcrypt_pool_batch *batch, unsigned int range)
+{
+  size_t task;
+
+  while (fcrypt_pool_take (batch, range, &task))
+    {
+      pthread_mutex_unlock (&fcrypt_pool_lock);
+      batch->func (batch->arg, task);
+      pthread_mutex_lock (&fcrypt_pool_lock);
+      if (--batch->remaining == 0)
+        pthread_cond_broadcast (&fcrypt_pool_done);
+    }
+}
+
+static void *
+fcrypt_pool_worker (void *unused)
+{
+  struct fcrypt_pool_batch *batch;
+
+  (void)unused;
+  pthread_mutex_lock (&fcrypt_pool_lock);
+  for (;;)
+    {
+      for (batch = fcrypt_pool_batches; batch != NULL; batch = batch->link)
+        if (batch->joined < batch->ranges
+            && fcrypt_pool_largest (batch) != batch->ranges)
+          break;
+      if (batch == NULL)
+        pthread_cond_wait (&fcrypt_pool_work, &fcrypt_pool_lock);
+      else
+        fcrypt_pool_work_on (batch, batch->joined++);
+    }
+  return NULL;
+}
+
+/* Starts workers until there are count of them. Called with the lock held. */
+static void
+fcrypt_pool_spawn (unsigned int count)
+{
+  pthread_attr_t attr;
+  pthread_t thread;
+
+  if (fcrypt_pool_workers >= count || pthread_attr_init (&attr) != 0)
+    return;
+  pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
+  while (fcrypt_pool_workers < count)
+    {
+      if (pthread_create (&thread, &attr, fcrypt_pool_worker, NULL) != 0)
+        break;
+      ++fcrypt_pool_workers;
+    }
+  pthread_attr_destroy (&attr);
+}
+#endif
+
+void
+fcrypt_pool_run (fcrypt_task_func *func, void *arg, size_t count,
+                 unsigned int threads)
+{
+#if defined(HAVE_PTHREAD)
+  struct fcrypt_pool_batch batch;
+  struct fcrypt_pool_batch **prev;
+#endif
+  size_t i;
+
+  if (threads > FCRYPT_POOL_MAX_THREADS)
+    threads = FCRYPT_POOL_MAX_THREADS;
+  if (threads > count)
+    threads = (unsigned int)count;
+
+#if defined(HAVE_PTHREAD)
+  if (threads > 1)
+    {
+      batch.func = func;
+      batch.arg = arg;
+      batch.ranges = threads;
+      batch.joined = 1;
+      batch.remaining = count;
+      for (i = 0; i < threads; ++i)
+        {
+          batch.next[i] = count * i / threads;
+          batch.end[i] = count * (i + 1) / threads;
+        }
+
+      pthread_mutex_lock (&fcrypt_pool_lock);
+      fcrypt_pool_spawn (threads - 1);
+      batch.link = fcrypt_pool_batches;
+      fcrypt_pool_batches = &batch;
+      pthread_cond_broadcast (&fcrypt_pool_work);
+
+      /* Tasks still running on the workers are waited for. */
+      fcrypt_pool_work_on (&batch, 0);
+      while (batch.remaining != 0)
+        pthread_cond_wait (&fcrypt_pool_done, &fcrypt_pool_lock);
+
+      for (prev = &fcrypt_pool_batches; *prev != &batch;
+           prev = &(*prev)->link)
+        ;
+      *prev = batch.link;
+      pthread_mutex_unlock (&fcrypt_pool_lock);
+      return;
+    }
+#endif
+
+  for (i = 0; i < count; ++i)
+    func (arg, i);
+}
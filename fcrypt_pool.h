@@ -0,0 +1,55 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * A pool of worker threads shared by every parallel function in the
+ * library, so that the threads are created once rather than on each call.
+ * The work of a call is a batch of numbered tasks. Each thread working on a
+ * batch starts with its own contiguous range of tasks and, once that runs
+ * out, steals the back half of the largest range left, which keeps all the
+ * threads busy when the tasks take unequal time. The caller works on its
+ * own batch too, so a task may itself call fcrypt_pool_run.
+ */
+
+#ifndef FCRYPT_POOL_H
+#define FCRYPT_POOL_H
+
+#include <stddef.h>
+
+/* Most threads, including the caller, that work on one batch. */
+#define FCRYPT_POOL_MAX_THREADS 64
+
+/* Runs task number i of a batch. */
+typedef void fcrypt_task_func (void *, size_t);
+
+/*
+ * Runs func (arg, i) for every i below count on at most threads threads,
+ * including the calling thread, and returns once all of them are done.
+ * Without POSIX threads, or if no worker can be created, the tasks run on
+ * the calling thread in order.
+ */
+void fcrypt_pool_run (fcrypt_task_func *, void *, size_t, unsigned int);
+
+#endif /* FCRYPT_POOL_H */
@@ -0,0 +1,121 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Macros used by the adapters of fcrypt_hash.c and fcrypt_cipher.c to
+ * update the counters of fcrypt_instrument.h and fire its events. Without
+ * FCRYPT_INSTRUMENT they expand to nothing.
+ */
+
+#ifndef FCRYPT_PROBE_H
+#define FCRYPT_PROBE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_instrument.h"
+
+#if defined(FCRYPT_INSTRUMENT)
+
+#if defined(HAVE_SYS_SDT_H)
+#include <sys/sdt.h>
+#define FCRYPT_PROBE_USDT(probe, name, len)                                   \
+  DTRACE_PROBE2 (libfcrypt, probe, name, len)
+#else
+#define FCRYPT_PROBE_USDT(probe, name, len) ((void)0)
+#endif
+
+#if defined(__GNUC__)
+#define FCRYPT_PROBE_ADD(counter, n)                                          \
+  ((void)__atomic_fetch_add (&(counter), (n), __ATOMIC_RELAXED))
+#define FCRYPT_PROBE_HOOK()                                                   \
+  __atomic_load_n (&fcrypt_probe_hook, __ATOMIC_RELAXED)
+#else
+#define FCRYPT_PROBE_ADD(counter, n) ((void)((counter) += (n)))
+#define FCRYPT_PROBE_HOOK() fcrypt_probe_hook
+#endif
+
+/* The hook of fcrypt_instrument_set_hook, or NULL. */
+extern fcrypt_hook_func *fcrypt_probe_hook;
+
+#define FCRYPT_PROBE_EVENT(probe, event, name, len)                           \
+  do                                                                          \
+    {                                                                         \
+      fcrypt_hook_func *fcrypt_probe_fn_ = FCRYPT_PROBE_HOOK ();              \
+                                                                              \
+      FCRYPT_PROBE_USDT (probe, name, len);                                   \
+      if (fcrypt_probe_fn_ != NULL)                                           \
+        fcrypt_probe_fn_ (event, name, len);                                  \
+    }                                                                         \
+  while (0)
+
+/* Brackets a setup call, such as hash init or cipher set_key. */
+#define FCRYPT_PROBE_SETUP_BEGIN(counters, name)                              \
+  do                                                                          \
+    {                                                                         \
+      FCRYPT_PROBE_ADD ((counters).setup_calls, 1);                           \
+      FCRYPT_PROBE_EVENT (setup__begin, FCRYPT_EVENT_SETUP_BEGIN, name,       \
+                          (size_t)0);                                         \
+    }                                                                         \
+  while (0)
+#define FCRYPT_PROBE_SETUP_END(counters, name)                                \
+  FCRYPT_PROBE_EVENT (setup__end, FCRYPT_EVENT_SETUP_END, name, (size_t)0)
+
+/* Brackets a bulk call on len bytes, such as hash update or a mode. */
+#define FCRYPT_PROBE_BULK_BEGIN(counters, name, len)                          \
+  do                                                                          \
+    {                                                                         \
+      FCRYPT_PROBE_ADD ((counters).bulk_calls, 1);                            \
+      FCRYPT_PROBE_ADD ((counters).bulk_bytes, (uint64_t)(len));              \
+      FCRYPT_PROBE_EVENT (bulk__begin, FCRYPT_EVENT_BULK_BEGIN, name,         \
+                          (size_t)(len));                                     \
+    }                                                                         \
+  while (0)
+#define FCRYPT_PROBE_BULK_END(counters, name, len)                            \
+  FCRYPT_PROBE_EVENT (bulk__end, FCRYPT_EVENT_BULK_END, name, (size_t)(len))
+
+/* Counters for one table, defined next to its adapters. */
+#define FCRYPT_PROBE_COUNTERS(var) static struct fcrypt_counters var;
+
+/* Reads and clears counters with atomic loads and stores. */
+void fcrypt_probe_read (const struct fcrypt_counters *,
+                        struct fcrypt_counters *);
+void fcrypt_probe_clear (struct fcrypt_counters *);
+
+/* Clear the counters of every table in fcrypt_hash.c and fcrypt_cipher.c. */
+void fcrypt_hash_clear_counters (void);
+void fcrypt_cipher_clear_counters (void);
+
+#else /* !FCRYPT_INSTRUMENT */
+
+#define FCRYPT_PROBE_SETUP_BEGIN(counters, name) ((void)0)
+#define FCRYPT_PROBE_SETUP_END(counters, name) ((void)0)
+#define FCRYPT_PROBE_BULK_BEGIN(counters, name, len) ((void)0)
+#define FCRYPT_PROBE_BULK_END(counters, name, len) ((void)0)
+#define FCRYPT_PROBE_COUNTERS(var)
+
+#endif /* FCRYPT_INSTRUMENT */
+
+#endif /* FCRYPT_PROBE_H */
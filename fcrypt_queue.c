@@ -0,0 +1,567 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#include "fcrypt_align.h"
+#include "fcrypt_cipher.h"
+#include "fcrypt_hash.h"
+#include "fcrypt_parallel.h"
+#include "fcrypt_pool.h"
+#include "fcrypt_queue.h"
+#include "fcrypt_wipe.h"
+
+/* Scratch memory of one thread running jobs. */
+struct fcrypt_queue_worker
+{
+  struct fcrypt_queue *queue;
+  uint8_t *ctx; /* Room for the contexts of any group of jobs */
+  uint8_t digests[FCRYPT_QUEUE_BATCH * FCRYPT_HASH_MAX_DIGEST_SIZE];
+};
+
+#if defined(HAVE_PTHREAD)
+/*
+ * A slot of the ring holds a job once seq is one more than the position of
+ * the slot, and is free for the position seq. This is the bounded queue of
+ * Dmitry Vyukov, which takes no lock in either direction.
+ */
+struct fcrypt_queue_slot
+{
+  size_t seq;
+  struct fcrypt_job *job;
+};
+#endif
+
+struct fcrypt_queue
+{
+#if defined(HAVE_PTHREAD)
+  /* Submitters and workers each update their end of the ring. */
+  size_t head; /* Next position to fill */
+  uint8_t pad1[FCRYPT_CACHE_LINE_SIZE];
+  size_t tail; /* Next position to take */
+  uint8_t pad2[FCRYPT_CACHE_LINE_SIZE];
+  size_t pending;  /* Jobs submitted and not done */
+  size_t sleepers; /* Workers waiting for work */
+  struct fcrypt_queue_slot *slots;
+  size_t mask; /* Slots minus one */
+  pthread_mutex_t lock;
+  pthread_cond_t work; /* Signalled when a job is added */
+  pthread_cond_t idle; /* Signalled when pending drops to zero */
+  int stopping;
+  unsigned int threads;
+  pthread_t tids[FCRYPT_POOL_MAX_THREADS];
+#endif
+  size_t ctx_size;  /* Bytes of context memory of each worker */
+  size_t ctx_align; /* Largest ctx_align, at least a cache line */
+  unsigned int workers;
+  struct fcrypt_queue_worker *worker; /* One for each thread */
+};
+
+/* Returns the context memory of a worker, aligned for any cipher. */
+static void *
+fcrypt_queue_ctx (const struct fcrypt_queue_worker *worker)
+{
+  size_t align = worker->queue->ctx_align;
+
+  return worker->ctx + (align - (uintptr_t)worker->ctx % align) % align;
+}
+
+/* Adds blocks to a big-endian counter of len bytes. */
+static void
+fcrypt_queue_ctr_add (uint8_t *ctr, size_t len, uint64_t blocks)
+{
+  uint64_t carry = blocks;
+
+  while (len-- > 0 && carry != 0)
+    {
+      carry += ctr[len];
+      ctr[len] = (uint8_t)carry;
+      carry >>= 8;
+    }
+}
+
+struct fcrypt_queue_split
+{
+  const struct fcrypt_job *job;
+  void *ctx;
+};
+
+static void
+fcrypt_queue_split_piece (void *arg, unsigned int index, uint64_t offset,
+                          size_t len)
+{
+  const struct fcrypt_queue_split *split = arg;
+  const struct fcrypt_job *job = split->job;
+  const struct fcrypt_cipher *cipher = job->cipher;
+  uint8_t ctr[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+
+  (void)index;
+  memcpy (ctr, job->iv, cipher->block_size);
+  fcrypt_queue_ctr_add (ctr, cipher->block_size, offset / cipher->block_size);
+  cipher->ctr_crypt (split->ctx, ctr, (const uint8_t *)job->input + offset,
+                     job->output + offset, len);
+}
+
+/* Runs a CTR mode job, on several threads if it is large. */
+static void
+fcrypt_queue_run_cipher (struct fcrypt_queue_worker *worker,
+                         struct fcrypt_job *job, unsigned int threads)
+{
+  const struct fcrypt_cipher *cipher = job->cipher;
+  struct fcrypt_queue_split split;
+  uint8_t ctr[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+  void *ctx = fcrypt_queue_ctx (worker);
+
+  cipher->set_encrypt_key (ctx, job->key);
+  if (job->len >= FCRYPT_QUEUE_SPLIT_SIZE && threads > 1)
+    {
+      split.job = job;
+      split.ctx = ctx;
+      fcrypt_parallel_range (fcrypt_queue_split_piece, &split, job->len,
+                             cipher->block_size, threads);
+    }
+  else
+    {
+      memcpy (ctr, job->iv, cipher->block_size);
+      cipher->ctr_crypt (ctx, ctr, job->input, job->output, job->len);
+    }
+  fcrypt_wipe (ctx, cipher->ctx_size);
+}
+
+/*
+ * Runs short CTR mode jobs of one cipher, setting all of their keys with a
+ * single set_encrypt_key_batch call, and calls the done functions of all
+ * but the first.
+ */
+static void
+fcrypt_queue_run_ctr_group (struct fcrypt_queue_worker *worker,
+                            struct fcrypt_job **group, size_t n)
+{
+  const struct fcrypt_cipher *cipher = group[0]->cipher;
+  const uint8_t *keys[FCRYPT_QUEUE_BATCH];
+  uint8_t ctr[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+  uint8_t *ctxs = fcrypt_queue_ctx (worker);
+  size_t j;
+
+  for (j = 0; j < n; ++j)
+    keys[j] = group[j]->key;
+  cipher->set_encrypt_key_batch (ctxs, keys, n);
+  for (j = 0; j < n; ++j)
+    {
+      memcpy (ctr, group[j]->iv, cipher->block_size);
+      cipher->ctr_crypt (ctxs + j * cipher->ctx_size, ctr, group[j]->input,
+                         group[j]->output, group[j]->len);
+    }
+  fcrypt_wipe (ctxs, n * cipher->ctx_size);
+  for (j = 1; j < n; ++j)
+    group[j]->done (group[j]);
+}
+
+/*
+ * Moves the short jobs from index i on with the same hash or cipher as job i
+ * into group, and returns how many there are. Job i stays in jobs.
+ */
+static size_t
+fcrypt_queue_group (struct fcrypt_job **jobs, size_t i, size_t count,
+                    struct fcrypt_job **group)
+{
+  const struct fcrypt_hash *hash = jobs[i]->hash;
+  const struct fcrypt_cipher *cipher = jobs[i]->cipher;
+  size_t j, n;
+
+  n = 0;
+  for (j = i; j < count; ++j)
+    if (jobs[j] != NULL && jobs[j]->hash == hash && jobs[j]->cipher == cipher
+        && jobs[j]->len <= FCRYPT_QUEUE_SMALL_SIZE)
+      {
+        group[n++] = jobs[j];
+        if (j != i)
+          jobs[j] = NULL;
+      }
+  return n;
+}
+
+/*
+ * Runs a batch of jobs and calls their done functions. Short messages of
+ * one hash are collected into a single fcrypt_hash_multi call, and short
+ * CTR mode jobs of one cipher into fcrypt_queue_run_ctr_group if it can set
+ * their keys together.
+ */
+static void
+fcrypt_queue_run (struct fcrypt_queue_worker *worker, struct fcrypt_job **jobs,
+                  size_t count, unsigned int threads)
+{
+  const uint8_t *inputs[FCRYPT_QUEUE_BATCH];
+  size_t lens[FCRYPT_QUEUE_BATCH];
+  struct fcrypt_job *group[FCRYPT_QUEUE_BATCH];
+  const struct fcrypt_hash *hash;
+  size_t i, j, n;
+
+  for (i = 0; i < count; ++i)
+    {
+      if (jobs[i] == NULL)
+        continue;
+      hash = jobs[i]->hash;
+      if (hash == NULL)
+        {
+          if (jobs[i]->len > FCRYPT_QUEUE_SMALL_SIZE
+              || jobs[i]->cipher->set_encrypt_key_batch == NULL)
+            fcrypt_queue_run_cipher (worker, jobs[i], threads);
+          else
+            {
+              n = fcrypt_queue_group (jobs, i, count, group);
+              fcrypt_queue_run_ctr_group (worker, group, n);
+            }
+        }
+      else if (jobs[i]->len > FCRYPT_QUEUE_SMALL_SIZE)
+        hash->digest (jobs[i]->output, jobs[i]->input, jobs[i]->len);
+      else
+        {
+          n = fcrypt_queue_group (jobs, i, count, group);
+          for (j = 0; j < n; ++j)
+            {
+              inputs[j] = group[j]->input;
+              lens[j] = group[j]->len;
+            }
+          fcrypt_hash_multi (hash, worker->digests, inputs, lens, n);
+          for (j = 0; j < n; ++j)
+            {
+              memcpy (group[j]->output,
+                      worker->digests + j * hash->digest_size,
+                      hash->digest_size);
+              if (j != 0)
+                group[j]->done (group[j]);
+            }
+          fcrypt_wipe (worker->digests, n * hash->digest_size);
+        }
+      jobs[i]->done (jobs[i]);
+    }
+}
+
+#if defined(HAVE_PTHREAD)
+
+static int
+fcrypt_queue_push (struct fcrypt_queue *queue, struct fcrypt_job *job)
+{
+  struct fcrypt_queue_slot *slot;
+  size_t pos, seq;
+
+  pos = __atomic_load_n (&queue->head, __ATOMIC_RELAXED);
+  for (;;)
+    {
+      slot = &queue->slots[pos & queue->mask];
+      seq = __atomic_load_n (&slot->seq, __ATOMIC_ACQUIRE);
+      if (seq == pos)
+        {
+          if (__atomic_compare_exchange_n (&queue->head, &pos, pos + 1, 1,
+                                           __ATOMIC_RELAXED,
+                                           __ATOMIC_RELAXED))
+            break;
+        }
+      else if ((intptr_t)(seq - pos) < 0)
+        return -1;
+      else
+        pos = __atomic_load_n (&queue->head, __ATOMIC_RELAXED);
+    }
+  slot->job = job;
+  /* Sequentially consistent, to order it before reading sleepers. */
+  __atomic_store_n (&slot->seq, pos + 1, __ATOMIC_SEQ_CST);
+  return 0;
+}
+
+static struct fcrypt_job *
+fcrypt_queue_pop (struct fcrypt_queue *queue)
+{
+  struct fcrypt_queue_slot *slot;
+  struct fcrypt_job *job;
+  size_t pos, seq;
+
+  pos = __atomic_load_n (&queue->tail, __ATOMIC_RELAXED);
+  for (;;)
+    {
+      slot = &queue->slots[pos & queue->mask];
+      seq = __atomic_load_n (&slot->seq, __ATOMIC_SEQ_CST);
+      if (seq == pos + 1)
+        {
+          if (__atomic_compare_exchange_n (&queue->tail, &pos, pos + 1, 1,
+                                           __ATOMIC_RELAXED,
+                                           __ATOMIC_RELAXED))
+            break;
+        }
+      else if ((intptr_t)(seq - (pos + 1)) < 0)
+        return NULL;
+      else
+        pos = __atomic_load_n (&queue->tail, __ATOMIC_RELAXED);
+    }
+  job = slot->job;
+  __atomic_store_n (&slot->seq, pos + queue->mask + 1, __ATOMIC_RELEASE);
+  return job;
+}
+
+/* Counts count jobs as done, waking fcrypt_queue_wait after the last. */
+static void
+fcrypt_queue_finish (struct fcrypt_queue *queue, size_t count)
+{
+  if (__atomic_sub_fetch (&queue->pending, count, __ATOMIC_SEQ_CST) == 0)
+    {
+      pthread_mutex_lock (&queue->lock);
+      pthread_cond_broadcast (&queue->idle);
+      pthread_mutex_unlock (&queue->lock);
+    }
+}
+
+static void *
+fcrypt_queue_thread (void *arg)
+{
+  struct fcrypt_queue_worker *worker = arg;
+  struct fcrypt_queue *queue = worker->queue;
+  struct fcrypt_job *jobs[FCRYPT_QUEUE_BATCH];
+  struct fcrypt_job *job;
+  size_t count;
+
+  for (;;)
+    {
+      count = 0;
+      while (count < FCRYPT_QUEUE_BATCH
+             && (jobs[count] = fcrypt_queue_pop (queue)) != NULL)
+        ++count;
+      if (count > 0)
+        {
+          fcrypt_queue_run (worker, jobs, count, queue->threads);
+          fcrypt_queue_finish (queue, count);
+          continue;
+        }
+
+      /*
+       * Announce the wait before looking at the ring again, so that a
+       * submitter either sees a sleeper and signals or its job is found.
+       */
+      pthread_mutex_lock (&queue->lock);
+      __atomic_add_fetch (&queue->sleepers, 1, __ATOMIC_SEQ_CST);
+      job = fcrypt_queue_pop (queue);
+      if (job == NULL && !queue->stopping)
+        pthread_cond_wait (&queue->work, &queue->lock);
+      __atomic_sub_fetch (&queue->sleepers, 1, __ATOMIC_SEQ_CST);
+      if (job == NULL && queue->stopping)
+        {
+          pthread_mutex_unlock (&queue->lock);
+          break;
+        }
+      pthread_mutex_unlock (&queue->lock);
+      if (job != NULL)
+        {
+          fcrypt_queue_run (worker, &job, 1, queue->threads);
+          fcrypt_queue_finish (queue, 1);
+        }
+    }
+  return NULL;
+}
+
+#endif
+
+/* Frees the workers and the queue, once no thread uses them. */
+static void
+fcrypt_queue_release (struct fcrypt_queue *queue)
+{
+  unsigned int i;
+
+  for (i = 0; i < queue->workers; ++i)
+    free (queue->worker[i].ctx);
+  free (queue->worker);
+#if defined(HAVE_PTHREAD)
+  free (queue->slots);
+#endif
+  free (queue);
+}
+
+struct fcrypt_queue *
+fcrypt_queue_new (unsigned int threads, size_t capacity)
+{
+  const struct fcrypt_cipher *cipher;
+  struct fcrypt_queue *queue;
+  size_t i, size;
+#if defined(HAVE_PTHREAD)
+  size_t slots;
+#endif
+
+  if (threads == 0 || threads > FCRYPT_POOL_MAX_THREADS || capacity == 0
+      || capacity > SIZE_MAX / 4)
+    {
+      errno = EINVAL;
+      return NULL;
+    }
+  queue = calloc (1, sizeof (*queue));
+  if (queue == NULL)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+
+  /*
+   * The scratch memory is allocated up front, so that jobs never fail. It
+   * holds the context of any cipher, or of a whole batch of jobs for the
+   * ciphers that set keys in batches.
+   */
+  queue->ctx_align = FCRYPT_CACHE_LINE_SIZE;
+  for (i = 0; (cipher = fcrypt_cipher_get (i)) != NULL; ++i)
+    {
+      size = cipher->ctx_size;
+      if (cipher->set_encrypt_key_batch != NULL)
+        size *= FCRYPT_QUEUE_BATCH;
+      if (size > queue->ctx_size)
+        queue->ctx_size = size;
+      if (cipher->ctx_align > queue->ctx_align)
+        queue->ctx_align = cipher->ctx_align;
+    }
+  queue->worker = calloc (threads, sizeof (*queue->worker));
+  if (queue->worker == NULL)
+    {
+      fcrypt_queue_release (queue);
+      errno = ENOMEM;
+      return NULL;
+    }
+  for (; queue->workers < threads; ++queue->workers)
+    {
+      queue->worker[queue->workers].queue = queue;
+      queue->worker[queue->workers].ctx
+          = malloc (queue->ctx_size + queue->ctx_align);
+      if (queue->worker[queue->workers].ctx == NULL)
+        {
+          fcrypt_queue_release (queue);
+          errno = ENOMEM;
+          return NULL;
+        }
+    }
+
+#if defined(HAVE_PTHREAD)
+  for (slots = 1; slots < capacity; slots *= 2)
+    ;
+  queue->slots = malloc (slots * sizeof (*queue->slots));
+  if (queue->slots == NULL)
+    {
+      fcrypt_queue_release (queue);
+      errno = ENOMEM;
+      return NULL;
+    }
+  for (i = 0; i < slots; ++i)
+    queue->slots[i].seq = i;
+  queue->mask = slots - 1;
+  pthread_mutex_init (&queue->lock, NULL);
+  pthread_cond_init (&queue->work, NULL);
+  pthread_cond_init (&queue->idle, NULL);
+  for (i = 0; i < threads; ++i)
+    if (pthread_create (&queue->tids[i], NULL, fcrypt_queue_thread,
+                        &queue->worker[i])
+        != 0)
+      break;
+  queue->threads = (unsigned int)i;
+  if (queue->threads == 0)
+    {
+      fcrypt_queue_free (queue);
+      errno = EAGAIN;
+      return NULL;
+    }
+#endif
+  return queue;
+}
+
+int
+fcrypt_queue_submit (struct fcrypt_queue *queue, struct fcrypt_job *job)
+{
+  if (job == NULL || job->done == NULL
+      || (job->hash == NULL) == (job->cipher == NULL)
+      || (job->cipher != NULL && job->key == NULL)
+      || (job->input == NULL && job->len != 0) || job->output == NULL)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+#if defined(HAVE_PTHREAD)
+  __atomic_add_fetch (&queue->pending, 1, __ATOMIC_SEQ_CST);
+  if (fcrypt_queue_push (queue, job) != 0)
+    {
+      fcrypt_queue_finish (queue, 1);
+      errno = EAGAIN;
+      return -1;
+    }
+  if (__atomic_load_n (&queue->sleepers, __ATOMIC_SEQ_CST) != 0)
+    {
+      pthread_mutex_lock (&queue->lock);
+      pthread_cond_signal (&queue->work);
+      pthread_mutex_unlock (&queue->lock);
+    }
+#else
+  fcrypt_queue_run (&queue->worker[0], &job, 1, 1);
+#endif
+  return 0;
+}
+
+void
+fcrypt_queue_wait (struct fcrypt_queue *queue)
+{
+#if defined(HAVE_PTHREAD)
+  pthread_mutex_lock (&queue->lock);
+  while (__atomic_load_n (&queue->pending, __ATOMIC_SEQ_CST) != 0)
+    pthread_cond_wait (&queue->idle, &queue->lock);
+  pthread_mutex_unlock (&queue->lock);
+#else
+  (void)queue;
+#endif
+}
+
+void
+fcrypt_queue_free (struct fcrypt_queue *queue)
+{
+#if defined(HAVE_PTHREAD)
+  unsigned int i;
+#endif
+
+  if (queue == NULL)
+    return;
+#if defined(HAVE_PTHREAD)
+  fcrypt_queue_wait (queue);
+  pthread_mutex_lock (&queue->lock);
+  queue->stopping = 1;
+  pthread_cond_broadcast (&queue->work);
+  pthread_mutex_unlock (&queue->lock);
+  for (i = 0; i < queue->threads; ++i)
+    pthread_join (queue->tids[i], NULL);
+  pthread_cond_destroy (&queue->idle);
+  pthread_cond_destroy (&queue->work);
+  pthread_mutex_destroy (&queue->lock);
+#endif
+  fcrypt_queue_release (queue);
+}
@@ -0,0 +1,102 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Asynchronous hashing and encryption on worker threads, for programs such
+ * as event loops that must not block on large inputs. Jobs are submitted to
+ * a bounded ring without taking a lock, and each worker takes up to
+ * FCRYPT_QUEUE_BATCH of them at a time. Short messages of the same hash in
+ * a batch are hashed together with fcrypt_hash_multi, which runs the
+ * multi-buffer code where there is some, and the keys of short CTR mode
+ * jobs of the same cipher are expanded together with its
+ * set_encrypt_key_batch. CTR mode jobs of at least FCRYPT_QUEUE_SPLIT_SIZE
+ * bytes are split across the threads that the library keeps for its
+ * parallel functions.
+ */
+
+#ifndef FCRYPT_QUEUE_H
+#define FCRYPT_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_cipher.h"
+#include "fcrypt_hash.h"
+
+/* Most jobs a worker takes from the ring at once. */
+#define FCRYPT_QUEUE_BATCH 32
+
+/* Jobs up to this size are grouped with others of the same algorithm. */
+#define FCRYPT_QUEUE_SMALL_SIZE 4096
+
+/* CTR mode jobs of this size or more are split across threads. */
+#define FCRYPT_QUEUE_SPLIT_SIZE (1024 * 1024)
+
+struct fcrypt_queue;
+
+/*
+ * A job hashes input with hash, writing the digest to output, or encrypts
+ * it with cipher in CTR mode under key starting from the counter block iv,
+ * writing len bytes to output. Exactly one of hash and cipher is set. The
+ * job and the buffers it points to belong to the caller, and must stay
+ * valid until done has been called with the job. done runs on a worker
+ * thread and may submit more jobs.
+ */
+struct fcrypt_job
+{
+  const struct fcrypt_hash *hash;
+  const struct fcrypt_cipher *cipher;
+  const uint8_t *key; /* cipher->key_size bytes */
+  uint8_t iv[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+  const void *input;
+  size_t len;
+  uint8_t *output;
+  void (*done) (struct fcrypt_job *);
+  void *arg; /* Not used by the queue */
+};
+
+/*
+ * Creates a queue served by the given number of worker threads, from 1 to
+ * 64, which holds at least capacity jobs waiting to be started. Returns
+ * NULL with errno set to EINVAL if the arguments are invalid, or ENOMEM or
+ * EAGAIN if the queue or its threads can not be created. Without POSIX
+ * threads, jobs run as they are submitted.
+ */
+struct fcrypt_queue *fcrypt_queue_new (unsigned int, size_t);
+
+/*
+ * Submits a job. Returns 0 on success, and -1 with errno set to EINVAL if
+ * the job is invalid or EAGAIN if the queue is full. Any thread may submit
+ * jobs.
+ */
+int fcrypt_queue_submit (struct fcrypt_queue *, struct fcrypt_job *);
+
+/* Waits until every job submitted so far is done. */
+void fcrypt_queue_wait (struct fcrypt_queue *);
+
+/* Waits for the jobs, stops the workers and frees the queue. */
+void fcrypt_queue_free (struct fcrypt_queue *);
+
+#endif /* FCRYPT_QUEUE_H */
@@ -0,0 +1,357 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * A fast-key-erasure generator as described by D. J. Bernstein in
+ * https://blog.cr.yp.to/20170723-random.html. The state is a ChaCha20 key.
+ * A refill encrypts a buffer of zeros with it, using the widest vector
+ * backend, then replaces the key with the first 32 bytes of the result and
+ * hands out the rest. Every byte is cleared once it has been handed out, so
+ * reading the state afterwards reveals nothing about earlier output.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(HAVE_FCNTL_H)
+#include <fcntl.h>
+#endif
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+#if defined(HAVE_SYS_RANDOM_H)
+#include <sys/random.h>
+#endif
+#if defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include "chacha-internal.h"
+#include "chacha.h"
+#include "fcrypt_memzero.h"
+#include "fcrypt_random.h"
+
+#define FCRYPT_RANDOM_KEY_SIZE 32
+
+/* Keystream made by one refill, a batch for the widest ChaCha backend. */
+#define FCRYPT_RANDOM_BUFFER_SIZE (CHACHA_MAX_WIDTH * CHACHA_BLOCK_SIZE)
+
+/*
+ * Requests of at least this many bytes are written straight to the output
+ * rather than through the buffer.
+ */
+#define FCRYPT_RANDOM_DIRECT_MIN FCRYPT_RANDOM_BUFFER_SIZE
+
+/* Bytes a generator outputs before mixing in a new seed. */
+#define FCRYPT_RANDOM_RESEED_BYTES (1024 * 1024)
+
+struct fcrypt_random_state
+{
+  uint8_t key[FCRYPT_RANDOM_KEY_SIZE];
+  uint8_t buffer[FCRYPT_RANDOM_BUFFER_SIZE];
+  size_t available;         /* Unused bytes at the end of buffer */
+  uint64_t output;          /* Bytes output since the last seed */
+  unsigned long generation; /* Process generation when seeded */
+  int seeded;
+};
+
+/*
+ * With thread-local storage every thread has its own generator. Otherwise
+ * they share one, behind a lock if there are threads at all.
+ */
+#if defined(THREAD_LOCAL)
+static THREAD_LOCAL struct fcrypt_random_state fcrypt_random_state;
+#else
+static struct fcrypt_random_state fcrypt_random_state;
+#if defined(HAVE_PTHREAD)
+static pthread_mutex_t fcrypt_random_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+#endif
+
+/*
+ * A child process starts with a copy of its parent's generators, which must
+ * not produce the same bytes as the parent. The fork handler counts forks
+ * in the child, and a generator seeded in an earlier generation seeds
+ * itself again. Without POSIX threads the process ID serves instead.
+ */
+#if defined(HAVE_PTHREAD)
+static unsigned long fcrypt_random_forks = 0;
+static pthread_once_t fcrypt_random_once = PTHREAD_ONCE_INIT;
+static pthread_key_t fcrypt_random_key;
+static int fcrypt_random_have_key = 0;
+
+static void
+fcrypt_random_prepare (void)
+{
+#if !defined(THREAD_LOCAL)
+  pthread_mutex_lock (&fcrypt_random_lock);
+#endif
+}
+
+static void
+fcrypt_random_parent (void)
+{
+#if !defined(THREAD_LOCAL)
+  pthread_mutex_unlock (&fcrypt_random_lock);
+#endif
+}
+
+static void
+fcrypt_random_child (void)
+{
+  ++fcrypt_random_forks;
+#if !defined(THREAD_LOCAL)
+  pthread_mutex_unlock (&fcrypt_random_lock);
+#endif
+}
+
+/* Clears a thread's generator when the thread exits. */
+static void
+fcrypt_random_destroy (void *state)
+{
+  fcrypt_memzero (state, sizeof (struct fcrypt_random_state));
+}
+
+static void
+fcrypt_random_init (void)
+{
+  pthread_atfork (fcrypt_random_prepare, fcrypt_random_parent,
+                  fcrypt_random_child);
+  if (pthread_key_create (&fcrypt_random_key, fcrypt_random_destroy) == 0)
+    fcrypt_random_have_key = 1;
+}
+#endif /* HAVE_PTHREAD */
+
+static unsigned long
+fcrypt_random_generation (void)
+{
+#if defined(HAVE_PTHREAD)
+  return fcrypt_random_forks;
+#elif defined(HAVE_UNISTD_H)
+  return (unsigned long)getpid ();
+#else
+  return 0;
+#endif
+}
+
+/*
+ * Reads len bytes, at most 256, from the operating system's generator.
+ * getrandom and getentropy are tried first since they work without a file
+ * descriptor, such as in a chroot without /dev.
+ */
+static int
+fcrypt_random_system (uint8_t *buf, size_t len)
+{
+#if defined(HAVE_FCNTL_H) && defined(HAVE_UNISTD_H)
+  int fd, flags;
+#endif
+#if defined(HAVE_GETRANDOM) || defined(HAVE_UNISTD_H)
+  ssize_t n;
+#endif
+
+#if defined(HAVE_GETRANDOM)
+  while (len > 0)
+    {
+      n = getrandom (buf, len, 0);
+      if (n < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          if (errno == ENOSYS)
+            break;
+          return -1;
+        }
+      buf += n;
+      len -= (size_t)n;
+    }
+  if (len == 0)
+    return 0;
+#endif
+#if defined(HAVE_GETENTROPY)
+  if (getentropy (buf, len) == 0)
+    return 0;
+#endif
+#if defined(HAVE_FCNTL_H) && defined(HAVE_UNISTD_H)
+  flags = O_RDONLY;
+#if defined(O_CLOEXEC)
+  flags |= O_CLOEXEC;
+#endif
+  do
+    fd = open ("/dev/urandom", flags);
+  while (fd < 0 && errno == EINTR);
+  if (fd < 0)
+    return -1;
+  while (len > 0)
+    {
+      n = read (fd, buf, len);
+      if (n <= 0)
+        {
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n == 0)
+            errno = EIO;
+          close (fd);
+          return -1;
+        }
+      buf += n;
+      len -= (size_t)n;
+    }
+  close (fd);
+  return 0;
+#else
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+/*
+ * Sets ctx to the keystream of the generator's key. The buffer is refilled
+ * from the stream with IV 0 and direct output uses IV 1, so the two never
+ * share keystream even though they start from the same key.
+ */
+static void
+fcrypt_random_cipher (struct chacha_ctx *ctx,
+                      const struct fcrypt_random_state *state, uint8_t iv0)
+{
+  uint8_t iv[8];
+
+  memset (iv, 0, sizeof (iv));
+  iv[0] = iv0;
+  chacha256_set_key (ctx, state->key);
+  chacha_set_iv (ctx, iv, NULL);
+}
+
+/* Replaces the key and the buffer with new keystream. */
+static void
+fcrypt_random_refill (struct fcrypt_random_state *state)
+{
+  struct chacha_ctx ctx;
+
+  fcrypt_random_cipher (&ctx, state, 0);
+  memset (state->buffer, 0, sizeof (state->buffer));
+  chacha_encrypt_bytes (&ctx, state->buffer, state->buffer,
+                        sizeof (state->buffer));
+  memcpy (state->key, state->buffer, FCRYPT_RANDOM_KEY_SIZE);
+  fcrypt_memzero (state->buffer, FCRYPT_RANDOM_KEY_SIZE);
+  state->available = sizeof (state->buffer) - FCRYPT_RANDOM_KEY_SIZE;
+  fcrypt_memzero (&ctx, sizeof (ctx));
+}
+
+/*
+ * Mixes a seed from the operating system into the key. XORing rather than
+ * replacing it means a seed that is somehow predictable can't make the
+ * generator weaker than it was.
+ */
+static int
+fcrypt_random_reseed (struct fcrypt_random_state *state)
+{
+  uint8_t seed[FCRYPT_RANDOM_KEY_SIZE];
+  size_t i;
+
+#if defined(HAVE_PTHREAD)
+  pthread_once (&fcrypt_random_once, fcrypt_random_init);
+#endif
+  if (fcrypt_random_system (seed, sizeof (seed)) != 0)
+    return -1;
+  for (i = 0; i < sizeof (seed); ++i)
+    state->key[i] ^= seed[i];
+  fcrypt_memzero (seed, sizeof (seed));
+  fcrypt_random_refill (state);
+#if defined(HAVE_PTHREAD) && defined(THREAD_LOCAL)
+  if (!state->seeded && fcrypt_random_have_key)
+    pthread_setspecific (fcrypt_random_key, state);
+#endif
+  state->output = 0;
+  state->generation = fcrypt_random_generation ();
+  state->seeded = 1;
+  return 0;
+}
+
+/*
+ * Writes keystream straight to a large output, then refills so that the
+ * key it came from is gone.
+ */
+static void
+fcrypt_random_direct (struct fcrypt_random_state *state, uint8_t *buf,
+                      size_t len)
+{
+  struct chacha_ctx ctx;
+
+  fcrypt_random_cipher (&ctx, state, 1);
+  memset (buf, 0, len);
+  chacha_encrypt_bytes (&ctx, buf, buf, len);
+  fcrypt_random_refill (state);
+  fcrypt_memzero (&ctx, sizeof (ctx));
+}
+
+int
+fcrypt_random (void *bufptr, size_t len)
+{
+  struct fcrypt_random_state *state = &fcrypt_random_state;
+  uint8_t *buf = bufptr;
+  uint8_t *pos;
+  size_t n;
+  int result = 0;
+
+#if !defined(THREAD_LOCAL) && defined(HAVE_PTHREAD)
+  pthread_mutex_lock (&fcrypt_random_lock);
+#endif
+  if (!state->seeded || state->generation != fcrypt_random_generation ()
+      || state->output >= FCRYPT_RANDOM_RESEED_BYTES)
+    {
+      if (fcrypt_random_reseed (state) != 0)
+        {
+          result = -1;
+          goto done;
+        }
+    }
+
+  state->output += len;
+  if (len >= FCRYPT_RANDOM_DIRECT_MIN)
+    fcrypt_random_direct (state, buf, len);
+  else
+    while (len > 0)
+      {
+        if (state->available == 0)
+          fcrypt_random_refill (state);
+        n = len < state->available ? len : state->available;
+        pos = state->buffer + sizeof (state->buffer) - state->available;
+        memcpy (buf, pos, n);
+        fcrypt_memzero (pos, n);
+        state->available -= n;
+        buf += n;
+        len -= n;
+      }
+
+done:
+#if !defined(THREAD_LOCAL) && defined(HAVE_PTHREAD)
+  pthread_mutex_unlock (&fcrypt_random_lock);
+#endif
+  return result;
+}
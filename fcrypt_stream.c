@@ -0,0 +1,308 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "chacha20poly1305.h"
+#include "fcrypt_memzero.h"
+#include "fcrypt_pool.h"
+#include "fcrypt_stream.h"
+#include "gcm.h"
+
+/* A whole object for the tasks of fcrypt_stream_seal and _open. */
+struct fcrypt_stream_job
+{
+  const struct fcrypt_stream *stream;
+  const uint8_t *src;
+  uint8_t *dest;
+  size_t len;      /* Of the plaintext */
+  size_t segments;
+  int failed;
+};
+
+static void
+fcrypt_stream_nonce (const struct fcrypt_stream *stream, uint8_t *nonce,
+                     uint64_t index, int last)
+{
+  memcpy (nonce, stream->prefix, FCRYPT_STREAM_PREFIX_SIZE);
+  buff_put_be32 (nonce + FCRYPT_STREAM_PREFIX_SIZE, (uint32_t)index);
+  nonce[FCRYPT_STREAM_PREFIX_SIZE + 4] = last ? 1 : 0;
+}
+
+/* Segments of a plaintext, with at least one even if it is empty. */
+static size_t
+fcrypt_stream_segments (const struct fcrypt_stream *stream, size_t len)
+{
+  return len == 0 ? 1 : (len - 1) / stream->segment_size + 1;
+}
+
+static int
+fcrypt_stream_check (const struct fcrypt_stream *stream, uint64_t index,
+                     int last, size_t len)
+{
+  if (index >= FCRYPT_STREAM_MAX_SEGMENTS || len > stream->segment_size
+      || (!last && len != stream->segment_size))
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  return 0;
+}
+
+int
+fcrypt_stream_init (struct fcrypt_stream *stream, int aead,
+                    const uint8_t *key, const uint8_t *prefix,
+                    size_t segment_size)
+{
+  if (segment_size == 0
+      || (uint64_t)segment_size > FCRYPT_STREAM_MAX_SEGMENT_SIZE)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  switch (aead)
+    {
+    case FCRYPT_STREAM_CHACHA20POLY1305:
+      chacha20poly1305_set_key (&stream->ctx.chacha20poly1305, key);
+      break;
+    case FCRYPT_STREAM_AES128_GCM:
+      aes128_gcm_set_key (&stream->ctx.aes128_gcm, key);
+      break;
+    case FCRYPT_STREAM_AES256_GCM:
+      aes256_gcm_set_key (&stream->ctx.aes256_gcm, key);
+      break;
+    default:
+      errno = EINVAL;
+      return -1;
+    }
+  stream->aead = aead;
+  stream->segment_size = segment_size;
+  memcpy (stream->prefix, prefix, FCRYPT_STREAM_PREFIX_SIZE);
+  return 0;
+}
+
+void
+fcrypt_stream_clear (struct fcrypt_stream *stream)
+{
+  fcrypt_memzero (stream, sizeof (*stream));
+}
+
+/*
+ * The AEAD contexts keep the state of the message in them, so each segment
+ * works on a copy of the keyed context, which leaves the stream constant.
+ */
+int
+fcrypt_stream_seal_segment (const struct fcrypt_stream *stream,
+                            uint64_t index, int last, const uint8_t *src,
+                            uint8_t *dest, size_t len, uint8_t *tag)
+{
+  uint8_t nonce[CHACHA20POLY1305_NONCE_SIZE];
+  struct fcrypt_stream copy;
+
+  if (fcrypt_stream_check (stream, index, last, len) != 0)
+    return -1;
+  fcrypt_stream_nonce (stream, nonce, index, last);
+  copy.ctx = stream->ctx;
+  switch (stream->aead)
+    {
+    case FCRYPT_STREAM_CHACHA20POLY1305:
+      chacha20poly1305_seal (&copy.ctx.chacha20poly1305, nonce, NULL, 0, src,
+                             dest, len, tag);
+      break;
+    case FCRYPT_STREAM_AES128_GCM:
+      aes128_gcm_seal (&copy.ctx.aes128_gcm, nonce, GCM_IV_SIZE, NULL, 0,
+                       src, dest, len, tag);
+      break;
+    default:
+      aes256_gcm_seal (&copy.ctx.aes256_gcm, nonce, GCM_IV_SIZE, NULL, 0,
+                       src, dest, len, tag);
+      break;
+    }
+  fcrypt_memzero (&copy.ctx, sizeof (copy.ctx));
+  return 0;
+}
+
+int
+fcrypt_stream_open_segment (const struct fcrypt_stream *stream,
+                            uint64_t index, int last, const uint8_t *src,
+                            uint8_t *dest, size_t len, const uint8_t *tag)
+{
+  uint8_t nonce[CHACHA20POLY1305_NONCE_SIZE];
+  struct fcrypt_stream copy;
+  int rv;
+
+  if (fcrypt_stream_check (stream, index, last, len) != 0)
+    return -1;
+  fcrypt_stream_nonce (stream, nonce, index, last);
+  copy.ctx = stream->ctx;
+  switch (stream->aead)
+    {
+    case FCRYPT_STREAM_CHACHA20POLY1305:
+      rv = chacha20poly1305_open (&copy.ctx.chacha20poly1305, nonce, NULL, 0,
+                                  src, dest, len, tag);
+      break;
+    case FCRYPT_STREAM_AES128_GCM:
+      rv = aes128_gcm_open (&copy.ctx.aes128_gcm, nonce, GCM_IV_SIZE, NULL,
+                            0, src, dest, len, tag);
+      break;
+    default:
+      rv = aes256_gcm_open (&copy.ctx.aes256_gcm, nonce, GCM_IV_SIZE, NULL,
+                            0, src, dest, len, tag);
+      break;
+    }
+  fcrypt_memzero (&copy.ctx, sizeof (copy.ctx));
+  return rv;
+}
+
+int
+fcrypt_stream_sealed_size (const struct fcrypt_stream *stream, size_t len,
+                           size_t *sealed)
+{
+  size_t segments;
+
+  segments = fcrypt_stream_segments (stream, len);
+  if ((uint64_t)segments > FCRYPT_STREAM_MAX_SEGMENTS
+      || segments > (SIZE_MAX - len) / FCRYPT_STREAM_TAG_SIZE)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  *sealed = len + segments * FCRYPT_STREAM_TAG_SIZE;
+  return 0;
+}
+
+int
+fcrypt_stream_opened_size (const struct fcrypt_stream *stream,
+                           size_t sealed, size_t *len)
+{
+  size_t segments, stride, rest;
+
+  stride = stream->segment_size + FCRYPT_STREAM_TAG_SIZE;
+  if (stride < FCRYPT_STREAM_TAG_SIZE)
+    stride = SIZE_MAX;
+  rest = sealed % stride;
+  segments = sealed / stride + (rest != 0);
+
+  /* Only an object with a single segment may have an empty one. */
+  if (sealed < FCRYPT_STREAM_TAG_SIZE
+      || (uint64_t)segments > FCRYPT_STREAM_MAX_SEGMENTS
+      || (rest != 0 && rest < FCRYPT_STREAM_TAG_SIZE + (segments > 1)))
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  *len = sealed - segments * FCRYPT_STREAM_TAG_SIZE;
+  return 0;
+}
+
+static void
+fcrypt_stream_seal_task (void *arg, size_t index)
+{
+  struct fcrypt_stream_job *job = arg;
+  size_t size, offset, len;
+
+  size = job->stream->segment_size;
+  offset = index * size;
+  len = index == job->segments - 1 ? job->len - offset : size;
+  fcrypt_stream_seal_segment (
+      job->stream, index, index == job->segments - 1, job->src + offset,
+      job->dest + offset + index * FCRYPT_STREAM_TAG_SIZE, len,
+      job->dest + offset + index * FCRYPT_STREAM_TAG_SIZE + len);
+}
+
+static void
+fcrypt_stream_open_task (void *arg, size_t index)
+{
+  struct fcrypt_stream_job *job = arg;
+  size_t size, offset, len;
+
+  size = job->stream->segment_size;
+  offset = index * size;
+  len = index == job->segments - 1 ? job->len - offset : size;
+  if (fcrypt_stream_open_segment (
+          job->stream, index, index == job->segments - 1,
+          job->src + offset + index * FCRYPT_STREAM_TAG_SIZE,
+          job->dest + offset, len,
+          job->src + offset + index * FCRYPT_STREAM_TAG_SIZE + len)
+      != 0)
+    {
+      /* Every failing task stores the same value. */
+#if defined(__GNUC__)
+      __atomic_store_n (&job->failed, 1, __ATOMIC_RELAXED);
+#else
+      job->failed = 1;
+#endif
+    }
+}
+
+int
+fcrypt_stream_seal (const struct fcrypt_stream *stream, const uint8_t *src,
+                    size_t len, uint8_t *dest, unsigned int threads)
+{
+  struct fcrypt_stream_job job;
+  size_t sealed;
+
+  if (fcrypt_stream_sealed_size (stream, len, &sealed) != 0)
+    return -1;
+  job.stream = stream;
+  job.src = src;
+  job.dest = dest;
+  job.len = len;
+  job.segments = fcrypt_stream_segments (stream, len);
+  fcrypt_pool_run (fcrypt_stream_seal_task, &job, job.segments,
+                   threads == 0 ? 1 : threads);
+  return 0;
+}
+
+int
+fcrypt_stream_open (const struct fcrypt_stream *stream, const uint8_t *src,
+                    size_t sealed, uint8_t *dest, unsigned int threads)
+{
+  struct fcrypt_stream_job job;
+  size_t len;
+
+  if (fcrypt_stream_opened_size (stream, sealed, &len) != 0)
+    return -1;
+  job.stream = stream;
+  job.src = src;
+  job.dest = dest;
+  job.len = len;
+  job.segments = fcrypt_stream_segments (stream, len);
+  job.failed = 0;
+  fcrypt_pool_run (fcrypt_stream_open_task, &job, job.segments,
+                   threads == 0 ? 1 : threads);
+  if (job.failed)
+    {
+      fcrypt_memzero (dest, len);
+      return -1;
+    }
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Segmented authenticated encryption of large objects with the STREAM
+ * construction of Hoang, Reyhanitabar, Rogaway and Vizar, "Online
+ * Authenticated-Encryption and its Nonce-Reuse Misuse-Resistance". The
+ * plaintext is cut into segments of a fixed size, of which only the last
+ * may be shorter, and each is sealed on its own with ChaCha20-Poly1305 or
+ * AES-GCM under the 12-byte nonce
+ *
+ *   prefix (7 bytes) || segment index (32-bit big-endian) || last (1 byte)
+ *
+ * where last is 1 for the final segment and 0 for the others. Segments can
+ * be sealed and opened in any order and on any thread, so an object is
+ * encrypted in constant memory as it arrives, decrypted from any segment,
+ * or processed on all cores at once. Reordering, dropping or duplicating
+ * segments, or truncating the object at a segment boundary, makes opening
+ * fail. The prefix must never be used twice with the same key.
+ *
+ * A sealed object is each segment followed by its tag, one after another.
+ */
+
+#ifndef FCRYPT_STREAM_H
+#define FCRYPT_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha20poly1305.h"
+#include "gcm.h"
+
+#define FCRYPT_STREAM_CHACHA20POLY1305 1
+#define FCRYPT_STREAM_AES128_GCM 2
+#define FCRYPT_STREAM_AES256_GCM 3
+
+#define FCRYPT_STREAM_PREFIX_SIZE 7
+#define FCRYPT_STREAM_TAG_SIZE 16
+
+/* Largest segment size, and number of segments in an object. */
+#define FCRYPT_STREAM_MAX_SEGMENT_SIZE (UINT64_C (1) << 32)
+#define FCRYPT_STREAM_MAX_SEGMENTS (UINT64_C (1) << 32)
+
+struct fcrypt_stream
+{
+  int aead;            /* FCRYPT_STREAM_* */
+  size_t segment_size; /* Plaintext bytes in a segment */
+  uint8_t prefix[FCRYPT_STREAM_PREFIX_SIZE];
+  union
+  {
+    struct chacha20poly1305_ctx chacha20poly1305;
+    struct aes128_gcm_ctx aes128_gcm;
+    struct aes256_gcm_ctx aes256_gcm;
+  } ctx;
+};
+
+/*
+ * Sets up a stream with one of the FCRYPT_STREAM_* AEADs, its key of 32
+ * bytes, or 16 for AES-128, the nonce prefix and the segment size. Returns
+ * 0, or -1 with errno set to EINVAL if the AEAD is unknown or the segment
+ * size is zero or larger than FCRYPT_STREAM_MAX_SEGMENT_SIZE. The stream is
+ * not changed by the functions below, so one stream can be used by many
+ * threads at once.
+ */
+int fcrypt_stream_init (struct fcrypt_stream *, int, const uint8_t *,
+                        const uint8_t *, size_t);
+
+/* Clears the key from a stream. */
+void fcrypt_stream_clear (struct fcrypt_stream *);
+
+/*
+ * Seals or opens one segment. The arguments are the index of the segment,
+ * whether it is the last one, the input, the output and its length, and
+ * the tag. Both return -1 with errno set to EINVAL if the index is not
+ * below FCRYPT_STREAM_MAX_SEGMENTS or the length is larger than the
+ * segment size, or smaller for a segment that is not the last. Open also
+ * returns -1 if the tag does not match, in which case the output is
+ * cleared.
+ */
+int fcrypt_stream_seal_segment (const struct fcrypt_stream *, uint64_t, int,
+                                const uint8_t *, uint8_t *, size_t,
+                                uint8_t *);
+int fcrypt_stream_open_segment (const struct fcrypt_stream *, uint64_t, int,
+                                const uint8_t *, uint8_t *, size_t,
+                                const uint8_t *);
+
+/*
+ * Computes the length of the sealed form of a plaintext, which has one tag
+ * for each segment and at least one segment, or of the plaintext of a
+ * sealed object. Both return 0, or -1 with errno set to EINVAL if there is
+ * no such length or it does not fit in a size_t.
+ */
+int fcrypt_stream_sealed_size (const struct fcrypt_stream *, size_t,
+                               size_t *);
+int fcrypt_stream_opened_size (const struct fcrypt_stream *, size_t,
+                               size_t *);
+
+/*
+ * Seals or opens a whole object in memory, with the segments spread over up
+ * to the given number of threads of the pool in fcrypt_pool.h. The
+ * arguments are the input and its length, the output, which holds the
+ * number of bytes given by fcrypt_stream_sealed_size or
+ * fcrypt_stream_opened_size, and the number of threads. Both return -1 with
+ * errno set to EINVAL if that function fails. Open also
+ * returns -1 if any segment fails to open, in which case the whole output
+ * is cleared.
+ */
+int fcrypt_stream_seal (const struct fcrypt_stream *, const uint8_t *,
+                        size_t, uint8_t *, unsigned int);
+int fcrypt_stream_open (const struct fcrypt_stream *, const uint8_t *,
+                        size_t, uint8_t *, unsigned int);
+
+#endif /* FCRYPT_STREAM_H */
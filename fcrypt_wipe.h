@@ -0,0 +1,54 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Inline counterpart of fcrypt_memzero, for clearing contexts and other
+ * objects whose size is known at compile time. The compiler expands the
+ * memset into a few vector stores where a call to explicit_bzero would cost
+ * more than the clearing itself, and the empty asm statement, which may
+ * read the memory through its address, keeps the stores from being removed
+ * as dead. Other compilers call fcrypt_memzero.
+ */
+
+#ifndef FCRYPT_WIPE_H
+#define FCRYPT_WIPE_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include "fcrypt_memzero.h"
+
+#if defined(__GNUC__)
+static inline void
+fcrypt_wipe (void *mem, size_t len)
+{
+  memset (mem, 0, len);
+  __asm__ __volatile__("" : : "r"(mem) : "memory");
+}
+#else
+#define fcrypt_wipe(mem, len) fcrypt_memzero (mem, len)
+#endif
+
+#endif /* FCRYPT_WIPE_H */
@@ -0,0 +1,165 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * GHASH using the ARMv8 PMULL instruction. The math is the same as in
+ * gcm-pclmul.c: eight 256-bit products are summed in vector registers and
+ * reduced once. The blocks are loaded as big-endian words with the helpers
+ * from bswap.h and the reduction is done on general purpose registers.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bswap.h"
+#include "gcm-internal.h"
+#include "gcm.h"
+
+#if defined(HAVE_ARM_PMULL_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define ARMV8_TARGET __attribute__ ((target (ARM_PMULL_TARGET_ATTRIBUTE)))
+
+ARMV8_TARGET static inline uint64x2_t
+armv8_clmul (uint64_t a, uint64_t b)
+{
+  return vreinterpretq_u64_p128 (vmull_p64 ((poly64_t)a, (poly64_t)b));
+}
+
+/*
+ * Adds a * b to the unreduced 256-bit sum in hi:lo. The operands use the
+ * word order of the running hash, so a[0] is the high word.
+ */
+ARMV8_TARGET static inline void
+armv8_mul_add (const uint64_t *a, const uint64_t *b, uint64x2_t *hi,
+               uint64x2_t *lo)
+{
+  uint64x2_t m, z;
+
+  z = vdupq_n_u64 (0);
+  m = veorq_u64 (armv8_clmul (a[0], b[1]), armv8_clmul (a[1], b[0]));
+  *lo = veorq_u64 (*lo, armv8_clmul (a[1], b[1]));
+  *hi = veorq_u64 (*hi, armv8_clmul (a[0], b[0]));
+  *lo = veorq_u64 (*lo, vextq_u64 (z, m, 1));
+  *hi = veorq_u64 (*hi, vextq_u64 (m, z, 1));
+}
+
+/* Shifts hi:lo left by one bit and reduces it into x. */
+ARMV8_TARGET static inline void
+armv8_reduce (uint64x2_t hi, uint64x2_t lo, uint64_t *x)
+{
+  uint64_t d0, d1, d2, d3, g;
+
+  d0 = vgetq_lane_u64 (lo, 0);
+  d1 = vgetq_lane_u64 (lo, 1);
+  d2 = vgetq_lane_u64 (hi, 0);
+  d3 = vgetq_lane_u64 (hi, 1);
+
+  d3 = (d3 << 1) | (d2 >> 63);
+  d2 = (d2 << 1) | (d1 >> 63);
+  d1 = (d1 << 1) | (d0 >> 63);
+  d0 <<= 1;
+
+  g = (d0 << 63) ^ (d0 << 62) ^ (d0 << 57);
+  d1 ^= g;
+  x[0] = d3 ^ d1 ^ (d1 >> 1) ^ (d1 >> 2) ^ (d1 >> 7);
+  x[1] = d2 ^ d0 ^ ((d0 >> 1) | (d1 << 63)) ^ ((d0 >> 2) | (d1 << 62))
+         ^ ((d0 >> 7) | (d1 << 57));
+}
+
+ARMV8_TARGET static inline void
+armv8_mul (const uint64_t *a, const uint64_t *b, uint64_t *x)
+{
+  uint64x2_t hi, lo;
+
+  hi = vdupq_n_u64 (0);
+  lo = vdupq_n_u64 (0);
+  armv8_mul_add (a, b, &hi, &lo);
+  armv8_reduce (hi, lo, x);
+}
+
+/* Stores H^(i + 1) in key->h[i]. */
+ARMV8_TARGET static void
+gcm_init_key_armv8 (struct gcm_key *key, const uint8_t *h)
+{
+  unsigned int i;
+
+  key->h[0][0] = buff_get_be64 (h);
+  key->h[0][1] = buff_get_be64 (h + 8);
+  for (i = 1; i < GCM_AGGREGATE_BLOCKS; ++i)
+    armv8_mul (key->h[i - 1], key->h[0], key->h[i]);
+}
+
+ARMV8_TARGET static void
+gcm_ghash_armv8 (const struct gcm_key *key, uint64_t *x, const uint8_t *data,
+                 size_t blocks)
+{
+  uint64x2_t hi, lo;
+  uint64_t c[2];
+  unsigned int i;
+
+  while (blocks >= GCM_AGGREGATE_BLOCKS)
+    {
+      hi = vdupq_n_u64 (0);
+      lo = vdupq_n_u64 (0);
+      c[0] = x[0] ^ buff_get_be64 (data);
+      c[1] = x[1] ^ buff_get_be64 (data + 8);
+      armv8_mul_add (c, key->h[GCM_AGGREGATE_BLOCKS - 1], &hi, &lo);
+      for (i = 1; i < GCM_AGGREGATE_BLOCKS; ++i)
+        {
+          c[0] = buff_get_be64 (data + i * GCM_BLOCK_SIZE);
+          c[1] = buff_get_be64 (data + i * GCM_BLOCK_SIZE + 8);
+          armv8_mul_add (c, key->h[GCM_AGGREGATE_BLOCKS - 1 - i], &hi, &lo);
+        }
+      armv8_reduce (hi, lo, x);
+      data += GCM_AGGREGATE_BLOCKS * GCM_BLOCK_SIZE;
+      blocks -= GCM_AGGREGATE_BLOCKS;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      c[0] = x[0] ^ buff_get_be64 (data);
+      c[1] = x[1] ^ buff_get_be64 (data + 8);
+      armv8_mul (c, key->h[0], x);
+      data += GCM_BLOCK_SIZE;
+    }
+}
+
+const struct gcm_backend gcm_backend_armv8 = {
+  "armv8",
+  gcm_init_key_armv8,
+  gcm_ghash_armv8,
+  NULL,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int gcm_armv8_unused;
+
+#endif /* HAVE_ARM_PMULL_INTRINSICS */
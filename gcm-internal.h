@@ -0,0 +1,77 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between gcm.c and the GHASH implementations. The running hash is
+ * kept as two 64-bit words holding the big-endian value of the block, so x[0]
+ * is the first eight bytes. Each implementation fills struct gcm_key in its
+ * own format from the hash subkey H, and ghash absorbs a whole number of
+ * blocks into the running hash.
+ */
+
+#ifndef GCM_INTERNAL_H
+#define GCM_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gcm.h"
+
+/* Number of blocks hashed with a single reduction by the carry-less code. */
+#define GCM_AGGREGATE_BLOCKS 8
+
+struct gcm_backend
+{
+  const char *name;
+  void (*init_key) (struct gcm_key *, const uint8_t *);
+  void (*ghash) (const struct gcm_key *, uint64_t *, const uint8_t *, size_t);
+  /*
+   * Optional AES-GCM encryption or decryption of a multiple of
+   * GCM_AGGREGATE_BLOCKS blocks in a single pass, or NULL. It takes the round
+   * keys and number of rounds from struct aes*_enc_ctx, and increments the
+   * counter modulo 2^32 itself.
+   */
+  void (*aes_crypt) (const uint32_t *, unsigned int, const struct gcm_key *,
+                     uint64_t *, uint8_t *, const uint8_t *, uint8_t *, size_t,
+                     int);
+};
+
+/* 4-bit table implementation in gcm.c, always available. */
+extern const struct gcm_backend gcm_backend_table;
+
+#if defined(HAVE_PCLMUL_INTRINSICS)
+/* PCLMULQDQ implementation in gcm-pclmul.c. */
+extern const struct gcm_backend gcm_backend_pclmul;
+#if defined(HAVE_AESNI_INTRINSICS)
+extern const struct gcm_backend gcm_backend_pclmul_aesni;
+#endif
+#endif
+
+#if defined(HAVE_ARM_PMULL_INTRINSICS)
+/* ARMv8 PMULL implementation in gcm-armv8.c. */
+extern const struct gcm_backend gcm_backend_armv8;
+#endif
+
+#endif /* GCM_INTERNAL_H */
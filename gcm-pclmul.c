@@ -0,0 +1,334 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * GHASH using the PCLMULQDQ instruction. See "Intel Carry-Less Multiplication
+ * Instruction and its Usage for Computing the GCM Mode" by Shay Gueron and
+ * Michael E. Kounavis. Blocks are byte reversed when loaded so that the
+ * register holds the big-endian value of the block, and the 256-bit product
+ * of reflected polynomials is shifted left by one bit before reducing it.
+ * Eight blocks are multiplied by H^8 through H^1 and summed before a single
+ * reduction, so the multiplications don't depend on each other.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gcm-internal.h"
+#include "gcm.h"
+
+#if defined(HAVE_PCLMUL_INTRINSICS)
+
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#define PCLMUL_TARGET __attribute__ ((target (PCLMUL_TARGET_ATTRIBUTE)))
+
+PCLMUL_TARGET static inline __m128i
+pclmul_load_block (const uint8_t *data)
+{
+  const __m128i mask
+      = _mm_set_epi8 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+  return _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *)data), mask);
+}
+
+/* Adds a * b to the unreduced 256-bit sum in hi:lo. */
+PCLMUL_TARGET static inline void
+pclmul_mul_add (__m128i a, __m128i b, __m128i *hi, __m128i *lo)
+{
+  __m128i m;
+
+  m = _mm_xor_si128 (_mm_clmulepi64_si128 (a, b, 0x01),
+                     _mm_clmulepi64_si128 (a, b, 0x10));
+  *lo = _mm_xor_si128 (*lo, _mm_clmulepi64_si128 (a, b, 0x00));
+  *hi = _mm_xor_si128 (*hi, _mm_clmulepi64_si128 (a, b, 0x11));
+  *lo = _mm_xor_si128 (*lo, _mm_slli_si128 (m, 8));
+  *hi = _mm_xor_si128 (*hi, _mm_srli_si128 (m, 8));
+}
+
+/* Shifts v right by s bits as a 128-bit integer. */
+#define PCLMUL_SHR128(v, s)                                                   \
+  _mm_or_si128 (_mm_srli_epi64 ((v), (s)),                                    \
+                _mm_srli_si128 (_mm_slli_epi64 ((v), 64 - (s)), 8))
+
+/*
+ * Reduces hi:lo modulo x^128 + x^7 + x^2 + x + 1. After the one bit shift
+ * the low half holds the coefficients of x^128 and above in reflected order.
+ * Its bits that would be shifted out by the multiplication with
+ * x^7 + x^2 + x + 1 are folded back in first, then the product is added.
+ */
+PCLMUL_TARGET static inline __m128i
+pclmul_reduce (__m128i hi, __m128i lo)
+{
+  __m128i c, d, g;
+
+  c = _mm_srli_epi64 (lo, 63);
+  d = _mm_srli_epi64 (hi, 63);
+  lo = _mm_or_si128 (_mm_slli_epi64 (lo, 1), _mm_slli_si128 (c, 8));
+  hi = _mm_or_si128 (_mm_slli_epi64 (hi, 1), _mm_slli_si128 (d, 8));
+  hi = _mm_or_si128 (hi, _mm_srli_si128 (c, 8));
+
+  g = _mm_xor_si128 (_mm_slli_epi64 (lo, 63), _mm_slli_epi64 (lo, 62));
+  g = _mm_xor_si128 (g, _mm_slli_epi64 (lo, 57));
+  lo = _mm_xor_si128 (lo, _mm_slli_si128 (g, 8));
+
+  hi = _mm_xor_si128 (hi, lo);
+  hi = _mm_xor_si128 (hi, PCLMUL_SHR128 (lo, 1));
+  hi = _mm_xor_si128 (hi, PCLMUL_SHR128 (lo, 2));
+  return _mm_xor_si128 (hi, PCLMUL_SHR128 (lo, 7));
+}
+
+PCLMUL_TARGET static inline __m128i
+pclmul_mul (__m128i a, __m128i b)
+{
+  __m128i hi, lo;
+
+  hi = _mm_setzero_si128 ();
+  lo = _mm_setzero_si128 ();
+  pclmul_mul_add (a, b, &hi, &lo);
+  return pclmul_reduce (hi, lo);
+}
+
+/* Stores H^(i + 1) in key->h[i]. */
+PCLMUL_TARGET static void
+gcm_init_key_pclmul (struct gcm_key *key, const uint8_t *h)
+{
+  __m128i h1, hn;
+  unsigned int i;
+
+  h1 = pclmul_load_block (h);
+  hn = h1;
+  _mm_storeu_si128 ((__m128i *)key->h[0], h1);
+  for (i = 1; i < GCM_AGGREGATE_BLOCKS; ++i)
+    {
+      hn = pclmul_mul (hn, h1);
+      _mm_storeu_si128 ((__m128i *)key->h[i], hn);
+    }
+}
+
+PCLMUL_TARGET static void
+gcm_ghash_pclmul (const struct gcm_key *key, uint64_t *x, const uint8_t *data,
+                  size_t blocks)
+{
+  __m128i h[GCM_AGGREGATE_BLOCKS];
+  __m128i y, hi, lo;
+  uint64_t out[2];
+  unsigned int i;
+
+  for (i = 0; i < GCM_AGGREGATE_BLOCKS; ++i)
+    h[i] = _mm_loadu_si128 ((const __m128i *)key->h[i]);
+
+  y = _mm_set_epi64x ((long long)x[0], (long long)x[1]);
+  while (blocks >= GCM_AGGREGATE_BLOCKS)
+    {
+      hi = _mm_setzero_si128 ();
+      lo = _mm_setzero_si128 ();
+      y = _mm_xor_si128 (y, pclmul_load_block (data));
+      pclmul_mul_add (y, h[7], &hi, &lo);
+      pclmul_mul_add (pclmul_load_block (data + 16), h[6], &hi, &lo);
+      pclmul_mul_add (pclmul_load_block (data + 32), h[5], &hi, &lo);
+      pclmul_mul_add (pclmul_load_block (data + 48), h[4], &hi, &lo);
+      pclmul_mul_add (pclmul_load_block (data + 64), h[3], &hi, &lo);
+      pclmul_mul_add (pclmul_load_block (data + 80), h[2], &hi, &lo);
+      pclmul_mul_add (pclmul_load_block (data + 96), h[1], &hi, &lo);
+      pclmul_mul_add (pclmul_load_block (data + 112), h[0], &hi, &lo);
+      y = pclmul_reduce (hi, lo);
+      data += GCM_AGGREGATE_BLOCKS * GCM_BLOCK_SIZE;
+      blocks -= GCM_AGGREGATE_BLOCKS;
+    }
+
+  for (; blocks > 0; --blocks)
+    {
+      y = pclmul_mul (_mm_xor_si128 (y, pclmul_load_block (data)), h[0]);
+      data += GCM_BLOCK_SIZE;
+    }
+
+  _mm_storeu_si128 ((__m128i *)out, y);
+  x[0] = out[1];
+  x[1] = out[0];
+}
+
+#if defined(HAVE_AESNI_INTRINSICS)
+
+#define AESNI_PCLMUL_TARGET                                                   \
+  __attribute__ ((target (AESNI_TARGET_ATTRIBUTE "," PCLMUL_TARGET_ATTRIBUTE)))
+
+/* Applies one AES-NI instruction to all of the blocks in flight. */
+#define GCM_AESNI_ROUND8(f, k)                                                \
+  do                                                                          \
+    {                                                                         \
+      x0 = f (x0, (k));                                                       \
+      x1 = f (x1, (k));                                                       \
+      x2 = f (x2, (k));                                                       \
+      x3 = f (x3, (k));                                                       \
+      x4 = f (x4, (k));                                                       \
+      x5 = f (x5, (k));                                                       \
+      x6 = f (x6, (k));                                                       \
+      x7 = f (x7, (k));                                                       \
+    }                                                                         \
+  while (0)
+
+/* An AES round on every block followed by the GHASH product of block i. */
+#define GCM_AESNI_ROUND8_HASH(k, i)                                           \
+  do                                                                          \
+    {                                                                         \
+      GCM_AESNI_ROUND8 (_mm_aesenc_si128, (k));                               \
+      if (hash != NULL)                                                       \
+        pclmul_mul_add (pclmul_load_block (hash + (i) * 16),                  \
+                        h[GCM_AGGREGATE_BLOCKS - 1 - (i)], &hi, &lo);         \
+    }                                                                         \
+  while (0)
+
+/* Counter block i of the iteration from the byte reversed counter. */
+#define GCM_AESNI_COUNTER(i)                                                  \
+  _mm_shuffle_epi8 (_mm_add_epi32 (counter, _mm_set_epi32 (0, 0, 0, (i))),    \
+                    reverse)
+
+#define GCM_AESNI_XOR_STORE(i, x)                                             \
+  _mm_storeu_si128 ((__m128i *)(dest + (i) * 16),                             \
+                    _mm_xor_si128 ((x), _mm_loadu_si128 ((const __m128i *)    \
+                                                         (src + (i) * 16))))
+
+/*
+ * CTR encryption and GHASH of GCM_AGGREGATE_BLOCKS blocks per iteration in a
+ * single loop, so the carry-less multiplications run in the gaps between the
+ * dependent AESENC instructions. When decrypting, the ciphertext being
+ * decrypted is hashed. When encrypting, the ciphertext from the previous
+ * iteration is hashed and the last one is hashed after the loop. The counter
+ * is kept byte reversed so that _mm_add_epi32 gives the increment modulo
+ * 2^32 that GCM requires. The round keys use the layout of struct aes*_ctx.
+ */
+AESNI_PCLMUL_TARGET static void
+gcm_aes_crypt_pclmul (const uint32_t *ek, unsigned int rounds,
+                      const struct gcm_key *key, uint64_t *x, uint8_t *ctr,
+                      const uint8_t *src, uint8_t *dest, size_t blocks,
+                      int encrypt)
+{
+  const __m128i bswap32
+      = _mm_set_epi8 (12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  const __m128i reverse
+      = _mm_set_epi8 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  __m128i rk[AES256_ROUNDS + 1];
+  __m128i h[GCM_AGGREGATE_BLOCKS];
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+  __m128i counter, y, hi, lo;
+  const uint8_t *hash;
+  uint64_t out[2];
+  unsigned int i;
+
+  for (i = 0; i <= rounds; ++i)
+    rk[i] = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *)(ek + i * 4)),
+                              bswap32);
+  for (i = 0; i < GCM_AGGREGATE_BLOCKS; ++i)
+    h[i] = _mm_loadu_si128 ((const __m128i *)key->h[i]);
+
+  counter = pclmul_load_block (ctr);
+  y = _mm_set_epi64x ((long long)x[0], (long long)x[1]);
+  hash = NULL;
+  for (; blocks >= GCM_AGGREGATE_BLOCKS; blocks -= GCM_AGGREGATE_BLOCKS)
+    {
+      if (!encrypt)
+        hash = src;
+
+      x0 = GCM_AESNI_COUNTER (0);
+      x1 = GCM_AESNI_COUNTER (1);
+      x2 = GCM_AESNI_COUNTER (2);
+      x3 = GCM_AESNI_COUNTER (3);
+      x4 = GCM_AESNI_COUNTER (4);
+      x5 = GCM_AESNI_COUNTER (5);
+      x6 = GCM_AESNI_COUNTER (6);
+      x7 = GCM_AESNI_COUNTER (7);
+      counter = _mm_add_epi32 (counter, _mm_set_epi32 (0, 0, 0, 8));
+      GCM_AESNI_ROUND8 (_mm_xor_si128, rk[0]);
+
+      hi = _mm_setzero_si128 ();
+      lo = _mm_setzero_si128 ();
+      if (hash != NULL)
+        y = _mm_xor_si128 (y, pclmul_load_block (hash));
+      GCM_AESNI_ROUND8 (_mm_aesenc_si128, rk[1]);
+      if (hash != NULL)
+        pclmul_mul_add (y, h[GCM_AGGREGATE_BLOCKS - 1], &hi, &lo);
+      GCM_AESNI_ROUND8_HASH (rk[2], 1);
+      GCM_AESNI_ROUND8_HASH (rk[3], 2);
+      GCM_AESNI_ROUND8_HASH (rk[4], 3);
+      GCM_AESNI_ROUND8_HASH (rk[5], 4);
+      GCM_AESNI_ROUND8_HASH (rk[6], 5);
+      GCM_AESNI_ROUND8_HASH (rk[7], 6);
+      GCM_AESNI_ROUND8_HASH (rk[8], 7);
+      for (i = 9; i < rounds; ++i)
+        GCM_AESNI_ROUND8 (_mm_aesenc_si128, rk[i]);
+      if (hash != NULL)
+        y = pclmul_reduce (hi, lo);
+      GCM_AESNI_ROUND8 (_mm_aesenclast_si128, rk[rounds]);
+
+      GCM_AESNI_XOR_STORE (0, x0);
+      GCM_AESNI_XOR_STORE (1, x1);
+      GCM_AESNI_XOR_STORE (2, x2);
+      GCM_AESNI_XOR_STORE (3, x3);
+      GCM_AESNI_XOR_STORE (4, x4);
+      GCM_AESNI_XOR_STORE (5, x5);
+      GCM_AESNI_XOR_STORE (6, x6);
+      GCM_AESNI_XOR_STORE (7, x7);
+      if (encrypt)
+        hash = dest;
+      src += GCM_AGGREGATE_BLOCKS * GCM_BLOCK_SIZE;
+      dest += GCM_AGGREGATE_BLOCKS * GCM_BLOCK_SIZE;
+    }
+
+  _mm_storeu_si128 ((__m128i *)out, y);
+  x[0] = out[1];
+  x[1] = out[0];
+  if (encrypt && hash != NULL)
+    gcm_ghash_pclmul (key, x, hash, GCM_AGGREGATE_BLOCKS);
+  _mm_storeu_si128 ((__m128i *)ctr, _mm_shuffle_epi8 (counter, reverse));
+}
+
+#endif /* HAVE_AESNI_INTRINSICS */
+
+const struct gcm_backend gcm_backend_pclmul = {
+  "pclmul",
+  gcm_init_key_pclmul,
+  gcm_ghash_pclmul,
+  NULL,
+};
+
+#if defined(HAVE_AESNI_INTRINSICS)
+const struct gcm_backend gcm_backend_pclmul_aesni = {
+  "pclmul-aesni",
+  gcm_init_key_pclmul,
+  gcm_ghash_pclmul,
+  gcm_aes_crypt_pclmul,
+};
+#endif
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int gcm_pclmul_unused;
+
+#endif /* HAVE_PCLMUL_INTRINSICS */
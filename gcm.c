@@ -0,0 +1,846 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * GCM as described in NIST SP 800-38D. The GHASH multiplication is done by
+ * one of the implementations behind struct gcm_backend, picked at load time.
+ * The portable one uses the 4-bit table method from "The Galois/Counter Mode
+ * of Operation (GCM)" by McGrew and Viega, section 4.1.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "aes.h"
+#include "bswap.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_memzero.h"
+#include "gcm-internal.h"
+#include "gcm.h"
+
+/*
+ * Bytes of keystream generated between GHASH calls. Small enough that the
+ * data is still in the L1 cache when it is hashed and large enough that the
+ * CTR and GHASH code run their multi-block loops.
+ */
+#define GCM_CHUNK_SIZE (32 * GCM_BLOCK_SIZE)
+
+/* Reduction of the four bits shifted out when multiplying by x^4. */
+static const uint16_t gcm_last4[16] = {
+  0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+  0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0,
+};
+
+/* Fills key->h[i] with H multiplied by the 4-bit polynomial i. */
+static void
+gcm_init_key_table (struct gcm_key *key, const uint8_t *h)
+{
+  uint64_t vh, vl, mask;
+  unsigned int i, j;
+
+  vh = buff_get_be64 (h);
+  vl = buff_get_be64 (h + 8);
+
+  key->h[0][0] = 0;
+  key->h[0][1] = 0;
+  key->h[8][0] = vh;
+  key->h[8][1] = vl;
+  for (i = 4; i > 0; i >>= 1)
+    {
+      mask = -(vl & 1) & UINT64_C (0xe100000000000000);
+      vl = (vh << 63) | (vl >> 1);
+      vh = (vh >> 1) ^ mask;
+      key->h[i][0] = vh;
+      key->h[i][1] = vl;
+    }
+  for (i = 2; i <= 8; i *= 2)
+    for (j = 1; j < i; ++j)
+      {
+        key->h[i + j][0] = key->h[i][0] ^ key->h[j][0];
+        key->h[i + j][1] = key->h[i][1] ^ key->h[j][1];
+      }
+}
+
+/* Computes x = x * H, four bits at a time starting from the last byte. */
+static void
+gcm_mul_table (const struct gcm_key *key, uint64_t *x)
+{
+  uint64_t zh, zl, w;
+  unsigned int i, n, rem;
+
+  zh = 0;
+  zl = 0;
+  for (i = 32; i-- > 0;)
+    {
+      w = x[i / 16];
+      n = (w >> ((15 - i % 16) * 4)) & 0xf;
+      rem = zl & 0xf;
+      zl = (zh << 60) | (zl >> 4);
+      zh = (zh >> 4) ^ ((uint64_t)gcm_last4[rem] << 48);
+      zh ^= key->h[n][0];
+      zl ^= key->h[n][1];
+    }
+  x[0] = zh;
+  x[1] = zl;
+}
+
+static void
+gcm_ghash_table (const struct gcm_key *key, uint64_t *x, const uint8_t *data,
+                 size_t blocks)
+{
+  for (; blocks > 0; --blocks)
+    {
+      x[0] ^= buff_get_be64 (data);
+      x[1] ^= buff_get_be64 (data + 8);
+      gcm_mul_table (key, x);
+      data += GCM_BLOCK_SIZE;
+    }
+}
+
+const struct gcm_backend gcm_backend_table = {
+  "table",
+  gcm_init_key_table,
+  gcm_ghash_table,
+  NULL,
+};
+
+static const struct gcm_backend *gcm_backend = &gcm_backend_table;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+gcm_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+#if defined(HAVE_PCLMUL_INTRINSICS)
+#if defined(HAVE_AESNI_INTRINSICS)
+  if ((features & FCRYPT_CPU_PCLMUL) != 0
+      && (features & FCRYPT_CPU_SSSE3) != 0
+      && (features & FCRYPT_CPU_AESNI) != 0)
+    {
+      gcm_backend = &gcm_backend_pclmul_aesni;
+      return;
+    }
+#endif
+  if ((features & FCRYPT_CPU_PCLMUL) != 0
+      && (features & FCRYPT_CPU_SSSE3) != 0)
+    {
+      gcm_backend = &gcm_backend_pclmul;
+      return;
+    }
+#endif
+#if defined(HAVE_ARM_PMULL_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_PMULL) != 0)
+    {
+      gcm_backend = &gcm_backend_armv8;
+      return;
+    }
+#endif
+  (void)features;
+}
+#endif
+
+/* Encrypts or decrypts with the CTR mode function of the block cipher. */
+typedef void gcm_ctr_func (void *, uint8_t *, const uint8_t *, uint8_t *,
+                           size_t);
+
+/* Hashes data, padding a trailing partial block with zeros. */
+static void
+gcm_hash (const struct gcm_key *key, uint64_t *x, const uint8_t *data,
+          size_t len)
+{
+  uint8_t block[GCM_BLOCK_SIZE];
+  size_t blocks;
+
+  blocks = len / GCM_BLOCK_SIZE;
+  if (blocks > 0)
+    gcm_backend->ghash (key, x, data, blocks);
+  data += blocks * GCM_BLOCK_SIZE;
+  len -= blocks * GCM_BLOCK_SIZE;
+  if (len > 0)
+    {
+      memset (block, 0, sizeof (block));
+      memcpy (block, data, len);
+      gcm_backend->ghash (key, x, block, 1);
+    }
+}
+
+static void
+gcm_set_key (struct gcm_key *key, void *cipher, gcm_ctr_func *f)
+{
+  uint8_t ctr[GCM_BLOCK_SIZE];
+  uint8_t h[GCM_BLOCK_SIZE];
+
+  /* H is the encryption of the zero block. */
+  memset (ctr, 0, sizeof (ctr));
+  memset (h, 0, sizeof (h));
+  f (cipher, ctr, h, h, sizeof (h));
+  gcm_backend->init_key (key, h);
+  fcrypt_memzero (h, sizeof (h));
+}
+
+static void
+gcm_set_iv (struct gcm_ctx *ctx, const struct gcm_key *key, const uint8_t *iv,
+            size_t len)
+{
+  uint8_t block[GCM_BLOCK_SIZE];
+  uint32_t counter;
+
+  if (len == GCM_IV_SIZE)
+    {
+      memcpy (ctx->iv, iv, GCM_IV_SIZE);
+      buff_put_be32 (ctx->iv + GCM_IV_SIZE, 1);
+    }
+  else
+    {
+      ctx->x[0] = 0;
+      ctx->x[1] = 0;
+      gcm_hash (key, ctx->x, iv, len);
+      buff_put_be64 (block, 0);
+      buff_put_be64 (block + 8, (uint64_t)len * 8);
+      gcm_backend->ghash (key, ctx->x, block, 1);
+      buff_put_be64 (ctx->iv, ctx->x[0]);
+      buff_put_be64 (ctx->iv + 8, ctx->x[1]);
+    }
+
+  /* The first counter block is J0 incremented once, modulo 2^32. */
+  memcpy (ctx->ctr, ctx->iv, GCM_BLOCK_SIZE);
+  counter = buff_get_be32 (ctx->iv + 12) + 1;
+  buff_put_be32 (ctx->ctr + 12, counter);
+
+  ctx->x[0] = 0;
+  ctx->x[1] = 0;
+  ctx->auth_size = 0;
+  ctx->data_size = 0;
+}
+
+static void
+gcm_update (struct gcm_ctx *ctx, const struct gcm_key *key,
+            const uint8_t *data, size_t len)
+{
+  gcm_hash (key, ctx->x, data, len);
+  ctx->auth_size += len;
+}
+
+/*
+ * The backend may do most of the message in one pass. Otherwise the
+ * ciphertext is hashed a chunk at a time right before or after it is
+ * produced. GCM only increments the low 32 bits of the counter, so a chunk
+ * never crosses the point where they wrap, and the upper 96 bits that the
+ * 128-bit CTR mode may have carried into are restored afterwards.
+ */
+static void
+gcm_crypt (struct gcm_ctx *ctx, const struct gcm_key *key, void *cipher,
+           gcm_ctr_func *f, const uint32_t *ek, unsigned int rounds,
+           const uint8_t *src, uint8_t *dest, size_t len, int encrypt)
+{
+  uint64_t left;
+  size_t n;
+
+  ctx->data_size += len;
+  if (gcm_backend->aes_crypt != NULL)
+    {
+      n = len / (GCM_AGGREGATE_BLOCKS * GCM_BLOCK_SIZE) * GCM_AGGREGATE_BLOCKS;
+      gcm_backend->aes_crypt (ek, rounds, key, ctx->x, ctx->ctr, src, dest, n,
+                              encrypt);
+      src += n * GCM_BLOCK_SIZE;
+      dest += n * GCM_BLOCK_SIZE;
+      len -= n * GCM_BLOCK_SIZE;
+    }
+
+  while (len > 0)
+    {
+      n = len < GCM_CHUNK_SIZE ? len : GCM_CHUNK_SIZE;
+      left = (UINT64_C (1) << 32) - buff_get_be32 (ctx->ctr + 12);
+      if (n > left * GCM_BLOCK_SIZE)
+        n = (size_t)left * GCM_BLOCK_SIZE;
+
+      if (!encrypt)
+        gcm_hash (key, ctx->x, src, n);
+      f (cipher, ctx->ctr, src, dest, n);
+      memcpy (ctx->ctr, ctx->iv, GCM_BLOCK_SIZE - 4);
+      if (encrypt)
+        gcm_hash (key, ctx->x, dest, n);
+
+      src += n;
+      dest += n;
+      len -= n;
+    }
+}
+
+static void
+gcm_digest (struct gcm_ctx *ctx, const struct gcm_key *key, void *cipher,
+            gcm_ctr_func *f, uint8_t *digest)
+{
+  uint8_t block[GCM_BLOCK_SIZE];
+  uint8_t j0[GCM_BLOCK_SIZE];
+
+  buff_put_be64 (block, ctx->auth_size * 8);
+  buff_put_be64 (block + 8, ctx->data_size * 8);
+  gcm_backend->ghash (key, ctx->x, block, 1);
+
+  /* The tag is the hash encrypted with the counter block J0. */
+  buff_put_be64 (block, ctx->x[0]);
+  buff_put_be64 (block + 8, ctx->x[1]);
+  memcpy (j0, ctx->iv, sizeof (j0));
+  f (cipher, j0, block, digest, GCM_DIGEST_SIZE);
+}
+
+/* Compares the tags in constant time, clearing the output on a mismatch. */
+static int
+gcm_verify (const uint8_t *digest, const uint8_t *tag, uint8_t *dest,
+            size_t len)
+{
+  uint8_t diff;
+  size_t i;
+
+  diff = 0;
+  for (i = 0; i < GCM_DIGEST_SIZE; ++i)
+    diff |= digest[i] ^ tag[i];
+  if (diff != 0)
+    {
+      fcrypt_memzero (dest, len);
+      return -1;
+    }
+  return 0;
+}
+
+static void
+gcm_aes128_ctr (void *cipher, uint8_t *ctr, const uint8_t *src,
+                uint8_t *dest, size_t len)
+{
+  aes128_enc_ctr_crypt ((struct aes128_enc_ctx *)cipher, ctr, src, dest, len);
+}
+
+void
+aes128_gcm_set_key (struct aes128_gcm_ctx *ctx, const uint8_t *key)
+{
+  aes128_enc_set_key (&ctx->cipher, key);
+  gcm_set_key (&ctx->key, &ctx->cipher, gcm_aes128_ctr);
+}
+
+void
+aes128_gcm_set_iv (struct aes128_gcm_ctx *ctx, const uint8_t *iv,
+                   size_t len)
+{
+  gcm_set_iv (&ctx->gcm, &ctx->key, iv, len);
+}
+
+void
+aes128_gcm_update (struct aes128_gcm_ctx *ctx, const uint8_t *data,
+                   size_t len)
+{
+  gcm_update (&ctx->gcm, &ctx->key, data, len);
+}
+
+void
+aes128_gcm_encrypt (struct aes128_gcm_ctx *ctx, const uint8_t *src,
+                    uint8_t *dest, size_t len)
+{
+  gcm_crypt (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes128_ctr,
+             ctx->cipher.ek, AES128_ROUNDS, src, dest, len, 1);
+}
+
+void
+aes128_gcm_decrypt (struct aes128_gcm_ctx *ctx, const uint8_t *src,
+                    uint8_t *dest, size_t len)
+{
+  gcm_crypt (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes128_ctr,
+             ctx->cipher.ek, AES128_ROUNDS, src, dest, len, 0);
+}
+
+void
+aes128_gcm_digest (struct aes128_gcm_ctx *ctx, uint8_t *digest)
+{
+  gcm_digest (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes128_ctr, digest);
+}
+
+void
+aes128_gcm_seal (struct aes128_gcm_ctx *ctx, const uint8_t *iv,
+                 size_t iv_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len, uint8_t *tag)
+{
+  aes128_gcm_set_iv (ctx, iv, iv_len);
+  aes128_gcm_update (ctx, ad, ad_len);
+  aes128_gcm_encrypt (ctx, src, dest, len);
+  aes128_gcm_digest (ctx, tag);
+}
+
+int
+aes128_gcm_open (struct aes128_gcm_ctx *ctx, const uint8_t *iv,
+                 size_t iv_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len,
+                 const uint8_t *tag)
+{
+  uint8_t digest[GCM_DIGEST_SIZE];
+
+  aes128_gcm_set_iv (ctx, iv, iv_len);
+  aes128_gcm_update (ctx, ad, ad_len);
+  aes128_gcm_decrypt (ctx, src, dest, len);
+  aes128_gcm_digest (ctx, digest);
+  return gcm_verify (digest, tag, dest, len);
+}
+
+static void
+gcm_aes192_ctr (void *cipher, uint8_t *ctr, const uint8_t *src,
+                uint8_t *dest, size_t len)
+{
+  aes192_enc_ctr_crypt ((struct aes192_enc_ctx *)cipher, ctr, src, dest, len);
+}
+
+void
+aes192_gcm_set_key (struct aes192_gcm_ctx *ctx, const uint8_t *key)
+{
+  aes192_enc_set_key (&ctx->cipher, key);
+  gcm_set_key (&ctx->key, &ctx->cipher, gcm_aes192_ctr);
+}
+
+void
+aes192_gcm_set_iv (struct aes192_gcm_ctx *ctx, const uint8_t *iv,
+                   size_t len)
+{
+  gcm_set_iv (&ctx->gcm, &ctx->key, iv, len);
+}
+
+void
+aes192_gcm_update (struct aes192_gcm_ctx *ctx, const uint8_t *data,
+                   size_t len)
+{
+  gcm_update (&ctx->gcm, &ctx->key, data, len);
+}
+
+void
+aes192_gcm_encrypt (struct aes192_gcm_ctx *ctx, const uint8_t *src,
+                    uint8_t *dest, size_t len)
+{
+  gcm_crypt (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes192_ctr,
+             ctx->cipher.ek, AES192_ROUNDS, src, dest, len, 1);
+}
+
+void
+aes192_gcm_decrypt (struct aes192_gcm_ctx *ctx, const uint8_t *src,
+                    uint8_t *dest, size_t len)
+{
+  gcm_crypt (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes192_ctr,
+             ctx->cipher.ek, AES192_ROUNDS, src, dest, len, 0);
+}
+
+void
+aes192_gcm_digest (struct aes192_gcm_ctx *ctx, uint8_t *digest)
+{
+  gcm_digest (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes192_ctr, digest);
+}
+
+void
+aes192_gcm_seal (struct aes192_gcm_ctx *ctx, const uint8_t *iv,
+                 size_t iv_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len, uint8_t *tag)
+{
+  aes192_gcm_set_iv (ctx, iv, iv_len);
+  aes192_gcm_update (ctx, ad, ad_len);
+  aes192_gcm_encrypt (ctx, src, dest, len);
+  aes192_gcm_digest (ctx, tag);
+}
+
+int
+aes192_gcm_open (struct aes192_gcm_ctx *ctx, const uint8_t *iv,
+                 size_t iv_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len,
+                 const uint8_t *tag)
+{
+  uint8_t digest[GCM_DIGEST_SIZE];
+
+  aes192_gcm_set_iv (ctx, iv, iv_len);
+  aes192_gcm_update (ctx, ad, ad_len);
+  aes192_gcm_decrypt (ctx, src, dest, len);
+  aes192_gcm_digest (ctx, digest);
+  return gcm_verify (digest, tag, dest, len);
+}
+
+static void
+gcm_aes256_ctr (void *cipher, uint8_t *ctr, const uint8_t *src,
+                uint8_t *dest, size_t len)
+{
+  aes256_enc_ctr_crypt ((struct aes256_enc_ctx *)cipher, ctr, src, dest, len);
+}
+
+void
+aes256_gcm_set_key (struct aes256_gcm_ctx *ctx, const uint8_t *key)
+{
+  aes256_enc_set_key (&ctx->cipher, key);
+  gcm_set_key (&ctx->key, &ctx->cipher, gcm_aes256_ctr);
+}
+
+void
+aes256_gcm_set_iv (struct aes256_gcm_ctx *ctx, const uint8_t *iv,
+                   size_t len)
+{
+  gcm_set_iv (&ctx->gcm, &ctx->key, iv, len);
+}
+
+void
+aes256_gcm_update (struct aes256_gcm_ctx *ctx, const uint8_t *data,
+                   size_t len)
+{
+  gcm_update (&ctx->gcm, &ctx->key, data, len);
+}
+
+void
+aes256_gcm_encrypt (struct aes256_gcm_ctx *ctx, const uint8_t *src,
+                    uint8_t *dest, size_t len)
+{
+  gcm_crypt (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes256_ctr,
+             ctx->cipher.ek, AES256_ROUNDS, src, dest, len, 1);
+}
+
+void
+aes256_gcm_decrypt (struct aes256_gcm_ctx *ctx, const uint8_t *src,
+                    uint8_t *dest, size_t len)
+{
+  gcm_crypt (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes256_ctr,
+             ctx->cipher.ek, AES256_ROUNDS, src, dest, len, 0);
+}
+
+void
+aes256_gcm_digest (struct aes256_gcm_ctx *ctx, uint8_t *digest)
+{
+  gcm_digest (&ctx->gcm, &ctx->key, &ctx->cipher, gcm_aes256_ctr, digest);
+}
+
+void
+aes256_gcm_seal (struct aes256_gcm_ctx *ctx, const uint8_t *iv,
+                 size_t iv_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len, uint8_t *tag)
+{
+  aes256_gcm_set_iv (ctx, iv, iv_len);
+  aes256_gcm_update (ctx, ad, ad_len);
+  aes256_gcm_encrypt (ctx, src, dest, len);
+  aes256_gcm_digest (ctx, tag);
+}
+
+int
+aes256_gcm_open (struct aes256_gcm_ctx *ctx, const uint8_t *iv,
+                 size_t iv_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len,
+                 const uint8_t *tag)
+{
+  uint8_t digest[GCM_DIGEST_SIZE];
+
+  aes256_gcm_set_iv (ctx, iv, iv_len);
+  aes256_gcm_update (ctx, ad, ad_len);
+  aes256_gcm_decrypt (ctx, src, dest, len);
+  aes256_gcm_digest (ctx, digest);
+  return gcm_verify (digest, tag, dest, len);
+}
+
+/*
+ * POLYVAL is GHASH with the bytes of every block reversed and the key
+ * multiplied by x, as shown in RFC 8452 Appendix A, so AES-GCM-SIV runs on
+ * the same GHASH backend. The running hash then holds the reversed POLYVAL
+ * state.
+ */
+static void
+gcm_siv_init_key (struct gcm_key *key, const uint8_t *h)
+{
+  uint8_t block[GCM_BLOCK_SIZE];
+  uint64_t hi, lo, mask;
+
+  hi = buff_get_le64 (h + 8);
+  lo = buff_get_le64 (h);
+  mask = -(lo & 1) & UINT64_C (0xe100000000000000);
+  lo = (hi << 63) | (lo >> 1);
+  hi = (hi >> 1) ^ mask;
+  buff_put_be64 (block, hi);
+  buff_put_be64 (block + 8, lo);
+  gcm_backend->init_key (key, block);
+  fcrypt_memzero (block, sizeof (block));
+}
+
+/* Hashes data a chunk at a time, padding a trailing partial block. */
+static void
+gcm_siv_hash (const struct gcm_key *key, uint64_t *x, const uint8_t *data,
+              size_t len)
+{
+  uint8_t buffer[GCM_CHUNK_SIZE];
+  uint64_t hi, lo;
+  size_t blocks, i, n;
+
+  while (len > 0)
+    {
+      n = len < sizeof (buffer) ? len : sizeof (buffer);
+      blocks = (n + GCM_BLOCK_SIZE - 1) / GCM_BLOCK_SIZE;
+      memcpy (buffer, data, n);
+      memset (buffer + n, 0, blocks * GCM_BLOCK_SIZE - n);
+      for (i = 0; i < blocks * GCM_BLOCK_SIZE; i += GCM_BLOCK_SIZE)
+        {
+          hi = buff_get_le64 (buffer + i + 8);
+          lo = buff_get_le64 (buffer + i);
+          buff_put_be64 (buffer + i, hi);
+          buff_put_be64 (buffer + i + 8, lo);
+        }
+      gcm_backend->ghash (key, x, buffer, blocks);
+      data += n;
+      len -= n;
+    }
+}
+
+/* Encrypts whole blocks in ECB mode, taking a length in bytes. */
+typedef void gcm_siv_ecb_func (void *, const uint8_t *, uint8_t *, size_t);
+typedef void gcm_siv_set_key_func (void *, const uint8_t *);
+
+/*
+ * Derives the POLYVAL key and sets the per-message encryption key in cipher.
+ * Each derived block is the encryption of a little-endian counter followed
+ * by the nonce, of which the first half is used, and all of them are
+ * encrypted in one call.
+ */
+static void
+gcm_siv_derive (void *kgk, gcm_siv_ecb_func *ecb, void *cipher,
+                gcm_siv_set_key_func *set_key, size_t key_size,
+                const uint8_t *nonce, struct gcm_key *key)
+{
+  uint8_t blocks[(2 + AES256_KEY_SIZE / 8) * GCM_BLOCK_SIZE];
+  uint8_t derived[GCM_BLOCK_SIZE + AES256_KEY_SIZE];
+  size_t i, n;
+
+  n = 2 + key_size / 8;
+  for (i = 0; i < n; ++i)
+    {
+      buff_put_le32 (blocks + i * GCM_BLOCK_SIZE, (uint32_t)i);
+      memcpy (blocks + i * GCM_BLOCK_SIZE + 4, nonce, GCM_SIV_NONCE_SIZE);
+    }
+  ecb (kgk, blocks, blocks, n * GCM_BLOCK_SIZE);
+  for (i = 0; i < n; ++i)
+    memcpy (derived + i * 8, blocks + i * GCM_BLOCK_SIZE, 8);
+
+  gcm_siv_init_key (key, derived);
+  set_key (cipher, derived + GCM_BLOCK_SIZE);
+  fcrypt_memzero (blocks, sizeof (blocks));
+  fcrypt_memzero (derived, sizeof (derived));
+}
+
+static void
+gcm_siv_tag (const struct gcm_key *key, void *cipher, gcm_siv_ecb_func *ecb,
+             const uint8_t *nonce, const uint8_t *ad, size_t ad_len,
+             const uint8_t *data, size_t len, uint8_t *tag)
+{
+  uint8_t block[GCM_BLOCK_SIZE];
+  uint64_t x[2];
+  size_t i;
+
+  x[0] = 0;
+  x[1] = 0;
+  gcm_siv_hash (key, x, ad, ad_len);
+  gcm_siv_hash (key, x, data, len);
+  buff_put_le64 (block, (uint64_t)ad_len * 8);
+  buff_put_le64 (block + 8, (uint64_t)len * 8);
+  gcm_siv_hash (key, x, block, GCM_BLOCK_SIZE);
+
+  /* The tag is the encryption of the POLYVAL output mixed with the nonce. */
+  buff_put_le64 (block, x[1]);
+  buff_put_le64 (block + 8, x[0]);
+  for (i = 0; i < GCM_SIV_NONCE_SIZE; ++i)
+    block[i] ^= nonce[i];
+  block[15] &= 0x7f;
+  ecb (cipher, block, tag, GCM_SIV_DIGEST_SIZE);
+}
+
+/*
+ * CTR mode with the tag as the initial counter block, its top bit set, and
+ * the first four bytes as a little-endian counter that wraps at 2^32. The
+ * keystream for a chunk is generated with one call of the ECB code.
+ */
+static void
+gcm_siv_ctr (void *cipher, gcm_siv_ecb_func *ecb, const uint8_t *tag,
+             const uint8_t *src, uint8_t *dest, size_t len)
+{
+  uint8_t keystream[GCM_CHUNK_SIZE];
+  uint8_t ctr[GCM_BLOCK_SIZE];
+  uint32_t counter;
+  size_t blocks, i, n;
+
+  memcpy (ctr, tag, sizeof (ctr));
+  ctr[15] |= 0x80;
+  counter = buff_get_le32 (ctr);
+  while (len > 0)
+    {
+      n = len < sizeof (keystream) ? len : sizeof (keystream);
+      blocks = (n + GCM_BLOCK_SIZE - 1) / GCM_BLOCK_SIZE;
+      for (i = 0; i < blocks; ++i)
+        {
+          buff_put_le32 (ctr, counter++);
+          memcpy (keystream + i * GCM_BLOCK_SIZE, ctr, GCM_BLOCK_SIZE);
+        }
+      ecb (cipher, keystream, keystream, blocks * GCM_BLOCK_SIZE);
+      for (i = 0; i < n; ++i)
+        dest[i] = src[i] ^ keystream[i];
+      src += n;
+      dest += n;
+      len -= n;
+    }
+  fcrypt_memzero (keystream, sizeof (keystream));
+}
+
+static int
+gcm_siv_seal (void *kgk, void *cipher, size_t cipher_size,
+              gcm_siv_ecb_func *ecb, gcm_siv_set_key_func *set_key,
+              size_t key_size, const uint8_t *nonce, const uint8_t *ad,
+              size_t ad_len, const uint8_t *src, uint8_t *dest, size_t len,
+              uint8_t *tag)
+{
+  struct gcm_key key;
+
+  if ((uint64_t)ad_len > GCM_SIV_MAX_SIZE || (uint64_t)len > GCM_SIV_MAX_SIZE)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  gcm_siv_derive (kgk, ecb, cipher, set_key, key_size, nonce, &key);
+  gcm_siv_tag (&key, cipher, ecb, nonce, ad, ad_len, src, len, tag);
+  gcm_siv_ctr (cipher, ecb, tag, src, dest, len);
+  fcrypt_memzero (&key, sizeof (key));
+  fcrypt_memzero (cipher, cipher_size);
+  return 0;
+}
+
+static int
+gcm_siv_open (void *kgk, void *cipher, size_t cipher_size,
+              gcm_siv_ecb_func *ecb, gcm_siv_set_key_func *set_key,
+              size_t key_size, const uint8_t *nonce, const uint8_t *ad,
+              size_t ad_len, const uint8_t *src, uint8_t *dest, size_t len,
+              const uint8_t *tag)
+{
+  struct gcm_key key;
+  uint8_t digest[GCM_SIV_DIGEST_SIZE];
+
+  if ((uint64_t)ad_len > GCM_SIV_MAX_SIZE || (uint64_t)len > GCM_SIV_MAX_SIZE)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  gcm_siv_derive (kgk, ecb, cipher, set_key, key_size, nonce, &key);
+  gcm_siv_ctr (cipher, ecb, tag, src, dest, len);
+  gcm_siv_tag (&key, cipher, ecb, nonce, ad, ad_len, dest, len, digest);
+  fcrypt_memzero (&key, sizeof (key));
+  fcrypt_memzero (cipher, cipher_size);
+  return gcm_verify (digest, tag, dest, len);
+}
+
+static void
+gcm_siv_aes128_ecb (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes128_enc_ecb_encrypt ((struct aes128_enc_ctx *)cipher, src, dest, len);
+}
+
+static void
+gcm_siv_aes128_set_key (void *cipher, const uint8_t *key)
+{
+  aes128_enc_set_key ((struct aes128_enc_ctx *)cipher, key);
+}
+
+void
+aes128_gcm_siv_set_key (struct aes128_gcm_siv_ctx *ctx, const uint8_t *key)
+{
+  aes128_enc_set_key (&ctx->cipher, key);
+}
+
+int
+aes128_gcm_siv_seal (struct aes128_gcm_siv_ctx *ctx, const uint8_t *nonce,
+                     const uint8_t *ad, size_t ad_len, const uint8_t *src,
+                     uint8_t *dest, size_t len, uint8_t *tag)
+{
+  struct aes128_enc_ctx cipher;
+
+  return gcm_siv_seal (&ctx->cipher, &cipher, sizeof (cipher),
+                       gcm_siv_aes128_ecb, gcm_siv_aes128_set_key,
+                       AES128_KEY_SIZE, nonce, ad, ad_len, src, dest, len,
+                       tag);
+}
+
+int
+aes128_gcm_siv_open (struct aes128_gcm_siv_ctx *ctx, const uint8_t *nonce,
+                     const uint8_t *ad, size_t ad_len, const uint8_t *src,
+                     uint8_t *dest, size_t len, const uint8_t *tag)
+{
+  struct aes128_enc_ctx cipher;
+
+  return gcm_siv_open (&ctx->cipher, &cipher, sizeof (cipher),
+                       gcm_siv_aes128_ecb, gcm_siv_aes128_set_key,
+                       AES128_KEY_SIZE, nonce, ad, ad_len, src, dest, len,
+                       tag);
+}
+
+static void
+gcm_siv_aes256_ecb (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes256_enc_ecb_encrypt ((struct aes256_enc_ctx *)cipher, src, dest, len);
+}
+
+static void
+gcm_siv_aes256_set_key (void *cipher, const uint8_t *key)
+{
+  aes256_enc_set_key ((struct aes256_enc_ctx *)cipher, key);
+}
+
+void
+aes256_gcm_siv_set_key (struct aes256_gcm_siv_ctx *ctx, const uint8_t *key)
+{
+  aes256_enc_set_key (&ctx->cipher, key);
+}
+
+int
+aes256_gcm_siv_seal (struct aes256_gcm_siv_ctx *ctx, const uint8_t *nonce,
+                     const uint8_t *ad, size_t ad_len, const uint8_t *src,
+                     uint8_t *dest, size_t len, uint8_t *tag)
+{
+  struct aes256_enc_ctx cipher;
+
+  return gcm_siv_seal (&ctx->cipher, &cipher, sizeof (cipher),
+                       gcm_siv_aes256_ecb, gcm_siv_aes256_set_key,
+                       AES256_KEY_SIZE, nonce, ad, ad_len, src, dest, len,
+                       tag);
+}
+
+int
+aes256_gcm_siv_open (struct aes256_gcm_siv_ctx *ctx, const uint8_t *nonce,
+                     const uint8_t *ad, size_t ad_len, const uint8_t *src,
+                     uint8_t *dest, size_t len, const uint8_t *tag)
+{
+  struct aes256_enc_ctx cipher;
+
+  return gcm_siv_open (&ctx->cipher, &cipher, sizeof (cipher),
+                       gcm_siv_aes256_ecb, gcm_siv_aes256_set_key,
+                       AES256_KEY_SIZE, nonce, ad, ad_len, src, dest, len,
+                       tag);
+}
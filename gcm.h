@@ -0,0 +1,180 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Galois/Counter Mode as described in NIST SP 800-38D, "Recommendation for
+ * Block Cipher Modes of Operation: Galois/Counter Mode (GCM) and GMAC".
+ */
+
+#ifndef GCM_H
+#define GCM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aes.h"
+
+#define GCM_BLOCK_SIZE 16
+#define GCM_IV_SIZE 12
+#define GCM_DIGEST_SIZE 16
+
+/* Number of 128-bit entries precomputed from the hash subkey H. */
+#define GCM_TABLE_SIZE 16
+
+/*
+ * Precomputed multiples of H. The GHASH implementation selected at runtime
+ * decides the layout: either the 4-bit multiplication table or the powers
+ * H^1 through H^8 used to hash eight blocks with a single reduction.
+ */
+struct gcm_key
+{
+  uint64_t h[GCM_TABLE_SIZE][2];
+};
+
+struct gcm_ctx
+{
+  uint64_t x[2];
+  uint8_t iv[GCM_BLOCK_SIZE];
+  uint8_t ctr[GCM_BLOCK_SIZE];
+  uint64_t auth_size;
+  uint64_t data_size;
+};
+
+struct aes128_gcm_ctx
+{
+  struct aes128_enc_ctx cipher;
+  struct gcm_key key;
+  struct gcm_ctx gcm;
+};
+
+struct aes192_gcm_ctx
+{
+  struct aes192_enc_ctx cipher;
+  struct gcm_key key;
+  struct gcm_ctx gcm;
+};
+
+struct aes256_gcm_ctx
+{
+  struct aes256_enc_ctx cipher;
+  struct gcm_key key;
+  struct gcm_ctx gcm;
+};
+
+/*
+ * Streaming interface. After setting the IV, the associated data is passed to
+ * update followed by the message to encrypt or decrypt, then digest writes
+ * the GCM_DIGEST_SIZE byte tag. Only the last update and the last encrypt or
+ * decrypt call may have a length that is not a multiple of GCM_BLOCK_SIZE.
+ */
+void aes128_gcm_set_key (struct aes128_gcm_ctx *, const uint8_t *);
+void aes192_gcm_set_key (struct aes192_gcm_ctx *, const uint8_t *);
+void aes256_gcm_set_key (struct aes256_gcm_ctx *, const uint8_t *);
+void aes128_gcm_set_iv (struct aes128_gcm_ctx *, const uint8_t *, size_t);
+void aes192_gcm_set_iv (struct aes192_gcm_ctx *, const uint8_t *, size_t);
+void aes256_gcm_set_iv (struct aes256_gcm_ctx *, const uint8_t *, size_t);
+void aes128_gcm_update (struct aes128_gcm_ctx *, const uint8_t *, size_t);
+void aes192_gcm_update (struct aes192_gcm_ctx *, const uint8_t *, size_t);
+void aes256_gcm_update (struct aes256_gcm_ctx *, const uint8_t *, size_t);
+void aes128_gcm_encrypt (struct aes128_gcm_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes192_gcm_encrypt (struct aes192_gcm_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes256_gcm_encrypt (struct aes256_gcm_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes128_gcm_decrypt (struct aes128_gcm_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes192_gcm_decrypt (struct aes192_gcm_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes256_gcm_decrypt (struct aes256_gcm_ctx *, const uint8_t *, uint8_t *,
+                         size_t);
+void aes128_gcm_digest (struct aes128_gcm_ctx *, uint8_t *);
+void aes192_gcm_digest (struct aes192_gcm_ctx *, uint8_t *);
+void aes256_gcm_digest (struct aes256_gcm_ctx *, uint8_t *);
+
+/*
+ * One-shot interface. The arguments are the IV, the associated data, the
+ * input, the output and its length, and the tag. Open returns 0 if the tag
+ * matches and -1 otherwise, in which case the output is cleared.
+ */
+void aes128_gcm_seal (struct aes128_gcm_ctx *, const uint8_t *, size_t,
+                      const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                      size_t, uint8_t *);
+void aes192_gcm_seal (struct aes192_gcm_ctx *, const uint8_t *, size_t,
+                      const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                      size_t, uint8_t *);
+void aes256_gcm_seal (struct aes256_gcm_ctx *, const uint8_t *, size_t,
+                      const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                      size_t, uint8_t *);
+int aes128_gcm_open (struct aes128_gcm_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, const uint8_t *);
+int aes192_gcm_open (struct aes192_gcm_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, const uint8_t *);
+int aes256_gcm_open (struct aes256_gcm_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, const uint8_t *);
+
+/*
+ * AES-GCM-SIV as described in RFC 8452, a nonce misuse resistant AEAD.
+ * Fresh authentication and encryption keys are derived from the key and
+ * nonce for every message. The tag is computed with POLYVAL over the
+ * plaintext and doubles as the initial counter block, so the message is
+ * processed twice and there is only a one-shot interface. Seal and open
+ * return -1 with errno set to EINVAL if the plaintext or the associated
+ * data is longer than GCM_SIV_MAX_SIZE bytes. Open also returns -1 if the
+ * tag does not match, in which case the output is cleared.
+ */
+#define GCM_SIV_NONCE_SIZE 12
+#define GCM_SIV_DIGEST_SIZE 16
+#define GCM_SIV_MAX_SIZE (UINT64_C (1) << 36)
+
+struct aes128_gcm_siv_ctx
+{
+  struct aes128_enc_ctx cipher;
+};
+
+struct aes256_gcm_siv_ctx
+{
+  struct aes256_enc_ctx cipher;
+};
+
+void aes128_gcm_siv_set_key (struct aes128_gcm_siv_ctx *, const uint8_t *);
+void aes256_gcm_siv_set_key (struct aes256_gcm_siv_ctx *, const uint8_t *);
+int aes128_gcm_siv_seal (struct aes128_gcm_siv_ctx *, const uint8_t *,
+                         const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                         size_t, uint8_t *);
+int aes256_gcm_siv_seal (struct aes256_gcm_siv_ctx *, const uint8_t *,
+                         const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                         size_t, uint8_t *);
+int aes128_gcm_siv_open (struct aes128_gcm_siv_ctx *, const uint8_t *,
+                         const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                         size_t, const uint8_t *);
+int aes256_gcm_siv_open (struct aes256_gcm_siv_ctx *, const uint8_t *,
+                         const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                         size_t, const uint8_t *);
+
+#endif /* GCM_H */
@@ -0,0 +1,98 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gear-table.h"
+#include "gear.h"
+
+#define GEAR_STEP(h, c) (((h) << 1) + gear_table[(c)])
+
+uint64_t
+gear_update (uint64_t hash, const void *inputptr, size_t len)
+{
+  const uint8_t *input = inputptr;
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    hash = GEAR_STEP (hash, input[i]);
+  return hash;
+}
+
+/*
+ * The hash only depends on itself through a shift and an add, so one byte
+ * takes about a cycle. The loop is unrolled by four to keep the test of
+ * each hash and the loop overhead off that path.
+ */
+size_t
+gear_scan (uint64_t *hashptr, const void *inputptr, size_t len, uint64_t mask)
+{
+  const uint8_t *input = inputptr;
+  uint64_t hash;
+  size_t i;
+
+  hash = *hashptr;
+  for (i = 0; i + 4 <= len; i += 4)
+    {
+      hash = GEAR_STEP (hash, input[i]);
+      if ((hash & mask) == 0)
+        {
+          *hashptr = hash;
+          return i + 1;
+        }
+      hash = GEAR_STEP (hash, input[i + 1]);
+      if ((hash & mask) == 0)
+        {
+          *hashptr = hash;
+          return i + 2;
+        }
+      hash = GEAR_STEP (hash, input[i + 2]);
+      if ((hash & mask) == 0)
+        {
+          *hashptr = hash;
+          return i + 3;
+        }
+      hash = GEAR_STEP (hash, input[i + 3]);
+      if ((hash & mask) == 0)
+        {
+          *hashptr = hash;
+          return i + 4;
+        }
+    }
+  for (; i < len; ++i)
+    {
+      hash = GEAR_STEP (hash, input[i]);
+      if ((hash & mask) == 0)
+        {
+          *hashptr = hash;
+          return i + 1;
+        }
+    }
+  *hashptr = hash;
+  return len;
+}
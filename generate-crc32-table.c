@@ -26,32 +26,145 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
-/* Table to compute. */
-static uint32_t crc32_table[256];
+#include "crc32-internal.h"
 
-static void build_crc32_table (void);
-static void print_cformat_crc32_table (void);
+/* Number of tables for slicing-by-16, the first is the bytewise table. */
+#define CRC32_SLICES 16
 
-int
-main (void)
-{
-  build_crc32_table ();
-  print_cformat_crc32_table ();
-  return 0;
-}
+/* Slicing-by-8 for CRC-64, whose table entries are twice as large. */
+#define CRC64_SLICES 8
 
 /*
- * Computes the lookup table for the CRC-32 with the polynomial representation
- * of: x^32 + x^26 + x^23 + x^22 + x^16 + x^12 + x^11 + x^10 + x^8 + ^x7 +
+ * CRC-32 with the polynomial representation of:
+ * x^32 + x^26 + x^23 + x^22 + x^16 + x^12 + x^11 + x^10 + x^8 + x^7 +
  *	x^5 + x^4 + x^2 + x + 1
  * Hex representation:         0x04c11db7
  * Reverse hex representation: 0xedb88320
  */
+#define CRC32_POLY 0xedb88320
+
+/*
+ * CRC-32C (Castagnoli) from RFC 3720, used by iSCSI, SCTP and ext4:
+ * Hex representation:         0x1edc6f41
+ * Reverse hex representation: 0x82f63b78
+ */
+#define CRC32C_POLY 0x82f63b78
+
+/*
+ * CRC-64 from ECMA-182, as used by xz:
+ * Hex representation:         0x42f0e1eba9ea3693
+ * Reverse hex representation: 0xc96c5795d7870f42
+ */
+#define CRC64_POLY UINT64_C (0xc96c5795d7870f42)
+
+/* Tables to compute. */
+static uint32_t crc32_table[CRC32_SLICES][256];
+static uint32_t crc32c_table[CRC32_SLICES][256];
+static uint32_t crc32c_long_table[4][256];
+static uint32_t crc32c_short_table[4][256];
+static uint64_t crc64_table[CRC64_SLICES][256];
+
+static void build_crc32_table (uint32_t (*)[256], uint32_t);
+static void build_crc32_shift_table (uint32_t (*)[256], uint32_t (*)[256],
+                                     uint32_t);
+static void build_crc64_table (void);
+static void print_cformat_crc32_table (const char *, uint32_t (*)[256],
+                                       int);
+static void print_cformat_crc64_table (void);
+
+int
+main (int argc, char **argv)
+{
+  if (argc > 1 && strcmp (argv[1], "crc64") == 0)
+    {
+      build_crc64_table ();
+      printf ("/* Generated by generate-crc32-table.c, do not edit. */\n\n");
+      printf ("#ifndef CRC64_TABLES_H\n#define CRC64_TABLES_H\n\n");
+      printf ("#include <stdint.h>\n\n");
+      print_cformat_crc64_table ();
+      printf ("\n#endif /* CRC64_TABLES_H */\n");
+      return ferror (stdout) != 0 || fflush (stdout) != 0;
+    }
+
+  build_crc32_table (crc32_table, CRC32_POLY);
+  build_crc32_table (crc32c_table, CRC32C_POLY);
+  build_crc32_shift_table (crc32c_long_table, crc32c_table, CRC32C_LONG);
+  build_crc32_shift_table (crc32c_short_table, crc32c_table, CRC32C_SHORT);
+  printf ("/* Generated by generate-crc32-table.c, do not edit. */\n\n");
+  printf ("#ifndef CRC32_TABLES_H\n#define CRC32_TABLES_H\n\n");
+  printf ("#include <stdint.h>\n\n");
+  print_cformat_crc32_table ("crc32_table", crc32_table, CRC32_SLICES);
+  printf ("\n");
+  print_cformat_crc32_table ("crc32c_table", crc32c_table, CRC32_SLICES);
+  printf ("\n/* Append CRC32C_LONG and CRC32C_SHORT zero bytes. */\n");
+  print_cformat_crc32_table ("crc32c_long_table", crc32c_long_table, 4);
+  printf ("\n");
+  print_cformat_crc32_table ("crc32c_short_table", crc32c_short_table, 4);
+  printf ("\n#endif /* CRC32_TABLES_H */\n");
+  return ferror (stdout) != 0 || fflush (stdout) != 0;
+}
+
+/*
+ * Computes the lookup tables for a bit reflected 32-bit CRC polynomial.
+ *
+ * Table k gives the CRC of a byte followed by k zero bytes, so that slicing
+ * can fold k + 1 bytes with one lookup per byte.
+ */
+static void
+build_crc32_table (uint32_t (*table)[256], uint32_t poly)
+{
+  uint32_t i, j, k, curr;
+
+  for (i = 0; i < 256; ++i)
+    {
+      curr = i;
+      for (j = 0; j < 8; ++j)
+        {
+          if ((curr & 1) != 0)
+            curr = poly ^ (curr >> 1);
+          else
+            curr = curr >> 1;
+        }
+      table[0][i] = curr;
+    }
+  for (k = 1; k < CRC32_SLICES; ++k)
+    for (i = 0; i < 256; ++i)
+      {
+        curr = table[k - 1][i];
+        table[k][i] = table[0][curr & 0xff] ^ (curr >> 8);
+      }
+}
+
+/*
+ * Computes the tables that append len zero bytes to a CRC register, given
+ * the bytewise table of its polynomial. This is linear in the register, so
+ * table k holds the result for byte k of the register on its own and the
+ * four lookups are XORed together.
+ */
+static void
+build_crc32_shift_table (uint32_t (*table)[256], uint32_t (*bytewise)[256],
+                         uint32_t len)
+{
+  uint32_t i, j, k, curr;
+
+  for (k = 0; k < 4; ++k)
+    for (i = 0; i < 256; ++i)
+      {
+        curr = i << (8 * k);
+        for (j = 0; j < len; ++j)
+          curr = bytewise[0][curr & 0xff] ^ (curr >> 8);
+        table[k][i] = curr;
+      }
+}
+
+/* The same as build_crc32_table for the 64-bit polynomial. */
 static void
-build_crc32_table (void)
+build_crc64_table (void)
 {
-  uint32_t i, j, curr;
+  uint64_t curr;
+  uint32_t i, j, k;
 
   for (i = 0; i < 256; ++i)
     {
@@ -59,34 +172,66 @@ build_crc32_table (void)
       for (j = 0; j < 8; ++j)
         {
           if ((curr & 1) != 0)
-            curr = 0xedb88320 ^ (curr >> 1);
+            curr = CRC64_POLY ^ (curr >> 1);
           else
             curr = curr >> 1;
         }
-      crc32_table[i] = curr;
+      crc64_table[0][i] = curr;
+    }
+  for (k = 1; k < CRC64_SLICES; ++k)
+    for (i = 0; i < 256; ++i)
+      {
+        curr = crc64_table[k - 1][i];
+        crc64_table[k][i] = crc64_table[0][curr & 0xff] ^ (curr >> 8);
+      }
+}
+
+static void
+print_cformat_crc32_table (const char *name, uint32_t (*table)[256],
+                           int slices)
+{
+  int i, k;
+
+  printf ("static const uint32_t %s[%d][256] = {\n", name, slices);
+  for (k = 0; k < slices; ++k)
+    {
+      printf ("  {\n");
+      for (i = 0; i < 256; ++i)
+        {
+          if (i % 6 == 0)
+            printf ("      ");
+          printf ("0x%08x,", table[k][i]);
+          if (i % 6 == 5 || i == 255)
+            printf ("\n");
+          else
+            printf (" ");
+        }
+      printf ("  },\n");
     }
+  printf ("};\n");
 }
 
 static void
-print_cformat_crc32_table (void)
+print_cformat_crc64_table (void)
 {
-  uint32_t i, val;
+  int i, k;
 
-  printf ("static const uint32_t crc32_table[256] = {\n");
-  for (i = 1; i <= 256; ++i)
+  printf ("static const uint64_t crc64_table[%d][256] = {\n", CRC64_SLICES);
+  for (k = 0; k < CRC64_SLICES; ++k)
     {
-      val = crc32_table[i - 1];
-      switch (i & 3)
+      printf ("  {\n");
+      for (i = 0; i < 256; ++i)
         {
-        case 0:
-          printf ("0x%08x,\n", val);
-          break;
-        case 1:
-          printf ("\t0x%08x, ", val);
-          break;
-        default:
-          printf ("0x%08x, ", val);
+          if (i % 2 == 0)
+            printf ("      ");
+          printf ("UINT64_C (0x%016llx),",
+                  (unsigned long long)crc64_table[k][i]);
+          if (i % 2 == 1)
+            printf ("\n");
+          else
+            printf (" ");
         }
+      printf ("  },\n");
     }
   printf ("};\n");
 }
@@ -30,13 +30,16 @@
  * Standards Number: TTAS.KO-12.0011/R1
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "bswap.h"
 #include "circularshift.h"
-#include "fcrypt_memzero.h"
+#include "fcrypt_md.h"
+#include "fcrypt_wipe.h"
 #include "has160.h"
 
 /*
@@ -101,194 +104,295 @@ has160_init (struct has160_ctx *ctx)
   ctx->count = 0;
 }
 
-void
-has160_transform (uint32_t *state, const uint8_t *block)
-{
-  uint32_t a, b, c, d, e, i;
-  uint32_t x[20];
+#if defined(FCRYPT_SMALL)
+/* Message word of each step, where 16 to 19 are the XORed words. */
+static const uint8_t has160_l[80] = {
+  18, 0, 1, 2, 3, 19, 4, 5, 6, 7,
+  16, 8, 9, 10, 11, 17, 12, 13, 14, 15,
+  18, 3, 6, 9, 12, 19, 15, 2, 5, 8,
+  16, 11, 14, 1, 4, 17, 7, 10, 13, 0,
+  18, 12, 5, 14, 7, 19, 0, 9, 2, 11,
+  16, 4, 13, 6, 15, 17, 8, 1, 10, 3,
+  18, 7, 2, 13, 8, 19, 3, 14, 9, 4,
+  16, 15, 10, 5, 0, 17, 11, 6, 1, 12
+};
+
+/* The words XORed into x[16] to x[19] in each round, four for each. */
+static const uint8_t has160_x[4][16] = {
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+  { 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0 },
+  { 12, 5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3 },
+  { 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5, 0, 11, 6, 1, 12 },
+};
+
+static const uint8_t has160_s[20] = {
+  5, 11, 7, 15, 6, 13, 8, 14, 7, 12, 9, 11, 8, 15, 6, 12, 9, 14, 5, 13
+};
 
-  for (i = 0; i < 16; ++i)
-    x[i] = buff_get_le32 (block + i * 4);
-
-  a = state[0];
-  b = state[1];
-  c = state[2];
-  d = state[3];
-  e = state[4];
-
-  x[16] = x[0] ^ x[1] ^ x[2] ^ x[3];
-  x[17] = x[4] ^ x[5] ^ x[6] ^ x[7];
-  x[18] = x[8] ^ x[9] ^ x[10] ^ x[11];
-  x[19] = x[12] ^ x[13] ^ x[14] ^ x[15];
-  STEP1 (a, b, c, d, e, x[18], 5);
-  STEP1 (e, a, b, c, d, x[0], 11);
-  STEP1 (d, e, a, b, c, x[1], 7);
-  STEP1 (c, d, e, a, b, x[2], 15);
-  STEP1 (b, c, d, e, a, x[3], 6);
-  STEP1 (a, b, c, d, e, x[19], 13);
-  STEP1 (e, a, b, c, d, x[4], 8);
-  STEP1 (d, e, a, b, c, x[5], 14);
-  STEP1 (c, d, e, a, b, x[6], 7);
-  STEP1 (b, c, d, e, a, x[7], 12);
-  STEP1 (a, b, c, d, e, x[16], 9);
-  STEP1 (e, a, b, c, d, x[8], 11);
-  STEP1 (d, e, a, b, c, x[9], 8);
-  STEP1 (c, d, e, a, b, x[10], 15);
-  STEP1 (b, c, d, e, a, x[11], 6);
-  STEP1 (a, b, c, d, e, x[17], 12);
-  STEP1 (e, a, b, c, d, x[12], 9);
-  STEP1 (d, e, a, b, c, x[13], 14);
-  STEP1 (c, d, e, a, b, x[14], 5);
-  STEP1 (b, c, d, e, a, x[15], 13);
-
-  x[16] = x[3] ^ x[6] ^ x[9] ^ x[12];
-  x[17] = x[15] ^ x[2] ^ x[5] ^ x[8];
-  x[18] = x[11] ^ x[14] ^ x[1] ^ x[4];
-  x[19] = x[7] ^ x[10] ^ x[13] ^ x[0];
-  STEP2 (a, b, c, d, e, x[18], 5);
-  STEP2 (e, a, b, c, d, x[3], 11);
-  STEP2 (d, e, a, b, c, x[6], 7);
-  STEP2 (c, d, e, a, b, x[9], 15);
-  STEP2 (b, c, d, e, a, x[12], 6);
-  STEP2 (a, b, c, d, e, x[19], 13);
-  STEP2 (e, a, b, c, d, x[15], 8);
-  STEP2 (d, e, a, b, c, x[2], 14);
-  STEP2 (c, d, e, a, b, x[5], 7);
-  STEP2 (b, c, d, e, a, x[8], 12);
-  STEP2 (a, b, c, d, e, x[16], 9);
-  STEP2 (e, a, b, c, d, x[11], 11);
-  STEP2 (d, e, a, b, c, x[14], 8);
-  STEP2 (c, d, e, a, b, x[1], 15);
-  STEP2 (b, c, d, e, a, x[4], 6);
-  STEP2 (a, b, c, d, e, x[17], 12);
-  STEP2 (e, a, b, c, d, x[7], 9);
-  STEP2 (d, e, a, b, c, x[10], 14);
-  STEP2 (c, d, e, a, b, x[13], 5);
-  STEP2 (b, c, d, e, a, x[0], 13);
-
-  x[16] = x[12] ^ x[5] ^ x[14] ^ x[7];
-  x[17] = x[0] ^ x[9] ^ x[2] ^ x[11];
-  x[18] = x[4] ^ x[13] ^ x[6] ^ x[15];
-  x[19] = x[8] ^ x[1] ^ x[10] ^ x[3];
-  STEP3 (a, b, c, d, e, x[18], 5);
-  STEP3 (e, a, b, c, d, x[12], 11);
-  STEP3 (d, e, a, b, c, x[5], 7);
-  STEP3 (c, d, e, a, b, x[14], 15);
-  STEP3 (b, c, d, e, a, x[7], 6);
-  STEP3 (a, b, c, d, e, x[19], 13);
-  STEP3 (e, a, b, c, d, x[0], 8);
-  STEP3 (d, e, a, b, c, x[9], 14);
-  STEP3 (c, d, e, a, b, x[2], 7);
-  STEP3 (b, c, d, e, a, x[11], 12);
-  STEP3 (a, b, c, d, e, x[16], 9);
-  STEP3 (e, a, b, c, d, x[4], 11);
-  STEP3 (d, e, a, b, c, x[13], 8);
-  STEP3 (c, d, e, a, b, x[6], 15);
-  STEP3 (b, c, d, e, a, x[15], 6);
-  STEP3 (a, b, c, d, e, x[17], 12);
-  STEP3 (e, a, b, c, d, x[8], 9);
-  STEP3 (d, e, a, b, c, x[1], 14);
-  STEP3 (c, d, e, a, b, x[10], 5);
-  STEP3 (b, c, d, e, a, x[3], 13);
-
-  x[16] = x[7] ^ x[2] ^ x[13] ^ x[8];
-  x[17] = x[3] ^ x[14] ^ x[9] ^ x[4];
-  x[18] = x[15] ^ x[10] ^ x[5] ^ x[0];
-  x[19] = x[11] ^ x[6] ^ x[1] ^ x[12];
-  STEP4 (a, b, c, d, e, x[18], 5);
-  STEP4 (e, a, b, c, d, x[7], 11);
-  STEP4 (d, e, a, b, c, x[2], 7);
-  STEP4 (c, d, e, a, b, x[13], 15);
-  STEP4 (b, c, d, e, a, x[8], 6);
-  STEP4 (a, b, c, d, e, x[19], 13);
-  STEP4 (e, a, b, c, d, x[3], 8);
-  STEP4 (d, e, a, b, c, x[14], 14);
-  STEP4 (c, d, e, a, b, x[9], 7);
-  STEP4 (b, c, d, e, a, x[4], 12);
-  STEP4 (a, b, c, d, e, x[16], 9);
-  STEP4 (e, a, b, c, d, x[15], 11);
-  STEP4 (d, e, a, b, c, x[10], 8);
-  STEP4 (c, d, e, a, b, x[5], 15);
-  STEP4 (b, c, d, e, a, x[0], 6);
-  STEP4 (a, b, c, d, e, x[17], 12);
-  STEP4 (e, a, b, c, d, x[11], 9);
-  STEP4 (d, e, a, b, c, x[6], 14);
-  STEP4 (c, d, e, a, b, x[1], 5);
-  STEP4 (b, c, d, e, a, x[12], 13);
-
-  state[0] += a;
-  state[1] += b;
-  state[2] += c;
-  state[3] += d;
-  state[4] += e;
+static const uint32_t has160_k[4] = { 0, K2, K3, K4 };
+static const uint8_t has160_rot[4] = { 10, 17, 25, 30 };
+
+static inline uint32_t
+has160_f (unsigned int r, uint32_t b, uint32_t c, uint32_t d)
+{
+  switch (r)
+    {
+    case 0:
+      return F1 (b, c, d);
+    case 1:
+      return F2 (b, c, d);
+    case 2:
+      return F3 (b, c, d);
+    default:
+      return F4 (b, c, d);
+    }
 }
 
+/* One loop over the 80 steps for builds that favor code size. */
 void
-has160_update (struct has160_ctx *ctx, const void *inputptr, size_t inputlen)
+has160_transform_blocks (uint32_t *state, const uint8_t *blocks,
+                         size_t nblocks)
 {
-  size_t filled, need;
-  const uint8_t *input = inputptr;
+  uint32_t h0, h1, h2, h3, h4;
+  uint32_t a, b, c, d, e, i, r, t;
+  uint32_t x[20];
+  const uint8_t *p;
 
-  /* Nothing to do */
-  if (inputlen == 0)
-    return;
+  h0 = state[0];
+  h1 = state[1];
+  h2 = state[2];
+  h3 = state[3];
+  h4 = state[4];
+  for (; nblocks > 0; --nblocks, blocks += HAS160_BLOCK_SIZE)
+    {
+      buff_get_le32_words (x, blocks, 16);
 
-  filled = (size_t)((ctx->count >> 3) & (HAS160_BLOCK_SIZE - 1));
-  ctx->count += (inputlen << 3);
+      a = h0;
+      b = h1;
+      c = h2;
+      d = h3;
+      e = h4;
 
-  if (filled != 0)
-    {
-      need = HAS160_BLOCK_SIZE - filled;
-      /* Not enough input to fill a block. */
-      if (inputlen < need)
+      for (r = 0; r < 4; ++r)
         {
-          memcpy (&ctx->buffer[filled], input, inputlen);
-          return;
+          for (i = 0; i < 4; ++i)
+            {
+              p = has160_x[r] + i * 4;
+              x[16 + i] = x[p[0]] ^ x[p[1]] ^ x[p[2]] ^ x[p[3]];
+            }
+          for (i = 0; i < 20; ++i)
+            {
+              t = rotl32 (a, has160_s[i]) + has160_f (r, b, c, d)
+                  + x[has160_l[r * 20 + i]] + has160_k[r] + e;
+              e = d;
+              d = c;
+              c = rotl32 (b, has160_rot[r]);
+              b = a;
+              a = t;
+            }
         }
 
-      /* Handle the buffer first. */
-      memcpy (&ctx->buffer[filled], input, need);
-      has160_transform (ctx->state, ctx->buffer);
-      inputlen -= need;
-      input += need;
+      h0 += a;
+      h1 += b;
+      h2 += c;
+      h3 += d;
+      h4 += e;
     }
 
-  /* Handle all complete blocks. */
-  while (inputlen >= HAS160_BLOCK_SIZE)
+  state[0] = h0;
+  state[1] = h1;
+  state[2] = h2;
+  state[3] = h3;
+  state[4] = h4;
+}
+#else
+void
+has160_transform_blocks (uint32_t *state, const uint8_t *blocks,
+                         size_t nblocks)
+{
+  uint32_t h0, h1, h2, h3, h4;
+  uint32_t a, b, c, d, e;
+  uint32_t x[20];
+
+  h0 = state[0];
+  h1 = state[1];
+  h2 = state[2];
+  h3 = state[3];
+  h4 = state[4];
+  for (; nblocks > 0; --nblocks, blocks += HAS160_BLOCK_SIZE)
     {
-      has160_transform (ctx->state, input);
-      inputlen -= HAS160_BLOCK_SIZE;
-      input += HAS160_BLOCK_SIZE;
+      buff_get_le32_words (x, blocks, 16);
+
+      a = h0;
+      b = h1;
+      c = h2;
+      d = h3;
+      e = h4;
+
+      x[16] = x[0] ^ x[1] ^ x[2] ^ x[3];
+      x[17] = x[4] ^ x[5] ^ x[6] ^ x[7];
+      x[18] = x[8] ^ x[9] ^ x[10] ^ x[11];
+      x[19] = x[12] ^ x[13] ^ x[14] ^ x[15];
+      STEP1 (a, b, c, d, e, x[18], 5);
+      STEP1 (e, a, b, c, d, x[0], 11);
+      STEP1 (d, e, a, b, c, x[1], 7);
+      STEP1 (c, d, e, a, b, x[2], 15);
+      STEP1 (b, c, d, e, a, x[3], 6);
+      STEP1 (a, b, c, d, e, x[19], 13);
+      STEP1 (e, a, b, c, d, x[4], 8);
+      STEP1 (d, e, a, b, c, x[5], 14);
+      STEP1 (c, d, e, a, b, x[6], 7);
+      STEP1 (b, c, d, e, a, x[7], 12);
+      STEP1 (a, b, c, d, e, x[16], 9);
+      STEP1 (e, a, b, c, d, x[8], 11);
+      STEP1 (d, e, a, b, c, x[9], 8);
+      STEP1 (c, d, e, a, b, x[10], 15);
+      STEP1 (b, c, d, e, a, x[11], 6);
+      STEP1 (a, b, c, d, e, x[17], 12);
+      STEP1 (e, a, b, c, d, x[12], 9);
+      STEP1 (d, e, a, b, c, x[13], 14);
+      STEP1 (c, d, e, a, b, x[14], 5);
+      STEP1 (b, c, d, e, a, x[15], 13);
+
+      x[16] = x[3] ^ x[6] ^ x[9] ^ x[12];
+      x[17] = x[15] ^ x[2] ^ x[5] ^ x[8];
+      x[18] = x[11] ^ x[14] ^ x[1] ^ x[4];
+      x[19] = x[7] ^ x[10] ^ x[13] ^ x[0];
+      STEP2 (a, b, c, d, e, x[18], 5);
+      STEP2 (e, a, b, c, d, x[3], 11);
+      STEP2 (d, e, a, b, c, x[6], 7);
+      STEP2 (c, d, e, a, b, x[9], 15);
+      STEP2 (b, c, d, e, a, x[12], 6);
+      STEP2 (a, b, c, d, e, x[19], 13);
+      STEP2 (e, a, b, c, d, x[15], 8);
+      STEP2 (d, e, a, b, c, x[2], 14);
+      STEP2 (c, d, e, a, b, x[5], 7);
+      STEP2 (b, c, d, e, a, x[8], 12);
+      STEP2 (a, b, c, d, e, x[16], 9);
+      STEP2 (e, a, b, c, d, x[11], 11);
+      STEP2 (d, e, a, b, c, x[14], 8);
+      STEP2 (c, d, e, a, b, x[1], 15);
+      STEP2 (b, c, d, e, a, x[4], 6);
+      STEP2 (a, b, c, d, e, x[17], 12);
+      STEP2 (e, a, b, c, d, x[7], 9);
+      STEP2 (d, e, a, b, c, x[10], 14);
+      STEP2 (c, d, e, a, b, x[13], 5);
+      STEP2 (b, c, d, e, a, x[0], 13);
+
+      x[16] = x[12] ^ x[5] ^ x[14] ^ x[7];
+      x[17] = x[0] ^ x[9] ^ x[2] ^ x[11];
+      x[18] = x[4] ^ x[13] ^ x[6] ^ x[15];
+      x[19] = x[8] ^ x[1] ^ x[10] ^ x[3];
+      STEP3 (a, b, c, d, e, x[18], 5);
+      STEP3 (e, a, b, c, d, x[12], 11);
+      STEP3 (d, e, a, b, c, x[5], 7);
+      STEP3 (c, d, e, a, b, x[14], 15);
+      STEP3 (b, c, d, e, a, x[7], 6);
+      STEP3 (a, b, c, d, e, x[19], 13);
+      STEP3 (e, a, b, c, d, x[0], 8);
+      STEP3 (d, e, a, b, c, x[9], 14);
+      STEP3 (c, d, e, a, b, x[2], 7);
+      STEP3 (b, c, d, e, a, x[11], 12);
+      STEP3 (a, b, c, d, e, x[16], 9);
+      STEP3 (e, a, b, c, d, x[4], 11);
+      STEP3 (d, e, a, b, c, x[13], 8);
+      STEP3 (c, d, e, a, b, x[6], 15);
+      STEP3 (b, c, d, e, a, x[15], 6);
+      STEP3 (a, b, c, d, e, x[17], 12);
+      STEP3 (e, a, b, c, d, x[8], 9);
+      STEP3 (d, e, a, b, c, x[1], 14);
+      STEP3 (c, d, e, a, b, x[10], 5);
+      STEP3 (b, c, d, e, a, x[3], 13);
+
+      x[16] = x[7] ^ x[2] ^ x[13] ^ x[8];
+      x[17] = x[3] ^ x[14] ^ x[9] ^ x[4];
+      x[18] = x[15] ^ x[10] ^ x[5] ^ x[0];
+      x[19] = x[11] ^ x[6] ^ x[1] ^ x[12];
+      STEP4 (a, b, c, d, e, x[18], 5);
+      STEP4 (e, a, b, c, d, x[7], 11);
+      STEP4 (d, e, a, b, c, x[2], 7);
+      STEP4 (c, d, e, a, b, x[13], 15);
+      STEP4 (b, c, d, e, a, x[8], 6);
+      STEP4 (a, b, c, d, e, x[19], 13);
+      STEP4 (e, a, b, c, d, x[3], 8);
+      STEP4 (d, e, a, b, c, x[14], 14);
+      STEP4 (c, d, e, a, b, x[9], 7);
+      STEP4 (b, c, d, e, a, x[4], 12);
+      STEP4 (a, b, c, d, e, x[16], 9);
+      STEP4 (e, a, b, c, d, x[15], 11);
+      STEP4 (d, e, a, b, c, x[10], 8);
+      STEP4 (c, d, e, a, b, x[5], 15);
+      STEP4 (b, c, d, e, a, x[0], 6);
+      STEP4 (a, b, c, d, e, x[17], 12);
+      STEP4 (e, a, b, c, d, x[11], 9);
+      STEP4 (d, e, a, b, c, x[6], 14);
+      STEP4 (c, d, e, a, b, x[1], 5);
+      STEP4 (b, c, d, e, a, x[12], 13);
+
+      h0 += a;
+      h1 += b;
+      h2 += c;
+      h3 += d;
+      h4 += e;
     }
 
-  /* Save any remaining input. */
-  if (inputlen != 0)
-    memcpy (ctx->buffer, input, inputlen);
+  state[0] = h0;
+  state[1] = h1;
+  state[2] = h2;
+  state[3] = h3;
+  state[4] = h4;
+}
+#endif /* FCRYPT_SMALL */
+
+void
+has160_transform (uint32_t *state, const uint8_t *block)
+{
+  has160_transform_blocks (state, block, 1);
+}
+
+/* Compresses consecutive blocks, used for the update and final steps. */
+static void
+has160_compress (void *state, const uint8_t *blocks, size_t nblocks)
+{
+  has160_transform_blocks (state, blocks, nblocks);
+}
+
+void
+has160_update (struct has160_ctx *ctx, const void *input, size_t inputlen)
+{
+  fcrypt_md_update (ctx->state, &ctx->count, ctx->buffer, has160_compress, input,
+                    inputlen);
 }
 
 void
 has160_final (uint8_t *digest, struct has160_ctx *ctx)
 {
   uint32_t i;
-  size_t padoffset = (size_t)((ctx->count >> 3) & (HAS160_BLOCK_SIZE - 1));
 
-  ctx->buffer[padoffset++] = 0x80;
+  fcrypt_md_final (ctx->state, ctx->count, ctx->buffer, has160_compress, 0x80,
+                   0);
+  for (i = 0; i < 5; ++i)
+    buff_put_le32 (digest + i * 4, ctx->state[i]);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
 
-  /* Enough room for count. */
-  if (padoffset <= 56)
-    memset (&ctx->buffer[padoffset], 0, 56 - padoffset);
-  else
-    {
-      /* Not enough room for count. */
-      memset (&ctx->buffer[padoffset], 0, HAS160_BLOCK_SIZE - padoffset);
-      has160_transform (ctx->state, ctx->buffer);
-      memset (ctx->buffer, 0, 56);
-    }
+void
+has160_copy (struct has160_ctx *dst, const struct has160_ctx *src)
+{
+  *dst = *src;
+}
 
-  buff_put_le64 (ctx->buffer + 56, ctx->count);
-  has160_transform (ctx->state, ctx->buffer);
+/* Hashes a whole message without buffering it through a context. */
+void
+has160 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct has160_ctx ctx;
+  uint32_t i;
 
+  has160_init (&ctx);
+  fcrypt_md_oneshot (ctx.state, ctx.buffer, has160_compress, 0x80, 0, input,
+                     inputlen);
   for (i = 0; i < 5; ++i)
-    buff_put_le32 (digest + i * 4, ctx->state[i]);
-  fcrypt_memzero (ctx, sizeof (*ctx));
+    buff_put_le32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
 }
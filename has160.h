@@ -41,7 +41,10 @@ struct has160_ctx
 
 void has160_init (struct has160_ctx *);
 void has160_transform (uint32_t *, const uint8_t *);
+void has160_transform_blocks (uint32_t *, const uint8_t *, size_t);
 void has160_update (struct has160_ctx *, const void *, size_t);
 void has160_final (uint8_t *, struct has160_ctx *);
+void has160_copy (struct has160_ctx *, const struct has160_ctx *);
+void has160 (uint8_t *, const void *, size_t);
 
 #endif /* HAS160_H */
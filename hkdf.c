@@ -0,0 +1,104 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fcrypt_memzero.h"
+#include "hkdf.h"
+#include "hmac.h"
+
+/*
+ * Defines the HKDF functions for a hash. The key for expanding is prepared
+ * once, so each block of output only costs the compressions for its own
+ * message, which is the previous block, the info string and a counter.
+ */
+#define HKDF_FUNCS(name, digest_size)                                         \
+  void hkdf_##name##_extract (uint8_t *prk, const uint8_t *salt,              \
+                              size_t saltlen, const void *ikm, size_t ikmlen) \
+  {                                                                           \
+    struct hmac_##name##_key key;                                             \
+                                                                              \
+    hmac_##name##_set_key (&key, salt, saltlen);                              \
+    hmac_##name (prk, &key, ikm, ikmlen);                                     \
+    fcrypt_memzero (&key, sizeof (key));                                      \
+  }                                                                           \
+                                                                              \
+  int hkdf_##name##_expand (uint8_t *okm, size_t okmlen, const uint8_t *prk,  \
+                            size_t prklen, const uint8_t *info,               \
+                            size_t infolen)                                   \
+  {                                                                           \
+    struct hmac_##name##_key key;                                             \
+    struct hmac_##name##_ctx ctx;                                             \
+    uint8_t t[digest_size];                                                   \
+    uint8_t counter;                                                          \
+    size_t len;                                                               \
+                                                                              \
+    if (okmlen > 255 * (digest_size))                                         \
+      {                                                                       \
+        errno = EINVAL;                                                       \
+        return -1;                                                            \
+      }                                                                       \
+                                                                              \
+    hmac_##name##_set_key (&key, prk, prklen);                                \
+    for (counter = 1; okmlen > 0; ++counter)                                  \
+      {                                                                       \
+        hmac_##name##_init (&ctx, &key);                                      \
+        if (counter > 1)                                                      \
+          hmac_##name##_update (&ctx, t, sizeof (t));                         \
+        hmac_##name##_update (&ctx, info, infolen);                           \
+        hmac_##name##_update (&ctx, &counter, 1);                             \
+        hmac_##name##_final (t, &ctx);                                        \
+        len = okmlen < sizeof (t) ? okmlen : sizeof (t);                      \
+        memcpy (okm, t, len);                                                 \
+        okm += len;                                                           \
+        okmlen -= len;                                                        \
+      }                                                                       \
+    fcrypt_memzero (&key, sizeof (key));                                      \
+    fcrypt_memzero (t, sizeof (t));                                           \
+    return 0;                                                                 \
+  }                                                                           \
+                                                                              \
+  int hkdf_##name (uint8_t *okm, size_t okmlen, const uint8_t *salt,          \
+                   size_t saltlen, const void *ikm, size_t ikmlen,            \
+                   const uint8_t *info, size_t infolen)                       \
+  {                                                                           \
+    uint8_t prk[digest_size];                                                 \
+    int result;                                                               \
+                                                                              \
+    hkdf_##name##_extract (prk, salt, saltlen, ikm, ikmlen);                  \
+    result = hkdf_##name##_expand (okm, okmlen, prk, sizeof (prk), info,      \
+                                   infolen);                                  \
+    fcrypt_memzero (prk, sizeof (prk));                                       \
+    return result;                                                            \
+  }
+
+HKDF_FUNCS (sha1, HMAC_SHA1_DIGEST_SIZE)
+HKDF_FUNCS (sha256, HMAC_SHA256_DIGEST_SIZE)
+HKDF_FUNCS (sha512, HMAC_SHA512_DIGEST_SIZE)
@@ -0,0 +1,76 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * HKDF as described in RFC 5869, over HMAC with SHA-1 and SHA-2.
+ */
+
+#ifndef HKDF_H
+#define HKDF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hmac.h"
+
+/*
+ * The extract functions derive a pseudorandom key of the hash's digest size
+ * from the salt and its length and the input keying material and its
+ * length. An empty salt stands for a string of zeros, as in RFC 5869.
+ *
+ * The expand functions stretch a pseudorandom key into output keying
+ * material. The arguments are the output and its length, the pseudorandom
+ * key and its length, and the info string and its length. They return 0, or
+ * -1 with errno set to EINVAL if the output is longer than 255 digests.
+ *
+ * The functions without a suffix do both steps, taking the output and its
+ * length, the salt, the input keying material and the info string.
+ */
+
+/* HKDF-SHA1 */
+void hkdf_sha1_extract (uint8_t *, const uint8_t *, size_t, const void *,
+                        size_t);
+int hkdf_sha1_expand (uint8_t *, size_t, const uint8_t *, size_t,
+                      const uint8_t *, size_t);
+int hkdf_sha1 (uint8_t *, size_t, const uint8_t *, size_t, const void *,
+               size_t, const uint8_t *, size_t);
+
+/* HKDF-SHA256 */
+void hkdf_sha256_extract (uint8_t *, const uint8_t *, size_t, const void *,
+                          size_t);
+int hkdf_sha256_expand (uint8_t *, size_t, const uint8_t *, size_t,
+                        const uint8_t *, size_t);
+int hkdf_sha256 (uint8_t *, size_t, const uint8_t *, size_t, const void *,
+                 size_t, const uint8_t *, size_t);
+
+/* HKDF-SHA512 */
+void hkdf_sha512_extract (uint8_t *, const uint8_t *, size_t, const void *,
+                          size_t);
+int hkdf_sha512_expand (uint8_t *, size_t, const uint8_t *, size_t,
+                        const uint8_t *, size_t);
+int hkdf_sha512 (uint8_t *, size_t, const uint8_t *, size_t, const void *,
+                 size_t, const uint8_t *, size_t);
+
+#endif /* HKDF_H */
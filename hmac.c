@@ -0,0 +1,113 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fcrypt_wipe.h"
+#include "hmac.h"
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "sha512.h"
+
+#define HMAC_IPAD 0x36
+#define HMAC_OPAD 0x5c
+
+/*
+ * Defines the HMAC functions for the hash name, whose context and key are
+ * those of base. The hash's own final functions clear the contexts.
+ */
+#define HMAC_FUNCS(name, base, digest_size, block_size)                       \
+  void hmac_##name##_set_key (struct hmac_##base##_key *key,                  \
+                              const void *keyptr, size_t keylen)              \
+  {                                                                           \
+    uint8_t pad[block_size];                                                  \
+    size_t i;                                                                 \
+                                                                              \
+    memset (pad, 0, sizeof (pad));                                            \
+    if (keylen > (block_size))                                                \
+      {                                                                       \
+        name##_init (&key->inner);                                            \
+        name##_update (&key->inner, keyptr, keylen);                          \
+        name##_final (pad, &key->inner);                                      \
+      }                                                                       \
+    else if (keylen > 0)                                                      \
+      memcpy (pad, keyptr, keylen);                                           \
+                                                                              \
+    for (i = 0; i < (block_size); ++i)                                        \
+      pad[i] ^= HMAC_IPAD;                                                    \
+    name##_init (&key->inner);                                                \
+    name##_update (&key->inner, pad, sizeof (pad));                           \
+                                                                              \
+    for (i = 0; i < (block_size); ++i)                                        \
+      pad[i] ^= HMAC_IPAD ^ HMAC_OPAD;                                        \
+    name##_init (&key->outer);                                                \
+    name##_update (&key->outer, pad, sizeof (pad));                           \
+    fcrypt_wipe (pad, sizeof (pad));                                          \
+  }                                                                           \
+                                                                              \
+  void hmac_##name##_init (struct hmac_##base##_ctx *ctx,                     \
+                           const struct hmac_##base##_key *key)               \
+  {                                                                           \
+    ctx->inner = key->inner;                                                  \
+    ctx->outer = key->outer;                                                  \
+  }                                                                           \
+                                                                              \
+  void hmac_##name##_update (struct hmac_##base##_ctx *ctx,                   \
+                             const void *input, size_t inputlen)              \
+  {                                                                           \
+    name##_update (&ctx->inner, input, inputlen);                             \
+  }                                                                           \
+                                                                              \
+  void hmac_##name##_final (uint8_t *digest, struct hmac_##base##_ctx *ctx)   \
+  {                                                                           \
+    uint8_t inner[digest_size];                                               \
+                                                                              \
+    name##_final (inner, &ctx->inner);                                        \
+    name##_update (&ctx->outer, inner, sizeof (inner));                       \
+    name##_final (digest, &ctx->outer);                                       \
+    fcrypt_wipe (inner, sizeof (inner));                                      \
+  }                                                                           \
+                                                                              \
+  void hmac_##name (uint8_t *digest, const struct hmac_##base##_key *key,     \
+                    const void *input, size_t inputlen)                       \
+  {                                                                           \
+    struct hmac_##base##_ctx ctx;                                             \
+                                                                              \
+    hmac_##name##_init (&ctx, key);                                           \
+    hmac_##name##_update (&ctx, input, inputlen);                             \
+    hmac_##name##_final (digest, &ctx);                                       \
+  }
+
+HMAC_FUNCS (md5, md5, MD5_DIGEST_SIZE, MD5_BLOCK_SIZE)
+HMAC_FUNCS (sha1, sha1, SHA1_DIGEST_SIZE, SHA1_BLOCK_SIZE)
+HMAC_FUNCS (sha224, sha256, SHA224_DIGEST_SIZE, SHA224_BLOCK_SIZE)
+HMAC_FUNCS (sha256, sha256, SHA256_DIGEST_SIZE, SHA256_BLOCK_SIZE)
+HMAC_FUNCS (sha384, sha512, SHA384_DIGEST_SIZE, SHA384_BLOCK_SIZE)
+HMAC_FUNCS (sha512, sha512, SHA512_DIGEST_SIZE, SHA512_BLOCK_SIZE)
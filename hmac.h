@@ -0,0 +1,163 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * HMAC as described in RFC 2104 over the Merkle-Damgard hashes. Setting a
+ * key compresses the inner and outer padded key blocks once, and keeps the
+ * two hash states after them. Each message then starts from copies of those
+ * states, so it only costs its own blocks and the final block of each hash,
+ * which saves two compressions per message when a key is reused.
+ */
+
+#ifndef HMAC_H
+#define HMAC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "sha512.h"
+
+#define HMAC_MD5_DIGEST_SIZE MD5_DIGEST_SIZE
+#define HMAC_SHA1_DIGEST_SIZE SHA1_DIGEST_SIZE
+#define HMAC_SHA224_DIGEST_SIZE SHA224_DIGEST_SIZE
+#define HMAC_SHA256_DIGEST_SIZE SHA256_DIGEST_SIZE
+#define HMAC_SHA384_DIGEST_SIZE SHA384_DIGEST_SIZE
+#define HMAC_SHA512_DIGEST_SIZE SHA512_DIGEST_SIZE
+
+/*
+ * A prepared key holds the hash states after the inner and outer padded key
+ * blocks. It is only read while computing a MAC, so one key can be shared
+ * between threads. A message context starts as a copy of it.
+ */
+struct hmac_md5_key
+{
+  struct md5_ctx inner;
+  struct md5_ctx outer;
+};
+
+struct hmac_sha1_key
+{
+  struct sha1_ctx inner;
+  struct sha1_ctx outer;
+};
+
+struct hmac_sha256_key
+{
+  struct sha256_ctx inner;
+  struct sha256_ctx outer;
+};
+
+struct hmac_sha512_key
+{
+  struct sha512_ctx inner;
+  struct sha512_ctx outer;
+};
+
+struct hmac_md5_ctx
+{
+  struct md5_ctx inner;
+  struct md5_ctx outer;
+};
+
+struct hmac_sha1_ctx
+{
+  struct sha1_ctx inner;
+  struct sha1_ctx outer;
+};
+
+struct hmac_sha256_ctx
+{
+  struct sha256_ctx inner;
+  struct sha256_ctx outer;
+};
+
+struct hmac_sha512_ctx
+{
+  struct sha512_ctx inner;
+  struct sha512_ctx outer;
+};
+
+/*
+ * The set_key functions take a key of any length; keys longer than the
+ * block are hashed first, as RFC 2104 requires. The one-shot functions
+ * MAC a whole message with a prepared key. HMAC-SHA224 and HMAC-SHA384 use
+ * the structures of HMAC-SHA256 and HMAC-SHA512, as the hashes do.
+ */
+
+/* HMAC-MD5 */
+void hmac_md5_set_key (struct hmac_md5_key *, const void *, size_t);
+void hmac_md5_init (struct hmac_md5_ctx *, const struct hmac_md5_key *);
+void hmac_md5_update (struct hmac_md5_ctx *, const void *, size_t);
+void hmac_md5_final (uint8_t *, struct hmac_md5_ctx *);
+void hmac_md5 (uint8_t *, const struct hmac_md5_key *, const void *, size_t);
+
+/* HMAC-SHA1 */
+void hmac_sha1_set_key (struct hmac_sha1_key *, const void *, size_t);
+void hmac_sha1_init (struct hmac_sha1_ctx *, const struct hmac_sha1_key *);
+void hmac_sha1_update (struct hmac_sha1_ctx *, const void *, size_t);
+void hmac_sha1_final (uint8_t *, struct hmac_sha1_ctx *);
+void hmac_sha1 (uint8_t *, const struct hmac_sha1_key *, const void *,
+                size_t);
+
+/* HMAC-SHA224 */
+void hmac_sha224_set_key (struct hmac_sha256_key *, const void *, size_t);
+void hmac_sha224_init (struct hmac_sha256_ctx *,
+                       const struct hmac_sha256_key *);
+void hmac_sha224_update (struct hmac_sha256_ctx *, const void *, size_t);
+void hmac_sha224_final (uint8_t *, struct hmac_sha256_ctx *);
+void hmac_sha224 (uint8_t *, const struct hmac_sha256_key *, const void *,
+                  size_t);
+
+/* HMAC-SHA256 */
+void hmac_sha256_set_key (struct hmac_sha256_key *, const void *, size_t);
+void hmac_sha256_init (struct hmac_sha256_ctx *,
+                       const struct hmac_sha256_key *);
+void hmac_sha256_update (struct hmac_sha256_ctx *, const void *, size_t);
+void hmac_sha256_final (uint8_t *, struct hmac_sha256_ctx *);
+void hmac_sha256 (uint8_t *, const struct hmac_sha256_key *, const void *,
+                  size_t);
+
+/* HMAC-SHA384 */
+void hmac_sha384_set_key (struct hmac_sha512_key *, const void *, size_t);
+void hmac_sha384_init (struct hmac_sha512_ctx *,
+                       const struct hmac_sha512_key *);
+void hmac_sha384_update (struct hmac_sha512_ctx *, const void *, size_t);
+void hmac_sha384_final (uint8_t *, struct hmac_sha512_ctx *);
+void hmac_sha384 (uint8_t *, const struct hmac_sha512_key *, const void *,
+                  size_t);
+
+/* HMAC-SHA512 */
+void hmac_sha512_set_key (struct hmac_sha512_key *, const void *, size_t);
+void hmac_sha512_init (struct hmac_sha512_ctx *,
+                       const struct hmac_sha512_key *);
+void hmac_sha512_update (struct hmac_sha512_ctx *, const void *, size_t);
+void hmac_sha512_final (uint8_t *, struct hmac_sha512_ctx *);
+void hmac_sha512 (uint8_t *, const struct hmac_sha512_key *, const void *,
+                  size_t);
+
+#endif /* HMAC_H */
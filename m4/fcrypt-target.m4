@@ -0,0 +1,28 @@
+# fcrypt-target.m4 - checks for instruction set specific intrinsics.
+
+# FCRYPT_CHECK_TARGET(NAME, CANDIDATES, INCLUDES, BODY)
+# -----------------------------------------------------
+# Try each space separated string in CANDIDATES as the argument to
+# __attribute__ ((target (...))) on a function containing BODY. The first
+# one that compiles defines HAVE_NAME_INTRINSICS and NAME_TARGET_ATTRIBUTE
+# in config.h so that the backend can be built without changing CFLAGS.
+AC_DEFUN([FCRYPT_CHECK_TARGET],
+[AC_CACHE_CHECK([for the target attribute needed for $1 intrinsics],
+  [fcrypt_cv_target_$1],
+  [fcrypt_cv_target_$1=no
+   for fcrypt_target in $2; do
+     AC_COMPILE_IFELSE([AC_LANG_PROGRAM([[$3
+__attribute__ ((target ("$fcrypt_target"))) static int
+fcrypt_target_test (void)
+{
+  $4
+}]], [[return fcrypt_target_test ();]])],
+       [fcrypt_cv_target_$1=$fcrypt_target
+        break])
+   done])
+AS_IF([test "x$fcrypt_cv_target_$1" != xno],
+  [AC_DEFINE([HAVE_$1_INTRINSICS], [1],
+     [Define to 1 if $1 intrinsics can be used with a target attribute.])
+   AC_DEFINE_UNQUOTED([$1_TARGET_ATTRIBUTE], ["$fcrypt_cv_target_$1"],
+     [Argument to the target attribute for functions using $1 intrinsics.])])
+])
@@ -0,0 +1,339 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Writes curve25519-tables.h, the constants and base point tables of
+ * curve25519.c, to standard output. Field elements are printed as five
+ * limbs of 51 bits, the representation of curve25519.c, after being
+ * computed here with the simpler sixteen limbs of 16 bits.
+ *
+ * The base table holds j * 256^i * B for 0 <= i < 32 and 1 <= j <= 8, so a
+ * scalar written with 64 signed digits in [-8, 8] needs one table entry per
+ * digit and four doublings. The odd table holds B, 3B, ..., 15B for the
+ * sliding windows of variable time verification. Points are affine and
+ * stored as (y + x, y - x, 2dxy).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef int64_t gf[16];
+
+struct point
+{
+  gf x, y, z, t;
+};
+
+static gf gf_d;
+static gf gf_d2;
+static gf gf_sqrtm1;
+
+static void
+gf_set (gf r, int64_t v)
+{
+  memset (r, 0, sizeof (gf));
+  r[0] = v;
+}
+
+static void
+gf_carry (gf r)
+{
+  int64_t c;
+  int i;
+
+  for (i = 0; i < 16; ++i)
+    {
+      /* Arithmetic shift, which every compiler we build with does. */
+      c = r[i] >> 16;
+      r[i] -= c * 65536;
+      if (i < 15)
+        r[i + 1] += c;
+      else
+        r[0] += 38 * c;
+    }
+}
+
+static void
+gf_add (gf r, const gf a, const gf b)
+{
+  int i;
+
+  for (i = 0; i < 16; ++i)
+    r[i] = a[i] + b[i];
+}
+
+static void
+gf_sub (gf r, const gf a, const gf b)
+{
+  int i;
+
+  for (i = 0; i < 16; ++i)
+    r[i] = a[i] - b[i];
+}
+
+static void
+gf_mul (gf r, const gf a, const gf b)
+{
+  int64_t t[31];
+  int i, j;
+
+  memset (t, 0, sizeof (t));
+  for (i = 0; i < 16; ++i)
+    for (j = 0; j < 16; ++j)
+      t[i + j] += a[i] * b[j];
+  /* 2^256 = 38 modulo 2^255 - 19. */
+  for (i = 0; i < 15; ++i)
+    t[i] += 38 * t[i + 16];
+  memcpy (r, t, sizeof (gf));
+  gf_carry (r);
+  gf_carry (r);
+}
+
+/* Raises a to 2^255 - 21 if inverse is set and 2^252 - 3 otherwise. */
+static void
+gf_pow (gf r, const gf a, int inverse)
+{
+  gf c;
+  int i;
+
+  memcpy (c, a, sizeof (gf));
+  for (i = inverse ? 253 : 250; i >= 0; --i)
+    {
+      gf_mul (c, c, c);
+      if (inverse ? i != 2 && i != 4 : i != 1)
+        gf_mul (c, c, a);
+    }
+  memcpy (r, c, sizeof (gf));
+}
+
+static void
+gf_pack (uint8_t *out, const gf a)
+{
+  gf t, m;
+  int64_t borrow;
+  int i, j;
+
+  memcpy (t, a, sizeof (gf));
+  gf_carry (t);
+  gf_carry (t);
+  gf_carry (t);
+  /* Subtract p at most twice while that leaves a nonnegative value. */
+  for (j = 0; j < 2; ++j)
+    {
+      m[0] = t[0] - 0xffed;
+      for (i = 1; i < 15; ++i)
+        {
+          m[i] = t[i] - 0xffff - ((m[i - 1] >> 16) & 1);
+          m[i - 1] &= 0xffff;
+        }
+      m[15] = t[15] - 0x7fff - ((m[14] >> 16) & 1);
+      borrow = (m[15] >> 16) & 1;
+      m[14] &= 0xffff;
+      if (borrow == 0)
+        memcpy (t, m, sizeof (gf));
+    }
+  for (i = 0; i < 16; ++i)
+    {
+      out[2 * i] = t[i] & 0xff;
+      out[2 * i + 1] = (t[i] >> 8) & 0xff;
+    }
+}
+
+static int
+gf_equal (const gf a, const gf b)
+{
+  uint8_t x[32], y[32];
+
+  gf_pack (x, a);
+  gf_pack (y, b);
+  return memcmp (x, y, 32) == 0;
+}
+
+static void
+point_add (struct point *r, const struct point *p, const struct point *q)
+{
+  gf a, b, c, d, e, f, g, h, t;
+
+  gf_sub (a, p->y, p->x);
+  gf_sub (t, q->y, q->x);
+  gf_mul (a, a, t);
+  gf_add (b, p->y, p->x);
+  gf_add (t, q->y, q->x);
+  gf_mul (b, b, t);
+  gf_mul (c, p->t, q->t);
+  gf_mul (c, c, gf_d2);
+  gf_mul (d, p->z, q->z);
+  gf_add (d, d, d);
+  gf_sub (e, b, a);
+  gf_sub (f, d, c);
+  gf_add (g, d, c);
+  gf_add (h, b, a);
+  gf_mul (r->x, e, f);
+  gf_mul (r->y, g, h);
+  gf_mul (r->z, f, g);
+  gf_mul (r->t, e, h);
+}
+
+static void
+print_gf (const gf a)
+{
+  uint64_t limb;
+  uint8_t s[32];
+  int i, j;
+
+  gf_pack (s, a);
+  printf ("{ ");
+  for (i = 0; i < 5; ++i)
+    {
+      limb = 0;
+      for (j = 0; j < 8 && (51 * i) / 8 + j < 32; ++j)
+        limb |= (uint64_t)s[(51 * i) / 8 + j] << (8 * j);
+      limb = (limb >> ((51 * i) % 8)) & ((UINT64_C (1) << 51) - 1);
+      printf ("UINT64_C (0x%013llx)%s", (unsigned long long)limb,
+              i == 4 ? " }" : ",\n        ");
+    }
+}
+
+static void
+print_precomp (const struct point *p, const char *indent)
+{
+  gf zi, x, y, v;
+
+  gf_pow (zi, p->z, 1);
+  gf_mul (x, p->x, zi);
+  gf_mul (y, p->y, zi);
+  printf ("%s{ ", indent);
+  gf_add (v, y, x);
+  print_gf (v);
+  printf (",\n%s  ", indent);
+  gf_sub (v, y, x);
+  print_gf (v);
+  printf (",\n%s  ", indent);
+  gf_mul (v, x, y);
+  gf_mul (v, v, gf_d2);
+  print_gf (v);
+  printf (" },\n");
+}
+
+int
+main (void)
+{
+  struct point base, row, p, q;
+  gf one, u, v, t;
+  uint8_t s[32];
+  int i, j;
+
+  gf_set (one, 1);
+
+  /* d = -121665 / 121666 */
+  gf_set (t, 121666);
+  gf_pow (t, t, 1);
+  gf_set (u, -121665);
+  gf_mul (gf_d, u, t);
+  gf_add (gf_d2, gf_d, gf_d);
+
+  /* sqrt(-1) = 2^((p - 1) / 4) = 2 * (2^((p - 5) / 8))^2 */
+  gf_set (t, 2);
+  gf_pow (t, t, 0);
+  gf_mul (t, t, t);
+  gf_add (gf_sqrtm1, t, t);
+
+  /*
+   * B has y = 4/5 and an even x with x^2 = u = (y^2 - 1) / (dy^2 + 1). As
+   * p = 5 modulo 8, u^((p + 3) / 8) is a square root of u or -u, and in the
+   * second case multiplying it by sqrt(-1) gives one of u.
+   */
+  gf_set (t, 5);
+  gf_pow (t, t, 1);
+  gf_set (u, 4);
+  gf_mul (base.y, u, t);
+  gf_mul (t, base.y, base.y);
+  gf_sub (u, t, one);
+  gf_mul (v, t, gf_d);
+  gf_add (v, v, one);
+  gf_pow (v, v, 1);
+  gf_mul (u, u, v);
+  gf_pow (t, u, 0);
+  gf_mul (base.x, t, u);
+  gf_mul (t, base.x, base.x);
+  if (!gf_equal (t, u))
+    gf_mul (base.x, base.x, gf_sqrtm1);
+  gf_pack (s, base.x);
+  if ((s[0] & 1) != 0)
+    {
+      gf_set (t, 0);
+      gf_sub (base.x, t, base.x);
+    }
+  memcpy (base.z, one, sizeof (gf));
+  gf_mul (base.t, base.x, base.y);
+
+  printf ("/* Generated by make-curve25519-tables.c, do not edit. */\n\n");
+  printf ("#ifndef CURVE25519_TABLES_H\n#define CURVE25519_TABLES_H\n\n");
+  printf ("#include <stdint.h>\n\n#include \"curve25519-internal.h\"\n\n");
+  printf ("static const fe25519 curve25519_d = ");
+  print_gf (gf_d);
+  printf (";\n\nstatic const fe25519 curve25519_d2 = ");
+  print_gf (gf_d2);
+  printf (";\n\nstatic const fe25519 curve25519_sqrtm1 = ");
+  print_gf (gf_sqrtm1);
+  printf (";\n\n");
+
+  printf ("static const struct ge25519_precomp "
+          "curve25519_base_table[32][8] = {\n");
+  row = base;
+  for (i = 0; i < 32; ++i)
+    {
+      printf ("  {\n");
+      p = row;
+      for (j = 0; j < 8; ++j)
+        {
+          print_precomp (&p, "    ");
+          point_add (&q, &p, &row);
+          p = q;
+        }
+      printf ("  },\n");
+      /* The next row starts at 256 times this one. */
+      for (j = 0; j < 8; ++j)
+        {
+          point_add (&q, &row, &row);
+          row = q;
+        }
+    }
+  printf ("};\n\n");
+
+  printf ("static const struct ge25519_precomp curve25519_base_odd[8] = {\n");
+  point_add (&q, &base, &base);
+  p = base;
+  for (j = 0; j < 8; ++j)
+    {
+      print_precomp (&p, "  ");
+      point_add (&row, &p, &q);
+      p = row;
+    }
+  printf ("};\n\n#endif /* CURVE25519_TABLES_H */\n");
+
+  return ferror (stdout) != 0 || fflush (stdout) != 0;
+}
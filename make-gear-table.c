@@ -0,0 +1,66 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * The Gear table maps each byte to a 64-bit value that looks random. Chunk
+ * boundaries, and so deduplication across versions of the library, depend
+ * on every entry, so the seed and generator below must never change. The
+ * values are the outputs of SplitMix64 from the fractional part of the
+ * golden ratio.
+ */
+static uint64_t
+splitmix64 (uint64_t *state)
+{
+  uint64_t z;
+
+  *state += UINT64_C (0x9e3779b97f4a7c15);
+  z = *state;
+  z = (z ^ (z >> 30)) * UINT64_C (0xbf58476d1ce4e5b9);
+  z = (z ^ (z >> 27)) * UINT64_C (0x94d049bb133111eb);
+  return z ^ (z >> 31);
+}
+
+int
+main (void)
+{
+  uint64_t state;
+  int i;
+
+  state = 0;
+  printf ("/* Generated by make-gear-table.c, do not edit. */\n\n");
+  printf ("#ifndef GEAR_TABLE_H\n#define GEAR_TABLE_H\n\n");
+  printf ("#include <stdint.h>\n\n");
+  printf ("static const uint64_t gear_table[256] = {\n");
+  for (i = 0; i < 256; ++i)
+    printf ("%sUINT64_C (0x%016llx),%s", i % 2 == 0 ? "  " : "",
+            (unsigned long long)splitmix64 (&state),
+            i % 2 == 1 ? "\n" : " ");
+  printf ("};\n\n#endif /* GEAR_TABLE_H */\n");
+
+  return ferror (stdout) != 0 || fflush (stdout) != 0;
+}
@@ -29,8 +29,6 @@
 
 #include <math.h>
 
-#include "bswap.h"
-
 /* First 64 prime numbers. */
 static uint32_t primes[64] = {
   2,   3,   5,   7,   11,  13,  17,  19,  23,  29,  31,  37,  41,
@@ -46,28 +44,17 @@ int
 main (void)
 {
   int i;
-  uint32_t k;
 
-  printf ("static const uint32_t sha256_ktable[64] = {\n");
-  for (i = 1; i <= 64; ++i)
-    {
-      k = calculate_kval (primes[i - 1]);
-      switch (i & 3)
-        {
-        case 0:
-          printf ("0x%08x,\n", k);
-          break;
-        case 1:
-          printf ("\t0x%08x, ", k);
-          break;
-        default:
-          printf ("0x%08x, ", k);
-          break;
-        }
-    }
-  printf ("};\n");
+  printf ("/* Generated by makesha256ktable.c, do not edit. */\n\n");
+  printf ("#ifndef SHA256_KTABLE_H\n#define SHA256_KTABLE_H\n\n");
+  printf ("#include <stdint.h>\n\n");
+  printf ("const uint32_t sha256_ktable[64] = {\n");
+  for (i = 0; i < 64; ++i)
+    printf ("%s0x%08x,%s", i % 6 == 0 ? "  " : "",
+            calculate_kval (primes[i]), i % 6 == 5 || i == 63 ? "\n" : " ");
+  printf ("};\n\n#endif /* SHA256_KTABLE_H */\n");
 
-  return 0;
+  return ferror (stdout) != 0 || fflush (stdout) != 0;
 }
 
 static uint32_t
@@ -79,8 +66,8 @@ calculate_kval (uint32_t val)
   /* Cube root. */
   cr = cbrt ((double)val);
 
-  /* Get the fractional part. */
-  retv = (uint32_t)((cr - floor (cr)) * 0xffffffff);
+  /* Get the first 32 bits of the fractional part. */
+  retv = (uint32_t)((cr - floor (cr)) * 4294967296.0);
 
   return retv;
 }
@@ -29,7 +29,7 @@
 
 #include "bswap.h"
 #include "circularshift.h"
-#include "fcrypt_memzero.h"
+#include "fcrypt_wipe.h"
 #include "md2.h"
 
 static const uint8_t md2_sbox[256] = {
@@ -141,5 +141,11 @@ md2_final (uint8_t *digest, struct md2_ctx *ctx)
 
   md2_transform (ctx, ctx->checksum);
   memcpy (digest, ctx->state, MD2_DIGEST_SIZE);
-  fcrypt_memzero (ctx, sizeof (*ctx));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+md2_copy (struct md2_ctx *dst, const struct md2_ctx *src)
+{
+  *dst = *src;
 }
@@ -44,5 +44,6 @@ void md2_init (struct md2_ctx *);
 void md2_transform (struct md2_ctx *, const uint8_t *);
 void md2_update (struct md2_ctx *, const void *, size_t);
 void md2_final (uint8_t *, struct md2_ctx *);
+void md2_copy (struct md2_ctx *, const struct md2_ctx *);
 
 #endif /* MD2_H */
@@ -29,6 +29,8 @@
 
 #include "bswap.h"
 #include "circularshift.h"
+#include "fcrypt_md.h"
+#include "fcrypt_wipe.h"
 #include "md4.h"
 
 /* Functions used by MD4. */
@@ -125,73 +127,50 @@ md4_transform (uint32_t *state, const uint8_t *block)
   state[3] += d;
 }
 
+/* Compresses consecutive blocks, used for the update and final steps. */
+static void
+md4_compress (void *state, const uint8_t *blocks, size_t nblocks)
+{
+  for (; nblocks > 0; --nblocks, blocks += MD4_BLOCK_SIZE)
+    md4_transform (state, blocks);
+}
+
 void
-md4_update (struct md4_ctx *ctx, const void *inputptr, size_t inputlen)
+md4_update (struct md4_ctx *ctx, const void *input, size_t inputlen)
 {
-  size_t filled, need;
-  const uint8_t *input = inputptr;
-
-  if (inputlen == 0)
-    return;
-
-  filled = (size_t)((ctx->count >> 3) & (MD4_BLOCK_SIZE - 1));
-  need = MD4_BLOCK_SIZE - filled;
-  ctx->count += (uint64_t)(inputlen << 3);
-
-  /* Input too short to fill a complete block. */
-  if (inputlen < need)
-    {
-      memcpy (&ctx->buffer[filled], input, inputlen);
-      return;
-    }
-
-  /* Check if we need to finish the buffer in ctx. */
-  if (filled != 0)
-    {
-      memcpy (&ctx->buffer[filled], input, need);
-      md4_transform (ctx->state, ctx->buffer);
-      inputlen -= need;
-      input += need;
-    }
-
-  /* Handle as many blocks as possible. */
-  while (inputlen >= MD4_BLOCK_SIZE)
-    {
-      md4_transform (ctx->state, input);
-      inputlen -= MD4_BLOCK_SIZE;
-      input += MD4_BLOCK_SIZE;
-    }
-
-  /* Save any remaining bytes. */
-  if (inputlen != 0)
-    memcpy (ctx->buffer, input, inputlen);
+  fcrypt_md_update (ctx->state, &ctx->count, ctx->buffer, md4_compress, input,
+                    inputlen);
 }
 
 void
 md4_final (uint8_t *digest, struct md4_ctx *ctx)
 {
-  size_t padoffset;
   uint32_t i;
 
-  padoffset = (size_t)((ctx->count >> 3) & (MD4_BLOCK_SIZE - 1));
-  ctx->buffer[padoffset++] = 0x80;
+  fcrypt_md_final (ctx->state, ctx->count, ctx->buffer, md4_compress, 0x80,
+                   0);
+  for (i = 0; i < 4; ++i)
+    buff_put_le32 (digest + i * 4, ctx->state[i]);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
 
-  /* Enough room for count. */
-  if (padoffset <= 56)
-    memset (&ctx->buffer[padoffset], 0, 56 - padoffset);
-  else
-    {
-      /* Not enough room for count. */
-      memset (&ctx->buffer[padoffset], 0, MD4_BLOCK_SIZE - padoffset);
-      md4_transform (ctx->state, ctx->buffer);
-      memset (ctx->buffer, 0, 56);
-    }
+void
+md4_copy (struct md4_ctx *dst, const struct md4_ctx *src)
+{
+  *dst = *src;
+}
 
-  /* Append the count and handle the block. */
-  buff_put_le64 (ctx->buffer + 56, ctx->count);
-  md4_transform (ctx->state, ctx->buffer);
+/* Hashes a whole message without buffering it through a context. */
+void
+md4 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct md4_ctx ctx;
+  uint32_t i;
 
+  md4_init (&ctx);
+  fcrypt_md_oneshot (ctx.state, ctx.buffer, md4_compress, 0x80, 0, input,
+                     inputlen);
   for (i = 0; i < 4; ++i)
-    buff_put_le32 (digest + i * 4, ctx->state[i]);
-  memset (ctx, 0, sizeof (*ctx));
+    buff_put_le32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
 }
@@ -43,5 +43,7 @@ void md4_init (struct md4_ctx *);
 void md4_transform (uint32_t *, const uint8_t *);
 void md4_update (struct md4_ctx *, const void *, size_t);
 void md4_final (uint8_t *, struct md4_ctx *);
+void md4_copy (struct md4_ctx *, const struct md4_ctx *);
+void md4 (uint8_t *, const void *, size_t);
 
 #endif /* MD4_H */
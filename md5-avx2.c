@@ -0,0 +1,176 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer MD5 with AVX2. Each 32-bit element of a vector belongs to a
+ * different message, so eight blocks from independent messages go through
+ * the steps of RFC 1321 at the same time. The blocks are transposed into
+ * that form with an 8x8 transpose of 32-bit words on the way in.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "md5-internal.h"
+#include "md5.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_LANES 8
+
+#define AVX2_ROTL(x, n)                                                       \
+  _mm256_or_si256 (_mm256_slli_epi32 ((x), (n)),                              \
+                   _mm256_srli_epi32 ((x), 32 - (n)))
+
+/* The four functions of RFC 1321, without ANDN. */
+#define AVX2_F1(b, c, d)                                                      \
+  _mm256_xor_si256 ((d), _mm256_and_si256 ((b), _mm256_xor_si256 ((c), (d))))
+#define AVX2_F2(b, c, d)                                                      \
+  _mm256_xor_si256 ((c), _mm256_and_si256 ((d), _mm256_xor_si256 ((b), (c))))
+#define AVX2_F3(b, c, d) _mm256_xor_si256 ((b), _mm256_xor_si256 ((c), (d)))
+#define AVX2_F4(b, c, d)                                                      \
+  _mm256_xor_si256 ((c), _mm256_or_si256 ((b), _mm256_xor_si256 ((d), ones)))
+
+#define AVX2_STEP(f, a, b, c, d, i, x, s)                                     \
+  do                                                                          \
+    {                                                                         \
+      (a) = _mm256_add_epi32 (                                                \
+          _mm256_add_epi32 ((a), f ((b), (c), (d))),                          \
+          _mm256_add_epi32 (w[(x)],                                           \
+                            _mm256_set1_epi32 ((int)md5_ktable[(i)])));       \
+      (a) = _mm256_add_epi32 (AVX2_ROTL ((a), (s)), (b));                     \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads words 0 to 7 or 8 to 15 of the eight blocks, at offset bytes into
+ * each, and stores the words of all lanes for index i in w[i].
+ */
+AVX2_TARGET static inline void
+avx2_load_transpose (__m256i *w, const uint8_t *const *blocks, size_t offset)
+{
+  __m256i r[AVX2_LANES], t[AVX2_LANES], u[AVX2_LANES];
+  unsigned int l;
+
+  for (l = 0; l < AVX2_LANES; ++l)
+    r[l] = _mm256_loadu_si256 ((const __m256i *)(blocks[l] + offset));
+
+  for (l = 0; l < AVX2_LANES; l += 2)
+    {
+      t[l] = _mm256_unpacklo_epi32 (r[l], r[l + 1]);
+      t[l + 1] = _mm256_unpackhi_epi32 (r[l], r[l + 1]);
+    }
+  for (l = 0; l < AVX2_LANES; l += 4)
+    {
+      u[l] = _mm256_unpacklo_epi64 (t[l], t[l + 2]);
+      u[l + 1] = _mm256_unpackhi_epi64 (t[l], t[l + 2]);
+      u[l + 2] = _mm256_unpacklo_epi64 (t[l + 1], t[l + 3]);
+      u[l + 3] = _mm256_unpackhi_epi64 (t[l + 1], t[l + 3]);
+    }
+  for (l = 0; l < 4; ++l)
+    {
+      w[l] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x20);
+      w[l + 4] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x31);
+    }
+}
+
+AVX2_TARGET static void
+md5_multi_compress_avx2 (uint32_t *state, const uint8_t *const *blocks)
+{
+  const __m256i ones = _mm256_set1_epi32 (-1);
+  __m256i a, b, c, d;
+  __m256i w[16];
+  unsigned int i;
+
+  avx2_load_transpose (w, blocks, 0);
+  avx2_load_transpose (w + 8, blocks, 32);
+
+  a = _mm256_loadu_si256 ((const __m256i *)(state + 0 * AVX2_LANES));
+  b = _mm256_loadu_si256 ((const __m256i *)(state + 1 * AVX2_LANES));
+  c = _mm256_loadu_si256 ((const __m256i *)(state + 2 * AVX2_LANES));
+  d = _mm256_loadu_si256 ((const __m256i *)(state + 3 * AVX2_LANES));
+
+  for (i = 0; i < 16; i += 4)
+    {
+      AVX2_STEP (AVX2_F1, a, b, c, d, i, i, 7);
+      AVX2_STEP (AVX2_F1, d, a, b, c, i + 1, i + 1, 12);
+      AVX2_STEP (AVX2_F1, c, d, a, b, i + 2, i + 2, 17);
+      AVX2_STEP (AVX2_F1, b, c, d, a, i + 3, i + 3, 22);
+    }
+  for (i = 16; i < 32; i += 4)
+    {
+      AVX2_STEP (AVX2_F2, a, b, c, d, i, (5 * i + 1) & 15, 5);
+      AVX2_STEP (AVX2_F2, d, a, b, c, i + 1, (5 * i + 6) & 15, 9);
+      AVX2_STEP (AVX2_F2, c, d, a, b, i + 2, (5 * i + 11) & 15, 14);
+      AVX2_STEP (AVX2_F2, b, c, d, a, i + 3, (5 * i + 16) & 15, 20);
+    }
+  for (i = 32; i < 48; i += 4)
+    {
+      AVX2_STEP (AVX2_F3, a, b, c, d, i, (3 * i + 5) & 15, 4);
+      AVX2_STEP (AVX2_F3, d, a, b, c, i + 1, (3 * i + 8) & 15, 11);
+      AVX2_STEP (AVX2_F3, c, d, a, b, i + 2, (3 * i + 11) & 15, 16);
+      AVX2_STEP (AVX2_F3, b, c, d, a, i + 3, (3 * i + 14) & 15, 23);
+    }
+  for (i = 48; i < 64; i += 4)
+    {
+      AVX2_STEP (AVX2_F4, a, b, c, d, i, (7 * i) & 15, 6);
+      AVX2_STEP (AVX2_F4, d, a, b, c, i + 1, (7 * i + 7) & 15, 10);
+      AVX2_STEP (AVX2_F4, c, d, a, b, i + 2, (7 * i + 14) & 15, 15);
+      AVX2_STEP (AVX2_F4, b, c, d, a, i + 3, (7 * i + 21) & 15, 21);
+    }
+
+#define AVX2_ADD_STATE(j, x)                                                  \
+  _mm256_storeu_si256 (                                                       \
+      (__m256i *)(state + (j) * AVX2_LANES),                                  \
+      _mm256_add_epi32 (                                                      \
+          (x), _mm256_loadu_si256 (                                           \
+                   (const __m256i *)(state + (j) * AVX2_LANES))))
+
+  AVX2_ADD_STATE (0, a);
+  AVX2_ADD_STATE (1, b);
+  AVX2_ADD_STATE (2, c);
+  AVX2_ADD_STATE (3, d);
+
+#undef AVX2_ADD_STATE
+}
+
+const struct md5_multi_backend md5_multi_backend_avx2 = {
+  "avx2",
+  AVX2_LANES,
+  md5_multi_compress_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int md5_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
@@ -0,0 +1,170 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer MD5 with AVX-512, sixteen messages at a time. This is the
+ * same as md5-avx2.c but VPROLD replaces the shift and OR pairs and
+ * VPTERNLOGD computes each of the four functions in one instruction.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "md5-internal.h"
+#include "md5.h"
+
+#if defined(HAVE_AVX512_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX512_TARGET __attribute__ ((target (AVX512_TARGET_ATTRIBUTE)))
+
+#define AVX512_LANES 16
+
+#define AVX512_F1(b, c, d) _mm512_ternarylogic_epi32 ((b), (c), (d), 0xca)
+#define AVX512_F2(b, c, d) _mm512_ternarylogic_epi32 ((d), (b), (c), 0xca)
+#define AVX512_F3(b, c, d) _mm512_ternarylogic_epi32 ((b), (c), (d), 0x96)
+#define AVX512_F4(b, c, d) _mm512_ternarylogic_epi32 ((b), (c), (d), 0x39)
+
+#define AVX512_STEP(f, a, b, c, d, i, x, s)                                   \
+  do                                                                          \
+    {                                                                         \
+      (a) = _mm512_add_epi32 (                                                \
+          _mm512_add_epi32 ((a), f ((b), (c), (d))),                          \
+          _mm512_add_epi32 (w[(x)],                                           \
+                            _mm512_set1_epi32 ((int)md5_ktable[(i)])));       \
+      (a) = _mm512_add_epi32 (_mm512_rol_epi32 ((a), (s)), (b));              \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads words 0 to 7 or 8 to 15, at offset bytes into each block, of eight
+ * of the blocks and transposes them so that w[i] holds word i of each.
+ */
+AVX512_TARGET static inline void
+avx512_load_transpose8 (__m256i *w, const uint8_t *const *blocks,
+                        size_t offset)
+{
+  __m256i r[8], t[8], u[8];
+  unsigned int l;
+
+  for (l = 0; l < 8; ++l)
+    r[l] = _mm256_loadu_si256 ((const __m256i *)(blocks[l] + offset));
+
+  for (l = 0; l < 8; l += 2)
+    {
+      t[l] = _mm256_unpacklo_epi32 (r[l], r[l + 1]);
+      t[l + 1] = _mm256_unpackhi_epi32 (r[l], r[l + 1]);
+    }
+  for (l = 0; l < 8; l += 4)
+    {
+      u[l] = _mm256_unpacklo_epi64 (t[l], t[l + 2]);
+      u[l + 1] = _mm256_unpackhi_epi64 (t[l], t[l + 2]);
+      u[l + 2] = _mm256_unpacklo_epi64 (t[l + 1], t[l + 3]);
+      u[l + 3] = _mm256_unpackhi_epi64 (t[l + 1], t[l + 3]);
+    }
+  for (l = 0; l < 4; ++l)
+    {
+      w[l] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x20);
+      w[l + 4] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x31);
+    }
+}
+
+AVX512_TARGET static void
+md5_multi_compress_avx512 (uint32_t *state, const uint8_t *const *blocks)
+{
+  __m512i a, b, c, d;
+  __m512i w[16];
+  __m256i lo[16], hi[16];
+  unsigned int i;
+
+  avx512_load_transpose8 (lo, blocks, 0);
+  avx512_load_transpose8 (lo + 8, blocks, 32);
+  avx512_load_transpose8 (hi, blocks + 8, 0);
+  avx512_load_transpose8 (hi + 8, blocks + 8, 32);
+  for (i = 0; i < 16; ++i)
+    w[i] = _mm512_inserti64x4 (_mm512_castsi256_si512 (lo[i]), hi[i], 1);
+
+  a = _mm512_loadu_si512 (state + 0 * AVX512_LANES);
+  b = _mm512_loadu_si512 (state + 1 * AVX512_LANES);
+  c = _mm512_loadu_si512 (state + 2 * AVX512_LANES);
+  d = _mm512_loadu_si512 (state + 3 * AVX512_LANES);
+
+  for (i = 0; i < 16; i += 4)
+    {
+      AVX512_STEP (AVX512_F1, a, b, c, d, i, i, 7);
+      AVX512_STEP (AVX512_F1, d, a, b, c, i + 1, i + 1, 12);
+      AVX512_STEP (AVX512_F1, c, d, a, b, i + 2, i + 2, 17);
+      AVX512_STEP (AVX512_F1, b, c, d, a, i + 3, i + 3, 22);
+    }
+  for (i = 16; i < 32; i += 4)
+    {
+      AVX512_STEP (AVX512_F2, a, b, c, d, i, (5 * i + 1) & 15, 5);
+      AVX512_STEP (AVX512_F2, d, a, b, c, i + 1, (5 * i + 6) & 15, 9);
+      AVX512_STEP (AVX512_F2, c, d, a, b, i + 2, (5 * i + 11) & 15, 14);
+      AVX512_STEP (AVX512_F2, b, c, d, a, i + 3, (5 * i + 16) & 15, 20);
+    }
+  for (i = 32; i < 48; i += 4)
+    {
+      AVX512_STEP (AVX512_F3, a, b, c, d, i, (3 * i + 5) & 15, 4);
+      AVX512_STEP (AVX512_F3, d, a, b, c, i + 1, (3 * i + 8) & 15, 11);
+      AVX512_STEP (AVX512_F3, c, d, a, b, i + 2, (3 * i + 11) & 15, 16);
+      AVX512_STEP (AVX512_F3, b, c, d, a, i + 3, (3 * i + 14) & 15, 23);
+    }
+  for (i = 48; i < 64; i += 4)
+    {
+      AVX512_STEP (AVX512_F4, a, b, c, d, i, (7 * i) & 15, 6);
+      AVX512_STEP (AVX512_F4, d, a, b, c, i + 1, (7 * i + 7) & 15, 10);
+      AVX512_STEP (AVX512_F4, c, d, a, b, i + 2, (7 * i + 14) & 15, 15);
+      AVX512_STEP (AVX512_F4, b, c, d, a, i + 3, (7 * i + 21) & 15, 21);
+    }
+
+#define AVX512_ADD_STATE(j, x)                                                \
+  _mm512_storeu_si512 (                                                       \
+      state + (j) * AVX512_LANES,                                             \
+      _mm512_add_epi32 ((x), _mm512_loadu_si512 (state + (j) * AVX512_LANES)))
+
+  AVX512_ADD_STATE (0, a);
+  AVX512_ADD_STATE (1, b);
+  AVX512_ADD_STATE (2, c);
+  AVX512_ADD_STATE (3, d);
+
+#undef AVX512_ADD_STATE
+}
+
+const struct md5_multi_backend md5_multi_backend_avx512 = {
+  "avx512",
+  AVX512_LANES,
+  md5_multi_compress_avx512,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int md5_avx512_unused;
+
+#endif /* HAVE_AVX512_INTRINSICS */
@@ -0,0 +1,66 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between md5.c and the vector MD5 code that hashes several
+ * independent messages at once for md5_multi.
+ */
+
+#ifndef MD5_INTERNAL_H
+#define MD5_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Compresses one block for each of lanes independent messages, with the
+ * transposed state described in fcrypt_md.h.
+ */
+struct md5_multi_backend
+{
+  const char *name;
+  unsigned int lanes;
+  void (*compress) (uint32_t *, const uint8_t *const *);
+};
+
+/* Additive constants from RFC 1321, shared with the backends. */
+extern const uint32_t md5_ktable[64];
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* Eight lanes with AVX2 in md5-avx2.c. */
+extern const struct md5_multi_backend md5_multi_backend_avx2;
+#endif
+
+#if defined(HAVE_AVX512_INTRINSICS)
+/* Sixteen lanes with AVX-512 in md5-avx512.c. */
+extern const struct md5_multi_backend md5_multi_backend_avx512;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* Four lanes with NEON in md5-neon.c. */
+extern const struct md5_multi_backend md5_multi_backend_neon;
+#endif
+
+#endif /* MD5_INTERNAL_H */
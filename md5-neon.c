@@ -0,0 +1,148 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer MD5 with NEON, four messages at a time. This is the same as
+ * md5-avx2.c with 128-bit vectors, using SRI to build the rotations and BSL
+ * and ORN for the functions of RFC 1321.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "md5-internal.h"
+#include "md5.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_LANES 4
+
+#define NEON_ROTL(x, n) vsriq_n_u32 (vshlq_n_u32 ((x), (n)), (x), 32 - (n))
+
+/* BSL selects bits from its second argument where the first is set. */
+#define NEON_F1(b, c, d) vbslq_u32 ((b), (c), (d))
+#define NEON_F2(b, c, d) vbslq_u32 ((d), (b), (c))
+#define NEON_F3(b, c, d) veorq_u32 ((b), veorq_u32 ((c), (d)))
+#define NEON_F4(b, c, d) veorq_u32 ((c), vornq_u32 ((b), (d)))
+
+#define NEON_STEP(f, a, b, c, d, i, x, s)                                     \
+  do                                                                          \
+    {                                                                         \
+      (a) = vaddq_u32 (vaddq_u32 ((a), f ((b), (c), (d))),                    \
+                       vaddq_u32 (w[(x)], vdupq_n_u32 (md5_ktable[(i)])));    \
+      (a) = vaddq_u32 (NEON_ROTL ((a), (s)), (b));                            \
+    }                                                                         \
+  while (0)
+
+NEON_TARGET static void
+md5_multi_compress_neon (uint32_t *state, const uint8_t *const *blocks)
+{
+  uint32x4_t a, b, c, d;
+  uint32x4_t w[16];
+  uint32x4_t r0, r1, r2, r3;
+  uint32x4x2_t t0, t1;
+  unsigned int i;
+
+  /* Transpose four words at a time from the four blocks. */
+  for (i = 0; i < 16; i += 4)
+    {
+      r0 = vreinterpretq_u32_u8 (vld1q_u8 (blocks[0] + i * 4));
+      r1 = vreinterpretq_u32_u8 (vld1q_u8 (blocks[1] + i * 4));
+      r2 = vreinterpretq_u32_u8 (vld1q_u8 (blocks[2] + i * 4));
+      r3 = vreinterpretq_u32_u8 (vld1q_u8 (blocks[3] + i * 4));
+      t0 = vtrnq_u32 (r0, r1);
+      t1 = vtrnq_u32 (r2, r3);
+      w[i] = vcombine_u32 (vget_low_u32 (t0.val[0]),
+                           vget_low_u32 (t1.val[0]));
+      w[i + 1] = vcombine_u32 (vget_low_u32 (t0.val[1]),
+                               vget_low_u32 (t1.val[1]));
+      w[i + 2] = vcombine_u32 (vget_high_u32 (t0.val[0]),
+                               vget_high_u32 (t1.val[0]));
+      w[i + 3] = vcombine_u32 (vget_high_u32 (t0.val[1]),
+                               vget_high_u32 (t1.val[1]));
+    }
+
+  a = vld1q_u32 (state + 0 * NEON_LANES);
+  b = vld1q_u32 (state + 1 * NEON_LANES);
+  c = vld1q_u32 (state + 2 * NEON_LANES);
+  d = vld1q_u32 (state + 3 * NEON_LANES);
+
+  for (i = 0; i < 16; i += 4)
+    {
+      NEON_STEP (NEON_F1, a, b, c, d, i, i, 7);
+      NEON_STEP (NEON_F1, d, a, b, c, i + 1, i + 1, 12);
+      NEON_STEP (NEON_F1, c, d, a, b, i + 2, i + 2, 17);
+      NEON_STEP (NEON_F1, b, c, d, a, i + 3, i + 3, 22);
+    }
+  for (i = 16; i < 32; i += 4)
+    {
+      NEON_STEP (NEON_F2, a, b, c, d, i, (5 * i + 1) & 15, 5);
+      NEON_STEP (NEON_F2, d, a, b, c, i + 1, (5 * i + 6) & 15, 9);
+      NEON_STEP (NEON_F2, c, d, a, b, i + 2, (5 * i + 11) & 15, 14);
+      NEON_STEP (NEON_F2, b, c, d, a, i + 3, (5 * i + 16) & 15, 20);
+    }
+  for (i = 32; i < 48; i += 4)
+    {
+      NEON_STEP (NEON_F3, a, b, c, d, i, (3 * i + 5) & 15, 4);
+      NEON_STEP (NEON_F3, d, a, b, c, i + 1, (3 * i + 8) & 15, 11);
+      NEON_STEP (NEON_F3, c, d, a, b, i + 2, (3 * i + 11) & 15, 16);
+      NEON_STEP (NEON_F3, b, c, d, a, i + 3, (3 * i + 14) & 15, 23);
+    }
+  for (i = 48; i < 64; i += 4)
+    {
+      NEON_STEP (NEON_F4, a, b, c, d, i, (7 * i) & 15, 6);
+      NEON_STEP (NEON_F4, d, a, b, c, i + 1, (7 * i + 7) & 15, 10);
+      NEON_STEP (NEON_F4, c, d, a, b, i + 2, (7 * i + 14) & 15, 15);
+      NEON_STEP (NEON_F4, b, c, d, a, i + 3, (7 * i + 21) & 15, 21);
+    }
+
+  vst1q_u32 (state + 0 * NEON_LANES,
+             vaddq_u32 (a, vld1q_u32 (state + 0 * NEON_LANES)));
+  vst1q_u32 (state + 1 * NEON_LANES,
+             vaddq_u32 (b, vld1q_u32 (state + 1 * NEON_LANES)));
+  vst1q_u32 (state + 2 * NEON_LANES,
+             vaddq_u32 (c, vld1q_u32 (state + 2 * NEON_LANES)));
+  vst1q_u32 (state + 3 * NEON_LANES,
+             vaddq_u32 (d, vld1q_u32 (state + 3 * NEON_LANES)));
+}
+
+const struct md5_multi_backend md5_multi_backend_neon = {
+  "neon",
+  NEON_LANES,
+  md5_multi_compress_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int md5_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
@@ -23,12 +23,19 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "bswap.h"
 #include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_md.h"
+#include "fcrypt_wipe.h"
+#include "md5-internal.h"
 #include "md5.h"
 
 /* Functions used by MD5. */
@@ -46,6 +53,23 @@
     }                                                                         \
   while (0)
 
+/*
+ * The additive constants again as a table for the multi-buffer code, from
+ * (uint32_t)(4294967296.0 * fabs(sin(i))) for i = 1 to 64.
+ */
+const uint32_t md5_ktable[64]
+    = { 0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a,
+        0xa8304613, 0xfd469501, 0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821, 0xf61e2562, 0xc040b340,
+        0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8,
+        0x676f02d9, 0x8d2a4c8a, 0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70, 0x289b7ec6, 0xeaa127fa,
+        0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92,
+        0xffeff47d, 0x85845dd1, 0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391 };
+
 void
 md5_init (struct md5_ctx *ctx)
 {
@@ -56,6 +80,32 @@ md5_init (struct md5_ctx *ctx)
   ctx->count = 0;
 }
 
+/* Vector code used by md5_multi, or NULL to hash one message at a time. */
+static const struct md5_multi_backend *md5_multi_backend = NULL;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+md5_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_NEON) != 0)
+    md5_multi_backend = &md5_multi_backend_neon;
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    md5_multi_backend = &md5_multi_backend_avx2;
+#endif
+#if defined(HAVE_AVX512_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX512F) != 0)
+    md5_multi_backend = &md5_multi_backend_avx512;
+#endif
+}
+#endif /* __GNUC__ */
+
 /*
  * Constants calculated using:
  * for (i = 1; i < 65; ++i)
@@ -64,11 +114,10 @@ md5_init (struct md5_ctx *ctx)
 void
 md5_transform (uint32_t *state, const uint8_t *block)
 {
-  uint32_t a, b, c, d, i;
+  uint32_t a, b, c, d;
   uint32_t w[16];
 
-  for (i = 0; i < 16; ++i)
-    w[i] = buff_get_le32 (block + i * 4);
+  buff_get_le32_words (w, block, 16);
 
   a = state[0];
   b = state[1];
@@ -149,73 +198,86 @@ md5_transform (uint32_t *state, const uint8_t *block)
   state[3] += d;
 }
 
-void
-md5_update (struct md5_ctx *ctx, const void *inputptr, size_t inputlen)
+/* Compresses consecutive blocks, used for the update and final steps. */
+static void
+md5_compress (void *state, const uint8_t *blocks, size_t nblocks)
 {
-  size_t filled, need;
-  const uint8_t *input = inputptr;
+  for (; nblocks > 0; --nblocks, blocks += MD5_BLOCK_SIZE)
+    md5_transform (state, blocks);
+}
 
-  if (inputlen == 0)
-    return;
+void
+md5_update (struct md5_ctx *ctx, const void *input, size_t inputlen)
+{
+  fcrypt_md_update (ctx->state, &ctx->count, ctx->buffer, md5_compress, input,
+                    inputlen);
+}
 
-  filled = (size_t)((ctx->count >> 3) & (MD5_BLOCK_SIZE - 1));
-  need = MD5_BLOCK_SIZE - filled;
-  ctx->count += (uint64_t)(inputlen << 3);
+void
+md5_updatev (struct md5_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
 
-  /* Input too short to fill a complete block. */
-  if (inputlen < need)
-    {
-      memcpy (&ctx->buffer[filled], input, inputlen);
-      return;
-    }
+  for (i = 0; i < iovcnt; ++i)
+    md5_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
 
-  /* Check if we need to finish the buffer in ctx. */
-  if (filled != 0)
-    {
-      memcpy (&ctx->buffer[filled], input, need);
-      md5_transform (ctx->state, ctx->buffer);
-      inputlen -= need;
-      input += need;
-    }
+void
+md5_final (uint8_t *digest, struct md5_ctx *ctx)
+{
+  uint32_t i;
 
-  /* Handle as many blocks as possible. */
-  while (inputlen >= MD5_BLOCK_SIZE)
-    {
-      md5_transform (ctx->state, input);
-      inputlen -= MD5_BLOCK_SIZE;
-      input += MD5_BLOCK_SIZE;
-    }
+  fcrypt_md_final (ctx->state, ctx->count, ctx->buffer, md5_compress, 0x80,
+                   0);
+  for (i = 0; i < 4; ++i)
+    buff_put_le32 (digest + i * 4, ctx->state[i]);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
 
-  /* Save any remaining bytes. */
-  if (inputlen != 0)
-    memcpy (ctx->buffer, input, inputlen);
+void
+md5_copy (struct md5_ctx *dst, const struct md5_ctx *src)
+{
+  *dst = *src;
 }
 
+/* Hashes a whole message without buffering it through a context. */
 void
-md5_final (uint8_t *digest, struct md5_ctx *ctx)
+md5 (uint8_t *digest, const void *input, size_t inputlen)
 {
-  size_t padoffset;
+  struct md5_ctx ctx;
   uint32_t i;
 
-  padoffset = (size_t)((ctx->count >> 3) & (MD5_BLOCK_SIZE - 1));
-  ctx->buffer[padoffset++] = 0x80;
+  md5_init (&ctx);
+  fcrypt_md_oneshot (ctx.state, ctx.buffer, md5_compress, 0x80, 0, input,
+                     inputlen);
+  for (i = 0; i < 4; ++i)
+    buff_put_le32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
+}
 
-  /* Enough room for count. */
-  if (padoffset <= 56)
-    memset (&ctx->buffer[padoffset], 0, 56 - padoffset);
-  else
+/*
+ * Hashes count independent messages, writing the MD5_DIGEST_SIZE byte
+ * digest of message i to digests + i * MD5_DIGEST_SIZE.
+ */
+void
+md5_multi (uint8_t *digests, const uint8_t *const *messages,
+           const size_t *lens, size_t count)
+{
+  struct fcrypt_md_multi md;
+  struct md5_ctx ctx;
+
+  md5_init (&ctx);
+  md.iv = ctx.state;
+  md.words = 4;
+  md.digest_words = 4;
+  md.big_endian = 0;
+  md.compress = md5_compress;
+  md.lanes = 0;
+  md.compress_lanes = NULL;
+  if (md5_multi_backend != NULL)
     {
-      /* Not enough room for count. */
-      memset (&ctx->buffer[padoffset], 0, MD5_BLOCK_SIZE - padoffset);
-      md5_transform (ctx->state, ctx->buffer);
-      memset (ctx->buffer, 0, 56);
+      md.lanes = md5_multi_backend->lanes;
+      md.compress_lanes = md5_multi_backend->compress;
     }
-
-  /* Append the count and handle the block. */
-  buff_put_le64 (ctx->buffer + 56, ctx->count);
-  md5_transform (ctx->state, ctx->buffer);
-
-  for (i = 0; i < 4; ++i)
-    buff_put_le32 (digest + i * 4, ctx->state[i]);
-  memset (ctx, 0, sizeof (*ctx));
+  fcrypt_md_multi (&md, digests, messages, lens, count);
 }
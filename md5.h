@@ -29,6 +29,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct iovec;
+
 #define MD5_DIGEST_SIZE 16
 #define MD5_BLOCK_SIZE 64
 
@@ -42,6 +44,17 @@ struct md5_ctx
 void md5_init (struct md5_ctx *);
 void md5_transform (uint32_t *, const uint8_t *);
 void md5_update (struct md5_ctx *, const void *, size_t);
+void md5_updatev (struct md5_ctx *, const struct iovec *, size_t);
 void md5_final (uint8_t *, struct md5_ctx *);
+void md5_copy (struct md5_ctx *, const struct md5_ctx *);
+void md5 (uint8_t *, const void *, size_t);
+
+/*
+ * Hashes many independent messages at once, using the SIMD units to run the
+ * compression function on several of them in parallel. The arguments are the
+ * output buffer for the digests, stored one after another, the arrays of
+ * message pointers and lengths, and the number of messages.
+ */
+void md5_multi (uint8_t *, const uint8_t *const *, const size_t *, size_t);
 
 #endif /* MD5_H */
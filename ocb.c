@@ -0,0 +1,507 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "aes.h"
+#include "bswap.h"
+#include "fcrypt_memzero.h"
+#include "ocb.h"
+
+/* Number of blocks whose offsets are computed and enciphered at once. */
+#define OCB_BLOCKS 8
+
+/* Runs the block cipher in ECB mode on whole blocks, given a byte length. */
+typedef void ocb_ecb_func (void *, const uint8_t *, uint8_t *, size_t);
+
+/* Converts between a big-endian block value and the layout of ocb_key. */
+static inline void
+ocb_swap (uint64_t *x)
+{
+  x[0] = bswap64 (x[0]);
+  x[1] = bswap64 (x[1]);
+}
+
+/* Doubles a big-endian block value in GF(2^128). */
+static inline void
+ocb_double (uint64_t *x)
+{
+  uint64_t carry;
+
+  carry = x[0] >> 63;
+  x[0] = (x[0] << 1) | (x[1] >> 63);
+  x[1] = (x[1] << 1) ^ (carry * 0x87);
+}
+
+static inline unsigned int
+ocb_ntz (uint64_t i)
+{
+  unsigned int n;
+
+  for (n = 0; (i & 1) == 0; ++n)
+    i >>= 1;
+  return n;
+}
+
+/* Computes L_n, doubling the last precomputed value for huge messages. */
+static inline const uint64_t *
+ocb_get_l (const struct ocb_key *key, unsigned int n, uint64_t *l)
+{
+  if (n < OCB_L_SIZE)
+    return key->l[n];
+
+  l[0] = key->l[OCB_L_SIZE - 1][0];
+  l[1] = key->l[OCB_L_SIZE - 1][1];
+  ocb_swap (l);
+  for (; n >= OCB_L_SIZE; --n)
+    ocb_double (l);
+  ocb_swap (l);
+  return l;
+}
+
+static inline void
+ocb_load (uint64_t *x, const uint8_t *block)
+{
+  x[0] = buff_get_le64 (block);
+  x[1] = buff_get_le64 (block + 8);
+}
+
+static inline void
+ocb_store (uint8_t *block, const uint64_t *x)
+{
+  buff_put_le64 (block, x[0]);
+  buff_put_le64 (block + 8, x[1]);
+}
+
+static void
+ocb_set_key (struct ocb_key *key, void *cipher, ocb_ecb_func *enc)
+{
+  uint8_t block[OCB_BLOCK_SIZE];
+  uint64_t x[2];
+  unsigned int i;
+
+  /* L_* is the encryption of the zero block, and each next L doubles it. */
+  memset (block, 0, sizeof (block));
+  enc (cipher, block, block, sizeof (block));
+  x[0] = buff_get_be64 (block);
+  x[1] = buff_get_be64 (block + 8);
+  ocb_load (key->l_star, block);
+  ocb_double (x);
+  key->l_dollar[0] = x[0];
+  key->l_dollar[1] = x[1];
+  ocb_swap (key->l_dollar);
+  for (i = 0; i < OCB_L_SIZE; ++i)
+    {
+      ocb_double (x);
+      key->l[i][0] = x[0];
+      key->l[i][1] = x[1];
+      ocb_swap (key->l[i]);
+    }
+  fcrypt_memzero (block, sizeof (block));
+  fcrypt_memzero (x, sizeof (x));
+}
+
+/* Derives the initial offset from the nonce. */
+static void
+ocb_set_nonce (void *cipher, ocb_ecb_func *enc, const uint8_t *nonce,
+               size_t nonce_len, uint64_t *offset)
+{
+  uint8_t block[OCB_BLOCK_SIZE];
+  uint8_t stretch[OCB_BLOCK_SIZE + 8];
+  unsigned int bottom, shift, i;
+
+  memset (block, 0, sizeof (block));
+  block[OCB_BLOCK_SIZE - 1 - nonce_len] = 1;
+  memcpy (block + OCB_BLOCK_SIZE - nonce_len, nonce, nonce_len);
+  bottom = block[OCB_BLOCK_SIZE - 1] & 0x3f;
+  block[OCB_BLOCK_SIZE - 1] &= 0xc0;
+  enc (cipher, block, stretch, OCB_BLOCK_SIZE);
+  for (i = 0; i < 8; ++i)
+    stretch[OCB_BLOCK_SIZE + i] = stretch[i] ^ stretch[i + 1];
+
+  /* The offset is the 128 bits of Stretch starting at bit bottom. */
+  shift = bottom % 8;
+  for (i = 0; i < OCB_BLOCK_SIZE; ++i)
+    {
+      block[i] = stretch[i + bottom / 8] << shift;
+      if (shift != 0)
+        block[i] |= stretch[i + bottom / 8 + 1] >> (8 - shift);
+    }
+  ocb_load (offset, block);
+  fcrypt_memzero (block, sizeof (block));
+  fcrypt_memzero (stretch, sizeof (stretch));
+}
+
+/*
+ * Advances the offset over up to OCB_BLOCKS blocks starting after block
+ * index, storing the offset of each block in offsets.
+ */
+static inline void
+ocb_offsets (const struct ocb_key *key, uint64_t index, uint64_t *offset,
+             uint64_t *offsets, size_t n)
+{
+  const uint64_t *l;
+  uint64_t tmp[2];
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      l = ocb_get_l (key, ocb_ntz (index + i + 1), tmp);
+      offset[0] ^= l[0];
+      offset[1] ^= l[1];
+      offsets[2 * i] = offset[0];
+      offsets[2 * i + 1] = offset[1];
+    }
+}
+
+/* XORs the blocks in src with the offsets, a word at a time. */
+static inline void
+ocb_whiten (const uint64_t *offsets, const uint8_t *src, uint8_t *dest,
+            size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < 2 * n; ++i)
+    buff_put_le64 (dest + i * 8, buff_get_le64 (src + i * 8) ^ offsets[i]);
+}
+
+static inline void
+ocb_fold (uint64_t *sum, const uint8_t *data, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      sum[0] ^= buff_get_le64 (data + i * OCB_BLOCK_SIZE);
+      sum[1] ^= buff_get_le64 (data + i * OCB_BLOCK_SIZE + 8);
+    }
+}
+
+/* Computes HASH (K, A), enciphering OCB_BLOCKS whitened blocks per call. */
+static void
+ocb_hash (const struct ocb_key *key, void *cipher, ocb_ecb_func *enc,
+          const uint8_t *ad, size_t len, uint64_t *sum)
+{
+  uint8_t buffer[OCB_BLOCKS * OCB_BLOCK_SIZE];
+  uint64_t offsets[2 * OCB_BLOCKS];
+  uint64_t offset[2], index;
+  size_t blocks, n;
+
+  offset[0] = 0;
+  offset[1] = 0;
+  sum[0] = 0;
+  sum[1] = 0;
+  index = 0;
+  for (blocks = len / OCB_BLOCK_SIZE; blocks > 0; blocks -= n)
+    {
+      n = blocks < OCB_BLOCKS ? blocks : OCB_BLOCKS;
+      ocb_offsets (key, index, offset, offsets, n);
+      ocb_whiten (offsets, ad, buffer, n);
+      enc (cipher, buffer, buffer, n * OCB_BLOCK_SIZE);
+      ocb_fold (sum, buffer, n);
+      ad += n * OCB_BLOCK_SIZE;
+      index += n;
+    }
+
+  len %= OCB_BLOCK_SIZE;
+  if (len > 0)
+    {
+      memset (buffer, 0, OCB_BLOCK_SIZE);
+      memcpy (buffer, ad, len);
+      buffer[len] = 0x80;
+      offset[0] ^= key->l_star[0];
+      offset[1] ^= key->l_star[1];
+      ocb_whiten (offset, buffer, buffer, 1);
+      enc (cipher, buffer, buffer, OCB_BLOCK_SIZE);
+      ocb_fold (sum, buffer, 1);
+    }
+  fcrypt_memzero (buffer, sizeof (buffer));
+  fcrypt_memzero (offsets, sizeof (offsets));
+}
+
+/*
+ * Encrypts or decrypts the message, OCB_BLOCKS blocks per call of the ECB
+ * code f, and accumulates the checksum of the plaintext. A trailing partial
+ * block is XORed with a pad made by enciphering its offset with enc.
+ */
+static void
+ocb_crypt (const struct ocb_key *key, void *cipher, ocb_ecb_func *f,
+           ocb_ecb_func *enc, uint64_t *offset, uint64_t *checksum,
+           const uint8_t *src, uint8_t *dest, size_t len, int encrypt)
+{
+  uint8_t buffer[OCB_BLOCKS * OCB_BLOCK_SIZE];
+  uint64_t offsets[2 * OCB_BLOCKS];
+  uint64_t index;
+  size_t blocks, i, n;
+
+  index = 0;
+  for (blocks = len / OCB_BLOCK_SIZE; blocks > 0; blocks -= n)
+    {
+      n = blocks < OCB_BLOCKS ? blocks : OCB_BLOCKS;
+      ocb_offsets (key, index, offset, offsets, n);
+      if (encrypt)
+        ocb_fold (checksum, src, n);
+      ocb_whiten (offsets, src, buffer, n);
+      f (cipher, buffer, buffer, n * OCB_BLOCK_SIZE);
+      ocb_whiten (offsets, buffer, dest, n);
+      if (!encrypt)
+        ocb_fold (checksum, dest, n);
+      src += n * OCB_BLOCK_SIZE;
+      dest += n * OCB_BLOCK_SIZE;
+      index += n;
+    }
+
+  len %= OCB_BLOCK_SIZE;
+  if (len > 0)
+    {
+      offset[0] ^= key->l_star[0];
+      offset[1] ^= key->l_star[1];
+      ocb_store (buffer, offset);
+      enc (cipher, buffer, buffer, OCB_BLOCK_SIZE);
+      for (i = 0; i < len; ++i)
+        {
+          dest[i] = src[i] ^ buffer[i];
+          buffer[i] = encrypt ? src[i] : dest[i];
+        }
+      buffer[len] = 0x80;
+      memset (buffer + len + 1, 0, OCB_BLOCK_SIZE - len - 1);
+      ocb_fold (checksum, buffer, 1);
+    }
+  fcrypt_memzero (buffer, sizeof (buffer));
+  fcrypt_memzero (offsets, sizeof (offsets));
+}
+
+static void
+ocb_digest (const struct ocb_key *key, void *cipher, ocb_ecb_func *enc,
+            const uint64_t *offset, const uint64_t *checksum,
+            const uint64_t *sum, uint8_t *digest)
+{
+  uint8_t block[OCB_BLOCK_SIZE];
+  uint64_t x[2];
+
+  x[0] = checksum[0] ^ offset[0] ^ key->l_dollar[0];
+  x[1] = checksum[1] ^ offset[1] ^ key->l_dollar[1];
+  ocb_store (block, x);
+  enc (cipher, block, block, OCB_BLOCK_SIZE);
+  ocb_load (x, block);
+  x[0] ^= sum[0];
+  x[1] ^= sum[1];
+  ocb_store (digest, x);
+  fcrypt_memzero (block, sizeof (block));
+}
+
+static int
+ocb_seal (const struct ocb_key *key, void *cipher, ocb_ecb_func *enc,
+          const uint8_t *nonce, size_t nonce_len, const uint8_t *ad,
+          size_t ad_len, const uint8_t *src, uint8_t *dest, size_t len,
+          uint8_t *tag)
+{
+  uint64_t offset[2], checksum[2], sum[2];
+
+  if (nonce_len == 0 || nonce_len > OCB_MAX_NONCE_SIZE)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  ocb_hash (key, cipher, enc, ad, ad_len, sum);
+  ocb_set_nonce (cipher, enc, nonce, nonce_len, offset);
+  checksum[0] = 0;
+  checksum[1] = 0;
+  ocb_crypt (key, cipher, enc, enc, offset, checksum, src, dest, len, 1);
+  ocb_digest (key, cipher, enc, offset, checksum, sum, tag);
+  return 0;
+}
+
+/* Compares the tags in constant time, clearing the output on a mismatch. */
+static int
+ocb_verify (const uint8_t *digest, const uint8_t *tag, uint8_t *dest,
+            size_t len)
+{
+  uint8_t diff;
+  size_t i;
+
+  diff = 0;
+  for (i = 0; i < OCB_DIGEST_SIZE; ++i)
+    diff |= digest[i] ^ tag[i];
+  if (diff != 0)
+    {
+      fcrypt_memzero (dest, len);
+      return -1;
+    }
+  return 0;
+}
+
+static int
+ocb_open (const struct ocb_key *key, void *cipher, ocb_ecb_func *enc,
+          ocb_ecb_func *dec, const uint8_t *nonce, size_t nonce_len,
+          const uint8_t *ad, size_t ad_len, const uint8_t *src, uint8_t *dest,
+          size_t len, const uint8_t *tag)
+{
+  uint64_t offset[2], checksum[2], sum[2];
+  uint8_t digest[OCB_DIGEST_SIZE];
+
+  if (nonce_len == 0 || nonce_len > OCB_MAX_NONCE_SIZE)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  ocb_hash (key, cipher, enc, ad, ad_len, sum);
+  ocb_set_nonce (cipher, enc, nonce, nonce_len, offset);
+  checksum[0] = 0;
+  checksum[1] = 0;
+  ocb_crypt (key, cipher, dec, enc, offset, checksum, src, dest, len, 0);
+  ocb_digest (key, cipher, enc, offset, checksum, sum, digest);
+  return ocb_verify (digest, tag, dest, len);
+}
+
+static void
+ocb_aes128_encrypt (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes128_ecb_encrypt ((struct aes128_ctx *)cipher, src, dest, len);
+}
+
+static void
+ocb_aes128_decrypt (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes128_ecb_decrypt ((struct aes128_ctx *)cipher, src, dest, len);
+}
+
+void
+aes128_ocb_set_key (struct aes128_ocb_ctx *ctx, const uint8_t *key)
+{
+  aes128_set_decrypt_key (&ctx->cipher, key);
+  ocb_set_key (&ctx->key, &ctx->cipher, ocb_aes128_encrypt);
+}
+
+int
+aes128_ocb_seal (struct aes128_ocb_ctx *ctx, const uint8_t *nonce,
+                 size_t nonce_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len, uint8_t *tag)
+{
+  return ocb_seal (&ctx->key, &ctx->cipher, ocb_aes128_encrypt, nonce,
+                   nonce_len, ad, ad_len, src, dest, len, tag);
+}
+
+int
+aes128_ocb_open (struct aes128_ocb_ctx *ctx, const uint8_t *nonce,
+                 size_t nonce_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len,
+                 const uint8_t *tag)
+{
+  return ocb_open (&ctx->key, &ctx->cipher, ocb_aes128_encrypt,
+                   ocb_aes128_decrypt, nonce, nonce_len, ad, ad_len, src,
+                   dest, len, tag);
+}
+
+static void
+ocb_aes192_encrypt (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes192_ecb_encrypt ((struct aes192_ctx *)cipher, src, dest, len);
+}
+
+static void
+ocb_aes192_decrypt (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes192_ecb_decrypt ((struct aes192_ctx *)cipher, src, dest, len);
+}
+
+void
+aes192_ocb_set_key (struct aes192_ocb_ctx *ctx, const uint8_t *key)
+{
+  aes192_set_decrypt_key (&ctx->cipher, key);
+  ocb_set_key (&ctx->key, &ctx->cipher, ocb_aes192_encrypt);
+}
+
+int
+aes192_ocb_seal (struct aes192_ocb_ctx *ctx, const uint8_t *nonce,
+                 size_t nonce_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len, uint8_t *tag)
+{
+  return ocb_seal (&ctx->key, &ctx->cipher, ocb_aes192_encrypt, nonce,
+                   nonce_len, ad, ad_len, src, dest, len, tag);
+}
+
+int
+aes192_ocb_open (struct aes192_ocb_ctx *ctx, const uint8_t *nonce,
+                 size_t nonce_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len,
+                 const uint8_t *tag)
+{
+  return ocb_open (&ctx->key, &ctx->cipher, ocb_aes192_encrypt,
+                   ocb_aes192_decrypt, nonce, nonce_len, ad, ad_len, src,
+                   dest, len, tag);
+}
+
+static void
+ocb_aes256_encrypt (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes256_ecb_encrypt ((struct aes256_ctx *)cipher, src, dest, len);
+}
+
+static void
+ocb_aes256_decrypt (void *cipher, const uint8_t *src, uint8_t *dest,
+                    size_t len)
+{
+  aes256_ecb_decrypt ((struct aes256_ctx *)cipher, src, dest, len);
+}
+
+void
+aes256_ocb_set_key (struct aes256_ocb_ctx *ctx, const uint8_t *key)
+{
+  aes256_set_decrypt_key (&ctx->cipher, key);
+  ocb_set_key (&ctx->key, &ctx->cipher, ocb_aes256_encrypt);
+}
+
+int
+aes256_ocb_seal (struct aes256_ocb_ctx *ctx, const uint8_t *nonce,
+                 size_t nonce_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len, uint8_t *tag)
+{
+  return ocb_seal (&ctx->key, &ctx->cipher, ocb_aes256_encrypt, nonce,
+                   nonce_len, ad, ad_len, src, dest, len, tag);
+}
+
+int
+aes256_ocb_open (struct aes256_ocb_ctx *ctx, const uint8_t *nonce,
+                 size_t nonce_len, const uint8_t *ad, size_t ad_len,
+                 const uint8_t *src, uint8_t *dest, size_t len,
+                 const uint8_t *tag)
+{
+  return ocb_open (&ctx->key, &ctx->cipher, ocb_aes256_encrypt,
+                   ocb_aes256_decrypt, nonce, nonce_len, ad, ad_len, src,
+                   dest, len, tag);
+}
@@ -0,0 +1,107 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * OCB3 authenticated encryption as described in RFC 7253, "The OCB
+ * Authenticated-Encryption Algorithm", with 128-bit tags.
+ */
+
+#ifndef OCB_H
+#define OCB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aes.h"
+
+#define OCB_BLOCK_SIZE 16
+#define OCB_NONCE_SIZE 12
+#define OCB_MAX_NONCE_SIZE 15
+#define OCB_DIGEST_SIZE 16
+
+/* Number of precomputed L_i offsets, enough for messages of 64 GiB. */
+#define OCB_L_SIZE 32
+
+/*
+ * Offsets derived from the key. The words hold the blocks read as pairs of
+ * little-endian integers, the same way the data is read when it is XORed
+ * with them.
+ */
+struct ocb_key
+{
+  uint64_t l_star[2];
+  uint64_t l_dollar[2];
+  uint64_t l[OCB_L_SIZE][2];
+};
+
+struct aes128_ocb_ctx
+{
+  struct aes128_ctx cipher;
+  struct ocb_key key;
+};
+
+struct aes192_ocb_ctx
+{
+  struct aes192_ctx cipher;
+  struct ocb_key key;
+};
+
+struct aes256_ocb_ctx
+{
+  struct aes256_ctx cipher;
+  struct ocb_key key;
+};
+
+void aes128_ocb_set_key (struct aes128_ocb_ctx *, const uint8_t *);
+void aes192_ocb_set_key (struct aes192_ocb_ctx *, const uint8_t *);
+void aes256_ocb_set_key (struct aes256_ocb_ctx *, const uint8_t *);
+
+/*
+ * One-shot interface. The arguments are the nonce and its length, between 1
+ * and OCB_MAX_NONCE_SIZE bytes, the associated data, the input, the output
+ * and its length, and the tag. Both return -1 with errno set to EINVAL if
+ * the nonce length is invalid. Open also returns -1 if the tag does not
+ * match, in which case the output is cleared.
+ */
+int aes128_ocb_seal (struct aes128_ocb_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, uint8_t *);
+int aes192_ocb_seal (struct aes192_ocb_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, uint8_t *);
+int aes256_ocb_seal (struct aes256_ocb_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, uint8_t *);
+int aes128_ocb_open (struct aes128_ocb_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, const uint8_t *);
+int aes192_ocb_open (struct aes192_ocb_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, const uint8_t *);
+int aes256_ocb_open (struct aes256_ocb_ctx *, const uint8_t *, size_t,
+                     const uint8_t *, size_t, const uint8_t *, uint8_t *,
+                     size_t, const uint8_t *);
+
+#endif /* OCB_H */
@@ -0,0 +1,308 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "fcrypt_md.h"
+#include "fcrypt_memzero.h"
+#include "hmac.h"
+#include "pbkdf2.h"
+#include "sha1.h"
+#include "sha256-internal.h"
+#include "sha256.h"
+#include "sha512.h"
+
+/*
+ * Each output block T_i is the XOR of U_1 ... U_c, where U_1 is the HMAC of
+ * the salt and i, and every later U is the HMAC of the one before it. The
+ * HMAC key never changes, so the hash states after the padded key blocks
+ * are computed once by hmac_*_set_key. From U_2 on the message is a single
+ * digest, so the inner and outer hashes are each one block with fixed
+ * padding: the digest goes at the start of the block and everything after
+ * it stays the same. Every iteration is then two calls to the compression
+ * function on those blocks, without any of the buffering in the update and
+ * final functions.
+ */
+
+/*
+ * Fills in the padding of a block that holds one digest of digest_size
+ * bytes after a block of key, which is the same for both HMAC hashes.
+ */
+static void
+pbkdf2_pad (uint8_t *block, size_t digest_size, size_t block_size)
+{
+  memset (block + digest_size, 0, block_size - digest_size);
+  block[digest_size] = 0x80;
+  buff_put_be64 (block + block_size - 8,
+                 (uint64_t) (block_size + digest_size) * 8);
+}
+
+/*
+ * Defines pbkdf2_name_block, which computes output block index into t. It
+ * reads the inner and outer key states from the prepared HMAC key. The hash
+ * state is eight words of type word_t and the digest is the first
+ * digest_words of them, stored big-endian.
+ */
+#define PBKDF2_BLOCK(name, word_t, bits, digest_words, block_size)            \
+  static void pbkdf2_##name##_block (                                         \
+      uint8_t *t, const struct hmac_##name##_key *key, const uint8_t *salt,   \
+      size_t saltlen, uint32_t index, uint64_t iterations)                    \
+  {                                                                           \
+    struct hmac_##name##_ctx ctx;                                             \
+    word_t state[8], sum[digest_words];                                       \
+    uint8_t ib[block_size], ob[block_size], be[4];                            \
+    size_t j;                                                                 \
+                                                                              \
+    buff_put_be32 (be, index);                                                \
+    hmac_##name##_init (&ctx, key);                                           \
+    hmac_##name##_update (&ctx, salt, saltlen);                               \
+    hmac_##name##_update (&ctx, be, sizeof (be));                             \
+    hmac_##name##_final (ib, &ctx);                                           \
+                                                                              \
+    pbkdf2_pad (ib, sizeof (sum), sizeof (ib));                               \
+    pbkdf2_pad (ob, sizeof (sum), sizeof (ob));                               \
+    for (j = 0; j < (digest_words); ++j)                                      \
+      sum[j] = buff_get_be##bits (ib + j * sizeof (word_t));                  \
+                                                                              \
+    for (; iterations > 1; --iterations)                                      \
+      {                                                                       \
+        memcpy (state, key->inner.state, sizeof (state));                     \
+        name##_transform (state, ib);                                         \
+        for (j = 0; j < (digest_words); ++j)                                  \
+          buff_put_be##bits (ob + j * sizeof (word_t), state[j]);             \
+        memcpy (state, key->outer.state, sizeof (state));                     \
+        name##_transform (state, ob);                                         \
+        for (j = 0; j < (digest_words); ++j)                                  \
+          {                                                                   \
+            sum[j] ^= state[j];                                               \
+            buff_put_be##bits (ib + j * sizeof (word_t), state[j]);           \
+          }                                                                   \
+      }                                                                       \
+                                                                              \
+    for (j = 0; j < (digest_words); ++j)                                      \
+      buff_put_be##bits (t + j * sizeof (word_t), sum[j]);                    \
+    fcrypt_memzero (state, sizeof (state));                                   \
+    fcrypt_memzero (sum, sizeof (sum));                                       \
+    fcrypt_memzero (ib, sizeof (ib));                                         \
+    fcrypt_memzero (ob, sizeof (ob));                                         \
+  }
+
+PBKDF2_BLOCK (sha1, uint32_t, 32, 5, SHA1_BLOCK_SIZE)
+PBKDF2_BLOCK (sha256, uint32_t, 32, 8, SHA256_BLOCK_SIZE)
+PBKDF2_BLOCK (sha512, uint64_t, 64, 8, SHA512_BLOCK_SIZE)
+
+/*
+ * Computes count consecutive output blocks of PBKDF2-HMAC-SHA256, starting
+ * at index, one in each lane of the multi-buffer backend. The blocks are
+ * independent, so every compression function call advances all of them.
+ * The states are transposed as in fcrypt_md.h. Unused lanes hash a block
+ * of padding and are ignored.
+ */
+static void
+pbkdf2_sha256_lanes (uint8_t *t, const struct hmac_sha256_key *key,
+                     const uint8_t *salt, size_t saltlen, uint32_t index,
+                     size_t count, uint64_t iterations,
+                     const struct sha256_multi_backend *backend)
+{
+  struct hmac_sha256_ctx ctx;
+  uint32_t inner[8 * FCRYPT_MD_MAX_LANES], outer[8 * FCRYPT_MD_MAX_LANES];
+  uint32_t state[8 * FCRYPT_MD_MAX_LANES], sum[8 * FCRYPT_MD_MAX_LANES];
+  uint8_t ib[FCRYPT_MD_MAX_LANES][SHA256_BLOCK_SIZE];
+  uint8_t ob[FCRYPT_MD_MAX_LANES][SHA256_BLOCK_SIZE];
+  const uint8_t *ibp[FCRYPT_MD_MAX_LANES], *obp[FCRYPT_MD_MAX_LANES];
+  const size_t lanes = backend->lanes;
+  uint8_t be[4];
+  size_t j, l;
+
+  for (l = 0; l < lanes; ++l)
+    {
+      if (l < count)
+        {
+          buff_put_be32 (be, index + (uint32_t) l);
+          hmac_sha256_init (&ctx, key);
+          hmac_sha256_update (&ctx, salt, saltlen);
+          hmac_sha256_update (&ctx, be, sizeof (be));
+          hmac_sha256_final (ib[l], &ctx);
+        }
+      else
+        memset (ib[l], 0, SHA256_DIGEST_SIZE);
+      pbkdf2_pad (ib[l], SHA256_DIGEST_SIZE, SHA256_BLOCK_SIZE);
+      pbkdf2_pad (ob[l], SHA256_DIGEST_SIZE, SHA256_BLOCK_SIZE);
+      ibp[l] = ib[l];
+      obp[l] = ob[l];
+      for (j = 0; j < 8; ++j)
+        {
+          inner[j * lanes + l] = key->inner.state[j];
+          outer[j * lanes + l] = key->outer.state[j];
+          sum[j * lanes + l] = buff_get_be32 (ib[l] + j * 4);
+        }
+    }
+
+  for (; iterations > 1; --iterations)
+    {
+      memcpy (state, inner, 8 * lanes * sizeof (uint32_t));
+      backend->compress (state, ibp);
+      for (l = 0; l < lanes; ++l)
+        for (j = 0; j < 8; ++j)
+          buff_put_be32 (ob[l] + j * 4, state[j * lanes + l]);
+      memcpy (state, outer, 8 * lanes * sizeof (uint32_t));
+      backend->compress (state, obp);
+      for (j = 0; j < 8 * lanes; ++j)
+        sum[j] ^= state[j];
+      for (l = 0; l < lanes; ++l)
+        for (j = 0; j < 8; ++j)
+          buff_put_be32 (ib[l] + j * 4, state[j * lanes + l]);
+    }
+
+  for (l = 0; l < count; ++l)
+    for (j = 0; j < 8; ++j)
+      buff_put_be32 (t + l * SHA256_DIGEST_SIZE + j * 4, sum[j * lanes + l]);
+  fcrypt_memzero (state, sizeof (state));
+  fcrypt_memzero (sum, sizeof (sum));
+  fcrypt_memzero (ib, sizeof (ib));
+  fcrypt_memzero (ob, sizeof (ob));
+}
+
+/*
+ * Checks the arguments shared by every hash. RFC 8018 limits the output to
+ * 2^32 - 1 blocks, since the block index is 32 bits.
+ */
+static int
+pbkdf2_check (size_t outlen, size_t digest_size, uint64_t iterations)
+{
+  if (iterations == 0
+      || (uint64_t) outlen > (uint64_t) UINT32_MAX * digest_size)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  return 0;
+}
+
+int
+pbkdf2_hmac_sha1 (uint8_t *out, size_t outlen, const void *pass,
+                  size_t passlen, const uint8_t *salt, size_t saltlen,
+                  uint64_t iterations)
+{
+  struct hmac_sha1_key key;
+  uint8_t t[SHA1_DIGEST_SIZE];
+  uint32_t index;
+  size_t len;
+
+  if (pbkdf2_check (outlen, SHA1_DIGEST_SIZE, iterations) != 0)
+    return -1;
+  hmac_sha1_set_key (&key, pass, passlen);
+  for (index = 1; outlen > 0; ++index)
+    {
+      len = outlen < sizeof (t) ? outlen : sizeof (t);
+      pbkdf2_sha1_block (t, &key, salt, saltlen, index, iterations);
+      memcpy (out, t, len);
+      out += len;
+      outlen -= len;
+    }
+  fcrypt_memzero (&key, sizeof (key));
+  fcrypt_memzero (t, sizeof (t));
+  return 0;
+}
+
+/*
+ * The multi-buffer backend is only worth it while at least half of its lanes
+ * have an output block to work on, the same rule as fcrypt_md_multi. The
+ * rest of the blocks go through the single-block loop, which uses the SHA
+ * extensions when the CPU has them.
+ */
+int
+pbkdf2_hmac_sha256 (uint8_t *out, size_t outlen, const void *pass,
+                    size_t passlen, const uint8_t *salt, size_t saltlen,
+                    uint64_t iterations)
+{
+  const struct sha256_multi_backend *backend = sha256_multi_get_backend ();
+  struct hmac_sha256_key key;
+  uint8_t t[FCRYPT_MD_MAX_LANES * SHA256_DIGEST_SIZE];
+  uint32_t index = 1;
+  size_t count, len;
+
+  if (pbkdf2_check (outlen, SHA256_DIGEST_SIZE, iterations) != 0)
+    return -1;
+  hmac_sha256_set_key (&key, pass, passlen);
+  while (outlen > 0)
+    {
+      count = (outlen + SHA256_DIGEST_SIZE - 1) / SHA256_DIGEST_SIZE;
+      if (backend != NULL && count * 2 > backend->lanes)
+        {
+          if (count > backend->lanes)
+            count = backend->lanes;
+          pbkdf2_sha256_lanes (t, &key, salt, saltlen, index, count,
+                               iterations, backend);
+        }
+      else
+        {
+          count = 1;
+          pbkdf2_sha256_block (t, &key, salt, saltlen, index, iterations);
+        }
+      len = count * SHA256_DIGEST_SIZE;
+      if (len > outlen)
+        len = outlen;
+      memcpy (out, t, len);
+      out += len;
+      outlen -= len;
+      index += (uint32_t) count;
+    }
+  fcrypt_memzero (&key, sizeof (key));
+  fcrypt_memzero (t, sizeof (t));
+  return 0;
+}
+
+int
+pbkdf2_hmac_sha512 (uint8_t *out, size_t outlen, const void *pass,
+                    size_t passlen, const uint8_t *salt, size_t saltlen,
+                    uint64_t iterations)
+{
+  struct hmac_sha512_key key;
+  uint8_t t[SHA512_DIGEST_SIZE];
+  uint32_t index;
+  size_t len;
+
+  if (pbkdf2_check (outlen, SHA512_DIGEST_SIZE, iterations) != 0)
+    return -1;
+  hmac_sha512_set_key (&key, pass, passlen);
+  for (index = 1; outlen > 0; ++index)
+    {
+      len = outlen < sizeof (t) ? outlen : sizeof (t);
+      pbkdf2_sha512_block (t, &key, salt, saltlen, index, iterations);
+      memcpy (out, t, len);
+      out += len;
+      outlen -= len;
+    }
+  fcrypt_memzero (&key, sizeof (key));
+  fcrypt_memzero (t, sizeof (t));
+  return 0;
+}
@@ -0,0 +1,51 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * PBKDF2 as described in RFC 8018 section 5.2, with HMAC as the
+ * pseudorandom function.
+ */
+
+#ifndef PBKDF2_H
+#define PBKDF2_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Derives a key of the given length from a password and salt with the given
+ * iteration count. The arguments are the output and its length, the
+ * password and its length, the salt and its length, and the count. Returns
+ * 0, or -1 with errno set to EINVAL if the count is zero or the output is
+ * longer than RFC 8018 allows.
+ */
+int pbkdf2_hmac_sha1 (uint8_t *, size_t, const void *, size_t,
+                      const uint8_t *, size_t, uint64_t);
+int pbkdf2_hmac_sha256 (uint8_t *, size_t, const void *, size_t,
+                        const uint8_t *, size_t, uint64_t);
+int pbkdf2_hmac_sha512 (uint8_t *, size_t, const void *, size_t,
+                        const uint8_t *, size_t, uint64_t);
+
+#endif /* PBKDF2_H */
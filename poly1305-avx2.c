@@ -0,0 +1,297 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Poly1305 with AVX2, accumulating four interleaved sums in radix 2^26.
+ * Lane j absorbs blocks j, j + 4, j + 8 and so on, each step multiplying
+ * by r^4. At the end lane j is multiplied by r^(4 - j) and the lanes are
+ * added, which gives the same result as absorbing the blocks in order.
+ * The accumulator is converted from and back to the radix 2^44 form used
+ * by poly1305.c on every call.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "poly1305-internal.h"
+#include "poly1305.h"
+
+#if defined(HAVE_AVX2_INTRINSICS) && defined(POLY1305_RADIX44)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_LANES 4
+
+#define POLY1305_MASK26 UINT64_C (0x3ffffff)
+#define POLY1305_MASK42 UINT64_C (0x3ffffffffff)
+#define POLY1305_MASK44 UINT64_C (0xfffffffffff)
+
+/*
+ * Splits the three limb value a into five 26-bit limbs. Only the top limb
+ * may be left above its width.
+ */
+static void
+poly1305_to_radix26 (uint64_t *out, const uint64_t *a)
+{
+  uint64_t a0 = a[0], a1 = a[1], a2 = a[2], c, lo, hi;
+
+  c = a2 >> 42;
+  a2 &= POLY1305_MASK42;
+  a0 += c * 5;
+  c = a0 >> 44;
+  a0 &= POLY1305_MASK44;
+  a1 += c;
+  c = a1 >> 44;
+  a1 &= POLY1305_MASK44;
+  a2 += c;
+
+  lo = a0 | (a1 << 44);
+  hi = (a1 >> 20) | (a2 << 24);
+  out[0] = lo & POLY1305_MASK26;
+  out[1] = (lo >> 26) & POLY1305_MASK26;
+  out[2] = ((lo >> 52) | (hi << 12)) & POLY1305_MASK26;
+  out[3] = (hi >> 14) & POLY1305_MASK26;
+  out[4] = (hi >> 40) | ((a2 >> 40) << 24);
+}
+
+/*
+ * Carries the five limb value a and packs it into three 44-bit limbs. Only
+ * the top limb may be left above its width.
+ */
+static void
+poly1305_from_radix26 (uint64_t *out, const uint64_t *a)
+{
+  uint64_t a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4], c;
+  uint64_t lo, hi;
+
+  c = a4 >> 26;
+  a4 &= POLY1305_MASK26;
+  a0 += c * 5;
+  c = a0 >> 26;
+  a0 &= POLY1305_MASK26;
+  a1 += c;
+  c = a1 >> 26;
+  a1 &= POLY1305_MASK26;
+  a2 += c;
+  c = a2 >> 26;
+  a2 &= POLY1305_MASK26;
+  a3 += c;
+  c = a3 >> 26;
+  a3 &= POLY1305_MASK26;
+  a4 += c;
+
+  lo = a0 | (a1 << 26) | (a2 << 52);
+  hi = (a2 >> 12) | (a3 << 14) | (a4 << 40);
+  out[0] = lo & POLY1305_MASK44;
+  out[1] = ((lo >> 44) | (hi << 20)) & POLY1305_MASK44;
+  out[2] = (hi >> 24) | ((a4 >> 24) << 40);
+}
+
+/* Computes out = a * b mod 2^130 - 5 in radix 2^26, partially reduced. */
+static void
+poly1305_mul_radix26 (uint64_t *out, const uint64_t *a, const uint64_t *b)
+{
+  const uint64_t s1 = b[1] * 5, s2 = b[2] * 5, s3 = b[3] * 5;
+  const uint64_t s4 = b[4] * 5;
+  uint64_t d0, d1, d2, d3, d4, c;
+
+  d0 = a[0] * b[0] + a[1] * s4 + a[2] * s3 + a[3] * s2 + a[4] * s1;
+  d1 = a[0] * b[1] + a[1] * b[0] + a[2] * s4 + a[3] * s3 + a[4] * s2;
+  d2 = a[0] * b[2] + a[1] * b[1] + a[2] * b[0] + a[3] * s4 + a[4] * s3;
+  d3 = a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0] + a[4] * s4;
+  d4 = a[0] * b[4] + a[1] * b[3] + a[2] * b[2] + a[3] * b[1] + a[4] * b[0];
+
+  c = d0 >> 26;
+  d1 += c;
+  c = d1 >> 26;
+  d2 += c;
+  c = d2 >> 26;
+  d3 += c;
+  c = d3 >> 26;
+  d4 += c;
+  c = d4 >> 26;
+  out[0] = (d0 & POLY1305_MASK26) + c * 5;
+  out[1] = d1 & POLY1305_MASK26;
+  out[2] = d2 & POLY1305_MASK26;
+  out[3] = d3 & POLY1305_MASK26;
+  out[4] = d4 & POLY1305_MASK26;
+  c = out[0] >> 26;
+  out[0] &= POLY1305_MASK26;
+  out[1] += c;
+}
+
+/*
+ * Multiplies the lanes of h by r, whose limbs are in r and their multiples
+ * by five in s, and carries the products back to 26-bit limbs.
+ */
+AVX2_TARGET static inline void
+avx2_mul (__m256i *h, const __m256i *r, const __m256i *s)
+{
+  const __m256i mask = _mm256_set1_epi64x ((long long)POLY1305_MASK26);
+  __m256i d[5], c;
+  int i;
+
+  d[0] = _mm256_add_epi64 (
+      _mm256_add_epi64 (_mm256_mul_epu32 (h[0], r[0]),
+                        _mm256_mul_epu32 (h[1], s[4])),
+      _mm256_add_epi64 (
+          _mm256_add_epi64 (_mm256_mul_epu32 (h[2], s[3]),
+                            _mm256_mul_epu32 (h[3], s[2])),
+          _mm256_mul_epu32 (h[4], s[1])));
+  d[1] = _mm256_add_epi64 (
+      _mm256_add_epi64 (_mm256_mul_epu32 (h[0], r[1]),
+                        _mm256_mul_epu32 (h[1], r[0])),
+      _mm256_add_epi64 (
+          _mm256_add_epi64 (_mm256_mul_epu32 (h[2], s[4]),
+                            _mm256_mul_epu32 (h[3], s[3])),
+          _mm256_mul_epu32 (h[4], s[2])));
+  d[2] = _mm256_add_epi64 (
+      _mm256_add_epi64 (_mm256_mul_epu32 (h[0], r[2]),
+                        _mm256_mul_epu32 (h[1], r[1])),
+      _mm256_add_epi64 (
+          _mm256_add_epi64 (_mm256_mul_epu32 (h[2], r[0]),
+                            _mm256_mul_epu32 (h[3], s[4])),
+          _mm256_mul_epu32 (h[4], s[3])));
+  d[3] = _mm256_add_epi64 (
+      _mm256_add_epi64 (_mm256_mul_epu32 (h[0], r[3]),
+                        _mm256_mul_epu32 (h[1], r[2])),
+      _mm256_add_epi64 (
+          _mm256_add_epi64 (_mm256_mul_epu32 (h[2], r[1]),
+                            _mm256_mul_epu32 (h[3], r[0])),
+          _mm256_mul_epu32 (h[4], s[4])));
+  d[4] = _mm256_add_epi64 (
+      _mm256_add_epi64 (_mm256_mul_epu32 (h[0], r[4]),
+                        _mm256_mul_epu32 (h[1], r[3])),
+      _mm256_add_epi64 (
+          _mm256_add_epi64 (_mm256_mul_epu32 (h[2], r[2]),
+                            _mm256_mul_epu32 (h[3], r[1])),
+          _mm256_mul_epu32 (h[4], r[0])));
+
+  for (i = 0; i < 4; ++i)
+    {
+      c = _mm256_srli_epi64 (d[i], 26);
+      h[i] = _mm256_and_si256 (d[i], mask);
+      d[i + 1] = _mm256_add_epi64 (d[i + 1], c);
+    }
+  c = _mm256_srli_epi64 (d[4], 26);
+  h[4] = _mm256_and_si256 (d[4], mask);
+  h[0] = _mm256_add_epi64 (h[0],
+                           _mm256_add_epi64 (c, _mm256_slli_epi64 (c, 2)));
+  c = _mm256_srli_epi64 (h[0], 26);
+  h[0] = _mm256_and_si256 (h[0], mask);
+  h[1] = _mm256_add_epi64 (h[1], c);
+}
+
+/* Adds four consecutive message blocks to the lanes of h. */
+AVX2_TARGET static inline void
+avx2_add_blocks (__m256i *h, const uint8_t *m)
+{
+  const __m256i mask = _mm256_set1_epi64x ((long long)POLY1305_MASK26);
+  const __m256i hibit = _mm256_set1_epi64x (1 << 24);
+  __m256i a, b, lo, hi;
+
+  a = _mm256_loadu_si256 ((const __m256i *)m);
+  b = _mm256_loadu_si256 ((const __m256i *)(m + 32));
+  lo = _mm256_permute4x64_epi64 (_mm256_unpacklo_epi64 (a, b), 0xd8);
+  hi = _mm256_permute4x64_epi64 (_mm256_unpackhi_epi64 (a, b), 0xd8);
+
+  h[0] = _mm256_add_epi64 (h[0], _mm256_and_si256 (lo, mask));
+  h[1] = _mm256_add_epi64 (
+      h[1], _mm256_and_si256 (_mm256_srli_epi64 (lo, 26), mask));
+  h[2] = _mm256_add_epi64 (
+      h[2], _mm256_and_si256 (_mm256_or_si256 (_mm256_srli_epi64 (lo, 52),
+                                               _mm256_slli_epi64 (hi, 12)),
+                              mask));
+  h[3] = _mm256_add_epi64 (
+      h[3], _mm256_and_si256 (_mm256_srli_epi64 (hi, 14), mask));
+  h[4] = _mm256_add_epi64 (
+      h[4], _mm256_or_si256 (_mm256_srli_epi64 (hi, 40), hibit));
+}
+
+AVX2_TARGET static void
+poly1305_blocks_avx2 (struct poly1305_ctx *ctx, const uint8_t *m,
+                      size_t count)
+{
+  uint64_t r1[5], r2[5], r3[5], r4[5], h[5], lanes[AVX2_LANES];
+  __m256i vh[5], vr[5], vs[5];
+  size_t i, j;
+
+  poly1305_to_radix26 (r1, ctx->r);
+  poly1305_mul_radix26 (r2, r1, r1);
+  poly1305_mul_radix26 (r3, r2, r1);
+  poly1305_mul_radix26 (r4, r2, r2);
+
+  /* The running accumulator starts in the first lane. */
+  poly1305_to_radix26 (h, ctx->h);
+  for (i = 0; i < 5; ++i)
+    {
+      vh[i] = _mm256_set_epi64x (0, 0, 0, (long long)h[i]);
+      vr[i] = _mm256_set1_epi64x ((long long)r4[i]);
+      vs[i] = _mm256_set1_epi64x ((long long)(r4[i] * 5));
+    }
+
+  avx2_add_blocks (vh, m);
+  for (j = AVX2_LANES; j < count; j += AVX2_LANES)
+    {
+      avx2_mul (vh, vr, vs);
+      avx2_add_blocks (vh, m + j * POLY1305_BLOCK_SIZE);
+    }
+
+  /* Multiply lane j by r^(4 - j) and add the lanes together. */
+  for (i = 0; i < 5; ++i)
+    {
+      vr[i] = _mm256_set_epi64x ((long long)r1[i], (long long)r2[i],
+                                 (long long)r3[i], (long long)r4[i]);
+      vs[i] = _mm256_set_epi64x ((long long)(r1[i] * 5),
+                                 (long long)(r2[i] * 5),
+                                 (long long)(r3[i] * 5),
+                                 (long long)(r4[i] * 5));
+    }
+  avx2_mul (vh, vr, vs);
+  for (i = 0; i < 5; ++i)
+    {
+      _mm256_storeu_si256 ((__m256i *)lanes, vh[i]);
+      h[i] = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+  poly1305_from_radix26 (ctx->h, h);
+}
+
+const struct poly1305_backend poly1305_backend_avx2 = {
+  "avx2",
+  AVX2_LANES,
+  poly1305_blocks_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int poly1305_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS && POLY1305_RADIX44 */
@@ -0,0 +1,66 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between poly1305.c and the instruction set specific Poly1305
+ * implementations.
+ */
+
+#ifndef POLY1305_INTERNAL_H
+#define POLY1305_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "poly1305.h"
+
+/* Radix 2^44 needs the full 128-bit products of 64-bit limbs. */
+#if defined(__SIZEOF_INT128__)
+#define POLY1305_RADIX44 1
+#endif
+
+/*
+ * Fewest blocks worth handing to a vector backend, which computes powers of
+ * r on every call.
+ */
+#define POLY1305_VECTOR_MIN_BLOCKS 16
+
+struct poly1305_backend
+{
+  const char *name;
+  size_t width;
+  /*
+   * Absorbs count whole message blocks, a multiple of width, into the
+   * accumulator of ctx.
+   */
+  void (*blocks) (struct poly1305_ctx *, const uint8_t *, size_t);
+};
+
+#if defined(HAVE_AVX2_INTRINSICS) && defined(POLY1305_RADIX44)
+/* Four blocks at a time in poly1305-avx2.c. */
+extern const struct poly1305_backend poly1305_backend_avx2;
+#endif
+
+#endif /* POLY1305_INTERNAL_H */
@@ -0,0 +1,421 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Poly1305 in the style of poly1305-donna by Andrew Moon. With 128-bit
+ * integers the accumulator is kept in three limbs of radix 2^44 and each
+ * block takes nine 64-bit multiplications. Otherwise five limbs of radix
+ * 2^26 and 32-bit multiplications are used.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_wipe.h"
+#include "poly1305-internal.h"
+#include "poly1305.h"
+
+static const struct poly1305_backend *poly1305_backend = NULL;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+poly1305_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+#if defined(HAVE_AVX2_INTRINSICS) && defined(POLY1305_RADIX44)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    poly1305_backend = &poly1305_backend_avx2;
+#endif
+}
+#endif /* __GNUC__ */
+
+#if defined(POLY1305_RADIX44)
+
+#define POLY1305_MASK42 UINT64_C (0x3ffffffffff)
+#define POLY1305_MASK44 UINT64_C (0xfffffffffff)
+
+__extension__ typedef unsigned __int128 poly1305_uint128;
+
+static void
+poly1305_set_r (struct poly1305_ctx *ctx, const uint8_t *key)
+{
+  const uint64_t t0 = buff_get_le64 (key);
+  const uint64_t t1 = buff_get_le64 (key + 8);
+
+  /* Clamp r as it is split into limbs. */
+  ctx->r[0] = t0 & UINT64_C (0xffc0fffffff);
+  ctx->r[1] = ((t0 >> 44) | (t1 << 20)) & UINT64_C (0xfffffc0ffff);
+  ctx->r[2] = (t1 >> 24) & UINT64_C (0x00ffffffc0f);
+}
+
+/*
+ * Computes h = (h + m) * r mod 2^130 - 5 for each block, where hibit is the
+ * bit set above the last byte of a full block.
+ */
+static void
+poly1305_blocks_generic (struct poly1305_ctx *ctx, const uint8_t *m,
+                         size_t count, uint64_t hibit)
+{
+  const uint64_t r0 = ctx->r[0], r1 = ctx->r[1], r2 = ctx->r[2];
+  const uint64_t s1 = r1 * (5 << 2), s2 = r2 * (5 << 2);
+  uint64_t h0 = ctx->h[0], h1 = ctx->h[1], h2 = ctx->h[2];
+  poly1305_uint128 d0, d1, d2;
+  uint64_t t0, t1, c;
+
+  hibit <<= 40;
+  for (; count > 0; --count, m += POLY1305_BLOCK_SIZE)
+    {
+      t0 = buff_get_le64 (m);
+      t1 = buff_get_le64 (m + 8);
+      h0 += t0 & POLY1305_MASK44;
+      h1 += ((t0 >> 44) | (t1 << 20)) & POLY1305_MASK44;
+      h2 += ((t1 >> 24) & POLY1305_MASK42) | hibit;
+
+      d0 = (poly1305_uint128)h0 * r0 + (poly1305_uint128)h1 * s2
+           + (poly1305_uint128)h2 * s1;
+      d1 = (poly1305_uint128)h0 * r1 + (poly1305_uint128)h1 * r0
+           + (poly1305_uint128)h2 * s2;
+      d2 = (poly1305_uint128)h0 * r2 + (poly1305_uint128)h1 * r1
+           + (poly1305_uint128)h2 * r0;
+
+      c = (uint64_t)(d0 >> 44);
+      h0 = (uint64_t)d0 & POLY1305_MASK44;
+      d1 += c;
+      c = (uint64_t)(d1 >> 44);
+      h1 = (uint64_t)d1 & POLY1305_MASK44;
+      d2 += c;
+      c = (uint64_t)(d2 >> 42);
+      h2 = (uint64_t)d2 & POLY1305_MASK42;
+      h0 += c * 5;
+      c = h0 >> 44;
+      h0 &= POLY1305_MASK44;
+      h1 += c;
+    }
+
+  ctx->h[0] = h0;
+  ctx->h[1] = h1;
+  ctx->h[2] = h2;
+}
+
+/* Fully reduces h, adds the pad and writes the tag. */
+static void
+poly1305_finish (struct poly1305_ctx *ctx, uint8_t *digest)
+{
+  uint64_t h0 = ctx->h[0], h1 = ctx->h[1], h2 = ctx->h[2];
+  uint64_t g0, g1, g2, c, mask, t0, t1;
+
+  c = h1 >> 44;
+  h1 &= POLY1305_MASK44;
+  h2 += c;
+  c = h2 >> 42;
+  h2 &= POLY1305_MASK42;
+  h0 += c * 5;
+  c = h0 >> 44;
+  h0 &= POLY1305_MASK44;
+  h1 += c;
+  c = h1 >> 44;
+  h1 &= POLY1305_MASK44;
+  h2 += c;
+  c = h2 >> 42;
+  h2 &= POLY1305_MASK42;
+  h0 += c * 5;
+  c = h0 >> 44;
+  h0 &= POLY1305_MASK44;
+  h1 += c;
+
+  /* Compute h - p and keep it if it did not borrow. */
+  g0 = h0 + 5;
+  c = g0 >> 44;
+  g0 &= POLY1305_MASK44;
+  g1 = h1 + c;
+  c = g1 >> 44;
+  g1 &= POLY1305_MASK44;
+  g2 = h2 + c - (UINT64_C (1) << 42);
+
+  mask = (g2 >> 63) - 1;
+  h0 = (h0 & ~mask) | (g0 & mask);
+  h1 = (h1 & ~mask) | (g1 & mask);
+  h2 = (h2 & ~mask) | (g2 & mask);
+
+  t0 = (uint64_t)ctx->pad[0] | ((uint64_t)ctx->pad[1] << 32);
+  t1 = (uint64_t)ctx->pad[2] | ((uint64_t)ctx->pad[3] << 32);
+  h0 += t0 & POLY1305_MASK44;
+  c = h0 >> 44;
+  h0 &= POLY1305_MASK44;
+  h1 += (((t0 >> 44) | (t1 << 20)) & POLY1305_MASK44) + c;
+  c = h1 >> 44;
+  h1 &= POLY1305_MASK44;
+  h2 += ((t1 >> 24) & POLY1305_MASK42) + c;
+
+  buff_put_le64 (digest, h0 | (h1 << 44));
+  buff_put_le64 (digest + 8, (h1 >> 20) | (h2 << 24));
+}
+
+#else /* !POLY1305_RADIX44 */
+
+#define POLY1305_MASK26 UINT32_C (0x3ffffff)
+
+static void
+poly1305_set_r (struct poly1305_ctx *ctx, const uint8_t *key)
+{
+  /* Clamp r as it is split into limbs. */
+  ctx->r[0] = buff_get_le32 (key) & UINT32_C (0x3ffffff);
+  ctx->r[1] = (buff_get_le32 (key + 3) >> 2) & UINT32_C (0x3ffff03);
+  ctx->r[2] = (buff_get_le32 (key + 6) >> 4) & UINT32_C (0x3ffc0ff);
+  ctx->r[3] = (buff_get_le32 (key + 9) >> 6) & UINT32_C (0x3f03fff);
+  ctx->r[4] = (buff_get_le32 (key + 12) >> 8) & UINT32_C (0x00fffff);
+}
+
+/*
+ * Computes h = (h + m) * r mod 2^130 - 5 for each block, where hibit is the
+ * bit set above the last byte of a full block.
+ */
+static void
+poly1305_blocks_generic (struct poly1305_ctx *ctx, const uint8_t *m,
+                         size_t count, uint64_t hibit)
+{
+  const uint32_t r0 = (uint32_t)ctx->r[0], r1 = (uint32_t)ctx->r[1];
+  const uint32_t r2 = (uint32_t)ctx->r[2], r3 = (uint32_t)ctx->r[3];
+  const uint32_t r4 = (uint32_t)ctx->r[4];
+  const uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+  uint32_t h0 = (uint32_t)ctx->h[0], h1 = (uint32_t)ctx->h[1];
+  uint32_t h2 = (uint32_t)ctx->h[2], h3 = (uint32_t)ctx->h[3];
+  uint32_t h4 = (uint32_t)ctx->h[4];
+  uint64_t d0, d1, d2, d3, d4;
+  uint32_t c;
+
+  hibit <<= 24;
+  for (; count > 0; --count, m += POLY1305_BLOCK_SIZE)
+    {
+      h0 += buff_get_le32 (m) & POLY1305_MASK26;
+      h1 += (buff_get_le32 (m + 3) >> 2) & POLY1305_MASK26;
+      h2 += (buff_get_le32 (m + 6) >> 4) & POLY1305_MASK26;
+      h3 += (buff_get_le32 (m + 9) >> 6) & POLY1305_MASK26;
+      h4 += (buff_get_le32 (m + 12) >> 8) | (uint32_t)hibit;
+
+      d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4 + (uint64_t)h2 * s3
+           + (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+      d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0 + (uint64_t)h2 * s4
+           + (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+      d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1 + (uint64_t)h2 * r0
+           + (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+      d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2 + (uint64_t)h2 * r1
+           + (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+      d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3 + (uint64_t)h2 * r2
+           + (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+      c = (uint32_t)(d0 >> 26);
+      h0 = (uint32_t)d0 & POLY1305_MASK26;
+      d1 += c;
+      c = (uint32_t)(d1 >> 26);
+      h1 = (uint32_t)d1 & POLY1305_MASK26;
+      d2 += c;
+      c = (uint32_t)(d2 >> 26);
+      h2 = (uint32_t)d2 & POLY1305_MASK26;
+      d3 += c;
+      c = (uint32_t)(d3 >> 26);
+      h3 = (uint32_t)d3 & POLY1305_MASK26;
+      d4 += c;
+      c = (uint32_t)(d4 >> 26);
+      h4 = (uint32_t)d4 & POLY1305_MASK26;
+      h0 += c * 5;
+      c = h0 >> 26;
+      h0 &= POLY1305_MASK26;
+      h1 += c;
+    }
+
+  ctx->h[0] = h0;
+  ctx->h[1] = h1;
+  ctx->h[2] = h2;
+  ctx->h[3] = h3;
+  ctx->h[4] = h4;
+}
+
+/* Fully reduces h, adds the pad and writes the tag. */
+static void
+poly1305_finish (struct poly1305_ctx *ctx, uint8_t *digest)
+{
+  uint32_t h0 = (uint32_t)ctx->h[0], h1 = (uint32_t)ctx->h[1];
+  uint32_t h2 = (uint32_t)ctx->h[2], h3 = (uint32_t)ctx->h[3];
+  uint32_t h4 = (uint32_t)ctx->h[4];
+  uint32_t g0, g1, g2, g3, g4, c, mask;
+  uint64_t f;
+
+  c = h1 >> 26;
+  h1 &= POLY1305_MASK26;
+  h2 += c;
+  c = h2 >> 26;
+  h2 &= POLY1305_MASK26;
+  h3 += c;
+  c = h3 >> 26;
+  h3 &= POLY1305_MASK26;
+  h4 += c;
+  c = h4 >> 26;
+  h4 &= POLY1305_MASK26;
+  h0 += c * 5;
+  c = h0 >> 26;
+  h0 &= POLY1305_MASK26;
+  h1 += c;
+
+  /* Compute h - p and keep it if it did not borrow. */
+  g0 = h0 + 5;
+  c = g0 >> 26;
+  g0 &= POLY1305_MASK26;
+  g1 = h1 + c;
+  c = g1 >> 26;
+  g1 &= POLY1305_MASK26;
+  g2 = h2 + c;
+  c = g2 >> 26;
+  g2 &= POLY1305_MASK26;
+  g3 = h3 + c;
+  c = g3 >> 26;
+  g3 &= POLY1305_MASK26;
+  g4 = h4 + c - (UINT32_C (1) << 26);
+
+  mask = (g4 >> 31) - 1;
+  h0 = (h0 & ~mask) | (g0 & mask);
+  h1 = (h1 & ~mask) | (g1 & mask);
+  h2 = (h2 & ~mask) | (g2 & mask);
+  h3 = (h3 & ~mask) | (g3 & mask);
+  h4 = (h4 & ~mask) | (g4 & mask);
+
+  /* Pack into 32-bit words and add the pad. */
+  h0 = h0 | (h1 << 26);
+  h1 = (h1 >> 6) | (h2 << 20);
+  h2 = (h2 >> 12) | (h3 << 14);
+  h3 = (h3 >> 18) | (h4 << 8);
+
+  f = (uint64_t)h0 + ctx->pad[0];
+  buff_put_le32 (digest, (uint32_t)f);
+  f = (uint64_t)h1 + ctx->pad[1] + (f >> 32);
+  buff_put_le32 (digest + 4, (uint32_t)f);
+  f = (uint64_t)h2 + ctx->pad[2] + (f >> 32);
+  buff_put_le32 (digest + 8, (uint32_t)f);
+  f = (uint64_t)h3 + ctx->pad[3] + (f >> 32);
+  buff_put_le32 (digest + 12, (uint32_t)f);
+}
+
+#endif /* POLY1305_RADIX44 */
+
+static void
+poly1305_blocks (struct poly1305_ctx *ctx, const uint8_t *m, size_t count)
+{
+  size_t n;
+
+  if (poly1305_backend != NULL && count >= POLY1305_VECTOR_MIN_BLOCKS)
+    {
+      n = count - count % poly1305_backend->width;
+      poly1305_backend->blocks (ctx, m, n);
+      m += n * POLY1305_BLOCK_SIZE;
+      count -= n;
+    }
+  poly1305_blocks_generic (ctx, m, count, 1);
+}
+
+void
+poly1305_init (struct poly1305_ctx *ctx, const uint8_t *key)
+{
+  memset (ctx, 0, sizeof (*ctx));
+  poly1305_set_r (ctx, key);
+  ctx->pad[0] = buff_get_le32 (key + 16);
+  ctx->pad[1] = buff_get_le32 (key + 20);
+  ctx->pad[2] = buff_get_le32 (key + 24);
+  ctx->pad[3] = buff_get_le32 (key + 28);
+}
+
+void
+poly1305_update (struct poly1305_ctx *ctx, const void *inputptr,
+                 size_t inputlen)
+{
+  const uint8_t *input = inputptr;
+  size_t n;
+
+  if (inputlen == 0)
+    return;
+
+  /* Fill the buffer first. */
+  if (ctx->bufferlen > 0)
+    {
+      n = POLY1305_BLOCK_SIZE - ctx->bufferlen;
+      if (n > inputlen)
+        n = inputlen;
+      memcpy (&ctx->buffer[ctx->bufferlen], input, n);
+      ctx->bufferlen += n;
+      input += n;
+      inputlen -= n;
+      if (ctx->bufferlen < POLY1305_BLOCK_SIZE)
+        return;
+      poly1305_blocks (ctx, ctx->buffer, 1);
+      ctx->bufferlen = 0;
+    }
+
+  /* Absorb all whole blocks directly from input. */
+  if (inputlen >= POLY1305_BLOCK_SIZE)
+    {
+      n = inputlen / POLY1305_BLOCK_SIZE;
+      poly1305_blocks (ctx, input, n);
+      input += n * POLY1305_BLOCK_SIZE;
+      inputlen -= n * POLY1305_BLOCK_SIZE;
+    }
+
+  /* Save the remaining bytes from input. */
+  memcpy (ctx->buffer, input, inputlen);
+  ctx->bufferlen = inputlen;
+}
+
+void
+poly1305_final (uint8_t *digest, struct poly1305_ctx *ctx)
+{
+  /* A partial block is padded with a one byte instead of the high bit. */
+  if (ctx->bufferlen > 0)
+    {
+      ctx->buffer[ctx->bufferlen] = 1;
+      memset (&ctx->buffer[ctx->bufferlen + 1], 0,
+              POLY1305_BLOCK_SIZE - ctx->bufferlen - 1);
+      poly1305_blocks_generic (ctx, ctx->buffer, 1, 0);
+    }
+
+  poly1305_finish (ctx, digest);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+poly1305 (uint8_t *digest, const uint8_t *input, const uint8_t *key,
+          const size_t inputlen)
+{
+  struct poly1305_ctx ctx;
+
+  poly1305_init (&ctx, key);
+  poly1305_update (&ctx, input, inputlen);
+  poly1305_final (digest, &ctx);
+}
@@ -41,7 +41,10 @@ struct rmd128_ctx
 
 void rmd128_init (struct rmd128_ctx *);
 void rmd128_transform (uint32_t *, const uint8_t *);
+void rmd128_transform_blocks (uint32_t *, const uint8_t *, size_t);
 void rmd128_update (struct rmd128_ctx *, const void *, size_t);
 void rmd128_final (uint8_t *, struct rmd128_ctx *);
+void rmd128_copy (struct rmd128_ctx *, const struct rmd128_ctx *);
+void rmd128 (uint8_t *, const void *, size_t);
 
 #endif /* RMD128_H */
@@ -23,14 +23,18 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "bswap.h"
 #include "circularshift.h"
-#include "fcrypt_memzero.h"
+#include "fcrypt_md.h"
+#include "fcrypt_wipe.h"
 #include "rmd160.h"
+#include "sha256.h"
 
 /* Functions used by RIPEMD-160. */
 #define F1(b, c, d) ((b) ^ (c) ^ (d))
@@ -71,267 +75,412 @@ rmd160_init (struct rmd160_ctx *ctx)
   ctx->count = 0;
 }
 
+#if defined(FCRYPT_SMALL)
+/* Message word and rotation of each step of the left and right lines. */
+static const uint8_t rmd160_r[80] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+  3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+  1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+  4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+
+static const uint8_t rmd160_rp[80] = {
+  5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+  6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+  15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+  8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+  12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+
+static const uint8_t rmd160_s[80] = {
+  11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+  7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+  11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+  11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+  9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+
+static const uint8_t rmd160_sp[80] = {
+  8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+  9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+  9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+  15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+  8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+
+static const uint32_t rmd160_k[5] = { 0, K2, K3, K4, K5 };
+static const uint32_t rmd160_kp[5] = { KP1, KP2, KP3, KP4, 0 };
+
+/* The boolean function of round r, the right line uses them in reverse. */
+static inline uint32_t
+rmd160_f (unsigned int r, uint32_t b, uint32_t c, uint32_t d)
+{
+  switch (r)
+    {
+    case 0:
+      return F1 (b, c, d);
+    case 1:
+      return F2 (b, c, d);
+    case 2:
+      return F3 (b, c, d);
+    case 3:
+      return F4 (b, c, d);
+    default:
+      return F5 (b, c, d);
+    }
+}
+
+/* One loop over the 80 steps for builds that favor code size. */
 void
-rmd160_transform (uint32_t *state, const uint8_t *block)
+rmd160_transform_blocks (uint32_t *state, const uint8_t *blocks,
+                         size_t nblocks)
 {
-  uint32_t a, b, c, d, e, i;
+  uint32_t h0, h1, h2, h3, h4;
+  uint32_t a, b, c, d, e, i, t;
   uint32_t aa, bb, cc, dd, ee;
   uint32_t w[16];
 
-  for (i = 0; i < 16; ++i)
-    w[i] = buff_get_le32 (block + i * 4);
-
-  a = aa = state[0];
-  b = bb = state[1];
-  c = cc = state[2];
-  d = dd = state[3];
-  e = ee = state[4];
-
-  RMD160_STEP (F1, a, b, c, d, e, w[0], 11);
-  RMD160_STEP (F1, e, a, b, c, d, w[1], 14);
-  RMD160_STEP (F1, d, e, a, b, c, w[2], 15);
-  RMD160_STEP (F1, c, d, e, a, b, w[3], 12);
-  RMD160_STEP (F1, b, c, d, e, a, w[4], 5);
-  RMD160_STEP (F1, a, b, c, d, e, w[5], 8);
-  RMD160_STEP (F1, e, a, b, c, d, w[6], 7);
-  RMD160_STEP (F1, d, e, a, b, c, w[7], 9);
-  RMD160_STEP (F1, c, d, e, a, b, w[8], 11);
-  RMD160_STEP (F1, b, c, d, e, a, w[9], 13);
-  RMD160_STEP (F1, a, b, c, d, e, w[10], 14);
-  RMD160_STEP (F1, e, a, b, c, d, w[11], 15);
-  RMD160_STEP (F1, d, e, a, b, c, w[12], 6);
-  RMD160_STEP (F1, c, d, e, a, b, w[13], 7);
-  RMD160_STEP (F1, b, c, d, e, a, w[14], 9);
-  RMD160_STEP (F1, a, b, c, d, e, w[15], 8);
-
-  RMD160_STEP (F2, e, a, b, c, d, w[7] + K2, 7);
-  RMD160_STEP (F2, d, e, a, b, c, w[4] + K2, 6);
-  RMD160_STEP (F2, c, d, e, a, b, w[13] + K2, 8);
-  RMD160_STEP (F2, b, c, d, e, a, w[1] + K2, 13);
-  RMD160_STEP (F2, a, b, c, d, e, w[10] + K2, 11);
-  RMD160_STEP (F2, e, a, b, c, d, w[6] + K2, 9);
-  RMD160_STEP (F2, d, e, a, b, c, w[15] + K2, 7);
-  RMD160_STEP (F2, c, d, e, a, b, w[3] + K2, 15);
-  RMD160_STEP (F2, b, c, d, e, a, w[12] + K2, 7);
-  RMD160_STEP (F2, a, b, c, d, e, w[0] + K2, 12);
-  RMD160_STEP (F2, e, a, b, c, d, w[9] + K2, 15);
-  RMD160_STEP (F2, d, e, a, b, c, w[5] + K2, 9);
-  RMD160_STEP (F2, c, d, e, a, b, w[2] + K2, 11);
-  RMD160_STEP (F2, b, c, d, e, a, w[14] + K2, 7);
-  RMD160_STEP (F2, a, b, c, d, e, w[11] + K2, 13);
-  RMD160_STEP (F2, e, a, b, c, d, w[8] + K2, 12);
-
-  RMD160_STEP (F3, d, e, a, b, c, w[3] + K3, 11);
-  RMD160_STEP (F3, c, d, e, a, b, w[10] + K3, 13);
-  RMD160_STEP (F3, b, c, d, e, a, w[14] + K3, 6);
-  RMD160_STEP (F3, a, b, c, d, e, w[4] + K3, 7);
-  RMD160_STEP (F3, e, a, b, c, d, w[9] + K3, 14);
-  RMD160_STEP (F3, d, e, a, b, c, w[15] + K3, 9);
-  RMD160_STEP (F3, c, d, e, a, b, w[8] + K3, 13);
-  RMD160_STEP (F3, b, c, d, e, a, w[1] + K3, 15);
-  RMD160_STEP (F3, a, b, c, d, e, w[2] + K3, 14);
-  RMD160_STEP (F3, e, a, b, c, d, w[7] + K3, 8);
-  RMD160_STEP (F3, d, e, a, b, c, w[0] + K3, 13);
-  RMD160_STEP (F3, c, d, e, a, b, w[6] + K3, 6);
-  RMD160_STEP (F3, b, c, d, e, a, w[13] + K3, 5);
-  RMD160_STEP (F3, a, b, c, d, e, w[11] + K3, 12);
-  RMD160_STEP (F3, e, a, b, c, d, w[5] + K3, 7);
-  RMD160_STEP (F3, d, e, a, b, c, w[12] + K3, 5);
-
-  RMD160_STEP (F4, c, d, e, a, b, w[1] + K4, 11);
-  RMD160_STEP (F4, b, c, d, e, a, w[9] + K4, 12);
-  RMD160_STEP (F4, a, b, c, d, e, w[11] + K4, 14);
-  RMD160_STEP (F4, e, a, b, c, d, w[10] + K4, 15);
-  RMD160_STEP (F4, d, e, a, b, c, w[0] + K4, 14);
-  RMD160_STEP (F4, c, d, e, a, b, w[8] + K4, 15);
-  RMD160_STEP (F4, b, c, d, e, a, w[12] + K4, 9);
-  RMD160_STEP (F4, a, b, c, d, e, w[4] + K4, 8);
-  RMD160_STEP (F4, e, a, b, c, d, w[13] + K4, 9);
-  RMD160_STEP (F4, d, e, a, b, c, w[3] + K4, 14);
-  RMD160_STEP (F4, c, d, e, a, b, w[7] + K4, 5);
-  RMD160_STEP (F4, b, c, d, e, a, w[15] + K4, 6);
-  RMD160_STEP (F4, a, b, c, d, e, w[14] + K4, 8);
-  RMD160_STEP (F4, e, a, b, c, d, w[5] + K4, 6);
-  RMD160_STEP (F4, d, e, a, b, c, w[6] + K4, 5);
-  RMD160_STEP (F4, c, d, e, a, b, w[2] + K4, 12);
-
-  RMD160_STEP (F5, b, c, d, e, a, w[4] + K5, 9);
-  RMD160_STEP (F5, a, b, c, d, e, w[0] + K5, 15);
-  RMD160_STEP (F5, e, a, b, c, d, w[5] + K5, 5);
-  RMD160_STEP (F5, d, e, a, b, c, w[9] + K5, 11);
-  RMD160_STEP (F5, c, d, e, a, b, w[7] + K5, 6);
-  RMD160_STEP (F5, b, c, d, e, a, w[12] + K5, 8);
-  RMD160_STEP (F5, a, b, c, d, e, w[2] + K5, 13);
-  RMD160_STEP (F5, e, a, b, c, d, w[10] + K5, 12);
-  RMD160_STEP (F5, d, e, a, b, c, w[14] + K5, 5);
-  RMD160_STEP (F5, c, d, e, a, b, w[1] + K5, 12);
-  RMD160_STEP (F5, b, c, d, e, a, w[3] + K5, 13);
-  RMD160_STEP (F5, a, b, c, d, e, w[8] + K5, 14);
-  RMD160_STEP (F5, e, a, b, c, d, w[11] + K5, 11);
-  RMD160_STEP (F5, d, e, a, b, c, w[6] + K5, 8);
-  RMD160_STEP (F5, c, d, e, a, b, w[15] + K5, 5);
-  RMD160_STEP (F5, b, c, d, e, a, w[13] + K5, 6);
-
-  RMD160_STEP (F5, aa, bb, cc, dd, ee, w[5] + KP1, 8);
-  RMD160_STEP (F5, ee, aa, bb, cc, dd, w[14] + KP1, 9);
-  RMD160_STEP (F5, dd, ee, aa, bb, cc, w[7] + KP1, 9);
-  RMD160_STEP (F5, cc, dd, ee, aa, bb, w[0] + KP1, 11);
-  RMD160_STEP (F5, bb, cc, dd, ee, aa, w[9] + KP1, 13);
-  RMD160_STEP (F5, aa, bb, cc, dd, ee, w[2] + KP1, 15);
-  RMD160_STEP (F5, ee, aa, bb, cc, dd, w[11] + KP1, 15);
-  RMD160_STEP (F5, dd, ee, aa, bb, cc, w[4] + KP1, 5);
-  RMD160_STEP (F5, cc, dd, ee, aa, bb, w[13] + KP1, 7);
-  RMD160_STEP (F5, bb, cc, dd, ee, aa, w[6] + KP1, 7);
-  RMD160_STEP (F5, aa, bb, cc, dd, ee, w[15] + KP1, 8);
-  RMD160_STEP (F5, ee, aa, bb, cc, dd, w[8] + KP1, 11);
-  RMD160_STEP (F5, dd, ee, aa, bb, cc, w[1] + KP1, 14);
-  RMD160_STEP (F5, cc, dd, ee, aa, bb, w[10] + KP1, 14);
-  RMD160_STEP (F5, bb, cc, dd, ee, aa, w[3] + KP1, 12);
-  RMD160_STEP (F5, aa, bb, cc, dd, ee, w[12] + KP1, 6);
-
-  RMD160_STEP (F4, ee, aa, bb, cc, dd, w[6] + KP2, 9);
-  RMD160_STEP (F4, dd, ee, aa, bb, cc, w[11] + KP2, 13);
-  RMD160_STEP (F4, cc, dd, ee, aa, bb, w[3] + KP2, 15);
-  RMD160_STEP (F4, bb, cc, dd, ee, aa, w[7] + KP2, 7);
-  RMD160_STEP (F4, aa, bb, cc, dd, ee, w[0] + KP2, 12);
-  RMD160_STEP (F4, ee, aa, bb, cc, dd, w[13] + KP2, 8);
-  RMD160_STEP (F4, dd, ee, aa, bb, cc, w[5] + KP2, 9);
-  RMD160_STEP (F4, cc, dd, ee, aa, bb, w[10] + KP2, 11);
-  RMD160_STEP (F4, bb, cc, dd, ee, aa, w[14] + KP2, 7);
-  RMD160_STEP (F4, aa, bb, cc, dd, ee, w[15] + KP2, 7);
-  RMD160_STEP (F4, ee, aa, bb, cc, dd, w[8] + KP2, 12);
-  RMD160_STEP (F4, dd, ee, aa, bb, cc, w[12] + KP2, 7);
-  RMD160_STEP (F4, cc, dd, ee, aa, bb, w[4] + KP2, 6);
-  RMD160_STEP (F4, bb, cc, dd, ee, aa, w[9] + KP2, 15);
-  RMD160_STEP (F4, aa, bb, cc, dd, ee, w[1] + KP2, 13);
-  RMD160_STEP (F4, ee, aa, bb, cc, dd, w[2] + KP2, 11);
-
-  RMD160_STEP (F3, dd, ee, aa, bb, cc, w[15] + KP3, 9);
-  RMD160_STEP (F3, cc, dd, ee, aa, bb, w[5] + KP3, 7);
-  RMD160_STEP (F3, bb, cc, dd, ee, aa, w[1] + KP3, 15);
-  RMD160_STEP (F3, aa, bb, cc, dd, ee, w[3] + KP3, 11);
-  RMD160_STEP (F3, ee, aa, bb, cc, dd, w[7] + KP3, 8);
-  RMD160_STEP (F3, dd, ee, aa, bb, cc, w[14] + KP3, 6);
-  RMD160_STEP (F3, cc, dd, ee, aa, bb, w[6] + KP3, 6);
-  RMD160_STEP (F3, bb, cc, dd, ee, aa, w[9] + KP3, 14);
-  RMD160_STEP (F3, aa, bb, cc, dd, ee, w[11] + KP3, 12);
-  RMD160_STEP (F3, ee, aa, bb, cc, dd, w[8] + KP3, 13);
-  RMD160_STEP (F3, dd, ee, aa, bb, cc, w[12] + KP3, 5);
-  RMD160_STEP (F3, cc, dd, ee, aa, bb, w[2] + KP3, 14);
-  RMD160_STEP (F3, bb, cc, dd, ee, aa, w[10] + KP3, 13);
-  RMD160_STEP (F3, aa, bb, cc, dd, ee, w[0] + KP3, 13);
-  RMD160_STEP (F3, ee, aa, bb, cc, dd, w[4] + KP3, 7);
-  RMD160_STEP (F3, dd, ee, aa, bb, cc, w[13] + KP3, 5);
-
-  RMD160_STEP (F2, cc, dd, ee, aa, bb, w[8] + KP4, 15);
-  RMD160_STEP (F2, bb, cc, dd, ee, aa, w[6] + KP4, 5);
-  RMD160_STEP (F2, aa, bb, cc, dd, ee, w[4] + KP4, 8);
-  RMD160_STEP (F2, ee, aa, bb, cc, dd, w[1] + KP4, 11);
-  RMD160_STEP (F2, dd, ee, aa, bb, cc, w[3] + KP4, 14);
-  RMD160_STEP (F2, cc, dd, ee, aa, bb, w[11] + KP4, 14);
-  RMD160_STEP (F2, bb, cc, dd, ee, aa, w[15] + KP4, 6);
-  RMD160_STEP (F2, aa, bb, cc, dd, ee, w[0] + KP4, 14);
-  RMD160_STEP (F2, ee, aa, bb, cc, dd, w[5] + KP4, 6);
-  RMD160_STEP (F2, dd, ee, aa, bb, cc, w[12] + KP4, 9);
-  RMD160_STEP (F2, cc, dd, ee, aa, bb, w[2] + KP4, 12);
-  RMD160_STEP (F2, bb, cc, dd, ee, aa, w[13] + KP4, 9);
-  RMD160_STEP (F2, aa, bb, cc, dd, ee, w[9] + KP4, 12);
-  RMD160_STEP (F2, ee, aa, bb, cc, dd, w[7] + KP4, 5);
-  RMD160_STEP (F2, dd, ee, aa, bb, cc, w[10] + KP4, 15);
-  RMD160_STEP (F2, cc, dd, ee, aa, bb, w[14] + KP4, 8);
-
-  RMD160_STEP (F1, bb, cc, dd, ee, aa, w[12], 8);
-  RMD160_STEP (F1, aa, bb, cc, dd, ee, w[15], 5);
-  RMD160_STEP (F1, ee, aa, bb, cc, dd, w[10], 12);
-  RMD160_STEP (F1, dd, ee, aa, bb, cc, w[4], 9);
-  RMD160_STEP (F1, cc, dd, ee, aa, bb, w[1], 12);
-  RMD160_STEP (F1, bb, cc, dd, ee, aa, w[5], 5);
-  RMD160_STEP (F1, aa, bb, cc, dd, ee, w[8], 14);
-  RMD160_STEP (F1, ee, aa, bb, cc, dd, w[7], 6);
-  RMD160_STEP (F1, dd, ee, aa, bb, cc, w[6], 8);
-  RMD160_STEP (F1, cc, dd, ee, aa, bb, w[2], 13);
-  RMD160_STEP (F1, bb, cc, dd, ee, aa, w[13], 6);
-  RMD160_STEP (F1, aa, bb, cc, dd, ee, w[14], 5);
-  RMD160_STEP (F1, ee, aa, bb, cc, dd, w[0], 15);
-  RMD160_STEP (F1, dd, ee, aa, bb, cc, w[3], 13);
-  RMD160_STEP (F1, cc, dd, ee, aa, bb, w[9], 11);
-  RMD160_STEP (F1, bb, cc, dd, ee, aa, w[11], 11);
-
-  dd += c + state[1];
-  state[1] = state[2] + d + ee;
-  state[2] = state[3] + e + aa;
-  state[3] = state[4] + a + bb;
-  state[4] = state[0] + b + cc;
-  state[0] = dd;
-}
+  h0 = state[0];
+  h1 = state[1];
+  h2 = state[2];
+  h3 = state[3];
+  h4 = state[4];
+  for (; nblocks > 0; --nblocks, blocks += RMD160_BLOCK_SIZE)
+    {
+      buff_get_le32_words (w, blocks, 16);
+
+      a = aa = h0;
+      b = bb = h1;
+      c = cc = h2;
+      d = dd = h3;
+      e = ee = h4;
+
+      for (i = 0; i < 80; ++i)
+        {
+          t = a + rmd160_f (i / 16, b, c, d) + w[rmd160_r[i]]
+              + rmd160_k[i / 16];
+          t = rotl32 (t, rmd160_s[i]) + e;
+          a = e;
+          e = d;
+          d = rotl32 (c, 10);
+          c = b;
+          b = t;
+          t = aa + rmd160_f (4 - i / 16, bb, cc, dd) + w[rmd160_rp[i]]
+              + rmd160_kp[i / 16];
+          t = rotl32 (t, rmd160_sp[i]) + ee;
+          aa = ee;
+          ee = dd;
+          dd = rotl32 (cc, 10);
+          cc = bb;
+          bb = t;
+        }
+
+      dd += c + h1;
+      h1 = h2 + d + ee;
+      h2 = h3 + e + aa;
+      h3 = h4 + a + bb;
+      h4 = h0 + b + cc;
+      h0 = dd;
+    }
 
+  state[0] = h0;
+  state[1] = h1;
+  state[2] = h2;
+  state[3] = h3;
+  state[4] = h4;
+}
+#else
 void
-rmd160_update (struct rmd160_ctx *ctx, const void *inputptr, size_t inputlen)
+rmd160_transform_blocks (uint32_t *state, const uint8_t *blocks,
+                         size_t nblocks)
 {
-  size_t filled, need;
-  const uint8_t *input = inputptr;
-
-  if (inputlen == 0)
-    return;
-
-  filled = (size_t)((ctx->count >> 3) & (RMD160_BLOCK_SIZE - 1));
-  need = RMD160_BLOCK_SIZE - filled;
-  ctx->count += (uint64_t)(inputlen << 3);
+  uint32_t h0, h1, h2, h3, h4;
+  uint32_t a, b, c, d, e;
+  uint32_t aa, bb, cc, dd, ee;
+  uint32_t w[16];
 
-  /* Input too short to fill a complete block. */
-  if (inputlen < need)
+  h0 = state[0];
+  h1 = state[1];
+  h2 = state[2];
+  h3 = state[3];
+  h4 = state[4];
+  for (; nblocks > 0; --nblocks, blocks += RMD160_BLOCK_SIZE)
     {
-      memcpy (&ctx->buffer[filled], input, inputlen);
-      return;
+      buff_get_le32_words (w, blocks, 16);
+
+      a = aa = h0;
+      b = bb = h1;
+      c = cc = h2;
+      d = dd = h3;
+      e = ee = h4;
+
+      RMD160_STEP (F1, a, b, c, d, e, w[0], 11);
+      RMD160_STEP (F1, e, a, b, c, d, w[1], 14);
+      RMD160_STEP (F1, d, e, a, b, c, w[2], 15);
+      RMD160_STEP (F1, c, d, e, a, b, w[3], 12);
+      RMD160_STEP (F1, b, c, d, e, a, w[4], 5);
+      RMD160_STEP (F1, a, b, c, d, e, w[5], 8);
+      RMD160_STEP (F1, e, a, b, c, d, w[6], 7);
+      RMD160_STEP (F1, d, e, a, b, c, w[7], 9);
+      RMD160_STEP (F1, c, d, e, a, b, w[8], 11);
+      RMD160_STEP (F1, b, c, d, e, a, w[9], 13);
+      RMD160_STEP (F1, a, b, c, d, e, w[10], 14);
+      RMD160_STEP (F1, e, a, b, c, d, w[11], 15);
+      RMD160_STEP (F1, d, e, a, b, c, w[12], 6);
+      RMD160_STEP (F1, c, d, e, a, b, w[13], 7);
+      RMD160_STEP (F1, b, c, d, e, a, w[14], 9);
+      RMD160_STEP (F1, a, b, c, d, e, w[15], 8);
+
+      RMD160_STEP (F2, e, a, b, c, d, w[7] + K2, 7);
+      RMD160_STEP (F2, d, e, a, b, c, w[4] + K2, 6);
+      RMD160_STEP (F2, c, d, e, a, b, w[13] + K2, 8);
+      RMD160_STEP (F2, b, c, d, e, a, w[1] + K2, 13);
+      RMD160_STEP (F2, a, b, c, d, e, w[10] + K2, 11);
+      RMD160_STEP (F2, e, a, b, c, d, w[6] + K2, 9);
+      RMD160_STEP (F2, d, e, a, b, c, w[15] + K2, 7);
+      RMD160_STEP (F2, c, d, e, a, b, w[3] + K2, 15);
+      RMD160_STEP (F2, b, c, d, e, a, w[12] + K2, 7);
+      RMD160_STEP (F2, a, b, c, d, e, w[0] + K2, 12);
+      RMD160_STEP (F2, e, a, b, c, d, w[9] + K2, 15);
+      RMD160_STEP (F2, d, e, a, b, c, w[5] + K2, 9);
+      RMD160_STEP (F2, c, d, e, a, b, w[2] + K2, 11);
+      RMD160_STEP (F2, b, c, d, e, a, w[14] + K2, 7);
+      RMD160_STEP (F2, a, b, c, d, e, w[11] + K2, 13);
+      RMD160_STEP (F2, e, a, b, c, d, w[8] + K2, 12);
+
+      RMD160_STEP (F3, d, e, a, b, c, w[3] + K3, 11);
+      RMD160_STEP (F3, c, d, e, a, b, w[10] + K3, 13);
+      RMD160_STEP (F3, b, c, d, e, a, w[14] + K3, 6);
+      RMD160_STEP (F3, a, b, c, d, e, w[4] + K3, 7);
+      RMD160_STEP (F3, e, a, b, c, d, w[9] + K3, 14);
+      RMD160_STEP (F3, d, e, a, b, c, w[15] + K3, 9);
+      RMD160_STEP (F3, c, d, e, a, b, w[8] + K3, 13);
+      RMD160_STEP (F3, b, c, d, e, a, w[1] + K3, 15);
+      RMD160_STEP (F3, a, b, c, d, e, w[2] + K3, 14);
+      RMD160_STEP (F3, e, a, b, c, d, w[7] + K3, 8);
+      RMD160_STEP (F3, d, e, a, b, c, w[0] + K3, 13);
+      RMD160_STEP (F3, c, d, e, a, b, w[6] + K3, 6);
+      RMD160_STEP (F3, b, c, d, e, a, w[13] + K3, 5);
+      RMD160_STEP (F3, a, b, c, d, e, w[11] + K3, 12);
+      RMD160_STEP (F3, e, a, b, c, d, w[5] + K3, 7);
+      RMD160_STEP (F3, d, e, a, b, c, w[12] + K3, 5);
+
+      RMD160_STEP (F4, c, d, e, a, b, w[1] + K4, 11);
+      RMD160_STEP (F4, b, c, d, e, a, w[9] + K4, 12);
+      RMD160_STEP (F4, a, b, c, d, e, w[11] + K4, 14);
+      RMD160_STEP (F4, e, a, b, c, d, w[10] + K4, 15);
+      RMD160_STEP (F4, d, e, a, b, c, w[0] + K4, 14);
+      RMD160_STEP (F4, c, d, e, a, b, w[8] + K4, 15);
+      RMD160_STEP (F4, b, c, d, e, a, w[12] + K4, 9);
+      RMD160_STEP (F4, a, b, c, d, e, w[4] + K4, 8);
+      RMD160_STEP (F4, e, a, b, c, d, w[13] + K4, 9);
+      RMD160_STEP (F4, d, e, a, b, c, w[3] + K4, 14);
+      RMD160_STEP (F4, c, d, e, a, b, w[7] + K4, 5);
+      RMD160_STEP (F4, b, c, d, e, a, w[15] + K4, 6);
+      RMD160_STEP (F4, a, b, c, d, e, w[14] + K4, 8);
+      RMD160_STEP (F4, e, a, b, c, d, w[5] + K4, 6);
+      RMD160_STEP (F4, d, e, a, b, c, w[6] + K4, 5);
+      RMD160_STEP (F4, c, d, e, a, b, w[2] + K4, 12);
+
+      RMD160_STEP (F5, b, c, d, e, a, w[4] + K5, 9);
+      RMD160_STEP (F5, a, b, c, d, e, w[0] + K5, 15);
+      RMD160_STEP (F5, e, a, b, c, d, w[5] + K5, 5);
+      RMD160_STEP (F5, d, e, a, b, c, w[9] + K5, 11);
+      RMD160_STEP (F5, c, d, e, a, b, w[7] + K5, 6);
+      RMD160_STEP (F5, b, c, d, e, a, w[12] + K5, 8);
+      RMD160_STEP (F5, a, b, c, d, e, w[2] + K5, 13);
+      RMD160_STEP (F5, e, a, b, c, d, w[10] + K5, 12);
+      RMD160_STEP (F5, d, e, a, b, c, w[14] + K5, 5);
+      RMD160_STEP (F5, c, d, e, a, b, w[1] + K5, 12);
+      RMD160_STEP (F5, b, c, d, e, a, w[3] + K5, 13);
+      RMD160_STEP (F5, a, b, c, d, e, w[8] + K5, 14);
+      RMD160_STEP (F5, e, a, b, c, d, w[11] + K5, 11);
+      RMD160_STEP (F5, d, e, a, b, c, w[6] + K5, 8);
+      RMD160_STEP (F5, c, d, e, a, b, w[15] + K5, 5);
+      RMD160_STEP (F5, b, c, d, e, a, w[13] + K5, 6);
+
+      RMD160_STEP (F5, aa, bb, cc, dd, ee, w[5] + KP1, 8);
+      RMD160_STEP (F5, ee, aa, bb, cc, dd, w[14] + KP1, 9);
+      RMD160_STEP (F5, dd, ee, aa, bb, cc, w[7] + KP1, 9);
+      RMD160_STEP (F5, cc, dd, ee, aa, bb, w[0] + KP1, 11);
+      RMD160_STEP (F5, bb, cc, dd, ee, aa, w[9] + KP1, 13);
+      RMD160_STEP (F5, aa, bb, cc, dd, ee, w[2] + KP1, 15);
+      RMD160_STEP (F5, ee, aa, bb, cc, dd, w[11] + KP1, 15);
+      RMD160_STEP (F5, dd, ee, aa, bb, cc, w[4] + KP1, 5);
+      RMD160_STEP (F5, cc, dd, ee, aa, bb, w[13] + KP1, 7);
+      RMD160_STEP (F5, bb, cc, dd, ee, aa, w[6] + KP1, 7);
+      RMD160_STEP (F5, aa, bb, cc, dd, ee, w[15] + KP1, 8);
+      RMD160_STEP (F5, ee, aa, bb, cc, dd, w[8] + KP1, 11);
+      RMD160_STEP (F5, dd, ee, aa, bb, cc, w[1] + KP1, 14);
+      RMD160_STEP (F5, cc, dd, ee, aa, bb, w[10] + KP1, 14);
+      RMD160_STEP (F5, bb, cc, dd, ee, aa, w[3] + KP1, 12);
+      RMD160_STEP (F5, aa, bb, cc, dd, ee, w[12] + KP1, 6);
+
+      RMD160_STEP (F4, ee, aa, bb, cc, dd, w[6] + KP2, 9);
+      RMD160_STEP (F4, dd, ee, aa, bb, cc, w[11] + KP2, 13);
+      RMD160_STEP (F4, cc, dd, ee, aa, bb, w[3] + KP2, 15);
+      RMD160_STEP (F4, bb, cc, dd, ee, aa, w[7] + KP2, 7);
+      RMD160_STEP (F4, aa, bb, cc, dd, ee, w[0] + KP2, 12);
+      RMD160_STEP (F4, ee, aa, bb, cc, dd, w[13] + KP2, 8);
+      RMD160_STEP (F4, dd, ee, aa, bb, cc, w[5] + KP2, 9);
+      RMD160_STEP (F4, cc, dd, ee, aa, bb, w[10] + KP2, 11);
+      RMD160_STEP (F4, bb, cc, dd, ee, aa, w[14] + KP2, 7);
+      RMD160_STEP (F4, aa, bb, cc, dd, ee, w[15] + KP2, 7);
+      RMD160_STEP (F4, ee, aa, bb, cc, dd, w[8] + KP2, 12);
+      RMD160_STEP (F4, dd, ee, aa, bb, cc, w[12] + KP2, 7);
+      RMD160_STEP (F4, cc, dd, ee, aa, bb, w[4] + KP2, 6);
+      RMD160_STEP (F4, bb, cc, dd, ee, aa, w[9] + KP2, 15);
+      RMD160_STEP (F4, aa, bb, cc, dd, ee, w[1] + KP2, 13);
+      RMD160_STEP (F4, ee, aa, bb, cc, dd, w[2] + KP2, 11);
+
+      RMD160_STEP (F3, dd, ee, aa, bb, cc, w[15] + KP3, 9);
+      RMD160_STEP (F3, cc, dd, ee, aa, bb, w[5] + KP3, 7);
+      RMD160_STEP (F3, bb, cc, dd, ee, aa, w[1] + KP3, 15);
+      RMD160_STEP (F3, aa, bb, cc, dd, ee, w[3] + KP3, 11);
+      RMD160_STEP (F3, ee, aa, bb, cc, dd, w[7] + KP3, 8);
+      RMD160_STEP (F3, dd, ee, aa, bb, cc, w[14] + KP3, 6);
+      RMD160_STEP (F3, cc, dd, ee, aa, bb, w[6] + KP3, 6);
+      RMD160_STEP (F3, bb, cc, dd, ee, aa, w[9] + KP3, 14);
+      RMD160_STEP (F3, aa, bb, cc, dd, ee, w[11] + KP3, 12);
+      RMD160_STEP (F3, ee, aa, bb, cc, dd, w[8] + KP3, 13);
+      RMD160_STEP (F3, dd, ee, aa, bb, cc, w[12] + KP3, 5);
+      RMD160_STEP (F3, cc, dd, ee, aa, bb, w[2] + KP3, 14);
+      RMD160_STEP (F3, bb, cc, dd, ee, aa, w[10] + KP3, 13);
+      RMD160_STEP (F3, aa, bb, cc, dd, ee, w[0] + KP3, 13);
+      RMD160_STEP (F3, ee, aa, bb, cc, dd, w[4] + KP3, 7);
+      RMD160_STEP (F3, dd, ee, aa, bb, cc, w[13] + KP3, 5);
+
+      RMD160_STEP (F2, cc, dd, ee, aa, bb, w[8] + KP4, 15);
+      RMD160_STEP (F2, bb, cc, dd, ee, aa, w[6] + KP4, 5);
+      RMD160_STEP (F2, aa, bb, cc, dd, ee, w[4] + KP4, 8);
+      RMD160_STEP (F2, ee, aa, bb, cc, dd, w[1] + KP4, 11);
+      RMD160_STEP (F2, dd, ee, aa, bb, cc, w[3] + KP4, 14);
+      RMD160_STEP (F2, cc, dd, ee, aa, bb, w[11] + KP4, 14);
+      RMD160_STEP (F2, bb, cc, dd, ee, aa, w[15] + KP4, 6);
+      RMD160_STEP (F2, aa, bb, cc, dd, ee, w[0] + KP4, 14);
+      RMD160_STEP (F2, ee, aa, bb, cc, dd, w[5] + KP4, 6);
+      RMD160_STEP (F2, dd, ee, aa, bb, cc, w[12] + KP4, 9);
+      RMD160_STEP (F2, cc, dd, ee, aa, bb, w[2] + KP4, 12);
+      RMD160_STEP (F2, bb, cc, dd, ee, aa, w[13] + KP4, 9);
+      RMD160_STEP (F2, aa, bb, cc, dd, ee, w[9] + KP4, 12);
+      RMD160_STEP (F2, ee, aa, bb, cc, dd, w[7] + KP4, 5);
+      RMD160_STEP (F2, dd, ee, aa, bb, cc, w[10] + KP4, 15);
+      RMD160_STEP (F2, cc, dd, ee, aa, bb, w[14] + KP4, 8);
+
+      RMD160_STEP (F1, bb, cc, dd, ee, aa, w[12], 8);
+      RMD160_STEP (F1, aa, bb, cc, dd, ee, w[15], 5);
+      RMD160_STEP (F1, ee, aa, bb, cc, dd, w[10], 12);
+      RMD160_STEP (F1, dd, ee, aa, bb, cc, w[4], 9);
+      RMD160_STEP (F1, cc, dd, ee, aa, bb, w[1], 12);
+      RMD160_STEP (F1, bb, cc, dd, ee, aa, w[5], 5);
+      RMD160_STEP (F1, aa, bb, cc, dd, ee, w[8], 14);
+      RMD160_STEP (F1, ee, aa, bb, cc, dd, w[7], 6);
+      RMD160_STEP (F1, dd, ee, aa, bb, cc, w[6], 8);
+      RMD160_STEP (F1, cc, dd, ee, aa, bb, w[2], 13);
+      RMD160_STEP (F1, bb, cc, dd, ee, aa, w[13], 6);
+      RMD160_STEP (F1, aa, bb, cc, dd, ee, w[14], 5);
+      RMD160_STEP (F1, ee, aa, bb, cc, dd, w[0], 15);
+      RMD160_STEP (F1, dd, ee, aa, bb, cc, w[3], 13);
+      RMD160_STEP (F1, cc, dd, ee, aa, bb, w[9], 11);
+      RMD160_STEP (F1, bb, cc, dd, ee, aa, w[11], 11);
+
+      dd += c + h1;
+      h1 = h2 + d + ee;
+      h2 = h3 + e + aa;
+      h3 = h4 + a + bb;
+      h4 = h0 + b + cc;
+      h0 = dd;
     }
 
-  /* Check if we need to finish the buffer in ctx. */
-  if (filled != 0)
-    {
-      memcpy (&ctx->buffer[filled], input, need);
-      rmd160_transform (ctx->state, ctx->buffer);
-      inputlen -= need;
-      input += need;
-    }
+  state[0] = h0;
+  state[1] = h1;
+  state[2] = h2;
+  state[3] = h3;
+  state[4] = h4;
+}
+#endif /* FCRYPT_SMALL */
 
-  /* Handle as many blocks as possible. */
-  while (inputlen >= RMD160_BLOCK_SIZE)
-    {
-      rmd160_transform (ctx->state, input);
-      inputlen -= RMD160_BLOCK_SIZE;
-      input += RMD160_BLOCK_SIZE;
-    }
+void
+rmd160_transform (uint32_t *state, const uint8_t *block)
+{
+  rmd160_transform_blocks (state, block, 1);
+}
+
+/* Compresses consecutive blocks, used for the update and final steps. */
+static void
+rmd160_compress (void *state, const uint8_t *blocks, size_t nblocks)
+{
+  rmd160_transform_blocks (state, blocks, nblocks);
+}
 
-  /* Save any remaining bytes. */
-  if (inputlen != 0)
-    memcpy (ctx->buffer, input, inputlen);
+void
+rmd160_update (struct rmd160_ctx *ctx, const void *input, size_t inputlen)
+{
+  fcrypt_md_update (ctx->state, &ctx->count, ctx->buffer, rmd160_compress, input,
+                    inputlen);
 }
 
 void
 rmd160_final (uint8_t *digest, struct rmd160_ctx *ctx)
 {
-  size_t padoffset;
   uint32_t i;
 
-  padoffset = (size_t)((ctx->count >> 3) & (RMD160_BLOCK_SIZE - 1));
-  ctx->buffer[padoffset++] = 0x80;
+  fcrypt_md_final (ctx->state, ctx->count, ctx->buffer, rmd160_compress, 0x80,
+                   0);
+  for (i = 0; i < 5; ++i)
+    buff_put_le32 (digest + i * 4, ctx->state[i]);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
 
-  /* Enough room for count. */
-  if (padoffset <= 56)
-    memset (&ctx->buffer[padoffset], 0, 56 - padoffset);
-  else
-    {
-      /* Not enough room for count. */
-      memset (&ctx->buffer[padoffset], 0, RMD160_BLOCK_SIZE - padoffset);
-      rmd160_transform (ctx->state, ctx->buffer);
-      memset (ctx->buffer, 0, 56);
-    }
+void
+rmd160_copy (struct rmd160_ctx *dst, const struct rmd160_ctx *src)
+{
+  *dst = *src;
+}
 
-  /* Append the count and handle the block. */
-  buff_put_le64 (ctx->buffer + 56, ctx->count);
-  rmd160_transform (ctx->state, ctx->buffer);
+/* Hashes a whole message without buffering it through a context. */
+void
+rmd160 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct rmd160_ctx ctx;
+  uint32_t i;
 
+  rmd160_init (&ctx);
+  fcrypt_md_oneshot (ctx.state, ctx.buffer, rmd160_compress, 0x80, 0, input,
+                     inputlen);
   for (i = 0; i < 5; ++i)
-    buff_put_le32 (digest + i * 4, ctx->state[i]);
-  fcrypt_memzero (ctx, sizeof (*ctx));
+    buff_put_le32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
+}
+
+/* Padding of a 32-byte message, ending with its length of 256 bits. */
+static const uint8_t rmd160_pad32[32] = {
+  0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0,    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+void
+rmd160_32 (uint8_t *digest, const uint8_t *input)
+{
+  struct rmd160_ctx ctx;
+  uint32_t i;
+
+  rmd160_init (&ctx);
+  memcpy (ctx.buffer, input, 32);
+  memcpy (ctx.buffer + 32, rmd160_pad32, sizeof (rmd160_pad32));
+  rmd160_transform_blocks (ctx.state, ctx.buffer, 1);
+  for (i = 0; i < 5; ++i)
+    buff_put_le32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
+}
+
+void
+hash160 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  uint8_t inner[SHA256_DIGEST_SIZE];
+
+  sha256 (inner, input, inputlen);
+  rmd160_32 (digest, inner);
+  fcrypt_wipe (inner, sizeof (inner));
 }
@@ -41,7 +41,18 @@ struct rmd160_ctx
 
 void rmd160_init (struct rmd160_ctx *);
 void rmd160_transform (uint32_t *, const uint8_t *);
+void rmd160_transform_blocks (uint32_t *, const uint8_t *, size_t);
 void rmd160_update (struct rmd160_ctx *, const void *, size_t);
 void rmd160_final (uint8_t *, struct rmd160_ctx *);
+void rmd160_copy (struct rmd160_ctx *, const struct rmd160_ctx *);
+void rmd160 (uint8_t *, const void *, size_t);
+
+/*
+ * RIPEMD-160 of exactly 32 bytes, one call of the compression function with
+ * a constant padding block, and HASH160, the RIPEMD-160 of the SHA-256 of a
+ * message, as used for Bitcoin addresses.
+ */
+void rmd160_32 (uint8_t *, const uint8_t *);
+void hash160 (uint8_t *, const void *, size_t);
 
 #endif /* RMD160_H */
@@ -0,0 +1,145 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SHA-1 using the ARMv8 cryptography extensions. SHA1C, SHA1P and SHA1M do
+ * four rounds with the choose, parity and majority functions, SHA1H rotates
+ * A into the next E, and SHA1SU0 and SHA1SU1 compute the message schedule
+ * four words at a time.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha1-internal.h"
+#include "sha1.h"
+
+#if defined(HAVE_ARM_SHA2_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define ARMV8_TARGET __attribute__ ((target (ARM_SHA2_TARGET_ATTRIBUTE)))
+
+/* Four rounds with the instruction op using the schedule words in m. */
+#define ARMV8_ROUNDS4(op, m, k)                                               \
+  do                                                                          \
+    {                                                                         \
+      x = vaddq_u32 ((m), (k));                                               \
+      e1 = vsha1h_u32 (vgetq_lane_u32 (abcd, 0));                             \
+      abcd = op (abcd, e0, x);                                                \
+      e0 = e1;                                                                \
+    }                                                                         \
+  while (0)
+
+/* Replaces the words in m0 with the ones needed 16 rounds later. */
+#define ARMV8_SCHEDULE(m0, m1, m2, m3)                                        \
+  ((m0) = vsha1su1q_u32 (vsha1su0q_u32 ((m0), (m1), (m2)), (m3)))
+
+ARMV8_TARGET static void
+sha1_compress_armv8 (uint32_t *state, const uint8_t *data, size_t blocks)
+{
+  const uint32x4_t k0 = vdupq_n_u32 (0x5a827999);
+  const uint32x4_t k1 = vdupq_n_u32 (0x6ed9eba1);
+  const uint32x4_t k2 = vdupq_n_u32 (0x8f1bbcdc);
+  const uint32x4_t k3 = vdupq_n_u32 (0xca62c1d6);
+  uint32x4_t abcd, save_abcd, x;
+  uint32x4_t m0, m1, m2, m3;
+  uint32_t e0, e1, save_e;
+
+  abcd = vld1q_u32 (state);
+  e0 = state[4];
+
+  for (; blocks > 0; --blocks)
+    {
+      save_abcd = abcd;
+      save_e = e0;
+
+      m0 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data)));
+      m1 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data + 16)));
+      m2 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data + 32)));
+      m3 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data + 48)));
+
+      ARMV8_ROUNDS4 (vsha1cq_u32, m0, k0);
+      ARMV8_SCHEDULE (m0, m1, m2, m3);
+      ARMV8_ROUNDS4 (vsha1cq_u32, m1, k0);
+      ARMV8_SCHEDULE (m1, m2, m3, m0);
+      ARMV8_ROUNDS4 (vsha1cq_u32, m2, k0);
+      ARMV8_SCHEDULE (m2, m3, m0, m1);
+      ARMV8_ROUNDS4 (vsha1cq_u32, m3, k0);
+      ARMV8_SCHEDULE (m3, m0, m1, m2);
+      ARMV8_ROUNDS4 (vsha1cq_u32, m0, k0);
+      ARMV8_SCHEDULE (m0, m1, m2, m3);
+
+      ARMV8_ROUNDS4 (vsha1pq_u32, m1, k1);
+      ARMV8_SCHEDULE (m1, m2, m3, m0);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m2, k1);
+      ARMV8_SCHEDULE (m2, m3, m0, m1);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m3, k1);
+      ARMV8_SCHEDULE (m3, m0, m1, m2);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m0, k1);
+      ARMV8_SCHEDULE (m0, m1, m2, m3);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m1, k1);
+      ARMV8_SCHEDULE (m1, m2, m3, m0);
+
+      ARMV8_ROUNDS4 (vsha1mq_u32, m2, k2);
+      ARMV8_SCHEDULE (m2, m3, m0, m1);
+      ARMV8_ROUNDS4 (vsha1mq_u32, m3, k2);
+      ARMV8_SCHEDULE (m3, m0, m1, m2);
+      ARMV8_ROUNDS4 (vsha1mq_u32, m0, k2);
+      ARMV8_SCHEDULE (m0, m1, m2, m3);
+      ARMV8_ROUNDS4 (vsha1mq_u32, m1, k2);
+      ARMV8_SCHEDULE (m1, m2, m3, m0);
+      ARMV8_ROUNDS4 (vsha1mq_u32, m2, k2);
+      ARMV8_SCHEDULE (m2, m3, m0, m1);
+
+      ARMV8_ROUNDS4 (vsha1pq_u32, m3, k3);
+      ARMV8_SCHEDULE (m3, m0, m1, m2);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m0, k3);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m1, k3);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m2, k3);
+      ARMV8_ROUNDS4 (vsha1pq_u32, m3, k3);
+
+      abcd = vaddq_u32 (abcd, save_abcd);
+      e0 += save_e;
+      data += SHA1_BLOCK_SIZE;
+    }
+
+  vst1q_u32 (state, abcd);
+  state[4] = e0;
+}
+
+const struct sha1_backend sha1_backend_armv8 = {
+  "armv8",
+  sha1_compress_armv8,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha1_armv8_unused;
+
+#endif /* HAVE_ARM_SHA2_INTRINSICS */
@@ -0,0 +1,199 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer SHA-1 with AVX2. Each 32-bit element of a vector belongs to a
+ * different message, so eight blocks from independent messages go through
+ * the rounds of FIPS 180-4 at the same time. The blocks are transposed into
+ * that form with an 8x8 transpose of 32-bit words on the way in.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha1-internal.h"
+#include "sha1.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_LANES 8
+
+#define AVX2_ROTL(x, n)                                                       \
+  _mm256_or_si256 (_mm256_slli_epi32 ((x), (n)),                              \
+                   _mm256_srli_epi32 ((x), 32 - (n)))
+#define AVX2_XOR3(a, b, c) _mm256_xor_si256 ((a), _mm256_xor_si256 ((b), (c)))
+
+/* Ch and Maj rewritten to need fewer instructions without ANDN. */
+#define AVX2_CH(b, c, d)                                                      \
+  _mm256_xor_si256 ((d), _mm256_and_si256 ((b), _mm256_xor_si256 ((c), (d))))
+#define AVX2_PARITY(b, c, d) AVX2_XOR3 ((b), (c), (d))
+#define AVX2_MAJ(b, c, d)                                                     \
+  _mm256_xor_si256 ((c), _mm256_and_si256 (_mm256_xor_si256 ((b), (c)),       \
+                                           _mm256_xor_si256 ((c), (d))))
+
+/* Extends the message schedule to word i, for i >= 16. */
+#define AVX2_SCHEDULE(i)                                                      \
+  (w[(i)&15] = AVX2_ROTL (                                                    \
+       _mm256_xor_si256 (AVX2_XOR3 (w[((i)-3) & 15], w[((i)-8) & 15],         \
+                                    w[((i)-14) & 15]),                        \
+                         w[(i)&15]),                                          \
+       1))
+
+#define AVX2_ROUND(f, a, b, c, d, e, i)                                       \
+  do                                                                          \
+    {                                                                         \
+      if ((i) >= 16)                                                          \
+        AVX2_SCHEDULE (i);                                                    \
+      (e) = _mm256_add_epi32 (                                                \
+          _mm256_add_epi32 ((e), AVX2_ROTL ((a), 5)),                         \
+          _mm256_add_epi32 (f ((b), (c), (d)),                                \
+                            _mm256_add_epi32 (k, w[(i)&15])));                \
+      (b) = AVX2_ROTL ((b), 30);                                              \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads words 0 to 7 or 8 to 15 of the eight blocks, at offset bytes into
+ * each, and stores the words of all lanes for index i in w[i].
+ */
+AVX2_TARGET static inline void
+avx2_load_transpose (__m256i *w, const uint8_t *const *blocks, size_t offset)
+{
+  const __m256i mask = _mm256_set_epi8 (
+      12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8,
+      9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  __m256i r[AVX2_LANES], t[AVX2_LANES], u[AVX2_LANES];
+  unsigned int l;
+
+  for (l = 0; l < AVX2_LANES; ++l)
+    r[l] = _mm256_shuffle_epi8 (
+        _mm256_loadu_si256 ((const __m256i *)(blocks[l] + offset)), mask);
+
+  for (l = 0; l < AVX2_LANES; l += 2)
+    {
+      t[l] = _mm256_unpacklo_epi32 (r[l], r[l + 1]);
+      t[l + 1] = _mm256_unpackhi_epi32 (r[l], r[l + 1]);
+    }
+  for (l = 0; l < AVX2_LANES; l += 4)
+    {
+      u[l] = _mm256_unpacklo_epi64 (t[l], t[l + 2]);
+      u[l + 1] = _mm256_unpackhi_epi64 (t[l], t[l + 2]);
+      u[l + 2] = _mm256_unpacklo_epi64 (t[l + 1], t[l + 3]);
+      u[l + 3] = _mm256_unpackhi_epi64 (t[l + 1], t[l + 3]);
+    }
+  for (l = 0; l < 4; ++l)
+    {
+      w[l] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x20);
+      w[l + 4] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x31);
+    }
+}
+
+AVX2_TARGET static void
+sha1_multi_compress_avx2 (uint32_t *state, const uint8_t *const *blocks)
+{
+  __m256i a, b, c, d, e, k;
+  __m256i w[16];
+  unsigned int i;
+
+  avx2_load_transpose (w, blocks, 0);
+  avx2_load_transpose (w + 8, blocks, 32);
+
+  a = _mm256_loadu_si256 ((const __m256i *)(state + 0 * AVX2_LANES));
+  b = _mm256_loadu_si256 ((const __m256i *)(state + 1 * AVX2_LANES));
+  c = _mm256_loadu_si256 ((const __m256i *)(state + 2 * AVX2_LANES));
+  d = _mm256_loadu_si256 ((const __m256i *)(state + 3 * AVX2_LANES));
+  e = _mm256_loadu_si256 ((const __m256i *)(state + 4 * AVX2_LANES));
+
+  k = _mm256_set1_epi32 (0x5a827999);
+  for (i = 0; i < 20; i += 5)
+    {
+      AVX2_ROUND (AVX2_CH, a, b, c, d, e, i);
+      AVX2_ROUND (AVX2_CH, e, a, b, c, d, i + 1);
+      AVX2_ROUND (AVX2_CH, d, e, a, b, c, i + 2);
+      AVX2_ROUND (AVX2_CH, c, d, e, a, b, i + 3);
+      AVX2_ROUND (AVX2_CH, b, c, d, e, a, i + 4);
+    }
+  k = _mm256_set1_epi32 (0x6ed9eba1);
+  for (i = 20; i < 40; i += 5)
+    {
+      AVX2_ROUND (AVX2_PARITY, a, b, c, d, e, i);
+      AVX2_ROUND (AVX2_PARITY, e, a, b, c, d, i + 1);
+      AVX2_ROUND (AVX2_PARITY, d, e, a, b, c, i + 2);
+      AVX2_ROUND (AVX2_PARITY, c, d, e, a, b, i + 3);
+      AVX2_ROUND (AVX2_PARITY, b, c, d, e, a, i + 4);
+    }
+  k = _mm256_set1_epi32 ((int)0x8f1bbcdc);
+  for (i = 40; i < 60; i += 5)
+    {
+      AVX2_ROUND (AVX2_MAJ, a, b, c, d, e, i);
+      AVX2_ROUND (AVX2_MAJ, e, a, b, c, d, i + 1);
+      AVX2_ROUND (AVX2_MAJ, d, e, a, b, c, i + 2);
+      AVX2_ROUND (AVX2_MAJ, c, d, e, a, b, i + 3);
+      AVX2_ROUND (AVX2_MAJ, b, c, d, e, a, i + 4);
+    }
+  k = _mm256_set1_epi32 ((int)0xca62c1d6);
+  for (i = 60; i < 80; i += 5)
+    {
+      AVX2_ROUND (AVX2_PARITY, a, b, c, d, e, i);
+      AVX2_ROUND (AVX2_PARITY, e, a, b, c, d, i + 1);
+      AVX2_ROUND (AVX2_PARITY, d, e, a, b, c, i + 2);
+      AVX2_ROUND (AVX2_PARITY, c, d, e, a, b, i + 3);
+      AVX2_ROUND (AVX2_PARITY, b, c, d, e, a, i + 4);
+    }
+
+#define AVX2_ADD_STATE(j, x)                                                  \
+  _mm256_storeu_si256 (                                                       \
+      (__m256i *)(state + (j) * AVX2_LANES),                                  \
+      _mm256_add_epi32 (                                                      \
+          (x), _mm256_loadu_si256 (                                           \
+                   (const __m256i *)(state + (j) * AVX2_LANES))))
+
+  AVX2_ADD_STATE (0, a);
+  AVX2_ADD_STATE (1, b);
+  AVX2_ADD_STATE (2, c);
+  AVX2_ADD_STATE (3, d);
+  AVX2_ADD_STATE (4, e);
+
+#undef AVX2_ADD_STATE
+}
+
+const struct sha1_multi_backend sha1_multi_backend_avx2 = {
+  "avx2",
+  AVX2_LANES,
+  sha1_multi_compress_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha1_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
@@ -0,0 +1,195 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer SHA-1 with AVX-512, sixteen messages at a time. This is the
+ * same as sha1-avx512.c but VPROLD replaces the shift and OR pairs and
+ * VPTERNLOGD computes Ch, Maj and the three input XORs in one instruction.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha1-internal.h"
+#include "sha1.h"
+
+#if defined(HAVE_AVX512_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX512_TARGET __attribute__ ((target (AVX512_TARGET_ATTRIBUTE)))
+
+#define AVX512_LANES 16
+
+#define AVX512_ROTL(x, n) _mm512_rol_epi32 ((x), (n))
+#define AVX512_XOR3(a, b, c) _mm512_ternarylogic_epi32 ((a), (b), (c), 0x96)
+#define AVX512_CH(b, c, d) _mm512_ternarylogic_epi32 ((b), (c), (d), 0xca)
+#define AVX512_PARITY(b, c, d) AVX512_XOR3 ((b), (c), (d))
+#define AVX512_MAJ(b, c, d) _mm512_ternarylogic_epi32 ((b), (c), (d), 0xe8)
+
+/* Extends the message schedule to word i, for i >= 16. */
+#define AVX512_SCHEDULE(i)                                                    \
+  (w[(i)&15] = AVX512_ROTL (                                                  \
+       _mm512_xor_si512 (AVX512_XOR3 (w[((i)-3) & 15], w[((i)-8) & 15],       \
+                                    w[((i)-14) & 15]),                        \
+                         w[(i)&15]),                                          \
+       1))
+
+#define AVX512_ROUND(f, a, b, c, d, e, i)                                     \
+  do                                                                          \
+    {                                                                         \
+      if ((i) >= 16)                                                          \
+        AVX512_SCHEDULE (i);                                                  \
+      (e) = _mm512_add_epi32 (                                                \
+          _mm512_add_epi32 ((e), AVX512_ROTL ((a), 5)),                       \
+          _mm512_add_epi32 (f ((b), (c), (d)),                                \
+                            _mm512_add_epi32 (k, w[(i)&15])));                \
+      (b) = AVX512_ROTL ((b), 30);                                            \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads words 0 to 7 or 8 to 15, at offset bytes into each block, of eight
+ * of the blocks and transposes them so that w[i] holds word i of each.
+ */
+AVX512_TARGET static inline void
+avx512_load_transpose8 (__m256i *w, const uint8_t *const *blocks,
+                        size_t offset)
+{
+  const __m256i mask = _mm256_set_epi8 (
+      12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8,
+      9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  __m256i r[8], t[8], u[8];
+  unsigned int l;
+
+  for (l = 0; l < 8; ++l)
+    r[l] = _mm256_shuffle_epi8 (
+        _mm256_loadu_si256 ((const __m256i *)(blocks[l] + offset)), mask);
+
+  for (l = 0; l < 8; l += 2)
+    {
+      t[l] = _mm256_unpacklo_epi32 (r[l], r[l + 1]);
+      t[l + 1] = _mm256_unpackhi_epi32 (r[l], r[l + 1]);
+    }
+  for (l = 0; l < 8; l += 4)
+    {
+      u[l] = _mm256_unpacklo_epi64 (t[l], t[l + 2]);
+      u[l + 1] = _mm256_unpackhi_epi64 (t[l], t[l + 2]);
+      u[l + 2] = _mm256_unpacklo_epi64 (t[l + 1], t[l + 3]);
+      u[l + 3] = _mm256_unpackhi_epi64 (t[l + 1], t[l + 3]);
+    }
+  for (l = 0; l < 4; ++l)
+    {
+      w[l] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x20);
+      w[l + 4] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x31);
+    }
+}
+
+AVX512_TARGET static void
+sha1_multi_compress_avx512 (uint32_t *state, const uint8_t *const *blocks)
+{
+  __m512i a, b, c, d, e, k;
+  __m512i w[16];
+  __m256i lo[16], hi[16];
+  unsigned int i;
+
+  avx512_load_transpose8 (lo, blocks, 0);
+  avx512_load_transpose8 (lo + 8, blocks, 32);
+  avx512_load_transpose8 (hi, blocks + 8, 0);
+  avx512_load_transpose8 (hi + 8, blocks + 8, 32);
+  for (i = 0; i < 16; ++i)
+    w[i] = _mm512_inserti64x4 (_mm512_castsi256_si512 (lo[i]), hi[i], 1);
+
+  a = _mm512_loadu_si512 (state + 0 * AVX512_LANES);
+  b = _mm512_loadu_si512 (state + 1 * AVX512_LANES);
+  c = _mm512_loadu_si512 (state + 2 * AVX512_LANES);
+  d = _mm512_loadu_si512 (state + 3 * AVX512_LANES);
+  e = _mm512_loadu_si512 (state + 4 * AVX512_LANES);
+
+  k = _mm512_set1_epi32 (0x5a827999);
+  for (i = 0; i < 20; i += 5)
+    {
+      AVX512_ROUND (AVX512_CH, a, b, c, d, e, i);
+      AVX512_ROUND (AVX512_CH, e, a, b, c, d, i + 1);
+      AVX512_ROUND (AVX512_CH, d, e, a, b, c, i + 2);
+      AVX512_ROUND (AVX512_CH, c, d, e, a, b, i + 3);
+      AVX512_ROUND (AVX512_CH, b, c, d, e, a, i + 4);
+    }
+  k = _mm512_set1_epi32 (0x6ed9eba1);
+  for (i = 20; i < 40; i += 5)
+    {
+      AVX512_ROUND (AVX512_PARITY, a, b, c, d, e, i);
+      AVX512_ROUND (AVX512_PARITY, e, a, b, c, d, i + 1);
+      AVX512_ROUND (AVX512_PARITY, d, e, a, b, c, i + 2);
+      AVX512_ROUND (AVX512_PARITY, c, d, e, a, b, i + 3);
+      AVX512_ROUND (AVX512_PARITY, b, c, d, e, a, i + 4);
+    }
+  k = _mm512_set1_epi32 ((int)0x8f1bbcdc);
+  for (i = 40; i < 60; i += 5)
+    {
+      AVX512_ROUND (AVX512_MAJ, a, b, c, d, e, i);
+      AVX512_ROUND (AVX512_MAJ, e, a, b, c, d, i + 1);
+      AVX512_ROUND (AVX512_MAJ, d, e, a, b, c, i + 2);
+      AVX512_ROUND (AVX512_MAJ, c, d, e, a, b, i + 3);
+      AVX512_ROUND (AVX512_MAJ, b, c, d, e, a, i + 4);
+    }
+  k = _mm512_set1_epi32 ((int)0xca62c1d6);
+  for (i = 60; i < 80; i += 5)
+    {
+      AVX512_ROUND (AVX512_PARITY, a, b, c, d, e, i);
+      AVX512_ROUND (AVX512_PARITY, e, a, b, c, d, i + 1);
+      AVX512_ROUND (AVX512_PARITY, d, e, a, b, c, i + 2);
+      AVX512_ROUND (AVX512_PARITY, c, d, e, a, b, i + 3);
+      AVX512_ROUND (AVX512_PARITY, b, c, d, e, a, i + 4);
+    }
+
+#define AVX512_ADD_STATE(j, x)                                                \
+  _mm512_storeu_si512 (                                                       \
+      state + (j) * AVX512_LANES,                                             \
+      _mm512_add_epi32 ((x), _mm512_loadu_si512 (state + (j) * AVX512_LANES)))
+
+  AVX512_ADD_STATE (0, a);
+  AVX512_ADD_STATE (1, b);
+  AVX512_ADD_STATE (2, c);
+  AVX512_ADD_STATE (3, d);
+  AVX512_ADD_STATE (4, e);
+
+#undef AVX512_ADD_STATE
+}
+
+const struct sha1_multi_backend sha1_multi_backend_avx512 = {
+  "avx512",
+  AVX512_LANES,
+  sha1_multi_compress_avx512,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha1_avx512_unused;
+
+#endif /* HAVE_AVX512_INTRINSICS */
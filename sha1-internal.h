@@ -0,0 +1,87 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between sha1.c and the instruction set specific SHA-1 code. The
+ * single message backends compress a whole number of 64-byte blocks into
+ * the five state words, the multi backends hash several independent messages
+ * at once for sha1_multi.
+ */
+
+#ifndef SHA1_INTERNAL_H
+#define SHA1_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct sha1_backend
+{
+  const char *name;
+  void (*compress) (uint32_t *, const uint8_t *, size_t);
+};
+
+/*
+ * Compresses one block for each of lanes independent messages, with the
+ * transposed state described in fcrypt_md.h.
+ */
+struct sha1_multi_backend
+{
+  const char *name;
+  unsigned int lanes;
+  void (*compress) (uint32_t *, const uint8_t *const *);
+};
+
+/* Portable implementation in sha1.c, always available. */
+extern const struct sha1_backend sha1_backend_generic;
+
+#if defined(HAVE_SHANI_INTRINSICS)
+/* Intel SHA extensions implementation in sha1-shani.c. */
+extern const struct sha1_backend sha1_backend_shani;
+#endif
+
+#if defined(HAVE_ARM_SHA2_INTRINSICS)
+/* ARMv8 SHA1C implementation in sha1-armv8.c. */
+extern const struct sha1_backend sha1_backend_armv8;
+#endif
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* Eight lanes with AVX2 in sha1-avx2.c. */
+extern const struct sha1_multi_backend sha1_multi_backend_avx2;
+#endif
+
+#if defined(HAVE_AVX512_INTRINSICS)
+/* Sixteen lanes with AVX-512 in sha1-avx512.c. */
+extern const struct sha1_multi_backend sha1_multi_backend_avx512;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* Four lanes with NEON in sha1-neon.c. */
+extern const struct sha1_multi_backend sha1_multi_backend_neon;
+#endif
+
+/* Name of the backend picked for this CPU, for fcrypt_hash_backend. */
+const char *sha1_backend_name (void);
+
+#endif /* SHA1_INTERNAL_H */
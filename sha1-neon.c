@@ -0,0 +1,169 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer SHA-1 with NEON, four messages at a time. This is the same as
+ * sha1-avx2.c with 128-bit vectors, using SRI to build the rotations.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha1-internal.h"
+#include "sha1.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_LANES 4
+
+#define NEON_ROTL(x, n) vsriq_n_u32 (vshlq_n_u32 ((x), (n)), (x), 32 - (n))
+#define NEON_XOR3(a, b, c) veorq_u32 ((a), veorq_u32 ((b), (c)))
+
+/* BSL selects bits from its second argument where the first is set. */
+#define NEON_CH(b, c, d) vbslq_u32 ((b), (c), (d))
+#define NEON_PARITY(b, c, d) NEON_XOR3 ((b), (c), (d))
+#define NEON_MAJ(b, c, d) vbslq_u32 (veorq_u32 ((b), (c)), (d), (c))
+
+/* Extends the message schedule to word i, for i >= 16. */
+#define NEON_SCHEDULE(i)                                                      \
+  (w[(i)&15] = NEON_ROTL (                                                    \
+       veorq_u32 (NEON_XOR3 (w[((i)-3) & 15], w[((i)-8) & 15],                \
+                             w[((i)-14) & 15]),                               \
+                  w[(i)&15]),                                                 \
+       1))
+
+#define NEON_ROUND(f, a, b, c, d, e, i)                                       \
+  do                                                                          \
+    {                                                                         \
+      if ((i) >= 16)                                                          \
+        NEON_SCHEDULE (i);                                                    \
+      (e) = vaddq_u32 (vaddq_u32 ((e), NEON_ROTL ((a), 5)),                   \
+                       vaddq_u32 (f ((b), (c), (d)),                          \
+                                  vaddq_u32 (k, w[(i)&15])));                 \
+      (b) = NEON_ROTL ((b), 30);                                              \
+    }                                                                         \
+  while (0)
+
+NEON_TARGET static void
+sha1_multi_compress_neon (uint32_t *state, const uint8_t *const *blocks)
+{
+  uint32x4_t a, b, c, d, e, k;
+  uint32x4_t w[16];
+  uint32x4_t r0, r1, r2, r3;
+  uint32x4x2_t t0, t1;
+  unsigned int i;
+
+  /* Transpose four words at a time from the four blocks. */
+  for (i = 0; i < 16; i += 4)
+    {
+      r0 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[0] + i * 4)));
+      r1 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[1] + i * 4)));
+      r2 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[2] + i * 4)));
+      r3 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[3] + i * 4)));
+      t0 = vtrnq_u32 (r0, r1);
+      t1 = vtrnq_u32 (r2, r3);
+      w[i] = vcombine_u32 (vget_low_u32 (t0.val[0]),
+                           vget_low_u32 (t1.val[0]));
+      w[i + 1] = vcombine_u32 (vget_low_u32 (t0.val[1]),
+                               vget_low_u32 (t1.val[1]));
+      w[i + 2] = vcombine_u32 (vget_high_u32 (t0.val[0]),
+                               vget_high_u32 (t1.val[0]));
+      w[i + 3] = vcombine_u32 (vget_high_u32 (t0.val[1]),
+                               vget_high_u32 (t1.val[1]));
+    }
+
+  a = vld1q_u32 (state + 0 * NEON_LANES);
+  b = vld1q_u32 (state + 1 * NEON_LANES);
+  c = vld1q_u32 (state + 2 * NEON_LANES);
+  d = vld1q_u32 (state + 3 * NEON_LANES);
+  e = vld1q_u32 (state + 4 * NEON_LANES);
+
+  k = vdupq_n_u32 (0x5a827999);
+  for (i = 0; i < 20; i += 5)
+    {
+      NEON_ROUND (NEON_CH, a, b, c, d, e, i);
+      NEON_ROUND (NEON_CH, e, a, b, c, d, i + 1);
+      NEON_ROUND (NEON_CH, d, e, a, b, c, i + 2);
+      NEON_ROUND (NEON_CH, c, d, e, a, b, i + 3);
+      NEON_ROUND (NEON_CH, b, c, d, e, a, i + 4);
+    }
+  k = vdupq_n_u32 (0x6ed9eba1);
+  for (i = 20; i < 40; i += 5)
+    {
+      NEON_ROUND (NEON_PARITY, a, b, c, d, e, i);
+      NEON_ROUND (NEON_PARITY, e, a, b, c, d, i + 1);
+      NEON_ROUND (NEON_PARITY, d, e, a, b, c, i + 2);
+      NEON_ROUND (NEON_PARITY, c, d, e, a, b, i + 3);
+      NEON_ROUND (NEON_PARITY, b, c, d, e, a, i + 4);
+    }
+  k = vdupq_n_u32 (0x8f1bbcdc);
+  for (i = 40; i < 60; i += 5)
+    {
+      NEON_ROUND (NEON_MAJ, a, b, c, d, e, i);
+      NEON_ROUND (NEON_MAJ, e, a, b, c, d, i + 1);
+      NEON_ROUND (NEON_MAJ, d, e, a, b, c, i + 2);
+      NEON_ROUND (NEON_MAJ, c, d, e, a, b, i + 3);
+      NEON_ROUND (NEON_MAJ, b, c, d, e, a, i + 4);
+    }
+  k = vdupq_n_u32 (0xca62c1d6);
+  for (i = 60; i < 80; i += 5)
+    {
+      NEON_ROUND (NEON_PARITY, a, b, c, d, e, i);
+      NEON_ROUND (NEON_PARITY, e, a, b, c, d, i + 1);
+      NEON_ROUND (NEON_PARITY, d, e, a, b, c, i + 2);
+      NEON_ROUND (NEON_PARITY, c, d, e, a, b, i + 3);
+      NEON_ROUND (NEON_PARITY, b, c, d, e, a, i + 4);
+    }
+
+  vst1q_u32 (state + 0 * NEON_LANES,
+             vaddq_u32 (a, vld1q_u32 (state + 0 * NEON_LANES)));
+  vst1q_u32 (state + 1 * NEON_LANES,
+             vaddq_u32 (b, vld1q_u32 (state + 1 * NEON_LANES)));
+  vst1q_u32 (state + 2 * NEON_LANES,
+             vaddq_u32 (c, vld1q_u32 (state + 2 * NEON_LANES)));
+  vst1q_u32 (state + 3 * NEON_LANES,
+             vaddq_u32 (d, vld1q_u32 (state + 3 * NEON_LANES)));
+  vst1q_u32 (state + 4 * NEON_LANES,
+             vaddq_u32 (e, vld1q_u32 (state + 4 * NEON_LANES)));
+}
+
+const struct sha1_multi_backend sha1_multi_backend_neon = {
+  "neon",
+  NEON_LANES,
+  sha1_multi_compress_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha1_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
@@ -0,0 +1,152 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SHA-1 using the Intel SHA extensions. SHA1RNDS4 does four rounds on ABCD
+ * given E plus the first message word, which SHA1NEXTE derives from the
+ * ABCD of four rounds earlier. SHA1MSG1 and SHA1MSG2 compute the message
+ * schedule four words at a time.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha1-internal.h"
+#include "sha1.h"
+
+#if defined(HAVE_SHANI_INTRINSICS)
+
+#include <immintrin.h>
+
+#define SHANI_TARGET __attribute__ ((target (SHANI_TARGET_ATTRIBUTE)))
+
+/*
+ * Four rounds with function f using the schedule words in m. On entry e
+ * holds ABCD from four rounds ago, on exit n holds ABCD from before these.
+ */
+#define SHANI_ROUNDS4(e, n, m, f)                                             \
+  do                                                                          \
+    {                                                                         \
+      (e) = _mm_sha1nexte_epu32 ((e), (m));                                   \
+      (n) = abcd;                                                             \
+      abcd = _mm_sha1rnds4_epu32 (abcd, (e), (f));                            \
+    }                                                                         \
+  while (0)
+
+/* Replaces the words in m0 with the ones needed 16 rounds later. */
+#define SHANI_SCHEDULE(m0, m1, m2, m3)                                        \
+  ((m0) = _mm_sha1msg2_epu32 (                                                \
+       _mm_xor_si128 (_mm_sha1msg1_epu32 ((m0), (m1)), (m2)), (m3)))
+
+SHANI_TARGET static void
+sha1_compress_shani (uint32_t *state, const uint8_t *data, size_t blocks)
+{
+  const __m128i mask
+      = _mm_set_epi8 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  __m128i abcd, e0, e1, save_abcd, save_e;
+  __m128i m0, m1, m2, m3;
+
+  /* A goes in the most significant word, E alone in another register. */
+  abcd = _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *)state), 0x1b);
+  e0 = _mm_set_epi32 ((int)state[4], 0, 0, 0);
+
+  for (; blocks > 0; --blocks)
+    {
+      save_abcd = abcd;
+      save_e = e0;
+
+      m0 = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *)data), mask);
+      m1 = _mm_shuffle_epi8 (
+          _mm_loadu_si128 ((const __m128i *)(data + 16)), mask);
+      m2 = _mm_shuffle_epi8 (
+          _mm_loadu_si128 ((const __m128i *)(data + 32)), mask);
+      m3 = _mm_shuffle_epi8 (
+          _mm_loadu_si128 ((const __m128i *)(data + 48)), mask);
+
+      e0 = _mm_add_epi32 (e0, m0);
+      e1 = abcd;
+      abcd = _mm_sha1rnds4_epu32 (abcd, e0, 0);
+      SHANI_SCHEDULE (m0, m1, m2, m3);
+      SHANI_ROUNDS4 (e1, e0, m1, 0);
+      SHANI_SCHEDULE (m1, m2, m3, m0);
+      SHANI_ROUNDS4 (e0, e1, m2, 0);
+      SHANI_SCHEDULE (m2, m3, m0, m1);
+      SHANI_ROUNDS4 (e1, e0, m3, 0);
+      SHANI_SCHEDULE (m3, m0, m1, m2);
+      SHANI_ROUNDS4 (e0, e1, m0, 0);
+      SHANI_SCHEDULE (m0, m1, m2, m3);
+
+      SHANI_ROUNDS4 (e1, e0, m1, 1);
+      SHANI_SCHEDULE (m1, m2, m3, m0);
+      SHANI_ROUNDS4 (e0, e1, m2, 1);
+      SHANI_SCHEDULE (m2, m3, m0, m1);
+      SHANI_ROUNDS4 (e1, e0, m3, 1);
+      SHANI_SCHEDULE (m3, m0, m1, m2);
+      SHANI_ROUNDS4 (e0, e1, m0, 1);
+      SHANI_SCHEDULE (m0, m1, m2, m3);
+      SHANI_ROUNDS4 (e1, e0, m1, 1);
+      SHANI_SCHEDULE (m1, m2, m3, m0);
+
+      SHANI_ROUNDS4 (e0, e1, m2, 2);
+      SHANI_SCHEDULE (m2, m3, m0, m1);
+      SHANI_ROUNDS4 (e1, e0, m3, 2);
+      SHANI_SCHEDULE (m3, m0, m1, m2);
+      SHANI_ROUNDS4 (e0, e1, m0, 2);
+      SHANI_SCHEDULE (m0, m1, m2, m3);
+      SHANI_ROUNDS4 (e1, e0, m1, 2);
+      SHANI_SCHEDULE (m1, m2, m3, m0);
+      SHANI_ROUNDS4 (e0, e1, m2, 2);
+      SHANI_SCHEDULE (m2, m3, m0, m1);
+
+      SHANI_ROUNDS4 (e1, e0, m3, 3);
+      SHANI_SCHEDULE (m3, m0, m1, m2);
+      SHANI_ROUNDS4 (e0, e1, m0, 3);
+      SHANI_ROUNDS4 (e1, e0, m1, 3);
+      SHANI_ROUNDS4 (e0, e1, m2, 3);
+      SHANI_ROUNDS4 (e1, e0, m3, 3);
+
+      /* E is the A from before the last four rounds, rotated. */
+      e0 = _mm_sha1nexte_epu32 (e0, save_e);
+      abcd = _mm_add_epi32 (abcd, save_abcd);
+      data += SHA1_BLOCK_SIZE;
+    }
+
+  _mm_storeu_si128 ((__m128i *)state, _mm_shuffle_epi32 (abcd, 0x1b));
+  state[4] = (uint32_t)_mm_extract_epi32 (e0, 3);
+}
+
+const struct sha1_backend sha1_backend_shani = {
+  "shani",
+  sha1_compress_shani,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha1_shani_unused;
+
+#endif /* HAVE_SHANI_INTRINSICS */
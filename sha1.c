@@ -23,12 +23,19 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "bswap.h"
 #include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_md.h"
+#include "fcrypt_wipe.h"
+#include "sha1-internal.h"
 #include "sha1.h"
 
 /* Logical functions used by SHA-1. */
@@ -54,135 +61,213 @@ sha1_init (struct sha1_ctx *ctx)
   ctx->count = 0;
 }
 
-void
-sha1_transform (uint32_t *state, const uint8_t *block)
+static void
+sha1_compress_generic (uint32_t *state, const uint8_t *data, size_t blocks)
 {
   uint32_t a, b, c, d, e, t, i;
   uint32_t w[80];
 
-  for (i = 0; i < 16; ++i)
-    w[i] = buff_get_be32 (block + i * 4);
-  for (i = 16; i < 80; ++i)
-    w[i] = rotl32 (w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  for (; blocks > 0; --blocks)
+    {
+      buff_get_be32_words (w, data, 16);
+      for (i = 16; i < 80; ++i)
+        w[i] = rotl32 (w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
 
-  a = state[0];
-  b = state[1];
-  c = state[2];
-  d = state[3];
-  e = state[4];
+      a = state[0];
+      b = state[1];
+      c = state[2];
+      d = state[3];
+      e = state[4];
 
-  for (i = 0; i < 20; ++i)
-    {
-      t = rotl32 (a, 5) + F1 (b, c, d) + e + w[i] + K1;
-      e = d;
-      d = c;
-      c = rotl32 (b, 30);
-      b = a;
-      a = t;
-    }
-  for (i = 20; i < 40; ++i)
-    {
-      t = rotl32 (a, 5) + F2 (b, c, d) + e + w[i] + K2;
-      e = d;
-      d = c;
-      c = rotl32 (b, 30);
-      b = a;
-      a = t;
-    }
-  for (i = 40; i < 60; ++i)
-    {
-      t = rotl32 (a, 5) + F3 (b, c, d) + e + w[i] + K3;
-      e = d;
-      d = c;
-      c = rotl32 (b, 30);
-      b = a;
-      a = t;
-    }
-  for (i = 60; i < 80; ++i)
-    {
-      t = rotl32 (a, 5) + F4 (b, c, d) + e + w[i] + K4;
-      e = d;
-      d = c;
-      c = rotl32 (b, 30);
-      b = a;
-      a = t;
+      for (i = 0; i < 20; ++i)
+        {
+          t = rotl32 (a, 5) + F1 (b, c, d) + e + w[i] + K1;
+          e = d;
+          d = c;
+          c = rotl32 (b, 30);
+          b = a;
+          a = t;
+        }
+      for (i = 20; i < 40; ++i)
+        {
+          t = rotl32 (a, 5) + F2 (b, c, d) + e + w[i] + K2;
+          e = d;
+          d = c;
+          c = rotl32 (b, 30);
+          b = a;
+          a = t;
+        }
+      for (i = 40; i < 60; ++i)
+        {
+          t = rotl32 (a, 5) + F3 (b, c, d) + e + w[i] + K3;
+          e = d;
+          d = c;
+          c = rotl32 (b, 30);
+          b = a;
+          a = t;
+        }
+      for (i = 60; i < 80; ++i)
+        {
+          t = rotl32 (a, 5) + F4 (b, c, d) + e + w[i] + K4;
+          e = d;
+          d = c;
+          c = rotl32 (b, 30);
+          b = a;
+          a = t;
+        }
+
+      state[0] += a;
+      state[1] += b;
+      state[2] += c;
+      state[3] += d;
+      state[4] += e;
+      data += SHA1_BLOCK_SIZE;
     }
+}
+
+const struct sha1_backend sha1_backend_generic = {
+  "generic",
+  sha1_compress_generic,
+};
+
+/*
+ * The implementation is picked once when the library is loaded. Compilers
+ * without constructor support always use the portable code.
+ */
+static const struct sha1_backend *sha1_backend = &sha1_backend_generic;
+
+/* Vector code used by sha1_multi, or NULL to hash one message at a time. */
+static const struct sha1_multi_backend *sha1_multi_backend = NULL;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+sha1_select_backend (void)
+{
+  uint32_t features;
 
-  state[0] += a;
-  state[1] += b;
-  state[2] += c;
-  state[3] += d;
-  state[4] += e;
+  features = fcrypt_cpu_features ();
+  (void)features;
+#if defined(HAVE_SHANI_INTRINSICS)
+  if ((features & (FCRYPT_CPU_SHA | FCRYPT_CPU_SSE41))
+      == (FCRYPT_CPU_SHA | FCRYPT_CPU_SSE41))
+    sha1_backend = &sha1_backend_shani;
+#endif
+#if defined(HAVE_ARM_SHA2_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_SHA1) != 0)
+    sha1_backend = &sha1_backend_armv8;
+#endif
+
+  /*
+   * Four or eight lanes are slower than the SHA instructions on a single
+   * message, so they are only used without them.
+   */
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & (FCRYPT_CPU_ARM_NEON | FCRYPT_CPU_ARM_SHA1))
+      == FCRYPT_CPU_ARM_NEON)
+    sha1_multi_backend = &sha1_multi_backend_neon;
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & (FCRYPT_CPU_AVX2 | FCRYPT_CPU_SHA)) == FCRYPT_CPU_AVX2)
+    sha1_multi_backend = &sha1_multi_backend_avx2;
+#endif
+#if defined(HAVE_AVX512_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX512F) != 0)
+    sha1_multi_backend = &sha1_multi_backend_avx512;
+#endif
+}
+#endif /* __GNUC__ */
+
+const char *
+sha1_backend_name (void)
+{
+  return sha1_backend->name;
 }
 
 void
-sha1_update (struct sha1_ctx *ctx, const void *inputptr, size_t inputlen)
+sha1_transform (uint32_t *state, const uint8_t *block)
 {
-  size_t filled, need;
-  const uint8_t *input = inputptr;
+  sha1_backend->compress (state, block, 1);
+}
 
-  if (inputlen == 0)
-    return;
+/* Adapts the backend to the shared block buffering in fcrypt_md.h. */
+static void
+sha1_compress (void *state, const uint8_t *blocks, size_t nblocks)
+{
+  sha1_backend->compress (state, blocks, nblocks);
+}
 
-  filled = (size_t)((ctx->count >> 3) & (SHA1_BLOCK_SIZE - 1));
-  need = SHA1_BLOCK_SIZE - filled;
-  ctx->count += (uint64_t)(inputlen << 3);
+void
+sha1_update (struct sha1_ctx *ctx, const void *input, size_t inputlen)
+{
+  fcrypt_md_update (ctx->state, &ctx->count, ctx->buffer, sha1_compress, input,
+                    inputlen);
+}
 
-  /* Input too short to fill a complete block. */
-  if (inputlen < need)
-    {
-      memcpy (&ctx->buffer[filled], input, inputlen);
-      return;
-    }
+void
+sha1_updatev (struct sha1_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
 
-  /* Check if we need to finish the buffer in ctx. */
-  if (filled != 0)
-    {
-      memcpy (&ctx->buffer[filled], input, need);
-      sha1_transform (ctx->state, ctx->buffer);
-      inputlen -= need;
-      input += need;
-    }
+  for (i = 0; i < iovcnt; ++i)
+    sha1_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
 
-  /* Handle as many blocks as possible. */
-  while (inputlen >= SHA1_BLOCK_SIZE)
-    {
-      sha1_transform (ctx->state, input);
-      inputlen -= SHA1_BLOCK_SIZE;
-      input += SHA1_BLOCK_SIZE;
-    }
+void
+sha1_final (uint8_t *digest, struct sha1_ctx *ctx)
+{
+  uint32_t i;
 
-  /* Save any remaining bytes. */
-  if (inputlen != 0)
-    memcpy (ctx->buffer, input, inputlen);
+  fcrypt_md_final (ctx->state, ctx->count, ctx->buffer, sha1_compress, 0x80,
+                   1);
+  for (i = 0; i < 5; ++i)
+    buff_put_be32 (digest + i * 4, ctx->state[i]);
+  fcrypt_wipe (ctx, sizeof (*ctx));
 }
 
 void
-sha1_final (uint8_t *digest, struct sha1_ctx *ctx)
+sha1_copy (struct sha1_ctx *dst, const struct sha1_ctx *src)
 {
-  size_t padoffset;
+  *dst = *src;
+}
+
+/* Hashes a whole message without buffering it through a context. */
+void
+sha1 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha1_ctx ctx;
   uint32_t i;
 
-  padoffset = (size_t)((ctx->count >> 3) & (SHA1_BLOCK_SIZE - 1));
+  sha1_init (&ctx);
+  fcrypt_md_oneshot (ctx.state, ctx.buffer, sha1_compress, 0x80, 1, input,
+                     inputlen);
+  for (i = 0; i < 5; ++i)
+    buff_put_be32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
+}
 
-  ctx->buffer[padoffset++] = 0x80;
+/*
+ * Hashes count independent messages, writing the SHA1_DIGEST_SIZE byte
+ * digest of message i to digests + i * SHA1_DIGEST_SIZE.
+ */
+void
+sha1_multi (uint8_t *digests, const uint8_t *const *messages,
+            const size_t *lens, size_t count)
+{
+  struct fcrypt_md_multi md;
+  struct sha1_ctx ctx;
 
-  /* Enough room for count. */
-  if (padoffset <= 56)
-    memset (&ctx->buffer[padoffset], 0, 56 - padoffset);
-  else
+  sha1_init (&ctx);
+  md.iv = ctx.state;
+  md.words = 5;
+  md.digest_words = 5;
+  md.big_endian = 1;
+  md.compress = sha1_compress;
+  md.lanes = 0;
+  md.compress_lanes = NULL;
+  if (sha1_multi_backend != NULL)
     {
-      /* Not enough room for count. */
-      memset (&ctx->buffer[padoffset], 0, SHA1_BLOCK_SIZE - padoffset);
-      sha1_transform (ctx->state, ctx->buffer);
-      memset (ctx->buffer, 0, 56);
+      md.lanes = sha1_multi_backend->lanes;
+      md.compress_lanes = sha1_multi_backend->compress;
     }
-
-  /* Append the count and handle the block. */
-  buff_put_be64 (ctx->buffer + 56, ctx->count);
-  sha1_transform (ctx->state, ctx->buffer);
-
-  for (i = 0; i < 5; ++i)
-    buff_put_be32 (digest + i * 4, ctx->state[i]);
-  memset (ctx, 0, sizeof (*ctx));
+  fcrypt_md_multi (&md, digests, messages, lens, count);
 }
@@ -29,6 +29,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct iovec;
+
 #define SHA1_DIGEST_SIZE 20
 #define SHA1_BLOCK_SIZE 64
 
@@ -42,6 +44,17 @@ struct sha1_ctx
 void sha1_init (struct sha1_ctx *);
 void sha1_transform (uint32_t *, const uint8_t *);
 void sha1_update (struct sha1_ctx *, const void *, size_t);
+void sha1_updatev (struct sha1_ctx *, const struct iovec *, size_t);
 void sha1_final (uint8_t *, struct sha1_ctx *);
+void sha1_copy (struct sha1_ctx *, const struct sha1_ctx *);
+void sha1 (uint8_t *, const void *, size_t);
+
+/*
+ * Hashes many independent messages at once, using the SIMD units to run the
+ * compression function on several of them in parallel. The arguments are the
+ * output buffer for the digests, stored one after another, the arrays of
+ * message pointers and lengths, and the number of messages.
+ */
+void sha1_multi (uint8_t *, const uint8_t *const *, const size_t *, size_t);
 
 #endif /* SHA1_H */
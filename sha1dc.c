@@ -0,0 +1,926 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Every published SHA-1 collision attack builds its blocks around a
+ * disturbance vector: a sparse XOR difference in the expanded message whose
+ * local collisions cancel inside the compression function. For each block
+ * we look at the 32 disturbance vectors that practical attacks can use, and
+ * for each one reconstruct the sibling block that an attack with it would
+ * pair ours with. Starting from our state at a step where the attack leaves
+ * no state difference, the sibling is computed backwards to its chaining
+ * value and forwards to its output, and the block is part of a collision if
+ * that output equals ours.
+ *
+ * Stevens and Shumow skip most disturbance vectors with the unavoidable bit
+ * conditions of the attack. We instead stop the backward computation at the
+ * first step where the sibling state differs from ours although the
+ * disturbance vector says an attack has no difference there. A random block
+ * fails the first or second such check, so the cost is a few steps per
+ * disturbance vector on top of the compression.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bswap.h"
+#include "circularshift.h"
+#include "fcrypt_md.h"
+#include "fcrypt_wipe.h"
+#include "sha1.h"
+#include "sha1dc.h"
+
+/* Logical functions used by SHA-1. */
+#define F1(b, c, d) (((b) & (c)) | ((~(b)) & (d)))
+#define F2(b, c, d) ((b) ^ (c) ^ (d))
+#define F3(b, c, d) (((b) & (c)) | ((b) & (d)) | ((c) & (d)))
+#define F4(b, c, d) ((b) ^ (c) ^ (d))
+
+/* Constants used by SHA-1. */
+#define K1 0x5a827999
+#define K2 0x6ed9eba1
+#define K3 0x8f1bbcdc
+#define K4 0xca62c1d6
+
+/*
+ * The state before step i is (A_i, A_i-1, A_i-2 <<< 30, A_i-3 <<< 30,
+ * A_i-4 <<< 30), so the 85 values A_-4 to A_80 describe the whole
+ * compression. Q (i) is A_i in an array starting at A_-4.
+ */
+#define Q(q, i) ((q)[(i) + 4])
+
+struct sha1dc_dv
+{
+  /* Step where the attack has no state difference. */
+  uint8_t t;
+  /* Last step before t with a message difference. */
+  uint8_t start;
+  /* Steps i below t where an attack has no difference in A_i. */
+  uint64_t checks;
+  /* Difference of the expanded message words. */
+  uint32_t dm[80];
+};
+
+/*
+ * Disturbance vectors of type I(K,b) and II(K,b) as named by Manuel,
+ * "Classification and generation of disturbance vectors for collision
+ * attacks against SHA-1". The message differences come from expanding the
+ * vector forwards and backwards and adding the corrections of each local
+ * collision.
+ */
+static const struct sha1dc_dv sha1dc_dvs[] = {
+  /* I(43,0) */
+  { 58, 47, UINT64_C (0x003ff55d93000000),
+    {
+        0x08000000, 0x9800000c, 0xd8000010, 0x08000010, 0xb8000010,
+        0x98000000, 0x60000000, 0x00000008, 0xc0000000, 0x90000014,
+        0x10000010, 0xb8000014, 0x28000000, 0x20000010, 0x48000000,
+        0x08000018, 0x60000000, 0x90000010, 0xf0000010, 0x90000008,
+        0xc0000000, 0x90000010, 0xf0000010, 0xb0000008, 0x40000000,
+        0x90000000, 0xf0000010, 0x90000018, 0x60000000, 0x90000010,
+        0x90000010, 0x90000000, 0x80000000, 0x00000010, 0xa0000000,
+        0x20000000, 0xa0000000, 0x20000010, 0x00000000, 0x20000010,
+        0x20000000, 0x00000010, 0x20000000, 0x00000010, 0xa0000000,
+        0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000020,
+        0x00000001, 0x40000002, 0x40000040, 0x40000002, 0x80000004,
+        0x80000080, 0x80000006, 0x00000049, 0x00000103, 0x80000009,
+        0x80000012, 0x80000202, 0x00000018, 0x00000164, 0x00000408,
+        0x800000e6, 0x8000004c, 0x00000803, 0x80000161, 0x80000599,
+    } },
+  /* I(44,0) */
+  { 58, 48, UINT64_C (0x003feabb26200000),
+    {
+        0xb4000008, 0x08000000, 0x9800000c, 0xd8000010, 0x08000010,
+        0xb8000010, 0x98000000, 0x60000000, 0x00000008, 0xc0000000,
+        0x90000014, 0x10000010, 0xb8000014, 0x28000000, 0x20000010,
+        0x48000000, 0x08000018, 0x60000000, 0x90000010, 0xf0000010,
+        0x90000008, 0xc0000000, 0x90000010, 0xf0000010, 0xb0000008,
+        0x40000000, 0x90000000, 0xf0000010, 0x90000018, 0x60000000,
+        0x90000010, 0x90000010, 0x90000000, 0x80000000, 0x00000010,
+        0xa0000000, 0x20000000, 0xa0000000, 0x20000010, 0x00000000,
+        0x20000010, 0x20000000, 0x00000010, 0x20000000, 0x00000010,
+        0xa0000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+        0x00000020, 0x00000001, 0x40000002, 0x40000040, 0x40000002,
+        0x80000004, 0x80000080, 0x80000006, 0x00000049, 0x00000103,
+        0x80000009, 0x80000012, 0x80000202, 0x00000018, 0x00000164,
+        0x00000408, 0x800000e6, 0x8000004c, 0x00000803, 0x80000161,
+    } },
+  /* I(45,0) */
+  { 58, 49, UINT64_C (0x003fd5764c400000),
+    {
+        0xf4000014, 0xb4000008, 0x08000000, 0x9800000c, 0xd8000010,
+        0x08000010, 0xb8000010, 0x98000000, 0x60000000, 0x00000008,
+        0xc0000000, 0x90000014, 0x10000010, 0xb8000014, 0x28000000,
+        0x20000010, 0x48000000, 0x08000018, 0x60000000, 0x90000010,
+        0xf0000010, 0x90000008, 0xc0000000, 0x90000010, 0xf0000010,
+        0xb0000008, 0x40000000, 0x90000000, 0xf0000010, 0x90000018,
+        0x60000000, 0x90000010, 0x90000010, 0x90000000, 0x80000000,
+        0x00000010, 0xa0000000, 0x20000000, 0xa0000000, 0x20000010,
+        0x00000000, 0x20000010, 0x20000000, 0x00000010, 0x20000000,
+        0x00000010, 0xa0000000, 0x00000000, 0x20000000, 0x20000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000001, 0x00000020, 0x00000001, 0x40000002, 0x40000040,
+        0x40000002, 0x80000004, 0x80000080, 0x80000006, 0x00000049,
+        0x00000103, 0x80000009, 0x80000012, 0x80000202, 0x00000018,
+        0x00000164, 0x00000408, 0x800000e6, 0x8000004c, 0x00000803,
+    } },
+  /* I(46,0) */
+  { 58, 50, UINT64_C (0x003faaec98800000),
+    {
+        0x2c000010, 0xf4000014, 0xb4000008, 0x08000000, 0x9800000c,
+        0xd8000010, 0x08000010, 0xb8000010, 0x98000000, 0x60000000,
+        0x00000008, 0xc0000000, 0x90000014, 0x10000010, 0xb8000014,
+        0x28000000, 0x20000010, 0x48000000, 0x08000018, 0x60000000,
+        0x90000010, 0xf0000010, 0x90000008, 0xc0000000, 0x90000010,
+        0xf0000010, 0xb0000008, 0x40000000, 0x90000000, 0xf0000010,
+        0x90000018, 0x60000000, 0x90000010, 0x90000010, 0x90000000,
+        0x80000000, 0x00000010, 0xa0000000, 0x20000000, 0xa0000000,
+        0x20000010, 0x00000000, 0x20000010, 0x20000000, 0x00000010,
+        0x20000000, 0x00000010, 0xa0000000, 0x00000000, 0x20000000,
+        0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000001, 0x00000020, 0x00000001, 0x40000002,
+        0x40000040, 0x40000002, 0x80000004, 0x80000080, 0x80000006,
+        0x00000049, 0x00000103, 0x80000009, 0x80000012, 0x80000202,
+        0x00000018, 0x00000164, 0x00000408, 0x800000e6, 0x8000004c,
+    } },
+  /* I(46,2) */
+  { 58, 50, UINT64_C (0x003faaec98800000),
+    {
+        0xb0000040, 0xd0000053, 0xd0000022, 0x20000000, 0x60000032,
+        0x60000043, 0x20000040, 0xe0000042, 0x60000002, 0x80000001,
+        0x00000020, 0x00000003, 0x40000052, 0x40000040, 0xe0000052,
+        0xa0000000, 0x80000040, 0x20000001, 0x20000060, 0x80000001,
+        0x40000042, 0xc0000043, 0x40000022, 0x00000003, 0x40000042,
+        0xc0000043, 0xc0000022, 0x00000001, 0x40000002, 0xc0000043,
+        0x40000062, 0x80000001, 0x40000042, 0x40000042, 0x40000002,
+        0x00000002, 0x00000040, 0x80000002, 0x80000000, 0x80000002,
+        0x80000040, 0x00000000, 0x80000040, 0x80000000, 0x00000040,
+        0x80000000, 0x00000040, 0x80000002, 0x00000000, 0x80000000,
+        0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000004, 0x00000080, 0x00000004, 0x00000009,
+        0x00000101, 0x00000009, 0x00000012, 0x00000202, 0x0000001a,
+        0x00000124, 0x0000040c, 0x00000026, 0x0000004a, 0x0000080a,
+        0x00000060, 0x00000590, 0x00001020, 0x0000039a, 0x00000132,
+    } },
+  /* I(47,0) */
+  { 58, 51, UINT64_C (0x003f55d931000000),
+    {
+        0xc8000010, 0x2c000010, 0xf4000014, 0xb4000008, 0x08000000,
+        0x9800000c, 0xd8000010, 0x08000010, 0xb8000010, 0x98000000,
+        0x60000000, 0x00000008, 0xc0000000, 0x90000014, 0x10000010,
+        0xb8000014, 0x28000000, 0x20000010, 0x48000000, 0x08000018,
+        0x60000000, 0x90000010, 0xf0000010, 0x90000008, 0xc0000000,
+        0x90000010, 0xf0000010, 0xb0000008, 0x40000000, 0x90000000,
+        0xf0000010, 0x90000018, 0x60000000, 0x90000010, 0x90000010,
+        0x90000000, 0x80000000, 0x00000010, 0xa0000000, 0x20000000,
+        0xa0000000, 0x20000010, 0x00000000, 0x20000010, 0x20000000,
+        0x00000010, 0x20000000, 0x00000010, 0xa0000000, 0x00000000,
+        0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000001, 0x00000020, 0x00000001,
+        0x40000002, 0x40000040, 0x40000002, 0x80000004, 0x80000080,
+        0x80000006, 0x00000049, 0x00000103, 0x80000009, 0x80000012,
+        0x80000202, 0x00000018, 0x00000164, 0x00000408, 0x800000e6,
+    } },
+  /* I(47,2) */
+  { 58, 51, UINT64_C (0x003f55d931000000),
+    {
+        0x20000043, 0xb0000040, 0xd0000053, 0xd0000022, 0x20000000,
+        0x60000032, 0x60000043, 0x20000040, 0xe0000042, 0x60000002,
+        0x80000001, 0x00000020, 0x00000003, 0x40000052, 0x40000040,
+        0xe0000052, 0xa0000000, 0x80000040, 0x20000001, 0x20000060,
+        0x80000001, 0x40000042, 0xc0000043, 0x40000022, 0x00000003,
+        0x40000042, 0xc0000043, 0xc0000022, 0x00000001, 0x40000002,
+        0xc0000043, 0x40000062, 0x80000001, 0x40000042, 0x40000042,
+        0x40000002, 0x00000002, 0x00000040, 0x80000002, 0x80000000,
+        0x80000002, 0x80000040, 0x00000000, 0x80000040, 0x80000000,
+        0x00000040, 0x80000000, 0x00000040, 0x80000002, 0x00000000,
+        0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000004, 0x00000080, 0x00000004,
+        0x00000009, 0x00000101, 0x00000009, 0x00000012, 0x00000202,
+        0x0000001a, 0x00000124, 0x0000040c, 0x00000026, 0x0000004a,
+        0x0000080a, 0x00000060, 0x00000590, 0x00001020, 0x0000039a,
+    } },
+  /* I(48,0) */
+  { 58, 52, UINT64_C (0x003eabb262200000),
+    {
+        0xb800000a, 0xc8000010, 0x2c000010, 0xf4000014, 0xb4000008,
+        0x08000000, 0x9800000c, 0xd8000010, 0x08000010, 0xb8000010,
+        0x98000000, 0x60000000, 0x00000008, 0xc0000000, 0x90000014,
+        0x10000010, 0xb8000014, 0x28000000, 0x20000010, 0x48000000,
+        0x08000018, 0x60000000, 0x90000010, 0xf0000010, 0x90000008,
+        0xc0000000, 0x90000010, 0xf0000010, 0xb0000008, 0x40000000,
+        0x90000000, 0xf0000010, 0x90000018, 0x60000000, 0x90000010,
+        0x90000010, 0x90000000, 0x80000000, 0x00000010, 0xa0000000,
+        0x20000000, 0xa0000000, 0x20000010, 0x00000000, 0x20000010,
+        0x20000000, 0x00000010, 0x20000000, 0x00000010, 0xa0000000,
+        0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000020,
+        0x00000001, 0x40000002, 0x40000040, 0x40000002, 0x80000004,
+        0x80000080, 0x80000006, 0x00000049, 0x00000103, 0x80000009,
+        0x80000012, 0x80000202, 0x00000018, 0x00000164, 0x00000408,
+    } },
+  /* I(48,2) */
+  { 58, 52, UINT64_C (0x003eabb262200000),
+    {
+        0xe000002a, 0x20000043, 0xb0000040, 0xd0000053, 0xd0000022,
+        0x20000000, 0x60000032, 0x60000043, 0x20000040, 0xe0000042,
+        0x60000002, 0x80000001, 0x00000020, 0x00000003, 0x40000052,
+        0x40000040, 0xe0000052, 0xa0000000, 0x80000040, 0x20000001,
+        0x20000060, 0x80000001, 0x40000042, 0xc0000043, 0x40000022,
+        0x00000003, 0x40000042, 0xc0000043, 0xc0000022, 0x00000001,
+        0x40000002, 0xc0000043, 0x40000062, 0x80000001, 0x40000042,
+        0x40000042, 0x40000002, 0x00000002, 0x00000040, 0x80000002,
+        0x80000000, 0x80000002, 0x80000040, 0x00000000, 0x80000040,
+        0x80000000, 0x00000040, 0x80000000, 0x00000040, 0x80000002,
+        0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000080,
+        0x00000004, 0x00000009, 0x00000101, 0x00000009, 0x00000012,
+        0x00000202, 0x0000001a, 0x00000124, 0x0000040c, 0x00000026,
+        0x0000004a, 0x0000080a, 0x00000060, 0x00000590, 0x00001020,
+    } },
+  /* I(49,0) */
+  { 58, 53, UINT64_C (0x003d5764c4400000),
+    {
+        0x18000000, 0xb800000a, 0xc8000010, 0x2c000010, 0xf4000014,
+        0xb4000008, 0x08000000, 0x9800000c, 0xd8000010, 0x08000010,
+        0xb8000010, 0x98000000, 0x60000000, 0x00000008, 0xc0000000,
+        0x90000014, 0x10000010, 0xb8000014, 0x28000000, 0x20000010,
+        0x48000000, 0x08000018, 0x60000000, 0x90000010, 0xf0000010,
+        0x90000008, 0xc0000000, 0x90000010, 0xf0000010, 0xb0000008,
+        0x40000000, 0x90000000, 0xf0000010, 0x90000018, 0x60000000,
+        0x90000010, 0x90000010, 0x90000000, 0x80000000, 0x00000010,
+        0xa0000000, 0x20000000, 0xa0000000, 0x20000010, 0x00000000,
+        0x20000010, 0x20000000, 0x00000010, 0x20000000, 0x00000010,
+        0xa0000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+        0x00000020, 0x00000001, 0x40000002, 0x40000040, 0x40000002,
+        0x80000004, 0x80000080, 0x80000006, 0x00000049, 0x00000103,
+        0x80000009, 0x80000012, 0x80000202, 0x00000018, 0x00000164,
+    } },
+  /* I(49,2) */
+  { 58, 53, UINT64_C (0x003d5764c4400000),
+    {
+        0x60000000, 0xe000002a, 0x20000043, 0xb0000040, 0xd0000053,
+        0xd0000022, 0x20000000, 0x60000032, 0x60000043, 0x20000040,
+        0xe0000042, 0x60000002, 0x80000001, 0x00000020, 0x00000003,
+        0x40000052, 0x40000040, 0xe0000052, 0xa0000000, 0x80000040,
+        0x20000001, 0x20000060, 0x80000001, 0x40000042, 0xc0000043,
+        0x40000022, 0x00000003, 0x40000042, 0xc0000043, 0xc0000022,
+        0x00000001, 0x40000002, 0xc0000043, 0x40000062, 0x80000001,
+        0x40000042, 0x40000042, 0x40000002, 0x00000002, 0x00000040,
+        0x80000002, 0x80000000, 0x80000002, 0x80000040, 0x00000000,
+        0x80000040, 0x80000000, 0x00000040, 0x80000000, 0x00000040,
+        0x80000002, 0x00000000, 0x80000000, 0x80000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004,
+        0x00000080, 0x00000004, 0x00000009, 0x00000101, 0x00000009,
+        0x00000012, 0x00000202, 0x0000001a, 0x00000124, 0x0000040c,
+        0x00000026, 0x0000004a, 0x0000080a, 0x00000060, 0x00000590,
+    } },
+  /* I(50,0) */
+  { 58, 54, UINT64_C (0x003aaec988a00000),
+    {
+        0x0800000c, 0x18000000, 0xb800000a, 0xc8000010, 0x2c000010,
+        0xf4000014, 0xb4000008, 0x08000000, 0x9800000c, 0xd8000010,
+        0x08000010, 0xb8000010, 0x98000000, 0x60000000, 0x00000008,
+        0xc0000000, 0x90000014, 0x10000010, 0xb8000014, 0x28000000,
+        0x20000010, 0x48000000, 0x08000018, 0x60000000, 0x90000010,
+        0xf0000010, 0x90000008, 0xc0000000, 0x90000010, 0xf0000010,
+        0xb0000008, 0x40000000, 0x90000000, 0xf0000010, 0x90000018,
+        0x60000000, 0x90000010, 0x90000010, 0x90000000, 0x80000000,
+        0x00000010, 0xa0000000, 0x20000000, 0xa0000000, 0x20000010,
+        0x00000000, 0x20000010, 0x20000000, 0x00000010, 0x20000000,
+        0x00000010, 0xa0000000, 0x00000000, 0x20000000, 0x20000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000001, 0x00000020, 0x00000001, 0x40000002, 0x40000040,
+        0x40000002, 0x80000004, 0x80000080, 0x80000006, 0x00000049,
+        0x00000103, 0x80000009, 0x80000012, 0x80000202, 0x00000018,
+    } },
+  /* I(50,2) */
+  { 58, 54, UINT64_C (0x003aaec988a00000),
+    {
+        0x20000030, 0x60000000, 0xe000002a, 0x20000043, 0xb0000040,
+        0xd0000053, 0xd0000022, 0x20000000, 0x60000032, 0x60000043,
+        0x20000040, 0xe0000042, 0x60000002, 0x80000001, 0x00000020,
+        0x00000003, 0x40000052, 0x40000040, 0xe0000052, 0xa0000000,
+        0x80000040, 0x20000001, 0x20000060, 0x80000001, 0x40000042,
+        0xc0000043, 0x40000022, 0x00000003, 0x40000042, 0xc0000043,
+        0xc0000022, 0x00000001, 0x40000002, 0xc0000043, 0x40000062,
+        0x80000001, 0x40000042, 0x40000042, 0x40000002, 0x00000002,
+        0x00000040, 0x80000002, 0x80000000, 0x80000002, 0x80000040,
+        0x00000000, 0x80000040, 0x80000000, 0x00000040, 0x80000000,
+        0x00000040, 0x80000002, 0x00000000, 0x80000000, 0x80000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000004, 0x00000080, 0x00000004, 0x00000009, 0x00000101,
+        0x00000009, 0x00000012, 0x00000202, 0x0000001a, 0x00000124,
+        0x0000040c, 0x00000026, 0x0000004a, 0x0000080a, 0x00000060,
+    } },
+  /* I(51,0) */
+  { 58, 55, UINT64_C (0x00355d9311400000),
+    {
+        0xe8000000, 0x0800000c, 0x18000000, 0xb800000a, 0xc8000010,
+        0x2c000010, 0xf4000014, 0xb4000008, 0x08000000, 0x9800000c,
+        0xd8000010, 0x08000010, 0xb8000010, 0x98000000, 0x60000000,
+        0x00000008, 0xc0000000, 0x90000014, 0x10000010, 0xb8000014,
+        0x28000000, 0x20000010, 0x48000000, 0x08000018, 0x60000000,
+        0x90000010, 0xf0000010, 0x90000008, 0xc0000000, 0x90000010,
+        0xf0000010, 0xb0000008, 0x40000000, 0x90000000, 0xf0000010,
+        0x90000018, 0x60000000, 0x90000010, 0x90000010, 0x90000000,
+        0x80000000, 0x00000010, 0xa0000000, 0x20000000, 0xa0000000,
+        0x20000010, 0x00000000, 0x20000010, 0x20000000, 0x00000010,
+        0x20000000, 0x00000010, 0xa0000000, 0x00000000, 0x20000000,
+        0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000001, 0x00000020, 0x00000001, 0x40000002,
+        0x40000040, 0x40000002, 0x80000004, 0x80000080, 0x80000006,
+        0x00000049, 0x00000103, 0x80000009, 0x80000012, 0x80000202,
+    } },
+  /* I(51,2) */
+  { 58, 55, UINT64_C (0x00355d9311400000),
+    {
+        0xa0000003, 0x20000030, 0x60000000, 0xe000002a, 0x20000043,
+        0xb0000040, 0xd0000053, 0xd0000022, 0x20000000, 0x60000032,
+        0x60000043, 0x20000040, 0xe0000042, 0x60000002, 0x80000001,
+        0x00000020, 0x00000003, 0x40000052, 0x40000040, 0xe0000052,
+        0xa0000000, 0x80000040, 0x20000001, 0x20000060, 0x80000001,
+        0x40000042, 0xc0000043, 0x40000022, 0x00000003, 0x40000042,
+        0xc0000043, 0xc0000022, 0x00000001, 0x40000002, 0xc0000043,
+        0x40000062, 0x80000001, 0x40000042, 0x40000042, 0x40000002,
+        0x00000002, 0x00000040, 0x80000002, 0x80000000, 0x80000002,
+        0x80000040, 0x00000000, 0x80000040, 0x80000000, 0x00000040,
+        0x80000000, 0x00000040, 0x80000002, 0x00000000, 0x80000000,
+        0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000004, 0x00000080, 0x00000004, 0x00000009,
+        0x00000101, 0x00000009, 0x00000012, 0x00000202, 0x0000001a,
+        0x00000124, 0x0000040c, 0x00000026, 0x0000004a, 0x0000080a,
+    } },
+  /* I(52,0) */
+  { 58, 56, UINT64_C (0x002abb2622a00000),
+    {
+        0x04000010, 0xe8000000, 0x0800000c, 0x18000000, 0xb800000a,
+        0xc8000010, 0x2c000010, 0xf4000014, 0xb4000008, 0x08000000,
+        0x9800000c, 0xd8000010, 0x08000010, 0xb8000010, 0x98000000,
+        0x60000000, 0x00000008, 0xc0000000, 0x90000014, 0x10000010,
+        0xb8000014, 0x28000000, 0x20000010, 0x48000000, 0x08000018,
+        0x60000000, 0x90000010, 0xf0000010, 0x90000008, 0xc0000000,
+        0x90000010, 0xf0000010, 0xb0000008, 0x40000000, 0x90000000,
+        0xf0000010, 0x90000018, 0x60000000, 0x90000010, 0x90000010,
+        0x90000000, 0x80000000, 0x00000010, 0xa0000000, 0x20000000,
+        0xa0000000, 0x20000010, 0x00000000, 0x20000010, 0x20000000,
+        0x00000010, 0x20000000, 0x00000010, 0xa0000000, 0x00000000,
+        0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000001, 0x00000020, 0x00000001,
+        0x40000002, 0x40000040, 0x40000002, 0x80000004, 0x80000080,
+        0x80000006, 0x00000049, 0x00000103, 0x80000009, 0x80000012,
+    } },
+  /* II(45,0) */
+  { 58, 53, UINT64_C (0x003d7ded57c00000),
+    {
+        0xec000014, 0x0c000002, 0xc0000010, 0xb400001c, 0x2c000004,
+        0xbc000018, 0xb0000010, 0x0000000c, 0xb8000010, 0x08000018,
+        0x78000010, 0x08000014, 0x70000010, 0xb800001c, 0xe8000000,
+        0xb0000004, 0x58000010, 0xb000000c, 0x48000000, 0xb0000000,
+        0xb8000010, 0x98000010, 0xa0000000, 0x00000000, 0x00000000,
+        0x20000000, 0x80000000, 0x00000010, 0x00000000, 0x20000010,
+        0x20000000, 0x00000010, 0x60000000, 0x00000018, 0xe0000000,
+        0x90000000, 0x30000010, 0xb0000000, 0x20000000, 0x20000000,
+        0xa0000000, 0x00000010, 0x80000000, 0x20000000, 0x20000000,
+        0x20000000, 0x80000000, 0x00000010, 0x00000000, 0x20000010,
+        0xa0000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000001, 0x00000020, 0x00000001, 0x40000002, 0x40000041,
+        0x40000022, 0x80000005, 0xc0000082, 0xc0000046, 0x4000004b,
+        0x80000107, 0x00000089, 0x00000014, 0x8000024b, 0x0000011b,
+        0x8000016d, 0x8000041a, 0x000002e4, 0x80000054, 0x00000967,
+    } },
+  /* II(46,0) */
+  { 58, 54, UINT64_C (0x003afbdaaf800000),
+    {
+        0x2400001c, 0xec000014, 0x0c000002, 0xc0000010, 0xb400001c,
+        0x2c000004, 0xbc000018, 0xb0000010, 0x0000000c, 0xb8000010,
+        0x08000018, 0x78000010, 0x08000014, 0x70000010, 0xb800001c,
+        0xe8000000, 0xb0000004, 0x58000010, 0xb000000c, 0x48000000,
+        0xb0000000, 0xb8000010, 0x98000010, 0xa0000000, 0x00000000,
+        0x00000000, 0x20000000, 0x80000000, 0x00000010, 0x00000000,
+        0x20000010, 0x20000000, 0x00000010, 0x60000000, 0x00000018,
+        0xe0000000, 0x90000000, 0x30000010, 0xb0000000, 0x20000000,
+        0x20000000, 0xa0000000, 0x00000010, 0x80000000, 0x20000000,
+        0x20000000, 0x20000000, 0x80000000, 0x00000010, 0x00000000,
+        0x20000010, 0xa0000000, 0x00000000, 0x20000000, 0x20000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000001, 0x00000020, 0x00000001, 0x40000002,
+        0x40000041, 0x40000022, 0x80000005, 0xc0000082, 0xc0000046,
+        0x4000004b, 0x80000107, 0x00000089, 0x00000014, 0x8000024b,
+        0x0000011b, 0x8000016d, 0x8000041a, 0x000002e4, 0x80000054,
+    } },
+  /* II(46,2) */
+  { 58, 54, UINT64_C (0x003afbdaaf800000),
+    {
+        0x90000070, 0xb0000053, 0x30000008, 0x00000043, 0xd0000072,
+        0xb0000010, 0xf0000062, 0xc0000042, 0x00000030, 0xe0000042,
+        0x20000060, 0xe0000041, 0x20000050, 0xc0000041, 0xe0000072,
+        0xa0000003, 0xc0000012, 0x60000041, 0xc0000032, 0x20000001,
+        0xc0000002, 0xe0000042, 0x60000042, 0x80000002, 0x00000000,
+        0x00000000, 0x80000000, 0x00000002, 0x00000040, 0x00000000,
+        0x80000040, 0x80000000, 0x00000040, 0x80000001, 0x00000060,
+        0x80000003, 0x40000002, 0xc0000040, 0xc0000002, 0x80000000,
+        0x80000000, 0x80000002, 0x00000040, 0x00000002, 0x80000000,
+        0x80000000, 0x80000000, 0x00000002, 0x00000040, 0x00000000,
+        0x80000040, 0x80000002, 0x00000000, 0x80000000, 0x80000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000004, 0x00000080, 0x00000004, 0x00000009,
+        0x00000105, 0x00000089, 0x00000016, 0x0000020b, 0x0000011b,
+        0x0000012d, 0x0000041e, 0x00000224, 0x00000050, 0x0000092e,
+        0x0000046c, 0x000005b6, 0x0000106a, 0x00000b90, 0x00000152,
+    } },
+  /* II(47,0) */
+  { 58, 55, UINT64_C (0x0035f7b55f200000),
+    {
+        0x20000010, 0x2400001c, 0xec000014, 0x0c000002, 0xc0000010,
+        0xb400001c, 0x2c000004, 0xbc000018, 0xb0000010, 0x0000000c,
+        0xb8000010, 0x08000018, 0x78000010, 0x08000014, 0x70000010,
+        0xb800001c, 0xe8000000, 0xb0000004, 0x58000010, 0xb000000c,
+        0x48000000, 0xb0000000, 0xb8000010, 0x98000010, 0xa0000000,
+        0x00000000, 0x00000000, 0x20000000, 0x80000000, 0x00000010,
+        0x00000000, 0x20000010, 0x20000000, 0x00000010, 0x60000000,
+        0x00000018, 0xe0000000, 0x90000000, 0x30000010, 0xb0000000,
+        0x20000000, 0x20000000, 0xa0000000, 0x00000010, 0x80000000,
+        0x20000000, 0x20000000, 0x20000000, 0x80000000, 0x00000010,
+        0x00000000, 0x20000010, 0xa0000000, 0x00000000, 0x20000000,
+        0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000001, 0x00000020, 0x00000001,
+        0x40000002, 0x40000041, 0x40000022, 0x80000005, 0xc0000082,
+        0xc0000046, 0x4000004b, 0x80000107, 0x00000089, 0x00000014,
+        0x8000024b, 0x0000011b, 0x8000016d, 0x8000041a, 0x000002e4,
+    } },
+  /* II(48,0) */
+  { 58, 56, UINT64_C (0x002bef6abe600000),
+    {
+        0xbc00001a, 0x20000010, 0x2400001c, 0xec000014, 0x0c000002,
+        0xc0000010, 0xb400001c, 0x2c000004, 0xbc000018, 0xb0000010,
+        0x0000000c, 0xb8000010, 0x08000018, 0x78000010, 0x08000014,
+        0x70000010, 0xb800001c, 0xe8000000, 0xb0000004, 0x58000010,
+        0xb000000c, 0x48000000, 0xb0000000, 0xb8000010, 0x98000010,
+        0xa0000000, 0x00000000, 0x00000000, 0x20000000, 0x80000000,
+        0x00000010, 0x00000000, 0x20000010, 0x20000000, 0x00000010,
+        0x60000000, 0x00000018, 0xe0000000, 0x90000000, 0x30000010,
+        0xb0000000, 0x20000000, 0x20000000, 0xa0000000, 0x00000010,
+        0x80000000, 0x20000000, 0x20000000, 0x20000000, 0x80000000,
+        0x00000010, 0x00000000, 0x20000010, 0xa0000000, 0x00000000,
+        0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000020,
+        0x00000001, 0x40000002, 0x40000041, 0x40000022, 0x80000005,
+        0xc0000082, 0xc0000046, 0x4000004b, 0x80000107, 0x00000089,
+        0x00000014, 0x8000024b, 0x0000011b, 0x8000016d, 0x8000041a,
+    } },
+  /* II(49,0) */
+  { 58, 57, UINT64_C (0x0017ded57cc00000),
+    {
+        0x3c000004, 0xbc00001a, 0x20000010, 0x2400001c, 0xec000014,
+        0x0c000002, 0xc0000010, 0xb400001c, 0x2c000004, 0xbc000018,
+        0xb0000010, 0x0000000c, 0xb8000010, 0x08000018, 0x78000010,
+        0x08000014, 0x70000010, 0xb800001c, 0xe8000000, 0xb0000004,
+        0x58000010, 0xb000000c, 0x48000000, 0xb0000000, 0xb8000010,
+        0x98000010, 0xa0000000, 0x00000000, 0x00000000, 0x20000000,
+        0x80000000, 0x00000010, 0x00000000, 0x20000010, 0x20000000,
+        0x00000010, 0x60000000, 0x00000018, 0xe0000000, 0x90000000,
+        0x30000010, 0xb0000000, 0x20000000, 0x20000000, 0xa0000000,
+        0x00000010, 0x80000000, 0x20000000, 0x20000000, 0x20000000,
+        0x80000000, 0x00000010, 0x00000000, 0x20000010, 0xa0000000,
+        0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+        0x00000020, 0x00000001, 0x40000002, 0x40000041, 0x40000022,
+        0x80000005, 0xc0000082, 0xc0000046, 0x4000004b, 0x80000107,
+        0x00000089, 0x00000014, 0x8000024b, 0x0000011b, 0x8000016d,
+    } },
+  /* II(49,2) */
+  { 58, 57, UINT64_C (0x0017ded57cc00000),
+    {
+        0xf0000010, 0xf000006a, 0x80000040, 0x90000070, 0xb0000053,
+        0x30000008, 0x00000043, 0xd0000072, 0xb0000010, 0xf0000062,
+        0xc0000042, 0x00000030, 0xe0000042, 0x20000060, 0xe0000041,
+        0x20000050, 0xc0000041, 0xe0000072, 0xa0000003, 0xc0000012,
+        0x60000041, 0xc0000032, 0x20000001, 0xc0000002, 0xe0000042,
+        0x60000042, 0x80000002, 0x00000000, 0x00000000, 0x80000000,
+        0x00000002, 0x00000040, 0x00000000, 0x80000040, 0x80000000,
+        0x00000040, 0x80000001, 0x00000060, 0x80000003, 0x40000002,
+        0xc0000040, 0xc0000002, 0x80000000, 0x80000000, 0x80000002,
+        0x00000040, 0x00000002, 0x80000000, 0x80000000, 0x80000000,
+        0x00000002, 0x00000040, 0x00000000, 0x80000040, 0x80000002,
+        0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004,
+        0x00000080, 0x00000004, 0x00000009, 0x00000105, 0x00000089,
+        0x00000016, 0x0000020b, 0x0000011b, 0x0000012d, 0x0000041e,
+        0x00000224, 0x00000050, 0x0000092e, 0x0000046c, 0x000005b6,
+    } },
+  /* II(50,0) */
+  { 65, 58, UINT64_C (0x1fafbdaaf9800000),
+    {
+        0xb400001c, 0x3c000004, 0xbc00001a, 0x20000010, 0x2400001c,
+        0xec000014, 0x0c000002, 0xc0000010, 0xb400001c, 0x2c000004,
+        0xbc000018, 0xb0000010, 0x0000000c, 0xb8000010, 0x08000018,
+        0x78000010, 0x08000014, 0x70000010, 0xb800001c, 0xe8000000,
+        0xb0000004, 0x58000010, 0xb000000c, 0x48000000, 0xb0000000,
+        0xb8000010, 0x98000010, 0xa0000000, 0x00000000, 0x00000000,
+        0x20000000, 0x80000000, 0x00000010, 0x00000000, 0x20000010,
+        0x20000000, 0x00000010, 0x60000000, 0x00000018, 0xe0000000,
+        0x90000000, 0x30000010, 0xb0000000, 0x20000000, 0x20000000,
+        0xa0000000, 0x00000010, 0x80000000, 0x20000000, 0x20000000,
+        0x20000000, 0x80000000, 0x00000010, 0x00000000, 0x20000010,
+        0xa0000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000001, 0x00000020, 0x00000001, 0x40000002, 0x40000041,
+        0x40000022, 0x80000005, 0xc0000082, 0xc0000046, 0x4000004b,
+        0x80000107, 0x00000089, 0x00000014, 0x8000024b, 0x0000011b,
+    } },
+  /* II(50,2) */
+  { 65, 58, UINT64_C (0x1fafbdaaf9800000),
+    {
+        0xd0000072, 0xf0000010, 0xf000006a, 0x80000040, 0x90000070,
+        0xb0000053, 0x30000008, 0x00000043, 0xd0000072, 0xb0000010,
+        0xf0000062, 0xc0000042, 0x00000030, 0xe0000042, 0x20000060,
+        0xe0000041, 0x20000050, 0xc0000041, 0xe0000072, 0xa0000003,
+        0xc0000012, 0x60000041, 0xc0000032, 0x20000001, 0xc0000002,
+        0xe0000042, 0x60000042, 0x80000002, 0x00000000, 0x00000000,
+        0x80000000, 0x00000002, 0x00000040, 0x00000000, 0x80000040,
+        0x80000000, 0x00000040, 0x80000001, 0x00000060, 0x80000003,
+        0x40000002, 0xc0000040, 0xc0000002, 0x80000000, 0x80000000,
+        0x80000002, 0x00000040, 0x00000002, 0x80000000, 0x80000000,
+        0x80000000, 0x00000002, 0x00000040, 0x00000000, 0x80000040,
+        0x80000002, 0x00000000, 0x80000000, 0x80000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000004, 0x00000080, 0x00000004, 0x00000009, 0x00000105,
+        0x00000089, 0x00000016, 0x0000020b, 0x0000011b, 0x0000012d,
+        0x0000041e, 0x00000224, 0x00000050, 0x0000092e, 0x0000046c,
+    } },
+  /* II(51,0) */
+  { 65, 59, UINT64_C (0x1f5f7b55f3000000),
+    {
+        0xc0000010, 0xb400001c, 0x3c000004, 0xbc00001a, 0x20000010,
+        0x2400001c, 0xec000014, 0x0c000002, 0xc0000010, 0xb400001c,
+        0x2c000004, 0xbc000018, 0xb0000010, 0x0000000c, 0xb8000010,
+        0x08000018, 0x78000010, 0x08000014, 0x70000010, 0xb800001c,
+        0xe8000000, 0xb0000004, 0x58000010, 0xb000000c, 0x48000000,
+        0xb0000000, 0xb8000010, 0x98000010, 0xa0000000, 0x00000000,
+        0x00000000, 0x20000000, 0x80000000, 0x00000010, 0x00000000,
+        0x20000010, 0x20000000, 0x00000010, 0x60000000, 0x00000018,
+        0xe0000000, 0x90000000, 0x30000010, 0xb0000000, 0x20000000,
+        0x20000000, 0xa0000000, 0x00000010, 0x80000000, 0x20000000,
+        0x20000000, 0x20000000, 0x80000000, 0x00000010, 0x00000000,
+        0x20000010, 0xa0000000, 0x00000000, 0x20000000, 0x20000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000001, 0x00000020, 0x00000001, 0x40000002,
+        0x40000041, 0x40000022, 0x80000005, 0xc0000082, 0xc0000046,
+        0x4000004b, 0x80000107, 0x00000089, 0x00000014, 0x8000024b,
+    } },
+  /* II(51,2) */
+  { 65, 59, UINT64_C (0x1f5f7b55f3000000),
+    {
+        0x00000043, 0xd0000072, 0xf0000010, 0xf000006a, 0x80000040,
+        0x90000070, 0xb0000053, 0x30000008, 0x00000043, 0xd0000072,
+        0xb0000010, 0xf0000062, 0xc0000042, 0x00000030, 0xe0000042,
+        0x20000060, 0xe0000041, 0x20000050, 0xc0000041, 0xe0000072,
+        0xa0000003, 0xc0000012, 0x60000041, 0xc0000032, 0x20000001,
+        0xc0000002, 0xe0000042, 0x60000042, 0x80000002, 0x00000000,
+        0x00000000, 0x80000000, 0x00000002, 0x00000040, 0x00000000,
+        0x80000040, 0x80000000, 0x00000040, 0x80000001, 0x00000060,
+        0x80000003, 0x40000002, 0xc0000040, 0xc0000002, 0x80000000,
+        0x80000000, 0x80000002, 0x00000040, 0x00000002, 0x80000000,
+        0x80000000, 0x80000000, 0x00000002, 0x00000040, 0x00000000,
+        0x80000040, 0x80000002, 0x00000000, 0x80000000, 0x80000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000004, 0x00000080, 0x00000004, 0x00000009,
+        0x00000105, 0x00000089, 0x00000016, 0x0000020b, 0x0000011b,
+        0x0000012d, 0x0000041e, 0x00000224, 0x00000050, 0x0000092e,
+    } },
+  /* II(52,0) */
+  { 65, 60, UINT64_C (0x1ebef6abe6200000),
+    {
+        0x0c000002, 0xc0000010, 0xb400001c, 0x3c000004, 0xbc00001a,
+        0x20000010, 0x2400001c, 0xec000014, 0x0c000002, 0xc0000010,
+        0xb400001c, 0x2c000004, 0xbc000018, 0xb0000010, 0x0000000c,
+        0xb8000010, 0x08000018, 0x78000010, 0x08000014, 0x70000010,
+        0xb800001c, 0xe8000000, 0xb0000004, 0x58000010, 0xb000000c,
+        0x48000000, 0xb0000000, 0xb8000010, 0x98000010, 0xa0000000,
+        0x00000000, 0x00000000, 0x20000000, 0x80000000, 0x00000010,
+        0x00000000, 0x20000010, 0x20000000, 0x00000010, 0x60000000,
+        0x00000018, 0xe0000000, 0x90000000, 0x30000010, 0xb0000000,
+        0x20000000, 0x20000000, 0xa0000000, 0x00000010, 0x80000000,
+        0x20000000, 0x20000000, 0x20000000, 0x80000000, 0x00000010,
+        0x00000000, 0x20000010, 0xa0000000, 0x00000000, 0x20000000,
+        0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000001, 0x00000020, 0x00000001,
+        0x40000002, 0x40000041, 0x40000022, 0x80000005, 0xc0000082,
+        0xc0000046, 0x4000004b, 0x80000107, 0x00000089, 0x00000014,
+    } },
+  /* II(53,0) */
+  { 65, 61, UINT64_C (0x1d7ded57cc400000),
+    {
+        0xcc000014, 0x0c000002, 0xc0000010, 0xb400001c, 0x3c000004,
+        0xbc00001a, 0x20000010, 0x2400001c, 0xec000014, 0x0c000002,
+        0xc0000010, 0xb400001c, 0x2c000004, 0xbc000018, 0xb0000010,
+        0x0000000c, 0xb8000010, 0x08000018, 0x78000010, 0x08000014,
+        0x70000010, 0xb800001c, 0xe8000000, 0xb0000004, 0x58000010,
+        0xb000000c, 0x48000000, 0xb0000000, 0xb8000010, 0x98000010,
+        0xa0000000, 0x00000000, 0x00000000, 0x20000000, 0x80000000,
+        0x00000010, 0x00000000, 0x20000010, 0x20000000, 0x00000010,
+        0x60000000, 0x00000018, 0xe0000000, 0x90000000, 0x30000010,
+        0xb0000000, 0x20000000, 0x20000000, 0xa0000000, 0x00000010,
+        0x80000000, 0x20000000, 0x20000000, 0x20000000, 0x80000000,
+        0x00000010, 0x00000000, 0x20000010, 0xa0000000, 0x00000000,
+        0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000020,
+        0x00000001, 0x40000002, 0x40000041, 0x40000022, 0x80000005,
+        0xc0000082, 0xc0000046, 0x4000004b, 0x80000107, 0x00000089,
+    } },
+  /* II(54,0) */
+  { 65, 62, UINT64_C (0x1afbdaaf98800000),
+    {
+        0x0400001c, 0xcc000014, 0x0c000002, 0xc0000010, 0xb400001c,
+        0x3c000004, 0xbc00001a, 0x20000010, 0x2400001c, 0xec000014,
+        0x0c000002, 0xc0000010, 0xb400001c, 0x2c000004, 0xbc000018,
+        0xb0000010, 0x0000000c, 0xb8000010, 0x08000018, 0x78000010,
+        0x08000014, 0x70000010, 0xb800001c, 0xe8000000, 0xb0000004,
+        0x58000010, 0xb000000c, 0x48000000, 0xb0000000, 0xb8000010,
+        0x98000010, 0xa0000000, 0x00000000, 0x00000000, 0x20000000,
+        0x80000000, 0x00000010, 0x00000000, 0x20000010, 0x20000000,
+        0x00000010, 0x60000000, 0x00000018, 0xe0000000, 0x90000000,
+        0x30000010, 0xb0000000, 0x20000000, 0x20000000, 0xa0000000,
+        0x00000010, 0x80000000, 0x20000000, 0x20000000, 0x20000000,
+        0x80000000, 0x00000010, 0x00000000, 0x20000010, 0xa0000000,
+        0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+        0x00000020, 0x00000001, 0x40000002, 0x40000041, 0x40000022,
+        0x80000005, 0xc0000082, 0xc0000046, 0x4000004b, 0x80000107,
+    } },
+  /* II(55,0) */
+  { 65, 63, UINT64_C (0x15f7b55f31000000),
+    {
+        0x00000010, 0x0400001c, 0xcc000014, 0x0c000002, 0xc0000010,
+        0xb400001c, 0x3c000004, 0xbc00001a, 0x20000010, 0x2400001c,
+        0xec000014, 0x0c000002, 0xc0000010, 0xb400001c, 0x2c000004,
+        0xbc000018, 0xb0000010, 0x0000000c, 0xb8000010, 0x08000018,
+        0x78000010, 0x08000014, 0x70000010, 0xb800001c, 0xe8000000,
+        0xb0000004, 0x58000010, 0xb000000c, 0x48000000, 0xb0000000,
+        0xb8000010, 0x98000010, 0xa0000000, 0x00000000, 0x00000000,
+        0x20000000, 0x80000000, 0x00000010, 0x00000000, 0x20000010,
+        0x20000000, 0x00000010, 0x60000000, 0x00000018, 0xe0000000,
+        0x90000000, 0x30000010, 0xb0000000, 0x20000000, 0x20000000,
+        0xa0000000, 0x00000010, 0x80000000, 0x20000000, 0x20000000,
+        0x20000000, 0x80000000, 0x00000010, 0x00000000, 0x20000010,
+        0xa0000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000001, 0x00000020, 0x00000001, 0x40000002, 0x40000041,
+        0x40000022, 0x80000005, 0xc0000082, 0xc0000046, 0x4000004b,
+    } },
+  /* II(56,0) */
+  { 65, 64, UINT64_C (0x0bef6abe62000000),
+    {
+        0x2600001a, 0x00000010, 0x0400001c, 0xcc000014, 0x0c000002,
+        0xc0000010, 0xb400001c, 0x3c000004, 0xbc00001a, 0x20000010,
+        0x2400001c, 0xec000014, 0x0c000002, 0xc0000010, 0xb400001c,
+        0x2c000004, 0xbc000018, 0xb0000010, 0x0000000c, 0xb8000010,
+        0x08000018, 0x78000010, 0x08000014, 0x70000010, 0xb800001c,
+        0xe8000000, 0xb0000004, 0x58000010, 0xb000000c, 0x48000000,
+        0xb0000000, 0xb8000010, 0x98000010, 0xa0000000, 0x00000000,
+        0x00000000, 0x20000000, 0x80000000, 0x00000010, 0x00000000,
+        0x20000010, 0x20000000, 0x00000010, 0x60000000, 0x00000018,
+        0xe0000000, 0x90000000, 0x30000010, 0xb0000000, 0x20000000,
+        0x20000000, 0xa0000000, 0x00000010, 0x80000000, 0x20000000,
+        0x20000000, 0x20000000, 0x80000000, 0x00000010, 0x00000000,
+        0x20000010, 0xa0000000, 0x00000000, 0x20000000, 0x20000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000001, 0x00000020, 0x00000001, 0x40000002,
+        0x40000041, 0x40000022, 0x80000005, 0xc0000082, 0xc0000046,
+    } },
+};
+
+/* Boolean function of step i plus its constant. */
+static inline uint32_t
+sha1dc_fk (unsigned int i, uint32_t b, uint32_t c, uint32_t d)
+{
+  if (i < 20)
+    return F1 (b, c, d) + K1;
+  if (i < 40)
+    return F2 (b, c, d) + K2;
+  if (i < 60)
+    return F3 (b, c, d) + K3;
+  return F4 (b, c, d) + K4;
+}
+
+#define STEP(q, i, f, k, w)                                                   \
+  (Q (q, (i) + 1) = rotl32 (Q (q, i), 5)                                      \
+                    + f (Q (q, (i) - 1), rotl32 (Q (q, (i) - 2), 30),         \
+                         rotl32 (Q (q, (i) - 3), 30))                         \
+                    + rotl32 (Q (q, (i) - 4), 30) + (k) + (w))
+
+/*
+ * Checks whether the block with expanded message w, intermediate values q
+ * and output ihv collides with the sibling block of the disturbance vector.
+ */
+static int
+sha1dc_check (const struct sha1dc_dv *dv, const uint32_t *w,
+              const uint32_t *q, const uint32_t *ihv)
+{
+  uint32_t qq[85];
+  uint32_t ihvin[5], x;
+  int i;
+
+  /* Up to the first message difference the sibling matches our block. */
+  for (i = dv->start - 3; i <= dv->start + 1; ++i)
+    Q (qq, i) = Q (q, i);
+
+  for (i = dv->start; i >= 0; --i)
+    {
+      x = Q (qq, i + 1) - rotl32 (Q (qq, i), 5)
+          - sha1dc_fk ((unsigned int)i, Q (qq, i - 1),
+                      rotl32 (Q (qq, i - 2), 30), rotl32 (Q (qq, i - 3), 30))
+          - (w[i] ^ dv->dm[i]);
+      Q (qq, i - 4) = rotr32 (x, 30);
+      if (i >= 4 && ((dv->checks >> (i - 4)) & 1) != 0
+          && Q (qq, i - 4) != Q (q, i - 4))
+        return 0;
+    }
+
+  ihvin[0] = Q (qq, 0);
+  ihvin[1] = Q (qq, -1);
+  ihvin[2] = rotl32 (Q (qq, -2), 30);
+  ihvin[3] = rotl32 (Q (qq, -3), 30);
+  ihvin[4] = rotl32 (Q (qq, -4), 30);
+
+  for (i = dv->t - 4; i <= dv->t; ++i)
+    Q (qq, i) = Q (q, i);
+  for (i = dv->t; i < 80; ++i)
+    Q (qq, i + 1) = rotl32 (Q (qq, i), 5)
+                    + sha1dc_fk ((unsigned int)i, Q (qq, i - 1),
+                                rotl32 (Q (qq, i - 2), 30),
+                                rotl32 (Q (qq, i - 3), 30))
+                    + rotl32 (Q (qq, i - 4), 30) + (w[i] ^ dv->dm[i]);
+
+  return ihvin[0] + Q (qq, 80) == ihv[0] && ihvin[1] + Q (qq, 79) == ihv[1]
+         && ihvin[2] + rotl32 (Q (qq, 78), 30) == ihv[2]
+         && ihvin[3] + rotl32 (Q (qq, 77), 30) == ihv[3]
+         && ihvin[4] + rotl32 (Q (qq, 76), 30) == ihv[4];
+}
+
+static void
+sha1dc_compress_block (struct sha1dc_ctx *ctx, const uint8_t *block)
+{
+  uint32_t w[80], q[85];
+  uint32_t *state = ctx->state;
+  size_t i;
+  int collision;
+
+  for (i = 0; i < 16; ++i)
+    w[i] = buff_get_be32 (block + i * 4);
+  for (i = 16; i < 80; ++i)
+    w[i] = rotl32 (w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+  Q (q, 0) = state[0];
+  Q (q, -1) = state[1];
+  Q (q, -2) = rotr32 (state[2], 30);
+  Q (q, -3) = rotr32 (state[3], 30);
+  Q (q, -4) = rotr32 (state[4], 30);
+
+  for (i = 0; i < 20; ++i)
+    STEP (q, i, F1, K1, w[i]);
+  for (i = 20; i < 40; ++i)
+    STEP (q, i, F2, K2, w[i]);
+  for (i = 40; i < 60; ++i)
+    STEP (q, i, F3, K3, w[i]);
+  for (i = 60; i < 80; ++i)
+    STEP (q, i, F4, K4, w[i]);
+
+  state[0] += Q (q, 80);
+  state[1] += Q (q, 79);
+  state[2] += rotl32 (Q (q, 78), 30);
+  state[3] += rotl32 (Q (q, 77), 30);
+  state[4] += rotl32 (Q (q, 76), 30);
+
+  collision = 0;
+  for (i = 0; i < sizeof (sha1dc_dvs) / sizeof (sha1dc_dvs[0]); ++i)
+    if (sha1dc_check (&sha1dc_dvs[i], w, q, state))
+      collision = 1;
+
+  if (collision)
+    {
+      ctx->collision = 1;
+      if (ctx->safe_hash)
+        {
+          sha1_transform (state, block);
+          sha1_transform (state, block);
+        }
+    }
+}
+
+/* Adapts the block function to the shared buffering in fcrypt_md.h. */
+static void
+sha1dc_compress (void *ctx, const uint8_t *blocks, size_t nblocks)
+{
+  for (; nblocks > 0; --nblocks, blocks += SHA1_BLOCK_SIZE)
+    sha1dc_compress_block (ctx, blocks);
+}
+
+void
+sha1dc_init (struct sha1dc_ctx *ctx)
+{
+  ctx->state[0] = 0x67452301;
+  ctx->state[1] = 0xefcdab89;
+  ctx->state[2] = 0x98badcfe;
+  ctx->state[3] = 0x10325476;
+  ctx->state[4] = 0xc3d2e1f0;
+  ctx->count = 0;
+  ctx->safe_hash = 1;
+  ctx->collision = 0;
+}
+
+void
+sha1dc_set_safe_hash (struct sha1dc_ctx *ctx, int safe_hash)
+{
+  ctx->safe_hash = safe_hash;
+}
+
+void
+sha1dc_update (struct sha1dc_ctx *ctx, const void *input, size_t inputlen)
+{
+  fcrypt_md_update (ctx, &ctx->count, ctx->buffer, sha1dc_compress, input,
+                    inputlen);
+}
+
+int
+sha1dc_final (uint8_t *digest, struct sha1dc_ctx *ctx)
+{
+  uint32_t i;
+  int collision;
+
+  fcrypt_md_final (ctx, ctx->count, ctx->buffer, sha1dc_compress, 0x80, 1);
+  for (i = 0; i < 5; ++i)
+    buff_put_be32 (digest + i * 4, ctx->state[i]);
+  collision = ctx->collision;
+  fcrypt_wipe (ctx, sizeof (*ctx));
+  return collision;
+}
+
+void
+sha1dc_copy (struct sha1dc_ctx *dst, const struct sha1dc_ctx *src)
+{
+  *dst = *src;
+}
+
+/* Hashes a whole message without buffering it through a context. */
+int
+sha1dc (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha1dc_ctx ctx;
+  uint32_t i;
+  int collision;
+
+  sha1dc_init (&ctx);
+  fcrypt_md_oneshot (&ctx, ctx.buffer, sha1dc_compress, 0x80, 1, input,
+                     inputlen);
+  for (i = 0; i < 5; ++i)
+    buff_put_be32 (digest + i * 4, ctx.state[i]);
+  collision = ctx.collision;
+  fcrypt_wipe (&ctx, sizeof (ctx));
+  return collision;
+}
@@ -0,0 +1,66 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef SHA1DC_H
+#define SHA1DC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha1.h"
+
+/*
+ * SHA-1 with counter-cryptanalysis collision detection, after Stevens and
+ * Shumow, "Speeding up detection of SHA-1 collision attacks using
+ * unavoidable attack conditions". The digest is the same as sha1 for every
+ * message that is not one half of a colliding pair built with one of the
+ * known disturbance vectors.
+ */
+struct sha1dc_ctx
+{
+  uint32_t state[5];               /* Hash state */
+  uint64_t count;                  /* Number of bits mod 2^64 */
+  uint8_t buffer[SHA1_BLOCK_SIZE]; /* Input buffer */
+  int safe_hash;                   /* Change the digest of collisions */
+  int collision;                   /* Set once a collision is detected */
+};
+
+void sha1dc_init (struct sha1dc_ctx *);
+
+/*
+ * With safe hashing, the default, blocks that complete a collision are
+ * compressed three times so the colliding messages get different digests.
+ * Disabling it only reports the collision from sha1dc_final.
+ */
+void sha1dc_set_safe_hash (struct sha1dc_ctx *, int);
+
+void sha1dc_update (struct sha1dc_ctx *, const void *, size_t);
+
+/* Returns nonzero if the message contained a collision attack. */
+int sha1dc_final (uint8_t *, struct sha1dc_ctx *);
+void sha1dc_copy (struct sha1dc_ctx *, const struct sha1dc_ctx *);
+int sha1dc (uint8_t *, const void *, size_t);
+
+#endif /* SHA1DC_H */
@@ -0,0 +1,116 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SHA-256 using the ARMv8 cryptography extensions. SHA256H and SHA256H2 do
+ * four rounds with the state kept as ABCD and EFGH, and SHA256SU0 and
+ * SHA256SU1 compute the message schedule four words at a time.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha256-internal.h"
+#include "sha256.h"
+
+#if defined(HAVE_ARM_SHA2_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define ARMV8_TARGET __attribute__ ((target (ARM_SHA2_TARGET_ATTRIBUTE)))
+
+/* Rounds 4 * j to 4 * j + 3 using the schedule words in m. */
+#define ARMV8_ROUNDS4(m, j)                                                   \
+  do                                                                          \
+    {                                                                         \
+      x = vaddq_u32 ((m), vld1q_u32 (&sha256_ktable[4 * (j)]));               \
+      t = state0;                                                             \
+      state0 = vsha256hq_u32 (state0, state1, x);                             \
+      state1 = vsha256h2q_u32 (state1, t, x);                                 \
+    }                                                                         \
+  while (0)
+
+/* Replaces the words in m0 with the ones needed 16 rounds later. */
+#define ARMV8_SCHEDULE(m0, m1, m2, m3)                                        \
+  ((m0) = vsha256su1q_u32 (vsha256su0q_u32 ((m0), (m1)), (m2), (m3)))
+
+ARMV8_TARGET static void
+sha256_compress_armv8 (uint32_t *state, const uint8_t *data, size_t blocks)
+{
+  uint32x4_t state0, state1, save0, save1, x, t;
+  uint32x4_t m0, m1, m2, m3;
+  unsigned int j;
+
+  state0 = vld1q_u32 (&state[0]);
+  state1 = vld1q_u32 (&state[4]);
+
+  for (; blocks > 0; --blocks)
+    {
+      save0 = state0;
+      save1 = state1;
+
+      m0 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data)));
+      m1 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data + 16)));
+      m2 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data + 32)));
+      m3 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (data + 48)));
+
+      for (j = 0; j < 12; j += 4)
+        {
+          ARMV8_ROUNDS4 (m0, j);
+          ARMV8_SCHEDULE (m0, m1, m2, m3);
+          ARMV8_ROUNDS4 (m1, j + 1);
+          ARMV8_SCHEDULE (m1, m2, m3, m0);
+          ARMV8_ROUNDS4 (m2, j + 2);
+          ARMV8_SCHEDULE (m2, m3, m0, m1);
+          ARMV8_ROUNDS4 (m3, j + 3);
+          ARMV8_SCHEDULE (m3, m0, m1, m2);
+        }
+      ARMV8_ROUNDS4 (m0, 12);
+      ARMV8_ROUNDS4 (m1, 13);
+      ARMV8_ROUNDS4 (m2, 14);
+      ARMV8_ROUNDS4 (m3, 15);
+
+      state0 = vaddq_u32 (state0, save0);
+      state1 = vaddq_u32 (state1, save1);
+      data += SHA256_BLOCK_SIZE;
+    }
+
+  vst1q_u32 (&state[0], state0);
+  vst1q_u32 (&state[4], state1);
+}
+
+const struct sha256_backend sha256_backend_armv8 = {
+  "armv8",
+  sha256_compress_armv8,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha256_armv8_unused;
+
+#endif /* HAVE_ARM_SHA2_INTRINSICS */
@@ -0,0 +1,203 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer SHA-256 with AVX2. Each 32-bit element of a vector belongs to
+ * a different message, so eight blocks from independent messages go through
+ * the rounds of FIPS 180-4 at the same time. The blocks are transposed into
+ * that form with an 8x8 transpose of 32-bit words on the way in.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha256-internal.h"
+#include "sha256.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_LANES 8
+
+#define AVX2_ROTR(x, n)                                                       \
+  _mm256_or_si256 (_mm256_srli_epi32 ((x), (n)),                              \
+                   _mm256_slli_epi32 ((x), 32 - (n)))
+#define AVX2_XOR3(a, b, c) _mm256_xor_si256 ((a), _mm256_xor_si256 ((b), (c)))
+
+#define AVX2_SIGMA0(x)                                                        \
+  AVX2_XOR3 (AVX2_ROTR ((x), 2), AVX2_ROTR ((x), 13), AVX2_ROTR ((x), 22))
+#define AVX2_SIGMA1(x)                                                        \
+  AVX2_XOR3 (AVX2_ROTR ((x), 6), AVX2_ROTR ((x), 11), AVX2_ROTR ((x), 25))
+#define AVX2_sigma0(x)                                                        \
+  AVX2_XOR3 (AVX2_ROTR ((x), 7), AVX2_ROTR ((x), 18),                         \
+             _mm256_srli_epi32 ((x), 3))
+#define AVX2_sigma1(x)                                                        \
+  AVX2_XOR3 (AVX2_ROTR ((x), 17), AVX2_ROTR ((x), 19),                        \
+             _mm256_srli_epi32 ((x), 10))
+
+/* Ch and Maj rewritten to need fewer instructions without ANDN. */
+#define AVX2_CH(e, f, g)                                                      \
+  _mm256_xor_si256 ((g), _mm256_and_si256 ((e), _mm256_xor_si256 ((f), (g))))
+#define AVX2_MAJ(a, b, c)                                                     \
+  _mm256_xor_si256 ((b), _mm256_and_si256 (_mm256_xor_si256 ((a), (b)),       \
+                                           _mm256_xor_si256 ((b), (c))))
+
+/* Extends the message schedule to word i, for i >= 16. */
+#define AVX2_SCHEDULE(i)                                                      \
+  (w[(i)&15] = _mm256_add_epi32 (                                             \
+       _mm256_add_epi32 (w[(i)&15], AVX2_sigma1 (w[((i)-2) & 15])),           \
+       _mm256_add_epi32 (w[((i)-7) & 15], AVX2_sigma0 (w[((i)-15) & 15]))))
+
+#define AVX2_ROUND(a, b, c, d, e, f, g, h, i)                                 \
+  do                                                                          \
+    {                                                                         \
+      __m256i t1_, t2_;                                                       \
+                                                                              \
+      t1_ = _mm256_add_epi32 (                                                \
+          _mm256_add_epi32 ((h), AVX2_SIGMA1 (e)),                            \
+          _mm256_add_epi32 (                                                  \
+              AVX2_CH ((e), (f), (g)),                                        \
+              _mm256_add_epi32 (_mm256_set1_epi32 ((int)sha256_ktable[(i)]),  \
+                                w[(i)&15])));                                 \
+      t2_ = _mm256_add_epi32 (AVX2_SIGMA0 (a), AVX2_MAJ ((a), (b), (c)));     \
+      (d) = _mm256_add_epi32 ((d), t1_);                                      \
+      (h) = _mm256_add_epi32 (t1_, t2_);                                      \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads words 0 to 7 or 8 to 15 of the eight blocks, at offset bytes into
+ * each, and stores the words of all lanes for index i in w[i].
+ */
+AVX2_TARGET static inline void
+avx2_load_transpose (__m256i *w, const uint8_t *const *blocks, size_t offset)
+{
+  const __m256i mask = _mm256_set_epi8 (
+      12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8,
+      9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  __m256i r[AVX2_LANES], t[AVX2_LANES], u[AVX2_LANES];
+  unsigned int l;
+
+  for (l = 0; l < AVX2_LANES; ++l)
+    r[l] = _mm256_shuffle_epi8 (
+        _mm256_loadu_si256 ((const __m256i *)(blocks[l] + offset)), mask);
+
+  for (l = 0; l < AVX2_LANES; l += 2)
+    {
+      t[l] = _mm256_unpacklo_epi32 (r[l], r[l + 1]);
+      t[l + 1] = _mm256_unpackhi_epi32 (r[l], r[l + 1]);
+    }
+  for (l = 0; l < AVX2_LANES; l += 4)
+    {
+      u[l] = _mm256_unpacklo_epi64 (t[l], t[l + 2]);
+      u[l + 1] = _mm256_unpackhi_epi64 (t[l], t[l + 2]);
+      u[l + 2] = _mm256_unpacklo_epi64 (t[l + 1], t[l + 3]);
+      u[l + 3] = _mm256_unpackhi_epi64 (t[l + 1], t[l + 3]);
+    }
+  for (l = 0; l < 4; ++l)
+    {
+      w[l] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x20);
+      w[l + 4] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x31);
+    }
+}
+
+AVX2_TARGET static void
+sha256_multi_compress_avx2 (uint32_t *state, const uint8_t *const *blocks)
+{
+  __m256i a, b, c, d, e, f, g, h;
+  __m256i w[16];
+  unsigned int i;
+
+  avx2_load_transpose (w, blocks, 0);
+  avx2_load_transpose (w + 8, blocks, 32);
+
+  a = _mm256_loadu_si256 ((const __m256i *)(state + 0 * AVX2_LANES));
+  b = _mm256_loadu_si256 ((const __m256i *)(state + 1 * AVX2_LANES));
+  c = _mm256_loadu_si256 ((const __m256i *)(state + 2 * AVX2_LANES));
+  d = _mm256_loadu_si256 ((const __m256i *)(state + 3 * AVX2_LANES));
+  e = _mm256_loadu_si256 ((const __m256i *)(state + 4 * AVX2_LANES));
+  f = _mm256_loadu_si256 ((const __m256i *)(state + 5 * AVX2_LANES));
+  g = _mm256_loadu_si256 ((const __m256i *)(state + 6 * AVX2_LANES));
+  h = _mm256_loadu_si256 ((const __m256i *)(state + 7 * AVX2_LANES));
+
+  for (i = 0; i < 64; i += 8)
+    {
+      if (i >= 16)
+        {
+          AVX2_SCHEDULE (i);
+          AVX2_SCHEDULE (i + 1);
+          AVX2_SCHEDULE (i + 2);
+          AVX2_SCHEDULE (i + 3);
+          AVX2_SCHEDULE (i + 4);
+          AVX2_SCHEDULE (i + 5);
+          AVX2_SCHEDULE (i + 6);
+          AVX2_SCHEDULE (i + 7);
+        }
+      AVX2_ROUND (a, b, c, d, e, f, g, h, i);
+      AVX2_ROUND (h, a, b, c, d, e, f, g, i + 1);
+      AVX2_ROUND (g, h, a, b, c, d, e, f, i + 2);
+      AVX2_ROUND (f, g, h, a, b, c, d, e, i + 3);
+      AVX2_ROUND (e, f, g, h, a, b, c, d, i + 4);
+      AVX2_ROUND (d, e, f, g, h, a, b, c, i + 5);
+      AVX2_ROUND (c, d, e, f, g, h, a, b, i + 6);
+      AVX2_ROUND (b, c, d, e, f, g, h, a, i + 7);
+    }
+
+#define AVX2_ADD_STATE(j, x)                                                  \
+  _mm256_storeu_si256 (                                                       \
+      (__m256i *)(state + (j) * AVX2_LANES),                                  \
+      _mm256_add_epi32 (                                                      \
+          (x), _mm256_loadu_si256 (                                           \
+                   (const __m256i *)(state + (j) * AVX2_LANES))))
+
+  AVX2_ADD_STATE (0, a);
+  AVX2_ADD_STATE (1, b);
+  AVX2_ADD_STATE (2, c);
+  AVX2_ADD_STATE (3, d);
+  AVX2_ADD_STATE (4, e);
+  AVX2_ADD_STATE (5, f);
+  AVX2_ADD_STATE (6, g);
+  AVX2_ADD_STATE (7, h);
+
+#undef AVX2_ADD_STATE
+}
+
+const struct sha256_multi_backend sha256_multi_backend_avx2 = {
+  "avx2",
+  AVX2_LANES,
+  sha256_multi_compress_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha256_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
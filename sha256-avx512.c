@@ -0,0 +1,200 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer SHA-256 with AVX-512, sixteen messages at a time. This is the
+ * same as sha256-avx2.c but VPRORD replaces the shift and OR pairs and
+ * VPTERNLOGD computes Ch, Maj and the three input XORs in one instruction.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha256-internal.h"
+#include "sha256.h"
+
+#if defined(HAVE_AVX512_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX512_TARGET __attribute__ ((target (AVX512_TARGET_ATTRIBUTE)))
+
+#define AVX512_LANES 16
+
+#define AVX512_XOR3(a, b, c) _mm512_ternarylogic_epi32 ((a), (b), (c), 0x96)
+#define AVX512_CH(e, f, g) _mm512_ternarylogic_epi32 ((e), (f), (g), 0xca)
+#define AVX512_MAJ(a, b, c) _mm512_ternarylogic_epi32 ((a), (b), (c), 0xe8)
+
+#define AVX512_SIGMA0(x)                                                      \
+  AVX512_XOR3 (_mm512_ror_epi32 ((x), 2), _mm512_ror_epi32 ((x), 13),         \
+               _mm512_ror_epi32 ((x), 22))
+#define AVX512_SIGMA1(x)                                                      \
+  AVX512_XOR3 (_mm512_ror_epi32 ((x), 6), _mm512_ror_epi32 ((x), 11),         \
+               _mm512_ror_epi32 ((x), 25))
+#define AVX512_sigma0(x)                                                      \
+  AVX512_XOR3 (_mm512_ror_epi32 ((x), 7), _mm512_ror_epi32 ((x), 18),         \
+               _mm512_srli_epi32 ((x), 3))
+#define AVX512_sigma1(x)                                                      \
+  AVX512_XOR3 (_mm512_ror_epi32 ((x), 17), _mm512_ror_epi32 ((x), 19),        \
+               _mm512_srli_epi32 ((x), 10))
+
+/* Extends the message schedule to word i, for i >= 16. */
+#define AVX512_SCHEDULE(i)                                                    \
+  (w[(i)&15] = _mm512_add_epi32 (                                             \
+       _mm512_add_epi32 (w[(i)&15], AVX512_sigma1 (w[((i)-2) & 15])),         \
+       _mm512_add_epi32 (w[((i)-7) & 15], AVX512_sigma0 (w[((i)-15) & 15]))))
+
+#define AVX512_ROUND(a, b, c, d, e, f, g, h, i)                               \
+  do                                                                          \
+    {                                                                         \
+      __m512i t1_, t2_;                                                       \
+                                                                              \
+      t1_ = _mm512_add_epi32 (                                                \
+          _mm512_add_epi32 ((h), AVX512_SIGMA1 (e)),                          \
+          _mm512_add_epi32 (                                                  \
+              AVX512_CH ((e), (f), (g)),                                      \
+              _mm512_add_epi32 (_mm512_set1_epi32 ((int)sha256_ktable[(i)]),  \
+                                w[(i)&15])));                                 \
+      t2_ = _mm512_add_epi32 (AVX512_SIGMA0 (a), AVX512_MAJ ((a), (b), (c))); \
+      (d) = _mm512_add_epi32 ((d), t1_);                                      \
+      (h) = _mm512_add_epi32 (t1_, t2_);                                      \
+    }                                                                         \
+  while (0)
+
+/*
+ * Loads words 0 to 7 or 8 to 15, at offset bytes into each block, of eight
+ * of the blocks and transposes them so that w[i] holds word i of each.
+ */
+AVX512_TARGET static inline void
+avx512_load_transpose8 (__m256i *w, const uint8_t *const *blocks,
+                        size_t offset)
+{
+  const __m256i mask = _mm256_set_epi8 (
+      12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8,
+      9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  __m256i r[8], t[8], u[8];
+  unsigned int l;
+
+  for (l = 0; l < 8; ++l)
+    r[l] = _mm256_shuffle_epi8 (
+        _mm256_loadu_si256 ((const __m256i *)(blocks[l] + offset)), mask);
+
+  for (l = 0; l < 8; l += 2)
+    {
+      t[l] = _mm256_unpacklo_epi32 (r[l], r[l + 1]);
+      t[l + 1] = _mm256_unpackhi_epi32 (r[l], r[l + 1]);
+    }
+  for (l = 0; l < 8; l += 4)
+    {
+      u[l] = _mm256_unpacklo_epi64 (t[l], t[l + 2]);
+      u[l + 1] = _mm256_unpackhi_epi64 (t[l], t[l + 2]);
+      u[l + 2] = _mm256_unpacklo_epi64 (t[l + 1], t[l + 3]);
+      u[l + 3] = _mm256_unpackhi_epi64 (t[l + 1], t[l + 3]);
+    }
+  for (l = 0; l < 4; ++l)
+    {
+      w[l] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x20);
+      w[l + 4] = _mm256_permute2x128_si256 (u[l], u[l + 4], 0x31);
+    }
+}
+
+AVX512_TARGET static void
+sha256_multi_compress_avx512 (uint32_t *state, const uint8_t *const *blocks)
+{
+  __m512i a, b, c, d, e, f, g, h;
+  __m512i w[16];
+  __m256i lo[16], hi[16];
+  unsigned int i;
+
+  avx512_load_transpose8 (lo, blocks, 0);
+  avx512_load_transpose8 (lo + 8, blocks, 32);
+  avx512_load_transpose8 (hi, blocks + 8, 0);
+  avx512_load_transpose8 (hi + 8, blocks + 8, 32);
+  for (i = 0; i < 16; ++i)
+    w[i] = _mm512_inserti64x4 (_mm512_castsi256_si512 (lo[i]), hi[i], 1);
+
+  a = _mm512_loadu_si512 (state + 0 * AVX512_LANES);
+  b = _mm512_loadu_si512 (state + 1 * AVX512_LANES);
+  c = _mm512_loadu_si512 (state + 2 * AVX512_LANES);
+  d = _mm512_loadu_si512 (state + 3 * AVX512_LANES);
+  e = _mm512_loadu_si512 (state + 4 * AVX512_LANES);
+  f = _mm512_loadu_si512 (state + 5 * AVX512_LANES);
+  g = _mm512_loadu_si512 (state + 6 * AVX512_LANES);
+  h = _mm512_loadu_si512 (state + 7 * AVX512_LANES);
+
+  for (i = 0; i < 64; i += 8)
+    {
+      if (i >= 16)
+        {
+          AVX512_SCHEDULE (i);
+          AVX512_SCHEDULE (i + 1);
+          AVX512_SCHEDULE (i + 2);
+          AVX512_SCHEDULE (i + 3);
+          AVX512_SCHEDULE (i + 4);
+          AVX512_SCHEDULE (i + 5);
+          AVX512_SCHEDULE (i + 6);
+          AVX512_SCHEDULE (i + 7);
+        }
+      AVX512_ROUND (a, b, c, d, e, f, g, h, i);
+      AVX512_ROUND (h, a, b, c, d, e, f, g, i + 1);
+      AVX512_ROUND (g, h, a, b, c, d, e, f, i + 2);
+      AVX512_ROUND (f, g, h, a, b, c, d, e, i + 3);
+      AVX512_ROUND (e, f, g, h, a, b, c, d, i + 4);
+      AVX512_ROUND (d, e, f, g, h, a, b, c, i + 5);
+      AVX512_ROUND (c, d, e, f, g, h, a, b, i + 6);
+      AVX512_ROUND (b, c, d, e, f, g, h, a, i + 7);
+    }
+
+#define AVX512_ADD_STATE(j, x)                                                \
+  _mm512_storeu_si512 (                                                       \
+      state + (j) * AVX512_LANES,                                             \
+      _mm512_add_epi32 ((x), _mm512_loadu_si512 (state + (j) * AVX512_LANES)))
+
+  AVX512_ADD_STATE (0, a);
+  AVX512_ADD_STATE (1, b);
+  AVX512_ADD_STATE (2, c);
+  AVX512_ADD_STATE (3, d);
+  AVX512_ADD_STATE (4, e);
+  AVX512_ADD_STATE (5, f);
+  AVX512_ADD_STATE (6, g);
+  AVX512_ADD_STATE (7, h);
+
+#undef AVX512_ADD_STATE
+}
+
+const struct sha256_multi_backend sha256_multi_backend_avx512 = {
+  "avx512",
+  AVX512_LANES,
+  sha256_multi_compress_avx512,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha256_avx512_unused;
+
+#endif /* HAVE_AVX512_INTRINSICS */
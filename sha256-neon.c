@@ -0,0 +1,175 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Multi-buffer SHA-256 with NEON, four messages at a time. This is the same
+ * as sha256-avx2.c with 128-bit vectors, using SRI to build the rotations.
+ * It is only chosen on processors without the SHA2 instructions.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha256-internal.h"
+#include "sha256.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_LANES 4
+
+#define NEON_ROTR(x, n) vsriq_n_u32 (vshlq_n_u32 ((x), 32 - (n)), (x), (n))
+#define NEON_XOR3(a, b, c) veorq_u32 ((a), veorq_u32 ((b), (c)))
+
+#define NEON_SIGMA0(x)                                                        \
+  NEON_XOR3 (NEON_ROTR ((x), 2), NEON_ROTR ((x), 13), NEON_ROTR ((x), 22))
+#define NEON_SIGMA1(x)                                                        \
+  NEON_XOR3 (NEON_ROTR ((x), 6), NEON_ROTR ((x), 11), NEON_ROTR ((x), 25))
+#define NEON_sigma0(x)                                                        \
+  NEON_XOR3 (NEON_ROTR ((x), 7), NEON_ROTR ((x), 18), vshrq_n_u32 ((x), 3))
+#define NEON_sigma1(x)                                                        \
+  NEON_XOR3 (NEON_ROTR ((x), 17), NEON_ROTR ((x), 19), vshrq_n_u32 ((x), 10))
+
+/* BSL selects bits from f where e is set and from g elsewhere. */
+#define NEON_CH(e, f, g) vbslq_u32 ((e), (f), (g))
+#define NEON_MAJ(a, b, c) vbslq_u32 (veorq_u32 ((a), (b)), (c), (b))
+
+/* Extends the message schedule to word i, for i >= 16. */
+#define NEON_SCHEDULE(i)                                                      \
+  (w[(i)&15] = vaddq_u32 (                                                    \
+       vaddq_u32 (w[(i)&15], NEON_sigma1 (w[((i)-2) & 15])),                  \
+       vaddq_u32 (w[((i)-7) & 15], NEON_sigma0 (w[((i)-15) & 15]))))
+
+#define NEON_ROUND(a, b, c, d, e, f, g, h, i)                                 \
+  do                                                                          \
+    {                                                                         \
+      uint32x4_t t1_, t2_;                                                    \
+                                                                              \
+      t1_ = vaddq_u32 (                                                       \
+          vaddq_u32 ((h), NEON_SIGMA1 (e)),                                   \
+          vaddq_u32 (NEON_CH ((e), (f), (g)),                                 \
+                     vaddq_u32 (vdupq_n_u32 (sha256_ktable[(i)]),             \
+                                w[(i)&15])));                                 \
+      t2_ = vaddq_u32 (NEON_SIGMA0 (a), NEON_MAJ ((a), (b), (c)));            \
+      (d) = vaddq_u32 ((d), t1_);                                             \
+      (h) = vaddq_u32 (t1_, t2_);                                             \
+    }                                                                         \
+  while (0)
+
+NEON_TARGET static void
+sha256_multi_compress_neon (uint32_t *state, const uint8_t *const *blocks)
+{
+  uint32x4_t a, b, c, d, e, f, g, h;
+  uint32x4_t w[16];
+  uint32x4_t r0, r1, r2, r3;
+  uint32x4x2_t t0, t1;
+  unsigned int i;
+
+  /* Transpose four words at a time from the four blocks. */
+  for (i = 0; i < 16; i += 4)
+    {
+      r0 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[0] + i * 4)));
+      r1 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[1] + i * 4)));
+      r2 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[2] + i * 4)));
+      r3 = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (blocks[3] + i * 4)));
+      t0 = vtrnq_u32 (r0, r1);
+      t1 = vtrnq_u32 (r2, r3);
+      w[i] = vcombine_u32 (vget_low_u32 (t0.val[0]),
+                           vget_low_u32 (t1.val[0]));
+      w[i + 1] = vcombine_u32 (vget_low_u32 (t0.val[1]),
+                               vget_low_u32 (t1.val[1]));
+      w[i + 2] = vcombine_u32 (vget_high_u32 (t0.val[0]),
+                               vget_high_u32 (t1.val[0]));
+      w[i + 3] = vcombine_u32 (vget_high_u32 (t0.val[1]),
+                               vget_high_u32 (t1.val[1]));
+    }
+
+  a = vld1q_u32 (state + 0 * NEON_LANES);
+  b = vld1q_u32 (state + 1 * NEON_LANES);
+  c = vld1q_u32 (state + 2 * NEON_LANES);
+  d = vld1q_u32 (state + 3 * NEON_LANES);
+  e = vld1q_u32 (state + 4 * NEON_LANES);
+  f = vld1q_u32 (state + 5 * NEON_LANES);
+  g = vld1q_u32 (state + 6 * NEON_LANES);
+  h = vld1q_u32 (state + 7 * NEON_LANES);
+
+  for (i = 0; i < 64; i += 8)
+    {
+      if (i >= 16)
+        {
+          NEON_SCHEDULE (i);
+          NEON_SCHEDULE (i + 1);
+          NEON_SCHEDULE (i + 2);
+          NEON_SCHEDULE (i + 3);
+          NEON_SCHEDULE (i + 4);
+          NEON_SCHEDULE (i + 5);
+          NEON_SCHEDULE (i + 6);
+          NEON_SCHEDULE (i + 7);
+        }
+      NEON_ROUND (a, b, c, d, e, f, g, h, i);
+      NEON_ROUND (h, a, b, c, d, e, f, g, i + 1);
+      NEON_ROUND (g, h, a, b, c, d, e, f, i + 2);
+      NEON_ROUND (f, g, h, a, b, c, d, e, i + 3);
+      NEON_ROUND (e, f, g, h, a, b, c, d, i + 4);
+      NEON_ROUND (d, e, f, g, h, a, b, c, i + 5);
+      NEON_ROUND (c, d, e, f, g, h, a, b, i + 6);
+      NEON_ROUND (b, c, d, e, f, g, h, a, i + 7);
+    }
+
+  vst1q_u32 (state + 0 * NEON_LANES,
+             vaddq_u32 (a, vld1q_u32 (state + 0 * NEON_LANES)));
+  vst1q_u32 (state + 1 * NEON_LANES,
+             vaddq_u32 (b, vld1q_u32 (state + 1 * NEON_LANES)));
+  vst1q_u32 (state + 2 * NEON_LANES,
+             vaddq_u32 (c, vld1q_u32 (state + 2 * NEON_LANES)));
+  vst1q_u32 (state + 3 * NEON_LANES,
+             vaddq_u32 (d, vld1q_u32 (state + 3 * NEON_LANES)));
+  vst1q_u32 (state + 4 * NEON_LANES,
+             vaddq_u32 (e, vld1q_u32 (state + 4 * NEON_LANES)));
+  vst1q_u32 (state + 5 * NEON_LANES,
+             vaddq_u32 (f, vld1q_u32 (state + 5 * NEON_LANES)));
+  vst1q_u32 (state + 6 * NEON_LANES,
+             vaddq_u32 (g, vld1q_u32 (state + 6 * NEON_LANES)));
+  vst1q_u32 (state + 7 * NEON_LANES,
+             vaddq_u32 (h, vld1q_u32 (state + 7 * NEON_LANES)));
+}
+
+const struct sha256_multi_backend sha256_multi_backend_neon = {
+  "neon",
+  NEON_LANES,
+  sha256_multi_compress_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha256_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
@@ -0,0 +1,164 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SHA-256 using the Intel SHA extensions. SHA256RNDS2 does two rounds and
+ * keeps the state as the ABEF and CDGH halves, so the state is shuffled
+ * into that form once per call. SHA256MSG1 and SHA256MSG2 compute the
+ * message schedule four words at a time.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha256-internal.h"
+#include "sha256.h"
+
+#if defined(HAVE_SHANI_INTRINSICS)
+
+#include <immintrin.h>
+
+#define SHANI_TARGET __attribute__ ((target (SHANI_TARGET_ATTRIBUTE)))
+
+/* Rounds 4 * j to 4 * j + 3 using the schedule words in m. */
+#define SHANI_ROUNDS4(m, j)                                                   \
+  do                                                                          \
+    {                                                                         \
+      x = _mm_add_epi32 (                                                     \
+          (m), _mm_loadu_si128 ((const __m128i *)&sha256_ktable[4 * (j)]));   \
+      state1 = _mm_sha256rnds2_epu32 (state1, state0, x);                     \
+      x = _mm_shuffle_epi32 (x, 0x0e);                                        \
+      state0 = _mm_sha256rnds2_epu32 (state0, state1, x);                     \
+    }                                                                         \
+  while (0)
+
+/* Finishes the next four schedule words in n from the current ones in m. */
+#define SHANI_SCHEDULE(n, m, p)                                               \
+  do                                                                          \
+    {                                                                         \
+      (n) = _mm_add_epi32 ((n), _mm_alignr_epi8 ((m), (p), 4));               \
+      (n) = _mm_sha256msg2_epu32 ((n), (m));                                  \
+    }                                                                         \
+  while (0)
+
+SHANI_TARGET static void
+sha256_compress_shani (uint32_t *state, const uint8_t *data, size_t blocks)
+{
+  const __m128i mask
+      = _mm_set_epi8 (12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  __m128i state0, state1, save0, save1, x;
+  __m128i m0, m1, m2, m3;
+
+  /* Rearrange ABCD and EFGH into ABEF and CDGH. */
+  x = _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *)&state[0]), 0xb1);
+  state1 = _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *)&state[4]),
+                              0x1b);
+  state0 = _mm_alignr_epi8 (x, state1, 8);
+  state1 = _mm_blend_epi16 (state1, x, 0xf0);
+
+  for (; blocks > 0; --blocks)
+    {
+      save0 = state0;
+      save1 = state1;
+
+      m0 = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *)data), mask);
+      m1 = _mm_shuffle_epi8 (
+          _mm_loadu_si128 ((const __m128i *)(data + 16)), mask);
+      m2 = _mm_shuffle_epi8 (
+          _mm_loadu_si128 ((const __m128i *)(data + 32)), mask);
+      m3 = _mm_shuffle_epi8 (
+          _mm_loadu_si128 ((const __m128i *)(data + 48)), mask);
+
+      SHANI_ROUNDS4 (m0, 0);
+      SHANI_ROUNDS4 (m1, 1);
+      m0 = _mm_sha256msg1_epu32 (m0, m1);
+      SHANI_ROUNDS4 (m2, 2);
+      m1 = _mm_sha256msg1_epu32 (m1, m2);
+      SHANI_ROUNDS4 (m3, 3);
+      SHANI_SCHEDULE (m0, m3, m2);
+      m2 = _mm_sha256msg1_epu32 (m2, m3);
+
+      SHANI_ROUNDS4 (m0, 4);
+      SHANI_SCHEDULE (m1, m0, m3);
+      m3 = _mm_sha256msg1_epu32 (m3, m0);
+      SHANI_ROUNDS4 (m1, 5);
+      SHANI_SCHEDULE (m2, m1, m0);
+      m0 = _mm_sha256msg1_epu32 (m0, m1);
+      SHANI_ROUNDS4 (m2, 6);
+      SHANI_SCHEDULE (m3, m2, m1);
+      m1 = _mm_sha256msg1_epu32 (m1, m2);
+      SHANI_ROUNDS4 (m3, 7);
+      SHANI_SCHEDULE (m0, m3, m2);
+      m2 = _mm_sha256msg1_epu32 (m2, m3);
+
+      SHANI_ROUNDS4 (m0, 8);
+      SHANI_SCHEDULE (m1, m0, m3);
+      m3 = _mm_sha256msg1_epu32 (m3, m0);
+      SHANI_ROUNDS4 (m1, 9);
+      SHANI_SCHEDULE (m2, m1, m0);
+      m0 = _mm_sha256msg1_epu32 (m0, m1);
+      SHANI_ROUNDS4 (m2, 10);
+      SHANI_SCHEDULE (m3, m2, m1);
+      m1 = _mm_sha256msg1_epu32 (m1, m2);
+      SHANI_ROUNDS4 (m3, 11);
+      SHANI_SCHEDULE (m0, m3, m2);
+      m2 = _mm_sha256msg1_epu32 (m2, m3);
+
+      SHANI_ROUNDS4 (m0, 12);
+      SHANI_SCHEDULE (m1, m0, m3);
+      m3 = _mm_sha256msg1_epu32 (m3, m0);
+      SHANI_ROUNDS4 (m1, 13);
+      SHANI_SCHEDULE (m2, m1, m0);
+      SHANI_ROUNDS4 (m2, 14);
+      SHANI_SCHEDULE (m3, m2, m1);
+      SHANI_ROUNDS4 (m3, 15);
+
+      state0 = _mm_add_epi32 (state0, save0);
+      state1 = _mm_add_epi32 (state1, save1);
+      data += SHA256_BLOCK_SIZE;
+    }
+
+  /* Back to ABCD and EFGH. */
+  x = _mm_shuffle_epi32 (state0, 0x1b);
+  state1 = _mm_shuffle_epi32 (state1, 0xb1);
+  state0 = _mm_blend_epi16 (x, state1, 0xf0);
+  state1 = _mm_alignr_epi8 (state1, x, 8);
+  _mm_storeu_si128 ((__m128i *)&state[0], state0);
+  _mm_storeu_si128 ((__m128i *)&state[4], state1);
+}
+
+const struct sha256_backend sha256_backend_shani = {
+  "shani",
+  sha256_compress_shani,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha256_shani_unused;
+
+#endif /* HAVE_SHANI_INTRINSICS */
@@ -23,12 +23,20 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "bswap.h"
 #include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_md.h"
+#include "fcrypt_wipe.h"
+#include "sha256-internal.h"
+#include "sha256-ktable.h"
 #include "sha256.h"
 
 /* Functions used by SHA-224 and SHA-256. */
@@ -39,20 +47,8 @@
 #define sigma0(x) (rotr32 ((x), 7) ^ rotr32 ((x), 18) ^ ((x) >> 3))
 #define sigma1(x) (rotr32 ((x), 17) ^ rotr32 ((x), 19) ^ ((x) >> 10))
 
-/* Constant values used by SHA-224 and SHA-256. */
+/* Constant values used by SHA-224 and SHA-256, see makesha256ktable.c. */
 #define K(x) (sha256_ktable[(x)])
-static const uint32_t sha256_ktable[64]
-    = { 0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
-        0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
-        0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
-        0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
-        0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
-        0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2 };
 
 void
 sha256_init (struct sha256_ctx *ctx)
@@ -68,16 +64,15 @@ sha256_init (struct sha256_ctx *ctx)
   ctx->count = 0;
 }
 
-void
-sha256_transform (uint32_t *state, const uint8_t *block)
+/*
+ * Compresses blocks with the state kept in registers between them. Only the
+ * last 16 words of the message schedule are needed, so w is updated in place.
+ */
+static void
+sha256_compress_generic (uint32_t *state, const uint8_t *data, size_t blocks)
 {
   uint32_t a, b, c, d, e, f, g, h, i, t1, t2;
-  uint32_t w[64];
-
-  for (i = 0; i < 16; ++i)
-    w[i] = buff_get_be32 (block + i * 4);
-  for (i = 16; i < 64; ++i)
-    w[i] = sigma1 (w[i - 2]) + w[i - 7] + sigma0 (w[i - 15]) + w[i - 16];
+  uint32_t w[16];
 
   a = state[0];
   b = state[1];
@@ -88,98 +83,169 @@ sha256_transform (uint32_t *state, const uint8_t *block)
   g = state[6];
   h = state[7];
 
-  for (i = 0; i < 64; ++i)
+  for (; blocks > 0; --blocks)
     {
-      t1 = h + Sigma1 (e) + Ch (e, f, g) + K (i) + w[i];
-      t2 = Sigma0 (a) + Maj (a, b, c);
-      h = g;
-      g = f;
-      f = e;
-      e = d + t1;
-      d = c;
-      c = b;
-      b = a;
-      a = t1 + t2;
+      buff_get_be32_words (w, data, 16);
+
+      for (i = 0; i < 64; ++i)
+        {
+          if (i >= 16)
+            w[i & 15] += sigma1 (w[(i - 2) & 15]) + w[(i - 7) & 15]
+                         + sigma0 (w[(i - 15) & 15]);
+          t1 = h + Sigma1 (e) + Ch (e, f, g) + K (i) + w[i & 15];
+          t2 = Sigma0 (a) + Maj (a, b, c);
+          h = g;
+          g = f;
+          f = e;
+          e = d + t1;
+          d = c;
+          c = b;
+          b = a;
+          a = t1 + t2;
+        }
+
+      a += state[0];
+      b += state[1];
+      c += state[2];
+      d += state[3];
+      e += state[4];
+      f += state[5];
+      g += state[6];
+      h += state[7];
+      state[0] = a;
+      state[1] = b;
+      state[2] = c;
+      state[3] = d;
+      state[4] = e;
+      state[5] = f;
+      state[6] = g;
+      state[7] = h;
+      data += SHA256_BLOCK_SIZE;
     }
+}
+
+const struct sha256_backend sha256_backend_generic = {
+  "generic",
+  sha256_compress_generic,
+};
+
+/*
+ * The implementation is picked once when the library is loaded. Compilers
+ * without constructor support always use the portable code.
+ */
+static const struct sha256_backend *sha256_backend = &sha256_backend_generic;
+
+/* Vector code used by sha256_multi, or NULL to hash one message at a time. */
+static const struct sha256_multi_backend *sha256_multi_backend = NULL;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+sha256_select_backend (void)
+{
+  uint32_t features;
 
-  state[0] += a;
-  state[1] += b;
-  state[2] += c;
-  state[3] += d;
-  state[4] += e;
-  state[5] += f;
-  state[6] += g;
-  state[7] += h;
+  features = fcrypt_cpu_features ();
+  (void)features;
+#if defined(HAVE_SHANI_INTRINSICS)
+  if ((features & (FCRYPT_CPU_SHA | FCRYPT_CPU_SSE41))
+      == (FCRYPT_CPU_SHA | FCRYPT_CPU_SSE41))
+    sha256_backend = &sha256_backend_shani;
+#endif
+#if defined(HAVE_ARM_SHA2_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_SHA2) != 0)
+    sha256_backend = &sha256_backend_armv8;
+#endif
+
+  /*
+   * Four or eight lanes are slower than the SHA instructions on a single
+   * message, so they are only used without them. Sixteen AVX-512 lanes are
+   * faster than SHA-NI.
+   */
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & (FCRYPT_CPU_ARM_NEON | FCRYPT_CPU_ARM_SHA2))
+      == FCRYPT_CPU_ARM_NEON)
+    sha256_multi_backend = &sha256_multi_backend_neon;
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & (FCRYPT_CPU_AVX2 | FCRYPT_CPU_SHA)) == FCRYPT_CPU_AVX2)
+    sha256_multi_backend = &sha256_multi_backend_avx2;
+#endif
+#if defined(HAVE_AVX512_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX512F) != 0)
+    sha256_multi_backend = &sha256_multi_backend_avx512;
+#endif
 }
+#endif /* __GNUC__ */
 
-void
-sha256_update (struct sha256_ctx *ctx, const void *inputptr, size_t inputlen)
+const char *
+sha256_backend_name (void)
 {
-  size_t filled, need;
-  const uint8_t *input = inputptr;
+  return sha256_backend->name;
+}
 
-  if (inputlen == 0)
-    return;
+const struct sha256_multi_backend *
+sha256_multi_get_backend (void)
+{
+  return sha256_multi_backend;
+}
 
-  filled = (size_t)((ctx->count >> 3) & (SHA256_BLOCK_SIZE - 1));
-  need = SHA256_BLOCK_SIZE - filled;
-  ctx->count += (uint64_t)(inputlen << 3);
+void
+sha256_transform (uint32_t *state, const uint8_t *block)
+{
+  sha256_backend->compress (state, block, 1);
+}
 
-  /* Input too short to fill a complete block. */
-  if (inputlen < need)
-    {
-      memcpy (&ctx->buffer[filled], input, inputlen);
-      return;
-    }
+void
+sha256_transform_blocks (uint32_t *state, const uint8_t *blocks,
+                         size_t nblocks)
+{
+  if (nblocks != 0)
+    sha256_backend->compress (state, blocks, nblocks);
+}
 
-  /* Check if we need to finish the buffer in ctx. */
-  if (filled != 0)
-    {
-      memcpy (&ctx->buffer[filled], input, need);
-      sha256_transform (ctx->state, ctx->buffer);
-      inputlen -= need;
-      input += need;
-    }
+/* Adapts the backend to the shared block buffering in fcrypt_md.h. */
+static void
+sha256_compress (void *state, const uint8_t *blocks, size_t nblocks)
+{
+  sha256_backend->compress (state, blocks, nblocks);
+}
 
-  /* Handle as many blocks as possible. */
-  while (inputlen >= SHA256_BLOCK_SIZE)
-    {
-      sha256_transform (ctx->state, input);
-      inputlen -= SHA256_BLOCK_SIZE;
-      input += SHA256_BLOCK_SIZE;
-    }
+void
+sha256_update (struct sha256_ctx *ctx, const void *input, size_t inputlen)
+{
+  fcrypt_md_update (ctx->state, &ctx->count, ctx->buffer, sha256_compress,
+                    input, inputlen);
+}
+
+void
+sha256_updatev (struct sha256_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
 
-  /* Save any remaining bytes. */
-  if (inputlen != 0)
-    memcpy (ctx->buffer, input, inputlen);
+  for (i = 0; i < iovcnt; ++i)
+    sha256_update (ctx, iov[i].iov_base, iov[i].iov_len);
 }
 
-/*
- * Internal function used by both SHA-224 and SHA-256. Pads the buffer to
- * 448 bits (56 bytes) so that the 64-bit length can be appended to the end.
- */
+/* Internal function used by both SHA-224 and SHA-256. */
 static void
 sha2xx_pad (struct sha256_ctx *ctx)
 {
-  size_t padoffset;
-
-  padoffset = (size_t)((ctx->count >> 3) & (SHA256_BLOCK_SIZE - 1));
-  ctx->buffer[padoffset++] = 0x80;
+  fcrypt_md_final (ctx->state, ctx->count, ctx->buffer, sha256_compress, 0x80,
+                   1);
+}
 
-  /* Enough room for count. */
-  if (padoffset <= 56)
-    memset (&ctx->buffer[padoffset], 0, 56 - padoffset);
-  else
-    {
-      /* Not enough room for count. */
-      memset (&ctx->buffer[padoffset], 0, SHA256_BLOCK_SIZE - padoffset);
-      sha256_transform (ctx->state, ctx->buffer);
-      memset (ctx->buffer, 0, 56);
-    }
+/* One-shot hash used by both SHA-224 and SHA-256. */
+static void
+sha2xx_oneshot (uint8_t *digest, size_t words, struct sha256_ctx *ctx,
+                const void *input, size_t inputlen)
+{
+  size_t i;
 
-  /* Append the count and handle the block. */
-  buff_put_be64 (ctx->buffer + 56, ctx->count);
-  sha256_transform (ctx->state, ctx->buffer);
+  fcrypt_md_oneshot (ctx->state, ctx->buffer, sha256_compress, 0x80, 1, input,
+                     inputlen);
+  for (i = 0; i < words; ++i)
+    buff_put_be32 (digest + i * 4, ctx->state[i]);
+  fcrypt_wipe (ctx, sizeof (*ctx));
 }
 
 void
@@ -191,7 +257,92 @@ sha256_final (uint8_t *digest, struct sha256_ctx *ctx)
 
   for (i = 0; i < 8; ++i)
     buff_put_be32 (digest + i * 4, ctx->state[i]);
-  memset (ctx, 0, sizeof (*ctx));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+sha256_copy (struct sha256_ctx *dst, const struct sha256_ctx *src)
+{
+  *dst = *src;
+}
+
+void
+sha256 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha256_ctx ctx;
+
+  sha256_init (&ctx);
+  sha2xx_oneshot (digest, 8, &ctx, input, inputlen);
+}
+
+/* Padding of a 32-byte message, ending with its length of 256 bits. */
+static const uint8_t sha256_pad32[32] = {
+  0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+};
+
+/* The block after a 64-byte message, ending with its length of 512 bits. */
+static const uint8_t sha256_pad64[64] = {
+  0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+};
+
+void
+sha256_32 (uint8_t *digest, const uint8_t *input)
+{
+  struct sha256_ctx ctx;
+  uint32_t i;
+
+  sha256_init (&ctx);
+  memcpy (ctx.buffer, input, 32);
+  memcpy (ctx.buffer + 32, sha256_pad32, sizeof (sha256_pad32));
+  sha256_backend->compress (ctx.state, ctx.buffer, 1);
+  for (i = 0; i < 8; ++i)
+    buff_put_be32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
+}
+
+void
+sha256_64 (uint8_t *digest, const uint8_t *input)
+{
+  struct sha256_ctx ctx;
+  uint32_t i;
+
+  sha256_init (&ctx);
+  sha256_backend->compress (ctx.state, input, 1);
+  sha256_backend->compress (ctx.state, sha256_pad64, 1);
+  for (i = 0; i < 8; ++i)
+    buff_put_be32 (digest + i * 4, ctx.state[i]);
+  fcrypt_wipe (&ctx, sizeof (ctx));
+}
+
+/*
+ * Hashes count independent messages, writing the SHA256_DIGEST_SIZE byte
+ * digest of message i to digests + i * SHA256_DIGEST_SIZE.
+ */
+void
+sha256_multi (uint8_t *digests, const uint8_t *const *messages,
+              const size_t *lens, size_t count)
+{
+  struct fcrypt_md_multi md;
+  struct sha256_ctx ctx;
+
+  sha256_init (&ctx);
+  md.iv = ctx.state;
+  md.words = 8;
+  md.digest_words = 8;
+  md.big_endian = 1;
+  md.compress = sha256_compress;
+  md.lanes = 0;
+  md.compress_lanes = NULL;
+  if (sha256_multi_backend != NULL)
+    {
+      md.lanes = sha256_multi_backend->lanes;
+      md.compress_lanes = sha256_multi_backend->compress;
+    }
+  fcrypt_md_multi (&md, digests, messages, lens, count);
 }
 
 void
@@ -215,6 +366,14 @@ sha224_transform (uint32_t *state, const uint8_t *block)
   sha256_transform (state, block);
 }
 
+void
+sha224_transform_blocks (uint32_t *state, const uint8_t *blocks,
+                         size_t nblocks)
+{
+  /* Same as SHA-256. */
+  sha256_transform_blocks (state, blocks, nblocks);
+}
+
 void
 sha224_update (struct sha256_ctx *ctx, const void *inputptr, size_t inputlen)
 {
@@ -222,6 +381,15 @@ sha224_update (struct sha256_ctx *ctx, const void *inputptr, size_t inputlen)
   sha256_update (ctx, inputptr, inputlen);
 }
 
+void
+sha224_updatev (struct sha256_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    sha224_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
 void
 sha224_final (uint8_t *digest, struct sha256_ctx *ctx)
 {
@@ -231,5 +399,14 @@ sha224_final (uint8_t *digest, struct sha256_ctx *ctx)
 
   for (i = 0; i < 7; ++i)
     buff_put_be32 (digest + i * 4, ctx->state[i]);
-  memset (ctx, 0, sizeof (*ctx));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+sha224 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha256_ctx ctx;
+
+  sha224_init (&ctx);
+  sha2xx_oneshot (digest, 7, &ctx, input, inputlen);
 }
@@ -29,6 +29,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct iovec;
+
 #define SHA256_DIGEST_SIZE 32
 #define SHA256_BLOCK_SIZE 64
 
@@ -45,13 +47,36 @@ struct sha256_ctx
 /* SHA-256 */
 void sha256_init (struct sha256_ctx *);
 void sha256_transform (uint32_t *, const uint8_t *);
+void sha256_transform_blocks (uint32_t *, const uint8_t *, size_t);
 void sha256_update (struct sha256_ctx *, const void *, size_t);
+void sha256_updatev (struct sha256_ctx *, const struct iovec *, size_t);
 void sha256_final (uint8_t *, struct sha256_ctx *);
+void sha256_copy (struct sha256_ctx *, const struct sha256_ctx *);
+void sha256 (uint8_t *, const void *, size_t);
+
+/*
+ * Hashes many independent messages at once, using the SIMD units to run the
+ * compression function on several of them in parallel. The arguments are the
+ * output buffer for the digests, stored one after another, the arrays of
+ * message pointers and lengths, and the number of messages.
+ */
+void sha256_multi (uint8_t *, const uint8_t *const *, const size_t *, size_t);
+
+/*
+ * SHA-256 of exactly 32 or 64 bytes, such as a key or two child digests of
+ * a hash tree. The padding is a constant block, so these are one or two
+ * calls of the compression function with no buffering.
+ */
+void sha256_32 (uint8_t *, const uint8_t *);
+void sha256_64 (uint8_t *, const uint8_t *);
 
 /* SHA-224 */
 void sha224_init (struct sha256_ctx *);
 void sha224_transform (uint32_t *, const uint8_t *);
+void sha224_transform_blocks (uint32_t *, const uint8_t *, size_t);
 void sha224_update (struct sha256_ctx *, const void *, size_t);
+void sha224_updatev (struct sha256_ctx *, const struct iovec *, size_t);
 void sha224_final (uint8_t *, struct sha256_ctx *);
+void sha224 (uint8_t *, const void *, size_t);
 
 #endif /* SHA256_H */
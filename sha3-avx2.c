@@ -0,0 +1,158 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Four Keccak-f[1600] instances with AVX2, one per 64-bit element. The
+ * interleaved state of struct shake_x4_ctx already has the four copies of
+ * each lane next to each other, so every lane is a single load. AND-NOT is
+ * native here, so chi is computed directly without complementing lanes.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha3-internal.h"
+#include "sha3.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_XOR(a, b) _mm256_xor_si256 ((a), (b))
+#define AVX2_XOR5(a, b, c, d, e)                                              \
+  AVX2_XOR (AVX2_XOR (AVX2_XOR ((a), (b)), AVX2_XOR ((c), (d))), (e))
+#define AVX2_ROL64(x, n)                                                      \
+  _mm256_or_si256 (_mm256_slli_epi64 ((x), (n)),                              \
+                   _mm256_srli_epi64 ((x), 64 - (n)))
+#define AVX2_CHI(a, b, c) AVX2_XOR ((a), _mm256_andnot_si256 ((b), (c)))
+
+#define AVX2_ROUND(a, e, rc)                                                  \
+  do                                                                          \
+    {                                                                         \
+      c0 = AVX2_XOR5 ((a)[0], (a)[5], (a)[10], (a)[15], (a)[20]);             \
+      c1 = AVX2_XOR5 ((a)[1], (a)[6], (a)[11], (a)[16], (a)[21]);             \
+      c2 = AVX2_XOR5 ((a)[2], (a)[7], (a)[12], (a)[17], (a)[22]);             \
+      c3 = AVX2_XOR5 ((a)[3], (a)[8], (a)[13], (a)[18], (a)[23]);             \
+      c4 = AVX2_XOR5 ((a)[4], (a)[9], (a)[14], (a)[19], (a)[24]);             \
+      d0 = AVX2_XOR (c4, AVX2_ROL64 (c1, 1));                                 \
+      d1 = AVX2_XOR (c0, AVX2_ROL64 (c2, 1));                                 \
+      d2 = AVX2_XOR (c1, AVX2_ROL64 (c3, 1));                                 \
+      d3 = AVX2_XOR (c2, AVX2_ROL64 (c4, 1));                                 \
+      d4 = AVX2_XOR (c3, AVX2_ROL64 (c0, 1));                                 \
+                                                                              \
+      b0 = AVX2_XOR ((a)[0], d0);                                             \
+      b1 = AVX2_ROL64 (AVX2_XOR ((a)[6], d1), 44);                            \
+      b2 = AVX2_ROL64 (AVX2_XOR ((a)[12], d2), 43);                           \
+      b3 = AVX2_ROL64 (AVX2_XOR ((a)[18], d3), 21);                           \
+      b4 = AVX2_ROL64 (AVX2_XOR ((a)[24], d4), 14);                           \
+      (e)[0] = AVX2_XOR (AVX2_CHI (b0, b1, b2), (rc));                        \
+      (e)[1] = AVX2_CHI (b1, b2, b3);                                         \
+      (e)[2] = AVX2_CHI (b2, b3, b4);                                         \
+      (e)[3] = AVX2_CHI (b3, b4, b0);                                         \
+      (e)[4] = AVX2_CHI (b4, b0, b1);                                         \
+                                                                              \
+      b0 = AVX2_ROL64 (AVX2_XOR ((a)[3], d3), 28);                            \
+      b1 = AVX2_ROL64 (AVX2_XOR ((a)[9], d4), 20);                            \
+      b2 = AVX2_ROL64 (AVX2_XOR ((a)[10], d0), 3);                            \
+      b3 = AVX2_ROL64 (AVX2_XOR ((a)[16], d1), 45);                           \
+      b4 = AVX2_ROL64 (AVX2_XOR ((a)[22], d2), 61);                           \
+      (e)[5] = AVX2_CHI (b0, b1, b2);                                         \
+      (e)[6] = AVX2_CHI (b1, b2, b3);                                         \
+      (e)[7] = AVX2_CHI (b2, b3, b4);                                         \
+      (e)[8] = AVX2_CHI (b3, b4, b0);                                         \
+      (e)[9] = AVX2_CHI (b4, b0, b1);                                         \
+                                                                              \
+      b0 = AVX2_ROL64 (AVX2_XOR ((a)[1], d1), 1);                             \
+      b1 = AVX2_ROL64 (AVX2_XOR ((a)[7], d2), 6);                             \
+      b2 = AVX2_ROL64 (AVX2_XOR ((a)[13], d3), 25);                           \
+      b3 = AVX2_ROL64 (AVX2_XOR ((a)[19], d4), 8);                            \
+      b4 = AVX2_ROL64 (AVX2_XOR ((a)[20], d0), 18);                           \
+      (e)[10] = AVX2_CHI (b0, b1, b2);                                        \
+      (e)[11] = AVX2_CHI (b1, b2, b3);                                        \
+      (e)[12] = AVX2_CHI (b2, b3, b4);                                        \
+      (e)[13] = AVX2_CHI (b3, b4, b0);                                        \
+      (e)[14] = AVX2_CHI (b4, b0, b1);                                        \
+                                                                              \
+      b0 = AVX2_ROL64 (AVX2_XOR ((a)[4], d4), 27);                            \
+      b1 = AVX2_ROL64 (AVX2_XOR ((a)[5], d0), 36);                            \
+      b2 = AVX2_ROL64 (AVX2_XOR ((a)[11], d1), 10);                           \
+      b3 = AVX2_ROL64 (AVX2_XOR ((a)[17], d2), 15);                           \
+      b4 = AVX2_ROL64 (AVX2_XOR ((a)[23], d3), 56);                           \
+      (e)[15] = AVX2_CHI (b0, b1, b2);                                        \
+      (e)[16] = AVX2_CHI (b1, b2, b3);                                        \
+      (e)[17] = AVX2_CHI (b2, b3, b4);                                        \
+      (e)[18] = AVX2_CHI (b3, b4, b0);                                        \
+      (e)[19] = AVX2_CHI (b4, b0, b1);                                        \
+                                                                              \
+      b0 = AVX2_ROL64 (AVX2_XOR ((a)[2], d2), 62);                            \
+      b1 = AVX2_ROL64 (AVX2_XOR ((a)[8], d3), 55);                            \
+      b2 = AVX2_ROL64 (AVX2_XOR ((a)[14], d4), 39);                           \
+      b3 = AVX2_ROL64 (AVX2_XOR ((a)[15], d0), 41);                           \
+      b4 = AVX2_ROL64 (AVX2_XOR ((a)[21], d1), 2);                            \
+      (e)[20] = AVX2_CHI (b0, b1, b2);                                        \
+      (e)[21] = AVX2_CHI (b1, b2, b3);                                        \
+      (e)[22] = AVX2_CHI (b2, b3, b4);                                        \
+      (e)[23] = AVX2_CHI (b3, b4, b0);                                        \
+      (e)[24] = AVX2_CHI (b4, b0, b1);                                        \
+    }                                                                         \
+  while (0)
+
+AVX2_TARGET static void
+sha3_x4_permute_avx2 (uint64_t *state)
+{
+  __m256i a[25], e[25];
+  __m256i b0, b1, b2, b3, b4, c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+  size_t i;
+
+  for (i = 0; i < 25; ++i)
+    a[i] = _mm256_loadu_si256 ((const __m256i *)(state + i * 4));
+
+  for (i = 0; i < 24; i += 2)
+    {
+      AVX2_ROUND (a, e,
+                  _mm256_set1_epi64x ((long long)keccak_round_constants[i]));
+      AVX2_ROUND (
+          e, a, _mm256_set1_epi64x ((long long)keccak_round_constants[i + 1]));
+    }
+
+  for (i = 0; i < 25; ++i)
+    _mm256_storeu_si256 ((__m256i *)(state + i * 4), a[i]);
+}
+
+const struct sha3_x4_backend sha3_x4_backend_avx2 = {
+  "avx2",
+  sha3_x4_permute_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha3_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
@@ -0,0 +1,60 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between sha3.c and the SIMD Keccak-f[1600] code used by the
+ * four instance SHAKE functions. The state is that of struct shake_x4_ctx,
+ * the four instances interleaved lane by lane.
+ */
+
+#ifndef SHA3_INTERNAL_H
+#define SHA3_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct sha3_x4_backend
+{
+  const char *name;
+  void (*permute) (uint64_t *);
+};
+
+/* Round constants from FIPS 202, shared with the backends. */
+extern const uint64_t keccak_round_constants[24];
+
+/* One instance at a time with keccak_f1600, in sha3.c. */
+extern const struct sha3_x4_backend sha3_x4_backend_generic;
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* All four instances at once with AVX2 in sha3-avx2.c. */
+extern const struct sha3_x4_backend sha3_x4_backend_avx2;
+#endif
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+/* Two pairs of instances with NEON in sha3-neon.c. */
+extern const struct sha3_x4_backend sha3_x4_backend_neon;
+#endif
+
+#endif /* SHA3_INTERNAL_H */
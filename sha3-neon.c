@@ -0,0 +1,164 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Keccak-f[1600] on two instances at a time with NEON, one per 64-bit
+ * element. The four instances of struct shake_x4_ctx are done as two pairs,
+ * interleaved in the same loop so that the pairs can overlap. BIC provides
+ * AND-NOT, so chi is computed directly without complementing lanes.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha3-internal.h"
+#include "sha3.h"
+
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define NEON_TARGET __attribute__ ((target (ARM_NEON_TARGET_ATTRIBUTE)))
+
+#define NEON_XOR(a, b) veorq_u64 ((a), (b))
+#define NEON_XOR5(a, b, c, d, e)                                              \
+  NEON_XOR (NEON_XOR (NEON_XOR ((a), (b)), NEON_XOR ((c), (d))), (e))
+#define NEON_ROL64(x, n) vsliq_n_u64 (vshrq_n_u64 ((x), 64 - (n)), (x), (n))
+#define NEON_CHI(a, b, c) NEON_XOR ((a), vbicq_u64 ((c), (b)))
+
+#define NEON_ROUND(a, e, rc)                                                  \
+  do                                                                          \
+    {                                                                         \
+      c0 = NEON_XOR5 ((a)[0], (a)[5], (a)[10], (a)[15], (a)[20]);             \
+      c1 = NEON_XOR5 ((a)[1], (a)[6], (a)[11], (a)[16], (a)[21]);             \
+      c2 = NEON_XOR5 ((a)[2], (a)[7], (a)[12], (a)[17], (a)[22]);             \
+      c3 = NEON_XOR5 ((a)[3], (a)[8], (a)[13], (a)[18], (a)[23]);             \
+      c4 = NEON_XOR5 ((a)[4], (a)[9], (a)[14], (a)[19], (a)[24]);             \
+      d0 = NEON_XOR (c4, NEON_ROL64 (c1, 1));                                 \
+      d1 = NEON_XOR (c0, NEON_ROL64 (c2, 1));                                 \
+      d2 = NEON_XOR (c1, NEON_ROL64 (c3, 1));                                 \
+      d3 = NEON_XOR (c2, NEON_ROL64 (c4, 1));                                 \
+      d4 = NEON_XOR (c3, NEON_ROL64 (c0, 1));                                 \
+                                                                              \
+      b0 = NEON_XOR ((a)[0], d0);                                             \
+      b1 = NEON_ROL64 (NEON_XOR ((a)[6], d1), 44);                            \
+      b2 = NEON_ROL64 (NEON_XOR ((a)[12], d2), 43);                           \
+      b3 = NEON_ROL64 (NEON_XOR ((a)[18], d3), 21);                           \
+      b4 = NEON_ROL64 (NEON_XOR ((a)[24], d4), 14);                           \
+      (e)[0] = NEON_XOR (NEON_CHI (b0, b1, b2), (rc));                        \
+      (e)[1] = NEON_CHI (b1, b2, b3);                                         \
+      (e)[2] = NEON_CHI (b2, b3, b4);                                         \
+      (e)[3] = NEON_CHI (b3, b4, b0);                                         \
+      (e)[4] = NEON_CHI (b4, b0, b1);                                         \
+                                                                              \
+      b0 = NEON_ROL64 (NEON_XOR ((a)[3], d3), 28);                            \
+      b1 = NEON_ROL64 (NEON_XOR ((a)[9], d4), 20);                            \
+      b2 = NEON_ROL64 (NEON_XOR ((a)[10], d0), 3);                            \
+      b3 = NEON_ROL64 (NEON_XOR ((a)[16], d1), 45);                           \
+      b4 = NEON_ROL64 (NEON_XOR ((a)[22], d2), 61);                           \
+      (e)[5] = NEON_CHI (b0, b1, b2);                                         \
+      (e)[6] = NEON_CHI (b1, b2, b3);                                         \
+      (e)[7] = NEON_CHI (b2, b3, b4);                                         \
+      (e)[8] = NEON_CHI (b3, b4, b0);                                         \
+      (e)[9] = NEON_CHI (b4, b0, b1);                                         \
+                                                                              \
+      b0 = NEON_ROL64 (NEON_XOR ((a)[1], d1), 1);                             \
+      b1 = NEON_ROL64 (NEON_XOR ((a)[7], d2), 6);                             \
+      b2 = NEON_ROL64 (NEON_XOR ((a)[13], d3), 25);                           \
+      b3 = NEON_ROL64 (NEON_XOR ((a)[19], d4), 8);                            \
+      b4 = NEON_ROL64 (NEON_XOR ((a)[20], d0), 18);                           \
+      (e)[10] = NEON_CHI (b0, b1, b2);                                        \
+      (e)[11] = NEON_CHI (b1, b2, b3);                                        \
+      (e)[12] = NEON_CHI (b2, b3, b4);                                        \
+      (e)[13] = NEON_CHI (b3, b4, b0);                                        \
+      (e)[14] = NEON_CHI (b4, b0, b1);                                        \
+                                                                              \
+      b0 = NEON_ROL64 (NEON_XOR ((a)[4], d4), 27);                            \
+      b1 = NEON_ROL64 (NEON_XOR ((a)[5], d0), 36);                            \
+      b2 = NEON_ROL64 (NEON_XOR ((a)[11], d1), 10);                           \
+      b3 = NEON_ROL64 (NEON_XOR ((a)[17], d2), 15);                           \
+      b4 = NEON_ROL64 (NEON_XOR ((a)[23], d3), 56);                           \
+      (e)[15] = NEON_CHI (b0, b1, b2);                                        \
+      (e)[16] = NEON_CHI (b1, b2, b3);                                        \
+      (e)[17] = NEON_CHI (b2, b3, b4);                                        \
+      (e)[18] = NEON_CHI (b3, b4, b0);                                        \
+      (e)[19] = NEON_CHI (b4, b0, b1);                                        \
+                                                                              \
+      b0 = NEON_ROL64 (NEON_XOR ((a)[2], d2), 62);                            \
+      b1 = NEON_ROL64 (NEON_XOR ((a)[8], d3), 55);                            \
+      b2 = NEON_ROL64 (NEON_XOR ((a)[14], d4), 39);                           \
+      b3 = NEON_ROL64 (NEON_XOR ((a)[15], d0), 41);                           \
+      b4 = NEON_ROL64 (NEON_XOR ((a)[21], d1), 2);                            \
+      (e)[20] = NEON_CHI (b0, b1, b2);                                        \
+      (e)[21] = NEON_CHI (b1, b2, b3);                                        \
+      (e)[22] = NEON_CHI (b2, b3, b4);                                        \
+      (e)[23] = NEON_CHI (b3, b4, b0);                                        \
+      (e)[24] = NEON_CHI (b4, b0, b1);                                        \
+    }                                                                         \
+  while (0)
+
+NEON_TARGET static void
+sha3_x4_permute_neon (uint64_t *state)
+{
+  uint64x2_t a[25], e[25], a2[25], e2[25], rc;
+  uint64x2_t b0, b1, b2, b3, b4, c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+  size_t i;
+
+  for (i = 0; i < 25; ++i)
+    {
+      a[i] = vld1q_u64 (state + i * 4);
+      a2[i] = vld1q_u64 (state + i * 4 + 2);
+    }
+
+  for (i = 0; i < 24; i += 2)
+    {
+      rc = vdupq_n_u64 (keccak_round_constants[i]);
+      NEON_ROUND (a, e, rc);
+      NEON_ROUND (a2, e2, rc);
+      rc = vdupq_n_u64 (keccak_round_constants[i + 1]);
+      NEON_ROUND (e, a, rc);
+      NEON_ROUND (e2, a2, rc);
+    }
+
+  for (i = 0; i < 25; ++i)
+    {
+      vst1q_u64 (state + i * 4, a[i]);
+      vst1q_u64 (state + i * 4 + 2, a2[i]);
+    }
+}
+
+const struct sha3_x4_backend sha3_x4_backend_neon = {
+  "neon",
+  sha3_x4_permute_neon,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha3_neon_unused;
+
+#endif /* HAVE_ARM_NEON_INTRINSICS */
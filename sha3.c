@@ -0,0 +1,583 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SHA-3 and SHAKE from FIPS 202. The permutation uses the lane complementing
+ * transform of the Keccak implementation overview: with six lanes kept
+ * inverted inside keccak_f1600, chi needs one NOT per row of five lanes
+ * instead of five, and the inversion is undone when the permutation returns
+ * so that absorbing and squeezing see the plain state.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include "bswap.h"
+#include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_wipe.h"
+#include "sha3-internal.h"
+#include "sha3.h"
+
+/* Padding suffixes, with the domain bits and the first bit of pad10*1. */
+#define SHA3_SUFFIX 0x06
+#define SHAKE_SUFFIX 0x1f
+
+const uint64_t keccak_round_constants[24]
+    = { 0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+        0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+        0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+        0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+        0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+        0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+        0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+        0x8000000000008080, 0x0000000080000001, 0x8000000080008008 };
+
+/*
+ * One round from the lanes in a to the lanes in e, with theta, rho and pi
+ * folded into the loads of each row and chi written for the complemented
+ * lanes 1, 2, 8, 12, 17 and 20.
+ */
+#define KECCAK_ROUND(a, e, rc)                                                \
+  do                                                                          \
+    {                                                                         \
+      c0 = (a)[0] ^ (a)[5] ^ (a)[10] ^ (a)[15] ^ (a)[20];                     \
+      c1 = (a)[1] ^ (a)[6] ^ (a)[11] ^ (a)[16] ^ (a)[21];                     \
+      c2 = (a)[2] ^ (a)[7] ^ (a)[12] ^ (a)[17] ^ (a)[22];                     \
+      c3 = (a)[3] ^ (a)[8] ^ (a)[13] ^ (a)[18] ^ (a)[23];                     \
+      c4 = (a)[4] ^ (a)[9] ^ (a)[14] ^ (a)[19] ^ (a)[24];                     \
+      d0 = c4 ^ rotl64 (c1, 1);                                               \
+      d1 = c0 ^ rotl64 (c2, 1);                                               \
+      d2 = c1 ^ rotl64 (c3, 1);                                               \
+      d3 = c2 ^ rotl64 (c4, 1);                                               \
+      d4 = c3 ^ rotl64 (c0, 1);                                               \
+                                                                              \
+      b0 = (a)[0] ^ d0;                                                       \
+      b1 = rotl64 ((a)[6] ^ d1, 44);                                          \
+      b2 = rotl64 ((a)[12] ^ d2, 43);                                         \
+      b3 = rotl64 ((a)[18] ^ d3, 21);                                         \
+      b4 = rotl64 ((a)[24] ^ d4, 14);                                         \
+      (e)[0] = b0 ^ (b1 | b2) ^ (rc);                                         \
+      (e)[1] = b1 ^ (~b2 | b3);                                               \
+      (e)[2] = b2 ^ (b3 & b4);                                                \
+      (e)[3] = b3 ^ (b4 | b0);                                                \
+      (e)[4] = b4 ^ (b0 & b1);                                                \
+                                                                              \
+      b0 = rotl64 ((a)[3] ^ d3, 28);                                          \
+      b1 = rotl64 ((a)[9] ^ d4, 20);                                          \
+      b2 = rotl64 ((a)[10] ^ d0, 3);                                          \
+      b3 = rotl64 ((a)[16] ^ d1, 45);                                         \
+      b4 = rotl64 ((a)[22] ^ d2, 61);                                         \
+      (e)[5] = b0 ^ (b1 | b2);                                                \
+      (e)[6] = b1 ^ (b2 & b3);                                                \
+      (e)[7] = b2 ^ (b3 | ~b4);                                               \
+      (e)[8] = b3 ^ (b4 | b0);                                                \
+      (e)[9] = b4 ^ (b0 & b1);                                                \
+                                                                              \
+      b0 = rotl64 ((a)[1] ^ d1, 1);                                           \
+      b1 = rotl64 ((a)[7] ^ d2, 6);                                           \
+      b2 = rotl64 ((a)[13] ^ d3, 25);                                         \
+      b3 = rotl64 ((a)[19] ^ d4, 8);                                          \
+      b4 = rotl64 ((a)[20] ^ d0, 18);                                         \
+      (e)[10] = b0 ^ (b1 | b2);                                               \
+      (e)[11] = b1 ^ (b2 & b3);                                               \
+      (e)[12] = b2 ^ (~b3 & b4);                                              \
+      (e)[13] = ~b3 ^ (b4 | b0);                                              \
+      (e)[14] = b4 ^ (b0 & b1);                                               \
+                                                                              \
+      b0 = rotl64 ((a)[4] ^ d4, 27);                                          \
+      b1 = rotl64 ((a)[5] ^ d0, 36);                                          \
+      b2 = rotl64 ((a)[11] ^ d1, 10);                                         \
+      b3 = rotl64 ((a)[17] ^ d2, 15);                                         \
+      b4 = rotl64 ((a)[23] ^ d3, 56);                                         \
+      (e)[15] = b0 ^ (b1 & b2);                                               \
+      (e)[16] = b1 ^ (b2 | b3);                                               \
+      (e)[17] = b2 ^ (~b3 | b4);                                              \
+      (e)[18] = ~b3 ^ (b4 & b0);                                              \
+      (e)[19] = b4 ^ (b0 | b1);                                               \
+                                                                              \
+      b0 = rotl64 ((a)[2] ^ d2, 62);                                          \
+      b1 = rotl64 ((a)[8] ^ d3, 55);                                          \
+      b2 = rotl64 ((a)[14] ^ d4, 39);                                         \
+      b3 = rotl64 ((a)[15] ^ d0, 41);                                         \
+      b4 = rotl64 ((a)[21] ^ d1, 2);                                          \
+      (e)[20] = b0 ^ (~b1 & b2);                                              \
+      (e)[21] = ~b1 ^ (b2 | b3);                                              \
+      (e)[22] = b2 ^ (b3 & b4);                                               \
+      (e)[23] = b3 ^ (b4 | b0);                                               \
+      (e)[24] = b4 ^ (b0 & b1);                                               \
+    }                                                                         \
+  while (0)
+
+/* The lanes inverted by the lane complementing transform. */
+#define KECCAK_COMPLEMENT(a)                                                  \
+  do                                                                          \
+    {                                                                         \
+      (a)[1] = ~(a)[1];                                                       \
+      (a)[2] = ~(a)[2];                                                       \
+      (a)[8] = ~(a)[8];                                                       \
+      (a)[12] = ~(a)[12];                                                     \
+      (a)[17] = ~(a)[17];                                                     \
+      (a)[20] = ~(a)[20];                                                     \
+    }                                                                         \
+  while (0)
+
+void
+keccak_f1600 (uint64_t *state)
+{
+  uint64_t a[25], e[25];
+  uint64_t b0, b1, b2, b3, b4, c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+  size_t i;
+
+  memcpy (a, state, sizeof (a));
+  KECCAK_COMPLEMENT (a);
+  for (i = 0; i < 24; i += 2)
+    {
+      KECCAK_ROUND (a, e, keccak_round_constants[i]);
+      KECCAK_ROUND (e, a, keccak_round_constants[i + 1]);
+    }
+  KECCAK_COMPLEMENT (a);
+  memcpy (state, a, sizeof (a));
+}
+
+static void
+sha3_x4_permute_generic (uint64_t *state)
+{
+  uint64_t lanes[25];
+  size_t i, j;
+
+  for (j = 0; j < 4; ++j)
+    {
+      for (i = 0; i < 25; ++i)
+        lanes[i] = state[i * 4 + j];
+      keccak_f1600 (lanes);
+      for (i = 0; i < 25; ++i)
+        state[i * 4 + j] = lanes[i];
+    }
+}
+
+const struct sha3_x4_backend sha3_x4_backend_generic = {
+  "generic",
+  sha3_x4_permute_generic,
+};
+
+/*
+ * The implementation is picked once when the library is loaded. Compilers
+ * without constructor support always use the portable code.
+ */
+static const struct sha3_x4_backend *sha3_x4_backend
+    = &sha3_x4_backend_generic;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+sha3_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_NEON) != 0)
+    sha3_x4_backend = &sha3_x4_backend_neon;
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    sha3_x4_backend = &sha3_x4_backend_avx2;
+#endif
+}
+#endif /* __GNUC__ */
+
+/* XORs len bytes into the state starting at byte pos. */
+static void
+sha3_xor_bytes (uint64_t *state, size_t pos, const uint8_t *input,
+                size_t len)
+{
+  for (; len > 0 && (pos & 7) != 0; --len, ++pos)
+    state[pos / 8] ^= (uint64_t)*input++ << (8 * (pos & 7));
+  for (; len >= 8; len -= 8, pos += 8, input += 8)
+    state[pos / 8] ^= buff_get_le64 (input);
+  for (; len > 0; --len, ++pos)
+    state[pos / 8] ^= (uint64_t)*input++ << (8 * (pos & 7));
+}
+
+/* Copies len bytes out of the state starting at byte pos. */
+static void
+sha3_extract_bytes (const uint64_t *state, size_t pos, uint8_t *output,
+                    size_t len)
+{
+  for (; len > 0 && (pos & 7) != 0; --len, ++pos)
+    *output++ = (uint8_t)(state[pos / 8] >> (8 * (pos & 7)));
+  for (; len >= 8; len -= 8, pos += 8, output += 8)
+    buff_put_le64 (output, state[pos / 8]);
+  for (; len > 0; --len, ++pos)
+    *output++ = (uint8_t)(state[pos / 8] >> (8 * (pos & 7)));
+}
+
+static void
+sha3_init (struct sha3_ctx *ctx, size_t rate, size_t digest_size,
+           uint8_t suffix)
+{
+  memset (ctx->state, 0, sizeof (ctx->state));
+  ctx->rate = rate;
+  ctx->pos = 0;
+  ctx->digest_size = digest_size;
+  ctx->suffix = suffix;
+  ctx->squeezing = 0;
+}
+
+void
+sha3_224_init (struct sha3_ctx *ctx)
+{
+  sha3_init (ctx, SHA3_224_BLOCK_SIZE, SHA3_224_DIGEST_SIZE, SHA3_SUFFIX);
+}
+
+void
+sha3_256_init (struct sha3_ctx *ctx)
+{
+  sha3_init (ctx, SHA3_256_BLOCK_SIZE, SHA3_256_DIGEST_SIZE, SHA3_SUFFIX);
+}
+
+void
+sha3_384_init (struct sha3_ctx *ctx)
+{
+  sha3_init (ctx, SHA3_384_BLOCK_SIZE, SHA3_384_DIGEST_SIZE, SHA3_SUFFIX);
+}
+
+void
+sha3_512_init (struct sha3_ctx *ctx)
+{
+  sha3_init (ctx, SHA3_512_BLOCK_SIZE, SHA3_512_DIGEST_SIZE, SHA3_SUFFIX);
+}
+
+void
+shake128_init (struct sha3_ctx *ctx)
+{
+  sha3_init (ctx, SHAKE128_BLOCK_SIZE, 0, SHAKE_SUFFIX);
+}
+
+void
+shake256_init (struct sha3_ctx *ctx)
+{
+  sha3_init (ctx, SHAKE256_BLOCK_SIZE, 0, SHAKE_SUFFIX);
+}
+
+void
+sha3_update (struct sha3_ctx *ctx, const void *inputptr, size_t inputlen)
+{
+  const uint8_t *input = inputptr;
+  size_t n;
+
+  /* Fill up a partial block. */
+  if (ctx->pos != 0)
+    {
+      n = ctx->rate - ctx->pos;
+      if (n > inputlen)
+        n = inputlen;
+      sha3_xor_bytes (ctx->state, ctx->pos, input, n);
+      ctx->pos += n;
+      input += n;
+      inputlen -= n;
+      if (ctx->pos < ctx->rate)
+        return;
+      keccak_f1600 (ctx->state);
+      ctx->pos = 0;
+    }
+
+  for (; inputlen >= ctx->rate; inputlen -= ctx->rate, input += ctx->rate)
+    {
+      sha3_xor_bytes (ctx->state, 0, input, ctx->rate);
+      keccak_f1600 (ctx->state);
+    }
+
+  if (inputlen != 0)
+    {
+      sha3_xor_bytes (ctx->state, 0, input, inputlen);
+      ctx->pos = inputlen;
+    }
+}
+
+void
+sha3_updatev (struct sha3_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    sha3_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
+void
+shake_update (struct sha3_ctx *ctx, const void *input, size_t inputlen)
+{
+  sha3_update (ctx, input, inputlen);
+}
+
+void
+shake_updatev (struct sha3_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    shake_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
+/* Absorbs the padding and switches to squeezing. */
+static void
+sha3_pad (struct sha3_ctx *ctx)
+{
+  ctx->state[ctx->pos / 8] ^= (uint64_t)ctx->suffix << (8 * (ctx->pos & 7));
+  ctx->state[(ctx->rate - 1) / 8] ^= UINT64_C (0x80) << 56;
+  keccak_f1600 (ctx->state);
+  ctx->pos = 0;
+  ctx->squeezing = 1;
+}
+
+void
+shake_squeeze (struct sha3_ctx *ctx, uint8_t *output, size_t outputlen)
+{
+  size_t n;
+
+  if (!ctx->squeezing)
+    sha3_pad (ctx);
+
+  while (outputlen > 0)
+    {
+      if (ctx->pos == ctx->rate)
+        {
+          keccak_f1600 (ctx->state);
+          ctx->pos = 0;
+        }
+      n = ctx->rate - ctx->pos;
+      if (n > outputlen)
+        n = outputlen;
+      sha3_extract_bytes (ctx->state, ctx->pos, output, n);
+      ctx->pos += n;
+      output += n;
+      outputlen -= n;
+    }
+}
+
+void
+shake_final (uint8_t *output, size_t outputlen, struct sha3_ctx *ctx)
+{
+  shake_squeeze (ctx, output, outputlen);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+sha3_final (uint8_t *digest, struct sha3_ctx *ctx)
+{
+  shake_squeeze (ctx, digest, ctx->digest_size);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+sha3_copy (struct sha3_ctx *dst, const struct sha3_ctx *src)
+{
+  *dst = *src;
+}
+
+void
+sha3_224 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha3_ctx ctx;
+
+  sha3_224_init (&ctx);
+  sha3_update (&ctx, input, inputlen);
+  sha3_final (digest, &ctx);
+}
+
+void
+sha3_256 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha3_ctx ctx;
+
+  sha3_256_init (&ctx);
+  sha3_update (&ctx, input, inputlen);
+  sha3_final (digest, &ctx);
+}
+
+void
+sha3_384 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha3_ctx ctx;
+
+  sha3_384_init (&ctx);
+  sha3_update (&ctx, input, inputlen);
+  sha3_final (digest, &ctx);
+}
+
+void
+sha3_512 (uint8_t *digest, const void *input, size_t inputlen)
+{
+  struct sha3_ctx ctx;
+
+  sha3_512_init (&ctx);
+  sha3_update (&ctx, input, inputlen);
+  sha3_final (digest, &ctx);
+}
+
+void
+shake128 (uint8_t *output, size_t outputlen, const void *input,
+          size_t inputlen)
+{
+  struct sha3_ctx ctx;
+
+  shake128_init (&ctx);
+  sha3_update (&ctx, input, inputlen);
+  shake_final (output, outputlen, &ctx);
+}
+
+void
+shake256 (uint8_t *output, size_t outputlen, const void *input,
+          size_t inputlen)
+{
+  struct sha3_ctx ctx;
+
+  shake256_init (&ctx);
+  sha3_update (&ctx, input, inputlen);
+  shake_final (output, outputlen, &ctx);
+}
+
+/*
+ * Absorbs inputlen bytes of each of the four inputs and the padding. The
+ * permutation after the last block is left to the squeezing.
+ */
+static void
+sha3_x4_absorb (struct shake_x4_ctx *ctx, size_t rate, uint8_t suffix,
+                const uint8_t *const *inputs, size_t inputlen)
+{
+  uint8_t block[SHAKE128_BLOCK_SIZE];
+  size_t i, j, off;
+
+  memset (ctx->state, 0, sizeof (ctx->state));
+  ctx->rate = rate;
+
+  for (off = 0; inputlen - off >= rate; off += rate)
+    {
+      for (j = 0; j < 4; ++j)
+        for (i = 0; i < rate / 8; ++i)
+          ctx->state[i * 4 + j] ^= buff_get_le64 (inputs[j] + off + i * 8);
+      sha3_x4_backend->permute (ctx->state);
+    }
+
+  for (j = 0; j < 4; ++j)
+    {
+      memset (block, 0, rate);
+      memcpy (block, inputs[j] + off, inputlen - off);
+      block[inputlen - off] = suffix;
+      block[rate - 1] |= 0x80;
+      for (i = 0; i < rate / 8; ++i)
+        ctx->state[i * 4 + j] ^= buff_get_le64 (block + i * 8);
+    }
+  fcrypt_wipe (block, sizeof (block));
+}
+
+void
+shake128_x4_absorb (struct shake_x4_ctx *ctx, const uint8_t *const *inputs,
+                    size_t inputlen)
+{
+  sha3_x4_absorb (ctx, SHAKE128_BLOCK_SIZE, SHAKE_SUFFIX, inputs, inputlen);
+}
+
+void
+shake256_x4_absorb (struct shake_x4_ctx *ctx, const uint8_t *const *inputs,
+                    size_t inputlen)
+{
+  sha3_x4_absorb (ctx, SHAKE256_BLOCK_SIZE, SHAKE_SUFFIX, inputs, inputlen);
+}
+
+void
+shake_x4_squeezeblocks (struct shake_x4_ctx *ctx, uint8_t *const *outputs,
+                        size_t blocks)
+{
+  size_t b, i, j;
+
+  for (b = 0; b < blocks; ++b)
+    {
+      sha3_x4_backend->permute (ctx->state);
+      for (j = 0; j < 4; ++j)
+        for (i = 0; i < ctx->rate / 8; ++i)
+          buff_put_le64 (outputs[j] + b * ctx->rate + i * 8,
+                         ctx->state[i * 4 + j]);
+    }
+}
+
+/* Squeezes outputlen bytes of each instance, then clears the context. */
+static void
+sha3_x4_output (struct shake_x4_ctx *ctx, uint8_t *const *outputs,
+                size_t outputlen)
+{
+  uint8_t last[4][SHAKE128_BLOCK_SIZE];
+  uint8_t *tail[4];
+  size_t blocks, j;
+
+  blocks = outputlen / ctx->rate;
+  shake_x4_squeezeblocks (ctx, outputs, blocks);
+  outputlen -= blocks * ctx->rate;
+  if (outputlen != 0)
+    {
+      for (j = 0; j < 4; ++j)
+        tail[j] = last[j];
+      shake_x4_squeezeblocks (ctx, tail, 1);
+      for (j = 0; j < 4; ++j)
+        memcpy (outputs[j] + blocks * ctx->rate, last[j], outputlen);
+      fcrypt_wipe (last, sizeof (last));
+    }
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+shake128_x4 (uint8_t *const *outputs, size_t outputlen,
+             const uint8_t *const *inputs, size_t inputlen)
+{
+  struct shake_x4_ctx ctx;
+
+  shake128_x4_absorb (&ctx, inputs, inputlen);
+  sha3_x4_output (&ctx, outputs, outputlen);
+}
+
+void
+shake256_x4 (uint8_t *const *outputs, size_t outputlen,
+             const uint8_t *const *inputs, size_t inputlen)
+{
+  struct shake_x4_ctx ctx;
+
+  shake256_x4_absorb (&ctx, inputs, inputlen);
+  sha3_x4_output (&ctx, outputs, outputlen);
+}
+
+void
+sha3_256_x4 (uint8_t *const *digests, const uint8_t *const *inputs,
+             size_t inputlen)
+{
+  struct shake_x4_ctx ctx;
+
+  sha3_x4_absorb (&ctx, SHA3_256_BLOCK_SIZE, SHA3_SUFFIX, inputs, inputlen);
+  sha3_x4_output (&ctx, digests, SHA3_256_DIGEST_SIZE);
+}
@@ -0,0 +1,117 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef SHA3_H
+#define SHA3_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct iovec;
+
+#define SHA3_224_DIGEST_SIZE 28
+#define SHA3_224_BLOCK_SIZE 144
+
+#define SHA3_256_DIGEST_SIZE 32
+#define SHA3_256_BLOCK_SIZE 136
+
+#define SHA3_384_DIGEST_SIZE 48
+#define SHA3_384_BLOCK_SIZE 104
+
+#define SHA3_512_DIGEST_SIZE 64
+#define SHA3_512_BLOCK_SIZE 72
+
+#define SHAKE128_BLOCK_SIZE 168
+#define SHAKE256_BLOCK_SIZE 136
+
+/* Shared by SHA-3 and SHAKE, which only differ in the rate and padding. */
+struct sha3_ctx
+{
+  uint64_t state[25];   /* Keccak-f[1600] state */
+  size_t rate;          /* Block size in bytes */
+  size_t pos;           /* Bytes absorbed or squeezed in this block */
+  size_t digest_size;   /* Zero for SHAKE */
+  uint8_t suffix;       /* Domain separation and first padding bit */
+  int squeezing;        /* Set once the padding has been absorbed */
+};
+
+/* Keccak-f[1600] on the 25 lanes, little-endian as in FIPS 202. */
+void keccak_f1600 (uint64_t *);
+
+/* SHA-3 */
+void sha3_224_init (struct sha3_ctx *);
+void sha3_256_init (struct sha3_ctx *);
+void sha3_384_init (struct sha3_ctx *);
+void sha3_512_init (struct sha3_ctx *);
+void sha3_update (struct sha3_ctx *, const void *, size_t);
+void sha3_updatev (struct sha3_ctx *, const struct iovec *, size_t);
+void sha3_final (uint8_t *, struct sha3_ctx *);
+void sha3_copy (struct sha3_ctx *, const struct sha3_ctx *);
+void sha3_224 (uint8_t *, const void *, size_t);
+void sha3_256 (uint8_t *, const void *, size_t);
+void sha3_384 (uint8_t *, const void *, size_t);
+void sha3_512 (uint8_t *, const void *, size_t);
+
+/*
+ * SHAKE. After the input, shake_squeeze can be called any number of times
+ * to read the output in pieces; shake_final reads the last piece and clears
+ * the context.
+ */
+void shake128_init (struct sha3_ctx *);
+void shake256_init (struct sha3_ctx *);
+void shake_update (struct sha3_ctx *, const void *, size_t);
+void shake_updatev (struct sha3_ctx *, const struct iovec *, size_t);
+void shake_squeeze (struct sha3_ctx *, uint8_t *, size_t);
+void shake_final (uint8_t *, size_t, struct sha3_ctx *);
+void shake128 (uint8_t *, size_t, const void *, size_t);
+void shake256 (uint8_t *, size_t, const void *, size_t);
+
+/*
+ * Four instances side by side, for expanding several seeds at once as in
+ * lattice signature schemes. All four inputs have the same length. The
+ * state is the four instances interleaved lane by lane, so that SIMD code
+ * can permute them together.
+ */
+struct shake_x4_ctx
+{
+  uint64_t state[4 * 25]; /* Lane i of instance j in state[i * 4 + j] */
+  size_t rate;            /* Block size in bytes */
+};
+
+/* Absorbs the whole input of each instance and its padding. */
+void shake128_x4_absorb (struct shake_x4_ctx *, const uint8_t *const *,
+                         size_t);
+void shake256_x4_absorb (struct shake_x4_ctx *, const uint8_t *const *,
+                         size_t);
+
+/* Writes the next blocks of rate bytes of each instance. */
+void shake_x4_squeezeblocks (struct shake_x4_ctx *, uint8_t *const *,
+                             size_t);
+
+void shake128_x4 (uint8_t *const *, size_t, const uint8_t *const *, size_t);
+void shake256_x4 (uint8_t *const *, size_t, const uint8_t *const *, size_t);
+void sha3_256_x4 (uint8_t *const *, const uint8_t *const *, size_t);
+
+#endif /* SHA3_H */
@@ -0,0 +1,143 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SHA-512 using the ARMv8.2 SHA512 instructions. SHA512H and SHA512H2 do two
+ * rounds on 128-bit registers that each hold a pair of state words, and
+ * SHA512SU0 and SHA512SU1 compute two words of the message schedule. The
+ * round structure is the one used by the Linux kernel in sha512-ce-core.S.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha512-internal.h"
+#include "sha512.h"
+
+#if defined(HAVE_ARM_SHA512_INTRINSICS)
+
+#include <arm_neon.h>
+
+#define ARMV8_TARGET __attribute__ ((target (ARM_SHA512_TARGET_ATTRIBUTE)))
+
+/*
+ * Rounds 2 * k and 2 * k + 1 with s0 to s3 holding the pairs ab, cd, ef
+ * and gh. The result is left with the roles of the five registers rotated,
+ * so that s3, s0, s4 and s2 hold the next ab, cd, ef and gh. For the first
+ * 32 pairs, the schedule words in m0 are replaced with the ones needed 16
+ * rounds later, using the words in m1 and m7 and the words between m4 and m5.
+ */
+#define ARMV8_DROUND(k, m0, m1, m4, m5, m7)                                   \
+  do                                                                          \
+    {                                                                         \
+      uint64x2_t kw_, x_, y_;                                                 \
+                                                                              \
+      kw_ = vaddq_u64 (vld1q_u64 (&sha512_ktable[2 * (k)]), (m0));            \
+      x_ = vextq_u64 (s2, s3, 1);                                             \
+      y_ = vextq_u64 (s1, s2, 1);                                             \
+      s3 = vaddq_u64 (s3, vextq_u64 (kw_, kw_, 1));                           \
+      s3 = vsha512hq_u64 (s3, x_, y_);                                        \
+      s4 = vaddq_u64 (s1, s3);                                                \
+      s3 = vsha512h2q_u64 (s3, s1, s0);                                       \
+      if ((k) < 32)                                                           \
+        (m0) = vsha512su1q_u64 (vsha512su0q_u64 ((m0), (m1)), (m7),           \
+                                vextq_u64 ((m4), (m5), 1));                   \
+      x_ = s0;                                                                \
+      s0 = s3;                                                                \
+      s3 = s2;                                                                \
+      s2 = s4;                                                                \
+      s4 = s1;                                                                \
+      s1 = x_;                                                                \
+    }                                                                         \
+  while (0)
+
+ARMV8_TARGET static void
+sha512_compress_armv8 (uint64_t *state, const uint8_t *data, size_t blocks)
+{
+  uint64x2_t s0, s1, s2, s3, s4, save0, save1, save2, save3;
+  uint64x2_t m0, m1, m2, m3, m4, m5, m6, m7;
+  unsigned int k;
+
+  s0 = vld1q_u64 (&state[0]);
+  s1 = vld1q_u64 (&state[2]);
+  s2 = vld1q_u64 (&state[4]);
+  s3 = vld1q_u64 (&state[6]);
+  s4 = vdupq_n_u64 (0);
+
+  for (; blocks > 0; --blocks)
+    {
+      save0 = s0;
+      save1 = s1;
+      save2 = s2;
+      save3 = s3;
+
+      m0 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data)));
+      m1 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data + 16)));
+      m2 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data + 32)));
+      m3 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data + 48)));
+      m4 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data + 64)));
+      m5 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data + 80)));
+      m6 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data + 96)));
+      m7 = vreinterpretq_u64_u8 (vrev64q_u8 (vld1q_u8 (data + 112)));
+
+      /* The roles of s0 to s4 repeat every five pairs, 40 in all. */
+      for (k = 0; k < 40; k += 8)
+        {
+          ARMV8_DROUND (k, m0, m1, m4, m5, m7);
+          ARMV8_DROUND (k + 1, m1, m2, m5, m6, m0);
+          ARMV8_DROUND (k + 2, m2, m3, m6, m7, m1);
+          ARMV8_DROUND (k + 3, m3, m4, m7, m0, m2);
+          ARMV8_DROUND (k + 4, m4, m5, m0, m1, m3);
+          ARMV8_DROUND (k + 5, m5, m6, m1, m2, m4);
+          ARMV8_DROUND (k + 6, m6, m7, m2, m3, m5);
+          ARMV8_DROUND (k + 7, m7, m0, m3, m4, m6);
+        }
+
+      s0 = vaddq_u64 (s0, save0);
+      s1 = vaddq_u64 (s1, save1);
+      s2 = vaddq_u64 (s2, save2);
+      s3 = vaddq_u64 (s3, save3);
+      data += SHA512_BLOCK_SIZE;
+    }
+
+  vst1q_u64 (&state[0], s0);
+  vst1q_u64 (&state[2], s1);
+  vst1q_u64 (&state[4], s2);
+  vst1q_u64 (&state[6], s3);
+}
+
+const struct sha512_backend sha512_backend_armv8 = {
+  "armv8",
+  sha512_compress_armv8,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha512_armv8_unused;
+
+#endif /* HAVE_ARM_SHA512_INTRINSICS */
@@ -0,0 +1,215 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SHA-512 with the message schedule computed by AVX2, four words at a time.
+ * The rounds themselves are serial and stay on the general purpose
+ * registers, reading the words with the round constants already added. The
+ * recurrence needs w[i - 2], so the sigma1 term of the two upper words is
+ * only added once the two lower words are known.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "circularshift.h"
+#include "sha512-internal.h"
+#include "sha512.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_ROTR64(x, n)                                                     \
+  _mm256_or_si256 (_mm256_srli_epi64 ((x), (n)),                              \
+                   _mm256_slli_epi64 ((x), 64 - (n)))
+#define AVX2_sigma0(x)                                                        \
+  _mm256_xor_si256 (_mm256_xor_si256 (AVX2_ROTR64 ((x), 1),                   \
+                                      AVX2_ROTR64 ((x), 8)),                  \
+                    _mm256_srli_epi64 ((x), 7))
+#define AVX2_sigma1(x)                                                        \
+  _mm256_xor_si256 (_mm256_xor_si256 (AVX2_ROTR64 ((x), 19),                  \
+                                      AVX2_ROTR64 ((x), 61)),                 \
+                    _mm256_srli_epi64 ((x), 6))
+
+#define Ch(b, c, d) ((d) ^ ((b) & ((c) ^ (d))))
+#define Maj(b, c, d) (((b) & (c)) | ((d) & ((b) | (c))))
+#define Sigma0(x) (rotr64 ((x), 28) ^ rotr64 ((x), 34) ^ rotr64 ((x), 39))
+#define Sigma1(x) (rotr64 ((x), 14) ^ rotr64 ((x), 18) ^ rotr64 ((x), 41))
+
+#define AVX2_ROUND(a, b, c, d, e, f, g, h, i)                                 \
+  do                                                                          \
+    {                                                                         \
+      uint64_t t1_;                                                           \
+                                                                              \
+      t1_ = (h) + Sigma1 (e) + Ch ((e), (f), (g)) + wk[(i)];                  \
+      (d) += t1_;                                                             \
+      (h) = t1_ + Sigma0 (a) + Maj ((a), (b), (c));                           \
+    }                                                                         \
+  while (0)
+
+/* Words 1 to 4 of the eight words in x:y. */
+AVX2_TARGET static inline __m256i
+avx2_shift_word (__m256i x, __m256i y)
+{
+  return _mm256_alignr_epi8 (_mm256_permute2x128_si256 (x, y, 0x21), x, 8);
+}
+
+/*
+ * Computes the next four words of the message schedule from the last
+ * sixteen in x0 to x3, shifts them in and stores them plus the round
+ * constants at wk[i].
+ */
+#define AVX2_SCHEDULE(i)                                                      \
+  do                                                                          \
+    {                                                                         \
+      __m256i t_, s_;                                                         \
+                                                                              \
+      /* w[i - 16] + sigma0 (w[i - 15]) + w[i - 7] for all four words. */     \
+      t_ = _mm256_add_epi64 (                                                 \
+          _mm256_add_epi64 (x0, AVX2_sigma0 (avx2_shift_word (x0, x1))),      \
+          avx2_shift_word (x2, x3));                                          \
+                                                                              \
+      /* sigma1 (w[i - 2]) for the two lower words. */                        \
+      s_ = AVX2_sigma1 (_mm256_permute2x128_si256 (x3, x3, 0x11));            \
+      t_ = _mm256_add_epi64 (t_, _mm256_permute2x128_si256 (s_, s_, 0x80));   \
+                                                                              \
+      /* sigma1 of the two new lower words for the upper ones. */             \
+      s_ = AVX2_sigma1 (t_);                                                  \
+      t_ = _mm256_add_epi64 (t_, _mm256_permute2x128_si256 (s_, s_, 0x08));   \
+                                                                              \
+      x0 = x1;                                                                \
+      x1 = x2;                                                                \
+      x2 = x3;                                                                \
+      x3 = t_;                                                                \
+      AVX2_STORE_WK ((i), t_);                                                \
+    }                                                                         \
+  while (0)
+
+#define AVX2_STORE_WK(i, x)                                                   \
+  _mm256_storeu_si256 (                                                       \
+      (__m256i *)(wk + (i)),                                                  \
+      _mm256_add_epi64 ((x), _mm256_loadu_si256 (                             \
+                                 (const __m256i *)(sha512_ktable + (i)))))
+
+AVX2_TARGET static void
+sha512_compress_avx2 (uint64_t *state, const uint8_t *data, size_t blocks)
+{
+  const __m256i mask = _mm256_set_epi8 (
+      8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+      13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+  uint64_t a, b, c, d, e, f, g, h;
+  uint64_t wk[80];
+  __m256i x0, x1, x2, x3;
+  unsigned int i;
+
+  a = state[0];
+  b = state[1];
+  c = state[2];
+  d = state[3];
+  e = state[4];
+  f = state[5];
+  g = state[6];
+  h = state[7];
+
+  for (; blocks > 0; --blocks)
+    {
+      x0 = _mm256_shuffle_epi8 (
+          _mm256_loadu_si256 ((const __m256i *)data), mask);
+      x1 = _mm256_shuffle_epi8 (
+          _mm256_loadu_si256 ((const __m256i *)(data + 32)), mask);
+      x2 = _mm256_shuffle_epi8 (
+          _mm256_loadu_si256 ((const __m256i *)(data + 64)), mask);
+      x3 = _mm256_shuffle_epi8 (
+          _mm256_loadu_si256 ((const __m256i *)(data + 96)), mask);
+      AVX2_STORE_WK (0, x0);
+      AVX2_STORE_WK (4, x1);
+      AVX2_STORE_WK (8, x2);
+      AVX2_STORE_WK (12, x3);
+
+      /*
+       * The schedule runs 16 words ahead of the rounds, so the vector and
+       * scalar work of each iteration are independent and can overlap.
+       */
+      for (i = 0; i < 64; i += 8)
+        {
+          AVX2_SCHEDULE (i + 16);
+          AVX2_ROUND (a, b, c, d, e, f, g, h, i);
+          AVX2_ROUND (h, a, b, c, d, e, f, g, i + 1);
+          AVX2_ROUND (g, h, a, b, c, d, e, f, i + 2);
+          AVX2_ROUND (f, g, h, a, b, c, d, e, i + 3);
+          AVX2_SCHEDULE (i + 20);
+          AVX2_ROUND (e, f, g, h, a, b, c, d, i + 4);
+          AVX2_ROUND (d, e, f, g, h, a, b, c, i + 5);
+          AVX2_ROUND (c, d, e, f, g, h, a, b, i + 6);
+          AVX2_ROUND (b, c, d, e, f, g, h, a, i + 7);
+        }
+      for (; i < 80; i += 8)
+        {
+          AVX2_ROUND (a, b, c, d, e, f, g, h, i);
+          AVX2_ROUND (h, a, b, c, d, e, f, g, i + 1);
+          AVX2_ROUND (g, h, a, b, c, d, e, f, i + 2);
+          AVX2_ROUND (f, g, h, a, b, c, d, e, i + 3);
+          AVX2_ROUND (e, f, g, h, a, b, c, d, i + 4);
+          AVX2_ROUND (d, e, f, g, h, a, b, c, i + 5);
+          AVX2_ROUND (c, d, e, f, g, h, a, b, i + 6);
+          AVX2_ROUND (b, c, d, e, f, g, h, a, i + 7);
+        }
+
+      a += state[0];
+      b += state[1];
+      c += state[2];
+      d += state[3];
+      e += state[4];
+      f += state[5];
+      g += state[6];
+      h += state[7];
+      state[0] = a;
+      state[1] = b;
+      state[2] = c;
+      state[3] = d;
+      state[4] = e;
+      state[5] = f;
+      state[6] = g;
+      state[7] = h;
+      data += SHA512_BLOCK_SIZE;
+    }
+}
+
+const struct sha512_backend sha512_backend_avx2 = {
+  "avx2",
+  sha512_compress_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sha512_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
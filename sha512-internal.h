@@ -0,0 +1,63 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between sha512.c and the instruction set specific SHA-512
+ * compression functions, shared by SHA-384. The state is the eight words of
+ * the hash and the input is a whole number of 128-byte blocks.
+ */
+
+#ifndef SHA512_INTERNAL_H
+#define SHA512_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct sha512_backend
+{
+  const char *name;
+  void (*compress) (uint64_t *, const uint8_t *, size_t);
+};
+
+/* Round constants from FIPS 180-4, shared with the backends. */
+extern const uint64_t sha512_ktable[80];
+
+/* Portable implementation in sha512.c, always available. */
+extern const struct sha512_backend sha512_backend_generic;
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* AVX2 message schedule in sha512-avx2.c. */
+extern const struct sha512_backend sha512_backend_avx2;
+#endif
+
+#if defined(HAVE_ARM_SHA512_INTRINSICS)
+/* ARMv8.2 SHA512H implementation in sha512-armv8.c. */
+extern const struct sha512_backend sha512_backend_armv8;
+#endif
+
+/* Name of the backend picked for this CPU, for fcrypt_hash_backend. */
+const char *sha512_backend_name (void);
+
+#endif /* SHA512_INTERNAL_H */
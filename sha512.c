@@ -23,12 +23,18 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "bswap.h"
 #include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_wipe.h"
+#include "sha512-internal.h"
 #include "sha512.h"
 
 /* Functions used by SHA-384 and SHA-512. */
@@ -41,7 +47,7 @@
 
 /* Constant values used by SHA-384 and SHA-512. */
 #define K(x) (sha512_ktable[(x)])
-static const uint64_t sha512_ktable[80]
+const uint64_t sha512_ktable[80]
     = { 0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f,
         0xe9b5dba58189dbbc, 0x3956c25bf348b538, 0x59f111f1b605d019,
         0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242,
@@ -85,18 +91,17 @@ sha512_init (struct sha512_ctx *ctx)
   ctx->count[1] = 0;
 }
 
-void
-sha512_transform (uint64_t *state, const uint8_t *block)
+/*
+ * Compresses blocks with the state kept in registers between them. Only the
+ * last 16 words of the message schedule are needed, so w is updated in place.
+ */
+static void
+sha512_compress_generic (uint64_t *state, const uint8_t *data, size_t blocks)
 {
   uint64_t a, b, c, d, e, f, g, h, t1, t2;
-  uint64_t w[80];
+  uint64_t w[16];
   uint32_t i;
 
-  for (i = 0; i < 16; ++i)
-    w[i] = buff_get_be64 (block + i * 8);
-  for (i = 16; i < 80; ++i)
-    w[i] = sigma1 (w[i - 2]) + w[i - 7] + sigma0 (w[i - 15]) + w[i - 16];
-
   a = state[0];
   b = state[1];
   c = state[2];
@@ -106,34 +111,101 @@ sha512_transform (uint64_t *state, const uint8_t *block)
   g = state[6];
   h = state[7];
 
-  for (i = 0; i < 80; ++i)
+  for (; blocks > 0; --blocks)
     {
-      t1 = h + Sigma1 (e) + Ch (e, f, g) + K (i) + w[i];
-      t2 = Sigma0 (a) + Maj (a, b, c);
-      h = g;
-      g = f;
-      f = e;
-      e = d + t1;
-      d = c;
-      c = b;
-      b = a;
-      a = t1 + t2;
+      buff_get_be64_words (w, data, 16);
+
+      for (i = 0; i < 80; ++i)
+        {
+          if (i >= 16)
+            w[i & 15] += sigma1 (w[(i - 2) & 15]) + w[(i - 7) & 15]
+                         + sigma0 (w[(i - 15) & 15]);
+          t1 = h + Sigma1 (e) + Ch (e, f, g) + K (i) + w[i & 15];
+          t2 = Sigma0 (a) + Maj (a, b, c);
+          h = g;
+          g = f;
+          f = e;
+          e = d + t1;
+          d = c;
+          c = b;
+          b = a;
+          a = t1 + t2;
+        }
+
+      a += state[0];
+      b += state[1];
+      c += state[2];
+      d += state[3];
+      e += state[4];
+      f += state[5];
+      g += state[6];
+      h += state[7];
+      state[0] = a;
+      state[1] = b;
+      state[2] = c;
+      state[3] = d;
+      state[4] = e;
+      state[5] = f;
+      state[6] = g;
+      state[7] = h;
+      data += SHA512_BLOCK_SIZE;
     }
+}
+
+const struct sha512_backend sha512_backend_generic = {
+  "generic",
+  sha512_compress_generic,
+};
+
+/*
+ * The implementation is picked once when the library is loaded. Compilers
+ * without constructor support always use the portable code.
+ */
+static const struct sha512_backend *sha512_backend = &sha512_backend_generic;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+sha512_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    sha512_backend = &sha512_backend_avx2;
+#endif
+#if defined(HAVE_ARM_SHA512_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_SHA512) != 0)
+    sha512_backend = &sha512_backend_armv8;
+#endif
+}
+#endif /* __GNUC__ */
 
-  state[0] += a;
-  state[1] += b;
-  state[2] += c;
-  state[3] += d;
-  state[4] += e;
-  state[5] += f;
-  state[6] += g;
-  state[7] += h;
+const char *
+sha512_backend_name (void)
+{
+  return sha512_backend->name;
+}
+
+void
+sha512_transform (uint64_t *state, const uint8_t *block)
+{
+  sha512_backend->compress (state, block, 1);
+}
+
+void
+sha512_transform_blocks (uint64_t *state, const uint8_t *blocks,
+                         size_t nblocks)
+{
+  if (nblocks != 0)
+    sha512_backend->compress (state, blocks, nblocks);
 }
 
 void
 sha512_update (struct sha512_ctx *ctx, const void *inputptr, size_t inputlen)
 {
-  size_t filled, need;
+  size_t filled, need, blocks;
   uint64_t increment;
   const uint8_t *input = inputptr;
 
@@ -164,11 +236,12 @@ sha512_update (struct sha512_ctx *ctx, const void *inputptr, size_t inputlen)
     }
 
   /* Handle as many blocks as possible. */
-  while (inputlen >= SHA512_BLOCK_SIZE)
+  if (inputlen >= SHA512_BLOCK_SIZE)
     {
-      sha512_transform (ctx->state, input);
-      inputlen -= SHA512_BLOCK_SIZE;
-      input += SHA512_BLOCK_SIZE;
+      blocks = inputlen / SHA512_BLOCK_SIZE;
+      sha512_backend->compress (ctx->state, input, blocks);
+      inputlen -= blocks * SHA512_BLOCK_SIZE;
+      input += blocks * SHA512_BLOCK_SIZE;
     }
 
   /* Save any remaining bytes. */
@@ -176,6 +249,15 @@ sha512_update (struct sha512_ctx *ctx, const void *inputptr, size_t inputlen)
     memcpy (ctx->buffer, input, inputlen);
 }
 
+void
+sha512_updatev (struct sha512_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    sha512_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
 /*
  * Internal function used by both SHA-384 and SHA-512. Pads the buffer to
  * 896 bits (112 bytes) so that the 128-bit length can be appended to the end.
@@ -214,7 +296,13 @@ sha512_final (uint8_t *digest, struct sha512_ctx *ctx)
 
   for (i = 0; i < 8; ++i)
     buff_put_be64 (digest + i * 8, ctx->state[i]);
-  memset (ctx, 0, sizeof (*ctx));
+  fcrypt_wipe (ctx, sizeof (*ctx));
+}
+
+void
+sha512_copy (struct sha512_ctx *dst, const struct sha512_ctx *src)
+{
+  *dst = *src;
 }
 
 void
@@ -235,8 +323,16 @@ sha384_init (struct sha512_ctx *ctx)
 void
 sha384_transform (uint64_t *state, const uint8_t *block)
 {
-  /* Same as SHA-512. */
-  sha512_transform (state, block);
+  /* Same compression function as SHA-512. */
+  sha512_backend->compress (state, block, 1);
+}
+
+void
+sha384_transform_blocks (uint64_t *state, const uint8_t *blocks,
+                         size_t nblocks)
+{
+  if (nblocks != 0)
+    sha512_backend->compress (state, blocks, nblocks);
 }
 
 void
@@ -246,6 +342,15 @@ sha384_update (struct sha512_ctx *ctx, const void *inputptr, size_t inputlen)
   sha512_update (ctx, inputptr, inputlen);
 }
 
+void
+sha384_updatev (struct sha512_ctx *ctx, const struct iovec *iov, size_t iovcnt)
+{
+  size_t i;
+
+  for (i = 0; i < iovcnt; ++i)
+    sha384_update (ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
 void
 sha384_final (uint8_t *digest, struct sha512_ctx *ctx)
 {
@@ -255,5 +360,5 @@ sha384_final (uint8_t *digest, struct sha512_ctx *ctx)
 
   for (i = 0; i < 6; ++i)
     buff_put_be64 (digest + i * 8, ctx->state[i]);
-  memset (ctx, 0, sizeof (*ctx));
+  fcrypt_wipe (ctx, sizeof (*ctx));
 }
@@ -29,6 +29,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct iovec;
+
 #define SHA512_DIGEST_SIZE 64
 #define SHA512_BLOCK_SIZE 128
 
@@ -45,13 +47,18 @@ struct sha512_ctx
 /* SHA-512 */
 void sha512_init (struct sha512_ctx *);
 void sha512_transform (uint64_t *, const uint8_t *);
+void sha512_transform_blocks (uint64_t *, const uint8_t *, size_t);
 void sha512_update (struct sha512_ctx *, const void *, size_t);
+void sha512_updatev (struct sha512_ctx *, const struct iovec *, size_t);
 void sha512_final (uint8_t *, struct sha512_ctx *);
+void sha512_copy (struct sha512_ctx *, const struct sha512_ctx *);
 
 /* SHA-384 */
 void sha384_init (struct sha512_ctx *);
 void sha384_transform (uint64_t *, const uint8_t *);
+void sha384_transform_blocks (uint64_t *, const uint8_t *, size_t);
 void sha384_update (struct sha512_ctx *, const void *, size_t);
+void sha384_updatev (struct sha512_ctx *, const struct iovec *, size_t);
 void sha384_final (uint8_t *, struct sha512_ctx *);
 
 #endif /* SHA512_H */
@@ -0,0 +1,147 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SipHash with AVX2, hashing four messages at a time with each register
+ * holding one state word of every message. The rotations by 32 and 16 bits
+ * are shuffles and the others shifts. Message words are gathered from each
+ * message with scalar loads, and lanes past the end of their message keep
+ * their state until the longest message is done.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "siphash-internal.h"
+#include "siphash.h"
+
+#if defined(HAVE_AVX2_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__ ((target (AVX2_TARGET_ATTRIBUTE)))
+
+#define AVX2_LANES 4
+
+#define AVX2_ROTL(x, n)                                                       \
+  _mm256_or_si256 (_mm256_slli_epi64 ((x), (n)),                              \
+                   _mm256_srli_epi64 ((x), 64 - (n)))
+#define AVX2_ROTL32(x) _mm256_shuffle_epi32 ((x), 0xb1)
+#define AVX2_ROTL16(x) _mm256_shuffle_epi8 ((x), rot16)
+
+#define AVX2_ROUND(v)                                                         \
+  do                                                                          \
+    {                                                                         \
+      (v)[0] = _mm256_add_epi64 ((v)[0], (v)[1]);                             \
+      (v)[1] = _mm256_xor_si256 (AVX2_ROTL ((v)[1], 13), (v)[0]);             \
+      (v)[0] = AVX2_ROTL32 ((v)[0]);                                          \
+      (v)[2] = _mm256_add_epi64 ((v)[2], (v)[3]);                             \
+      (v)[3] = _mm256_xor_si256 (AVX2_ROTL16 ((v)[3]), (v)[2]);               \
+      (v)[0] = _mm256_add_epi64 ((v)[0], (v)[3]);                             \
+      (v)[3] = _mm256_xor_si256 (AVX2_ROTL ((v)[3], 21), (v)[0]);             \
+      (v)[2] = _mm256_add_epi64 ((v)[2], (v)[1]);                             \
+      (v)[1] = _mm256_xor_si256 (AVX2_ROTL ((v)[1], 17), (v)[2]);             \
+      (v)[2] = AVX2_ROTL32 ((v)[2]);                                          \
+    }                                                                         \
+  while (0)
+
+AVX2_TARGET static void
+siphash_hash_avx2 (const uint64_t *init, const void *const *inputs,
+                   const size_t *lens, uint64_t *out, unsigned int crounds,
+                   unsigned int drounds)
+{
+  const __m256i rot16
+      = _mm256_setr_epi8 (6, 7, 0, 1, 2, 3, 4, 5, 14, 15, 8, 9, 10, 11, 12,
+                          13, 6, 7, 0, 1, 2, 3, 4, 5, 14, 15, 8, 9, 10, 11,
+                          12, 13);
+  const uint8_t *p[AVX2_LANES];
+  size_t nwords[AVX2_LANES];
+  __m256i v[4], old[4], m, words, active;
+  size_t i, j, minwords, maxwords;
+  unsigned int r;
+
+  /* Each message has one word per whole block and a final word. */
+  for (j = 0; j < AVX2_LANES; ++j)
+    {
+      p[j] = inputs[j];
+      nwords[j] = lens[j] / SIPHASH_BLOCK_SIZE + 1;
+    }
+  minwords = maxwords = nwords[0];
+  for (j = 1; j < AVX2_LANES; ++j)
+    {
+      minwords = nwords[j] < minwords ? nwords[j] : minwords;
+      maxwords = nwords[j] > maxwords ? nwords[j] : maxwords;
+    }
+  words = _mm256_setr_epi64x ((long long)nwords[0], (long long)nwords[1],
+                              (long long)nwords[2], (long long)nwords[3]);
+
+  for (j = 0; j < 4; ++j)
+    v[j] = _mm256_set1_epi64x ((long long)init[j]);
+
+  for (i = 0; i < maxwords; ++i)
+    {
+      m = _mm256_setr_epi64x (
+          (long long)siphash_message_word (p[0], lens[0], i),
+          (long long)siphash_message_word (p[1], lens[1], i),
+          (long long)siphash_message_word (p[2], lens[2], i),
+          (long long)siphash_message_word (p[3], lens[3], i));
+      for (j = 0; j < 4; ++j)
+        old[j] = v[j];
+      v[3] = _mm256_xor_si256 (v[3], m);
+      for (r = 0; r < crounds; ++r)
+        AVX2_ROUND (v);
+      v[0] = _mm256_xor_si256 (v[0], m);
+      /* Restore the lanes whose messages already ended. */
+      if (i >= minwords)
+        {
+          active
+              = _mm256_cmpgt_epi64 (words, _mm256_set1_epi64x ((long long)i));
+          for (j = 0; j < 4; ++j)
+            v[j] = _mm256_blendv_epi8 (old[j], v[j], active);
+        }
+    }
+
+  v[2] = _mm256_xor_si256 (v[2], _mm256_set1_epi64x (0xff));
+  for (r = 0; r < drounds; ++r)
+    AVX2_ROUND (v);
+  _mm256_storeu_si256 ((__m256i *)out,
+                       _mm256_xor_si256 (_mm256_xor_si256 (v[0], v[1]),
+                                         _mm256_xor_si256 (v[2], v[3])));
+}
+
+const struct siphash_backend siphash_backend_avx2 = {
+  "avx2",
+  AVX2_LANES,
+  siphash_hash_avx2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int siphash_avx2_unused;
+
+#endif /* HAVE_AVX2_INTRINSICS */
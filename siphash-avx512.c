@@ -0,0 +1,137 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * SipHash with AVX-512, hashing eight messages at a time with each register
+ * holding one state word of every message. AVX-512F has 64-bit rotates, so
+ * a round is fourteen instructions. Message words are gathered from each
+ * message with scalar loads, and lanes past the end of their message are
+ * masked off until the longest message is done.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "siphash-internal.h"
+#include "siphash.h"
+
+#if defined(HAVE_AVX512_INTRINSICS)
+
+#include <immintrin.h>
+
+#define AVX512_TARGET __attribute__ ((target (AVX512_TARGET_ATTRIBUTE)))
+
+#define AVX512_LANES 8
+
+#define AVX512_ROUND(v)                                                       \
+  do                                                                          \
+    {                                                                         \
+      (v)[0] = _mm512_add_epi64 ((v)[0], (v)[1]);                             \
+      (v)[1] = _mm512_xor_si512 (_mm512_rol_epi64 ((v)[1], 13), (v)[0]);      \
+      (v)[0] = _mm512_rol_epi64 ((v)[0], 32);                                 \
+      (v)[2] = _mm512_add_epi64 ((v)[2], (v)[3]);                             \
+      (v)[3] = _mm512_xor_si512 (_mm512_rol_epi64 ((v)[3], 16), (v)[2]);      \
+      (v)[0] = _mm512_add_epi64 ((v)[0], (v)[3]);                             \
+      (v)[3] = _mm512_xor_si512 (_mm512_rol_epi64 ((v)[3], 21), (v)[0]);      \
+      (v)[2] = _mm512_add_epi64 ((v)[2], (v)[1]);                             \
+      (v)[1] = _mm512_xor_si512 (_mm512_rol_epi64 ((v)[1], 17), (v)[2]);      \
+      (v)[2] = _mm512_rol_epi64 ((v)[2], 32);                                 \
+    }                                                                         \
+  while (0)
+
+AVX512_TARGET static void
+siphash_hash_avx512 (const uint64_t *init, const void *const *inputs,
+                     const size_t *lens, uint64_t *out, unsigned int crounds,
+                     unsigned int drounds)
+{
+  const uint8_t *p[AVX512_LANES];
+  size_t nwords[AVX512_LANES];
+  uint64_t w[AVX512_LANES];
+  __m512i v[4], old[4], m, words;
+  __mmask8 active;
+  size_t i, j, minwords, maxwords;
+  unsigned int r;
+
+  /* Each message has one word per whole block and a final word. */
+  for (j = 0; j < AVX512_LANES; ++j)
+    {
+      p[j] = inputs[j];
+      nwords[j] = lens[j] / SIPHASH_BLOCK_SIZE + 1;
+      w[j] = nwords[j];
+    }
+  minwords = maxwords = nwords[0];
+  for (j = 1; j < AVX512_LANES; ++j)
+    {
+      minwords = nwords[j] < minwords ? nwords[j] : minwords;
+      maxwords = nwords[j] > maxwords ? nwords[j] : maxwords;
+    }
+  words = _mm512_loadu_si512 (w);
+
+  for (j = 0; j < 4; ++j)
+    v[j] = _mm512_set1_epi64 ((long long)init[j]);
+
+  for (i = 0; i < maxwords; ++i)
+    {
+      for (j = 0; j < AVX512_LANES; ++j)
+        w[j] = siphash_message_word (p[j], lens[j], i);
+      m = _mm512_loadu_si512 (w);
+      for (j = 0; j < 4; ++j)
+        old[j] = v[j];
+      v[3] = _mm512_xor_si512 (v[3], m);
+      for (r = 0; r < crounds; ++r)
+        AVX512_ROUND (v);
+      v[0] = _mm512_xor_si512 (v[0], m);
+      /* Restore the lanes whose messages already ended. */
+      if (i >= minwords)
+        {
+          active = _mm512_cmpgt_epu64_mask (
+              words, _mm512_set1_epi64 ((long long)i));
+          for (j = 0; j < 4; ++j)
+            v[j] = _mm512_mask_blend_epi64 (active, old[j], v[j]);
+        }
+    }
+
+  v[2] = _mm512_xor_si512 (v[2], _mm512_set1_epi64 (0xff));
+  for (r = 0; r < drounds; ++r)
+    AVX512_ROUND (v);
+  _mm512_storeu_si512 (out, _mm512_ternarylogic_epi64 (
+                                _mm512_xor_si512 (v[0], v[1]), v[2], v[3],
+                                0x96));
+}
+
+const struct siphash_backend siphash_backend_avx512 = {
+  "avx512",
+  AVX512_LANES,
+  siphash_hash_avx512,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int siphash_avx512_unused;
+
+#endif /* HAVE_AVX512_INTRINSICS */
@@ -0,0 +1,125 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between siphash.c and the vector SipHash implementations used
+ * for batches of messages. A backend hashes as many independent messages as
+ * it has lanes, starting from the keyed state computed once per batch.
+ * Lanes whose messages have fewer blocks are masked off until the rest
+ * catch up, so the messages may have any lengths.
+ */
+
+#ifndef SIPHASH_INTERNAL_H
+#define SIPHASH_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bswap.h"
+#include "siphash.h"
+
+/* Most messages any backend hashes at once. */
+#define SIPHASH_MAX_WIDTH 8
+
+struct siphash_backend
+{
+  const char *name;
+  size_t width;
+  /*
+   * Hashes width messages with the given round counts into out, starting
+   * from the four word state.
+   */
+  void (*hash) (const uint64_t *, const void *const *, const size_t *,
+                uint64_t *, unsigned int, unsigned int);
+};
+
+/* Loads the last len < 8 bytes of a message as a little-endian word. */
+static inline uint64_t
+siphash_load_tail (const uint8_t *input, size_t len)
+{
+  uint64_t x;
+
+  x = 0;
+  switch (len)
+    {
+    case 7:
+      x |= ((uint64_t)input[6]) << 48;
+      /* FALLTHROUGH */
+    case 6:
+      x |= ((uint64_t)input[5]) << 40;
+      /* FALLTHROUGH */
+    case 5:
+      x |= ((uint64_t)input[4]) << 32;
+      /* FALLTHROUGH */
+    case 4:
+      x |= ((uint64_t)input[3]) << 24;
+      /* FALLTHROUGH */
+    case 3:
+      x |= ((uint64_t)input[2]) << 16;
+      /* FALLTHROUGH */
+    case 2:
+      x |= ((uint64_t)input[1]) << 8;
+      /* FALLTHROUGH */
+    case 1:
+      x |= ((uint64_t)input[0]);
+      /* FALLTHROUGH */
+    case 0:
+      /* FALLTHROUGH */
+    default:
+      break;
+    }
+  return x;
+}
+
+/*
+ * Returns message word i of a len byte message, where word len / 8 is the
+ * final one holding the length and the tail, and later words are zero.
+ */
+static inline uint64_t
+siphash_message_word (const uint8_t *input, size_t len, size_t i)
+{
+  size_t blocks;
+
+  blocks = len / SIPHASH_BLOCK_SIZE;
+  if (i < blocks)
+    return buff_get_le64 (input + i * SIPHASH_BLOCK_SIZE);
+  if (i > blocks)
+    return 0;
+  return ((uint64_t)len << 56)
+         | siphash_load_tail (input + blocks * SIPHASH_BLOCK_SIZE,
+                              len % SIPHASH_BLOCK_SIZE);
+}
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* Four messages at a time in siphash-avx2.c. */
+extern const struct siphash_backend siphash_backend_avx2;
+#endif
+
+#if defined(HAVE_AVX512_INTRINSICS)
+/* Eight messages at a time in siphash-avx512.c. */
+extern const struct siphash_backend siphash_backend_avx512;
+#endif
+
+#endif /* SIPHASH_INTERNAL_H */
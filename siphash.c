@@ -23,13 +23,17 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "bswap.h"
 #include "circularshift.h"
-#include "fcrypt_memzero.h"
+#include "fcrypt_cpu.h"
+#include "fcrypt_wipe.h"
+#include "siphash-internal.h"
 #include "siphash.h"
 
 #define SIPHASH_ROUND(v)                                                      \
@@ -52,35 +56,80 @@
     }                                                                         \
   while (0)
 
-void
-siphash_init (struct siphash_ctx *ctx, uint8_t digestlen, const uint8_t *key,
-              uint8_t crounds, uint8_t drounds)
+#define HALFSIPHASH_ROUND(v)                                                  \
+  do                                                                          \
+    {                                                                         \
+      (v)[0] += (v)[1];                                                       \
+      (v)[1] = rotl32 ((v)[1], 5);                                            \
+      (v)[1] ^= (v)[0];                                                       \
+      (v)[0] = rotl32 ((v)[0], 16);                                           \
+      (v)[2] += (v)[3];                                                       \
+      (v)[3] = rotl32 ((v)[3], 8);                                            \
+      (v)[3] ^= (v)[2];                                                       \
+      (v)[0] += (v)[3];                                                       \
+      (v)[3] = rotl32 ((v)[3], 7);                                            \
+      (v)[3] ^= (v)[0];                                                       \
+      (v)[2] += (v)[1];                                                       \
+      (v)[1] = rotl32 ((v)[1], 13);                                           \
+      (v)[1] ^= (v)[2];                                                       \
+      (v)[2] = rotl32 ((v)[2], 16);                                           \
+    }                                                                         \
+  while (0)
+
+/* Sets the state for a 16 byte key for either digest length. */
+static inline void
+siphash_key_state (uint64_t *v, const uint8_t *key)
 {
   uint64_t k0, k1;
 
   k0 = buff_get_le64 (key);
   k1 = buff_get_le64 (key + 8);
+  v[0] = 0x736f6d6570736575 ^ k0;
+  v[1] = 0x646f72616e646f6d ^ k1;
+  v[2] = 0x6c7967656e657261 ^ k0;
+  v[3] = 0x7465646279746573 ^ k1;
+}
 
-  ctx->state[0] = 0x736f6d6570736575 ^ k0;
-  ctx->state[1] = 0x646f72616e646f6d ^ k1;
-  ctx->state[2] = 0x6c7967656e657261 ^ k0;
-  ctx->state[3] = 0x7465646279746573 ^ k1;
+void
+siphash_set_key (struct siphash_key *key, uint8_t digestlen,
+                 const uint8_t *keybytes, uint8_t crounds, uint8_t drounds)
+{
+  siphash_key_state (key->state, keybytes);
 
   /*  Default to siphash-2-4. */
-  ctx->crounds = (crounds != 0) ? crounds : SIPHASH_C_ROUNDS;
-  ctx->drounds = (drounds != 0) ? drounds : SIPHASH_D_ROUNDS;
+  key->crounds = (crounds != 0) ? crounds : SIPHASH_C_ROUNDS;
+  key->drounds = (drounds != 0) ? drounds : SIPHASH_D_ROUNDS;
   if (digestlen != SIPHASH_MAX_DIGEST_SIZE)
-    ctx->digestlen = SIPHASH_MIN_DIGEST_SIZE;
+    key->digestlen = SIPHASH_MIN_DIGEST_SIZE;
   else
     {
-      ctx->digestlen = SIPHASH_MAX_DIGEST_SIZE;
-      ctx->state[1] ^= 0xee;
+      key->digestlen = SIPHASH_MAX_DIGEST_SIZE;
+      key->state[1] ^= 0xee;
     }
+}
 
+void
+siphash_init_key (struct siphash_ctx *ctx, const struct siphash_key *key)
+{
+  memcpy (ctx->state, key->state, sizeof (key->state));
+  ctx->digestlen = key->digestlen;
+  ctx->crounds = key->crounds;
+  ctx->drounds = key->drounds;
   ctx->bufferlen = 0;
   ctx->inputlen = 0;
 }
 
+void
+siphash_init (struct siphash_ctx *ctx, uint8_t digestlen, const uint8_t *key,
+              uint8_t crounds, uint8_t drounds)
+{
+  struct siphash_key prepared;
+
+  siphash_set_key (&prepared, digestlen, key, crounds, drounds);
+  siphash_init_key (ctx, &prepared);
+  fcrypt_wipe (&prepared, sizeof (prepared));
+}
+
 void
 siphash_update (struct siphash_ctx *ctx, const void *inputptr, size_t inputlen)
 {
@@ -143,36 +192,8 @@ siphash_final (uint8_t *digest, struct siphash_ctx *ctx)
   uint64_t x;
   uint32_t i;
 
-  x = ctx->inputlen << 56;
   /* Handle remaining bytes in buffer. */
-  switch (ctx->bufferlen)
-    {
-    case 7:
-      x |= ((uint64_t)ctx->buffer[6]) << 48;
-      /* FALLTHROUGH */
-    case 6:
-      x |= ((uint64_t)ctx->buffer[5]) << 40;
-      /* FALLTHROUGH */
-    case 5:
-      x |= ((uint64_t)ctx->buffer[4]) << 32;
-      /* FALLTHROUGH */
-    case 4:
-      x |= ((uint64_t)ctx->buffer[3]) << 24;
-      /* FALLTHROUGH */
-    case 3:
-      x |= ((uint64_t)ctx->buffer[2]) << 16;
-      /* FALLTHROUGH */
-    case 2:
-      x |= ((uint64_t)ctx->buffer[1]) << 8;
-      /* FALLTHROUGH */
-    case 1:
-      x |= ((uint64_t)ctx->buffer[0]);
-      /* FALLTHROUGH */
-    case 0:
-      /* FALLTHROUGH */
-    default:
-      break;
-    }
+  x = (ctx->inputlen << 56) | siphash_load_tail (ctx->buffer, ctx->bufferlen);
 
   ctx->state[3] ^= x;
   for (i = 0; i < ctx->crounds; ++i)
@@ -194,6 +215,219 @@ siphash_final (uint8_t *digest, struct siphash_ctx *ctx)
   x = ctx->state[0] ^ ctx->state[1] ^ ctx->state[2] ^ ctx->state[3];
   buff_put_le64 (digest + 8, x);
 cleanup:
-  fcrypt_memzero (ctx, sizeof (*ctx));
+  fcrypt_wipe (ctx, sizeof (*ctx));
   return;
 }
+
+void
+siphash_copy (struct siphash_ctx *dst, const struct siphash_ctx *src)
+{
+  *dst = *src;
+}
+
+/*
+ * One-shot SipHash with a 64-bit result, for short keys such as those of a
+ * hash table, starting from the keyed state in init. The state stays in
+ * registers and the round counts are constants at each call site, so the
+ * round loops are unrolled.
+ */
+static inline uint64_t
+siphash_oneshot (const uint64_t *init, const uint8_t *input, size_t len,
+                 unsigned int crounds, unsigned int drounds)
+{
+  uint64_t v[4], x;
+  const uint8_t *end;
+  unsigned int i;
+
+  v[0] = init[0];
+  v[1] = init[1];
+  v[2] = init[2];
+  v[3] = init[3];
+
+  end = input + (len & ~(size_t)(SIPHASH_BLOCK_SIZE - 1));
+  for (; input != end; input += SIPHASH_BLOCK_SIZE)
+    {
+      x = buff_get_le64 (input);
+      v[3] ^= x;
+      for (i = 0; i < crounds; ++i)
+        SIPHASH_ROUND (v);
+      v[0] ^= x;
+    }
+
+  x = ((uint64_t)len << 56)
+      | siphash_load_tail (input, len & (SIPHASH_BLOCK_SIZE - 1));
+  v[3] ^= x;
+  for (i = 0; i < crounds; ++i)
+    SIPHASH_ROUND (v);
+  v[0] ^= x;
+  v[2] ^= 0xff;
+  for (i = 0; i < drounds; ++i)
+    SIPHASH_ROUND (v);
+  return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+uint64_t
+siphash24 (const uint8_t *key, const void *input, size_t len)
+{
+  uint64_t v[4];
+
+  siphash_key_state (v, key);
+  return siphash_oneshot (v, input, len, 2, 4);
+}
+
+uint64_t
+siphash24_16 (const uint8_t *key, const void *input)
+{
+  uint64_t v[4];
+
+  siphash_key_state (v, key);
+  return siphash_oneshot (v, input, 16, 2, 4);
+}
+
+uint64_t
+siphash13 (const uint8_t *key, const void *input, size_t len)
+{
+  uint64_t v[4];
+
+  siphash_key_state (v, key);
+  return siphash_oneshot (v, input, len, 1, 3);
+}
+
+/*
+ * The 64-bit digests of SipHash-2-4 and SipHash-1-3 take the one-shot code
+ * with its unrolled rounds, and anything else the streaming code.
+ */
+void
+siphash_mac (uint8_t *digest, const struct siphash_key *key,
+             const void *input, size_t len)
+{
+  struct siphash_ctx ctx;
+
+  if (key->digestlen == SIPHASH_MIN_DIGEST_SIZE)
+    {
+      if (key->crounds == 2 && key->drounds == 4)
+        {
+          buff_put_le64 (digest,
+                         siphash_oneshot (key->state, input, len, 2, 4));
+          return;
+        }
+      if (key->crounds == 1 && key->drounds == 3)
+        {
+          buff_put_le64 (digest,
+                         siphash_oneshot (key->state, input, len, 1, 3));
+          return;
+        }
+    }
+  siphash_init_key (&ctx, key);
+  siphash_update (&ctx, input, len);
+  siphash_final (digest, &ctx);
+}
+
+static const struct siphash_backend *siphash_backends[2];
+static size_t siphash_nbackends = 0;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+siphash_select_backend (void)
+{
+  uint32_t features;
+  size_t n;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+  n = 0;
+#if defined(HAVE_AVX512_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX512F) != 0)
+    siphash_backends[n++] = &siphash_backend_avx512;
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    siphash_backends[n++] = &siphash_backend_avx2;
+#endif
+  siphash_nbackends = n;
+}
+#endif /* __GNUC__ */
+
+/*
+ * Hashes n messages with the same key. The keyed state is computed once and
+ * the messages are given to the widest backend in groups of its width, with
+ * what is left going to the next one and finally to the scalar code.
+ */
+static inline void
+siphash_batch (const uint8_t *key, const void *const *inputs,
+               const size_t *lens, uint64_t *out, size_t n,
+               unsigned int crounds, unsigned int drounds)
+{
+  const struct siphash_backend *backend;
+  uint64_t v[4];
+  size_t i, j;
+
+  siphash_key_state (v, key);
+  j = 0;
+  for (i = 0; i < siphash_nbackends; ++i)
+    {
+      backend = siphash_backends[i];
+      for (; n - j >= backend->width; j += backend->width)
+        backend->hash (v, inputs + j, lens + j, out + j, crounds, drounds);
+    }
+  for (; j < n; ++j)
+    out[j] = siphash_oneshot (v, inputs[j], lens[j], crounds, drounds);
+}
+
+void
+siphash24_batch (const uint8_t *key, const void *const *inputs,
+                 const size_t *lens, uint64_t *out, size_t n)
+{
+  siphash_batch (key, inputs, lens, out, n, 2, 4);
+}
+
+void
+siphash13_batch (const uint8_t *key, const void *const *inputs,
+                 const size_t *lens, uint64_t *out, size_t n)
+{
+  siphash_batch (key, inputs, lens, out, n, 1, 3);
+}
+
+/*
+ * HalfSipHash-2-4 with a 32-bit result. It works on 32-bit words, so it is
+ * the cheaper choice on 32-bit targets, at the cost of a smaller key and
+ * security margin.
+ */
+uint32_t
+halfsiphash24 (const uint8_t *key, const void *inputptr, size_t len)
+{
+  uint32_t v[4], k0, k1, x;
+  const uint8_t *input = inputptr;
+  const uint8_t *end;
+
+  k0 = buff_get_le32 (key);
+  k1 = buff_get_le32 (key + 4);
+  v[0] = k0;
+  v[1] = k1;
+  v[2] = 0x6c796765 ^ k0;
+  v[3] = 0x74656462 ^ k1;
+
+  end = input + (len & ~(size_t)(HALFSIPHASH_BLOCK_SIZE - 1));
+  for (; input != end; input += HALFSIPHASH_BLOCK_SIZE)
+    {
+      x = buff_get_le32 (input);
+      v[3] ^= x;
+      HALFSIPHASH_ROUND (v);
+      HALFSIPHASH_ROUND (v);
+      v[0] ^= x;
+    }
+
+  x = ((uint32_t)len << 24)
+      | (uint32_t)siphash_load_tail (input,
+                                     len & (HALFSIPHASH_BLOCK_SIZE - 1));
+  v[3] ^= x;
+  HALFSIPHASH_ROUND (v);
+  HALFSIPHASH_ROUND (v);
+  v[0] ^= x;
+  v[2] ^= 0xff;
+  HALFSIPHASH_ROUND (v);
+  HALFSIPHASH_ROUND (v);
+  HALFSIPHASH_ROUND (v);
+  HALFSIPHASH_ROUND (v);
+  return v[1] ^ v[3];
+}
@@ -29,6 +29,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fcrypt_align.h"
+
 /* Default to Siphash24. */
 #define SIPHASH_C_ROUNDS 2
 #define SIPHASH_D_ROUNDS 4
@@ -39,20 +41,74 @@
 #define SIPHASH_MIN_DIGEST_SIZE 8
 #define SIPHASH_MAX_DIGEST_SIZE 16
 
+#define HALFSIPHASH_KEY_SIZE 8
+#define HALFSIPHASH_BLOCK_SIZE 4
+
+/* The whole context fits in one cache line. */
 struct siphash_ctx
 {
-  uint64_t state[4];                  /* Hash state. */
-  uint8_t buffer[SIPHASH_BLOCK_SIZE]; /* Input buffer. */
-  uint64_t inputlen;                  /* Total bytes. */
-  uint8_t digestlen;                  /* 8 or 16 bytes. */
-  uint8_t bufferlen;                  /* Used bytes in buffer. */
-  uint8_t crounds;                    /* # of compression rounds. */
-  uint8_t drounds;                    /* # of finalization rounds. */
+  FCRYPT_CACHE_ALIGNED uint64_t state[4]; /* Hash state. */
+  uint64_t inputlen;                      /* Total bytes. */
+  uint8_t buffer[SIPHASH_BLOCK_SIZE];     /* Input buffer. */
+  uint8_t digestlen;                      /* 8 or 16 bytes. */
+  uint8_t bufferlen;                      /* Used bytes in buffer. */
+  uint8_t crounds;                        /* # of compression rounds. */
+  uint8_t drounds;                        /* # of finalization rounds. */
 };
 
+/*
+ * A prepared key holds the state after the key along with the digest length
+ * and round counts, so starting a MAC under a key that was used before is a
+ * copy of a few words rather than key processing. It is only read while
+ * computing a MAC, so one key can be shared between threads.
+ */
+struct siphash_key
+{
+  uint64_t state[4]; /* State after the key. */
+  uint8_t digestlen; /* 8 or 16 bytes. */
+  uint8_t crounds;   /* # of compression rounds. */
+  uint8_t drounds;   /* # of finalization rounds. */
+};
+
+/*
+ * The arguments of siphash_init and siphash_set_key are the digest length,
+ * the key and the numbers of compression and finalization rounds, where 0
+ * selects those of SipHash-2-4. siphash_init_key starts a context from a
+ * prepared key and siphash_mac computes a whole MAC with one.
+ */
 void siphash_init (struct siphash_ctx *, uint8_t, const uint8_t *, uint8_t,
                    uint8_t);
+void siphash_set_key (struct siphash_key *, uint8_t, const uint8_t *,
+                      uint8_t, uint8_t);
+void siphash_init_key (struct siphash_ctx *, const struct siphash_key *);
+void siphash_mac (uint8_t *, const struct siphash_key *, const void *,
+                  size_t);
 void siphash_update (struct siphash_ctx *, const void *, size_t);
 void siphash_final (uint8_t *, struct siphash_ctx *);
+void siphash_copy (struct siphash_ctx *, const struct siphash_ctx *);
+
+/*
+ * One-shot SipHash-2-4, SipHash-1-3 and HalfSipHash-2-4. The result is the
+ * digest read as a little-endian integer.
+ */
+uint64_t siphash24 (const uint8_t *, const void *, size_t);
+uint64_t siphash13 (const uint8_t *, const void *, size_t);
+uint32_t halfsiphash24 (const uint8_t *, const void *, size_t);
+
+/*
+ * SipHash-2-4 of exactly 16 bytes, such as a UUID, as two message blocks
+ * and the length block with no tail handling.
+ */
+uint64_t siphash24_16 (const uint8_t *, const void *);
+
+/*
+ * Batched one-shot SipHash. Hashes n messages, given by pointers and
+ * lengths, with the same key into out. Several messages are hashed at once
+ * in vector registers where the CPU allows.
+ */
+void siphash24_batch (const uint8_t *, const void *const *, const size_t *,
+                      uint64_t *, size_t);
+void siphash13_batch (const uint8_t *, const void *const *, const size_t *,
+                      uint64_t *, size_t);
 
 #endif /* SIPHASH_H */
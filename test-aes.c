@@ -23,18 +23,60 @@
  * SUCH DAMAGE.
  */
 
+#include "config.h"
+
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 
+#include "aes-internal.h"
 #include "aes.h"
+#include "fcrypt_cpu.h"
 
 static bool run_aes128_test (void);
 static bool run_aes192_test (void);
 static bool run_aes256_test (void);
+static bool run_aes128_ctr_test (void);
+static bool run_aes192_ctr_test (void);
+static bool run_aes256_ctr_test (void);
+static bool run_aes_ctr_wrap_test (void);
+static bool run_aes_ctr_random_access_test (void);
+static bool run_aes_ctr_iov_test (void);
+static bool run_aes128_cbc_test (void);
+static bool run_aes128_cfb_test (void);
+static bool run_aes192_cbc_test (void);
+static bool run_aes192_cfb_test (void);
+static bool run_aes256_cbc_test (void);
+static bool run_aes256_cfb_test (void);
+static bool run_aes_modes_long_test (void);
+static bool run_aes_lazy_decrypt_test (void);
+static bool run_aes_enc_ctx_test (void);
+static bool run_aes_key_batch_test (void);
+static bool run_aes_backend_test (void);
+static void hexdump (const uint8_t *, size_t);
+
+/* Plaintext from NIST SP 800-38A Appendix F. */
+static const uint8_t sp800_38a_pt[AES_BLOCK_SIZE * 4]
+    = { 0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e,
+        0x11, 0x73, 0x93, 0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03,
+        0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51, 0x30,
+        0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19,
+        0x1a, 0x0a, 0x52, 0xef, 0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b,
+        0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10 };
+
+/* IV from NIST SP 800-38A F.2 and F.3. */
+static const uint8_t sp800_38a_iv[AES_BLOCK_SIZE]
+    = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+/* Initial counter block from NIST SP 800-38A F.5. */
+static const uint8_t sp800_38a_ctr[AES_BLOCK_SIZE]
+    = { 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+        0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
 
 int
 main (void)
@@ -45,6 +87,40 @@ main (void)
     return 1;
   if (!run_aes256_test ())
     return 1;
+  if (!run_aes128_ctr_test ())
+    return 1;
+  if (!run_aes192_ctr_test ())
+    return 1;
+  if (!run_aes256_ctr_test ())
+    return 1;
+  if (!run_aes_ctr_wrap_test ())
+    return 1;
+  if (!run_aes_ctr_random_access_test ())
+    return 1;
+  if (!run_aes_ctr_iov_test ())
+    return 1;
+  if (!run_aes128_cbc_test ())
+    return 1;
+  if (!run_aes128_cfb_test ())
+    return 1;
+  if (!run_aes192_cbc_test ())
+    return 1;
+  if (!run_aes192_cfb_test ())
+    return 1;
+  if (!run_aes256_cbc_test ())
+    return 1;
+  if (!run_aes256_cfb_test ())
+    return 1;
+  if (!run_aes_modes_long_test ())
+    return 1;
+  if (!run_aes_lazy_decrypt_test ())
+    return 1;
+  if (!run_aes_enc_ctx_test ())
+    return 1;
+  if (!run_aes_key_batch_test ())
+    return 1;
+  if (!run_aes_backend_test ())
+    return 1;
   return 0;
 }
 
@@ -83,7 +159,18 @@ run_aes128_test (void)
     printf ("%02x", buffer[i]);
   printf ("\n");
 
-  return memcmp (buffer, ct1, sizeof (buffer)) == 0;
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  aes128_set_decrypt_key (&ctx, key1);
+  for (i = 0; i < 4; ++i)
+    aes128_decrypt (&ctx, ct1 + AES128_BLOCK_SIZE * i,
+                    buffer + AES128_BLOCK_SIZE * i);
+  for (i = 0; i < sizeof (buffer); ++i)
+    printf ("%02x", buffer[i]);
+  printf ("\n");
+
+  return memcmp (buffer, pt1, sizeof (buffer)) == 0;
 }
 
 static bool
@@ -124,7 +211,18 @@ run_aes192_test (void)
     printf ("%02x", buffer[i]);
   printf ("\n");
 
-  return memcmp (buffer, ct1, sizeof (buffer)) == 0;
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  aes192_set_decrypt_key (&ctx, key1);
+  for (i = 0; i < 4; ++i)
+    aes192_decrypt (&ctx, ct1 + AES192_BLOCK_SIZE * i,
+                    buffer + AES192_BLOCK_SIZE * i);
+  for (i = 0; i < sizeof (buffer); ++i)
+    printf ("%02x", buffer[i]);
+  printf ("\n");
+
+  return memcmp (buffer, pt1, sizeof (buffer)) == 0;
 }
 
 static bool
@@ -163,5 +261,939 @@ run_aes256_test (void)
     printf ("%02x", buffer[i]);
   printf ("\n");
 
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  aes256_set_decrypt_key (&ctx, key1);
+  for (i = 0; i < 4; ++i)
+    aes256_decrypt (&ctx, ct1 + AES256_BLOCK_SIZE * i,
+                    buffer + AES256_BLOCK_SIZE * i);
+  for (i = 0; i < sizeof (buffer); ++i)
+    printf ("%02x", buffer[i]);
+  printf ("\n");
+
+  return memcmp (buffer, pt1, sizeof (buffer)) == 0;
+}
+
+static bool
+run_aes128_ctr_test (void)
+{
+  struct aes128_ctx ctx;
+  size_t i;
+  uint8_t ctr[AES_BLOCK_SIZE];
+  uint8_t buffer[AES128_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES128_KEY_SIZE]
+      = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+          0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+
+  const uint8_t ct1[AES128_BLOCK_SIZE * 4]
+      = { 0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68,
+          0x64, 0x99, 0x0d, 0xb6, 0xce, 0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70,
+          0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff, 0x5a,
+          0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02,
+          0x0d, 0xb0, 0x3e, 0xab, 0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03,
+          0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee };
+
+  aes128_set_encrypt_key (&ctx, key1);
+
+  /* Every prefix length, covering the partial block path. */
+  for (i = 0; i <= sizeof (buffer); ++i)
+    {
+      memcpy (ctr, sp800_38a_ctr, sizeof (ctr));
+      aes128_ctr_crypt (&ctx, ctr, sp800_38a_pt, buffer, i);
+      if (memcmp (buffer, ct1, i) != 0)
+        return false;
+    }
+
+  /* Split at a block boundary, continuing from the updated counter. */
+  memcpy (ctr, sp800_38a_ctr, sizeof (ctr));
+  aes128_ctr_crypt (&ctx, ctr, sp800_38a_pt, buffer, AES_BLOCK_SIZE);
+  aes128_ctr_crypt (&ctx, ctr, sp800_38a_pt + AES_BLOCK_SIZE,
+                    buffer + AES_BLOCK_SIZE,
+                    sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+
+  return memcmp (buffer, ct1, sizeof (buffer)) == 0;
+}
+
+static bool
+run_aes192_ctr_test (void)
+{
+  struct aes192_ctx ctx;
+  size_t i;
+  uint8_t ctr[AES_BLOCK_SIZE];
+  uint8_t buffer[AES192_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES192_KEY_SIZE]
+      = { 0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52,
+          0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+          0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b };
+
+  const uint8_t ct1[AES192_BLOCK_SIZE * 4]
+      = { 0x1a, 0xbc, 0x93, 0x24, 0x17, 0x52, 0x1c, 0xa2, 0x4f, 0x2b, 0x04,
+          0x59, 0xfe, 0x7e, 0x6e, 0x0b, 0x09, 0x03, 0x39, 0xec, 0x0a, 0xa6,
+          0xfa, 0xef, 0xd5, 0xcc, 0xc2, 0xc6, 0xf4, 0xce, 0x8e, 0x94, 0x1e,
+          0x36, 0xb2, 0x6b, 0xd1, 0xeb, 0xc6, 0x70, 0xd1, 0xbd, 0x1d, 0x66,
+          0x56, 0x20, 0xab, 0xf7, 0x4f, 0x78, 0xa7, 0xf6, 0xd2, 0x98, 0x09,
+          0x58, 0x5a, 0x97, 0xda, 0xec, 0x58, 0xc6, 0xb0, 0x50 };
+
+  aes192_set_encrypt_key (&ctx, key1);
+
+  /* Every prefix length, covering the partial block path. */
+  for (i = 0; i <= sizeof (buffer); ++i)
+    {
+      memcpy (ctr, sp800_38a_ctr, sizeof (ctr));
+      aes192_ctr_crypt (&ctx, ctr, sp800_38a_pt, buffer, i);
+      if (memcmp (buffer, ct1, i) != 0)
+        return false;
+    }
+
+  /* Split at a block boundary, continuing from the updated counter. */
+  memcpy (ctr, sp800_38a_ctr, sizeof (ctr));
+  aes192_ctr_crypt (&ctx, ctr, sp800_38a_pt, buffer, AES_BLOCK_SIZE);
+  aes192_ctr_crypt (&ctx, ctr, sp800_38a_pt + AES_BLOCK_SIZE,
+                    buffer + AES_BLOCK_SIZE,
+                    sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+
+  return memcmp (buffer, ct1, sizeof (buffer)) == 0;
+}
+
+static bool
+run_aes256_ctr_test (void)
+{
+  struct aes256_ctx ctx;
+  size_t i;
+  uint8_t ctr[AES_BLOCK_SIZE];
+  uint8_t buffer[AES256_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES256_KEY_SIZE]
+      = { 0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae,
+          0xf0, 0x85, 0x7d, 0x77, 0x81, 0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61,
+          0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4 };
+
+  const uint8_t ct1[AES256_BLOCK_SIZE * 4]
+      = { 0x60, 0x1e, 0xc3, 0x13, 0x77, 0x57, 0x89, 0xa5, 0xb7, 0xa7, 0xf5,
+          0x04, 0xbb, 0xf3, 0xd2, 0x28, 0xf4, 0x43, 0xe3, 0xca, 0x4d, 0x62,
+          0xb5, 0x9a, 0xca, 0x84, 0xe9, 0x90, 0xca, 0xca, 0xf5, 0xc5, 0x2b,
+          0x09, 0x30, 0xda, 0xa2, 0x3d, 0xe9, 0x4c, 0xe8, 0x70, 0x17, 0xba,
+          0x2d, 0x84, 0x98, 0x8d, 0xdf, 0xc9, 0xc5, 0x8d, 0xb6, 0x7a, 0xad,
+          0xa6, 0x13, 0xc2, 0xdd, 0x08, 0x45, 0x79, 0x41, 0xa6 };
+
+  aes256_set_encrypt_key (&ctx, key1);
+
+  /* Every prefix length, covering the partial block path. */
+  for (i = 0; i <= sizeof (buffer); ++i)
+    {
+      memcpy (ctr, sp800_38a_ctr, sizeof (ctr));
+      aes256_ctr_crypt (&ctx, ctr, sp800_38a_pt, buffer, i);
+      if (memcmp (buffer, ct1, i) != 0)
+        return false;
+    }
+
+  /* Split at a block boundary, continuing from the updated counter. */
+  memcpy (ctr, sp800_38a_ctr, sizeof (ctr));
+  aes256_ctr_crypt (&ctx, ctr, sp800_38a_pt, buffer, AES_BLOCK_SIZE);
+  aes256_ctr_crypt (&ctx, ctr, sp800_38a_pt + AES_BLOCK_SIZE,
+                    buffer + AES_BLOCK_SIZE,
+                    sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+
   return memcmp (buffer, ct1, sizeof (buffer)) == 0;
 }
+
+/*
+ * Checks that the counter carries across all 128 bits by comparing a long
+ * CTR encryption against single block encryptions of the counter values.
+ */
+static bool
+run_aes_ctr_wrap_test (void)
+{
+  struct aes128_ctx ctx;
+  size_t i, j;
+  uint8_t key[AES128_KEY_SIZE];
+  uint8_t ctr[AES_BLOCK_SIZE];
+  uint8_t expect_ctr[AES_BLOCK_SIZE];
+  uint8_t keystream[AES_BLOCK_SIZE];
+  uint8_t input[AES_BLOCK_SIZE * 19 + 5];
+  uint8_t output[sizeof (input)];
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 17);
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)i;
+  /* 2^128 - 3 */
+  memset (ctr, 0xff, sizeof (ctr));
+  ctr[15] = 0xfd;
+  memcpy (expect_ctr, ctr, sizeof (ctr));
+
+  aes128_set_encrypt_key (&ctx, key);
+  aes128_ctr_crypt (&ctx, ctr, input, output, sizeof (input));
+
+  for (i = 0; i < sizeof (input); i += AES_BLOCK_SIZE)
+    {
+      aes128_encrypt (&ctx, expect_ctr, keystream);
+      for (j = 0; j < AES_BLOCK_SIZE && i + j < sizeof (input); ++j)
+        if ((input[i + j] ^ keystream[j]) != output[i + j])
+          return false;
+      for (j = AES_BLOCK_SIZE; j-- > 0;)
+        if (++expect_ctr[j] != 0)
+          break;
+    }
+  hexdump (ctr, sizeof (ctr));
+
+  return memcmp (ctr, expect_ctr, sizeof (ctr)) == 0;
+}
+
+static bool
+run_aes_ctr_random_access_test (void)
+{
+  static const size_t offsets[] = { 0, 1, 15, 16, 17, 100, 4096, 10000 };
+  struct aes128_enc_ctx ctx;
+  size_t i, j, len;
+  bool ok;
+  uint8_t key[AES128_KEY_SIZE];
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t ctr[AES_BLOCK_SIZE];
+  uint8_t expect_ctr[AES_BLOCK_SIZE];
+  uint8_t *input, *output, *expected;
+
+  len = 1024 * 1024 + 13;
+  input = malloc (len);
+  output = malloc (len);
+  expected = malloc (len);
+  if (input == NULL || output == NULL || expected == NULL)
+    {
+      free (input);
+      free (output);
+      free (expected);
+      return false;
+    }
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 29 + 1);
+  for (i = 0; i < len; ++i)
+    input[i] = (uint8_t)(i * 13 + 7);
+  /* Close enough to 2^64 that the low half of the counter carries. */
+  memset (iv, 0xa5, sizeof (iv));
+  memset (iv + 8, 0xff, 7);
+
+  aes128_enc_set_key (&ctx, key);
+  memcpy (ctr, iv, sizeof (ctr));
+  aes128_enc_ctr_crypt (&ctx, ctr, input, expected, len);
+
+  ok = true;
+  for (i = 0; i < sizeof (offsets) / sizeof (offsets[0]); ++i)
+    {
+      aes128_enc_ctr_crypt_at (&ctx, iv, offsets[i], input + offsets[i],
+                               output, 1000);
+      ok = ok && memcmp (output, expected + offsets[i], 1000) == 0;
+    }
+
+  aes128_enc_ctr_crypt_parallel (&ctx, iv, 37, input + 37, output, len - 37,
+                                 4);
+  ok = ok && memcmp (output, expected + 37, len - 37) == 0;
+
+  for (i = 1; i <= 20; i += 3)
+    {
+      memcpy (output, input, len);
+      aes128_enc_ctr_crypt_parallel (&ctx, iv, 0, output, output, len, i);
+      ok = ok && memcmp (output, expected, len) == 0;
+    }
+
+  /* Seeking matches stepping the counter one block at a time. */
+  memcpy (expect_ctr, iv, sizeof (expect_ctr));
+  for (i = 0; i < 300; ++i)
+    for (j = AES_BLOCK_SIZE; j-- > 0;)
+      if (++expect_ctr[j] != 0)
+        break;
+  aes_ctr_seek (ctr, iv, 300);
+  ok = ok && memcmp (ctr, expect_ctr, sizeof (ctr)) == 0;
+
+  free (input);
+  free (output);
+  free (expected);
+  return ok;
+}
+
+/*
+ * Encrypts a message split into pieces that start and end inside blocks,
+ * and compares the output and final counter with a single call.
+ */
+static bool
+run_aes_ctr_iov_test (void)
+{
+  static const size_t lens[] = { 0, 1, 15, 16, 17, 3, 40, 0, 7, 64, 200 };
+  struct aes128_enc_ctx ctx;
+  struct aes256_ctx ctx256;
+  struct iovec iov[sizeof (lens) / sizeof (lens[0])];
+  uint8_t key[AES256_KEY_SIZE];
+  uint8_t ctr[AES_BLOCK_SIZE];
+  uint8_t expect_ctr[AES_BLOCK_SIZE];
+  uint8_t input[500], output[500], expected[500];
+  size_t i, n;
+  bool ok;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 5 + 2);
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 7 + 3);
+  for (i = n = 0; i < sizeof (lens) / sizeof (lens[0]); n += lens[i++])
+    {
+      iov[i].iov_base = output + n;
+      iov[i].iov_len = lens[i];
+    }
+  iov[i - 1].iov_len = sizeof (output) - (n - lens[i - 1]);
+  n = i;
+
+  aes128_enc_set_key (&ctx, key);
+  memset (expect_ctr, 0xfe, sizeof (expect_ctr));
+  aes128_enc_ctr_crypt (&ctx, expect_ctr, input, expected, sizeof (input));
+  memset (ctr, 0xfe, sizeof (ctr));
+  memcpy (output, input, sizeof (output));
+  aes128_enc_ctr_cryptv (&ctx, ctr, iov, n);
+  ok = memcmp (output, expected, sizeof (output)) == 0
+       && memcmp (ctr, expect_ctr, sizeof (ctr)) == 0;
+
+  aes256_set_encrypt_key (&ctx256, key);
+  memset (expect_ctr, 0, sizeof (expect_ctr));
+  aes256_ctr_crypt (&ctx256, expect_ctr, input, expected, sizeof (input));
+  memset (ctr, 0, sizeof (ctr));
+  memcpy (output, input, sizeof (output));
+  aes256_ctr_cryptv (&ctx256, ctr, iov, n);
+  ok = ok && memcmp (output, expected, sizeof (output)) == 0
+       && memcmp (ctr, expect_ctr, sizeof (ctr)) == 0;
+
+  return ok;
+}
+
+static bool
+run_aes128_cbc_test (void)
+{
+  struct aes128_ctx ctx;
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t buffer[AES128_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES128_KEY_SIZE]
+      = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+          0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+
+  const uint8_t ct1[AES128_BLOCK_SIZE * 4]
+      = { 0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e,
+          0x9b, 0x12, 0xe9, 0x19, 0x7d, 0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72,
+          0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2, 0x73,
+          0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b, 0x71, 0x16, 0xe6, 0x9e,
+          0x22, 0x22, 0x95, 0x16, 0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac,
+          0x09, 0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7 };
+
+  aes128_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes128_cbc_encrypt (&ctx, iv, sp800_38a_pt, buffer, sizeof (buffer));
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  /* Decrypt in place in two calls, continuing from the updated IV. */
+  aes128_set_decrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes128_cbc_decrypt (&ctx, iv, buffer, buffer, AES_BLOCK_SIZE);
+  aes128_cbc_decrypt (&ctx, iv, buffer + AES_BLOCK_SIZE,
+                      buffer + AES_BLOCK_SIZE,
+                      sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, sp800_38a_pt, sizeof (buffer)) != 0)
+    return false;
+
+  return memcmp (iv, ct1 + sizeof (ct1) - AES_BLOCK_SIZE, sizeof (iv)) == 0;
+}
+
+static bool
+run_aes128_cfb_test (void)
+{
+  struct aes128_ctx ctx;
+  size_t i;
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t buffer[AES128_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES128_KEY_SIZE]
+      = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+          0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+
+  const uint8_t ct1[AES128_BLOCK_SIZE * 4]
+      = { 0x3b, 0x3f, 0xd9, 0x2e, 0xb7, 0x2d, 0xad, 0x20, 0x33, 0x34, 0x49,
+          0xf8, 0xe8, 0x3c, 0xfb, 0x4a, 0xc8, 0xa6, 0x45, 0x37, 0xa0, 0xb3,
+          0xa9, 0x3f, 0xcd, 0xe3, 0xcd, 0xad, 0x9f, 0x1c, 0xe5, 0x8b, 0x26,
+          0x75, 0x1f, 0x67, 0xa3, 0xcb, 0xb1, 0x40, 0xb1, 0x80, 0x8c, 0xf1,
+          0x87, 0xa4, 0xf4, 0xdf, 0xc0, 0x4b, 0x05, 0x35, 0x7c, 0x5d, 0x1c,
+          0x0e, 0xea, 0xc4, 0xc6, 0x6f, 0x9f, 0xf7, 0xf2, 0xe6 };
+
+  aes128_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes128_cfb_encrypt (&ctx, iv, sp800_38a_pt, buffer, sizeof (buffer));
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  /* Decrypt in place in two calls, continuing from the updated IV. */
+  aes128_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes128_cfb_decrypt (&ctx, iv, buffer, buffer, AES_BLOCK_SIZE);
+  aes128_cfb_decrypt (&ctx, iv, buffer + AES_BLOCK_SIZE,
+                      buffer + AES_BLOCK_SIZE,
+                      sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, sp800_38a_pt, sizeof (buffer)) != 0)
+    return false;
+
+  /* Every prefix length, covering the partial block path. */
+  for (i = 0; i <= sizeof (buffer); ++i)
+    {
+      memcpy (iv, sp800_38a_iv, sizeof (iv));
+      aes128_cfb_decrypt (&ctx, iv, ct1, buffer, i);
+      if (memcmp (buffer, sp800_38a_pt, i) != 0)
+        return false;
+      memcpy (iv, sp800_38a_iv, sizeof (iv));
+      aes128_cfb_encrypt (&ctx, iv, sp800_38a_pt, buffer, i);
+      if (memcmp (buffer, ct1, i) != 0)
+        return false;
+    }
+
+  return memcmp (iv, ct1 + sizeof (ct1) - AES_BLOCK_SIZE, sizeof (iv)) == 0;
+}
+
+static bool
+run_aes192_cbc_test (void)
+{
+  struct aes192_ctx ctx;
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t buffer[AES192_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES192_KEY_SIZE]
+      = { 0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52,
+          0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+          0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b };
+
+  const uint8_t ct1[AES192_BLOCK_SIZE * 4]
+      = { 0x4f, 0x02, 0x1d, 0xb2, 0x43, 0xbc, 0x63, 0x3d, 0x71, 0x78, 0x18,
+          0x3a, 0x9f, 0xa0, 0x71, 0xe8, 0xb4, 0xd9, 0xad, 0xa9, 0xad, 0x7d,
+          0xed, 0xf4, 0xe5, 0xe7, 0x38, 0x76, 0x3f, 0x69, 0x14, 0x5a, 0x57,
+          0x1b, 0x24, 0x20, 0x12, 0xfb, 0x7a, 0xe0, 0x7f, 0xa9, 0xba, 0xac,
+          0x3d, 0xf1, 0x02, 0xe0, 0x08, 0xb0, 0xe2, 0x79, 0x88, 0x59, 0x88,
+          0x81, 0xd9, 0x20, 0xa9, 0xe6, 0x4f, 0x56, 0x15, 0xcd };
+
+  aes192_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes192_cbc_encrypt (&ctx, iv, sp800_38a_pt, buffer, sizeof (buffer));
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  /* Decrypt in place in two calls, continuing from the updated IV. */
+  aes192_set_decrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes192_cbc_decrypt (&ctx, iv, buffer, buffer, AES_BLOCK_SIZE);
+  aes192_cbc_decrypt (&ctx, iv, buffer + AES_BLOCK_SIZE,
+                      buffer + AES_BLOCK_SIZE,
+                      sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, sp800_38a_pt, sizeof (buffer)) != 0)
+    return false;
+
+  return memcmp (iv, ct1 + sizeof (ct1) - AES_BLOCK_SIZE, sizeof (iv)) == 0;
+}
+
+static bool
+run_aes192_cfb_test (void)
+{
+  struct aes192_ctx ctx;
+  size_t i;
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t buffer[AES192_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES192_KEY_SIZE]
+      = { 0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52,
+          0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+          0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b };
+
+  const uint8_t ct1[AES192_BLOCK_SIZE * 4]
+      = { 0xcd, 0xc8, 0x0d, 0x6f, 0xdd, 0xf1, 0x8c, 0xab, 0x34, 0xc2, 0x59,
+          0x09, 0xc9, 0x9a, 0x41, 0x74, 0x67, 0xce, 0x7f, 0x7f, 0x81, 0x17,
+          0x36, 0x21, 0x96, 0x1a, 0x2b, 0x70, 0x17, 0x1d, 0x3d, 0x7a, 0x2e,
+          0x1e, 0x8a, 0x1d, 0xd5, 0x9b, 0x88, 0xb1, 0xc8, 0xe6, 0x0f, 0xed,
+          0x1e, 0xfa, 0xc4, 0xc9, 0xc0, 0x5f, 0x9f, 0x9c, 0xa9, 0x83, 0x4f,
+          0xa0, 0x42, 0xae, 0x8f, 0xba, 0x58, 0x4b, 0x09, 0xff };
+
+  aes192_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes192_cfb_encrypt (&ctx, iv, sp800_38a_pt, buffer, sizeof (buffer));
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  /* Decrypt in place in two calls, continuing from the updated IV. */
+  aes192_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes192_cfb_decrypt (&ctx, iv, buffer, buffer, AES_BLOCK_SIZE);
+  aes192_cfb_decrypt (&ctx, iv, buffer + AES_BLOCK_SIZE,
+                      buffer + AES_BLOCK_SIZE,
+                      sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, sp800_38a_pt, sizeof (buffer)) != 0)
+    return false;
+
+  /* Every prefix length, covering the partial block path. */
+  for (i = 0; i <= sizeof (buffer); ++i)
+    {
+      memcpy (iv, sp800_38a_iv, sizeof (iv));
+      aes192_cfb_decrypt (&ctx, iv, ct1, buffer, i);
+      if (memcmp (buffer, sp800_38a_pt, i) != 0)
+        return false;
+      memcpy (iv, sp800_38a_iv, sizeof (iv));
+      aes192_cfb_encrypt (&ctx, iv, sp800_38a_pt, buffer, i);
+      if (memcmp (buffer, ct1, i) != 0)
+        return false;
+    }
+
+  return memcmp (iv, ct1 + sizeof (ct1) - AES_BLOCK_SIZE, sizeof (iv)) == 0;
+}
+
+static bool
+run_aes256_cbc_test (void)
+{
+  struct aes256_ctx ctx;
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t buffer[AES256_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES256_KEY_SIZE]
+      = { 0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae,
+          0xf0, 0x85, 0x7d, 0x77, 0x81, 0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61,
+          0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4 };
+
+  const uint8_t ct1[AES256_BLOCK_SIZE * 4]
+      = { 0xf5, 0x8c, 0x4c, 0x04, 0xd6, 0xe5, 0xf1, 0xba, 0x77, 0x9e, 0xab,
+          0xfb, 0x5f, 0x7b, 0xfb, 0xd6, 0x9c, 0xfc, 0x4e, 0x96, 0x7e, 0xdb,
+          0x80, 0x8d, 0x67, 0x9f, 0x77, 0x7b, 0xc6, 0x70, 0x2c, 0x7d, 0x39,
+          0xf2, 0x33, 0x69, 0xa9, 0xd9, 0xba, 0xcf, 0xa5, 0x30, 0xe2, 0x63,
+          0x04, 0x23, 0x14, 0x61, 0xb2, 0xeb, 0x05, 0xe2, 0xc3, 0x9b, 0xe9,
+          0xfc, 0xda, 0x6c, 0x19, 0x07, 0x8c, 0x6a, 0x9d, 0x1b };
+
+  aes256_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes256_cbc_encrypt (&ctx, iv, sp800_38a_pt, buffer, sizeof (buffer));
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  /* Decrypt in place in two calls, continuing from the updated IV. */
+  aes256_set_decrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes256_cbc_decrypt (&ctx, iv, buffer, buffer, AES_BLOCK_SIZE);
+  aes256_cbc_decrypt (&ctx, iv, buffer + AES_BLOCK_SIZE,
+                      buffer + AES_BLOCK_SIZE,
+                      sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, sp800_38a_pt, sizeof (buffer)) != 0)
+    return false;
+
+  return memcmp (iv, ct1 + sizeof (ct1) - AES_BLOCK_SIZE, sizeof (iv)) == 0;
+}
+
+static bool
+run_aes256_cfb_test (void)
+{
+  struct aes256_ctx ctx;
+  size_t i;
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t buffer[AES256_BLOCK_SIZE * 4];
+
+  const uint8_t key1[AES256_KEY_SIZE]
+      = { 0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae,
+          0xf0, 0x85, 0x7d, 0x77, 0x81, 0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61,
+          0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4 };
+
+  const uint8_t ct1[AES256_BLOCK_SIZE * 4]
+      = { 0xdc, 0x7e, 0x84, 0xbf, 0xda, 0x79, 0x16, 0x4b, 0x7e, 0xcd, 0x84,
+          0x86, 0x98, 0x5d, 0x38, 0x60, 0x39, 0xff, 0xed, 0x14, 0x3b, 0x28,
+          0xb1, 0xc8, 0x32, 0x11, 0x3c, 0x63, 0x31, 0xe5, 0x40, 0x7b, 0xdf,
+          0x10, 0x13, 0x24, 0x15, 0xe5, 0x4b, 0x92, 0xa1, 0x3e, 0xd0, 0xa8,
+          0x26, 0x7a, 0xe2, 0xf9, 0x75, 0xa3, 0x85, 0x74, 0x1a, 0xb9, 0xce,
+          0xf8, 0x20, 0x31, 0x62, 0x3d, 0x55, 0xb1, 0xe4, 0x71 };
+
+  aes256_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes256_cfb_encrypt (&ctx, iv, sp800_38a_pt, buffer, sizeof (buffer));
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, ct1, sizeof (buffer)) != 0)
+    return false;
+
+  /* Decrypt in place in two calls, continuing from the updated IV. */
+  aes256_set_encrypt_key (&ctx, key1);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes256_cfb_decrypt (&ctx, iv, buffer, buffer, AES_BLOCK_SIZE);
+  aes256_cfb_decrypt (&ctx, iv, buffer + AES_BLOCK_SIZE,
+                      buffer + AES_BLOCK_SIZE,
+                      sizeof (buffer) - AES_BLOCK_SIZE);
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, sp800_38a_pt, sizeof (buffer)) != 0)
+    return false;
+
+  /* Every prefix length, covering the partial block path. */
+  for (i = 0; i <= sizeof (buffer); ++i)
+    {
+      memcpy (iv, sp800_38a_iv, sizeof (iv));
+      aes256_cfb_decrypt (&ctx, iv, ct1, buffer, i);
+      if (memcmp (buffer, sp800_38a_pt, i) != 0)
+        return false;
+      memcpy (iv, sp800_38a_iv, sizeof (iv));
+      aes256_cfb_encrypt (&ctx, iv, sp800_38a_pt, buffer, i);
+      if (memcmp (buffer, ct1, i) != 0)
+        return false;
+    }
+
+  return memcmp (iv, ct1 + sizeof (ct1) - AES_BLOCK_SIZE, sizeof (iv)) == 0;
+}
+
+/*
+ * Long enough for the multi-block code in every backend. The expected output
+ * of each mode is built from single block encryptions.
+ */
+static bool
+run_aes_modes_long_test (void)
+{
+  struct aes128_ctx ctx;
+  size_t i, j;
+  uint8_t key[AES128_KEY_SIZE];
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t block[AES_BLOCK_SIZE];
+  uint8_t input[AES_BLOCK_SIZE * 37];
+  uint8_t expect[sizeof (input)];
+  uint8_t output[sizeof (input)];
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 29);
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 7 + 3);
+  aes128_set_encrypt_key (&ctx, key);
+
+  /* ECB */
+  for (i = 0; i < sizeof (input); i += AES_BLOCK_SIZE)
+    aes128_encrypt (&ctx, input + i, expect + i);
+  aes128_ecb_encrypt (&ctx, input, output, sizeof (input));
+  if (memcmp (output, expect, sizeof (output)) != 0)
+    return false;
+  aes128_set_decrypt_key (&ctx, key);
+  aes128_ecb_decrypt (&ctx, expect, output, sizeof (expect));
+  if (memcmp (output, input, sizeof (output)) != 0)
+    return false;
+
+  /* CBC */
+  aes128_set_encrypt_key (&ctx, key);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  for (i = 0; i < sizeof (input); i += AES_BLOCK_SIZE)
+    {
+      for (j = 0; j < AES_BLOCK_SIZE; ++j)
+        block[j] = input[i + j] ^ iv[j];
+      aes128_encrypt (&ctx, block, expect + i);
+      memcpy (iv, expect + i, sizeof (iv));
+    }
+  aes128_set_decrypt_key (&ctx, key);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  memcpy (output, expect, sizeof (output));
+  aes128_cbc_decrypt (&ctx, iv, output, output, sizeof (output));
+  if (memcmp (output, input, sizeof (output)) != 0)
+    return false;
+
+  /* CFB, with a partial final block */
+  aes128_set_encrypt_key (&ctx, key);
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  for (i = 0; i < sizeof (input); i += AES_BLOCK_SIZE)
+    {
+      aes128_encrypt (&ctx, iv, block);
+      for (j = 0; j < AES_BLOCK_SIZE; ++j)
+        expect[i + j] = input[i + j] ^ block[j];
+      memcpy (iv, expect + i, sizeof (iv));
+    }
+  memcpy (iv, sp800_38a_iv, sizeof (iv));
+  aes128_cfb_decrypt (&ctx, iv, expect, output, sizeof (output) - 3);
+  hexdump (output + sizeof (output) - AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+  return memcmp (output, input, sizeof (output) - 3) == 0;
+}
+
+/*
+ * Decrypting with a context set up by aes*_set_encrypt_key derives the
+ * decryption keys on first use. Setting a new key must discard them.
+ */
+static bool
+run_aes_lazy_decrypt_test (void)
+{
+  struct aes128_ctx ctx;
+  struct aes256_ctx ctx256;
+  size_t i;
+  uint8_t key[AES256_KEY_SIZE];
+  uint8_t input[AES_BLOCK_SIZE * 9];
+  uint8_t cipher[sizeof (input)];
+  uint8_t output[sizeof (input)];
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 13 + 1);
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 5);
+
+  aes128_set_encrypt_key (&ctx, key);
+  aes128_ecb_encrypt (&ctx, input, cipher, sizeof (input));
+  aes128_ecb_decrypt (&ctx, cipher, output, sizeof (cipher));
+  if (memcmp (output, input, sizeof (output)) != 0)
+    return false;
+
+  aes128_set_encrypt_key (&ctx, key + AES128_KEY_SIZE);
+  aes128_ecb_encrypt (&ctx, input, cipher, sizeof (input));
+  aes128_ecb_decrypt (&ctx, cipher, output, sizeof (cipher));
+  if (memcmp (output, input, sizeof (output)) != 0)
+    return false;
+
+  aes256_set_encrypt_key (&ctx256, key);
+  for (i = 0; i < sizeof (input); i += AES_BLOCK_SIZE)
+    aes256_encrypt (&ctx256, input + i, cipher + i);
+  for (i = 0; i < sizeof (input); i += AES_BLOCK_SIZE)
+    aes256_decrypt (&ctx256, cipher + i, output + i);
+  hexdump (cipher, AES_BLOCK_SIZE);
+
+  return memcmp (output, input, sizeof (output)) == 0;
+}
+
+/* The encryption-only contexts must match struct aes*_ctx in every mode. */
+static bool
+run_aes_enc_ctx_test (void)
+{
+  struct aes128_ctx ctx;
+  struct aes128_enc_ctx ectx;
+  struct aes192_ctx ctx192;
+  struct aes192_enc_ctx ectx192;
+  struct aes256_ctx ctx256;
+  struct aes256_enc_ctx ectx256;
+  size_t i;
+  uint8_t key[AES256_KEY_SIZE];
+  uint8_t iv1[AES_BLOCK_SIZE];
+  uint8_t iv2[AES_BLOCK_SIZE];
+  uint8_t input[AES_BLOCK_SIZE * 37 + 3];
+  uint8_t expect[sizeof (input)];
+  uint8_t output[sizeof (input)];
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 31 + 7);
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 11);
+  aes128_set_encrypt_key (&ctx, key);
+  aes128_enc_set_key (&ectx, key);
+
+  aes128_ecb_encrypt (&ctx, input, expect, sizeof (input) - 3);
+  aes128_enc_ecb_encrypt (&ectx, input, output, sizeof (input) - 3);
+  if (memcmp (output, expect, sizeof (output) - 3) != 0)
+    return false;
+
+  memcpy (iv1, sp800_38a_iv, sizeof (iv1));
+  memcpy (iv2, sp800_38a_iv, sizeof (iv2));
+  aes128_cbc_encrypt (&ctx, iv1, input, expect, sizeof (input) - 3);
+  aes128_enc_cbc_encrypt (&ectx, iv2, input, output, sizeof (input) - 3);
+  if (memcmp (output, expect, sizeof (output) - 3) != 0
+      || memcmp (iv1, iv2, sizeof (iv1)) != 0)
+    return false;
+
+  memcpy (iv1, sp800_38a_iv, sizeof (iv1));
+  memcpy (iv2, sp800_38a_iv, sizeof (iv2));
+  aes128_cfb_encrypt (&ctx, iv1, input, expect, sizeof (input));
+  aes128_enc_cfb_encrypt (&ectx, iv2, input, output, sizeof (input));
+  if (memcmp (output, expect, sizeof (output)) != 0)
+    return false;
+  memcpy (iv2, sp800_38a_iv, sizeof (iv2));
+  aes128_enc_cfb_decrypt (&ectx, iv2, expect, output, sizeof (expect));
+  if (memcmp (output, input, sizeof (output)) != 0)
+    return false;
+
+  memcpy (iv1, sp800_38a_ctr, sizeof (iv1));
+  memcpy (iv2, sp800_38a_ctr, sizeof (iv2));
+  aes128_ctr_crypt (&ctx, iv1, input, expect, sizeof (input));
+  aes128_enc_ctr_crypt (&ectx, iv2, input, output, sizeof (input));
+  if (memcmp (output, expect, sizeof (output)) != 0
+      || memcmp (iv1, iv2, sizeof (iv1)) != 0)
+    return false;
+
+  aes192_set_encrypt_key (&ctx192, key);
+  aes192_enc_set_key (&ectx192, key);
+  aes192_encrypt (&ctx192, input, expect);
+  aes192_enc_encrypt (&ectx192, input, output);
+  if (memcmp (output, expect, AES_BLOCK_SIZE) != 0)
+    return false;
+
+  aes256_set_encrypt_key (&ctx256, key);
+  aes256_enc_set_key (&ectx256, key);
+  aes256_encrypt (&ctx256, input, expect);
+  aes256_enc_encrypt (&ectx256, input, output);
+  hexdump (output, AES_BLOCK_SIZE);
+
+  return memcmp (output, expect, AES_BLOCK_SIZE) == 0;
+}
+
+/* Number of keys, enough for two full batches and a partial one. */
+#define KEY_BATCH_TEST_KEYS 19
+
+/*
+ * The batched key setup must give the same schedules as setting each key on
+ * its own, including the decryption schedule derived from them later.
+ */
+#define KEY_BATCH_TEST(bits)                                                  \
+  do                                                                          \
+    {                                                                         \
+      struct aes##bits##_ctx ctxs[KEY_BATCH_TEST_KEYS], ctx;                  \
+                                                                              \
+      aes##bits##_set_encrypt_key_batch (ctxs, keyp, KEY_BATCH_TEST_KEYS);    \
+      for (i = 0; i < KEY_BATCH_TEST_KEYS; ++i)                               \
+        {                                                                     \
+          aes##bits##_set_encrypt_key (&ctx, keyp[i]);                        \
+          if (memcmp (ctxs[i].ek, ctx.ek, sizeof (ctx.ek)) != 0)              \
+            return false;                                                     \
+          aes##bits##_encrypt (&ctxs[i], block, output);                      \
+          aes##bits##_decrypt (&ctxs[i], output, output);                     \
+          if (memcmp (output, block, sizeof (block)) != 0)                    \
+            return false;                                                     \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+
+static bool
+run_aes_key_batch_test (void)
+{
+  uint8_t keys[KEY_BATCH_TEST_KEYS][AES256_KEY_SIZE];
+  const uint8_t *keyp[KEY_BATCH_TEST_KEYS];
+  uint8_t block[AES_BLOCK_SIZE];
+  uint8_t output[AES_BLOCK_SIZE];
+  size_t i, j;
+
+  for (i = 0; i < KEY_BATCH_TEST_KEYS; ++i)
+    {
+      for (j = 0; j < AES256_KEY_SIZE; ++j)
+        keys[i][j] = (uint8_t)(i * 37 + j * 13 + 5);
+      keyp[i] = keys[i];
+    }
+  for (i = 0; i < sizeof (block); ++i)
+    block[i] = (uint8_t)i;
+
+  KEY_BATCH_TEST (128);
+  KEY_BATCH_TEST (192);
+  KEY_BATCH_TEST (256);
+  return true;
+}
+
+/* Enough blocks for full and partial eight-block passes. */
+#define BACKEND_TEST_BLOCKS 37
+
+/*
+ * Only one backend is picked at run time, so the T-table and bitsliced code
+ * are also compared directly with the public functions, whichever backend
+ * those use. Every count of blocks up to BACKEND_TEST_BLOCKS is tried, since
+ * the bitsliced code takes another path for a few blocks. The counter starts
+ * near the top to cover the carry.
+ */
+#define BACKEND_TEST(backend, bits)                                           \
+  do                                                                          \
+    {                                                                         \
+      struct aes##bits##_ctx ctx;                                             \
+      uint8_t ctr_expect[BACKEND_TEST_BLOCKS * AES_BLOCK_SIZE];               \
+      uint8_t cbc_expect[BACKEND_TEST_BLOCKS * AES_BLOCK_SIZE];               \
+      size_t n;                                                               \
+                                                                              \
+      aes##bits##_set_decrypt_key (&ctx, key);                                \
+      (backend)->aes##bits##_expand_key (ek, key);                            \
+      (backend)->aes##bits##_invert_key (dk, ek);                             \
+                                                                              \
+      aes##bits##_ecb_encrypt (&ctx, data, expect, sizeof (data));            \
+      memset (iv, 0x5c, sizeof (iv));                                         \
+      aes##bits##_cbc_decrypt (&ctx, iv, data, cbc_expect, sizeof (data));    \
+      memset (iv, 0xff, sizeof (iv));                                         \
+      iv[AES_BLOCK_SIZE - 1] = 0xf0;                                          \
+      aes##bits##_ctr_crypt (&ctx, iv, data, ctr_expect, sizeof (data));      \
+                                                                              \
+      (backend)->aes##bits##_encrypt (ek, data, output);                      \
+      if (memcmp (output, expect, AES_BLOCK_SIZE) != 0)                       \
+        return false;                                                         \
+      (backend)->aes##bits##_decrypt (dk, expect, output);                    \
+      if (memcmp (output, data, AES_BLOCK_SIZE) != 0)                         \
+        return false;                                                         \
+      for (n = 1; n <= BACKEND_TEST_BLOCKS; ++n)                              \
+        {                                                                     \
+          (backend)->ecb_encrypt (ek, AES##bits##_ROUNDS, data, output, n);   \
+          if (memcmp (output, expect, n * AES_BLOCK_SIZE) != 0)               \
+            return false;                                                     \
+          (backend)->ecb_decrypt (dk, AES##bits##_ROUNDS, expect, output, n); \
+          if (memcmp (output, data, n * AES_BLOCK_SIZE) != 0)                 \
+            return false;                                                     \
+                                                                              \
+          memset (iv, 0x5c, sizeof (iv));                                     \
+          (backend)->cbc_decrypt (dk, AES##bits##_ROUNDS, iv, data, output,   \
+                                  n);                                         \
+          if (memcmp (output, cbc_expect, n * AES_BLOCK_SIZE) != 0            \
+              || memcmp (iv, data + (n - 1) * AES_BLOCK_SIZE,                 \
+                         AES_BLOCK_SIZE)                                      \
+                     != 0)                                                    \
+            return false;                                                     \
+                                                                              \
+          memset (iv, 0xff, sizeof (iv));                                     \
+          iv[AES_BLOCK_SIZE - 1] = 0xf0;                                      \
+          (backend)->ctr_crypt (ek, AES##bits##_ROUNDS, iv, data, output,     \
+                                n * AES_BLOCK_SIZE - 5);                      \
+          if (memcmp (output, ctr_expect, n * AES_BLOCK_SIZE - 5) != 0)       \
+            return false;                                                     \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+
+static bool
+run_aes_backend_test (void)
+{
+  const struct aes_backend *backends[4];
+  uint8_t key[AES256_KEY_SIZE];
+  uint8_t iv[AES_BLOCK_SIZE];
+  uint8_t data[BACKEND_TEST_BLOCKS * AES_BLOCK_SIZE];
+  uint8_t expect[BACKEND_TEST_BLOCKS * AES_BLOCK_SIZE];
+  uint8_t output[BACKEND_TEST_BLOCKS * AES_BLOCK_SIZE];
+  uint32_t ek[4 * (AES256_ROUNDS + 1)], dk[4 * (AES256_ROUNDS + 1)];
+  uint32_t features;
+  size_t i, count;
+
+  features = fcrypt_cpu_features ();
+  (void)features;
+  count = 0;
+  backends[count++] = &aes_backend_table;
+  backends[count++] = &aes_backend_bitslice;
+#if defined(HAVE_SSSE3_INTRINSICS)
+  if ((features & FCRYPT_CPU_SSSE3) != 0)
+    backends[count++] = &aes_backend_ssse3;
+#endif
+#if defined(HAVE_ARM_NEON_INTRINSICS)
+  if ((features & FCRYPT_CPU_ARM_NEON) != 0)
+    backends[count++] = &aes_backend_neon;
+#endif
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 29 + 3);
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 7 + (i >> 5));
+
+  for (i = 0; i < count; ++i)
+    {
+      BACKEND_TEST (backends[i], 128);
+      BACKEND_TEST (backends[i], 192);
+      BACKEND_TEST (backends[i], 256);
+    }
+  return true;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
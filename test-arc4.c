@@ -43,6 +43,7 @@ main (void)
 {
   struct arc4_ctx ctx;
   uint8_t buffer[512];
+  size_t i, n;
   int rv = 0;
 
   uint8_t test_plaintext1[] = { 0xdc, 0xee, 0x4c, 0xf9, 0x2c };
@@ -112,6 +113,20 @@ main (void)
     0x9e, 0xb1, 0xa4, 0xc1, 0xaf, 0x5f, 0x6a, 0x54, 0x7f
   };
 
+  uint8_t test_drop_key1[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+
+  uint8_t test_drop_keystream1[] = { 0xd8, 0x72, 0x9d, 0xb4, 0x18, 0x82,
+                                     0x25, 0x9b, 0xee, 0x4f, 0x82, 0x53,
+                                     0x25, 0xf5, 0xa1, 0x30 };
+
+  uint8_t test_drop_key2[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+                               0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+                               0x0d, 0x0e, 0x0f, 0x10 };
+
+  uint8_t test_drop_keystream2[] = { 0xff, 0xa0, 0xb5, 0x14, 0x64, 0x7e,
+                                     0xc0, 0x4f, 0x63, 0x06, 0xb8, 0x92,
+                                     0xae, 0x66, 0x11, 0x81 };
+
   arc4_set_key (&ctx, test_key1, sizeof (test_key1));
   arc4_crypt (&ctx, test_plaintext1, buffer, sizeof (test_plaintext1));
   hexdump (buffer, sizeof (test_plaintext1));
@@ -130,6 +145,41 @@ main (void)
       rv = 1;
     }
 
+  /* Keystream at offset 1536 for two keys from RFC 6229. */
+  arc4_set_key_drop (&ctx, test_drop_key1, sizeof (test_drop_key1), 1536);
+  arc4_keystream (&ctx, buffer, sizeof (test_drop_keystream1));
+  if (memcmp (buffer, test_drop_keystream1, sizeof (test_drop_keystream1))
+      != 0)
+    {
+      fprintf (stderr, "Drop test 1 failed.\n");
+      rv = 1;
+    }
+
+  arc4_set_key (&ctx, test_drop_key2, sizeof (test_drop_key2));
+  arc4_drop (&ctx, 1000);
+  arc4_drop (&ctx, 536);
+  arc4_keystream (&ctx, buffer, sizeof (test_drop_keystream2));
+  if (memcmp (buffer, test_drop_keystream2, sizeof (test_drop_keystream2))
+      != 0)
+    {
+      fprintf (stderr, "Drop test 2 failed.\n");
+      rv = 1;
+    }
+
+  /* Encrypting in pieces that straddle the blocks gives the same result. */
+  arc4_set_key (&ctx, test_key2, sizeof (test_key2));
+  for (i = 0; i < sizeof (test_plaintext2); i += n)
+    {
+      n = sizeof (test_plaintext2) - i < 37 ? sizeof (test_plaintext2) - i
+                                             : 37;
+      arc4_crypt (&ctx, test_plaintext2 + i, buffer + i, n);
+    }
+  if (memcmp (buffer, test_ciphertext2, sizeof (test_ciphertext2)) != 0)
+    {
+      fprintf (stderr, "Split test failed.\n");
+      rv = 1;
+    }
+
   return rv;
 }
 
@@ -0,0 +1,174 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * The first test vector is the Argon2id one from RFC 9106 section 5.3 and
+ * the second is from the reference implementation's tests. The others were
+ * generated with a direct Python transcription of RFC 9106 that reproduces
+ * both, and cover several lanes, memory that isn't a multiple of four
+ * lanes, long tags and segments with more than one block of addresses.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argon2.h"
+
+struct argon2_testcase
+{
+  uint32_t t_cost;
+  uint32_t m_cost;
+  uint32_t lanes;
+  size_t passlen;
+  const char *pass;
+  size_t saltlen;
+  const char *salt;
+  size_t secretlen;
+  const char *secret;
+  size_t adlen;
+  const char *ad;
+  size_t taglen;
+  const char *tag;
+};
+
+static const struct argon2_testcase testcases[] = {
+  { 3, 32, 4, 32,
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01"
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01",
+    16, "\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02",
+    8, "\x03\x03\x03\x03\x03\x03\x03\x03", 12,
+    "\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04", 32,
+    "\x0d\x64\x0d\xf5\x8d\x78\x76\x6c\x08\xc0\x37\xa3\x4a\x8b\x53\xc9"
+    "\xd0\x1e\xf0\x45\x2d\x75\xb6\x5e\xb5\x25\x20\xe9\x6b\x01\xe6\x59" },
+  { 2, 65536, 1, 8, "password", 8, "somesalt", 0, NULL, 0, NULL, 32,
+    "\x09\x31\x61\x15\xd5\xcf\x24\xed\x5a\x15\xa3\x1a\x3b\xa3\x26\xe5"
+    "\xcf\x32\xed\xc2\x47\x02\x98\x7c\x02\xb6\x56\x6f\x61\x91\x3c\xf7" },
+  { 2, 1024, 1, 8, "password", 8, "somesalt", 0, NULL, 0, NULL, 32,
+    "\xec\x57\xec\x9c\x0e\xaf\x51\xee\xea\x2e\x92\xff\xdc\xaa\x9c\xde"
+    "\xe4\x78\xf1\x92\x72\x15\xb5\x15\xb7\xb8\xd6\x66\x57\xf4\x1e\xd9" },
+  { 1, 64, 2, 8, "password", 8, "diffsalt", 0, NULL, 0, NULL, 100,
+    "\x47\x0b\x33\x45\x41\x33\x4b\x03\xcd\x25\x22\x07\x73\xf3\x29\x81"
+    "\x06\xbd\xc5\x19\xb2\x13\xd2\x72\xa7\xb2\x72\x37\xab\xe1\xcf\x92"
+    "\x18\x35\x20\xe5\x46\x45\xb8\x7b\xf4\x37\x76\x73\x63\x5c\x50\x4f"
+    "\x75\x68\xe1\x07\xea\xb0\x5f\x14\x25\xc3\x15\x0d\xe7\x8a\xf7\x19"
+    "\x9f\xc8\x74\x32\x40\xbf\x97\x19\x40\xbd\x5d\xf2\x95\x7e\x2c\x5a"
+    "\xa2\x7d\x94\x7a\x2e\x4a\xa2\x65\x34\x48\x2f\xd9\x57\xa3\xd5\x61"
+    "\xaf\xf2\xf7\x1f" },
+  { 2, 50, 3, 4, "pass", 12, "saltsaltsalt", 3, "key", 0, NULL, 16,
+    "\xd4\xf2\xb8\xcf\x4a\xc6\x72\x95\xca\x5d\x35\x21\x52\x3b\x5d\x86" },
+};
+
+static bool run_argon2_testcase (const struct argon2_testcase *, uint32_t);
+static bool run_argon2_error_test (void);
+
+int
+main (void)
+{
+  size_t i;
+  int rv;
+
+  rv = 0;
+  for (i = 0; i < sizeof (testcases) / sizeof (testcases[0]); ++i)
+    {
+      /* The tag must not depend on the number of threads. */
+      if (!run_argon2_testcase (&testcases[i], 1)
+          || !run_argon2_testcase (&testcases[i], 4))
+        {
+          printf ("Argon2id test %zu failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  if (!run_argon2_error_test ())
+    {
+      printf ("Argon2id error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static bool
+run_argon2_testcase (const struct argon2_testcase *test, uint32_t threads)
+{
+  struct argon2_params params;
+  uint8_t tag[100];
+
+  params.t_cost = test->t_cost;
+  params.m_cost = test->m_cost;
+  params.lanes = test->lanes;
+  params.threads = threads;
+  params.secret = (const uint8_t *)test->secret;
+  params.secretlen = test->secretlen;
+  params.ad = (const uint8_t *)test->ad;
+  params.adlen = test->adlen;
+  if (argon2id (tag, test->taglen, test->pass, test->passlen,
+                (const uint8_t *)test->salt, test->saltlen, &params)
+      != 0)
+    return false;
+
+  return memcmp (tag, test->tag, test->taglen) == 0;
+}
+
+static bool
+run_argon2_error_test (void)
+{
+  static const struct argon2_params valid = { 1, 8, 1, 1, NULL, 0, NULL, 0 };
+  struct argon2_params params;
+  uint8_t tag[32];
+
+  params = valid;
+  if (argon2id (tag, sizeof (tag), "p", 1, (const uint8_t *)"saltsalt", 8,
+                &params)
+      != 0)
+    return false;
+
+  /* Too little memory for the lanes, no passes and a short salt. */
+  params.lanes = 2;
+  errno = 0;
+  if (argon2id (tag, sizeof (tag), "p", 1, (const uint8_t *)"saltsalt", 8,
+                &params)
+          != -1
+      || errno != EINVAL)
+    return false;
+  params = valid;
+  params.t_cost = 0;
+  errno = 0;
+  if (argon2id (tag, sizeof (tag), "p", 1, (const uint8_t *)"saltsalt", 8,
+                &params)
+          != -1
+      || errno != EINVAL)
+    return false;
+  params = valid;
+  errno = 0;
+  return argon2id (tag, sizeof (tag), "p", 1, (const uint8_t *)"salt", 4,
+                   &params)
+             == -1
+         && errno == EINVAL;
+}
@@ -0,0 +1,176 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors are from the tests of Solar Designer's crypt_blowfish.
+ * https://www.openwall.com/crypt/
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bcrypt.h"
+
+struct bcrypt_test
+{
+  const char *hash;
+  const char *password;
+};
+
+static const struct bcrypt_test bcrypt_tests[] = {
+  { "$2a$05$CCCCCCCCCCCCCCCCCCCCC.E5YPO9kmyuRGyh0XouQYb4YMJKvyOeW", "U*U" },
+  { "$2a$05$CCCCCCCCCCCCCCCCCCCCC.VGOzA784oUp/Z0DY336zx7pLYAy0lwK", "U*U*" },
+  { "$2a$05$XXXXXXXXXXXXXXXXXXXXXOAcXxm9kjPGEMsLznoKqmqw7tc8WCx4a", "U*U*U" },
+  { "$2a$05$abcdefghijklmnopqrstuu5s2v8.iXieOjg/.AySBTTZIIVFJeBui",
+    "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "chars after 72 are ignored" },
+  { "$2b$05$CCCCCCCCCCCCCCCCCCCCC.E5YPO9kmyuRGyh0XouQYb4YMJKvyOeW", "U*U" },
+  { "$2y$05$CCCCCCCCCCCCCCCCCCCCC.E5YPO9kmyuRGyh0XouQYb4YMJKvyOeW", "U*U" },
+  { "$2a$05$CCCCCCCCCCCCCCCCCCCCC.7uG0VCzI2bS7j6ymqJi9CdcdxiRTWNy", "" },
+};
+
+#define BCRYPT_TESTS (sizeof (bcrypt_tests) / sizeof (bcrypt_tests[0]))
+
+static int run_bcrypt_tests (void);
+static int run_bcrypt_setting_test (void);
+static int run_bcrypt_batch_test (void);
+
+int
+main (void)
+{
+  if (run_bcrypt_tests () < 0)
+    exit (1);
+  if (run_bcrypt_setting_test () < 0)
+    exit (1);
+  if (run_bcrypt_batch_test () < 0)
+    exit (1);
+
+  return 0;
+}
+
+static int
+run_bcrypt_tests (void)
+{
+  char out[BCRYPT_HASH_LENGTH + 1];
+  size_t i;
+  int rv;
+
+  for (i = 0, rv = 0; i < BCRYPT_TESTS; ++i)
+    {
+      printf ("bcrypt test %zu:\n", i);
+      printf ("  Expected: %s\n", bcrypt_tests[i].hash);
+      if (bcrypt_hash (out, bcrypt_tests[i].password, bcrypt_tests[i].hash)
+          != 0)
+        {
+          printf ("Test %zu failed.\n", i);
+          rv = -1;
+          continue;
+        }
+      printf ("  Got:      %s\n", out);
+      if (strcmp (out, bcrypt_tests[i].hash) != 0
+          || bcrypt_verify (bcrypt_tests[i].password, bcrypt_tests[i].hash)
+                 != 0
+          || bcrypt_verify ("wrong", bcrypt_tests[i].hash) == 0)
+        {
+          printf ("Test %zu failed.\n", i);
+          rv = -1;
+        }
+    }
+
+  return rv;
+}
+
+static int
+run_bcrypt_setting_test (void)
+{
+  char setting[BCRYPT_SETTING_LENGTH + 1];
+  char out[BCRYPT_HASH_LENGTH + 1];
+  uint8_t salt[BCRYPT_SALT_SIZE];
+  size_t i;
+
+  for (i = 0; i < sizeof (salt); ++i)
+    salt[i] = (uint8_t)(i * 37 + 11);
+  if (bcrypt_setting (setting, salt, 3) == 0
+      || bcrypt_setting (setting, salt, 32) == 0)
+    return -1;
+  if (bcrypt_setting (setting, salt, 4) != 0
+      || strlen (setting) != BCRYPT_SETTING_LENGTH)
+    return -1;
+  printf ("bcrypt setting: %s\n", setting);
+  if (bcrypt_hash (out, "password", setting) != 0
+      || strlen (out) != BCRYPT_HASH_LENGTH
+      || strncmp (out, setting, BCRYPT_SETTING_LENGTH) != 0
+      || bcrypt_verify ("password", out) != 0)
+    return -1;
+
+  /* Malformed settings. */
+  if (bcrypt_hash (out, "password", "$2c$05$CCCCCCCCCCCCCCCCCCCCC.") == 0
+      || bcrypt_hash (out, "password", "$2a$03$CCCCCCCCCCCCCCCCCCCCC.") == 0
+      || bcrypt_hash (out, "password", "$2a$05$CCCCCCCCCC!CCCCCCCCCC.") == 0
+      || bcrypt_hash (out, "password", "$2a$05$CCCC") == 0)
+    return -1;
+
+  return 0;
+}
+
+/* Mixes costs, bad hashes and wrong passwords to exercise the grouping. */
+static int
+run_bcrypt_batch_test (void)
+{
+  const char *passwords[12];
+  const char *hashes[12];
+  int expect[12];
+  int results[12];
+  char cost4[BCRYPT_HASH_LENGTH + 1];
+  size_t i;
+
+  if (bcrypt_hash (cost4, "U*U", "$2b$04$CCCCCCCCCCCCCCCCCCCCC.") != 0)
+    return -1;
+  for (i = 0; i < 12; ++i)
+    {
+      passwords[i] = bcrypt_tests[i % BCRYPT_TESTS].password;
+      hashes[i] = bcrypt_tests[i % BCRYPT_TESTS].hash;
+      expect[i] = 0;
+    }
+  passwords[2] = "wrong";
+  expect[2] = -1;
+  hashes[5] = "$2a$05$bad";
+  expect[5] = -1;
+  passwords[6] = "U*U";
+  hashes[6] = cost4;
+  passwords[10] = "U*U";
+  hashes[10] = cost4;
+
+  bcrypt_verify_batch (passwords, hashes, results, 12);
+  for (i = 0; i < 12; ++i)
+    {
+      printf ("bcrypt batch %zu: %d\n", i, results[i]);
+      if (results[i] != expect[i])
+        return -1;
+    }
+
+  return 0;
+}
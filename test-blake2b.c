@@ -3114,9 +3114,33 @@ static const uint8_t blake2b_keyed_kat[256][BLAKE2B_DIGEST_SIZE] = {
     0x6d, 0xee, 0x2d, 0x46, 0xd6, 0x2e, 0xf2, 0xa4, 0x61 },
 };
 
+/* BLAKE2b-512 of the one million byte message built by blake2b_do_long. */
+static const uint8_t blake2b_long_digest[BLAKE2B_DIGEST_SIZE] = {
+  0x35, 0x2e, 0x27, 0x04, 0xd9, 0x0f, 0xf3, 0xce, 0xa8, 0xde, 0x95,
+  0x86, 0xb4, 0x45, 0x1f, 0xc7, 0xb6, 0x65, 0x6a, 0x72, 0x51, 0x71,
+  0x5c, 0x7f, 0xb0, 0xa3, 0xfc, 0xdd, 0xd5, 0xac, 0x6b, 0xcf, 0xcd,
+  0x06, 0x5b, 0x01, 0x3a, 0xca, 0x87, 0x84, 0x32, 0xa6, 0xd9, 0x3c,
+  0x51, 0x3c, 0xc8, 0xf4, 0xaa, 0x28, 0x6e, 0xc4, 0xe6, 0x40, 0xc4,
+  0x14, 0xc3, 0x8e, 0xdf, 0x9d, 0x85, 0xff, 0x8f, 0x9e
+};
+
+/*
+ * BLAKE2b of "abc" with a 32-byte digest, the key "kkkkk", the salt
+ * 0, 1, 2 ... and the personalization "fcrypt personal!", computed with
+ * Python's hashlib.
+ */
+static const uint8_t blake2b_param_digest[32] = {
+  0xe8, 0x20, 0xe2, 0x6f, 0x77, 0xf9, 0x5a, 0x4b, 0xd4, 0x73, 0xd4,
+  0x34, 0x62, 0xdc, 0x33, 0x2a, 0x17, 0x65, 0x40, 0x78, 0xb4, 0xea,
+  0x47, 0x12, 0xb3, 0x15, 0xb6, 0xe4, 0x3b, 0xef, 0x6f, 0x76
+};
+
 static void hexdump (const uint8_t *, size_t);
 static bool blake2b_do_kat (void);
 static bool blake2b_do_keyed_kat (void);
+static bool blake2b_do_param (void);
+static bool blake2b_do_long (void);
+static bool blake2b_do_fixed (void);
 
 int
 main (void)
@@ -3128,6 +3152,12 @@ main (void)
     rv = 1;
   if (!blake2b_do_keyed_kat ())
     rv = 1;
+  if (!blake2b_do_param ())
+    rv = 1;
+  if (!blake2b_do_long ())
+    rv = 1;
+  if (!blake2b_do_fixed ())
+    rv = 1;
 
   return rv;
 }
@@ -3207,3 +3237,98 @@ blake2b_do_keyed_kat (void)
 
   return retval;
 }
+
+/*
+ * Hashes a long message in one call and in pieces of varying length, so
+ * that runs of many blocks go through the compression function at once.
+ */
+static bool
+blake2b_do_long (void)
+{
+  static uint8_t message[1000000];
+  struct blake2b_ctx ctx;
+  uint8_t digest[BLAKE2B_DIGEST_SIZE];
+  size_t i, n;
+  bool retval;
+
+  for (i = 0; i < sizeof (message); ++i)
+    message[i] = (uint8_t)(i * 7 + (i >> 11));
+
+  retval = true;
+  blake2b (digest, message, NULL, BLAKE2B_DIGEST_SIZE, sizeof (message), 0);
+  hexdump (digest, BLAKE2B_DIGEST_SIZE);
+  if (memcmp (digest, blake2b_long_digest, BLAKE2B_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2b_long: Failed one-shot\n");
+    }
+
+  blake2b_init (&ctx, BLAKE2B_DIGEST_SIZE);
+  for (i = 0, n = 1; i < sizeof (message); i += n, n = n * 7 % 2039)
+    {
+      if (n > sizeof (message) - i)
+        n = sizeof (message) - i;
+      blake2b_update (&ctx, message + i, n);
+    }
+  blake2b_final (digest, &ctx);
+  if (memcmp (digest, blake2b_long_digest, BLAKE2B_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2b_long: Failed incremental\n");
+    }
+
+  return retval;
+}
+
+static bool
+blake2b_do_param (void)
+{
+  struct blake2b_param param;
+  struct blake2b_ctx ctx;
+  uint8_t digest[32];
+  size_t i;
+
+  memset (&param, 0, sizeof (param));
+  param.digestlen = sizeof (digest);
+  param.keylen = 5;
+  param.fanout = 1;
+  param.depth = 1;
+  for (i = 0; i < BLAKE2B_SALT_SIZE; ++i)
+    param.salt[i] = (uint8_t)i;
+  memcpy (param.personal, "fcrypt personal!", BLAKE2B_PERSONAL_SIZE);
+
+  blake2b_init_param (&ctx, &param, (const uint8_t *)"kkkkk");
+  blake2b_update (&ctx, "abc", 3);
+  blake2b_final (digest, &ctx);
+  hexdump (digest, sizeof (digest));
+  if (memcmp (digest, blake2b_param_digest, sizeof (digest)) != 0)
+    {
+      fprintf (stderr, "blake2b_param: Failed\n");
+      return false;
+    }
+
+  return true;
+}
+
+/* blake2b_64 on the 64-byte message of the unkeyed KAT. */
+static bool
+blake2b_do_fixed (void)
+{
+  uint8_t data[64 + 7];
+  uint8_t digest[BLAKE2B_DIGEST_SIZE];
+  uint32_t i, offset;
+
+  for (offset = 0; offset < 8; ++offset)
+    {
+      for (i = 0; i < 64; ++i)
+        data[offset + i] = i;
+      blake2b_64 (digest, data + offset);
+      if (memcmp (digest, blake2b_kat[64], BLAKE2B_DIGEST_SIZE) != 0)
+        {
+          fprintf (stderr, "blake2b_64: Failed at offset %u\n", offset);
+          return false;
+        }
+    }
+
+  return true;
+}
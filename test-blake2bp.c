@@ -0,0 +1,1736 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * The keyed test vectors match blake2bp-kat.txt from the CC0 reference
+ * implementation of BLAKE2. https://github.com/BLAKE2/BLAKE2
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2bp.h"
+
+static const uint8_t blake2bp_keyed_kat[256][BLAKE2BP_DIGEST_SIZE] = {
+  { 0x9d, 0x94, 0x61, 0x07, 0x3e, 0x4e, 0xb6, 0x40, 0xa2, 0x55, 0x35,
+    0x7b, 0x83, 0x9f, 0x39, 0x4b, 0x83, 0x8c, 0x6f, 0xf5, 0x7c, 0x9b,
+    0x68, 0x6a, 0x3f, 0x76, 0x10, 0x7c, 0x10, 0x66, 0x72, 0x8f, 0x3c,
+    0x99, 0x56, 0xbd, 0x78, 0x5c, 0xbc, 0x3b, 0xf7, 0x9d, 0xc2, 0xab,
+    0x57, 0x8c, 0x5a, 0x0c, 0x06, 0x3b, 0x9d, 0x9c, 0x40, 0x58, 0x48,
+    0xde, 0x1d, 0xbe, 0x82, 0x1c, 0xd0, 0x5c, 0x94, 0x0a },
+  { 0xff, 0x8e, 0x90, 0xa3, 0x7b, 0x94, 0x62, 0x39, 0x32, 0xc5, 0x9f,
+    0x75, 0x59, 0xf2, 0x60, 0x35, 0x02, 0x9c, 0x37, 0x67, 0x32, 0xcb,
+    0x14, 0xd4, 0x16, 0x02, 0x00, 0x1c, 0xbb, 0x73, 0xad, 0xb7, 0x92,
+    0x93, 0xa2, 0xdb, 0xda, 0x5f, 0x60, 0x70, 0x30, 0x25, 0x14, 0x4d,
+    0x15, 0x8e, 0x27, 0x35, 0x52, 0x95, 0x96, 0x25, 0x1c, 0x73, 0xc0,
+    0x34, 0x5c, 0xa6, 0xfc, 0xcb, 0x1f, 0xb1, 0xe9, 0x7e },
+  { 0xd6, 0x22, 0x0c, 0xa1, 0x95, 0xa0, 0xf3, 0x56, 0xa4, 0x79, 0x5e,
+    0x07, 0x1c, 0xee, 0x1f, 0x54, 0x12, 0xec, 0xd9, 0x5d, 0x8a, 0x5e,
+    0x01, 0xd7, 0xc2, 0xb8, 0x67, 0x50, 0xca, 0x53, 0xd7, 0xf6, 0x4c,
+    0x29, 0xcb, 0xb3, 0xd2, 0x89, 0xc6, 0xf4, 0xec, 0xc6, 0xc0, 0x1e,
+    0x3c, 0xa9, 0x33, 0x89, 0x71, 0x17, 0x03, 0x88, 0xe3, 0xe4, 0x02,
+    0x28, 0x47, 0x90, 0x06, 0xd1, 0xbb, 0xeb, 0xad, 0x51 },
+  { 0x30, 0x30, 0x2c, 0x3f, 0xc9, 0x99, 0x06, 0x5d, 0x10, 0xdc, 0x98,
+    0x2c, 0x8f, 0xee, 0xf4, 0x1b, 0xbb, 0x66, 0x42, 0x71, 0x8f, 0x62,
+    0x4a, 0xf6, 0xe3, 0xea, 0xbe, 0xa0, 0x83, 0xe7, 0xfe, 0x78, 0x53,
+    0x40, 0xdb, 0x4b, 0x08, 0x97, 0xef, 0xff, 0x39, 0xce, 0xe1, 0xdc,
+    0x1e, 0xb7, 0x37, 0xcd, 0x1e, 0xea, 0x0f, 0xe7, 0x53, 0x84, 0x98,
+    0x4e, 0x7d, 0x8f, 0x44, 0x6f, 0xaa, 0x68, 0x3b, 0x80 },
+  { 0x32, 0xf3, 0x98, 0xa6, 0x0c, 0x1e, 0x53, 0xf1, 0xf8, 0x1d, 0x6d,
+    0x8d, 0xa2, 0xec, 0x11, 0x75, 0x42, 0x2d, 0x6b, 0x2c, 0xfa, 0x0c,
+    0x0e, 0x66, 0xd8, 0xc4, 0xe7, 0x30, 0xb2, 0x96, 0xa4, 0xb5, 0x3e,
+    0x39, 0x2e, 0x39, 0x85, 0x98, 0x22, 0xa1, 0x45, 0xae, 0x5f, 0x1a,
+    0x24, 0xc2, 0x7f, 0x55, 0x33, 0x9e, 0x2b, 0x4b, 0x44, 0x58, 0xe8,
+    0xc5, 0xeb, 0x19, 0xaa, 0x14, 0x20, 0x64, 0x27, 0xaa },
+  { 0x23, 0x6d, 0xb9, 0x33, 0xf1, 0x8a, 0x9d, 0xbd, 0x4e, 0x50, 0xb7,
+    0x29, 0x53, 0x90, 0x65, 0xbd, 0xa4, 0x20, 0xdf, 0x97, 0xac, 0x78,
+    0x0b, 0xe4, 0x3f, 0x59, 0x10, 0x3c, 0x47, 0x2e, 0x0b, 0xcc, 0xa6,
+    0xd4, 0x97, 0x38, 0x97, 0x86, 0xaf, 0x22, 0xba, 0x94, 0x30, 0xb7,
+    0x4d, 0x6f, 0x74, 0xb1, 0x3f, 0x6f, 0x94, 0x9e, 0x25, 0x6a, 0x14,
+    0x0a, 0xa3, 0x4b, 0x47, 0x70, 0x0b, 0x10, 0x03, 0x43 },
+  { 0x23, 0x8c, 0x9d, 0x08, 0x02, 0x85, 0xe3, 0x54, 0x35, 0xcb, 0x53,
+    0x15, 0x5d, 0x9f, 0x79, 0x2c, 0xa1, 0xbb, 0x27, 0xde, 0x4f, 0x9b,
+    0x6c, 0x87, 0x26, 0xe1, 0x1c, 0x02, 0x8e, 0x7b, 0x87, 0x87, 0x33,
+    0x54, 0x91, 0x12, 0xa3, 0x28, 0xb5, 0x0e, 0x8c, 0xd8, 0xba, 0x27,
+    0x87, 0x21, 0x7e, 0x46, 0xb8, 0x16, 0x8d, 0x57, 0x11, 0x3d, 0xd4,
+    0x04, 0xd9, 0x14, 0xe2, 0x9a, 0x6a, 0x54, 0x70, 0xe6 },
+  { 0x9a, 0x02, 0x1e, 0xbd, 0x50, 0x4a, 0x97, 0x59, 0x6d, 0x0e, 0x85,
+    0x04, 0x8a, 0xe1, 0xda, 0x89, 0x99, 0xe3, 0xa0, 0x47, 0x01, 0x6f,
+    0x17, 0xc6, 0xc5, 0x55, 0x6c, 0x27, 0x31, 0xe9, 0xb1, 0x39, 0x26,
+    0x1f, 0x84, 0x3f, 0xad, 0x6b, 0xd4, 0x3f, 0x7c, 0x7c, 0x58, 0x7f,
+    0x69, 0x8d, 0x69, 0xb6, 0x82, 0xe5, 0x68, 0xb4, 0x42, 0xac, 0x45,
+    0x88, 0x98, 0x57, 0xb7, 0x69, 0x07, 0x34, 0xcd, 0xbb },
+  { 0x3a, 0xba, 0x07, 0xae, 0x98, 0x0e, 0x33, 0x86, 0x37, 0x47, 0x9d,
+    0xca, 0x1e, 0x35, 0x28, 0x00, 0xf4, 0x58, 0x8e, 0x62, 0xd8, 0x23,
+    0x36, 0x5a, 0xa6, 0x9c, 0x5b, 0x25, 0xfc, 0xe1, 0x29, 0x68, 0xd2,
+    0x6c, 0x9b, 0xdb, 0xee, 0x9a, 0x32, 0xbf, 0xfd, 0x42, 0xe6, 0xb2,
+    0x2c, 0x81, 0x38, 0xa6, 0x1c, 0x1f, 0xce, 0x49, 0xff, 0xbc, 0x19,
+    0x0e, 0x1e, 0x15, 0x16, 0x01, 0x53, 0xcc, 0xb6, 0xb4 },
+  { 0x77, 0x4c, 0xdf, 0x9a, 0xbb, 0x50, 0x81, 0xfe, 0x07, 0xeb, 0x57,
+    0x25, 0xe6, 0x06, 0x9b, 0x8d, 0x6c, 0x7e, 0x60, 0x04, 0xa2, 0x4d,
+    0x70, 0xf7, 0xdf, 0xab, 0xfc, 0x03, 0x82, 0x5b, 0xbc, 0x3b, 0x30,
+    0xe6, 0x20, 0xb6, 0x04, 0x1f, 0x3c, 0xc2, 0x89, 0x6b, 0x14, 0xab,
+    0x66, 0x0a, 0xf7, 0x2e, 0x24, 0x95, 0x10, 0xac, 0x2f, 0xe8, 0x10,
+    0xcc, 0x77, 0x63, 0xa2, 0xe5, 0xc3, 0xfc, 0xa7, 0xfc },
+  { 0x9e, 0x08, 0x9f, 0x51, 0x65, 0x7b, 0x29, 0xc2, 0x66, 0x8e, 0x28,
+    0x50, 0x52, 0x4e, 0x53, 0xae, 0xaa, 0xa7, 0x30, 0x6f, 0x2a, 0xd5,
+    0xa2, 0x32, 0xb5, 0xf0, 0x7f, 0x68, 0x8d, 0x8a, 0xb2, 0xb4, 0x25,
+    0xdf, 0x7e, 0xa5, 0xbd, 0x3e, 0x9f, 0xfd, 0x61, 0x68, 0x38, 0x90,
+    0x15, 0x1d, 0x78, 0xbb, 0x94, 0x03, 0x11, 0x85, 0xac, 0xa4, 0x81,
+    0xe2, 0x14, 0x0f, 0xe3, 0x79, 0x85, 0x36, 0x76, 0x43 },
+  { 0xb3, 0x5b, 0xd5, 0x4e, 0x4f, 0x81, 0x69, 0x6b, 0x4f, 0x22, 0x31,
+    0x6a, 0x1e, 0x33, 0x7d, 0x98, 0xd1, 0xc6, 0xb0, 0x61, 0x10, 0x99,
+    0x87, 0x63, 0xb5, 0x91, 0x33, 0x35, 0x92, 0x3a, 0x40, 0x76, 0xcb,
+    0x80, 0xd6, 0xd8, 0xa5, 0x18, 0x62, 0x91, 0x13, 0x47, 0x7b, 0x30,
+    0xa1, 0x32, 0xa6, 0xb2, 0x7f, 0xc1, 0xee, 0x79, 0xf6, 0xb2, 0xe0,
+    0xd3, 0x5d, 0x5b, 0xc2, 0x97, 0x27, 0x46, 0x3d, 0xb5 },
+  { 0x12, 0x39, 0x30, 0xd5, 0xa4, 0xb7, 0x3b, 0x49, 0x1f, 0x50, 0xe5,
+    0x6e, 0x2b, 0x73, 0x97, 0xa4, 0x3d, 0x2e, 0x47, 0x87, 0x23, 0x76,
+    0x02, 0xb6, 0x6f, 0xe0, 0xa8, 0x47, 0xbd, 0x13, 0xcb, 0xe8, 0xb3,
+    0x7d, 0xc7, 0x03, 0xd7, 0xb2, 0xb4, 0xea, 0xa8, 0xbf, 0xb9, 0xa5,
+    0x8a, 0x7d, 0x71, 0x9c, 0x90, 0x8f, 0x19, 0x66, 0xa2, 0xf1, 0x9f,
+    0xe6, 0xeb, 0x1a, 0x78, 0x96, 0x2a, 0xfa, 0x5b, 0xf9 },
+  { 0x08, 0x9c, 0xbc, 0x7e, 0xe1, 0xb1, 0x2c, 0x0c, 0xc9, 0xc8, 0x3f,
+    0xf6, 0x66, 0xfe, 0xc8, 0x02, 0x6b, 0xb7, 0x1b, 0x90, 0x84, 0x97,
+    0x9b, 0x0e, 0xa8, 0xb7, 0x23, 0xbb, 0xbe, 0x8b, 0x00, 0xd4, 0x10,
+    0x08, 0xb6, 0x04, 0x99, 0xf2, 0x4f, 0x24, 0x1b, 0x63, 0x28, 0x1f,
+    0xe5, 0xb4, 0xd8, 0x89, 0x66, 0x30, 0x9c, 0x0d, 0x7e, 0x64, 0x66,
+    0x91, 0x05, 0xe5, 0x1e, 0x69, 0xd7, 0xaf, 0x8c, 0xe5 },
+  { 0x6b, 0x3c, 0x67, 0x89, 0x47, 0xf6, 0x12, 0x52, 0x65, 0x7c, 0x35,
+    0x49, 0x78, 0xc1, 0x01, 0xb2, 0xfd, 0xd2, 0x72, 0x9e, 0xc3, 0x49,
+    0x27, 0xdd, 0x5e, 0xff, 0x0a, 0x7c, 0x0a, 0x86, 0x58, 0x26, 0xe8,
+    0x33, 0xc3, 0x63, 0x23, 0x21, 0x31, 0xb1, 0x05, 0x93, 0xbe, 0x1c,
+    0xcf, 0x6b, 0xa5, 0x4e, 0xcc, 0x14, 0x31, 0x2f, 0x45, 0xbf, 0xfc,
+    0x24, 0x04, 0x62, 0x9f, 0xf8, 0x02, 0x67, 0xf0, 0x94 },
+  { 0xaa, 0x0c, 0x23, 0xea, 0x1c, 0x6f, 0xe2, 0xe9, 0x0a, 0x77, 0x18,
+    0xef, 0x4a, 0xa4, 0x75, 0x1f, 0xf6, 0xbe, 0xb9, 0xd4, 0x61, 0x63,
+    0x59, 0x5b, 0x5d, 0x4f, 0xb8, 0x96, 0x00, 0x52, 0x5c, 0x5b, 0x6c,
+    0xf1, 0x9e, 0xcd, 0xb2, 0x47, 0x78, 0x72, 0xa7, 0xa1, 0x2d, 0x40,
+    0xe5, 0x06, 0x36, 0x08, 0xe5, 0xf0, 0x00, 0x8e, 0x79, 0x72, 0xa9,
+    0xc0, 0x1a, 0x4b, 0xe2, 0xaf, 0xe9, 0x53, 0x2f, 0x9c },
+  { 0x63, 0x34, 0x7a, 0xb4, 0xcb, 0xb6, 0xf2, 0x89, 0x52, 0x99, 0x2c,
+    0x07, 0x9d, 0x18, 0xd4, 0x20, 0x01, 0xb7, 0xf3, 0xa9, 0xd0, 0xfd,
+    0x90, 0xb0, 0xa4, 0x77, 0x1f, 0x69, 0x72, 0xf0, 0xc5, 0x32, 0x89,
+    0xc8, 0xae, 0xe1, 0x43, 0x29, 0x4b, 0x50, 0xc6, 0x34, 0x12, 0x58,
+    0x5c, 0xdc, 0xe4, 0xff, 0x7b, 0xed, 0x11, 0x2c, 0xd0, 0x3c, 0x9b,
+    0x1d, 0xf3, 0xde, 0xf0, 0xcc, 0x32, 0x0d, 0x6b, 0x70 },
+  { 0x23, 0x96, 0xc0, 0xcb, 0x9e, 0xda, 0xac, 0xa9, 0xd8, 0xb1, 0x04,
+    0x65, 0x2c, 0xb7, 0xf1, 0x25, 0xf1, 0x93, 0x55, 0x1a, 0xe5, 0xd7,
+    0xbc, 0x94, 0x63, 0x30, 0x7c, 0x9e, 0x69, 0xca, 0x7d, 0xa2, 0x3a,
+    0x9f, 0xbc, 0xbc, 0xb8, 0x66, 0x69, 0xd5, 0xba, 0x63, 0x43, 0x85,
+    0x93, 0xe1, 0x32, 0xf9, 0x92, 0xb5, 0x7c, 0x00, 0x17, 0xc8, 0x6d,
+    0xdb, 0x9b, 0x47, 0x28, 0x6e, 0xf5, 0xb6, 0x87, 0x18 },
+  { 0xa9, 0x4b, 0x80, 0x22, 0x57, 0xfd, 0x03, 0x1e, 0xe6, 0x0f, 0x1b,
+    0xe1, 0x84, 0x38, 0x3a, 0x76, 0x32, 0x85, 0x39, 0xf9, 0xd8, 0x06,
+    0x08, 0x72, 0xef, 0x35, 0x73, 0xbe, 0xb6, 0xf2, 0x73, 0x68, 0x08,
+    0x95, 0x90, 0xed, 0xbb, 0x21, 0xf4, 0xd8, 0xf1, 0x81, 0xba, 0x66,
+    0x20, 0x75, 0xf9, 0x19, 0x05, 0x97, 0x4b, 0xee, 0xef, 0x1f, 0xc5,
+    0xcb, 0x9b, 0xcf, 0xb2, 0x8a, 0xae, 0x1e, 0x4d, 0xe3 },
+  { 0x52, 0xc7, 0xd3, 0x39, 0x9a, 0x03, 0x80, 0x04, 0xbe, 0xa5, 0x2d,
+    0x3e, 0xa9, 0xe9, 0x1e, 0x25, 0x44, 0xc8, 0x65, 0x2a, 0xb8, 0xf5,
+    0x28, 0x5c, 0x9d, 0x32, 0x18, 0x63, 0x7a, 0x6d, 0x9f, 0xca, 0xf0,
+    0xd9, 0x65, 0xb3, 0x58, 0x8e, 0xe6, 0xd7, 0x3f, 0xa5, 0x99, 0xde,
+    0xca, 0x1f, 0x41, 0xde, 0xd8, 0x02, 0x5b, 0xf7, 0x76, 0x8e, 0x0e,
+    0x20, 0x0e, 0x8c, 0xd3, 0xff, 0x86, 0x8c, 0x38, 0x00 },
+  { 0xb6, 0x29, 0xf5, 0x71, 0x62, 0x87, 0x6a, 0xdb, 0x8f, 0xa9, 0x57,
+    0x2e, 0xba, 0x4e, 0x1e, 0xcd, 0x75, 0xa6, 0x56, 0x73, 0x08, 0xde,
+    0x90, 0xdb, 0xb8, 0xff, 0xde, 0x77, 0xde, 0x82, 0x13, 0xa4, 0xd7,
+    0xf7, 0xcb, 0x85, 0xae, 0x1b, 0x71, 0xe6, 0x45, 0x7b, 0xc4, 0xe8,
+    0x9c, 0x0d, 0x9d, 0xe2, 0x41, 0xb6, 0xb9, 0xf3, 0x74, 0xb7, 0x34,
+    0x19, 0x4d, 0xb2, 0xb2, 0x67, 0x02, 0xd7, 0xcb, 0x7c },
+  { 0x72, 0x28, 0x46, 0xdd, 0xac, 0xaa, 0x94, 0xfd, 0xe6, 0x63, 0x2a,
+    0x2d, 0xc7, 0xdc, 0x70, 0x8b, 0xdf, 0x98, 0x31, 0x1c, 0x9f, 0xb6,
+    0x3c, 0x61, 0xe5, 0x25, 0xfd, 0x4b, 0x0d, 0x87, 0xb6, 0x38, 0x8b,
+    0x5a, 0xf7, 0x04, 0x20, 0x18, 0xdd, 0xca, 0x06, 0x5e, 0x8a, 0x55,
+    0xbb, 0xfd, 0x68, 0xee, 0x61, 0xfc, 0xd3, 0xc6, 0x87, 0x8f, 0x5b,
+    0x09, 0xbc, 0xc2, 0x7b, 0xed, 0x61, 0xdd, 0x93, 0xed },
+  { 0x1c, 0xed, 0x6a, 0x0c, 0x78, 0x9d, 0xdb, 0x29, 0x56, 0x78, 0xad,
+    0x43, 0xa3, 0x22, 0xd8, 0x96, 0x61, 0x7f, 0xde, 0x27, 0x5f, 0x13,
+    0x8c, 0xcc, 0xfb, 0x13, 0x26, 0xcd, 0x3f, 0x76, 0x09, 0xc2, 0xaa,
+    0xa5, 0xec, 0x10, 0x26, 0x97, 0x17, 0x3e, 0x12, 0x1a, 0xe1, 0x63,
+    0x02, 0x4f, 0x42, 0x8c, 0x98, 0x28, 0x35, 0xb4, 0xfa, 0x6d, 0xa6,
+    0xd6, 0x78, 0xae, 0xb9, 0xee, 0x10, 0x6a, 0x3f, 0x6c },
+  { 0xe8, 0x69, 0x14, 0x8c, 0x05, 0x45, 0xb3, 0x58, 0x0e, 0x39, 0x5a,
+    0xfd, 0xc7, 0x45, 0xcd, 0x24, 0x3b, 0x6b, 0x5f, 0xe3, 0xb6, 0x7e,
+    0x29, 0x43, 0xf6, 0xf8, 0xd9, 0xf2, 0x4f, 0xfa, 0x40, 0xe8, 0x81,
+    0x75, 0x6e, 0x1c, 0x18, 0xd9, 0x2f, 0x3e, 0xbe, 0x84, 0x55, 0x9b,
+    0x57, 0xe2, 0xee, 0x3a, 0x65, 0xd9, 0xec, 0xe0, 0x49, 0x72, 0xb3,
+    0x5d, 0x4c, 0x4e, 0xbe, 0x78, 0x6c, 0x88, 0xda, 0x62 },
+  { 0xda, 0xda, 0x15, 0x5e, 0x55, 0x42, 0x32, 0xb1, 0x6e, 0xca, 0xd9,
+    0x31, 0xcb, 0x42, 0xe3, 0x25, 0xb5, 0x86, 0xdb, 0xf1, 0xcb, 0xd0,
+    0xce, 0x38, 0x14, 0x45, 0x16, 0x6b, 0xd1, 0xbf, 0xa3, 0x32, 0x49,
+    0x85, 0xe7, 0x7c, 0x6f, 0x0d, 0x51, 0x2a, 0x02, 0x6e, 0x09, 0xd4,
+    0x86, 0x1c, 0x3b, 0xb8, 0x52, 0x9d, 0x72, 0x02, 0xea, 0xc1, 0xc0,
+    0x44, 0x27, 0x44, 0xd3, 0x7c, 0x7f, 0x5a, 0xb8, 0xaf },
+  { 0x2d, 0x14, 0x8c, 0x8e, 0x8f, 0x76, 0xfa, 0xac, 0x6f, 0x7f, 0x01,
+    0xf2, 0x03, 0x9e, 0xa0, 0x2a, 0x42, 0xd9, 0x32, 0x57, 0x94, 0xc2,
+    0xc7, 0xa0, 0x0f, 0x83, 0xf4, 0xa7, 0x79, 0x8a, 0xfb, 0xa9, 0x93,
+    0xff, 0x94, 0x91, 0x1e, 0x09, 0x8b, 0x00, 0x1a, 0x0b, 0xdf, 0xf4,
+    0xc8, 0x5a, 0x2a, 0x61, 0x31, 0xe0, 0xcf, 0xe7, 0x0f, 0x1d, 0x2e,
+    0x07, 0xaf, 0x02, 0x09, 0xda, 0x77, 0x96, 0x09, 0x1f },
+  { 0x99, 0x98, 0x3a, 0x75, 0x9c, 0xcf, 0x9c, 0xac, 0xae, 0x70, 0x2d,
+    0xcb, 0xfc, 0xdf, 0x72, 0x04, 0xdd, 0xf0, 0x33, 0x4b, 0xc6, 0x5d,
+    0xad, 0x84, 0x6f, 0x83, 0x1f, 0x9f, 0x9d, 0x8a, 0x45, 0x3f, 0x0d,
+    0x24, 0x93, 0x5c, 0x4c, 0x65, 0x7f, 0xff, 0x2e, 0xbb, 0xdb, 0xaf,
+    0x7b, 0xce, 0x6a, 0xac, 0xdb, 0xb8, 0x87, 0x6f, 0x16, 0x04, 0x59,
+    0xb1, 0xa4, 0xaa, 0xc9, 0x56, 0x97, 0xe0, 0x0d, 0x98 },
+  { 0x7e, 0x4a, 0x02, 0x12, 0x6d, 0x75, 0x52, 0xf4, 0xc9, 0xb9, 0x4d,
+    0x80, 0xe3, 0xcf, 0x7b, 0x89, 0x7e, 0x09, 0x84, 0xe4, 0x06, 0xf0,
+    0x78, 0x13, 0x5c, 0xf4, 0x56, 0xc0, 0xd5, 0x1e, 0x13, 0x91, 0xff,
+    0x18, 0xa8, 0x8f, 0x93, 0x12, 0x2c, 0x83, 0x2c, 0xac, 0x7d, 0x79,
+    0x6a, 0x6b, 0x42, 0x51, 0x9b, 0x1d, 0xb4, 0xea, 0xd8, 0xf4, 0x98,
+    0x40, 0xce, 0xb5, 0x52, 0x33, 0x6b, 0x29, 0xde, 0x44 },
+  { 0xd7, 0xe1, 0x6f, 0xd1, 0x59, 0x65, 0x8a, 0xd7, 0xee, 0x25, 0x1e,
+    0x51, 0x7d, 0xce, 0x5a, 0x29, 0xf4, 0x6f, 0xd4, 0xb8, 0xd3, 0x19,
+    0xdb, 0x80, 0x5f, 0xc2, 0x5a, 0xa6, 0x20, 0x35, 0x0f, 0xf4, 0x23,
+    0xad, 0x8d, 0x05, 0x37, 0xcd, 0x20, 0x69, 0x43, 0x2e, 0xbf, 0xf2,
+    0x92, 0x36, 0xf8, 0xc2, 0xa8, 0xa0, 0x4d, 0x04, 0xb3, 0xb4, 0x8c,
+    0x59, 0xa3, 0x55, 0xfc, 0xc6, 0x2d, 0x27, 0xf8, 0xee },
+  { 0x0d, 0x45, 0x17, 0xd4, 0xf1, 0xd0, 0x47, 0x30, 0xc6, 0x91, 0x69,
+    0x18, 0xa0, 0x4c, 0x9e, 0x90, 0xcc, 0xa3, 0xac, 0x1c, 0x63, 0xd6,
+    0x45, 0x97, 0x8a, 0x7f, 0x07, 0x03, 0x9f, 0x92, 0x20, 0x64, 0x7c,
+    0x25, 0xc0, 0x4e, 0x85, 0xf6, 0xe2, 0x28, 0x6d, 0x2e, 0x35, 0x46,
+    0x0d, 0x0b, 0x2c, 0x1e, 0x25, 0xaf, 0x9d, 0x35, 0x37, 0xef, 0x33,
+    0xfd, 0x7f, 0xe5, 0x1e, 0x2b, 0xa8, 0x76, 0x4b, 0x36 },
+  { 0x56, 0xb7, 0x2e, 0x51, 0x37, 0xc6, 0x89, 0xb2, 0x73, 0x66, 0xfb,
+    0x22, 0xc7, 0xc6, 0x75, 0x44, 0xf6, 0xbc, 0xe5, 0x76, 0x19, 0x41,
+    0x31, 0xc5, 0xbf, 0xab, 0x1c, 0xf9, 0x3c, 0x2b, 0x51, 0xaa, 0xa3,
+    0x03, 0x36, 0x8a, 0xa8, 0x44, 0xd5, 0x8d, 0xf0, 0xee, 0x5d, 0x4e,
+    0x31, 0x9f, 0xcd, 0x8e, 0xff, 0xc6, 0x02, 0xce, 0xe4, 0x35, 0x1b,
+    0xd2, 0xf5, 0x51, 0x43, 0x0b, 0x92, 0x11, 0xe7, 0x3c },
+  { 0xf3, 0x35, 0xcc, 0x22, 0xff, 0xea, 0x5a, 0xa5, 0x9c, 0xdf, 0xc8,
+    0xf5, 0x02, 0x89, 0xcc, 0x92, 0x31, 0x9b, 0x8b, 0x14, 0x40, 0x8d,
+    0x7a, 0x5a, 0xa1, 0x23, 0x2a, 0xe2, 0x3a, 0xa1, 0xea, 0x7f, 0x77,
+    0x48, 0xcf, 0xef, 0x03, 0x20, 0x10, 0xf8, 0x62, 0x6d, 0x93, 0x18,
+    0xed, 0xba, 0x98, 0xd4, 0x16, 0x62, 0x03, 0x35, 0xc9, 0x01, 0xed,
+    0x02, 0xea, 0xbd, 0x27, 0x6a, 0x1b, 0x82, 0x9c, 0x9d },
+  { 0xa9, 0x9a, 0x3d, 0x10, 0xf9, 0x5b, 0x44, 0x2f, 0xff, 0xf7, 0xc4,
+    0x18, 0xfa, 0x94, 0x9d, 0x48, 0x30, 0x86, 0x9b, 0x0e, 0x60, 0xec,
+    0x8b, 0x97, 0x2c, 0x30, 0xa3, 0x16, 0x9c, 0x27, 0xbe, 0xb5, 0xcf,
+    0x33, 0x05, 0x94, 0xf0, 0x14, 0xb6, 0x6b, 0x22, 0x00, 0xa7, 0xf0,
+    0x86, 0xd2, 0xc2, 0xf3, 0xf9, 0xfd, 0x85, 0x32, 0xa5, 0x71, 0x88,
+    0x76, 0xdf, 0xca, 0x66, 0x1b, 0xa0, 0xf7, 0xb3, 0x6d },
+  { 0x15, 0x8e, 0x25, 0x70, 0xd0, 0x84, 0xa4, 0x86, 0x9d, 0x96, 0x93,
+    0x43, 0xc0, 0x10, 0x86, 0x07, 0x17, 0xff, 0x74, 0x11, 0x61, 0x88,
+    0x17, 0x5f, 0x2e, 0xd7, 0x4c, 0xd5, 0x78, 0xfa, 0x0d, 0x80, 0x91,
+    0xb0, 0x3f, 0xad, 0x0c, 0x65, 0xcf, 0x59, 0xab, 0x91, 0xdd, 0x73,
+    0xb3, 0x7f, 0xe3, 0xf5, 0x8a, 0x58, 0xe7, 0xb4, 0x47, 0x9c, 0x87,
+    0x5a, 0xcd, 0x63, 0xec, 0x52, 0x58, 0x12, 0x35, 0x3f },
+  { 0x7c, 0x49, 0x50, 0x1c, 0x58, 0x08, 0xb1, 0x5c, 0x0d, 0x31, 0xbd,
+    0xd5, 0xbb, 0x56, 0x31, 0xd5, 0x3a, 0xe0, 0x0d, 0xf4, 0x31, 0x02,
+    0x5f, 0xea, 0x51, 0xeb, 0x47, 0x62, 0x54, 0x4e, 0xfd, 0xee, 0x97,
+    0x8a, 0x83, 0x50, 0x8d, 0xea, 0x6b, 0xfd, 0x3b, 0x93, 0x1a, 0x0e,
+    0x95, 0x83, 0xcc, 0xfc, 0x04, 0x9e, 0xa8, 0x46, 0x44, 0x70, 0x5d,
+    0x31, 0x9f, 0xdc, 0x5c, 0x16, 0x3b, 0xf4, 0x82, 0x24 },
+  { 0xfe, 0xf4, 0x36, 0xb3, 0x5f, 0x71, 0x7d, 0x59, 0xac, 0xa1, 0x7e,
+    0x9b, 0xf5, 0xff, 0xda, 0x28, 0xf5, 0xf4, 0x01, 0x94, 0x3e, 0xfe,
+    0x93, 0xeb, 0x58, 0x0f, 0xfb, 0x98, 0xf1, 0x3b, 0xea, 0x80, 0x94,
+    0x69, 0xa3, 0x44, 0xe7, 0x82, 0xa4, 0x43, 0xc6, 0x4e, 0xb2, 0x5a,
+    0xd0, 0x9d, 0x8d, 0xe2, 0x05, 0xfe, 0xe7, 0xd5, 0x63, 0x96, 0x86,
+    0xa1, 0x9e, 0x7c, 0x42, 0xb4, 0x0f, 0x70, 0x6a, 0x08 },
+  { 0x4d, 0x47, 0xa6, 0x7a, 0x5f, 0x8e, 0x17, 0xb7, 0x22, 0xdf, 0x98,
+    0x58, 0xae, 0xb6, 0x7b, 0x99, 0x56, 0xb4, 0x59, 0x62, 0xec, 0x35,
+    0x3d, 0xc2, 0xe2, 0x7f, 0x0f, 0x50, 0x1c, 0x39, 0x8e, 0x34, 0x39,
+    0x7b, 0xeb, 0xe0, 0x2b, 0x54, 0x92, 0x7e, 0x2d, 0x31, 0xf1, 0x2e,
+    0xcf, 0x55, 0xe8, 0x82, 0x69, 0xfa, 0xb5, 0x37, 0x0e, 0x7f, 0xa5,
+    0x70, 0x35, 0x26, 0x6f, 0x89, 0xd5, 0xc2, 0x64, 0x41 },
+  { 0x1b, 0x58, 0xdc, 0x7a, 0xac, 0x36, 0x3b, 0x00, 0x44, 0x6e, 0xa8,
+    0x03, 0xbc, 0xd7, 0x49, 0xc3, 0xf5, 0xca, 0xbe, 0xaa, 0xf2, 0x23,
+    0x99, 0x4c, 0x0c, 0x3e, 0xcc, 0x1b, 0x28, 0x47, 0x73, 0x44, 0xd7,
+    0xbf, 0x97, 0xc0, 0x8a, 0x95, 0x9d, 0x1a, 0xc2, 0x06, 0x0b, 0x47,
+    0x27, 0x89, 0x86, 0x92, 0x91, 0x88, 0xad, 0x73, 0xde, 0x67, 0x07,
+    0x8b, 0xa6, 0x80, 0x96, 0x3b, 0x9d, 0x3b, 0x12, 0xa4 },
+  { 0x3c, 0x52, 0x2c, 0x84, 0x3e, 0x69, 0x74, 0xec, 0x75, 0x0d, 0xf2,
+    0x20, 0xd4, 0x1a, 0x00, 0x4a, 0xc2, 0xad, 0xf0, 0x94, 0x56, 0xfa,
+    0x78, 0x7f, 0x7c, 0x65, 0x43, 0xab, 0x17, 0x97, 0x9c, 0x77, 0x7b,
+    0x3e, 0x79, 0xd1, 0x78, 0x7d, 0xa5, 0xa8, 0x3f, 0x17, 0x8d, 0xa9,
+    0xf0, 0x4c, 0xf6, 0xf5, 0xb2, 0x55, 0xdd, 0xcb, 0x18, 0x74, 0x84,
+    0x1b, 0xbf, 0x70, 0x16, 0xe6, 0x13, 0x2b, 0x99, 0x8a },
+  { 0x5a, 0x4f, 0xeb, 0x8f, 0x70, 0x75, 0xb4, 0xdc, 0x9c, 0xa1, 0x6c,
+    0x6f, 0x05, 0xcd, 0x6b, 0x70, 0x27, 0x48, 0x5f, 0xfe, 0xd9, 0x15,
+    0x7d, 0x82, 0x4d, 0x9d, 0x1a, 0x17, 0x20, 0xee, 0xee, 0xea, 0x3f,
+    0x6c, 0x12, 0x5f, 0xda, 0x4b, 0xa4, 0x40, 0x9d, 0x79, 0x80, 0x49,
+    0xfd, 0x18, 0x82, 0xc6, 0x90, 0x28, 0x8f, 0x33, 0x54, 0x7a, 0x3d,
+    0x8d, 0x62, 0x60, 0xb6, 0x54, 0x54, 0x88, 0x53, 0xd7 },
+  { 0xbc, 0xaa, 0x79, 0x36, 0x32, 0x56, 0x9e, 0x2f, 0x84, 0x17, 0xcc,
+    0x60, 0x32, 0x53, 0x53, 0x5b, 0xd7, 0xd8, 0x5f, 0x38, 0x53, 0x19,
+    0x92, 0x59, 0x1e, 0x56, 0xc1, 0xa4, 0xb6, 0xf5, 0x8e, 0xe7, 0xf8,
+    0x18, 0xfa, 0xe0, 0x27, 0x88, 0x8a, 0x86, 0x28, 0x43, 0x05, 0x10,
+    0x1e, 0xc0, 0x46, 0x61, 0xf5, 0x99, 0x53, 0x47, 0xa4, 0x67, 0xed,
+    0x8b, 0x92, 0x79, 0xf1, 0xac, 0xc2, 0xb4, 0xbb, 0x1f },
+  { 0x34, 0xaf, 0x91, 0xcc, 0x22, 0xa6, 0x9b, 0xcb, 0x55, 0xdd, 0xbf,
+    0x7f, 0x0f, 0x43, 0xec, 0x56, 0x48, 0x40, 0x43, 0x32, 0x13, 0xea,
+    0x55, 0xd9, 0xf8, 0x1a, 0xc4, 0x75, 0x20, 0x8d, 0x74, 0x85, 0x1d,
+    0xb7, 0x0f, 0xe4, 0x96, 0xaf, 0x9d, 0xa1, 0xd3, 0x93, 0xec, 0xf8,
+    0x78, 0x69, 0x5d, 0xd3, 0x3f, 0xd5, 0x43, 0x49, 0xa6, 0xf8, 0x24,
+    0xae, 0xed, 0x18, 0x3c, 0xb1, 0xb0, 0x8c, 0x54, 0x85 },
+  { 0xb8, 0xb7, 0xad, 0x2e, 0xa2, 0xb6, 0xfa, 0x06, 0xd0, 0x0b, 0xcd,
+    0x59, 0x9c, 0x99, 0x71, 0xc5, 0xb4, 0xe1, 0x65, 0x58, 0xe1, 0x52,
+    0x12, 0xc9, 0xbf, 0xd3, 0x73, 0xe4, 0xbc, 0x79, 0x17, 0x05, 0x26,
+    0x01, 0xff, 0xdb, 0x68, 0x01, 0xbe, 0x80, 0xba, 0x50, 0x9d, 0xb8,
+    0x2a, 0x0b, 0x71, 0x95, 0x92, 0x91, 0x33, 0xad, 0x53, 0x99, 0x56,
+    0x06, 0x52, 0x33, 0xf4, 0x9d, 0x07, 0x1c, 0x84, 0xe4 },
+  { 0xdc, 0xee, 0x9c, 0x45, 0xbc, 0x5d, 0x1f, 0xe6, 0x30, 0xb1, 0x8b,
+    0x06, 0x3c, 0xe8, 0x2c, 0x38, 0x57, 0xe3, 0x0d, 0x20, 0xc6, 0x4b,
+    0x5c, 0xc2, 0x58, 0x84, 0x94, 0x3e, 0x7a, 0xe9, 0x4e, 0xdf, 0xf8,
+    0x50, 0xeb, 0x0e, 0x82, 0x44, 0x02, 0x3d, 0x3d, 0x07, 0xa8, 0xa0,
+    0x07, 0x06, 0xf0, 0x58, 0x2c, 0xc1, 0x02, 0xb6, 0x6c, 0x6d, 0xda,
+    0x86, 0xe8, 0xf2, 0xdf, 0x32, 0x56, 0x59, 0x88, 0x6f },
+  { 0x04, 0xf6, 0xe8, 0x22, 0xf1, 0x7c, 0xc7, 0xa5, 0x94, 0x6d, 0xf8,
+    0x0d, 0x95, 0x8a, 0xef, 0x06, 0x5d, 0x87, 0x49, 0x16, 0xe1, 0x03,
+    0xa6, 0x83, 0x0c, 0x6e, 0x46, 0xb6, 0x05, 0x59, 0x18, 0x18, 0x0d,
+    0x14, 0x52, 0x29, 0x3c, 0x58, 0xa9, 0x74, 0x9c, 0xbc, 0x8f, 0x0a,
+    0xc4, 0x08, 0xa9, 0xca, 0x89, 0x57, 0x61, 0xcf, 0xc4, 0x51, 0x16,
+    0x46, 0x41, 0xa1, 0x79, 0xfb, 0x5c, 0xd8, 0xfe, 0xbc },
+  { 0x51, 0x1f, 0xdb, 0x7c, 0x88, 0x26, 0x85, 0x35, 0xe9, 0x7e, 0x4e,
+    0xd8, 0x92, 0xf3, 0xc0, 0x65, 0x83, 0x2b, 0x26, 0x59, 0x14, 0xfc,
+    0x61, 0x07, 0xa1, 0xd2, 0x7d, 0xbb, 0x7d, 0x51, 0xc3, 0x7e, 0x95,
+    0x98, 0x15, 0x06, 0xc1, 0x14, 0x72, 0x44, 0xd5, 0xba, 0xe9, 0x0e,
+    0xe9, 0x0d, 0x08, 0x49, 0x84, 0xba, 0xa7, 0x58, 0x7f, 0x41, 0xff,
+    0x6f, 0x4b, 0xa7, 0x22, 0xc8, 0xb9, 0x2a, 0xeb, 0x99 },
+  { 0x2b, 0xa2, 0xbd, 0x17, 0xe9, 0x26, 0x27, 0x5b, 0x06, 0x83, 0xb2,
+    0x36, 0xbf, 0xe3, 0x76, 0x30, 0x26, 0x6e, 0x37, 0xf4, 0x18, 0x2f,
+    0x53, 0xa9, 0x82, 0x34, 0xe9, 0x15, 0xab, 0x64, 0xc9, 0x59, 0x96,
+    0xc6, 0xcb, 0x7a, 0xe8, 0x80, 0xc3, 0xdf, 0xcb, 0x47, 0xd0, 0x5a,
+    0xad, 0xd2, 0x1a, 0xbf, 0x8e, 0x40, 0xb7, 0x3f, 0x40, 0xf3, 0x98,
+    0xdc, 0x5b, 0x02, 0x14, 0x14, 0x57, 0x45, 0x6a, 0x09 },
+  { 0x9b, 0x66, 0x8d, 0x9b, 0x44, 0x47, 0xe3, 0x76, 0xf6, 0xc6, 0xcf,
+    0xa6, 0x8d, 0xbc, 0x79, 0x19, 0x83, 0x81, 0xab, 0x60, 0x5f, 0x55,
+    0xd5, 0xa7, 0xef, 0x68, 0x3b, 0xce, 0xd4, 0x6f, 0x9a, 0xfd, 0x36,
+    0x85, 0x41, 0x1a, 0x66, 0xe2, 0x34, 0x6f, 0x96, 0x07, 0x77, 0xd0,
+    0xc9, 0x22, 0x71, 0x24, 0x30, 0xe0, 0x18, 0xbf, 0xae, 0x86, 0x53,
+    0x01, 0x7e, 0xa2, 0x0e, 0xcd, 0x5f, 0x1f, 0x95, 0x6c },
+  { 0x56, 0x81, 0x02, 0x4f, 0x53, 0x85, 0x88, 0xa0, 0x1b, 0x2c, 0x83,
+    0x94, 0xca, 0xe8, 0x73, 0xc6, 0xd8, 0x5d, 0x6a, 0xa0, 0x6e, 0xdd,
+    0xb3, 0xa5, 0x02, 0x09, 0x6f, 0xc0, 0x82, 0xbb, 0x89, 0xcb, 0x24,
+    0x15, 0x31, 0xb3, 0x15, 0x75, 0x0d, 0x31, 0xbb, 0x0b, 0x63, 0x01,
+    0x28, 0xd1, 0x9d, 0x11, 0x39, 0x2b, 0xcf, 0x4b, 0x34, 0x78, 0xd5,
+    0x23, 0xd7, 0xd2, 0x13, 0xe4, 0x75, 0x0f, 0x55, 0x92 },
+  { 0x2a, 0xa9, 0x1b, 0xa6, 0xde, 0x60, 0x17, 0xf1, 0x93, 0x0f, 0xc7,
+    0xd9, 0x6d, 0xcc, 0xd6, 0x70, 0x74, 0x8b, 0x7e, 0xb1, 0xd0, 0x94,
+    0xdf, 0xb4, 0xb3, 0xb1, 0x47, 0x8a, 0x61, 0x2e, 0xbf, 0x03, 0xdd,
+    0xd7, 0x21, 0x27, 0x9a, 0x26, 0x6d, 0xe3, 0x88, 0x45, 0xe6, 0x12,
+    0xc9, 0x30, 0x98, 0xc2, 0xef, 0xff, 0x34, 0xfe, 0x50, 0x06, 0x17,
+    0x20, 0x5b, 0x1d, 0xe2, 0xfe, 0xa1, 0xd8, 0x02, 0x46 },
+  { 0x82, 0x4d, 0x89, 0xc0, 0x63, 0x7c, 0xe1, 0x78, 0xb6, 0x30, 0x68,
+    0x4c, 0x72, 0x9e, 0x26, 0x65, 0x3f, 0x34, 0xea, 0xc7, 0xe9, 0x04,
+    0x12, 0xe9, 0x63, 0xd3, 0xf1, 0x9d, 0x64, 0x51, 0xe8, 0x25, 0x85,
+    0x21, 0x67, 0xc4, 0x8d, 0xf7, 0xcc, 0x55, 0xb2, 0x57, 0xb2, 0x50,
+    0xa7, 0x0c, 0x7b, 0xcc, 0xfa, 0x9a, 0xa1, 0x5c, 0x18, 0x8a, 0xc4,
+    0x63, 0x7a, 0x52, 0x22, 0x89, 0xc0, 0x87, 0x6a, 0xd4 },
+  { 0x87, 0xe4, 0xae, 0x11, 0xda, 0x1a, 0x2c, 0xa8, 0x82, 0x2a, 0xe3,
+    0x30, 0xdc, 0x97, 0xab, 0x2e, 0x47, 0xff, 0x62, 0x32, 0x30, 0x93,
+    0xc2, 0xb7, 0xa6, 0xc0, 0xe2, 0xc1, 0x68, 0x21, 0xcd, 0x7c, 0xec,
+    0x92, 0x18, 0x4d, 0xf4, 0xbb, 0x6e, 0x2b, 0x62, 0x6a, 0x44, 0x78,
+    0x03, 0x90, 0x63, 0xaf, 0xee, 0xb0, 0xd2, 0x87, 0xf2, 0x42, 0x19,
+    0x20, 0x78, 0x98, 0xcc, 0xe7, 0xad, 0xe0, 0x63, 0x9c },
+  { 0xdd, 0x7f, 0x2f, 0x44, 0xa4, 0x02, 0xa0, 0x1e, 0x82, 0x16, 0xb1,
+    0x03, 0xa4, 0xe7, 0x23, 0x5c, 0x28, 0x30, 0x31, 0x9d, 0x56, 0xaf,
+    0x63, 0x9f, 0x23, 0xc4, 0x8c, 0x27, 0x59, 0xab, 0xa6, 0xeb, 0x5e,
+    0xee, 0xe3, 0x8c, 0x29, 0x8e, 0xbe, 0x41, 0x98, 0x26, 0x7a, 0x00,
+    0xeb, 0x2a, 0x08, 0xd9, 0x3a, 0x50, 0x37, 0x03, 0x17, 0x1c, 0x77,
+    0x33, 0x38, 0x62, 0x10, 0x10, 0x55, 0xbd, 0x7a, 0xd2 },
+  { 0x4c, 0xb8, 0x46, 0x59, 0x61, 0x93, 0xf7, 0xf2, 0x78, 0xaa, 0xaa,
+    0xc5, 0xcc, 0xff, 0xd5, 0x35, 0x7a, 0xb0, 0xd1, 0x24, 0x5f, 0x69,
+    0x79, 0xd1, 0x41, 0xa4, 0x71, 0xbd, 0xab, 0x55, 0xe2, 0x38, 0xb1,
+    0xae, 0xd6, 0x7b, 0x73, 0x39, 0x95, 0x04, 0xb9, 0x7d, 0xf1, 0xa2,
+    0x5e, 0xb6, 0xfe, 0x27, 0x2b, 0x5c, 0xd4, 0x96, 0xa7, 0xc8, 0xa0,
+    0x60, 0x92, 0x6e, 0x74, 0x04, 0xfd, 0xa0, 0x79, 0x0d },
+  { 0x6f, 0x44, 0xec, 0xda, 0xe1, 0x4e, 0x3b, 0x81, 0xa1, 0x91, 0x22,
+    0x03, 0x01, 0x5f, 0x59, 0x18, 0xea, 0xc6, 0xfb, 0xf4, 0x96, 0x60,
+    0x10, 0xf4, 0x9d, 0x2b, 0xc2, 0xbc, 0xef, 0xe7, 0xb1, 0xdf, 0xec,
+    0x5c, 0x83, 0x5d, 0x7d, 0x87, 0xa4, 0x43, 0x71, 0xf1, 0x5a, 0x6c,
+    0x08, 0x42, 0x52, 0xb9, 0x34, 0x65, 0x26, 0x42, 0x72, 0xa4, 0x10,
+    0xd5, 0x0f, 0x89, 0xa1, 0x17, 0xf3, 0x1a, 0xf4, 0x63 },
+  { 0x1f, 0x70, 0x5f, 0x6e, 0x9f, 0x07, 0x0d, 0x87, 0xfd, 0xe8, 0xe2,
+    0x77, 0x46, 0x74, 0xfa, 0x9b, 0xf1, 0x20, 0xd2, 0x88, 0xeb, 0x0b,
+    0xe7, 0xaa, 0x12, 0x8d, 0xfb, 0x5d, 0x10, 0x11, 0xce, 0x1f, 0xda,
+    0x99, 0xb2, 0x55, 0x22, 0x66, 0x65, 0xd8, 0x3f, 0x63, 0x4e, 0x8f,
+    0xca, 0xbd, 0xa9, 0xa2, 0x3c, 0x03, 0x51, 0x5e, 0x9c, 0xfe, 0xce,
+    0x6e, 0x94, 0xa8, 0xec, 0x92, 0xe4, 0xed, 0xec, 0xb7 },
+  { 0x2d, 0x96, 0xc5, 0xb0, 0x15, 0x74, 0x72, 0x2b, 0x81, 0x7f, 0xeb,
+    0x48, 0x6c, 0x5f, 0xc9, 0x8f, 0x5f, 0x84, 0x61, 0xf4, 0xce, 0xe9,
+    0x90, 0x5a, 0xf2, 0x06, 0xd4, 0x72, 0x33, 0x86, 0xd1, 0xc4, 0xc7,
+    0xca, 0xc5, 0x84, 0x00, 0x28, 0xd7, 0xaf, 0xed, 0x0e, 0x38, 0xad,
+    0x13, 0x96, 0x28, 0xeb, 0x6a, 0xf9, 0x2b, 0x4b, 0x88, 0xeb, 0xf0,
+    0x9b, 0x1f, 0xa0, 0x47, 0xfb, 0xe1, 0x0b, 0xc3, 0x1d },
+  { 0x65, 0xda, 0x78, 0x0a, 0x0a, 0x37, 0x47, 0x9d, 0xd8, 0xf4, 0xd6,
+    0x55, 0x64, 0xf9, 0xa7, 0x08, 0x9e, 0x42, 0x07, 0xeb, 0x16, 0xac,
+    0xa3, 0xf6, 0x55, 0x31, 0xcf, 0xee, 0x76, 0x25, 0xba, 0x13, 0x80,
+    0xa4, 0x97, 0xb6, 0x24, 0x72, 0xfc, 0x7e, 0x00, 0x07, 0xa6, 0xb0,
+    0x35, 0x61, 0x04, 0x16, 0xa5, 0xf8, 0x2c, 0x10, 0x82, 0xfa, 0x06,
+    0x5c, 0x46, 0xdd, 0xee, 0x49, 0x40, 0xd1, 0xfc, 0x46 },
+  { 0x1c, 0x09, 0xa3, 0xb3, 0x80, 0xb8, 0xa7, 0xfc, 0x33, 0x3f, 0xd2,
+    0x71, 0x4d, 0xf7, 0x12, 0x9b, 0x44, 0xa4, 0x67, 0x68, 0xba, 0xcf,
+    0x0a, 0x67, 0xa3, 0x8a, 0x47, 0xb3, 0xab, 0x31, 0xf5, 0x1b, 0x05,
+    0x33, 0xc2, 0xaa, 0x2b, 0x4b, 0x7b, 0xbb, 0x6a, 0xe5, 0xed, 0xf3,
+    0xdc, 0xb0, 0xec, 0xc1, 0xa2, 0x83, 0xe8, 0x43, 0xf2, 0x90, 0x7b,
+    0x34, 0x1f, 0x17, 0x9a, 0xfd, 0x8b, 0x67, 0xda, 0x90 },
+  { 0x67, 0x88, 0x8b, 0x83, 0xfa, 0xaf, 0xbb, 0x62, 0x29, 0x34, 0xb8,
+    0xd5, 0x59, 0x63, 0xe1, 0x86, 0x15, 0x3e, 0x59, 0x51, 0x88, 0x7c,
+    0x7f, 0x4a, 0x76, 0x35, 0xc7, 0x98, 0xd9, 0xa5, 0x82, 0x94, 0xbe,
+    0x26, 0xa3, 0xc5, 0x49, 0xc9, 0xfd, 0x59, 0x86, 0xab, 0xd1, 0x9f,
+    0x40, 0x1e, 0xe2, 0x4e, 0xda, 0x36, 0x02, 0x04, 0x2a, 0xd3, 0x83,
+    0x35, 0x7a, 0x31, 0x7d, 0x38, 0x07, 0x3b, 0x38, 0xce },
+  { 0xb4, 0xf7, 0x99, 0x63, 0xca, 0x31, 0xbb, 0x62, 0x26, 0x5d, 0xd9,
+    0x29, 0xaf, 0x7d, 0x51, 0x27, 0x2f, 0xa6, 0x63, 0x1d, 0xe7, 0xfa,
+    0x35, 0xf7, 0xa6, 0xb0, 0x3f, 0x9f, 0xcf, 0xdb, 0x8e, 0x3b, 0x5b,
+    0xac, 0xe3, 0x35, 0x91, 0xb7, 0xec, 0x2c, 0xfa, 0xb4, 0x9c, 0x91,
+    0xa6, 0xdb, 0x1f, 0xf8, 0xf6, 0x78, 0x6d, 0x08, 0xf4, 0x4e, 0x80,
+    0x62, 0xd2, 0xff, 0x69, 0x6a, 0x7d, 0x98, 0x41, 0x42 },
+  { 0x40, 0x84, 0x83, 0x69, 0x7b, 0xb6, 0xf9, 0xd0, 0x11, 0xa1, 0xf2,
+    0x9a, 0x23, 0xc2, 0x78, 0xa8, 0x1d, 0x37, 0x57, 0x8d, 0xcc, 0xcf,
+    0x42, 0x3b, 0xdf, 0x48, 0x93, 0x37, 0xf1, 0x82, 0xea, 0xb7, 0x9a,
+    0x50, 0xb0, 0x5f, 0x3d, 0x2c, 0xcc, 0x49, 0x13, 0x37, 0xc7, 0xe4,
+    0x1f, 0x30, 0x79, 0x3b, 0xd2, 0x7d, 0x76, 0x61, 0xc2, 0xe3, 0x04,
+    0xc9, 0x46, 0xa5, 0xa4, 0x01, 0xaf, 0x8d, 0x94, 0x6f },
+  { 0xee, 0xb5, 0xad, 0xe1, 0xab, 0x97, 0xe7, 0x15, 0x43, 0x43, 0xa4,
+    0x6e, 0xb4, 0xcd, 0xd2, 0xa7, 0x73, 0xf3, 0x63, 0x01, 0xed, 0xc6,
+    0xa1, 0xbc, 0x1d, 0xd6, 0x48, 0x0e, 0x08, 0xf5, 0x87, 0x65, 0xcb,
+    0x93, 0x87, 0x82, 0x92, 0x3b, 0xc0, 0x1f, 0x8e, 0x0c, 0x61, 0xc6,
+    0xbe, 0x0d, 0xd1, 0xab, 0x4c, 0x18, 0xcb, 0x15, 0xed, 0x52, 0x10,
+    0x11, 0x24, 0x05, 0xf1, 0xea, 0x8f, 0x2e, 0x8c, 0x4e },
+  { 0x71, 0x4a, 0xd1, 0x85, 0xf1, 0xee, 0xc4, 0x3f, 0x46, 0xb6, 0x7e,
+    0x99, 0x2d, 0x2d, 0x38, 0xbc, 0x31, 0x49, 0xe3, 0x7d, 0xa7, 0xb4,
+    0x47, 0x48, 0xd4, 0xd1, 0x4c, 0x16, 0x1e, 0x08, 0x78, 0x02, 0x04,
+    0x42, 0x14, 0x95, 0x79, 0xa8, 0x65, 0xd8, 0x04, 0xb0, 0x49, 0xcd,
+    0x01, 0x55, 0xba, 0x98, 0x33, 0x78, 0x75, 0x7a, 0x13, 0x88, 0x30,
+    0x1b, 0xdc, 0x0f, 0xae, 0x2c, 0xea, 0xea, 0x07, 0xdd },
+  { 0x22, 0xb8, 0x24, 0x9e, 0xaf, 0x72, 0x29, 0x64, 0xce, 0x42, 0x4f,
+    0x71, 0xa7, 0x4d, 0x03, 0x8f, 0xf9, 0xb6, 0x15, 0xfb, 0xa5, 0xc7,
+    0xc2, 0x2c, 0xb6, 0x27, 0x97, 0xf5, 0x39, 0x82, 0x24, 0xc3, 0xf0,
+    0x72, 0xeb, 0xc1, 0xda, 0xcb, 0xa3, 0x2f, 0xc6, 0xf6, 0x63, 0x60,
+    0xb3, 0xe1, 0x65, 0x8d, 0x0f, 0xa0, 0xda, 0x1e, 0xd1, 0xc1, 0xda,
+    0x66, 0x2a, 0x20, 0x37, 0xda, 0x82, 0x3a, 0x33, 0x83 },
+  { 0xb8, 0xe9, 0x03, 0xe6, 0x91, 0xb9, 0x92, 0x78, 0x25, 0x28, 0xf8,
+    0xdb, 0x96, 0x4d, 0x08, 0xe3, 0xba, 0xaf, 0xbd, 0x08, 0xba, 0x60,
+    0xc7, 0x2a, 0xec, 0x0c, 0x28, 0xec, 0x6b, 0xfe, 0xca, 0x4b, 0x2e,
+    0xc4, 0xc4, 0x6f, 0x22, 0xbf, 0x62, 0x1a, 0x5d, 0x74, 0xf7, 0x5c,
+    0x0d, 0x29, 0x69, 0x3e, 0x56, 0xc5, 0xc5, 0x84, 0xf4, 0x39, 0x9e,
+    0x94, 0x2f, 0x3b, 0xd8, 0xd3, 0x86, 0x13, 0xe6, 0x39 },
+  { 0xd5, 0xb4, 0x66, 0xff, 0x1f, 0xd6, 0x8c, 0xfa, 0x8e, 0xdf, 0x0b,
+    0x68, 0x02, 0x44, 0x8f, 0x30, 0x2d, 0xcc, 0xda, 0xf5, 0x66, 0x28,
+    0x78, 0x6b, 0x9d, 0xa0, 0xf6, 0x62, 0xfd, 0xa6, 0x90, 0x26, 0x6b,
+    0xd4, 0x0a, 0xb6, 0xf0, 0xbe, 0xc0, 0x43, 0xf1, 0x01, 0x28, 0xb3,
+    0x3d, 0x05, 0xdb, 0x82, 0xd4, 0xab, 0x26, 0x8a, 0x4f, 0x91, 0xac,
+    0x42, 0x86, 0x79, 0x5f, 0xc0, 0xf7, 0xcb, 0x48, 0x5c },
+  { 0x0a, 0x1e, 0x8c, 0x0a, 0x8c, 0x48, 0xb8, 0x4b, 0x71, 0xba, 0x0f,
+    0xe5, 0x6f, 0xa0, 0x56, 0x09, 0x8c, 0xa6, 0x92, 0xe9, 0x2f, 0x27,
+    0x6e, 0x85, 0xb3, 0x38, 0x26, 0xcd, 0x78, 0x75, 0xfc, 0xf8, 0x83,
+    0x85, 0x13, 0x1b, 0x43, 0xdf, 0x74, 0x53, 0x2e, 0xaa, 0x86, 0xcf,
+    0x17, 0x1f, 0x50, 0x76, 0xe6, 0xd1, 0x7b, 0x1c, 0x75, 0xfb, 0xa1,
+    0xdb, 0x00, 0x1b, 0x6e, 0x66, 0x97, 0x7c, 0xb8, 0xd7 },
+  { 0x65, 0xaa, 0x17, 0x99, 0x14, 0x36, 0x93, 0xab, 0xd9, 0xcb, 0x21,
+    0x8d, 0x9b, 0x5e, 0xc6, 0x0c, 0x0e, 0xdd, 0xb0, 0x67, 0xe6, 0xa3,
+    0x2f, 0x76, 0x79, 0x60, 0x10, 0xac, 0xb1, 0x1a, 0xd0, 0x13, 0x6c,
+    0xe4, 0x9f, 0x97, 0x6e, 0x74, 0xf8, 0x95, 0x04, 0x2f, 0x7c, 0xbf,
+    0x13, 0xfb, 0x73, 0xd1, 0x9d, 0xc8, 0x89, 0xd7, 0xe9, 0x03, 0x46,
+    0x9d, 0xeb, 0x33, 0x73, 0x1f, 0x24, 0x06, 0xb6, 0x63 },
+  { 0xde, 0xb7, 0x12, 0xb9, 0xcc, 0x64, 0xf5, 0x88, 0x14, 0x86, 0x0b,
+    0x51, 0xfa, 0x89, 0xad, 0x8a, 0x92, 0x6a, 0x69, 0x08, 0xc7, 0x96,
+    0xde, 0x55, 0x7f, 0x90, 0xcf, 0xad, 0xb0, 0xc6, 0x2c, 0x07, 0x87,
+    0x2f, 0x33, 0xfe, 0x18, 0x4e, 0x5e, 0x21, 0x2a, 0x3c, 0x5c, 0x37,
+    0x31, 0x74, 0x18, 0x44, 0x6e, 0xfd, 0x95, 0x61, 0x3f, 0x61, 0x8a,
+    0x35, 0xf7, 0xd2, 0x78, 0x9e, 0xfe, 0x0d, 0x96, 0x60 },
+  { 0xb4, 0x2f, 0x4a, 0x40, 0xb3, 0xc8, 0x8b, 0xce, 0xcf, 0xe3, 0x28,
+    0xc8, 0x46, 0xbf, 0x06, 0x48, 0xa1, 0x69, 0x90, 0xca, 0x53, 0x91,
+    0x95, 0xc0, 0xc1, 0xdc, 0x8d, 0x70, 0x30, 0x80, 0x67, 0x68, 0x5a,
+    0xf6, 0x77, 0xad, 0x65, 0xac, 0x0c, 0x7a, 0x9b, 0xcf, 0xa8, 0xf7,
+    0xac, 0xc0, 0xaa, 0xcf, 0x45, 0xca, 0x18, 0xac, 0x83, 0x1f, 0xed,
+    0x64, 0x4e, 0xc3, 0xd9, 0x28, 0x31, 0x01, 0xff, 0xef },
+  { 0xed, 0xcf, 0x6c, 0x81, 0xcc, 0xf1, 0x6e, 0x11, 0xdd, 0xf7, 0x19,
+    0xa3, 0x3d, 0xd0, 0xe5, 0x34, 0x9c, 0xab, 0xac, 0x5c, 0xfa, 0xe5,
+    0x97, 0x00, 0x98, 0x40, 0xe1, 0xc3, 0x93, 0x62, 0xc0, 0xf1, 0x19,
+    0x82, 0xfe, 0x2c, 0x27, 0x65, 0x85, 0x9a, 0x94, 0x26, 0x2d, 0xa2,
+    0x8d, 0xd3, 0x37, 0x3d, 0x52, 0x26, 0x93, 0x89, 0x75, 0x11, 0xeb,
+    0xa5, 0xe0, 0x7b, 0x8b, 0xc6, 0xb6, 0x06, 0x4d, 0xc0 },
+  { 0x46, 0xb9, 0x62, 0xd2, 0x28, 0x36, 0x94, 0xd2, 0x79, 0x75, 0xdc,
+    0xbf, 0x32, 0x56, 0x4c, 0x9b, 0x04, 0x03, 0x2b, 0x30, 0xa9, 0x3e,
+    0x05, 0x8f, 0xb7, 0x7b, 0x2b, 0x71, 0x8b, 0x4a, 0xd5, 0xfb, 0x78,
+    0x9a, 0xb7, 0xd7, 0xaa, 0x90, 0x85, 0x2d, 0xa2, 0xbf, 0xb6, 0xb3,
+    0x93, 0xb0, 0x9f, 0x98, 0xe8, 0x69, 0xb1, 0x6e, 0x41, 0x0e, 0x7d,
+    0xe2, 0x30, 0xb1, 0x79, 0xf6, 0x2e, 0xb5, 0x74, 0x71 },
+  { 0x29, 0x03, 0x6c, 0x3f, 0x53, 0x82, 0xe3, 0x5d, 0xe7, 0xa6, 0x9f,
+    0xa7, 0xa6, 0x3e, 0xc7, 0xbd, 0xcb, 0xc4, 0xe0, 0xcc, 0x5a, 0x7b,
+    0x64, 0x14, 0xcf, 0x44, 0xbf, 0x9a, 0x83, 0x83, 0xef, 0xb5, 0x97,
+    0x23, 0x50, 0x6f, 0x0d, 0x51, 0xad, 0x50, 0xac, 0x1e, 0xac, 0xf7,
+    0x04, 0x30, 0x8e, 0x8a, 0xec, 0xb9, 0x66, 0xf6, 0xac, 0x94, 0x1d,
+    0xb1, 0xcd, 0xe4, 0xb5, 0x9e, 0x84, 0xc1, 0xeb, 0xba },
+  { 0x17, 0x3f, 0x8a, 0xb8, 0x93, 0x3e, 0xb0, 0x7c, 0xc5, 0xfd, 0x6e,
+    0x4b, 0xce, 0xba, 0xe1, 0xff, 0x35, 0xc7, 0x87, 0x9b, 0x93, 0x8a,
+    0x5a, 0x15, 0x79, 0xea, 0x02, 0xf3, 0x83, 0x32, 0x48, 0x86, 0xc7,
+    0x0e, 0xd9, 0x10, 0x9d, 0xe1, 0x69, 0x0b, 0x8e, 0xe8, 0x01, 0xbc,
+    0x95, 0x9b, 0x21, 0xd3, 0x81, 0x17, 0xeb, 0xb8, 0x4a, 0xb5, 0x6f,
+    0x88, 0xf8, 0xa3, 0x72, 0x62, 0x00, 0x2d, 0xd9, 0x8e },
+  { 0xc6, 0xaf, 0xa6, 0xa1, 0x91, 0x93, 0x1f, 0xd4, 0x5c, 0x3b, 0xad,
+    0xba, 0x72, 0x6e, 0x68, 0xa9, 0xbc, 0x73, 0x88, 0xc8, 0xcf, 0x37,
+    0xad, 0xec, 0x7c, 0x64, 0x56, 0x1c, 0xf4, 0x81, 0xfd, 0x25, 0x9a,
+    0x64, 0x6c, 0x8b, 0xd8, 0x43, 0xe7, 0x70, 0x9e, 0x11, 0xe6, 0x4d,
+    0xcf, 0xd5, 0xdf, 0xff, 0xed, 0x79, 0x23, 0x5c, 0x68, 0x9b, 0x42,
+    0x00, 0xfe, 0x7a, 0xc8, 0xdf, 0xda, 0xdd, 0xec, 0xe0 },
+  { 0xa6, 0xdc, 0xcd, 0x8c, 0x19, 0x26, 0x64, 0x88, 0xbf, 0x77, 0xb9,
+    0xf2, 0x4b, 0x91, 0x43, 0xde, 0xf1, 0xfe, 0xd6, 0x1d, 0x0c, 0x60,
+    0xb5, 0x00, 0x0a, 0x52, 0x3f, 0x45, 0x0d, 0xa2, 0x3d, 0x74, 0xe4,
+    0xe3, 0xf6, 0xef, 0x04, 0x09, 0x0d, 0x10, 0x66, 0xb6, 0xac, 0xe8,
+    0x5a, 0xbc, 0x0f, 0x03, 0x01, 0x73, 0xf5, 0x28, 0x17, 0x72, 0x7c,
+    0x4e, 0x40, 0x43, 0x2d, 0xd3, 0x4c, 0x6e, 0xf9, 0xf0 },
+  { 0xaa, 0xf8, 0x90, 0x8d, 0x54, 0x6e, 0x4f, 0x1e, 0x31, 0x4c, 0x00,
+    0xe9, 0xd2, 0xe8, 0x85, 0x5c, 0xb2, 0x56, 0x44, 0x5a, 0xae, 0x3e,
+    0xca, 0x44, 0x23, 0x83, 0x22, 0xae, 0xc7, 0x40, 0x34, 0xa1, 0x45,
+    0x8a, 0x29, 0x36, 0x75, 0xda, 0xd9, 0x49, 0x40, 0x8d, 0xe5, 0x55,
+    0x4f, 0x22, 0xd7, 0x34, 0x54, 0xf3, 0xf0, 0x70, 0x9c, 0xbc, 0xcc,
+    0x85, 0xcb, 0x05, 0x3a, 0x6f, 0x50, 0x38, 0x91, 0xa1 },
+  { 0x52, 0x5f, 0x4a, 0xab, 0x9c, 0x32, 0x7d, 0x2a, 0x6a, 0x3c, 0x9d,
+    0xf8, 0x1f, 0xb7, 0xbe, 0x97, 0xee, 0x03, 0xe3, 0xf7, 0xce, 0x33,
+    0x21, 0x1c, 0x47, 0x78, 0x8a, 0xcd, 0x13, 0x46, 0x40, 0xdd, 0x90,
+    0xad, 0x74, 0x99, 0x2d, 0x3d, 0xd6, 0xac, 0x80, 0x63, 0x50, 0xf3,
+    0xba, 0xbc, 0x7f, 0xe1, 0x98, 0xa6, 0x1d, 0xb3, 0x2d, 0x4a, 0xd1,
+    0xd6, 0x56, 0x9a, 0xe8, 0x41, 0x31, 0x04, 0xde, 0xa4 },
+  { 0x2d, 0xac, 0xcd, 0x88, 0x71, 0x9d, 0x0a, 0x00, 0xb5, 0x2c, 0x6e,
+    0xb7, 0x9e, 0x1c, 0xa8, 0xb4, 0xa1, 0xb4, 0xb4, 0x4f, 0xfa, 0x20,
+    0x88, 0x9f, 0x23, 0x63, 0xef, 0x5c, 0x0d, 0x73, 0x7f, 0x1f, 0x81,
+    0xf5, 0x0d, 0xa1, 0xca, 0xac, 0x23, 0x1d, 0x6f, 0xcb, 0x48, 0x89,
+    0x5e, 0x72, 0x99, 0xb7, 0x7a, 0xf8, 0x1f, 0x0a, 0xa4, 0xa7, 0x61,
+    0x8a, 0xd2, 0x4b, 0x7a, 0xaf, 0xc8, 0xe3, 0xa2, 0xbe },
+  { 0x7d, 0x28, 0x6f, 0x1f, 0x72, 0x1e, 0xc2, 0xd2, 0x11, 0x5e, 0xf4,
+    0xcc, 0xd8, 0x28, 0x58, 0xa4, 0xd5, 0x12, 0x21, 0x13, 0x55, 0xd4,
+    0xfc, 0x58, 0xe5, 0x34, 0xbf, 0xa5, 0x9c, 0x2e, 0x1b, 0xf5, 0x52,
+    0xa9, 0x6d, 0xc4, 0xb3, 0xe4, 0x6b, 0x01, 0x28, 0x65, 0xda, 0x88,
+    0x13, 0x4c, 0xf0, 0x4e, 0x73, 0x1b, 0x19, 0x30, 0x75, 0x9e, 0x15,
+    0x8f, 0xf6, 0x20, 0xb6, 0xec, 0x5a, 0xaf, 0xd0, 0x12 },
+  { 0x21, 0x82, 0x6b, 0x95, 0x29, 0xc4, 0xbc, 0x51, 0x91, 0x47, 0xf5,
+    0xf9, 0xfe, 0x6d, 0xb8, 0x78, 0x34, 0x52, 0x15, 0xe5, 0x09, 0x4f,
+    0x4e, 0x99, 0xb1, 0x31, 0xed, 0x54, 0xe2, 0x49, 0x53, 0xce, 0xe9,
+    0xad, 0xb7, 0x18, 0xd1, 0x74, 0x3e, 0x6c, 0x27, 0xfc, 0x94, 0x51,
+    0x6a, 0x99, 0x22, 0xfb, 0x97, 0x5a, 0x78, 0x16, 0xb8, 0xaa, 0xb0,
+    0x21, 0x12, 0x60, 0x8c, 0x03, 0x2b, 0xf1, 0x38, 0xe3 },
+  { 0xc1, 0x68, 0x9c, 0x69, 0x8a, 0xb0, 0x65, 0xf6, 0x2e, 0xee, 0x65,
+    0xdd, 0xca, 0x67, 0x6b, 0xaa, 0x45, 0xb5, 0x2f, 0x30, 0x8a, 0xfa,
+    0x80, 0x4a, 0xb4, 0xaa, 0x6a, 0xb8, 0x4b, 0x7a, 0xc1, 0xaa, 0x1d,
+    0xff, 0x07, 0x17, 0x56, 0x10, 0xb1, 0x2a, 0xe1, 0x1f, 0x27, 0xb7,
+    0xc4, 0x30, 0xaf, 0xd5, 0x75, 0x56, 0xbd, 0x18, 0x1d, 0x02, 0x83,
+    0x2c, 0xd8, 0xd0, 0xa5, 0xfd, 0xc3, 0x02, 0x01, 0x24 },
+  { 0xa1, 0xa6, 0x28, 0x17, 0x47, 0xe3, 0x4d, 0x3e, 0xde, 0x5e, 0x93,
+    0x34, 0x01, 0x74, 0x7c, 0xa7, 0xf7, 0x66, 0x28, 0xb6, 0x14, 0xc8,
+    0xa3, 0x94, 0xf5, 0x02, 0x56, 0x2b, 0xfe, 0xe0, 0xb9, 0x94, 0xec,
+    0xb6, 0x5f, 0xbf, 0xe1, 0xff, 0x70, 0x67, 0xdc, 0xb0, 0x1d, 0x02,
+    0xa9, 0x2b, 0xa4, 0x62, 0x20, 0x75, 0x87, 0xce, 0xf7, 0xdc, 0x2c,
+    0xfd, 0xb4, 0x58, 0x48, 0x48, 0xad, 0x55, 0x91, 0x4a },
+  { 0x00, 0x70, 0xa0, 0x19, 0x0a, 0xa6, 0x96, 0x57, 0x2d, 0x85, 0x3f,
+    0x1d, 0x24, 0xab, 0x63, 0x08, 0x48, 0xac, 0x56, 0xad, 0x5c, 0x2e,
+    0xbf, 0xcf, 0xde, 0x27, 0xd1, 0x11, 0xcd, 0x55, 0x93, 0x9c, 0x1e,
+    0x4d, 0x07, 0x87, 0x2d, 0xde, 0x7c, 0xe7, 0x8b, 0x53, 0x4b, 0x53,
+    0x0f, 0x0a, 0x39, 0x6e, 0x86, 0xaf, 0x9d, 0x57, 0x53, 0x54, 0xb5,
+    0xd7, 0xe3, 0x4a, 0xcd, 0xe1, 0x8c, 0xc7, 0x67, 0xae },
+  { 0x51, 0xb9, 0xb5, 0xed, 0x19, 0x3f, 0xd4, 0xb1, 0xa3, 0xa9, 0x2b,
+    0x46, 0xbd, 0x4b, 0xd1, 0xf6, 0xec, 0x6b, 0x38, 0xa6, 0x0f, 0x2d,
+    0x02, 0x61, 0xd7, 0x2a, 0xbf, 0xd1, 0x64, 0x36, 0x12, 0x8d, 0xcb,
+    0xf2, 0x2c, 0x25, 0xe3, 0xe3, 0xc4, 0x3f, 0xe4, 0xd2, 0x9d, 0xb9,
+    0x12, 0x4d, 0x03, 0x33, 0x30, 0x18, 0x45, 0x92, 0xd2, 0x0c, 0x5b,
+    0x08, 0x2c, 0x23, 0x20, 0x64, 0x54, 0xcb, 0x3d, 0xd7 },
+  { 0x57, 0x8f, 0x24, 0x27, 0x46, 0x91, 0x4e, 0x36, 0xd0, 0xd9, 0xd4,
+    0x80, 0x96, 0x89, 0x57, 0x12, 0x16, 0xa4, 0x3e, 0x47, 0x33, 0x32,
+    0x39, 0x51, 0x62, 0x0f, 0x5e, 0xe7, 0x8c, 0xcf, 0xee, 0x91, 0x9b,
+    0xf5, 0x5f, 0x28, 0x7b, 0x45, 0xa7, 0x3d, 0x44, 0x85, 0xac, 0x74,
+    0x22, 0x87, 0x92, 0x39, 0x65, 0x3b, 0x05, 0x91, 0xc3, 0x6c, 0x86,
+    0x69, 0x41, 0xf8, 0xaf, 0xfe, 0x4a, 0xe5, 0x6e, 0x9e },
+  { 0x94, 0x71, 0x30, 0xef, 0x0b, 0x94, 0x8e, 0xe0, 0x45, 0x81, 0xab,
+    0xa3, 0xe2, 0xcc, 0x4c, 0xef, 0xc3, 0x8c, 0xce, 0xdc, 0x86, 0x17,
+    0x92, 0xb7, 0xb5, 0xdc, 0xd9, 0xd9, 0x36, 0x1c, 0x72, 0x4a, 0x12,
+    0x20, 0x03, 0xbf, 0x79, 0x6c, 0xe0, 0x97, 0x98, 0x00, 0xad, 0xab,
+    0xc7, 0x45, 0x6f, 0x17, 0x3a, 0xe5, 0x26, 0x93, 0x15, 0xaf, 0xc0,
+    0x1b, 0x60, 0x6d, 0xb2, 0x9c, 0x75, 0x50, 0xe8, 0xca },
+  { 0xc8, 0x52, 0xe6, 0x77, 0xf7, 0x7b, 0x14, 0xb5, 0x85, 0xbd, 0x10,
+    0x2a, 0x0f, 0x14, 0x42, 0x43, 0x05, 0x9d, 0xab, 0xec, 0x7c, 0xb0,
+    0x1f, 0xfa, 0x61, 0xdf, 0x19, 0xfc, 0xe8, 0xab, 0x43, 0x6b, 0xf5,
+    0xe2, 0xd5, 0xc7, 0x9a, 0xa2, 0xd7, 0xb6, 0x77, 0xf6, 0xc3, 0x75,
+    0xe9, 0x34, 0x3d, 0x34, 0x2e, 0x4f, 0xf4, 0xe3, 0xab, 0x00, 0x1b,
+    0xc7, 0x98, 0x8c, 0x3c, 0x7a, 0x83, 0xcc, 0xb6, 0x9f },
+  { 0x01, 0x19, 0x75, 0x26, 0x91, 0x7a, 0xc2, 0xc7, 0xbc, 0x53, 0x95,
+    0x19, 0xe6, 0x8b, 0xb2, 0x79, 0x81, 0x35, 0xf6, 0x03, 0x3e, 0xd5,
+    0x8f, 0x5c, 0x45, 0x1e, 0x0c, 0xe9, 0x46, 0xaf, 0xf0, 0xf9, 0x8d,
+    0xfd, 0xd1, 0x51, 0x01, 0x73, 0x1a, 0xc1, 0x66, 0x12, 0x6e, 0xaf,
+    0xb5, 0xe7, 0xcb, 0xe2, 0xe2, 0x72, 0xee, 0x23, 0x3f, 0x34, 0xe5,
+    0xf3, 0xf8, 0xea, 0x3d, 0x2d, 0x12, 0x24, 0x82, 0xfb },
+  { 0x05, 0x9c, 0x90, 0x85, 0x89, 0x5e, 0xb7, 0x18, 0x30, 0x4e, 0x2d,
+    0xda, 0x78, 0x68, 0x6b, 0xd9, 0x57, 0x49, 0x81, 0x5a, 0x5e, 0xe9,
+    0x02, 0x51, 0x0b, 0x00, 0x9a, 0xf6, 0x92, 0x48, 0xb6, 0xa7, 0xa7,
+    0x2f, 0xf8, 0xa6, 0x28, 0xd8, 0x17, 0x73, 0xe1, 0x1d, 0x5a, 0x1e,
+    0x7f, 0x69, 0x7a, 0x44, 0x9b, 0x7a, 0x1e, 0x27, 0x12, 0xd5, 0xcf,
+    0xae, 0x7a, 0xb2, 0x65, 0x07, 0xd1, 0x11, 0x29, 0x18 },
+  { 0x29, 0x52, 0x43, 0xbd, 0x75, 0x8c, 0xf2, 0x1c, 0x80, 0x31, 0x25,
+    0xfc, 0xf3, 0x21, 0xde, 0x5f, 0x97, 0x98, 0x7c, 0x8d, 0xb3, 0xbb,
+    0x3c, 0xb5, 0x1f, 0xf9, 0x7c, 0x4c, 0xda, 0xc9, 0xd3, 0xbf, 0x0a,
+    0x67, 0xce, 0xe7, 0xed, 0x35, 0x0a, 0x41, 0xfd, 0xe6, 0xab, 0xcc,
+    0x25, 0x4f, 0xbc, 0x9f, 0x8e, 0x6b, 0x3e, 0x3c, 0xce, 0xcb, 0xd0,
+    0xe4, 0xa6, 0x40, 0xa2, 0x0f, 0x36, 0x2b, 0xa3, 0xa0 },
+  { 0xdd, 0x82, 0x32, 0xd2, 0x41, 0x2c, 0xce, 0xec, 0xb5, 0x12, 0x31,
+    0x91, 0xf6, 0xe9, 0x22, 0x1e, 0x85, 0x1e, 0xcc, 0xe0, 0xfa, 0xeb,
+    0xf0, 0x50, 0x5f, 0x2a, 0xee, 0xff, 0x8a, 0x8c, 0x92, 0xd4, 0x1d,
+    0xac, 0xf1, 0x77, 0xbd, 0xae, 0x27, 0x76, 0x3e, 0xa4, 0xa8, 0x62,
+    0x05, 0xef, 0x76, 0x34, 0xf7, 0xa6, 0x87, 0xcc, 0x44, 0xbb, 0xbb,
+    0xde, 0xee, 0x5e, 0x11, 0xe6, 0x5f, 0x9f, 0xbd, 0x69 },
+  { 0xb0, 0x46, 0xb6, 0x83, 0x71, 0x6d, 0x31, 0xc9, 0x14, 0xc7, 0x0b,
+    0x10, 0xf7, 0x64, 0x6d, 0xa3, 0x1e, 0xfa, 0xb2, 0x23, 0x63, 0x47,
+    0x45, 0x9c, 0xf8, 0xfa, 0x2c, 0x09, 0x12, 0x34, 0x31, 0xf7, 0x28,
+    0x07, 0xf1, 0x1d, 0x86, 0x7c, 0x37, 0x70, 0xb1, 0xf0, 0x61, 0xd5,
+    0x6c, 0xa0, 0xe5, 0xb1, 0xe8, 0x8a, 0x6b, 0x44, 0xa3, 0x3c, 0xf9,
+    0x3e, 0x18, 0xbc, 0xc9, 0xce, 0xbb, 0xa5, 0xad, 0xe7 },
+  { 0x20, 0xe5, 0xa2, 0x55, 0x05, 0x8b, 0xe5, 0x1e, 0x1a, 0x62, 0x9b,
+    0x4e, 0xbf, 0x81, 0xe5, 0xcb, 0xe0, 0x78, 0x1c, 0xb6, 0x7c, 0xa4,
+    0xe5, 0x7b, 0xa8, 0x6b, 0x30, 0x88, 0x96, 0xbc, 0xe7, 0x38, 0x20,
+    0xeb, 0x08, 0x43, 0x1c, 0xe8, 0xc9, 0xbc, 0x58, 0x10, 0xcc, 0x8d,
+    0x8b, 0x9c, 0x9d, 0x6f, 0xcf, 0x83, 0x4e, 0x42, 0xea, 0x33, 0xef,
+    0x73, 0xce, 0xc4, 0x7d, 0x71, 0x3b, 0x6d, 0x8d, 0xfd },
+  { 0x1e, 0x48, 0x04, 0xf9, 0xc0, 0xb1, 0xe8, 0x2b, 0x9e, 0xd3, 0x63,
+    0xbd, 0xe4, 0x47, 0x28, 0xac, 0xf7, 0xd0, 0x90, 0xa1, 0xbf, 0xe2,
+    0xdd, 0xf8, 0x81, 0x9d, 0x65, 0x92, 0xef, 0x45, 0x3b, 0x83, 0x5b,
+    0xd2, 0xef, 0xe8, 0xb0, 0x20, 0x6e, 0x29, 0x25, 0x5b, 0x07, 0xfb,
+    0x90, 0xc7, 0xd3, 0x0d, 0x2c, 0x11, 0x48, 0x00, 0xb8, 0x6c, 0xb0,
+    0xe3, 0xe0, 0x7d, 0x38, 0x7e, 0x98, 0xce, 0x95, 0x37 },
+  { 0x41, 0xc9, 0x53, 0xd8, 0xd2, 0x2a, 0x86, 0xc3, 0x63, 0x4d, 0xf4,
+    0x22, 0xb6, 0xde, 0x4a, 0x4f, 0x14, 0x96, 0x66, 0xbe, 0x8c, 0x4f,
+    0x58, 0x1b, 0x26, 0x23, 0xee, 0x65, 0xc3, 0x92, 0xa5, 0xc3, 0x28,
+    0x36, 0x63, 0x9e, 0xf5, 0x6b, 0x93, 0x68, 0x62, 0x20, 0xf4, 0x5c,
+    0xe6, 0x5b, 0x4f, 0xa8, 0x58, 0x9c, 0x91, 0x25, 0x64, 0x17, 0x90,
+    0xb6, 0x92, 0x5f, 0xaa, 0xd9, 0x48, 0xb8, 0xbe, 0x04 },
+  { 0x8b, 0xfc, 0xa4, 0xc8, 0xdf, 0xe3, 0xfd, 0xe4, 0x25, 0x7b, 0x75,
+    0xc3, 0xdb, 0x01, 0x86, 0x2e, 0xd3, 0x11, 0x67, 0xde, 0x66, 0xc2,
+    0xe0, 0x3a, 0x25, 0x56, 0xc4, 0xf4, 0x6c, 0x9d, 0xff, 0xc1, 0xac,
+    0x45, 0xf7, 0xbc, 0x59, 0xa6, 0x7a, 0xb9, 0x36, 0x24, 0xbe, 0xb8,
+    0x6d, 0xdd, 0x0d, 0x02, 0x60, 0x3f, 0x0d, 0xcd, 0x03, 0x64, 0xf0,
+    0xf8, 0x08, 0x81, 0x9b, 0xe9, 0x6c, 0xd8, 0xd3, 0xb6 },
+  { 0xf6, 0xbf, 0x59, 0xd8, 0xd4, 0x5a, 0x55, 0x71, 0x11, 0xa2, 0x36,
+    0xcb, 0xba, 0x52, 0x61, 0x9a, 0xe3, 0xdf, 0xcc, 0x43, 0x16, 0x94,
+    0x38, 0x43, 0xaf, 0xd1, 0x28, 0x1b, 0x28, 0x21, 0x4a, 0x4a, 0x5e,
+    0x85, 0x1e, 0xf8, 0xc5, 0x4f, 0x50, 0x5e, 0x3c, 0x4b, 0x60, 0x0e,
+    0xff, 0xbe, 0xbb, 0x3e, 0xac, 0x17, 0x08, 0x7f, 0x22, 0x27, 0x58,
+    0x12, 0x63, 0xf1, 0x7d, 0x7e, 0x5f, 0x68, 0xea, 0x83 },
+  { 0x1b, 0xc9, 0xed, 0xe4, 0xd4, 0x1a, 0x4d, 0xf6, 0xe8, 0xe6, 0xf4,
+    0x7c, 0x2f, 0x4a, 0xd8, 0x73, 0x37, 0xb6, 0x9b, 0x19, 0xf7, 0x10,
+    0xf7, 0x66, 0xe1, 0xfa, 0xf5, 0xaa, 0x05, 0xa4, 0x3b, 0x66, 0x45,
+    0x39, 0x6e, 0x7f, 0xbe, 0xf4, 0x3b, 0xb7, 0x79, 0x5d, 0x39, 0x40,
+    0x7b, 0x58, 0x15, 0xb9, 0x2e, 0xcc, 0x23, 0xa6, 0xc1, 0x24, 0x14,
+    0x21, 0x15, 0x3a, 0x55, 0xd5, 0x1f, 0x12, 0xbf, 0xd8 },
+  { 0x76, 0xb3, 0x8b, 0x36, 0x31, 0x55, 0x5d, 0xbc, 0xfb, 0x21, 0x21,
+    0x8f, 0xf9, 0xe4, 0x12, 0xa2, 0x29, 0x88, 0x9e, 0xf2, 0xce, 0x8a,
+    0xd7, 0x05, 0xe9, 0x0f, 0x96, 0xaa, 0xbb, 0xd5, 0xbe, 0x7e, 0x53,
+    0x29, 0xa4, 0x26, 0x53, 0x4c, 0x81, 0x5a, 0x56, 0x53, 0x77, 0x13,
+    0x18, 0x72, 0x66, 0x41, 0x42, 0x4e, 0x3b, 0x88, 0x29, 0x2f, 0xb1,
+    0xd8, 0x95, 0x44, 0x40, 0x6a, 0xde, 0x9b, 0xcc, 0xb5 },
+  { 0xe5, 0x3f, 0x60, 0x07, 0x40, 0x22, 0x4e, 0x4d, 0x10, 0xd3, 0x1d,
+    0x24, 0x38, 0x00, 0x31, 0x43, 0xaf, 0xdb, 0x43, 0x6e, 0xb1, 0x79,
+    0x1b, 0x15, 0x0d, 0xe3, 0x56, 0x76, 0xf0, 0xe3, 0x2f, 0x80, 0xb0,
+    0xb6, 0x5f, 0x0a, 0xcf, 0x48, 0x1a, 0x5f, 0xbf, 0x95, 0x96, 0xc0,
+    0xcb, 0x0a, 0x27, 0xc7, 0xaf, 0xc1, 0x1d, 0x1e, 0x2c, 0x4d, 0x54,
+    0x02, 0x47, 0x5e, 0x4f, 0xfc, 0xc1, 0xcd, 0xa8, 0x11 },
+  { 0x62, 0x06, 0xb9, 0x1f, 0xc0, 0xb6, 0xf1, 0x21, 0x1e, 0x9f, 0xde,
+    0xcd, 0xc9, 0xd5, 0x1a, 0x6f, 0x1e, 0xee, 0x65, 0x54, 0xb1, 0x38,
+    0xad, 0xcd, 0x4a, 0x82, 0x3d, 0xf0, 0x0d, 0xde, 0xf6, 0x75, 0x9a,
+    0x9b, 0xfd, 0x7a, 0x4e, 0x98, 0x1e, 0x04, 0x52, 0x36, 0x83, 0x8f,
+    0x4a, 0xf6, 0x93, 0xf6, 0x93, 0x77, 0x93, 0x14, 0x84, 0xb3, 0xe8,
+    0x1e, 0x3e, 0x3b, 0xc2, 0xcb, 0x7e, 0xf7, 0x9f, 0xe9 },
+  { 0x76, 0xfd, 0x02, 0xda, 0xdd, 0x96, 0x3b, 0xc0, 0x35, 0x39, 0x91,
+    0x46, 0xce, 0x42, 0x98, 0x8c, 0xc0, 0x99, 0xd3, 0xcf, 0x4d, 0x32,
+    0xdf, 0x5c, 0x0b, 0xbf, 0x64, 0x10, 0x12, 0x46, 0xb1, 0xc7, 0x08,
+    0xd1, 0x67, 0xe2, 0x95, 0x95, 0xd1, 0x1d, 0x09, 0xb3, 0xf6, 0x34,
+    0x86, 0xb4, 0x05, 0x26, 0xac, 0x1d, 0xfe, 0x31, 0xbc, 0x22, 0xde,
+    0xc7, 0x0b, 0x74, 0x5e, 0x90, 0xe2, 0xea, 0xaf, 0x5a },
+  { 0xf0, 0xa1, 0xfb, 0xe3, 0x11, 0x63, 0xe4, 0x21, 0x01, 0x50, 0x72,
+    0x18, 0x3d, 0x68, 0xee, 0x51, 0x91, 0xa9, 0x9c, 0xfd, 0xa1, 0x69,
+    0xba, 0x5a, 0x19, 0x54, 0xc9, 0xf3, 0x10, 0x7d, 0x4e, 0xca, 0x06,
+    0x3e, 0x13, 0x7a, 0x71, 0x14, 0xd3, 0x97, 0xc9, 0xdb, 0x67, 0x2b,
+    0x9f, 0x47, 0x8d, 0x41, 0xc3, 0x4e, 0x99, 0x1b, 0x06, 0x69, 0xa9,
+    0x51, 0x53, 0x92, 0x90, 0xc8, 0xed, 0x65, 0xe4, 0x6a },
+  { 0x13, 0xc7, 0x2a, 0x6a, 0xa5, 0x71, 0xb1, 0x43, 0xdc, 0xcf, 0x45,
+    0xad, 0xcd, 0x98, 0xea, 0xe6, 0x99, 0xa1, 0x54, 0xb1, 0x10, 0xf2,
+    0x5e, 0x7e, 0x9e, 0x82, 0xb7, 0x65, 0xb9, 0xa0, 0x89, 0x23, 0x68,
+    0x8e, 0x8e, 0x0f, 0xf3, 0x11, 0xa6, 0x8a, 0x77, 0x1e, 0x14, 0x50,
+    0x96, 0xd6, 0x07, 0x76, 0xc6, 0xd6, 0xee, 0x70, 0xad, 0x6f, 0x69,
+    0xfa, 0x2b, 0x76, 0x77, 0x63, 0x40, 0x55, 0xa0, 0x0e },
+  { 0x0e, 0x06, 0x2b, 0xfe, 0x81, 0x8e, 0xe1, 0x0f, 0x33, 0x48, 0x1d,
+    0xea, 0x43, 0x02, 0x8b, 0x2c, 0xfb, 0xb4, 0x9e, 0xc9, 0x5e, 0x0f,
+    0x75, 0xa9, 0xe1, 0x6d, 0x40, 0x4b, 0xc5, 0x19, 0xb9, 0xad, 0x50,
+    0xb4, 0xa7, 0x33, 0x69, 0x2c, 0xa5, 0x4e, 0xfb, 0x68, 0x04, 0x69,
+    0xed, 0x83, 0xdd, 0xef, 0xbd, 0xdd, 0xb1, 0x39, 0x04, 0x2e, 0x0e,
+    0x1c, 0x09, 0xc3, 0xeb, 0x79, 0x03, 0xfa, 0x08, 0xdf },
+  { 0x45, 0x3b, 0xe4, 0xaa, 0xb9, 0xf4, 0x23, 0xb3, 0x36, 0x52, 0xa0,
+    0xb5, 0xd0, 0x2a, 0x9a, 0xf8, 0x55, 0xdd, 0x0d, 0x42, 0xdd, 0x83,
+    0x11, 0x0b, 0xa3, 0xbc, 0x4b, 0x39, 0x94, 0xea, 0x3f, 0x88, 0x5a,
+    0x71, 0x30, 0x89, 0x75, 0x08, 0x9b, 0x49, 0x03, 0xe2, 0xe4, 0xd6,
+    0xba, 0x6d, 0xc2, 0xe8, 0x40, 0x31, 0xff, 0xe9, 0xc8, 0x56, 0x39,
+    0x75, 0xc8, 0x61, 0x6a, 0xca, 0x07, 0x42, 0xe8, 0x29 },
+  { 0x53, 0x61, 0xe3, 0xe8, 0x93, 0xdd, 0x36, 0x0b, 0xcb, 0xf5, 0x1c,
+    0x79, 0x3e, 0xc0, 0x92, 0xa6, 0xb0, 0x52, 0x05, 0x4f, 0x5f, 0x00,
+    0x0b, 0x9f, 0xce, 0x50, 0x7b, 0x66, 0x45, 0xf8, 0xd4, 0x70, 0x13,
+    0xa8, 0x70, 0x6a, 0x58, 0xd4, 0xb1, 0x06, 0x29, 0xcc, 0x82, 0xb8,
+    0xd2, 0xd7, 0x96, 0xfd, 0xd3, 0x7b, 0x60, 0x8a, 0x58, 0x79, 0x52,
+    0xd6, 0x55, 0x3e, 0x01, 0xd1, 0xaf, 0x0e, 0x04, 0xb8 },
+  { 0x74, 0xb5, 0x67, 0x39, 0xf0, 0x1f, 0x82, 0x09, 0xa4, 0x04, 0x44,
+    0xdf, 0x4c, 0xcd, 0xee, 0xea, 0x8f, 0x97, 0xe8, 0xe7, 0x6e, 0xfa,
+    0x3c, 0x04, 0x33, 0x7f, 0x69, 0x94, 0x5c, 0x4d, 0x44, 0xc0, 0x85,
+    0xf1, 0xf4, 0x78, 0x96, 0x96, 0x36, 0x1e, 0x3c, 0x97, 0x77, 0x4a,
+    0x93, 0x5f, 0x86, 0x0d, 0x67, 0x46, 0x86, 0xdc, 0xba, 0x3d, 0x45,
+    0xec, 0xd8, 0x63, 0x9a, 0x64, 0xae, 0xa0, 0x62, 0x1b },
+  { 0xb4, 0xd3, 0x15, 0x87, 0xb9, 0x2b, 0x53, 0x61, 0xcd, 0xc2, 0xd3,
+    0xc4, 0x10, 0x86, 0xc1, 0x55, 0x3e, 0x7b, 0x55, 0xa1, 0xf6, 0x1e,
+    0x94, 0xd2, 0xbc, 0x30, 0xbc, 0x25, 0x1d, 0xaf, 0x8a, 0x5e, 0xbf,
+    0xc5, 0x07, 0x09, 0xcc, 0x04, 0xcb, 0xaf, 0x4b, 0x3b, 0x4d, 0xa2,
+    0xd2, 0x6b, 0x81, 0x23, 0x8f, 0xba, 0x71, 0x8f, 0xa9, 0x17, 0x59,
+    0xb8, 0x0b, 0xd3, 0x10, 0x3a, 0xec, 0x11, 0xe0, 0x6f },
+  { 0xaa, 0xf6, 0x12, 0x7f, 0x00, 0xa0, 0x3d, 0x96, 0x40, 0x6b, 0x9f,
+    0xb4, 0xac, 0x70, 0x16, 0x0d, 0xb5, 0x22, 0x42, 0x9b, 0x5c, 0xd9,
+    0x4e, 0x7f, 0xa0, 0x30, 0x3a, 0x74, 0x94, 0x78, 0xfe, 0x31, 0x89,
+    0xc8, 0xea, 0x23, 0x93, 0x0a, 0x66, 0x25, 0x2a, 0x80, 0x26, 0x74,
+    0xdc, 0xaf, 0x77, 0x00, 0x46, 0x82, 0x0d, 0xd9, 0x64, 0xc6, 0x6f,
+    0x0f, 0x54, 0x75, 0x1a, 0x72, 0xf9, 0x7d, 0x9c, 0x35 },
+  { 0x2c, 0x30, 0xd4, 0x8d, 0xf9, 0x98, 0x4e, 0x02, 0xf7, 0x5a, 0x94,
+    0x54, 0x92, 0x17, 0x18, 0x4d, 0xd0, 0x2a, 0xad, 0x3b, 0x57, 0x68,
+    0x3d, 0x09, 0xb5, 0xa8, 0xc2, 0xef, 0x53, 0xa9, 0x6a, 0xfb, 0x73,
+    0xfe, 0xb6, 0xf9, 0x14, 0xe2, 0xd8, 0x15, 0xbb, 0x3b, 0x08, 0x65,
+    0x43, 0x32, 0xfc, 0xfe, 0x79, 0xf8, 0x0e, 0xc5, 0xf0, 0x51, 0xda,
+    0x10, 0xd7, 0x21, 0x41, 0x3d, 0xdd, 0xe8, 0xfa, 0x60 },
+  { 0x92, 0xe2, 0xc5, 0xf7, 0x5d, 0x0c, 0xea, 0xfc, 0x81, 0x8f, 0xa7,
+    0x93, 0x59, 0x39, 0xe4, 0x8b, 0x91, 0x59, 0x41, 0xef, 0x73, 0x4d,
+    0x75, 0x27, 0x0e, 0xb3, 0x21, 0xba, 0x20, 0x80, 0xef, 0x6d, 0x25,
+    0x5e, 0x90, 0xef, 0x96, 0xc6, 0x4c, 0xff, 0x1d, 0x8c, 0x18, 0xf3,
+    0x3c, 0x2e, 0xab, 0x10, 0x7f, 0xef, 0x53, 0xe0, 0xd8, 0xbb, 0x16,
+    0x05, 0x16, 0x80, 0x74, 0x80, 0xfc, 0xba, 0x53, 0x73 },
+  { 0x6e, 0x03, 0xa9, 0x1e, 0x20, 0x44, 0x46, 0x27, 0xe3, 0xd2, 0xe2,
+    0x22, 0x26, 0xcf, 0x47, 0x00, 0x26, 0x69, 0x44, 0x34, 0xed, 0x64,
+    0x79, 0x82, 0x8c, 0xb6, 0xdc, 0x8f, 0x27, 0x96, 0x0a, 0xee, 0xe2,
+    0xf4, 0xab, 0x87, 0x2a, 0x5c, 0xa2, 0xf7, 0xf6, 0x52, 0xf7, 0xdc,
+    0x77, 0xd5, 0xf9, 0x6d, 0x85, 0x82, 0x8b, 0x8f, 0x9c, 0x2d, 0x6c,
+    0x23, 0x9e, 0x79, 0x77, 0x24, 0xa1, 0x31, 0x31, 0xb1 },
+  { 0xba, 0x43, 0x2d, 0xb0, 0xa3, 0x31, 0xbb, 0x8c, 0x39, 0xb1, 0x7b,
+    0xee, 0x34, 0x46, 0x2b, 0x26, 0xdd, 0xb7, 0xad, 0x91, 0xb6, 0xc7,
+    0x5a, 0xec, 0x27, 0x65, 0xfb, 0xae, 0x3a, 0x0e, 0x60, 0xec, 0x54,
+    0x6d, 0x45, 0xf8, 0xe5, 0x84, 0x37, 0xb9, 0xd7, 0x7c, 0x3d, 0x2e,
+    0x8d, 0x7c, 0xe0, 0x69, 0x73, 0x15, 0x66, 0x51, 0xd4, 0x08, 0x22,
+    0x2a, 0xa2, 0x90, 0xcb, 0x58, 0xca, 0xbc, 0x0a, 0xe5 },
+  { 0x83, 0xa0, 0x1e, 0x23, 0xab, 0x27, 0x7b, 0x1f, 0xc2, 0x8c, 0xd8,
+    0xbb, 0x8d, 0xa7, 0xe9, 0x4c, 0x70, 0xf1, 0xde, 0xe3, 0x2d, 0x19,
+    0x55, 0xce, 0xe2, 0x50, 0xee, 0x58, 0x41, 0x9a, 0x1f, 0xee, 0x10,
+    0xa8, 0x99, 0x17, 0x97, 0xce, 0x3d, 0x20, 0x93, 0x80, 0xca, 0x9f,
+    0x98, 0x93, 0x39, 0xe2, 0xd8, 0xa8, 0x1c, 0x67, 0xd7, 0x37, 0xd8,
+    0x28, 0x8c, 0x7f, 0xae, 0x46, 0x02, 0x83, 0x4a, 0x8b },
+  { 0x0e, 0xa3, 0x21, 0x72, 0xcc, 0x19, 0x1d, 0xfc, 0x13, 0x1c, 0xd8,
+    0x8a, 0xa0, 0x3f, 0xf4, 0x18, 0x5c, 0x0b, 0xfa, 0x7b, 0x19, 0x11,
+    0x12, 0x19, 0xee, 0xcb, 0x45, 0xb0, 0xff, 0x60, 0x4d, 0x3e, 0xdb,
+    0x00, 0x55, 0x0a, 0xbb, 0xa1, 0x11, 0x52, 0x2b, 0x77, 0xae, 0x61,
+    0xc9, 0xa8, 0xd6, 0xe9, 0x4f, 0xca, 0x9d, 0x96, 0xc3, 0x8d, 0x6b,
+    0x7c, 0xce, 0x27, 0x52, 0xf0, 0xd0, 0xc3, 0x7e, 0x78 },
+  { 0x54, 0xad, 0xd6, 0x55, 0x2b, 0x08, 0x85, 0x8b, 0x23, 0xd6, 0x64,
+    0x5f, 0x6c, 0xe7, 0x9e, 0x92, 0xf3, 0x8b, 0x66, 0xae, 0x91, 0x86,
+    0x77, 0xe6, 0xd9, 0x1f, 0x71, 0x87, 0xc4, 0x16, 0x05, 0x24, 0xdf,
+    0xa8, 0xd0, 0x1f, 0x00, 0xea, 0x93, 0xdd, 0x29, 0x9f, 0x3c, 0xc4,
+    0x09, 0x01, 0xbd, 0x33, 0x27, 0xa0, 0xf1, 0x8c, 0xcd, 0x7b, 0x6b,
+    0x8e, 0x4e, 0x47, 0xcd, 0x28, 0xcf, 0x83, 0x8f, 0xab },
+  { 0xef, 0x84, 0x74, 0x6d, 0xc2, 0x01, 0x56, 0xb6, 0x6b, 0xa5, 0xc7,
+    0x8a, 0x50, 0x83, 0x0a, 0xbd, 0x2a, 0xef, 0x90, 0xe6, 0x67, 0xb9,
+    0x7e, 0xb5, 0x22, 0x91, 0xbc, 0x86, 0x9d, 0x8a, 0xa2, 0x45, 0x59,
+    0xa1, 0x42, 0xc6, 0x8f, 0xea, 0x2e, 0xf3, 0x2a, 0xf2, 0x2d, 0xfc,
+    0xea, 0x4c, 0x90, 0xb3, 0xd4, 0x90, 0x8c, 0xc9, 0xea, 0x5c, 0xfc,
+    0x4e, 0x91, 0xbf, 0x11, 0xce, 0x6a, 0x7e, 0x57, 0x61 },
+  { 0x5a, 0x1b, 0xf3, 0x81, 0xa0, 0x41, 0x19, 0xf9, 0x42, 0xe4, 0x63,
+    0xab, 0xa2, 0xb1, 0x64, 0x38, 0x82, 0x46, 0x8a, 0xec, 0xc1, 0xb1,
+    0xaa, 0x1e, 0x7b, 0xca, 0xab, 0x3b, 0x47, 0x8f, 0xc5, 0xf0, 0x56,
+    0xf1, 0x0d, 0xa9, 0x03, 0x7d, 0x40, 0xfa, 0x7f, 0x55, 0x70, 0x8e,
+    0x10, 0x3b, 0xda, 0x96, 0x5e, 0x92, 0x0c, 0xf6, 0x7c, 0xe3, 0xad,
+    0xf7, 0xe2, 0x00, 0xe8, 0x61, 0x01, 0x4d, 0xec, 0xc6 },
+  { 0xac, 0xf7, 0x8a, 0xa3, 0x28, 0x45, 0x96, 0xf3, 0x30, 0xb7, 0xe8,
+    0x47, 0x51, 0xb9, 0x4c, 0x31, 0x4c, 0xd8, 0x36, 0x36, 0x27, 0xba,
+    0x99, 0x78, 0x81, 0x30, 0x85, 0x78, 0x87, 0x37, 0x59, 0x89, 0x5d,
+    0x13, 0xdf, 0xff, 0xa5, 0xe5, 0x74, 0x50, 0x13, 0x61, 0xf0, 0x43,
+    0xc7, 0x4f, 0x57, 0xd2, 0xd0, 0xf1, 0x5c, 0x7a, 0x41, 0xc7, 0xc4,
+    0x5e, 0x3c, 0x09, 0xad, 0x89, 0xd6, 0x99, 0xa9, 0x77 },
+  { 0x18, 0xb3, 0xe9, 0x04, 0x38, 0x44, 0xd4, 0xf3, 0xa2, 0xd0, 0x21,
+    0xf5, 0x4c, 0x38, 0xfa, 0xcc, 0x36, 0x4f, 0x84, 0xba, 0x10, 0x58,
+    0xf2, 0x10, 0x09, 0xfc, 0x37, 0x1d, 0x2e, 0x4f, 0x38, 0xc7, 0x27,
+    0x51, 0x8a, 0xab, 0xa6, 0xa2, 0x9e, 0x0f, 0xda, 0xe6, 0xe7, 0x60,
+    0xa4, 0xf1, 0xa6, 0xd7, 0x58, 0xeb, 0xe4, 0x2c, 0x2a, 0xfc, 0x9d,
+    0x2c, 0xdc, 0x6d, 0xd5, 0x80, 0x77, 0x8c, 0x4b, 0x32 },
+  { 0x18, 0x96, 0xb2, 0x31, 0x70, 0x33, 0xcf, 0x31, 0x04, 0x68, 0x73,
+    0xd8, 0x7f, 0x26, 0xe6, 0xa4, 0x2a, 0x9d, 0x77, 0x0b, 0xba, 0xf6,
+    0xe0, 0x62, 0xdf, 0x11, 0xf9, 0xb4, 0xa0, 0xea, 0xb2, 0x75, 0xaa,
+    0xb1, 0x2c, 0xaa, 0xc2, 0xd3, 0xf5, 0x29, 0xeb, 0x20, 0xd0, 0x70,
+    0xfd, 0x84, 0x4d, 0x86, 0xd0, 0xa5, 0x71, 0xcd, 0xf6, 0x28, 0x5f,
+    0x80, 0xe2, 0x30, 0x8b, 0xb8, 0x2c, 0x6c, 0x5b, 0x3b },
+  { 0x8c, 0x3d, 0xc4, 0x01, 0x94, 0xaa, 0x02, 0x1f, 0x3c, 0x4a, 0x1f,
+    0x9a, 0x05, 0x5e, 0x4d, 0x41, 0x9e, 0xb3, 0xa2, 0x6d, 0x4c, 0x2f,
+    0x1a, 0x8c, 0x7e, 0x18, 0x8b, 0x73, 0x48, 0x13, 0x40, 0x80, 0xb6,
+    0x3f, 0x6e, 0x57, 0x0a, 0xd1, 0x1c, 0x28, 0x78, 0x66, 0x53, 0x55,
+    0x41, 0x9c, 0x10, 0x20, 0xde, 0x4b, 0x65, 0x5e, 0x7a, 0x6c, 0x2c,
+    0xcd, 0xe9, 0x07, 0x2c, 0xd4, 0x27, 0xfe, 0x8c, 0x4e },
+  { 0x70, 0xae, 0x04, 0x30, 0xd5, 0x45, 0xec, 0x42, 0x7f, 0x85, 0x41,
+    0x21, 0x1d, 0x4f, 0xe0, 0x42, 0xb9, 0x82, 0x3a, 0xce, 0xc0, 0x4b,
+    0x15, 0xc9, 0x0b, 0x7f, 0x4b, 0x8b, 0xdd, 0x3d, 0xc7, 0x85, 0x19,
+    0x90, 0xf3, 0x70, 0xe7, 0x14, 0x16, 0x75, 0x10, 0x66, 0x49, 0xd3,
+    0x91, 0x51, 0x09, 0x03, 0x18, 0x23, 0x1e, 0x4d, 0xed, 0x51, 0x22,
+    0x5d, 0x9a, 0x6f, 0xa6, 0xc4, 0x24, 0x69, 0x5d, 0xe2 },
+  { 0x07, 0x33, 0x6c, 0x42, 0xbd, 0x51, 0x49, 0x0e, 0xf8, 0x4d, 0xfb,
+    0xdf, 0xab, 0x74, 0x66, 0xf6, 0xb6, 0x39, 0x99, 0xa5, 0xc0, 0x88,
+    0x72, 0xdf, 0xed, 0xa0, 0x20, 0x6f, 0xda, 0x80, 0xb9, 0xa6, 0x2d,
+    0xe7, 0x28, 0xe3, 0xe3, 0xc3, 0xfd, 0x6b, 0x7d, 0x21, 0xa4, 0x38,
+    0xaa, 0xd1, 0xb8, 0xdd, 0x22, 0x38, 0x63, 0xc0, 0xd2, 0x6a, 0xca,
+    0x27, 0x79, 0x01, 0x74, 0xd9, 0xd4, 0x42, 0xa6, 0x4c },
+  { 0x79, 0x26, 0x70, 0x88, 0x59, 0xe6, 0xe2, 0xab, 0x68, 0xf6, 0x04,
+    0xda, 0x69, 0xa9, 0xfb, 0x50, 0x87, 0xbb, 0x33, 0xf4, 0xe8, 0xd8,
+    0x95, 0x73, 0x0e, 0x30, 0x1a, 0xb2, 0xd7, 0xdf, 0x74, 0x8b, 0x67,
+    0xdf, 0x0b, 0x6b, 0x86, 0x22, 0xe5, 0x2d, 0xd5, 0x7d, 0x8d, 0x3a,
+    0xd8, 0x7d, 0x58, 0x20, 0xd4, 0xec, 0xfd, 0x24, 0x17, 0x8b, 0x2d,
+    0x2b, 0x78, 0xd6, 0x4f, 0x4f, 0xbd, 0x38, 0x75, 0x82 },
+  { 0x92, 0x80, 0xf4, 0xd1, 0x15, 0x70, 0x32, 0xab, 0x31, 0x5c, 0x10,
+    0x0d, 0x63, 0x62, 0x83, 0xfb, 0xf4, 0xfb, 0xa2, 0xfb, 0xad, 0x0f,
+    0x8b, 0xc0, 0x20, 0x72, 0x1d, 0x76, 0xbc, 0x1c, 0x89, 0x73, 0xce,
+    0xd2, 0x88, 0x71, 0xcc, 0x90, 0x7d, 0xab, 0x60, 0xe5, 0x97, 0x56,
+    0x98, 0x7b, 0x0e, 0x0f, 0x86, 0x7f, 0xa2, 0xfe, 0x9d, 0x90, 0x41,
+    0xf2, 0xc9, 0x61, 0x80, 0x74, 0xe4, 0x4f, 0xe5, 0xe9 },
+  { 0x55, 0x30, 0xc2, 0xd5, 0x9f, 0x14, 0x48, 0x72, 0xe9, 0x87, 0xe4,
+    0xe2, 0x58, 0xa7, 0xd8, 0xc3, 0x8c, 0xe8, 0x44, 0xe2, 0xcc, 0x2e,
+    0xed, 0x94, 0x0f, 0xfc, 0x68, 0x3b, 0x49, 0x88, 0x15, 0xe5, 0x3a,
+    0xdb, 0x1f, 0xaa, 0xf5, 0x68, 0x94, 0x61, 0x22, 0x80, 0x5a, 0xc3,
+    0xb8, 0xe2, 0xfe, 0xd4, 0x35, 0xfe, 0xd6, 0x16, 0x2e, 0x76, 0xf5,
+    0x64, 0xe5, 0x86, 0xba, 0x46, 0x44, 0x24, 0xe8, 0x85 },
+  { 0xda, 0x85, 0x0a, 0x2f, 0x54, 0xe9, 0x44, 0x89, 0x17, 0xd0, 0xdc,
+    0xaa, 0x63, 0x93, 0x7b, 0x95, 0xa4, 0xda, 0x1e, 0xac, 0x8a, 0xf4,
+    0xdd, 0xf2, 0x11, 0x3e, 0x5c, 0x8b, 0x0d, 0x4d, 0xb2, 0x66, 0x9a,
+    0xf3, 0xc2, 0xac, 0xb0, 0x80, 0x3d, 0x05, 0x32, 0x3f, 0x3e, 0xc5,
+    0x5a, 0xbd, 0x33, 0xbd, 0xf9, 0xb2, 0xbe, 0x89, 0x0e, 0xe7, 0x9e,
+    0x7f, 0x3f, 0xce, 0x4e, 0x19, 0x86, 0x96, 0xa7, 0xa3 },
+  { 0xf1, 0x60, 0x95, 0xdd, 0x9f, 0x1e, 0xeb, 0x77, 0xd5, 0xb9, 0x2f,
+    0x4b, 0x1f, 0xac, 0x3a, 0x2c, 0x5d, 0xa6, 0xae, 0x5d, 0x0a, 0xb3,
+    0xf2, 0x54, 0xe2, 0xa7, 0xfe, 0x52, 0x67, 0x24, 0x11, 0xd0, 0x1c,
+    0xfa, 0x6a, 0xc0, 0x5b, 0xf3, 0x9e, 0xf6, 0x5f, 0x4b, 0x22, 0x26,
+    0x4b, 0x41, 0xc3, 0xf3, 0x63, 0x56, 0x3a, 0xbf, 0x0e, 0x92, 0x42,
+    0x90, 0xc1, 0xc6, 0x80, 0xb1, 0x8a, 0xa6, 0x5b, 0x44 },
+  { 0x76, 0xd0, 0x0a, 0x09, 0xc5, 0xbd, 0xd3, 0x9e, 0xd3, 0x28, 0x71,
+    0x72, 0x2c, 0xfa, 0x00, 0x47, 0x67, 0x4b, 0xec, 0x8d, 0x35, 0x17,
+    0x5a, 0xf9, 0x0d, 0x7a, 0xe9, 0x10, 0x74, 0x40, 0xa2, 0xa0, 0x63,
+    0x88, 0x56, 0xd8, 0x38, 0x4c, 0x81, 0x7d, 0x77, 0x2a, 0x4a, 0x59,
+    0x7a, 0x89, 0x55, 0x49, 0xc8, 0x48, 0x66, 0x37, 0x56, 0x31, 0xcb,
+    0xa0, 0x42, 0xf0, 0xef, 0x6f, 0xfe, 0xb8, 0x9d, 0x44 },
+  { 0xa6, 0x51, 0x13, 0x7b, 0x2c, 0x47, 0xfb, 0x79, 0x51, 0xe7, 0xbd,
+    0xa7, 0x15, 0x43, 0xa6, 0xeb, 0xc6, 0x24, 0x2a, 0xca, 0xb4, 0x34,
+    0x7d, 0x38, 0x8b, 0xe8, 0x35, 0x0f, 0x0c, 0x3f, 0xa3, 0xdf, 0x8d,
+    0x95, 0x2c, 0x7c, 0x8a, 0x3d, 0xaf, 0x01, 0xe0, 0x6c, 0x1d, 0xa6,
+    0x94, 0x96, 0xbb, 0xa8, 0xde, 0x62, 0xd8, 0x6b, 0x50, 0x93, 0x25,
+    0x6f, 0x77, 0xa1, 0x87, 0xb5, 0x3d, 0xb0, 0x39, 0x88 },
+  { 0xf3, 0x2f, 0x15, 0x0c, 0x2d, 0x67, 0xc0, 0xc4, 0x37, 0x40, 0x1b,
+    0x70, 0xf6, 0x0b, 0x38, 0xf0, 0xa3, 0xa4, 0x70, 0x59, 0x03, 0x3e,
+    0x75, 0x05, 0xe6, 0x9a, 0x1d, 0x30, 0x12, 0x96, 0x03, 0x0b, 0xc9,
+    0xb2, 0x95, 0x19, 0xc7, 0xf8, 0xb7, 0xd5, 0x9a, 0x71, 0xfa, 0xb9,
+    0x05, 0x57, 0xdc, 0x3d, 0xc8, 0x23, 0xfa, 0xc9, 0x5b, 0x9e, 0x85,
+    0xe6, 0x52, 0x52, 0x8c, 0xbf, 0xb0, 0x1b, 0x11, 0x78 },
+  { 0x27, 0x02, 0x56, 0x61, 0x36, 0xc4, 0x92, 0xf4, 0x10, 0x89, 0xb0,
+    0x60, 0x10, 0x84, 0x60, 0xfa, 0x30, 0x22, 0xc9, 0xc2, 0x5d, 0x34,
+    0x3b, 0xcb, 0xd8, 0xaf, 0x2a, 0xf1, 0x9c, 0x17, 0xef, 0x4c, 0xa9,
+    0xf2, 0x22, 0x4f, 0xe7, 0xc4, 0x70, 0x0a, 0x10, 0x19, 0x8e, 0xe5,
+    0x24, 0x8f, 0x30, 0x0b, 0x54, 0x8e, 0xbf, 0x5c, 0x8e, 0x71, 0x16,
+    0x32, 0x0c, 0xc8, 0x93, 0xff, 0x7e, 0x23, 0x1f, 0xfb },
+  { 0xff, 0xe6, 0x87, 0x9f, 0x46, 0xb6, 0x29, 0x2b, 0x21, 0x96, 0x97,
+    0x2e, 0x3f, 0xdf, 0x4f, 0xe9, 0xea, 0x4a, 0x81, 0x6d, 0x18, 0x07,
+    0xa3, 0x1c, 0xae, 0xad, 0x6a, 0xac, 0x5f, 0x06, 0x3c, 0x8f, 0xe8,
+    0x77, 0x79, 0x75, 0x59, 0xa7, 0x59, 0xa0, 0x0f, 0x8b, 0xa8, 0xf6,
+    0x68, 0xd8, 0x96, 0x8f, 0xb3, 0x1d, 0x8a, 0x3b, 0x84, 0x57, 0x35,
+    0x90, 0x2c, 0x5e, 0x42, 0xe2, 0x89, 0xee, 0x0b, 0x62 },
+  { 0x14, 0x48, 0x84, 0x28, 0x68, 0x22, 0xc2, 0x51, 0x2d, 0x61, 0xb0,
+    0x46, 0xe6, 0x74, 0xd8, 0x6b, 0x26, 0x4e, 0x9c, 0xc6, 0x89, 0x3e,
+    0xff, 0x36, 0x73, 0x11, 0x24, 0xf5, 0x9d, 0x1a, 0x82, 0x00, 0x1e,
+    0x63, 0xf3, 0xe8, 0x05, 0x1c, 0xfe, 0x52, 0xe7, 0x59, 0x7e, 0x28,
+    0x73, 0x8e, 0x3c, 0x3a, 0x70, 0xf1, 0xbe, 0xd9, 0x68, 0x0e, 0x2c,
+    0x0e, 0xf3, 0x72, 0x8b, 0x10, 0xa5, 0x6e, 0xd9, 0x87 },
+  { 0x17, 0xc3, 0xf1, 0x46, 0xee, 0x8d, 0xec, 0x3b, 0xaf, 0xcb, 0x51,
+    0xc0, 0xda, 0x37, 0xf1, 0x78, 0x71, 0xf2, 0x34, 0xc4, 0xa0, 0xfb,
+    0x7f, 0xa6, 0xd0, 0x70, 0x7a, 0x54, 0x3e, 0x3c, 0xbf, 0x3a, 0xdb,
+    0x81, 0xe3, 0x0c, 0x1e, 0x0a, 0xe9, 0xe1, 0xac, 0xe7, 0x22, 0x3b,
+    0xda, 0x99, 0xbd, 0x59, 0x19, 0xa3, 0xcf, 0xcc, 0x92, 0xc6, 0xa7,
+    0x55, 0xe4, 0x56, 0xf0, 0x93, 0x82, 0x3b, 0xd3, 0x3e },
+  { 0x1b, 0x83, 0x7a, 0xf2, 0x33, 0xa8, 0xa6, 0x8b, 0xe7, 0x09, 0x52,
+    0xf7, 0x83, 0xc4, 0x96, 0x1a, 0x81, 0x52, 0xd1, 0xe0, 0xb0, 0xfa,
+    0x32, 0x5f, 0xf0, 0x86, 0xea, 0x5b, 0x5f, 0x13, 0x12, 0xb8, 0x9c,
+    0x42, 0xe0, 0x1b, 0x8c, 0x3a, 0x47, 0x7c, 0xb5, 0x40, 0xc0, 0x6b,
+    0x2f, 0x37, 0xee, 0x0e, 0x39, 0x24, 0xd7, 0x45, 0xb4, 0xff, 0x5c,
+    0x6a, 0xf7, 0xd6, 0x1e, 0x0e, 0x37, 0xac, 0x19, 0x31 },
+  { 0x78, 0x97, 0x88, 0x0c, 0x1e, 0xb0, 0x0f, 0xd2, 0x56, 0x7a, 0xe8,
+    0xa5, 0x9e, 0x64, 0x82, 0xaf, 0xe1, 0x73, 0x49, 0xcf, 0x93, 0x92,
+    0x4a, 0x91, 0x5f, 0x8c, 0x59, 0x26, 0x93, 0xd4, 0x52, 0x07, 0x55,
+    0x19, 0x68, 0x9d, 0xfc, 0xd2, 0x93, 0xe3, 0x76, 0x89, 0x7b, 0x3b,
+    0x0e, 0x03, 0x6f, 0x11, 0x4f, 0xe8, 0x1e, 0xbc, 0xb3, 0x15, 0x36,
+    0x71, 0xbd, 0x23, 0xbc, 0x2b, 0xed, 0x46, 0xf9, 0xc2 },
+  { 0xca, 0x7b, 0x6c, 0x77, 0x5d, 0x20, 0x1e, 0x5b, 0x5a, 0x77, 0x22,
+    0x61, 0xde, 0x52, 0x8e, 0x47, 0x5f, 0x4b, 0xde, 0x51, 0x76, 0x60,
+    0x52, 0x9f, 0x41, 0xbe, 0xeb, 0x15, 0x78, 0xb2, 0x4b, 0xcb, 0x94,
+    0xb9, 0x41, 0x0f, 0x9b, 0xf3, 0x36, 0xc1, 0x09, 0xf9, 0xd4, 0x70,
+    0x93, 0xa1, 0x0b, 0xa6, 0xde, 0xbe, 0x50, 0x43, 0x80, 0xd9, 0xd1,
+    0x50, 0x73, 0xbd, 0xd1, 0x11, 0xc8, 0xd1, 0x29, 0xfa },
+  { 0x57, 0x18, 0xe0, 0xd4, 0x5d, 0xeb, 0xc3, 0x00, 0x2d, 0x52, 0xb2,
+    0x2c, 0x52, 0x73, 0x29, 0xae, 0x5e, 0xbf, 0x27, 0xe8, 0xfa, 0x9c,
+    0x8f, 0xea, 0xb4, 0x6c, 0x40, 0xbc, 0x64, 0x22, 0xca, 0x03, 0x35,
+    0x30, 0x4c, 0xf9, 0xe7, 0xf1, 0x41, 0xde, 0x7f, 0xa6, 0xad, 0xb6,
+    0x78, 0x9b, 0xdb, 0xf3, 0x8d, 0x14, 0xda, 0xba, 0x3e, 0x62, 0x97,
+    0xd2, 0x5b, 0xf1, 0x7d, 0xe1, 0x70, 0xd6, 0xe3, 0xc8 },
+  { 0x48, 0xd0, 0xed, 0x24, 0x9f, 0x90, 0x28, 0x41, 0x99, 0x7c, 0x25,
+    0x5d, 0xaf, 0x99, 0x08, 0x9c, 0x9a, 0x31, 0x24, 0x69, 0x8b, 0x16,
+    0x4a, 0x30, 0x28, 0x33, 0x0f, 0xdd, 0x4c, 0xee, 0x41, 0xe1, 0x68,
+    0x3f, 0xa4, 0xd9, 0xdc, 0x66, 0xb2, 0xa7, 0x9c, 0x8a, 0xa4, 0xc8,
+    0x28, 0x4e, 0x27, 0xbe, 0xe2, 0xa4, 0x28, 0xa6, 0x71, 0x9d, 0x6e,
+    0xc6, 0x55, 0xed, 0x76, 0x9d, 0xcb, 0x62, 0x4e, 0x24 },
+  { 0x79, 0x4e, 0x0b, 0x64, 0xac, 0xe1, 0xfe, 0x5a, 0xe3, 0x79, 0x93,
+    0x70, 0x68, 0xd8, 0x2d, 0xf0, 0x48, 0x68, 0x61, 0x6c, 0xae, 0x0c,
+    0x17, 0xd3, 0x05, 0x72, 0xc2, 0x02, 0x4e, 0x77, 0x48, 0x94, 0xe0,
+    0x66, 0x8c, 0x47, 0x2d, 0x62, 0x3c, 0x90, 0x3c, 0xc5, 0x88, 0x5f,
+    0x17, 0x84, 0x94, 0x51, 0x10, 0x32, 0x9e, 0xb4, 0x98, 0xa8, 0x95,
+    0xa9, 0xe5, 0x9a, 0x75, 0xe5, 0x27, 0x15, 0x8a, 0x5c },
+  { 0x21, 0x79, 0xaa, 0x82, 0x0e, 0x03, 0xfa, 0x33, 0xd9, 0xbd, 0xe5,
+    0x56, 0x8c, 0x26, 0x2e, 0x2d, 0x34, 0x17, 0xa4, 0x02, 0xe0, 0x7a,
+    0x59, 0x1f, 0x9d, 0x55, 0x70, 0x68, 0x2d, 0xb5, 0xf9, 0xbb, 0xa4,
+    0xbb, 0x9d, 0x5a, 0x82, 0xee, 0x5e, 0xfd, 0xb4, 0xf6, 0x5b, 0xbb,
+    0xfe, 0xee, 0x2f, 0x4a, 0xb9, 0xe4, 0x6c, 0xf2, 0xce, 0x7e, 0x3b,
+    0x05, 0x43, 0x27, 0xa7, 0x18, 0xd3, 0xf1, 0x08, 0x06 },
+  { 0xb0, 0xa4, 0x8c, 0x6a, 0xda, 0x54, 0x87, 0x25, 0x79, 0x9b, 0x59,
+    0x86, 0xba, 0xb4, 0x32, 0x69, 0x79, 0x60, 0x92, 0x24, 0xd8, 0x97,
+    0x18, 0x4b, 0x89, 0x97, 0x10, 0x4e, 0x0c, 0x6a, 0x24, 0xb3, 0xab,
+    0xe5, 0x62, 0x16, 0x54, 0x22, 0xa4, 0x5d, 0x8a, 0xc8, 0x19, 0xb9,
+    0x9d, 0x37, 0x56, 0xeb, 0xbb, 0x64, 0xf8, 0x43, 0xe3, 0xe0, 0x93,
+    0x4d, 0xec, 0x48, 0x7a, 0xed, 0x12, 0x13, 0x72, 0x79 },
+  { 0x84, 0x8d, 0x7f, 0x2e, 0xad, 0x41, 0x29, 0x1d, 0x05, 0x38, 0x68,
+    0x0c, 0x64, 0x9d, 0x07, 0x89, 0x7e, 0x45, 0xc7, 0x0a, 0x0a, 0xa4,
+    0xf9, 0x35, 0x3f, 0x82, 0xc3, 0xf6, 0xfb, 0xb8, 0xe8, 0x48, 0x9c,
+    0x75, 0x3e, 0x90, 0xdb, 0xe8, 0x89, 0x00, 0x41, 0xa1, 0xae, 0xef,
+    0x84, 0xcd, 0x31, 0x36, 0x43, 0x4f, 0x53, 0x0e, 0x9d, 0xd9, 0xc2,
+    0x3f, 0xa5, 0x4f, 0xe1, 0x24, 0xea, 0xfb, 0x72, 0xad },
+  { 0x0e, 0xd1, 0x46, 0x26, 0xee, 0x6d, 0x0c, 0x8e, 0xd3, 0xf0, 0xc2,
+    0x00, 0xc1, 0x29, 0x85, 0x0f, 0xff, 0x76, 0x31, 0x8f, 0xff, 0xa1,
+    0xdd, 0xd7, 0xdd, 0x56, 0x3a, 0x01, 0xb7, 0x77, 0x97, 0x06, 0x86,
+    0x2b, 0x23, 0x99, 0x59, 0xb6, 0x15, 0xae, 0x2e, 0xbe, 0x27, 0xc4,
+    0x50, 0x37, 0xe6, 0xff, 0xaf, 0x99, 0x14, 0xda, 0x8f, 0xf2, 0x77,
+    0x2b, 0xa5, 0xee, 0x08, 0x11, 0xcd, 0x9e, 0xd5, 0x32 },
+  { 0x52, 0x03, 0xc0, 0x76, 0x38, 0xc4, 0xb6, 0x5f, 0x78, 0x43, 0x1e,
+    0x8b, 0x02, 0xe2, 0x0f, 0x6d, 0x68, 0x3f, 0x19, 0xfa, 0x8f, 0x83,
+    0xb5, 0x13, 0x4c, 0xd0, 0xf4, 0xe4, 0x68, 0xc9, 0x7e, 0xac, 0xb5,
+    0x26, 0x7c, 0x7d, 0x3e, 0xab, 0x58, 0x3c, 0xca, 0xac, 0xd0, 0xdb,
+    0xa4, 0xd5, 0x8a, 0xce, 0x52, 0x19, 0x3a, 0x51, 0x78, 0xa7, 0xb1,
+    0x2d, 0x27, 0x95, 0xf5, 0xfd, 0xe8, 0xa3, 0x7b, 0xb9 },
+  { 0x48, 0xbe, 0x43, 0xd5, 0xe0, 0x04, 0x36, 0x88, 0xdf, 0x35, 0x32,
+    0xf7, 0x12, 0x1a, 0xff, 0xfa, 0x16, 0x7d, 0xab, 0xe4, 0xa4, 0x84,
+    0xfb, 0x75, 0xa0, 0x3a, 0xf3, 0x04, 0xa5, 0xc6, 0xf8, 0x25, 0xf3,
+    0x6c, 0xec, 0xcb, 0xbb, 0xc0, 0x75, 0xee, 0xf3, 0x20, 0xc4, 0xcd,
+    0x8d, 0x7e, 0xf8, 0xcb, 0x49, 0xe6, 0xdd, 0x59, 0x73, 0x37, 0x9e,
+    0xec, 0x4c, 0x23, 0x3c, 0x45, 0x43, 0xd1, 0x32, 0xce },
+  { 0xb5, 0x46, 0x4e, 0x6a, 0xba, 0xf5, 0xd3, 0xd4, 0x08, 0x3d, 0x1d,
+    0x7d, 0x2a, 0x8b, 0x0b, 0xab, 0x78, 0xb6, 0x17, 0x09, 0x50, 0x0b,
+    0xbf, 0x77, 0x82, 0x3f, 0x60, 0x2d, 0x57, 0xd5, 0x13, 0xca, 0x9e,
+    0x9f, 0xff, 0x65, 0xef, 0xaa, 0x89, 0x9c, 0xfe, 0x7b, 0xf8, 0x8a,
+    0x01, 0x88, 0x82, 0x9c, 0x24, 0xe4, 0x98, 0xad, 0x00, 0x23, 0x5a,
+    0xbe, 0x8e, 0xef, 0xa7, 0x19, 0xfa, 0x6a, 0xe6, 0xf6 },
+  { 0xaf, 0xe5, 0xe5, 0xe8, 0x3f, 0x19, 0xad, 0xad, 0x9e, 0x95, 0x90,
+    0x3e, 0xa9, 0xb2, 0x98, 0x10, 0x7d, 0x37, 0xdd, 0x38, 0x63, 0x2c,
+    0x95, 0x90, 0xbb, 0xff, 0xc6, 0x24, 0xd4, 0xde, 0x95, 0x8c, 0xb6,
+    0xb6, 0x1a, 0xf0, 0x80, 0xf0, 0x37, 0xad, 0x17, 0xd0, 0x35, 0xb6,
+    0xbf, 0x58, 0xf7, 0x80, 0xfa, 0xdf, 0x70, 0xf3, 0xc9, 0x59, 0x66,
+    0x8a, 0x1b, 0x47, 0x21, 0x98, 0xa5, 0x9a, 0x8a, 0x00 },
+  { 0xef, 0xa2, 0xc7, 0xc8, 0x02, 0xe2, 0x10, 0xd2, 0xd8, 0x0f, 0xb3,
+    0x50, 0xb3, 0xc2, 0xcb, 0x31, 0x56, 0x13, 0x18, 0x11, 0xe7, 0x18,
+    0xee, 0xe5, 0xc9, 0xc6, 0x64, 0x0f, 0x87, 0x68, 0x2a, 0x55, 0x81,
+    0x2b, 0x10, 0xf4, 0x03, 0x10, 0xba, 0xa7, 0xb8, 0x2b, 0x27, 0x3e,
+    0xf3, 0xac, 0xc5, 0x5f, 0xed, 0xe0, 0xb5, 0xf1, 0x94, 0x9d, 0xe4,
+    0x29, 0x3d, 0x91, 0xb5, 0x89, 0xa2, 0x17, 0x5f, 0xf7 },
+  { 0xd6, 0xc6, 0x2a, 0x61, 0x82, 0x71, 0xf3, 0xbc, 0xbe, 0x00, 0x79,
+    0x24, 0xa0, 0xc9, 0x81, 0x2f, 0x83, 0x17, 0x44, 0x5f, 0xb6, 0xfb,
+    0x19, 0xeb, 0x58, 0x9a, 0x62, 0x9f, 0x51, 0x2f, 0xb3, 0x8a, 0x0b,
+    0x4e, 0x24, 0x7d, 0xea, 0x88, 0xc5, 0x6a, 0x1b, 0xaf, 0x17, 0x88,
+    0x33, 0x65, 0xb4, 0x36, 0xf2, 0x84, 0x46, 0xff, 0x66, 0xea, 0x43,
+    0x18, 0x0b, 0xd0, 0x1e, 0xb5, 0xa6, 0x50, 0x9b, 0xd5 },
+  { 0x0b, 0x41, 0x16, 0x6b, 0xe6, 0x2f, 0x65, 0xe1, 0x93, 0xb3, 0xb8,
+    0x65, 0xe6, 0xc4, 0x7a, 0xad, 0x26, 0x0a, 0xf5, 0xfc, 0xee, 0xc9,
+    0xab, 0x44, 0xab, 0xaa, 0x46, 0x0a, 0x0c, 0x02, 0x46, 0xb6, 0xc6,
+    0x9b, 0x67, 0xd7, 0x1d, 0x3a, 0xdf, 0xec, 0x60, 0xdc, 0x8e, 0x77,
+    0x37, 0x2f, 0x09, 0x49, 0x52, 0x34, 0x4f, 0xe1, 0x0c, 0x0d, 0x59,
+    0xef, 0xec, 0x0e, 0x11, 0xc4, 0xa5, 0x16, 0x93, 0x6d },
+  { 0x79, 0xd5, 0xf9, 0xff, 0xc0, 0x5e, 0xcf, 0x33, 0x7d, 0xe9, 0xf1,
+    0xe0, 0xf1, 0xd8, 0x9b, 0x30, 0xac, 0xfe, 0xbb, 0xb8, 0x8a, 0x69,
+    0x35, 0x86, 0x78, 0x18, 0xcd, 0x8d, 0x45, 0xda, 0x3d, 0x25, 0x18,
+    0xde, 0x61, 0xa7, 0xfe, 0x28, 0x75, 0x1b, 0x61, 0x8f, 0x7a, 0x87,
+    0x5e, 0x11, 0x89, 0x8f, 0xff, 0x74, 0x15, 0x7a, 0xb9, 0x06, 0x81,
+    0xbd, 0x53, 0xfa, 0x69, 0x62, 0x67, 0x1e, 0xd9, 0x9d },
+  { 0xbe, 0xa9, 0x83, 0xd7, 0x6f, 0x24, 0xb1, 0xee, 0xde, 0x1d, 0x06,
+    0x71, 0x48, 0x05, 0x76, 0x8f, 0xaa, 0xad, 0x47, 0x08, 0xc9, 0xa4,
+    0xff, 0x9c, 0xd2, 0x42, 0x2f, 0x70, 0x6b, 0x6f, 0x0c, 0x30, 0x6d,
+    0x8b, 0x67, 0xf3, 0x40, 0x89, 0xc6, 0x5e, 0xd3, 0x88, 0x0c, 0x75,
+    0xf6, 0x7b, 0xbc, 0x4d, 0x89, 0xad, 0x87, 0x12, 0x0a, 0x77, 0xd0,
+    0xff, 0xe4, 0x36, 0xfb, 0x7b, 0x58, 0xb2, 0xca, 0x41 },
+  { 0x46, 0x6f, 0xd9, 0x15, 0xef, 0xd9, 0x50, 0xbc, 0x96, 0x65, 0x78,
+    0xcd, 0x92, 0xc6, 0x85, 0x92, 0x9d, 0x7b, 0x51, 0xa6, 0x3d, 0xb1,
+    0x42, 0xc7, 0xb9, 0xa9, 0x3d, 0x16, 0x52, 0x04, 0x95, 0x31, 0x9b,
+    0x87, 0xf6, 0x58, 0xe6, 0xaf, 0xda, 0x1b, 0x42, 0x77, 0x3e, 0x2d,
+    0x49, 0xda, 0x81, 0x45, 0x94, 0xa5, 0x54, 0x90, 0x89, 0xef, 0xb1,
+    0xf3, 0xab, 0x5f, 0x15, 0x90, 0xca, 0x0a, 0x02, 0xaf },
+  { 0xf6, 0x46, 0x11, 0x13, 0x7a, 0xd2, 0x95, 0x46, 0x70, 0xea, 0xec,
+    0xd6, 0x26, 0xd2, 0x12, 0xcf, 0xc5, 0xb9, 0xf6, 0xbb, 0x41, 0xaa,
+    0xeb, 0xb1, 0xd7, 0x1e, 0x89, 0x79, 0x2e, 0xb1, 0x31, 0x7a, 0xed,
+    0xc6, 0x38, 0x13, 0xfe, 0x63, 0xde, 0x40, 0x17, 0x98, 0xdf, 0x75,
+    0x6c, 0xa1, 0xf2, 0x20, 0x35, 0xa0, 0xfa, 0xbd, 0x37, 0xfb, 0x11,
+    0x03, 0x43, 0x7f, 0x89, 0x1e, 0xad, 0x5e, 0x64, 0x29 },
+  { 0x32, 0xe1, 0xf9, 0x38, 0xa2, 0x7f, 0xaa, 0xd8, 0xac, 0x4a, 0x13,
+    0xfd, 0x4f, 0x6a, 0x8b, 0xf3, 0xda, 0xbe, 0x4b, 0xc7, 0x2a, 0xf1,
+    0x1c, 0x8f, 0x0e, 0x1a, 0x06, 0x56, 0x7e, 0xd7, 0x04, 0xb8, 0xe7,
+    0x8e, 0x11, 0x40, 0xa0, 0xc7, 0x72, 0x4e, 0x3e, 0xfb, 0x70, 0xd2,
+    0x38, 0x07, 0xcf, 0x38, 0xe6, 0x27, 0xe3, 0x26, 0xaf, 0xc1, 0x64,
+    0xcd, 0xed, 0x52, 0xb4, 0x41, 0x39, 0xff, 0xb3, 0xf3 },
+  { 0x48, 0x33, 0xac, 0x92, 0xe3, 0x02, 0xac, 0x2b, 0x67, 0xb0, 0x2b,
+    0x88, 0x27, 0x14, 0x3b, 0xad, 0xa1, 0x5c, 0xed, 0x22, 0x0e, 0x1d,
+    0x1f, 0x5b, 0x71, 0x12, 0x0c, 0x51, 0xee, 0x54, 0xc1, 0x9d, 0x30,
+    0x1f, 0x29, 0x60, 0xbd, 0xb5, 0xa2, 0xce, 0x27, 0xd4, 0x41, 0xd1,
+    0x4a, 0xf0, 0x80, 0xcb, 0x01, 0x0a, 0x8a, 0x23, 0xee, 0xff, 0x58,
+    0x11, 0xdf, 0xa4, 0x4d, 0x1d, 0x7b, 0x35, 0x8b, 0x48 },
+  { 0x9a, 0x03, 0x88, 0xce, 0xe1, 0xad, 0x01, 0x46, 0x17, 0x7c, 0x48,
+    0xb5, 0xa0, 0x8a, 0x2d, 0xb3, 0xc4, 0x89, 0xe8, 0x4c, 0xe2, 0xab,
+    0xa8, 0xc6, 0x45, 0x11, 0x2a, 0x02, 0x1e, 0x41, 0x1c, 0xf8, 0x29,
+    0x12, 0x7f, 0xa2, 0xf1, 0xd1, 0xae, 0x1b, 0xaf, 0x3a, 0x33, 0xea,
+    0x53, 0x09, 0x84, 0x77, 0xa7, 0xd1, 0x2b, 0xa7, 0x48, 0xd2, 0xaf,
+    0x24, 0xd1, 0x66, 0x02, 0xe9, 0x19, 0x07, 0x76, 0x23 },
+  { 0xe3, 0xdf, 0x00, 0x74, 0xa9, 0x37, 0x35, 0x13, 0x0d, 0x99, 0x22,
+    0xd2, 0xbe, 0x91, 0x6f, 0x35, 0x34, 0x3d, 0x98, 0x8c, 0xe5, 0x9d,
+    0x76, 0x97, 0x15, 0xa9, 0x83, 0xb4, 0xba, 0x80, 0x7c, 0xe1, 0xee,
+    0x70, 0xa3, 0x13, 0xe5, 0x92, 0x31, 0x58, 0x4f, 0x55, 0x6e, 0xbb,
+    0xa1, 0xb9, 0x0b, 0x1b, 0xb6, 0xa6, 0xc5, 0x81, 0xa4, 0xb4, 0x7c,
+    0x3f, 0xf5, 0x21, 0x89, 0x65, 0x2a, 0xab, 0x36, 0xf5 },
+  { 0x91, 0x91, 0xcf, 0x46, 0x1b, 0x69, 0x59, 0xbe, 0xc9, 0x3e, 0xae,
+    0x7f, 0xb1, 0xc6, 0xe3, 0x70, 0x73, 0xd1, 0xa6, 0x15, 0x27, 0xad,
+    0x75, 0xd1, 0x0b, 0x7f, 0x89, 0x49, 0xd9, 0xb8, 0xaf, 0x70, 0xa2,
+    0x3a, 0xd1, 0x31, 0x2e, 0xd5, 0x1f, 0x70, 0xf0, 0xe9, 0xdf, 0x60,
+    0x1d, 0xda, 0xe2, 0x38, 0x90, 0x6c, 0x0f, 0xe3, 0xf7, 0x66, 0xb1,
+    0x4f, 0x11, 0x3b, 0x26, 0xbc, 0x85, 0x42, 0xd1, 0xd2 },
+  { 0x2a, 0x8b, 0xad, 0xe2, 0x72, 0xee, 0x7a, 0xc6, 0x43, 0xc5, 0xe3,
+    0x71, 0x47, 0xfa, 0xac, 0x92, 0xc3, 0x97, 0x0b, 0xd3, 0x86, 0x2f,
+    0x53, 0x1e, 0x5d, 0xce, 0xa5, 0xce, 0xac, 0xd1, 0x83, 0x74, 0x53,
+    0xaa, 0x49, 0x8d, 0x78, 0x5b, 0x4d, 0x1f, 0x89, 0xe1, 0xb2, 0xa7,
+    0x39, 0xca, 0x4a, 0x38, 0x49, 0x87, 0x30, 0x27, 0x46, 0xb4, 0xf1,
+    0x13, 0x42, 0x43, 0x02, 0xc4, 0xa1, 0xe0, 0xf9, 0xdf },
+  { 0x32, 0x3e, 0x67, 0x93, 0xc7, 0xdd, 0x9b, 0x4d, 0x7b, 0xb7, 0xfb,
+    0xf2, 0x15, 0x31, 0xd3, 0x7f, 0x72, 0x64, 0x53, 0x2c, 0x58, 0xf1,
+    0x22, 0x55, 0x48, 0xd0, 0x6e, 0x69, 0x40, 0xc6, 0x3e, 0x91, 0x27,
+    0x09, 0x90, 0xe7, 0xf5, 0x64, 0x32, 0x03, 0xc9, 0x87, 0x64, 0x7e,
+    0x5c, 0xf6, 0x61, 0x03, 0xe7, 0x9b, 0x71, 0x4c, 0x58, 0x1b, 0xd8,
+    0x77, 0x2e, 0x19, 0xd0, 0xf0, 0x05, 0xdc, 0x86, 0x33 },
+  { 0xf9, 0x22, 0x07, 0x6d, 0x29, 0x5d, 0x23, 0xe2, 0x98, 0x58, 0x30,
+    0xaa, 0xd2, 0xf2, 0x3f, 0x65, 0x2f, 0x7f, 0x4d, 0xb4, 0x2c, 0x11,
+    0x9e, 0xd2, 0x20, 0xa5, 0x45, 0x14, 0x88, 0xa4, 0x53, 0xf5, 0x9f,
+    0xa8, 0xa2, 0xde, 0x23, 0x03, 0x00, 0x0d, 0x6b, 0xfd, 0x8c, 0x48,
+    0x23, 0xa8, 0x5f, 0xad, 0xb4, 0xfb, 0x8e, 0x7e, 0xac, 0x12, 0x2b,
+    0xf0, 0x12, 0x47, 0xd7, 0x6f, 0x65, 0x24, 0x7d, 0x45 },
+  { 0xdc, 0x40, 0x00, 0x95, 0x60, 0x95, 0x92, 0x91, 0x55, 0x8e, 0xbe,
+    0x07, 0x20, 0x64, 0xce, 0x67, 0x12, 0xc9, 0x21, 0xb5, 0x40, 0x9b,
+    0x44, 0xe0, 0x4f, 0x9a, 0x56, 0x5e, 0xea, 0xdd, 0x39, 0xa7, 0x71,
+    0x6e, 0x21, 0xb4, 0x6d, 0xd8, 0x61, 0x65, 0x17, 0xa2, 0x1a, 0x0c,
+    0x03, 0x41, 0x9e, 0x94, 0xdb, 0x82, 0x0a, 0x35, 0x3f, 0x15, 0x2d,
+    0x10, 0x83, 0x84, 0xbe, 0x94, 0x70, 0x09, 0x3f, 0x89 },
+  { 0x7f, 0xa4, 0xbe, 0x91, 0xca, 0x52, 0x07, 0xff, 0x08, 0x7d, 0xe9,
+    0x2f, 0x1d, 0xb0, 0x9b, 0xf7, 0x1a, 0x67, 0x87, 0x8b, 0xed, 0x19,
+    0x3a, 0x5c, 0x2c, 0xc4, 0xe3, 0x53, 0x23, 0xb8, 0xdf, 0x99, 0xa2,
+    0x6e, 0xcb, 0x98, 0x88, 0xd7, 0xb3, 0x4a, 0x73, 0x9d, 0x64, 0x1a,
+    0x0e, 0xcd, 0x0a, 0x66, 0x47, 0xa6, 0xa0, 0x64, 0x26, 0xf3, 0xcc,
+    0x1f, 0xef, 0xdf, 0x90, 0x69, 0x92, 0x2f, 0xae, 0x4c },
+  { 0xba, 0xd3, 0xcd, 0x75, 0x90, 0x5d, 0x7b, 0xfd, 0xa3, 0x32, 0x2b,
+    0x44, 0xa7, 0xd3, 0x58, 0x87, 0x14, 0xd3, 0x33, 0xee, 0x86, 0x85,
+    0x5a, 0x87, 0x27, 0x47, 0xe7, 0x04, 0xf6, 0x11, 0x94, 0x84, 0xbd,
+    0xb7, 0xd0, 0x77, 0xfa, 0x08, 0xed, 0xc4, 0xa7, 0x9d, 0xe0, 0xf4,
+    0x3f, 0xca, 0x8d, 0x43, 0x6e, 0x8a, 0x10, 0x08, 0x57, 0xf5, 0x9b,
+    0xc7, 0xb0, 0x55, 0xb9, 0x87, 0xf9, 0x7a, 0xc6, 0xb9 },
+  { 0xb7, 0xde, 0xe8, 0xe8, 0x33, 0x9d, 0xb2, 0x97, 0xfd, 0xaa, 0x3c,
+    0xa5, 0xc1, 0xdc, 0x19, 0x88, 0xd9, 0x7f, 0x5f, 0xb6, 0x20, 0x8c,
+    0x64, 0xde, 0xa9, 0x5e, 0x1c, 0x78, 0xf3, 0x37, 0xce, 0x20, 0xa2,
+    0xb4, 0xdf, 0x17, 0xa7, 0xb8, 0x23, 0x6a, 0x90, 0xd6, 0x28, 0x67,
+    0x33, 0x16, 0x35, 0x72, 0xc8, 0x67, 0xd9, 0x3d, 0xe8, 0x9e, 0xf6,
+    0x2f, 0xa0, 0x5d, 0xab, 0x70, 0x7e, 0xc3, 0xa7, 0x70 },
+  { 0xa0, 0xf7, 0xe9, 0x3c, 0xf3, 0x25, 0x02, 0xb9, 0xfd, 0x79, 0xec,
+    0x20, 0x54, 0x62, 0x07, 0xf3, 0x31, 0xc5, 0x29, 0x9e, 0xce, 0xf3,
+    0x50, 0xd6, 0x6e, 0xa8, 0x55, 0xc8, 0x7f, 0xbd, 0xdf, 0x18, 0xe6,
+    0x91, 0xc2, 0x0d, 0x04, 0x5a, 0x30, 0x8f, 0x83, 0xf6, 0xcb, 0x8f,
+    0xca, 0x69, 0xd7, 0xe2, 0xb3, 0x9b, 0x34, 0xd2, 0xf8, 0x77, 0x27,
+    0x6c, 0x19, 0x6b, 0xf5, 0x14, 0xba, 0xc6, 0x02, 0x70 },
+  { 0x6f, 0x50, 0x93, 0xcf, 0xc8, 0x83, 0x00, 0xbf, 0x68, 0x8e, 0x88,
+    0x4b, 0x4c, 0x5e, 0xc2, 0xc3, 0x1a, 0x8c, 0xc2, 0x8d, 0x63, 0x31,
+    0xad, 0x7c, 0xa7, 0x1d, 0x97, 0x60, 0x21, 0x64, 0x82, 0x05, 0x28,
+    0x15, 0xd4, 0x4f, 0xc6, 0x9e, 0x18, 0xa8, 0xdc, 0x8b, 0xd7, 0x1b,
+    0x31, 0xf2, 0xb5, 0x89, 0xa7, 0xc0, 0x78, 0x0b, 0x61, 0x99, 0x38,
+    0x5f, 0x8d, 0xae, 0x6c, 0x9b, 0x79, 0x74, 0xc4, 0xcb },
+  { 0x3c, 0xff, 0x46, 0xac, 0x35, 0x46, 0xf6, 0x5a, 0xd7, 0xa7, 0x20,
+    0x87, 0x1a, 0xfa, 0x20, 0xa9, 0x21, 0x6d, 0xda, 0x5c, 0x45, 0x18,
+    0x81, 0x56, 0xa5, 0xbb, 0xed, 0xf2, 0x15, 0x46, 0xd4, 0xbb, 0x39,
+    0x40, 0xb2, 0x1a, 0x41, 0xa3, 0x94, 0x03, 0xe3, 0xcf, 0xd5, 0xe7,
+    0xa0, 0xe7, 0x90, 0x4d, 0xa9, 0x5f, 0x4d, 0x8e, 0x0c, 0x5b, 0xf5,
+    0xb7, 0x0e, 0xb0, 0x29, 0x55, 0x6e, 0xfd, 0x49, 0x7e },
+  { 0xaf, 0x66, 0x8a, 0x80, 0x5e, 0x6d, 0x70, 0x4b, 0x1e, 0x58, 0x1f,
+    0x1e, 0x8e, 0x3c, 0x00, 0xcf, 0x4c, 0xf3, 0xe5, 0x46, 0x14, 0x7c,
+    0x40, 0x6d, 0x17, 0xca, 0x97, 0x4d, 0x19, 0xa0, 0x14, 0xc7, 0x8b,
+    0x44, 0xe7, 0x2d, 0xde, 0xeb, 0x65, 0x26, 0x07, 0xe8, 0x6d, 0x69,
+    0x02, 0x59, 0xdc, 0xab, 0x0d, 0xda, 0x81, 0xc7, 0x7c, 0x7e, 0xe2,
+    0x72, 0x1e, 0x82, 0xbb, 0xb1, 0x39, 0x43, 0x07, 0x1d },
+  { 0x79, 0xdd, 0xeb, 0x5c, 0x54, 0xde, 0xd1, 0xe4, 0x48, 0x40, 0x71,
+    0xc4, 0x6b, 0xb4, 0x28, 0x02, 0xd2, 0x3b, 0x3a, 0x08, 0xc1, 0x23,
+    0x11, 0xbe, 0x36, 0x3c, 0x7c, 0x7a, 0x02, 0x5a, 0x17, 0x64, 0xc8,
+    0xd8, 0x50, 0x69, 0xfd, 0xa8, 0xd5, 0x17, 0x77, 0x7d, 0x8d, 0xd8,
+    0x09, 0xe3, 0xd4, 0xa9, 0x56, 0x04, 0x1a, 0x70, 0x79, 0xf9, 0x16,
+    0x7b, 0x0f, 0xe9, 0x71, 0x2e, 0x5f, 0x12, 0x29, 0xf5 },
+  { 0x99, 0x8e, 0x82, 0xf4, 0x26, 0x3d, 0x53, 0xae, 0xda, 0xc9, 0x39,
+    0xeb, 0xb6, 0xeb, 0x8b, 0x19, 0x69, 0x74, 0x6c, 0xb8, 0x15, 0xbd,
+    0x72, 0x1f, 0x17, 0xa4, 0x8b, 0xee, 0x9e, 0xcf, 0xf2, 0xfe, 0x59,
+    0x8c, 0x53, 0x9c, 0x41, 0x9a, 0x60, 0xe0, 0xd5, 0xa0, 0x4f, 0x1c,
+    0xb5, 0x23, 0xa2, 0xfd, 0x05, 0x38, 0xbb, 0x17, 0x8e, 0x44, 0x75,
+    0x8d, 0x31, 0x59, 0xab, 0x9e, 0x02, 0x84, 0x01, 0xa3 },
+  { 0x33, 0x96, 0xcf, 0xd5, 0xcd, 0xe1, 0x4a, 0xec, 0x1a, 0xae, 0xd3,
+    0xe1, 0x22, 0x52, 0xcf, 0xd6, 0xe3, 0x42, 0xed, 0x25, 0x5e, 0x8e,
+    0x9e, 0x1b, 0xe1, 0x0f, 0x1f, 0x27, 0x38, 0x77, 0xf3, 0x63, 0x33,
+    0x81, 0xe3, 0xc9, 0x61, 0xe6, 0x7e, 0xc4, 0x1e, 0x8f, 0x9e, 0x16,
+    0x11, 0x0f, 0xc0, 0x3d, 0xde, 0x88, 0xbf, 0xc0, 0x96, 0xfc, 0x15,
+    0x14, 0x46, 0x1d, 0x70, 0xd0, 0xbe, 0xce, 0x0a, 0xf6 },
+  { 0x77, 0x7d, 0x9d, 0xc5, 0x5a, 0x2f, 0x57, 0xa4, 0x6e, 0xa0, 0x6a,
+    0x2f, 0x4c, 0xb9, 0x76, 0x0d, 0x00, 0xd7, 0xa8, 0x62, 0xd0, 0xa2,
+    0xaa, 0x19, 0x46, 0x7b, 0x57, 0x0f, 0x7c, 0x7d, 0x5e, 0xa7, 0x62,
+    0x9a, 0x95, 0xeb, 0x20, 0x0e, 0x1f, 0x9d, 0xb0, 0x66, 0x10, 0xcf,
+    0x8e, 0x30, 0xd5, 0xe6, 0xad, 0x0a, 0x7b, 0x63, 0x29, 0x77, 0xfc,
+    0x21, 0xbb, 0x17, 0x89, 0x67, 0xf3, 0xb0, 0xe0, 0x9b },
+  { 0x32, 0xee, 0x35, 0x7f, 0xc9, 0x16, 0x36, 0xa8, 0x55, 0xba, 0x01,
+    0xa0, 0xb8, 0xda, 0x6f, 0x35, 0x53, 0xb1, 0xd5, 0x20, 0xad, 0xcf,
+    0xe8, 0xfe, 0x9d, 0xeb, 0xcc, 0xb2, 0x6c, 0x5c, 0x4c, 0xe8, 0x50,
+    0x5b, 0xb1, 0xef, 0xb5, 0xed, 0x5b, 0xaa, 0x4c, 0x52, 0x45, 0xb5,
+    0x0d, 0x74, 0x46, 0x3f, 0x07, 0x67, 0xb2, 0xc7, 0x83, 0xc4, 0x7a,
+    0x93, 0xb0, 0xfd, 0xa6, 0x68, 0x95, 0x69, 0x3c, 0xe6 },
+  { 0x34, 0x0c, 0x0a, 0x7c, 0xe4, 0x96, 0xfe, 0xbd, 0xa1, 0x3f, 0xa2,
+    0x40, 0x7a, 0x21, 0xdc, 0x19, 0x83, 0x9b, 0xed, 0xae, 0x1a, 0x08,
+    0x6a, 0xd0, 0xfe, 0xd3, 0x91, 0x7d, 0xf9, 0xbf, 0x40, 0x94, 0x4a,
+    0x78, 0x7f, 0x64, 0x1e, 0x90, 0xdd, 0xba, 0xe0, 0x3a, 0x93, 0x37,
+    0x72, 0x3e, 0x51, 0x66, 0x8f, 0xb8, 0x93, 0x77, 0x2c, 0x0f, 0xbd,
+    0xb3, 0xeb, 0x7e, 0xf7, 0x90, 0xdf, 0xcb, 0xb9, 0xab },
+  { 0xd8, 0x6a, 0x5b, 0xaa, 0x33, 0x65, 0xab, 0xd8, 0xf4, 0x42, 0xcd,
+    0x6e, 0xbb, 0x93, 0x11, 0x38, 0x19, 0xf0, 0xb4, 0x60, 0x61, 0xe1,
+    0x34, 0x04, 0xef, 0xaa, 0x1a, 0x58, 0xe1, 0xff, 0x27, 0x2a, 0xd4,
+    0xbf, 0xd3, 0x08, 0x15, 0xad, 0xd8, 0x8a, 0xd9, 0x8f, 0xce, 0x9a,
+    0xf0, 0x18, 0x37, 0x4c, 0xa6, 0x0d, 0x89, 0x79, 0x0f, 0x71, 0xa6,
+    0x07, 0x5f, 0x3d, 0x68, 0xd3, 0x20, 0x21, 0xa9, 0xeb },
+  { 0xa6, 0x7e, 0x6e, 0xc6, 0x57, 0xc9, 0x5e, 0xab, 0x3c, 0x3c, 0x32,
+    0xe4, 0x1f, 0xbf, 0x39, 0xcf, 0x20, 0x33, 0xab, 0x4b, 0xe2, 0xe2,
+    0xb8, 0x21, 0x10, 0x4a, 0xdb, 0xe6, 0x9d, 0x16, 0xe9, 0x48, 0xdc,
+    0xe4, 0xc4, 0xc6, 0xa3, 0xcf, 0x22, 0x76, 0x90, 0x1f, 0x7d, 0x4f,
+    0xfd, 0x69, 0x65, 0x46, 0x49, 0x88, 0x2c, 0x01, 0x4d, 0x2c, 0x10,
+    0xa1, 0x30, 0x2b, 0x79, 0xc6, 0x15, 0x69, 0xcd, 0x36 },
+  { 0x55, 0xce, 0x19, 0x2a, 0xe4, 0xb3, 0xea, 0xf8, 0x55, 0x59, 0x0e,
+    0x2d, 0x44, 0xe6, 0x25, 0xd9, 0xba, 0x14, 0x6e, 0xb7, 0x50, 0x48,
+    0xe6, 0xb5, 0x6e, 0x02, 0x50, 0x31, 0xef, 0xba, 0x0b, 0xda, 0x8a,
+    0xaa, 0xfa, 0x04, 0x70, 0xb7, 0xac, 0x3d, 0x40, 0x6e, 0x5a, 0xba,
+    0x3e, 0x83, 0x2f, 0x27, 0xa5, 0x07, 0x24, 0x6d, 0x1b, 0x5f, 0x33,
+    0xde, 0xa1, 0xf7, 0x24, 0xe2, 0xb8, 0x1b, 0x0c, 0x98 },
+  { 0xb3, 0xa2, 0x0c, 0x1f, 0xb0, 0xb4, 0xf0, 0xd3, 0x77, 0x26, 0xc2,
+    0x3b, 0x58, 0x77, 0xdd, 0x8e, 0x72, 0xf6, 0x98, 0x86, 0xe0, 0x9a,
+    0x8c, 0x68, 0xcf, 0xc3, 0x01, 0xd2, 0xa3, 0xf2, 0xf9, 0x5c, 0xef,
+    0xcf, 0xab, 0xb8, 0x88, 0x99, 0x03, 0xc7, 0x32, 0xf4, 0xe8, 0x14,
+    0x32, 0xd3, 0xf6, 0x78, 0xcc, 0xdf, 0xc3, 0x98, 0xac, 0xd8, 0xa2,
+    0xf0, 0x66, 0x41, 0x10, 0x04, 0x50, 0xd8, 0x9f, 0x32 },
+  { 0xf7, 0x27, 0x2d, 0x93, 0xc7, 0x01, 0x2d, 0x38, 0xb2, 0x7f, 0x0c,
+    0x9a, 0xe2, 0x01, 0x79, 0x58, 0xbb, 0xa6, 0x66, 0xa9, 0xde, 0x1e,
+    0x88, 0x12, 0xe9, 0x74, 0x37, 0xae, 0xb2, 0xe0, 0x3c, 0x99, 0x94,
+    0x38, 0xf0, 0xbe, 0x33, 0x3d, 0x09, 0xad, 0xdb, 0xcf, 0xaa, 0xc7,
+    0xaa, 0x73, 0xf7, 0xb6, 0xcc, 0xec, 0x67, 0xdc, 0x07, 0x79, 0x98,
+    0xde, 0xdb, 0x8c, 0x13, 0x32, 0xba, 0xc0, 0xfb, 0xa8 },
+  { 0x1f, 0xe7, 0xb3, 0xde, 0x34, 0xc0, 0x47, 0x9c, 0xa8, 0x40, 0x5f,
+    0x3c, 0xbc, 0xd2, 0xdb, 0x64, 0xbb, 0x18, 0xdb, 0xb2, 0x91, 0xa5,
+    0xfe, 0xaa, 0x16, 0xc5, 0x22, 0x8c, 0x93, 0xee, 0x21, 0xc7, 0x11,
+    0xd6, 0x8a, 0x01, 0x0c, 0x2a, 0xe8, 0x80, 0x05, 0xeb, 0xac, 0x95,
+    0x9e, 0x3a, 0x32, 0x24, 0x52, 0xf8, 0x62, 0xdd, 0xe9, 0x4b, 0xb9,
+    0x41, 0x81, 0x3e, 0x52, 0x4d, 0x23, 0x47, 0xfe, 0xee },
+  { 0x4e, 0xe1, 0xd3, 0x88, 0x05, 0xc3, 0x22, 0x84, 0xec, 0xeb, 0xe9,
+    0x2e, 0x3d, 0xf6, 0xcd, 0x98, 0xc7, 0xd6, 0x68, 0x0e, 0xab, 0x0d,
+    0x68, 0x66, 0x4f, 0x96, 0x70, 0x6c, 0x45, 0x63, 0x3b, 0x1e, 0x26,
+    0x82, 0x22, 0xaa, 0x5a, 0x52, 0x79, 0xef, 0x01, 0xfc, 0x28, 0x54,
+    0x32, 0xab, 0xee, 0xd7, 0x4b, 0xa3, 0xdf, 0x18, 0x9f, 0x50, 0xa9,
+    0x89, 0xd5, 0x8e, 0x71, 0x30, 0x62, 0x2d, 0xaa, 0x59 },
+  { 0x0e, 0x14, 0x05, 0x87, 0x1c, 0x87, 0xa5, 0xea, 0x40, 0x83, 0x42,
+    0xf3, 0x9d, 0x34, 0x94, 0xf9, 0x39, 0xf7, 0x3c, 0x22, 0x60, 0xc2,
+    0xa4, 0x3a, 0x5c, 0x9f, 0x1b, 0x57, 0x33, 0x0c, 0xca, 0x40, 0x93,
+    0xfc, 0x1f, 0x42, 0xf9, 0x6d, 0x83, 0x00, 0x56, 0x77, 0x03, 0x7d,
+    0xb5, 0x1a, 0xef, 0x26, 0xf0, 0x54, 0x38, 0x05, 0x7a, 0xe7, 0x9e,
+    0xd1, 0x44, 0x64, 0xfd, 0x8e, 0x57, 0xd1, 0x55, 0x86 },
+  { 0x17, 0xc5, 0xca, 0xb4, 0x09, 0x10, 0x73, 0x62, 0x1b, 0x5c, 0x24,
+    0xc3, 0x36, 0x31, 0x6d, 0x0c, 0xf6, 0x49, 0xba, 0x1e, 0xff, 0xeb,
+    0xfc, 0x87, 0xe0, 0x43, 0x9c, 0xdf, 0x57, 0x88, 0x87, 0xb2, 0x21,
+    0x65, 0x6d, 0x33, 0x9a, 0x6f, 0xd1, 0x98, 0xab, 0xae, 0xe6, 0x7e,
+    0xa1, 0x88, 0xdd, 0x66, 0x56, 0x78, 0x23, 0xfc, 0x22, 0x0c, 0x52,
+    0xb5, 0x74, 0x90, 0x25, 0x14, 0x69, 0xd2, 0x5d, 0x8c },
+  { 0x57, 0xdc, 0x27, 0x97, 0xd1, 0x42, 0x68, 0x1c, 0x94, 0xfe, 0x48,
+    0x86, 0x26, 0x98, 0x6e, 0xd4, 0xb2, 0x67, 0x03, 0xcb, 0xf6, 0xbf,
+    0xe5, 0x93, 0x91, 0x64, 0x36, 0x57, 0x06, 0x5b, 0x2d, 0x46, 0xe4,
+    0xb1, 0xdd, 0xb3, 0xaa, 0x83, 0x2c, 0x9b, 0xd4, 0x49, 0x75, 0x5a,
+    0xc8, 0xb1, 0xbf, 0x93, 0x68, 0x97, 0xfb, 0xc6, 0xad, 0xe3, 0x78,
+    0xf2, 0xbd, 0x64, 0x93, 0xe4, 0x86, 0xf4, 0x20, 0x29 },
+  { 0x44, 0x12, 0xdd, 0x6b, 0xed, 0x6d, 0xb2, 0xa8, 0x03, 0xc2, 0xe0,
+    0xdf, 0x8f, 0x58, 0x29, 0xe7, 0xa4, 0xb0, 0x41, 0x78, 0x89, 0x51,
+    0x0d, 0xf7, 0xdf, 0xee, 0x49, 0x57, 0x4a, 0x71, 0xec, 0x0d, 0x9e,
+    0x0d, 0x46, 0x06, 0x50, 0x17, 0xc7, 0x2d, 0xd9, 0x74, 0x39, 0x33,
+    0xca, 0x83, 0x9a, 0x76, 0x8d, 0xd1, 0x5a, 0xb0, 0xb7, 0xc1, 0x4c,
+    0x62, 0x6a, 0x35, 0x41, 0x09, 0x69, 0x01, 0x96, 0xae },
+  { 0xd0, 0xeb, 0xc7, 0x71, 0x03, 0x1b, 0x7c, 0x16, 0x00, 0x21, 0xc9,
+    0xb6, 0xfb, 0xb2, 0xb6, 0x70, 0xe3, 0xb4, 0x02, 0x70, 0x02, 0x69,
+    0x07, 0xa3, 0x91, 0x63, 0xdb, 0x18, 0x73, 0xec, 0xc3, 0xb8, 0x00,
+    0x11, 0x1d, 0xd7, 0xbf, 0x13, 0x8f, 0x83, 0xa6, 0x10, 0xdc, 0x04,
+    0x6d, 0xa2, 0x68, 0xb7, 0x2b, 0x8c, 0x90, 0x86, 0x92, 0x23, 0x77,
+    0xdb, 0xed, 0x73, 0x94, 0x82, 0x43, 0xca, 0x1e, 0x14 },
+  { 0x10, 0xc4, 0xba, 0x31, 0x55, 0x91, 0x69, 0x8d, 0xfb, 0x91, 0xa5,
+    0x73, 0x37, 0x63, 0x18, 0x84, 0xb4, 0x73, 0x8d, 0x9f, 0x59, 0x80,
+    0x78, 0x51, 0xa6, 0x79, 0x84, 0x0c, 0xc2, 0x87, 0xac, 0xe3, 0x01,
+    0x1c, 0xcd, 0xc8, 0xf4, 0xa4, 0x85, 0xbb, 0x19, 0x73, 0x40, 0x4e,
+    0xf9, 0xee, 0x9b, 0x9c, 0xf1, 0xea, 0xdb, 0xc5, 0x40, 0x74, 0xc6,
+    0xd1, 0x13, 0xde, 0x8f, 0xc9, 0x1d, 0x07, 0x97, 0xeb },
+  { 0x14, 0x64, 0x34, 0x7b, 0xe3, 0x2c, 0x79, 0x59, 0x17, 0x2b, 0x74,
+    0x72, 0xd1, 0x1f, 0xe0, 0x78, 0x44, 0xa5, 0x2e, 0x2d, 0x3b, 0x2d,
+    0x05, 0x8c, 0xc6, 0xbc, 0xc0, 0xa8, 0xa2, 0x75, 0xd6, 0xb8, 0x2b,
+    0x2d, 0x62, 0x63, 0x75, 0x5e, 0xaf, 0x2a, 0x65, 0x88, 0xb6, 0xa1,
+    0xeb, 0x79, 0x9a, 0xf8, 0x3a, 0x4c, 0xe7, 0x53, 0xf8, 0xc7, 0x5a,
+    0x22, 0x84, 0xd0, 0x28, 0x5b, 0xab, 0x5f, 0x7c, 0x1c },
+  { 0xf4, 0x09, 0x23, 0x1e, 0xd1, 0x87, 0xf5, 0xc4, 0xe8, 0x33, 0xfa,
+    0x9e, 0x30, 0x42, 0xac, 0xa6, 0xc8, 0x58, 0xb0, 0x8b, 0x49, 0x6b,
+    0x25, 0x31, 0xf8, 0x4f, 0xd5, 0xce, 0xa9, 0x3e, 0xcd, 0x06, 0xda,
+    0xfe, 0x0a, 0x10, 0xc3, 0xff, 0x23, 0x76, 0xc7, 0x4d, 0xc8, 0x0d,
+    0xa0, 0x7d, 0xa0, 0x18, 0x64, 0xfb, 0xf2, 0x68, 0x59, 0x60, 0xb5,
+    0x40, 0xb3, 0xa2, 0xe9, 0x42, 0xcb, 0x8d, 0x90, 0x9f },
+  { 0x39, 0x51, 0x32, 0xc5, 0x80, 0xc3, 0x55, 0xb5, 0xb0, 0xe2, 0x35,
+    0x33, 0x6c, 0x8d, 0xc1, 0x08, 0x5e, 0x59, 0x59, 0x64, 0x04, 0x3d,
+    0x38, 0x9e, 0x08, 0x1e, 0xfe, 0x48, 0x5b, 0xa4, 0xc6, 0x37, 0x72,
+    0xdb, 0x8d, 0x7e, 0x0f, 0x18, 0x6c, 0x50, 0x98, 0x2e, 0x12, 0x23,
+    0xea, 0x78, 0x5a, 0xdc, 0x74, 0x0b, 0x0c, 0xf2, 0x18, 0x70, 0x74,
+    0x58, 0xb8, 0xb8, 0x03, 0x40, 0x42, 0xf9, 0x23, 0xc2 },
+  { 0xf9, 0x2a, 0xba, 0xca, 0x21, 0x32, 0x29, 0x66, 0x06, 0x49, 0xef,
+    0x2d, 0x8f, 0x88, 0x11, 0x5b, 0x5b, 0xed, 0x8a, 0xb5, 0xb9, 0xbc,
+    0xa9, 0xa1, 0xb4, 0xc5, 0x24, 0x57, 0x03, 0x53, 0x10, 0xc4, 0x1a,
+    0x6b, 0xea, 0x2b, 0x23, 0xb7, 0x91, 0x8b, 0x5b, 0x8b, 0xf3, 0x8b,
+    0x52, 0xea, 0xc6, 0xff, 0x3b, 0x62, 0x13, 0xa5, 0x22, 0xf3, 0x81,
+    0xbe, 0x7f, 0xf0, 0x90, 0x6d, 0xba, 0x7b, 0xd0, 0x0c },
+  { 0xcb, 0xad, 0xe7, 0xad, 0x3b, 0x5d, 0xee, 0x0f, 0xf1, 0xa4, 0x6b,
+    0x08, 0x2c, 0xf4, 0xe1, 0xe1, 0xdc, 0x21, 0x62, 0x0d, 0xd2, 0xcc,
+    0x0e, 0xdc, 0x2c, 0x70, 0x7a, 0x21, 0x62, 0xd2, 0x14, 0x99, 0x69,
+    0xab, 0xbb, 0x29, 0xc5, 0x72, 0x0b, 0x04, 0xbd, 0x15, 0x68, 0xa9,
+    0x55, 0x61, 0x95, 0xe6, 0x7f, 0x24, 0x32, 0x2d, 0xd9, 0xaa, 0x4e,
+    0x83, 0x65, 0x19, 0x1a, 0xa5, 0xb6, 0xc4, 0x45, 0x79 },
+  { 0xf5, 0x1b, 0x4a, 0xe4, 0xd4, 0xc5, 0x4a, 0x29, 0xcf, 0x71, 0x35,
+    0xa8, 0xfe, 0x1e, 0xab, 0xd5, 0xe1, 0xbc, 0xbf, 0x82, 0x08, 0x96,
+    0x96, 0x7d, 0xc4, 0x1e, 0x38, 0x49, 0xda, 0xc2, 0x25, 0x07, 0x69,
+    0x42, 0x10, 0xca, 0x11, 0xc4, 0xeb, 0xf1, 0xc2, 0x9a, 0x8d, 0x4f,
+    0x71, 0xb3, 0x0f, 0x76, 0xc9, 0xb6, 0x01, 0x0a, 0xd9, 0x5b, 0xdf,
+    0xb0, 0xde, 0x83, 0x79, 0x25, 0xf0, 0x61, 0x25, 0x97 },
+  { 0xce, 0x38, 0x72, 0x11, 0x5d, 0x83, 0x3b, 0x34, 0x56, 0xca, 0x94,
+    0x2e, 0x6e, 0x38, 0x5f, 0x28, 0xa9, 0x03, 0xbe, 0xab, 0xfb, 0x75,
+    0x3f, 0x8a, 0xfc, 0xcc, 0x12, 0xf2, 0x58, 0x2c, 0xe1, 0xf3, 0x62,
+    0x12, 0xbd, 0x05, 0xe0, 0x5a, 0x46, 0xfc, 0x88, 0xd3, 0x19, 0x50,
+    0xb4, 0x91, 0x1a, 0xe5, 0xdc, 0xd8, 0xff, 0x7a, 0x0b, 0x50, 0x47,
+    0x4c, 0xb4, 0x88, 0xcc, 0xf2, 0xa8, 0x9c, 0xd0, 0xeb },
+  { 0x9b, 0xb7, 0x4c, 0xbd, 0x47, 0xa6, 0x24, 0xcb, 0xea, 0xfc, 0xc1,
+    0x6d, 0x46, 0x29, 0x47, 0xbb, 0xea, 0x13, 0x70, 0xb8, 0x5c, 0x96,
+    0x1a, 0x40, 0x7d, 0xf9, 0x86, 0x3e, 0x54, 0xe6, 0xd9, 0xe6, 0xa8,
+    0xd2, 0xef, 0x0c, 0x64, 0x97, 0x20, 0x5e, 0x5e, 0xb7, 0xc3, 0xe5,
+    0x9e, 0x69, 0x8d, 0x99, 0x24, 0x63, 0xca, 0x9d, 0xd4, 0xcf, 0x28,
+    0xcf, 0x9a, 0x2d, 0x4e, 0x30, 0xc1, 0x33, 0xe8, 0x55 },
+  { 0x72, 0x96, 0x33, 0x82, 0x0b, 0xf0, 0x13, 0xd9, 0xd2, 0xbd, 0x37,
+    0x3c, 0xca, 0xc7, 0xbc, 0x9f, 0x37, 0x16, 0xf6, 0x9e, 0x16, 0xa4,
+    0x4e, 0x94, 0x9c, 0x7a, 0x9a, 0x93, 0xdc, 0xa1, 0x26, 0xbb, 0x1a,
+    0xa5, 0x4e, 0x5e, 0x70, 0x40, 0x70, 0x7f, 0x02, 0x87, 0x6a, 0xfd,
+    0x02, 0x0a, 0xf4, 0x72, 0x63, 0x9d, 0x49, 0xf5, 0x42, 0x0d, 0x29,
+    0x4c, 0x3a, 0xa3, 0x1d, 0x06, 0x7e, 0x3e, 0x85, 0x75 },
+  { 0x06, 0x86, 0x1d, 0xb3, 0x07, 0xc6, 0x78, 0x08, 0x6e, 0x8b, 0x2a,
+    0xec, 0xdf, 0x18, 0x29, 0xd2, 0x88, 0x3d, 0x28, 0xb7, 0x31, 0xab,
+    0xd0, 0xf1, 0xe7, 0x2f, 0x1c, 0xed, 0x6c, 0x7a, 0xd4, 0x17, 0x2e,
+    0xca, 0x63, 0x22, 0xa8, 0x3f, 0xb6, 0xa6, 0x5a, 0xfa, 0x37, 0xe9,
+    0x4a, 0x3e, 0x2b, 0xa2, 0x05, 0xb8, 0x7b, 0xf3, 0x82, 0xd9, 0x15,
+    0x88, 0x49, 0x7a, 0x46, 0x50, 0x88, 0x3b, 0xd8, 0x75 },
+  { 0x35, 0x6e, 0xce, 0xaf, 0x17, 0x02, 0xb3, 0x70, 0xf4, 0xaa, 0xb8,
+    0xea, 0x82, 0x84, 0x86, 0xf3, 0x30, 0x13, 0xf7, 0x44, 0xb3, 0x9e,
+    0x7e, 0xa2, 0x6c, 0x69, 0x18, 0xd6, 0x0e, 0x1a, 0xbc, 0xf4, 0x4f,
+    0xb1, 0x6e, 0xdc, 0xa7, 0x72, 0x0a, 0xcf, 0xc6, 0xa7, 0x01, 0xbf,
+    0x1e, 0x2c, 0x35, 0xdd, 0xbd, 0x69, 0x5a, 0x8d, 0x40, 0x8e, 0x8c,
+    0x96, 0x32, 0xe8, 0xcd, 0x27, 0x23, 0x0c, 0xad, 0x8d },
+  { 0x48, 0x9a, 0x39, 0xd0, 0xfc, 0x3c, 0xde, 0xaf, 0x42, 0x89, 0x2e,
+    0xd8, 0x03, 0x85, 0xc1, 0x1c, 0xe2, 0x93, 0xc9, 0x32, 0x21, 0x5b,
+    0xb2, 0x31, 0x88, 0x69, 0x2a, 0x86, 0xe6, 0x1b, 0xca, 0xd9, 0x2c,
+    0x2a, 0x1d, 0x11, 0x42, 0x60, 0x1b, 0x1b, 0xdf, 0x09, 0x82, 0xd1,
+    0xcd, 0x1e, 0x05, 0xc0, 0x52, 0xde, 0x81, 0x9e, 0x64, 0xf2, 0x47,
+    0xdb, 0x35, 0x91, 0x5d, 0xd1, 0xdb, 0x79, 0xa3, 0xb5 },
+  { 0xc0, 0x2f, 0x46, 0x4b, 0x4d, 0xd1, 0x81, 0x17, 0xe3, 0x0a, 0x8d,
+    0xb8, 0xef, 0x1d, 0xa0, 0x67, 0x13, 0x4b, 0x60, 0x4e, 0xfa, 0x19,
+    0x51, 0x76, 0x7e, 0xe6, 0x32, 0xdc, 0x02, 0x4d, 0x64, 0xc0, 0x0f,
+    0x24, 0x49, 0xf0, 0x42, 0xdb, 0x3a, 0xea, 0x01, 0x74, 0xeb, 0xcd,
+    0xbb, 0x4f, 0xf5, 0x9d, 0xae, 0x75, 0x4f, 0x72, 0x39, 0x46, 0xf1,
+    0xb9, 0x0a, 0x77, 0xfd, 0x95, 0x23, 0x69, 0x0b, 0x7b },
+  { 0xfb, 0x31, 0xe6, 0xdd, 0xb8, 0x6d, 0xbf, 0xf3, 0x72, 0x64, 0x6d,
+    0x1e, 0x3a, 0x3f, 0x31, 0xdd, 0x61, 0x15, 0x9f, 0xc3, 0x93, 0x65,
+    0x8c, 0x2e, 0xe9, 0x57, 0x10, 0x3b, 0xf2, 0x11, 0x6b, 0xde, 0xf8,
+    0x2c, 0x33, 0xe8, 0x69, 0xf3, 0xc8, 0x3a, 0xc3, 0xc2, 0xf6, 0x38,
+    0x0c, 0xf6, 0x92, 0xf7, 0xb1, 0xdc, 0xba, 0xe0, 0xbb, 0x22, 0x7a,
+    0xd3, 0x47, 0xe7, 0x54, 0x13, 0x74, 0x66, 0xc6, 0x9f },
+  { 0x00, 0x60, 0x62, 0xab, 0xe1, 0x6c, 0x2f, 0xe7, 0x9a, 0xf8, 0x80,
+    0x85, 0xe0, 0xb5, 0x82, 0xb1, 0x06, 0xe7, 0xf7, 0x9f, 0x01, 0xa4,
+    0x39, 0x46, 0xc7, 0x8b, 0x19, 0xf9, 0xbd, 0xd7, 0x25, 0x99, 0x76,
+    0x36, 0xa3, 0x32, 0xeb, 0x9a, 0x3a, 0xaa, 0x6d, 0xe0, 0xd4, 0xa8,
+    0xe9, 0xe2, 0x8e, 0x8c, 0x77, 0x87, 0x74, 0x22, 0x4c, 0x66, 0x5b,
+    0xf7, 0xbc, 0x36, 0x44, 0xfc, 0xe4, 0x11, 0x22, 0x8c },
+  { 0xd4, 0x4a, 0x6d, 0xb3, 0xde, 0x9f, 0xd4, 0xe4, 0xa7, 0xef, 0x15,
+    0x5a, 0x01, 0xbc, 0xcb, 0x91, 0xc1, 0xbc, 0xf1, 0xcb, 0x53, 0x22,
+    0x56, 0x89, 0xa7, 0x7a, 0x0d, 0x23, 0xb4, 0xd3, 0x9a, 0x89, 0xa1,
+    0x89, 0xf2, 0x89, 0x80, 0xf9, 0x1c, 0x56, 0xea, 0xc5, 0x87, 0x9e,
+    0xae, 0x93, 0x3c, 0xed, 0x7f, 0x26, 0x7e, 0x2f, 0x70, 0x40, 0xeb,
+    0x38, 0x0f, 0xdb, 0xbf, 0x34, 0xa6, 0xb7, 0xb6, 0x15 },
+  { 0x5a, 0xfb, 0xfe, 0xa1, 0xde, 0xda, 0x5a, 0xea, 0xb9, 0x2e, 0x4d,
+    0x0c, 0x31, 0xd1, 0x6a, 0x9a, 0x86, 0xbf, 0x7c, 0x75, 0x23, 0x27,
+    0x4a, 0x05, 0xc5, 0x05, 0x29, 0xf5, 0xc1, 0x39, 0xdb, 0x10, 0x93,
+    0x3a, 0x52, 0xc6, 0x22, 0x9c, 0xd3, 0x11, 0x08, 0xf0, 0x83, 0xfb,
+    0x0c, 0x85, 0xcf, 0x52, 0x83, 0x1b, 0x5a, 0x05, 0xf2, 0x55, 0x0a,
+    0x77, 0xb5, 0x70, 0x3c, 0xc6, 0x68, 0x91, 0x2d, 0xbc },
+  { 0xd1, 0x7f, 0xca, 0xd4, 0xe0, 0xd8, 0xbd, 0xe2, 0xed, 0xfd, 0xa1,
+    0x68, 0xba, 0x47, 0x10, 0x4b, 0xbc, 0xa4, 0xd2, 0x6d, 0xa2, 0xd3,
+    0x1a, 0x07, 0x0b, 0x0f, 0xba, 0x0b, 0x26, 0xee, 0xdd, 0x95, 0xee,
+    0xc1, 0xfc, 0x34, 0xd7, 0x6c, 0xd4, 0xa1, 0xcb, 0x15, 0xf2, 0x62,
+    0x16, 0x88, 0xa9, 0xcc, 0x0e, 0x96, 0x35, 0x8d, 0xe9, 0x93, 0x22,
+    0x2b, 0xb3, 0xe3, 0xcd, 0x0b, 0xfd, 0xcb, 0x74, 0x6c },
+  { 0xbd, 0x6a, 0x59, 0x21, 0x63, 0x37, 0xb4, 0x5d, 0x6b, 0x71, 0xae,
+    0xac, 0x01, 0x36, 0x6b, 0xfe, 0x96, 0x60, 0xe0, 0xfb, 0xc2, 0x95,
+    0x9a, 0xdb, 0xb6, 0x8d, 0x52, 0x6c, 0x43, 0xd4, 0x8f, 0xff, 0xfe,
+    0x2f, 0xfc, 0x43, 0x05, 0x88, 0xe7, 0x8e, 0x66, 0x54, 0x6a, 0x3c,
+    0x70, 0x9b, 0x0a, 0xce, 0xa1, 0x7c, 0xbc, 0x5a, 0x21, 0x8c, 0x53,
+    0xcd, 0x47, 0xaa, 0x48, 0x71, 0xc1, 0xdd, 0x98, 0x4a },
+  { 0x83, 0xea, 0x5a, 0xe1, 0x89, 0x11, 0x45, 0xc4, 0x1a, 0x7c, 0x6c,
+    0x87, 0xfe, 0x92, 0x24, 0x87, 0xf5, 0xd2, 0x82, 0x93, 0x35, 0x69,
+    0xb7, 0xae, 0x0e, 0x34, 0x56, 0x53, 0x38, 0x1e, 0xde, 0x6d, 0x4b,
+    0x16, 0xe1, 0x44, 0xd1, 0xc3, 0xe8, 0xf0, 0x60, 0x5d, 0xaa, 0x0d,
+    0xb5, 0x96, 0x5a, 0x7b, 0x79, 0xd9, 0x1a, 0x8a, 0xfe, 0x11, 0xf1,
+    0xe0, 0xbc, 0x54, 0x9a, 0xc0, 0x74, 0xa0, 0x1a, 0xb7 },
+  { 0x37, 0x50, 0x50, 0xcf, 0x2e, 0x43, 0x0d, 0x0e, 0x29, 0x87, 0x58,
+    0x35, 0x20, 0x8e, 0x89, 0x06, 0xd7, 0x05, 0x2e, 0x47, 0x29, 0x2c,
+    0x5a, 0x38, 0xa6, 0x30, 0x82, 0x87, 0x3d, 0x31, 0xd5, 0x83, 0x13,
+    0x5c, 0x07, 0xa2, 0x0c, 0x52, 0xd9, 0x5b, 0x2d, 0x5d, 0xc3, 0xea,
+    0xde, 0x6b, 0xe1, 0x43, 0xca, 0x34, 0x38, 0xf4, 0x4d, 0x02, 0x0a,
+    0xae, 0x16, 0x0e, 0xd7, 0x7a, 0xb9, 0x88, 0x4f, 0x7d },
+  { 0x30, 0x28, 0xb0, 0xe8, 0x24, 0x95, 0x7f, 0xf3, 0xb3, 0x05, 0xe9,
+    0x7f, 0xf5, 0x92, 0xaa, 0x8e, 0xf2, 0x9b, 0x3b, 0xec, 0x1d, 0xc4,
+    0x7b, 0x76, 0x13, 0x3d, 0x10, 0x3f, 0xfe, 0x38, 0x71, 0xbf, 0x05,
+    0x12, 0xa2, 0x31, 0xaf, 0xcb, 0x1d, 0xf8, 0x65, 0x97, 0xec, 0x5e,
+    0x46, 0xe9, 0x23, 0xc8, 0xb9, 0x85, 0xc2, 0x85, 0x08, 0x57, 0xc6,
+    0x40, 0x01, 0xb2, 0xc5, 0x51, 0xea, 0x83, 0x3d, 0x0e },
+  { 0x08, 0x7c, 0xcb, 0x1e, 0x5b, 0xd1, 0x72, 0x22, 0xb8, 0xaf, 0x20,
+    0x6d, 0xd6, 0x39, 0x08, 0xf8, 0x91, 0x72, 0x97, 0x62, 0x1a, 0x8c,
+    0xb9, 0x33, 0x0a, 0xe0, 0xba, 0x4a, 0xf3, 0xe9, 0xd6, 0x0c, 0x98,
+    0xfc, 0xf1, 0xef, 0xfc, 0xec, 0x20, 0x13, 0x6b, 0x4f, 0x91, 0x88,
+    0x12, 0x6d, 0xfa, 0x04, 0x4e, 0x1c, 0x1c, 0xcd, 0xa3, 0xce, 0xd8,
+    0x73, 0x73, 0xd9, 0x37, 0x9c, 0xcb, 0xed, 0xbd, 0xb3 },
+  { 0x7f, 0x17, 0x06, 0x24, 0x98, 0xbf, 0xa2, 0xbb, 0x58, 0x56, 0xcd,
+    0x0a, 0x62, 0xc5, 0x68, 0xc5, 0xc6, 0xb8, 0x97, 0x43, 0x24, 0x74,
+    0xef, 0xb2, 0xe6, 0xa2, 0xee, 0x18, 0xca, 0xff, 0xd2, 0x1e, 0x1e,
+    0xf3, 0x0d, 0x06, 0x47, 0x23, 0x85, 0x0f, 0x79, 0x90, 0xd2, 0x1b,
+    0xa3, 0x4e, 0x8f, 0x2b, 0x3b, 0xb0, 0x67, 0x02, 0x3a, 0x77, 0x27,
+    0x82, 0x15, 0x8a, 0x27, 0xc6, 0xc4, 0x67, 0xc9, 0x28 },
+  { 0x6b, 0xa9, 0x86, 0xa9, 0x42, 0x49, 0x7f, 0xd3, 0x84, 0x62, 0x97,
+    0x2f, 0x50, 0xa6, 0x19, 0x68, 0xc0, 0x65, 0x2d, 0xac, 0x56, 0xce,
+    0x9b, 0x9a, 0xc1, 0xbc, 0x06, 0x1a, 0xb6, 0x34, 0xfe, 0x5a, 0x77,
+    0xac, 0xd0, 0x27, 0x5f, 0x83, 0x96, 0xe3, 0xc0, 0xbe, 0xf0, 0x12,
+    0xae, 0x93, 0xb7, 0x27, 0x58, 0xb8, 0xd7, 0x67, 0x9c, 0x87, 0xe8,
+    0x47, 0xe6, 0x30, 0x17, 0xb5, 0x5a, 0x69, 0xc5, 0xc6 },
+  { 0x96, 0x7c, 0x81, 0xf5, 0x61, 0x95, 0x18, 0x33, 0xfa, 0x56, 0x6f,
+    0x6b, 0x36, 0x07, 0x7e, 0xad, 0xb2, 0xa6, 0x15, 0xcc, 0x15, 0xf0,
+    0xed, 0xbb, 0xae, 0x4f, 0x84, 0x4d, 0xdc, 0x8e, 0x9c, 0x1f, 0xb8,
+    0x3d, 0x31, 0xa9, 0x3f, 0xcb, 0x17, 0x74, 0xd7, 0x40, 0xd6, 0x92,
+    0x08, 0xca, 0x59, 0x30, 0xbc, 0xfa, 0xc4, 0xa1, 0xf9, 0x44, 0x46,
+    0x9f, 0xef, 0xd1, 0x9b, 0x6e, 0x93, 0x75, 0xe0, 0xb5 },
+  { 0xe8, 0xae, 0xf1, 0x78, 0xe6, 0xda, 0x3e, 0xf5, 0xca, 0xed, 0x65,
+    0x30, 0xf7, 0xeb, 0x25, 0x60, 0x82, 0x56, 0xc2, 0x37, 0x7c, 0x4c,
+    0xf9, 0x6b, 0x0c, 0xfd, 0x0d, 0x76, 0xee, 0xb4, 0xbb, 0x86, 0xee,
+    0xff, 0x7b, 0x7d, 0xf1, 0x58, 0x5c, 0x8d, 0x7a, 0x20, 0xc0, 0x63,
+    0x3a, 0x67, 0x90, 0x7f, 0x6d, 0x28, 0x67, 0xc3, 0x26, 0x4a, 0x91,
+    0xc0, 0x51, 0xab, 0xae, 0x6e, 0xea, 0x5a, 0x91, 0xd8 },
+  { 0x64, 0x81, 0xdc, 0xc8, 0x15, 0x7a, 0xe6, 0x28, 0xb5, 0xcd, 0x52,
+    0x6b, 0xac, 0x8f, 0x93, 0x31, 0x56, 0xde, 0xda, 0xc9, 0x56, 0xa2,
+    0xb2, 0x2a, 0x97, 0x4b, 0xf5, 0xf7, 0xec, 0x2d, 0xb5, 0x80, 0x6f,
+    0x53, 0xdd, 0x0e, 0x2d, 0xd5, 0x3d, 0xb8, 0x7c, 0xd8, 0xf5, 0x8a,
+    0x58, 0x6f, 0x9b, 0x3c, 0x5c, 0x52, 0x23, 0x31, 0xa3, 0x11, 0x74,
+    0xc4, 0xe7, 0xb9, 0xb6, 0xf7, 0xf0, 0x57, 0xc2, 0x8f },
+  { 0xa7, 0x1e, 0xa4, 0x5c, 0xe6, 0x61, 0x6a, 0x3d, 0x2f, 0x0a, 0x59,
+    0x2d, 0x5d, 0x02, 0x86, 0x93, 0x2d, 0xa6, 0x3c, 0x6d, 0xb1, 0x1d,
+    0x59, 0xc6, 0x69, 0x1c, 0x35, 0xa5, 0x6f, 0x7e, 0xe4, 0xf8, 0x0b,
+    0x6f, 0xc3, 0x40, 0xb4, 0xdb, 0xc1, 0x84, 0x4c, 0x50, 0x40, 0xe6,
+    0x68, 0xd2, 0x89, 0x2f, 0x4a, 0x4a, 0xe8, 0x53, 0x3f, 0x1b, 0x67,
+    0x71, 0xbc, 0xfc, 0xe7, 0xc3, 0xa2, 0x3e, 0x0d, 0x97 },
+  { 0x96, 0x93, 0x44, 0x87, 0x70, 0xfe, 0xae, 0x42, 0x17, 0x26, 0xeb,
+    0x20, 0x3b, 0x01, 0xc7, 0x08, 0x23, 0xd5, 0xf4, 0x4c, 0xc5, 0x21,
+    0x3e, 0x6a, 0x68, 0x28, 0x47, 0x29, 0xbd, 0x11, 0x7d, 0x9b, 0xd1,
+    0x8f, 0xec, 0x4a, 0x0a, 0x82, 0x4a, 0x24, 0x08, 0x0f, 0x29, 0x8b,
+    0xac, 0xd2, 0x96, 0xd7, 0xb4, 0x97, 0x83, 0x8f, 0xbd, 0x7b, 0x0d,
+    0x57, 0x5c, 0x52, 0x49, 0x2b, 0x3e, 0x6f, 0x92, 0x6b },
+  { 0x37, 0xa1, 0x50, 0x66, 0xf2, 0xb9, 0xf9, 0x4c, 0x24, 0x61, 0x1b,
+    0xc4, 0x53, 0xed, 0x02, 0x74, 0x07, 0x8d, 0x1f, 0x70, 0xb2, 0xd3,
+    0x4c, 0x8b, 0x96, 0x36, 0x08, 0x48, 0x9d, 0xcb, 0xe8, 0xdf, 0x44,
+    0x8e, 0xdd, 0x9c, 0x73, 0x36, 0x2b, 0xb2, 0xb6, 0x6b, 0xee, 0xf6,
+    0x1f, 0xce, 0x60, 0x10, 0x6f, 0x70, 0x19, 0xed, 0x37, 0x3c, 0x69,
+    0x22, 0x59, 0xd9, 0x55, 0x6a, 0x94, 0x0b, 0x1a, 0x06 },
+  { 0xbd, 0x44, 0xe7, 0x39, 0xe1, 0xf9, 0xdb, 0x1c, 0x6b, 0xaf, 0x42,
+    0xca, 0x4a, 0x12, 0xac, 0x09, 0x9b, 0x96, 0xf6, 0xb3, 0x6c, 0x4b,
+    0xcb, 0x1b, 0x72, 0xee, 0xff, 0x08, 0xa6, 0x49, 0x68, 0x35, 0xec,
+    0x65, 0x15, 0x0b, 0xe8, 0xfe, 0x16, 0xcb, 0xe3, 0x27, 0x07, 0xe3,
+    0x47, 0x54, 0x7d, 0xc5, 0xa5, 0x83, 0xd2, 0x65, 0x74, 0x6f, 0xa5,
+    0x95, 0xc5, 0xe7, 0x73, 0x0f, 0xcf, 0x24, 0x58, 0x1e },
+  { 0xfa, 0xb2, 0x03, 0x8e, 0x94, 0x98, 0xa1, 0xc3, 0x9e, 0x05, 0x78,
+    0xa0, 0xa5, 0xea, 0x6b, 0x44, 0xf3, 0xc1, 0xb4, 0x1a, 0xe5, 0x67,
+    0xf9, 0x91, 0x4a, 0x95, 0xb1, 0x31, 0xc4, 0x8d, 0x12, 0x1e, 0xca,
+    0xce, 0xa8, 0x95, 0xa0, 0x9b, 0x1d, 0x4e, 0x04, 0x42, 0xbe, 0xc9,
+    0xc5, 0x0c, 0x50, 0xe0, 0x0a, 0x9f, 0xaf, 0xef, 0xfa, 0xe0, 0x70,
+    0x88, 0x4c, 0x26, 0x25, 0xa8, 0xb1, 0xa2, 0x17, 0x26 },
+  { 0x05, 0xa1, 0xb7, 0x6b, 0x2f, 0xd5, 0x62, 0x11, 0xe0, 0xf2, 0xd7,
+    0x5a, 0x25, 0x16, 0x54, 0xa7, 0x72, 0xf5, 0x5e, 0x18, 0xca, 0x02,
+    0x2a, 0xf5, 0x2c, 0xb3, 0x30, 0x19, 0x1e, 0x98, 0xa3, 0xb8, 0xeb,
+    0x87, 0xe5, 0x11, 0x7b, 0xae, 0x58, 0x04, 0x4d, 0x94, 0x4c, 0x1f,
+    0x18, 0x85, 0x45, 0x12, 0x25, 0x41, 0x77, 0x35, 0xfc, 0x72, 0xf7,
+    0x39, 0x36, 0x69, 0x3c, 0xff, 0x45, 0x46, 0x9f, 0x8c },
+  { 0x2a, 0x30, 0xc9, 0x6b, 0xda, 0xc7, 0x8a, 0x39, 0x94, 0xee, 0xca,
+    0xa5, 0xa5, 0x3f, 0x82, 0x7f, 0x58, 0xe1, 0x32, 0x31, 0xa0, 0xd1,
+    0x13, 0x08, 0x6c, 0x06, 0xb1, 0xbd, 0xab, 0xda, 0x38, 0xd0, 0x8f,
+    0x1a, 0xe2, 0x7d, 0xe2, 0x5f, 0xd2, 0x2e, 0xea, 0x70, 0xc0, 0x5f,
+    0x01, 0x32, 0xbf, 0x7a, 0x50, 0x1c, 0x82, 0xae, 0x62, 0x15, 0xbf,
+    0xef, 0x3c, 0x01, 0x63, 0x98, 0xba, 0xf2, 0xcb, 0x62 },
+  { 0x48, 0xdb, 0x53, 0x76, 0x5b, 0x82, 0xbd, 0x6f, 0x25, 0x33, 0xea,
+    0xe1, 0x7f, 0x67, 0x69, 0xd7, 0xa4, 0xe3, 0xb2, 0x43, 0x74, 0x60,
+    0x1c, 0xdd, 0x8e, 0xc0, 0xca, 0x3a, 0xab, 0x30, 0x93, 0xfd, 0x2b,
+    0x99, 0x24, 0x38, 0x46, 0x0b, 0xaf, 0x8d, 0xa5, 0x8f, 0xb9, 0xa8,
+    0x9b, 0x2c, 0x58, 0xf9, 0x68, 0xe6, 0x36, 0x17, 0xcb, 0xeb, 0x18,
+    0x44, 0xb0, 0x2d, 0x6a, 0x27, 0xc5, 0xb4, 0xad, 0x41 },
+  { 0x5c, 0x8b, 0x2e, 0x0e, 0x1b, 0x5c, 0x8f, 0x45, 0x7d, 0x7f, 0x7b,
+    0xd9, 0xf0, 0x5a, 0x97, 0xe5, 0x8d, 0xda, 0x1d, 0x28, 0xdb, 0x9f,
+    0x34, 0xd1, 0xce, 0x73, 0x25, 0x28, 0xf9, 0x68, 0xbe, 0xdd, 0x9e,
+    0x1c, 0xc9, 0x35, 0x2d, 0x0a, 0x5d, 0xf6, 0x67, 0x29, 0x28, 0xbd,
+    0xd3, 0xea, 0x6f, 0x5c, 0xb0, 0x60, 0x77, 0xcf, 0x3a, 0xd3, 0xa7,
+    0x6e, 0x29, 0xb2, 0x2e, 0x82, 0xba, 0xc6, 0x7b, 0x61 },
+  { 0x5b, 0x73, 0x91, 0xaa, 0x52, 0xf2, 0x76, 0xfa, 0xb9, 0xc1, 0x38,
+    0x77, 0xf1, 0x22, 0x32, 0x70, 0x84, 0x97, 0xfc, 0x02, 0x8f, 0xaa,
+    0x17, 0x32, 0xa5, 0xdb, 0x07, 0x9e, 0x7f, 0xe0, 0x73, 0xed, 0x0c,
+    0xc9, 0x52, 0x9c, 0xfc, 0x86, 0x3a, 0x4e, 0xcb, 0xa4, 0xdc, 0x2f,
+    0x1e, 0xa9, 0xf6, 0xbd, 0x69, 0x04, 0xf3, 0xa0, 0xc1, 0x07, 0x19,
+    0x3c, 0x5e, 0x71, 0x1c, 0xb9, 0x11, 0xf3, 0x80, 0x25 },
+  { 0x1d, 0x5a, 0xf7, 0x0f, 0x09, 0xa5, 0xfc, 0x69, 0x16, 0xef, 0x59,
+    0xa3, 0x8a, 0x86, 0x92, 0x6d, 0xca, 0xae, 0x39, 0xa8, 0x95, 0x4d,
+    0x73, 0xfc, 0x80, 0xa3, 0x50, 0x75, 0x1a, 0xdd, 0xa3, 0x8c, 0x9d,
+    0x59, 0x75, 0x06, 0xdc, 0x05, 0xe1, 0xed, 0x37, 0xbd, 0x2d, 0xb1,
+    0x59, 0x0f, 0x99, 0xaa, 0x29, 0x6a, 0xea, 0x13, 0xab, 0x84, 0x43,
+    0xd5, 0xa9, 0x23, 0x47, 0xfb, 0x85, 0xfc, 0x81, 0x6d },
+  { 0x80, 0xe3, 0x70, 0x92, 0x97, 0xd4, 0x41, 0x14, 0xb9, 0xfb, 0xdf,
+    0x55, 0x67, 0xf0, 0x5f, 0x33, 0x00, 0x94, 0xcf, 0x09, 0xf4, 0xc0,
+    0xef, 0xcf, 0xac, 0x05, 0x09, 0x5c, 0x36, 0x08, 0x10, 0x77, 0x30,
+    0xc1, 0xaa, 0x07, 0xff, 0x23, 0x00, 0x25, 0x62, 0xc7, 0xe8, 0x41,
+    0xa9, 0xf5, 0x66, 0x24, 0xff, 0xe2, 0xab, 0xec, 0x61, 0x1e, 0xb9,
+    0xe7, 0x3e, 0x1c, 0xcb, 0xd8, 0xf6, 0x2b, 0x11, 0x49 },
+  { 0xf9, 0x94, 0x5c, 0x19, 0x06, 0x77, 0x84, 0x61, 0x94, 0x13, 0x2b,
+    0x49, 0x6e, 0xc6, 0x01, 0x2c, 0x08, 0x75, 0x0e, 0x02, 0x5f, 0xd5,
+    0x52, 0xed, 0x32, 0x4d, 0x3a, 0x49, 0xd8, 0x63, 0x66, 0xc0, 0x3d,
+    0xcc, 0xde, 0x8d, 0x5b, 0x5a, 0xc9, 0xa4, 0xbc, 0xb7, 0x19, 0x5e,
+    0x63, 0xbc, 0xaa, 0x93, 0x9e, 0x8e, 0xda, 0x18, 0xf1, 0x16, 0x94,
+    0xb6, 0xfa, 0x69, 0x37, 0x39, 0x3b, 0xff, 0xdb, 0xf4 },
+  { 0x8d, 0x8f, 0x2e, 0xd9, 0xae, 0x39, 0x80, 0x9a, 0xac, 0xad, 0x2f,
+    0xce, 0xdb, 0xd2, 0xdc, 0xa7, 0x30, 0xc7, 0x83, 0xe6, 0x2f, 0xf7,
+    0x0b, 0x8d, 0x3c, 0x53, 0x62, 0xf0, 0x73, 0xf8, 0x34, 0x67, 0x19,
+    0x7d, 0x37, 0x56, 0xb4, 0x45, 0x19, 0x5f, 0xe7, 0x52, 0x11, 0x73,
+    0x64, 0xd9, 0x2c, 0xf4, 0x2c, 0x02, 0x6e, 0x40, 0x9d, 0x5f, 0xf7,
+    0xa9, 0x53, 0x3e, 0xab, 0x78, 0xf1, 0x75, 0x4a, 0x2d },
+  { 0x3a, 0xc9, 0x9a, 0xc5, 0x3a, 0xc4, 0x9a, 0x56, 0xfa, 0xa1, 0x86,
+    0x46, 0xb8, 0xe0, 0x8a, 0x2d, 0x35, 0xbe, 0x80, 0xdf, 0x3e, 0xfb,
+    0xbb, 0xa6, 0xbd, 0xa4, 0xae, 0x90, 0x2b, 0x8d, 0x3e, 0x17, 0x0a,
+    0x7b, 0xe8, 0x60, 0x5c, 0x34, 0xa4, 0xdc, 0x9a, 0x73, 0x62, 0xb1,
+    0xc2, 0x01, 0xd7, 0x02, 0x39, 0x1b, 0xd7, 0xd5, 0x20, 0x7f, 0x95,
+    0xfa, 0x39, 0x0c, 0xe3, 0x3c, 0x43, 0x14, 0xd4, 0x11 },
+  { 0xe4, 0x69, 0x4b, 0xdb, 0x31, 0x01, 0x6f, 0x25, 0x53, 0x2c, 0x04,
+    0x3c, 0x5c, 0x63, 0x08, 0xcc, 0x61, 0x9b, 0x0f, 0x87, 0x16, 0xf0,
+    0xc2, 0x9e, 0xeb, 0x9f, 0x34, 0x0f, 0x47, 0xb0, 0x7b, 0x4a, 0x4c,
+    0xe0, 0x98, 0x4c, 0x47, 0x24, 0xb1, 0x2a, 0xb3, 0xd3, 0x2a, 0xf5,
+    0x16, 0xad, 0xa2, 0x64, 0x4c, 0xa6, 0x55, 0x8c, 0x1c, 0xb5, 0x81,
+    0x5c, 0x12, 0x12, 0xa9, 0xb5, 0xfa, 0x83, 0x44, 0x12 },
+  { 0xc6, 0x3c, 0x70, 0x3e, 0x62, 0x10, 0x8a, 0xa0, 0xed, 0xc6, 0x83,
+    0xf3, 0x67, 0x8a, 0x00, 0x78, 0x8f, 0xb1, 0x00, 0xc0, 0x96, 0x0b,
+    0x4e, 0x98, 0xb7, 0x6a, 0x48, 0xe4, 0xe5, 0x92, 0x3d, 0x34, 0x13,
+    0x44, 0x8d, 0xb8, 0x87, 0x5e, 0x3b, 0xce, 0xa7, 0xb6, 0xb8, 0x5d,
+    0x9e, 0x3e, 0xea, 0xb7, 0x2c, 0xd1, 0x50, 0x96, 0xfb, 0xbb, 0x2c,
+    0xc4, 0x27, 0x03, 0x17, 0xfc, 0x34, 0xd4, 0x04, 0x71 },
+  { 0x90, 0x80, 0xb7, 0xe8, 0x41, 0xef, 0x51, 0x9c, 0x54, 0x17, 0xe6,
+    0x90, 0xaa, 0xf4, 0x32, 0x79, 0x07, 0xa8, 0x3d, 0xbc, 0xb7, 0x38,
+    0xd0, 0xf7, 0x30, 0x8b, 0x1d, 0x61, 0x1d, 0xef, 0x16, 0x9a, 0x4f,
+    0x47, 0x42, 0x3e, 0x69, 0x0f, 0x27, 0xa7, 0xe2, 0x74, 0x1a, 0xe7,
+    0x86, 0x5d, 0xa2, 0x3c, 0x5d, 0x3f, 0x13, 0xc3, 0x16, 0x06, 0x3c,
+    0x7a, 0xa1, 0xa9, 0x58, 0xe5, 0xbe, 0x83, 0x8f, 0x04 },
+  { 0x29, 0x8d, 0xf6, 0x46, 0x91, 0x5f, 0x04, 0xd6, 0x65, 0xe9, 0x67,
+    0x5e, 0x6a, 0x10, 0x31, 0x87, 0x0d, 0x28, 0xeb, 0x7a, 0x04, 0x05,
+    0x66, 0x3e, 0xac, 0x3b, 0x10, 0xd1, 0xb4, 0xfa, 0x2e, 0x86, 0x8e,
+    0x63, 0x73, 0xa5, 0x86, 0xcd, 0x73, 0xe0, 0x6d, 0x8e, 0x7a, 0xd7,
+    0x71, 0xb4, 0xfb, 0x0a, 0x8b, 0x4f, 0xc2, 0xdc, 0x6c, 0xe0, 0x9c,
+    0x64, 0x2e, 0xe8, 0x99, 0x26, 0xfd, 0xc6, 0x52, 0x60 },
+  { 0x4f, 0x2d, 0xe9, 0xc4, 0xf4, 0x34, 0x8b, 0xdb, 0x32, 0x3a, 0x66,
+    0x83, 0x72, 0xe7, 0x71, 0x42, 0x99, 0xc7, 0x76, 0xf9, 0x60, 0x2f,
+    0x3a, 0xf8, 0xfb, 0x77, 0x46, 0xf1, 0x76, 0x86, 0x8d, 0xf3, 0x54,
+    0x2b, 0x2f, 0xa6, 0x9e, 0xae, 0x38, 0xb6, 0xa2, 0x6a, 0x06, 0xca,
+    0x89, 0x42, 0xf8, 0x82, 0x78, 0xc6, 0x4e, 0x3d, 0x01, 0x7f, 0xee,
+    0x67, 0xa9, 0x4e, 0xa0, 0x23, 0xb2, 0xb5, 0xbe, 0x5f },
+  { 0x40, 0x18, 0xc5, 0xee, 0x90, 0x93, 0xa6, 0x81, 0x11, 0x2f, 0x4c,
+    0xe1, 0x93, 0xa1, 0xd6, 0x5e, 0x05, 0x48, 0x72, 0x5f, 0x96, 0xae,
+    0x31, 0x53, 0x87, 0xcd, 0x76, 0x5c, 0x2b, 0x9c, 0x30, 0x68, 0xae,
+    0x4c, 0xbe, 0x5c, 0xd5, 0x40, 0x2c, 0x11, 0xc5, 0x5a, 0x9d, 0x78,
+    0x5f, 0xfd, 0xfc, 0x2b, 0xde, 0x6e, 0x7a, 0xcf, 0x19, 0x61, 0x74,
+    0x75, 0xda, 0xe0, 0xeb, 0x01, 0x44, 0x56, 0xce, 0x45 },
+  { 0x6f, 0xce, 0x66, 0x75, 0xe8, 0x6d, 0x7e, 0x85, 0x70, 0x4c, 0x96,
+    0xc2, 0x95, 0x70, 0x3c, 0xd9, 0x54, 0x98, 0x59, 0x0e, 0x50, 0x76,
+    0x4d, 0x23, 0xd7, 0xa7, 0xa3, 0xa3, 0x22, 0x68, 0xa0, 0xb3, 0xc9,
+    0x91, 0xe8, 0xf7, 0x84, 0x87, 0x69, 0x9a, 0x55, 0x4b, 0x58, 0x1e,
+    0x33, 0x9c, 0x09, 0xae, 0xc9, 0x82, 0xe0, 0xba, 0xa4, 0x31, 0x87,
+    0x93, 0x62, 0x06, 0x35, 0xe1, 0xe2, 0xc8, 0xd9, 0xf2 },
+  { 0xeb, 0xa9, 0x37, 0x85, 0x91, 0x97, 0xc7, 0xfd, 0x41, 0x2d, 0xbc,
+    0x9a, 0xfc, 0x0d, 0x67, 0xcc, 0x19, 0x81, 0x60, 0xb5, 0xa9, 0xcc,
+    0xee, 0x87, 0xc4, 0x1a, 0x86, 0x64, 0x85, 0x9f, 0x3e, 0xfd, 0x96,
+    0x13, 0x66, 0xa8, 0x09, 0xc7, 0xc6, 0xbc, 0x6f, 0xa8, 0x44, 0x92,
+    0x68, 0x14, 0xe0, 0xb4, 0xef, 0xa3, 0x7e, 0xde, 0x2c, 0x88, 0x44,
+    0x26, 0x8d, 0x7f, 0x35, 0x56, 0xe4, 0x46, 0x58, 0x1d },
+  { 0x83, 0xf4, 0x33, 0xe4, 0xf1, 0xc5, 0x07, 0x97, 0x49, 0x3c, 0x58,
+    0xc2, 0x64, 0xcf, 0xfa, 0x70, 0xc4, 0xa7, 0xa2, 0x4c, 0x33, 0x4d,
+    0xba, 0xa3, 0xc5, 0x74, 0x89, 0xd9, 0x70, 0xd4, 0x9d, 0x69, 0x49,
+    0xfe, 0x45, 0xb7, 0x04, 0xf2, 0x65, 0xef, 0xd2, 0xae, 0xe1, 0xac,
+    0x1b, 0x46, 0xf4, 0xaa, 0x3e, 0x4f, 0xad, 0x68, 0xb3, 0x79, 0x61,
+    0xd2, 0xc7, 0x28, 0x0a, 0xe1, 0x96, 0x72, 0xc8, 0x50 },
+  { 0xb5, 0x57, 0xec, 0xe1, 0x22, 0x72, 0x49, 0x3d, 0xc2, 0x7e, 0x88,
+    0xa0, 0x5a, 0xdc, 0xd8, 0x61, 0x87, 0x5a, 0x0c, 0xd0, 0x0b, 0xd6,
+    0x8a, 0xdc, 0x3a, 0x30, 0x1d, 0x26, 0x3a, 0x9c, 0xd9, 0x93, 0xa9,
+    0x6a, 0xe1, 0x4c, 0xfc, 0xdd, 0xcb, 0x99, 0x7c, 0xc9, 0x86, 0x23,
+    0x93, 0x50, 0x50, 0xea, 0x43, 0x55, 0x2a, 0x34, 0x11, 0x07, 0x18,
+    0x7d, 0xe7, 0x5c, 0x4e, 0xde, 0xd7, 0xc7, 0x86, 0xbd },
+  { 0x95, 0x89, 0xc0, 0x81, 0x3b, 0x73, 0x93, 0xdb, 0xaa, 0xaf, 0xe4,
+    0x7a, 0xf5, 0xb4, 0x08, 0xb2, 0x3c, 0x8a, 0x8c, 0x8b, 0xac, 0x62,
+    0x55, 0x4b, 0x8f, 0xa1, 0x32, 0xa3, 0x58, 0xce, 0x30, 0x83, 0xb1,
+    0xd4, 0xe3, 0x97, 0x07, 0xcd, 0x54, 0xa5, 0x5f, 0x67, 0x3d, 0x48,
+    0x11, 0x6e, 0xb1, 0xf9, 0xed, 0x8d, 0xe9, 0xc9, 0x43, 0xcd, 0x2d,
+    0xe4, 0x60, 0xa6, 0x8b, 0xdd, 0xf7, 0x1e, 0x98, 0x03 },
+  { 0xae, 0x4c, 0xcf, 0x27, 0xab, 0x00, 0xa4, 0x0c, 0x36, 0x37, 0xd3,
+    0xd2, 0xce, 0x51, 0xa8, 0x3e, 0xfb, 0xa6, 0x2d, 0x4a, 0x6f, 0xda,
+    0xd6, 0x95, 0x06, 0x3f, 0xbc, 0x60, 0xa2, 0xd8, 0x2e, 0xc5, 0xa5,
+    0x4a, 0xcb, 0xe0, 0x9b, 0xa9, 0x38, 0x8f, 0x49, 0xaa, 0xc2, 0x7c,
+    0x99, 0x2d, 0x84, 0x63, 0x20, 0x36, 0xe1, 0xbd, 0xd4, 0xc5, 0x29,
+    0xbb, 0xf1, 0x85, 0x1e, 0xae, 0x0c, 0x6e, 0xa9, 0x02 },
+  { 0xa3, 0x94, 0x4b, 0x2c, 0x31, 0xcb, 0x49, 0x40, 0x80, 0xb7, 0xee,
+    0x1d, 0xb0, 0x81, 0x68, 0x53, 0xe4, 0x25, 0xb5, 0x4c, 0x48, 0xd6,
+    0x31, 0x44, 0x7e, 0xa5, 0x2c, 0x1d, 0x29, 0x52, 0x07, 0x9b, 0xd8,
+    0x8f, 0xab, 0x9e, 0xd0, 0xb7, 0xd8, 0xc0, 0xba, 0xaf, 0x0c, 0x4e,
+    0xca, 0x19, 0x10, 0xdb, 0x6f, 0x98, 0x53, 0x4f, 0x0d, 0x42, 0xe5,
+    0xeb, 0xb6, 0xc0, 0xa7, 0x5e, 0xf0, 0xd8, 0xb2, 0xc0 },
+  { 0xcf, 0xa1, 0xa2, 0x24, 0x68, 0x5a, 0x5f, 0xb2, 0x01, 0x04, 0x58,
+    0x20, 0x1c, 0xeb, 0x0c, 0xda, 0x21, 0xc8, 0x2b, 0x16, 0x02, 0xdc,
+    0x41, 0x35, 0x85, 0xfb, 0xce, 0x80, 0x97, 0x6f, 0x06, 0x1c, 0x23,
+    0x5b, 0x13, 0x67, 0x71, 0x24, 0x98, 0x14, 0x4a, 0xc1, 0x6a, 0x98,
+    0x54, 0xf6, 0xfb, 0x32, 0x3c, 0xbe, 0xb6, 0x23, 0x69, 0xcf, 0x9b,
+    0x75, 0x2b, 0x92, 0x52, 0xa2, 0xa7, 0xac, 0xe1, 0xfd },
+  { 0xfa, 0x62, 0xc6, 0xcf, 0xc8, 0xf0, 0x79, 0xe5, 0x8f, 0x3d, 0x3f,
+    0xef, 0xd7, 0xc2, 0x24, 0xe7, 0x1e, 0xbc, 0x69, 0xa9, 0x5b, 0x18,
+    0x35, 0xcc, 0xc3, 0x2f, 0x35, 0x07, 0x77, 0x05, 0x11, 0x02, 0x61,
+    0x54, 0x92, 0xd6, 0x7f, 0xb6, 0xde, 0x62, 0xcf, 0x2a, 0xd5, 0xb1,
+    0x84, 0x67, 0xfe, 0x87, 0x15, 0x74, 0x88, 0x82, 0xdb, 0x89, 0xff,
+    0x86, 0xef, 0xdf, 0x2f, 0x96, 0xf8, 0x13, 0x5e, 0xd2 },
+  { 0xcc, 0x63, 0x3f, 0xd4, 0xea, 0x6a, 0xc4, 0x08, 0xc3, 0x87, 0x57,
+    0x56, 0xb9, 0x01, 0x28, 0x8a, 0x1d, 0xe1, 0x91, 0x89, 0x28, 0x32,
+    0xbe, 0x2e, 0x90, 0x26, 0xdc, 0x65, 0xc2, 0xff, 0x00, 0x00, 0x9f,
+    0x14, 0x36, 0xdd, 0xff, 0x42, 0x06, 0x26, 0x0a, 0x3d, 0x66, 0xef,
+    0x61, 0x92, 0x14, 0x3e, 0x57, 0x2f, 0x1e, 0x4b, 0xb8, 0xe5, 0xa7,
+    0x4b, 0x12, 0x05, 0x5e, 0x42, 0x41, 0x1c, 0x18, 0xbc },
+  { 0x44, 0xd2, 0xbf, 0x7f, 0x36, 0x96, 0xb8, 0x93, 0x3f, 0x25, 0x5b,
+    0x9b, 0xe1, 0xa4, 0xa6, 0xae, 0x33, 0x16, 0xc2, 0x5d, 0x03, 0x95,
+    0xf5, 0x90, 0xb9, 0xb9, 0x89, 0x8f, 0x12, 0x7e, 0x40, 0xd3, 0xf4,
+    0x12, 0x4d, 0x7b, 0xdb, 0xc8, 0x72, 0x5f, 0x00, 0xb0, 0xd2, 0x81,
+    0x50, 0xff, 0x05, 0xb4, 0xa7, 0x9e, 0x5e, 0x04, 0xe3, 0x4a, 0x47,
+    0xe9, 0x08, 0x7b, 0x3f, 0x79, 0xd4, 0x13, 0xab, 0x7f },
+  { 0x96, 0xfb, 0xcb, 0xb6, 0x0b, 0xd3, 0x13, 0xb8, 0x84, 0x50, 0x33,
+    0xe5, 0xbc, 0x05, 0x8a, 0x38, 0x02, 0x74, 0x38, 0x57, 0x2d, 0x7e,
+    0x79, 0x57, 0xf3, 0x68, 0x4f, 0x62, 0x68, 0xaa, 0xdd, 0x3a, 0xd0,
+    0x8d, 0x21, 0x76, 0x7e, 0xd6, 0x87, 0x86, 0x85, 0x33, 0x1b, 0xa9,
+    0x85, 0x71, 0x48, 0x7e, 0x12, 0x47, 0x0a, 0xad, 0x66, 0x93, 0x26,
+    0x71, 0x6e, 0x46, 0x66, 0x7f, 0x69, 0xf8, 0xd7, 0xe8 }
+};
+
+/* BLAKE2bp of the message built by blake2bp_do_long. */
+static const uint8_t blake2bp_long_digest[BLAKE2BP_DIGEST_SIZE] = {
+  0x18, 0x2e, 0x57, 0x76, 0x11, 0xe7, 0x9f, 0x33, 0xe2, 0xf9, 0xfa,
+  0x51, 0xc6, 0xd6, 0x69, 0xaf, 0x45, 0x18, 0x85, 0xec, 0x41, 0xa8,
+  0x23, 0x45, 0x5d, 0x29, 0x64, 0x12, 0xb2, 0xcd, 0x08, 0xca, 0x8b,
+  0xa2, 0xfa, 0xb9, 0x36, 0x99, 0x83, 0x15, 0x73, 0xaa, 0x15, 0x4b,
+  0x9d, 0xf6, 0x11, 0x78, 0xce, 0x4e, 0x2b, 0x02, 0x57, 0xfa, 0xc9,
+  0xe1, 0xbb, 0x69, 0xe6, 0xbc, 0x9d, 0x12, 0xa4, 0x4a
+};
+
+static void hexdump (const uint8_t *, size_t);
+static bool blake2bp_do_keyed_kat (void);
+static bool blake2bp_do_long (void);
+static bool blake2bp_do_parallel (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!blake2bp_do_keyed_kat ())
+    rv = 1;
+  if (!blake2bp_do_long ())
+    rv = 1;
+  if (!blake2bp_do_parallel ())
+    rv = 1;
+
+  return rv;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
+
+static bool
+blake2bp_do_keyed_kat (void)
+{
+  uint32_t i;
+  uint8_t key[BLAKE2BP_KEY_SIZE];
+  uint8_t data[256];
+  uint8_t digest[BLAKE2BP_DIGEST_SIZE];
+  const uint8_t *p;
+  bool retval;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = i;
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = i;
+
+  retval = true;
+  for (i = 0; i < 256; ++i)
+    {
+      blake2bp (digest, data, key, BLAKE2BP_DIGEST_SIZE, i,
+                BLAKE2BP_KEY_SIZE);
+      hexdump (digest, BLAKE2BP_DIGEST_SIZE);
+      p = blake2bp_keyed_kat[i];
+      if (memcmp (digest, p, BLAKE2BP_DIGEST_SIZE) != 0)
+        {
+          retval = false;
+          fprintf (stderr, "blake2bp_keyed_kat: Failed #%u\n", i);
+        }
+    }
+
+  return retval;
+}
+
+/*
+ * Hashes a long message in one call and in pieces of varying length, so that
+ * the pieces cross the stride of blocks dealt out to the leaves at every
+ * offset.
+ */
+static bool
+blake2bp_do_long (void)
+{
+  static uint8_t message[100000];
+  struct blake2bp_ctx ctx;
+  uint8_t digest[BLAKE2BP_DIGEST_SIZE];
+  size_t i, n;
+  bool retval;
+
+  for (i = 0; i < sizeof (message); ++i)
+    message[i] = (uint8_t)(i * 7 + (i >> 11));
+
+  retval = true;
+  blake2bp (digest, message, NULL, BLAKE2BP_DIGEST_SIZE, sizeof (message), 0);
+  hexdump (digest, BLAKE2BP_DIGEST_SIZE);
+  if (memcmp (digest, blake2bp_long_digest, BLAKE2BP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2bp_long: Failed one-shot\n");
+    }
+
+  blake2bp_init (&ctx, BLAKE2BP_DIGEST_SIZE);
+  for (i = 0, n = 1; i < sizeof (message); i += n, n = n * 7 % 2039)
+    {
+      if (n > sizeof (message) - i)
+        n = sizeof (message) - i;
+      blake2bp_update (&ctx, message + i, n);
+    }
+  blake2bp_final (digest, &ctx);
+  if (memcmp (digest, blake2bp_long_digest, BLAKE2BP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2bp_long: Failed incremental\n");
+    }
+
+  return retval;
+}
+
+/*
+ * Hashes a message long enough to be split across threads, in one call and
+ * in pieces of which some are below the threshold for threads.
+ */
+static bool
+blake2bp_do_parallel (void)
+{
+  static uint8_t message[3000000];
+  struct blake2bp_ctx ctx;
+  uint8_t expect[BLAKE2BP_DIGEST_SIZE];
+  uint8_t digest[BLAKE2BP_DIGEST_SIZE];
+  size_t i, n;
+  bool retval;
+
+  for (i = 0; i < sizeof (message); ++i)
+    message[i] = (uint8_t)(i * 13 + (i >> 9));
+
+  retval = true;
+  blake2bp (expect, message, NULL, BLAKE2BP_DIGEST_SIZE, sizeof (message), 0);
+  blake2bp_parallel (digest, message, NULL, BLAKE2BP_DIGEST_SIZE,
+                     sizeof (message), 0, 4);
+  if (memcmp (digest, expect, BLAKE2BP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2bp_parallel: Failed one-shot\n");
+    }
+
+  blake2bp_init (&ctx, BLAKE2BP_DIGEST_SIZE);
+  for (i = 0, n = 777; i < sizeof (message); i += n, n = n * 5 % 1048573)
+    {
+      if (n > sizeof (message) - i)
+        n = sizeof (message) - i;
+      blake2bp_update_parallel (&ctx, message + i, n, 3);
+    }
+  blake2bp_final (digest, &ctx);
+  if (memcmp (digest, expect, BLAKE2BP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2bp_parallel: Failed incremental\n");
+    }
+
+  return retval;
+}
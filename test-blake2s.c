@@ -1578,9 +1578,20 @@ static const uint8_t blake2s_keyed_kat[256][BLAKE2S_DIGEST_SIZE] = {
     0x5b, 0xad, 0x34, 0xbd, 0xe9, 0x99, 0xef, 0xd7, 0x24, 0xdd },
 };
 
+/*
+ * BLAKE2s of "abc" with a 20-byte digest, the key "kkkkk", the salt
+ * 0, 1, 2 ... and the personalization "fcrypt!!", computed with
+ * Python's hashlib.
+ */
+static const uint8_t blake2s_param_digest[20] = {
+  0x82, 0x60, 0x7b, 0x3f, 0xa9, 0x7b, 0x04, 0xca, 0x69, 0x3b, 0xaa,
+  0x30, 0x01, 0xa8, 0x05, 0x1b, 0xd4, 0xab, 0x96, 0xd6
+};
+
 static void hexdump (const uint8_t *, size_t);
 static bool blake2s_do_kat (void);
 static bool blake2s_do_keyed_kat (void);
+static bool blake2s_do_param (void);
 
 int
 main (void)
@@ -1592,6 +1603,8 @@ main (void)
     rv = 1;
   if (!blake2s_do_keyed_kat ())
     rv = 1;
+  if (!blake2s_do_param ())
+    rv = 1;
 
   return rv;
 }
@@ -1671,3 +1684,33 @@ blake2s_do_keyed_kat (void)
 
   return retval;
 }
+
+static bool
+blake2s_do_param (void)
+{
+  struct blake2s_param param;
+  struct blake2s_ctx ctx;
+  uint8_t digest[20];
+  size_t i;
+
+  memset (&param, 0, sizeof (param));
+  param.digestlen = sizeof (digest);
+  param.keylen = 5;
+  param.fanout = 1;
+  param.depth = 1;
+  for (i = 0; i < BLAKE2S_SALT_SIZE; ++i)
+    param.salt[i] = (uint8_t)i;
+  memcpy (param.personal, "fcrypt!!", BLAKE2S_PERSONAL_SIZE);
+
+  blake2s_init_param (&ctx, &param, (const uint8_t *)"kkkkk");
+  blake2s_update (&ctx, "abc", 3);
+  blake2s_final (digest, &ctx);
+  hexdump (digest, sizeof (digest));
+  if (memcmp (digest, blake2s_param_digest, sizeof (digest)) != 0)
+    {
+      fprintf (stderr, "blake2s_param: Failed\n");
+      return false;
+    }
+
+  return true;
+}
@@ -0,0 +1,965 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * The keyed test vectors match blake2sp-kat.txt from the CC0 reference
+ * implementation of BLAKE2. https://github.com/BLAKE2/BLAKE2
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2sp.h"
+
+static const uint8_t blake2sp_keyed_kat[256][BLAKE2SP_DIGEST_SIZE] = {
+  { 0x71, 0x5c, 0xb1, 0x38, 0x95, 0xae, 0xb6, 0x78, 0xf6, 0x12, 0x41,
+    0x60, 0xbf, 0xf2, 0x14, 0x65, 0xb3, 0x0f, 0x4f, 0x68, 0x74, 0x19,
+    0x3f, 0xc8, 0x51, 0xb4, 0x62, 0x10, 0x43, 0xf0, 0x9c, 0xc6 },
+  { 0x40, 0x57, 0x8f, 0xfa, 0x52, 0xbf, 0x51, 0xae, 0x18, 0x66, 0xf4,
+    0x28, 0x4d, 0x3a, 0x15, 0x7f, 0xc1, 0xbc, 0xd3, 0x6a, 0xc1, 0x3c,
+    0xbd, 0xcb, 0x03, 0x77, 0xe4, 0xd0, 0xcd, 0x0b, 0x66, 0x03 },
+  { 0x67, 0xe3, 0x09, 0x75, 0x45, 0xba, 0xd7, 0xe8, 0x52, 0xd7, 0x4d,
+    0x4e, 0xb5, 0x48, 0xec, 0xa7, 0xc2, 0x19, 0xc2, 0x02, 0xa7, 0xd0,
+    0x88, 0xdb, 0x0e, 0xfe, 0xac, 0x0e, 0xac, 0x30, 0x42, 0x49 },
+  { 0x8d, 0xbc, 0xc0, 0x58, 0x9a, 0x3d, 0x17, 0x29, 0x6a, 0x7a, 0x58,
+    0xe2, 0xf1, 0xef, 0xf0, 0xe2, 0xaa, 0x42, 0x10, 0xb5, 0x8d, 0x1f,
+    0x88, 0xb8, 0x6d, 0x7b, 0xa5, 0xf2, 0x9d, 0xd3, 0xb5, 0x83 },
+  { 0xa9, 0xa9, 0x65, 0x2c, 0x8c, 0x67, 0x75, 0x94, 0xc8, 0x72, 0x12,
+    0xd8, 0x9d, 0x5a, 0x75, 0xfb, 0x31, 0xef, 0x4f, 0x47, 0xc6, 0x58,
+    0x2c, 0xde, 0x5f, 0x1e, 0xf6, 0x6b, 0xd4, 0x94, 0x53, 0x3a },
+  { 0x05, 0xa7, 0x18, 0x0e, 0x59, 0x50, 0x54, 0x73, 0x99, 0x48, 0xc5,
+    0xe3, 0x38, 0xc9, 0x5f, 0xe0, 0xb7, 0xfc, 0x61, 0xac, 0x58, 0xa7,
+    0x35, 0x74, 0x74, 0x56, 0x33, 0xbb, 0xc1, 0xf7, 0x70, 0x31 },
+  { 0x81, 0x4d, 0xe8, 0x31, 0x53, 0xb8, 0xd7, 0x5d, 0xfa, 0xde, 0x29,
+    0xfd, 0x39, 0xac, 0x72, 0xdd, 0x09, 0xca, 0x0f, 0x9b, 0xc8, 0xb7,
+    0xab, 0x6a, 0x06, 0xba, 0xee, 0x7d, 0xd0, 0xf9, 0xf0, 0x83 },
+  { 0xdf, 0xd4, 0x19, 0x44, 0x91, 0x29, 0xff, 0x60, 0x4f, 0x0a, 0x14,
+    0x8b, 0x4c, 0x7d, 0x68, 0xf1, 0x17, 0x4f, 0x7d, 0x0f, 0x8c, 0x8d,
+    0x2c, 0xe7, 0x7f, 0x44, 0x8f, 0xd3, 0x41, 0x9c, 0x6f, 0xb0 },
+  { 0xb9, 0xed, 0x22, 0xe7, 0xdd, 0x8d, 0xd1, 0x4e, 0xe8, 0xc9, 0x5b,
+    0x20, 0xe7, 0x63, 0x2e, 0x85, 0x53, 0xa2, 0x68, 0xd9, 0xff, 0x86,
+    0x33, 0xed, 0x3c, 0x21, 0xd1, 0xb8, 0xc9, 0xa7, 0x0b, 0xe1 },
+  { 0x95, 0xf0, 0x31, 0x67, 0x1a, 0x4e, 0x3c, 0x54, 0x44, 0x1c, 0xee,
+    0x9d, 0xbe, 0xf4, 0xb7, 0xac, 0xa4, 0x46, 0x18, 0xa3, 0xa3, 0x33,
+    0xad, 0x74, 0x06, 0xd1, 0x97, 0xac, 0x5b, 0xa0, 0x79, 0x1a },
+  { 0xe2, 0x92, 0x5b, 0x9d, 0x5c, 0xa0, 0xff, 0x62, 0x88, 0xc5, 0xea,
+    0x1a, 0xf2, 0xd2, 0x2b, 0x0a, 0x6b, 0x79, 0xe2, 0xda, 0xe0, 0x8b,
+    0xfd, 0x36, 0xc3, 0xbe, 0x10, 0xbb, 0x8d, 0x71, 0xd8, 0x39 },
+  { 0x16, 0x24, 0x9c, 0x74, 0x4e, 0x49, 0x51, 0x45, 0x1d, 0x4c, 0x89,
+    0x4f, 0xb5, 0x9a, 0x3e, 0xcb, 0x3f, 0xbf, 0xb7, 0xa4, 0x5f, 0x96,
+    0xf8, 0x5d, 0x15, 0x80, 0xac, 0x0b, 0x84, 0x2d, 0x96, 0xda },
+  { 0x43, 0x2b, 0xc9, 0x1c, 0x52, 0xac, 0xeb, 0x9d, 0xae, 0xd8, 0x83,
+    0x28, 0x81, 0x64, 0x86, 0x50, 0xc1, 0xb8, 0x1d, 0x11, 0x7a, 0xbd,
+    0x68, 0xe0, 0x84, 0x51, 0x50, 0x8a, 0x63, 0xbe, 0x00, 0x81 },
+  { 0xcd, 0xe8, 0x20, 0x2b, 0xcf, 0xa3, 0xf3, 0xe9, 0x5d, 0x79, 0xba,
+    0xcc, 0x16, 0x5d, 0x52, 0x70, 0x0e, 0xf7, 0x1d, 0x87, 0x4a, 0x3c,
+    0x63, 0x7e, 0x63, 0x4f, 0x64, 0x44, 0x73, 0x72, 0x0d, 0x6b },
+  { 0x16, 0x21, 0x62, 0x1f, 0x5c, 0x3e, 0xe4, 0x46, 0x89, 0x9d, 0x3c,
+    0x8a, 0xae, 0x49, 0x17, 0xb1, 0xe6, 0xdb, 0x4a, 0x0e, 0xd0, 0x42,
+    0x31, 0x5f, 0xb2, 0xc1, 0x74, 0x82, 0x5e, 0x0a, 0x18, 0x19 },
+  { 0x33, 0x6e, 0x8e, 0xbc, 0x71, 0xe2, 0x09, 0x5c, 0x27, 0xf8, 0x64,
+    0xa3, 0x12, 0x1e, 0xfd, 0x0f, 0xaa, 0x7a, 0x41, 0x28, 0x57, 0x25,
+    0xa5, 0x92, 0xf6, 0x1b, 0xed, 0xed, 0x9d, 0xde, 0x86, 0xed },
+  { 0x07, 0x9b, 0xe0, 0x41, 0x0e, 0x78, 0x9b, 0x36, 0xee, 0x7f, 0x55,
+    0xc1, 0x9f, 0xaa, 0xc6, 0x91, 0x65, 0x6e, 0xb0, 0x52, 0x1f, 0x42,
+    0x94, 0x9b, 0x84, 0xee, 0x29, 0xfe, 0x2a, 0x0e, 0x7f, 0x36 },
+  { 0x17, 0x27, 0x0c, 0x4f, 0x34, 0x88, 0x08, 0x2d, 0x9f, 0xf9, 0x93,
+    0x7e, 0xab, 0x3c, 0xa9, 0x9c, 0x97, 0xc5, 0xb4, 0x59, 0x61, 0x47,
+    0x37, 0x2d, 0xd4, 0xe9, 0x8a, 0xcf, 0x13, 0xdb, 0x28, 0x10 },
+  { 0x18, 0x3c, 0x38, 0x75, 0x4d, 0x03, 0x41, 0xce, 0x07, 0xc1, 0x7a,
+    0x6c, 0xb6, 0xc2, 0xfd, 0x8b, 0xbc, 0xc1, 0x40, 0x4f, 0xdd, 0x01,
+    0x41, 0x99, 0xc7, 0x8b, 0xe1, 0xa9, 0x75, 0x59, 0xa9, 0x28 },
+  { 0x6e, 0x52, 0xd7, 0x28, 0xa4, 0x05, 0xa6, 0xe1, 0xf8, 0x75, 0x87,
+    0xbb, 0xc2, 0xac, 0x91, 0xc5, 0xc0, 0x9b, 0x2d, 0x82, 0x8a, 0xc8,
+    0x1e, 0x5c, 0x4a, 0x81, 0xd0, 0x3d, 0xd4, 0xaa, 0x8d, 0x5c },
+  { 0xf4, 0xe0, 0x8e, 0x05, 0x9b, 0x74, 0x14, 0x4b, 0xf9, 0x48, 0x14,
+    0x6d, 0x14, 0xa2, 0xc8, 0x1e, 0x46, 0xdc, 0x15, 0xff, 0x26, 0xeb,
+    0x52, 0x34, 0x4c, 0xdd, 0x47, 0x4a, 0xbe, 0xa1, 0x4b, 0xc0 },
+  { 0x0f, 0x2e, 0x0a, 0x10, 0x0e, 0xd8, 0xa1, 0x17, 0x85, 0x96, 0x2a,
+    0xd4, 0x59, 0x6a, 0xf9, 0x55, 0xe3, 0x0b, 0x9a, 0xef, 0x93, 0x0a,
+    0x24, 0x8d, 0xa9, 0x32, 0x2b, 0x70, 0x2d, 0x4b, 0x68, 0x72 },
+  { 0x51, 0x90, 0xfc, 0xc7, 0x32, 0xf4, 0x04, 0xaa, 0xd4, 0x36, 0x4a,
+    0xc7, 0x96, 0x0c, 0xfd, 0x5b, 0x4e, 0x34, 0x86, 0x29, 0xc3, 0x72,
+    0xee, 0xb3, 0x25, 0xb5, 0xc6, 0xc7, 0xcb, 0xce, 0x59, 0xab },
+  { 0xc0, 0xc4, 0xcb, 0x86, 0xea, 0x25, 0xea, 0x95, 0x7e, 0xec, 0x5b,
+    0x22, 0xd2, 0x55, 0x0a, 0x16, 0x49, 0xe6, 0xdf, 0xfa, 0x31, 0x6b,
+    0xb8, 0xf4, 0xc9, 0x1b, 0x8f, 0xf7, 0xa2, 0x4b, 0x25, 0x31 },
+  { 0x2c, 0x9e, 0xda, 0x13, 0x5a, 0x30, 0xae, 0xca, 0xf3, 0xac, 0xb3,
+    0xd2, 0x3a, 0x30, 0x35, 0xfb, 0xab, 0xba, 0x98, 0x33, 0x31, 0x65,
+    0xd8, 0x7f, 0xcb, 0xf8, 0xfe, 0x10, 0x33, 0x6e, 0xcf, 0x20 },
+  { 0x3c, 0xd6, 0x69, 0xe8, 0xd5, 0x62, 0x62, 0xa2, 0x37, 0x13, 0x67,
+    0x22, 0x4d, 0xae, 0x6d, 0x75, 0x9e, 0xe1, 0x52, 0xc3, 0x15, 0x33,
+    0xb2, 0x63, 0xfa, 0x2e, 0x64, 0x92, 0x08, 0x77, 0xb2, 0xa7 },
+  { 0x18, 0xa9, 0xa0, 0xc2, 0xd0, 0xea, 0x6c, 0x3b, 0xb3, 0x32, 0x83,
+    0x0f, 0x89, 0x18, 0xb0, 0x68, 0x4f, 0x5d, 0x39, 0x94, 0xdf, 0x48,
+    0x67, 0x46, 0x2d, 0xd0, 0x6e, 0xf0, 0x86, 0x24, 0x24, 0xcc },
+  { 0x73, 0x90, 0xea, 0x41, 0x04, 0xa9, 0xf4, 0xee, 0xa9, 0x0f, 0x81,
+    0xe2, 0x6a, 0x12, 0x9d, 0xcf, 0x9f, 0x4a, 0xf3, 0x83, 0x52, 0xd9,
+    0xcb, 0x6a, 0x81, 0x2c, 0xc8, 0x05, 0x69, 0x09, 0x05, 0x0e },
+  { 0xe4, 0x9e, 0x01, 0x14, 0xc6, 0x29, 0xb4, 0x94, 0xb1, 0x1e, 0xa9,
+    0x8e, 0xcd, 0x40, 0x32, 0x73, 0x1f, 0x15, 0x3b, 0x46, 0x50, 0xac,
+    0xac, 0xd7, 0xe0, 0xf6, 0xe7, 0xde, 0x3d, 0xf0, 0x19, 0x77 },
+  { 0x27, 0xc5, 0x70, 0x2b, 0xe1, 0x04, 0xb3, 0xa9, 0x4f, 0xc4, 0x34,
+    0x23, 0xae, 0xee, 0x83, 0xac, 0x3c, 0xa7, 0x3b, 0x7f, 0x87, 0x83,
+    0x9a, 0x6b, 0x2e, 0x29, 0x60, 0x79, 0x03, 0xb7, 0xf2, 0x87 },
+  { 0x81, 0xd2, 0xe1, 0x2e, 0xb2, 0xf4, 0x27, 0x60, 0xc6, 0xe3, 0xba,
+    0xa7, 0x8f, 0x84, 0x07, 0x3a, 0xe6, 0xf5, 0x61, 0x60, 0x70, 0xfe,
+    0x25, 0xbe, 0xde, 0x7c, 0x7c, 0x82, 0x48, 0xab, 0x1f, 0xba },
+  { 0xfa, 0xb2, 0x35, 0xd5, 0x93, 0x48, 0xab, 0x8c, 0xe4, 0x9b, 0xec,
+    0x77, 0xc0, 0xf1, 0x93, 0x28, 0xfd, 0x04, 0x5d, 0xfd, 0x60, 0x8a,
+    0x53, 0x03, 0x36, 0xdf, 0x4f, 0x94, 0xe1, 0x72, 0xa5, 0xc8 },
+  { 0x8a, 0xaa, 0x8d, 0x80, 0x5c, 0x58, 0x88, 0x1f, 0xf3, 0x79, 0xfb,
+    0xd4, 0x2c, 0x6b, 0xf6, 0xf1, 0x4c, 0x6c, 0x73, 0xdf, 0x80, 0x71,
+    0xb3, 0xb2, 0x28, 0x98, 0x11, 0x09, 0xcc, 0xc0, 0x15, 0xf9 },
+  { 0x91, 0xfd, 0xd2, 0x62, 0x20, 0x39, 0x16, 0x39, 0x47, 0x40, 0x95,
+    0x2b, 0xce, 0x72, 0xb6, 0x4b, 0xab, 0xb6, 0xf7, 0x21, 0x34, 0x4d,
+    0xee, 0x82, 0x50, 0xbf, 0x0e, 0x46, 0xf1, 0xba, 0x18, 0x8f },
+  { 0xf7, 0xe5, 0x7b, 0x8f, 0x85, 0xf4, 0x7d, 0x59, 0x03, 0xad, 0x4c,
+    0xcb, 0x8a, 0xf6, 0x2a, 0x3e, 0x85, 0x8a, 0xab, 0x2b, 0x8c, 0xc2,
+    0x26, 0x49, 0x4f, 0x7b, 0x00, 0xbe, 0xdb, 0xf5, 0xb0, 0xd0 },
+  { 0xf7, 0x6f, 0x21, 0xad, 0xda, 0xe9, 0x6a, 0x96, 0x46, 0xfc, 0x06,
+    0xf9, 0xbf, 0x52, 0xae, 0x08, 0x48, 0xf1, 0x8c, 0x35, 0x26, 0xb1,
+    0x29, 0xe1, 0x5b, 0x2c, 0x35, 0x5e, 0x2e, 0x79, 0xe5, 0xda },
+  { 0x8a, 0xeb, 0x1c, 0x79, 0x5f, 0x34, 0x90, 0x01, 0x5e, 0xf4, 0xcd,
+    0x61, 0xa2, 0x80, 0x7b, 0x23, 0x0e, 0xfd, 0xc8, 0x46, 0x01, 0x73,
+    0xda, 0xd0, 0x26, 0xa4, 0xa0, 0xfc, 0xc2, 0xfb, 0xf2, 0x2a },
+  { 0xc5, 0x64, 0xff, 0xc6, 0x23, 0x07, 0x77, 0x65, 0xbb, 0x97, 0x87,
+    0x58, 0x56, 0x54, 0xce, 0x74, 0x5d, 0xbd, 0x10, 0x8c, 0xef, 0x24,
+    0x8a, 0xb0, 0x0a, 0xd1, 0xa2, 0x64, 0x7d, 0x99, 0x03, 0x87 },
+  { 0xfe, 0x89, 0x42, 0xa3, 0xe5, 0xf5, 0xe8, 0xcd, 0x70, 0x51, 0x04,
+    0xf8, 0x82, 0x10, 0x72, 0x6e, 0x53, 0xdd, 0x7e, 0xb3, 0xf9, 0xa2,
+    0x02, 0xbf, 0x93, 0x14, 0xb3, 0xb9, 0x06, 0x5e, 0xb7, 0x12 },
+  { 0xdc, 0x29, 0x53, 0x59, 0xd4, 0x36, 0xee, 0xa7, 0x80, 0x84, 0xe7,
+    0xb0, 0x77, 0xfe, 0x09, 0xb1, 0x9c, 0x5b, 0xf3, 0xd2, 0xa7, 0x96,
+    0xda, 0xb0, 0x19, 0xe4, 0x20, 0x05, 0x99, 0xfd, 0x82, 0x02 },
+  { 0x70, 0xb3, 0xf7, 0x2f, 0x74, 0x90, 0x32, 0xe2, 0x5e, 0x38, 0x3b,
+    0x96, 0x43, 0x78, 0xea, 0x1c, 0x54, 0x3e, 0x9c, 0x15, 0xde, 0x3a,
+    0x27, 0xd8, 0x6d, 0x2a, 0x9d, 0x22, 0x31, 0xef, 0xf4, 0x8a },
+  { 0x79, 0x82, 0xb5, 0x4c, 0x08, 0xdb, 0x2b, 0xfb, 0x6f, 0x45, 0xf3,
+    0x5b, 0xc3, 0x23, 0xbc, 0x09, 0x37, 0x79, 0xb6, 0xbb, 0x0e, 0x3e,
+    0xea, 0x3e, 0x8c, 0x98, 0xb1, 0xde, 0x99, 0xd3, 0xc5, 0x5e },
+  { 0x75, 0xe4, 0x16, 0x22, 0x57, 0x01, 0x4b, 0xed, 0xcc, 0x05, 0xc2,
+    0x94, 0x4d, 0xce, 0x0d, 0xf0, 0xc3, 0x5e, 0xba, 0x13, 0x19, 0x54,
+    0x06, 0x4f, 0x6e, 0x4e, 0x09, 0x5f, 0xd0, 0x84, 0x45, 0xee },
+  { 0x4a, 0x12, 0x9e, 0xa6, 0xcd, 0xba, 0xbc, 0x2d, 0x39, 0x24, 0x79,
+    0x37, 0x2f, 0x97, 0x5b, 0x9c, 0xf5, 0xa1, 0xb7, 0xde, 0xb6, 0x9a,
+    0x32, 0x66, 0xf0, 0x3e, 0xbc, 0x6d, 0x11, 0x13, 0x93, 0xc4 },
+  { 0x8f, 0xed, 0x70, 0xf2, 0x79, 0x55, 0xdc, 0x8a, 0xd9, 0xf1, 0xb7,
+    0xb3, 0xf6, 0xf5, 0xdf, 0xbd, 0x96, 0x2a, 0x33, 0x59, 0x2b, 0x42,
+    0xde, 0x85, 0x6d, 0x42, 0x1e, 0x29, 0x12, 0xba, 0xb8, 0x6b },
+  { 0xe2, 0xf2, 0x06, 0x60, 0x37, 0x6f, 0x2b, 0x18, 0x39, 0x66, 0x7c,
+    0xbf, 0xe5, 0xe1, 0x6e, 0xf0, 0x75, 0xac, 0x39, 0x43, 0x64, 0x4f,
+    0x35, 0x32, 0x28, 0x2f, 0x8b, 0xb0, 0x72, 0x3b, 0x99, 0x86 },
+  { 0xab, 0xf8, 0x4c, 0x91, 0x3a, 0x83, 0xdf, 0x98, 0xc7, 0x00, 0x29,
+    0x81, 0x9c, 0x06, 0x5f, 0x6d, 0x6d, 0xe4, 0xf6, 0xd4, 0x3a, 0xbf,
+    0x60, 0x0d, 0xad, 0xe0, 0x35, 0xb2, 0x3b, 0xed, 0x7b, 0xaa },
+  { 0x45, 0x9c, 0x15, 0xd4, 0x85, 0x6c, 0x7e, 0xcf, 0x82, 0x62, 0x03,
+    0x51, 0xc3, 0xc1, 0xc7, 0x6c, 0x40, 0x3f, 0x3e, 0x97, 0x07, 0x74,
+    0x13, 0x87, 0xe2, 0x99, 0x07, 0x3f, 0xb1, 0x70, 0x4b, 0x2b },
+  { 0x9a, 0xb9, 0x12, 0xed, 0xa0, 0x76, 0x8a, 0xbd, 0xf8, 0x26, 0xb6,
+    0xe0, 0x5d, 0x0d, 0x73, 0x58, 0x39, 0xe6, 0xa5, 0xf0, 0x2e, 0x04,
+    0xc4, 0xcc, 0x75, 0x65, 0x0b, 0x2c, 0x8c, 0xab, 0x67, 0x49 },
+  { 0x47, 0x40, 0xeb, 0xec, 0xac, 0x90, 0x03, 0x1b, 0xb7, 0xe6, 0x8e,
+    0x51, 0xc5, 0x53, 0x91, 0xaf, 0xb1, 0x89, 0xb3, 0x17, 0xf2, 0xde,
+    0x55, 0x87, 0x66, 0xf7, 0x8f, 0x5c, 0xb7, 0x1f, 0x81, 0xb6 },
+  { 0x3c, 0xc4, 0x7f, 0x0e, 0xf6, 0x48, 0x21, 0x58, 0x7c, 0x93, 0x7c,
+    0xdd, 0xba, 0x85, 0xc9, 0x93, 0xd3, 0xce, 0x2d, 0xd0, 0xce, 0xd4,
+    0x0d, 0x3b, 0xe3, 0x3c, 0xb7, 0xdc, 0x7e, 0xda, 0xbc, 0xf1 },
+  { 0x9f, 0x47, 0x6a, 0x22, 0xdb, 0x54, 0xd6, 0xbb, 0x9b, 0xef, 0xdb,
+    0x26, 0x0c, 0x66, 0x57, 0x8a, 0xe1, 0xd8, 0xa5, 0xf8, 0x7d, 0x3d,
+    0x8c, 0x01, 0x7f, 0xdb, 0x74, 0x75, 0x08, 0x0f, 0xa8, 0xe1 },
+  { 0x8b, 0x68, 0xc6, 0xfb, 0x07, 0x06, 0xa7, 0x95, 0xf3, 0xa8, 0x39,
+    0xd6, 0xfe, 0x25, 0xfd, 0x4a, 0xa7, 0xf9, 0x2e, 0x66, 0x4f, 0x76,
+    0x2d, 0x61, 0x53, 0x81, 0xbc, 0x85, 0x9a, 0xfa, 0x29, 0x2c },
+  { 0xf6, 0x40, 0xd2, 0x25, 0xa6, 0xbc, 0xd2, 0xfc, 0x8a, 0xcc, 0xaf,
+    0xbe, 0xd5, 0xa8, 0x4b, 0x5b, 0xbb, 0x5d, 0x8a, 0xe5, 0xdb, 0x06,
+    0xa1, 0x0b, 0x6d, 0x9d, 0x93, 0x16, 0x0b, 0x39, 0x2e, 0xe0 },
+  { 0x70, 0x48, 0x60, 0xa7, 0xf5, 0xba, 0x68, 0xdb, 0x27, 0x03, 0x1c,
+    0x15, 0xf2, 0x25, 0x50, 0x0d, 0x69, 0x2a, 0xb2, 0x47, 0x53, 0x42,
+    0x81, 0xc4, 0xf6, 0x84, 0xf6, 0xc6, 0xc8, 0xcd, 0x88, 0xc7 },
+  { 0xc1, 0xa7, 0x5b, 0xdd, 0xa1, 0x2b, 0x8b, 0x2a, 0xb1, 0xb9, 0x24,
+    0x84, 0x38, 0x58, 0x18, 0x3a, 0x09, 0xd2, 0x02, 0x42, 0x1f, 0xdb,
+    0xcd, 0xf0, 0xe6, 0x3e, 0xae, 0x46, 0xf3, 0x7d, 0x91, 0xed },
+  { 0x9a, 0x8c, 0xab, 0x7a, 0x5f, 0x2e, 0x57, 0x62, 0x21, 0xa6, 0xa8,
+    0x5e, 0x5f, 0xdd, 0xee, 0x75, 0x67, 0x8e, 0x06, 0x53, 0x24, 0xa6,
+    0x1d, 0xb0, 0x3a, 0x39, 0x26, 0x1d, 0xdf, 0x75, 0xe3, 0xf4 },
+  { 0x05, 0xc2, 0xb2, 0x6b, 0x03, 0xce, 0x6c, 0xa5, 0x87, 0x1b, 0xe0,
+    0xde, 0x84, 0xee, 0x27, 0x86, 0xa7, 0x9b, 0xcd, 0x9f, 0x30, 0x03,
+    0x3e, 0x81, 0x9b, 0x4a, 0x87, 0xcc, 0xa2, 0x7a, 0xfc, 0x6a },
+  { 0xb0, 0xb0, 0x99, 0x3c, 0x6d, 0x0c, 0x6e, 0xd5, 0xc3, 0x59, 0x04,
+    0x80, 0xf8, 0x65, 0xf4, 0x67, 0xf4, 0x33, 0x1a, 0x58, 0xdd, 0x8e,
+    0x47, 0xbd, 0x98, 0xeb, 0xbc, 0xdb, 0x8e, 0xb4, 0xf9, 0x4d },
+  { 0xe5, 0x7c, 0x10, 0x3c, 0xf7, 0xb6, 0xbb, 0xeb, 0x8a, 0x0d, 0xc8,
+    0xf0, 0x48, 0x62, 0x5c, 0x3f, 0x4c, 0xe4, 0xf1, 0xa5, 0xad, 0x4d,
+    0x07, 0x9c, 0x11, 0x87, 0xbf, 0xe9, 0xee, 0x3b, 0x8a, 0x5f },
+  { 0xf1, 0x00, 0x23, 0xe1, 0x5f, 0x3b, 0x72, 0xb7, 0x38, 0xad, 0x61,
+    0xae, 0x65, 0xab, 0x9a, 0x07, 0xe7, 0x77, 0x4e, 0x2d, 0x7a, 0xb0,
+    0x2d, 0xba, 0x4e, 0x0c, 0xaf, 0x56, 0x02, 0xc8, 0x01, 0x78 },
+  { 0x9a, 0x8f, 0xb3, 0xb5, 0x38, 0xc1, 0xd6, 0xc4, 0x50, 0x51, 0xfa,
+    0x9e, 0xd9, 0xb0, 0x7d, 0x3e, 0x89, 0xb4, 0x43, 0x03, 0x30, 0x01,
+    0x4a, 0x1e, 0xfa, 0x28, 0x23, 0xc0, 0x82, 0x3c, 0xf2, 0x37 },
+  { 0x30, 0x75, 0xc5, 0xbc, 0x7c, 0x3a, 0xd7, 0xe3, 0x92, 0x01, 0x01,
+    0xbc, 0x68, 0x99, 0xc5, 0x8e, 0xa7, 0x01, 0x67, 0xa7, 0x77, 0x2c,
+    0xa2, 0x8e, 0x38, 0xe2, 0xc1, 0xb0, 0xd3, 0x25, 0xe5, 0xa0 },
+  { 0xe8, 0x55, 0x94, 0x70, 0x0e, 0x39, 0x22, 0xa1, 0xe8, 0xe4, 0x1e,
+    0xb8, 0xb0, 0x64, 0xe7, 0xac, 0x6d, 0x94, 0x9d, 0x13, 0xb5, 0xa3,
+    0x45, 0x23, 0xe5, 0xa6, 0xbe, 0xac, 0x03, 0xc8, 0xab, 0x29 },
+  { 0x1d, 0x37, 0x01, 0xa5, 0x66, 0x1b, 0xd3, 0x1a, 0xb2, 0x05, 0x62,
+    0xbd, 0x07, 0xb7, 0x4d, 0xd1, 0x9a, 0xc8, 0xf3, 0x52, 0x4b, 0x73,
+    0xce, 0x7b, 0xc9, 0x96, 0xb7, 0x88, 0xaf, 0xd2, 0xf3, 0x17 },
+  { 0x87, 0x4e, 0x19, 0x38, 0x03, 0x3d, 0x7d, 0x38, 0x35, 0x97, 0xa2,
+    0xa6, 0x5f, 0x58, 0xb5, 0x54, 0xe4, 0x11, 0x06, 0xf6, 0xd1, 0xd5,
+    0x0e, 0x9b, 0xa0, 0xeb, 0x68, 0x5f, 0x6b, 0x6d, 0xa0, 0x71 },
+  { 0x93, 0xf2, 0xf3, 0xd6, 0x9b, 0x2d, 0x36, 0x52, 0x95, 0x56, 0xec,
+    0xca, 0xf9, 0xf9, 0x9a, 0xdb, 0xe8, 0x95, 0xe1, 0x57, 0x22, 0x31,
+    0xe6, 0x49, 0xb5, 0x05, 0x84, 0xb5, 0xd7, 0xd0, 0x8a, 0xf8 },
+  { 0x06, 0xe0, 0x6d, 0x61, 0x0f, 0x2e, 0xeb, 0xba, 0x36, 0x76, 0x82,
+    0x3e, 0x77, 0x44, 0xd7, 0x51, 0xaf, 0xf7, 0x30, 0x76, 0xed, 0x65,
+    0xf3, 0xcf, 0xf5, 0xe7, 0x2f, 0xd2, 0x27, 0x99, 0x9c, 0x77 },
+  { 0x8d, 0xf7, 0x57, 0xb3, 0xa1, 0xe0, 0xf4, 0x80, 0xfa, 0x76, 0xc7,
+    0xf3, 0x58, 0xed, 0x03, 0x98, 0xbe, 0x3f, 0x2a, 0x8f, 0x7b, 0x90,
+    0xea, 0x8c, 0x80, 0x75, 0x99, 0xde, 0xda, 0x1d, 0x05, 0x34 },
+  { 0xee, 0xc9, 0xc5, 0xc6, 0x3c, 0xc5, 0x16, 0x9d, 0x96, 0x7b, 0xb1,
+    0x62, 0x4e, 0x9e, 0xe5, 0xce, 0xd9, 0x28, 0x97, 0x73, 0x6e, 0xfb,
+    0xd1, 0x57, 0x54, 0x8d, 0x82, 0xe8, 0x7c, 0xc7, 0x2f, 0x25 },
+  { 0xcc, 0x2b, 0x58, 0x32, 0xad, 0x27, 0x2c, 0xc5, 0x5c, 0x10, 0xd4,
+    0xf8, 0xc7, 0xf8, 0xbb, 0x38, 0xe6, 0xe4, 0xeb, 0x92, 0x2f, 0x93,
+    0x86, 0x83, 0x0f, 0x90, 0xb1, 0xe3, 0xda, 0x39, 0x37, 0xd5 },
+  { 0x36, 0x89, 0x85, 0xd5, 0x38, 0x7c, 0x0b, 0xfc, 0x92, 0x8a, 0xc2,
+    0x54, 0xfa, 0x6d, 0x16, 0x67, 0x3e, 0x70, 0x94, 0x75, 0x66, 0x96,
+    0x1b, 0x5f, 0xb3, 0x32, 0x5a, 0x58, 0x8a, 0xb3, 0x17, 0x3a },
+  { 0xf1, 0xe4, 0x42, 0xaf, 0xb8, 0x72, 0x15, 0x1f, 0x81, 0x34, 0x95,
+    0x6c, 0x54, 0x8a, 0xe3, 0x24, 0x0d, 0x07, 0xe6, 0xe3, 0x38, 0xd4,
+    0xa7, 0xa6, 0xaf, 0x8d, 0xa4, 0x11, 0x9a, 0xb0, 0xe2, 0xb0 },
+  { 0xb0, 0x12, 0xc7, 0x54, 0x6a, 0x39, 0xc4, 0x0c, 0xad, 0xec, 0xe4,
+    0xe0, 0x4e, 0x7f, 0x33, 0xc5, 0x93, 0xad, 0x18, 0x2e, 0xbc, 0x5a,
+    0x46, 0xd2, 0xdb, 0xf4, 0xad, 0x1a, 0x92, 0xf5, 0x9e, 0x7b },
+  { 0x6c, 0x60, 0x97, 0xcd, 0x20, 0x33, 0x09, 0x6b, 0x4d, 0xf3, 0x17,
+    0xde, 0x8a, 0x90, 0x8b, 0x7d, 0x0c, 0x72, 0x94, 0x39, 0x0c, 0x5a,
+    0x39, 0x9c, 0x30, 0x1b, 0xf2, 0xa2, 0x65, 0x2e, 0x82, 0x62 },
+  { 0xba, 0x83, 0xfe, 0xb5, 0x10, 0xb4, 0x9a, 0xde, 0x4f, 0xae, 0xfb,
+    0xe9, 0x42, 0x78, 0x1e, 0xaf, 0xd4, 0x1a, 0xd5, 0xd4, 0x36, 0x88,
+    0x85, 0x31, 0xb6, 0x88, 0x59, 0xf2, 0x2c, 0x2d, 0x16, 0x4a },
+  { 0x5a, 0x06, 0x9e, 0x43, 0x92, 0x19, 0x5a, 0xc9, 0xd2, 0x84, 0xa4,
+    0x7f, 0x3b, 0xd8, 0x54, 0xaf, 0x8f, 0xd0, 0xd7, 0xfd, 0xc3, 0x48,
+    0x3d, 0x2c, 0x5f, 0x34, 0x24, 0xcc, 0xfd, 0xa1, 0x5c, 0x8e },
+  { 0x7e, 0x88, 0xd6, 0x4b, 0xbb, 0xe2, 0x02, 0x4f, 0x44, 0x54, 0xba,
+    0x13, 0x98, 0xb3, 0xd8, 0x65, 0x2d, 0xce, 0xc8, 0x20, 0xb1, 0x4c,
+    0x3b, 0x0a, 0xbf, 0xbf, 0x0f, 0x4f, 0x33, 0x06, 0xbb, 0x5e },
+  { 0xf8, 0x74, 0x2f, 0xf4, 0x6d, 0xfd, 0xf3, 0xec, 0x82, 0x64, 0xf9,
+    0x94, 0x5b, 0x20, 0x41, 0x94, 0x62, 0xf0, 0x69, 0xe8, 0x33, 0xc5,
+    0x94, 0xec, 0x80, 0xff, 0xac, 0x5e, 0x7e, 0x51, 0x34, 0xf9 },
+  { 0xd3, 0xe0, 0xb7, 0x38, 0xd2, 0xe9, 0x2f, 0x3c, 0x47, 0xc7, 0x94,
+    0x66, 0x66, 0x09, 0xc0, 0xf5, 0x50, 0x4f, 0x67, 0xec, 0x4e, 0x76,
+    0x0e, 0xee, 0xcc, 0xf8, 0x64, 0x4e, 0x68, 0x33, 0x34, 0x11 },
+  { 0x0c, 0x90, 0xce, 0x10, 0xed, 0xf0, 0xce, 0x1d, 0x47, 0xee, 0xb5,
+    0x0b, 0x5b, 0x7a, 0xff, 0x8e, 0xe8, 0xa4, 0x3b, 0x64, 0xa8, 0x89,
+    0xc1, 0xc6, 0xc6, 0xb8, 0xe3, 0x1a, 0x3c, 0xfc, 0x45, 0xee },
+  { 0x83, 0x91, 0x7a, 0xc1, 0xcd, 0xad, 0xe8, 0xf0, 0xe3, 0xbf, 0x42,
+    0x6f, 0xea, 0xc1, 0x38, 0x8b, 0x3f, 0xcb, 0xe3, 0xe1, 0xbf, 0x98,
+    0x79, 0x8c, 0x81, 0x58, 0xbf, 0x75, 0x8e, 0x8d, 0x5d, 0x4e },
+  { 0xdc, 0x8e, 0xb0, 0xc0, 0x13, 0xfa, 0x9d, 0x06, 0x4e, 0xe3, 0x76,
+    0x23, 0x36, 0x9f, 0xb3, 0x94, 0xaf, 0x97, 0x4b, 0x1a, 0xac, 0x82,
+    0x40, 0x5b, 0x88, 0x97, 0x6c, 0xd8, 0xfc, 0xa1, 0x25, 0x30 },
+  { 0x9a, 0xf4, 0xfc, 0x92, 0xea, 0x8d, 0x6b, 0x5f, 0xe7, 0x99, 0x0e,
+    0x3a, 0x02, 0x70, 0x1e, 0xc2, 0x2b, 0x2d, 0xfd, 0x71, 0x00, 0xb9,
+    0x0d, 0x05, 0x51, 0x86, 0x94, 0x17, 0x95, 0x5e, 0x44, 0xc8 },
+  { 0xc7, 0x22, 0xce, 0xc1, 0x31, 0xba, 0xa1, 0x63, 0xf4, 0x7e, 0x4b,
+    0x33, 0x9e, 0x1f, 0xb9, 0xb4, 0xac, 0xa2, 0x48, 0xc4, 0x75, 0x93,
+    0x45, 0xea, 0xdb, 0xd6, 0xc6, 0xa7, 0xdd, 0xb5, 0x04, 0x77 },
+  { 0x18, 0x37, 0xb1, 0x20, 0xd4, 0xe4, 0x04, 0x6c, 0x6d, 0xe8, 0xcc,
+    0xaf, 0x09, 0xf1, 0xca, 0xf3, 0x02, 0xad, 0x56, 0x23, 0x4e, 0x6b,
+    0x42, 0x2c, 0xe9, 0x0a, 0x61, 0xbf, 0x06, 0xae, 0xe4, 0x3d },
+  { 0x87, 0xac, 0x9d, 0x0f, 0x8a, 0x0b, 0x11, 0xbf, 0xed, 0xd6, 0x99,
+    0x1a, 0x6d, 0xaf, 0x34, 0xc8, 0xaa, 0x5d, 0x7e, 0x8a, 0xe1, 0xb9,
+    0xdf, 0x4a, 0xf7, 0x38, 0x00, 0x5f, 0xe7, 0x8c, 0xe9, 0x3c },
+  { 0xe2, 0x1f, 0xb6, 0x68, 0xeb, 0xb8, 0xbf, 0x2d, 0x82, 0x08, 0x6d,
+    0xed, 0xcb, 0x3a, 0x53, 0x71, 0xc2, 0xc4, 0x6f, 0xa1, 0xac, 0x11,
+    0xd2, 0xe2, 0xc5, 0x66, 0xd1, 0x4a, 0xd3, 0xc3, 0x65, 0x3f },
+  { 0x5a, 0x9a, 0x69, 0x81, 0x5e, 0x4d, 0x3e, 0xb7, 0x72, 0xed, 0x90,
+    0x8f, 0xe6, 0x58, 0xce, 0x50, 0x87, 0x31, 0x0e, 0xc1, 0xd5, 0x0c,
+    0xb9, 0x4f, 0x56, 0x28, 0x33, 0x9a, 0x61, 0xdc, 0xd9, 0xee },
+  { 0xaa, 0xc2, 0x85, 0xf1, 0x20, 0x8f, 0x70, 0xa6, 0x47, 0x97, 0xd0,
+    0xa9, 0x40, 0x0d, 0xa6, 0x46, 0x53, 0x30, 0x18, 0x38, 0xfe, 0xf6,
+    0x69, 0x0b, 0x87, 0xcd, 0xa9, 0x15, 0x9e, 0xe0, 0x7e, 0xf4 },
+  { 0x05, 0x64, 0x3c, 0x1c, 0x6f, 0x26, 0x59, 0x25, 0xa6, 0x50, 0x93,
+    0xf9, 0xde, 0x8a, 0x19, 0x1c, 0x4f, 0x6f, 0xd1, 0x41, 0x8f, 0xbf,
+    0x66, 0xbe, 0x80, 0x59, 0xa9, 0x1b, 0xa8, 0xdc, 0xda, 0x61 },
+  { 0x1c, 0x6c, 0xde, 0x5b, 0x78, 0x10, 0x3c, 0x9e, 0x6f, 0x04, 0x6d,
+    0xfe, 0x30, 0xf5, 0x12, 0x1c, 0xf9, 0xd4, 0x03, 0x9e, 0xfe, 0x22,
+    0x25, 0x40, 0xa4, 0x1b, 0xbc, 0x06, 0xe4, 0x69, 0xfe, 0xb6 },
+  { 0xb4, 0x9b, 0xb4, 0x6d, 0x1b, 0x19, 0x3b, 0x04, 0x5e, 0x74, 0x12,
+    0x05, 0x9f, 0xe7, 0x2d, 0x55, 0x25, 0x52, 0xa8, 0xfb, 0x6c, 0x36,
+    0x41, 0x07, 0x23, 0xdc, 0x7d, 0x05, 0xfc, 0xce, 0xde, 0xd3 },
+  { 0xb6, 0x12, 0xd3, 0xd2, 0x1f, 0xc4, 0xde, 0x3c, 0x79, 0x1a, 0xf7,
+    0x35, 0xe5, 0x9f, 0xb7, 0x17, 0xd8, 0x39, 0x72, 0x3b, 0x42, 0x50,
+    0x8e, 0x9e, 0xbf, 0x78, 0x06, 0xd9, 0x3e, 0x9c, 0x83, 0x7f },
+  { 0x7c, 0x33, 0x90, 0xa3, 0xe5, 0xcb, 0x27, 0xd1, 0x86, 0x8b, 0xa4,
+    0x55, 0xcf, 0xeb, 0x32, 0x22, 0xfd, 0xe2, 0x7b, 0xcd, 0xa4, 0xbf,
+    0x24, 0x8e, 0x3d, 0x29, 0xcf, 0x1f, 0x34, 0x32, 0x9f, 0x25 },
+  { 0xbd, 0x42, 0xee, 0xa7, 0xb3, 0x54, 0x86, 0xcd, 0xd0, 0x90, 0x7c,
+    0xb4, 0x71, 0x2e, 0xde, 0x2f, 0x4d, 0xee, 0xcc, 0xbc, 0xa1, 0x91,
+    0x60, 0x38, 0x65, 0xa1, 0xcc, 0x80, 0x9f, 0x12, 0xb4, 0x46 },
+  { 0xd1, 0xdd, 0x62, 0x01, 0x74, 0x0c, 0xfa, 0xad, 0x53, 0xce, 0xcc,
+    0xb7, 0x56, 0xb1, 0x10, 0xf3, 0xd5, 0x0f, 0x81, 0x7b, 0x43, 0xd7,
+    0x55, 0x95, 0x57, 0xe5, 0x7a, 0xad, 0x14, 0x3a, 0x85, 0xd9 },
+  { 0x58, 0x29, 0x64, 0x3c, 0x1b, 0x10, 0xe1, 0xc8, 0xcc, 0xf2, 0x0c,
+    0x9b, 0x4a, 0xf8, 0x21, 0xea, 0x05, 0x2d, 0x7f, 0x0f, 0x7c, 0x22,
+    0xf7, 0x38, 0x0b, 0xbb, 0xcf, 0xaf, 0xb9, 0x77, 0xe2, 0x1f },
+  { 0xfc, 0x4c, 0xf2, 0xa7, 0xfb, 0xe0, 0xb1, 0xe8, 0xae, 0xfb, 0xe4,
+    0xb4, 0xb7, 0x9e, 0xd8, 0x4e, 0xc9, 0x7b, 0x03, 0x4f, 0x51, 0xb4,
+    0xe9, 0x7f, 0x76, 0x0b, 0x20, 0x63, 0x97, 0x65, 0xb9, 0x33 },
+  { 0x4d, 0x7c, 0x3b, 0x34, 0x38, 0xa0, 0xbd, 0xa2, 0x8e, 0x7a, 0x96,
+    0xe4, 0x20, 0x27, 0xd8, 0x13, 0xe8, 0x8a, 0xe6, 0x28, 0x85, 0x49,
+    0x98, 0x33, 0xd3, 0xc5, 0xf6, 0x35, 0x9e, 0xf7, 0xed, 0xbc },
+  { 0x34, 0xcb, 0xd3, 0x20, 0x68, 0xef, 0x7e, 0x82, 0x09, 0x9e, 0x58,
+    0x0b, 0xf9, 0xe2, 0x64, 0x23, 0xe9, 0x81, 0xe3, 0x1b, 0x1b, 0xbc,
+    0xe6, 0x1a, 0xea, 0xb1, 0x4c, 0x32, 0xa2, 0x73, 0xe4, 0xcb },
+  { 0xa0, 0x5d, 0xda, 0x7d, 0x0d, 0xa9, 0xe0, 0x94, 0xae, 0x22, 0x53,
+    0x3f, 0x79, 0xe7, 0xdc, 0xcd, 0x26, 0xb1, 0x75, 0x7c, 0xef, 0xb9,
+    0x5b, 0xcf, 0x62, 0xc4, 0xff, 0x9c, 0x26, 0x92, 0xe1, 0xc0 },
+  { 0x22, 0x4c, 0xcf, 0xfa, 0x7c, 0xca, 0x4c, 0xe3, 0x4a, 0xfd, 0x47,
+    0xf6, 0x2a, 0xde, 0x53, 0xc5, 0xe8, 0x48, 0x9b, 0x04, 0xac, 0x9c,
+    0x41, 0xf7, 0xfa, 0xd0, 0xc8, 0xed, 0xeb, 0x89, 0xe9, 0x41 },
+  { 0x6b, 0xc6, 0x07, 0x64, 0x83, 0xaa, 0x11, 0xc0, 0x7f, 0xba, 0x55,
+    0xc0, 0xf9, 0xa1, 0xb5, 0xda, 0x87, 0xec, 0xbf, 0xfe, 0xa7, 0x55,
+    0x98, 0xcc, 0x31, 0x8a, 0x51, 0x4c, 0xec, 0x7b, 0x3b, 0x6a },
+  { 0x9a, 0x03, 0x60, 0xe2, 0x3a, 0x22, 0xf4, 0xf7, 0x6c, 0x0e, 0x95,
+    0x28, 0xda, 0xfd, 0x12, 0x9b, 0xb4, 0x67, 0x5f, 0xb8, 0x8d, 0x44,
+    0xea, 0xf8, 0x57, 0x77, 0x30, 0x0c, 0xec, 0x9b, 0xcc, 0x79 },
+  { 0x79, 0x01, 0x99, 0xb4, 0xca, 0x90, 0xde, 0xdc, 0xcf, 0xe3, 0x24,
+    0x74, 0xe8, 0x5b, 0x17, 0x4f, 0x06, 0x9e, 0x35, 0x42, 0xbe, 0x31,
+    0x04, 0xc1, 0x12, 0x5c, 0x2f, 0xdb, 0xd6, 0x9d, 0x32, 0xc7 },
+  { 0x55, 0x83, 0x99, 0x25, 0x83, 0x4c, 0xa3, 0xe8, 0x25, 0xe9, 0x92,
+    0x41, 0x87, 0x4d, 0x16, 0xd6, 0xc2, 0x62, 0x36, 0x29, 0xc4, 0xc2,
+    0xad, 0xdd, 0xf0, 0xdb, 0xa0, 0x1e, 0x6c, 0xe8, 0xa0, 0xdc },
+  { 0x61, 0x5f, 0xf8, 0x46, 0xd9, 0x93, 0x00, 0x7d, 0x38, 0xde, 0x1a,
+    0xec, 0xb3, 0x17, 0x82, 0x89, 0xde, 0xd0, 0x9e, 0x6b, 0xb5, 0xcb,
+    0xd6, 0x0f, 0x69, 0xc6, 0xaa, 0x36, 0x38, 0x30, 0x20, 0xf7 },
+  { 0xf0, 0xe4, 0x0b, 0x4e, 0xd4, 0x0d, 0x34, 0x85, 0x1e, 0x72, 0xb4,
+    0xee, 0x4d, 0x00, 0xea, 0x6a, 0x40, 0xea, 0x1c, 0x1b, 0xf9, 0xe5,
+    0xc2, 0x69, 0x71, 0x0c, 0x9d, 0x51, 0xcb, 0xb8, 0xa3, 0xc9 },
+  { 0x0b, 0x07, 0xb2, 0x33, 0x3b, 0x08, 0xd0, 0x8c, 0x11, 0xca, 0x34,
+    0xab, 0x44, 0x9b, 0x71, 0xd2, 0x9a, 0x0f, 0x43, 0xe1, 0xf7, 0x78,
+    0xe0, 0x73, 0xe7, 0x90, 0x06, 0xcc, 0xb7, 0x30, 0xed, 0x62 },
+  { 0xd1, 0xf4, 0xc2, 0x9d, 0x9f, 0x23, 0xea, 0x35, 0xec, 0x40, 0x35,
+    0xb3, 0x77, 0xd5, 0x06, 0x53, 0x8e, 0x72, 0x8b, 0xc7, 0x39, 0xc1,
+    0x45, 0x96, 0x80, 0xcf, 0x1c, 0xc6, 0x94, 0x24, 0x92, 0x4d },
+  { 0x12, 0x79, 0xcf, 0x6f, 0x66, 0x9f, 0x92, 0xf6, 0xbf, 0xc2, 0x5d,
+    0x60, 0x5b, 0x94, 0x40, 0xc7, 0xdc, 0xcb, 0xd2, 0x5d, 0xf2, 0x8d,
+    0xc7, 0x35, 0x3a, 0xbc, 0x1c, 0x05, 0x30, 0x40, 0x5d, 0xc4 },
+  { 0x1f, 0xa0, 0xaf, 0x00, 0x77, 0x5d, 0xc2, 0xce, 0x76, 0x50, 0x6d,
+    0x32, 0x80, 0xf4, 0x72, 0xd2, 0xf6, 0xff, 0x97, 0xa2, 0x15, 0x1f,
+    0xaa, 0x82, 0x79, 0x42, 0xfe, 0xa4, 0x4a, 0xd0, 0xba, 0x1f },
+  { 0x3e, 0x1a, 0xd5, 0x4a, 0x5f, 0x83, 0x5b, 0x98, 0x3b, 0xd2, 0xaa,
+    0xb0, 0xed, 0x2a, 0x4c, 0x0b, 0xdd, 0x72, 0x16, 0x20, 0x9c, 0x36,
+    0xa7, 0x9e, 0x9e, 0x2a, 0xab, 0xb9, 0x9f, 0xaf, 0x35, 0x12 },
+  { 0xc6, 0xed, 0x39, 0xe2, 0xd8, 0xb6, 0x36, 0xec, 0xcb, 0xa2, 0x45,
+    0xef, 0x4e, 0x88, 0x64, 0xf4, 0xcd, 0x94, 0x6b, 0xe2, 0x16, 0xb9,
+    0xbe, 0x48, 0x30, 0x3e, 0x08, 0xb9, 0x2d, 0xd0, 0x94, 0x34 },
+  { 0xe2, 0x47, 0x36, 0xc1, 0x3e, 0xcb, 0x9f, 0x36, 0xa0, 0xd8, 0x29,
+    0xd4, 0x79, 0x8d, 0x76, 0x99, 0xc1, 0x4c, 0xc6, 0x5b, 0x6d, 0xc4,
+    0x4e, 0xd6, 0xf1, 0x0c, 0xd4, 0x85, 0x3d, 0x6e, 0x07, 0x57 },
+  { 0x38, 0x9b, 0xe8, 0x80, 0x52, 0xa3, 0x81, 0x27, 0x2c, 0x6d, 0xf7,
+    0x41, 0xa8, 0x8a, 0xd3, 0x49, 0xb7, 0x12, 0x71, 0x84, 0x35, 0x48,
+    0x0a, 0x81, 0x90, 0xb7, 0x04, 0x77, 0x1d, 0x2d, 0xe6, 0x37 },
+  { 0x88, 0x9f, 0x2d, 0x57, 0x8a, 0x5d, 0xae, 0xfd, 0x34, 0x1c, 0x21,
+    0x09, 0x84, 0xe1, 0x26, 0xd1, 0xd9, 0x6d, 0xa2, 0xde, 0xe3, 0xc8,
+    0x1f, 0x7a, 0x60, 0x80, 0xbf, 0x84, 0x56, 0x9b, 0x31, 0x14 },
+  { 0xe9, 0x36, 0x09, 0x5b, 0x9b, 0x98, 0x2f, 0xfc, 0x85, 0x6d, 0x2f,
+    0x52, 0x76, 0xa4, 0xe5, 0x29, 0xec, 0x73, 0x95, 0xda, 0x31, 0x6d,
+    0x62, 0x87, 0x02, 0xfb, 0x28, 0x1a, 0xda, 0x6f, 0x38, 0x99 },
+  { 0xef, 0x89, 0xce, 0x1d, 0x6f, 0x8b, 0x48, 0xea, 0x5c, 0xd6, 0xae,
+    0xab, 0x6a, 0x83, 0xd0, 0xcc, 0x98, 0xc9, 0xa3, 0xa2, 0x07, 0xa1,
+    0x08, 0x57, 0x32, 0xf0, 0x47, 0xd9, 0x40, 0x38, 0xc2, 0x88 },
+  { 0xf9, 0x25, 0x01, 0x6d, 0x79, 0xf2, 0xac, 0xa8, 0xc4, 0x9e, 0xdf,
+    0xcd, 0x66, 0x21, 0xd5, 0xbe, 0x3c, 0x8c, 0xec, 0x61, 0xbd, 0x58,
+    0x71, 0xd8, 0xc1, 0xd3, 0xa5, 0x65, 0xf3, 0x5e, 0x0c, 0x9f },
+  { 0x63, 0xe8, 0x63, 0x4b, 0x75, 0x7a, 0x38, 0xf9, 0x2b, 0x92, 0xfd,
+    0x23, 0x89, 0x3b, 0xa2, 0x99, 0x85, 0x3a, 0x86, 0x13, 0x67, 0x9f,
+    0xdf, 0x7e, 0x05, 0x11, 0x09, 0x5c, 0x0f, 0x04, 0x7b, 0xca },
+  { 0xcf, 0x2c, 0xca, 0x07, 0x72, 0xb7, 0x05, 0xeb, 0x57, 0xd2, 0x89,
+    0x43, 0xf8, 0x3d, 0x35, 0x3f, 0xe2, 0x91, 0xe5, 0xb3, 0x77, 0x78,
+    0x0b, 0x37, 0x4c, 0x8b, 0xa4, 0x66, 0x58, 0x30, 0xbe, 0x87 },
+  { 0x46, 0xdf, 0x5b, 0x87, 0xc8, 0x0e, 0x7e, 0x40, 0x74, 0xae, 0xe6,
+    0x85, 0x59, 0x42, 0x47, 0x42, 0x84, 0x5b, 0x9b, 0x35, 0x0f, 0x51,
+    0xba, 0x55, 0xb0, 0x74, 0xbb, 0xae, 0x4c, 0x62, 0x6a, 0xab },
+  { 0x65, 0x8a, 0xa4, 0xf9, 0xd2, 0xbc, 0xbd, 0x4f, 0x7f, 0x8e, 0xb6,
+    0x3e, 0x68, 0xf5, 0x36, 0x7e, 0xdb, 0xc5, 0x00, 0xa0, 0xb1, 0xfb,
+    0xb4, 0x1e, 0x9d, 0xf1, 0x41, 0xbc, 0xba, 0x8f, 0xcd, 0x53 },
+  { 0xee, 0x80, 0x55, 0x50, 0x08, 0xa7, 0x16, 0x55, 0xe0, 0x81, 0x09,
+    0x2b, 0xba, 0x6f, 0x67, 0x0e, 0xd9, 0x8a, 0xf9, 0xa0, 0x9f, 0xb5,
+    0xaf, 0xb9, 0x4c, 0xbc, 0x5c, 0x75, 0x48, 0x14, 0xdb, 0x4f },
+  { 0x2c, 0x5f, 0x9d, 0x04, 0x82, 0x20, 0xb0, 0x41, 0xb6, 0xd4, 0x52,
+    0x4b, 0x44, 0x90, 0xcf, 0x8c, 0x66, 0xfc, 0xb8, 0xe1, 0x4b, 0x0d,
+    0x64, 0x88, 0x7a, 0xa1, 0xe4, 0x76, 0x1a, 0x60, 0x2b, 0x39 },
+  { 0x44, 0xcb, 0x63, 0x11, 0xd0, 0x75, 0x0b, 0x7e, 0x33, 0xf7, 0x33,
+    0x3a, 0xa7, 0x8a, 0xac, 0xa9, 0xc3, 0x4a, 0xd5, 0xf7, 0x9c, 0x1b,
+    0x15, 0x91, 0xec, 0x33, 0x95, 0x1e, 0x69, 0xc4, 0xc4, 0x61 },
+  { 0x0c, 0x6c, 0xe3, 0x2a, 0x3e, 0xa0, 0x56, 0x12, 0xc5, 0xf8, 0x09,
+    0x0f, 0x6a, 0x7e, 0x87, 0xf5, 0xab, 0x30, 0xe4, 0x1b, 0x70, 0x7d,
+    0xcb, 0xe5, 0x41, 0x55, 0x62, 0x0a, 0xd7, 0x70, 0xa3, 0x40 },
+  { 0xc6, 0x59, 0x38, 0xdd, 0x3a, 0x05, 0x3c, 0x72, 0x9c, 0xf5, 0xb7,
+    0xc8, 0x9f, 0x39, 0x0b, 0xfe, 0xbb, 0x51, 0x12, 0x76, 0x6b, 0xb0,
+    0x0a, 0xa5, 0xfa, 0x31, 0x64, 0xdf, 0xdf, 0x3b, 0x56, 0x47 },
+  { 0x7d, 0xe7, 0xf0, 0xd5, 0x9a, 0x90, 0x39, 0xaf, 0xf3, 0xaa, 0xf3,
+    0x2c, 0x3e, 0xe5, 0x2e, 0x79, 0x17, 0x53, 0x57, 0x29, 0x06, 0x21,
+    0x68, 0xd2, 0x49, 0x0b, 0x6b, 0x6c, 0xe2, 0x44, 0xb3, 0x80 },
+  { 0x89, 0x58, 0x98, 0xf5, 0x3a, 0x8f, 0x39, 0xe4, 0x24, 0x10, 0xda,
+    0x77, 0xb6, 0xc4, 0x81, 0x5b, 0x0b, 0xb2, 0x39, 0x5e, 0x39, 0x22,
+    0xf5, 0xbe, 0xd0, 0xe1, 0xfb, 0xf2, 0xa4, 0xc6, 0xdf, 0xeb },
+  { 0xc9, 0x05, 0xa8, 0x49, 0x84, 0x34, 0x8a, 0x64, 0xdb, 0x1f, 0x54,
+    0x20, 0x83, 0x74, 0x8a, 0xd9, 0x0a, 0x4b, 0xad, 0x98, 0x33, 0xcb,
+    0x6d, 0xa3, 0x87, 0x29, 0x34, 0x31, 0xf1, 0x9e, 0x7c, 0x9c },
+  { 0xed, 0x37, 0xd1, 0xa4, 0xd0, 0x6c, 0x90, 0xd1, 0x95, 0x78, 0x48,
+    0x66, 0x7e, 0x95, 0x48, 0xfe, 0xbb, 0x5d, 0x42, 0x3e, 0xab, 0x4f,
+    0x56, 0x78, 0x5c, 0xc4, 0xb5, 0x41, 0x6b, 0x78, 0x00, 0x08 },
+  { 0x0b, 0xc6, 0x5d, 0x99, 0x97, 0xfb, 0x73, 0x4a, 0x56, 0x1f, 0xb1,
+    0xe9, 0xf8, 0xc0, 0x95, 0x8a, 0x02, 0xc7, 0xa4, 0xdb, 0xd0, 0x96,
+    0xeb, 0xef, 0x1a, 0x17, 0x51, 0xae, 0xd9, 0x59, 0xee, 0xd7 },
+  { 0x7c, 0x5f, 0x43, 0x2e, 0xb8, 0xb7, 0x35, 0x2a, 0x94, 0x94, 0xde,
+    0xa4, 0xd5, 0x3c, 0x21, 0x38, 0x70, 0x31, 0xce, 0x70, 0xe8, 0x5d,
+    0x94, 0x08, 0xfc, 0x6f, 0x8c, 0xd9, 0x8a, 0x6a, 0xaa, 0x1e },
+  { 0xb8, 0xbf, 0x8e, 0x2c, 0x34, 0xe0, 0x33, 0x98, 0x36, 0x39, 0x90,
+    0x9e, 0xaa, 0x37, 0x64, 0x0d, 0x87, 0x7b, 0x04, 0x8f, 0xe2, 0x99,
+    0xb4, 0x70, 0xaf, 0x2d, 0x0b, 0xa8, 0x2a, 0x5f, 0x14, 0xc0 },
+  { 0x88, 0xa9, 0xdd, 0x13, 0xd5, 0xda, 0xdb, 0xde, 0xe6, 0xbf, 0xf7,
+    0xee, 0x1e, 0xf8, 0xc7, 0x1c, 0xc1, 0x93, 0xaa, 0x4b, 0xf3, 0xe8,
+    0x4f, 0x8f, 0xe8, 0x0c, 0xb0, 0x75, 0x68, 0x3c, 0x07, 0x79 },
+  { 0x9a, 0xed, 0xb8, 0x87, 0x6d, 0xd2, 0x1c, 0x8c, 0x84, 0xd2, 0xe7,
+    0x02, 0xa1, 0x36, 0x25, 0x98, 0x04, 0x62, 0xf6, 0x8b, 0xf0, 0xa1,
+    0xb7, 0x25, 0x4a, 0xd8, 0x06, 0xc3, 0x84, 0x03, 0xc9, 0xde },
+  { 0xd0, 0x97, 0x57, 0x3d, 0xf2, 0xd6, 0xb2, 0x48, 0x9a, 0x47, 0x94,
+    0x84, 0x86, 0x98, 0x00, 0xa1, 0xf8, 0x33, 0xea, 0x16, 0x9e, 0xff,
+    0x32, 0xae, 0x3c, 0xe6, 0x3a, 0x20, 0x79, 0x54, 0x8d, 0x78 },
+  { 0xd1, 0x8f, 0x27, 0xa3, 0xe5, 0x55, 0xd7, 0xf9, 0x1a, 0x00, 0x7c,
+    0x67, 0xac, 0xee, 0xde, 0x39, 0x1f, 0x75, 0xa6, 0x1f, 0xa4, 0x2a,
+    0x0b, 0x45, 0x66, 0xeb, 0x58, 0x2c, 0xa0, 0x5e, 0xbc, 0xe7 },
+  { 0xdf, 0x1d, 0xaa, 0x90, 0xb1, 0x70, 0x23, 0x13, 0xe6, 0xa5, 0x90,
+    0x1c, 0x7a, 0xfc, 0x5e, 0xd9, 0x65, 0x77, 0x17, 0xa7, 0x15, 0xfa,
+    0x53, 0xa4, 0x18, 0x9e, 0xc1, 0xe5, 0xdf, 0x29, 0x3a, 0x68 },
+  { 0x04, 0xe3, 0xa4, 0x96, 0xb6, 0x69, 0x96, 0xc6, 0x6e, 0x32, 0x91,
+    0x9e, 0xd1, 0xf9, 0x4c, 0x36, 0xee, 0xbb, 0xf2, 0x40, 0x63, 0x3a,
+    0x2f, 0x73, 0x98, 0x45, 0xf0, 0x29, 0x5d, 0x34, 0xaf, 0xba },
+  { 0x8c, 0x45, 0xd8, 0x8c, 0x4e, 0x9c, 0x9d, 0x0c, 0x8c, 0x67, 0x7f,
+    0xe4, 0x8f, 0xa5, 0x44, 0x9b, 0xa3, 0x01, 0x78, 0xd4, 0x0a, 0xf0,
+    0xf0, 0x21, 0x79, 0x21, 0xc6, 0x2e, 0x4b, 0x60, 0xcd, 0xd3 },
+  { 0xe1, 0x49, 0xa6, 0xb1, 0x3b, 0xde, 0xde, 0xa2, 0xee, 0xee, 0x00,
+    0x9c, 0xe9, 0x44, 0x5e, 0x8d, 0xcf, 0x76, 0xb7, 0x6e, 0x55, 0xa5,
+    0x01, 0xd8, 0xf5, 0xb4, 0x3f, 0xf8, 0x96, 0x79, 0x6a, 0xd1 },
+  { 0xa8, 0x37, 0xc4, 0xc7, 0xc6, 0xf5, 0xcf, 0xb9, 0x9e, 0x10, 0x85,
+    0xfd, 0x43, 0x28, 0x7a, 0x41, 0x05, 0xcb, 0x28, 0xb7, 0x6f, 0xc3,
+    0x8b, 0x60, 0x55, 0xc5, 0xdc, 0xff, 0x78, 0xb8, 0x25, 0x65 },
+  { 0x42, 0x41, 0x1f, 0x28, 0x78, 0x0b, 0x4f, 0x16, 0x38, 0x54, 0x0b,
+    0x87, 0x05, 0x21, 0xec, 0x45, 0xbc, 0xeb, 0x1e, 0x0c, 0x71, 0x31,
+    0xf7, 0xe1, 0xc4, 0x67, 0x2e, 0x43, 0x6c, 0x88, 0xc8, 0xe9 },
+  { 0x34, 0xb4, 0xe8, 0x76, 0x76, 0x94, 0x71, 0xdf, 0x55, 0x2e, 0x55,
+    0x22, 0xce, 0xa7, 0x84, 0xfa, 0x53, 0xac, 0x61, 0xbe, 0xde, 0x8c,
+    0xfe, 0x29, 0x14, 0x09, 0xe6, 0x8b, 0x69, 0xe8, 0x77, 0x6f },
+  { 0x8f, 0x31, 0xd6, 0x37, 0xa9, 0x1d, 0xbd, 0x0e, 0xcb, 0x0b, 0xa0,
+    0xe6, 0x94, 0xbe, 0xc1, 0x44, 0x76, 0x58, 0xce, 0x6c, 0x27, 0xea,
+    0x9b, 0x95, 0xff, 0x36, 0x70, 0x1c, 0xaf, 0x36, 0xf0, 0x01 },
+  { 0xb5, 0xc8, 0x95, 0xeb, 0x07, 0x1e, 0x3d, 0x38, 0x52, 0x8d, 0x47,
+    0x5d, 0x3b, 0xb0, 0xba, 0x88, 0xb7, 0x17, 0x95, 0xe4, 0x0a, 0x98,
+    0x2e, 0x2a, 0xc2, 0xd8, 0x44, 0x22, 0xa0, 0xf2, 0x68, 0x5d },
+  { 0xe9, 0x06, 0x25, 0x7c, 0x41, 0x9d, 0x94, 0x1e, 0xd2, 0xb8, 0xa9,
+    0xc1, 0x27, 0x81, 0xdb, 0x97, 0x59, 0xa3, 0xfc, 0xf3, 0xdc, 0x7c,
+    0xdb, 0x03, 0x15, 0x99, 0xe1, 0x08, 0x6b, 0x67, 0x2f, 0x10 },
+  { 0x98, 0xad, 0x24, 0x39, 0x7c, 0x6e, 0xae, 0x4c, 0xf7, 0x3e, 0xa8,
+    0xbb, 0xef, 0x5a, 0x0b, 0x74, 0xd2, 0x1a, 0xd1, 0x5f, 0x33, 0x92,
+    0x0f, 0x44, 0x07, 0x0a, 0x98, 0xbd, 0xf5, 0x3d, 0x0b, 0x3a },
+  { 0xdd, 0x51, 0x0c, 0xa5, 0x5b, 0x11, 0x70, 0xf9, 0xce, 0xfd, 0xbb,
+    0x16, 0xfc, 0x14, 0x52, 0x62, 0xaa, 0x36, 0x3a, 0x87, 0x0a, 0x01,
+    0xe1, 0xbc, 0x4f, 0xbe, 0x40, 0x23, 0x4b, 0x4b, 0x6f, 0x2f },
+  { 0xf2, 0xd8, 0xd9, 0x31, 0xb9, 0x2e, 0x1c, 0xb6, 0x98, 0xe5, 0x6e,
+    0xd0, 0x28, 0x19, 0xea, 0x11, 0xd2, 0x66, 0x19, 0xb8, 0x3a, 0x62,
+    0x09, 0xad, 0x67, 0x22, 0x53, 0x68, 0xfe, 0x11, 0x95, 0x71 },
+  { 0xe4, 0x63, 0x70, 0x55, 0xdb, 0x91, 0xf9, 0x43, 0x7c, 0xf4, 0x60,
+    0xef, 0x40, 0xb5, 0x14, 0x5f, 0x69, 0x98, 0x26, 0x6a, 0x5e, 0x74,
+    0xe9, 0x6a, 0x00, 0x78, 0x2c, 0x62, 0xcf, 0x30, 0xcf, 0x1c },
+  { 0x35, 0x63, 0x53, 0x0a, 0x89, 0xd3, 0x2b, 0x75, 0xf7, 0x8d, 0x83,
+    0xe9, 0x87, 0x2a, 0xd4, 0xc5, 0x75, 0xf5, 0x20, 0x39, 0x9d, 0x65,
+    0x03, 0x5d, 0xed, 0x99, 0xe5, 0xee, 0xc5, 0x80, 0x71, 0x50 },
+  { 0x8e, 0x79, 0xf9, 0x2c, 0x86, 0x5b, 0xeb, 0x3e, 0x1c, 0xdb, 0xf0,
+    0x8f, 0x75, 0x4a, 0x26, 0x06, 0xe8, 0x53, 0x49, 0x05, 0x3d, 0x66,
+    0xd6, 0x16, 0x02, 0x4a, 0x81, 0x3f, 0xca, 0x54, 0x1a, 0x4d },
+  { 0x86, 0x42, 0x26, 0xf2, 0x83, 0x9c, 0x76, 0xb1, 0xd5, 0xf7, 0xc1,
+    0x3d, 0x98, 0xc2, 0xa5, 0x15, 0x8c, 0x2a, 0xbb, 0x71, 0xd9, 0xd8,
+    0xf0, 0xfa, 0x1f, 0x7c, 0x3f, 0x74, 0x68, 0x00, 0x16, 0x03 },
+  { 0xd3, 0xe3, 0xf5, 0xb8, 0xce, 0xeb, 0xb1, 0x11, 0x84, 0x80, 0x35,
+    0x35, 0x90, 0x0b, 0x6e, 0xed, 0xda, 0x60, 0x6e, 0xeb, 0x36, 0x97,
+    0x51, 0xa7, 0xcd, 0xa3, 0x6c, 0xa3, 0x02, 0x29, 0xfb, 0x02 },
+  { 0x8c, 0x7d, 0x6b, 0x98, 0x72, 0x69, 0x16, 0x90, 0x31, 0xf7, 0x1f,
+    0xd7, 0xe4, 0xc4, 0x45, 0x01, 0x2d, 0x3e, 0x6a, 0x3c, 0x88, 0x09,
+    0xf6, 0x47, 0x9b, 0xd6, 0x67, 0xcf, 0x31, 0x1e, 0x27, 0x6e },
+  { 0xb9, 0x04, 0xb5, 0x71, 0x1b, 0xf1, 0x9e, 0x85, 0x32, 0xf7, 0xad,
+    0x64, 0x27, 0x41, 0x0a, 0x62, 0xa1, 0xf7, 0x7f, 0x77, 0xb9, 0xb6,
+    0xd7, 0x1d, 0x2f, 0xc4, 0x3b, 0xc9, 0x0f, 0x73, 0x23, 0x5a },
+  { 0x45, 0x36, 0x63, 0x43, 0x15, 0xc8, 0x67, 0x28, 0xf5, 0xab, 0x74,
+    0x49, 0xeb, 0x2d, 0x04, 0x02, 0x0e, 0x9e, 0xae, 0x8d, 0xd6, 0x79,
+    0x55, 0x00, 0xe9, 0xec, 0x9a, 0x00, 0x66, 0x38, 0x6e, 0x69 },
+  { 0xfd, 0x5e, 0x49, 0xfe, 0xd4, 0x9d, 0xc4, 0x4b, 0xde, 0x89, 0xf4,
+    0x60, 0xa9, 0x50, 0x19, 0x1e, 0xbb, 0x06, 0x7c, 0x69, 0x8a, 0x3f,
+    0x21, 0xea, 0x14, 0x30, 0x8c, 0x74, 0x13, 0xb9, 0x16, 0x81 },
+  { 0x31, 0xf0, 0x1d, 0x03, 0x0b, 0x9b, 0x22, 0xd0, 0x0a, 0x0f, 0x71,
+    0xed, 0x2c, 0xeb, 0x5d, 0x2d, 0xc8, 0x1a, 0xf2, 0xc2, 0x4b, 0xf5,
+    0x67, 0x0f, 0xde, 0x19, 0xa6, 0x85, 0xe8, 0xd1, 0x39, 0x2e },
+  { 0x5f, 0x84, 0xd9, 0xde, 0x28, 0x4b, 0x1e, 0x4f, 0x67, 0x8e, 0x31,
+    0xab, 0x6a, 0x76, 0xf5, 0x66, 0x1b, 0x5a, 0xea, 0xa7, 0x68, 0x53,
+    0x93, 0x84, 0xaa, 0x38, 0xf9, 0xe4, 0x9c, 0xce, 0x6e, 0x6e },
+  { 0xb2, 0x07, 0x9e, 0x59, 0x97, 0xa4, 0xea, 0xd3, 0xa7, 0x1f, 0xef,
+    0xc0, 0x2f, 0x90, 0xa7, 0x48, 0x3a, 0x10, 0xfd, 0x2e, 0x6f, 0x31,
+    0xbd, 0xa9, 0xd2, 0x08, 0x44, 0x85, 0xcc, 0x01, 0x6b, 0xbd },
+  { 0xe0, 0xf8, 0x4d, 0x7f, 0x52, 0x5b, 0x6f, 0xed, 0x79, 0x1f, 0x77,
+    0x28, 0x9a, 0xe5, 0x8f, 0x7d, 0x50, 0xa2, 0x94, 0x32, 0xd4, 0x2c,
+    0x25, 0xc1, 0xe8, 0x39, 0x29, 0xb8, 0x38, 0x89, 0x1d, 0x79 },
+  { 0x70, 0x46, 0x96, 0x90, 0x95, 0x6d, 0x79, 0x18, 0xac, 0xe7, 0xba,
+    0x5f, 0x41, 0x30, 0x2d, 0xa1, 0x38, 0xc9, 0xb5, 0x6e, 0xcd, 0x41,
+    0x55, 0x44, 0xfa, 0xce, 0x8d, 0x99, 0x8c, 0x21, 0xab, 0xeb },
+  { 0x45, 0xc9, 0x1a, 0x62, 0x24, 0x9b, 0x39, 0xcd, 0xa9, 0x4e, 0x50,
+    0x82, 0x95, 0xbe, 0xc7, 0x66, 0x71, 0x19, 0x44, 0x77, 0x65, 0xef,
+    0x80, 0xef, 0xa8, 0x2d, 0x1e, 0x92, 0xd5, 0x70, 0x67, 0xd8 },
+  { 0x1d, 0x9e, 0x00, 0x73, 0xee, 0xd0, 0x73, 0x15, 0x54, 0xc3, 0xbe,
+    0xaa, 0x47, 0x46, 0x0d, 0x51, 0x1a, 0xd2, 0x61, 0xdd, 0x4d, 0x4a,
+    0x3b, 0xed, 0x9d, 0x8d, 0x20, 0x2f, 0x22, 0xf2, 0x15, 0x89 },
+  { 0x40, 0x82, 0x62, 0x73, 0x6d, 0x8a, 0xec, 0x0b, 0x84, 0x7d, 0xba,
+    0x25, 0x02, 0x58, 0x60, 0x8a, 0x43, 0x45, 0xa6, 0x3a, 0x1e, 0xb1,
+    0x95, 0xe5, 0xc7, 0xae, 0x2e, 0xe8, 0x74, 0xc3, 0x4d, 0xa8 },
+  { 0x23, 0xd2, 0xb7, 0x04, 0x39, 0x46, 0x99, 0x49, 0x98, 0x23, 0x90,
+    0x53, 0x8d, 0x7e, 0x5a, 0xde, 0x9f, 0x18, 0xc8, 0xe3, 0xbb, 0xf6,
+    0x60, 0x5a, 0xfc, 0xf4, 0x9b, 0x00, 0xc0, 0x61, 0xe8, 0x37 },
+  { 0x23, 0x2f, 0xb1, 0x87, 0xd2, 0x71, 0xbe, 0xa9, 0x12, 0xef, 0xd4,
+    0x07, 0xff, 0xe0, 0x80, 0x56, 0xd6, 0xa4, 0x2e, 0x53, 0x21, 0xec,
+    0x79, 0x2d, 0xf3, 0xd5, 0x84, 0xa9, 0x4f, 0x63, 0x0a, 0xb2 },
+  { 0x13, 0x8e, 0x19, 0x44, 0xe4, 0xb5, 0x4d, 0xe8, 0x68, 0x1d, 0x7e,
+    0x48, 0xc4, 0xf0, 0x81, 0x48, 0xe4, 0x0a, 0x56, 0x7e, 0x5c, 0xad,
+    0x94, 0x6a, 0x6a, 0xf4, 0xe8, 0xd5, 0xd2, 0x6f, 0x75, 0xc7 },
+  { 0x80, 0xc1, 0x51, 0x32, 0x5f, 0xbf, 0xc6, 0x78, 0xb7, 0xbe, 0x4e,
+    0x40, 0xb3, 0x0f, 0x29, 0xfe, 0x31, 0xcd, 0xbe, 0x1c, 0x84, 0x12,
+    0x6e, 0x00, 0x6d, 0xf3, 0xc1, 0x85, 0x24, 0xbd, 0x2d, 0x6c },
+  { 0xa6, 0x42, 0x26, 0x73, 0x01, 0x66, 0x9d, 0xf2, 0x61, 0xb8, 0x39,
+    0xf8, 0x73, 0x65, 0x76, 0x29, 0x05, 0xff, 0x32, 0x0a, 0x0a, 0x2f,
+    0xc4, 0xbd, 0xc4, 0x8e, 0x5a, 0x8e, 0x15, 0xd1, 0x32, 0x33 },
+  { 0x0f, 0x8b, 0x10, 0x99, 0x38, 0x60, 0x93, 0x7a, 0x74, 0xcc, 0x2d,
+    0xe4, 0x0a, 0x27, 0x31, 0xdd, 0x99, 0x54, 0xb6, 0x54, 0xbb, 0x94,
+    0xc3, 0x4e, 0x87, 0x66, 0x52, 0xe9, 0x8d, 0x4b, 0xbd, 0x16 },
+  { 0xe6, 0x34, 0xa5, 0x85, 0x12, 0x49, 0x32, 0x73, 0x26, 0x0f, 0x10,
+    0xd4, 0x49, 0x53, 0xcd, 0x99, 0x8e, 0x34, 0xcb, 0x82, 0x81, 0xc4,
+    0x1b, 0xf4, 0x2e, 0x0a, 0xe2, 0xf2, 0x5c, 0xbd, 0x1f, 0x75 },
+  { 0xbd, 0xe6, 0xaf, 0x9b, 0xaf, 0x3c, 0x07, 0xe9, 0x54, 0x23, 0xca,
+    0xb5, 0x04, 0xde, 0xe7, 0x0e, 0xdc, 0xc3, 0x31, 0x8b, 0x22, 0xdd,
+    0x1e, 0xb6, 0xfd, 0x85, 0xbe, 0x44, 0x7a, 0xc9, 0xf2, 0x09 },
+  { 0x91, 0x4b, 0x37, 0xab, 0x5b, 0x8c, 0xfd, 0xe6, 0xa4, 0x80, 0x46,
+    0x6a, 0x0d, 0x82, 0x43, 0x2c, 0x7d, 0x76, 0x32, 0x8e, 0x9a, 0x88,
+    0xef, 0x5b, 0x4f, 0x52, 0x42, 0x9f, 0x7a, 0x3f, 0xfc, 0x7d },
+  { 0x55, 0xbe, 0x66, 0xe9, 0xa5, 0xaa, 0x67, 0x1a, 0x23, 0x88, 0x2e,
+    0xf3, 0xe7, 0xd9, 0xd3, 0x6e, 0xa9, 0x54, 0x87, 0xdc, 0x71, 0xb7,
+    0x25, 0xa5, 0xad, 0x4b, 0x79, 0x8a, 0x87, 0x91, 0x43, 0xd0 },
+  { 0x3f, 0xd0, 0x45, 0x89, 0x4b, 0x83, 0x6e, 0x44, 0xe9, 0xca, 0x75,
+    0xfb, 0xe3, 0xea, 0xdc, 0x48, 0x6c, 0xbb, 0xd0, 0xd8, 0xce, 0xe1,
+    0xb3, 0xcf, 0x14, 0xf7, 0x6e, 0x7f, 0x1e, 0x77, 0xae, 0xf3 },
+  { 0xce, 0x60, 0x34, 0x3d, 0xc4, 0x87, 0x4b, 0x66, 0x04, 0xe1, 0xfb,
+    0x23, 0x1e, 0x37, 0xec, 0x1e, 0xec, 0x3f, 0x06, 0x56, 0x6e, 0x42,
+    0x8a, 0xe7, 0x64, 0xef, 0xff, 0xa2, 0x30, 0xad, 0xd4, 0x85 },
+  { 0xe3, 0x8c, 0x9d, 0xf0, 0x24, 0xde, 0x21, 0x53, 0xd2, 0x26, 0x73,
+    0x8a, 0x0e, 0x5b, 0xa9, 0xb8, 0xc6, 0x78, 0x4d, 0xac, 0xa6, 0x5c,
+    0x22, 0xa7, 0x62, 0x8e, 0xb5, 0x8e, 0xa0, 0xd4, 0x95, 0xa7 },
+  { 0x8d, 0xfe, 0xc0, 0xd4, 0xf3, 0x65, 0x8a, 0x20, 0xa0, 0xba, 0xd6,
+    0x6f, 0x21, 0x60, 0x83, 0x2b, 0x16, 0x4e, 0x70, 0x0a, 0x21, 0xec,
+    0x5a, 0x01, 0x65, 0xc3, 0x67, 0x72, 0xb2, 0x08, 0x61, 0x11 },
+  { 0x44, 0x01, 0xb5, 0x0e, 0x09, 0x86, 0x5f, 0x42, 0x38, 0x24, 0x3b,
+    0x82, 0x25, 0xca, 0x40, 0xa0, 0x8d, 0xbb, 0x46, 0x85, 0xf5, 0xf8,
+    0x62, 0xfb, 0xdd, 0x72, 0x98, 0x04, 0x31, 0xa8, 0x5d, 0x3f },
+  { 0x86, 0x68, 0x94, 0x27, 0x88, 0xc4, 0xce, 0x8a, 0x33, 0x19, 0x0f,
+    0xfc, 0xfa, 0xd1, 0xc6, 0x78, 0xc4, 0xfa, 0x41, 0xe9, 0x94, 0x17,
+    0x09, 0x4e, 0x24, 0x0f, 0x4a, 0x43, 0xf3, 0x87, 0xa3, 0xb6 },
+  { 0xa7, 0x28, 0x8d, 0x5e, 0x09, 0x80, 0x9b, 0x69, 0x69, 0x84, 0xec,
+    0xd5, 0x32, 0x6c, 0xdd, 0x84, 0xfb, 0xe3, 0x5f, 0xcf, 0x67, 0x23,
+    0x5d, 0x81, 0x1c, 0x82, 0x00, 0x25, 0x36, 0xa3, 0xc5, 0xe1 },
+  { 0x8e, 0x92, 0x5c, 0x3c, 0x14, 0x6b, 0xac, 0xf3, 0x35, 0x1e, 0xc5,
+    0x32, 0x41, 0xac, 0xe5, 0xf7, 0x3e, 0x8f, 0xc9, 0xbd, 0x8c, 0x61,
+    0xca, 0xd9, 0x7f, 0xd7, 0x72, 0xb0, 0x7e, 0x1b, 0x83, 0x73 },
+  { 0xc7, 0xeb, 0x9e, 0x6d, 0xed, 0x2f, 0x99, 0x3d, 0x48, 0xb0, 0x17,
+    0x0d, 0xa2, 0x7c, 0x5b, 0x75, 0x3b, 0x12, 0x17, 0x6b, 0xe1, 0x26,
+    0xc7, 0xba, 0x2d, 0x6a, 0xf8, 0x5f, 0x85, 0x93, 0xb7, 0x52 },
+  { 0xca, 0x27, 0xf1, 0x6f, 0x94, 0xe4, 0xec, 0x0e, 0x62, 0x8e, 0x7f,
+    0x8a, 0xef, 0xc6, 0x65, 0x7b, 0xed, 0xc9, 0x37, 0x42, 0x96, 0x59,
+    0x40, 0xae, 0x78, 0x6a, 0x73, 0xb5, 0xfd, 0x59, 0x3b, 0x97 },
+  { 0x8c, 0x21, 0xe6, 0x56, 0x8b, 0xc6, 0xdc, 0x00, 0xe3, 0xd6, 0xeb,
+    0xc0, 0x9e, 0xa9, 0xc2, 0xce, 0x00, 0x6c, 0xd3, 0x11, 0xd3, 0xb3,
+    0xe9, 0xcc, 0x9d, 0x8d, 0xdb, 0xfb, 0x3c, 0x5a, 0x77, 0x76 },
+  { 0x52, 0x56, 0x66, 0x96, 0x8b, 0x3b, 0x7d, 0x00, 0x7b, 0xb9, 0x26,
+    0xb6, 0xef, 0xdc, 0x7e, 0x21, 0x2a, 0x31, 0x15, 0x4c, 0x9a, 0xe1,
+    0x8d, 0x43, 0xee, 0x0e, 0xb7, 0xe6, 0xb1, 0xa9, 0x38, 0xd3 },
+  { 0xe0, 0x9a, 0x4f, 0xa5, 0xc2, 0x8b, 0xdc, 0xd7, 0xc8, 0x39, 0x84,
+    0x0e, 0x0a, 0x38, 0x3e, 0x4f, 0x7a, 0x10, 0x2d, 0x0b, 0x1b, 0xc8,
+    0x49, 0xc9, 0x49, 0x62, 0x7c, 0x41, 0x00, 0xc1, 0x7d, 0xd3 },
+  { 0xc1, 0x9f, 0x3e, 0x29, 0x5d, 0xb2, 0xfc, 0x0e, 0x74, 0x81, 0xc4,
+    0xf1, 0x6a, 0xf0, 0x11, 0x55, 0xdd, 0xb0, 0xd7, 0xd1, 0x38, 0x3d,
+    0x4a, 0x1f, 0xf1, 0x69, 0x9d, 0xb7, 0x11, 0x77, 0x34, 0x0c },
+  { 0x76, 0x9e, 0x67, 0x8c, 0x0a, 0x09, 0x09, 0xa2, 0x02, 0x1c, 0x4d,
+    0xc2, 0x6b, 0x1a, 0x3c, 0x9b, 0xc5, 0x57, 0xad, 0xb2, 0x1a, 0x50,
+    0x83, 0x4c, 0xdc, 0x5c, 0x92, 0x93, 0xf7, 0x53, 0x65, 0xf8 },
+  { 0xb6, 0x48, 0x74, 0xad, 0xab, 0x6b, 0xcb, 0x85, 0xb9, 0x4b, 0xd9,
+    0xa6, 0xc5, 0x65, 0xd0, 0xd2, 0xbc, 0x35, 0x44, 0x5d, 0x75, 0x28,
+    0xbc, 0x85, 0xb4, 0x1f, 0xdc, 0x79, 0xdc, 0x76, 0xe3, 0x4f },
+  { 0xfa, 0xf2, 0x50, 0xde, 0x15, 0x82, 0x0f, 0x7f, 0xc6, 0x10, 0xdd,
+    0x53, 0xee, 0xae, 0x44, 0x60, 0x1c, 0x3e, 0xff, 0xa3, 0xac, 0xcd,
+    0x08, 0x8e, 0xb6, 0x69, 0x05, 0xbb, 0x26, 0x53, 0xbe, 0x8c },
+  { 0x1e, 0x20, 0x38, 0x73, 0x9b, 0x2c, 0x01, 0x8b, 0x0e, 0x9e, 0x0e,
+    0x1e, 0x52, 0x2f, 0xd9, 0x65, 0x12, 0x87, 0xee, 0x6e, 0x36, 0x65,
+    0x91, 0x9b, 0x24, 0xc2, 0x12, 0x4f, 0x0c, 0x1a, 0x3f, 0x3a },
+  { 0x5f, 0xec, 0x3a, 0xa0, 0x08, 0x61, 0xde, 0x1a, 0xc5, 0xda, 0xb3,
+    0xc1, 0x37, 0x06, 0x5d, 0x1e, 0x01, 0xbb, 0x03, 0xf6, 0x9d, 0xcc,
+    0x7d, 0x1c, 0xf7, 0xca, 0x4f, 0x43, 0x56, 0xae, 0xc9, 0xa3 },
+  { 0x44, 0x51, 0xfe, 0x6b, 0xbe, 0xf3, 0x93, 0x43, 0x91, 0x92, 0x44,
+    0xc5, 0x1d, 0xae, 0x1e, 0xa9, 0xa9, 0x54, 0xcf, 0x2c, 0x09, 0x66,
+    0xab, 0x04, 0x5b, 0x15, 0x52, 0x1e, 0xcf, 0x35, 0x00, 0x81 },
+  { 0x8c, 0x62, 0x2f, 0xa2, 0x16, 0x0e, 0x8e, 0x99, 0x18, 0x13, 0xf1,
+    0x80, 0xbf, 0xec, 0x0b, 0x43, 0x1c, 0x6d, 0xbf, 0xa2, 0x95, 0x6d,
+    0x91, 0x75, 0x81, 0x6a, 0x23, 0xc3, 0x82, 0xc4, 0xf2, 0x00 },
+  { 0x81, 0x7d, 0x5c, 0x8f, 0x92, 0xe7, 0xb5, 0xca, 0x57, 0xf5, 0xe1,
+    0x63, 0x90, 0x16, 0xad, 0x57, 0x60, 0xe4, 0x46, 0xd6, 0xe9, 0xca,
+    0xa7, 0x49, 0x84, 0x14, 0xac, 0xe8, 0x22, 0x80, 0xb5, 0xcd },
+  { 0xa6, 0xa1, 0xad, 0x58, 0xce, 0xe5, 0x4e, 0x69, 0xcb, 0xbc, 0xaa,
+    0x87, 0xdf, 0x07, 0xa6, 0x70, 0x7e, 0xb2, 0x24, 0x73, 0x9c, 0x21,
+    0x76, 0x13, 0x46, 0x0a, 0xb4, 0x54, 0xb4, 0x59, 0xca, 0x9c },
+  { 0x63, 0xb8, 0x47, 0x27, 0x52, 0x26, 0x60, 0x5b, 0xe6, 0x76, 0x81,
+    0x25, 0x8f, 0x7d, 0x00, 0xbb, 0xb3, 0x07, 0xc6, 0x6f, 0x19, 0x59,
+    0xbf, 0x2e, 0x46, 0x7a, 0x41, 0xae, 0xe7, 0x14, 0xe5, 0x5c },
+  { 0xfe, 0x52, 0xeb, 0xe5, 0xcf, 0xcf, 0xe6, 0xa2, 0x29, 0x7b, 0x53,
+    0x9f, 0xa3, 0xda, 0xdb, 0xd6, 0xeb, 0xd2, 0x01, 0xaa, 0x2c, 0xa1,
+    0x35, 0x63, 0xe3, 0xd7, 0xf1, 0x4d, 0x15, 0xab, 0xff, 0x63 },
+  { 0xb7, 0xbe, 0xf9, 0xfa, 0x5a, 0x3d, 0x10, 0x42, 0x62, 0x46, 0xb5,
+    0xf6, 0x58, 0xc0, 0x8f, 0xdf, 0x80, 0x66, 0xea, 0xa3, 0xe5, 0x5a,
+    0x2f, 0x7d, 0xa1, 0x59, 0x1e, 0x05, 0xc8, 0x7d, 0xf8, 0xc7 },
+  { 0xde, 0xd1, 0xd6, 0xca, 0xa9, 0xf8, 0xf3, 0xbd, 0xa9, 0x2c, 0xea,
+    0x7f, 0x65, 0x49, 0xb1, 0xfb, 0x86, 0xa2, 0x21, 0x14, 0x78, 0xc4,
+    0xec, 0x28, 0x9b, 0x83, 0x7e, 0xfc, 0x2b, 0x5c, 0x27, 0xd7 },
+  { 0x9f, 0x30, 0x00, 0x8a, 0x2e, 0xb0, 0x50, 0xf1, 0x8e, 0x56, 0xa7,
+    0x6b, 0xe9, 0x20, 0x91, 0xb2, 0xfd, 0xc1, 0x64, 0xd5, 0x6e, 0x32,
+    0xc8, 0x7d, 0xd6, 0x4c, 0x9e, 0x3a, 0x61, 0x10, 0x41, 0xb1 },
+  { 0x01, 0x0b, 0x6a, 0x3b, 0x11, 0x86, 0x00, 0x88, 0xf0, 0xab, 0xc8,
+    0x0a, 0x89, 0x72, 0xcb, 0xbc, 0x32, 0x9d, 0x52, 0x75, 0x34, 0x29,
+    0x50, 0xeb, 0x9a, 0x04, 0x5a, 0xfd, 0xc8, 0xbb, 0xed, 0x24 },
+  { 0x0c, 0xd2, 0x10, 0xaa, 0xc1, 0x1f, 0x1c, 0x1c, 0xed, 0x49, 0x7f,
+    0x67, 0x3e, 0x53, 0xdb, 0x68, 0xc3, 0xec, 0x36, 0x07, 0xf0, 0xc5,
+    0x78, 0x7d, 0xdc, 0x60, 0xa3, 0x55, 0xdf, 0xe5, 0x6c, 0x25 },
+  { 0x0e, 0x56, 0xfd, 0x01, 0xda, 0x3b, 0x4f, 0x8b, 0xe2, 0xc9, 0x90,
+    0x55, 0x2a, 0xac, 0x8d, 0x1e, 0x8d, 0xa2, 0x09, 0xbc, 0xf4, 0xaa,
+    0xd4, 0xff, 0xb5, 0x42, 0x7f, 0xd6, 0x31, 0x72, 0x46, 0x3e },
+  { 0xd6, 0xd5, 0xcd, 0xb1, 0x14, 0x40, 0xe3, 0x4a, 0xca, 0x3a, 0x2f,
+    0xcf, 0x30, 0xf5, 0x9e, 0x08, 0xb1, 0x1a, 0x2a, 0x3d, 0xe5, 0x39,
+    0xe3, 0xe6, 0x51, 0x3e, 0xd7, 0x8a, 0x4f, 0xee, 0x51, 0x3b },
+  { 0xaa, 0x35, 0xac, 0x90, 0x68, 0x06, 0x70, 0xc7, 0x32, 0xed, 0x1e,
+    0xf3, 0x7e, 0x8c, 0xba, 0xae, 0x49, 0xa4, 0xd8, 0x8e, 0xcf, 0x4d,
+    0xf2, 0xb6, 0x89, 0xa0, 0xf1, 0x01, 0xb7, 0x56, 0xae, 0x47 },
+  { 0x27, 0x8e, 0x56, 0x12, 0x88, 0x72, 0x26, 0x30, 0xe2, 0x6a, 0x5f,
+    0xc9, 0x54, 0xbf, 0x2d, 0xcd, 0x6a, 0x65, 0x81, 0x67, 0x39, 0xab,
+    0xee, 0x7b, 0xe1, 0x43, 0x07, 0xa9, 0x61, 0x74, 0xe5, 0xb0 },
+  { 0xab, 0x4b, 0x2c, 0xa1, 0xa2, 0xb3, 0x49, 0x98, 0x15, 0x24, 0xb6,
+    0x15, 0x54, 0x62, 0xf0, 0xff, 0x10, 0x60, 0xbf, 0x9b, 0xfa, 0x07,
+    0xfb, 0x9e, 0xc6, 0x9c, 0xa4, 0x71, 0x64, 0x5b, 0x6a, 0x18 },
+  { 0x18, 0xa9, 0xbb, 0xec, 0x3c, 0x8e, 0x1f, 0x8e, 0xe9, 0x57, 0x12,
+    0x97, 0xa9, 0x34, 0x36, 0xde, 0x42, 0x7c, 0xd2, 0x70, 0xec, 0x69,
+    0xdf, 0xe8, 0x88, 0xdb, 0x7d, 0xbf, 0x10, 0xb6, 0x49, 0x93 },
+  { 0xba, 0xfc, 0x7e, 0x43, 0xd2, 0x65, 0xa1, 0x73, 0x02, 0x1a, 0x9d,
+    0x9e, 0x58, 0x3d, 0x60, 0xed, 0x42, 0xa8, 0x03, 0xfa, 0xcd, 0x6b,
+    0x83, 0x60, 0xde, 0x1f, 0x91, 0x68, 0x35, 0x38, 0x9b, 0xf0 },
+  { 0xa5, 0xb6, 0x7b, 0xe9, 0x50, 0xfb, 0xc2, 0xf0, 0xdd, 0x32, 0x3a,
+    0x79, 0xa1, 0x9e, 0x3e, 0xd1, 0xf4, 0xae, 0x4b, 0xa7, 0x89, 0x4f,
+    0x93, 0x0e, 0xa5, 0xef, 0x73, 0x4d, 0xe7, 0xdb, 0x83, 0xae },
+  { 0xbf, 0x1e, 0x65, 0xf3, 0xcd, 0x84, 0x98, 0x88, 0x4d, 0x9d, 0x5c,
+    0x19, 0xeb, 0xf7, 0xb9, 0x16, 0x06, 0x76, 0x37, 0x60, 0x4e, 0x26,
+    0xdb, 0xe2, 0xb7, 0x28, 0x8e, 0xcb, 0x11, 0x42, 0x60, 0x68 },
+  { 0xc3, 0x34, 0x2c, 0xf9, 0xcb, 0xbf, 0x29, 0xd4, 0x06, 0xd7, 0x89,
+    0x5d, 0xd4, 0xd9, 0x54, 0x8d, 0x4a, 0xc7, 0x8b, 0x4d, 0x00, 0xe9,
+    0xb6, 0x3e, 0x20, 0x3e, 0x5e, 0x19, 0xe9, 0x97, 0x46, 0x20 },
+  { 0x1c, 0x0b, 0xe6, 0x02, 0x77, 0x43, 0x4b, 0x0e, 0x00, 0x4b, 0x7b,
+    0x38, 0x8a, 0x37, 0x55, 0x9f, 0x84, 0xb3, 0x0c, 0x6c, 0xf8, 0x60,
+    0x0f, 0x52, 0x8b, 0xfc, 0xd3, 0x3c, 0xaf, 0x52, 0xcb, 0x1e },
+  { 0x73, 0x95, 0x45, 0x30, 0xd0, 0x3f, 0x10, 0xbe, 0xf5, 0x2a, 0xd5,
+    0xbc, 0x7f, 0xb4, 0xc0, 0x76, 0xf8, 0x3f, 0x63, 0x31, 0xc8, 0xbd,
+    0x1e, 0xee, 0xc3, 0x88, 0x7f, 0x4a, 0xa2, 0x06, 0x92, 0x40 },
+  { 0x69, 0xc1, 0x1e, 0xe0, 0x49, 0x44, 0xde, 0xa9, 0x85, 0xac, 0x9f,
+    0x13, 0x96, 0x0e, 0x73, 0x98, 0x0e, 0x1b, 0xb0, 0xe3, 0x09, 0xf4,
+    0x38, 0x4a, 0x16, 0x76, 0xf8, 0xef, 0xab, 0x38, 0x42, 0x88 },
+  { 0x36, 0xfb, 0x8f, 0xde, 0x0e, 0xc2, 0x8c, 0xe8, 0x53, 0xfb, 0x71,
+    0x75, 0xc1, 0xb7, 0x9d, 0xa3, 0xb5, 0xe8, 0xc3, 0x91, 0x86, 0xe7,
+    0x8a, 0xae, 0xce, 0x54, 0x64, 0xdb, 0xd9, 0xfe, 0x2a, 0xa2 },
+  { 0x6b, 0xb2, 0xa0, 0x9d, 0xfc, 0xaf, 0x96, 0x96, 0x2d, 0xe0, 0x0c,
+    0x8a, 0x08, 0x2d, 0x6d, 0xf9, 0x32, 0x2b, 0x49, 0x66, 0xae, 0x8d,
+    0x2e, 0xcf, 0x73, 0x24, 0x11, 0xa7, 0x6a, 0x1a, 0x0e, 0xe6 },
+  { 0x74, 0x12, 0xe7, 0xdd, 0x1b, 0xf1, 0xaa, 0x93, 0x97, 0x41, 0x1b,
+    0xba, 0x4d, 0x3e, 0x02, 0x76, 0xd2, 0xe7, 0xa1, 0xa2, 0x9a, 0x24,
+    0x77, 0x15, 0x7a, 0xd6, 0x03, 0x60, 0xd3, 0x3d, 0x4e, 0x76 },
+  { 0xdd, 0xde, 0xaf, 0xcf, 0xc7, 0x23, 0x21, 0xc8, 0x49, 0xfb, 0x25,
+    0x94, 0x7a, 0xb4, 0x2c, 0x1a, 0xf2, 0xa5, 0xe4, 0x3f, 0xef, 0x68,
+    0x1b, 0xe4, 0x2c, 0x7e, 0xaf, 0x36, 0x60, 0x08, 0x0a, 0xd3 },
+  { 0x9d, 0xef, 0xeb, 0xad, 0xbd, 0xcb, 0x0a, 0x0e, 0x7f, 0xf9, 0x92,
+    0xf9, 0x47, 0xce, 0xd3, 0xd0, 0xa4, 0xc8, 0x99, 0xe6, 0x4f, 0xe7,
+    0x73, 0x60, 0xe8, 0x1e, 0x1f, 0x0e, 0x97, 0xf8, 0xc1, 0xa2 },
+  { 0x84, 0x4c, 0x59, 0xfb, 0xe6, 0x47, 0x6f, 0xd1, 0x89, 0x23, 0x99,
+    0x54, 0xf1, 0x7e, 0x36, 0xe1, 0xf6, 0x9e, 0x24, 0xaa, 0xed, 0x5d,
+    0x5c, 0x8b, 0x84, 0x05, 0xef, 0x2a, 0x83, 0x0c, 0xc2, 0xa0 },
+  { 0xff, 0x3f, 0xaf, 0xb6, 0x77, 0x86, 0xe0, 0x1a, 0x0c, 0x38, 0xea,
+    0xdf, 0x99, 0xc4, 0xca, 0xe8, 0x02, 0x9d, 0xa8, 0xcf, 0x29, 0x87,
+    0x5f, 0xc4, 0x19, 0xbf, 0x68, 0x00, 0x09, 0xb3, 0xbd, 0xb3 },
+  { 0xca, 0x67, 0x60, 0xf3, 0x45, 0x67, 0x8f, 0x30, 0xa2, 0x8d, 0x62,
+    0x82, 0x94, 0x27, 0x2a, 0x19, 0xe3, 0x07, 0x2e, 0xbc, 0x61, 0xb1,
+    0x9f, 0xf1, 0x3b, 0x31, 0x89, 0x73, 0xe9, 0x7c, 0x27, 0x38 },
+  { 0xc0, 0x8e, 0x1a, 0x90, 0x47, 0xc5, 0x05, 0x26, 0x4a, 0x16, 0x44,
+    0x7c, 0x9e, 0xd9, 0x81, 0xa7, 0x19, 0xd3, 0x81, 0xf2, 0x8e, 0x60,
+    0x5f, 0xd7, 0xca, 0xa9, 0xe8, 0xbd, 0xbb, 0x42, 0x99, 0x6a },
+  { 0xf1, 0x73, 0xba, 0x9d, 0x45, 0x84, 0xcd, 0x12, 0x60, 0x50, 0xc6,
+    0x9f, 0xc2, 0x19, 0xa9, 0x19, 0x0a, 0x0b, 0xf0, 0xae, 0xce, 0xcb,
+    0xe6, 0x11, 0xbe, 0xed, 0x19, 0x3d, 0xa6, 0xca, 0x4d, 0xe7 },
+  { 0xb1, 0x84, 0x87, 0x65, 0x20, 0xde, 0xd8, 0xbd, 0x7d, 0xe2, 0x5e,
+    0xae, 0xfb, 0xd3, 0xe0, 0x36, 0x88, 0xc3, 0xbe, 0x39, 0xc1, 0x9f,
+    0xb7, 0x3e, 0x1f, 0x0e, 0xcc, 0xac, 0x7c, 0xc0, 0xf0, 0x14 },
+  { 0x90, 0x25, 0xdb, 0x07, 0x58, 0xbd, 0xfb, 0x48, 0xf0, 0x66, 0x7e,
+    0xbd, 0x7e, 0x12, 0x02, 0x46, 0x59, 0x8f, 0xed, 0x01, 0xc2, 0x58,
+    0x76, 0x4f, 0xa0, 0xfa, 0xe3, 0x34, 0xa2, 0xa0, 0x0a, 0x97 },
+  { 0xe8, 0x3d, 0x80, 0x86, 0xfa, 0xbc, 0x46, 0x0d, 0x5e, 0xfc, 0x45,
+    0x9f, 0x95, 0xa2, 0x68, 0xf5, 0xdc, 0x4a, 0xc2, 0x84, 0x09, 0x3c,
+    0x24, 0x7c, 0xa6, 0xec, 0x84, 0x1a, 0xd6, 0x18, 0x3f, 0xe1 },
+  { 0xcc, 0x9d, 0xf4, 0x1d, 0x35, 0xaa, 0x75, 0x92, 0x8c, 0x18, 0x5f,
+    0x73, 0x93, 0x66, 0x61, 0x10, 0xb8, 0x0f, 0x09, 0x86, 0xa2, 0x21,
+    0xc3, 0x70, 0xf4, 0x5c, 0x2e, 0xb9, 0x01, 0x6c, 0x9a, 0x3b },
+  { 0x92, 0xf9, 0xa5, 0x94, 0x95, 0x45, 0x90, 0xfa, 0x81, 0x98, 0x17,
+    0xe5, 0xd1, 0xc2, 0x8a, 0xab, 0x2b, 0x1c, 0xc5, 0x04, 0xd8, 0x6d,
+    0xba, 0x44, 0x36, 0x76, 0xbd, 0xf8, 0x66, 0x79, 0x68, 0x11 },
+  { 0x72, 0x95, 0x62, 0xa1, 0xe0, 0x7b, 0x0e, 0x26, 0x05, 0x49, 0x48,
+    0x09, 0xbd, 0x48, 0x0f, 0x15, 0x37, 0xce, 0xa1, 0x0d, 0xca, 0xd4,
+    0x3e, 0xf9, 0xf6, 0x8c, 0x66, 0xe8, 0x25, 0xdc, 0x46, 0xb1 },
+  { 0x26, 0xf1, 0x60, 0xab, 0x96, 0xf5, 0x58, 0x20, 0x45, 0x14, 0x6e,
+    0xaf, 0xf2, 0xe2, 0xa8, 0xd4, 0xda, 0xb2, 0x98, 0xb4, 0xc5, 0x7e,
+    0x11, 0x7c, 0xdf, 0xc5, 0xd0, 0x25, 0xc9, 0x2a, 0x22, 0x68 },
+  { 0x87, 0xeb, 0xe7, 0x21, 0x38, 0x38, 0x73, 0xd2, 0x47, 0xf8, 0x61,
+    0x82, 0xe3, 0xf5, 0x99, 0xa7, 0x63, 0x4f, 0xca, 0xec, 0x5e, 0x07,
+    0xb1, 0xe8, 0x3e, 0xbb, 0x79, 0x62, 0x5b, 0xa3, 0x54, 0xe6 },
+  { 0xe0, 0x8d, 0x38, 0x9f, 0x75, 0x69, 0x4a, 0xdc, 0x99, 0x6c, 0x22,
+    0xf5, 0x5d, 0x4f, 0x85, 0x9f, 0xfd, 0x0c, 0x13, 0x19, 0xff, 0x9c,
+    0xed, 0xf7, 0x8c, 0x31, 0xbe, 0x84, 0xb6, 0xf2, 0x1a, 0xbc },
+  { 0x13, 0x63, 0xe2, 0x29, 0x13, 0xc6, 0xe1, 0x8e, 0x7a, 0xa6, 0x5b,
+    0x83, 0xe7, 0x51, 0xc8, 0xa2, 0xc6, 0x1b, 0x0f, 0x30, 0x71, 0x55,
+    0x86, 0x5a, 0x57, 0xdb, 0xa5, 0x69, 0xa9, 0x9c, 0x7b, 0x0e },
+  { 0x88, 0x78, 0x08, 0x8e, 0xb2, 0xd1, 0xf6, 0xd0, 0xbb, 0x48, 0x1b,
+    0x4b, 0xb1, 0x87, 0xda, 0x04, 0xbc, 0xd8, 0xc2, 0xc6, 0x39, 0xf0,
+    0x05, 0xb0, 0x80, 0x54, 0xcc, 0x41, 0x75, 0x39, 0x05, 0xfb },
+  { 0x04, 0x18, 0xd6, 0x0d, 0x05, 0xb4, 0xe1, 0x24, 0x64, 0x6e, 0xe5,
+    0x0e, 0x77, 0x49, 0xa1, 0xd2, 0x09, 0x45, 0x7b, 0xc5, 0x43, 0xe3,
+    0xcc, 0x11, 0x30, 0x27, 0x4a, 0xea, 0x0f, 0x7b, 0xf3, 0xc1 },
+  { 0x7a, 0x39, 0x7e, 0x50, 0x3f, 0x29, 0x3b, 0xc4, 0x2d, 0x5f, 0x7e,
+    0xf5, 0xec, 0x37, 0x87, 0x24, 0x60, 0xa4, 0xf5, 0xb5, 0xcc, 0xde,
+    0x77, 0xfb, 0x4d, 0x47, 0xac, 0x06, 0x81, 0xe5, 0xa0, 0x49 },
+  { 0x5c, 0x0d, 0x29, 0x83, 0xe7, 0x2a, 0x6d, 0xd4, 0xe6, 0x52, 0xd7,
+    0x23, 0xc1, 0xdf, 0xc1, 0x2b, 0x41, 0x4c, 0x87, 0x3d, 0x4a, 0xb4,
+    0xa0, 0xa1, 0x50, 0x40, 0x8e, 0xb3, 0x43, 0x47, 0xe9, 0x95 },
+  { 0x56, 0x23, 0x36, 0x54, 0x53, 0xc0, 0x49, 0x89, 0xc7, 0xcf, 0x33,
+    0x63, 0x5e, 0x0f, 0xc4, 0xcd, 0xdd, 0x68, 0x6f, 0xc9, 0x5a, 0x33,
+    0xdf, 0xed, 0xcf, 0x33, 0x35, 0x79, 0x4c, 0x7d, 0xc3, 0x44 },
+  { 0x11, 0xf6, 0xda, 0xd1, 0x88, 0x02, 0x8f, 0xdf, 0x13, 0x78, 0xa2,
+    0x56, 0xe4, 0x57, 0x0e, 0x90, 0x63, 0x10, 0x7b, 0x8f, 0x79, 0xdc,
+    0x66, 0x3f, 0xa5, 0x55, 0x6f, 0x56, 0xfd, 0x44, 0xa0, 0xf0 },
+  { 0x0e, 0xd8, 0x16, 0x17, 0x97, 0xec, 0xee, 0x88, 0x1e, 0x7d, 0x0e,
+    0x3f, 0x4c, 0x5f, 0xb8, 0x39, 0xc8, 0x4e, 0xb7, 0xa9, 0x24, 0x26,
+    0x57, 0xcc, 0x48, 0x30, 0x68, 0x07, 0xb3, 0x2b, 0xef, 0xde },
+  { 0x73, 0x66, 0x67, 0xc9, 0x36, 0x4c, 0xe1, 0x2d, 0xb8, 0xf6, 0xb1,
+    0x43, 0xc6, 0xc1, 0x78, 0xcd, 0xef, 0x1e, 0x14, 0x45, 0xbc, 0x5a,
+    0x2f, 0x26, 0x34, 0xf0, 0x8e, 0x99, 0x32, 0x27, 0x3c, 0xaa },
+  { 0xe1, 0x5f, 0x36, 0x8b, 0x44, 0x06, 0xc1, 0xf6, 0x55, 0x57, 0xc8,
+    0x35, 0x5c, 0xbe, 0x69, 0x4b, 0x63, 0x3e, 0x26, 0xf1, 0x55, 0xf5,
+    0x2b, 0x7d, 0xa9, 0x4c, 0xfb, 0x23, 0xfd, 0x4a, 0x5d, 0x96 },
+  { 0x43, 0x7a, 0xb2, 0xd7, 0x4f, 0x50, 0xca, 0x86, 0xcc, 0x3d, 0xe9,
+    0xbe, 0x70, 0xe4, 0x55, 0x48, 0x25, 0xe3, 0x3d, 0x82, 0x4b, 0x3a,
+    0x49, 0x23, 0x62, 0xe2, 0xe9, 0xd6, 0x11, 0xbc, 0x57, 0x9d },
+  { 0x2b, 0x91, 0x58, 0xc7, 0x22, 0x89, 0x8e, 0x52, 0x6d, 0x2c, 0xdd,
+    0x3f, 0xc0, 0x88, 0xe9, 0xff, 0xa7, 0x9a, 0x9b, 0x73, 0xb7, 0xd2,
+    0xd2, 0x4b, 0xc4, 0x78, 0xe2, 0x1c, 0xdb, 0x3b, 0x67, 0x63 },
+  { 0x0c, 0x8a, 0x36, 0x59, 0x7d, 0x74, 0x61, 0xc6, 0x3a, 0x94, 0x73,
+    0x28, 0x21, 0xc9, 0x41, 0x85, 0x6c, 0x66, 0x83, 0x76, 0x60, 0x6c,
+    0x86, 0xa5, 0x2d, 0xe0, 0xee, 0x41, 0x04, 0xc6, 0x15, 0xdb }
+};
+
+/* BLAKE2sp of the message built by blake2sp_do_long. */
+static const uint8_t blake2sp_long_digest[BLAKE2SP_DIGEST_SIZE] = {
+  0xb5, 0xbe, 0x73, 0x07, 0x57, 0xf0, 0x5b, 0xab, 0x24, 0xcc, 0xe9,
+  0x4b, 0x1c, 0xbc, 0x23, 0xbc, 0xd4, 0x85, 0x9a, 0x3d, 0x33, 0xf5,
+  0xd3, 0xf2, 0x4e, 0xf5, 0xdc, 0xf7, 0x2a, 0x9f, 0x94, 0xe1
+};
+
+static void hexdump (const uint8_t *, size_t);
+static bool blake2sp_do_keyed_kat (void);
+static bool blake2sp_do_long (void);
+static bool blake2sp_do_parallel (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!blake2sp_do_keyed_kat ())
+    rv = 1;
+  if (!blake2sp_do_long ())
+    rv = 1;
+  if (!blake2sp_do_parallel ())
+    rv = 1;
+
+  return rv;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
+
+static bool
+blake2sp_do_keyed_kat (void)
+{
+  uint32_t i;
+  uint8_t key[BLAKE2SP_KEY_SIZE];
+  uint8_t data[256];
+  uint8_t digest[BLAKE2SP_DIGEST_SIZE];
+  const uint8_t *p;
+  bool retval;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = i;
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = i;
+
+  retval = true;
+  for (i = 0; i < 256; ++i)
+    {
+      blake2sp (digest, data, key, BLAKE2SP_DIGEST_SIZE, i,
+                BLAKE2SP_KEY_SIZE);
+      hexdump (digest, BLAKE2SP_DIGEST_SIZE);
+      p = blake2sp_keyed_kat[i];
+      if (memcmp (digest, p, BLAKE2SP_DIGEST_SIZE) != 0)
+        {
+          retval = false;
+          fprintf (stderr, "blake2sp_keyed_kat: Failed #%u\n", i);
+        }
+    }
+
+  return retval;
+}
+
+/*
+ * Hashes a long message in one call and in pieces of varying length, so that
+ * the pieces cross the stride of blocks dealt out to the leaves at every
+ * offset.
+ */
+static bool
+blake2sp_do_long (void)
+{
+  static uint8_t message[100000];
+  struct blake2sp_ctx ctx;
+  uint8_t digest[BLAKE2SP_DIGEST_SIZE];
+  size_t i, n;
+  bool retval;
+
+  for (i = 0; i < sizeof (message); ++i)
+    message[i] = (uint8_t)(i * 7 + (i >> 11));
+
+  retval = true;
+  blake2sp (digest, message, NULL, BLAKE2SP_DIGEST_SIZE, sizeof (message), 0);
+  hexdump (digest, BLAKE2SP_DIGEST_SIZE);
+  if (memcmp (digest, blake2sp_long_digest, BLAKE2SP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2sp_long: Failed one-shot\n");
+    }
+
+  blake2sp_init (&ctx, BLAKE2SP_DIGEST_SIZE);
+  for (i = 0, n = 1; i < sizeof (message); i += n, n = n * 7 % 2039)
+    {
+      if (n > sizeof (message) - i)
+        n = sizeof (message) - i;
+      blake2sp_update (&ctx, message + i, n);
+    }
+  blake2sp_final (digest, &ctx);
+  if (memcmp (digest, blake2sp_long_digest, BLAKE2SP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2sp_long: Failed incremental\n");
+    }
+
+  return retval;
+}
+
+/*
+ * Hashes a message long enough to be split across threads, in one call and
+ * in pieces of which some are below the threshold for threads.
+ */
+static bool
+blake2sp_do_parallel (void)
+{
+  static uint8_t message[3000000];
+  struct blake2sp_ctx ctx;
+  uint8_t expect[BLAKE2SP_DIGEST_SIZE];
+  uint8_t digest[BLAKE2SP_DIGEST_SIZE];
+  size_t i, n;
+  bool retval;
+
+  for (i = 0; i < sizeof (message); ++i)
+    message[i] = (uint8_t)(i * 13 + (i >> 9));
+
+  retval = true;
+  blake2sp (expect, message, NULL, BLAKE2SP_DIGEST_SIZE, sizeof (message), 0);
+  blake2sp_parallel (digest, message, NULL, BLAKE2SP_DIGEST_SIZE,
+                     sizeof (message), 0, 4);
+  if (memcmp (digest, expect, BLAKE2SP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2sp_parallel: Failed one-shot\n");
+    }
+
+  blake2sp_init (&ctx, BLAKE2SP_DIGEST_SIZE);
+  for (i = 0, n = 777; i < sizeof (message); i += n, n = n * 5 % 1048573)
+    {
+      if (n > sizeof (message) - i)
+        n = sizeof (message) - i;
+      blake2sp_update_parallel (&ctx, message + i, n, 3);
+    }
+  blake2sp_final (digest, &ctx);
+  if (memcmp (digest, expect, BLAKE2SP_DIGEST_SIZE) != 0)
+    {
+      retval = false;
+      fprintf (stderr, "blake2sp_parallel: Failed incremental\n");
+    }
+
+  return retval;
+}
@@ -0,0 +1,448 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors for BLAKE2Xb. The input is the bytes 0 to 255 and the keyed
+ * cases use the bytes 0 to 63 as the key, like the reference KAT files.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2xb.h"
+
+struct blake2xb_testcase
+{
+  size_t outlen;
+  size_t keylen;
+  const uint8_t *output;
+};
+
+static const uint8_t blake2xb_1[1] = {
+  0xf0
+};
+
+static const uint8_t blake2xb_keyed_1[1] = {
+  0x64
+};
+
+static const uint8_t blake2xb_32[32] = {
+  0xb5, 0xd2, 0x59, 0xe2, 0xe3, 0xa8, 0x6c, 0x77, 0xcb, 0xf6, 0xd5,
+  0x3f, 0x9d, 0xc7, 0x8d, 0xad, 0xdc, 0x2a, 0xfd, 0x84, 0xdb, 0xb4,
+  0xba, 0x7e, 0x98, 0x91, 0x22, 0x7f, 0xec, 0x07, 0x9d, 0x5a
+};
+
+static const uint8_t blake2xb_keyed_32[32] = {
+  0x29, 0xf6, 0xbb, 0x55, 0xde, 0x7f, 0x88, 0x68, 0xe0, 0x53, 0x17,
+  0x6c, 0x87, 0x8c, 0x9f, 0xe6, 0xc2, 0x05, 0x5c, 0x4c, 0x54, 0x13,
+  0xb5, 0x1a, 0xb0, 0x38, 0x6c, 0x27, 0x7f, 0xdb, 0xac, 0x75
+};
+
+static const uint8_t blake2xb_63[63] = {
+  0xd9, 0x94, 0x2e, 0x99, 0x65, 0x73, 0x68, 0x8a, 0x34, 0x8a, 0xa0,
+  0xfd, 0x1a, 0x29, 0x51, 0xb1, 0x1d, 0x77, 0x32, 0x10, 0x3a, 0xcc,
+  0x23, 0xf3, 0x1f, 0x27, 0xb2, 0x22, 0xd5, 0x10, 0x38, 0x79, 0xb9,
+  0xd3, 0x83, 0x7f, 0x25, 0x71, 0xa7, 0xae, 0xbf, 0xfd, 0x17, 0x0a,
+  0xd0, 0x3c, 0xfd, 0x89, 0x28, 0x1f, 0x48, 0xfa, 0x70, 0xed, 0xb7,
+  0xc9, 0xf4, 0x10, 0x3b, 0x5b, 0x8b, 0xb7, 0x91
+};
+
+static const uint8_t blake2xb_keyed_63[63] = {
+  0xe1, 0x01, 0xf4, 0x31, 0x79, 0xd8, 0xe8, 0x54, 0x6e, 0x5c, 0xe6,
+  0xa9, 0x6d, 0x75, 0x56, 0xb7, 0xe6, 0xb9, 0xd4, 0xa7, 0xd0, 0x0e,
+  0x7a, 0xad, 0xe5, 0x57, 0x9d, 0x08, 0x5d, 0x52, 0x7c, 0xe3, 0x4a,
+  0x93, 0x29, 0x55, 0x1e, 0xbc, 0xaf, 0x6b, 0xa9, 0x46, 0x94, 0x9b,
+  0xbe, 0x38, 0xe3, 0x0a, 0x62, 0xae, 0x34, 0x4c, 0x19, 0x50, 0xb4,
+  0xbd, 0xe5, 0x53, 0x06, 0xb3, 0xba, 0xc4, 0x32
+};
+
+static const uint8_t blake2xb_64[64] = {
+  0x57, 0x1b, 0xe9, 0x10, 0x37, 0xc1, 0x51, 0x45, 0xe2, 0xab, 0x48,
+  0x94, 0xa7, 0xbb, 0x8d, 0x8a, 0x3c, 0xab, 0x75, 0xe6, 0xe6, 0x4e,
+  0xf2, 0x96, 0xe7, 0x60, 0xc1, 0x5c, 0xf8, 0xf3, 0xf3, 0xac, 0xfa,
+  0x5c, 0x89, 0x4e, 0xe5, 0x6c, 0xb6, 0xac, 0x2d, 0xb9, 0xb3, 0x2c,
+  0x39, 0xa1, 0xcc, 0x39, 0xf9, 0x6c, 0x50, 0xdd, 0x33, 0x3f, 0x10,
+  0x59, 0x23, 0x04, 0x82, 0xf3, 0xed, 0x2d, 0x92, 0x46
+};
+
+static const uint8_t blake2xb_keyed_64[64] = {
+  0x43, 0x24, 0x56, 0x1d, 0x76, 0xc3, 0x70, 0xef, 0x35, 0xac, 0x36,
+  0xa4, 0xad, 0xf8, 0xf3, 0x77, 0x3a, 0x50, 0xd8, 0x65, 0x04, 0xbd,
+  0x28, 0x4f, 0x71, 0xf7, 0xce, 0x9e, 0x2b, 0xc4, 0xc1, 0xf1, 0xd3,
+  0x4a, 0x7f, 0xb2, 0xd6, 0x75, 0x61, 0xd1, 0x01, 0x95, 0x5d, 0x44,
+  0x8b, 0x67, 0x57, 0x7e, 0xb3, 0x0d, 0xfe, 0xe9, 0x6a, 0x95, 0xc7,
+  0xf9, 0x21, 0xef, 0x53, 0xe2, 0x0b, 0xe8, 0xbc, 0x44
+};
+
+static const uint8_t blake2xb_65[65] = {
+  0xc6, 0xf0, 0xb1, 0xb6, 0x6f, 0x22, 0x72, 0x6c, 0xef, 0x3e, 0x4f,
+  0xca, 0x23, 0x25, 0xd2, 0xbb, 0x4e, 0x92, 0x2b, 0x39, 0xf9, 0xdf,
+  0x5e, 0xf5, 0x48, 0xd3, 0x21, 0x41, 0x9c, 0x07, 0x39, 0x1f, 0xc3,
+  0x11, 0x90, 0x44, 0x07, 0xf9, 0x8d, 0xb7, 0xd7, 0x46, 0x2d, 0xb1,
+  0xe8, 0x57, 0x61, 0x38, 0xba, 0xea, 0xc2, 0xa7, 0x64, 0x00, 0xb2,
+  0xa2, 0xf7, 0x2b, 0x44, 0x97, 0xc1, 0x9e, 0x23, 0x94, 0x30
+};
+
+static const uint8_t blake2xb_keyed_65[65] = {
+  0x78, 0xf0, 0xed, 0x6e, 0x22, 0x0b, 0x3d, 0xa3, 0xcc, 0x93, 0x81,
+  0x56, 0x3b, 0x2f, 0x72, 0xc8, 0xdc, 0x83, 0x0c, 0xb0, 0xf3, 0x9a,
+  0x48, 0xc6, 0xae, 0x47, 0x9a, 0x6a, 0x78, 0xdc, 0xfa, 0x94, 0x00,
+  0x26, 0x31, 0xde, 0xc4, 0x67, 0xe9, 0xe9, 0xb4, 0x7c, 0xc8, 0xf0,
+  0x88, 0x7e, 0xb6, 0x80, 0xe3, 0x40, 0xae, 0xc3, 0xec, 0x00, 0x9d,
+  0x4a, 0x33, 0xd2, 0x41, 0x53, 0x3c, 0x76, 0xc8, 0xca, 0x8c
+};
+
+static const uint8_t blake2xb_128[128] = {
+  0x92, 0x6f, 0x57, 0x16, 0x26, 0x65, 0x06, 0x10, 0xf9, 0x56, 0x22,
+  0x62, 0x8f, 0x73, 0x80, 0x40, 0x81, 0x4e, 0x59, 0x31, 0x5f, 0xe7,
+  0xaf, 0x85, 0xa8, 0xe3, 0x46, 0xd1, 0x8c, 0x28, 0xcf, 0xc6, 0xf3,
+  0xca, 0xb9, 0x85, 0xdb, 0x99, 0x47, 0x91, 0x7d, 0x0f, 0xc1, 0x28,
+  0xb1, 0x38, 0xaf, 0x2e, 0xcb, 0x02, 0xfd, 0x84, 0x0e, 0xd9, 0x1c,
+  0x36, 0x3f, 0x8d, 0x52, 0x60, 0x8e, 0xa4, 0x05, 0xe3, 0x7e, 0x2a,
+  0x52, 0x2d, 0x0f, 0x1b, 0xf1, 0x85, 0xcf, 0x2c, 0x31, 0x99, 0xfd,
+  0x9f, 0x19, 0x57, 0xf7, 0x21, 0x6f, 0x6f, 0x2e, 0x6e, 0xa6, 0x61,
+  0xc6, 0xa3, 0x19, 0x6e, 0x77, 0x60, 0x84, 0x02, 0x37, 0x3d, 0xc9,
+  0xc3, 0x6e, 0x35, 0xb2, 0xef, 0xf1, 0xfe, 0x17, 0xae, 0x8f, 0x26,
+  0x9e, 0x52, 0x41, 0x95, 0x60, 0x88, 0x13, 0x0f, 0x8e, 0x7b, 0x94,
+  0xcf, 0x04, 0x23, 0x91, 0x48, 0x23, 0x29
+};
+
+static const uint8_t blake2xb_keyed_128[128] = {
+  0x2d, 0x7d, 0xc8, 0x0c, 0x19, 0xa1, 0xd1, 0x2d, 0x5f, 0xe3, 0x96,
+  0x35, 0x69, 0x54, 0x7a, 0x5d, 0x1d, 0x3e, 0x82, 0x1e, 0x6f, 0x06,
+  0xc5, 0xd5, 0xe2, 0xc0, 0x94, 0x01, 0xf9, 0x46, 0xc9, 0xf7, 0xe1,
+  0x3c, 0xd0, 0x19, 0xf2, 0xf9, 0xa8, 0x78, 0xb6, 0x2d, 0xd8, 0x50,
+  0x45, 0x3b, 0x62, 0x94, 0xb9, 0x9c, 0xca, 0xa0, 0x68, 0xe5, 0x42,
+  0x99, 0x35, 0x24, 0xb0, 0xf6, 0x38, 0x32, 0xd4, 0x8e, 0x86, 0x5b,
+  0xe3, 0x1e, 0x8e, 0xc1, 0xee, 0x10, 0x3c, 0x71, 0x83, 0x40, 0xc9,
+  0x04, 0xb3, 0x2e, 0xfb, 0x69, 0x17, 0x0b, 0x67, 0xf0, 0x38, 0xd5,
+  0x0a, 0x32, 0x52, 0x79, 0x4b, 0x1b, 0x40, 0x76, 0xc0, 0x62, 0x06,
+  0x21, 0xab, 0x3d, 0x91, 0x21, 0x5d, 0x55, 0xff, 0xea, 0x99, 0xf2,
+  0x3d, 0x54, 0xe1, 0x61, 0xa9, 0x0d, 0x8d, 0x49, 0x02, 0xfd, 0xa5,
+  0x93, 0x1d, 0x9f, 0x6a, 0x27, 0x14, 0x6a
+};
+
+static const uint8_t blake2xb_199[199] = {
+  0x35, 0xd3, 0x28, 0x1f, 0xcd, 0x49, 0x03, 0x3f, 0xf7, 0x25, 0x5c,
+  0x49, 0xee, 0x4b, 0x08, 0x4e, 0x90, 0xa3, 0x4c, 0xab, 0xbb, 0xa2,
+  0x98, 0x4f, 0xb4, 0xce, 0x4f, 0x66, 0xa6, 0x2b, 0x51, 0x49, 0x77,
+  0xb3, 0x28, 0x05, 0x0f, 0x0a, 0xf3, 0xb9, 0xec, 0x9b, 0x29, 0x07,
+  0xab, 0xca, 0x54, 0x13, 0xde, 0x2c, 0xa1, 0xaa, 0x05, 0xed, 0xea,
+  0xdd, 0x44, 0x0d, 0x5a, 0x26, 0x1c, 0x86, 0x1c, 0xb3, 0xe7, 0x26,
+  0x48, 0x89, 0x13, 0x91, 0x7c, 0xc0, 0x7e, 0x2c, 0x47, 0x63, 0x02,
+  0x4a, 0xaa, 0xd1, 0x3d, 0x37, 0x15, 0x8f, 0x16, 0x06, 0xbc, 0xda,
+  0x25, 0x3d, 0x13, 0x32, 0x81, 0x1f, 0x0f, 0xde, 0x69, 0xd4, 0x11,
+  0xbf, 0x82, 0x96, 0xd0, 0x0b, 0x45, 0x83, 0x0d, 0x30, 0x05, 0x67,
+  0xdb, 0xae, 0xfa, 0x79, 0xae, 0x5f, 0x15, 0x2a, 0x7a, 0x62, 0x12,
+  0xf0, 0xc4, 0x81, 0x83, 0x8a, 0x93, 0x19, 0xd0, 0x42, 0x40, 0x4d,
+  0xd3, 0xe6, 0x48, 0x92, 0xb5, 0x92, 0xfe, 0xfd, 0x3b, 0x11, 0x27,
+  0xc3, 0x00, 0xcb, 0x54, 0x13, 0x88, 0x86, 0x7d, 0xae, 0x01, 0x1b,
+  0x74, 0x96, 0x72, 0x00, 0x89, 0x58, 0x76, 0x4d, 0xad, 0x93, 0xc1,
+  0x38, 0x98, 0xa4, 0xb6, 0x12, 0xe6, 0xa1, 0x37, 0xbd, 0xfa, 0x4c,
+  0xcf, 0x0d, 0xa5, 0x8a, 0xa0, 0xc2, 0x5c, 0x09, 0x6b, 0xa7, 0x9c,
+  0xfa, 0x49, 0xec, 0x9a, 0xf6, 0x89, 0xe7, 0x61, 0x85, 0x5f, 0xd7,
+  0x12
+};
+
+static const uint8_t blake2xb_keyed_199[199] = {
+  0xb9, 0xe4, 0x26, 0x7e, 0xa3, 0x9e, 0x1d, 0xe1, 0xfe, 0xd0, 0x57,
+  0x9f, 0x93, 0xbb, 0x35, 0x10, 0x07, 0xc9, 0xf8, 0xfc, 0xdd, 0x81,
+  0x10, 0x53, 0xfa, 0xe3, 0x3f, 0x09, 0xe2, 0x75, 0x3d, 0x74, 0x28,
+  0xf0, 0x4e, 0x1a, 0x9e, 0xfc, 0xd4, 0x5e, 0xa7, 0x01, 0xa5, 0xd8,
+  0x7a, 0x35, 0xb3, 0xaf, 0xb2, 0xe6, 0xb6, 0x53, 0x65, 0xde, 0xe6,
+  0xea, 0xd0, 0xbb, 0xb6, 0x11, 0xb7, 0x79, 0x7b, 0x21, 0x2a, 0xc6,
+  0x88, 0x65, 0x3f, 0x54, 0x2e, 0x60, 0x4a, 0x39, 0xdf, 0x27, 0x7f,
+  0x12, 0x51, 0x4d, 0xdf, 0xee, 0x3b, 0x4e, 0x27, 0xb9, 0x83, 0x95,
+  0xc2, 0xcd, 0x97, 0xa2, 0x03, 0xf1, 0xf1, 0x15, 0x3c, 0x50, 0x32,
+  0x79, 0x65, 0x77, 0x08, 0x02, 0xec, 0x2c, 0x97, 0x83, 0xed, 0xc4,
+  0x28, 0x27, 0x17, 0x62, 0xb2, 0x75, 0x47, 0x1e, 0x7a, 0xc6, 0x5a,
+  0xc3, 0x65, 0x23, 0xdf, 0x28, 0xb0, 0xd7, 0xe6, 0xe6, 0xcc, 0xc7,
+  0x67, 0x42, 0x68, 0xa1, 0x32, 0xa6, 0x34, 0x11, 0xfc, 0x82, 0xc0,
+  0x73, 0x8d, 0xbb, 0x68, 0xaf, 0x00, 0x3b, 0x76, 0x9a, 0x0b, 0xf9,
+  0xe6, 0x58, 0x7b, 0x36, 0x47, 0x6c, 0xb4, 0x65, 0x35, 0x0f, 0xee,
+  0x13, 0xf8, 0x8e, 0xa3, 0x55, 0xd4, 0x7f, 0xfa, 0xc7, 0xb0, 0xf9,
+  0x64, 0xf4, 0x13, 0x9d, 0xb1, 0x1b, 0x76, 0x42, 0xcb, 0x8d, 0x75,
+  0xfe, 0x1b, 0xc7, 0x4d, 0x85, 0x9b, 0x6d, 0x9e, 0x88, 0x4f, 0x75,
+  0xac
+};
+
+static const uint8_t blake2xb_1000[1000] = {
+  0x8b, 0x18, 0x50, 0xd3, 0xd8, 0xa0, 0x0e, 0xd0, 0x44, 0xa3, 0x8f,
+  0x79, 0x05, 0x06, 0x3d, 0xd8, 0xe5, 0x61, 0xf4, 0xc4, 0x3e, 0x01,
+  0x68, 0xbc, 0xfd, 0x76, 0x1e, 0x31, 0x35, 0xa7, 0x46, 0x98, 0x9a,
+  0x1a, 0x2b, 0x75, 0x55, 0x96, 0x7a, 0x69, 0x17, 0x2c, 0xc7, 0xc9,
+  0x80, 0x79, 0x44, 0x9b, 0xa0, 0x15, 0xd7, 0x1c, 0x60, 0x06, 0x11,
+  0xd3, 0x57, 0xb1, 0xbf, 0xe2, 0x62, 0x19, 0xcd, 0xc3, 0xdb, 0x55,
+  0xeb, 0x53, 0xd5, 0x23, 0x91, 0x72, 0xb3, 0x1a, 0xc3, 0xed, 0xab,
+  0xed, 0xe1, 0xae, 0x54, 0xb5, 0x18, 0x38, 0x34, 0xe3, 0xf6, 0x41,
+  0x9f, 0xeb, 0x81, 0x50, 0x69, 0xf5, 0x04, 0x8e, 0x93, 0x0c, 0x92,
+  0xf5, 0x1e, 0xca, 0x66, 0xca, 0x05, 0x05, 0xa9, 0x1a, 0x62, 0xb8,
+  0xcc, 0xf8, 0x23, 0x9e, 0x24, 0xa7, 0x75, 0xa2, 0x9b, 0xbf, 0x66,
+  0xe8, 0xe1, 0xbb, 0xf5, 0xbd, 0x35, 0x68, 0xc3, 0x52, 0x3e, 0xc2,
+  0x5d, 0x8c, 0x9c, 0x78, 0xd8, 0x79, 0x89, 0x3f, 0x01, 0x41, 0xee,
+  0x61, 0x04, 0xfa, 0x39, 0x5d, 0xc5, 0x11, 0xcc, 0x52, 0xfa, 0xa7,
+  0x1a, 0xd2, 0xc7, 0x87, 0xd3, 0x16, 0x1e, 0xd2, 0x79, 0xfb, 0xd4,
+  0x0f, 0x52, 0x90, 0xbf, 0x7e, 0x4f, 0x86, 0x62, 0x0a, 0xc4, 0x0d,
+  0x04, 0x67, 0x14, 0x1e, 0x91, 0xd7, 0x0f, 0x61, 0x17, 0x75, 0xc7,
+  0x32, 0xbe, 0xaf, 0x78, 0x68, 0x67, 0xab, 0x1d, 0x08, 0x95, 0xc4,
+  0x95, 0x6c, 0xbe, 0x76, 0x6b, 0xa8, 0x6a, 0x6b, 0x66, 0x7f, 0x49,
+  0xa4, 0x96, 0x2f, 0xfb, 0x6c, 0xd3, 0xcf, 0x2b, 0xaa, 0x7d, 0x2c,
+  0x77, 0x12, 0x45, 0x7e, 0xa8, 0xd2, 0x2f, 0x80, 0x2e, 0x8a, 0x87,
+  0xa7, 0x57, 0xe4, 0xdb, 0xf5, 0x89, 0x20, 0x94, 0xc9, 0xc6, 0x3d,
+  0x18, 0x62, 0x49, 0xd8, 0x64, 0x5b, 0x46, 0x7e, 0xf7, 0x3d, 0x67,
+  0x9c, 0x29, 0xe2, 0x37, 0x9c, 0x90, 0xf6, 0x9d, 0x13, 0x7f, 0xa2,
+  0x2b, 0x8c, 0x28, 0xa8, 0x07, 0x1d, 0xf6, 0x2b, 0xf2, 0x25, 0x01,
+  0x93, 0xd4, 0x3e, 0xdb, 0x26, 0xfd, 0x61, 0x21, 0x70, 0x01, 0x6a,
+  0xb8, 0x40, 0x07, 0x22, 0xe6, 0x82, 0x2a, 0x1a, 0xbf, 0xf4, 0xdf,
+  0x56, 0x4d, 0x32, 0x4a, 0x72, 0x2f, 0x8d, 0xc0, 0xc3, 0xca, 0xbf,
+  0x8f, 0x2e, 0x66, 0x59, 0xc3, 0x3b, 0xe0, 0x59, 0xf1, 0xa2, 0x61,
+  0xd7, 0xac, 0x58, 0xa5, 0x2e, 0xcf, 0x36, 0x42, 0x5a, 0xd8, 0x32,
+  0xa9, 0xf4, 0xfb, 0x47, 0xac, 0x09, 0x87, 0x87, 0x98, 0x30, 0x32,
+  0xd4, 0x5b, 0x8b, 0x7f, 0x23, 0x89, 0x4b, 0xda, 0x5b, 0x9d, 0x14,
+  0xdb, 0x60, 0xb4, 0x52, 0x36, 0x9c, 0x82, 0x4e, 0xe3, 0x94, 0xc9,
+  0xab, 0x29, 0xa2, 0xf7, 0xa4, 0x1e, 0xfe, 0x96, 0x82, 0x7d, 0x49,
+  0x02, 0x97, 0x31, 0x6e, 0x31, 0x1f, 0x1f, 0xf8, 0xa6, 0xf6, 0xee,
+  0xad, 0xa7, 0x2e, 0x2c, 0xb8, 0xb4, 0x9b, 0xfc, 0x90, 0x50, 0x76,
+  0x24, 0x3b, 0x6e, 0x30, 0xc4, 0xe6, 0x5b, 0xa6, 0xb1, 0x4e, 0x8c,
+  0xe7, 0x15, 0x70, 0xb9, 0x47, 0x66, 0x06, 0xf9, 0x1e, 0xd3, 0x57,
+  0x7b, 0x2b, 0xbd, 0xb1, 0x2f, 0x76, 0xb6, 0x31, 0x6d, 0xf3, 0x0e,
+  0xf2, 0x6d, 0x1c, 0x7b, 0x2d, 0x7a, 0xe0, 0x05, 0x7b, 0xea, 0xa9,
+  0x04, 0xa1, 0xd4, 0x55, 0x9a, 0x1b, 0x2a, 0x8f, 0x73, 0x6f, 0xd0,
+  0x2c, 0xb1, 0x66, 0xbb, 0x3f, 0xea, 0xaf, 0x78, 0xd6, 0x74, 0xce,
+  0xb0, 0xbc, 0x76, 0xaa, 0xb9, 0x3b, 0x4d, 0xa6, 0x51, 0x5b, 0xd2,
+  0xe0, 0x39, 0x96, 0xde, 0xde, 0x41, 0xb0, 0x60, 0x60, 0x6a, 0xb0,
+  0x9e, 0x4c, 0x51, 0xd3, 0x3e, 0x0a, 0x43, 0xc4, 0xaf, 0x6c, 0x26,
+  0xf5, 0x33, 0xec, 0x50, 0xcc, 0x1d, 0xb5, 0xef, 0xe7, 0xf5, 0x31,
+  0x47, 0x3c, 0x18, 0x9c, 0x72, 0xf1, 0xe2, 0x20, 0xc4, 0xfa, 0x52,
+  0xa1, 0x4b, 0x02, 0x6a, 0x1c, 0xa7, 0x31, 0x79, 0x03, 0x4b, 0x09,
+  0xa1, 0x29, 0x6a, 0x83, 0x5f, 0x69, 0x5d, 0x3d, 0xb5, 0x97, 0x68,
+  0xd5, 0x75, 0xcc, 0xb0, 0xb8, 0xf3, 0x45, 0x37, 0x33, 0xcf, 0xbc,
+  0xcc, 0xd2, 0x9c, 0xb9, 0xd2, 0x7d, 0x53, 0xb3, 0x78, 0x75, 0x2d,
+  0xe0, 0xc4, 0x7a, 0xf6, 0x1b, 0x6f, 0xc9, 0xd1, 0xad, 0xb1, 0xc6,
+  0x65, 0x50, 0x8e, 0x4f, 0x6e, 0xf2, 0xea, 0x74, 0x2a, 0x5c, 0x27,
+  0x27, 0x4c, 0xb6, 0x2b, 0xe4, 0x67, 0x3a, 0xed, 0x7c, 0x01, 0x5e,
+  0x36, 0x5a, 0xcd, 0x63, 0xd2, 0x9d, 0x43, 0x18, 0xe7, 0xe4, 0xbb,
+  0x85, 0x3c, 0x08, 0x41, 0xa5, 0xdb, 0xda, 0xee, 0x7c, 0xed, 0x39,
+  0xaa, 0x23, 0x23, 0x4c, 0xc3, 0xbf, 0xc8, 0x18, 0xe1, 0x74, 0xb0,
+  0xad, 0x61, 0x1b, 0x56, 0x52, 0x3f, 0x30, 0x20, 0xbf, 0x9d, 0xe2,
+  0x03, 0x1b, 0x0a, 0xbc, 0x81, 0xeb, 0x4e, 0x62, 0x43, 0x9a, 0xa3,
+  0xf9, 0xa7, 0xf3, 0x4f, 0xe0, 0x63, 0x8c, 0xd9, 0xba, 0x54, 0x2e,
+  0xa4, 0x9a, 0x3c, 0x71, 0xee, 0xf8, 0xef, 0xcd, 0x8d, 0xa8, 0x01,
+  0x37, 0xbe, 0xac, 0xf0, 0xf1, 0xab, 0x69, 0xfd, 0x46, 0xbb, 0x70,
+  0x06, 0xaa, 0x25, 0x5c, 0xfe, 0xae, 0x83, 0x27, 0x1f, 0x93, 0x70,
+  0x13, 0xf1, 0x61, 0x3c, 0xaf, 0x11, 0x01, 0xf3, 0x2d, 0xce, 0x93,
+  0xec, 0xe1, 0xbf, 0xa2, 0x9a, 0x07, 0xbd, 0x42, 0x68, 0xc3, 0xb7,
+  0x1e, 0x22, 0x35, 0xcd, 0x3f, 0x1f, 0xdb, 0x9d, 0x9b, 0xf7, 0x51,
+  0xad, 0x68, 0x7c, 0xce, 0x80, 0xd8, 0xee, 0xb5, 0x90, 0xb2, 0x7a,
+  0x37, 0x1f, 0x1a, 0xa0, 0xd2, 0x88, 0xd0, 0xa7, 0x97, 0xb6, 0x83,
+  0x1e, 0xb2, 0x77, 0x5d, 0xf3, 0x31, 0x42, 0xdb, 0x6d, 0x4c, 0xfd,
+  0x30, 0xa7, 0x0c, 0xc7, 0x38, 0xad, 0x3d, 0xa9, 0x2a, 0x99, 0x37,
+  0xb1, 0x3e, 0xf3, 0x88, 0xb6, 0xc8, 0x0f, 0x2f, 0x27, 0x3a, 0xc9,
+  0xc3, 0x91, 0x76, 0x87, 0x63, 0x69, 0xbd, 0x30, 0x1c, 0xf2, 0x26,
+  0xf5, 0xa5, 0x27, 0x27, 0x8c, 0x46, 0x42, 0xf4, 0x0b, 0xee, 0x26,
+  0x5d, 0xd7, 0xb2, 0xdf, 0xab, 0x36, 0xed, 0x0b, 0x04, 0xbe, 0x2a,
+  0x6a, 0x9f, 0xd9, 0xd5, 0xad, 0xf0, 0x30, 0x9f, 0x2a, 0xf9, 0xb0,
+  0x89, 0x7f, 0x87, 0x44, 0x71, 0x32, 0xc7, 0x76, 0xcc, 0xf2, 0x39,
+  0x46, 0x38, 0x40, 0x96, 0xcc, 0x5a, 0xe0, 0x21, 0x3d, 0xd2, 0xa7,
+  0x82, 0x33, 0xb2, 0xf9, 0x10, 0xf5, 0x34, 0x8c, 0x1b, 0x52, 0xd3,
+  0xbd, 0xd9, 0x44, 0x8b, 0x24, 0x51, 0x8c, 0xf4, 0xad, 0xf2, 0x98,
+  0x6a, 0x3a, 0x68, 0xdc, 0xb6, 0x45, 0x30, 0x5d, 0xa5, 0xa6, 0x34,
+  0x23, 0xa6, 0x79, 0x5d, 0x85, 0x05, 0xd3, 0xeb, 0xbc, 0x5c, 0xf6,
+  0x29, 0xd9, 0x39, 0x67, 0x74, 0x33, 0x52, 0x5b, 0xfe, 0x5d, 0xc8,
+  0x58, 0x44, 0xa7, 0x5c, 0x0d, 0x37, 0xcf, 0x61, 0xd3, 0xf9, 0x4d,
+  0x0e, 0x4d, 0x7e, 0xf5, 0xb2, 0xef, 0x16, 0x0d, 0x69, 0x72, 0x39,
+  0x88, 0xe7, 0x58, 0xb9, 0x56, 0x62, 0xb7, 0x68, 0xc7, 0x30, 0x1a,
+  0xa4, 0x06, 0xda, 0x03, 0x17, 0xcb, 0x2b, 0xf0, 0xa0, 0x84, 0xc2,
+  0x7e, 0x43, 0x5e, 0xb7, 0x04, 0x23, 0x3c, 0x8f, 0x86, 0x1d, 0xce,
+  0x0b, 0x4e, 0x42, 0x68, 0x56, 0xdf, 0xda, 0x34, 0x8f, 0x3f, 0x19,
+  0xe6, 0x6b, 0x6e, 0xf6, 0x18, 0xbe, 0x09, 0xb2, 0xc7, 0xaf, 0x4a,
+  0x17, 0xa3, 0xaf, 0x8e, 0x45, 0x1c, 0x17, 0x15, 0x7f, 0x42, 0xbb,
+  0xff, 0xc8, 0xeb, 0xd8, 0xee, 0xfa, 0xec, 0x28, 0x66, 0xc4
+};
+
+static const uint8_t blake2xb_keyed_1000[1000] = {
+  0x3b, 0x72, 0x8b, 0xee, 0xe4, 0x03, 0x7c, 0xdf, 0x57, 0x0b, 0x87,
+  0x02, 0xce, 0xf8, 0x4e, 0x63, 0x67, 0x59, 0x67, 0x5d, 0x96, 0x74,
+  0x9b, 0x10, 0xca, 0xe4, 0x62, 0x44, 0x64, 0x5e, 0x89, 0x08, 0x1e,
+  0x72, 0x64, 0x8c, 0x19, 0x4a, 0xed, 0xdc, 0x76, 0xe1, 0xd7, 0xf4,
+  0xef, 0x64, 0x87, 0xd3, 0xdf, 0x19, 0x74, 0xc8, 0xf7, 0x69, 0xf6,
+  0xf0, 0x88, 0x44, 0xa2, 0xab, 0x2f, 0xb8, 0x7b, 0xda, 0x57, 0xdb,
+  0x59, 0x61, 0xe4, 0x12, 0x11, 0xa1, 0x9d, 0xe6, 0x5f, 0xc5, 0x69,
+  0x50, 0x45, 0x36, 0xe2, 0x41, 0x24, 0xcd, 0x2b, 0x4e, 0xe1, 0xc3,
+  0x26, 0x9d, 0x06, 0xfd, 0x40, 0x63, 0x80, 0x0a, 0x19, 0xc1, 0xdc,
+  0xee, 0xa6, 0x3c, 0x00, 0x13, 0xf6, 0xd7, 0xbf, 0x9b, 0xe4, 0x27,
+  0x29, 0x75, 0x4e, 0x2e, 0x9b, 0x91, 0x0c, 0x6e, 0xb0, 0x1f, 0x82,
+  0xeb, 0x87, 0x87, 0xb7, 0x86, 0xe6, 0x08, 0x6d, 0x6d, 0xd1, 0xf3,
+  0x06, 0xd1, 0x4e, 0xdf, 0x96, 0xc5, 0x71, 0xe0, 0x14, 0x60, 0xf3,
+  0xd0, 0x03, 0x95, 0xb2, 0x27, 0x4b, 0x95, 0x50, 0x74, 0xa7, 0x1a,
+  0xb2, 0x8f, 0x04, 0xd3, 0x8e, 0x36, 0x3f, 0xe1, 0x82, 0x29, 0x36,
+  0xa7, 0xd0, 0x26, 0xf8, 0xc1, 0xca, 0xfc, 0x3a, 0x25, 0x7b, 0xc6,
+  0x49, 0x04, 0xbc, 0x40, 0x87, 0xc5, 0x9d, 0xb9, 0x48, 0x95, 0x8d,
+  0x47, 0xd2, 0xcd, 0xea, 0xad, 0x3d, 0x09, 0xc5, 0x21, 0x30, 0xb9,
+  0xa0, 0xf7, 0x62, 0xdf, 0x9d, 0x69, 0x7a, 0x4d, 0xa7, 0x0b, 0x39,
+  0xef, 0x31, 0xe0, 0xd8, 0x77, 0xf3, 0x6e, 0xe0, 0x7d, 0xa5, 0x14,
+  0xb1, 0xaa, 0x0b, 0xb2, 0xa1, 0xbf, 0x7c, 0x23, 0xa4, 0x33, 0x44,
+  0x20, 0x09, 0x53, 0x35, 0x3a, 0xa2, 0x6b, 0xa6, 0x5d, 0xea, 0x77,
+  0x1c, 0xd2, 0x06, 0xdb, 0x86, 0xb7, 0x33, 0x02, 0x2e, 0x14, 0x64,
+  0xb2, 0x70, 0xd0, 0x9b, 0x6e, 0x72, 0xb2, 0x90, 0x92, 0xf7, 0x8a,
+  0x86, 0xa4, 0x21, 0xf7, 0xc2, 0x0b, 0xdc, 0xb9, 0x99, 0x23, 0x46,
+  0xa0, 0xad, 0x14, 0x37, 0xed, 0x9e, 0x16, 0xc0, 0xb0, 0x34, 0xa7,
+  0x1b, 0x8a, 0x78, 0x4c, 0x7e, 0xc5, 0x9f, 0xfa, 0xa7, 0xc1, 0x9e,
+  0x2d, 0xfc, 0x51, 0x20, 0x1c, 0x83, 0xc1, 0xcf, 0xfe, 0x4b, 0x38,
+  0xde, 0x7e, 0x56, 0x14, 0xf0, 0x2c, 0x78, 0x31, 0x90, 0xbf, 0xe0,
+  0x09, 0xe7, 0x38, 0x7c, 0x77, 0xfa, 0x64, 0x13, 0x39, 0x96, 0x11,
+  0xd6, 0x0b, 0x03, 0x47, 0x46, 0x1d, 0xe4, 0x38, 0xe1, 0x1b, 0x34,
+  0xc8, 0xe0, 0xe8, 0x80, 0xc4, 0x14, 0xeb, 0x7a, 0xad, 0xf8, 0x79,
+  0x59, 0x07, 0xae, 0x86, 0xa6, 0x71, 0x33, 0x43, 0x9c, 0xeb, 0x6a,
+  0x25, 0x81, 0x1d, 0x1d, 0xbc, 0xda, 0xa2, 0x0e, 0xc1, 0x5d, 0x5e,
+  0x82, 0xed, 0x72, 0xb5, 0x5a, 0x8f, 0xc0, 0x1b, 0x4f, 0x0b, 0x83,
+  0x0a, 0xff, 0x88, 0x58, 0xd0, 0x4c, 0xce, 0xbd, 0x43, 0xaa, 0x88,
+  0xa0, 0x56, 0xa4, 0xbf, 0x95, 0x4d, 0x3f, 0x30, 0x92, 0x2a, 0x06,
+  0xb3, 0x96, 0x34, 0xc6, 0xf1, 0x50, 0x16, 0x49, 0x62, 0x58, 0x5e,
+  0x3e, 0x3a, 0xc2, 0xe0, 0xfb, 0x1b, 0x44, 0xd0, 0x0d, 0x84, 0x81,
+  0x7f, 0xbc, 0x63, 0x9d, 0x18, 0x01, 0xd0, 0x6c, 0x9e, 0x24, 0x7b,
+  0xa7, 0x50, 0x9b, 0x05, 0x02, 0xfa, 0xae, 0xef, 0xae, 0xf5, 0xd7,
+  0xf3, 0xc9, 0x83, 0x61, 0x7a, 0xec, 0x67, 0x21, 0x93, 0xf9, 0x2f,
+  0xcb, 0xa2, 0x71, 0xfd, 0x9e, 0x6b, 0xad, 0x1a, 0xad, 0xdf, 0x51,
+  0x2d, 0x80, 0x82, 0x2f, 0xda, 0x9f, 0xfc, 0xde, 0x72, 0x93, 0x40,
+  0x3b, 0x79, 0x18, 0x27, 0x1d, 0xcf, 0xda, 0xa0, 0xd0, 0x9b, 0xc4,
+  0xfc, 0xb8, 0x9f, 0xeb, 0x95, 0x48, 0x56, 0x87, 0x70, 0xe9, 0xff,
+  0xa7, 0x3f, 0x70, 0x35, 0xe1, 0x6f, 0x3d, 0x09, 0xe5, 0x99, 0x8d,
+  0x01, 0x22, 0x59, 0xed, 0x83, 0x47, 0xbe, 0xde, 0x3a, 0x3c, 0x68,
+  0xb3, 0x8d, 0x38, 0xe4, 0x1d, 0x8d, 0xac, 0x1b, 0xe3, 0xb4, 0x6c,
+  0xf1, 0x27, 0xc5, 0xfb, 0x7e, 0xef, 0xd7, 0x0b, 0xac, 0xc1, 0x57,
+  0x4b, 0x30, 0xb7, 0x5b, 0x3d, 0xb4, 0x24, 0x75, 0xcf, 0x11, 0x5a,
+  0xec, 0x4a, 0x96, 0x12, 0x27, 0x70, 0xcf, 0x70, 0x4c, 0x13, 0x2c,
+  0x0e, 0x4f, 0x0d, 0x34, 0xef, 0x02, 0x48, 0x6d, 0x4a, 0xd9, 0xed,
+  0xde, 0xab, 0x15, 0x91, 0xe4, 0x0d, 0x43, 0x7a, 0xe5, 0x96, 0x77,
+  0x8c, 0x98, 0x40, 0x07, 0xb4, 0xff, 0x63, 0x76, 0x33, 0xdf, 0x39,
+  0x34, 0x5a, 0x2f, 0x5a, 0x98, 0x4f, 0xc3, 0xdb, 0x3f, 0xb3, 0xef,
+  0x4f, 0x65, 0x7b, 0x23, 0x93, 0x4f, 0xec, 0xdf, 0x08, 0x21, 0x37,
+  0xee, 0xdd, 0x4c, 0xfd, 0xa4, 0x61, 0x1a, 0xe1, 0xe8, 0x18, 0xcc,
+  0xce, 0xae, 0x4e, 0x66, 0x97, 0x94, 0xac, 0x3e, 0xbc, 0x5e, 0x09,
+  0xb2, 0x2a, 0x08, 0xd6, 0x5d, 0xc8, 0x4e, 0xc7, 0xf3, 0x0c, 0xc9,
+  0xc9, 0x4b, 0x6b, 0x87, 0xf0, 0x88, 0x80, 0x53, 0x56, 0x7b, 0xb5,
+  0x61, 0x0d, 0x5c, 0xa7, 0x9d, 0xbd, 0xa4, 0xce, 0x7e, 0xa8, 0x2d,
+  0x01, 0x41, 0x4c, 0x6a, 0x5a, 0xe8, 0xfe, 0x84, 0x8b, 0x39, 0x35,
+  0x27, 0x60, 0x35, 0x99, 0x5a, 0x15, 0xc1, 0xa9, 0x1d, 0x98, 0xdd,
+  0xae, 0xc5, 0x06, 0xed, 0xf4, 0xba, 0xcf, 0x43, 0x1b, 0x88, 0xe7,
+  0x18, 0x21, 0x60, 0x47, 0x4e, 0xcc, 0x4a, 0x9f, 0x31, 0xdf, 0x9b,
+  0x30, 0xd4, 0x25, 0x54, 0x18, 0x55, 0xab, 0x7c, 0x1a, 0x78, 0xb9,
+  0xeb, 0x7b, 0x77, 0x6f, 0xd7, 0x2f, 0x23, 0xdb, 0x3a, 0xa8, 0x60,
+  0x8a, 0xb3, 0xb4, 0x73, 0x14, 0x12, 0xb0, 0xc3, 0x10, 0xf4, 0x6b,
+  0x44, 0xe2, 0x35, 0x7f, 0x9f, 0xe0, 0x08, 0x46, 0xee, 0x82, 0x79,
+  0x34, 0xee, 0xa3, 0x8a, 0x78, 0x69, 0x06, 0xa7, 0x3c, 0x73, 0x34,
+  0xae, 0xee, 0x49, 0x98, 0x20, 0x17, 0xcc, 0x9a, 0xc7, 0x05, 0x6a,
+  0xe8, 0x61, 0x3d, 0xda, 0x6d, 0xd5, 0x62, 0x93, 0x79, 0x8e, 0xc2,
+  0xc3, 0xb6, 0x71, 0xe8, 0x50, 0x79, 0x5e, 0x40, 0x11, 0xd8, 0xb3,
+  0xaf, 0x7c, 0x8e, 0x08, 0xd9, 0xc7, 0x1b, 0x36, 0x86, 0x0c, 0x65,
+  0x36, 0x18, 0xdc, 0x4d, 0xd9, 0x11, 0xe5, 0xbb, 0xf0, 0xbf, 0x6f,
+  0xa0, 0x4d, 0x2a, 0x9c, 0xfb, 0x9e, 0xfb, 0x58, 0x59, 0x49, 0xdb,
+  0x55, 0xc8, 0xad, 0xa6, 0x9b, 0xd1, 0x5a, 0x63, 0x4c, 0x9a, 0x03,
+  0xe0, 0x49, 0xb9, 0x1b, 0xbe, 0xe9, 0xe6, 0x62, 0x85, 0x4c, 0x68,
+  0xba, 0xd9, 0x01, 0x4b, 0x4e, 0xb9, 0x9d, 0x53, 0x30, 0x23, 0x9c,
+  0xb8, 0xe2, 0x24, 0xc4, 0x14, 0x09, 0xe5, 0x6c, 0xa0, 0xaf, 0xab,
+  0x7c, 0x6b, 0xdc, 0x41, 0xe2, 0x36, 0xc2, 0x54, 0xd7, 0x32, 0xfc,
+  0xbd, 0x93, 0x9d, 0x5f, 0x9d, 0xe6, 0x48, 0xe3, 0x30, 0x1f, 0xed,
+  0xf7, 0x59, 0x75, 0x10, 0x4f, 0xcf, 0x75, 0xad, 0x61, 0xa8, 0xcd,
+  0xe9, 0x45, 0x20, 0x32, 0xea, 0x01, 0x06, 0x65, 0x13, 0xba, 0x00,
+  0x2a, 0x97, 0x60, 0xe7, 0x0f, 0x4f, 0xfd, 0xc4, 0x59, 0xe0, 0xfa,
+  0xe0, 0x20, 0x66, 0x85, 0x58, 0x2b, 0xa3, 0x08, 0x75, 0x71, 0xf2,
+  0x9f, 0xd2, 0x9f, 0x3b, 0xe0, 0x18, 0xf5, 0x34, 0x06, 0x43, 0xd7,
+  0xd3, 0x3e, 0x73, 0x94, 0x02, 0xeb, 0x41, 0x16, 0x6e, 0x06, 0x9d,
+  0xed, 0x36, 0xbb, 0xba, 0xfe, 0x71, 0x0d, 0xd2, 0x90, 0xae, 0xc2,
+  0x93, 0x87, 0x54, 0x55, 0xb2, 0xc5, 0x7c, 0xc9, 0x0c, 0x34
+};
+
+static const struct blake2xb_testcase testcases[] = {
+  { 1, 0, blake2xb_1 },
+  { 1, BLAKE2XB_KEY_SIZE, blake2xb_keyed_1 },
+  { 32, 0, blake2xb_32 },
+  { 32, BLAKE2XB_KEY_SIZE, blake2xb_keyed_32 },
+  { 63, 0, blake2xb_63 },
+  { 63, BLAKE2XB_KEY_SIZE, blake2xb_keyed_63 },
+  { 64, 0, blake2xb_64 },
+  { 64, BLAKE2XB_KEY_SIZE, blake2xb_keyed_64 },
+  { 65, 0, blake2xb_65 },
+  { 65, BLAKE2XB_KEY_SIZE, blake2xb_keyed_65 },
+  { 128, 0, blake2xb_128 },
+  { 128, BLAKE2XB_KEY_SIZE, blake2xb_keyed_128 },
+  { 199, 0, blake2xb_199 },
+  { 199, BLAKE2XB_KEY_SIZE, blake2xb_keyed_199 },
+  { 1000, 0, blake2xb_1000 },
+  { 1000, BLAKE2XB_KEY_SIZE, blake2xb_keyed_1000 },
+};
+
+static bool run_blake2xb_testcase (const struct blake2xb_testcase *);
+
+int
+main (void)
+{
+  uint32_t i;
+  int rv;
+
+  rv = 0;
+  for (i = 0; i < (sizeof (testcases) / sizeof (testcases[0])); ++i)
+    {
+      if (!run_blake2xb_testcase (&testcases[i]))
+        {
+          fprintf (stderr, "BLAKE2Xb test %u failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  return rv;
+}
+
+static bool
+run_blake2xb_testcase (const struct blake2xb_testcase *test)
+{
+  struct blake2xb_ctx ctx;
+  uint8_t input[256], key[BLAKE2XB_KEY_SIZE];
+  uint8_t output[1000], incremental[1000];
+  size_t i;
+
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)i;
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)i;
+
+  blake2xb (output, input, key, test->outlen, sizeof (input), test->keylen);
+  for (i = 0; i < test->outlen; ++i)
+    printf ("%02x", output[i]);
+  printf ("\n");
+
+  /* Absorb the input a byte at a time. */
+  blake2xb_init_key (&ctx, test->outlen, key, test->keylen);
+  for (i = 0; i < sizeof (input); ++i)
+    blake2xb_update (&ctx, &input[i], 1);
+  blake2xb_final (incremental, &ctx);
+
+  return memcmp (output, test->output, test->outlen) == 0
+         && memcmp (incremental, test->output, test->outlen) == 0;
+}
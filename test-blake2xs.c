@@ -0,0 +1,398 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors for BLAKE2Xs. The input is the bytes 0 to 255 and the keyed
+ * cases use the bytes 0 to 31 as the key, like the reference KAT files.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2xs.h"
+
+struct blake2xs_testcase
+{
+  size_t outlen;
+  size_t keylen;
+  const uint8_t *output;
+};
+
+static const uint8_t blake2xs_1[1] = {
+  0x99
+};
+
+static const uint8_t blake2xs_keyed_1[1] = {
+  0x0e
+};
+
+static const uint8_t blake2xs_16[16] = {
+  0x54, 0x1e, 0x57, 0xa4, 0x98, 0x89, 0x09, 0xea, 0x2f, 0x81, 0x95,
+  0x3f, 0x6c, 0xa1, 0xcb, 0x75
+};
+
+static const uint8_t blake2xs_keyed_16[16] = {
+  0x19, 0xb8, 0x27, 0xf0, 0x54, 0xb6, 0x7a, 0x12, 0x0f, 0x11, 0xef,
+  0xb0, 0xd6, 0x90, 0xbe, 0x70
+};
+
+static const uint8_t blake2xs_31[31] = {
+  0xca, 0x46, 0xfb, 0x7d, 0x84, 0xd7, 0x26, 0xf5, 0x01, 0x1c, 0x00,
+  0xc3, 0x79, 0xef, 0x2f, 0xb6, 0x25, 0x15, 0x1c, 0x0a, 0x1f, 0x41,
+  0x6e, 0x62, 0xc9, 0xda, 0x2a, 0xa1, 0x4c, 0x33, 0xcb
+};
+
+static const uint8_t blake2xs_keyed_31[31] = {
+  0x02, 0xdd, 0x75, 0x8f, 0xa2, 0x31, 0x13, 0xa1, 0x4f, 0xd9, 0x48,
+  0x30, 0xe5, 0x0e, 0x0f, 0x6b, 0x86, 0xfa, 0xec, 0x4e, 0x55, 0x1e,
+  0x80, 0x8b, 0x0c, 0xa8, 0xd0, 0x0f, 0xef, 0x2a, 0x15
+};
+
+static const uint8_t blake2xs_32[32] = {
+  0x91, 0xca, 0xb8, 0x02, 0xb4, 0x66, 0x09, 0x28, 0x97, 0xc7, 0x63,
+  0x9a, 0x02, 0xac, 0xf5, 0x29, 0xca, 0x61, 0x86, 0x4e, 0x5e, 0x8c,
+  0x8e, 0x42, 0x2b, 0x3a, 0x93, 0x81, 0xa9, 0x51, 0x54, 0xd1
+};
+
+static const uint8_t blake2xs_keyed_32[32] = {
+  0xa4, 0xfe, 0x2b, 0xd0, 0xf9, 0x6a, 0x21, 0x5f, 0xa7, 0x16, 0x4a,
+  0xe1, 0xa4, 0x05, 0xf4, 0x03, 0x0a, 0x58, 0x6c, 0x12, 0xb0, 0xc2,
+  0x98, 0x06, 0xa0, 0x99, 0xd7, 0xd7, 0xfd, 0xd8, 0xdd, 0x72
+};
+
+static const uint8_t blake2xs_33[33] = {
+  0x02, 0x53, 0xf5, 0x48, 0x7d, 0x92, 0x7a, 0x5d, 0x35, 0xd0, 0x08,
+  0x9a, 0xd9, 0xca, 0xb2, 0xd7, 0x51, 0x5b, 0x65, 0xd3, 0x32, 0xe8,
+  0x70, 0xc7, 0x8d, 0x12, 0x29, 0xd1, 0xc5, 0x84, 0xbe, 0xc3, 0xd5
+};
+
+static const uint8_t blake2xs_keyed_33[33] = {
+  0x7d, 0xce, 0x71, 0x0a, 0x20, 0xf4, 0x2a, 0xb6, 0x87, 0xec, 0x6e,
+  0xa8, 0x3b, 0x53, 0xfa, 0xaa, 0x41, 0x82, 0x29, 0xce, 0x0d, 0x5a,
+  0x2f, 0xf2, 0xa5, 0xe6, 0x6d, 0xef, 0xb0, 0xb6, 0x5c, 0x03, 0xc9
+};
+
+static const uint8_t blake2xs_64[64] = {
+  0x57, 0xaa, 0x5c, 0x76, 0x1e, 0x7c, 0xfa, 0x57, 0x3c, 0x48, 0x78,
+  0x51, 0x09, 0xad, 0x76, 0x44, 0x54, 0x41, 0xde, 0x0e, 0xe0, 0xf9,
+  0xfe, 0x9d, 0xd4, 0xab, 0xb9, 0x20, 0xb7, 0xcb, 0x5f, 0x60, 0x8f,
+  0xc9, 0xa0, 0x29, 0xf8, 0x5e, 0xc4, 0x78, 0xa1, 0x30, 0xf1, 0x94,
+  0x37, 0x2b, 0x61, 0x12, 0xf5, 0xf2, 0xd1, 0x04, 0x08, 0xe0, 0xd2,
+  0x3f, 0x69, 0x6c, 0xc9, 0xe3, 0x13, 0xb7, 0xf1, 0xd3
+};
+
+static const uint8_t blake2xs_keyed_64[64] = {
+  0xec, 0x47, 0x0d, 0x0a, 0xa9, 0x32, 0xc7, 0x8c, 0x5b, 0xcf, 0x86,
+  0x20, 0x3e, 0xc0, 0x01, 0x43, 0x14, 0x11, 0x47, 0x65, 0xfa, 0x67,
+  0x9c, 0x3d, 0xae, 0xf2, 0x14, 0xf8, 0x83, 0xa1, 0x7e, 0x1b, 0x4c,
+  0xa1, 0x2f, 0x44, 0x43, 0x37, 0x72, 0xa6, 0xe4, 0xef, 0x68, 0x5c,
+  0x90, 0x4b, 0x2f, 0xc3, 0x55, 0x86, 0xc6, 0xbd, 0x88, 0xf3, 0x25,
+  0xb9, 0x65, 0x96, 0x8b, 0x06, 0xd8, 0x08, 0xd7, 0x3f
+};
+
+static const uint8_t blake2xs_103[103] = {
+  0xe8, 0xb1, 0x1e, 0x72, 0x0b, 0x08, 0x70, 0xdb, 0x77, 0x6a, 0x8f,
+  0x68, 0x2b, 0x85, 0xc8, 0x65, 0x14, 0x4f, 0xfa, 0xe5, 0xa7, 0xab,
+  0x78, 0x49, 0xbb, 0xd0, 0xcd, 0x90, 0x77, 0xe5, 0xf6, 0x4d, 0x4e,
+  0xe4, 0xae, 0xc0, 0xb2, 0x5d, 0x06, 0xff, 0x5d, 0x2a, 0xd5, 0x28,
+  0xb1, 0x24, 0x8d, 0xf9, 0x0a, 0x3d, 0xc8, 0xcc, 0x18, 0x9c, 0xec,
+  0x02, 0x6b, 0x22, 0x91, 0x0d, 0x57, 0xd7, 0x56, 0xb1, 0x21, 0x53,
+  0x36, 0x20, 0x01, 0x92, 0x0c, 0x3f, 0x82, 0xd1, 0x02, 0xf9, 0x10,
+  0xea, 0xfd, 0xd3, 0x4b, 0x1a, 0x50, 0xe9, 0xb9, 0x9b, 0x01, 0x91,
+  0x07, 0xe7, 0x64, 0xb5, 0xb8, 0xee, 0xda, 0x5b, 0x46, 0x5c, 0x75,
+  0x5d, 0x68, 0x44, 0x89
+};
+
+static const uint8_t blake2xs_keyed_103[103] = {
+  0x38, 0xc8, 0x76, 0xa0, 0x07, 0xec, 0x72, 0x7c, 0x92, 0xe2, 0x50,
+  0x39, 0x90, 0xc4, 0xd9, 0x40, 0x7c, 0xea, 0x22, 0x71, 0x02, 0x6a,
+  0xee, 0x88, 0xcd, 0x7b, 0x16, 0xc4, 0x39, 0x6f, 0x00, 0xcc, 0x4b,
+  0x76, 0x05, 0x76, 0xad, 0xf2, 0xd6, 0x83, 0x71, 0x3a, 0x3f, 0x60,
+  0x63, 0xcc, 0x13, 0xec, 0xd7, 0xe4, 0xf3, 0xb6, 0x14, 0x8a, 0xd9,
+  0x14, 0xca, 0x89, 0xf3, 0x4d, 0x13, 0x75, 0xaa, 0x4c, 0x8e, 0x20,
+  0x33, 0xf1, 0x31, 0x51, 0x53, 0x18, 0x95, 0x07, 0xbf, 0xd1, 0x16,
+  0xb0, 0x7f, 0xc4, 0xbc, 0x14, 0xf7, 0x51, 0xbb, 0xbb, 0x0e, 0x75,
+  0x2f, 0x62, 0x11, 0x53, 0xae, 0x8d, 0xf4, 0xd6, 0x84, 0x91, 0xa2,
+  0x24, 0x30, 0xb3, 0x09
+};
+
+static const uint8_t blake2xs_1000[1000] = {
+  0xd0, 0x30, 0xd5, 0x05, 0xfc, 0x75, 0xe5, 0xcf, 0x8c, 0xd3, 0x90,
+  0xe3, 0x9f, 0x05, 0x29, 0x06, 0x57, 0x52, 0x00, 0xf3, 0x4a, 0xd5,
+  0x5b, 0x5b, 0x3e, 0x33, 0xc9, 0x41, 0xf8, 0x33, 0xf4, 0x69, 0x36,
+  0x10, 0xd3, 0xaf, 0x14, 0xee, 0x18, 0x2a, 0xac, 0x45, 0xd4, 0x4b,
+  0x6a, 0x1c, 0xbc, 0x4a, 0x5f, 0x42, 0xb3, 0x10, 0xbe, 0x54, 0x8f,
+  0x84, 0x14, 0x32, 0x1a, 0xce, 0x5b, 0xe4, 0x5e, 0x0f, 0x98, 0x09,
+  0x83, 0x9a, 0x7c, 0xa3, 0xfd, 0x6e, 0x72, 0x58, 0xdd, 0x89, 0xd9,
+  0x44, 0xe0, 0x2d, 0x2f, 0x51, 0xae, 0xc6, 0x40, 0xa6, 0x48, 0x39,
+  0x41, 0x76, 0xac, 0x01, 0x66, 0x26, 0x15, 0x51, 0xd7, 0x10, 0x18,
+  0x74, 0xbf, 0x88, 0x28, 0x36, 0xe6, 0xaf, 0x59, 0x6f, 0xba, 0x89,
+  0xe5, 0x5c, 0x7c, 0xcd, 0x79, 0x63, 0x71, 0x03, 0xfd, 0xba, 0x59,
+  0x7e, 0x80, 0xc0, 0xa8, 0x20, 0x1a, 0xb5, 0xe3, 0x60, 0xaf, 0x07,
+  0xb4, 0xba, 0x82, 0x60, 0xf3, 0x40, 0x63, 0x66, 0x4c, 0xb7, 0x2a,
+  0x38, 0x41, 0x18, 0x54, 0xd9, 0xeb, 0x28, 0x37, 0x54, 0x04, 0x8a,
+  0x70, 0x13, 0x6f, 0x3d, 0xc3, 0x8c, 0x43, 0x7e, 0x79, 0x02, 0x66,
+  0x45, 0xe5, 0x5d, 0x24, 0x4e, 0x98, 0x0d, 0x93, 0xcb, 0x31, 0x26,
+  0x09, 0xfa, 0x7f, 0xc0, 0x43, 0x9e, 0x2f, 0xfc, 0xb5, 0x57, 0x17,
+  0xc4, 0xa3, 0xab, 0x54, 0xd8, 0xf8, 0x3b, 0xae, 0x66, 0xb7, 0x3f,
+  0xb4, 0x44, 0x99, 0x26, 0x30, 0x13, 0xd3, 0x98, 0xe7, 0xbc, 0xa5,
+  0x7e, 0x3c, 0x35, 0xb8, 0x3f, 0xaa, 0x37, 0xe7, 0x16, 0x45, 0x07,
+  0x10, 0xf9, 0xc4, 0x44, 0xc8, 0xd4, 0xf1, 0x58, 0xc1, 0xd8, 0x95,
+  0x2a, 0xd2, 0x10, 0xea, 0x74, 0xf3, 0xc0, 0x7c, 0x42, 0x96, 0xa1,
+  0xc5, 0xbb, 0x89, 0xc3, 0xfc, 0x32, 0xe9, 0xb8, 0x4f, 0x5c, 0xae,
+  0xb4, 0x7f, 0x96, 0x90, 0x1e, 0x41, 0xe1, 0x26, 0xd8, 0x34, 0x9e,
+  0xd4, 0x82, 0xa5, 0x15, 0x6e, 0xf1, 0x1d, 0x67, 0x98, 0x64, 0x3d,
+  0x98, 0xc2, 0x53, 0x04, 0xa0, 0x83, 0x46, 0xc3, 0xdc, 0x9a, 0xa2,
+  0xe2, 0xd6, 0x17, 0xb3, 0xac, 0x8e, 0x06, 0xe8, 0xfb, 0x0b, 0xdf,
+  0xc0, 0xca, 0x23, 0x70, 0x2c, 0x2c, 0xa2, 0xc6, 0xc4, 0x68, 0xb9,
+  0xb4, 0x12, 0x17, 0x29, 0x4a, 0xea, 0xa8, 0x82, 0x70, 0xd8, 0x2d,
+  0x97, 0x35, 0xda, 0x5a, 0xed, 0xd9, 0xfa, 0x1e, 0x49, 0xd4, 0x61,
+  0x24, 0x7d, 0x67, 0x79, 0xfe, 0x6c, 0xa2, 0x4e, 0x7a, 0xc6, 0x10,
+  0xe0, 0xe0, 0x12, 0x7f, 0x4b, 0x66, 0xab, 0xe3, 0x92, 0x39, 0xc4,
+  0x25, 0xe3, 0xca, 0x7f, 0xaa, 0x13, 0x3a, 0xc4, 0x1e, 0x79, 0x4b,
+  0xa8, 0xc1, 0x5d, 0x15, 0x7e, 0x67, 0xc5, 0x17, 0x44, 0x1c, 0xd5,
+  0xf4, 0x72, 0xda, 0x50, 0xb5, 0x2f, 0x38, 0xcb, 0x51, 0x2c, 0xd2,
+  0x4e, 0xbc, 0x56, 0x54, 0x57, 0x6a, 0x15, 0x6a, 0x7e, 0x04, 0xba,
+  0x27, 0xc8, 0xa8, 0xd3, 0xe0, 0xee, 0x51, 0x07, 0x7b, 0xfd, 0xc6,
+  0xeb, 0x08, 0x44, 0x1d, 0x26, 0x86, 0x9c, 0x85, 0x51, 0x48, 0x7a,
+  0x26, 0x5a, 0x2b, 0xd9, 0x53, 0xf7, 0x16, 0xe7, 0x16, 0x17, 0xee,
+  0xee, 0x1a, 0x47, 0x61, 0x9c, 0x02, 0x2d, 0xdd, 0xdc, 0x5d, 0x37,
+  0xb7, 0xb3, 0xdf, 0xcc, 0xec, 0x14, 0x5d, 0x48, 0xf4, 0xa6, 0xfc,
+  0x53, 0x03, 0xc6, 0x1f, 0xa1, 0x62, 0x36, 0xc1, 0xc8, 0xe4, 0x76,
+  0xab, 0x73, 0xed, 0x86, 0x64, 0x63, 0xc1, 0x3f, 0x00, 0x72, 0x57,
+  0x29, 0xd5, 0xec, 0xe6, 0x07, 0x5f, 0xb3, 0x3a, 0x50, 0x65, 0x15,
+  0x6a, 0x66, 0x99, 0x8f, 0x29, 0x7e, 0xd2, 0xac, 0xcf, 0xf4, 0x24,
+  0x17, 0x0f, 0x72, 0x53, 0xa6, 0x15, 0xc6, 0x04, 0xfb, 0x7f, 0xa9,
+  0xd3, 0x01, 0xb4, 0x16, 0xa8, 0x65, 0x6b, 0x84, 0xa1, 0x8b, 0x51,
+  0x64, 0xb2, 0x84, 0xa0, 0xa5, 0x52, 0xcf, 0x42, 0xc2, 0x5c, 0xa5,
+  0x24, 0x3f, 0xaa, 0x39, 0x38, 0xa9, 0xd5, 0x41, 0x7b, 0x25, 0x9f,
+  0x60, 0x9e, 0x36, 0xf8, 0x15, 0xc9, 0x66, 0xbb, 0x9a, 0x4f, 0x22,
+  0x7a, 0x13, 0x2c, 0x1e, 0xee, 0xb4, 0xb2, 0x66, 0x35, 0xfb, 0x3b,
+  0x68, 0x36, 0x65, 0x5c, 0x27, 0xcd, 0x51, 0x38, 0x5f, 0xb3, 0x05,
+  0x05, 0xa5, 0x17, 0x38, 0xe7, 0x40, 0xd7, 0x18, 0x2e, 0x95, 0xb3,
+  0x10, 0xdb, 0x6e, 0x23, 0x3f, 0x9d, 0xd7, 0xaf, 0xd2, 0x29, 0xf6,
+  0x80, 0x23, 0x39, 0x13, 0x07, 0x40, 0xf5, 0x5a, 0xaf, 0x91, 0xc2,
+  0x57, 0xc4, 0xa8, 0x57, 0xd5, 0xcd, 0x1b, 0x86, 0xdc, 0x1f, 0xa9,
+  0xc3, 0xda, 0x49, 0xe4, 0x29, 0x8b, 0x42, 0xcf, 0xa6, 0x60, 0x4a,
+  0x77, 0x86, 0x40, 0xc5, 0x99, 0x41, 0x46, 0xea, 0x26, 0x70, 0xcf,
+  0x6c, 0x7a, 0x59, 0x69, 0x0b, 0x2d, 0xbe, 0xd7, 0x37, 0x15, 0x0b,
+  0x59, 0x86, 0x3c, 0x6e, 0xbe, 0xd2, 0x91, 0xe7, 0xc9, 0xbf, 0xab,
+  0x06, 0xe7, 0xc4, 0x17, 0x56, 0x75, 0xfa, 0x01, 0xe4, 0xe2, 0xbe,
+  0x5c, 0x2f, 0x52, 0xd9, 0xd7, 0xfc, 0xd1, 0xe8, 0x51, 0x9d, 0x3b,
+  0x32, 0xa3, 0xbc, 0x36, 0xa7, 0x70, 0x5a, 0x27, 0xd9, 0xf6, 0xc5,
+  0x76, 0x7e, 0xc3, 0x36, 0x59, 0x26, 0x89, 0xac, 0x78, 0xaf, 0x36,
+  0x57, 0x3b, 0x57, 0x4e, 0xf4, 0x90, 0xaf, 0xb3, 0x96, 0xc2, 0xb3,
+  0x57, 0x21, 0x5e, 0xef, 0x8c, 0x37, 0xe6, 0x34, 0xc0, 0xa7, 0xf6,
+  0xa3, 0xc8, 0x2b, 0x9f, 0xb1, 0xe3, 0x58, 0x1e, 0x01, 0x58, 0xb3,
+  0xa6, 0xbe, 0x9e, 0xf9, 0xc5, 0x26, 0x5f, 0xd4, 0x68, 0x30, 0xa3,
+  0xa4, 0x65, 0xc1, 0x58, 0xd0, 0x24, 0x77, 0xb3, 0x32, 0x1f, 0xde,
+  0xa4, 0xb6, 0xf8, 0x20, 0xa3, 0x92, 0x9a, 0xc0, 0xb4, 0x67, 0xaf,
+  0x58, 0x12, 0x3a, 0xd4, 0x34, 0x00, 0xdb, 0x3b, 0x16, 0x59, 0x47,
+  0x5e, 0x18, 0xe5, 0xa3, 0xbf, 0x5b, 0x5c, 0x02, 0x64, 0xd0, 0x2e,
+  0x35, 0x26, 0xbb, 0x4e, 0x8f, 0xcf, 0xb1, 0xf5, 0xee, 0x4d, 0x59,
+  0x35, 0xaf, 0x3c, 0x22, 0x51, 0xd3, 0x47, 0xc5, 0x45, 0xdf, 0xf9,
+  0x26, 0x8a, 0x54, 0x1a, 0xa0, 0xe2, 0xc9, 0x40, 0xfa, 0xcf, 0xfe,
+  0x88, 0x41, 0x99, 0x47, 0x77, 0xa7, 0x44, 0xbd, 0xb2, 0x99, 0xd4,
+  0x50, 0x6e, 0x14, 0x16, 0x52, 0xfb, 0xec, 0xf5, 0x03, 0x47, 0xd6,
+  0x43, 0x45, 0x42, 0x06, 0x87, 0x04, 0xa6, 0xdc, 0xb7, 0x9b, 0x77,
+  0xc2, 0xaa, 0xbb, 0x12, 0x6e, 0xba, 0x7d, 0x84, 0x8d, 0xa3, 0x7a,
+  0x42, 0xab, 0x0f, 0xf1, 0x36, 0x4e, 0x06, 0x50, 0x56, 0x4f, 0x5f,
+  0x2f, 0x7a, 0xcd, 0x74, 0x36, 0x95, 0x8e, 0xe0, 0x79, 0x92, 0xf0,
+  0x08, 0x56, 0x67, 0x53, 0x5a, 0xde, 0xea, 0x52, 0x5a, 0x7e, 0x4e,
+  0xf1, 0x54, 0x36, 0xa3, 0xfa, 0x77, 0x98, 0xc9, 0x37, 0x8c, 0xc9,
+  0x63, 0x1c, 0x75, 0x99, 0x91, 0x51, 0x00, 0x9c, 0x0f, 0xe2, 0xbb,
+  0xdb, 0x9e, 0x1a, 0x35, 0x1a, 0xd6, 0x98, 0x13, 0x0a, 0x81, 0xfb,
+  0xc8, 0x12, 0x26, 0xf5, 0xf6, 0x27, 0xbb, 0xee, 0xb5, 0x8f, 0xb2,
+  0x5a, 0x18, 0x72, 0xf3, 0xa8, 0xef, 0x15, 0x66, 0x64, 0x60, 0xae,
+  0x9e, 0xe6, 0x23, 0x38, 0x0b, 0x7c, 0x93, 0x3d, 0xc9, 0xf9, 0x2b,
+  0xc8, 0x00, 0x21, 0xf7, 0x35, 0xcf, 0xfd, 0xf0, 0x3c, 0x58, 0x28,
+  0xf3, 0x05, 0x4d, 0xc9, 0x91, 0xdd, 0xe4, 0x34, 0x10, 0x54, 0x8b,
+  0x92, 0x30, 0xf7, 0x37, 0x96, 0xac, 0x14, 0x84, 0xba, 0x37
+};
+
+static const uint8_t blake2xs_keyed_1000[1000] = {
+  0xc5, 0x6b, 0xcc, 0xca, 0xcf, 0x14, 0xb5, 0xab, 0x50, 0x0f, 0xf3,
+  0xe0, 0xed, 0xcb, 0x56, 0xb7, 0x39, 0x40, 0x3f, 0x71, 0xd2, 0xcc,
+  0xd9, 0xa5, 0x13, 0xe1, 0x00, 0x6f, 0xf7, 0x1d, 0x94, 0xfc, 0x52,
+  0x09, 0x8e, 0x4f, 0xf9, 0xee, 0x5c, 0x32, 0x4a, 0x47, 0xf1, 0xff,
+  0x29, 0xd5, 0x48, 0xb5, 0x99, 0x41, 0x6e, 0x73, 0x8d, 0x21, 0x90,
+  0x18, 0x0a, 0x57, 0xd6, 0xd9, 0x49, 0x79, 0x18, 0x07, 0x62, 0x75,
+  0xfd, 0x0b, 0xaf, 0x3c, 0x02, 0x16, 0x9f, 0xd6, 0x1b, 0x37, 0x45,
+  0x24, 0x1c, 0x75, 0x7b, 0x13, 0xab, 0xe7, 0x92, 0x4e, 0xe7, 0x47,
+  0x80, 0x7f, 0x45, 0x58, 0x22, 0xc6, 0x11, 0xc5, 0x84, 0x72, 0x74,
+  0x88, 0x18, 0x90, 0x58, 0x6f, 0xf1, 0x48, 0xbd, 0x61, 0xb0, 0xd4,
+  0x69, 0x54, 0x2c, 0x2e, 0x86, 0xd0, 0x9b, 0x93, 0x3c, 0x10, 0x15,
+  0xf2, 0x8e, 0x5e, 0xe4, 0x17, 0xa6, 0x29, 0x23, 0x32, 0xf0, 0x80,
+  0x31, 0x74, 0x3b, 0xbc, 0xd8, 0x40, 0x5d, 0xfd, 0x63, 0xbc, 0xd8,
+  0xd7, 0xbe, 0xe8, 0xf5, 0x87, 0x1a, 0x9e, 0x6e, 0x67, 0x34, 0xdd,
+  0xb7, 0xbc, 0xa7, 0x1e, 0xea, 0x23, 0xb6, 0xc9, 0xff, 0x3e, 0xc6,
+  0x13, 0x27, 0xeb, 0x27, 0x0e, 0x44, 0x7e, 0xc3, 0xa9, 0x15, 0x56,
+  0x63, 0x50, 0xd8, 0xc2, 0x91, 0x75, 0x73, 0x01, 0xc5, 0xa4, 0x56,
+  0x69, 0x69, 0xbe, 0x55, 0xfb, 0xb0, 0xad, 0xa5, 0x6f, 0x64, 0x9f,
+  0xd1, 0x6a, 0xc0, 0x42, 0x69, 0x02, 0xb3, 0x5c, 0x57, 0x30, 0x67,
+  0xc6, 0xb8, 0xd0, 0x01, 0xa5, 0x7e, 0xee, 0xbb, 0x4e, 0xf8, 0x8a,
+  0xf9, 0x6a, 0x0b, 0x37, 0x83, 0x81, 0xc8, 0x5e, 0x87, 0x24, 0x39,
+  0x31, 0x38, 0x89, 0xf1, 0x8b, 0xcd, 0x23, 0x56, 0xfe, 0x6e, 0x79,
+  0x03, 0x7a, 0xdb, 0x9a, 0xd5, 0x60, 0x22, 0x0f, 0x26, 0x86, 0x6f,
+  0xa5, 0x71, 0x54, 0x35, 0x00, 0x2f, 0x45, 0x59, 0xa8, 0x9d, 0x52,
+  0x4a, 0x85, 0x9f, 0xb4, 0x7c, 0x9d, 0x98, 0x91, 0x73, 0x5c, 0x49,
+  0x81, 0x73, 0x9b, 0xd1, 0x66, 0x69, 0x2a, 0x11, 0x2e, 0x80, 0x75,
+  0x7b, 0x18, 0x19, 0x3d, 0xa2, 0x94, 0xd6, 0x93, 0x14, 0xa1, 0x12,
+  0x46, 0xcb, 0x45, 0x0d, 0x16, 0x79, 0xc5, 0xdd, 0x7a, 0x48, 0xfb,
+  0x75, 0x98, 0x6d, 0xde, 0x11, 0x9a, 0x18, 0x91, 0x73, 0x02, 0x77,
+  0xd1, 0x37, 0x99, 0xd1, 0xe2, 0xf8, 0xa9, 0xed, 0x82, 0xd4, 0xe7,
+  0x5e, 0xca, 0x42, 0xb2, 0x26, 0x28, 0xef, 0x38, 0x8a, 0x06, 0xd9,
+  0x43, 0xc2, 0xe9, 0x87, 0x5e, 0x09, 0x55, 0xc8, 0x1a, 0x9d, 0x1b,
+  0xce, 0x37, 0x9a, 0x75, 0xfb, 0x4f, 0xfe, 0x00, 0x4d, 0xf2, 0x53,
+  0x71, 0xa1, 0x88, 0x29, 0xad, 0xed, 0x65, 0x01, 0x45, 0x86, 0x42,
+  0x2f, 0x85, 0x95, 0x5a, 0xff, 0x4e, 0xb0, 0xe6, 0xf0, 0x70, 0xff,
+  0xf4, 0xca, 0x54, 0x0e, 0x00, 0x2d, 0xed, 0x55, 0x32, 0xf1, 0xb6,
+  0x1f, 0x9f, 0xde, 0x88, 0x98, 0x47, 0x2d, 0xbe, 0x0d, 0x28, 0x28,
+  0x05, 0x6f, 0x33, 0x14, 0xc6, 0x86, 0xdc, 0x1f, 0x30, 0x09, 0x4f,
+  0xe5, 0x40, 0x30, 0xab, 0xa5, 0x24, 0x5e, 0x52, 0x8f, 0x0c, 0x1f,
+  0xa1, 0xdd, 0x07, 0x1c, 0xe2, 0xe2, 0xa8, 0x26, 0xe4, 0xc2, 0xb6,
+  0x3e, 0x41, 0x0a, 0x3f, 0x1a, 0x4c, 0x0b, 0xa6, 0x8a, 0xc7, 0x18,
+  0x5b, 0x3e, 0xa5, 0x56, 0xe2, 0x77, 0xe5, 0x8f, 0x5f, 0x5a, 0xaa,
+  0x61, 0x1e, 0xfc, 0x88, 0xdc, 0xdf, 0xf7, 0x39, 0x46, 0xc7, 0xe1,
+  0x16, 0xbd, 0xa3, 0x95, 0x74, 0x82, 0xfb, 0xe7, 0x16, 0x56, 0xf7,
+  0xd0, 0x24, 0xfc, 0x3a, 0x39, 0x02, 0x47, 0xeb, 0x67, 0xc2, 0xf4,
+  0xf5, 0xcd, 0x3c, 0x7f, 0x6f, 0xdd, 0x2c, 0xc4, 0x04, 0x6c, 0x2e,
+  0x3e, 0xab, 0x18, 0x95, 0xf7, 0x56, 0xdd, 0xdf, 0x27, 0x7f, 0x7e,
+  0x7e, 0xdb, 0x70, 0xb3, 0x88, 0x36, 0xf6, 0xae, 0xcf, 0x5e, 0x54,
+  0x18, 0xa1, 0x5a, 0xad, 0x27, 0x8a, 0x9c, 0x76, 0x98, 0x29, 0x5d,
+  0x38, 0x04, 0xb6, 0xe1, 0x36, 0x01, 0xd2, 0x33, 0xdf, 0x86, 0x61,
+  0x81, 0x18, 0xea, 0xa9, 0xb9, 0x0d, 0x2e, 0x85, 0x39, 0x6c, 0xa8,
+  0xf8, 0x32, 0xfd, 0x8a, 0x19, 0xd4, 0x5a, 0x0a, 0xab, 0x1a, 0xc1,
+  0xec, 0x5b, 0x55, 0x3e, 0xf2, 0x2b, 0xc7, 0xf9, 0x13, 0xb1, 0x12,
+  0x05, 0x88, 0x60, 0x6d, 0x3a, 0xde, 0xec, 0x42, 0x74, 0x9a, 0x9a,
+  0xfe, 0xa9, 0xbb, 0xf7, 0x53, 0x2e, 0xdf, 0x28, 0x11, 0x2a, 0x7b,
+  0x7f, 0x5d, 0xd0, 0x4d, 0x4a, 0x57, 0x05, 0xf9, 0xfe, 0xf2, 0x32,
+  0x43, 0xb3, 0x78, 0x73, 0x15, 0xcd, 0x64, 0xa2, 0xd4, 0x19, 0xc0,
+  0x8a, 0xe0, 0xa3, 0x4a, 0x7f, 0x25, 0x5e, 0xe3, 0x74, 0x3b, 0xa6,
+  0x09, 0xdb, 0xf5, 0x8d, 0x83, 0x94, 0x80, 0x3f, 0x25, 0x7b, 0x5c,
+  0x64, 0x5c, 0xb0, 0xc2, 0xc3, 0x4b, 0xbc, 0x55, 0x31, 0xa5, 0x27,
+  0x2f, 0x90, 0xd2, 0xba, 0x75, 0xb0, 0xa4, 0x80, 0xea, 0xa2, 0xaa,
+  0x16, 0xba, 0xac, 0xc4, 0xd2, 0x4b, 0x28, 0xaa, 0x04, 0x0b, 0x4d,
+  0x15, 0x3a, 0x70, 0x95, 0xa5, 0xd7, 0x13, 0x05, 0xd7, 0x34, 0xde,
+  0xe0, 0xab, 0x2b, 0xbd, 0xcb, 0x44, 0xa5, 0xd6, 0xfb, 0xa7, 0xd1,
+  0x55, 0xdb, 0xf7, 0xb5, 0x2e, 0x40, 0x03, 0xc8, 0x5e, 0xa9, 0xc3,
+  0x66, 0xcd, 0x8f, 0xf8, 0xbe, 0x91, 0x9c, 0x83, 0xaa, 0xb8, 0xd4,
+  0xae, 0xe8, 0x21, 0x76, 0x94, 0x61, 0x9e, 0xc8, 0xf3, 0x8a, 0xb0,
+  0x22, 0x37, 0xee, 0xfd, 0x1d, 0x9c, 0x91, 0x68, 0x76, 0x54, 0xac,
+  0xd2, 0x50, 0xae, 0x51, 0x19, 0xd9, 0x16, 0x38, 0x35, 0xec, 0x68,
+  0x4f, 0xf6, 0xdf, 0xbc, 0xde, 0x64, 0x6c, 0xe5, 0x05, 0xee, 0xec,
+  0x4b, 0xae, 0x70, 0xf5, 0x90, 0x32, 0xb6, 0x02, 0x12, 0x17, 0x2b,
+  0x03, 0x3c, 0x44, 0xb8, 0xb2, 0xd4, 0x38, 0xeb, 0x5e, 0x30, 0x39,
+  0x41, 0xaa, 0xd9, 0x7c, 0xbe, 0xbf, 0x4b, 0x60, 0x68, 0x6c, 0xc0,
+  0xdf, 0x67, 0x6e, 0x81, 0x7d, 0x9c, 0x88, 0x0b, 0x1a, 0xbb, 0x92,
+  0x18, 0x4c, 0x21, 0x87, 0xd9, 0x6d, 0x5a, 0xd6, 0xc3, 0xb6, 0xb2,
+  0xb8, 0x1a, 0xda, 0x7c, 0xcc, 0xb1, 0x61, 0x29, 0x91, 0xf0, 0xcb,
+  0x64, 0x56, 0xca, 0xf5, 0x17, 0x67, 0x74, 0xdc, 0xd8, 0x46, 0x55,
+  0xe1, 0x22, 0x50, 0x26, 0xa8, 0x07, 0x98, 0x17, 0x54, 0x6e, 0x25,
+  0xbe, 0x7e, 0xdb, 0xa3, 0xe0, 0x0e, 0xc0, 0x04, 0xaf, 0x57, 0x06,
+  0xa9, 0xd9, 0x32, 0xcc, 0x3e, 0x2b, 0xae, 0x96, 0xd3, 0xfd, 0x12,
+  0x5e, 0xe2, 0x60, 0x29, 0x69, 0x61, 0xb6, 0x9d, 0x18, 0x4d, 0x1c,
+  0x3e, 0x16, 0x6d, 0xf3, 0x0b, 0xe9, 0x41, 0x1d, 0xb2, 0xdc, 0x50,
+  0xf1, 0xf0, 0xf6, 0x71, 0xc9, 0x4d, 0xc0, 0x41, 0x65, 0xd7, 0x64,
+  0xd7, 0x4b, 0x09, 0x37, 0x0e, 0x66, 0x32, 0x69, 0x47, 0x12, 0x8f,
+  0x5a, 0xc3, 0xde, 0x6e, 0xfc, 0xdb, 0x6f, 0x19, 0x8e, 0x43, 0x3d,
+  0x4e, 0xe4, 0xf2, 0x49, 0x78, 0x38, 0xe3, 0xa4, 0x34, 0x6d, 0xe4,
+  0xe1, 0xb1, 0x65, 0xa7, 0xa3, 0xc3, 0x5a, 0xdf, 0x9c, 0x70, 0x4c,
+  0xcb, 0x9e, 0x1f, 0x6e, 0x01, 0x7d, 0xd6, 0x47, 0xb4, 0x9c, 0x30,
+  0x93, 0xb8, 0xaa, 0x28, 0x95, 0x60, 0xd7, 0xc0, 0xbf, 0x07, 0x3e,
+  0x53, 0x3f, 0xd7, 0xc9, 0x4b, 0x37, 0xff, 0x74, 0x3d, 0xad, 0x39,
+  0x20, 0xe5, 0xfa, 0x63, 0x7d, 0xe3, 0xfe, 0x81, 0x6c, 0xeb
+};
+
+static const struct blake2xs_testcase testcases[] = {
+  { 1, 0, blake2xs_1 },
+  { 1, BLAKE2XS_KEY_SIZE, blake2xs_keyed_1 },
+  { 16, 0, blake2xs_16 },
+  { 16, BLAKE2XS_KEY_SIZE, blake2xs_keyed_16 },
+  { 31, 0, blake2xs_31 },
+  { 31, BLAKE2XS_KEY_SIZE, blake2xs_keyed_31 },
+  { 32, 0, blake2xs_32 },
+  { 32, BLAKE2XS_KEY_SIZE, blake2xs_keyed_32 },
+  { 33, 0, blake2xs_33 },
+  { 33, BLAKE2XS_KEY_SIZE, blake2xs_keyed_33 },
+  { 64, 0, blake2xs_64 },
+  { 64, BLAKE2XS_KEY_SIZE, blake2xs_keyed_64 },
+  { 103, 0, blake2xs_103 },
+  { 103, BLAKE2XS_KEY_SIZE, blake2xs_keyed_103 },
+  { 1000, 0, blake2xs_1000 },
+  { 1000, BLAKE2XS_KEY_SIZE, blake2xs_keyed_1000 },
+};
+
+static bool run_blake2xs_testcase (const struct blake2xs_testcase *);
+
+int
+main (void)
+{
+  uint32_t i;
+  int rv;
+
+  rv = 0;
+  for (i = 0; i < (sizeof (testcases) / sizeof (testcases[0])); ++i)
+    {
+      if (!run_blake2xs_testcase (&testcases[i]))
+        {
+          fprintf (stderr, "BLAKE2Xs test %u failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  return rv;
+}
+
+static bool
+run_blake2xs_testcase (const struct blake2xs_testcase *test)
+{
+  struct blake2xs_ctx ctx;
+  uint8_t input[256], key[BLAKE2XS_KEY_SIZE];
+  uint8_t output[1000], incremental[1000];
+  size_t i;
+
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)i;
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)i;
+
+  blake2xs (output, input, key, test->outlen, sizeof (input), test->keylen);
+  for (i = 0; i < test->outlen; ++i)
+    printf ("%02x", output[i]);
+  printf ("\n");
+
+  /* Absorb the input a byte at a time. */
+  blake2xs_init_key (&ctx, test->outlen, key, test->keylen);
+  for (i = 0; i < sizeof (input); ++i)
+    blake2xs_update (&ctx, &input[i], 1);
+  blake2xs_final (incremental, &ctx);
+
+  return memcmp (output, test->output, test->outlen) == 0
+         && memcmp (incremental, test->output, test->outlen) == 0;
+}
@@ -0,0 +1,1125 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors for BLAKE3 in the format of the official test vectors. The
+ * input is the bytes 0 to 250 repeated, the key is the 32 ASCII bytes
+ * below and each case reads 131 bytes of output to cover more than one
+ * root block.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake3.h"
+
+#define BLAKE3_TEST_OUTPUT_SIZE 131
+#define BLAKE3_TEST_LONG_SIZE (1024 * 1024)
+
+enum blake3_test_mode
+{
+  BLAKE3_TEST_HASH,
+  BLAKE3_TEST_KEYED,
+  BLAKE3_TEST_DERIVE
+};
+
+struct blake3_testcase
+{
+  size_t inputlen;
+  enum blake3_test_mode mode;
+  const uint8_t *output;
+};
+
+static const uint8_t blake3_test_key[BLAKE3_KEY_SIZE]
+    = "whats the Elvish word for friend";
+
+static const char blake3_test_context[]
+    = "BLAKE3 2019-12-27 16:29:52 test vectors context";
+
+static const uint8_t blake3_0[131] = {
+  0xaf, 0x13, 0x49, 0xb9, 0xf5, 0xf9, 0xa1, 0xa6, 0xa0, 0x40, 0x4d,
+  0xea, 0x36, 0xdc, 0xc9, 0x49, 0x9b, 0xcb, 0x25, 0xc9, 0xad, 0xc1,
+  0x12, 0xb7, 0xcc, 0x9a, 0x93, 0xca, 0xe4, 0x1f, 0x32, 0x62, 0xe0,
+  0x0f, 0x03, 0xe7, 0xb6, 0x9a, 0xf2, 0x6b, 0x7f, 0xaa, 0xf0, 0x9f,
+  0xcd, 0x33, 0x30, 0x50, 0x33, 0x8d, 0xdf, 0xe0, 0x85, 0xb8, 0xcc,
+  0x86, 0x9c, 0xa9, 0x8b, 0x20, 0x6c, 0x08, 0x24, 0x3a, 0x26, 0xf5,
+  0x48, 0x77, 0x89, 0xe8, 0xf6, 0x60, 0xaf, 0xe6, 0xc9, 0x9e, 0xf9,
+  0xe0, 0xc5, 0x2b, 0x92, 0xe7, 0x39, 0x30, 0x24, 0xa8, 0x04, 0x59,
+  0xcf, 0x91, 0xf4, 0x76, 0xf9, 0xff, 0xdb, 0xda, 0x70, 0x01, 0xc2,
+  0x2e, 0x15, 0x9b, 0x40, 0x26, 0x31, 0xf2, 0x77, 0xca, 0x96, 0xf2,
+  0xde, 0xfd, 0xf1, 0x07, 0x82, 0x82, 0x31, 0x4e, 0x76, 0x36, 0x99,
+  0xa3, 0x1c, 0x53, 0x63, 0x16, 0x54, 0x21, 0xcc, 0xe1, 0x4d
+};
+
+static const uint8_t blake3_keyed_0[131] = {
+  0x92, 0xb2, 0xb7, 0x56, 0x04, 0xed, 0x3c, 0x76, 0x1f, 0x9d, 0x6f,
+  0x62, 0x39, 0x2c, 0x8a, 0x92, 0x27, 0xad, 0x0e, 0xa3, 0xf0, 0x95,
+  0x73, 0xe7, 0x83, 0xf1, 0x49, 0x8a, 0x4e, 0xd6, 0x0d, 0x26, 0xb1,
+  0x81, 0x71, 0xa2, 0xf2, 0x2a, 0x4b, 0x94, 0x82, 0x2c, 0x70, 0x1f,
+  0x10, 0x71, 0x53, 0xdb, 0xa2, 0x49, 0x18, 0xc4, 0xba, 0xe4, 0xd2,
+  0x94, 0x5c, 0x20, 0xec, 0xe1, 0x33, 0x87, 0x62, 0x7d, 0x3b, 0x73,
+  0xcb, 0xf9, 0x7b, 0x79, 0x7d, 0x5e, 0x59, 0x94, 0x8c, 0x7e, 0xf7,
+  0x88, 0xf5, 0x43, 0x72, 0xdf, 0x45, 0xe4, 0x5e, 0x42, 0x93, 0xc7,
+  0xdc, 0x18, 0xc1, 0xd4, 0x11, 0x44, 0xa9, 0x75, 0x8b, 0xe5, 0x89,
+  0x60, 0x85, 0x6b, 0xe1, 0xea, 0xbb, 0xe2, 0x2c, 0x26, 0x53, 0x19,
+  0x0d, 0xe5, 0x60, 0xca, 0x3b, 0x2a, 0xc4, 0xaa, 0x69, 0x2a, 0x92,
+  0x10, 0x69, 0x42, 0x54, 0xc3, 0x71, 0xe8, 0x51, 0xbc, 0x8f
+};
+
+static const uint8_t blake3_derive_0[131] = {
+  0x2c, 0xc3, 0x97, 0x83, 0xc2, 0x23, 0x15, 0x4f, 0xea, 0x8d, 0xfb,
+  0x7c, 0x1b, 0x16, 0x60, 0xf2, 0xac, 0x2d, 0xcb, 0xd1, 0xc1, 0xde,
+  0x82, 0x77, 0xb0, 0xb0, 0xdd, 0x39, 0xb7, 0xe5, 0x0d, 0x7d, 0x90,
+  0x56, 0x30, 0xc8, 0xbe, 0x29, 0x0d, 0xfc, 0xf3, 0xe6, 0x84, 0x2f,
+  0x13, 0xbd, 0xdd, 0x57, 0x3c, 0x09, 0x8c, 0x3f, 0x17, 0x36, 0x1f,
+  0x1f, 0x20, 0x6b, 0x8c, 0xad, 0x9d, 0x08, 0x8a, 0xa4, 0xa3, 0xf7,
+  0x46, 0x75, 0x2c, 0x6b, 0x0c, 0xe6, 0xa8, 0x3b, 0x0d, 0xa8, 0x1d,
+  0x59, 0x64, 0x92, 0x57, 0xcd, 0xf8, 0xeb, 0x3e, 0x9f, 0x7d, 0x49,
+  0x98, 0xe4, 0x10, 0x21, 0xfa, 0xc1, 0x19, 0xde, 0xef, 0xb8, 0x96,
+  0x22, 0x4a, 0xc9, 0x9f, 0x86, 0x00, 0x11, 0xf7, 0x36, 0x09, 0xe6,
+  0xe0, 0xe4, 0x54, 0x0f, 0x93, 0xb2, 0x73, 0xe5, 0x65, 0x47, 0xdf,
+  0xd3, 0xaa, 0x1a, 0x03, 0x5b, 0xa6, 0x68, 0x9d, 0x89, 0xa0
+};
+
+static const uint8_t blake3_1[131] = {
+  0x2d, 0x3a, 0xde, 0xdf, 0xf1, 0x1b, 0x61, 0xf1, 0x4c, 0x88, 0x6e,
+  0x35, 0xaf, 0xa0, 0x36, 0x73, 0x6d, 0xcd, 0x87, 0xa7, 0x4d, 0x27,
+  0xb5, 0xc1, 0x51, 0x02, 0x25, 0xd0, 0xf5, 0x92, 0xe2, 0x13, 0xc3,
+  0xa6, 0xcb, 0x8b, 0xf6, 0x23, 0xe2, 0x0c, 0xdb, 0x53, 0x5f, 0x8d,
+  0x1a, 0x5f, 0xfb, 0x86, 0x34, 0x2d, 0x9c, 0x0b, 0x64, 0xac, 0xa3,
+  0xbc, 0xe1, 0xd3, 0x1f, 0x60, 0xad, 0xfa, 0x13, 0x7b, 0x35, 0x8a,
+  0xd4, 0xd7, 0x9f, 0x97, 0xb4, 0x7c, 0x3d, 0x5e, 0x79, 0xf1, 0x79,
+  0xdf, 0x87, 0xa3, 0xb9, 0x77, 0x6e, 0xf8, 0x32, 0x5f, 0x83, 0x29,
+  0x88, 0x6b, 0xa4, 0x2f, 0x07, 0xfb, 0x13, 0x8b, 0xb5, 0x02, 0xf4,
+  0x08, 0x1c, 0xbc, 0xec, 0x31, 0x95, 0xc5, 0x87, 0x1e, 0x6c, 0x23,
+  0xe2, 0xcc, 0x97, 0xd3, 0xc6, 0x9a, 0x61, 0x3e, 0xba, 0x13, 0x1e,
+  0x5f, 0x13, 0x51, 0xf3, 0xf1, 0xda, 0x78, 0x65, 0x45, 0xe5
+};
+
+static const uint8_t blake3_keyed_1[131] = {
+  0x6d, 0x78, 0x78, 0xdf, 0xff, 0x2f, 0x48, 0x56, 0x35, 0xd3, 0x90,
+  0x13, 0x27, 0x8a, 0xe1, 0x4f, 0x14, 0x54, 0xb8, 0xc0, 0xa3, 0xa2,
+  0xd3, 0x4b, 0xc1, 0xab, 0x38, 0x22, 0x8a, 0x80, 0xc9, 0x5b, 0x65,
+  0x68, 0xc0, 0x49, 0x06, 0x09, 0x41, 0x30, 0x06, 0xfb, 0xd4, 0x28,
+  0xeb, 0x3f, 0xd1, 0x4e, 0x77, 0x56, 0xd9, 0x0f, 0x73, 0xa4, 0x72,
+  0x5f, 0xad, 0x14, 0x7f, 0x7b, 0xf7, 0x0f, 0xd6, 0x1c, 0x4e, 0x0c,
+  0xf7, 0x07, 0x48, 0x85, 0xe9, 0x2b, 0x0e, 0x3f, 0x12, 0x59, 0x78,
+  0xb4, 0x15, 0x49, 0x86, 0xd4, 0xfb, 0x20, 0x2a, 0x3f, 0x33, 0x1a,
+  0x3f, 0xb6, 0xcf, 0x34, 0x9a, 0x3a, 0x70, 0xe4, 0x99, 0x90, 0xf9,
+  0x8f, 0xe4, 0x28, 0x97, 0x61, 0xc8, 0x60, 0x2c, 0x4e, 0x6a, 0xb1,
+  0x13, 0x8d, 0x31, 0xd3, 0xb6, 0x22, 0x18, 0x07, 0x8b, 0x2f, 0x3b,
+  0xa9, 0xa8, 0x8e, 0x1d, 0x08, 0xd0, 0xdd, 0x4c, 0xea, 0x11
+};
+
+static const uint8_t blake3_derive_1[131] = {
+  0xb3, 0xe2, 0xe3, 0x40, 0xa1, 0x17, 0xa4, 0x99, 0xc6, 0xcf, 0x23,
+  0x98, 0xa1, 0x9e, 0xe0, 0xd2, 0x9c, 0xca, 0x2b, 0xb7, 0x40, 0x4c,
+  0x73, 0x06, 0x33, 0x82, 0x69, 0x3b, 0xf6, 0x6c, 0xb0, 0x6c, 0x58,
+  0x27, 0xb9, 0x1b, 0xf8, 0x89, 0xb6, 0xb9, 0x7c, 0x54, 0x77, 0xf5,
+  0x35, 0x36, 0x1c, 0xae, 0xfc, 0xa0, 0xb5, 0xd8, 0xc4, 0x74, 0x64,
+  0x41, 0xc5, 0x76, 0x17, 0x11, 0x19, 0x33, 0x15, 0x89, 0x50, 0x67,
+  0x0f, 0x9a, 0xa8, 0xa0, 0x5d, 0x79, 0x1d, 0xaa, 0xe1, 0x0a, 0xc6,
+  0x83, 0xcb, 0xef, 0x8f, 0xaf, 0x89, 0x7c, 0x84, 0xe6, 0x11, 0x4a,
+  0x59, 0xd2, 0x17, 0x3c, 0x3f, 0x41, 0x70, 0x23, 0xa3, 0x5d, 0x69,
+  0x83, 0xf2, 0xc7, 0xdf, 0xa5, 0x7e, 0x7f, 0xc5, 0x59, 0xad, 0x75,
+  0x1d, 0xbf, 0xb9, 0xff, 0xab, 0x39, 0xc2, 0xef, 0x8c, 0x4a, 0xaf,
+  0xeb, 0xc9, 0xae, 0x97, 0x3a, 0x64, 0xf0, 0xc7, 0x65, 0x51
+};
+
+static const uint8_t blake3_63[131] = {
+  0xe9, 0xbc, 0x37, 0xa5, 0x94, 0xda, 0xad, 0x83, 0xbe, 0x94, 0x70,
+  0xdf, 0x7f, 0x7b, 0x37, 0x98, 0x29, 0x7c, 0x3d, 0x83, 0x4c, 0xe8,
+  0x0b, 0xa8, 0x5d, 0x6e, 0x20, 0x76, 0x27, 0xb7, 0xdb, 0x7b, 0x11,
+  0x97, 0x01, 0x2b, 0x1e, 0x7d, 0x9a, 0xf4, 0xd7, 0xcb, 0x7b, 0xdd,
+  0x1f, 0x3b, 0xb4, 0x9a, 0x90, 0xa9, 0xb5, 0xde, 0xc3, 0xea, 0x2b,
+  0xbc, 0x6e, 0xae, 0xbc, 0xe7, 0x7f, 0x4e, 0x47, 0x0c, 0xbf, 0x46,
+  0x87, 0x09, 0x3b, 0x53, 0x52, 0xf0, 0x4e, 0x4a, 0x45, 0x70, 0xfb,
+  0xa2, 0x33, 0x16, 0x4e, 0x6a, 0xcc, 0x36, 0x90, 0x0e, 0x35, 0xd1,
+  0x85, 0x88, 0x6a, 0x82, 0x7f, 0x7e, 0xa9, 0xbd, 0xc1, 0xe5, 0xc3,
+  0xce, 0x88, 0xb0, 0x95, 0xa2, 0x00, 0xe6, 0x2c, 0x10, 0xc0, 0x43,
+  0xb3, 0xe9, 0xbc, 0x6c, 0xb9, 0xb6, 0xac, 0x4d, 0xfa, 0x51, 0x79,
+  0x4b, 0x02, 0xac, 0xe9, 0xf9, 0x87, 0x79, 0x04, 0x07, 0x55
+};
+
+static const uint8_t blake3_keyed_63[131] = {
+  0xbb, 0x1e, 0xb5, 0xd4, 0xaf, 0xa7, 0x93, 0xc1, 0xeb, 0xdd, 0x9f,
+  0xb0, 0x8d, 0xef, 0x6c, 0x36, 0xd1, 0x00, 0x96, 0x98, 0x6a, 0xe0,
+  0xcf, 0xe1, 0x48, 0xcd, 0x10, 0x11, 0x70, 0xce, 0x37, 0xae, 0xa0,
+  0x5a, 0x63, 0xd7, 0x4a, 0x84, 0x0a, 0xec, 0xd5, 0x14, 0xf6, 0x54,
+  0xf0, 0x80, 0xe5, 0x1a, 0xc5, 0x0f, 0xd6, 0x17, 0xd2, 0x26, 0x10,
+  0xd9, 0x17, 0x80, 0xfe, 0x6b, 0x07, 0xa2, 0x6b, 0x08, 0x47, 0xab,
+  0xb3, 0x82, 0x91, 0x05, 0x8c, 0x97, 0x47, 0x4e, 0xf6, 0xdd, 0xd1,
+  0x90, 0xd3, 0x0f, 0xc3, 0x18, 0x18, 0x5c, 0x09, 0xca, 0x15, 0x89,
+  0xd2, 0x02, 0x4f, 0x0a, 0x6f, 0x16, 0xd4, 0x5f, 0x11, 0x67, 0x83,
+  0x77, 0x48, 0x3f, 0xa5, 0xc0, 0x05, 0xb2, 0xa1, 0x07, 0xcb, 0x99,
+  0x43, 0xe5, 0xda, 0x63, 0x4e, 0x70, 0x46, 0x85, 0x5e, 0xaa, 0x88,
+  0x86, 0x63, 0xde, 0x55, 0xd6, 0x47, 0x13, 0x71, 0xd5, 0x5d
+};
+
+static const uint8_t blake3_derive_63[131] = {
+  0xb6, 0x45, 0x1e, 0x30, 0xb9, 0x53, 0xc2, 0x06, 0xe3, 0x46, 0x44,
+  0xc6, 0x80, 0x37, 0x24, 0xe9, 0xd2, 0x72, 0x5e, 0x08, 0x93, 0x03,
+  0x9c, 0xfc, 0x49, 0x58, 0x4f, 0x99, 0x1f, 0x45, 0x1a, 0xf3, 0xb8,
+  0x9e, 0x8f, 0xf5, 0x72, 0xd3, 0xda, 0x4f, 0x40, 0x22, 0x19, 0x9b,
+  0x95, 0x63, 0xb9, 0xd7, 0x0e, 0xbb, 0x61, 0x6e, 0xff, 0xf0, 0x76,
+  0x3e, 0x9a, 0xbe, 0xc7, 0x1b, 0x55, 0x0f, 0x13, 0x71, 0xe2, 0x33,
+  0x31, 0x9c, 0x4c, 0x4e, 0x74, 0xda, 0x93, 0x6b, 0xa8, 0xe5, 0xbb,
+  0xb2, 0x9a, 0x59, 0x8e, 0x00, 0x7a, 0x0b, 0xbf, 0xa9, 0x29, 0xc9,
+  0x97, 0x38, 0xca, 0x2c, 0xc0, 0x98, 0xd5, 0x91, 0x34, 0xd1, 0x1f,
+  0xf3, 0x00, 0xc3, 0x9f, 0x82, 0xe2, 0xfc, 0xe9, 0xf7, 0xf0, 0xfa,
+  0x26, 0x64, 0x59, 0x50, 0x3f, 0x64, 0xab, 0x99, 0x13, 0xbe, 0xfc,
+  0x65, 0xfd, 0xdc, 0x47, 0x4f, 0x6d, 0xc1, 0xc6, 0x76, 0x69
+};
+
+static const uint8_t blake3_64[131] = {
+  0x4e, 0xed, 0x71, 0x41, 0xea, 0x4a, 0x5c, 0xd4, 0xb7, 0x88, 0x60,
+  0x6b, 0xd2, 0x3f, 0x46, 0xe2, 0x12, 0xaf, 0x9c, 0xac, 0xeb, 0xac,
+  0xdc, 0x7d, 0x1f, 0x4c, 0x6d, 0xc7, 0xf2, 0x51, 0x1b, 0x98, 0xfc,
+  0x9c, 0xc5, 0x6c, 0xb8, 0x31, 0xff, 0xe3, 0x3e, 0xa8, 0xe7, 0xe1,
+  0xd1, 0xdf, 0x09, 0xb2, 0x6e, 0xfd, 0x27, 0x67, 0x67, 0x00, 0x66,
+  0xaa, 0x82, 0xd0, 0x23, 0xb1, 0xdf, 0xe8, 0xab, 0x1b, 0x2b, 0x7f,
+  0xbb, 0x5b, 0x97, 0x59, 0x2d, 0x46, 0xff, 0xe3, 0xe0, 0x5a, 0x6a,
+  0x9b, 0x59, 0x2e, 0x29, 0x49, 0xc7, 0x41, 0x60, 0xe4, 0x67, 0x43,
+  0x01, 0xbc, 0x3f, 0x97, 0xe0, 0x49, 0x03, 0xf8, 0xc6, 0xcf, 0x95,
+  0xb8, 0x63, 0x17, 0x4c, 0x33, 0x22, 0x89, 0x24, 0xcd, 0xef, 0x7a,
+  0xe4, 0x75, 0x59, 0xb1, 0x0b, 0x29, 0x4a, 0xcd, 0x66, 0x06, 0x66,
+  0xc4, 0x53, 0x88, 0x33, 0x58, 0x2b, 0x43, 0xf8, 0x2d, 0x74
+};
+
+static const uint8_t blake3_keyed_64[131] = {
+  0xba, 0x8c, 0xed, 0x36, 0xf3, 0x27, 0x70, 0x0d, 0x21, 0x3f, 0x12,
+  0x0b, 0x1a, 0x20, 0x7a, 0x3b, 0x8c, 0x04, 0x33, 0x05, 0x28, 0x58,
+  0x6f, 0x41, 0x4d, 0x09, 0xf2, 0xf7, 0xd9, 0xcc, 0xb7, 0xe6, 0x82,
+  0x44, 0xc2, 0x60, 0x10, 0xaf, 0xc3, 0xf7, 0x62, 0x61, 0x5b, 0xba,
+  0xc5, 0x52, 0xa1, 0xca, 0x90, 0x9e, 0x67, 0xc8, 0x3e, 0x2f, 0xd5,
+  0x47, 0x8c, 0xf4, 0x6b, 0x9e, 0x81, 0x1e, 0xfc, 0xcc, 0x93, 0xf7,
+  0x7a, 0x21, 0xb1, 0x7a, 0x15, 0x2e, 0xba, 0xca, 0x16, 0x95, 0x73,
+  0x3f, 0xdb, 0x08, 0x6e, 0x23, 0xcd, 0x0e, 0xb4, 0x8c, 0x41, 0xc0,
+  0x34, 0xd5, 0x25, 0x23, 0xfc, 0x21, 0x23, 0x6e, 0x5d, 0x8c, 0x92,
+  0x55, 0x30, 0x6e, 0x48, 0xd5, 0x2b, 0xa4, 0x0b, 0x4d, 0xac, 0x24,
+  0x25, 0x64, 0x60, 0xd5, 0x65, 0x73, 0xd1, 0x31, 0x23, 0x19, 0xaf,
+  0xcf, 0x3e, 0xd3, 0x9d, 0x72, 0xd0, 0xbf, 0xc6, 0x9a, 0xcb
+};
+
+static const uint8_t blake3_derive_64[131] = {
+  0xa5, 0xc4, 0xa7, 0x05, 0x3f, 0xa8, 0x6b, 0x64, 0x74, 0x6d, 0x4b,
+  0xb6, 0x88, 0xd0, 0x6a, 0xd1, 0xf0, 0x2a, 0x18, 0xfc, 0xe9, 0xaf,
+  0xd3, 0xe8, 0x18, 0xfe, 0xfa, 0xa7, 0x12, 0x6b, 0xf7, 0x3e, 0x9b,
+  0x94, 0x93, 0xa9, 0xbe, 0xfe, 0xbe, 0x0b, 0xf0, 0xc9, 0x50, 0x9f,
+  0xb3, 0x10, 0x5c, 0xfa, 0x0e, 0x26, 0x2c, 0xde, 0x14, 0x1a, 0xa8,
+  0xe3, 0xf2, 0xc2, 0xf7, 0x78, 0x90, 0xbb, 0x64, 0xa4, 0xcc, 0xa9,
+  0x69, 0x22, 0xa2, 0x1e, 0xad, 0x11, 0x1f, 0x63, 0x38, 0xad, 0x52,
+  0x44, 0xf2, 0xc1, 0x5c, 0x44, 0xcb, 0x59, 0x54, 0x43, 0xac, 0x2a,
+  0xc2, 0x94, 0x23, 0x1e, 0x31, 0xbe, 0x4a, 0x43, 0x07, 0xd0, 0xa9,
+  0x1e, 0x87, 0x4d, 0x36, 0xfc, 0x98, 0x52, 0xae, 0xb1, 0x26, 0x5c,
+  0x09, 0xb6, 0xe0, 0xcd, 0xa7, 0xc3, 0x7e, 0xf6, 0x86, 0xfb, 0xbc,
+  0xab, 0x97, 0xe8, 0xff, 0x66, 0x71, 0x8b, 0xe0, 0x48, 0xbb
+};
+
+static const uint8_t blake3_65[131] = {
+  0xde, 0x1e, 0x5f, 0xa0, 0xbe, 0x70, 0xdf, 0x6d, 0x2b, 0xe8, 0xff,
+  0xfd, 0x0e, 0x99, 0xce, 0xaa, 0x8e, 0xb6, 0xe8, 0xc9, 0x3a, 0x63,
+  0xf2, 0xd8, 0xd1, 0xc3, 0x0e, 0xcb, 0x6b, 0x26, 0x3d, 0xee, 0x0e,
+  0x16, 0xe0, 0xa4, 0x74, 0x9d, 0x68, 0x11, 0xdd, 0x1d, 0x6d, 0x12,
+  0x65, 0xc2, 0x97, 0x29, 0xb1, 0xb7, 0x5a, 0x9a, 0xc3, 0x46, 0xcf,
+  0x93, 0xf0, 0xe1, 0xd7, 0x29, 0x6d, 0xfc, 0xfd, 0x43, 0x13, 0xb3,
+  0xa2, 0x27, 0xfa, 0xaa, 0xaf, 0x77, 0x57, 0xcc, 0x95, 0xb4, 0xe8,
+  0x7a, 0x49, 0xbe, 0x3b, 0x8a, 0x27, 0x0a, 0x12, 0x02, 0x02, 0x33,
+  0x50, 0x9b, 0x1c, 0x36, 0x32, 0xb3, 0x48, 0x5e, 0xef, 0x30, 0x9d,
+  0x0a, 0xbc, 0x4a, 0x4a, 0x69, 0x6c, 0x9d, 0xec, 0xc6, 0xe9, 0x04,
+  0x54, 0xb5, 0x3b, 0x00, 0x0f, 0x45, 0x6a, 0x3f, 0x10, 0x07, 0x90,
+  0x72, 0xba, 0xaf, 0x7a, 0x98, 0x16, 0x53, 0x22, 0x1f, 0x2c
+};
+
+static const uint8_t blake3_keyed_65[131] = {
+  0xc0, 0xa4, 0xed, 0xef, 0xa2, 0xd2, 0xac, 0xcb, 0x92, 0x77, 0xc3,
+  0x71, 0xac, 0x12, 0xfc, 0xdb, 0xb5, 0x29, 0x88, 0xa8, 0x6e, 0xdc,
+  0x54, 0xf0, 0x71, 0x6e, 0x15, 0x91, 0xb4, 0x32, 0x6e, 0x72, 0xd5,
+  0xe7, 0x95, 0xf4, 0x6a, 0x59, 0x6b, 0x02, 0xd3, 0xd4, 0xbf, 0xb4,
+  0x3a, 0xba, 0xd1, 0xe5, 0xd1, 0x92, 0x11, 0x15, 0x27, 0x22, 0xec,
+  0x1f, 0x20, 0xfe, 0xf2, 0xcd, 0x41, 0x3e, 0x3c, 0x22, 0xf2, 0xfc,
+  0x5d, 0xa3, 0xd7, 0x30, 0x41, 0x27, 0x5b, 0xe6, 0xed, 0xe3, 0x51,
+  0x7b, 0x3b, 0x9f, 0x0f, 0xc6, 0x7a, 0xde, 0x59, 0x56, 0xa6, 0x72,
+  0xb8, 0xb7, 0x5d, 0x96, 0xcb, 0x43, 0x29, 0x4b, 0x90, 0x41, 0x49,
+  0x7d, 0xe9, 0x26, 0x37, 0xed, 0x3f, 0x24, 0x39, 0x22, 0x5e, 0x68,
+  0x39, 0x10, 0xcb, 0x3a, 0xe9, 0x23, 0x37, 0x44, 0x49, 0xca, 0x78,
+  0x8f, 0xb0, 0xf9, 0xbe, 0xa9, 0x27, 0x31, 0xbc, 0x26, 0xad
+};
+
+static const uint8_t blake3_derive_65[131] = {
+  0x51, 0xfd, 0x05, 0xc3, 0xc1, 0xcf, 0xbc, 0x8e, 0xd6, 0x7d, 0x13,
+  0x9a, 0xd7, 0x6f, 0x5c, 0xf8, 0x23, 0x6c, 0xd2, 0xac, 0xd2, 0x66,
+  0x27, 0xa3, 0x0c, 0x10, 0x4d, 0xfd, 0x9d, 0x3f, 0xf8, 0xa8, 0x2b,
+  0x02, 0xe8, 0xbd, 0x36, 0xd8, 0x49, 0x8a, 0x75, 0xad, 0x8c, 0x8e,
+  0x9b, 0x15, 0xeb, 0x38, 0x69, 0x70, 0x28, 0x3d, 0x6d, 0xd4, 0x2c,
+  0x8a, 0xe7, 0x91, 0x1c, 0xc5, 0x92, 0x88, 0x7f, 0xdb, 0xe2, 0x6a,
+  0x0a, 0x5f, 0x0b, 0xf8, 0x21, 0xcd, 0x92, 0x98, 0x6c, 0x60, 0xb2,
+  0x50, 0x2c, 0x9b, 0xe3, 0xf9, 0x8a, 0x9c, 0x13, 0x3a, 0x7e, 0x80,
+  0x45, 0xea, 0x86, 0x7e, 0x08, 0x28, 0xc7, 0x25, 0x2e, 0x73, 0x93,
+  0x21, 0xf7, 0xc2, 0xd6, 0x5d, 0xae, 0xe4, 0x46, 0x8e, 0xb4, 0x42,
+  0x9e, 0xfa, 0xe4, 0x69, 0xa4, 0x27, 0x63, 0xf1, 0xf9, 0x49, 0x77,
+  0x43, 0x5d, 0x10, 0xdc, 0xca, 0xe3, 0xe3, 0xdc, 0xe8, 0x8d
+};
+
+static const uint8_t blake3_1023[131] = {
+  0x10, 0x10, 0x89, 0x70, 0xee, 0xda, 0x3e, 0xb9, 0x32, 0xba, 0xac,
+  0x14, 0x28, 0xc7, 0xa2, 0x16, 0x3b, 0x0e, 0x92, 0x4c, 0x9a, 0x9e,
+  0x25, 0xb3, 0x5b, 0xba, 0x72, 0xb2, 0x8f, 0x70, 0xbd, 0x11, 0xa1,
+  0x82, 0xd2, 0x7a, 0x59, 0x1b, 0x05, 0x59, 0x2b, 0x15, 0x60, 0x75,
+  0x00, 0xe1, 0xe8, 0xdd, 0x56, 0xbc, 0x6c, 0x7f, 0xc0, 0x63, 0x71,
+  0x5b, 0x7a, 0x1d, 0x73, 0x7d, 0xf5, 0xba, 0xd3, 0x33, 0x9c, 0x56,
+  0x77, 0x89, 0x57, 0xd8, 0x70, 0xeb, 0x97, 0x17, 0xb5, 0x7e, 0xa3,
+  0xd9, 0xfb, 0x68, 0xd1, 0xb5, 0x51, 0x27, 0xbb, 0xa6, 0xa9, 0x06,
+  0xa4, 0xa2, 0x4b, 0xbd, 0x5a, 0xcb, 0x2d, 0x12, 0x3a, 0x37, 0xb2,
+  0x8f, 0x9e, 0x9a, 0x81, 0xbb, 0xaa, 0xe3, 0x60, 0xd5, 0x8f, 0x85,
+  0xe5, 0xfc, 0x9d, 0x75, 0xf7, 0xc3, 0x70, 0xa0, 0xcc, 0x09, 0xb6,
+  0x52, 0x2d, 0x9c, 0x8d, 0x82, 0x2f, 0x2f, 0x28, 0xf4, 0x85
+};
+
+static const uint8_t blake3_keyed_1023[131] = {
+  0xc9, 0x51, 0xec, 0xdf, 0x03, 0x28, 0x8d, 0x0f, 0xcc, 0x96, 0xee,
+  0x34, 0x13, 0x56, 0x3d, 0x8a, 0x6d, 0x35, 0x89, 0x54, 0x7f, 0x2c,
+  0x2f, 0xb3, 0x6d, 0x97, 0x86, 0x47, 0x0f, 0x1b, 0x9d, 0x6e, 0x89,
+  0x03, 0x16, 0xd2, 0xe6, 0xd8, 0xb8, 0xc2, 0x5b, 0x0a, 0x5b, 0x21,
+  0x80, 0xf9, 0x4f, 0xb1, 0xa1, 0x58, 0xef, 0x50, 0x8c, 0x3c, 0xde,
+  0x45, 0xe2, 0x96, 0x6b, 0xd7, 0x96, 0xa6, 0x96, 0xd3, 0xe1, 0x3e,
+  0xfd, 0x86, 0x25, 0x9d, 0x75, 0x63, 0x87, 0xd9, 0xbe, 0xcf, 0x5c,
+  0x8b, 0xf1, 0xce, 0x21, 0x92, 0xb8, 0x70, 0x25, 0x15, 0x29, 0x07,
+  0xb6, 0xd8, 0xcc, 0x33, 0xd1, 0x78, 0x26, 0xd8, 0xb7, 0xb9, 0xbc,
+  0x97, 0xe3, 0x8c, 0x3c, 0x85, 0x10, 0x8e, 0xf0, 0x9f, 0x01, 0x3e,
+  0x01, 0xc2, 0x29, 0xc2, 0x0a, 0x83, 0xd9, 0xe8, 0xef, 0xac, 0x5b,
+  0x37, 0x47, 0x0d, 0xa2, 0x85, 0x75, 0xfd, 0x75, 0x5a, 0x10
+};
+
+static const uint8_t blake3_derive_1023[131] = {
+  0x74, 0xa1, 0x6c, 0x1c, 0x3d, 0x44, 0x36, 0x8a, 0x86, 0xe1, 0xca,
+  0x6d, 0xf6, 0x4b, 0xe6, 0xa2, 0xf6, 0x4c, 0xce, 0x8f, 0x09, 0x22,
+  0x07, 0x87, 0x45, 0x07, 0x22, 0xd8, 0x57, 0x25, 0xde, 0xa5, 0x9c,
+  0x41, 0x32, 0x64, 0x40, 0x46, 0x61, 0xe9, 0xe4, 0xd9, 0x55, 0x40,
+  0x9d, 0xfe, 0x4a, 0xd3, 0xaa, 0x48, 0x78, 0x71, 0xbc, 0xd4, 0x54,
+  0xed, 0x12, 0xab, 0xfe, 0x2c, 0x2b, 0x1e, 0xb7, 0x75, 0x75, 0x88,
+  0xcf, 0x6c, 0xb1, 0x8d, 0x2e, 0xcc, 0xad, 0x49, 0xe0, 0x18, 0xc0,
+  0xd0, 0xfe, 0xc3, 0x23, 0xbe, 0xc8, 0x2b, 0xf1, 0x64, 0x4c, 0x63,
+  0x25, 0x71, 0x7d, 0x13, 0xea, 0x71, 0x2e, 0x68, 0x40, 0xd3, 0xe6,
+  0xe7, 0x30, 0xd3, 0x55, 0x53, 0xf5, 0x9e, 0xff, 0x53, 0x77, 0xa9,
+  0xc3, 0x50, 0xbc, 0xc1, 0x55, 0x66, 0x94, 0xb9, 0x24, 0xb8, 0x58,
+  0xf3, 0x29, 0xc4, 0x4e, 0xe6, 0x4b, 0x88, 0x4e, 0xf0, 0x0d
+};
+
+static const uint8_t blake3_1024[131] = {
+  0x42, 0x21, 0x47, 0x39, 0xf0, 0x95, 0xa4, 0x06, 0xf3, 0xfc, 0x83,
+  0xde, 0xb8, 0x89, 0x74, 0x4a, 0xc0, 0x0d, 0xf8, 0x31, 0xc1, 0x0d,
+  0xaa, 0x55, 0x18, 0x9b, 0x5d, 0x12, 0x1c, 0x85, 0x5a, 0xf7, 0x1c,
+  0xf8, 0x10, 0x72, 0x65, 0xec, 0xda, 0xf8, 0x50, 0x5b, 0x95, 0xd8,
+  0xfc, 0xec, 0x83, 0xa9, 0x8a, 0x6a, 0x96, 0xea, 0x51, 0x09, 0xd2,
+  0xc1, 0x79, 0xc4, 0x7a, 0x38, 0x7f, 0xfb, 0xb4, 0x04, 0x75, 0x6f,
+  0x6e, 0xea, 0xe7, 0x88, 0x3b, 0x44, 0x6b, 0x70, 0xeb, 0xb1, 0x44,
+  0x52, 0x7c, 0x20, 0x75, 0xab, 0x8a, 0xb2, 0x04, 0xc0, 0x08, 0x6b,
+  0xb2, 0x2b, 0x7c, 0x93, 0xd4, 0x65, 0xef, 0xc5, 0x7f, 0x8d, 0x91,
+  0x7f, 0x0b, 0x38, 0x5c, 0x6d, 0xf2, 0x65, 0xe7, 0x70, 0x03, 0xb8,
+  0x51, 0x02, 0x96, 0x74, 0x86, 0xed, 0x57, 0xdb, 0x5c, 0x5c, 0xa1,
+  0x70, 0xba, 0x44, 0x14, 0x27, 0xed, 0x9a, 0xfa, 0x68, 0x4e
+};
+
+static const uint8_t blake3_keyed_1024[131] = {
+  0x75, 0xc4, 0x6f, 0x6f, 0x3d, 0x9e, 0xb4, 0xf5, 0x5e, 0xca, 0xae,
+  0xe4, 0x80, 0xdb, 0x73, 0x2e, 0x6c, 0x21, 0x05, 0x54, 0x6f, 0x1e,
+  0x67, 0x50, 0x03, 0x68, 0x7c, 0x31, 0x71, 0x9c, 0x7b, 0xa4, 0xa7,
+  0x8b, 0xc8, 0x38, 0xc7, 0x28, 0x52, 0xd4, 0xf4, 0x9c, 0x86, 0x4a,
+  0xcb, 0x7a, 0xda, 0xfe, 0x24, 0x78, 0xe8, 0x24, 0xaf, 0xe5, 0x1c,
+  0x89, 0x19, 0xd0, 0x61, 0x68, 0x41, 0x4c, 0x26, 0x5f, 0x29, 0x8a,
+  0x80, 0x94, 0xb1, 0xad, 0x81, 0x3a, 0x9b, 0x86, 0x14, 0xac, 0xab,
+  0xac, 0x32, 0x1f, 0x24, 0xce, 0x61, 0xc5, 0xa5, 0x34, 0x6e, 0xb5,
+  0x19, 0x52, 0x0d, 0x38, 0xec, 0xc4, 0x3e, 0x89, 0xb5, 0x00, 0x02,
+  0x36, 0xdf, 0x05, 0x97, 0x24, 0x3e, 0x4d, 0x24, 0x93, 0xfd, 0x62,
+  0x67, 0x30, 0xe2, 0xba, 0x17, 0xac, 0x4d, 0x88, 0x24, 0xd0, 0x9d,
+  0x1a, 0x4a, 0x8f, 0x57, 0xb8, 0x22, 0x77, 0x78, 0xe2, 0xde
+};
+
+static const uint8_t blake3_derive_1024[131] = {
+  0x73, 0x56, 0xcd, 0x77, 0x20, 0xd5, 0xb6, 0x6b, 0x6d, 0x06, 0x97,
+  0xeb, 0x31, 0x77, 0xd9, 0xf8, 0xd7, 0x3a, 0x4a, 0x5c, 0x5e, 0x96,
+  0x88, 0x96, 0xeb, 0x6a, 0x68, 0x96, 0x84, 0x30, 0x27, 0x06, 0x6c,
+  0x23, 0xb6, 0x01, 0xd3, 0xdd, 0xfb, 0x39, 0x1e, 0x90, 0xd5, 0xc8,
+  0xec, 0xcd, 0xef, 0x4a, 0xe2, 0xa2, 0x64, 0xbc, 0xe9, 0xe6, 0x12,
+  0xba, 0x15, 0xe2, 0xbc, 0x9d, 0x65, 0x4a, 0xf1, 0x48, 0x1b, 0x2e,
+  0x75, 0xdb, 0xab, 0xe6, 0x15, 0x97, 0x4f, 0x10, 0x70, 0xbb, 0xa8,
+  0x4d, 0x56, 0x85, 0x32, 0x65, 0xa3, 0x43, 0x30, 0xb4, 0x76, 0x6f,
+  0x8e, 0x75, 0xed, 0xd1, 0xf4, 0xa1, 0x65, 0x04, 0x76, 0xc1, 0x08,
+  0x02, 0xf2, 0x2b, 0x64, 0xbd, 0x39, 0x19, 0xd2, 0x46, 0xba, 0x20,
+  0xa1, 0x75, 0x58, 0xbc, 0x51, 0xc1, 0x99, 0xef, 0xde, 0xc6, 0x7e,
+  0x80, 0xa2, 0x27, 0x25, 0x18, 0x08, 0xd8, 0xce, 0x5b, 0xad
+};
+
+static const uint8_t blake3_1025[131] = {
+  0xd0, 0x02, 0x78, 0xae, 0x47, 0xeb, 0x27, 0xb3, 0x4f, 0xae, 0xcf,
+  0x67, 0xb4, 0xfe, 0x26, 0x3f, 0x82, 0xd5, 0x41, 0x29, 0x16, 0xc1,
+  0xff, 0xd9, 0x7c, 0x8c, 0xb7, 0xfb, 0x81, 0x4b, 0x84, 0x44, 0xf4,
+  0xc4, 0xa2, 0x2b, 0x4b, 0x39, 0x91, 0x55, 0x35, 0x8a, 0x99, 0x4e,
+  0x52, 0xbf, 0x25, 0x5d, 0xe6, 0x00, 0x35, 0x74, 0x2e, 0xc7, 0x1b,
+  0xd0, 0x8a, 0xc2, 0x75, 0xa1, 0xb5, 0x1c, 0xc6, 0xbf, 0xe3, 0x32,
+  0xb0, 0xef, 0x84, 0xb4, 0x09, 0x10, 0x8c, 0xda, 0x08, 0x0e, 0x62,
+  0x69, 0xed, 0x4b, 0x3e, 0x2c, 0x3f, 0x7d, 0x72, 0x2a, 0xa4, 0xcd,
+  0xc9, 0x8d, 0x16, 0xde, 0xb5, 0x54, 0xe5, 0x62, 0x7b, 0xe8, 0xf9,
+  0x55, 0xc9, 0x8e, 0x1d, 0x5f, 0x95, 0x65, 0xa9, 0x19, 0x4c, 0xad,
+  0x0c, 0x42, 0x85, 0xf9, 0x37, 0x00, 0x06, 0x2d, 0x95, 0x95, 0xad,
+  0xb9, 0x92, 0xae, 0x68, 0xff, 0x12, 0x80, 0x0a, 0xb6, 0x7a
+};
+
+static const uint8_t blake3_keyed_1025[131] = {
+  0x35, 0x7d, 0xc5, 0x5d, 0xe0, 0xc7, 0xe3, 0x82, 0xc9, 0x00, 0xfd,
+  0x6e, 0x32, 0x0a, 0xcc, 0x04, 0x14, 0x6b, 0xe0, 0x1d, 0xb6, 0xa8,
+  0xce, 0x72, 0x10, 0xb7, 0x18, 0x9b, 0xd6, 0x64, 0xea, 0x69, 0x36,
+  0x23, 0x96, 0xb7, 0x7f, 0xdc, 0x0d, 0x26, 0x34, 0xa5, 0x52, 0x97,
+  0x08, 0x43, 0x72, 0x20, 0x66, 0xc3, 0xc1, 0x59, 0x02, 0xae, 0x50,
+  0x97, 0xe0, 0x0f, 0xf5, 0x3f, 0x1e, 0x11, 0x6f, 0x1c, 0xd5, 0x35,
+  0x27, 0x20, 0x11, 0x3a, 0x83, 0x7a, 0xb2, 0x45, 0x2c, 0xaf, 0xbd,
+  0xe4, 0xd5, 0x40, 0x85, 0xd9, 0xcf, 0x5d, 0x21, 0xca, 0x61, 0x30,
+  0x71, 0x55, 0x1b, 0x25, 0xd5, 0x2e, 0x69, 0xd6, 0xc8, 0x11, 0x23,
+  0x87, 0x2b, 0x6f, 0x19, 0xcd, 0x3b, 0xc1, 0x33, 0x3e, 0xdf, 0x0c,
+  0x52, 0xb9, 0x4d, 0xe2, 0x3b, 0xa7, 0x72, 0xcf, 0x82, 0x63, 0x6c,
+  0xff, 0x45, 0x42, 0x54, 0x0a, 0x77, 0x38, 0xd5, 0xb9, 0x30
+};
+
+static const uint8_t blake3_derive_1025[131] = {
+  0xef, 0xfa, 0xa2, 0x45, 0xf0, 0x65, 0xfb, 0xf8, 0x2a, 0xc1, 0x86,
+  0x83, 0x9a, 0x24, 0x97, 0x07, 0xc3, 0xbd, 0xdf, 0x6d, 0x3f, 0xdd,
+  0xa2, 0x2d, 0x1b, 0x95, 0xa3, 0xc9, 0x70, 0x37, 0x9b, 0xcb, 0x5d,
+  0x31, 0x01, 0x3a, 0x16, 0x75, 0x09, 0xe9, 0x06, 0x62, 0x73, 0xab,
+  0x6e, 0x21, 0x23, 0xbc, 0x83, 0x5b, 0x40, 0x8b, 0x06, 0x7d, 0x88,
+  0xf9, 0x6a, 0xdd, 0xb5, 0x50, 0xd9, 0x6b, 0x68, 0x52, 0xda, 0xd3,
+  0x8e, 0x32, 0x0b, 0x9d, 0x94, 0x0f, 0x86, 0xdb, 0x74, 0xd3, 0x98,
+  0xc7, 0x70, 0xf4, 0x62, 0x11, 0x8b, 0x35, 0xd2, 0x72, 0x4e, 0xfa,
+  0x13, 0xda, 0x97, 0x19, 0x44, 0x91, 0xd9, 0x6d, 0xd3, 0x7c, 0x3c,
+  0x09, 0xcb, 0xef, 0x66, 0x59, 0x53, 0xf2, 0xee, 0x85, 0xec, 0x83,
+  0xd8, 0x8b, 0x88, 0xd1, 0x15, 0x47, 0xa6, 0xf9, 0x11, 0xc8, 0x21,
+  0x7c, 0xca, 0x46, 0xde, 0xfa, 0x27, 0x51, 0xe7, 0xf3, 0xad
+};
+
+static const uint8_t blake3_2048[131] = {
+  0xe7, 0x76, 0xb6, 0x02, 0x8c, 0x7c, 0xd2, 0x2a, 0x4d, 0x0b, 0xa1,
+  0x82, 0xa8, 0xbf, 0x62, 0x20, 0x5d, 0x2e, 0xf5, 0x76, 0x46, 0x7e,
+  0x83, 0x8e, 0xd6, 0xf2, 0x52, 0x9b, 0x85, 0xfb, 0xa2, 0x4a, 0x9a,
+  0x60, 0xbf, 0x80, 0x00, 0x14, 0x10, 0xec, 0x9e, 0xea, 0x66, 0x98,
+  0xcd, 0x53, 0x79, 0x39, 0xfa, 0xd4, 0x74, 0x9e, 0xdd, 0x48, 0x4c,
+  0xb5, 0x41, 0xac, 0xed, 0x55, 0xcd, 0x9b, 0xf5, 0x47, 0x64, 0xd0,
+  0x63, 0xf2, 0x3f, 0x6f, 0x1e, 0x32, 0xe1, 0x29, 0x58, 0xba, 0x5c,
+  0xfe, 0xb1, 0xbf, 0x61, 0x8a, 0xd0, 0x94, 0x26, 0x6d, 0x4f, 0xc3,
+  0xc9, 0x68, 0xc2, 0x08, 0x8f, 0x67, 0x74, 0x54, 0xc2, 0x88, 0xc6,
+  0x7b, 0xa0, 0xdb, 0xa3, 0x37, 0xb9, 0xd9, 0x1c, 0x7e, 0x1b, 0xa5,
+  0x86, 0xdc, 0x9a, 0x5b, 0xc2, 0xd5, 0xe9, 0x0c, 0x14, 0xf5, 0x3a,
+  0x88, 0x63, 0xac, 0x75, 0x65, 0x54, 0x61, 0xce, 0xa8, 0xf9
+};
+
+static const uint8_t blake3_keyed_2048[131] = {
+  0x87, 0x9c, 0xf1, 0xfa, 0x2e, 0xa0, 0xe7, 0x91, 0x26, 0xcb, 0x10,
+  0x63, 0x61, 0x7a, 0x05, 0xb6, 0xad, 0x9d, 0x0b, 0x69, 0x6d, 0x0d,
+  0x75, 0x7c, 0xf0, 0x53, 0x43, 0x9f, 0x60, 0xa9, 0x9d, 0xd1, 0x01,
+  0x73, 0xb9, 0x61, 0xcd, 0x57, 0x42, 0x88, 0x19, 0x4b, 0x23, 0xec,
+  0xe2, 0x78, 0xc3, 0x30, 0xfb, 0xb8, 0x58, 0x54, 0x85, 0xe7, 0x49,
+  0x67, 0xf3, 0x13, 0x52, 0xa8, 0x18, 0x3a, 0xa7, 0x82, 0xb2, 0xb2,
+  0x2f, 0x26, 0xcd, 0xca, 0xdb, 0x61, 0xee, 0xd1, 0xa5, 0xbc, 0x14,
+  0x4b, 0x81, 0x98, 0xfb, 0xb0, 0xc1, 0x3a, 0xbb, 0xf8, 0xe3, 0x19,
+  0x2c, 0x14, 0x5d, 0x0a, 0x5c, 0x21, 0x63, 0x3b, 0x0e, 0xf8, 0x60,
+  0x54, 0xf4, 0x28, 0x09, 0xdf, 0x82, 0x33, 0x89, 0xee, 0x40, 0x81,
+  0x1a, 0x59, 0x10, 0xdc, 0xbd, 0x10, 0x18, 0xaf, 0x31, 0xc3, 0xb4,
+  0x3a, 0xa5, 0x52, 0x01, 0xed, 0x4e, 0xda, 0xac, 0x74, 0xfe
+};
+
+static const uint8_t blake3_derive_2048[131] = {
+  0x7b, 0x29, 0x45, 0xcb, 0x4f, 0xef, 0x70, 0x88, 0x5c, 0xc5, 0xd7,
+  0x8a, 0x87, 0xbf, 0x6f, 0x62, 0x07, 0xdd, 0x90, 0x1f, 0xf2, 0x39,
+  0x20, 0x13, 0x51, 0xff, 0xac, 0x04, 0xe1, 0x08, 0x8a, 0x23, 0xe2,
+  0xc1, 0x1a, 0x1e, 0xbf, 0xfc, 0xea, 0x4d, 0x80, 0x44, 0x78, 0x67,
+  0xb6, 0x1b, 0xad, 0xb1, 0x38, 0x3d, 0x84, 0x2d, 0x4e, 0x79, 0x64,
+  0x5d, 0x48, 0xdd, 0x82, 0xcc, 0xba, 0x29, 0x07, 0x69, 0xca, 0xa7,
+  0xaf, 0x8e, 0xaa, 0x1b, 0xd7, 0x8a, 0x2a, 0x5e, 0x6e, 0x94, 0xfb,
+  0xda, 0xb7, 0x8d, 0x9c, 0x7b, 0x74, 0xe8, 0x94, 0x87, 0x9f, 0x6a,
+  0x51, 0x52, 0x57, 0xcc, 0xf6, 0xf9, 0x50, 0x56, 0xf4, 0xe2, 0x53,
+  0x90, 0xf2, 0x4f, 0x6b, 0x35, 0xff, 0xbb, 0x74, 0xb7, 0x66, 0x20,
+  0x25, 0x69, 0xb1, 0xd7, 0x97, 0xf2, 0xd4, 0xbd, 0x9d, 0x17, 0x52,
+  0x4c, 0x72, 0x01, 0x07, 0xf9, 0x85, 0xf4, 0xdd, 0xc5, 0x83
+};
+
+static const uint8_t blake3_2049[131] = {
+  0x5f, 0x4d, 0x72, 0xf4, 0x0d, 0x7a, 0x5f, 0x82, 0xb1, 0x5c, 0xa2,
+  0xb2, 0xe4, 0x4b, 0x1d, 0xe3, 0xc2, 0xef, 0x86, 0xc4, 0x26, 0xc9,
+  0x5c, 0x1a, 0xf0, 0xb6, 0x87, 0x95, 0x22, 0x56, 0x30, 0x30, 0x96,
+  0xde, 0x31, 0xd7, 0x1d, 0x74, 0x10, 0x34, 0x03, 0x82, 0x2a, 0x2e,
+  0x0b, 0xc1, 0xeb, 0x19, 0x3e, 0x7a, 0xec, 0xc9, 0x64, 0x3a, 0x76,
+  0xb7, 0xbb, 0xc0, 0xc9, 0xf9, 0xc5, 0x2e, 0x87, 0x83, 0xaa, 0xe9,
+  0x87, 0x64, 0xca, 0x46, 0x89, 0x62, 0xb5, 0xc2, 0xec, 0x92, 0xf0,
+  0xc7, 0x4e, 0xb5, 0x44, 0x8d, 0x51, 0x97, 0x13, 0xe0, 0x94, 0x13,
+  0x71, 0x94, 0x31, 0xc8, 0x02, 0xf9, 0x48, 0xdd, 0x5d, 0x90, 0x42,
+  0x5a, 0x4e, 0xcd, 0xad, 0xec, 0xe9, 0xeb, 0x17, 0x8d, 0x80, 0xf2,
+  0x6e, 0xfc, 0xca, 0xe6, 0x30, 0x73, 0x4d, 0xff, 0x63, 0x34, 0x02,
+  0x85, 0xad, 0xec, 0x2a, 0xed, 0x3b, 0x51, 0x07, 0x3a, 0xd3
+};
+
+static const uint8_t blake3_keyed_2049[131] = {
+  0x9f, 0x29, 0x70, 0x09, 0x02, 0xf7, 0xc8, 0x6e, 0x51, 0x4d, 0xdc,
+  0x4d, 0xf1, 0xe3, 0x04, 0x9f, 0x25, 0x8b, 0x24, 0x72, 0xb6, 0xdd,
+  0x52, 0x67, 0xf6, 0x1b, 0xf1, 0x39, 0x83, 0xb7, 0x8d, 0xd5, 0xf9,
+  0xa8, 0x8a, 0xbf, 0xef, 0xdf, 0xa1, 0xe0, 0x0b, 0x41, 0x89, 0x71,
+  0xf2, 0xb3, 0x9c, 0x64, 0xca, 0x62, 0x1e, 0x8e, 0xb3, 0x7f, 0xce,
+  0xac, 0x57, 0xfd, 0x0c, 0x8f, 0xc8, 0xe1, 0x17, 0xd4, 0x3b, 0x81,
+  0x44, 0x7b, 0xe2, 0x2d, 0x5d, 0x81, 0x86, 0xf8, 0xf5, 0x91, 0x9b,
+  0xa6, 0xbc, 0xc6, 0x84, 0x6b, 0xd7, 0xd5, 0x07, 0x26, 0xc0, 0x6d,
+  0x24, 0x56, 0x72, 0xc2, 0xad, 0x4f, 0x61, 0x70, 0x2c, 0x64, 0x64,
+  0x99, 0xee, 0x11, 0x73, 0xda, 0xa0, 0x61, 0xff, 0xe1, 0x5b, 0xf4,
+  0x5a, 0x63, 0x1e, 0x29, 0x46, 0xd6, 0x16, 0xa4, 0xc3, 0x45, 0x82,
+  0x2f, 0x11, 0x51, 0x28, 0x47, 0x12, 0xf7, 0x6b, 0x2b, 0x0e
+};
+
+static const uint8_t blake3_derive_2049[131] = {
+  0x2e, 0xa4, 0x77, 0xc5, 0x51, 0x5c, 0xc3, 0xdd, 0x60, 0x65, 0x12,
+  0xee, 0x72, 0xbb, 0x3e, 0x0e, 0x75, 0x8c, 0xfa, 0xe7, 0x23, 0x28,
+  0x26, 0xf3, 0x5f, 0xb9, 0x8c, 0xa1, 0xbc, 0xbd, 0xf2, 0x73, 0x16,
+  0xd8, 0xe9, 0xe7, 0x90, 0x81, 0xa8, 0x0b, 0x04, 0x6b, 0x60, 0xf6,
+  0xa2, 0x63, 0x61, 0x6f, 0x33, 0xca, 0x46, 0x4b, 0xd7, 0x8d, 0x79,
+  0xfa, 0x18, 0x20, 0x0d, 0x06, 0xc7, 0xfc, 0x9b, 0xff, 0xd8, 0x08,
+  0xcc, 0x47, 0x55, 0x27, 0x7a, 0x7d, 0x5e, 0x09, 0xda, 0x0f, 0x29,
+  0xed, 0x15, 0x0f, 0x65, 0x37, 0xea, 0x9b, 0xed, 0x94, 0x62, 0x27,
+  0xff, 0x18, 0x4c, 0xc6, 0x6a, 0x72, 0xa5, 0xf8, 0xc1, 0xe4, 0xbd,
+  0x8b, 0x04, 0xe8, 0x1c, 0xf4, 0x0f, 0xe6, 0xdc, 0x44, 0x27, 0xad,
+  0x56, 0x78, 0x31, 0x1a, 0x61, 0xf4, 0xff, 0xc3, 0x9d, 0x19, 0x55,
+  0x89, 0xbd, 0xbc, 0x67, 0x0f, 0x63, 0xae, 0x70, 0xf4, 0xb6
+};
+
+static const uint8_t blake3_3072[131] = {
+  0xb9, 0x8c, 0xb0, 0xff, 0x36, 0x23, 0xbe, 0x03, 0x32, 0x6b, 0x37,
+  0x3d, 0xe6, 0xb9, 0x09, 0x52, 0x18, 0x51, 0x3e, 0x64, 0xf1, 0xee,
+  0x2e, 0xdd, 0x25, 0x25, 0xc7, 0xad, 0x1e, 0x5c, 0xff, 0xd2, 0x9a,
+  0x3f, 0x6b, 0x0b, 0x97, 0x8d, 0x66, 0x08, 0x33, 0x5c, 0x09, 0xdc,
+  0x94, 0xcc, 0xf6, 0x82, 0xf9, 0x95, 0x1c, 0xdf, 0xc5, 0x01, 0xbf,
+  0xe4, 0x7b, 0x9c, 0x91, 0x89, 0xa6, 0xfc, 0x7b, 0x40, 0x4d, 0x12,
+  0x02, 0x58, 0x50, 0x63, 0x41, 0xa6, 0xd8, 0x02, 0x85, 0x73, 0x22,
+  0xfb, 0xd2, 0x0d, 0x3e, 0x5d, 0xae, 0x05, 0xb9, 0x5c, 0x88, 0x79,
+  0x3f, 0xa8, 0x3d, 0xb1, 0xcb, 0x08, 0xe7, 0xd8, 0x00, 0x8d, 0x15,
+  0x99, 0xb6, 0x20, 0x9d, 0x78, 0x33, 0x6e, 0x24, 0x83, 0x97, 0x24,
+  0xc1, 0x91, 0xb2, 0xa5, 0x2a, 0x80, 0x44, 0x83, 0x06, 0xe0, 0xda,
+  0xa8, 0x4a, 0x3f, 0xdb, 0x56, 0x66, 0x61, 0xa3, 0x7e, 0x11
+};
+
+static const uint8_t blake3_keyed_3072[131] = {
+  0x04, 0x4a, 0x0e, 0x7b, 0x17, 0x2a, 0x31, 0x2d, 0xc0, 0x2a, 0x4c,
+  0x9a, 0x81, 0x8c, 0x03, 0x6f, 0xfa, 0x27, 0x76, 0x36, 0x8d, 0x7f,
+  0x52, 0x82, 0x68, 0xd2, 0xe6, 0xb5, 0xdf, 0x19, 0x17, 0x70, 0x22,
+  0xf3, 0x02, 0xd0, 0x52, 0x9e, 0x41, 0x74, 0xcc, 0x50, 0x7c, 0x46,
+  0x36, 0x71, 0x21, 0x79, 0x75, 0xe8, 0x1d, 0xab, 0x02, 0xb8, 0xfd,
+  0xeb, 0x0d, 0x7c, 0xcc, 0x75, 0x68, 0xdd, 0x22, 0x57, 0x4c, 0x78,
+  0x3a, 0x76, 0xbe, 0x21, 0x54, 0x41, 0xb3, 0x2e, 0x91, 0xb9, 0xa9,
+  0x04, 0xbe, 0x8e, 0xa8, 0x1f, 0x7a, 0x0a, 0xfd, 0x14, 0xba, 0xd8,
+  0xee, 0x7c, 0x8e, 0xfc, 0x30, 0x5a, 0xce, 0x5d, 0x3d, 0xd6, 0x1b,
+  0x99, 0x6f, 0xeb, 0xe8, 0xda, 0x4f, 0x56, 0xca, 0x09, 0x19, 0x35,
+  0x9a, 0x75, 0x33, 0x21, 0x6e, 0x29, 0x99, 0xfc, 0x87, 0xff, 0x7d,
+  0x8f, 0x17, 0x6f, 0xbe, 0xcb, 0x3d, 0x6f, 0x34, 0x27, 0x8b
+};
+
+static const uint8_t blake3_derive_3072[131] = {
+  0x05, 0x0d, 0xf9, 0x7f, 0x8c, 0x2e, 0xad, 0x65, 0x4d, 0x9b, 0xb3,
+  0xab, 0x8c, 0x91, 0x78, 0xed, 0xcd, 0x90, 0x2a, 0x32, 0xf8, 0x49,
+  0x59, 0x49, 0xfe, 0xad, 0xcc, 0x1e, 0x04, 0x80, 0xc4, 0x6b, 0x36,
+  0x04, 0x13, 0x1b, 0xbd, 0x6e, 0x3b, 0xa5, 0x73, 0xb6, 0xdd, 0x68,
+  0x2f, 0xa0, 0xa6, 0x3e, 0x5b, 0x16, 0x5d, 0x39, 0xfc, 0x43, 0xa6,
+  0x25, 0xd0, 0x02, 0x07, 0x60, 0x7a, 0x2b, 0xfe, 0xb6, 0x5f, 0xf1,
+  0xd2, 0x92, 0x92, 0x15, 0x2e, 0x26, 0xb2, 0x98, 0x86, 0x8e, 0x3b,
+  0x87, 0xbe, 0x95, 0xd6, 0x45, 0x8f, 0x6f, 0x2c, 0xe6, 0x11, 0x84,
+  0x37, 0xb6, 0x32, 0x41, 0x5a, 0xbe, 0x6a, 0xd5, 0x22, 0x87, 0x4b,
+  0xcd, 0x79, 0xe4, 0x03, 0x0a, 0x5e, 0x7b, 0xad, 0x2e, 0xfa, 0x90,
+  0xa7, 0xa7, 0xc6, 0x7e, 0x93, 0xf0, 0xa1, 0x8f, 0xb2, 0x83, 0x69,
+  0xd0, 0xa9, 0x32, 0x9a, 0xb5, 0xc2, 0x41, 0x34, 0xcc, 0xb0
+};
+
+static const uint8_t blake3_3073[131] = {
+  0x71, 0x24, 0xb4, 0x95, 0x01, 0x01, 0x2f, 0x81, 0xcc, 0x7f, 0x11,
+  0xca, 0x06, 0x9e, 0xc9, 0x22, 0x6c, 0xec, 0xb8, 0xa2, 0xc8, 0x50,
+  0xcf, 0xe6, 0x44, 0xe3, 0x27, 0xd2, 0x2d, 0x3e, 0x1c, 0xd3, 0x9a,
+  0x27, 0xae, 0x3b, 0x79, 0xd6, 0x8d, 0x89, 0xda, 0x9b, 0xf2, 0x5b,
+  0xc2, 0x71, 0x39, 0xae, 0x65, 0xa3, 0x24, 0x91, 0x8a, 0x5f, 0x9b,
+  0x78, 0x28, 0x18, 0x1e, 0x52, 0xcf, 0x37, 0x3c, 0x84, 0xf3, 0x5b,
+  0x63, 0x9b, 0x7f, 0xcc, 0xbb, 0x98, 0x5b, 0x6f, 0x2f, 0xa5, 0x6a,
+  0xea, 0x0c, 0x18, 0xf5, 0x31, 0x20, 0x34, 0x97, 0xb8, 0xbb, 0xd3,
+  0xa0, 0x7c, 0xeb, 0x59, 0x26, 0xf1, 0xca, 0xb7, 0x4d, 0x14, 0xbd,
+  0x66, 0x48, 0x6d, 0x9a, 0x91, 0xeb, 0xa9, 0x90, 0x59, 0xa9, 0x8b,
+  0xd1, 0xcd, 0x25, 0x87, 0x6b, 0x2a, 0xf5, 0xa7, 0x6c, 0x3e, 0x9e,
+  0xed, 0x55, 0x4e, 0xd7, 0x2e, 0xa9, 0x52, 0xb6, 0x03, 0xbf
+};
+
+static const uint8_t blake3_keyed_3073[131] = {
+  0x68, 0xde, 0xde, 0x9b, 0xef, 0x00, 0xba, 0x89, 0xe4, 0x3f, 0x31,
+  0xa6, 0x82, 0x5f, 0x4c, 0xf4, 0x33, 0x38, 0x9f, 0xed, 0xae, 0x75,
+  0xc0, 0x4e, 0xe9, 0xf0, 0xcf, 0x16, 0xa4, 0x27, 0xc9, 0x5a, 0x96,
+  0xd6, 0xda, 0x3f, 0xe9, 0x85, 0x05, 0x4d, 0x34, 0x78, 0x86, 0x5b,
+  0xe9, 0xa0, 0x92, 0x25, 0x08, 0x39, 0xa6, 0x97, 0xbb, 0xda, 0x74,
+  0xe2, 0x79, 0xe8, 0xa9, 0xe6, 0x9f, 0x00, 0x25, 0xe4, 0xcf, 0xdd,
+  0xd6, 0xcf, 0xb4, 0x34, 0xb1, 0xcd, 0x95, 0x43, 0xaa, 0xf9, 0x7c,
+  0x63, 0x5d, 0x1b, 0x45, 0x1a, 0x43, 0x86, 0x04, 0x1e, 0x4b, 0xb1,
+  0x00, 0xf5, 0xe4, 0x54, 0x07, 0xcb, 0xbc, 0x24, 0xfa, 0x53, 0xea,
+  0x2d, 0xe3, 0x53, 0x6c, 0xcb, 0x32, 0x9e, 0x4e, 0xb9, 0x46, 0x6e,
+  0xc3, 0x70, 0x93, 0xa4, 0x2c, 0xf6, 0x2b, 0x82, 0x90, 0x3c, 0x69,
+  0x6a, 0x93, 0xa5, 0x0b, 0x70, 0x2c, 0x80, 0xf3, 0xc3, 0xc5
+};
+
+static const uint8_t blake3_derive_3073[131] = {
+  0x72, 0x61, 0x3c, 0x9e, 0xc9, 0xff, 0x7e, 0x40, 0xf8, 0xf5, 0xc1,
+  0x73, 0x78, 0x4c, 0x53, 0x2a, 0xd8, 0x52, 0xe8, 0x27, 0xdb, 0xa2,
+  0xbf, 0x85, 0xb2, 0xab, 0x4b, 0x76, 0xf7, 0x07, 0x90, 0x81, 0x57,
+  0x62, 0x88, 0xe5, 0x52, 0x64, 0x7a, 0x9d, 0x86, 0x48, 0x1c, 0x2c,
+  0xae, 0x75, 0xc2, 0xdd, 0x4e, 0x7c, 0x51, 0x95, 0xfb, 0x9a, 0xda,
+  0x1e, 0xf5, 0x0e, 0x9c, 0x50, 0x98, 0xc2, 0x49, 0xd7, 0x43, 0x92,
+  0x91, 0x91, 0x44, 0x13, 0x01, 0xc6, 0x9e, 0x1f, 0x48, 0x50, 0x5a,
+  0x43, 0x05, 0xec, 0x17, 0x78, 0x45, 0x0e, 0xe4, 0x8b, 0x8e, 0x69,
+  0xdc, 0x23, 0xa2, 0x59, 0x60, 0xfe, 0x33, 0x07, 0x0e, 0xa5, 0x49,
+  0x11, 0x95, 0x99, 0x76, 0x0a, 0x8a, 0x2d, 0x28, 0xae, 0xca, 0x06,
+  0xb8, 0xc5, 0xe9, 0xba, 0x58, 0xbc, 0x19, 0xe1, 0x1f, 0xe5, 0x7b,
+  0x6e, 0xe9, 0x8a, 0xa4, 0x4b, 0x2a, 0x8e, 0x6b, 0x14, 0xa5
+};
+
+static const uint8_t blake3_4096[131] = {
+  0x01, 0x50, 0x94, 0x01, 0x3f, 0x57, 0xa5, 0x27, 0x7b, 0x59, 0xd8,
+  0x47, 0x5c, 0x05, 0x01, 0x04, 0x2c, 0x0b, 0x64, 0x2e, 0x53, 0x1b,
+  0x0a, 0x1c, 0x8f, 0x58, 0xd2, 0x16, 0x32, 0x29, 0xe9, 0x69, 0x02,
+  0x89, 0xe9, 0x40, 0x9d, 0xdb, 0x1b, 0x99, 0x76, 0x8e, 0xaf, 0xe1,
+  0x62, 0x3d, 0xa8, 0x96, 0xfa, 0xf7, 0xe1, 0x11, 0x4b, 0xeb, 0xea,
+  0xdc, 0x1b, 0xe3, 0x08, 0x29, 0xb6, 0xf8, 0xaf, 0x70, 0x7d, 0x85,
+  0xc2, 0x98, 0xf4, 0xf0, 0xff, 0x4d, 0x94, 0x38, 0xae, 0xf9, 0x48,
+  0x33, 0x56, 0x12, 0xae, 0x92, 0x1e, 0x76, 0xd4, 0x11, 0xc3, 0xa9,
+  0x11, 0x1d, 0xf6, 0x2d, 0x27, 0xea, 0xf8, 0x71, 0x95, 0x9a, 0xe0,
+  0x06, 0x2b, 0x54, 0x92, 0xa0, 0xfe, 0xb9, 0x8e, 0xf3, 0xed, 0x4a,
+  0xf2, 0x77, 0xf5, 0x39, 0x51, 0x72, 0xdb, 0xe5, 0xc3, 0x11, 0x91,
+  0x8e, 0xa0, 0x07, 0x4c, 0xe0, 0x03, 0x64, 0x54, 0xf6, 0x20
+};
+
+static const uint8_t blake3_keyed_4096[131] = {
+  0xbe, 0xfc, 0x66, 0x0a, 0xea, 0x2f, 0x17, 0x18, 0x88, 0x4c, 0xd8,
+  0xde, 0xb9, 0x90, 0x28, 0x11, 0xd3, 0x32, 0xf4, 0xfc, 0x4a, 0x38,
+  0xcf, 0x7c, 0x73, 0x00, 0xd5, 0x97, 0xa0, 0x81, 0xbf, 0xc0, 0xbb,
+  0xb6, 0x4a, 0x36, 0xed, 0xb5, 0x64, 0xe0, 0x1e, 0x4b, 0x4a, 0xaf,
+  0x3b, 0x06, 0x00, 0x92, 0xa6, 0xb8, 0x38, 0xbe, 0xa4, 0x4a, 0xfe,
+  0xbd, 0x2d, 0xeb, 0x82, 0x98, 0xfa, 0x56, 0x2b, 0x7b, 0x59, 0x7c,
+  0x75, 0x7b, 0x9d, 0xf4, 0xc9, 0x11, 0xc3, 0xca, 0x46, 0x2e, 0x2a,
+  0xc8, 0x9e, 0x9a, 0x78, 0x73, 0x57, 0xaa, 0xf7, 0x4c, 0x3b, 0x56,
+  0xd5, 0xc0, 0x7b, 0xc9, 0x3c, 0xe8, 0x99, 0x56, 0x8a, 0x3e, 0xb1,
+  0x7d, 0x92, 0x50, 0xc2, 0x0f, 0x6c, 0x5f, 0x6c, 0x1e, 0x79, 0x2e,
+  0xc9, 0xa2, 0xdc, 0xb7, 0x15, 0x39, 0x8d, 0x5a, 0x6e, 0xc6, 0xd5,
+  0xc5, 0x4f, 0x58, 0x6a, 0x00, 0x40, 0x3a, 0x1a, 0xf1, 0xde
+};
+
+static const uint8_t blake3_derive_4096[131] = {
+  0x1e, 0x0d, 0x7f, 0x3d, 0xb8, 0xc4, 0x14, 0xc9, 0x7c, 0x63, 0x07,
+  0xcb, 0xda, 0x6c, 0xd2, 0x7a, 0xc3, 0xb0, 0x30, 0x94, 0x9d, 0xa8,
+  0xe2, 0x3b, 0xe1, 0xa1, 0xa9, 0x24, 0xad, 0x2f, 0x25, 0xb9, 0xd7,
+  0x80, 0x38, 0xf7, 0xb1, 0x98, 0x59, 0x6c, 0x6c, 0xc4, 0xa9, 0xcc,
+  0xf9, 0x32, 0x23, 0xc0, 0x87, 0x22, 0xd6, 0x84, 0xf2, 0x40, 0xff,
+  0x65, 0x69, 0x07, 0x5e, 0xd8, 0x15, 0x91, 0xfd, 0x93, 0xf9, 0xff,
+  0xf1, 0x11, 0x0b, 0x3a, 0x75, 0xbc, 0x67, 0xe4, 0x26, 0x01, 0x2e,
+  0x55, 0x88, 0x95, 0x9c, 0xc5, 0xa4, 0xc1, 0x92, 0x17, 0x3a, 0x03,
+  0xc0, 0x07, 0x31, 0xcf, 0x84, 0x54, 0x4f, 0x65, 0xa2, 0xfb, 0x93,
+  0x78, 0x98, 0x9f, 0x72, 0xe9, 0x69, 0x4a, 0x6a, 0x39, 0x4a, 0x8a,
+  0x30, 0x99, 0x7c, 0x2e, 0x67, 0xf9, 0x5a, 0x50, 0x4e, 0x63, 0x1c,
+  0xd2, 0xc5, 0xf5, 0x52, 0x46, 0x02, 0x47, 0x61, 0xb2, 0x45
+};
+
+static const uint8_t blake3_4097[131] = {
+  0x9b, 0x40, 0x52, 0xb3, 0x8f, 0x1c, 0x5f, 0xc8, 0xb1, 0xf9, 0xff,
+  0x7a, 0xc7, 0xb2, 0x7c, 0xd2, 0x42, 0x48, 0x7b, 0x3d, 0x89, 0x0d,
+  0x15, 0xc9, 0x6a, 0x1c, 0x25, 0xb8, 0xaa, 0x0f, 0xb9, 0x95, 0x05,
+  0xf9, 0x1b, 0x0b, 0x56, 0x00, 0xa1, 0x12, 0x51, 0x65, 0x2e, 0xac,
+  0xfa, 0x94, 0x97, 0xb3, 0x1c, 0xd3, 0xc4, 0x09, 0xce, 0x2e, 0x45,
+  0xcf, 0xe6, 0xc0, 0xa0, 0x16, 0x96, 0x73, 0x16, 0xc4, 0x26, 0xbd,
+  0x26, 0xf6, 0x19, 0xea, 0xb5, 0xd7, 0x0a, 0xf9, 0xa4, 0x18, 0xb8,
+  0x45, 0xc6, 0x08, 0x84, 0x03, 0x90, 0xf3, 0x61, 0x63, 0x0b, 0xd4,
+  0x97, 0xb1, 0xab, 0x44, 0x01, 0x93, 0x16, 0x35, 0x7c, 0x61, 0xdb,
+  0xe0, 0x91, 0xce, 0x72, 0xfc, 0x16, 0xdc, 0x34, 0x0a, 0xc3, 0xd6,
+  0xe0, 0x09, 0xe0, 0x50, 0xb3, 0xad, 0xac, 0x4b, 0x5b, 0x2c, 0x92,
+  0xe7, 0x22, 0xcf, 0xfd, 0xc4, 0x65, 0x01, 0x53, 0x19, 0x56
+};
+
+static const uint8_t blake3_keyed_4097[131] = {
+  0x00, 0xdf, 0x94, 0x0c, 0xd3, 0x6b, 0xb9, 0xfa, 0x7c, 0xbb, 0xc3,
+  0x55, 0x67, 0x44, 0xe0, 0xdb, 0xc8, 0x19, 0x14, 0x01, 0xaf, 0xe7,
+  0x05, 0x20, 0xba, 0x29, 0x2e, 0xe3, 0xca, 0x80, 0xab, 0xbc, 0x60,
+  0x6d, 0xb4, 0x97, 0x6c, 0xfd, 0xd2, 0x66, 0xae, 0x0a, 0xbf, 0x66,
+  0x7d, 0x94, 0x81, 0x83, 0x1f, 0xf1, 0x2e, 0x0c, 0xaa, 0x26, 0x8e,
+  0x7d, 0x3e, 0x57, 0x26, 0x0c, 0x08, 0x24, 0x11, 0x5a, 0x54, 0xce,
+  0x59, 0x5c, 0xcc, 0x89, 0x77, 0x86, 0xd9, 0xdc, 0xbf, 0x49, 0x55,
+  0x99, 0xcf, 0xd9, 0x01, 0x57, 0x18, 0x6a, 0x46, 0xec, 0x80, 0x0a,
+  0x67, 0x63, 0xf1, 0xc5, 0x9e, 0x36, 0x19, 0x7e, 0x99, 0x39, 0xe9,
+  0x00, 0x80, 0x9f, 0x70, 0x77, 0xc1, 0x02, 0xf8, 0x88, 0xca, 0xaf,
+  0x86, 0x4b, 0x25, 0x3b, 0xc4, 0x1e, 0xea, 0x81, 0x26, 0x56, 0xd4,
+  0x67, 0x42, 0xe4, 0xea, 0x42, 0x76, 0x9f, 0x89, 0xb8, 0x3f
+};
+
+static const uint8_t blake3_derive_4097[131] = {
+  0xac, 0xa5, 0x10, 0x29, 0x62, 0x6b, 0x55, 0xfd, 0xa7, 0x11, 0x7b,
+  0x42, 0xa7, 0xc2, 0x11, 0xf8, 0xc6, 0xe9, 0xba, 0x4f, 0xe5, 0xb7,
+  0xa8, 0xca, 0x92, 0x2f, 0x34, 0x29, 0x95, 0x00, 0xea, 0xd8, 0xa8,
+  0x97, 0xf6, 0x6a, 0x40, 0x0f, 0xed, 0x91, 0x98, 0xfd, 0x61, 0xdd,
+  0x2d, 0x58, 0xd3, 0x82, 0x45, 0x8e, 0x64, 0xe1, 0x00, 0x12, 0x80,
+  0x75, 0xfc, 0x54, 0xb8, 0x60, 0x93, 0x4e, 0x8d, 0xe2, 0xe8, 0x41,
+  0x70, 0x73, 0x4b, 0x06, 0xe1, 0xd2, 0x12, 0xa1, 0x17, 0x10, 0x08,
+  0x20, 0xdb, 0xc4, 0x82, 0x92, 0xd1, 0x48, 0xaf, 0xa5, 0x05, 0x67,
+  0xb8, 0xb8, 0x4b, 0x1e, 0xc3, 0x36, 0xae, 0x10, 0xd4, 0x0c, 0x8c,
+  0x97, 0x5a, 0x62, 0x49, 0x96, 0xe1, 0x2d, 0xe3, 0x1a, 0xbb, 0xe1,
+  0x35, 0xd9, 0xd1, 0x59, 0x37, 0x57, 0x39, 0xc3, 0x33, 0x79, 0x8a,
+  0x80, 0xc6, 0x4a, 0xe8, 0x95, 0xe5, 0x1e, 0x22, 0xf3, 0xad
+};
+
+static const uint8_t blake3_8192[131] = {
+  0xaa, 0xe7, 0x92, 0x48, 0x4c, 0x8e, 0xfe, 0x4f, 0x19, 0xe2, 0xca,
+  0x7d, 0x37, 0x1d, 0x8c, 0x46, 0x7f, 0xfb, 0x10, 0x74, 0x8d, 0x8a,
+  0x5a, 0x1a, 0xe5, 0x79, 0x94, 0x8f, 0x71, 0x8a, 0x2a, 0x63, 0x5f,
+  0xe5, 0x1a, 0x27, 0xdb, 0x04, 0x5a, 0x56, 0x7c, 0x1a, 0xd5, 0x1b,
+  0xe5, 0xaa, 0x34, 0xc0, 0x1c, 0x66, 0x51, 0xc4, 0xd9, 0xb5, 0xb5,
+  0xac, 0x5d, 0x0f, 0xd5, 0x8c, 0xf1, 0x8d, 0xd6, 0x1a, 0x47, 0x77,
+  0x85, 0x66, 0xb7, 0x97, 0xa8, 0xc6, 0x7d, 0xf7, 0xb1, 0xd6, 0x0b,
+  0x97, 0xb1, 0x92, 0x88, 0xd2, 0xd8, 0x77, 0xbb, 0x2d, 0xf4, 0x17,
+  0xac, 0xe0, 0x09, 0xdc, 0xb0, 0x24, 0x1c, 0xa1, 0x25, 0x7d, 0x62,
+  0x71, 0x2b, 0x6a, 0x40, 0x43, 0xb4, 0xff, 0x33, 0xf6, 0x90, 0xd8,
+  0x49, 0xda, 0x91, 0xea, 0x3b, 0xf7, 0x11, 0xed, 0x58, 0x3c, 0xb7,
+  0xb7, 0xa7, 0xda, 0x28, 0x39, 0xba, 0x71, 0x30, 0x9b, 0xbf
+};
+
+static const uint8_t blake3_keyed_8192[131] = {
+  0xdc, 0x96, 0x37, 0xc8, 0x84, 0x5a, 0x77, 0x0b, 0x4c, 0xbf, 0x76,
+  0xb8, 0xda, 0xec, 0x0e, 0xeb, 0xf7, 0xdc, 0x2e, 0xac, 0x11, 0x49,
+  0x85, 0x17, 0xf0, 0x8d, 0x44, 0xc8, 0xfc, 0x00, 0xd5, 0x8a, 0x48,
+  0x34, 0x46, 0x41, 0x59, 0xdc, 0xbc, 0x12, 0xa0, 0xba, 0x0c, 0x6d,
+  0x6e, 0xb4, 0x1b, 0xac, 0x0e, 0xd6, 0x58, 0x5c, 0xab, 0xfe, 0x0a,
+  0xca, 0x36, 0xa3, 0x75, 0xe6, 0xc5, 0x48, 0x0c, 0x22, 0xaf, 0xdc,
+  0x40, 0x78, 0x5c, 0x17, 0x0f, 0x5a, 0x6b, 0x8a, 0x11, 0x07, 0xdb,
+  0xee, 0x28, 0x23, 0x18, 0xd0, 0x0d, 0x91, 0x5a, 0xc9, 0xed, 0x11,
+  0x43, 0xad, 0x40, 0x76, 0x5e, 0xc1, 0x20, 0x04, 0x2e, 0xe1, 0x21,
+  0xcd, 0x2b, 0xaa, 0x36, 0x25, 0x0c, 0x61, 0x8a, 0xda, 0xf9, 0xe2,
+  0x72, 0x60, 0xfd, 0xa2, 0xf9, 0x4d, 0xea, 0x8f, 0xb6, 0xf0, 0x8c,
+  0x04, 0xf8, 0xf1, 0x0c, 0x78, 0x29, 0x2a, 0xa4, 0x61, 0x02
+};
+
+static const uint8_t blake3_derive_8192[131] = {
+  0xad, 0x01, 0xd7, 0xae, 0x4a, 0xd0, 0x59, 0xb0, 0xd3, 0x3b, 0xaa,
+  0x3c, 0x01, 0x31, 0x9d, 0xcf, 0x80, 0x88, 0x09, 0x4d, 0x03, 0x59,
+  0xe5, 0xfd, 0x45, 0xd6, 0xae, 0xaa, 0x8b, 0x2d, 0x0c, 0x3d, 0x4c,
+  0x9e, 0x58, 0x95, 0x85, 0x53, 0x51, 0x3b, 0x67, 0xf8, 0x4f, 0x8e,
+  0xac, 0x65, 0x3a, 0xee, 0xb0, 0x2a, 0xe1, 0xd5, 0x67, 0x2d, 0xce,
+  0xcf, 0x91, 0xcd, 0x99, 0x85, 0xa0, 0xe6, 0x7f, 0x45, 0x01, 0x91,
+  0x0e, 0xcb, 0xa2, 0x55, 0x55, 0x39, 0x54, 0x27, 0xcc, 0xc7, 0x24,
+  0x1d, 0x70, 0xdc, 0x21, 0xc1, 0x90, 0xe2, 0xaa, 0xde, 0xe8, 0x75,
+  0xe5, 0xaa, 0xe6, 0xbf, 0x19, 0x12, 0x83, 0x7e, 0x53, 0x41, 0x1d,
+  0xab, 0xf7, 0xa5, 0x6c, 0xbf, 0x8e, 0x4f, 0xb7, 0x80, 0x43, 0x2b,
+  0x0d, 0x7f, 0xe6, 0xce, 0xc4, 0x50, 0x24, 0xa0, 0x78, 0x8c, 0xf5,
+  0x87, 0x46, 0x16, 0x40, 0x77, 0x57, 0xe9, 0xe6, 0xbe, 0xf7
+};
+
+static const uint8_t blake3_8193[131] = {
+  0xba, 0xb6, 0xc0, 0x9c, 0xb8, 0xce, 0x8c, 0xf4, 0x59, 0x26, 0x13,
+  0x98, 0xd2, 0xe7, 0xae, 0xf3, 0x57, 0x00, 0xbf, 0x48, 0x81, 0x16,
+  0xce, 0xb9, 0x4a, 0x36, 0xd0, 0xf5, 0xf1, 0xb7, 0xbc, 0x3b, 0xb2,
+  0x28, 0x2a, 0xa6, 0x9b, 0xe0, 0x89, 0x35, 0x9e, 0xa1, 0x15, 0x4b,
+  0x9a, 0x92, 0x86, 0xc4, 0xa5, 0x6a, 0xf4, 0xde, 0x97, 0x5a, 0x9a,
+  0xa4, 0xa5, 0xc4, 0x97, 0x65, 0x49, 0x14, 0xd2, 0x79, 0xbe, 0xa6,
+  0x0b, 0xb6, 0xd2, 0xcf, 0x72, 0x25, 0xa2, 0xfa, 0x0f, 0xf5, 0xef,
+  0x56, 0xbb, 0xe4, 0xb1, 0x49, 0xf3, 0xed, 0x15, 0x86, 0x0f, 0x78,
+  0xb4, 0xe2, 0xad, 0x04, 0xe1, 0x58, 0xe3, 0x75, 0xc1, 0xe0, 0xc0,
+  0xb5, 0x51, 0xcd, 0x7d, 0xfc, 0x82, 0xf1, 0xb1, 0x55, 0xc1, 0x1b,
+  0x6b, 0x3e, 0xd5, 0x1e, 0xc9, 0xed, 0xb3, 0x0d, 0x13, 0x36, 0x53,
+  0xbb, 0x57, 0x09, 0xd1, 0xdb, 0xd5, 0x5f, 0x4e, 0x1f, 0xf6
+};
+
+static const uint8_t blake3_keyed_8193[131] = {
+  0x95, 0x4a, 0x2a, 0x75, 0x42, 0x0c, 0x8d, 0x65, 0x47, 0xe3, 0xba,
+  0x5b, 0x98, 0xd9, 0x63, 0xe6, 0xfa, 0x64, 0x91, 0xad, 0xdc, 0x8c,
+  0x02, 0x31, 0x89, 0xcc, 0x51, 0x98, 0x21, 0xb4, 0xa1, 0xf5, 0xf0,
+  0x32, 0x28, 0x64, 0x8f, 0xd9, 0x83, 0xae, 0xf0, 0x45, 0xc2, 0xfa,
+  0x82, 0x90, 0x93, 0x4b, 0x08, 0x66, 0xb6, 0x15, 0xf5, 0x85, 0x14,
+  0x95, 0x87, 0xdd, 0xa2, 0x29, 0x90, 0x39, 0x96, 0x53, 0x28, 0x83,
+  0x5a, 0x2b, 0x18, 0xf1, 0xd6, 0x3b, 0x7e, 0x30, 0x0f, 0xc7, 0x6f,
+  0xf2, 0x60, 0xb5, 0x71, 0x83, 0x9f, 0xe4, 0x48, 0x76, 0xa4, 0xea,
+  0xe6, 0x6c, 0xba, 0xc8, 0xc6, 0x76, 0x94, 0x41, 0x1e, 0xd7, 0xe0,
+  0x9d, 0xf5, 0x10, 0x68, 0xa2, 0x2c, 0x6e, 0x67, 0xd6, 0xd3, 0xdd,
+  0x2c, 0xca, 0x8f, 0xf1, 0x2e, 0x32, 0x75, 0x38, 0x40, 0x06, 0xc8,
+  0x0f, 0x4d, 0xb6, 0x80, 0x23, 0xf2, 0x4e, 0xeb, 0xba, 0x57
+};
+
+static const uint8_t blake3_derive_8193[131] = {
+  0xaf, 0x1e, 0x03, 0x46, 0xe3, 0x89, 0xb1, 0x7c, 0x23, 0x20, 0x02,
+  0x70, 0xa6, 0x4a, 0xa4, 0xe1, 0xea, 0xd9, 0x8c, 0x61, 0x69, 0x5d,
+  0x91, 0x7d, 0xe7, 0xd5, 0xb0, 0x04, 0x91, 0xc9, 0xb0, 0xf1, 0x2f,
+  0x20, 0xa0, 0x1d, 0x6d, 0x62, 0x2e, 0xdf, 0x3d, 0xe0, 0x26, 0xa4,
+  0xdb, 0x4e, 0x45, 0x26, 0x22, 0x5d, 0xeb, 0xb9, 0x3c, 0x12, 0x37,
+  0x93, 0x4d, 0x71, 0xc7, 0x34, 0x0b, 0xb5, 0x91, 0x61, 0x58, 0xcb,
+  0xda, 0xfe, 0x9a, 0xc3, 0x22, 0x54, 0x76, 0xb6, 0xab, 0x57, 0xa1,
+  0x23, 0x57, 0xdb, 0x3a, 0xbb, 0xad, 0x7a, 0x26, 0xc6, 0xe6, 0x62,
+  0x90, 0xe4, 0x40, 0x34, 0xfb, 0x08, 0xa2, 0x0a, 0x8d, 0x0e, 0xc2,
+  0x64, 0xf3, 0x09, 0x99, 0x4d, 0x28, 0x10, 0xc4, 0x9c, 0xfb, 0xa6,
+  0x98, 0x9d, 0x7a, 0xbb, 0x09, 0x58, 0x97, 0x45, 0x9f, 0x54, 0x25,
+  0xad, 0xb4, 0x8a, 0xba, 0x07, 0xc5, 0xfb, 0x3c, 0x83, 0xc0
+};
+
+static const uint8_t blake3_16384[131] = {
+  0xf8, 0x75, 0xd6, 0x64, 0x6d, 0xe2, 0x89, 0x85, 0x64, 0x6f, 0x34,
+  0xee, 0x13, 0xbe, 0x9a, 0x57, 0x6f, 0xd5, 0x15, 0xf7, 0x6b, 0x5b,
+  0x0a, 0x26, 0xbb, 0x32, 0x47, 0x35, 0x04, 0x1d, 0xdd, 0xe4, 0x9d,
+  0x76, 0x4c, 0x27, 0x01, 0x76, 0xe5, 0x3e, 0x97, 0xbd, 0xff, 0xa5,
+  0x8d, 0x54, 0x90, 0x73, 0xf2, 0xc6, 0x60, 0xbe, 0x0e, 0x81, 0x29,
+  0x37, 0x67, 0xed, 0x4e, 0x49, 0x29, 0xf9, 0xad, 0x34, 0xbb, 0xb3,
+  0x9a, 0x52, 0x93, 0x34, 0xc5, 0x7c, 0x4a, 0x38, 0x1f, 0xfd, 0x2a,
+  0x6d, 0x4b, 0xfd, 0xbf, 0x14, 0x82, 0x65, 0x1b, 0x17, 0x2a, 0xa8,
+  0x83, 0xcc, 0x13, 0x40, 0x8f, 0xa6, 0x77, 0x58, 0xa3, 0xe4, 0x75,
+  0x03, 0xf9, 0x3f, 0x87, 0x72, 0x0a, 0x31, 0x77, 0x32, 0x5f, 0x78,
+  0x23, 0x25, 0x1b, 0x85, 0x27, 0x5f, 0x64, 0x63, 0x6a, 0x8f, 0x1d,
+  0x59, 0x9c, 0x2e, 0x49, 0x72, 0x2f, 0x42, 0xe9, 0x38, 0x93
+};
+
+static const uint8_t blake3_keyed_16384[131] = {
+  0x9e, 0x9f, 0xc4, 0xeb, 0x7c, 0xf0, 0x81, 0xea, 0x7c, 0x47, 0xd1,
+  0x80, 0x77, 0x90, 0xed, 0x21, 0x1b, 0xfe, 0xc5, 0x6a, 0xa2, 0x5b,
+  0xb7, 0x03, 0x77, 0x84, 0xc1, 0x3c, 0x4b, 0x70, 0x7b, 0x0d, 0xf9,
+  0xe6, 0x01, 0xb1, 0x01, 0xe4, 0xcf, 0x63, 0xa4, 0x04, 0xdf, 0xe5,
+  0x0f, 0x2e, 0x18, 0x65, 0xbb, 0x12, 0xed, 0xc8, 0xfc, 0xa1, 0x66,
+  0x57, 0x9c, 0xe0, 0xc7, 0x0d, 0xba, 0x5a, 0x5c, 0x0f, 0xc9, 0x60,
+  0xad, 0x6f, 0x37, 0x72, 0x18, 0x34, 0x16, 0xa0, 0x0b, 0xd2, 0x9d,
+  0x4c, 0x6e, 0x65, 0x1e, 0xa7, 0x62, 0x0b, 0xb1, 0x00, 0xc9, 0x44,
+  0x98, 0x58, 0xbf, 0x14, 0xe1, 0xdd, 0xc9, 0xec, 0xd3, 0x57, 0x25,
+  0x58, 0x1c, 0xa5, 0xb9, 0x16, 0x0d, 0xe0, 0x40, 0x60, 0x04, 0x59,
+  0x93, 0xd9, 0x72, 0x57, 0x1c, 0x3e, 0x8f, 0x71, 0xe9, 0xd0, 0x49,
+  0x6b, 0xfa, 0x74, 0x46, 0x56, 0x86, 0x1b, 0x16, 0x9d, 0x65
+};
+
+static const uint8_t blake3_derive_16384[131] = {
+  0x16, 0x0e, 0x18, 0xb5, 0x87, 0x8c, 0xd0, 0xdf, 0x1c, 0x3a, 0xf8,
+  0x5e, 0xb2, 0x5a, 0x0d, 0xb5, 0x34, 0x4d, 0x43, 0xa6, 0xfb, 0xd7,
+  0xa8, 0xef, 0x4e, 0xd9, 0x8d, 0x07, 0x14, 0xc3, 0xf7, 0xe1, 0x60,
+  0xdc, 0x0b, 0x1f, 0x09, 0xca, 0xa3, 0x5f, 0x2f, 0x41, 0x7b, 0x9e,
+  0xf3, 0x09, 0xdf, 0xe5, 0xeb, 0xd6, 0x7f, 0x4c, 0x95, 0x07, 0x99,
+  0x5a, 0x53, 0x13, 0x74, 0xd0, 0x99, 0xcf, 0x8a, 0xe3, 0x17, 0x54,
+  0x2e, 0x88, 0x5e, 0xc6, 0xf5, 0x89, 0x37, 0x88, 0x64, 0xd3, 0xea,
+  0x98, 0x71, 0x6b, 0x3b, 0xbb, 0x65, 0xef, 0x4a, 0xb5, 0xe0, 0xab,
+  0x5b, 0xb2, 0x98, 0xa5, 0x01, 0xf1, 0x9a, 0x41, 0xec, 0x19, 0xaf,
+  0x84, 0xa5, 0xe6, 0xb4, 0x28, 0xec, 0xd8, 0x13, 0xb1, 0xa4, 0x7e,
+  0xd9, 0x1c, 0x96, 0x57, 0xc3, 0xfb, 0xa1, 0x1c, 0x40, 0x6b, 0xc3,
+  0x16, 0x76, 0x8b, 0x58, 0xf6, 0x80, 0x2c, 0x9e, 0x9b, 0x57
+};
+
+static const uint8_t blake3_31744[131] = {
+  0x62, 0xb6, 0x96, 0x0e, 0x1a, 0x44, 0xbc, 0xc1, 0xeb, 0x1a, 0x61,
+  0x1a, 0x8d, 0x62, 0x35, 0xb6, 0xb4, 0xb7, 0x8f, 0x32, 0xe7, 0xab,
+  0xc4, 0xfb, 0x4c, 0x6c, 0xdc, 0xce, 0x94, 0x89, 0x5c, 0x47, 0x86,
+  0x0c, 0xc5, 0x1f, 0x2b, 0x0c, 0x28, 0xa7, 0xb7, 0x73, 0x04, 0xbd,
+  0x55, 0xfe, 0x73, 0xaf, 0x66, 0x3c, 0x02, 0xd3, 0xf5, 0x2e, 0xa0,
+  0x53, 0xba, 0x43, 0x43, 0x1c, 0xa5, 0xba, 0xb7, 0xbf, 0xea, 0x2f,
+  0x5e, 0x9d, 0x71, 0x21, 0x77, 0x0d, 0x88, 0xf7, 0x0a, 0xe9, 0x64,
+  0x9e, 0xa7, 0x13, 0x08, 0x7d, 0x19, 0x14, 0xf7, 0xf3, 0x12, 0x14,
+  0x7e, 0x24, 0x7f, 0x87, 0xeb, 0x2d, 0x4f, 0xfe, 0xf0, 0xac, 0x97,
+  0x8b, 0xf7, 0xb6, 0x57, 0x9d, 0x57, 0xd5, 0x33, 0x35, 0x5a, 0xa2,
+  0x0b, 0x8b, 0x77, 0xb1, 0x3f, 0xd0, 0x97, 0x48, 0x72, 0x8a, 0x5c,
+  0xc3, 0x27, 0xa8, 0xec, 0x47, 0x0f, 0x40, 0x13, 0x22, 0x6f
+};
+
+static const uint8_t blake3_keyed_31744[131] = {
+  0xef, 0xa5, 0x3b, 0x38, 0x9a, 0xb6, 0x7c, 0x59, 0x3d, 0xba, 0x62,
+  0x4d, 0x89, 0x8d, 0x0f, 0x73, 0x53, 0xab, 0x99, 0xe4, 0xac, 0x9d,
+  0x42, 0x30, 0x2e, 0xe6, 0x4c, 0xbf, 0x99, 0x39, 0xa4, 0x19, 0x3a,
+  0x72, 0x58, 0xdb, 0x2d, 0x9c, 0xd3, 0x2a, 0x7a, 0x3e, 0xcf, 0xce,
+  0x46, 0x14, 0x41, 0x14, 0xb1, 0x5c, 0x2f, 0xcb, 0x68, 0xa6, 0x18,
+  0xa9, 0x76, 0xbd, 0x74, 0x51, 0x5d, 0x47, 0xbe, 0x08, 0xb6, 0x28,
+  0xbe, 0x42, 0x0b, 0x5e, 0x83, 0x0f, 0xad, 0xe7, 0xc0, 0x80, 0xe3,
+  0x51, 0xa0, 0x76, 0xfb, 0xc3, 0x86, 0x41, 0xad, 0x80, 0xc7, 0x36,
+  0xc8, 0xa1, 0x8f, 0xe3, 0xc6, 0x6c, 0xe1, 0x2f, 0x95, 0xc6, 0x1c,
+  0x24, 0x62, 0xa9, 0x77, 0x0d, 0x60, 0xd0, 0xf7, 0x71, 0x15, 0xbb,
+  0xcd, 0x37, 0x82, 0xb5, 0x93, 0x01, 0x6a, 0x4e, 0x72, 0x8d, 0x4c,
+  0x06, 0xce, 0xe4, 0x50, 0x5c, 0xb0, 0xc0, 0x8a, 0x42, 0xec
+};
+
+static const uint8_t blake3_derive_31744[131] = {
+  0x39, 0x77, 0x2a, 0xef, 0x80, 0xe0, 0xeb, 0xe6, 0x05, 0x96, 0x36,
+  0x1e, 0x45, 0xb0, 0x61, 0xe8, 0xf4, 0x17, 0x42, 0x9d, 0x52, 0x91,
+  0x71, 0xb6, 0x76, 0x44, 0x68, 0xc2, 0x29, 0x28, 0xe2, 0x8e, 0x97,
+  0x59, 0xad, 0xeb, 0x79, 0x7a, 0x3f, 0xbf, 0x77, 0x1b, 0x1b, 0xce,
+  0xa3, 0x01, 0x50, 0xa0, 0x20, 0xe3, 0x17, 0x98, 0x2b, 0xf0, 0xd6,
+  0xe7, 0xd1, 0x4d, 0xd9, 0xf0, 0x64, 0xbc, 0x11, 0x02, 0x5c, 0x25,
+  0xf3, 0x1e, 0x81, 0xbd, 0x78, 0xa9, 0x21, 0xdb, 0x01, 0x74, 0xf0,
+  0x3d, 0xd4, 0x81, 0xd3, 0x0e, 0x93, 0xfd, 0x8e, 0x90, 0xf8, 0xb2,
+  0xfe, 0xe2, 0x09, 0xf8, 0x49, 0xf2, 0xd2, 0xa5, 0x2f, 0x31, 0x71,
+  0x9a, 0x49, 0x0f, 0xb0, 0xba, 0x7a, 0xea, 0x1e, 0x09, 0x81, 0x4e,
+  0xe9, 0x12, 0xeb, 0xa1, 0x11, 0xa9, 0xfd, 0xe9, 0xd5, 0xc2, 0x74,
+  0x18, 0x5f, 0x7b, 0xae, 0x8b, 0xa8, 0x5d, 0x30, 0x0a, 0x2b
+};
+
+static const uint8_t blake3_102400[131] = {
+  0xbc, 0x3e, 0x3d, 0x41, 0xa1, 0x14, 0x6b, 0x06, 0x9a, 0xbf, 0xfa,
+  0xd3, 0xc0, 0xd4, 0x48, 0x60, 0xcf, 0x66, 0x43, 0x90, 0xaf, 0xce,
+  0x4d, 0x96, 0x61, 0xf7, 0x90, 0x2e, 0x79, 0x43, 0xe0, 0x85, 0xe0,
+  0x1c, 0x59, 0xda, 0xb9, 0x08, 0xc0, 0x4c, 0x33, 0x42, 0xb8, 0x16,
+  0x94, 0x1a, 0x26, 0xd6, 0x9c, 0x26, 0x05, 0xeb, 0xee, 0x5e, 0xc5,
+  0x29, 0x1c, 0xc5, 0x5e, 0x15, 0xb7, 0x61, 0x46, 0xe6, 0x74, 0x5f,
+  0x06, 0x01, 0x15, 0x6c, 0x35, 0x96, 0xcb, 0x75, 0x06, 0x5a, 0x9c,
+  0x57, 0xf3, 0x55, 0x85, 0xa5, 0x2e, 0x1a, 0xc7, 0x0f, 0x69, 0x13,
+  0x1c, 0x23, 0xd6, 0x11, 0xce, 0x11, 0xee, 0x4a, 0xb1, 0xec, 0x2c,
+  0x00, 0x90, 0x12, 0xd2, 0x36, 0x64, 0x8e, 0x77, 0xbe, 0x92, 0x95,
+  0xdd, 0x04, 0x26, 0xf2, 0x9b, 0x76, 0x4d, 0x65, 0xde, 0x58, 0xeb,
+  0x7d, 0x01, 0xdd, 0x42, 0x24, 0x82, 0x04, 0xf4, 0x5f, 0x8e
+};
+
+static const uint8_t blake3_keyed_102400[131] = {
+  0x1c, 0x35, 0xd1, 0xa5, 0x81, 0x10, 0x83, 0xfd, 0x71, 0x19, 0xf5,
+  0xd5, 0xd1, 0xba, 0x02, 0x7b, 0x4d, 0x01, 0xc0, 0xc6, 0xc4, 0x9f,
+  0xb6, 0xff, 0x2c, 0xf7, 0x53, 0x93, 0xea, 0x5d, 0xb4, 0xa7, 0xf9,
+  0xdb, 0xdd, 0x3e, 0x1d, 0x81, 0xdc, 0xbc, 0xa3, 0xba, 0x24, 0x1b,
+  0xb1, 0x87, 0x60, 0xf2, 0x07, 0x71, 0x0b, 0x75, 0x18, 0x46, 0xfa,
+  0xae, 0xb9, 0xdf, 0xf8, 0x26, 0x27, 0x10, 0x99, 0x9a, 0x59, 0xb2,
+  0xaa, 0x1a, 0xca, 0x29, 0x8a, 0x03, 0x2d, 0x94, 0xea, 0xcf, 0xad,
+  0xf1, 0xaa, 0x19, 0x24, 0x18, 0xeb, 0x54, 0x80, 0x8d, 0xb2, 0x3b,
+  0x56, 0xe3, 0x42, 0x13, 0x26, 0x6a, 0xa0, 0x84, 0x99, 0xa1, 0x6b,
+  0x35, 0x4f, 0x01, 0x8f, 0xc4, 0x96, 0x7d, 0x05, 0xf8, 0xb9, 0xd2,
+  0xad, 0x87, 0xa7, 0x27, 0x83, 0x37, 0xbe, 0x96, 0x93, 0xfc, 0x63,
+  0x8a, 0x3b, 0xfd, 0xbe, 0x31, 0x45, 0x74, 0xee, 0x6f, 0xc4
+};
+
+static const uint8_t blake3_derive_102400[131] = {
+  0x46, 0x52, 0xcf, 0xf7, 0xa3, 0xf3, 0x85, 0xa6, 0x10, 0x3b, 0x5c,
+  0x26, 0x0f, 0xc1, 0x59, 0x3e, 0x13, 0xc7, 0x78, 0xdb, 0xe6, 0x08,
+  0xef, 0xb0, 0x92, 0xfe, 0x7e, 0xe6, 0x9d, 0xf6, 0xe9, 0xc6, 0xd8,
+  0x3a, 0x3e, 0x04, 0x1b, 0xc3, 0xa4, 0x8d, 0xf2, 0x87, 0x9f, 0x4a,
+  0x0a, 0x3e, 0xd4, 0x0e, 0x7c, 0x96, 0x1c, 0x73, 0xef, 0xf7, 0x40,
+  0xf3, 0x11, 0x7a, 0x05, 0x04, 0xc2, 0xdf, 0xf4, 0x78, 0x6d, 0x44,
+  0xfb, 0x17, 0xf1, 0x54, 0x9e, 0xb0, 0xba, 0x58, 0x5e, 0x40, 0xec,
+  0x29, 0xbf, 0x77, 0x32, 0xf0, 0xb7, 0xe2, 0x86, 0xff, 0x8a, 0xcd,
+  0xdc, 0x4c, 0xb1, 0xe2, 0x3b, 0x87, 0xff, 0x5d, 0x82, 0x4a, 0x98,
+  0x64, 0x58, 0xdc, 0xc6, 0xa0, 0x4a, 0xc8, 0x39, 0x69, 0xb8, 0x06,
+  0x37, 0x56, 0x29, 0x53, 0xdf, 0x51, 0xed, 0x1a, 0x7e, 0x90, 0xa7,
+  0x92, 0x69, 0x24, 0xd2, 0x76, 0x37, 0x78, 0xbe, 0x85, 0x60
+};
+
+static const struct blake3_testcase testcases[] = {
+  { 0, BLAKE3_TEST_HASH, blake3_0 },
+  { 0, BLAKE3_TEST_KEYED, blake3_keyed_0 },
+  { 0, BLAKE3_TEST_DERIVE, blake3_derive_0 },
+  { 1, BLAKE3_TEST_HASH, blake3_1 },
+  { 1, BLAKE3_TEST_KEYED, blake3_keyed_1 },
+  { 1, BLAKE3_TEST_DERIVE, blake3_derive_1 },
+  { 63, BLAKE3_TEST_HASH, blake3_63 },
+  { 63, BLAKE3_TEST_KEYED, blake3_keyed_63 },
+  { 63, BLAKE3_TEST_DERIVE, blake3_derive_63 },
+  { 64, BLAKE3_TEST_HASH, blake3_64 },
+  { 64, BLAKE3_TEST_KEYED, blake3_keyed_64 },
+  { 64, BLAKE3_TEST_DERIVE, blake3_derive_64 },
+  { 65, BLAKE3_TEST_HASH, blake3_65 },
+  { 65, BLAKE3_TEST_KEYED, blake3_keyed_65 },
+  { 65, BLAKE3_TEST_DERIVE, blake3_derive_65 },
+  { 1023, BLAKE3_TEST_HASH, blake3_1023 },
+  { 1023, BLAKE3_TEST_KEYED, blake3_keyed_1023 },
+  { 1023, BLAKE3_TEST_DERIVE, blake3_derive_1023 },
+  { 1024, BLAKE3_TEST_HASH, blake3_1024 },
+  { 1024, BLAKE3_TEST_KEYED, blake3_keyed_1024 },
+  { 1024, BLAKE3_TEST_DERIVE, blake3_derive_1024 },
+  { 1025, BLAKE3_TEST_HASH, blake3_1025 },
+  { 1025, BLAKE3_TEST_KEYED, blake3_keyed_1025 },
+  { 1025, BLAKE3_TEST_DERIVE, blake3_derive_1025 },
+  { 2048, BLAKE3_TEST_HASH, blake3_2048 },
+  { 2048, BLAKE3_TEST_KEYED, blake3_keyed_2048 },
+  { 2048, BLAKE3_TEST_DERIVE, blake3_derive_2048 },
+  { 2049, BLAKE3_TEST_HASH, blake3_2049 },
+  { 2049, BLAKE3_TEST_KEYED, blake3_keyed_2049 },
+  { 2049, BLAKE3_TEST_DERIVE, blake3_derive_2049 },
+  { 3072, BLAKE3_TEST_HASH, blake3_3072 },
+  { 3072, BLAKE3_TEST_KEYED, blake3_keyed_3072 },
+  { 3072, BLAKE3_TEST_DERIVE, blake3_derive_3072 },
+  { 3073, BLAKE3_TEST_HASH, blake3_3073 },
+  { 3073, BLAKE3_TEST_KEYED, blake3_keyed_3073 },
+  { 3073, BLAKE3_TEST_DERIVE, blake3_derive_3073 },
+  { 4096, BLAKE3_TEST_HASH, blake3_4096 },
+  { 4096, BLAKE3_TEST_KEYED, blake3_keyed_4096 },
+  { 4096, BLAKE3_TEST_DERIVE, blake3_derive_4096 },
+  { 4097, BLAKE3_TEST_HASH, blake3_4097 },
+  { 4097, BLAKE3_TEST_KEYED, blake3_keyed_4097 },
+  { 4097, BLAKE3_TEST_DERIVE, blake3_derive_4097 },
+  { 8192, BLAKE3_TEST_HASH, blake3_8192 },
+  { 8192, BLAKE3_TEST_KEYED, blake3_keyed_8192 },
+  { 8192, BLAKE3_TEST_DERIVE, blake3_derive_8192 },
+  { 8193, BLAKE3_TEST_HASH, blake3_8193 },
+  { 8193, BLAKE3_TEST_KEYED, blake3_keyed_8193 },
+  { 8193, BLAKE3_TEST_DERIVE, blake3_derive_8193 },
+  { 16384, BLAKE3_TEST_HASH, blake3_16384 },
+  { 16384, BLAKE3_TEST_KEYED, blake3_keyed_16384 },
+  { 16384, BLAKE3_TEST_DERIVE, blake3_derive_16384 },
+  { 31744, BLAKE3_TEST_HASH, blake3_31744 },
+  { 31744, BLAKE3_TEST_KEYED, blake3_keyed_31744 },
+  { 31744, BLAKE3_TEST_DERIVE, blake3_derive_31744 },
+  { 102400, BLAKE3_TEST_HASH, blake3_102400 },
+  { 102400, BLAKE3_TEST_KEYED, blake3_keyed_102400 },
+  { 102400, BLAKE3_TEST_DERIVE, blake3_derive_102400 },
+};
+
+/* BLAKE3 of the first 1 MiB of the input pattern. */
+static const uint8_t blake3_long[32] = {
+  0x74, 0xcb, 0x44, 0x1f, 0xd0, 0x87, 0x76, 0x4c, 0xa9, 0xc3, 0x69,
+  0x4d, 0xa7, 0x42, 0xeb, 0xe3, 0x0c, 0xbe, 0xb3, 0x06, 0x0a, 0x17,
+  0x00, 0x9c, 0xa8, 0x18, 0x25, 0xc7, 0xa8, 0xd1, 0x03, 0x43
+};
+
+static void blake3_test_init (struct blake3_ctx *, enum blake3_test_mode);
+static bool run_blake3_testcase (const struct blake3_testcase *);
+static bool run_blake3_long (void);
+
+int
+main (void)
+{
+  uint32_t i;
+  int rv;
+
+  rv = 0;
+  for (i = 0; i < (sizeof (testcases) / sizeof (testcases[0])); ++i)
+    {
+      if (!run_blake3_testcase (&testcases[i]))
+        {
+          fprintf (stderr, "BLAKE3 test %u failed.\n", i);
+          rv = 1;
+        }
+    }
+  if (!run_blake3_long ())
+    {
+      fprintf (stderr, "BLAKE3 long message test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static void
+blake3_test_init (struct blake3_ctx *ctx, enum blake3_test_mode mode)
+{
+  switch (mode)
+    {
+    case BLAKE3_TEST_HASH:
+      blake3_init (ctx);
+      break;
+    case BLAKE3_TEST_KEYED:
+      blake3_init_key (ctx, blake3_test_key);
+      break;
+    case BLAKE3_TEST_DERIVE:
+      blake3_init_derive_key (ctx, blake3_test_context);
+      break;
+    }
+}
+
+static bool
+run_blake3_testcase (const struct blake3_testcase *test)
+{
+  struct blake3_ctx ctx;
+  uint8_t *input;
+  uint8_t output[BLAKE3_TEST_OUTPUT_SIZE];
+  uint8_t incremental[BLAKE3_TEST_OUTPUT_SIZE];
+  uint8_t parallel[BLAKE3_TEST_OUTPUT_SIZE];
+  size_t i;
+  bool ok;
+
+  input = malloc (test->inputlen + 1);
+  if (input == NULL)
+    return false;
+  for (i = 0; i < test->inputlen; ++i)
+    input[i] = (uint8_t)(i % 251);
+
+  blake3_test_init (&ctx, test->mode);
+  blake3_update (&ctx, input, test->inputlen);
+  blake3_final (output, sizeof (output), &ctx);
+  for (i = 0; i < sizeof (output); ++i)
+    printf ("%02x", output[i]);
+  printf ("\n");
+
+  /* Absorb the input in pieces that straddle block and chunk edges. */
+  blake3_test_init (&ctx, test->mode);
+  for (i = 0; i < test->inputlen; i += 67)
+    blake3_update (&ctx, input + i,
+                   test->inputlen - i < 67 ? test->inputlen - i : 67);
+  blake3_final (incremental, sizeof (incremental), &ctx);
+
+  blake3_test_init (&ctx, test->mode);
+  blake3_update_parallel (&ctx, input, test->inputlen, 4);
+  blake3_final (parallel, sizeof (parallel), &ctx);
+
+  ok = memcmp (output, test->output, sizeof (output)) == 0
+       && memcmp (incremental, test->output, sizeof (incremental)) == 0
+       && memcmp (parallel, test->output, sizeof (parallel)) == 0;
+
+  /* The one-shot functions only cover the unkeyed and keyed modes. */
+  if (test->mode != BLAKE3_TEST_DERIVE)
+    {
+      const uint8_t *key = test->mode == BLAKE3_TEST_KEYED
+                               ? blake3_test_key
+                               : NULL;
+
+      blake3 (output, input, key, sizeof (output), test->inputlen);
+      ok = ok && memcmp (output, test->output, sizeof (output)) == 0;
+    }
+
+  free (input);
+  return ok;
+}
+
+static bool
+run_blake3_long (void)
+{
+  struct blake3_ctx ctx;
+  uint8_t *input;
+  uint8_t output[BLAKE3_DIGEST_SIZE], parallel[BLAKE3_DIGEST_SIZE];
+  uint8_t chunked[BLAKE3_DIGEST_SIZE];
+  size_t i, step;
+  bool ok;
+
+  input = malloc (BLAKE3_TEST_LONG_SIZE);
+  if (input == NULL)
+    return false;
+  for (i = 0; i < BLAKE3_TEST_LONG_SIZE; ++i)
+    input[i] = (uint8_t)(i % 251);
+
+  blake3 (output, input, NULL, sizeof (output), BLAKE3_TEST_LONG_SIZE);
+  blake3_parallel (parallel, input, NULL, sizeof (parallel),
+                   BLAKE3_TEST_LONG_SIZE, 4);
+
+  /* Mix parallel updates of uneven sizes with serial ones. */
+  blake3_init (&ctx);
+  step = 1;
+  for (i = 0; i < BLAKE3_TEST_LONG_SIZE; i += step, step = step * 3 + 1)
+    {
+      if (step > BLAKE3_TEST_LONG_SIZE - i)
+        step = BLAKE3_TEST_LONG_SIZE - i;
+      if (step & 1)
+        blake3_update (&ctx, input + i, step);
+      else
+        blake3_update_parallel (&ctx, input + i, step, 3);
+    }
+  blake3_final (chunked, sizeof (chunked), &ctx);
+
+  ok = memcmp (output, blake3_long, sizeof (output)) == 0
+       && memcmp (parallel, blake3_long, sizeof (parallel)) == 0
+       && memcmp (chunked, blake3_long, sizeof (chunked)) == 0;
+
+  free (input);
+  return ok;
+}
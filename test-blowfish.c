@@ -142,14 +142,37 @@ static const uint8_t blowfish_test_ciphertexts[34][8]
         { 0x24, 0x59, 0x46, 0x88, 0x57, 0x54, 0x36, 0x9a },
         { 0x6b, 0x5c, 0x5a, 0x9c, 0x5d, 0x9e, 0x0a, 0x5a } };
 
+/* CBC test from Eric Young's libdes, "7654321 Now is the time for ". */
+static const uint8_t blowfish_cbc_key[16]
+    = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+        0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87 };
+static const uint8_t blowfish_cbc_iv[8]
+    = { 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10 };
+static const uint8_t blowfish_cbc_plaintext[32]
+    = { 0x37, 0x36, 0x35, 0x34, 0x33, 0x32, 0x31, 0x20,
+        0x4e, 0x6f, 0x77, 0x20, 0x69, 0x73, 0x20, 0x74,
+        0x68, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20,
+        0x66, 0x6f, 0x72, 0x20, 0x00, 0x00, 0x00, 0x00 };
+static const uint8_t blowfish_cbc_ciphertext[32]
+    = { 0x6b, 0x77, 0xb4, 0xd6, 0x30, 0x06, 0xde, 0xe6,
+        0x05, 0xb1, 0x56, 0xe2, 0x74, 0x03, 0x97, 0x93,
+        0x58, 0xde, 0xb9, 0xe7, 0x15, 0x46, 0x16, 0xd9,
+        0x59, 0xf1, 0x65, 0x2b, 0xd5, 0xff, 0x92, 0xcc };
+
 static void hexdump (const uint8_t *, size_t);
 static int run_blowfish_tests (void);
+static int run_blowfish_cbc_test (void);
+static int run_blowfish_ctr_test (void);
 
 int
 main (void)
 {
   if (run_blowfish_tests () < 0)
     exit (1);
+  if (run_blowfish_cbc_test () < 0)
+    exit (1);
+  if (run_blowfish_ctr_test () < 0)
+    exit (1);
 
   return 0;
 }
@@ -209,3 +232,99 @@ run_blowfish_tests (void)
 
   return rv;
 }
+
+static int
+run_blowfish_cbc_test (void)
+{
+  struct blowfish_ctx ctx;
+  uint8_t iv[8];
+  uint8_t buffer[32];
+  uint8_t long_pt[8 * 23];
+  uint8_t long_ct[sizeof (long_pt)];
+  size_t i;
+
+  blowfish_set_key (&ctx, blowfish_cbc_key, sizeof (blowfish_cbc_key));
+  memcpy (iv, blowfish_cbc_iv, sizeof (iv));
+  blowfish_cbc_encrypt (&ctx, iv, blowfish_cbc_plaintext, buffer,
+                        sizeof (buffer));
+  printf ("Blowfish CBC encrypt:\n  Got:       ");
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, blowfish_cbc_ciphertext, sizeof (buffer)) != 0
+      || memcmp (iv, blowfish_cbc_ciphertext + 24, sizeof (iv)) != 0)
+    return -1;
+
+  /* Decrypt in place. */
+  memcpy (iv, blowfish_cbc_iv, sizeof (iv));
+  blowfish_cbc_decrypt (&ctx, iv, buffer, buffer, sizeof (buffer));
+  if (memcmp (buffer, blowfish_cbc_plaintext, sizeof (buffer)) != 0
+      || memcmp (iv, blowfish_cbc_ciphertext + 24, sizeof (iv)) != 0)
+    return -1;
+
+  /* More blocks than are deciphered at once, against one at a time. */
+  for (i = 0; i < sizeof (long_pt); ++i)
+    long_pt[i] = (uint8_t)(i * 7 + 1);
+  memcpy (iv, blowfish_cbc_iv, sizeof (iv));
+  blowfish_cbc_encrypt (&ctx, iv, long_pt, long_ct, sizeof (long_pt));
+  memcpy (iv, blowfish_cbc_iv, sizeof (iv));
+  for (i = 0; i < sizeof (long_ct); i += 8)
+    {
+      blowfish_cbc_decrypt (&ctx, iv, long_ct + i, buffer, 8);
+      if (memcmp (buffer, long_pt + i, 8) != 0)
+        return -1;
+    }
+  memcpy (iv, blowfish_cbc_iv, sizeof (iv));
+  blowfish_cbc_decrypt (&ctx, iv, long_ct, long_ct, sizeof (long_ct));
+  if (memcmp (long_ct, long_pt, sizeof (long_pt)) != 0)
+    return -1;
+
+  /* ECB over several blocks at once against one at a time. */
+  blowfish_ecb_encrypt (&ctx, long_pt, long_ct, sizeof (long_pt));
+  for (i = 0; i < sizeof (long_pt); i += 8)
+    {
+      blowfish_ecb_encrypt (&ctx, long_pt + i, buffer, 8);
+      if (memcmp (buffer, long_ct + i, 8) != 0)
+        return -1;
+    }
+  blowfish_ecb_decrypt (&ctx, long_ct, long_ct, sizeof (long_ct));
+  if (memcmp (long_ct, long_pt, sizeof (long_pt)) != 0)
+    return -1;
+
+  return 0;
+}
+
+static int
+run_blowfish_ctr_test (void)
+{
+  struct blowfish_ctx ctx;
+  uint8_t ctr[8], expect_ctr[8];
+  uint8_t keystream[8];
+  uint8_t input[8 * 13 + 5];
+  uint8_t output[sizeof (input)];
+  size_t i, j;
+
+  blowfish_set_key (&ctx, blowfish_cbc_key, sizeof (blowfish_cbc_key));
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 5 + 3);
+  /* Close to 2^64 so that the counter wraps. */
+  memset (ctr, 0xff, sizeof (ctr));
+  ctr[7] = 0xfa;
+  memcpy (expect_ctr, ctr, sizeof (ctr));
+
+  blowfish_ctr_crypt (&ctx, ctr, input, output, sizeof (input));
+  for (i = 0; i < sizeof (input); i += 8)
+    {
+      blowfish_ecb_encrypt (&ctx, expect_ctr, keystream, 8);
+      for (j = 0; j < 8 && i + j < sizeof (input); ++j)
+        if ((input[i + j] ^ keystream[j]) != output[i + j])
+          return -1;
+      for (j = 8; j-- > 0;)
+        if (++expect_ctr[j] != 0)
+          break;
+    }
+  printf ("Blowfish CTR counter: ");
+  hexdump (ctr, sizeof (ctr));
+  if (memcmp (ctr, expect_ctr, sizeof (ctr)) != 0)
+    return -1;
+
+  return 0;
+}
@@ -0,0 +1,198 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors are from Appendix A of RFC 3713.
+ * https://www.rfc-editor.org/rfc/rfc3713
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "camellia.h"
+
+static const uint8_t camellia_test_key[32]
+    = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba,
+        0x98, 0x76, 0x54, 0x32, 0x10, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+        0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+static const uint8_t camellia_test_plaintext[16]
+    = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+        0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10 };
+
+static const uint8_t camellia128_test_ciphertext[16]
+    = { 0x67, 0x67, 0x31, 0x38, 0x54, 0x96, 0x69, 0x73,
+        0x08, 0x57, 0x06, 0x56, 0x48, 0xea, 0xbe, 0x43 };
+
+static const uint8_t camellia192_test_ciphertext[16]
+    = { 0xb4, 0x99, 0x34, 0x01, 0xb3, 0xe9, 0x96, 0xf8,
+        0x4e, 0xe5, 0xce, 0xe7, 0xd7, 0x9b, 0x09, 0xb9 };
+
+static const uint8_t camellia256_test_ciphertext[16]
+    = { 0x9a, 0xcc, 0x23, 0x7d, 0xff, 0x16, 0xd7, 0x6c,
+        0x20, 0xef, 0x7c, 0x91, 0x9e, 0x3a, 0x75, 0x09 };
+
+static void hexdump (const uint8_t *, size_t);
+static int check_block (const char *, const uint8_t *, const uint8_t *,
+                        const uint8_t *);
+static int run_camellia_tests (void);
+static int run_camellia_ctr_test (void);
+
+int
+main (void)
+{
+  if (run_camellia_tests () < 0)
+    exit (1);
+  if (run_camellia_ctr_test () < 0)
+    exit (1);
+
+  return 0;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
+
+static int
+check_block (const char *name, const uint8_t *expected,
+             const uint8_t *encrypted, const uint8_t *decrypted)
+{
+  printf ("%s:\n", name);
+  printf ("  Expected:  ");
+  hexdump (expected, CAMELLIA_BLOCK_SIZE);
+  printf ("  Got:       ");
+  hexdump (encrypted, CAMELLIA_BLOCK_SIZE);
+  printf ("  Decrypted: ");
+  hexdump (decrypted, CAMELLIA_BLOCK_SIZE);
+  if (memcmp (encrypted, expected, CAMELLIA_BLOCK_SIZE) != 0
+      || memcmp (decrypted, camellia_test_plaintext, CAMELLIA_BLOCK_SIZE)
+             != 0)
+    {
+      printf ("%s failed.\n", name);
+      return -1;
+    }
+  return 0;
+}
+
+static int
+run_camellia_tests (void)
+{
+  struct camellia128_ctx ctx128;
+  struct camellia192_ctx ctx192;
+  struct camellia256_ctx ctx256;
+  uint8_t buffer1[CAMELLIA_BLOCK_SIZE];
+  uint8_t buffer2[CAMELLIA_BLOCK_SIZE];
+  int rv;
+
+  rv = 0;
+  camellia128_set_key (&ctx128, camellia_test_key);
+  camellia128_encrypt (&ctx128, camellia_test_plaintext, buffer1);
+  camellia128_decrypt (&ctx128, buffer1, buffer2);
+  if (check_block ("Camellia-128", camellia128_test_ciphertext, buffer1,
+                   buffer2)
+      != 0)
+    rv = -1;
+
+  camellia192_set_key (&ctx192, camellia_test_key);
+  camellia192_encrypt (&ctx192, camellia_test_plaintext, buffer1);
+  camellia192_decrypt (&ctx192, buffer1, buffer2);
+  if (check_block ("Camellia-192", camellia192_test_ciphertext, buffer1,
+                   buffer2)
+      != 0)
+    rv = -1;
+
+  camellia256_set_key (&ctx256, camellia_test_key);
+  camellia256_encrypt (&ctx256, camellia_test_plaintext, buffer1);
+  camellia256_decrypt (&ctx256, buffer1, buffer2);
+  if (check_block ("Camellia-256", camellia256_test_ciphertext, buffer1,
+                   buffer2)
+      != 0)
+    rv = -1;
+
+  return rv;
+}
+
+/*
+ * Long enough for the sixteen block code, with the counter crossing a
+ * 64-bit boundary and a partial final block, against single blocks.
+ */
+static int
+run_camellia_ctr_test (void)
+{
+  struct camellia128_ctx ctx128;
+  struct camellia256_ctx ctx256;
+  uint8_t ctr[16], expect_ctr[16];
+  uint8_t keystream[16];
+  uint8_t input[16 * 53 + 7];
+  uint8_t output[sizeof (input)];
+  size_t i, j, k;
+
+  camellia128_set_key (&ctx128, camellia_test_key);
+  camellia256_set_key (&ctx256, camellia_test_key);
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 7 + 1);
+
+  for (k = 0; k < 2; ++k)
+    {
+      memset (ctr, 0, sizeof (ctr));
+      memset (ctr + 8, 0xff, 8);
+      ctr[15] = 0xf0;
+      memcpy (expect_ctr, ctr, sizeof (ctr));
+      if (k == 0)
+        camellia128_ctr_crypt (&ctx128, ctr, input, output, sizeof (input));
+      else
+        camellia256_ctr_crypt (&ctx256, ctr, input, output, sizeof (input));
+
+      for (i = 0; i < sizeof (input); i += 16)
+        {
+          if (k == 0)
+            camellia128_encrypt (&ctx128, expect_ctr, keystream);
+          else
+            camellia256_encrypt (&ctx256, expect_ctr, keystream);
+          for (j = 0; j < 16 && i + j < sizeof (input); ++j)
+            if ((input[i + j] ^ keystream[j]) != output[i + j])
+              {
+                printf ("Camellia CTR test %zu failed at byte %zu.\n", k,
+                        i + j);
+                return -1;
+              }
+          for (j = 16; j-- > 0;)
+            if (++expect_ctr[j] != 0)
+              break;
+        }
+      printf ("Camellia CTR counter: ");
+      hexdump (ctr, sizeof (ctr));
+      if (memcmp (ctr, expect_ctr, sizeof (ctr)) != 0)
+        return -1;
+    }
+
+  return 0;
+}
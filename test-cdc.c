@@ -0,0 +1,260 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fcrypt_cdc.h"
+#include "fcrypt_hash.h"
+#include "gear.h"
+
+#define DATA_SIZE (1024 * 1024 + 123)
+#define MAX_CHUNKS 20000
+
+struct chunk_list
+{
+  size_t count;
+  struct fcrypt_cdc_chunk chunks[MAX_CHUNKS];
+};
+
+static uint8_t data[DATA_SIZE];
+static struct chunk_list whole, split;
+
+static bool run_cdc_test (const char *, size_t, size_t, size_t);
+static bool run_cdc_error_test (void);
+
+int
+main (void)
+{
+  uint64_t state;
+  size_t i;
+  int rv;
+
+  state = UINT64_C (0x9e3779b97f4a7c15);
+  for (i = 0; i < DATA_SIZE; ++i)
+    {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      data[i] = (uint8_t)(state >> 32);
+    }
+
+  rv = 0;
+  if (!run_cdc_test ("sha256", 2048, 8192, 65536)
+      || !run_cdc_test ("sha256", 64, 256, 1024)
+      || !run_cdc_test ("sha1", 512, 4096, 16384)
+      || !run_cdc_test ("md5", 1024, 1024, 4096)
+      || !run_cdc_test ("blake2b", 2048, 8192, 65536)
+      || !run_cdc_test ("blake3", 128, 128, 128))
+    {
+      printf ("CDC test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_cdc_error_test ())
+    {
+      printf ("CDC error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static void
+add_chunk (void *arg, const struct fcrypt_cdc_chunk *chunk)
+{
+  struct chunk_list *list = arg;
+
+  if (list->count < MAX_CHUNKS)
+    list->chunks[list->count] = *chunk;
+  ++list->count;
+}
+
+static unsigned int
+log2_floor (size_t n)
+{
+  unsigned int bits;
+
+  for (bits = 0; (n >> bits) > 1; ++bits)
+    ;
+  return bits;
+}
+
+/* Finds the end of the chunk at the start of input one byte at a time. */
+static size_t
+reference_cut (const uint8_t *input, size_t len, size_t min, size_t avg,
+               size_t max)
+{
+  uint64_t hash, mask_s, mask_l;
+  unsigned int bits;
+  size_t i;
+
+  bits = log2_floor (avg);
+  mask_s = ~UINT64_C (0) << (64 - (bits + 2));
+  mask_l = ~UINT64_C (0) << (64 - (bits - 2));
+  hash = 0;
+  for (i = min; i < max && i < len; ++i)
+    {
+      hash = gear_update (hash, input + i, 1);
+      if ((hash & (i < avg ? mask_s : mask_l)) == 0)
+        return i + 1;
+    }
+  return i < len ? i : len;
+}
+
+static bool
+same_chunks (const struct chunk_list *a, const struct chunk_list *b,
+             size_t digest_size)
+{
+  size_t i;
+
+  if (a->count != b->count)
+    return false;
+  for (i = 0; i < a->count; ++i)
+    if (a->chunks[i].offset != b->chunks[i].offset
+        || a->chunks[i].len != b->chunks[i].len
+        || memcmp (a->chunks[i].digest, b->chunks[i].digest, digest_size)
+               != 0)
+      return false;
+  return true;
+}
+
+/*
+ * Chunks the data in one call and checks the boundaries against the
+ * reference and the digests against the hash of each chunk. Then chunks it
+ * again in pieces of varying size, through both update functions, and
+ * checks that the chunks are the same.
+ */
+static bool
+run_cdc_test (const char *name, size_t min, size_t avg, size_t max)
+{
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  const struct fcrypt_hash *hash;
+  const struct fcrypt_cdc_chunk *chunk;
+  struct fcrypt_cdc *cdc;
+  uint64_t offset;
+  size_t i, n, piece;
+  bool ok;
+
+  hash = fcrypt_hash_lookup (name);
+  if (hash == NULL)
+    return false;
+  cdc = fcrypt_cdc_new (hash, min, avg, max, add_chunk, &whole);
+  if (cdc == NULL)
+    return false;
+
+  whole.count = 0;
+  fcrypt_cdc_update (cdc, data, DATA_SIZE);
+  fcrypt_cdc_final (cdc);
+  ok = whole.count > 0 && whole.count <= MAX_CHUNKS;
+  offset = 0;
+  for (i = 0; ok && i < whole.count; ++i)
+    {
+      chunk = &whole.chunks[i];
+      n = reference_cut (data + offset, DATA_SIZE - offset, min, avg, max);
+      hash->digest (digest, data + offset, chunk->len);
+      ok = chunk->offset == offset && chunk->len == n
+           && memcmp (chunk->digest, digest, hash->digest_size) == 0;
+      offset += chunk->len;
+    }
+  ok = ok && offset == DATA_SIZE;
+
+  /* The average is within a factor of two of the one asked for. */
+  ok = ok && DATA_SIZE / whole.count > avg / 2
+       && DATA_SIZE / whole.count < avg * 2;
+
+  /* Twice, to check that the final function starts a new stream. */
+  fcrypt_cdc_free (cdc);
+  cdc = fcrypt_cdc_new (hash, min, avg, max, add_chunk, &split);
+  if (cdc == NULL)
+    return false;
+  for (n = 0; ok && n < 2; ++n)
+    {
+      split.count = 0;
+      piece = 1;
+      for (i = 0; i < DATA_SIZE; i += piece)
+        {
+          piece = (piece * 7919 + n) % 20000 + 1;
+          if (piece > DATA_SIZE - i)
+            piece = DATA_SIZE - i;
+          if (piece % 3 == 0)
+            fcrypt_cdc_update (cdc, data + i, piece);
+          else
+            fcrypt_cdc_update_multi (cdc, data + i, piece);
+        }
+      fcrypt_cdc_final (cdc);
+      ok = same_chunks (&whole, &split, hash->digest_size);
+    }
+
+  /* All of the data in one batched call. */
+  split.count = 0;
+  fcrypt_cdc_update_multi (cdc, data, DATA_SIZE);
+  fcrypt_cdc_final (cdc);
+  ok = ok && same_chunks (&whole, &split, hash->digest_size);
+
+  fcrypt_cdc_free (cdc);
+  return ok;
+}
+
+static bool
+run_cdc_error_test (void)
+{
+  const struct fcrypt_hash *hash;
+  struct fcrypt_cdc *cdc;
+
+  hash = &fcrypt_hash_sha256;
+  errno = 0;
+  if (fcrypt_cdc_new (hash, 32, 4096, 8192, add_chunk, &split) != NULL
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_cdc_new (hash, 4096, 2048, 8192, add_chunk, &split) != NULL
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_cdc_new (hash, 1024, 4096, 2048, add_chunk, &split) != NULL
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_cdc_new (NULL, 1024, 4096, 8192, add_chunk, &split) != NULL
+      || errno != EINVAL)
+    return false;
+
+  /* An empty stream has no chunks. */
+  cdc = fcrypt_cdc_new (hash, 1024, 4096, 8192, add_chunk, &split);
+  if (cdc == NULL)
+    return false;
+  split.count = 0;
+  fcrypt_cdc_update (cdc, data, 0);
+  fcrypt_cdc_update_multi (cdc, data, 0);
+  fcrypt_cdc_final (cdc);
+  fcrypt_cdc_free (cdc);
+  return split.count == 0;
+}
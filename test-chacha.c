@@ -32,6 +32,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "chacha.h"
 
@@ -255,7 +256,70 @@ static const struct chacha_testcase testcases[]
           64,
           128 } };
 
+/* RFC 8439 section 2.4.2, with the initial block counter 1. */
+static const uint8_t ietf_nonce[12] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x00
+};
+
+static const uint8_t ietf_plaintext[]
+    = "Ladies and Gentlemen of the class of '99: If I could offer you only "
+      "one tip for the future, sunscreen would be it.";
+
+static const uint8_t ietf_ciphertext[114] = {
+  0x6e, 0x2e, 0x35, 0x9a, 0x25, 0x68, 0xf9, 0x80, 0x41, 0xba, 0x07,
+  0x28, 0xdd, 0x0d, 0x69, 0x81, 0xe9, 0x7e, 0x7a, 0xec, 0x1d, 0x43,
+  0x60, 0xc2, 0x0a, 0x27, 0xaf, 0xcc, 0xfd, 0x9f, 0xae, 0x0b, 0xf9,
+  0x1b, 0x65, 0xc5, 0x52, 0x47, 0x33, 0xab, 0x8f, 0x59, 0x3d, 0xab,
+  0xcd, 0x62, 0xb3, 0x57, 0x16, 0x39, 0xd6, 0x24, 0xe6, 0x51, 0x52,
+  0xab, 0x8f, 0x53, 0x0c, 0x35, 0x9f, 0x08, 0x61, 0xd8, 0x07, 0xca,
+  0x0d, 0xbf, 0x50, 0x0d, 0x6a, 0x61, 0x56, 0xa3, 0x8e, 0x08, 0x8a,
+  0x22, 0xb6, 0x5e, 0x52, 0xbc, 0x51, 0x4d, 0x16, 0xcc, 0xf8, 0x06,
+  0x81, 0x8c, 0xe9, 0x1a, 0xb7, 0x79, 0x37, 0x36, 0x5a, 0xf9, 0x0b,
+  0xbf, 0x74, 0xa3, 0x5b, 0xe6, 0xb4, 0x0b, 0x8e, 0xed, 0xf2, 0x78,
+  0x5e, 0x42, 0x87, 0x4d
+};
+
+/* draft-irtf-cfrg-xchacha section 2.2.1. */
+static const uint8_t hchacha20_nonce[HCHACHA20_NONCE_SIZE] = {
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x00, 0x31, 0x41, 0x59, 0x27
+};
+
+static const uint8_t hchacha20_subkey[32] = {
+  0x82, 0x41, 0x3b, 0x42, 0x27, 0xb2, 0x7b, 0xfe, 0xd3, 0x0e, 0x42,
+  0x50, 0x8a, 0x87, 0x7d, 0x73, 0xa0, 0xf9, 0xe4, 0xd5, 0x8a, 0x74,
+  0xa8, 0x53, 0xc1, 0x2e, 0xc4, 0x13, 0x26, 0xd3, 0xec, 0xdc
+};
+
+/*
+ * XChaCha20 with the key 0x80 to 0x9f and the nonce 0x40 to 0x57 over the
+ * message byte i * 5 + 1, the first and last 64 bytes of 1100.
+ */
+static const uint8_t xchacha20_head[64] = {
+  0x7a, 0x1f, 0x14, 0x90, 0xe6, 0x7b, 0xef, 0xbd, 0x20, 0x61, 0x5c,
+  0x73, 0xb2, 0xfb, 0x3a, 0xb4, 0x16, 0x9a, 0x33, 0x13, 0xcd, 0x98,
+  0xde, 0xe4, 0xa4, 0x0d, 0x03, 0xf9, 0x0e, 0x6b, 0x90, 0x49, 0x00,
+  0x6d, 0x8c, 0x88, 0xee, 0xba, 0x8d, 0x5b, 0xb4, 0x12, 0xc1, 0xa8,
+  0x84, 0x34, 0x6f, 0xc9, 0xa0, 0x57, 0xdb, 0xe7, 0x66, 0x19, 0x5d,
+  0xfd, 0xa9, 0x26, 0x36, 0x5a, 0xc4, 0x62, 0x22, 0x66
+};
+
+static const uint8_t xchacha20_tail[64] = {
+  0xf7, 0x34, 0x8d, 0x42, 0x5d, 0xfe, 0xc8, 0xd3, 0x04, 0x8b, 0x18,
+  0xd5, 0x1b, 0x18, 0x8d, 0xa9, 0xfb, 0x30, 0xec, 0x0f, 0x3e, 0xa3,
+  0x2a, 0xa8, 0xc5, 0xc4, 0x4f, 0x77, 0x33, 0x0c, 0xdf, 0x36, 0xa7,
+  0x4f, 0xa6, 0x9f, 0xbd, 0xe2, 0x22, 0xc0, 0xa7, 0x38, 0x9c, 0xfc,
+  0x96, 0x6b, 0xc1, 0x56, 0x7a, 0x4e, 0x55, 0x78, 0x76, 0xfb, 0x9c,
+  0x10, 0xd1, 0x8a, 0xa4, 0x84, 0xcc, 0xab, 0x00, 0x0b
+};
+
 static bool run_chacha_testcase (const struct chacha_testcase *);
+static bool run_chacha_long (void);
+static bool run_chacha_ietf (void);
+static bool run_xchacha20 (void);
+static bool run_chacha_random_access (void);
+static bool run_chacha_iov (void);
 static void hexdump (const uint8_t *, size_t);
 
 int
@@ -277,6 +341,32 @@ main (void)
         }
     }
 
+  if (!run_chacha_long ())
+    {
+      printf ("CHACHA long message test failed.\n");
+      rv = 1;
+    }
+  if (!run_chacha_ietf ())
+    {
+      printf ("CHACHA RFC 8439 test failed.\n");
+      rv = 1;
+    }
+  if (!run_xchacha20 ())
+    {
+      printf ("XChaCha20 test failed.\n");
+      rv = 1;
+    }
+  if (!run_chacha_random_access ())
+    {
+      printf ("CHACHA random access test failed.\n");
+      rv = 1;
+    }
+  if (!run_chacha_iov ())
+    {
+      printf ("CHACHA iovec test failed.\n");
+      rv = 1;
+    }
+
   return rv;
 }
 
@@ -326,3 +416,203 @@ hexdump (const uint8_t *data, size_t len)
     printf ("%02x", data[i]);
   printf ("\n");
 }
+
+/*
+ * Encrypts a long message at once, which uses the vector code, and the same
+ * message a block at a time, which does not. The counter starts just below
+ * 2^32 so that its carry into the high word falls inside a vector.
+ */
+static bool
+run_chacha_long (void)
+{
+  static const uint8_t counter[8] = { 0xfa, 0xff, 0xff, 0xff, 0, 0, 0, 0 };
+  struct chacha_ctx ctx;
+  uint8_t *input, *output, *expected;
+  size_t i, len;
+  bool ok;
+
+  len = 67 * 64 + 29;
+  input = malloc (len);
+  output = malloc (len);
+  expected = malloc (len);
+  if (input == NULL || output == NULL || expected == NULL)
+    {
+      free (input);
+      free (output);
+      free (expected);
+      return false;
+    }
+  for (i = 0; i < len; ++i)
+    input[i] = (uint8_t)(i * 7 + 3);
+
+  chacha_set_key (&ctx, testcases[14].key, 256);
+  chacha_set_iv (&ctx, testcases[14].iv, counter);
+  for (i = 0; i < len; i += 64)
+    chacha_encrypt_bytes (&ctx, input + i, expected + i,
+                          len - i < 64 ? len - i : 64);
+
+  chacha_set_key (&ctx, testcases[14].key, 256);
+  chacha_set_iv (&ctx, testcases[14].iv, counter);
+  chacha_encrypt_bytes (&ctx, input, output, len);
+  ok = memcmp (output, expected, len) == 0;
+
+  /* Encrypting in place must give the same result. */
+  chacha_set_key (&ctx, testcases[14].key, 256);
+  chacha_set_iv (&ctx, testcases[14].iv, counter);
+  chacha_encrypt_bytes (&ctx, input, input, len);
+  ok = ok && memcmp (input, expected, len) == 0;
+
+  free (input);
+  free (output);
+  free (expected);
+  return ok;
+}
+
+static bool
+run_chacha_ietf (void)
+{
+  struct chacha_ctx ctx;
+  uint8_t key[32], output[sizeof (ietf_ciphertext)];
+  size_t i;
+  bool ok;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)i;
+
+  chacha256_set_key (&ctx, key);
+  chacha_set_nonce (&ctx, ietf_nonce, 1);
+  chacha_encrypt_bytes (&ctx, ietf_plaintext, output, sizeof (output));
+  ok = memcmp (output, ietf_ciphertext, sizeof (output)) == 0;
+
+  /* Start from the second block by passing its counter. */
+  chacha_set_nonce (&ctx, ietf_nonce, 2);
+  chacha_encrypt_bytes (&ctx, ietf_plaintext + 64, output + 64,
+                        sizeof (output) - 64);
+  ok = ok && memcmp (output, ietf_ciphertext, sizeof (output)) == 0;
+
+  return ok;
+}
+
+static bool
+run_xchacha20 (void)
+{
+  struct xchacha20_ctx ctx;
+  uint8_t key[32], nonce[XCHACHA20_NONCE_SIZE], subkey[32];
+  uint8_t input[1100], output[1100], seeked[1100 - 640];
+  size_t i;
+  bool ok;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)i;
+  hchacha20 (subkey, key, hchacha20_nonce);
+  ok = memcmp (subkey, hchacha20_subkey, sizeof (subkey)) == 0;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(0x80 + i);
+  for (i = 0; i < sizeof (nonce); ++i)
+    nonce[i] = (uint8_t)(0x40 + i);
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 5 + 1);
+
+  xchacha20_set_key (&ctx, key);
+  xchacha20_set_nonce (&ctx, nonce, 0);
+  xchacha20_encrypt_bytes (&ctx, input, output, sizeof (output));
+  ok = ok && memcmp (output, xchacha20_head, 64) == 0
+       && memcmp (output + sizeof (output) - 64, xchacha20_tail, 64) == 0;
+
+  /* Seeking to block 10 gives the rest of the same keystream. */
+  xchacha20_set_nonce (&ctx, nonce, 0);
+  xchacha20_seek (&ctx, 10);
+  xchacha20_encrypt_bytes (&ctx, input + 640, seeked, sizeof (seeked));
+  ok = ok && memcmp (seeked, output + 640, sizeof (seeked)) == 0;
+
+  return ok;
+}
+
+static bool
+run_chacha_random_access (void)
+{
+  static const uint8_t counter[8] = { 0xf0, 0xff, 0xff, 0xff, 0, 0, 0, 0 };
+  static const size_t offsets[] = { 0, 1, 63, 64, 65, 100, 4096, 10000 };
+  struct chacha_ctx ctx;
+  uint8_t *input, *output, *expected;
+  size_t i, len;
+  bool ok;
+
+  len = 1024 * 1024 + 77;
+  input = malloc (len);
+  output = malloc (len);
+  expected = malloc (len);
+  if (input == NULL || output == NULL || expected == NULL)
+    {
+      free (input);
+      free (output);
+      free (expected);
+      return false;
+    }
+  for (i = 0; i < len; ++i)
+    input[i] = (uint8_t)(i * 11 + 5);
+
+  chacha_set_key (&ctx, testcases[14].key, 256);
+  chacha_set_iv (&ctx, testcases[14].iv, counter);
+  chacha_encrypt_bytes (&ctx, input, expected, len);
+
+  /* The context is left at its initial counter by both functions. */
+  chacha_set_iv (&ctx, testcases[14].iv, counter);
+  ok = true;
+  for (i = 0; i < sizeof (offsets) / sizeof (offsets[0]); ++i)
+    {
+      chacha_encrypt_at (&ctx, offsets[i], input + offsets[i], output, 1000);
+      ok = ok && memcmp (output, expected + offsets[i], 1000) == 0;
+    }
+
+  chacha_encrypt_parallel (&ctx, 37, input + 37, output, len - 37, 4);
+  ok = ok && memcmp (output, expected + 37, len - 37) == 0;
+
+  /* In place, across every thread count up to a few more than needed. */
+  for (i = 1; i <= 20; i += 3)
+    {
+      memcpy (output, input, len);
+      chacha_encrypt_parallel (&ctx, 0, output, output, len, i);
+      ok = ok && memcmp (output, expected, len) == 0;
+    }
+
+  free (input);
+  free (output);
+  free (expected);
+  return ok;
+}
+
+/*
+ * Encrypts a message split into pieces that start and end inside blocks,
+ * and compares with encrypting it in one call.
+ */
+static bool
+run_chacha_iov (void)
+{
+  static const size_t lens[] = { 0, 1, 63, 64, 65, 3, 200, 0, 7, 128, 500 };
+  struct chacha_ctx ctx, expect_ctx;
+  struct iovec iov[sizeof (lens) / sizeof (lens[0])];
+  uint8_t input[1100], output[1100], expected[1100];
+  size_t i, n;
+
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t)(i * 7 + 3);
+
+  chacha_set_key (&expect_ctx, testcases[14].key, 256);
+  chacha_set_iv (&expect_ctx, testcases[14].iv, NULL);
+  ctx = expect_ctx;
+  chacha_encrypt_bytes (&expect_ctx, input, expected, sizeof (input));
+
+  memcpy (output, input, sizeof (output));
+  for (i = n = 0; i < sizeof (lens) / sizeof (lens[0]); n += lens[i++])
+    {
+      iov[i].iov_base = output + n;
+      iov[i].iov_len = lens[i];
+    }
+  iov[i - 1].iov_len = sizeof (output) - (n - lens[i - 1]);
+  chacha_encryptv (&ctx, iov, i);
+
+  return memcmp (output, expected, sizeof (output)) == 0
+         && memcmp (&ctx, &expect_ctx, sizeof (ctx)) == 0;
+}
@@ -0,0 +1,275 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Tests for ChaCha20-Poly1305. The first case is from RFC 8439 section
+ * 2.8.2. The others use generated messages and associated data, checking
+ * the tag against a reference and the ciphertext against the ChaCha20
+ * keystream starting at block 1.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chacha.h"
+#include "chacha20poly1305.h"
+
+struct chacha20poly1305_testcase
+{
+  size_t len;
+  size_t ad_len;
+  uint8_t tag[CHACHA20POLY1305_DIGEST_SIZE];
+};
+
+static const uint8_t rfc_key[CHACHA20POLY1305_KEY_SIZE] = {
+  0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
+  0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95,
+  0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+
+static const uint8_t rfc_nonce[CHACHA20POLY1305_NONCE_SIZE] = {
+  0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47
+};
+
+static const uint8_t rfc_ad[12] = {
+  0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+  0xc7
+};
+
+static const uint8_t rfc_plaintext[]
+    = "Ladies and Gentlemen of the class of '99: If I could offer you only "
+      "one tip for the future, sunscreen would be it.";
+
+static const uint8_t rfc_ciphertext[114] = {
+  0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf,
+  0xbc, 0x53, 0xef, 0x7e, 0xc2, 0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e,
+  0x08, 0xfe, 0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6, 0x3d,
+  0xbe, 0xa4, 0x5e, 0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69,
+  0xda, 0x92, 0x72, 0x8b, 0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b,
+  0x29, 0x05, 0xd6, 0xa5, 0xb6, 0x7e, 0xcd, 0x3b, 0x36, 0x92, 0xdd,
+  0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c, 0x98, 0x03, 0xae, 0xe3, 0x28,
+  0x09, 0x1b, 0x58, 0xfa, 0xb3, 0x24, 0xe4, 0xfa, 0xd6, 0x75, 0x94,
+  0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc, 0x3f, 0xf4, 0xde,
+  0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65, 0x86, 0xce,
+  0xc6, 0x4b, 0x61, 0x16
+};
+
+static const uint8_t rfc_tag[CHACHA20POLY1305_DIGEST_SIZE] = {
+  0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a, 0x7e, 0x90, 0x2e,
+  0xcb, 0xd0, 0x60, 0x06, 0x91
+};
+
+static const uint8_t test_key[CHACHA20POLY1305_KEY_SIZE] = {
+  0x01, 0x08, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47,
+  0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94,
+  0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda
+};
+
+static const uint8_t test_nonce[CHACHA20POLY1305_NONCE_SIZE] = {
+  0x03, 0x08, 0x0d, 0x12, 0x17, 0x1c, 0x21, 0x26, 0x2b, 0x30, 0x35,
+  0x3a
+};
+
+/* The message byte i is i * 11 + 2 and the associated data byte i * 3 + 9. */
+static const struct chacha20poly1305_testcase testcases[] = {
+  { 0, 0, {
+    0x6e, 0xbd, 0x26, 0x78, 0xfe, 0x4e, 0xa0, 0x98, 0x95, 0x6b, 0xfc,
+    0xa2, 0x7a, 0x39, 0xe2, 0x72
+  } },
+  { 0, 17, {
+    0x83, 0xd2, 0x0b, 0x1d, 0x86, 0xa3, 0x63, 0x81, 0x6e, 0x97, 0x53,
+    0xaf, 0x59, 0xcc, 0xbc, 0xa8
+  } },
+  { 1, 0, {
+    0xa3, 0xc1, 0xc3, 0x89, 0x12, 0x2f, 0xa8, 0x9e, 0x0e, 0xd6, 0x5b,
+    0x0d, 0xcc, 0xcc, 0x8d, 0x09
+  } },
+  { 64, 12, {
+    0x64, 0xae, 0x06, 0x86, 0xb8, 0x4d, 0xa5, 0x77, 0x32, 0x21, 0xb9,
+    0x24, 0xd5, 0x1d, 0xb0, 0x7a
+  } },
+  { 65, 1, {
+    0x6a, 0xc0, 0xcb, 0x0d, 0xfd, 0x57, 0x83, 0x12, 0xe3, 0x7f, 0x4e,
+    0x60, 0x47, 0x10, 0x71, 0xb3
+  } },
+  { 1000, 16, {
+    0xce, 0x5d, 0x72, 0x7b, 0x53, 0xfb, 0xe8, 0x96, 0xa6, 0xe6, 0xd5,
+    0xae, 0xbb, 0x69, 0xde, 0xfc
+  } },
+  { 4096, 0, {
+    0x12, 0x5d, 0x76, 0xa9, 0xc0, 0xe4, 0x02, 0xc9, 0x0f, 0xa3, 0x12,
+    0xea, 0x51, 0x17, 0x5b, 0x40
+  } },
+  { 4097, 33, {
+    0x0b, 0xfc, 0xa4, 0xdd, 0x15, 0xa3, 0x21, 0xfd, 0x51, 0x26, 0x5a,
+    0xee, 0xf7, 0xa5, 0x64, 0xf6
+  } },
+  { 20000, 12, {
+    0xb4, 0x86, 0xe6, 0x51, 0x01, 0xe4, 0x7c, 0xca, 0x86, 0x79, 0xc9,
+    0x6d, 0x5e, 0x2c, 0xb3, 0x8e
+  } },
+};
+
+static bool run_rfc_testcase (void);
+static bool run_chacha20poly1305_testcase (
+    const struct chacha20poly1305_testcase *);
+static void hexdump (const uint8_t *, size_t);
+
+int
+main (void)
+{
+  size_t i;
+  int rv;
+
+  rv = 0;
+  if (!run_rfc_testcase ())
+    {
+      printf ("ChaCha20-Poly1305 RFC 8439 test failed.\n");
+      rv = 1;
+    }
+  for (i = 0; i < sizeof (testcases) / sizeof (testcases[0]); ++i)
+    {
+      if (!run_chacha20poly1305_testcase (&testcases[i]))
+        {
+          printf ("ChaCha20-Poly1305 test %zu failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  return rv;
+}
+
+static bool
+run_rfc_testcase (void)
+{
+  struct chacha20poly1305_ctx ctx;
+  uint8_t ciphertext[sizeof (rfc_ciphertext)];
+  uint8_t plaintext[sizeof (rfc_ciphertext)];
+  uint8_t tag[CHACHA20POLY1305_DIGEST_SIZE];
+  bool ok;
+
+  chacha20poly1305_set_key (&ctx, rfc_key);
+  chacha20poly1305_seal (&ctx, rfc_nonce, rfc_ad, sizeof (rfc_ad),
+                         rfc_plaintext, ciphertext, sizeof (ciphertext), tag);
+  hexdump (tag, sizeof (tag));
+  ok = memcmp (ciphertext, rfc_ciphertext, sizeof (ciphertext)) == 0
+       && memcmp (tag, rfc_tag, sizeof (tag)) == 0;
+
+  ok = ok
+       && chacha20poly1305_open (&ctx, rfc_nonce, rfc_ad, sizeof (rfc_ad),
+                                 rfc_ciphertext, plaintext,
+                                 sizeof (plaintext), rfc_tag)
+              == 0
+       && memcmp (plaintext, rfc_plaintext, sizeof (plaintext)) == 0;
+
+  /* A modified tag must be rejected and the output cleared. */
+  tag[0] ^= 1;
+  ok = ok
+       && chacha20poly1305_open (&ctx, rfc_nonce, rfc_ad, sizeof (rfc_ad),
+                                 rfc_ciphertext, plaintext,
+                                 sizeof (plaintext), tag)
+              == -1
+       && plaintext[0] == 0;
+
+  return ok;
+}
+
+static bool
+run_chacha20poly1305_testcase (const struct chacha20poly1305_testcase *test)
+{
+  struct chacha20poly1305_ctx ctx;
+  struct chacha_ctx stream;
+  uint8_t *input, *output, *expected, ad[64];
+  uint8_t tag[CHACHA20POLY1305_DIGEST_SIZE];
+  size_t i, n;
+  bool ok;
+
+  input = calloc (1, test->len + 1);
+  output = calloc (1, test->len + 1);
+  expected = calloc (1, test->len + 1);
+  if (input == NULL || output == NULL || expected == NULL)
+    {
+      free (input);
+      free (output);
+      free (expected);
+      return false;
+    }
+  for (i = 0; i < test->len; ++i)
+    input[i] = (uint8_t)(i * 11 + 2);
+  for (i = 0; i < test->ad_len; ++i)
+    ad[i] = (uint8_t)(i * 3 + 9);
+
+  chacha256_set_key (&stream, test_key);
+  chacha_set_nonce (&stream, test_nonce, 1);
+  chacha_encrypt_bytes (&stream, input, expected, test->len);
+
+  chacha20poly1305_set_key (&ctx, test_key);
+  chacha20poly1305_seal (&ctx, test_nonce, ad, test->ad_len, input, output,
+                         test->len, tag);
+  hexdump (tag, sizeof (tag));
+  ok = memcmp (output, expected, test->len) == 0
+       && memcmp (tag, test->tag, sizeof (tag)) == 0;
+
+  /* Stream the associated data in halves and the message 64 bytes at a
+     time, except for the last call. */
+  chacha20poly1305_set_nonce (&ctx, test_nonce);
+  chacha20poly1305_update (&ctx, ad, test->ad_len / 2);
+  chacha20poly1305_update (&ctx, ad + test->ad_len / 2,
+                           test->ad_len - test->ad_len / 2);
+  for (i = 0; i < test->len; i += n)
+    {
+      n = test->len - i > 64 ? 64 : test->len - i;
+      chacha20poly1305_encrypt (&ctx, input + i, output + i, n);
+    }
+  chacha20poly1305_digest (&ctx, tag);
+  ok = ok && memcmp (output, expected, test->len) == 0
+       && memcmp (tag, test->tag, sizeof (tag)) == 0;
+
+  /* Decrypt in place. */
+  ok = ok
+       && chacha20poly1305_open (&ctx, test_nonce, ad, test->ad_len, output,
+                                 output, test->len, test->tag)
+              == 0
+       && memcmp (output, input, test->len) == 0;
+
+  free (input);
+  free (output);
+  free (expected);
+  return ok;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "crc32.h"
 
@@ -75,11 +76,32 @@ static const uint32_t crc32_expect_table[256] = {
   0x0e845022, 0xb367940e, 0xf6052bbf, 0xd32f9ba0,
 };
 
+/*
+ * Bitwise CRC-32C without the initial and output XOR, the reference for the
+ * table and hardware code.
+ */
+static uint32_t
+crc32c_reference (uint32_t crc, const uint8_t *input, size_t len)
+{
+  size_t i;
+  int j;
+
+  for (i = 0; i < len; ++i)
+    {
+      crc ^= input[i];
+      for (j = 0; j < 8; ++j)
+        crc = (crc & 1) != 0 ? 0x82f63b78 ^ (crc >> 1) : crc >> 1;
+    }
+  return crc;
+}
+
 int
 main (void)
 {
-  size_t i;
+  size_t i, len;
   uint8_t buffer[256];
+  static uint8_t large[65536 + 4];
+  uint8_t *huge;
   uint32_t crc;
   int rv;
 
@@ -99,5 +121,140 @@ main (void)
         }
     }
 
+  /* The sliced versions against the bytewise one, at every alignment. */
+  for (i = 0; i < sizeof (buffer); ++i)
+    buffer[i] = (uint8_t)(i * 31 + 7);
+  for (i = 0; i < 16; ++i)
+    for (len = 0; len + i <= sizeof (buffer); len += 5)
+      {
+        crc = crc32_update_base (0x12345678, buffer + i, len);
+        if (crc32_update_slice8 (0x12345678, buffer + i, len) != crc
+            || crc32_update_slice16 (0x12345678, buffer + i, len) != crc)
+          {
+            printf ("Sliced CRC-32 failed at offset %zu, length %zu\n", i,
+                    len);
+            rv = 1;
+          }
+      }
+
+  /* The dispatched version against the bytewise one on longer inputs. */
+  for (i = 0; i < sizeof (large); ++i)
+    large[i] = (uint8_t)(i * 13 + (i >> 8));
+  for (i = 0; i < 4; ++i)
+    for (len = 0; len + i <= sizeof (large); len = len * 2 + 37)
+      {
+        crc = crc32_update_base (0xcafef00d ^ 0xffffffff, large + i, len)
+              ^ 0xffffffff;
+        if (crc32_update (0xcafef00d, large + i, len) != crc)
+          {
+            printf ("CRC-32 failed at offset %zu, length %zu\n", i, len);
+            rv = 1;
+          }
+        /* Split into two updates part way through. */
+        if (crc32_update (crc32_update (0xcafef00d, large + i, len / 3),
+                          large + i + len / 3, len - len / 3)
+            != crc)
+          {
+            printf ("Split CRC-32 failed at offset %zu, length %zu\n", i,
+                    len);
+            rv = 1;
+          }
+      }
+
+  /* Combining the CRC-32 of two parts gives that of the whole. */
+  for (len = 0; len <= sizeof (large); len = len * 3 + 1)
+    {
+      crc = crc32 (large, sizeof (large));
+      if (crc32_combine (crc32 (large, len), crc32 (large + len,
+                                                    sizeof (large) - len),
+                         sizeof (large) - len)
+          != crc)
+        {
+          printf ("CRC-32 combine failed at length %zu\n", len);
+          rv = 1;
+        }
+    }
+  if (crc32_combine (0, 0, 0) != 0 || crc32_combine (0x1234, 0, 0) != 0x1234)
+    {
+      printf ("CRC-32 combine of empty input failed\n");
+      rv = 1;
+    }
+
+  /* The check value and the examples from RFC 3720, Appendix B.4. */
+  for (i = 0; i < 32; ++i)
+    buffer[i] = 0;
+  if (crc32c ("123456789", 9) != 0xe3069283
+      || crc32c (buffer, 32) != 0x8a9136aa)
+    {
+      printf ("CRC-32C failed\n");
+      rv = 1;
+    }
+  for (i = 0; i < 32; ++i)
+    buffer[i] = 0xff;
+  if (crc32c (buffer, 32) != 0x62a8ab43)
+    {
+      printf ("CRC-32C failed\n");
+      rv = 1;
+    }
+  for (i = 0; i < 32; ++i)
+    buffer[i] = (uint8_t)i;
+  if (crc32c (buffer, 32) != 0x46dd794e)
+    {
+      printf ("CRC-32C failed\n");
+      rv = 1;
+    }
+
+  /*
+   * The dispatched CRC-32C against the bitwise one, with lengths that reach
+   * both sets of interleaved streams in the hardware code.
+   */
+  for (i = 0; i < 4; ++i)
+    for (len = 0; len + i <= sizeof (large); len = len * 2 + 37)
+      {
+        crc = crc32c_reference (0xcafef00d ^ 0xffffffff, large + i, len)
+              ^ 0xffffffff;
+        if (crc32c_update (0xcafef00d, large + i, len) != crc)
+          {
+            printf ("CRC-32C failed at offset %zu, length %zu\n", i, len);
+            rv = 1;
+          }
+        if (crc32c_update (crc32c_update (0xcafef00d, large + i, len / 3),
+                           large + i + len / 3, len - len / 3)
+            != crc)
+          {
+            printf ("Split CRC-32C failed at offset %zu, length %zu\n", i,
+                    len);
+            rv = 1;
+          }
+      }
+  for (len = 0; len <= sizeof (large); len = len * 3 + 1)
+    {
+      crc = crc32c (large, sizeof (large));
+      if (crc32c_combine (crc32c (large, len),
+                          crc32c (large + len, sizeof (large) - len),
+                          sizeof (large) - len)
+          != crc)
+        {
+          printf ("CRC-32C combine failed at length %zu\n", len);
+          rv = 1;
+        }
+    }
+
+  /* Large enough to be split across several threads. */
+  len = 1024 * 1024 + 3;
+  huge = malloc (len);
+  if (huge == NULL)
+    return 1;
+  for (i = 0; i < len; ++i)
+    huge[i] = (uint8_t)(i * 7 + (i >> 12));
+  crc = crc32 (huge, len);
+  for (i = 1; i <= 8; ++i)
+    if (crc32_parallel (huge, len, (unsigned int)i) != crc)
+      {
+        printf ("Parallel CRC-32 failed with %zu threads\n", i);
+        rv = 1;
+      }
+  free (huge);
+
   return rv;
 }
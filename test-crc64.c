@@ -0,0 +1,103 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "crc64.h"
+
+/* Bitwise CRC-64 with the initial and output XOR. */
+static uint64_t
+crc64_reference (uint64_t crc, const uint8_t *input, size_t len)
+{
+  size_t i;
+  int j;
+
+  crc = ~crc;
+  for (i = 0; i < len; ++i)
+    {
+      crc ^= input[i];
+      for (j = 0; j < 8; ++j)
+        crc = (crc & 1) != 0 ? UINT64_C (0xc96c5795d7870f42) ^ (crc >> 1)
+                             : crc >> 1;
+    }
+  return ~crc;
+}
+
+int
+main (void)
+{
+  static uint8_t large[65536 + 4];
+  size_t i, len;
+  uint64_t crc;
+  int rv;
+
+  rv = 0;
+
+  /* The check value of the CRC-64/XZ catalogue entry. */
+  crc = crc64 ("123456789", 9);
+  printf ("0x%016llx\n", (unsigned long long)crc);
+  if (crc != UINT64_C (0x995dc9bbdf1939fa) || crc64 (NULL, 0) != 0)
+    {
+      printf ("CRC-64 failed\n");
+      rv = 1;
+    }
+
+  for (i = 0; i < sizeof (large); ++i)
+    large[i] = (uint8_t)(i * 13 + (i >> 8));
+  for (i = 0; i < 8; ++i)
+    for (len = 0; len + i <= sizeof (large); len = len * 2 + 5)
+      {
+        crc = crc64_reference (0xcafef00d, large + i, len);
+        if (crc64_update (0xcafef00d, large + i, len) != crc)
+          {
+            printf ("CRC-64 failed at offset %zu, length %zu\n", i, len);
+            rv = 1;
+          }
+        if (crc64_update (crc64_update (0xcafef00d, large + i, len / 3),
+                          large + i + len / 3, len - len / 3)
+            != crc)
+          {
+            printf ("Split CRC-64 failed at offset %zu, length %zu\n", i,
+                    len);
+            rv = 1;
+          }
+      }
+
+  /* Combining the CRC-64 of two parts gives that of the whole. */
+  crc = crc64 (large, sizeof (large));
+  for (len = 0; len <= sizeof (large); len = len * 3 + 1)
+    if (crc64_combine (crc64 (large, len),
+                       crc64 (large + len, sizeof (large) - len),
+                       sizeof (large) - len)
+        != crc)
+      {
+        printf ("CRC-64 combine failed at length %zu\n", len);
+        rv = 1;
+      }
+
+  return rv;
+}
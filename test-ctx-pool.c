@@ -0,0 +1,285 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fcrypt_ctx_pool.h"
+#include "fcrypt_hash.h"
+
+#define CTX_COUNT 1000
+#define THREAD_COUNT 4
+#define THREAD_ROUNDS 300
+#define THREAD_CTX_COUNT 50
+
+static bool run_ctx_pool_layout_test (size_t, size_t);
+static bool run_ctx_pool_hash_test (void);
+static bool run_ctx_pool_thread_test (void);
+static bool run_ctx_pool_error_test (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!run_ctx_pool_layout_test (1, 1)
+      || !run_ctx_pool_layout_test (480, 16)
+      || !run_ctx_pool_layout_test (4224, 64)
+      || !run_ctx_pool_layout_test (70000, 256))
+    {
+      printf ("Context pool layout test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_ctx_pool_hash_test ())
+    {
+      printf ("Context pool hash test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_ctx_pool_thread_test ())
+    {
+      printf ("Context pool thread test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_ctx_pool_error_test ())
+    {
+      printf ("Context pool error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static bool
+is_zero (const uint8_t *ctx, size_t size)
+{
+  size_t i;
+
+  for (i = 0; i < size; ++i)
+    if (ctx[i] != 0)
+      return false;
+  return true;
+}
+
+/*
+ * Takes enough contexts to fill several slabs, checks that they are zero,
+ * aligned and don't overlap, and that contexts given back are cleared.
+ */
+static bool
+run_ctx_pool_layout_test (size_t size, size_t align)
+{
+  struct fcrypt_ctx_pool *pool;
+  uint8_t **ctx;
+  size_t i, count;
+  bool ok;
+
+  count = size > 10000 ? 10 : CTX_COUNT;
+  pool = fcrypt_ctx_pool_new (size, align);
+  ctx = calloc (count, sizeof (*ctx));
+  if (pool == NULL || ctx == NULL)
+    {
+      fcrypt_ctx_pool_free (pool);
+      free (ctx);
+      return false;
+    }
+
+  ok = true;
+  for (i = 0; i < count; ++i)
+    {
+      ctx[i] = fcrypt_ctx_pool_get (pool);
+      ok = ok && ctx[i] != NULL && (uintptr_t)ctx[i] % align == 0
+           && (uintptr_t)ctx[i] % 64 == 0 && is_zero (ctx[i], size);
+      if (ctx[i] != NULL)
+        memset (ctx[i], (int)(i % 255 + 1), size);
+    }
+  for (i = 0; ok && i < count; ++i)
+    ok = memchr (ctx[i], (int)(i % 255 + 1), size) == ctx[i]
+         && ctx[i][size - 1] == (uint8_t)(i % 255 + 1);
+
+  /* Give back every other one, then take them again. */
+  for (i = 0; i < count; i += 2)
+    fcrypt_ctx_pool_put (pool, ctx[i]);
+  for (i = 0; ok && i < count; i += 2)
+    {
+      ctx[i] = fcrypt_ctx_pool_get (pool);
+      ok = ctx[i] != NULL && is_zero (ctx[i], size);
+    }
+  for (i = 1; ok && i < count; i += 2)
+    ok = ctx[i][0] == (uint8_t)(i % 255 + 1);
+
+  fcrypt_ctx_pool_free (pool);
+  free (ctx);
+  return ok;
+}
+
+/* Hashes with contexts from a pool sized by the hash table. */
+static bool
+run_ctx_pool_hash_test (void)
+{
+  static const uint8_t message[] = "abc";
+  const struct fcrypt_hash *hash;
+  uint8_t expect[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  struct fcrypt_ctx_pool *pool;
+  void *ctx;
+  size_t i;
+  bool ok;
+
+  ok = true;
+  for (i = 0; ok && (hash = fcrypt_hash_get (i)) != NULL; ++i)
+    {
+      pool = fcrypt_ctx_pool_new (hash->ctx_size, hash->ctx_align);
+      ctx = pool != NULL ? fcrypt_ctx_pool_get (pool) : NULL;
+      if (ctx == NULL)
+        {
+          fcrypt_ctx_pool_free (pool);
+          return false;
+        }
+      hash->digest (expect, message, sizeof (message) - 1);
+      hash->init (ctx);
+      hash->update (ctx, message, sizeof (message) - 1);
+      hash->final (digest, ctx);
+      ok = memcmp (digest, expect, hash->digest_size) == 0
+           && (uintptr_t)ctx % hash->ctx_align == 0;
+      fcrypt_ctx_pool_put (pool, ctx);
+      fcrypt_ctx_pool_free (pool);
+    }
+  return ok;
+}
+
+struct thread_arg
+{
+  struct fcrypt_ctx_pool *pool;
+  uint8_t id;
+  uint8_t *given[THREAD_CTX_COUNT]; /* Taken by main, put by the thread */
+  bool ok;
+};
+
+/*
+ * Takes contexts, marks them with the thread's id and checks that no other
+ * thread wrote to them before giving them back.
+ */
+static void *
+thread_main (void *varg)
+{
+  struct thread_arg *arg = varg;
+  uint8_t *ctx[THREAD_CTX_COUNT];
+  size_t i, j;
+
+  for (i = 0; i < THREAD_CTX_COUNT; ++i)
+    fcrypt_ctx_pool_put (arg->pool, arg->given[i]);
+  for (i = 0; i < THREAD_ROUNDS; ++i)
+    {
+      for (j = 0; j < THREAD_CTX_COUNT; ++j)
+        {
+          ctx[j] = fcrypt_ctx_pool_get (arg->pool);
+          if (ctx[j] == NULL || !is_zero (ctx[j], 100))
+            {
+              arg->ok = false;
+              return NULL;
+            }
+          memset (ctx[j], arg->id, 100);
+        }
+      for (j = 0; j < THREAD_CTX_COUNT; ++j)
+        {
+          if (memchr (ctx[j], arg->id, 100) != ctx[j] || ctx[j][99] != arg->id)
+            arg->ok = false;
+          fcrypt_ctx_pool_put (arg->pool, ctx[j]);
+        }
+    }
+  return NULL;
+}
+
+static bool
+run_ctx_pool_thread_test (void)
+{
+  static struct thread_arg args[THREAD_COUNT];
+  pthread_t threads[THREAD_COUNT];
+  struct fcrypt_ctx_pool *pool;
+  size_t i, j, started;
+  bool ok;
+
+  pool = fcrypt_ctx_pool_new (100, 8);
+  if (pool == NULL)
+    return false;
+
+  ok = true;
+  for (i = 0; i < THREAD_COUNT; ++i)
+    {
+      args[i].pool = pool;
+      args[i].id = (uint8_t)(i + 1);
+      args[i].ok = true;
+      for (j = 0; j < THREAD_CTX_COUNT; ++j)
+        {
+          args[i].given[j] = fcrypt_ctx_pool_get (pool);
+          ok = ok && args[i].given[j] != NULL;
+        }
+    }
+  if (!ok)
+    {
+      fcrypt_ctx_pool_free (pool);
+      return false;
+    }
+
+  for (started = 0; started < THREAD_COUNT; ++started)
+    if (pthread_create (&threads[started], NULL, thread_main, &args[started])
+        != 0)
+      {
+        ok = false;
+        break;
+      }
+  for (i = 0; i < started; ++i)
+    {
+      pthread_join (threads[i], NULL);
+      ok = ok && args[i].ok;
+    }
+
+  fcrypt_ctx_pool_free (pool);
+  return ok;
+}
+
+static bool
+run_ctx_pool_error_test (void)
+{
+  errno = 0;
+  if (fcrypt_ctx_pool_new (0, 8) != NULL || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_ctx_pool_new (64, 24) != NULL || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_ctx_pool_new (64, 0) != NULL || errno != EINVAL)
+    return false;
+  return true;
+}
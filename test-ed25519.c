@@ -0,0 +1,297 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Tests for Ed25519. The vectors are the first three of RFC 8032 section
+ * 7.1. Altered signatures, messages and keys must be rejected, as must an
+ * S that is not reduced, and batch verification must agree with single
+ * verification and find the invalid signatures in a group.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ed25519.h"
+
+#define BATCH_COUNT 150
+#define BATCH_MSG_SIZE 100
+
+struct ed25519_testcase
+{
+  uint8_t seed[ED25519_SEED_SIZE];
+  uint8_t public_key[ED25519_PUBLIC_KEY_SIZE];
+  const uint8_t *msg;
+  size_t len;
+  uint8_t signature[ED25519_SIGNATURE_SIZE];
+};
+
+static const uint8_t ed25519_msg_1[1] = { 0x72 };
+
+static const uint8_t ed25519_msg_2[2] = { 0xaf, 0x82 };
+
+static const struct ed25519_testcase testcases[] = {
+  { {
+      0x9d, 0x61, 0xb1, 0x9d, 0xef, 0xfd, 0x5a, 0x60, 0xba, 0x84, 0x4a,
+      0xf4, 0x92, 0xec, 0x2c, 0xc4, 0x44, 0x49, 0xc5, 0x69, 0x7b, 0x32,
+      0x69, 0x19, 0x70, 0x3b, 0xac, 0x03, 0x1c, 0xae, 0x7f, 0x60
+    },
+    {
+      0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7, 0xd5, 0x4b, 0xfe,
+      0xd3, 0xc9, 0x64, 0x07, 0x3a, 0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6,
+      0x23, 0x25, 0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a
+    },
+    NULL,
+    0,
+    {
+      0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72, 0x90, 0x86, 0xe2,
+      0xcc, 0x80, 0x6e, 0x82, 0x8a, 0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5,
+      0xd9, 0x74, 0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55, 0x5f,
+      0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac, 0xc6, 0x1e, 0x39, 0x70,
+      0x1c, 0xf9, 0xb4, 0x6b, 0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe,
+      0x24, 0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b
+    } },
+  { {
+      0x4c, 0xcd, 0x08, 0x9b, 0x28, 0xff, 0x96, 0xda, 0x9d, 0xb6, 0xc3,
+      0x46, 0xec, 0x11, 0x4e, 0x0f, 0x5b, 0x8a, 0x31, 0x9f, 0x35, 0xab,
+      0xa6, 0x24, 0xda, 0x8c, 0xf6, 0xed, 0x4f, 0xb8, 0xa6, 0xfb
+    },
+    {
+      0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a, 0x92, 0xb7, 0x0a,
+      0xa7, 0x4d, 0x1b, 0x7e, 0xbc, 0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4,
+      0x96, 0x8c, 0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c
+    },
+    ed25519_msg_1,
+    1,
+    {
+      0x92, 0xa0, 0x09, 0xa9, 0xf0, 0xd4, 0xca, 0xb8, 0x72, 0x0e, 0x82,
+      0x0b, 0x5f, 0x64, 0x25, 0x40, 0xa2, 0xb2, 0x7b, 0x54, 0x16, 0x50,
+      0x3f, 0x8f, 0xb3, 0x76, 0x22, 0x23, 0xeb, 0xdb, 0x69, 0xda, 0x08,
+      0x5a, 0xc1, 0xe4, 0x3e, 0x15, 0x99, 0x6e, 0x45, 0x8f, 0x36, 0x13,
+      0xd0, 0xf1, 0x1d, 0x8c, 0x38, 0x7b, 0x2e, 0xae, 0xb4, 0x30, 0x2a,
+      0xee, 0xb0, 0x0d, 0x29, 0x16, 0x12, 0xbb, 0x0c, 0x00
+    } },
+  { {
+      0xc5, 0xaa, 0x8d, 0xf4, 0x3f, 0x9f, 0x83, 0x7b, 0xed, 0xb7, 0x44,
+      0x2f, 0x31, 0xdc, 0xb7, 0xb1, 0x66, 0xd3, 0x85, 0x35, 0x07, 0x6f,
+      0x09, 0x4b, 0x85, 0xce, 0x3a, 0x2e, 0x0b, 0x44, 0x58, 0xf7
+    },
+    {
+      0xfc, 0x51, 0xcd, 0x8e, 0x62, 0x18, 0xa1, 0xa3, 0x8d, 0xa4, 0x7e,
+      0xd0, 0x02, 0x30, 0xf0, 0x58, 0x08, 0x16, 0xed, 0x13, 0xba, 0x33,
+      0x03, 0xac, 0x5d, 0xeb, 0x91, 0x15, 0x48, 0x90, 0x80, 0x25
+    },
+    ed25519_msg_2,
+    2,
+    {
+      0x62, 0x91, 0xd6, 0x57, 0xde, 0xec, 0x24, 0x02, 0x48, 0x27, 0xe6,
+      0x9c, 0x3a, 0xbe, 0x01, 0xa3, 0x0c, 0xe5, 0x48, 0xa2, 0x84, 0x74,
+      0x3a, 0x44, 0x5e, 0x36, 0x80, 0xd7, 0xdb, 0x5a, 0xc3, 0xac, 0x18,
+      0xff, 0x9b, 0x53, 0x8d, 0x16, 0xf2, 0x90, 0xae, 0x67, 0xf7, 0x60,
+      0x98, 0x4d, 0xc6, 0x59, 0x4a, 0x7c, 0x15, 0xe9, 0x71, 0x6e, 0xd2,
+      0x8d, 0xc0, 0x27, 0xbe, 0xce, 0xea, 0x1e, 0xc4, 0x0a
+    } }
+};
+
+static uint8_t batch_seeds[BATCH_COUNT][ED25519_SEED_SIZE];
+static uint8_t batch_keys[BATCH_COUNT][ED25519_PUBLIC_KEY_SIZE];
+static uint8_t batch_sigs[BATCH_COUNT][ED25519_SIGNATURE_SIZE];
+static uint8_t batch_msgs[BATCH_COUNT][BATCH_MSG_SIZE];
+
+static bool run_ed25519_vector_test (void);
+static bool run_ed25519_reject_test (void);
+static bool run_ed25519_batch_test (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!run_ed25519_vector_test ())
+    {
+      printf ("Ed25519 vector test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_ed25519_reject_test ())
+    {
+      printf ("Ed25519 reject test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_ed25519_batch_test ())
+    {
+      printf ("Ed25519 batch test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static bool
+run_ed25519_vector_test (void)
+{
+  uint8_t public_key[ED25519_PUBLIC_KEY_SIZE];
+  uint8_t signature[ED25519_SIGNATURE_SIZE];
+  const struct ed25519_testcase *tc;
+  size_t i;
+
+  for (i = 0; i < sizeof (testcases) / sizeof (testcases[0]); ++i)
+    {
+      tc = &testcases[i];
+      ed25519_public_key (public_key, tc->seed);
+      if (memcmp (public_key, tc->public_key, sizeof (public_key)) != 0)
+        return false;
+      ed25519_sign (signature, tc->seed, tc->public_key, tc->msg, tc->len);
+      if (memcmp (signature, tc->signature, sizeof (signature)) != 0)
+        return false;
+      if (ed25519_verify (tc->signature, tc->public_key, tc->msg, tc->len)
+          != 0)
+        return false;
+    }
+  return true;
+}
+
+static bool
+run_ed25519_reject_test (void)
+{
+  static const uint8_t order[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7,
+    0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+  };
+  const struct ed25519_testcase *tc = &testcases[2];
+  uint8_t public_key[ED25519_PUBLIC_KEY_SIZE];
+  uint8_t signature[ED25519_SIGNATURE_SIZE];
+  uint8_t msg[2];
+  unsigned int carry;
+  size_t i;
+
+  /* Every bit of the signature matters. */
+  for (i = 0; i < 8 * sizeof (signature); i += 7)
+    {
+      memcpy (signature, tc->signature, sizeof (signature));
+      signature[i / 8] ^= (uint8_t)(1 << (i % 8));
+      if (ed25519_verify (signature, tc->public_key, tc->msg, tc->len) != -1)
+        return false;
+    }
+
+  memcpy (msg, tc->msg, sizeof (msg));
+  msg[1] ^= 1;
+  if (ed25519_verify (tc->signature, tc->public_key, msg, sizeof (msg)) != -1
+      || ed25519_verify (tc->signature, tc->public_key, msg, 1) != -1)
+    return false;
+
+  memcpy (public_key, tc->public_key, sizeof (public_key));
+  public_key[0] ^= 4;
+  if (ed25519_verify (tc->signature, public_key, tc->msg, tc->len) != -1)
+    return false;
+
+  /* S + L is the same scalar but must not be accepted. */
+  memcpy (signature, tc->signature, sizeof (signature));
+  carry = 0;
+  for (i = 0; i < 32; ++i)
+    {
+      carry += (unsigned int)signature[32 + i] + order[i];
+      signature[32 + i] = (uint8_t)carry;
+      carry >>= 8;
+    }
+  return ed25519_verify (signature, tc->public_key, tc->msg, tc->len) == -1;
+}
+
+static bool
+check_batch (const int *expect, size_t first, size_t count)
+{
+  const uint8_t *sigs[BATCH_COUNT] = { NULL };
+  const uint8_t *keys[BATCH_COUNT] = { NULL };
+  const uint8_t *msgs[BATCH_COUNT] = { NULL };
+  size_t lens[BATCH_COUNT] = { 0 };
+  int valid[BATCH_COUNT];
+  bool all;
+  size_t i;
+
+  all = true;
+  for (i = 0; i < count; ++i)
+    {
+      sigs[i] = batch_sigs[first + i];
+      keys[i] = batch_keys[first + i];
+      msgs[i] = batch_msgs[first + i];
+      lens[i] = (first + i) % BATCH_MSG_SIZE;
+      valid[i] = -1;
+      if (!expect[first + i])
+        all = false;
+      if (ed25519_verify (sigs[i], keys[i], msgs[i], lens[i])
+          != (expect[first + i] ? 0 : -1))
+        return false;
+    }
+  if (ed25519_verify_batch (valid, sigs, keys, msgs, lens, count)
+      != (all ? 0 : -1))
+    return false;
+  for (i = 0; i < count; ++i)
+    if (valid[i] != expect[first + i])
+      return false;
+  return ed25519_verify_batch (NULL, sigs, keys, msgs, lens, count)
+         == (all ? 0 : -1);
+}
+
+static bool
+run_ed25519_batch_test (void)
+{
+  int expect[BATCH_COUNT];
+  size_t i, j;
+
+  for (i = 0; i < BATCH_COUNT; ++i)
+    {
+      for (j = 0; j < ED25519_SEED_SIZE; ++j)
+        batch_seeds[i][j] = (uint8_t)(i * 29 + j * 7 + 1);
+      for (j = 0; j < BATCH_MSG_SIZE; ++j)
+        batch_msgs[i][j] = (uint8_t)(i + j * 13);
+      ed25519_public_key (batch_keys[i], batch_seeds[i]);
+      ed25519_sign (batch_sigs[i], batch_seeds[i], batch_keys[i],
+                    batch_msgs[i], i % BATCH_MSG_SIZE);
+      expect[i] = 1;
+    }
+
+  if (!check_batch (expect, 0, 0) || !check_batch (expect, 0, 1)
+      || !check_batch (expect, 3, 2) || !check_batch (expect, 0, BATCH_COUNT))
+    return false;
+
+  /* Break a few signatures in different ways, spread over the groups. */
+  batch_sigs[5][40] ^= 1;
+  expect[5] = 0;
+  batch_sigs[70][0] ^= 2;
+  expect[70] = 0;
+  batch_msgs[71][0] ^= 1;
+  expect[71] = 0;
+  memcpy (batch_keys[140], batch_keys[141], ED25519_PUBLIC_KEY_SIZE);
+  expect[140] = 0;
+  batch_sigs[149][63] |= 0xf0;
+  expect[149] = 0;
+
+  return check_batch (expect, 0, BATCH_COUNT) && check_batch (expect, 4, 2)
+         && check_batch (expect, 60, 20) && check_batch (expect, 149, 1);
+}
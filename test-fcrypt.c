@@ -0,0 +1,515 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include "fcrypt_align.h"
+#include "fcrypt_cipher.h"
+#include "fcrypt_hash.h"
+
+struct hash_testcase
+{
+  const char *name;
+  const char *digest; /* Digest of "abc" */
+};
+
+static const struct hash_testcase hash_testcases[] = {
+  { "md5", "\x90\x01\x50\x98\x3c\xd2\x4f\xb0\xd6\x96\x3f\x7d\x28\xe1\x7f"
+           "\x72" },
+  { "sha256",
+    "\xba\x78\x16\xbf\x8f\x01\xcf\xea\x41\x41\x40\xde\x5d\xae\x22\x23"
+    "\xb0\x03\x61\xa3\x96\x17\x7a\x9c\xb4\x10\xff\x61\xf2\x00\x15\xad" },
+  { "sha3-256",
+    "\x3a\x98\x5d\xa7\x4f\xe2\x25\xb2\x04\x5c\x17\x2d\x6b\xd3\x90\xbd"
+    "\x85\x5f\x08\x6e\x3e\x9d\x52\x5b\x46\xbf\xe2\x45\x11\x43\x15\x32" },
+};
+
+/* FIPS 197 appendix C.1. */
+static const uint8_t aes128_key[16]
+    = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+static const uint8_t aes128_plaintext[16]
+    = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+static const uint8_t aes128_ciphertext[16]
+    = { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+        0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a };
+
+static void *ctx_alloc (size_t, size_t);
+static bool run_hash_testcase (const struct hash_testcase *);
+static bool run_hash_test (const struct fcrypt_hash *);
+static bool run_hash_state_test (const struct fcrypt_hash *);
+static bool run_cipher_test (const struct fcrypt_cipher *);
+static bool run_cipher_encrypt_key_test (const struct fcrypt_cipher *);
+static bool run_aes128_test (void);
+static bool run_hash_file_test (size_t, long);
+
+int
+main (void)
+{
+  const struct fcrypt_hash *hash;
+  const struct fcrypt_cipher *cipher;
+  size_t i;
+  int rv;
+
+  rv = 0;
+  for (i = 0; i < (sizeof (hash_testcases) / sizeof (hash_testcases[0])); ++i)
+    {
+      if (!run_hash_testcase (&hash_testcases[i]))
+        {
+          printf ("Hash test %s failed.\n", hash_testcases[i].name);
+          rv = 1;
+        }
+    }
+
+  for (i = 0; (hash = fcrypt_hash_get (i)) != NULL; ++i)
+    {
+      if (!run_hash_test (hash))
+        {
+          printf ("Hash %s failed.\n", hash->name);
+          rv = 1;
+        }
+      if (!run_hash_state_test (hash))
+        {
+          printf ("Hash %s state export failed.\n", hash->name);
+          rv = 1;
+        }
+    }
+
+  /* Read in the reading thread, then mapped, then mapped from an offset. */
+  if (!run_hash_file_test (1000000, 0) || !run_hash_file_test (5000000, 0)
+      || !run_hash_file_test (5000000, 12345))
+    {
+      printf ("File hashing test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_aes128_test ())
+    {
+      printf ("AES-128 cipher test failed.\n");
+      rv = 1;
+    }
+
+  for (i = 0; (cipher = fcrypt_cipher_get (i)) != NULL; ++i)
+    {
+      if (!run_cipher_test (cipher) || !run_cipher_encrypt_key_test (cipher))
+        {
+          printf ("Cipher %s failed.\n", cipher->name);
+          rv = 1;
+        }
+    }
+
+#if defined(__GNUC__)
+  if (fcrypt_hash_blake2b.ctx_align != FCRYPT_CACHE_LINE_SIZE
+      || fcrypt_hash_blake2s.ctx_align != FCRYPT_CACHE_LINE_SIZE
+      || fcrypt_cipher_lookup ("blowfish")->ctx_align
+             != FCRYPT_CACHE_LINE_SIZE)
+    {
+      printf ("Context alignment test failed.\n");
+      rv = 1;
+    }
+#endif
+
+  if (fcrypt_hash_lookup ("sha0") != NULL
+      || fcrypt_cipher_lookup ("des") != NULL)
+    {
+      printf ("Lookup of unknown names failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+/*
+ * Allocates a context with the alignment given by the table, as malloc only
+ * guarantees the alignment of the basic types.
+ */
+static void *
+ctx_alloc (size_t size, size_t align)
+{
+  void *ctx;
+
+  if (align < sizeof (void *))
+    align = sizeof (void *);
+  if (posix_memalign (&ctx, align, size) != 0)
+    return NULL;
+  return ctx;
+}
+
+static bool
+run_hash_testcase (const struct hash_testcase *test)
+{
+  const struct fcrypt_hash *hash;
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+
+  hash = fcrypt_hash_lookup (test->name);
+  if (hash == NULL)
+    return false;
+  hash->digest (digest, "abc", 3);
+  return memcmp (digest, test->digest, hash->digest_size) == 0;
+}
+
+/*
+ * Checks that the one-shot function agrees with feeding the message in
+ * uneven pieces, directly and as an iovec array, and that the hash can be
+ * found by its name.
+ */
+static bool
+run_hash_test (const struct fcrypt_hash *hash)
+{
+  static uint8_t data[777];
+  uint8_t expect[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  struct iovec iov[32];
+  void *ctx;
+  size_t i, n, step;
+  bool ok;
+
+  if (fcrypt_hash_lookup (hash->name) != hash
+      || hash->digest_size > FCRYPT_HASH_MAX_DIGEST_SIZE
+      || hash->block_size > FCRYPT_HASH_MAX_BLOCK_SIZE
+      || (hash->ctx_align & (hash->ctx_align - 1)) != 0
+      || hash->ctx_size % hash->ctx_align != 0)
+    return false;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 29 + 5);
+
+  ctx = ctx_alloc (hash->ctx_size, hash->ctx_align);
+  if (ctx == NULL)
+    return false;
+
+  hash->digest (expect, data, sizeof (data));
+  hash->init (ctx);
+  for (i = 0; i < sizeof (data); i += step)
+    {
+      step = i % 97 + 1;
+      if (step > sizeof (data) - i)
+        step = sizeof (data) - i;
+      hash->update (ctx, data + i, step);
+    }
+  hash->final (digest, ctx);
+  ok = memcmp (digest, expect, hash->digest_size) == 0;
+
+  /* Pieces of 0, 1, 2, ... bytes, with the rest in the last one. */
+  for (i = n = 0; n < sizeof (iov) / sizeof (iov[0]) - 1; ++n, i += step)
+    {
+      step = n;
+      iov[n].iov_base = data + i;
+      iov[n].iov_len = step;
+    }
+  iov[n].iov_base = data + i;
+  iov[n].iov_len = sizeof (data) - i;
+  hash->init (ctx);
+  fcrypt_hash_updatev (hash, ctx, iov, n + 1);
+  hash->final (digest, ctx);
+  ok = ok && memcmp (digest, expect, hash->digest_size) == 0;
+
+  /* The same message twice through one context. */
+  hash->init (ctx);
+  hash->update (ctx, data, sizeof (data));
+  fcrypt_hash_final_reset (hash, digest, ctx);
+  ok = ok && memcmp (digest, expect, hash->digest_size) == 0;
+  hash->update (ctx, data, sizeof (data));
+  hash->final (digest, ctx);
+  ok = ok && memcmp (digest, expect, hash->digest_size) == 0;
+
+  free (ctx);
+  return ok;
+}
+
+/*
+ * Hashes a prefix of the message, then finishes it from a copy of the
+ * context and from a context exported and imported again. Also checks that
+ * damaged states are refused.
+ */
+static bool
+run_hash_state_test (const struct fcrypt_hash *hash)
+{
+  static const size_t splits[] = { 0, 1, 63, 64, 65, 1500, 4097 };
+  static uint8_t data[5000];
+  uint8_t expect[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t state[FCRYPT_HASH_MAX_STATE_SIZE + 1];
+  const struct fcrypt_hash *other;
+  void *ctx, *copy;
+  size_t i, n;
+  bool ok;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 23 + 9);
+  other = hash == &fcrypt_hash_sha256 ? &fcrypt_hash_sha224
+                                      : &fcrypt_hash_sha256;
+
+  ctx = ctx_alloc (hash->ctx_size, hash->ctx_align);
+  copy = ctx_alloc (
+      hash->ctx_size > other->ctx_size ? hash->ctx_size : other->ctx_size,
+      hash->ctx_align > other->ctx_align ? hash->ctx_align : other->ctx_align);
+  if (ctx == NULL || copy == NULL)
+    {
+      free (ctx);
+      free (copy);
+      return false;
+    }
+
+  hash->digest (expect, data, sizeof (data));
+  ok = true;
+  for (i = 0; i < sizeof (splits) / sizeof (splits[0]); ++i)
+    {
+      hash->init (ctx);
+      hash->update (ctx, data, splits[i]);
+      n = fcrypt_hash_export (hash, ctx, state);
+      ok = ok && n > 0 && n <= FCRYPT_HASH_MAX_STATE_SIZE;
+
+      fcrypt_hash_copy (hash, copy, ctx);
+      hash->update (copy, data + splits[i], sizeof (data) - splits[i]);
+      hash->final (digest, copy);
+      ok = ok && memcmp (digest, expect, hash->digest_size) == 0;
+
+      ok = ok && fcrypt_hash_import (hash, copy, state, n) == 0;
+      hash->update (copy, data + splits[i], sizeof (data) - splits[i]);
+      hash->final (digest, copy);
+      ok = ok && memcmp (digest, expect, hash->digest_size) == 0;
+
+      /* Short, long, or for another hash. */
+      ok = ok && fcrypt_hash_import (hash, copy, state, n - 1) == -1;
+      state[n] = 0;
+      ok = ok && fcrypt_hash_import (hash, copy, state, n + 1) == -1;
+      ok = ok && fcrypt_hash_import (other, copy, state, n) == -1;
+      hash->final (digest, ctx);
+    }
+
+  free (ctx);
+  free (copy);
+  return ok;
+}
+
+/*
+ * Hashes a temporary file from the given offset and compares with hashing
+ * the same bytes in memory.
+ */
+static bool
+run_hash_file_test (size_t len, long offset)
+{
+  const struct fcrypt_hash *hash;
+  uint8_t expect[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t *data;
+  FILE *fp;
+  size_t i;
+  bool ok;
+
+  hash = &fcrypt_hash_sha256;
+  data = malloc (len);
+  if (data == NULL)
+    return false;
+  for (i = 0; i < len; ++i)
+    data[i] = (uint8_t)(i * 17 + (i >> 13));
+
+  fp = tmpfile ();
+  ok = fp != NULL && fwrite (data, 1, len, fp) == len && fflush (fp) == 0
+       && fseek (fp, offset, SEEK_SET) == 0;
+  if (ok)
+    {
+      hash->digest (expect, data + offset, len - (size_t)offset);
+      ok = fcrypt_hash_fd (hash, fileno (fp), digest) == 0
+           && memcmp (digest, expect, hash->digest_size) == 0;
+    }
+
+  if (fp != NULL)
+    fclose (fp);
+  free (data);
+  return ok;
+}
+
+static bool
+run_aes128_test (void)
+{
+  const struct fcrypt_cipher *cipher;
+  uint8_t output[16];
+  void *ctx;
+  bool ok;
+
+  cipher = fcrypt_cipher_lookup ("aes128");
+  if (cipher == NULL)
+    return false;
+  ctx = ctx_alloc (cipher->ctx_size, cipher->ctx_align);
+  if (ctx == NULL)
+    return false;
+
+  cipher->set_key (ctx, aes128_key);
+  cipher->ecb_encrypt (ctx, aes128_plaintext, output, sizeof (output));
+  ok = memcmp (output, aes128_ciphertext, sizeof (output)) == 0;
+  cipher->ecb_decrypt (ctx, output, output, sizeof (output));
+  ok = ok && memcmp (output, aes128_plaintext, sizeof (output)) == 0;
+
+  free (ctx);
+  return ok;
+}
+
+/*
+ * Round trips a message through each mode of the cipher, and checks that
+ * none of them writes to the context, which may be shared between threads.
+ */
+static bool
+run_cipher_test (const struct fcrypt_cipher *cipher)
+{
+  uint8_t key[FCRYPT_CIPHER_MAX_KEY_SIZE];
+  uint8_t iv[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+  uint8_t data[256], output[256], back[256];
+  void *ctx, *keyed;
+  size_t i, len;
+  bool ok;
+
+  if (fcrypt_cipher_lookup (cipher->name) != cipher
+      || cipher->key_size > FCRYPT_CIPHER_MAX_KEY_SIZE
+      || cipher->block_size > FCRYPT_CIPHER_MAX_BLOCK_SIZE)
+    return false;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 3 + 1);
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 11 + 7);
+
+  ctx = ctx_alloc (cipher->ctx_size, cipher->ctx_align);
+  keyed = malloc (cipher->ctx_size);
+  if (ctx == NULL || keyed == NULL)
+    {
+      free (ctx);
+      free (keyed);
+      return false;
+    }
+  cipher->set_key (ctx, key);
+  memcpy (keyed, ctx, cipher->ctx_size);
+  len = sizeof (data);
+
+  cipher->ecb_encrypt (ctx, data, output, len);
+  cipher->ecb_decrypt (ctx, output, back, len);
+  ok = memcmp (output, data, len) != 0 && memcmp (back, data, len) == 0;
+
+  if (cipher->cbc_encrypt != NULL)
+    {
+      memset (iv, 0xa5, sizeof (iv));
+      cipher->cbc_encrypt (ctx, iv, data, output, len);
+      memset (iv, 0xa5, sizeof (iv));
+      cipher->cbc_decrypt (ctx, iv, output, back, len);
+      ok = ok && memcmp (back, data, len) == 0;
+    }
+
+  /* An odd length to cover the partial last block. */
+  memset (iv, 0, sizeof (iv));
+  cipher->ctr_crypt (ctx, iv, data, output, len - 3);
+  memset (iv, 0, sizeof (iv));
+  cipher->ctr_crypt (ctx, iv, output, back, len - 3);
+  ok = ok && memcmp (back, data, len - 3) == 0;
+  ok = ok && memcmp (ctx, keyed, cipher->ctx_size) == 0;
+
+  free (ctx);
+  free (keyed);
+  return ok;
+}
+
+/*
+ * Checks that the encryption functions give the same output with the keys
+ * of set_encrypt_key and set_encrypt_key_batch as with those of set_key.
+ */
+static bool
+run_cipher_encrypt_key_test (const struct fcrypt_cipher *cipher)
+{
+  const uint8_t *keys[3];
+  uint8_t key[FCRYPT_CIPHER_MAX_KEY_SIZE + 2];
+  uint8_t iv[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+  uint8_t data[256], expect[256], output[256];
+  uint8_t *ctx, *batch;
+  size_t i, len;
+  bool ok;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 5 + 2);
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 13 + 1);
+
+  ctx = ctx_alloc (cipher->ctx_size, cipher->ctx_align);
+  batch = ctx_alloc (3 * cipher->ctx_size, cipher->ctx_align);
+  if (ctx == NULL || batch == NULL)
+    {
+      free (ctx);
+      free (batch);
+      return false;
+    }
+  len = sizeof (data);
+  ok = true;
+
+  cipher->set_key (ctx, key);
+  cipher->ecb_encrypt (ctx, data, expect, len);
+  cipher->set_encrypt_key (ctx, key);
+  cipher->ecb_encrypt (ctx, data, output, len);
+  ok = ok && memcmp (output, expect, len) == 0;
+
+  if (cipher->cbc_encrypt != NULL)
+    {
+      cipher->set_key (ctx, key);
+      memset (iv, 0x5a, sizeof (iv));
+      cipher->cbc_encrypt (ctx, iv, data, expect, len);
+      cipher->set_encrypt_key (ctx, key);
+      memset (iv, 0x5a, sizeof (iv));
+      cipher->cbc_encrypt (ctx, iv, data, output, len);
+      ok = ok && memcmp (output, expect, len) == 0;
+    }
+
+  cipher->set_key (ctx, key);
+  memset (iv, 0xfe, sizeof (iv));
+  cipher->ctr_crypt (ctx, iv, data, expect, len - 5);
+  cipher->set_encrypt_key (ctx, key);
+  memset (iv, 0xfe, sizeof (iv));
+  cipher->ctr_crypt (ctx, iv, data, output, len - 5);
+  ok = ok && memcmp (output, expect, len - 5) == 0;
+
+  /* Three different keys, each checked against a context of its own. */
+  if (cipher->set_encrypt_key_batch != NULL)
+    {
+      for (i = 0; i < 3; ++i)
+        keys[i] = key + i;
+      cipher->set_encrypt_key_batch (batch, keys, 3);
+      for (i = 0; i < 3; ++i)
+        {
+          cipher->set_key (ctx, keys[i]);
+          cipher->ecb_encrypt (ctx, data, expect, len);
+          cipher->ecb_encrypt (batch + i * cipher->ctx_size, data, output,
+                               len);
+          ok = ok && memcmp (output, expect, len) == 0;
+        }
+    }
+
+  free (ctx);
+  free (batch);
+  return ok;
+}
@@ -0,0 +1,530 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gcm.h"
+
+static bool run_aes128_gcm_test (void);
+static bool run_aes192_gcm_test (void);
+static bool run_aes256_gcm_test (void);
+static bool run_aes128_gcm_stream_test (void);
+static bool run_aes128_gcm_wrap_test (void);
+static bool run_aes_gcm_siv_test (void);
+static bool run_aes_gcm_siv_long_test (void);
+static void fill_message (uint8_t *, size_t);
+static void hexdump (const uint8_t *, size_t);
+
+/*
+ * Test cases 4, 5, 6 and their AES-192 and AES-256 versions from "The
+ * Galois/Counter Mode of Operation (GCM)" by McGrew and Viega. The keys of
+ * the shorter variants are prefixes of gcm_key.
+ */
+static const uint8_t gcm_key[AES256_KEY_SIZE]
+    = { 0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+        0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+        0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+        0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08 };
+
+static const uint8_t gcm_pt[60]
+    = { 0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09,
+        0xc5, 0xaf, 0xf5, 0x26, 0x9a, 0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34,
+        0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72, 0x1c,
+        0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24,
+        0x49, 0xa6, 0xb5, 0x25, 0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6,
+        0x57, 0xba, 0x63, 0x7b, 0x39 };
+
+static const uint8_t gcm_ad[20]
+    = { 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa,
+        0xce, 0xde, 0xad, 0xbe, 0xef, 0xab, 0xad, 0xda, 0xd2 };
+
+/* A 96-bit IV, a 64-bit IV and a 480-bit IV. */
+static const uint8_t gcm_iv1[GCM_IV_SIZE]
+    = { 0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+        0xde, 0xca, 0xf8, 0x88 };
+
+static const uint8_t gcm_iv2[8]
+    = { 0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad };
+
+static const uint8_t gcm_iv3[60]
+    = { 0x93, 0x13, 0x22, 0x5d, 0xf8, 0x84, 0x06, 0xe5, 0x55, 0x90, 0x9c,
+        0x5a, 0xff, 0x52, 0x69, 0xaa, 0x6a, 0x7a, 0x95, 0x38, 0x53, 0x4f,
+        0x7d, 0xa1, 0xe4, 0xc3, 0x03, 0xd2, 0xa3, 0x18, 0xa7, 0x28, 0xc3,
+        0xc0, 0xc9, 0x51, 0x56, 0x80, 0x95, 0x39, 0xfc, 0xf0, 0xe2, 0x42,
+        0x9a, 0x6b, 0x52, 0x54, 0x16, 0xae, 0xdb, 0xf5, 0xa0, 0xde, 0x6a,
+        0x57, 0xa6, 0x37, 0xb3, 0x9b };
+
+static const uint8_t *const gcm_ivs[3] = { gcm_iv1, gcm_iv2, gcm_iv3 };
+static const size_t gcm_iv_sizes[3]
+    = { sizeof (gcm_iv1), sizeof (gcm_iv2), sizeof (gcm_iv3) };
+
+int
+main (void)
+{
+  if (!run_aes128_gcm_test ())
+    return 1;
+  if (!run_aes192_gcm_test ())
+    return 1;
+  if (!run_aes256_gcm_test ())
+    return 1;
+  if (!run_aes128_gcm_stream_test ())
+    return 1;
+  if (!run_aes128_gcm_wrap_test ())
+    return 1;
+  if (!run_aes_gcm_siv_test ())
+    return 1;
+  if (!run_aes_gcm_siv_long_test ())
+    return 1;
+  return 0;
+}
+
+static bool
+run_aes128_gcm_test (void)
+{
+  struct aes128_gcm_ctx ctx;
+  uint8_t buffer[sizeof (gcm_pt)];
+  uint8_t tag[GCM_DIGEST_SIZE];
+  size_t i;
+
+  const uint8_t ct[3][sizeof (gcm_pt)]
+      = { { 0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72,
+            0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c, 0xe3, 0xaa, 0x21, 0x2f,
+            0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac,
+            0xa1, 0x2e, 0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c,
+            0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05, 0x1b, 0xa3,
+            0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91 },
+          { 0x61, 0x35, 0x3b, 0x4c, 0x28, 0x06, 0x93, 0x4a, 0x77, 0x7f,
+            0xf5, 0x1f, 0xa2, 0x2a, 0x47, 0x55, 0x69, 0x9b, 0x2a, 0x71,
+            0x4f, 0xcd, 0xc6, 0xf8, 0x37, 0x66, 0xe5, 0xf9, 0x7b, 0x6c,
+            0x74, 0x23, 0x73, 0x80, 0x69, 0x00, 0xe4, 0x9f, 0x24, 0xb2,
+            0x2b, 0x09, 0x75, 0x44, 0xd4, 0x89, 0x6b, 0x42, 0x49, 0x89,
+            0xb5, 0xe1, 0xeb, 0xac, 0x0f, 0x07, 0xc2, 0x3f, 0x45, 0x98 },
+          { 0x8c, 0xe2, 0x49, 0x98, 0x62, 0x56, 0x15, 0xb6, 0x03, 0xa0,
+            0x33, 0xac, 0xa1, 0x3f, 0xb8, 0x94, 0xbe, 0x91, 0x12, 0xa5,
+            0xc3, 0xa2, 0x11, 0xa8, 0xba, 0x26, 0x2a, 0x3c, 0xca, 0x7e,
+            0x2c, 0xa7, 0x01, 0xe4, 0xa9, 0xa4, 0xfb, 0xa4, 0x3c, 0x90,
+            0xcc, 0xdc, 0xb2, 0x81, 0xd4, 0x8c, 0x7c, 0x6f, 0xd6, 0x28,
+            0x75, 0xd2, 0xac, 0xa4, 0x17, 0x03, 0x4c, 0x34, 0xae, 0xe5 } };
+
+  const uint8_t tags[3][GCM_DIGEST_SIZE]
+      = { { 0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb,
+            0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47 },
+          { 0x36, 0x12, 0xd2, 0xe7, 0x9e, 0x3b, 0x07, 0x85,
+            0x56, 0x1b, 0xe1, 0x4a, 0xac, 0xa2, 0xfc, 0xcb },
+          { 0x61, 0x9c, 0xc5, 0xae, 0xff, 0xfe, 0x0b, 0xfa,
+            0x46, 0x2a, 0xf4, 0x3c, 0x16, 0x99, 0xd0, 0x50 } };
+
+  aes128_gcm_set_key (&ctx, gcm_key);
+  for (i = 0; i < 3; ++i)
+    {
+      aes128_gcm_seal (&ctx, gcm_ivs[i], gcm_iv_sizes[i], gcm_ad,
+                       sizeof (gcm_ad), gcm_pt, buffer, sizeof (buffer), tag);
+      hexdump (buffer, sizeof (buffer));
+      hexdump (tag, sizeof (tag));
+      if (memcmp (buffer, ct[i], sizeof (buffer)) != 0
+          || memcmp (tag, tags[i], sizeof (tag)) != 0)
+        return false;
+
+      if (aes128_gcm_open (&ctx, gcm_ivs[i], gcm_iv_sizes[i], gcm_ad,
+                           sizeof (gcm_ad), ct[i], buffer, sizeof (buffer),
+                           tags[i])
+          != 0)
+        return false;
+      if (memcmp (buffer, gcm_pt, sizeof (buffer)) != 0)
+        return false;
+    }
+
+  return true;
+}
+
+static bool
+run_aes192_gcm_test (void)
+{
+  struct aes192_gcm_ctx ctx;
+  uint8_t buffer[sizeof (gcm_pt)];
+  uint8_t tag[GCM_DIGEST_SIZE];
+  size_t i;
+
+  const uint8_t ct[3][sizeof (gcm_pt)]
+      = { { 0x39, 0x80, 0xca, 0x0b, 0x3c, 0x00, 0xe8, 0x41, 0xeb, 0x06,
+            0xfa, 0xc4, 0x87, 0x2a, 0x27, 0x57, 0x85, 0x9e, 0x1c, 0xea,
+            0xa6, 0xef, 0xd9, 0x84, 0x62, 0x85, 0x93, 0xb4, 0x0c, 0xa1,
+            0xe1, 0x9c, 0x7d, 0x77, 0x3d, 0x00, 0xc1, 0x44, 0xc5, 0x25,
+            0xac, 0x61, 0x9d, 0x18, 0xc8, 0x4a, 0x3f, 0x47, 0x18, 0xe2,
+            0x44, 0x8b, 0x2f, 0xe3, 0x24, 0xd9, 0xcc, 0xda, 0x27, 0x10 },
+          { 0x0f, 0x10, 0xf5, 0x99, 0xae, 0x14, 0xa1, 0x54, 0xed, 0x24,
+            0xb3, 0x6e, 0x25, 0x32, 0x4d, 0xb8, 0xc5, 0x66, 0x63, 0x2e,
+            0xf2, 0xbb, 0xb3, 0x4f, 0x83, 0x47, 0x28, 0x0f, 0xc4, 0x50,
+            0x70, 0x57, 0xfd, 0xdc, 0x29, 0xdf, 0x9a, 0x47, 0x1f, 0x75,
+            0xc6, 0x65, 0x41, 0xd4, 0xd4, 0xda, 0xd1, 0xc9, 0xe9, 0x3a,
+            0x19, 0xa5, 0x8e, 0x8b, 0x47, 0x3f, 0xa0, 0xf0, 0x62, 0xf7 },
+          { 0xd2, 0x7e, 0x88, 0x68, 0x1c, 0xe3, 0x24, 0x3c, 0x48, 0x30,
+            0x16, 0x5a, 0x8f, 0xdc, 0xf9, 0xff, 0x1d, 0xe9, 0xa1, 0xd8,
+            0xe6, 0xb4, 0x47, 0xef, 0x6e, 0xf7, 0xb7, 0x98, 0x28, 0x66,
+            0x6e, 0x45, 0x81, 0xe7, 0x90, 0x12, 0xaf, 0x34, 0xdd, 0xd9,
+            0xe2, 0xf0, 0x37, 0x58, 0x9b, 0x29, 0x2d, 0xb3, 0xe6, 0x7c,
+            0x03, 0x67, 0x45, 0xfa, 0x22, 0xe7, 0xe9, 0xb7, 0x37, 0x3b } };
+
+  const uint8_t tags[3][GCM_DIGEST_SIZE]
+      = { { 0x25, 0x19, 0x49, 0x8e, 0x80, 0xf1, 0x47, 0x8f,
+            0x37, 0xba, 0x55, 0xbd, 0x6d, 0x27, 0x61, 0x8c },
+          { 0x65, 0xdc, 0xc5, 0x7f, 0xcf, 0x62, 0x3a, 0x24,
+            0x09, 0x4f, 0xcc, 0xa4, 0x0d, 0x35, 0x33, 0xf8 },
+          { 0xdc, 0xf5, 0x66, 0xff, 0x29, 0x1c, 0x25, 0xbb,
+            0xb8, 0x56, 0x8f, 0xc3, 0xd3, 0x76, 0xa6, 0xd9 } };
+
+  aes192_gcm_set_key (&ctx, gcm_key);
+  for (i = 0; i < 3; ++i)
+    {
+      aes192_gcm_seal (&ctx, gcm_ivs[i], gcm_iv_sizes[i], gcm_ad,
+                       sizeof (gcm_ad), gcm_pt, buffer, sizeof (buffer), tag);
+      hexdump (buffer, sizeof (buffer));
+      hexdump (tag, sizeof (tag));
+      if (memcmp (buffer, ct[i], sizeof (buffer)) != 0
+          || memcmp (tag, tags[i], sizeof (tag)) != 0)
+        return false;
+
+      if (aes192_gcm_open (&ctx, gcm_ivs[i], gcm_iv_sizes[i], gcm_ad,
+                           sizeof (gcm_ad), ct[i], buffer, sizeof (buffer),
+                           tags[i])
+          != 0)
+        return false;
+      if (memcmp (buffer, gcm_pt, sizeof (buffer)) != 0)
+        return false;
+    }
+
+  return true;
+}
+
+static bool
+run_aes256_gcm_test (void)
+{
+  struct aes256_gcm_ctx ctx;
+  uint8_t buffer[sizeof (gcm_pt)];
+  uint8_t tag[GCM_DIGEST_SIZE];
+  size_t i;
+
+  const uint8_t ct[3][sizeof (gcm_pt)]
+      = { { 0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07, 0xf4, 0x7f,
+            0x37, 0xa3, 0x2a, 0x84, 0x42, 0x7d, 0x64, 0x3a, 0x8c, 0xdc,
+            0xbf, 0xe5, 0xc0, 0xc9, 0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55,
+            0xd1, 0xaa, 0x8c, 0xb0, 0x8e, 0x48, 0x59, 0x0d, 0xbb, 0x3d,
+            0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38, 0xc5, 0xf6,
+            0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a, 0xbc, 0xc9, 0xf6, 0x62 },
+          { 0xc3, 0x76, 0x2d, 0xf1, 0xca, 0x78, 0x7d, 0x32, 0xae, 0x47,
+            0xc1, 0x3b, 0xf1, 0x98, 0x44, 0xcb, 0xaf, 0x1a, 0xe1, 0x4d,
+            0x0b, 0x97, 0x6a, 0xfa, 0xc5, 0x2f, 0xf7, 0xd7, 0x9b, 0xba,
+            0x9d, 0xe0, 0xfe, 0xb5, 0x82, 0xd3, 0x39, 0x34, 0xa4, 0xf0,
+            0x95, 0x4c, 0xc2, 0x36, 0x3b, 0xc7, 0x3f, 0x78, 0x62, 0xac,
+            0x43, 0x0e, 0x64, 0xab, 0xe4, 0x99, 0xf4, 0x7c, 0x9b, 0x1f },
+          { 0x5a, 0x8d, 0xef, 0x2f, 0x0c, 0x9e, 0x53, 0xf1, 0xf7, 0x5d,
+            0x78, 0x53, 0x65, 0x9e, 0x2a, 0x20, 0xee, 0xb2, 0xb2, 0x2a,
+            0xaf, 0xde, 0x64, 0x19, 0xa0, 0x58, 0xab, 0x4f, 0x6f, 0x74,
+            0x6b, 0xf4, 0x0f, 0xc0, 0xc3, 0xb7, 0x80, 0xf2, 0x44, 0x45,
+            0x2d, 0xa3, 0xeb, 0xf1, 0xc5, 0xd8, 0x2c, 0xde, 0xa2, 0x41,
+            0x89, 0x97, 0x20, 0x0e, 0xf8, 0x2e, 0x44, 0xae, 0x7e, 0x3f } };
+
+  const uint8_t tags[3][GCM_DIGEST_SIZE]
+      = { { 0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68,
+            0xcd, 0xdf, 0x88, 0x53, 0xbb, 0x2d, 0x55, 0x1b },
+          { 0x3a, 0x33, 0x7d, 0xbf, 0x46, 0xa7, 0x92, 0xc4,
+            0x5e, 0x45, 0x49, 0x13, 0xfe, 0x2e, 0xa8, 0xf2 },
+          { 0xa4, 0x4a, 0x82, 0x66, 0xee, 0x1c, 0x8e, 0xb0,
+            0xc8, 0xb5, 0xd4, 0xcf, 0x5a, 0xe9, 0xf1, 0x9a } };
+
+  aes256_gcm_set_key (&ctx, gcm_key);
+  for (i = 0; i < 3; ++i)
+    {
+      aes256_gcm_seal (&ctx, gcm_ivs[i], gcm_iv_sizes[i], gcm_ad,
+                       sizeof (gcm_ad), gcm_pt, buffer, sizeof (buffer), tag);
+      hexdump (buffer, sizeof (buffer));
+      hexdump (tag, sizeof (tag));
+      if (memcmp (buffer, ct[i], sizeof (buffer)) != 0
+          || memcmp (tag, tags[i], sizeof (tag)) != 0)
+        return false;
+
+      if (aes256_gcm_open (&ctx, gcm_ivs[i], gcm_iv_sizes[i], gcm_ad,
+                           sizeof (gcm_ad), ct[i], buffer, sizeof (buffer),
+                           tags[i])
+          != 0)
+        return false;
+      if (memcmp (buffer, gcm_pt, sizeof (buffer)) != 0)
+        return false;
+    }
+
+  return true;
+}
+
+/*
+ * A message long enough for the multi-block GHASH code, passed in pieces of
+ * different sizes. The expected tag was computed with OpenSSL.
+ */
+static bool
+run_aes128_gcm_stream_test (void)
+{
+  struct aes128_gcm_ctx ctx;
+  uint8_t message[1000];
+  uint8_t expected[sizeof (message)];
+  uint8_t buffer[sizeof (message)];
+  uint8_t tag[GCM_DIGEST_SIZE];
+
+  const uint8_t tag1[GCM_DIGEST_SIZE]
+      = { 0xd6, 0xac, 0x5f, 0x7b, 0x34, 0xae, 0x22, 0x53,
+          0x9e, 0x17, 0x7c, 0xc3, 0x05, 0x22, 0x8d, 0xed };
+
+  fill_message (message, sizeof (message));
+  aes128_gcm_set_key (&ctx, gcm_key);
+  aes128_gcm_seal (&ctx, gcm_iv1, sizeof (gcm_iv1), gcm_ad, sizeof (gcm_ad),
+                   message, expected, sizeof (expected), tag);
+  hexdump (tag, sizeof (tag));
+  if (memcmp (tag, tag1, sizeof (tag)) != 0)
+    return false;
+
+  aes128_gcm_set_iv (&ctx, gcm_iv1, sizeof (gcm_iv1));
+  aes128_gcm_update (&ctx, gcm_ad, 16);
+  aes128_gcm_update (&ctx, gcm_ad + 16, sizeof (gcm_ad) - 16);
+  aes128_gcm_encrypt (&ctx, message, buffer, 48);
+  aes128_gcm_encrypt (&ctx, message + 48, buffer + 48, 320);
+  aes128_gcm_encrypt (&ctx, message + 368, buffer + 368,
+                      sizeof (message) - 368);
+  aes128_gcm_digest (&ctx, tag);
+  if (memcmp (buffer, expected, sizeof (buffer)) != 0
+      || memcmp (tag, tag1, sizeof (tag)) != 0)
+    return false;
+
+  /* Decrypt in place. */
+  aes128_gcm_set_iv (&ctx, gcm_iv1, sizeof (gcm_iv1));
+  aes128_gcm_update (&ctx, gcm_ad, sizeof (gcm_ad));
+  aes128_gcm_decrypt (&ctx, buffer, buffer, 160);
+  aes128_gcm_decrypt (&ctx, buffer + 160, buffer + 160,
+                      sizeof (buffer) - 160);
+  aes128_gcm_digest (&ctx, tag);
+  if (memcmp (buffer, message, sizeof (buffer)) != 0
+      || memcmp (tag, tag1, sizeof (tag)) != 0)
+    return false;
+
+  /* A modified tag must be rejected and the output cleared. */
+  tag[0] ^= 1;
+  if (aes128_gcm_open (&ctx, gcm_iv1, sizeof (gcm_iv1), gcm_ad,
+                       sizeof (gcm_ad), expected, buffer, sizeof (buffer), tag)
+      != -1)
+    return false;
+  memset (message, 0, sizeof (message));
+  return memcmp (buffer, message, sizeof (buffer)) == 0;
+}
+
+/*
+ * The IV was picked so that the low 32 bits of J0 are 0xffffffeb, so the
+ * counter wraps to zero after 20 blocks without carrying into the upper 96
+ * bits. The expected tag was computed with OpenSSL.
+ */
+static bool
+run_aes128_gcm_wrap_test (void)
+{
+  struct aes128_gcm_ctx ctx;
+  uint8_t message[1000];
+  uint8_t buffer[sizeof (message)];
+  uint8_t tag[GCM_DIGEST_SIZE];
+
+  const uint8_t iv[8] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xe9, 0x86 };
+
+  const uint8_t tag1[GCM_DIGEST_SIZE]
+      = { 0xe8, 0x46, 0x9a, 0xad, 0x5f, 0x7c, 0x2f, 0x9a,
+          0xfb, 0x9c, 0xc9, 0x8f, 0xd2, 0x94, 0xcf, 0xfb };
+
+  fill_message (message, sizeof (message));
+  aes128_gcm_set_key (&ctx, gcm_key);
+  aes128_gcm_seal (&ctx, iv, sizeof (iv), gcm_ad, sizeof (gcm_ad), message,
+                   buffer, sizeof (buffer), tag);
+  hexdump (tag, sizeof (tag));
+  if (memcmp (tag, tag1, sizeof (tag)) != 0)
+    return false;
+
+  if (aes128_gcm_open (&ctx, iv, sizeof (iv), gcm_ad, sizeof (gcm_ad), buffer,
+                       buffer, sizeof (buffer), tag1)
+      != 0)
+    return false;
+  return memcmp (buffer, message, sizeof (buffer)) == 0;
+}
+
+/*
+ * The first two AES-128 and AES-256 test vectors from RFC 8452, Appendix C,
+ * with an empty and an 8-byte plaintext and no associated data.
+ */
+static bool
+run_aes_gcm_siv_test (void)
+{
+  struct aes128_gcm_siv_ctx ctx128;
+  struct aes256_gcm_siv_ctx ctx256;
+  uint8_t key[AES256_KEY_SIZE];
+  uint8_t nonce[GCM_SIV_NONCE_SIZE];
+  uint8_t message[8];
+  uint8_t buffer[sizeof (message)];
+  uint8_t tag[GCM_SIV_DIGEST_SIZE];
+
+  const uint8_t tags128[2][GCM_SIV_DIGEST_SIZE]
+      = { { 0xdc, 0x20, 0xe2, 0xd8, 0x3f, 0x25, 0x70, 0x5b,
+            0xb4, 0x9e, 0x43, 0x9e, 0xca, 0x56, 0xde, 0x25 },
+          { 0x57, 0x87, 0x82, 0xff, 0xf6, 0x01, 0x3b, 0x81,
+            0x5b, 0x28, 0x7c, 0x22, 0x49, 0x3a, 0x36, 0x4c } };
+
+  const uint8_t ct128[sizeof (message)]
+      = { 0xb5, 0xd8, 0x39, 0x33, 0x0a, 0xc7, 0xb7, 0x86 };
+
+  const uint8_t tags256[2][GCM_SIV_DIGEST_SIZE]
+      = { { 0x07, 0xf5, 0xf4, 0x16, 0x9b, 0xbf, 0x55, 0xa8,
+            0x40, 0x0c, 0xd4, 0x7e, 0xa6, 0xfd, 0x40, 0x0f },
+          { 0x84, 0x31, 0x22, 0x13, 0x0f, 0x73, 0x64, 0xb7,
+            0x61, 0xe0, 0xb9, 0x74, 0x27, 0xe3, 0xdf, 0x28 } };
+
+  const uint8_t ct256[sizeof (message)]
+      = { 0xc2, 0xef, 0x32, 0x8e, 0x5c, 0x71, 0xc8, 0x3b };
+
+  memset (key, 0, sizeof (key));
+  key[0] = 0x01;
+  memset (nonce, 0, sizeof (nonce));
+  nonce[0] = 0x03;
+  memset (message, 0, sizeof (message));
+  message[0] = 0x01;
+
+  aes128_gcm_siv_set_key (&ctx128, key);
+  if (aes128_gcm_siv_seal (&ctx128, nonce, NULL, 0, NULL, NULL, 0, tag) != 0)
+    return false;
+  hexdump (tag, sizeof (tag));
+  if (memcmp (tag, tags128[0], sizeof (tag)) != 0)
+    return false;
+  if (aes128_gcm_siv_seal (&ctx128, nonce, NULL, 0, message, buffer,
+                           sizeof (message), tag)
+      != 0)
+    return false;
+  hexdump (buffer, sizeof (buffer));
+  hexdump (tag, sizeof (tag));
+  if (memcmp (buffer, ct128, sizeof (buffer)) != 0
+      || memcmp (tag, tags128[1], sizeof (tag)) != 0)
+    return false;
+  if (aes128_gcm_siv_open (&ctx128, nonce, NULL, 0, ct128, buffer,
+                           sizeof (buffer), tags128[1])
+          != 0
+      || memcmp (buffer, message, sizeof (buffer)) != 0)
+    return false;
+
+  aes256_gcm_siv_set_key (&ctx256, key);
+  if (aes256_gcm_siv_seal (&ctx256, nonce, NULL, 0, NULL, NULL, 0, tag) != 0)
+    return false;
+  hexdump (tag, sizeof (tag));
+  if (memcmp (tag, tags256[0], sizeof (tag)) != 0)
+    return false;
+  if (aes256_gcm_siv_seal (&ctx256, nonce, NULL, 0, message, buffer,
+                           sizeof (message), tag)
+      != 0)
+    return false;
+  hexdump (buffer, sizeof (buffer));
+  hexdump (tag, sizeof (tag));
+  if (memcmp (buffer, ct256, sizeof (buffer)) != 0
+      || memcmp (tag, tags256[1], sizeof (tag)) != 0)
+    return false;
+  if (aes256_gcm_siv_open (&ctx256, nonce, NULL, 0, ct256, buffer,
+                           sizeof (buffer), tags256[1])
+          != 0
+      || memcmp (buffer, message, sizeof (buffer)) != 0)
+    return false;
+
+  return true;
+}
+
+/*
+ * A message spanning several chunks of the POLYVAL and CTR code, with
+ * associated data. The tags were checked against a bit-serial POLYVAL
+ * written from the RFC 8452 definitions. A corrupted tag must be rejected
+ * and the output cleared.
+ */
+static bool
+run_aes_gcm_siv_long_test (void)
+{
+  struct aes128_gcm_siv_ctx ctx128;
+  struct aes256_gcm_siv_ctx ctx256;
+  uint8_t message[1000];
+  uint8_t buffer[sizeof (message)];
+  uint8_t tag[GCM_SIV_DIGEST_SIZE];
+
+  const uint8_t tag128[GCM_SIV_DIGEST_SIZE]
+      = { 0x6b, 0xef, 0xbd, 0x57, 0xcb, 0x1f, 0xda, 0x82,
+          0xfd, 0x34, 0x53, 0xeb, 0xdf, 0x09, 0xa3, 0x84 };
+
+  const uint8_t tag256[GCM_SIV_DIGEST_SIZE]
+      = { 0x7c, 0x6f, 0x9b, 0x6f, 0x74, 0x67, 0x4f, 0x27,
+          0x85, 0x1a, 0x57, 0x9a, 0x2a, 0xeb, 0x91, 0x7c };
+
+  fill_message (message, sizeof (message));
+  aes128_gcm_siv_set_key (&ctx128, gcm_key);
+  aes128_gcm_siv_seal (&ctx128, gcm_iv1, gcm_ad, sizeof (gcm_ad), message,
+                       buffer, sizeof (buffer), tag);
+  hexdump (tag, sizeof (tag));
+  if (memcmp (tag, tag128, sizeof (tag)) != 0)
+    return false;
+  if (aes128_gcm_siv_open (&ctx128, gcm_iv1, gcm_ad, sizeof (gcm_ad), buffer,
+                           buffer, sizeof (buffer), tag)
+          != 0
+      || memcmp (buffer, message, sizeof (buffer)) != 0)
+    return false;
+
+  aes256_gcm_siv_set_key (&ctx256, gcm_key);
+  aes256_gcm_siv_seal (&ctx256, gcm_iv1, gcm_ad, sizeof (gcm_ad), message,
+                       buffer, sizeof (buffer), tag);
+  hexdump (tag, sizeof (tag));
+  if (memcmp (tag, tag256, sizeof (tag)) != 0)
+    return false;
+  tag[0] ^= 1;
+  if (aes256_gcm_siv_open (&ctx256, gcm_iv1, gcm_ad, sizeof (gcm_ad), buffer,
+                           buffer, sizeof (buffer), tag)
+      != -1)
+    return false;
+  memset (message, 0, sizeof (message));
+  return memcmp (buffer, message, sizeof (buffer)) == 0;
+}
+
+static void
+fill_message (uint8_t *message, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    message[i] = (uint8_t)(i * 7 + 1);
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
@@ -0,0 +1,119 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gear.h"
+
+#define GEAR_TEST_SIZE (1024 * 1024)
+
+/* Simple generator for data with no structure of its own. */
+static uint8_t
+next_byte (uint64_t *state)
+{
+  *state = *state * UINT64_C (6364136223846793005)
+           + UINT64_C (1442695040888963407);
+  return (uint8_t)(*state >> 56);
+}
+
+int
+main (void)
+{
+  uint8_t *data, a[100], b[100];
+  uint64_t state, hash, expect, mask;
+  size_t i, n, off, chunks;
+  int rv;
+
+  rv = 0;
+  data = malloc (GEAR_TEST_SIZE);
+  if (data == NULL)
+    return 1;
+  state = 1;
+  for (i = 0; i < GEAR_TEST_SIZE; ++i)
+    data[i] = next_byte (&state);
+
+  /*
+   * The table is part of the format of any chunk index built on this, so a
+   * change to it must show up here.
+   */
+  hash = gear_update (0, "123456789", 9);
+  printf ("0x%016llx\n", (unsigned long long)hash);
+  if (hash != UINT64_C (0xa2f4fc9b85d4c6be))
+    {
+      printf ("Gear check value failed\n");
+      rv = 1;
+    }
+
+  /* Only the last 64 bytes affect the hash. */
+  for (i = 0; i < sizeof (a); ++i)
+    {
+      a[i] = data[i];
+      b[i] = i < sizeof (a) - 64 ? (uint8_t)~data[i] : data[i];
+    }
+  if (gear_update (0, a, sizeof (a)) != gear_update (7, b, sizeof (b)))
+    {
+      printf ("Gear window failed\n");
+      rv = 1;
+    }
+
+  /*
+   * The boundaries found by gear_scan against a byte at a time search, with
+   * a 13-bit mask for chunks of about 8 KiB.
+   */
+  mask = UINT64_C (0x1fff) << 51;
+  hash = 0;
+  expect = 0;
+  chunks = 0;
+  for (off = 0; off < GEAR_TEST_SIZE; off += n)
+    {
+      n = gear_scan (&hash, data + off, GEAR_TEST_SIZE - off, mask);
+      for (i = 0; i < n; ++i)
+        {
+          expect = gear_update (expect, data + off + i, 1);
+          if ((expect & mask) == 0 && i + 1 != n)
+            break;
+        }
+      if (i != n || hash != expect)
+        {
+          printf ("Gear scan failed at offset %zu\n", off);
+          rv = 1;
+          break;
+        }
+      ++chunks;
+    }
+  printf ("%zu chunks\n", chunks);
+  if (chunks < GEAR_TEST_SIZE / 8192 / 2 || chunks > GEAR_TEST_SIZE / 8192 * 2)
+    {
+      printf ("Gear chunk count out of range\n");
+      rv = 1;
+    }
+
+  free (data);
+  return rv;
+}
@@ -105,6 +105,11 @@ run_has160_testcase (const struct has160_testcase *test)
     printf ("%02x", digest[i]);
   printf ("\n");
 
+  if (memcmp (digest, test->hash, HAS160_DIGEST_SIZE) != 0)
+    return false;
+
+  /* The one-shot function must agree with init, update and final. */
+  has160 (digest, test->message, strlen (test->message));
   return memcmp (digest, test->hash, HAS160_DIGEST_SIZE) == 0;
 }
 
@@ -0,0 +1,212 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fcrypt_cipher.h"
+#include "fcrypt_hash.h"
+#include "fcrypt_instrument.h"
+
+#define MAX_EVENTS 16
+
+static int events[MAX_EVENTS];
+static size_t event_lens[MAX_EVENTS];
+static size_t event_count;
+
+static bool run_instrument_hash_test (void);
+static bool run_instrument_cipher_test (void);
+static bool run_instrument_error_test (void);
+static void *ctx_alloc (size_t, size_t);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!run_instrument_hash_test ())
+    {
+      printf ("Instrumentation hash test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_instrument_cipher_test ())
+    {
+      printf ("Instrumentation cipher test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_instrument_error_test ())
+    {
+      printf ("Instrumentation error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static void
+record_event (int event, const char *name, size_t len)
+{
+  (void)name;
+  if (event_count < MAX_EVENTS)
+    {
+      events[event_count] = event;
+      event_lens[event_count] = len;
+    }
+  ++event_count;
+}
+
+/*
+ * Checks the counters after hashing through the table, which are zero
+ * unless the library was built with --enable-instrument, and the events
+ * seen by the hook.
+ */
+static bool
+run_instrument_hash_test (void)
+{
+  static const int expect[] = {
+    FCRYPT_EVENT_SETUP_BEGIN, FCRYPT_EVENT_SETUP_END,
+    FCRYPT_EVENT_BULK_BEGIN,  FCRYPT_EVENT_BULK_END,
+    FCRYPT_EVENT_BULK_BEGIN,  FCRYPT_EVENT_BULK_END,
+    FCRYPT_EVENT_BULK_BEGIN,  FCRYPT_EVENT_BULK_END,
+  };
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  const struct fcrypt_hash *hash;
+  struct fcrypt_counters counters;
+  uint8_t input[100] = { 0 };
+  void *ctx;
+  size_t i;
+  bool ok;
+
+  hash = &fcrypt_hash_sha256;
+  ctx = ctx_alloc (hash->ctx_size, hash->ctx_align);
+  if (ctx == NULL)
+    return false;
+  fcrypt_instrument_reset ();
+  event_count = 0;
+  fcrypt_instrument_set_hook (record_event);
+  hash->init (ctx);
+  hash->update (ctx, input, 10);
+  hash->update (ctx, input, 90);
+  hash->final (digest, ctx);
+  hash->digest (digest, input, 64);
+  fcrypt_instrument_set_hook (NULL);
+  free (ctx);
+
+  /* The one-shot function of SHA-384 is built from the raw adapters. */
+  fcrypt_hash_sha384.digest (digest, input, 3);
+
+  if (fcrypt_hash_counters (hash, &counters) != 0
+      || counters.backend == NULL || counters.backend[0] == '\0')
+    return false;
+  if (!fcrypt_instrument_enabled ())
+    return counters.setup_calls == 0 && counters.bulk_calls == 0
+           && counters.bulk_bytes == 0 && event_count == 0;
+
+  ok = counters.setup_calls == 1 && counters.bulk_calls == 3
+       && counters.bulk_bytes == 164
+       && event_count == sizeof (expect) / sizeof (expect[0]);
+  for (i = 0; ok && i < event_count; ++i)
+    ok = events[i] == expect[i];
+  ok = ok && event_lens[0] == 0 && event_lens[2] == 10
+       && event_lens[5] == 90 && event_lens[7] == 64;
+
+  ok = ok && fcrypt_hash_counters (&fcrypt_hash_sha384, &counters) == 0
+       && counters.setup_calls == 0 && counters.bulk_calls == 1
+       && counters.bulk_bytes == 3;
+
+  fcrypt_instrument_reset ();
+  ok = ok && fcrypt_hash_counters (hash, &counters) == 0
+       && counters.setup_calls == 0 && counters.bulk_calls == 0
+       && counters.bulk_bytes == 0;
+  return ok;
+}
+
+static bool
+run_instrument_cipher_test (void)
+{
+  const struct fcrypt_cipher *cipher;
+  struct fcrypt_counters counters;
+  uint8_t key[FCRYPT_CIPHER_MAX_KEY_SIZE] = { 0 };
+  uint8_t iv[FCRYPT_CIPHER_MAX_BLOCK_SIZE] = { 0 };
+  uint8_t buffer[64] = { 0 };
+  void *ctx;
+  size_t i;
+
+  fcrypt_instrument_reset ();
+  for (i = 0; (cipher = fcrypt_cipher_get (i)) != NULL; ++i)
+    {
+      ctx = ctx_alloc (cipher->ctx_size, cipher->ctx_align);
+      if (ctx == NULL)
+        return false;
+      cipher->set_key (ctx, key);
+      cipher->ecb_encrypt (ctx, buffer, buffer, 32);
+      cipher->ctr_crypt (ctx, iv, buffer, buffer, 64);
+      free (ctx);
+      if (fcrypt_cipher_counters (cipher, &counters) != 0
+          || counters.backend == NULL || counters.backend[0] == '\0')
+        return false;
+      if (fcrypt_instrument_enabled ()
+              ? counters.setup_calls != 1 || counters.bulk_calls != 2
+                    || counters.bulk_bytes != 96
+              : counters.setup_calls != 0 || counters.bulk_calls != 0)
+        return false;
+    }
+  return true;
+}
+
+static bool
+run_instrument_error_test (void)
+{
+  struct fcrypt_hash fake;
+  struct fcrypt_counters counters;
+
+  fake = fcrypt_hash_sha256;
+  errno = 0;
+  return fcrypt_hash_counters (&fake, &counters) == -1 && errno == EINVAL;
+}
+
+/*
+ * Allocates a context with the alignment given by the descriptor, as some
+ * contexts need more than malloc or a byte array guarantees.
+ */
+static void *
+ctx_alloc (size_t size, size_t align)
+{
+  void *ctx;
+
+  if (align < sizeof (void *))
+    align = sizeof (void *);
+  if (posix_memalign (&ctx, align, size) != 0)
+    return NULL;
+  return ctx;
+}
@@ -101,5 +101,10 @@ run_md4_testcase (const struct md4_testcase *test)
     printf ("%02x", digest[i]);
   printf ("\n");
 
+  if (memcmp (digest, test->digest, MD4_DIGEST_SIZE) != 0)
+    return false;
+
+  /* The one-shot function must agree with init, update and final. */
+  md4 (digest, test->message, strlen (test->message));
   return memcmp (digest, test->digest, MD4_DIGEST_SIZE) == 0;
 }
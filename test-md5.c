@@ -63,6 +63,7 @@ static const struct md5_testcase testcases[]
       };
 
 static bool run_md5_testcase (const struct md5_testcase *);
+static bool run_md5_multi_test (void);
 
 int
 main (void)
@@ -82,6 +83,12 @@ main (void)
         }
     }
 
+  if (!run_md5_multi_test ())
+    {
+      fprintf (stderr, "MD5 multi-buffer test failed.\n");
+      rv = 1;
+    }
+
   return rv;
 }
 
@@ -100,5 +107,50 @@ run_md5_testcase (const struct md5_testcase *test)
     printf ("%02x", digest[i]);
   printf ("\n");
 
+  if (memcmp (digest, test->digest, MD5_DIGEST_SIZE) != 0)
+    return false;
+
+  /* The one-shot function must agree with init, update and final. */
+  md5 (digest, test->message, strlen (test->message));
   return memcmp (digest, test->digest, MD5_DIGEST_SIZE) == 0;
 }
+
+/*
+ * Compares md5_multi with hashing each message on its own. The lengths
+ * cover the padding boundaries and messages of very different length, so
+ * lanes are refilled and finished one at a time.
+ */
+static bool
+run_md5_multi_test (void)
+{
+  static uint8_t data[8192];
+  static const size_t sizes[]
+      = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 127, 128, 1000, 4096, 8192 };
+  const uint8_t *messages[67];
+  size_t lens[67];
+  uint8_t digests[67 * MD5_DIGEST_SIZE];
+  uint8_t digest[MD5_DIGEST_SIZE];
+  size_t i, n;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 131 + 17);
+
+  for (n = 1; n <= 67; n += 11)
+    {
+      for (i = 0; i < n; ++i)
+        {
+          lens[i] = i < 14 ? sizes[i] : (i * 997) % sizeof (data);
+          messages[i] = data + (sizeof (data) - lens[i]) / (i % 3 + 1);
+        }
+      md5_multi (digests, messages, lens, n);
+      for (i = 0; i < n; ++i)
+        {
+          md5 (digest, messages[i], lens[i]);
+          if (memcmp (digest, digests + i * MD5_DIGEST_SIZE, MD5_DIGEST_SIZE)
+              != 0)
+            return false;
+        }
+    }
+
+  return true;
+}
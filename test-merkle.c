@@ -0,0 +1,302 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fcrypt_hash.h"
+#include "fcrypt_merkle.h"
+
+#define MAX_LEAVES 1000
+#define MAX_LEAF_SIZE 1500
+
+static uint8_t leaf_data[MAX_LEAVES][MAX_LEAF_SIZE];
+static const uint8_t *leaf_ptrs[MAX_LEAVES];
+static size_t leaf_lens[MAX_LEAVES];
+static uint64_t rand_state = UINT64_C (0x9e3779b97f4a7c15);
+
+static bool run_merkle_empty_test (void);
+static bool run_merkle_tree_test (const char *);
+static bool run_merkle_update_test (const char *);
+static bool run_merkle_error_test (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!run_merkle_empty_test ())
+    {
+      printf ("Merkle tree empty leaf test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_merkle_tree_test ("sha256") || !run_merkle_tree_test ("blake2b")
+      || !run_merkle_tree_test ("md5"))
+    {
+      printf ("Merkle tree test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_merkle_update_test ("sha256")
+      || !run_merkle_update_test ("blake2b"))
+    {
+      printf ("Merkle tree update test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_merkle_error_test ())
+    {
+      printf ("Merkle tree error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static uint64_t
+next_rand (void)
+{
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 7;
+  rand_state ^= rand_state << 17;
+  return rand_state;
+}
+
+/* Fills leaf i with random bytes, with a few longer than a batch slot. */
+static void
+fill_leaf (size_t i)
+{
+  size_t j;
+
+  leaf_lens[i] = i % 17 == 5 ? MAX_LEAF_SIZE : next_rand () % 200;
+  for (j = 0; j < leaf_lens[i]; ++j)
+    leaf_data[i][j] = (uint8_t)next_rand ();
+  leaf_ptrs[i] = leaf_data[i];
+}
+
+/* The Merkle tree hash of RFC 6962, section 2.1. */
+static void
+reference_root (const struct fcrypt_hash *hash, uint8_t *digest,
+                size_t first, size_t count)
+{
+  uint8_t buffer[1 + MAX_LEAF_SIZE];
+  size_t k;
+
+  if (count == 1)
+    {
+      buffer[0] = 0x00;
+      memcpy (buffer + 1, leaf_ptrs[first], leaf_lens[first]);
+      hash->digest (digest, buffer, 1 + leaf_lens[first]);
+      return;
+    }
+  for (k = 1; k * 2 < count; k *= 2)
+    ;
+  buffer[0] = 0x01;
+  reference_root (hash, buffer + 1, first, k);
+  reference_root (hash, buffer + 1 + hash->digest_size, first + k,
+                  count - k);
+  hash->digest (digest, buffer, 1 + 2 * hash->digest_size);
+}
+
+/* The root of a one leaf tree of empty data is SHA-256 of a zero byte. */
+static bool
+run_merkle_empty_test (void)
+{
+  static const uint8_t expect[32]
+      = { 0x6e, 0x34, 0x0b, 0x9c, 0xff, 0xb3, 0x7a, 0x98, 0x9c, 0xa5, 0x44,
+          0xe6, 0xbb, 0x78, 0x0a, 0x2c, 0x78, 0x90, 0x1d, 0x3f, 0xb3, 0x37,
+          0x38, 0x76, 0x85, 0x11, 0xa3, 0x06, 0x17, 0xaf, 0xa0, 0x1d };
+  struct fcrypt_merkle *tree;
+  uint8_t root[32];
+  size_t count;
+  bool ok;
+
+  tree = fcrypt_merkle_new (&fcrypt_hash_sha256, 1);
+  if (tree == NULL)
+    return false;
+  fcrypt_merkle_root (tree, root);
+  ok = memcmp (root, expect, sizeof (expect)) == 0
+       && fcrypt_merkle_proof (tree, 0, root, &count) == 0 && count == 0
+       && fcrypt_merkle_verify (&fcrypt_hash_sha256, 1, 0, "", 0, NULL, 0,
+                                expect)
+              == 0;
+  fcrypt_merkle_free (tree);
+  return ok;
+}
+
+/*
+ * Builds trees of every size up to 70 leaves, compares the root with the
+ * reference and checks the proof of every leaf, and that a proof with a
+ * changed digest or for another index fails.
+ */
+static bool
+run_merkle_tree_test (const char *name)
+{
+  uint8_t proof[FCRYPT_MERKLE_MAX_DEPTH * FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t expect[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t root[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  const struct fcrypt_hash *hash;
+  struct fcrypt_merkle *tree;
+  size_t n, i, count;
+  bool ok;
+
+  hash = fcrypt_hash_lookup (name);
+  if (hash == NULL)
+    return false;
+  ok = true;
+  for (n = 1; ok && n <= 70; ++n)
+    {
+      for (i = 0; i < n; ++i)
+        fill_leaf (i);
+      tree = fcrypt_merkle_new (hash, n);
+      if (tree == NULL)
+        return false;
+      ok = fcrypt_merkle_set_leaves (tree, 0, leaf_ptrs, leaf_lens, n) == 0;
+      fcrypt_merkle_root (tree, root);
+      reference_root (hash, expect, 0, n);
+      ok = ok && memcmp (root, expect, hash->digest_size) == 0;
+      for (i = 0; ok && i < n; ++i)
+        {
+          ok = fcrypt_merkle_proof (tree, i, proof, &count) == 0
+               && fcrypt_merkle_verify (hash, n, i, leaf_ptrs[i],
+                                        leaf_lens[i], proof, count, root)
+                      == 0;
+          if (ok && n > 1)
+            {
+              ok = fcrypt_merkle_verify (hash, n, (i + 1) % n, leaf_ptrs[i],
+                                         leaf_lens[i], proof, count, root)
+                       != 0
+                   && fcrypt_merkle_verify (hash, n, i, leaf_ptrs[i],
+                                            leaf_lens[i], proof, count - 1,
+                                            root)
+                          != 0;
+              proof[0] ^= 1;
+              ok = ok
+                   && fcrypt_merkle_verify (hash, n, i, leaf_ptrs[i],
+                                            leaf_lens[i], proof, count, root)
+                          != 0;
+            }
+        }
+      fcrypt_merkle_free (tree);
+    }
+  return ok;
+}
+
+/*
+ * Changes single leaves and runs of leaves, some set twice in one call,
+ * and checks the root against a tree built from scratch each time.
+ */
+static bool
+run_merkle_update_test (const char *name)
+{
+  uint8_t expect[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  uint8_t root[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  const uint8_t *ptrs[2];
+  size_t lens[2];
+  const struct fcrypt_hash *hash;
+  struct fcrypt_merkle *tree, *fresh;
+  size_t round, i, first, count;
+  bool ok;
+
+  hash = fcrypt_hash_lookup (name);
+  tree = hash != NULL ? fcrypt_merkle_new (hash, MAX_LEAVES) : NULL;
+  if (tree == NULL)
+    return false;
+  for (i = 0; i < MAX_LEAVES; ++i)
+    fill_leaf (i);
+  ok = fcrypt_merkle_set_leaves (tree, 0, leaf_ptrs, leaf_lens, MAX_LEAVES)
+       == 0;
+
+  for (round = 0; ok && round < 30; ++round)
+    {
+      first = next_rand () % MAX_LEAVES;
+      count = round % 3 == 0 ? 1 : next_rand () % (MAX_LEAVES - first) + 1;
+      for (i = first; i < first + count; ++i)
+        fill_leaf (i);
+      ok = fcrypt_merkle_set_leaves (tree, first, leaf_ptrs + first,
+                                     leaf_lens + first, count)
+           == 0;
+      if (round % 2 == 0)
+        {
+          /* The same leaf twice; the second value counts. */
+          ptrs[0] = leaf_data[(first + 1) % MAX_LEAVES];
+          lens[0] = MAX_LEAF_SIZE;
+          ptrs[1] = leaf_ptrs[first];
+          lens[1] = leaf_lens[first];
+          ok = ok && fcrypt_merkle_set_leaves (tree, first, ptrs, lens, 1) == 0
+               && fcrypt_merkle_set_leaves (tree, first, ptrs + 1, lens + 1,
+                                            1)
+                      == 0;
+        }
+      if (round % 5 == 4)
+        continue;
+
+      fresh = fcrypt_merkle_new (hash, MAX_LEAVES);
+      if (fresh == NULL)
+        break;
+      ok = ok
+           && fcrypt_merkle_set_leaves (fresh, 0, leaf_ptrs, leaf_lens,
+                                        MAX_LEAVES)
+                  == 0;
+      fcrypt_merkle_root (tree, root);
+      fcrypt_merkle_root (fresh, expect);
+      ok = ok && memcmp (root, expect, hash->digest_size) == 0;
+      fcrypt_merkle_free (fresh);
+    }
+
+  fcrypt_merkle_free (tree);
+  return ok;
+}
+
+static bool
+run_merkle_error_test (void)
+{
+  struct fcrypt_merkle *tree;
+  uint8_t proof[FCRYPT_MERKLE_MAX_DEPTH * FCRYPT_HASH_MAX_DIGEST_SIZE];
+  size_t count;
+  bool ok;
+
+  errno = 0;
+  if (fcrypt_merkle_new (&fcrypt_hash_sha256, 0) != NULL || errno != EINVAL)
+    return false;
+  tree = fcrypt_merkle_new (&fcrypt_hash_sha256, 10);
+  if (tree == NULL)
+    return false;
+  errno = 0;
+  ok = fcrypt_merkle_set_leaves (tree, 9, leaf_ptrs, leaf_lens, 2) == -1
+       && errno == EINVAL;
+  errno = 0;
+  ok = ok && fcrypt_merkle_proof (tree, 10, proof, &count) == -1
+       && errno == EINVAL;
+  fcrypt_merkle_free (tree);
+  return ok;
+}
@@ -0,0 +1,277 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ocb.h"
+
+static bool run_aes128_ocb_test (void);
+static bool run_aes_ocb_iterative_test (void);
+static bool run_aes128_ocb_open_test (void);
+static void fill_message (uint8_t *, size_t);
+static void hexdump (const uint8_t *, size_t);
+
+int
+main (void)
+{
+  if (!run_aes128_ocb_test ())
+    return 1;
+  if (!run_aes_ocb_iterative_test ())
+    return 1;
+  if (!run_aes128_ocb_open_test ())
+    return 1;
+  return 0;
+}
+
+/*
+ * The samples from RFC 7253, Appendix A, with an empty and an 8-byte
+ * message, and a 40-byte message that runs through the multi-block path
+ * with a partial final block. The last was computed with OpenSSL.
+ */
+static bool
+run_aes128_ocb_test (void)
+{
+  struct aes128_ocb_ctx ctx;
+  uint8_t key[AES128_KEY_SIZE];
+  uint8_t nonce[OCB_NONCE_SIZE]
+      = { 0xbb, 0xaa, 0x99, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11 };
+  uint8_t message[40], buffer[40];
+  uint8_t tag[OCB_DIGEST_SIZE];
+  size_t i;
+
+  const uint8_t tag0[OCB_DIGEST_SIZE]
+      = { 0x78, 0x54, 0x07, 0xbf, 0xff, 0xc8, 0xad, 0x9e,
+          0xdc, 0xc5, 0x52, 0x0a, 0xc9, 0x11, 0x1e, 0xe6 };
+
+  const uint8_t ct8[8 + OCB_DIGEST_SIZE]
+      = { 0x68, 0x20, 0xb3, 0x65, 0x7b, 0x6f, 0x61, 0x5a,
+          0x57, 0x25, 0xbd, 0xa0, 0xd3, 0xb4, 0xeb, 0x3a,
+          0x25, 0x7c, 0x9a, 0xf1, 0xf8, 0xf0, 0x30, 0x09 };
+
+  const uint8_t ct40[40 + OCB_DIGEST_SIZE]
+      = { 0x44, 0x12, 0x92, 0x34, 0x93, 0xc5, 0x7d, 0x5d, 0xe0, 0xd7,
+          0x00, 0xf7, 0x53, 0xcc, 0xe0, 0xd1, 0xd2, 0xd9, 0x50, 0x60,
+          0x12, 0x2e, 0x9f, 0x15, 0xa5, 0xdd, 0xbf, 0xc5, 0x78, 0x7e,
+          0x50, 0xb5, 0xcc, 0x55, 0xee, 0x50, 0x7b, 0xcb, 0x08, 0x4e,
+          0x24, 0x0a, 0x35, 0x36, 0x49, 0x43, 0x2a, 0xc6, 0xc1, 0xbd,
+          0xa9, 0xac, 0xba, 0x93, 0xf5, 0x6d };
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)i;
+  for (i = 0; i < sizeof (message); ++i)
+    message[i] = (uint8_t)i;
+  aes128_ocb_set_key (&ctx, key);
+
+  if (aes128_ocb_seal (&ctx, nonce, sizeof (nonce), NULL, 0, NULL, NULL, 0,
+                       tag)
+      != 0)
+    return false;
+  hexdump (tag, sizeof (tag));
+  if (memcmp (tag, tag0, sizeof (tag)) != 0)
+    return false;
+
+  nonce[11] = 0x01;
+  if (aes128_ocb_seal (&ctx, nonce, sizeof (nonce), message, 8, message,
+                       buffer, 8, tag)
+      != 0)
+    return false;
+  hexdump (buffer, 8);
+  hexdump (tag, sizeof (tag));
+  if (memcmp (buffer, ct8, 8) != 0
+      || memcmp (tag, ct8 + 8, sizeof (tag)) != 0)
+    return false;
+
+  nonce[11] = 0x0f;
+  if (aes128_ocb_seal (&ctx, nonce, sizeof (nonce), message, 40, message,
+                       buffer, 40, tag)
+      != 0)
+    return false;
+  hexdump (buffer, 40);
+  hexdump (tag, sizeof (tag));
+  if (memcmp (buffer, ct40, 40) != 0
+      || memcmp (tag, ct40 + 40, sizeof (tag)) != 0)
+    return false;
+  if (aes128_ocb_open (&ctx, nonce, sizeof (nonce), message, 40, buffer,
+                       buffer, 40, tag)
+          != 0
+      || memcmp (buffer, message, 40) != 0)
+    return false;
+
+  return true;
+}
+
+#define OCB_ITERATIVE_SIZE (128 * (127 + 3 * OCB_DIGEST_SIZE))
+
+/*
+ * The iterative test from RFC 7253, Appendix A. It seals 384 messages with
+ * lengths from 0 to 127 bytes, with and without associated data, then
+ * authenticates the concatenation of all of the output.
+ */
+#define OCB_ITERATIVE_TEST(bits)                                              \
+  do                                                                          \
+    {                                                                         \
+      struct aes##bits##_ocb_ctx ctx;                                         \
+      uint8_t key[AES##bits##_KEY_SIZE];                                      \
+                                                                              \
+      memset (key, 0, sizeof (key));                                          \
+      key[sizeof (key) - 1] = 128;                                            \
+      aes##bits##_ocb_set_key (&ctx, key);                                    \
+      len = 0;                                                                \
+      for (i = 0; i < 128; ++i)                                               \
+        {                                                                     \
+          nonce[10] = (uint8_t)((3 * i + 1) >> 8);                            \
+          nonce[11] = (uint8_t)(3 * i + 1);                                   \
+          aes##bits##_ocb_seal (&ctx, nonce, sizeof (nonce), zeros, i,        \
+                                zeros, output + len, i, output + len + i);    \
+          len += i + OCB_DIGEST_SIZE;                                         \
+          nonce[10] = (uint8_t)((3 * i + 2) >> 8);                            \
+          nonce[11] = (uint8_t)(3 * i + 2);                                   \
+          aes##bits##_ocb_seal (&ctx, nonce, sizeof (nonce), NULL, 0, zeros,  \
+                                output + len, i, output + len + i);           \
+          len += i + OCB_DIGEST_SIZE;                                         \
+          nonce[10] = (uint8_t)((3 * i + 3) >> 8);                            \
+          nonce[11] = (uint8_t)(3 * i + 3);                                   \
+          aes##bits##_ocb_seal (&ctx, nonce, sizeof (nonce), zeros, i, NULL,  \
+                                NULL, 0, output + len);                       \
+          len += OCB_DIGEST_SIZE;                                             \
+        }                                                                     \
+      nonce[10] = (uint8_t)(385 >> 8);                                        \
+      nonce[11] = (uint8_t)385;                                               \
+      aes##bits##_ocb_seal (&ctx, nonce, sizeof (nonce), output, len, NULL,   \
+                            NULL, 0, tag);                                    \
+      hexdump (tag, sizeof (tag));                                            \
+      if (memcmp (tag, tag##bits, sizeof (tag)) != 0)                         \
+        return false;                                                         \
+    }                                                                         \
+  while (0)
+
+static bool
+run_aes_ocb_iterative_test (void)
+{
+  static uint8_t output[OCB_ITERATIVE_SIZE];
+  uint8_t zeros[128];
+  uint8_t nonce[OCB_NONCE_SIZE];
+  uint8_t tag[OCB_DIGEST_SIZE];
+  size_t i, len;
+
+  const uint8_t tag128[OCB_DIGEST_SIZE]
+      = { 0x67, 0xe9, 0x44, 0xd2, 0x32, 0x56, 0xc5, 0xe0,
+          0xb6, 0xc6, 0x1f, 0xa2, 0x2f, 0xdf, 0x1e, 0xa2 };
+
+  const uint8_t tag192[OCB_DIGEST_SIZE]
+      = { 0xf6, 0x73, 0xf2, 0xc3, 0xe7, 0x17, 0x4a, 0xae,
+          0x7b, 0xae, 0x98, 0x6c, 0xa9, 0xf2, 0x9e, 0x17 };
+
+  const uint8_t tag256[OCB_DIGEST_SIZE]
+      = { 0xd9, 0x0e, 0xb8, 0xe9, 0xc9, 0x77, 0xc8, 0x8b,
+          0x79, 0xdd, 0x79, 0x3d, 0x7f, 0xfa, 0x16, 0x1c };
+
+  memset (zeros, 0, sizeof (zeros));
+  memset (nonce, 0, sizeof (nonce));
+  OCB_ITERATIVE_TEST (128);
+  OCB_ITERATIVE_TEST (192);
+  OCB_ITERATIVE_TEST (256);
+  return true;
+}
+
+/*
+ * Round trips a long message with a short nonce, then checks that a
+ * corrupted tag is rejected with the output cleared and that invalid nonce
+ * lengths are refused.
+ */
+static bool
+run_aes128_ocb_open_test (void)
+{
+  struct aes128_ocb_ctx ctx;
+  uint8_t key[AES128_KEY_SIZE];
+  uint8_t nonce[OCB_MAX_NONCE_SIZE + 1];
+  uint8_t message[1000], buffer[1000];
+  uint8_t ad[37];
+  uint8_t tag[OCB_DIGEST_SIZE];
+
+  fill_message (key, sizeof (key));
+  fill_message (nonce, sizeof (nonce));
+  fill_message (message, sizeof (message));
+  fill_message (ad, sizeof (ad));
+  aes128_ocb_set_key (&ctx, key);
+
+  if (aes128_ocb_seal (&ctx, nonce, 1, ad, sizeof (ad), message, buffer,
+                       sizeof (buffer), tag)
+      != 0)
+    return false;
+  if (aes128_ocb_open (&ctx, nonce, 1, ad, sizeof (ad), buffer, buffer,
+                       sizeof (buffer), tag)
+          != 0
+      || memcmp (buffer, message, sizeof (buffer)) != 0)
+    return false;
+
+  aes128_ocb_seal (&ctx, nonce, 1, ad, sizeof (ad), message, buffer,
+                   sizeof (buffer), tag);
+  tag[OCB_DIGEST_SIZE - 1] ^= 0x80;
+  if (aes128_ocb_open (&ctx, nonce, 1, ad, sizeof (ad), buffer, buffer,
+                       sizeof (buffer), tag)
+      != -1)
+    return false;
+  memset (message, 0, sizeof (message));
+  if (memcmp (buffer, message, sizeof (buffer)) != 0)
+    return false;
+
+  errno = 0;
+  if (aes128_ocb_seal (&ctx, nonce, 0, NULL, 0, NULL, NULL, 0, tag) != -1
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (aes128_ocb_seal (&ctx, nonce, sizeof (nonce), NULL, 0, NULL, NULL, 0,
+                       tag)
+          != -1
+      || errno != EINVAL)
+    return false;
+
+  return true;
+}
+
+static void
+fill_message (uint8_t *message, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    message[i] = (uint8_t)(i * 7 + 1);
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
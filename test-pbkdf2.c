@@ -0,0 +1,209 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors are from RFC 6070 for PBKDF2-HMAC-SHA1 and RFC 7914 for
+ * PBKDF2-HMAC-SHA256. The PBKDF2-HMAC-SHA512 vectors and the long output
+ * were generated with Python's hashlib.pbkdf2_hmac.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pbkdf2.h"
+#include "sha256.h"
+
+struct pbkdf2_testcase
+{
+  const char *hash;
+  size_t passlen;
+  const char *pass;
+  size_t saltlen;
+  const char *salt;
+  uint64_t iterations;
+  size_t keylen;
+  const char *key;
+};
+
+static const struct pbkdf2_testcase testcases[] = {
+  { "sha1", 8, "password", 4, "salt", 1, 20,
+    "\x0c\x60\xc8\x0f\x96\x1f\x0e\x71\xf3\xa9\xb5\x24\xaf\x60\x12\x06"
+    "\x2f\xe0\x37\xa6" },
+  { "sha1", 8, "password", 4, "salt", 2, 20,
+    "\xea\x6c\x01\x4d\xc7\x2d\x6f\x8c\xcd\x1e\xd9\x2a\xce\x1d\x41\xf0"
+    "\xd8\xde\x89\x57" },
+  { "sha1", 8, "password", 4, "salt", 4096, 20,
+    "\x4b\x00\x79\x01\xb7\x65\x48\x9a\xbe\xad\x49\xd9\x26\xf7\x21\xd0"
+    "\x65\xa4\x29\xc1" },
+  { "sha1", 24, "passwordPASSWORDpassword", 36,
+    "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096, 25,
+    "\x3d\x2e\xec\x4f\xe4\x1c\x84\x9b\x80\xc8\xd8\x36\x62\xc0\xe4\x4a"
+    "\x8b\x29\x1a\x96\x4c\xf2\xf0\x70\x38" },
+  { "sha1", 9, "pass\0word", 5, "sa\0lt", 4096, 16,
+    "\x56\xfa\x6a\xa7\x55\x48\x09\x9d\xcc\x37\xd7\xf0\x34\x25\xe0\xc3" },
+  { "sha256", 6, "passwd", 4, "salt", 1, 64,
+    "\x55\xac\x04\x6e\x56\xe3\x08\x9f\xec\x16\x91\xc2\x25\x44\xb6\x05"
+    "\xf9\x41\x85\x21\x6d\xde\x04\x65\xe6\x8b\x9d\x57\xc2\x0d\xac\xbc"
+    "\x49\xca\x9c\xcc\xf1\x79\xb6\x45\x99\x16\x64\xb3\x9d\x77\xef\x31"
+    "\x7c\x71\xb8\x45\xb1\xe3\x0b\xd5\x09\x11\x20\x41\xd3\xa1\x97\x83" },
+  { "sha256", 8, "Password", 4, "NaCl", 80000, 64,
+    "\x4d\xdc\xd8\xf6\x0b\x98\xbe\x21\x83\x0c\xee\x5e\xf2\x27\x01\xf9"
+    "\x64\x1a\x44\x18\xd0\x4c\x04\x14\xae\xff\x08\x87\x6b\x34\xab\x56"
+    "\xa1\xd4\x25\xa1\x22\x58\x33\x54\x9a\xdb\x84\x1b\x51\xc9\xb3\x17"
+    "\x6a\x27\x2b\xde\xbb\xa1\xd0\x78\x47\x8f\x62\xb3\x97\xf3\x3c\x8d" },
+  { "sha512", 8, "password", 4, "salt", 1, 64,
+    "\x86\x7f\x70\xcf\x1a\xde\x02\xcf\xf3\x75\x25\x99\xa3\xa5\x3d\xc4"
+    "\xaf\x34\xc7\xa6\x69\x81\x5a\xe5\xd5\x13\x55\x4e\x1c\x8c\xf2\x52"
+    "\xc0\x2d\x47\x0a\x28\x5a\x05\x01\xba\xd9\x99\xbf\xe9\x43\xc0\x8f"
+    "\x05\x02\x35\xd7\xd6\x8b\x1d\xa5\x5e\x63\xf7\x3b\x60\xa5\x7f\xce" },
+  { "sha512", 8, "password", 4, "salt", 4096, 64,
+    "\xd1\x97\xb1\xb3\x3d\xb0\x14\x3e\x01\x8b\x12\xf3\xd1\xd1\x47\x9e"
+    "\x6c\xde\xbd\xcc\x97\xc5\xc0\xf8\x7f\x69\x02\xe0\x72\xf4\x57\xb5"
+    "\x14\x3f\x30\x60\x26\x41\xb3\xd5\x5c\xd3\x35\x98\x8c\xb3\x6b\x84"
+    "\x37\x60\x60\xec\xd5\x32\xe0\x39\xb7\x42\xa2\x39\x43\x4a\xf2\xd5" },
+  { "sha512", 24, "passwordPASSWORDpassword", 36,
+    "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096, 100,
+    "\x8c\x05\x11\xf4\xc6\xe5\x97\xc6\xac\x63\x15\xd8\xf0\x36\x2e\x22"
+    "\x5f\x3c\x50\x14\x95\xba\x23\xb8\x68\xc0\x05\x17\x4d\xc4\xee\x71"
+    "\x11\x5b\x59\xf9\xe6\x0c\xd9\x53\x2f\xa3\x3e\x0f\x75\xae\xfe\x30"
+    "\x22\x5c\x58\x3a\x18\x6c\xd8\x2b\xd4\xda\xea\x97\x24\xa3\xd3\xb8"
+    "\x04\xf7\x5b\xdd\x41\x49\x4f\xa3\x24\xca\xb2\x4b\xcc\x68\x0f\xb3"
+    "\xb9\x6a\x30\xcf\x5d\x21\xfa\xc3\xc2\x87\x59\x13\x91\x9f\x33\x99"
+    "\xb1\xd9\xce\x7e" },
+};
+
+static bool run_pbkdf2_testcase (const struct pbkdf2_testcase *);
+static bool run_pbkdf2_long_test (void);
+static bool run_pbkdf2_error_test (void);
+
+int
+main (void)
+{
+  size_t i;
+  int rv;
+
+  rv = 0;
+  for (i = 0; i < sizeof (testcases) / sizeof (testcases[0]); ++i)
+    {
+      if (!run_pbkdf2_testcase (&testcases[i]))
+        {
+          printf ("PBKDF2-HMAC-%s test %zu failed.\n", testcases[i].hash, i);
+          rv = 1;
+        }
+    }
+
+  if (!run_pbkdf2_long_test ())
+    {
+      printf ("PBKDF2 long output test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_pbkdf2_error_test ())
+    {
+      printf ("PBKDF2 error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static bool
+run_pbkdf2_testcase (const struct pbkdf2_testcase *test)
+{
+  uint8_t key[100];
+  int result;
+
+  if (strcmp (test->hash, "sha1") == 0)
+    result = pbkdf2_hmac_sha1 (key, test->keylen, test->pass, test->passlen,
+                               (const uint8_t *)test->salt, test->saltlen,
+                               test->iterations);
+  else if (strcmp (test->hash, "sha256") == 0)
+    result = pbkdf2_hmac_sha256 (key, test->keylen, test->pass,
+                                 test->passlen, (const uint8_t *)test->salt,
+                                 test->saltlen, test->iterations);
+  else
+    result = pbkdf2_hmac_sha512 (key, test->keylen, test->pass,
+                                 test->passlen, (const uint8_t *)test->salt,
+                                 test->saltlen, test->iterations);
+
+  return result == 0 && memcmp (key, test->key, test->keylen) == 0;
+}
+
+/*
+ * An output of twenty blocks, less a few bytes, fills every lane of the
+ * multi-buffer SHA-256 code and then finishes with single blocks. The
+ * expected value is the SHA-256 of the output. Each prefix must match the
+ * shorter outputs too, which take the other path for the same blocks.
+ */
+static bool
+run_pbkdf2_long_test (void)
+{
+  static const uint8_t expect[SHA256_DIGEST_SIZE]
+      = "\xde\xaa\x1a\xec\x16\x62\x70\xdf\x56\xaf\x17\xb2\x52\xae\x68\x87"
+        "\x32\x2d\x83\x3b\x42\xc0\x18\x6d\xd2\x9d\x27\xc1\xdf\x43\xa3\x10";
+  static uint8_t key[20 * SHA256_DIGEST_SIZE - 5];
+  uint8_t digest[SHA256_DIGEST_SIZE];
+  uint8_t prefix[3 * SHA256_DIGEST_SIZE];
+  size_t len;
+  bool ok;
+
+  if (pbkdf2_hmac_sha256 (key, sizeof (key), "lanes", 5,
+                          (const uint8_t *)"pbkdf2", 6, 1000)
+      != 0)
+    return false;
+  sha256 (digest, key, sizeof (key));
+  ok = memcmp (digest, expect, sizeof (digest)) == 0;
+
+  for (len = 1; len <= sizeof (prefix); len += 19)
+    {
+      pbkdf2_hmac_sha256 (prefix, len, "lanes", 5,
+                          (const uint8_t *)"pbkdf2", 6, 1000);
+      ok = ok && memcmp (prefix, key, len) == 0;
+    }
+
+  return ok;
+}
+
+static bool
+run_pbkdf2_error_test (void)
+{
+  uint8_t key[SHA256_DIGEST_SIZE];
+
+  errno = 0;
+  if (pbkdf2_hmac_sha256 (key, sizeof (key), "p", 1, (const uint8_t *)"s",
+                          1, 0)
+          != -1
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  return pbkdf2_hmac_sha1 (key, sizeof (key), "p", 1, (const uint8_t *)"s",
+                           1, 0)
+             == -1
+         && errno == EINVAL;
+}
@@ -0,0 +1,364 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Tests for Poly1305. The first cases are from RFC 8439 section 2.5.2 and
+ * appendix A.3, which cover the corner cases of the reduction. The others
+ * hash generated messages long enough to use the vector code, including
+ * all ones messages under the largest clamped r.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "poly1305.h"
+
+struct poly1305_testcase
+{
+  uint8_t key[POLY1305_KEY_SIZE];
+  const uint8_t *input;
+  size_t len;
+  uint8_t tag[POLY1305_DIGEST_SIZE];
+};
+
+/* Messages are either the byte i * 31 + 5 at index i or all ones. */
+struct poly1305_long_testcase
+{
+  size_t len;
+  int ones;
+  uint8_t tag[POLY1305_DIGEST_SIZE];
+};
+
+static const uint8_t poly1305_input_0[34] = {
+  0x43, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x69, 0x63, 0x20, 0x46, 0x6f, 0x72, 0x75, 0x6d, 0x20, 0x52, 0x65,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x47, 0x72, 0x6f, 0x75,
+  0x70
+};
+
+static const uint8_t poly1305_input_1[16] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t poly1305_input_2[16] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const uint8_t poly1305_input_3[48] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static const uint8_t poly1305_input_4[48] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01
+};
+
+static const uint8_t poly1305_input_5[16] = {
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t poly1305_input_6[64] = {
+  0xe3, 0x35, 0x94, 0xd7, 0x50, 0x5e, 0x43, 0xb9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x94, 0xd7, 0x50, 0x5e, 0x43,
+  0x79, 0xcd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const uint8_t poly1305_input_7[48] = {
+  0xe3, 0x35, 0x94, 0xd7, 0x50, 0x5e, 0x43, 0xb9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x94, 0xd7, 0x50, 0x5e, 0x43,
+  0x79, 0xcd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static const struct poly1305_testcase testcases[] = {
+  { {
+      0x85, 0xd6, 0xbe, 0x78, 0x57, 0x55, 0x6d, 0x33, 0x7f, 0x44, 0x52,
+      0xfe, 0x42, 0xd5, 0x06, 0xa8, 0x01, 0x03, 0x80, 0x8a, 0xfb, 0x0d,
+      0xb2, 0xfd, 0x4a, 0xbf, 0xf6, 0xaf, 0x41, 0x49, 0xf5, 0x1b
+    },
+    poly1305_input_0,
+    34,
+    {
+      0xa8, 0x06, 0x1d, 0xc1, 0x30, 0x51, 0x36, 0xc6, 0xc2, 0x2b, 0x8b,
+      0xaf, 0x0c, 0x01, 0x27, 0xa9
+    } },
+  { {
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    poly1305_input_1,
+    16,
+    {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00
+    } },
+  { {
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    },
+    poly1305_input_2,
+    16,
+    {
+      0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00
+    } },
+  { {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    poly1305_input_3,
+    48,
+    {
+      0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00
+    } },
+  { {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    poly1305_input_4,
+    48,
+    {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00
+    } },
+  { {
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    poly1305_input_5,
+    16,
+    {
+      0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff
+    } },
+  { {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    poly1305_input_6,
+    64,
+    {
+      0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00
+    } },
+  { {
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    poly1305_input_7,
+    48,
+    {
+      0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00
+    } },
+};
+
+static const uint8_t poly1305_long_key[POLY1305_KEY_SIZE] = {
+  0x07, 0x14, 0x21, 0x2e, 0x3b, 0x48, 0x55, 0x62, 0x6f, 0x7c, 0x89,
+  0x96, 0xa3, 0xb0, 0xbd, 0xca, 0xd7, 0xe4, 0xf1, 0xfe, 0x0b, 0x18,
+  0x25, 0x32, 0x3f, 0x4c, 0x59, 0x66, 0x73, 0x80, 0x8d, 0x9a
+};
+
+static const struct poly1305_long_testcase long_testcases[] = {
+  { 0, 0, {
+    0xd7, 0xe4, 0xf1, 0xfe, 0x0b, 0x18, 0x25, 0x32, 0x3f, 0x4c, 0x59,
+    0x66, 0x73, 0x80, 0x8d, 0x9a
+  } },
+  { 1, 0, {
+    0x04, 0x50, 0xab, 0x66, 0x32, 0xb9, 0x17, 0x93, 0x5d, 0x26, 0x85,
+    0x10, 0x9a, 0x93, 0xf2, 0x8d
+  } },
+  { 15, 0, {
+    0x7d, 0xe4, 0xd4, 0xec, 0x7b, 0x6f, 0xb0, 0xf6, 0x15, 0x3b, 0xca,
+    0xe7, 0x45, 0xc3, 0xd1, 0x56
+  } },
+  { 16, 0, {
+    0x99, 0x24, 0x30, 0x4b, 0x1e, 0x3c, 0x08, 0x4f, 0x44, 0x94, 0xc2,
+    0x5e, 0x00, 0xa9, 0x6a, 0x42
+  } },
+  { 17, 0, {
+    0xf6, 0xa5, 0x8d, 0xcd, 0x15, 0x9c, 0xc1, 0x4d, 0x76, 0x78, 0x59,
+    0xf4, 0x7c, 0x4d, 0xe3, 0x8f
+  } },
+  { 63, 0, {
+    0xa0, 0x30, 0x11, 0x2e, 0x0e, 0x4d, 0x04, 0xdf, 0x3f, 0x7f, 0x9a,
+    0x93, 0x62, 0x10, 0x93, 0x5a
+  } },
+  { 64, 0, {
+    0x0c, 0xb0, 0x1c, 0x69, 0xc3, 0x1c, 0xd0, 0xe6, 0x44, 0x9f, 0x0a,
+    0x89, 0xb7, 0x80, 0xa7, 0xf3
+  } },
+  { 255, 0, {
+    0x05, 0x9a, 0xb2, 0xda, 0xdf, 0xe8, 0x35, 0x03, 0x3f, 0xcd, 0x2c,
+    0x71, 0x2b, 0xf3, 0x77, 0xb7
+  } },
+  { 256, 0, {
+    0xb6, 0x6f, 0x28, 0x9a, 0x26, 0x5f, 0xbc, 0xcb, 0x25, 0xe4, 0xa7,
+    0x68, 0xb2, 0xaa, 0xe7, 0x13
+  } },
+  { 257, 0, {
+    0xf8, 0x30, 0xe8, 0xe6, 0x75, 0xbe, 0x75, 0x57, 0xfd, 0x77, 0x4b,
+    0xbc, 0xc5, 0x25, 0x58, 0x2b
+  } },
+  { 1000, 0, {
+    0x56, 0x4e, 0xed, 0x65, 0x39, 0x5f, 0x64, 0xb6, 0x7d, 0x45, 0xfe,
+    0x3e, 0xcc, 0xb6, 0xf3, 0xf0
+  } },
+  { 4096, 0, {
+    0x78, 0x85, 0x79, 0xff, 0xf3, 0x25, 0xbc, 0x0a, 0x10, 0x23, 0xad,
+    0xf5, 0x30, 0x9d, 0xa8, 0xe2
+  } },
+  { 4103, 0, {
+    0x01, 0xc6, 0xe2, 0x58, 0x7e, 0xf6, 0xf0, 0x99, 0x1e, 0x97, 0x4f,
+    0x0c, 0xeb, 0x72, 0xa5, 0x63
+  } },
+  { 256, 1, {
+    0xc3, 0x0c, 0x8c, 0x6a, 0x3a, 0xf3, 0x5f, 0xc6, 0x64, 0x5a, 0x7e,
+    0x3a, 0x51, 0xdf, 0x3f, 0x04
+  } },
+  { 4096, 1, {
+    0x28, 0x27, 0x27, 0x9b, 0x4c, 0x1d, 0x3e, 0x6b, 0x93, 0x28, 0x62,
+    0x38, 0x19, 0x9e, 0x13, 0x1a
+  } },
+  { 4112, 1, {
+    0xd1, 0x81, 0x46, 0x0f, 0xdd, 0xe4, 0x5c, 0xb8, 0xcf, 0x36, 0x7e,
+    0x0a, 0xd8, 0xac, 0xc4, 0x64
+  } },
+  { 65584, 1, {
+    0x08, 0xf3, 0xce, 0x3b, 0xfe, 0x68, 0x5d, 0x8b, 0xf1, 0x85, 0xf2,
+    0xac, 0xc2, 0x36, 0xeb, 0xa1
+  } },
+};
+
+static bool run_poly1305_testcase (const struct poly1305_testcase *);
+static bool run_poly1305_long_testcase (const struct poly1305_long_testcase *);
+static void hexdump (const uint8_t *, size_t);
+
+int
+main (void)
+{
+  size_t i;
+  int rv;
+
+  rv = 0;
+  for (i = 0; i < sizeof (testcases) / sizeof (testcases[0]); ++i)
+    {
+      if (!run_poly1305_testcase (&testcases[i]))
+        {
+          printf ("Poly1305 test %zu failed.\n", i);
+          rv = 1;
+        }
+    }
+  for (i = 0; i < sizeof (long_testcases) / sizeof (long_testcases[0]); ++i)
+    {
+      if (!run_poly1305_long_testcase (&long_testcases[i]))
+        {
+          printf ("Poly1305 long test %zu failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  return rv;
+}
+
+static bool
+run_poly1305_testcase (const struct poly1305_testcase *test)
+{
+  uint8_t tag[POLY1305_DIGEST_SIZE];
+
+  poly1305 (tag, test->input, test->key, test->len);
+  hexdump (tag, sizeof (tag));
+
+  return memcmp (tag, test->tag, sizeof (tag)) == 0;
+}
+
+static bool
+run_poly1305_long_testcase (const struct poly1305_long_testcase *test)
+{
+  static const uint8_t ones_key[POLY1305_KEY_SIZE]
+      = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+          0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+          0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+  struct poly1305_ctx ctx;
+  const uint8_t *key;
+  uint8_t tag[POLY1305_DIGEST_SIZE], incremental[POLY1305_DIGEST_SIZE];
+  uint8_t *input;
+  size_t i, n;
+
+  input = malloc (test->len + 1);
+  if (input == NULL)
+    return false;
+  for (i = 0; i < test->len; ++i)
+    input[i] = test->ones ? 0xff : (uint8_t)(i * 31 + 5);
+  key = test->ones ? ones_key : poly1305_long_key;
+
+  poly1305 (tag, input, key, test->len);
+  hexdump (tag, sizeof (tag));
+
+  /* Absorb the input in pieces of 1, 2, 4... bytes up to 1024. */
+  poly1305_init (&ctx, key);
+  for (i = 0, n = 1; i < test->len; i += n, n = n < 1024 ? n * 2 : 1)
+    poly1305_update (&ctx, input + i, n < test->len - i ? n : test->len - i);
+  poly1305_final (incremental, &ctx);
+
+  free (input);
+  return memcmp (tag, test->tag, sizeof (tag)) == 0
+         && memcmp (incremental, test->tag, sizeof (incremental)) == 0;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
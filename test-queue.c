@@ -0,0 +1,227 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fcrypt_cipher.h"
+#include "fcrypt_hash.h"
+#include "fcrypt_queue.h"
+
+#define JOB_COUNT 2000
+#define BIG_SIZE (3 * FCRYPT_QUEUE_SPLIT_SIZE + 5)
+
+static bool run_queue_jobs_test (unsigned int, size_t);
+static bool run_queue_error_test (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!run_queue_jobs_test (1, 8) || !run_queue_jobs_test (4, 256))
+    {
+      printf ("Queue jobs test failed.\n");
+      rv = 1;
+    }
+  if (!run_queue_error_test ())
+    {
+      printf ("Queue error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static unsigned long done_count;
+
+static void
+count_done (struct fcrypt_job *job)
+{
+  (void)job;
+  __atomic_add_fetch (&done_count, 1, __ATOMIC_RELAXED);
+}
+
+/* Fills in job i, a mix of short and long hashes and CTR encryptions. */
+static void
+make_job (struct fcrypt_job *job, size_t i, const uint8_t *data,
+          const uint8_t *big, const uint8_t *key, uint8_t *output)
+{
+  static const char *const hashes[] = { "sha256", "md5", "sha1", "blake2b" };
+  static const char *const ciphers[] = { "aes128", "camellia256", "aes256" };
+
+  memset (job, 0, sizeof (*job));
+  job->output = output;
+  job->done = count_done;
+  if (i % 500 == 7)
+    {
+      job->cipher = fcrypt_cipher_lookup (ciphers[i % 3]);
+      job->key = key;
+      memset (job->iv, 0xff, sizeof (job->iv));
+      job->iv[0] = (uint8_t)i;
+      job->input = big;
+      job->len = BIG_SIZE;
+    }
+  else if (i % 5 == 4)
+    {
+      job->cipher = fcrypt_cipher_lookup (ciphers[i % 3]);
+      job->key = key + i % 8;
+      job->iv[15] = (uint8_t)i;
+      job->input = data + i % 64;
+      job->len = i % 700;
+    }
+  else
+    {
+      job->hash = fcrypt_hash_lookup (hashes[i % 4]);
+      job->input = data + i % 32;
+      job->len = i % 3 == 0 ? (i * 37) % 9000 : i % 200;
+    }
+}
+
+/* Checks the output of a job against the functions it should call. */
+static bool
+check_job (const struct fcrypt_job *job, uint8_t *scratch, void *ctx)
+{
+  uint8_t ctr[FCRYPT_CIPHER_MAX_BLOCK_SIZE];
+
+  if (job->hash != NULL)
+    {
+      job->hash->digest (scratch, job->input, job->len);
+      return memcmp (scratch, job->output, job->hash->digest_size) == 0;
+    }
+  job->cipher->set_key (ctx, job->key);
+  memcpy (ctr, job->iv, sizeof (ctr));
+  job->cipher->ctr_crypt (ctx, ctr, job->input, scratch, job->len);
+  return memcmp (scratch, job->output, job->len) == 0;
+}
+
+static bool
+run_queue_jobs_test (unsigned int threads, size_t capacity)
+{
+  static struct fcrypt_job jobs[JOB_COUNT];
+  static uint8_t data[16384];
+  static uint8_t key[64];
+  static uint64_t ctx[1024];
+  struct fcrypt_queue *queue;
+  uint8_t *big, *outputs, *output, *scratch;
+  bool retval;
+  size_t i;
+
+  big = malloc (BIG_SIZE);
+  outputs = malloc ((size_t)JOB_COUNT * 1024 + 4 * BIG_SIZE);
+  scratch = malloc (BIG_SIZE);
+  queue = fcrypt_queue_new (threads, capacity);
+  if (big == NULL || outputs == NULL || scratch == NULL || queue == NULL)
+    return false;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 131 + 7);
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 29 + 3);
+  for (i = 0; i < BIG_SIZE; ++i)
+    big[i] = (uint8_t)(i * 7 + i / 4096);
+
+  /* Submit from one thread, waiting for room whenever the ring is full. */
+  done_count = 0;
+  for (i = 0; i < JOB_COUNT; ++i)
+    {
+      /* Each long job needs BIG_SIZE bytes of output after its slot. */
+      output = outputs + i * 1024 + (i + 492) / 500 * BIG_SIZE;
+      make_job (&jobs[i], i, data, big, key, output);
+      while (fcrypt_queue_submit (queue, &jobs[i]) != 0)
+        {
+          if (errno != EAGAIN)
+            return false;
+          fcrypt_queue_wait (queue);
+        }
+    }
+  fcrypt_queue_wait (queue);
+
+  retval = __atomic_load_n (&done_count, __ATOMIC_RELAXED) == JOB_COUNT;
+  for (i = 0; i < JOB_COUNT && retval; ++i)
+    if (!check_job (&jobs[i], scratch, ctx))
+      {
+        printf ("Job %zu with %u threads is wrong.\n", i, threads);
+        retval = false;
+      }
+
+  fcrypt_queue_free (queue);
+  free (big);
+  free (outputs);
+  free (scratch);
+  return retval;
+}
+
+static bool
+run_queue_error_test (void)
+{
+  struct fcrypt_queue *queue;
+  struct fcrypt_job job;
+  uint8_t digest[FCRYPT_HASH_MAX_DIGEST_SIZE];
+  bool retval;
+
+  errno = 0;
+  if (fcrypt_queue_new (0, 16) != NULL || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_queue_new (1, 0) != NULL || errno != EINVAL)
+    return false;
+
+  queue = fcrypt_queue_new (2, 16);
+  if (queue == NULL)
+    return false;
+
+  retval = true;
+  memset (&job, 0, sizeof (job));
+  job.input = "abc";
+  job.len = 3;
+  job.output = digest;
+  job.done = count_done;
+
+  /* Neither a hash nor a cipher, and then both. */
+  errno = 0;
+  if (fcrypt_queue_submit (queue, &job) != -1 || errno != EINVAL)
+    retval = false;
+  job.hash = &fcrypt_hash_sha256;
+  job.cipher = &fcrypt_cipher_aes128;
+  errno = 0;
+  if (fcrypt_queue_submit (queue, &job) != -1 || errno != EINVAL)
+    retval = false;
+
+  /* A cipher without a key. */
+  job.hash = NULL;
+  errno = 0;
+  if (fcrypt_queue_submit (queue, &job) != -1 || errno != EINVAL)
+    retval = false;
+
+  fcrypt_queue_free (queue);
+  return retval;
+}
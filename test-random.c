@@ -0,0 +1,158 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * The output can't be compared with known values, so these tests check that
+ * requests of every size are filled exactly, that the bytes look uniform,
+ * and that a forked child doesn't repeat its parent's output.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "fcrypt_random.h"
+
+static bool run_random_sizes_test (void);
+static bool run_random_distribution_test (void);
+static bool run_random_fork_test (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!run_random_sizes_test ())
+    {
+      printf ("Random sizes test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_random_distribution_test ())
+    {
+      printf ("Random distribution test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_random_fork_test ())
+    {
+      printf ("Random fork test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+/*
+ * Each request must write exactly its length, and two requests of the same
+ * length must differ. The sizes cover the buffer and direct paths.
+ */
+static bool
+run_random_sizes_test (void)
+{
+  static uint8_t a[5000], b[5000];
+  size_t len, i;
+
+  for (len = 0; len < sizeof (a) - 1; len += len < 100 ? 1 : 97)
+    {
+      memset (a, 0xa5, sizeof (a));
+      memset (b, 0xa5, sizeof (b));
+      if (fcrypt_random (a, len) != 0 || fcrypt_random (b, len) != 0)
+        return false;
+      for (i = len; i < sizeof (a); ++i)
+        if (a[i] != 0xa5 || b[i] != 0xa5)
+          return false;
+      if (len >= 16 && memcmp (a, b, len) == 0)
+        return false;
+    }
+  return true;
+}
+
+/*
+ * Counts the byte values of several megabytes taken in small pieces, which
+ * also crosses the reseed interval a few times. Each value is expected 4096
+ * times per megabyte, with a standard deviation of 64, and the bounds are
+ * far enough out that a correct generator never fails.
+ */
+static bool
+run_random_distribution_test (void)
+{
+  static uint8_t buf[4 * 1024 * 1024];
+  size_t counts[256];
+  size_t i;
+
+  for (i = 0; i < sizeof (buf); i += 61)
+    if (fcrypt_random (buf + i,
+                       sizeof (buf) - i < 61 ? sizeof (buf) - i : 61)
+        != 0)
+      return false;
+
+  memset (counts, 0, sizeof (counts));
+  for (i = 0; i < sizeof (buf); ++i)
+    ++counts[buf[i]];
+  for (i = 0; i < 256; ++i)
+    if (counts[i] < 4 * (4096 - 640) || counts[i] > 4 * (4096 + 640))
+      return false;
+  return true;
+}
+
+static bool
+run_random_fork_test (void)
+{
+  uint8_t parent[32], child[32];
+  int fds[2], status;
+  pid_t pid;
+
+  /* Make sure the generator is seeded and has bytes buffered. */
+  if (fcrypt_random (parent, 1) != 0 || pipe (fds) != 0)
+    return false;
+
+  pid = fork ();
+  if (pid < 0)
+    return false;
+  if (pid == 0)
+    {
+      close (fds[0]);
+      if (fcrypt_random (child, sizeof (child)) != 0
+          || write (fds[1], child, sizeof (child)) != sizeof (child))
+        _exit (1);
+      _exit (0);
+    }
+
+  close (fds[1]);
+  if (fcrypt_random (parent, sizeof (parent)) != 0
+      || read (fds[0], child, sizeof (child)) != sizeof (child))
+    return false;
+  close (fds[0]);
+  if (waitpid (pid, &status, 0) != pid || !WIFEXITED (status)
+      || WEXITSTATUS (status) != 0)
+    return false;
+  return memcmp (parent, child, sizeof (parent)) != 0;
+}
@@ -109,6 +109,11 @@ run_rmd128_testcase (const struct rmd128_testcase *test)
     printf ("%02x", digest[i]);
   printf ("\n");
 
+  if (memcmp (digest, test->hash, RMD128_DIGEST_SIZE) != 0)
+    return false;
+
+  /* The one-shot function must agree with init, update and final. */
+  rmd128 (digest, test->message, strlen (test->message));
   return memcmp (digest, test->hash, RMD128_DIGEST_SIZE) == 0;
 }
 
@@ -34,6 +34,7 @@
 #include <string.h>
 
 #include "rmd160.h"
+#include "sha256.h"
 
 struct rmd160_testcase
 {
@@ -67,6 +68,7 @@ static const struct rmd160_testcase testcases[]
 
 static bool run_rmd160_testcase (const struct rmd160_testcase *);
 static bool run_rmd160_test1mb (void);
+static bool run_hash160_tests (void);
 
 int
 main (void)
@@ -92,6 +94,12 @@ main (void)
       rv = 1;
     }
 
+  if (!run_hash160_tests ())
+    {
+      fprintf (stderr, "HASH160 tests failed.\n");
+      rv = 1;
+    }
+
   return rv;
 }
 
@@ -110,6 +118,11 @@ run_rmd160_testcase (const struct rmd160_testcase *test)
     printf ("%02x", digest[i]);
   printf ("\n");
 
+  if (memcmp (digest, test->hash, RMD160_DIGEST_SIZE) != 0)
+    return false;
+
+  /* The one-shot function must agree with init, update and final. */
+  rmd160 (digest, test->message, strlen (test->message));
   return memcmp (digest, test->hash, RMD160_DIGEST_SIZE) == 0;
 }
 
@@ -142,3 +155,45 @@ run_rmd160_test1mb (void)
   free (ptr);
   return memcmp (digest, expected, RMD160_DIGEST_SIZE) == 0;
 }
+
+/* Checks the fixed-length and fused functions against the general ones, at
+   several alignments, and HASH160 against a known public key. */
+static bool
+run_hash160_tests (void)
+{
+  uint8_t input[33 + 8];
+  uint8_t inner[SHA256_DIGEST_SIZE];
+  uint8_t digest[RMD160_DIGEST_SIZE];
+  uint8_t expected[RMD160_DIGEST_SIZE];
+  size_t i, offset;
+  static const uint8_t pubkey[33]
+      = "\x02\x79\xbe\x66\x7e\xf9\xdc\xbb\xac\x55\xa0"
+        "\x62\x95\xce\x87\x0b\x07\x02\x9b\xfc\xdb\x2d"
+        "\xce\x28\xd9\x59\xf2\x81\x5b\x16\xf8\x17\x98";
+  static const uint8_t pubkey_hash[RMD160_DIGEST_SIZE]
+      = "\x75\x1e\x76\xe8\x19\x91\x96\xd4\x54\x94"
+        "\x1c\x45\xd1\xb3\xa3\x23\xf1\x43\x3b\xd6";
+
+  hash160 (digest, pubkey, sizeof (pubkey));
+  if (memcmp (digest, pubkey_hash, RMD160_DIGEST_SIZE) != 0)
+    return false;
+
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = (uint8_t) (i * 7 + 1);
+
+  for (offset = 0; offset < 8; ++offset)
+    {
+      rmd160 (expected, input + offset, 32);
+      rmd160_32 (digest, input + offset);
+      if (memcmp (digest, expected, RMD160_DIGEST_SIZE) != 0)
+        return false;
+
+      sha256 (inner, input + offset, 33);
+      rmd160 (expected, inner, sizeof (inner));
+      hash160 (digest, input + offset, 33);
+      if (memcmp (digest, expected, RMD160_DIGEST_SIZE) != 0)
+        return false;
+    }
+
+  return true;
+}
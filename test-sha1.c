@@ -66,6 +66,8 @@ static const struct sha1_testcase testcases[]
 
 static void hexdump (const uint8_t *, size_t);
 static bool run_sha1_testcase (const struct sha1_testcase *);
+static bool run_sha1_multi_test (void);
+static bool run_sha1_million_test (void);
 
 int
 main (void)
@@ -85,6 +87,18 @@ main (void)
         }
     }
 
+  if (!run_sha1_multi_test ())
+    {
+      printf ("SHA-1 multi-buffer test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_sha1_million_test ())
+    {
+      printf ("SHA-1 million 'a' test failed.\n");
+      rv = 1;
+    }
+
   return rv;
 }
 
@@ -112,5 +126,82 @@ run_sha1_testcase (const struct sha1_testcase *test)
   if (memcmp (digest, test->hash, SHA1_DIGEST_SIZE) != 0)
     return false;
 
+  /* The one-shot function must agree with init, update and final. */
+  sha1 (digest, test->message, strlen (test->message));
+  return memcmp (digest, test->hash, SHA1_DIGEST_SIZE) == 0;
+}
+
+/*
+ * Compares sha1_multi with hashing each message on its own. The lengths
+ * cover the padding boundaries and messages of very different length, so
+ * lanes are refilled and finished one at a time.
+ */
+static bool
+run_sha1_multi_test (void)
+{
+  static uint8_t data[8192];
+  static const size_t sizes[]
+      = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 127, 128, 1000, 4096, 8192 };
+  const uint8_t *messages[67];
+  size_t lens[67];
+  uint8_t digests[67 * SHA1_DIGEST_SIZE];
+  uint8_t digest[SHA1_DIGEST_SIZE];
+  size_t i, n;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 131 + 17);
+
+  for (n = 1; n <= 67; n += 11)
+    {
+      for (i = 0; i < n; ++i)
+        {
+          lens[i] = i < 14 ? sizes[i] : (i * 997) % sizeof (data);
+          messages[i] = data + (sizeof (data) - lens[i]) / (i % 3 + 1);
+        }
+      sha1_multi (digests, messages, lens, n);
+      for (i = 0; i < n; ++i)
+        {
+          sha1 (digest, messages[i], lens[i]);
+          if (memcmp (digest, digests + i * SHA1_DIGEST_SIZE, SHA1_DIGEST_SIZE)
+              != 0)
+            return false;
+        }
+    }
+
   return true;
 }
+
+/*
+ * The third test of RFC 3174, one million repetitions of 'a'. Hashed in one
+ * call it runs the compression over many blocks at once, and fed in odd
+ * sized pieces it also goes through the partial block buffer.
+ */
+static bool
+run_sha1_million_test (void)
+{
+  static const uint8_t expect[SHA1_DIGEST_SIZE]
+      = { 0x34, 0xaa, 0x97, 0x3c, 0xd4, 0xc4, 0xda, 0xa4, 0xf6, 0x1e,
+          0xeb, 0x2b, 0xdb, 0xad, 0x27, 0x31, 0x65, 0x34, 0x01, 0x6f };
+  struct sha1_ctx ctx;
+  uint8_t digest[SHA1_DIGEST_SIZE];
+  uint8_t *data;
+  size_t off;
+  bool ok;
+
+  data = malloc (1000000);
+  if (data == NULL)
+    return false;
+  memset (data, 'a', 1000000);
+
+  sha1 (digest, data, 1000000);
+  ok = memcmp (digest, expect, SHA1_DIGEST_SIZE) == 0;
+
+  sha1_init (&ctx);
+  for (off = 0; off < 1000000; off += 999)
+    sha1_update (&ctx, data + off, 1000000 - off < 999 ? 1000000 - off : 999);
+  sha1_final (digest, &ctx);
+  ok = ok && memcmp (digest, expect, SHA1_DIGEST_SIZE) == 0;
+
+  free (data);
+  return ok;
+}
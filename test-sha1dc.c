@@ -0,0 +1,275 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors are from RFC 3174. Messages without a collision attack must
+ * hash exactly like SHA-1 and must not be reported. The colliding pair is
+ * the first 320 bytes of the SHAttered PDFs, https://shattered.io.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sha1.h"
+#include "sha1dc.h"
+
+struct sha1dc_testcase
+{
+  const char *message;
+  const char *hash;
+};
+
+static const struct sha1dc_testcase testcases[]
+    = { { "abc", "\xa9\x99\x3e\x36\x47\x06\x81\x6a\xba\x3e"
+                 "\x25\x71\x78\x50\xc2\x6c\x9c\xd0\xd8\x9d" },
+        { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+          "\x84\x98\x3e\x44\x1c\x3b\xd2\x6e\xba\xae\x4a\xa1\xf9\x51\x29\xe5"
+          "\xe5\x46\x70\xf1" },
+        { "01234567012345670123456701234567"
+          "01234567012345670123456701234567",
+          "\xe0\xc0\x94\xe8\x67\xef\x46\xc3\x50\xef\x54\xa7\xf5\x9d\xd6\x0b"
+          "\xed\x92\xae\x83" } };
+
+/* The PDF header and JPEG start shared by both files. */
+static const uint8_t shattered_prefix[] = {
+  0x25, 0x50, 0x44, 0x46, 0x2d, 0x31, 0x2e, 0x33, 0x0a, 0x25, 0xe2, 0xe3,
+  0xcf, 0xd3, 0x0a, 0x0a, 0x0a, 0x31, 0x20, 0x30, 0x20, 0x6f, 0x62, 0x6a,
+  0x0a, 0x3c, 0x3c, 0x2f, 0x57, 0x69, 0x64, 0x74, 0x68, 0x20, 0x32, 0x20,
+  0x30, 0x20, 0x52, 0x2f, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x33,
+  0x20, 0x30, 0x20, 0x52, 0x2f, 0x54, 0x79, 0x70, 0x65, 0x20, 0x34, 0x20,
+  0x30, 0x20, 0x52, 0x2f, 0x53, 0x75, 0x62, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x35, 0x20, 0x30, 0x20, 0x52, 0x2f, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72,
+  0x20, 0x36, 0x20, 0x30, 0x20, 0x52, 0x2f, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
+  0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x37, 0x20, 0x30, 0x20, 0x52, 0x2f,
+  0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x38, 0x20, 0x30, 0x20, 0x52,
+  0x2f, 0x42, 0x69, 0x74, 0x73, 0x50, 0x65, 0x72, 0x43, 0x6f, 0x6d, 0x70,
+  0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x38, 0x3e, 0x3e, 0x0a, 0x73, 0x74,
+  0x72, 0x65, 0x61, 0x6d, 0x0a, 0xff, 0xd8, 0xff, 0xfe, 0x00, 0x24, 0x53,
+  0x48, 0x41, 0x2d, 0x31, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x61, 0x64,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x85, 0x2f, 0xec, 0x09, 0x23, 0x39, 0x75,
+  0x9c, 0x39, 0xb1, 0xa1, 0xc6, 0x3c, 0x4c, 0x97, 0xe1, 0xff, 0xfe, 0x01,
+};
+
+/* The near-collision blocks of shattered-1.pdf. */
+static const uint8_t shattered_1[] = {
+  0x7f, 0x46, 0xdc, 0x93, 0xa6, 0xb6, 0x7e, 0x01, 0x3b, 0x02, 0x9a, 0xaa,
+  0x1d, 0xb2, 0x56, 0x0b, 0x45, 0xca, 0x67, 0xd6, 0x88, 0xc7, 0xf8, 0x4b,
+  0x8c, 0x4c, 0x79, 0x1f, 0xe0, 0x2b, 0x3d, 0xf6, 0x14, 0xf8, 0x6d, 0xb1,
+  0x69, 0x09, 0x01, 0xc5, 0x6b, 0x45, 0xc1, 0x53, 0x0a, 0xfe, 0xdf, 0xb7,
+  0x60, 0x38, 0xe9, 0x72, 0x72, 0x2f, 0xe7, 0xad, 0x72, 0x8f, 0x0e, 0x49,
+  0x04, 0xe0, 0x46, 0xc2, 0x30, 0x57, 0x0f, 0xe9, 0xd4, 0x13, 0x98, 0xab,
+  0xe1, 0x2e, 0xf5, 0xbc, 0x94, 0x2b, 0xe3, 0x35, 0x42, 0xa4, 0x80, 0x2d,
+  0x98, 0xb5, 0xd7, 0x0f, 0x2a, 0x33, 0x2e, 0xc3, 0x7f, 0xac, 0x35, 0x14,
+  0xe7, 0x4d, 0xdc, 0x0f, 0x2c, 0xc1, 0xa8, 0x74, 0xcd, 0x0c, 0x78, 0x30,
+  0x5a, 0x21, 0x56, 0x64, 0x61, 0x30, 0x97, 0x89, 0x60, 0x6b, 0xd0, 0xbf,
+  0x3f, 0x98, 0xcd, 0xa8, 0x04, 0x46, 0x29, 0xa1,
+};
+
+/* The near-collision blocks of shattered-2.pdf. */
+static const uint8_t shattered_2[] = {
+  0x73, 0x46, 0xdc, 0x91, 0x66, 0xb6, 0x7e, 0x11, 0x8f, 0x02, 0x9a, 0xb6,
+  0x21, 0xb2, 0x56, 0x0f, 0xf9, 0xca, 0x67, 0xcc, 0xa8, 0xc7, 0xf8, 0x5b,
+  0xa8, 0x4c, 0x79, 0x03, 0x0c, 0x2b, 0x3d, 0xe2, 0x18, 0xf8, 0x6d, 0xb3,
+  0xa9, 0x09, 0x01, 0xd5, 0xdf, 0x45, 0xc1, 0x4f, 0x26, 0xfe, 0xdf, 0xb3,
+  0xdc, 0x38, 0xe9, 0x6a, 0xc2, 0x2f, 0xe7, 0xbd, 0x72, 0x8f, 0x0e, 0x45,
+  0xbc, 0xe0, 0x46, 0xd2, 0x3c, 0x57, 0x0f, 0xeb, 0x14, 0x13, 0x98, 0xbb,
+  0x55, 0x2e, 0xf5, 0xa0, 0xa8, 0x2b, 0xe3, 0x31, 0xfe, 0xa4, 0x80, 0x37,
+  0xb8, 0xb5, 0xd7, 0x1f, 0x0e, 0x33, 0x2e, 0xdf, 0x93, 0xac, 0x35, 0x00,
+  0xeb, 0x4d, 0xdc, 0x0d, 0xec, 0xc1, 0xa8, 0x64, 0x79, 0x0c, 0x78, 0x2c,
+  0x76, 0x21, 0x56, 0x60, 0xdd, 0x30, 0x97, 0x91, 0xd0, 0x6b, 0xd0, 0xaf,
+  0x3f, 0x98, 0xcd, 0xa4, 0xbc, 0x46, 0x29, 0xb1,
+};
+
+static void hexdump (const uint8_t *, size_t);
+static bool run_sha1dc_testcase (const struct sha1dc_testcase *);
+static bool run_sha1dc_compare_test (void);
+static bool run_sha1dc_collision_test (void);
+
+int
+main (void)
+{
+  uint32_t i;
+  int rv;
+  const struct sha1dc_testcase *curr;
+
+  rv = 0;
+  for (i = 0; i < (sizeof (testcases) / sizeof (testcases[0])); ++i)
+    {
+      curr = &testcases[i];
+      if (!run_sha1dc_testcase (curr))
+        {
+          printf ("SHA-1DC test %d failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  if (!run_sha1dc_compare_test ())
+    {
+      printf ("SHA-1DC comparison with SHA-1 failed.\n");
+      rv = 1;
+    }
+
+  if (!run_sha1dc_collision_test ())
+    {
+      printf ("SHA-1DC collision detection test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
+
+static bool
+run_sha1dc_testcase (const struct sha1dc_testcase *test)
+{
+  struct sha1dc_ctx ctx;
+  uint8_t digest[SHA1_DIGEST_SIZE];
+
+  sha1dc_init (&ctx);
+  sha1dc_update (&ctx, test->message, strlen (test->message));
+  if (sha1dc_final (digest, &ctx) != 0)
+    return false;
+
+  hexdump (digest, SHA1_DIGEST_SIZE);
+
+  if (memcmp (digest, test->hash, SHA1_DIGEST_SIZE) != 0)
+    return false;
+
+  /* The one-shot function must agree with init, update and final. */
+  if (sha1dc (digest, test->message, strlen (test->message)) != 0)
+    return false;
+  return memcmp (digest, test->hash, SHA1_DIGEST_SIZE) == 0;
+}
+
+/*
+ * Hashes pseudo-random messages of many lengths in uneven pieces, with and
+ * without safe hashing, and compares the digests with sha1.
+ */
+static bool
+run_sha1dc_compare_test (void)
+{
+  static uint8_t data[4096];
+  struct sha1dc_ctx ctx;
+  uint8_t expect[SHA1_DIGEST_SIZE];
+  uint8_t digest[SHA1_DIGEST_SIZE];
+  uint32_t x;
+  size_t i, len, off, step;
+
+  x = 0x12345678;
+  for (i = 0; i < sizeof (data); ++i)
+    {
+      x = x * 1103515245 + 12345;
+      data[i] = (uint8_t)(x >> 24);
+    }
+
+  for (len = 0; len <= sizeof (data); len += 61)
+    {
+      sha1 (expect, data, len);
+
+      if (sha1dc (digest, data, len) != 0
+          || memcmp (digest, expect, SHA1_DIGEST_SIZE) != 0)
+        return false;
+
+      sha1dc_init (&ctx);
+      sha1dc_set_safe_hash (&ctx, len & 1);
+      step = len % 97 + 1;
+      for (off = 0; off < len; off += step)
+        sha1dc_update (&ctx, data + off, len - off < step ? len - off : step);
+      if (sha1dc_final (digest, &ctx) != 0
+          || memcmp (digest, expect, SHA1_DIGEST_SIZE) != 0)
+        return false;
+    }
+
+  return true;
+}
+
+/*
+ * Both halves of the SHAttered collision must be reported. With safe hashing
+ * their digests must differ from SHA-1 and from each other, and without it
+ * they must be the colliding SHA-1 digest.
+ */
+static bool
+run_sha1dc_collision_test (void)
+{
+  uint8_t messages[2][sizeof (shattered_prefix) + sizeof (shattered_1)];
+  uint8_t expect[SHA1_DIGEST_SIZE];
+  uint8_t plain[SHA1_DIGEST_SIZE];
+  uint8_t safe[2][SHA1_DIGEST_SIZE];
+  uint8_t digest[SHA1_DIGEST_SIZE];
+  struct sha1dc_ctx ctx;
+  size_t i, off;
+
+  memcpy (messages[0], shattered_prefix, sizeof (shattered_prefix));
+  memcpy (messages[0] + sizeof (shattered_prefix), shattered_1,
+          sizeof (shattered_1));
+  memcpy (messages[1], shattered_prefix, sizeof (shattered_prefix));
+  memcpy (messages[1] + sizeof (shattered_prefix), shattered_2,
+          sizeof (shattered_2));
+
+  sha1 (expect, messages[0], sizeof (messages[0]));
+  for (i = 0; i < 2; ++i)
+    {
+      sha1 (plain, messages[i], sizeof (messages[i]));
+      if (memcmp (plain, expect, SHA1_DIGEST_SIZE) != 0)
+        return false;
+
+      if (sha1dc (safe[i], messages[i], sizeof (messages[i])) == 0
+          || memcmp (safe[i], plain, SHA1_DIGEST_SIZE) == 0)
+        return false;
+      hexdump (safe[i], SHA1_DIGEST_SIZE);
+
+      /* Detection must not depend on how the input is split. */
+      sha1dc_init (&ctx);
+      for (off = 0; off < sizeof (messages[i]); off += 7)
+        sha1dc_update (&ctx, messages[i] + off,
+                       sizeof (messages[i]) - off < 7
+                           ? sizeof (messages[i]) - off
+                           : 7);
+      if (sha1dc_final (digest, &ctx) == 0
+          || memcmp (digest, safe[i], SHA1_DIGEST_SIZE) != 0)
+        return false;
+
+      sha1dc_init (&ctx);
+      sha1dc_set_safe_hash (&ctx, 0);
+      sha1dc_update (&ctx, messages[i], sizeof (messages[i]));
+      if (sha1dc_final (digest, &ctx) == 0
+          || memcmp (digest, plain, SHA1_DIGEST_SIZE) != 0)
+        return false;
+    }
+
+  return memcmp (safe[0], safe[1], SHA1_DIGEST_SIZE) != 0;
+}
@@ -78,7 +78,17 @@ static const struct sha256_testcase testcases[] = {
     "\x34\x10\x12\xee\xa9\xff\xdf\xdd" },
 };
 
+/* SHA-256 of one million 'a' characters, from FIPS 180-2. */
+static const char *million_a_hash
+    = "\xcd\xc7\x6e\x5c\x99\x14\xfb\x92\x81\xa1\xc7\xe2\x84"
+      "\xd7\x3e\x67\xf1\x80\x9a\x48\xa4\x97\x20\x0e"
+      "\x04\x6d\x39\xcc\xc7\x11\x2c\xd0";
+
 static bool run_sha256_testcase (const struct sha256_testcase *);
+static bool run_sha256_million_test (void);
+static bool run_sha256_blocks_test (void);
+static bool run_sha256_multi_test (void);
+static bool run_sha256_fixed_test (void);
 
 int
 main (void)
@@ -99,6 +109,30 @@ main (void)
         }
     }
 
+  if (!run_sha256_million_test ())
+    {
+      fprintf (stderr, "SHA-256 million 'a' test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_sha256_blocks_test ())
+    {
+      fprintf (stderr, "SHA-256 multi-block transform test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_sha256_multi_test ())
+    {
+      fprintf (stderr, "SHA-256 multi-buffer test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_sha256_fixed_test ())
+    {
+      fprintf (stderr, "SHA-256 fixed-length test failed.\n");
+      rv = 1;
+    }
+
   return rv;
 }
 
@@ -120,5 +154,123 @@ run_sha256_testcase (const struct sha256_testcase *test)
   if (memcmp (digest, test->hash, SHA256_DIGEST_SIZE) != 0)
     return false;
 
+  /* The one-shot function must agree with init, update and final. */
+  sha256 (digest, test->message, strlen (test->message));
+  return memcmp (digest, test->hash, SHA256_DIGEST_SIZE) == 0;
+}
+
+/*
+ * Hashes the message in pieces of varying size so that both the buffered
+ * path and the multi-block path of sha256_update are used.
+ */
+static bool
+run_sha256_million_test (void)
+{
+  static uint8_t message[1000000];
+  struct sha256_ctx ctx;
+  uint8_t digest[SHA256_DIGEST_SIZE];
+  size_t i, n;
+
+  memset (message, 'a', sizeof (message));
+  sha256_init (&ctx);
+  for (i = 0, n = 1; i < sizeof (message); i += n, n = n * 7 % 1021)
+    {
+      if (n > sizeof (message) - i)
+        n = sizeof (message) - i;
+      sha256_update (&ctx, message + i, n);
+    }
+  sha256_final (digest, &ctx);
+
+  return memcmp (digest, million_a_hash, SHA256_DIGEST_SIZE) == 0;
+}
+
+/* Compares sha256_transform_blocks with one sha256_transform per block. */
+static bool
+run_sha256_blocks_test (void)
+{
+  uint8_t data[17 * SHA256_BLOCK_SIZE];
+  struct sha256_ctx a, b;
+  size_t i;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 31 + 7);
+
+  sha256_init (&a);
+  sha256_init (&b);
+  sha256_transform_blocks (a.state, data, 17);
+  for (i = 0; i < 17; ++i)
+    sha256_transform (b.state, data + i * SHA256_BLOCK_SIZE);
+
+  return memcmp (a.state, b.state, sizeof (a.state)) == 0;
+}
+
+/*
+ * Compares sha256_multi with hashing each message on its own. The lengths
+ * cover the padding boundaries and differ enough that lanes are refilled at
+ * different times.
+ */
+static bool
+run_sha256_multi_test (void)
+{
+  static uint8_t data[8192];
+  static const size_t sizes[]
+      = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 127, 128, 1000, 4096, 8192 };
+  const uint8_t *messages[67];
+  size_t lens[67];
+  uint8_t digests[67 * SHA256_DIGEST_SIZE];
+  uint8_t digest[SHA256_DIGEST_SIZE];
+  struct sha256_ctx ctx;
+  size_t i, n;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 131 + 17);
+
+  for (n = 1; n <= 67; n += 11)
+    {
+      for (i = 0; i < n; ++i)
+        {
+          lens[i] = i < 14 ? sizes[i] : (i * 997) % sizeof (data);
+          messages[i] = data + (sizeof (data) - lens[i]) / (i % 3 + 1);
+        }
+      sha256_multi (digests, messages, lens, n);
+      for (i = 0; i < n; ++i)
+        {
+          sha256_init (&ctx);
+          sha256_update (&ctx, messages[i], lens[i]);
+          sha256_final (digest, &ctx);
+          if (memcmp (digest, digests + i * SHA256_DIGEST_SIZE,
+                      SHA256_DIGEST_SIZE)
+              != 0)
+            return false;
+        }
+    }
+
+  return true;
+}
+
+/* Compares sha256_32 and sha256_64 with the general function. */
+static bool
+run_sha256_fixed_test (void)
+{
+  uint8_t data[64 + 7];
+  uint8_t digest[SHA256_DIGEST_SIZE];
+  uint8_t expect[SHA256_DIGEST_SIZE];
+  size_t i, offset;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 73 + 5);
+
+  for (offset = 0; offset < 8; ++offset)
+    {
+      sha256 (expect, data + offset, 32);
+      sha256_32 (digest, data + offset);
+      if (memcmp (digest, expect, SHA256_DIGEST_SIZE) != 0)
+        return false;
+      sha256 (expect, data + offset, 64);
+      sha256_64 (digest, data + offset);
+      if (memcmp (digest, expect, SHA256_DIGEST_SIZE) != 0)
+        return false;
+    }
+
   return true;
 }
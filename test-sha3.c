@@ -0,0 +1,253 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors are from the NIST examples for FIPS 202.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sha3.h"
+
+struct sha3_testcase
+{
+  void (*hash) (uint8_t *, const void *, size_t);
+  size_t digest_size;
+  const char *message;
+  const char *digest;
+};
+
+static const struct sha3_testcase testcases[] = {
+  { sha3_224, SHA3_224_DIGEST_SIZE, "abc",
+    "\xe6\x42\x82\x4c\x3f\x8c\xf2\x4a\xd0\x92\x34\xee\x7d\x3c\x76\x6f"
+    "\xc9\xa3\xa5\x16\x8d\x0c\x94\xad\x73\xb4\x6f\xdf" },
+  { sha3_256, SHA3_256_DIGEST_SIZE, "",
+    "\xa7\xff\xc6\xf8\xbf\x1e\xd7\x66\x51\xc1\x47\x56\xa0\x61\xd6\x62"
+    "\xf5\x80\xff\x4d\xe4\x3b\x49\xfa\x82\xd8\x0a\x4b\x80\xf8\x43\x4a" },
+  { sha3_256, SHA3_256_DIGEST_SIZE, "abc",
+    "\x3a\x98\x5d\xa7\x4f\xe2\x25\xb2\x04\x5c\x17\x2d\x6b\xd3\x90\xbd"
+    "\x85\x5f\x08\x6e\x3e\x9d\x52\x5b\x46\xbf\xe2\x45\x11\x43\x15\x32" },
+  { sha3_256, SHA3_256_DIGEST_SIZE,
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+    "\x41\xc0\xdb\xa2\xa9\xd6\x24\x08\x49\x10\x03\x76\xa8\x23\x5e\x2c"
+    "\x82\xe1\xb9\x99\x8a\x99\x9e\x21\xdb\x32\xdd\x97\x49\x6d\x33\x76" },
+  { sha3_384, SHA3_384_DIGEST_SIZE, "abc",
+    "\xec\x01\x49\x82\x88\x51\x6f\xc9\x26\x45\x9f\x58\xe2\xc6\xad\x8d"
+    "\xf9\xb4\x73\xcb\x0f\xc0\x8c\x25\x96\xda\x7c\xf0\xe4\x9b\xe4\xb2"
+    "\x98\xd8\x8c\xea\x92\x7a\xc7\xf5\x39\xf1\xed\xf2\x28\x37\x6d\x25" },
+  { sha3_512, SHA3_512_DIGEST_SIZE, "abc",
+    "\xb7\x51\x85\x0b\x1a\x57\x16\x8a\x56\x93\xcd\x92\x4b\x6b\x09\x6e"
+    "\x08\xf6\x21\x82\x74\x44\xf7\x0d\x88\x4f\x5d\x02\x40\xd2\x71\x2e"
+    "\x10\xe1\x16\xe9\x19\x2a\xf3\xc9\x1a\x7e\xc5\x76\x47\xe3\x93\x40"
+    "\x57\x34\x0b\x4c\xf4\x08\xd5\xa5\x65\x92\xf8\x27\x4e\xec\x53\xf0" },
+};
+
+static const uint8_t shake128_empty[32]
+    = { 0x7f, 0x9c, 0x2b, 0xa4, 0xe8, 0x8f, 0x82, 0x7d, 0x61, 0x60, 0x45,
+        0x50, 0x76, 0x05, 0x85, 0x3e, 0xd7, 0x3b, 0x80, 0x93, 0xf6, 0xef,
+        0xbc, 0x88, 0xeb, 0x1a, 0x6e, 0xac, 0xfa, 0x66, 0xef, 0x26 };
+
+static const uint8_t shake256_empty[64]
+    = { 0x46, 0xb9, 0xdd, 0x2b, 0x0b, 0xa8, 0x8d, 0x13, 0x23, 0x3b, 0x3f,
+        0xeb, 0x74, 0x3e, 0xeb, 0x24, 0x3f, 0xcd, 0x52, 0xea, 0x62, 0xb8,
+        0x1b, 0x82, 0xb5, 0x0c, 0x27, 0x64, 0x6e, 0xd5, 0x76, 0x2f, 0xd7,
+        0x5d, 0xc4, 0xdd, 0xd8, 0xc0, 0xf2, 0x00, 0xcb, 0x05, 0x01, 0x9d,
+        0x67, 0xb5, 0x92, 0xf6, 0xfc, 0x82, 0x1c, 0x49, 0x47, 0x9a, 0xb4,
+        0x86, 0x40, 0x29, 0x2e, 0xac, 0xb3, 0xb7, 0xc4, 0xbe };
+
+static void hexdump (const uint8_t *, size_t);
+static bool run_sha3_testcase (const struct sha3_testcase *);
+static bool run_shake_test (void);
+static bool run_sha3_update_test (void);
+static bool run_shake_x4_test (void);
+
+int
+main (void)
+{
+  uint32_t i;
+  int rv;
+  const struct sha3_testcase *curr;
+
+  rv = 0;
+  for (i = 0; i < (sizeof (testcases) / sizeof (testcases[0])); ++i)
+    {
+      curr = &testcases[i];
+      if (!run_sha3_testcase (curr))
+        {
+          printf ("SHA-3 test %d failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  if (!run_shake_test ())
+    {
+      printf ("SHAKE test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_sha3_update_test ())
+    {
+      printf ("SHA-3 incremental test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_shake_x4_test ())
+    {
+      printf ("SHAKE four instance test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
+
+static bool
+run_sha3_testcase (const struct sha3_testcase *test)
+{
+  uint8_t digest[SHA3_512_DIGEST_SIZE];
+
+  test->hash (digest, test->message, strlen (test->message));
+  hexdump (digest, test->digest_size);
+  return memcmp (digest, test->digest, test->digest_size) == 0;
+}
+
+/*
+ * The SHAKE outputs of the empty message, read both at once and one byte at
+ * a time across several blocks.
+ */
+static bool
+run_shake_test (void)
+{
+  struct sha3_ctx ctx;
+  uint8_t output[512], bytes[512];
+  size_t i;
+
+  shake128 (output, sizeof (shake128_empty), "", 0);
+  hexdump (output, sizeof (shake128_empty));
+  if (memcmp (output, shake128_empty, sizeof (shake128_empty)) != 0)
+    return false;
+
+  shake256 (output, sizeof (shake256_empty), "", 0);
+  hexdump (output, sizeof (shake256_empty));
+  if (memcmp (output, shake256_empty, sizeof (shake256_empty)) != 0)
+    return false;
+
+  shake128 (output, sizeof (output), "abc", 3);
+  shake128_init (&ctx);
+  shake_update (&ctx, "abc", 3);
+  for (i = 0; i < sizeof (bytes); ++i)
+    shake_squeeze (&ctx, bytes + i, 1);
+  shake_final (bytes, 0, &ctx);
+  return memcmp (output, bytes, sizeof (output)) == 0;
+}
+
+/* Feeds messages in uneven pieces and compares with the one-shot function. */
+static bool
+run_sha3_update_test (void)
+{
+  static uint8_t data[1000];
+  struct sha3_ctx ctx;
+  uint8_t expect[SHA3_256_DIGEST_SIZE];
+  uint8_t digest[SHA3_256_DIGEST_SIZE];
+  size_t i, len, off, step;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 7 + 3);
+
+  for (len = 0; len <= sizeof (data); len += 37)
+    {
+      sha3_256 (expect, data, len);
+      sha3_256_init (&ctx);
+      step = len % 29 + 1;
+      for (off = 0; off < len; off += step)
+        sha3_update (&ctx, data + off, len - off < step ? len - off : step);
+      sha3_final (digest, &ctx);
+      if (memcmp (digest, expect, sizeof (digest)) != 0)
+        return false;
+    }
+
+  return true;
+}
+
+/* Compares the four instance functions with hashing each input alone. */
+static bool
+run_shake_x4_test (void)
+{
+  static uint8_t data[1024];
+  uint8_t outputs[4][600], expect[600];
+  uint8_t *outptrs[4];
+  const uint8_t *inptrs[4];
+  size_t i, j, len;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 13 + 1);
+  for (j = 0; j < 4; ++j)
+    {
+      outptrs[j] = outputs[j];
+      inptrs[j] = data + j * 100;
+    }
+
+  for (len = 0; len <= 700; len += 67)
+    {
+      shake128_x4 (outptrs, 599, inptrs, len);
+      for (j = 0; j < 4; ++j)
+        {
+          shake128 (expect, 599, inptrs[j], len);
+          if (memcmp (outputs[j], expect, 599) != 0)
+            return false;
+        }
+
+      shake256_x4 (outptrs, 300, inptrs, len);
+      for (j = 0; j < 4; ++j)
+        {
+          shake256 (expect, 300, inptrs[j], len);
+          if (memcmp (outputs[j], expect, 300) != 0)
+            return false;
+        }
+
+      sha3_256_x4 (outptrs, inptrs, len);
+      for (j = 0; j < 4; ++j)
+        {
+          sha3_256 (expect, inptrs[j], len);
+          if (memcmp (outputs[j], expect, SHA3_256_DIGEST_SIZE) != 0)
+            return false;
+        }
+    }
+
+  return true;
+}
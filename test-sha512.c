@@ -94,7 +94,22 @@ static const struct sha512_testcase testcases[] = {
     "\x7d\x45\xb8\x2f\xb3\xd1\x24\x69\x9d\x78" },
 };
 
+/* SHA-512 and SHA-384 of one million 'a' characters, from FIPS 180-2. */
+static const char *million_a_hash
+    = "\xe7\x18\x48\x3d\x0c\xe7\x69\x64\x4e\x2e\x42\xc7\xbc\x15"
+      "\xb4\x63\x8e\x1f\x98\xb1\x3b\x20\x44\x28\x56\x32\xa8"
+      "\x03\xaf\xa9\x73\xeb\xde\x0f\xf2\x44\x87\x7e\xa6\x0a"
+      "\x4c\xb0\x43\x2c\xe5\x77\xc3\x1b\xeb\x00\x9c\x5c\x2c"
+      "\x49\xaa\x2e\x4e\xad\xb2\x17\xad\x8c\xc0\x9b";
+static const char *million_a_hash384
+    = "\x9d\x0e\x18\x09\x71\x64\x74\xcb\x08\x6e\x83\x4e\x31\x0a"
+      "\x4a\x1c\xed\x14\x9e\x9c\x00\xf2\x48\x52\x79\x72\xce"
+      "\xc5\x70\x4c\x2a\x5b\x07\xb8\xb3\xdc\x38\xec\xc4\xeb"
+      "\xae\x97\xdd\xd8\x7f\x3d\x89\x85";
+
 static bool run_sha512_testcase (const struct sha512_testcase *);
+static bool run_sha512_million_test (void);
+static bool run_sha512_blocks_test (void);
 
 int
 main (void)
@@ -114,6 +129,18 @@ main (void)
         }
     }
 
+  if (!run_sha512_million_test ())
+    {
+      fprintf (stderr, "SHA-512 million 'a' test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_sha512_blocks_test ())
+    {
+      fprintf (stderr, "SHA-512 multi-block transform test failed.\n");
+      rv = 1;
+    }
+
   return rv;
 }
 
@@ -137,3 +164,60 @@ run_sha512_testcase (const struct sha512_testcase *test)
 
   return true;
 }
+
+/*
+ * Hashes the message in pieces of varying size so that both the buffered
+ * path and the multi-block path of the update functions are used.
+ */
+static bool
+run_sha512_million_test (void)
+{
+  static uint8_t message[1000000];
+  struct sha512_ctx ctx, ctx384;
+  uint8_t digest[SHA512_DIGEST_SIZE];
+  uint8_t digest384[SHA384_DIGEST_SIZE];
+  size_t i, n;
+
+  memset (message, 'a', sizeof (message));
+  sha512_init (&ctx);
+  sha384_init (&ctx384);
+  for (i = 0, n = 1; i < sizeof (message); i += n, n = n * 7 % 2039)
+    {
+      if (n > sizeof (message) - i)
+        n = sizeof (message) - i;
+      sha512_update (&ctx, message + i, n);
+      sha384_update (&ctx384, message + i, n);
+    }
+  sha512_final (digest, &ctx);
+  sha384_final (digest384, &ctx384);
+
+  return memcmp (digest, million_a_hash, SHA512_DIGEST_SIZE) == 0
+         && memcmp (digest384, million_a_hash384, SHA384_DIGEST_SIZE) == 0;
+}
+
+/* Compares the multi-block transforms with one transform per block. */
+static bool
+run_sha512_blocks_test (void)
+{
+  uint8_t data[9 * SHA512_BLOCK_SIZE];
+  struct sha512_ctx a, b, c;
+  size_t i;
+
+  for (i = 0; i < sizeof (data); ++i)
+    data[i] = (uint8_t)(i * 31 + 7);
+
+  sha512_init (&a);
+  sha512_init (&b);
+  sha384_init (&c);
+  sha512_transform_blocks (a.state, data, 9);
+  for (i = 0; i < 9; ++i)
+    sha512_transform (b.state, data + i * SHA512_BLOCK_SIZE);
+  if (memcmp (a.state, b.state, sizeof (a.state)) != 0)
+    return false;
+
+  sha384_init (&a);
+  sha384_transform_blocks (a.state, data, 9);
+  for (i = 0; i < 9; ++i)
+    sha384_transform (c.state, data + i * SHA384_BLOCK_SIZE);
+  return memcmp (a.state, c.state, sizeof (a.state)) == 0;
+}
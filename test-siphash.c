@@ -223,8 +223,79 @@ const uint8_t siphash_tests128[64][16]
         { 0x51, 0x50, 0xd1, 0x77, 0x2f, 0x50, 0x83, 0x4a, 0x50, 0x3e, 0x06,
           0x9a, 0x97, 0x3f, 0xbd, 0x7c } };
 
+/* HalfSipHash-2-4-32. */
+const uint8_t halfsiphash_tests32[64][4]
+    = { { 0xa9, 0x35, 0x9f, 0x5b },
+        { 0x27, 0x47, 0x5a, 0xb8 },
+        { 0xfa, 0x62, 0xa6, 0x03 },
+        { 0x8a, 0xfe, 0xe7, 0x04 },
+        { 0x2a, 0x6e, 0x46, 0x89 },
+        { 0xc5, 0xfa, 0xb6, 0x69 },
+        { 0x58, 0x63, 0xfc, 0x23 },
+        { 0x8b, 0xcf, 0x63, 0xc5 },
+        { 0xd0, 0xb8, 0x84, 0x8f },
+        { 0xf8, 0x06, 0xe7, 0x79 },
+        { 0x94, 0xb0, 0x79, 0x34 },
+        { 0x08, 0x08, 0x30, 0x50 },
+        { 0x57, 0xf0, 0x87, 0x2f },
+        { 0x77, 0xe6, 0x63, 0xff },
+        { 0xd6, 0xff, 0xf8, 0x7c },
+        { 0x74, 0xfe, 0x2b, 0x97 },
+        { 0xd9, 0xb5, 0xac, 0x84 },
+        { 0xc4, 0x74, 0x64, 0x5b },
+        { 0x46, 0x5b, 0x8d, 0x9b },
+        { 0x7b, 0xef, 0xe3, 0x87 },
+        { 0xe3, 0x4d, 0x10, 0x45 },
+        { 0x61, 0x3f, 0x62, 0xb3 },
+        { 0x70, 0xf3, 0x67, 0xfe },
+        { 0xe6, 0xad, 0xb8, 0xbd },
+        { 0x27, 0x40, 0x0c, 0x63 },
+        { 0x26, 0x78, 0x78, 0x75 },
+        { 0x4f, 0x56, 0x7b, 0x5f },
+        { 0x3a, 0xb0, 0xe6, 0x69 },
+        { 0xb0, 0x64, 0x40, 0x00 },
+        { 0xff, 0x67, 0x0f, 0xb4 },
+        { 0x50, 0x9e, 0x33, 0x8b },
+        { 0x5d, 0x58, 0x9f, 0x1a },
+        { 0xfe, 0xe7, 0x21, 0x12 },
+        { 0x33, 0x75, 0x32, 0x59 },
+        { 0x6a, 0x43, 0x4f, 0x8c },
+        { 0xfe, 0x28, 0xb7, 0x29 },
+        { 0xe7, 0x5c, 0xc6, 0xec },
+        { 0x69, 0x7e, 0x8d, 0x54 },
+        { 0x63, 0x68, 0x8b, 0x0f },
+        { 0x65, 0x0b, 0x62, 0xb4 },
+        { 0xb6, 0xbc, 0x18, 0x40 },
+        { 0x5d, 0x07, 0x45, 0x05 },
+        { 0x24, 0x42, 0xfd, 0x2e },
+        { 0x7b, 0xb7, 0x86, 0x3a },
+        { 0x77, 0x05, 0xd5, 0x48 },
+        { 0xd7, 0x52, 0x08, 0xb1 },
+        { 0xb6, 0xd4, 0x99, 0xc8 },
+        { 0x08, 0x92, 0x20, 0x2e },
+        { 0x69, 0xe1, 0x2c, 0xe3 },
+        { 0x8d, 0xb5, 0x80, 0xe5 },
+        { 0x36, 0x97, 0x64, 0xc6 },
+        { 0x01, 0x6e, 0x02, 0x04 },
+        { 0x3b, 0x85, 0xf3, 0xd4 },
+        { 0xfe, 0xdb, 0x66, 0xbe },
+        { 0x1e, 0x69, 0x2a, 0x3a },
+        { 0xc6, 0x89, 0x84, 0xc0 },
+        { 0xa5, 0xc5, 0xb9, 0x40 },
+        { 0x9b, 0xe9, 0xe8, 0x8c },
+        { 0x7d, 0xbc, 0x81, 0x40 },
+        { 0x7c, 0x07, 0x8e, 0xc5 },
+        { 0xd4, 0xe7, 0x6c, 0x73 },
+        { 0x42, 0x8f, 0xcb, 0xb9 },
+        { 0xbd, 0x83, 0x99, 0x7a },
+        { 0x59, 0xea, 0x4a, 0x74 } };
+
 static bool run_siphash64_tests (void);
 static bool run_siphash128_tests (void);
+static bool run_siphash_oneshot_tests (void);
+static bool run_siphash_batch_tests (void);
+static bool run_siphash_key_tests (void);
+static bool run_siphash_fixed_tests (void);
 static void hexdump (const uint8_t *, size_t);
 
 int
@@ -237,6 +308,14 @@ main (void)
     rv = 1;
   if (!run_siphash128_tests ())
     rv = 1;
+  if (!run_siphash_oneshot_tests ())
+    rv = 1;
+  if (!run_siphash_batch_tests ())
+    rv = 1;
+  if (!run_siphash_key_tests ())
+    rv = 1;
+  if (!run_siphash_fixed_tests ())
+    rv = 1;
 
   return rv;
 }
@@ -305,6 +384,208 @@ run_siphash128_tests ()
   return retval;
 }
 
+/* Reads a test vector as a little-endian integer. */
+static uint64_t
+get_le (const uint8_t *data, size_t len)
+{
+  uint64_t x;
+
+  x = 0;
+  while (len-- > 0)
+    x = (x << 8) | data[len];
+  return x;
+}
+
+static bool
+run_siphash_oneshot_tests ()
+{
+  uint32_t i;
+  bool retval;
+  uint8_t key[16];
+  uint8_t digest[SIPHASH_MIN_DIGEST_SIZE];
+  uint8_t input[64];
+  struct siphash_ctx ctx;
+
+  for (i = 0; i < 16; ++i)
+    key[i] = i;
+
+  retval = true;
+  for (i = 0; i < 64; ++i)
+    {
+      input[i] = i;
+      if (siphash24 (key, input, i) != get_le (siphash_tests64[i], 8))
+        {
+          retval = false;
+          fprintf (stderr, "SIPHASH24 one-shot test %u failed.\n", i);
+        }
+      if (halfsiphash24 (key, input, i) != get_le (halfsiphash_tests32[i], 4))
+        {
+          retval = false;
+          fprintf (stderr, "HALFSIPHASH24 test %u failed.\n", i);
+        }
+
+      /* SipHash-1-3 against the streaming code with the same rounds. */
+      siphash_init (&ctx, SIPHASH_MIN_DIGEST_SIZE, key, 1, 3);
+      siphash_update (&ctx, input, i);
+      siphash_final (digest, &ctx);
+      if (siphash13 (key, input, i) != get_le (digest, 8))
+        {
+          retval = false;
+          fprintf (stderr, "SIPHASH13 test %u failed.\n", i);
+        }
+    }
+
+  return retval;
+}
+
+static bool
+run_siphash_batch_tests ()
+{
+  uint32_t i, n;
+  bool retval;
+  uint8_t key[16];
+  uint8_t input[256];
+  const void *inputs[40];
+  size_t lens[40];
+  uint64_t out[40];
+
+  for (i = 0; i < 16; ++i)
+    key[i] = 0xf0 - i;
+  for (i = 0; i < sizeof (input); ++i)
+    input[i] = i * 3;
+
+  /* Every batch size up to a few groups of the widest backend, with the
+     lengths differing within a batch. */
+  retval = true;
+  for (n = 0; n <= 40; ++n)
+    {
+      for (i = 0; i < n; ++i)
+        {
+          lens[i] = (i * 37 + n * 11) % 200;
+          inputs[i] = input + i;
+        }
+      siphash24_batch (key, inputs, lens, out, n);
+      for (i = 0; i < n; ++i)
+        if (out[i] != siphash24 (key, inputs[i], lens[i]))
+          {
+            retval = false;
+            fprintf (stderr, "SIPHASH24 batch %u, message %u failed.\n", n,
+                     i);
+          }
+      siphash13_batch (key, inputs, lens, out, n);
+      for (i = 0; i < n; ++i)
+        if (out[i] != siphash13 (key, inputs[i], lens[i]))
+          {
+            retval = false;
+            fprintf (stderr, "SIPHASH13 batch %u, message %u failed.\n", n,
+                     i);
+          }
+    }
+
+  /* Messages of the same length. */
+  for (i = 0; i < 40; ++i)
+    {
+      lens[i] = 16;
+      inputs[i] = input + i * 5;
+    }
+  siphash24_batch (key, inputs, lens, out, 40);
+  for (i = 0; i < 40; ++i)
+    if (out[i] != siphash24 (key, inputs[i], lens[i]))
+      {
+        retval = false;
+        fprintf (stderr, "SIPHASH24 batch message %u failed.\n", i);
+      }
+
+  return retval;
+}
+
+/*
+ * A prepared key must give the same MACs as siphash_init, whether through a
+ * context or siphash_mac, and be reusable for any number of messages.
+ */
+static bool
+run_siphash_key_tests ()
+{
+  static const uint8_t params[][3] = { { SIPHASH_MIN_DIGEST_SIZE, 0, 0 },
+                                       { SIPHASH_MIN_DIGEST_SIZE, 1, 3 },
+                                       { SIPHASH_MIN_DIGEST_SIZE, 3, 5 },
+                                       { SIPHASH_MAX_DIGEST_SIZE, 0, 0 },
+                                       { SIPHASH_MAX_DIGEST_SIZE, 1, 3 } };
+  uint8_t expect[SIPHASH_MAX_DIGEST_SIZE];
+  uint8_t digest[SIPHASH_MAX_DIGEST_SIZE];
+  struct siphash_key prepared;
+  struct siphash_ctx ctx;
+  uint8_t input[64];
+  uint8_t key[16];
+  uint32_t i, j;
+  bool retval;
+
+  for (i = 0; i < 16; ++i)
+    key[i] = i;
+  for (i = 0; i < 64; ++i)
+    input[i] = i;
+
+  retval = true;
+  for (j = 0; j < sizeof (params) / sizeof (params[0]); ++j)
+    {
+      siphash_set_key (&prepared, params[j][0], key, params[j][1],
+                       params[j][2]);
+      for (i = 0; i < 64; ++i)
+        {
+          siphash_init (&ctx, params[j][0], key, params[j][1], params[j][2]);
+          siphash_update (&ctx, input, i);
+          siphash_final (expect, &ctx);
+
+          siphash_init_key (&ctx, &prepared);
+          siphash_update (&ctx, input, i / 2);
+          siphash_update (&ctx, input + i / 2, i - i / 2);
+          siphash_final (digest, &ctx);
+          if (memcmp (digest, expect, params[j][0]) != 0)
+            {
+              retval = false;
+              fprintf (stderr, "SIPHASH key %u test %u failed.\n", j, i);
+            }
+
+          memset (digest, 0, sizeof (digest));
+          siphash_mac (digest, &prepared, input, i);
+          if (memcmp (digest, expect, params[j][0]) != 0)
+            {
+              retval = false;
+              fprintf (stderr, "SIPHASH key %u MAC %u failed.\n", j, i);
+            }
+        }
+    }
+
+  return retval;
+}
+
+/* siphash24_16 on the 16-byte message of the reference vectors. */
+static bool
+run_siphash_fixed_tests (void)
+{
+  uint8_t key[16];
+  uint8_t input[16 + 7];
+  uint32_t i, offset;
+
+  for (i = 0; i < 16; ++i)
+    key[i] = i;
+
+  for (offset = 0; offset < 8; ++offset)
+    {
+      for (i = 0; i < 16; ++i)
+        input[offset + i] = i;
+      if (siphash24_16 (key, input + offset)
+          != get_le (siphash_tests64[16], 8))
+        {
+          fprintf (stderr, "SIPHASH 16-byte test at offset %u failed.\n",
+                   offset);
+          return false;
+        }
+    }
+
+  return true;
+}
+
 static void
 hexdump (const uint8_t *data, size_t len)
 {
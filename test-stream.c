@@ -0,0 +1,330 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Tests for the STREAM construction. Each segment is checked against the
+ * underlying AEAD with the nonce built by hand, and whole objects are
+ * sealed and opened with one and several threads.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chacha20poly1305.h"
+#include "fcrypt_stream.h"
+#include "gcm.h"
+
+#define SEGMENT_SIZE 4096
+#define MAX_SIZE (40 * SEGMENT_SIZE + 123)
+#define MAX_SEALED (MAX_SIZE + 41 * FCRYPT_STREAM_TAG_SIZE)
+
+static const uint8_t key[32] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+  0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+  0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+static const uint8_t prefix[FCRYPT_STREAM_PREFIX_SIZE]
+    = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6 };
+
+static const int aeads[] = { FCRYPT_STREAM_CHACHA20POLY1305,
+                             FCRYPT_STREAM_AES128_GCM,
+                             FCRYPT_STREAM_AES256_GCM };
+
+static uint8_t plain[MAX_SIZE];
+static uint8_t sealed[MAX_SEALED];
+static uint8_t other[MAX_SEALED];
+static uint8_t opened[MAX_SIZE];
+
+static bool run_stream_segment_test (int);
+static bool run_stream_object_test (int, size_t);
+static bool run_stream_tamper_test (int);
+static bool run_stream_error_test (void);
+
+int
+main (void)
+{
+  static const size_t sizes[]
+      = { 0, 1, SEGMENT_SIZE - 1, SEGMENT_SIZE, SEGMENT_SIZE + 1,
+          2 * SEGMENT_SIZE, MAX_SIZE };
+  size_t i, j;
+  int rv;
+
+  for (i = 0; i < MAX_SIZE; ++i)
+    plain[i] = (uint8_t)(i * 7 + (i >> 8));
+
+  rv = 0;
+  for (i = 0; i < sizeof (aeads) / sizeof (aeads[0]); ++i)
+    {
+      if (!run_stream_segment_test (aeads[i]))
+        {
+          printf ("STREAM segment test %zu failed.\n", i);
+          rv = 1;
+        }
+      for (j = 0; j < sizeof (sizes) / sizeof (sizes[0]); ++j)
+        if (!run_stream_object_test (aeads[i], sizes[j]))
+          {
+            printf ("STREAM object test %zu with %zu bytes failed.\n", i,
+                    sizes[j]);
+            rv = 1;
+          }
+      if (!run_stream_tamper_test (aeads[i]))
+        {
+          printf ("STREAM tamper test %zu failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  if (!run_stream_error_test ())
+    {
+      printf ("STREAM error test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+/* Seals a segment with the AEAD directly, under the nonce of STREAM. */
+static void
+reference_seal (int aead, uint32_t index, int last, const uint8_t *src,
+                uint8_t *dest, size_t len, uint8_t *tag)
+{
+  struct chacha20poly1305_ctx chacha;
+  struct aes128_gcm_ctx aes128;
+  struct aes256_gcm_ctx aes256;
+  uint8_t nonce[12];
+
+  memcpy (nonce, prefix, FCRYPT_STREAM_PREFIX_SIZE);
+  nonce[7] = (uint8_t)(index >> 24);
+  nonce[8] = (uint8_t)(index >> 16);
+  nonce[9] = (uint8_t)(index >> 8);
+  nonce[10] = (uint8_t)index;
+  nonce[11] = (uint8_t)last;
+  switch (aead)
+    {
+    case FCRYPT_STREAM_CHACHA20POLY1305:
+      chacha20poly1305_set_key (&chacha, key);
+      chacha20poly1305_seal (&chacha, nonce, NULL, 0, src, dest, len, tag);
+      break;
+    case FCRYPT_STREAM_AES128_GCM:
+      aes128_gcm_set_key (&aes128, key);
+      aes128_gcm_seal (&aes128, nonce, 12, NULL, 0, src, dest, len, tag);
+      break;
+    default:
+      aes256_gcm_set_key (&aes256, key);
+      aes256_gcm_seal (&aes256, nonce, 12, NULL, 0, src, dest, len, tag);
+      break;
+    }
+}
+
+/*
+ * Seals segments out of order and checks them against the reference, then
+ * opens them, also out of order.
+ */
+static bool
+run_stream_segment_test (int aead)
+{
+  static const uint32_t indexes[] = { 5, 0, 70000, 1, UINT32_C (0xffffffff) };
+  uint8_t expect[SEGMENT_SIZE + FCRYPT_STREAM_TAG_SIZE];
+  uint8_t out[SEGMENT_SIZE + FCRYPT_STREAM_TAG_SIZE];
+  struct fcrypt_stream stream;
+  size_t i, len;
+  int last;
+  bool ok;
+
+  if (fcrypt_stream_init (&stream, aead, key, prefix, SEGMENT_SIZE) != 0)
+    return false;
+  ok = true;
+  for (i = 0; ok && i < sizeof (indexes) / sizeof (indexes[0]); ++i)
+    {
+      last = i % 2;
+      len = last ? 100 * i : SEGMENT_SIZE;
+      reference_seal (aead, indexes[i], last, plain, expect, len,
+                      expect + len);
+      ok = fcrypt_stream_seal_segment (&stream, indexes[i], last, plain, out,
+                                       len, out + len)
+               == 0
+           && memcmp (out, expect, len + FCRYPT_STREAM_TAG_SIZE) == 0
+           && fcrypt_stream_open_segment (&stream, indexes[i], last, out,
+                                          opened, len, out + len)
+                  == 0
+           && memcmp (opened, plain, len) == 0
+           && fcrypt_stream_open_segment (&stream, indexes[i], !last, out,
+                                          opened, len, out + len)
+                  != 0;
+    }
+  fcrypt_stream_clear (&stream);
+  return ok;
+}
+
+/*
+ * Seals an object segment by segment, as it would be while streaming, and
+ * checks that sealing and opening it whole gives the same result with one
+ * thread or several.
+ */
+static bool
+run_stream_object_test (int aead, size_t len)
+{
+  struct fcrypt_stream stream;
+  size_t size, back, i, n, pos;
+  unsigned int threads;
+  bool ok;
+
+  if (fcrypt_stream_init (&stream, aead, key, prefix, SEGMENT_SIZE) != 0
+      || fcrypt_stream_sealed_size (&stream, len, &size) != 0
+      || fcrypt_stream_opened_size (&stream, size, &back) != 0
+      || back != len || size > MAX_SEALED)
+    return false;
+
+  ok = true;
+  pos = 0;
+  for (i = 0; ok && (i == 0 || i * SEGMENT_SIZE < len); ++i)
+    {
+      n = len - i * SEGMENT_SIZE < SEGMENT_SIZE ? len - i * SEGMENT_SIZE
+                                                : SEGMENT_SIZE;
+      ok = fcrypt_stream_seal_segment (&stream, i,
+                                       (i + 1) * SEGMENT_SIZE >= len,
+                                       plain + i * SEGMENT_SIZE,
+                                       other + pos, n, other + pos + n)
+           == 0;
+      pos += n + FCRYPT_STREAM_TAG_SIZE;
+    }
+  ok = ok && pos == size;
+
+  for (threads = 1; ok && threads <= 4; threads += 3)
+    {
+      memset (sealed, 0, size);
+      memset (opened, 0, len);
+      ok = fcrypt_stream_seal (&stream, plain, len, sealed, threads) == 0
+           && memcmp (sealed, other, size) == 0
+           && fcrypt_stream_open (&stream, sealed, size, opened, threads)
+                  == 0
+           && memcmp (opened, plain, len) == 0;
+    }
+  fcrypt_stream_clear (&stream);
+  return ok;
+}
+
+/*
+ * Flips a bit, swaps two segments and truncates an object at a segment
+ * boundary, each of which must make opening fail and clear the output.
+ */
+static bool
+run_stream_tamper_test (int aead)
+{
+  struct fcrypt_stream stream;
+  size_t size, stride, i;
+  bool ok;
+
+  stride = SEGMENT_SIZE + FCRYPT_STREAM_TAG_SIZE;
+  if (fcrypt_stream_init (&stream, aead, key, prefix, SEGMENT_SIZE) != 0
+      || fcrypt_stream_sealed_size (&stream, MAX_SIZE, &size) != 0
+      || fcrypt_stream_seal (&stream, plain, MAX_SIZE, sealed, 4) != 0)
+    return false;
+
+  memcpy (other, sealed, size);
+  other[3 * stride + 10] ^= 0x20;
+  ok = fcrypt_stream_open (&stream, other, size, opened, 4) != 0;
+  for (i = 0; ok && i < MAX_SIZE; ++i)
+    ok = opened[i] == 0;
+
+  memcpy (other, sealed, size);
+  memcpy (other + 2 * stride, sealed + 3 * stride, stride);
+  memcpy (other + 3 * stride, sealed + 2 * stride, stride);
+  ok = ok && fcrypt_stream_open (&stream, other, size, opened, 1) != 0;
+
+  ok = ok && fcrypt_stream_open (&stream, sealed, 5 * stride, opened, 2) != 0;
+
+  /* Other keys and prefixes fail too. */
+  ok = ok && fcrypt_stream_open (&stream, sealed, size, opened, 4) == 0;
+  fcrypt_stream_clear (&stream);
+  if (fcrypt_stream_init (&stream, aead, key, key, SEGMENT_SIZE) != 0)
+    return false;
+  ok = ok && fcrypt_stream_open (&stream, sealed, size, opened, 4) != 0;
+  fcrypt_stream_clear (&stream);
+  return ok;
+}
+
+static bool
+run_stream_error_test (void)
+{
+  struct fcrypt_stream stream;
+  uint8_t tag[FCRYPT_STREAM_TAG_SIZE];
+  size_t size;
+
+  errno = 0;
+  if (fcrypt_stream_init (&stream, 0, key, prefix, SEGMENT_SIZE) != -1
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_stream_init (&stream, FCRYPT_STREAM_AES256_GCM, key, prefix, 0)
+          != -1
+      || errno != EINVAL)
+    return false;
+
+  if (fcrypt_stream_init (&stream, FCRYPT_STREAM_AES256_GCM, key, prefix,
+                          SEGMENT_SIZE)
+      != 0)
+    return false;
+  errno = 0;
+  if (fcrypt_stream_seal_segment (&stream, 0, 0, plain, sealed, 100, tag)
+          != -1
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_stream_seal_segment (&stream, 0, 1, plain, sealed,
+                                  SEGMENT_SIZE + 1, tag)
+          != -1
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_stream_seal_segment (&stream, FCRYPT_STREAM_MAX_SEGMENTS, 1,
+                                  plain, sealed, 1, tag)
+          != -1
+      || errno != EINVAL)
+    return false;
+
+  /* Sealed lengths with an empty or partial tag in the last segment. */
+  errno = 0;
+  if (fcrypt_stream_opened_size (&stream, 15, &size) != -1
+      || errno != EINVAL)
+    return false;
+  errno = 0;
+  if (fcrypt_stream_opened_size (
+          &stream, SEGMENT_SIZE + 2 * FCRYPT_STREAM_TAG_SIZE, &size)
+          != -1
+      || errno != EINVAL)
+    return false;
+  if (fcrypt_stream_opened_size (&stream, FCRYPT_STREAM_TAG_SIZE, &size) != 0
+      || size != 0)
+    return false;
+  fcrypt_stream_clear (&stream);
+  return true;
+}
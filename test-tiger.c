@@ -123,6 +123,11 @@ run_tiger_testcase (const struct tiger_testcase *test)
     printf ("%02x", digest[i]);
   printf ("\n");
 
+  if (memcmp (digest, test->hash, TIGER192_DIGEST_SIZE) != 0)
+    return false;
+
+  /* The one-shot function must agree with init, update and final. */
+  tiger1 (digest, test->message, strlen (test->message));
   return memcmp (digest, test->hash, TIGER192_DIGEST_SIZE) == 0;
 }
 
@@ -0,0 +1,203 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Test vectors are from the THEX draft, "Tree Hash EXchange format", where
+ * they are given in base32. The larger messages are checked against the
+ * tree built level by level as the draft describes it.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tiger.h"
+#include "tigertree.h"
+
+struct tigertree_testcase
+{
+  uint8_t byte;
+  size_t len;
+  const char *hash;
+};
+
+static const struct tigertree_testcase testcases[]
+    = { { 0, 0, "\x5d\x9e\xd0\x0a\x03\x0e\x63\x8b\xdb\x75\x3a\x6a"
+                "\x24\xfb\x90\x0e\x5a\x63\xb8\xe7\x3e\x6c\x25\xb6" },
+        { 0, 1, "\xaa\xbb\xcc\xa0\x84\xac\xec\xd0\x51\x1d\x1f\x62"
+                "\x32\xa1\x7b\xfa\xef\xa4\x41\xb2\x98\x2e\x55\x48" },
+        { 'A', 1024, "\x5f\xbd\x0e\x62\xad\x01\x6d\x59\x6b\x77\xd1\xd2"
+                     "\x88\x83\xb9\x4f\xed\x78\xec\xba\xf4\x64\x09\x14" },
+        { 'A', 1025, "\x7e\x59\x1c\x1c\xd8\xf2\xe6\x12\x1f\xdb\xcd\x80"
+                     "\x71\xba\x27\x96\x26\xb7\x71\x64\x2d\x10\xa3\xdb" } };
+
+static void hexdump (const uint8_t *, size_t);
+static bool run_tigertree_testcase (const struct tigertree_testcase *);
+static bool run_tigertree_level_test (void);
+
+int
+main (void)
+{
+  uint32_t i;
+  int rv;
+  const struct tigertree_testcase *curr;
+
+  rv = 0;
+  for (i = 0; i < (sizeof (testcases) / sizeof (testcases[0])); ++i)
+    {
+      curr = &testcases[i];
+      if (!run_tigertree_testcase (curr))
+        {
+          printf ("Tiger Tree Hash test %d failed.\n", i);
+          rv = 1;
+        }
+    }
+
+  if (!run_tigertree_level_test ())
+    {
+      printf ("Tiger Tree Hash level by level test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
+
+static bool
+run_tigertree_testcase (const struct tigertree_testcase *test)
+{
+  struct tigertree_ctx ctx;
+  uint8_t message[1025];
+  uint8_t digest[TIGERTREE_DIGEST_SIZE];
+
+  memset (message, test->byte, test->len);
+
+  tigertree_init (&ctx);
+  tigertree_update (&ctx, message, test->len);
+  tigertree_final (digest, &ctx);
+
+  hexdump (digest, TIGERTREE_DIGEST_SIZE);
+
+  if (memcmp (digest, test->hash, TIGERTREE_DIGEST_SIZE) != 0)
+    return false;
+
+  tigertree (digest, message, test->len);
+  return memcmp (digest, test->hash, TIGERTREE_DIGEST_SIZE) == 0;
+}
+
+/* Hashes every leaf, then pairs up the nodes of each level in turn. */
+static void
+tigertree_levels (uint8_t *digest, const uint8_t *message, size_t len)
+{
+  static uint8_t nodes[601][TIGERTREE_DIGEST_SIZE];
+  uint8_t buffer[1 + TIGERTREE_LEAF_SIZE];
+  size_t n, m, i, leaflen;
+
+  n = len == 0 ? 1 : (len + TIGERTREE_LEAF_SIZE - 1) / TIGERTREE_LEAF_SIZE;
+  for (i = 0; i < n; ++i)
+    {
+      leaflen = len - i * TIGERTREE_LEAF_SIZE;
+      if (leaflen > TIGERTREE_LEAF_SIZE)
+        leaflen = TIGERTREE_LEAF_SIZE;
+      buffer[0] = 0x00;
+      memcpy (buffer + 1, message + i * TIGERTREE_LEAF_SIZE, leaflen);
+      tiger1 (nodes[i], buffer, 1 + leaflen);
+    }
+
+  while (n > 1)
+    {
+      for (i = 0, m = 0; i < n; i += 2, ++m)
+        {
+          if (i + 1 == n)
+            {
+              memcpy (nodes[m], nodes[i], TIGERTREE_DIGEST_SIZE);
+              continue;
+            }
+          buffer[0] = 0x01;
+          memcpy (buffer + 1, nodes[i], TIGERTREE_DIGEST_SIZE);
+          memcpy (buffer + 1 + TIGERTREE_DIGEST_SIZE, nodes[i + 1],
+                  TIGERTREE_DIGEST_SIZE);
+          tiger1 (nodes[m], buffer, 1 + 2 * TIGERTREE_DIGEST_SIZE);
+        }
+      n = m;
+    }
+
+  memcpy (digest, nodes[0], TIGERTREE_DIGEST_SIZE);
+}
+
+/*
+ * Compares the one-shot, piecewise and threaded functions with the level by
+ * level tree, for lengths around leaf boundaries and with odd leaf counts,
+ * and finally for a message large enough to be split among threads.
+ */
+static bool
+run_tigertree_level_test (void)
+{
+  static uint8_t message[600 * TIGERTREE_LEAF_SIZE + 5];
+  struct tigertree_ctx ctx;
+  uint8_t expect[TIGERTREE_DIGEST_SIZE];
+  uint8_t digest[TIGERTREE_DIGEST_SIZE];
+  size_t i, len, off, step;
+
+  for (i = 0; i < sizeof (message); ++i)
+    message[i] = (uint8_t)(i * 31 + (i >> 11));
+
+  for (len = 0; len <= 64 * TIGERTREE_LEAF_SIZE; len += 1023)
+    {
+      tigertree_levels (expect, message, len);
+
+      tigertree (digest, message, len);
+      if (memcmp (digest, expect, TIGERTREE_DIGEST_SIZE) != 0)
+        return false;
+
+      tigertree_parallel (digest, message, len, 4);
+      if (memcmp (digest, expect, TIGERTREE_DIGEST_SIZE) != 0)
+        return false;
+
+      tigertree_init (&ctx);
+      step = len % 1500 + 1;
+      for (off = 0; off < len; off += step)
+        tigertree_update (&ctx, message + off,
+                          len - off < step ? len - off : step);
+      tigertree_final (digest, &ctx);
+      if (memcmp (digest, expect, TIGERTREE_DIGEST_SIZE) != 0)
+        return false;
+    }
+
+  tigertree_levels (expect, message, sizeof (message));
+  tigertree_parallel (digest, message, sizeof (message), 4);
+  return memcmp (digest, expect, TIGERTREE_DIGEST_SIZE) == 0;
+}
@@ -0,0 +1,234 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Tests for X25519. The vectors are from RFC 7748 sections 5.2 and 6.1,
+ * including the iterated one, and results of points of small order must be
+ * rejected.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "x25519.h"
+
+struct x25519_testcase
+{
+  uint8_t scalar[X25519_KEY_SIZE];
+  uint8_t point[X25519_KEY_SIZE];
+  uint8_t result[X25519_KEY_SIZE];
+};
+
+static const struct x25519_testcase testcases[] = {
+  { {
+      0xa5, 0x46, 0xe3, 0x6b, 0xf0, 0x52, 0x7c, 0x9d, 0x3b, 0x16, 0x15,
+      0x4b, 0x82, 0x46, 0x5e, 0xdd, 0x62, 0x14, 0x4c, 0x0a, 0xc1, 0xfc,
+      0x5a, 0x18, 0x50, 0x6a, 0x22, 0x44, 0xba, 0x44, 0x9a, 0xc4
+    },
+    {
+      0xe6, 0xdb, 0x68, 0x67, 0x58, 0x30, 0x30, 0xdb, 0x35, 0x94, 0xc1,
+      0xa4, 0x24, 0xb1, 0x5f, 0x7c, 0x72, 0x66, 0x24, 0xec, 0x26, 0xb3,
+      0x35, 0x3b, 0x10, 0xa9, 0x03, 0xa6, 0xd0, 0xab, 0x1c, 0x4c
+    },
+    {
+      0xc3, 0xda, 0x55, 0x37, 0x9d, 0xe9, 0xc6, 0x90, 0x8e, 0x94, 0xea,
+      0x4d, 0xf2, 0x8d, 0x08, 0x4f, 0x32, 0xec, 0xcf, 0x03, 0x49, 0x1c,
+      0x71, 0xf7, 0x54, 0xb4, 0x07, 0x55, 0x77, 0xa2, 0x85, 0x52
+    } },
+  { {
+      0x4b, 0x66, 0xe9, 0xd4, 0xd1, 0xb4, 0x67, 0x3c, 0x5a, 0xd2, 0x26,
+      0x91, 0x95, 0x7d, 0x6a, 0xf5, 0xc1, 0x1b, 0x64, 0x21, 0xe0, 0xea,
+      0x01, 0xd4, 0x2c, 0xa4, 0x16, 0x9e, 0x79, 0x18, 0xba, 0x0d
+    },
+    {
+      0xe5, 0x21, 0x0f, 0x12, 0x78, 0x68, 0x11, 0xd3, 0xf4, 0xb7, 0x95,
+      0x9d, 0x05, 0x38, 0xae, 0x2c, 0x31, 0xdb, 0xe7, 0x10, 0x6f, 0xc0,
+      0x3c, 0x3e, 0xfc, 0x4c, 0xd5, 0x49, 0xc7, 0x15, 0xa4, 0x93
+    },
+    {
+      0x95, 0xcb, 0xde, 0x94, 0x76, 0xe8, 0x90, 0x7d, 0x7a, 0xad, 0xe4,
+      0x5c, 0xb4, 0xb8, 0x73, 0xf8, 0x8b, 0x59, 0x5a, 0x68, 0x79, 0x9f,
+      0xa1, 0x52, 0xe6, 0xf8, 0xf7, 0x64, 0x7a, 0xac, 0x79, 0x57
+    } }
+};
+
+static const uint8_t alice_private[32] = {
+  0x77, 0x07, 0x6d, 0x0a, 0x73, 0x18, 0xa5, 0x7d, 0x3c, 0x16, 0xc1,
+  0x72, 0x51, 0xb2, 0x66, 0x45, 0xdf, 0x4c, 0x2f, 0x87, 0xeb, 0xc0,
+  0x99, 0x2a, 0xb1, 0x77, 0xfb, 0xa5, 0x1d, 0xb9, 0x2c, 0x2a
+};
+
+static const uint8_t alice_public[32] = {
+  0x85, 0x20, 0xf0, 0x09, 0x89, 0x30, 0xa7, 0x54, 0x74, 0x8b, 0x7d,
+  0xdc, 0xb4, 0x3e, 0xf7, 0x5a, 0x0d, 0xbf, 0x3a, 0x0d, 0x26, 0x38,
+  0x1a, 0xf4, 0xeb, 0xa4, 0xa9, 0x8e, 0xaa, 0x9b, 0x4e, 0x6a
+};
+
+static const uint8_t bob_private[32] = {
+  0x5d, 0xab, 0x08, 0x7e, 0x62, 0x4a, 0x8a, 0x4b, 0x79, 0xe1, 0x7f,
+  0x8b, 0x83, 0x80, 0x0e, 0xe6, 0x6f, 0x3b, 0xb1, 0x29, 0x26, 0x18,
+  0xb6, 0xfd, 0x1c, 0x2f, 0x8b, 0x27, 0xff, 0x88, 0xe0, 0xeb
+};
+
+static const uint8_t bob_public[32] = {
+  0xde, 0x9e, 0xdb, 0x7d, 0x7b, 0x7d, 0xc1, 0xb4, 0xd3, 0x5b, 0x61,
+  0xc2, 0xec, 0xe4, 0x35, 0x37, 0x3f, 0x83, 0x43, 0xc8, 0x5b, 0x78,
+  0x67, 0x4d, 0xad, 0xfc, 0x7e, 0x14, 0x6f, 0x88, 0x2b, 0x4f
+};
+
+static const uint8_t shared_secret[32] = {
+  0x4a, 0x5d, 0x9d, 0x5b, 0xa4, 0xce, 0x2d, 0xe1, 0x72, 0x8e, 0x3b,
+  0xf4, 0x80, 0x35, 0x0f, 0x25, 0xe0, 0x7e, 0x21, 0xc9, 0x47, 0xd1,
+  0x9e, 0x33, 0x76, 0xf0, 0x9b, 0x3c, 0x1e, 0x16, 0x17, 0x42
+};
+
+/* The scalar after 1 and 1000 iterations of k = X25519(k, u), u = k. */
+static const uint8_t iterated_1[32] = {
+  0x42, 0x2c, 0x8e, 0x7a, 0x62, 0x27, 0xd7, 0xbc, 0xa1, 0x35, 0x0b,
+  0x3e, 0x2b, 0xb7, 0x27, 0x9f, 0x78, 0x97, 0xb8, 0x7b, 0xb6, 0x85,
+  0x4b, 0x78, 0x3c, 0x60, 0xe8, 0x03, 0x11, 0xae, 0x30, 0x79
+};
+
+static const uint8_t iterated_1000[32] = {
+  0x68, 0x4c, 0xf5, 0x9b, 0xa8, 0x33, 0x09, 0x55, 0x28, 0x00, 0xef,
+  0x56, 0x6f, 0x2f, 0x4d, 0x3c, 0x1c, 0x38, 0x87, 0xc4, 0x93, 0x60,
+  0xe3, 0x87, 0x5f, 0x2e, 0xb9, 0x4d, 0x99, 0x53, 0x2c, 0x51
+};
+
+static bool run_x25519_vector_test (void);
+static bool run_x25519_exchange_test (void);
+static bool run_x25519_iterated_test (void);
+static bool run_x25519_small_order_test (void);
+
+int
+main (void)
+{
+  int rv;
+
+  rv = 0;
+  if (!run_x25519_vector_test ())
+    {
+      printf ("X25519 vector test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_x25519_exchange_test ())
+    {
+      printf ("X25519 exchange test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_x25519_iterated_test ())
+    {
+      printf ("X25519 iterated test failed.\n");
+      rv = 1;
+    }
+
+  if (!run_x25519_small_order_test ())
+    {
+      printf ("X25519 small order test failed.\n");
+      rv = 1;
+    }
+
+  return rv;
+}
+
+static bool
+run_x25519_vector_test (void)
+{
+  uint8_t result[X25519_KEY_SIZE];
+  size_t i;
+
+  for (i = 0; i < sizeof (testcases) / sizeof (testcases[0]); ++i)
+    {
+      if (x25519 (result, testcases[i].scalar, testcases[i].point) != 0
+          || memcmp (result, testcases[i].result, X25519_KEY_SIZE) != 0)
+        return false;
+    }
+  return true;
+}
+
+static bool
+run_x25519_exchange_test (void)
+{
+  uint8_t result[X25519_KEY_SIZE];
+
+  x25519_base (result, alice_private);
+  if (memcmp (result, alice_public, X25519_KEY_SIZE) != 0)
+    return false;
+  x25519_base (result, bob_private);
+  if (memcmp (result, bob_public, X25519_KEY_SIZE) != 0)
+    return false;
+  if (x25519 (result, alice_private, bob_public) != 0
+      || memcmp (result, shared_secret, X25519_KEY_SIZE) != 0)
+    return false;
+  return x25519 (result, bob_private, alice_public) == 0
+         && memcmp (result, shared_secret, X25519_KEY_SIZE) == 0;
+}
+
+static bool
+run_x25519_iterated_test (void)
+{
+  uint8_t k[X25519_KEY_SIZE], u[X25519_KEY_SIZE], result[X25519_KEY_SIZE];
+  int i;
+
+  memset (k, 0, sizeof (k));
+  k[0] = 9;
+  memcpy (u, k, sizeof (u));
+  for (i = 1; i <= 1000; ++i)
+    {
+      if (x25519 (result, k, u) != 0)
+        return false;
+      memcpy (u, k, sizeof (u));
+      memcpy (k, result, sizeof (k));
+      if (i == 1 && memcmp (k, iterated_1, sizeof (k)) != 0)
+        return false;
+    }
+  return memcmp (k, iterated_1000, sizeof (k)) == 0;
+}
+
+/* u = 0, u = 1 and u = p + 1, which is 1 again, all have small order. */
+static bool
+run_x25519_small_order_test (void)
+{
+  uint8_t point[X25519_KEY_SIZE], result[X25519_KEY_SIZE];
+
+  memset (point, 0, sizeof (point));
+  errno = 0;
+  if (x25519 (result, alice_private, point) != -1 || errno != EINVAL)
+    return false;
+  point[0] = 1;
+  errno = 0;
+  if (x25519 (result, alice_private, point) != -1 || errno != EINVAL)
+    return false;
+  memset (point, 0xff, sizeof (point));
+  point[0] = 0xee;
+  point[31] = 0x7f;
+  errno = 0;
+  return x25519 (result, alice_private, point) == -1 && errno == EINVAL;
+}
@@ -0,0 +1,268 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "aes.h"
+
+static bool run_aes128_xts_test (void);
+static bool run_aes256_xts_test (void);
+static bool run_aes128_xts_sectors_test (void);
+static void fill_message (uint8_t *, size_t);
+static void hexdump (const uint8_t *, size_t);
+
+int
+main (void)
+{
+  if (!run_aes128_xts_test ())
+    return 1;
+  if (!run_aes256_xts_test ())
+    return 1;
+  if (!run_aes128_xts_sectors_test ())
+    return 1;
+  return 0;
+}
+
+/* Vectors 1, 2 and 15 from IEEE Std 1619-2007, Annex B. */
+static bool
+run_aes128_xts_test (void)
+{
+  struct aes128_xts_ctx ctx;
+  uint8_t key[AES128_XTS_KEY_SIZE];
+  uint8_t tweak[AES_XTS_TWEAK_SIZE];
+  uint8_t pt[32], buffer[32];
+  size_t i;
+
+  const uint8_t ct1[32]
+      = { 0x91, 0x7c, 0xf6, 0x9e, 0xbd, 0x68, 0xb2, 0xec, 0x9b, 0x9f, 0xe9,
+          0xa3, 0xea, 0xdd, 0xa6, 0x92, 0xcd, 0x43, 0xd2, 0xf5, 0x95, 0x98,
+          0xed, 0x85, 0x8c, 0x02, 0xc2, 0x65, 0x2f, 0xbf, 0x92, 0x2e };
+
+  const uint8_t ct2[32]
+      = { 0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e, 0x39, 0x33, 0x40,
+          0x38, 0xac, 0xef, 0x83, 0x8b, 0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80,
+          0xad, 0xc4, 0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0 };
+
+  const uint8_t ct15[17]
+      = { 0x6c, 0x16, 0x25, 0xdb, 0x46, 0x71, 0x52, 0x2d, 0x3d,
+          0x75, 0x99, 0x60, 0x1d, 0xe7, 0xca, 0x09, 0xed };
+
+  memset (key, 0, sizeof (key));
+  memset (tweak, 0, sizeof (tweak));
+  memset (pt, 0, sizeof (pt));
+  aes128_xts_set_key (&ctx, key);
+  if (aes128_xts_encrypt (&ctx, tweak, pt, buffer, sizeof (ct1)) != 0)
+    return false;
+  hexdump (buffer, sizeof (ct1));
+  if (memcmp (buffer, ct1, sizeof (ct1)) != 0)
+    return false;
+  if (aes128_xts_decrypt (&ctx, tweak, buffer, buffer, sizeof (ct1)) != 0
+      || memcmp (buffer, pt, sizeof (ct1)) != 0)
+    return false;
+
+  memset (key, 0x11, AES128_KEY_SIZE);
+  memset (key + AES128_KEY_SIZE, 0x22, AES128_KEY_SIZE);
+  memset (tweak, 0x33, 5);
+  memset (pt, 0x44, sizeof (pt));
+  aes128_xts_set_key (&ctx, key);
+  if (aes128_xts_encrypt (&ctx, tweak, pt, buffer, sizeof (ct2)) != 0)
+    return false;
+  hexdump (buffer, sizeof (ct2));
+  if (memcmp (buffer, ct2, sizeof (ct2)) != 0)
+    return false;
+  if (aes128_xts_decrypt (&ctx, tweak, buffer, buffer, sizeof (ct2)) != 0
+      || memcmp (buffer, pt, sizeof (ct2)) != 0)
+    return false;
+
+  /* A data unit of 17 bytes, which needs ciphertext stealing. */
+  for (i = 0; i < AES128_KEY_SIZE; ++i)
+    {
+      key[i] = (uint8_t)(0xff - i);
+      key[AES128_KEY_SIZE + i] = (uint8_t)(0xbf - i);
+    }
+  memset (tweak, 0, sizeof (tweak));
+  tweak[0] = 0x9a;
+  tweak[1] = 0x78;
+  tweak[2] = 0x56;
+  tweak[3] = 0x34;
+  tweak[4] = 0x12;
+  for (i = 0; i < sizeof (ct15); ++i)
+    pt[i] = (uint8_t)i;
+  aes128_xts_set_key (&ctx, key);
+  if (aes128_xts_encrypt (&ctx, tweak, pt, buffer, sizeof (ct15)) != 0)
+    return false;
+  hexdump (buffer, sizeof (ct15));
+  if (memcmp (buffer, ct15, sizeof (ct15)) != 0)
+    return false;
+  if (aes128_xts_decrypt (&ctx, tweak, buffer, buffer, sizeof (ct15)) != 0
+      || memcmp (buffer, pt, sizeof (ct15)) != 0)
+    return false;
+
+  /* Data units shorter than a block are rejected. */
+  errno = 0;
+  if (aes128_xts_encrypt (&ctx, tweak, pt, buffer, AES_BLOCK_SIZE - 1) != -1
+      || errno != EINVAL)
+    return false;
+
+  return true;
+}
+
+/*
+ * A data unit of nine blocks and a partial block, which goes through both
+ * the multi-block loop and ciphertext stealing. The expected output was
+ * computed with OpenSSL.
+ */
+static bool
+run_aes256_xts_test (void)
+{
+  struct aes256_xts_ctx ctx;
+  uint8_t key[AES256_XTS_KEY_SIZE];
+  uint8_t tweak[AES_XTS_TWEAK_SIZE];
+  uint8_t pt[145], buffer[145];
+  size_t i;
+
+  const uint8_t ct[sizeof (pt)]
+      = { 0x41, 0x9e, 0x07, 0xa7, 0x53, 0x5a, 0xb9, 0x8a, 0xa1, 0x94, 0xfb,
+          0x1c, 0x5f, 0x07, 0xe9, 0x1f, 0x2f, 0x2f, 0xc4, 0x64, 0xfe, 0xab,
+          0xd2, 0x8f, 0xc6, 0x19, 0xc2, 0x31, 0x99, 0x6a, 0xaa, 0x94, 0x84,
+          0x8d, 0x5c, 0x19, 0xca, 0x64, 0x79, 0x9d, 0xee, 0xb8, 0x48, 0x4e,
+          0x00, 0x0a, 0x85, 0xfa, 0x71, 0x02, 0x3c, 0xdd, 0xd1, 0xf9, 0x22,
+          0xad, 0xb2, 0xee, 0x01, 0x18, 0x51, 0xf1, 0xc7, 0xb8, 0xe2, 0xa2,
+          0x89, 0xbb, 0x37, 0xe8, 0x00, 0xa1, 0x51, 0x6e, 0xd3, 0x12, 0xa1,
+          0xbb, 0x22, 0xc7, 0x6b, 0xb1, 0xde, 0x06, 0xcc, 0x86, 0x97, 0x2b,
+          0x24, 0xd9, 0x2f, 0x10, 0x0f, 0x7b, 0x40, 0x51, 0x1d, 0xcb, 0xd7,
+          0xb9, 0x49, 0x3f, 0x98, 0x3e, 0xe9, 0x3b, 0xd1, 0x80, 0x04, 0xca,
+          0xed, 0x24, 0xdb, 0x06, 0x77, 0x7d, 0xfe, 0x49, 0x6d, 0x8b, 0x32,
+          0x5f, 0x34, 0x92, 0x98, 0x6e, 0x91, 0xef, 0x06, 0x0c, 0x1b, 0x5d,
+          0xcb, 0x03, 0x51, 0xc8, 0x44, 0x4c, 0xb6, 0x84, 0x01, 0x2f, 0x39,
+          0x9f, 0x12 };
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)i;
+  memset (tweak, 0, sizeof (tweak));
+  tweak[0] = 0x9a;
+  tweak[1] = 0x78;
+  tweak[2] = 0x56;
+  tweak[3] = 0x34;
+  tweak[4] = 0x12;
+  fill_message (pt, sizeof (pt));
+
+  aes256_xts_set_key (&ctx, key);
+  if (aes256_xts_encrypt (&ctx, tweak, pt, buffer, sizeof (buffer)) != 0)
+    return false;
+  hexdump (buffer, sizeof (buffer));
+  if (memcmp (buffer, ct, sizeof (ct)) != 0)
+    return false;
+  if (aes256_xts_decrypt (&ctx, tweak, buffer, buffer, sizeof (buffer)) != 0
+      || memcmp (buffer, pt, sizeof (pt)) != 0)
+    return false;
+
+  return true;
+}
+
+/*
+ * The sector interface must match aes128_xts_encrypt with the little-endian
+ * sector numbers as tweaks, including for a count that is not a multiple of
+ * the number of tweaks encrypted at once and for ragged sectors.
+ */
+static bool
+run_aes128_xts_sectors_test (void)
+{
+  static uint8_t pt[19 * 520], ct[19 * 520], buffer[19 * 520];
+  const size_t sizes[3] = { 512, 520, 4096 };
+  struct aes128_xts_ctx ctx;
+  uint8_t key[AES128_XTS_KEY_SIZE];
+  uint8_t tweak[AES_XTS_TWEAK_SIZE];
+  uint64_t sectors[19];
+  size_t i, j, n, size;
+
+  for (i = 0; i < sizeof (key); ++i)
+    key[i] = (uint8_t)(i * 13 + 5);
+  aes128_xts_set_key (&ctx, key);
+  fill_message (pt, sizeof (pt));
+  for (i = 0; i < 19; ++i)
+    sectors[i] = UINT64_C (0x0123456789abcdef) * i + 1000;
+
+  for (i = 0; i < 3; ++i)
+    {
+      size = sizes[i];
+      n = sizeof (pt) / size;
+      if (aes128_xts_encrypt_sectors (&ctx, sectors, pt, ct, size, n) != 0)
+        return false;
+      for (j = 0; j < n; ++j)
+        {
+          memset (tweak, 0, sizeof (tweak));
+          tweak[0] = (uint8_t)sectors[j];
+          tweak[1] = (uint8_t)(sectors[j] >> 8);
+          tweak[2] = (uint8_t)(sectors[j] >> 16);
+          tweak[3] = (uint8_t)(sectors[j] >> 24);
+          tweak[4] = (uint8_t)(sectors[j] >> 32);
+          tweak[5] = (uint8_t)(sectors[j] >> 40);
+          tweak[6] = (uint8_t)(sectors[j] >> 48);
+          tweak[7] = (uint8_t)(sectors[j] >> 56);
+          aes128_xts_encrypt (&ctx, tweak, pt + j * size, buffer, size);
+          if (memcmp (buffer, ct + j * size, size) != 0)
+            return false;
+        }
+
+      memcpy (buffer, ct, n * size);
+      if (aes128_xts_decrypt_sectors (&ctx, sectors, buffer, buffer, size, n)
+          != 0)
+        return false;
+      if (memcmp (buffer, pt, n * size) != 0)
+        return false;
+    }
+
+  errno = 0;
+  if (aes128_xts_encrypt_sectors (&ctx, sectors, pt, ct, 8, 1) != -1
+      || errno != EINVAL)
+    return false;
+
+  return true;
+}
+
+static void
+fill_message (uint8_t *message, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    message[i] = (uint8_t)(i * 7 + 1);
+}
+
+static void
+hexdump (const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    printf ("%02x", data[i]);
+  printf ("\n");
+}
@@ -0,0 +1,194 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "xxhash.h"
+
+/*
+ * Expected hashes of fill_message output, computed with the reference
+ * xxHash library. The lengths cover each of the short input cases of XXH3,
+ * the boundary of its 1024-byte blocks and a partial final stripe.
+ */
+struct xxhash_test
+{
+  size_t len;
+  uint64_t seed;
+  uint64_t xxh64;
+  uint64_t xxh3;
+};
+
+static const struct xxhash_test xxhash_tests[] = {
+  { 0, 0, UINT64_C (0xef46db3751d8e999),
+    UINT64_C (0x2d06800538d394c2) },
+  { 1, 0, UINT64_C (0x8a4127811b21e730),
+    UINT64_C (0xe12ef9d2eb86ceeb) },
+  { 3, 0, UINT64_C (0xb6e6c910c2fd373a),
+    UINT64_C (0x5c83885a0fb5d516) },
+  { 4, 0, UINT64_C (0x22eda2cf6af4c124),
+    UINT64_C (0x244f36de481e7522) },
+  { 8, 0, UINT64_C (0xc6f1803a5e0b3222),
+    UINT64_C (0x96cc97a6768fd7a9) },
+  { 9, 0, UINT64_C (0x9e8adf2a0ccdb6da),
+    UINT64_C (0x4781d83b8e99d495) },
+  { 16, 0, UINT64_C (0xafe8f989a0735a8e),
+    UINT64_C (0x913bd4a8038027a7) },
+  { 17, 0, UINT64_C (0xb191cd44210ea488),
+    UINT64_C (0x2bf6f66973a6179d) },
+  { 128, 0, UINT64_C (0x85cbe89fe5a0317d),
+    UINT64_C (0xc4399c7829d0628f) },
+  { 129, 0, UINT64_C (0x6c9a4008b493e757),
+    UINT64_C (0x8433489056750b32) },
+  { 240, 0, UINT64_C (0xbbbbb56821328cac),
+    UINT64_C (0x3c0bb96864e543a1) },
+  { 241, 0, UINT64_C (0x6c9698e4efdc2e1f),
+    UINT64_C (0xbff7215089202d8f) },
+  { 1024, 0, UINT64_C (0x84b6d3f9f48b9584),
+    UINT64_C (0xac8e32e4ea3ba062) },
+  { 1025, 0, UINT64_C (0xdcb3bd6722591006),
+    UINT64_C (0xc856c953bbdbc807) },
+  { 2367, 0, UINT64_C (0x8eb13d1a8717b904),
+    UINT64_C (0x4c6b547b3779f79b) },
+  { 0, 0x9e3779b1, UINT64_C (0xac75fda2929b17ef),
+    UINT64_C (0xf702ca3814de2125) },
+  { 1, 0x9e3779b1, UINT64_C (0x211ae13247ce135f),
+    UINT64_C (0x8eb18c6c626335f3) },
+  { 3, 0x9e3779b1, UINT64_C (0x0ccdb2c7c2850613),
+    UINT64_C (0x28250dd038bf4ace) },
+  { 4, 0x9e3779b1, UINT64_C (0x446be1f3228ed3c3),
+    UINT64_C (0x9f9ccd990845e99d) },
+  { 8, 0x9e3779b1, UINT64_C (0xb872c2fb02e71655),
+    UINT64_C (0xe955c40d0c249ba4) },
+  { 9, 0x9e3779b1, UINT64_C (0x27ac6a38a58004a8),
+    UINT64_C (0xa824e3bfea02ba12) },
+  { 16, 0x9e3779b1, UINT64_C (0x170f6a9cdd26fb1c),
+    UINT64_C (0x7f7f0c553df2cfd4) },
+  { 17, 0x9e3779b1, UINT64_C (0xe7d326229356b712),
+    UINT64_C (0x876aef009169c7b9) },
+  { 128, 0x9e3779b1, UINT64_C (0xf4393829f49c2217),
+    UINT64_C (0xc21a7666f6e6e285) },
+  { 129, 0x9e3779b1, UINT64_C (0x5c1ed7b801c4b84d),
+    UINT64_C (0xb0ade9b9f0513a57) },
+  { 240, 0x9e3779b1, UINT64_C (0x7f5fcc114366caee),
+    UINT64_C (0x15cf0ea158f30298) },
+  { 241, 0x9e3779b1, UINT64_C (0x5f67bd1c6593bda3),
+    UINT64_C (0xad84d05ef1db2003) },
+  { 1024, 0x9e3779b1, UINT64_C (0xf24b14aac92019ad),
+    UINT64_C (0x109414fc31bb935a) },
+  { 1025, 0x9e3779b1, UINT64_C (0x9b05fb01539dcb9d),
+    UINT64_C (0xc8206f193f23371a) },
+  { 2367, 0x9e3779b1, UINT64_C (0x9967a759c910737e),
+    UINT64_C (0xc61378e180336a89) },
+};
+
+static bool run_xxhash_test (void);
+static bool run_xxhash_split_test (void);
+static void fill_message (uint8_t *, size_t);
+
+int
+main (void)
+{
+  if (!run_xxhash_test ())
+    return 1;
+  if (!run_xxhash_split_test ())
+    return 1;
+  return 0;
+}
+
+static bool
+run_xxhash_test (void)
+{
+  static uint8_t message[2400];
+  struct xxh64_ctx ctx64;
+  struct xxh3_ctx ctx3;
+  uint64_t h64, h3;
+  size_t i;
+
+  fill_message (message, sizeof (message));
+  for (i = 0; i < sizeof (xxhash_tests) / sizeof (xxhash_tests[0]); ++i)
+    {
+      h64 = xxh64 (xxhash_tests[i].seed, message, xxhash_tests[i].len);
+      h3 = xxh3 (xxhash_tests[i].seed, message, xxhash_tests[i].len);
+      printf ("%4zu %016llx %016llx\n", xxhash_tests[i].len,
+              (unsigned long long)h64, (unsigned long long)h3);
+      if (h64 != xxhash_tests[i].xxh64 || h3 != xxhash_tests[i].xxh3)
+        return false;
+
+      xxh64_init (&ctx64, xxhash_tests[i].seed);
+      xxh64_update (&ctx64, message, xxhash_tests[i].len);
+      xxh3_init (&ctx3, xxhash_tests[i].seed);
+      xxh3_update (&ctx3, message, xxhash_tests[i].len);
+      if (xxh64_final (&ctx64) != h64 || xxh3_final (&ctx3) != h3)
+        return false;
+    }
+  return true;
+}
+
+/*
+ * Streaming in pieces of varying sizes must give the one-shot hash, with
+ * intermediate values read along the way.
+ */
+static bool
+run_xxhash_split_test (void)
+{
+  static uint8_t message[5000];
+  struct xxh64_ctx ctx64;
+  struct xxh3_ctx ctx3;
+  size_t len, off, n, step;
+
+  fill_message (message, sizeof (message));
+  for (len = 0; len <= sizeof (message); len += len < 600 ? 13 : 311)
+    {
+      xxh64_init (&ctx64, 42);
+      xxh3_init (&ctx3, 42);
+      for (off = 0, step = 1; off < len; off += n)
+        {
+          n = len - off < step ? len - off : step;
+          xxh64_update (&ctx64, message + off, n);
+          xxh3_update (&ctx3, message + off, n);
+          if (xxh64_final (&ctx64) != xxh64 (42, message, off + n)
+              || xxh3_final (&ctx3) != xxh3 (42, message, off + n))
+            {
+              printf ("Split hash failed at length %zu\n", len);
+              return false;
+            }
+          step = step * 5 % 301 + 1;
+        }
+    }
+  return true;
+}
+
+static void
+fill_message (uint8_t *message, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    message[i] = (uint8_t)(i * 7 + 1);
+}
@@ -46,9 +46,22 @@ struct tiger_ctx
 void tiger1_init (struct tiger_ctx *);
 void tiger2_init (struct tiger_ctx *);
 void tiger_transform (uint64_t *, const uint8_t *);
+void tiger_transform_blocks (uint64_t *, const uint8_t *, size_t);
+
+/*
+ * Compresses one block into each of two independent states, interleaving
+ * the rounds so that the S-box loads of one hide the latency of the other.
+ */
+void tiger_transform2 (uint64_t *, const uint8_t *, uint64_t *,
+                       const uint8_t *);
 void tiger_update (struct tiger_ctx *, const void *, size_t);
 void tiger192_final (uint8_t *, struct tiger_ctx *);
 void tiger160_final (uint8_t *, struct tiger_ctx *);
 void tiger128_final (uint8_t *, struct tiger_ctx *);
+void tiger_copy (struct tiger_ctx *, const struct tiger_ctx *);
+
+/* One-shot Tiger1 and Tiger2 with 192-bit digests. */
+void tiger1 (uint8_t *, const void *, size_t);
+void tiger2 (uint8_t *, const void *, size_t);
 
 #endif /* TIGER_H */
@@ -0,0 +1,325 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Tiger Tree Hash. Runs of whole leaves are hashed as complete subtrees of a
+ * power of two leaves, two leaves at a time with tiger_transform2, and
+ * tigertree_update_parallel hands the halves of large subtrees to threads.
+ * Because THEX moves an odd node up unchanged, the root is the same as that
+ * of the tree whose left subtrees are always complete, so the roots of
+ * finished subtrees can be kept on a stack and merged as in BLAKE3.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "fcrypt_pool.h"
+#include "fcrypt_wipe.h"
+#include "tiger.h"
+#include "tigertree.h"
+
+/* Smallest subtree worth splitting between two threads. */
+#define TIGERTREE_THREAD_MIN 256
+
+/* Hashes a leaf of at most TIGERTREE_LEAF_SIZE bytes. */
+static void
+tigertree_leaf (const uint8_t *input, size_t inputlen, uint8_t *out)
+{
+  static const uint8_t prefix = 0x00;
+  struct tiger_ctx ctx;
+
+  tiger1_init (&ctx);
+  tiger_update (&ctx, &prefix, 1);
+  tiger_update (&ctx, input, inputlen);
+  tiger192_final (out, &ctx);
+}
+
+/*
+ * Hashes two whole leaves side by side. With the prefix byte a leaf is 1025
+ * bytes: a first block holding the prefix, fifteen blocks read straight from
+ * the input and a last block with the final byte and the padding.
+ */
+static void
+tigertree_leaf2 (const uint8_t *input, const uint8_t *input2, uint8_t *out,
+                 uint8_t *out2)
+{
+  struct tiger_ctx ctx, ctx2;
+  uint8_t block[TIGER_BLOCK_SIZE], block2[TIGER_BLOCK_SIZE];
+  size_t i;
+
+  tiger1_init (&ctx);
+  tiger1_init (&ctx2);
+
+  block[0] = 0x00;
+  block2[0] = 0x00;
+  memcpy (block + 1, input, TIGER_BLOCK_SIZE - 1);
+  memcpy (block2 + 1, input2, TIGER_BLOCK_SIZE - 1);
+  tiger_transform2 (ctx.state, block, ctx2.state, block2);
+
+  for (i = TIGER_BLOCK_SIZE - 1; i + TIGER_BLOCK_SIZE < TIGERTREE_LEAF_SIZE;
+       i += TIGER_BLOCK_SIZE)
+    tiger_transform2 (ctx.state, input + i, ctx2.state, input2 + i);
+
+  memset (block, 0, sizeof (block));
+  memset (block2, 0, sizeof (block2));
+  block[0] = input[TIGERTREE_LEAF_SIZE - 1];
+  block2[0] = input2[TIGERTREE_LEAF_SIZE - 1];
+  block[1] = 0x01;
+  block2[1] = 0x01;
+  buff_put_le64 (block + TIGER_BLOCK_SIZE - 8,
+                 (uint64_t)(TIGERTREE_LEAF_SIZE + 1) << 3);
+  buff_put_le64 (block2 + TIGER_BLOCK_SIZE - 8,
+                 (uint64_t)(TIGERTREE_LEAF_SIZE + 1) << 3);
+  tiger_transform2 (ctx.state, block, ctx2.state, block2);
+
+  for (i = 0; i < 3; ++i)
+    {
+      buff_put_le64 (out + i * 8, ctx.state[i]);
+      buff_put_le64 (out2 + i * 8, ctx2.state[i]);
+    }
+  fcrypt_wipe (&ctx, sizeof (ctx));
+  fcrypt_wipe (&ctx2, sizeof (ctx2));
+}
+
+/* Hashes two nodes into their parent. out may be the same as either. */
+static void
+tigertree_node (const uint8_t *left, const uint8_t *right, uint8_t *out)
+{
+  uint8_t buffer[1 + 2 * TIGERTREE_DIGEST_SIZE];
+
+  buffer[0] = 0x01;
+  memcpy (buffer + 1, left, TIGERTREE_DIGEST_SIZE);
+  memcpy (buffer + 1 + TIGERTREE_DIGEST_SIZE, right, TIGERTREE_DIGEST_SIZE);
+  tiger1 (out, buffer, sizeof (buffer));
+}
+
+static void tigertree_subtree (const uint8_t *, uint64_t, uint8_t *,
+                               unsigned int);
+
+/* One half of a subtree, computed by a task of the thread pool. */
+struct tigertree_subtree_job
+{
+  const uint8_t *input;
+  uint64_t leaves;
+  uint8_t *out;
+  unsigned int threads;
+};
+
+static void
+tigertree_subtree_task (void *arg, size_t index)
+{
+  struct tigertree_subtree_job *job
+      = (struct tigertree_subtree_job *)arg + index;
+
+  tigertree_subtree (job->input, job->leaves, job->out, job->threads);
+}
+
+/*
+ * Computes the root of a complete subtree of leaves whole leaves, a power of
+ * two. With more than one thread the halves are run as two tasks of the
+ * thread pool.
+ */
+static void
+tigertree_subtree (const uint8_t *input, uint64_t leaves, uint8_t *out,
+                   unsigned int threads)
+{
+  uint8_t left[TIGERTREE_DIGEST_SIZE], right[TIGERTREE_DIGEST_SIZE];
+  uint64_t half;
+
+  if (leaves == 1)
+    {
+      tigertree_leaf (input, TIGERTREE_LEAF_SIZE, out);
+      return;
+    }
+  if (leaves == 2)
+    {
+      tigertree_leaf2 (input, input + TIGERTREE_LEAF_SIZE, left, right);
+      tigertree_node (left, right, out);
+      return;
+    }
+
+  half = leaves / 2;
+  if (threads > 1 && leaves >= TIGERTREE_THREAD_MIN)
+    {
+      struct tigertree_subtree_job jobs[2];
+
+      jobs[0].input = input;
+      jobs[0].out = left;
+      jobs[0].threads = threads / 2;
+      jobs[1].input = input + half * TIGERTREE_LEAF_SIZE;
+      jobs[1].out = right;
+      jobs[1].threads = threads - threads / 2;
+      jobs[0].leaves = jobs[1].leaves = half;
+      fcrypt_pool_run (tigertree_subtree_task, jobs, 2, 2);
+    }
+  else
+    {
+      tigertree_subtree (input, half, left, 1);
+      tigertree_subtree (input + half * TIGERTREE_LEAF_SIZE, half, right, 1);
+    }
+  tigertree_node (left, right, out);
+}
+
+static unsigned int
+tigertree_popcount (uint64_t x)
+{
+  unsigned int n;
+
+  for (n = 0; x != 0; ++n)
+    x &= x - 1;
+  return n;
+}
+
+/*
+ * Pushes the root of a complete subtree of leaves leaves and merges the
+ * stack so that one root is left for every bit set in the leaf count.
+ */
+static void
+tigertree_push (struct tigertree_ctx *ctx, const uint8_t *node,
+                uint64_t leaves)
+{
+  uint8_t *top;
+
+  memcpy (&ctx->stack[ctx->stacklen * TIGERTREE_DIGEST_SIZE], node,
+          TIGERTREE_DIGEST_SIZE);
+  ctx->stacklen++;
+  ctx->leaves += leaves;
+
+  while (ctx->stacklen > tigertree_popcount (ctx->leaves))
+    {
+      top = &ctx->stack[(ctx->stacklen - 2) * TIGERTREE_DIGEST_SIZE];
+      tigertree_node (top, top + TIGERTREE_DIGEST_SIZE, top);
+      ctx->stacklen--;
+    }
+}
+
+void
+tigertree_init (struct tigertree_ctx *ctx)
+{
+  ctx->buflen = 0;
+  ctx->leaves = 0;
+  ctx->stacklen = 0;
+}
+
+void
+tigertree_update_parallel (struct tigertree_ctx *ctx, const void *inputptr,
+                           size_t inputlen, unsigned int threads)
+{
+  const uint8_t *input = inputptr;
+  uint8_t node[TIGERTREE_DIGEST_SIZE];
+  uint64_t leaves;
+  size_t n;
+
+  /* Finish the partial leaf. */
+  if (ctx->buflen != 0)
+    {
+      n = TIGERTREE_LEAF_SIZE - ctx->buflen;
+      if (n > inputlen)
+        n = inputlen;
+      memcpy (ctx->buffer + ctx->buflen, input, n);
+      ctx->buflen += n;
+      input += n;
+      inputlen -= n;
+      if (ctx->buflen < TIGERTREE_LEAF_SIZE)
+        return;
+      tigertree_leaf (ctx->buffer, TIGERTREE_LEAF_SIZE, node);
+      tigertree_push (ctx, node, 1);
+      ctx->buflen = 0;
+    }
+
+  /*
+   * Take the largest complete subtree that fits in the input and starts at
+   * a multiple of its own size, so it sits in the tree as a single node.
+   */
+  while (inputlen >= TIGERTREE_LEAF_SIZE)
+    {
+      leaves = 1;
+      while (leaves * 2 <= inputlen / TIGERTREE_LEAF_SIZE
+             && (ctx->leaves & (leaves * 2 - 1)) == 0)
+        leaves *= 2;
+      tigertree_subtree (input, leaves, node, threads);
+      tigertree_push (ctx, node, leaves);
+      input += leaves * TIGERTREE_LEAF_SIZE;
+      inputlen -= leaves * TIGERTREE_LEAF_SIZE;
+    }
+
+  if (inputlen != 0)
+    {
+      memcpy (ctx->buffer, input, inputlen);
+      ctx->buflen = inputlen;
+    }
+}
+
+void
+tigertree_update (struct tigertree_ctx *ctx, const void *input,
+                  size_t inputlen)
+{
+  tigertree_update_parallel (ctx, input, inputlen, 1);
+}
+
+void
+tigertree_final (uint8_t *digest, struct tigertree_ctx *ctx)
+{
+  uint8_t node[TIGERTREE_DIGEST_SIZE];
+  size_t i;
+
+  /* The empty message still has one leaf. */
+  if (ctx->buflen != 0 || ctx->leaves == 0)
+    {
+      tigertree_leaf (ctx->buffer, ctx->buflen, node);
+      tigertree_push (ctx, node, 1);
+    }
+
+  memcpy (node, &ctx->stack[(ctx->stacklen - 1) * TIGERTREE_DIGEST_SIZE],
+          TIGERTREE_DIGEST_SIZE);
+  for (i = ctx->stacklen - 1; i > 0; --i)
+    tigertree_node (&ctx->stack[(i - 1) * TIGERTREE_DIGEST_SIZE], node, node);
+
+  memcpy (digest, node, TIGERTREE_DIGEST_SIZE);
+  fcrypt_wipe (ctx, sizeof (*ctx));
+  fcrypt_wipe (node, sizeof (node));
+}
+
+void
+tigertree (uint8_t *digest, const void *input, size_t inputlen)
+{
+  tigertree_parallel (digest, input, inputlen, 1);
+}
+
+/* As tigertree, with the leaves split among up to threads threads. */
+void
+tigertree_parallel (uint8_t *digest, const void *input, size_t inputlen,
+                    unsigned int threads)
+{
+  struct tigertree_ctx ctx;
+
+  tigertree_init (&ctx);
+  tigertree_update_parallel (&ctx, input, inputlen, threads);
+  tigertree_final (digest, &ctx);
+}
@@ -0,0 +1,62 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef TIGERTREE_H
+#define TIGERTREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tiger.h"
+
+#define TIGERTREE_DIGEST_SIZE TIGER192_DIGEST_SIZE
+#define TIGERTREE_LEAF_SIZE 1024
+#define TIGERTREE_MAX_DEPTH 64
+
+/*
+ * Tiger Tree Hash as specified by THEX: the input is split into 1024-byte
+ * leaves hashed with Tiger after a 0x00 byte, and pairs of nodes are hashed
+ * after a 0x01 byte, with an odd node at the end of a level moved up as is.
+ */
+struct tigertree_ctx
+{
+  uint8_t buffer[TIGERTREE_LEAF_SIZE]; /* Partial leaf */
+  size_t buflen;                       /* Bytes in buffer */
+  uint64_t leaves;                     /* Leaves hashed so far */
+  size_t stacklen;                     /* Subtree roots on the stack */
+  uint8_t stack[TIGERTREE_MAX_DEPTH * TIGERTREE_DIGEST_SIZE];
+};
+
+void tigertree_init (struct tigertree_ctx *);
+void tigertree_update (struct tigertree_ctx *, const void *, size_t);
+
+/* As tigertree_update, with the leaves split among up to threads threads. */
+void tigertree_update_parallel (struct tigertree_ctx *, const void *, size_t,
+                                unsigned int);
+void tigertree_final (uint8_t *, struct tigertree_ctx *);
+void tigertree (uint8_t *, const void *, size_t);
+void tigertree_parallel (uint8_t *, const void *, size_t, unsigned int);
+
+#endif /* TIGERTREE_H */
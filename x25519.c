@@ -0,0 +1,76 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "curve25519-internal.h"
+#include "fcrypt_wipe.h"
+#include "x25519.h"
+
+static void
+x25519_clamp (uint8_t *k, const uint8_t *key)
+{
+  memcpy (k, key, X25519_KEY_SIZE);
+  k[0] &= 248;
+  k[31] &= 127;
+  k[31] |= 64;
+}
+
+void
+x25519_base (uint8_t *out, const uint8_t *key)
+{
+  uint8_t k[X25519_KEY_SIZE];
+
+  x25519_clamp (k, key);
+  curve25519_scalarmult_base (out, k);
+  fcrypt_wipe (k, sizeof (k));
+}
+
+int
+x25519 (uint8_t *out, const uint8_t *key, const uint8_t *point)
+{
+  uint8_t k[X25519_KEY_SIZE];
+  uint8_t acc;
+  size_t i;
+
+  x25519_clamp (k, key);
+  curve25519_scalarmult (out, k, point);
+  fcrypt_wipe (k, sizeof (k));
+
+  acc = 0;
+  for (i = 0; i < X25519_KEY_SIZE; ++i)
+    acc |= out[i];
+  if (acc == 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  return 0;
+}
@@ -0,0 +1,50 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * X25519 Diffie-Hellman as described in RFC 7748, "Elliptic Curves for
+ * Security". Private keys are 32 random bytes, which are clamped here, and
+ * public keys and shared secrets are encoded u-coordinates.
+ */
+
+#ifndef X25519_H
+#define X25519_H
+
+#include <stdint.h>
+
+#define X25519_KEY_SIZE 32
+
+/* Writes the public key of the private key in the second argument. */
+void x25519_base (uint8_t *, const uint8_t *);
+
+/*
+ * Writes the shared secret of the private key in the second argument and
+ * the public key of the peer in the third. Returns 0, or -1 with errno set
+ * to EINVAL if the secret is all zeros, which happens when the peer sends a
+ * point of small order and must be treated as a failed exchange.
+ */
+int x25519 (uint8_t *, const uint8_t *, const uint8_t *);
+
+#endif /* X25519_H */
@@ -0,0 +1,64 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Interface between xxhash.c and the vector XXH3 implementations. The eight
+ * accumulators of a long input are independent lanes, so a backend handles
+ * two, four or eight of them per instruction. Only the loop over the
+ * stripes of the input is vectorized, the short input and finalization
+ * code is shared.
+ */
+
+#ifndef XXHASH_INTERNAL_H
+#define XXHASH_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define XXH_PRIME32_1 UINT32_C (0x9e3779b1)
+
+struct xxh3_backend
+{
+  const char *name;
+  /*
+   * Adds the given number of stripes of input to the accumulators, using
+   * the secret from the given offset and advancing 8 bytes per stripe.
+   */
+  void (*accumulate) (uint64_t *, const uint8_t *, const uint8_t *, size_t);
+  /* Scrambles the accumulators with the last 64 bytes of the secret. */
+  void (*scramble) (uint64_t *, const uint8_t *);
+};
+
+#if defined(HAVE_SSE2_INTRINSICS)
+/* Two lanes per register in xxhash-sse2.c. */
+extern const struct xxh3_backend xxh3_backend_sse2;
+#endif
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* Four lanes per register in xxhash-avx2.c. */
+extern const struct xxh3_backend xxh3_backend_avx2;
+#endif
+
+#endif /* XXHASH_INTERNAL_H */
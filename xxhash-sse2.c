@@ -0,0 +1,103 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * XXH3 with SSE2, holding 2 of the eight accumulators in each register. The
+ * 32 by 32-bit multiplications map to _mm_mul_epu32 and swapping the data
+ * words of each pair to a shuffle.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xxhash-internal.h"
+#include "xxhash.h"
+
+#if defined(HAVE_SSE2_INTRINSICS)
+
+#include <emmintrin.h>
+
+#define SSE2_TARGET __attribute__ ((target (SSE2_TARGET_ATTRIBUTE)))
+
+/* Registers holding the eight accumulators. */
+#define SSE2_REGS 4
+
+SSE2_TARGET static void
+xxh3_accumulate_sse2 (uint64_t *acc, const uint8_t *input,
+                      const uint8_t *secret, size_t stripes)
+{
+  __m128i a[SSE2_REGS], data, key;
+  size_t i;
+
+  for (i = 0; i < SSE2_REGS; ++i)
+    a[i] = _mm_loadu_si128 ((const __m128i *)acc + i);
+  for (; stripes > 0; --stripes, input += XXH3_STRIPE_SIZE, secret += 8)
+    for (i = 0; i < SSE2_REGS; ++i)
+      {
+        data = _mm_loadu_si128 ((const __m128i *)input + i);
+        key = _mm_loadu_si128 ((const __m128i *)secret + i);
+        key = _mm_xor_si128 (data, key);
+        key = _mm_mul_epu32 (key, _mm_shuffle_epi32 (key, 0x31));
+        a[i] = _mm_add_epi64 (a[i], _mm_shuffle_epi32 (data, 0x4e));
+        a[i] = _mm_add_epi64 (a[i], key);
+      }
+  for (i = 0; i < SSE2_REGS; ++i)
+    _mm_storeu_si128 ((__m128i *)acc + i, a[i]);
+}
+
+SSE2_TARGET static void
+xxh3_scramble_sse2 (uint64_t *acc, const uint8_t *secret)
+{
+  __m128i a, key, prime, lo, hi;
+  size_t i;
+
+  prime = _mm_set1_epi32 ((int)XXH_PRIME32_1);
+  for (i = 0; i < SSE2_REGS; ++i)
+    {
+      a = _mm_loadu_si128 ((const __m128i *)acc + i);
+      key = _mm_loadu_si128 ((const __m128i *)secret + i);
+      a = _mm_xor_si128 (a, _mm_srli_epi64 (a, 47));
+      a = _mm_xor_si128 (a, key);
+      lo = _mm_mul_epu32 (a, prime);
+      hi = _mm_mul_epu32 (_mm_shuffle_epi32 (a, 0x31), prime);
+      a = _mm_add_epi64 (lo, _mm_slli_epi64 (hi, 32));
+      _mm_storeu_si128 ((__m128i *)acc + i, a);
+    }
+}
+
+const struct xxh3_backend xxh3_backend_sse2 = {
+  "sse2",
+  xxh3_accumulate_sse2,
+  xxh3_scramble_sse2,
+};
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int xxhash_sse2_unused;
+
+#endif /* HAVE_SSE2_INTRINSICS */
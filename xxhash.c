@@ -0,0 +1,580 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bswap.h"
+#include "circularshift.h"
+#include "fcrypt_cpu.h"
+#include "xxhash-internal.h"
+#include "xxhash.h"
+
+#define XXH_PRIME32_2 UINT32_C (0x85ebca77)
+#define XXH_PRIME32_3 UINT32_C (0xc2b2ae3d)
+
+#define XXH_PRIME64_1 UINT64_C (0x9e3779b185ebca87)
+#define XXH_PRIME64_2 UINT64_C (0xc2b2ae3d27d4eb4f)
+#define XXH_PRIME64_3 UINT64_C (0x165667b19e3779f9)
+#define XXH_PRIME64_4 UINT64_C (0x85ebca77c2b2ae63)
+#define XXH_PRIME64_5 UINT64_C (0x27d4eb2f165667c5)
+
+#define XXH_PRIME_MX1 UINT64_C (0x165667919e3779f9)
+#define XXH_PRIME_MX2 UINT64_C (0x9fb21c651e98df25)
+
+/* Stripes per block, each stripe using the secret 8 bytes further on. */
+#define XXH3_BLOCK_STRIPES ((XXH3_SECRET_SIZE - XXH3_STRIPE_SIZE) / 8)
+#define XXH3_BLOCK_SIZE (XXH3_BLOCK_STRIPES * XXH3_STRIPE_SIZE)
+
+/* Longest input hashed without the accumulators. */
+#define XXH3_MIDSIZE_MAX 240
+
+/* The default secret, which seeds other than zero are added to. */
+static const uint8_t xxh3_secret[XXH3_SECRET_SIZE] = {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c,
+  0xf7, 0x21, 0xad, 0x1c, 0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+  0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f, 0xcb, 0x79, 0xe6, 0x4e,
+  0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6,
+  0x81, 0x3a, 0x26, 0x4c, 0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+  0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3, 0x71, 0x64, 0x48, 0x97,
+  0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7,
+  0xc7, 0x0b, 0x4f, 0x1d, 0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+  0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64, 0xea, 0xc5, 0xac, 0x83,
+  0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26,
+  0x29, 0xd4, 0x68, 0x9e, 0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+  0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce, 0x45, 0xcb, 0x3a, 0x8f,
+  0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static const uint64_t xxh3_init_acc[8] = {
+  XXH_PRIME32_3, XXH_PRIME64_1, XXH_PRIME64_2, XXH_PRIME64_3,
+  XXH_PRIME64_4, XXH_PRIME32_2, XXH_PRIME64_5, XXH_PRIME32_1,
+};
+
+static uint64_t
+xxh64_round (uint64_t acc, uint64_t input)
+{
+  acc += input * XXH_PRIME64_2;
+  return rotl64 (acc, 31) * XXH_PRIME64_1;
+}
+
+static uint64_t
+xxh64_merge_round (uint64_t acc, uint64_t lane)
+{
+  acc ^= xxh64_round (0, lane);
+  return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+static uint64_t
+xxh64_avalanche (uint64_t h)
+{
+  h ^= h >> 33;
+  h *= XXH_PRIME64_2;
+  h ^= h >> 29;
+  h *= XXH_PRIME64_3;
+  return h ^ (h >> 32);
+}
+
+static void
+xxh64_blocks (uint64_t *state, const uint8_t *input, size_t blocks)
+{
+  uint64_t v0, v1, v2, v3;
+
+  v0 = state[0];
+  v1 = state[1];
+  v2 = state[2];
+  v3 = state[3];
+  for (; blocks > 0; --blocks, input += XXH64_BLOCK_SIZE)
+    {
+      v0 = xxh64_round (v0, buff_get_le64 (input));
+      v1 = xxh64_round (v1, buff_get_le64 (input + 8));
+      v2 = xxh64_round (v2, buff_get_le64 (input + 16));
+      v3 = xxh64_round (v3, buff_get_le64 (input + 24));
+    }
+  state[0] = v0;
+  state[1] = v1;
+  state[2] = v2;
+  state[3] = v3;
+}
+
+static void
+xxh64_init_state (uint64_t *state, uint64_t seed)
+{
+  state[0] = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+  state[1] = seed + XXH_PRIME64_2;
+  state[2] = seed;
+  state[3] = seed - XXH_PRIME64_1;
+}
+
+/*
+ * Merges the lanes, or starts from the seed if no whole block was seen, and
+ * mixes in the len < 32 bytes of input that are left.
+ */
+static uint64_t
+xxh64_finish (const uint64_t *state, uint64_t seed, uint64_t inputlen,
+              const uint8_t *input, size_t len)
+{
+  uint64_t h;
+
+  if (inputlen >= XXH64_BLOCK_SIZE)
+    {
+      h = rotl64 (state[0], 1) + rotl64 (state[1], 7)
+          + rotl64 (state[2], 12) + rotl64 (state[3], 18);
+      h = xxh64_merge_round (h, state[0]);
+      h = xxh64_merge_round (h, state[1]);
+      h = xxh64_merge_round (h, state[2]);
+      h = xxh64_merge_round (h, state[3]);
+    }
+  else
+    h = seed + XXH_PRIME64_5;
+  h += inputlen;
+  for (; len >= 8; input += 8, len -= 8)
+    {
+      h ^= xxh64_round (0, buff_get_le64 (input));
+      h = rotl64 (h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+  if (len >= 4)
+    {
+      h ^= (uint64_t)buff_get_le32 (input) * XXH_PRIME64_1;
+      h = rotl64 (h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+      input += 4;
+      len -= 4;
+    }
+  for (; len > 0; ++input, --len)
+    {
+      h ^= *input * XXH_PRIME64_5;
+      h = rotl64 (h, 11) * XXH_PRIME64_1;
+    }
+  return xxh64_avalanche (h);
+}
+
+void
+xxh64_init (struct xxh64_ctx *ctx, uint64_t seed)
+{
+  xxh64_init_state (ctx->state, seed);
+  ctx->inputlen = 0;
+  ctx->seed = seed;
+  ctx->bufferlen = 0;
+}
+
+void
+xxh64_update (struct xxh64_ctx *ctx, const void *inputptr, size_t len)
+{
+  const uint8_t *input = inputptr;
+  size_t n;
+
+  ctx->inputlen += len;
+  if (ctx->bufferlen > 0)
+    {
+      n = XXH64_BLOCK_SIZE - ctx->bufferlen;
+      if (len < n)
+        {
+          memcpy (ctx->buffer + ctx->bufferlen, input, len);
+          ctx->bufferlen += (uint8_t)len;
+          return;
+        }
+      memcpy (ctx->buffer + ctx->bufferlen, input, n);
+      xxh64_blocks (ctx->state, ctx->buffer, 1);
+      input += n;
+      len -= n;
+    }
+  xxh64_blocks (ctx->state, input, len / XXH64_BLOCK_SIZE);
+  input += len - len % XXH64_BLOCK_SIZE;
+  len %= XXH64_BLOCK_SIZE;
+  memcpy (ctx->buffer, input, len);
+  ctx->bufferlen = (uint8_t)len;
+}
+
+uint64_t
+xxh64_final (const struct xxh64_ctx *ctx)
+{
+  return xxh64_finish (ctx->state, ctx->seed, ctx->inputlen, ctx->buffer,
+                       ctx->bufferlen);
+}
+
+uint64_t
+xxh64 (uint64_t seed, const void *inputptr, size_t len)
+{
+  const uint8_t *input = inputptr;
+  uint64_t state[4];
+  size_t blocks;
+
+  xxh64_init_state (state, seed);
+  blocks = len / XXH64_BLOCK_SIZE;
+  xxh64_blocks (state, input, blocks);
+  return xxh64_finish (state, seed, len, input + blocks * XXH64_BLOCK_SIZE,
+                       len % XXH64_BLOCK_SIZE);
+}
+
+static void
+xxh3_accumulate_generic (uint64_t *acc, const uint8_t *input,
+                         const uint8_t *secret, size_t stripes)
+{
+  uint64_t data, key;
+  size_t i;
+
+  for (; stripes > 0; --stripes, input += XXH3_STRIPE_SIZE, secret += 8)
+    for (i = 0; i < 8; ++i)
+      {
+        data = buff_get_le64 (input + 8 * i);
+        key = data ^ buff_get_le64 (secret + 8 * i);
+        acc[i ^ 1] += data;
+        acc[i] += (key & 0xffffffff) * (key >> 32);
+      }
+}
+
+static void
+xxh3_scramble_generic (uint64_t *acc, const uint8_t *secret)
+{
+  size_t i;
+
+  for (i = 0; i < 8; ++i)
+    {
+      acc[i] ^= acc[i] >> 47;
+      acc[i] ^= buff_get_le64 (secret + 8 * i);
+      acc[i] *= XXH_PRIME32_1;
+    }
+}
+
+static const struct xxh3_backend xxh3_backend_generic = {
+  "generic",
+  xxh3_accumulate_generic,
+  xxh3_scramble_generic,
+};
+
+static const struct xxh3_backend *xxh3_backend = &xxh3_backend_generic;
+
+#if defined(__GNUC__)
+__attribute__ ((constructor)) static void
+xxh3_select_backend (void)
+{
+  uint32_t features;
+
+  features = fcrypt_cpu_features ();
+#if defined(HAVE_AVX2_INTRINSICS)
+  if ((features & FCRYPT_CPU_AVX2) != 0)
+    {
+      xxh3_backend = &xxh3_backend_avx2;
+      return;
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+  if ((features & FCRYPT_CPU_SSE2) != 0)
+    {
+      xxh3_backend = &xxh3_backend_sse2;
+      return;
+    }
+#endif
+  (void)features;
+}
+#endif
+
+/* The high and low halves of the 128-bit product, XORed together. */
+static inline uint64_t
+xxh3_mul128_fold64 (uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ unsigned __int128 p = (unsigned __int128)a * b;
+
+  return (uint64_t)p ^ (uint64_t)(p >> 64);
+#else
+  uint64_t lo_lo, hi_lo, lo_hi, hi_hi, cross, upper, lower;
+
+  lo_lo = (a & 0xffffffff) * (b & 0xffffffff);
+  hi_lo = (a >> 32) * (b & 0xffffffff);
+  lo_hi = (a & 0xffffffff) * (b >> 32);
+  hi_hi = (a >> 32) * (b >> 32);
+  cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+  upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+  lower = (cross << 32) | (lo_lo & 0xffffffff);
+  return lower ^ upper;
+#endif
+}
+
+static inline uint64_t
+xxh3_avalanche (uint64_t h)
+{
+  h ^= h >> 37;
+  h *= XXH_PRIME_MX1;
+  return h ^ (h >> 32);
+}
+
+static inline uint64_t
+xxh3_rrmxmx (uint64_t h, uint64_t len)
+{
+  h ^= rotl64 (h, 49) ^ rotl64 (h, 24);
+  h *= XXH_PRIME_MX2;
+  h ^= (h >> 35) + len;
+  h *= XXH_PRIME_MX2;
+  return h ^ (h >> 28);
+}
+
+static inline uint64_t
+xxh3_mix16 (const uint8_t *input, const uint8_t *secret, uint64_t seed)
+{
+  return xxh3_mul128_fold64 (
+      buff_get_le64 (input) ^ (buff_get_le64 (secret) + seed),
+      buff_get_le64 (input + 8) ^ (buff_get_le64 (secret + 8) - seed));
+}
+
+/*
+ * Inputs of up to 240 bytes are hashed directly with the default secret,
+ * using code specialized for each range of lengths.
+ */
+static uint64_t
+xxh3_short (uint64_t seed, const uint8_t *input, size_t len)
+{
+  const uint8_t *secret = xxh3_secret;
+  uint64_t acc, lo, hi;
+  uint32_t a, b;
+  size_t i;
+
+  if (len == 0)
+    return xxh64_avalanche (seed ^ buff_get_le64 (secret + 56)
+                            ^ buff_get_le64 (secret + 64));
+  if (len <= 3)
+    {
+      a = ((uint32_t)input[0] << 16) | ((uint32_t)input[len >> 1] << 24)
+          | input[len - 1] | ((uint32_t)len << 8);
+      lo = (uint64_t)(buff_get_le32 (secret) ^ buff_get_le32 (secret + 4))
+           + seed;
+      return xxh64_avalanche (a ^ lo);
+    }
+  if (len <= 8)
+    {
+      seed ^= (uint64_t)bswap32 ((uint32_t)seed) << 32;
+      a = buff_get_le32 (input);
+      b = buff_get_le32 (input + len - 4);
+      lo = (buff_get_le64 (secret + 8) ^ buff_get_le64 (secret + 16)) - seed;
+      return xxh3_rrmxmx ((b + ((uint64_t)a << 32)) ^ lo, len);
+    }
+  if (len <= 16)
+    {
+      lo = buff_get_le64 (input)
+           ^ ((buff_get_le64 (secret + 24) ^ buff_get_le64 (secret + 32))
+              + seed);
+      hi = buff_get_le64 (input + len - 8)
+           ^ ((buff_get_le64 (secret + 40) ^ buff_get_le64 (secret + 48))
+              - seed);
+      acc = len + bswap64 (lo) + hi + xxh3_mul128_fold64 (lo, hi);
+      return xxh3_avalanche (acc);
+    }
+
+  acc = len * XXH_PRIME64_1;
+  if (len <= 128)
+    {
+      /* Pairs of blocks from each end, meeting in the middle. */
+      for (i = (len - 1) / 32; i > 0; --i)
+        {
+          acc += xxh3_mix16 (input + 16 * i, secret + 32 * i, seed);
+          acc += xxh3_mix16 (input + len - 16 * (i + 1),
+                             secret + 32 * i + 16, seed);
+        }
+      acc += xxh3_mix16 (input, secret, seed);
+      acc += xxh3_mix16 (input + len - 16, secret + 16, seed);
+      return xxh3_avalanche (acc);
+    }
+
+  for (i = 0; i < 8; ++i)
+    acc += xxh3_mix16 (input + 16 * i, secret + 16 * i, seed);
+  acc = xxh3_avalanche (acc);
+  for (i = 8; i < len / 16; ++i)
+    acc += xxh3_mix16 (input + 16 * i, secret + 16 * (i - 8) + 3, seed);
+  acc += xxh3_mix16 (input + len - 16, secret + 136 - 17, seed);
+  return xxh3_avalanche (acc);
+}
+
+/* Adds the seed to the default secret, for inputs longer than 240 bytes. */
+static void
+xxh3_derive_secret (uint8_t *secret, uint64_t seed)
+{
+  size_t i;
+
+  for (i = 0; i < XXH3_SECRET_SIZE; i += 16)
+    {
+      buff_put_le64 (secret + i, buff_get_le64 (xxh3_secret + i) + seed);
+      buff_put_le64 (secret + i + 8,
+                     buff_get_le64 (xxh3_secret + i + 8) - seed);
+    }
+}
+
+static uint64_t
+xxh3_merge (const uint64_t *acc, const uint8_t *secret, uint64_t start)
+{
+  size_t i;
+
+  for (i = 0; i < 4; ++i)
+    start += xxh3_mul128_fold64 (acc[2 * i] ^ buff_get_le64 (secret + 16 * i),
+                                 acc[2 * i + 1]
+                                     ^ buff_get_le64 (secret + 16 * i + 8));
+  return xxh3_avalanche (start);
+}
+
+/*
+ * The final stripe always ends at the last byte of input, overlapping the
+ * stripes before it, and uses the secret from a fixed offset.
+ */
+static uint64_t
+xxh3_finish (uint64_t *acc, const uint8_t *stripe, const uint8_t *secret,
+             uint64_t inputlen)
+{
+  xxh3_backend->accumulate (acc, stripe,
+                            secret + XXH3_SECRET_SIZE - XXH3_STRIPE_SIZE - 7,
+                            1);
+  return xxh3_merge (acc, secret + 11, inputlen * XXH_PRIME64_1);
+}
+
+/*
+ * Adds stripes to the accumulators, continuing the block that already has
+ * *count stripes and scrambling whenever one is completed.
+ */
+static void
+xxh3_consume (uint64_t *acc, size_t *count, const uint8_t *input,
+              size_t stripes, const uint8_t *secret)
+{
+  size_t n;
+
+  while (*count + stripes >= XXH3_BLOCK_STRIPES)
+    {
+      n = XXH3_BLOCK_STRIPES - *count;
+      xxh3_backend->accumulate (acc, input, secret + 8 * *count, n);
+      xxh3_backend->scramble (acc,
+                              secret + XXH3_SECRET_SIZE - XXH3_STRIPE_SIZE);
+      input += n * XXH3_STRIPE_SIZE;
+      stripes -= n;
+      *count = 0;
+    }
+  xxh3_backend->accumulate (acc, input, secret + 8 * *count, stripes);
+  *count += stripes;
+}
+
+static uint64_t
+xxh3_long (const uint8_t *input, size_t len, const uint8_t *secret)
+{
+  uint64_t acc[8];
+  size_t count;
+
+  memcpy (acc, xxh3_init_acc, sizeof (acc));
+  count = 0;
+  xxh3_consume (acc, &count, input, (len - 1) / XXH3_STRIPE_SIZE, secret);
+  return xxh3_finish (acc, input + len - XXH3_STRIPE_SIZE, secret, len);
+}
+
+uint64_t
+xxh3 (uint64_t seed, const void *inputptr, size_t len)
+{
+  uint8_t secret[XXH3_SECRET_SIZE];
+
+  if (len <= XXH3_MIDSIZE_MAX)
+    return xxh3_short (seed, inputptr, len);
+  if (seed == 0)
+    return xxh3_long (inputptr, len, xxh3_secret);
+  xxh3_derive_secret (secret, seed);
+  return xxh3_long (inputptr, len, secret);
+}
+
+void
+xxh3_init (struct xxh3_ctx *ctx, uint64_t seed)
+{
+  memcpy (ctx->acc, xxh3_init_acc, sizeof (ctx->acc));
+  xxh3_derive_secret (ctx->secret, seed);
+  ctx->inputlen = 0;
+  ctx->seed = seed;
+  ctx->bufferlen = 0;
+  ctx->stripes = 0;
+}
+
+/*
+ * Input is buffered until more than XXH3_BUFFER_SIZE bytes have arrived, so
+ * that the final stripe is always still in the buffer. Whole buffers are
+ * consumed before it is refilled, and the last stripe of input consumed
+ * directly is kept at its end for finals that find fewer bytes buffered.
+ */
+void
+xxh3_update (struct xxh3_ctx *ctx, const void *inputptr, size_t len)
+{
+  const uint8_t *input = inputptr;
+  size_t n;
+
+  ctx->inputlen += len;
+  if (len <= XXH3_BUFFER_SIZE - ctx->bufferlen)
+    {
+      memcpy (ctx->buffer + ctx->bufferlen, input, len);
+      ctx->bufferlen += len;
+      return;
+    }
+  if (ctx->bufferlen > 0)
+    {
+      n = XXH3_BUFFER_SIZE - ctx->bufferlen;
+      memcpy (ctx->buffer + ctx->bufferlen, input, n);
+      input += n;
+      len -= n;
+      xxh3_consume (ctx->acc, &ctx->stripes, ctx->buffer,
+                    XXH3_BUFFER_SIZE / XXH3_STRIPE_SIZE, ctx->secret);
+    }
+  if (len > XXH3_BUFFER_SIZE)
+    {
+      n = (len - 1) / XXH3_STRIPE_SIZE;
+      xxh3_consume (ctx->acc, &ctx->stripes, input, n, ctx->secret);
+      input += n * XXH3_STRIPE_SIZE;
+      len -= n * XXH3_STRIPE_SIZE;
+      memcpy (ctx->buffer + XXH3_BUFFER_SIZE - XXH3_STRIPE_SIZE,
+              input - XXH3_STRIPE_SIZE, XXH3_STRIPE_SIZE);
+    }
+  memcpy (ctx->buffer, input, len);
+  ctx->bufferlen = len;
+}
+
+uint64_t
+xxh3_final (const struct xxh3_ctx *ctx)
+{
+  uint8_t stripe[XXH3_STRIPE_SIZE];
+  uint64_t acc[8];
+  size_t count, n;
+
+  if (ctx->inputlen <= XXH3_MIDSIZE_MAX)
+    return xxh3_short (ctx->seed, ctx->buffer, (size_t)ctx->inputlen);
+
+  memcpy (acc, ctx->acc, sizeof (acc));
+  count = ctx->stripes;
+  if (ctx->bufferlen >= XXH3_STRIPE_SIZE)
+    {
+      n = (ctx->bufferlen - 1) / XXH3_STRIPE_SIZE;
+      xxh3_consume (acc, &count, ctx->buffer, n, ctx->secret);
+      return xxh3_finish (acc,
+                          ctx->buffer + ctx->bufferlen - XXH3_STRIPE_SIZE,
+                          ctx->secret, ctx->inputlen);
+    }
+  n = XXH3_STRIPE_SIZE - ctx->bufferlen;
+  memcpy (stripe, ctx->buffer + XXH3_BUFFER_SIZE - n, n);
+  memcpy (stripe + n, ctx->buffer, ctx->bufferlen);
+  return xxh3_finish (acc, stripe, ctx->secret, ctx->inputlen);
+}
@@ -0,0 +1,82 @@
+/*-
+ * Copyright (c) 2023, Collin Funk
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef XXHASH_H
+#define XXHASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fcrypt_align.h"
+
+/*
+ * XXH64 and the 64-bit XXH3 from the xxHash family. These are fast
+ * non-cryptographic hashes for hash tables and checksums, not MACs: anyone
+ * can produce collisions for any seed.
+ */
+
+#define XXH64_BLOCK_SIZE 32
+
+/* XXH3 works on stripes of 64 bytes and buffers four of them. */
+#define XXH3_STRIPE_SIZE 64
+#define XXH3_BUFFER_SIZE 256
+#define XXH3_SECRET_SIZE 192
+
+struct xxh64_ctx
+{
+  uint64_t state[4];                /* Four lanes. */
+  uint64_t inputlen;                /* Total bytes. */
+  uint64_t seed;                    /* Seed for short inputs. */
+  uint8_t buffer[XXH64_BLOCK_SIZE]; /* Input buffer. */
+  uint8_t bufferlen;                /* Used bytes in buffer. */
+};
+
+struct xxh3_ctx
+{
+  FCRYPT_CACHE_ALIGNED uint64_t acc[8]; /* Accumulators. */
+  uint8_t secret[XXH3_SECRET_SIZE];     /* Secret derived from seed. */
+  uint8_t buffer[XXH3_BUFFER_SIZE];     /* Input buffer. */
+  uint64_t inputlen;                    /* Total bytes. */
+  uint64_t seed;                        /* Seed for short inputs. */
+  size_t bufferlen;                     /* Used bytes in buffer. */
+  size_t stripes;                       /* Stripes in current block. */
+};
+
+/*
+ * The streaming functions follow the other hashes, except that the final
+ * functions return the hash as an integer and leave the context unchanged,
+ * so more input may be added after reading an intermediate value.
+ */
+void xxh64_init (struct xxh64_ctx *, uint64_t);
+void xxh64_update (struct xxh64_ctx *, const void *, size_t);
+uint64_t xxh64_final (const struct xxh64_ctx *);
+uint64_t xxh64 (uint64_t, const void *, size_t);
+
+void xxh3_init (struct xxh3_ctx *, uint64_t);
+void xxh3_update (struct xxh3_ctx *, const void *, size_t);
+uint64_t xxh3_final (const struct xxh3_ctx *);
+uint64_t xxh3 (uint64_t, const void *, size_t);
+
+#endif /* XXHASH_H */